@@ -0,0 +1,93 @@
+/*==============================================================================
+ * @file    anim_bench.c
+ * @brief   Panel traffic of the span-delta animations, tick by tick.
+ *
+ * Runs the boot logo (2 s), the PVP winner bars (6 s) and the countdown
+ * overlay on the virtual clock at 16 ms ticks, and prints the total and
+ * worst-tick SPI bytes, windows and wire time at 8 MHz SCK. With an output
+ * path it also saves the final screen of each as a PNG.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude -Ihost host/anim_bench.c \
+ *       host/host_timer.c src/gfx.c src/ssd1351.c src/ssd1351_emu.c \
+ *       src/hud.c src/logo_anim.c src/logo_anim_frames.c src/winner2.c \
+ *       -o anim_bench && ./anim_bench [png-prefix]
+ *============================================================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "project.h"
+#include "gfx.h"
+#include "ssd1351.h"
+#include "ssd1351_emu.h"
+#include "logo_anim.h"
+#include "winner2.h"
+#include "host_timer.h"
+
+#define TICK_MS 16u
+
+typedef struct {
+  uint32_t bytes, windows, ticks;
+  uint64_t ns;
+  uint32_t worst_bytes;
+  uint64_t worst_ns;
+} acc_t;
+
+static uint32_t s_now;
+
+static bool tick_logo(void){ return logo_anim_tick(); }
+static bool tick_winner(void){ return winner2_tick(); }
+static bool tick_countdown(void){ return gfx_countdown_tick(s_now); }
+
+// Run fn every TICK_MS from t0 for ms, one stats window per tick
+static void run(acc_t *a, bool (*fn)(void), uint32_t t0, uint32_t ms){
+  for (s_now = t0; s_now < t0 + ms; s_now += TICK_MS){
+    host_timer_set_us(s_now * 1000u);
+    ssd1351_emu_stats_t s;
+    ssd1351_emu_stats_reset();
+    (void)fn();
+    gfx_jobs_flush();
+    ssd1351_emu_stats(&s);
+    a->bytes += s.bytes; a->windows += s.windows; a->ns += s.wire_ns; a->ticks++;
+    if (s.bytes > a->worst_bytes) a->worst_bytes = s.bytes;
+    if (s.wire_ns > a->worst_ns) a->worst_ns = s.wire_ns;
+  }
+}
+
+static void report(const char *name, const acc_t *a, const char *prefix){
+  printf("  %-10s %4u ticks %9u B %6u win %8.1f ms | worst tick %6u B %6.2f ms\n",
+         name, (unsigned)a->ticks, (unsigned)a->bytes, (unsigned)a->windows,
+         (double)a->ns / 1e6, (unsigned)a->worst_bytes, (double)a->worst_ns / 1e6);
+  if (prefix){
+    char path[256];
+    snprintf(path, sizeof path, "%s_%s.png", prefix, name);
+    (void)ssd1351_emu_dump_png(path);
+  }
+}
+
+int main(int argc, char **argv){
+  const char *prefix = (argc > 1) ? argv[1] : NULL;
+  timer_init();
+  ssd1351_init();
+  gfx_init();
+  ssd1351_emu_set_sck_hz(8000000u);
+
+  acc_t logo = {0}, win = {0}, cd = {0};
+
+  gfx_clear(COL_BLACK);
+  host_timer_set_us(1000u * 1000u);
+  logo_anim_start(2000u);
+  run(&logo, tick_logo, 1000u, 2016u);
+  report("logo", &logo, prefix);
+
+  host_timer_set_us(10000u * 1000u);
+  winner2_start(180.0f, 95.5f);
+  run(&win, tick_winner, 10000u, 6016u);
+  report("winner2", &win, prefix);
+
+  gfx_clear(COL_BLACK);
+  gfx_countdown_begin(20000u, COL_BLACK);
+  run(&cd, tick_countdown, 20000u, 6100u);
+  report("countdown", &cd, prefix);
+  return 0;
+}
@@ -0,0 +1,94 @@
+/*==============================================================================
+ * @file    blit_bench.c
+ * @brief   CPU time of indexed image blits, with the panel replaced by a sink.
+ *
+ * Links ssd1351.c (HOST_SIM) against the byte sink below instead of the
+ * emulator, so the time measured is gfx row expansion plus the driver's
+ * byte loop. Each case reports the best of 5 runs in ns per pixel and a
+ * checksum of the bytes sent, which must not change when only the speed
+ * of a path changes. The same file builds against older trees (it only
+ * uses gfx_blit_pal4() and gfx_blit_image()), so a before/after pair is
+ * two builds of this file. Build with -flto so the sink inlines into the
+ * driver loop the way the SPI register write does on the target; without
+ * it the call per byte dominates.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -flto -DHOST_SIM -Iinclude -Ihost host/blit_bench.c \
+ *       host/host_timer.c src/gfx.c src/ssd1351.c src/story_ch1.c \
+ *       src/tower_dragon.c -o blit_bench && ./blit_bench
+ *============================================================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "project.h"
+#include "gfx.h"
+#include "ssd1351.h"
+#include "story_ch1.h"
+#include "tower_dragon.h"
+#include "host_timer.h"
+
+#define RUNS  5
+#define REPS  200
+
+/* ------------------------------------------------ panel byte sink --- */
+
+static bool     s_cs;
+static uint32_t s_sum, s_bytes;
+
+void ssd1351_emu_cs(bool asserted){ s_cs = asserted; }
+void ssd1351_emu_dc(bool data){ (void)data; }
+void ssd1351_emu_reset(void){}
+void ssd1351_emu_sck(uint32_t hz){ (void)hz; }
+void ssd1351_emu_byte(uint8_t b){
+  if (!s_cs) return;
+  s_sum = (s_sum << 5) + s_sum + b;                    // djb2 over the wire
+  s_bytes++;
+}
+
+/* ----------------------------------------------------------- cases --- */
+
+static uint8_t  s_idx[128 * 128 / 2];
+static uint16_t s_pal[16];
+
+static void draw_pal4(void){ gfx_blit_pal4(0, 0, 128, 128, s_idx, s_pal); }
+static void draw_rle(void){ gfx_blit_image(0, 0, &STORY_CH1_IMG); }
+static void draw_rle_clip(void){ gfx_blit_image(60, 90, &TOWER_DRAGON_IMG); }   // clipped to 68x38
+
+static double now_ns(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+static void bench(const char *name, void (*draw)(void), uint32_t px){
+  s_sum = 5381u; s_bytes = 0;
+  draw();
+  gfx_jobs_flush();
+  uint32_t sum = s_sum, bytes = s_bytes;
+
+  double best = 1e300;
+  for (int r = 0; r < RUNS; ++r){
+    double t0 = now_ns();
+    for (int k = 0; k < REPS; ++k){ draw(); gfx_jobs_flush(); }
+    double dt = now_ns() - t0;
+    if (dt < best) best = dt;
+  }
+  printf("  %-24s %6.2f ns/px  %6u B  wire sum %08x\n",
+         name, best / REPS / px, (unsigned)bytes, (unsigned)sum);
+}
+
+int main(void){
+  timer_init();
+  ssd1351_init();
+  gfx_init();
+
+  uint32_t x = 12345u;                                 // fixed pseudo-random image
+  for (unsigned i = 0; i < sizeof s_idx; ++i){ x = x * 1664525u + 1013904223u; s_idx[i] = (uint8_t)(x >> 24); }
+  for (unsigned i = 0; i < 16; ++i){ x = x * 1664525u + 1013904223u; s_pal[i] = (uint16_t)(x >> 16); }
+
+  bench("pal4 128x128",           draw_pal4,     128u * 128u);
+  bench("rle STORY_CH1",          draw_rle,      (uint32_t)STORY_CH1_W * STORY_CH1_H);
+  bench("rle TOWER_DRAGON clipped", draw_rle_clip, (128u - 60u) * (128u - 90u));
+  return 0;
+}
@@ -0,0 +1,53 @@
+#!/bin/sh
+# code_size.sh
+# Code and constant size of the mode flows (the scene-table modules), per
+# file and in total, for the working tree or for git revisions:
+#   host/code_size.sh              working tree
+#   host/code_size.sh REV [REV..]  each revision, via git archive
+# Uses arm-none-eabi-gcc (Cortex-M4F, -Os) when it is on PATH. Otherwise
+# it falls back to gcc -m32 -Os -fno-pic without unwind tables (needs
+# gcc-multilib), which has the target's 4-byte pointers and keeps const
+# tables out of RAM; use it for before/after deltas, not absolute flash.
+# EXTRA_CFLAGS is appended to the compile line.
+set -e
+
+FILES="scene game_single game_two game_four game_tower game_story menu end_credits"
+
+if command -v arm-none-eabi-gcc >/dev/null 2>&1; then
+  CC=arm-none-eabi-gcc
+  SIZE=arm-none-eabi-size
+  CFLAGS="-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-sp-d16"
+else
+  CC=gcc
+  SIZE=size
+  CFLAGS="-m32 -fno-pic -fno-asynchronous-unwind-tables -fno-unwind-tables"
+fi
+CFLAGS="$CFLAGS -std=gnu99 -Os -w -ffunction-sections -fdata-sections -DADS_FRONTEND_M04=1"
+
+measure() {   # $1 = tree root
+  out=$(mktemp -d)
+  for f in $FILES; do
+    [ -f "$1/src/$f.c" ] || continue
+    $CC $CFLAGS $EXTRA_CFLAGS -I"$1/include" -c "$1/src/$f.c" -o "$out/$f.o"
+  done
+  (cd "$out" && $SIZE -t *.o | awk 'NR > 1 { printf "  %-16s %6d B\n", $6, $1 + $2 }')
+  rm -rf "$out"
+}
+
+root=$(git rev-parse --show-toplevel)
+if [ $# -eq 0 ]; then
+  echo "working tree ($CC)"
+  measure "$root"
+  exit 0
+fi
+for rev in "$@"; do
+  tree=$(mktemp -d)
+  git -C "$root" archive "$rev" src include | tar -x -C "$tree"
+  # Older trees: project.h fixes ADS_FRONTEND_M04 (game_four would be
+  # empty) and end_credits.c includes the logo header in lower case
+  sed -i 's/^#define ADS_FRONTEND_M04 0/#define ADS_FRONTEND_M04 1/' "$tree/include/project.h"
+  [ -f "$tree/include/msu_logo.h" ] || cp "$tree/include/MSU_logo.h" "$tree/include/msu_logo.h"
+  echo "$rev ($CC)"
+  measure "$tree"
+  rm -rf "$tree"
+done
@@ -0,0 +1,111 @@
+/*==============================================================================
+ * @file    duel_sim.c
+ * @brief   Simulated PVP matches scored by duel_step(), against the truth.
+ *
+ * Each match draws a true mean rate per player and a true gap (0 in 30% of
+ * matches, 5-15% in 30%, 15-60% in 40%), then plays a 10 s round of 100 ms
+ * windows whose rates carry AR(1) noise with lag-1 correlation rho and
+ * relative spread cv. Windows go through round_acc and duel_step() as in
+ * game_two. Prints how often the round was called early, the average
+ * round length, wrong winners among real gaps, ties called within the
+ * margin, and the wrong winners of the old full-length '>' comparison.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude host/duel_sim.c src/duel.c \
+ *       src/round_acc.c -lm -o duel_sim && ./duel_sim [rho cv]
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "project.h"
+#include "emg_pipe.h"
+#include "round_acc.h"
+#include "duel.h"
+
+#define MATCHES  20000
+#define FLEX_MS  10000u
+
+static uint64_t s_rng = 88172645463325252ull;
+
+// xorshift64, uniform in [0, 1)
+static double urand(void){
+  s_rng ^= s_rng << 13; s_rng ^= s_rng >> 7; s_rng ^= s_rng << 17;
+  return (double)(s_rng >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Box-Muller, standard normal
+static double nrand(void){
+  double u = urand(), v = urand();
+  if (u < 1e-12) u = 1e-12;
+  return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+int main(int argc, char **argv){
+  double rho = (argc > 2) ? atof(argv[1]) : 0.5;
+  double cv  = (argc > 2) ? atof(argv[2]) : 0.25;
+  long early = 0, n_real = 0, called = 0, wrong = 0, tie_real = 0;
+  long n_close = 0, tie_close = 0, legacy_wrong = 0;
+  double saved_ms = 0.0;
+
+  for (int i = 0; i < MATCHES; ++i){
+    double mu[2], e[2] = {0.0, 0.0};
+    mu[0] = 30.0 + 90.0 * urand();
+    double g = urand();
+    double gap = (g < 0.3) ? 0.0 : (g < 0.6) ? 0.05 + 0.10 * urand() : 0.15 + 0.45 * urand();
+    if (urand() < 0.5) gap = -gap;
+    mu[1] = mu[0] * (1.0 + gap);
+
+    round_acc_begin(0u, 0u, 0u, FLEX_MS, ROUND_ACTIVE_HZ);
+    round_acc_begin(1u, 1u, 0u, FLEX_MS, ROUND_ACTIVE_HZ);
+    duel_t d;
+    duel_reset(&d);
+    duel_verdict_t v = DUEL_OPEN;
+    uint32_t end_ms = FLEX_MS;
+
+    for (uint32_t t = EMG_PIPE_WINDOW_MS; t <= FLEX_MS; t += EMG_PIPE_WINDOW_MS){
+      metrics_t m = {0};
+      m.t_ms = t;
+      for (int p = 0; p < 2; ++p){
+        e[p] = rho * e[p] + sqrt(1.0 - rho * rho) * nrand();
+        double hz = mu[p] * (1.0 + cv * e[p]);
+        m.hz[p] = (hz < 0.0) ? 0.0f : (float)hz;
+      }
+      round_acc_feed(&m, t - EMG_PIPE_WINDOW_MS);
+
+      round_stats_t a, b;
+      (void)round_acc_peek(0u, &a);
+      (void)round_acc_peek(1u, &b);
+      if (t < FLEX_MS){
+        v = duel_step(&d, &a, &b, t, false);
+        if (v != DUEL_OPEN){ end_ms = t; break; }
+      } else {
+        v = duel_step(&d, &a, &b, t, true);
+        bool p1_ahead = a.active_hz > b.active_hz;
+        if (gap != 0.0 && (p1_ahead ? mu[0] < mu[1] : mu[1] < mu[0])) legacy_wrong++;
+      }
+    }
+    if (end_ms < FLEX_MS){ early++; saved_ms += FLEX_MS - end_ms; }
+
+    duel_verdict_t truth = (mu[0] > mu[1]) ? DUEL_P1 : DUEL_P2;
+    double margin = TIE_MARGIN_PCT * 0.01 * fmax(mu[0], mu[1]);
+    if (fabs(mu[0] - mu[1]) > margin){
+      n_real++;
+      if (v == DUEL_TIE) tie_real++;
+      else { called++; if (v != truth) wrong++; }
+    } else {
+      n_close++;
+      if (v == DUEL_TIE) tie_close++;
+    }
+  }
+
+  printf("rho %.2f, cv %.2f, %d matches\n", rho, cv, MATCHES);
+  printf("  early calls %.1f%%, average round %.2f s\n", 100.0 * early / MATCHES,
+         (FLEX_MS * (double)MATCHES - saved_ms) / MATCHES / 1000.0);
+  printf("  gap > margin: %ld; winner called %.1f%%, wrong winner %.2f%%, tie %.1f%%\n",
+         n_real, 100.0 * called / n_real, 100.0 * wrong / (called ? called : 1),
+         100.0 * tie_real / n_real);
+  printf("  gap within margin: %ld; tie called %.1f%%\n", n_close, 100.0 * tie_close / n_close);
+  printf("  old full-length '>' wrong winner: %.2f%%\n", 100.0 * legacy_wrong / MATCHES);
+  return 0;
+}
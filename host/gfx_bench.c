@@ -0,0 +1,145 @@
+/*==============================================================================
+ * @file    gfx_bench.c
+ * @brief   Panel traffic of gfx drawing calls, measured on the emulator.
+ *
+ * Each case draws once on a fresh panel and prints what ssd1351_emu counted:
+ * window set-ups, CS assertions, SPI bytes and wire time at 8 MHz SCK.
+ * Pass a section name to run only that section.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude -Ihost host/gfx_bench.c \
+ *       host/host_timer.c src/gfx.c src/ssd1351.c src/ssd1351_emu.c \
+ *       -o gfx_bench && ./gfx_bench [text] [shapes]
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "project.h"
+#include "gfx.h"
+#include "ssd1351.h"
+#include "ssd1351_emu.h"
+#include "host_timer.h"
+
+static void begin(void){
+  gfx_clear(COL_BLACK);
+  gfx_jobs_flush();
+  ssd1351_emu_stats_reset();
+}
+
+static void report(const char *name){
+  ssd1351_emu_stats_t s;
+  gfx_jobs_flush();
+  ssd1351_emu_stats(&s);
+  printf("  %-28s %5u win %5u cs %7u B %9.1f us\n", name, (unsigned)s.windows,
+         (unsigned)s.cs_assertions, (unsigned)s.bytes, (double)s.wire_ns / 1000.0);
+}
+
+static bool wanted(int argc, char **argv, const char *section){
+  if (argc < 2) return true;
+  for (int i = 1; i < argc; ++i) if (strcmp(argv[i], section) == 0) return true;
+  return false;
+}
+
+/* ---------------------------------------------------------------- text --- */
+
+// Text rows rasterized into the line buffer and sent through one window
+static void bench_text(void){
+  char name[40];
+  printf("text (\"Hz: 123.4\")\n");
+  for (uint8_t sc = 1; sc <= 3; ++sc){
+    begin(); gfx_text2(0, 20, "Hz: 123.4", COL_WHITE, sc);
+    snprintf(name, sizeof name, "gfx_text2 s%u", (unsigned)sc); report(name);
+  }
+  for (uint8_t sc = 1; sc <= 3; ++sc){
+    begin(); gfx_text2_bg(0, 20, "Hz: 123.4", COL_WHITE, COL_BLACK, sc);
+    snprintf(name, sizeof name, "gfx_text2_bg s%u", (unsigned)sc); report(name);
+  }
+  begin(); gfx_header("FLEX!", COL_WHITE);                       report("gfx_header s2");
+  begin(); gfx_header("GET READY P2", COL_WHITE);                report("gfx_header s1");
+  begin(); gfx_text2_field(6, 28, 120, 16, "Hz: 123.4", COL_WHITE, COL_BLACK, 2);
+  report("flex readout (field)");
+  begin(); gfx_bar(6, 28, 120, 16, COL_BLACK); gfx_text2(6, 28, "Hz: 123.4", COL_WHITE, 2);
+  report("flex readout (bar + text)");
+}
+
+/* -------------------------------------------------------------- shapes --- */
+
+static uint8_t s_ref[128][128];
+
+// Reference Bresenham, the same tie rule as gfx.c's span walker
+static void ref_line(int x0, int y0, int x1, int y1){
+  int t, steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep){ t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+  if (x0 > x1){ t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+  int dx = x1 - x0, dy = abs(y1 - y0), err = dx / 2, sy = (y0 < y1) ? 1 : -1;
+  for (int x = x0, y = y0; x <= x1; ++x){
+    if (steep) s_ref[x][y] = 1; else s_ref[y][x] = 1;
+    err -= dy;
+    if (err < 0){ y += sy; err += dx; }
+  }
+}
+
+// Random X shapes against two reference lines each: boxes that differ
+static int check_lines(int n){
+  int bad = 0;
+  srand(1);
+  for (int k = 0; k < n; ++k){
+    int x = rand() % 128, y = rand() % 128;
+    int w = 1 + rand() % (128 - x), h = 1 + rand() % (128 - y);
+    if (k % 7 == 0) h = 1;                             // axis-aligned cases
+    if (k % 11 == 0) w = 1;
+    gfx_bar((uint8_t)x, (uint8_t)y, (uint8_t)w, (uint8_t)h, COL_BLACK);
+    gfx_xshape((uint8_t)x, (uint8_t)y, (uint8_t)w, (uint8_t)h, COL_WHITE);
+    for (int j = y; j < y + h; ++j) memset(&s_ref[j][x], 0, (size_t)w);
+    ref_line(x, y, x + w - 1, y + h - 1);
+    ref_line(x + w - 1, y, x, y + h - 1);
+    for (int j = y; j < y + h; ++j)
+      for (int i = x; i < x + w; ++i)
+        if ((ssd1351_emu_pixel((uint8_t)i, (uint8_t)j) != COL_BLACK) != s_ref[j][i]){
+          bad++;
+          j = y + h;
+          break;
+        }
+  }
+  return bad;
+}
+
+// Filled triangles must cover their vertices
+static int check_triangles(int n){
+  int bad = 0;
+  srand(2);
+  for (int k = 0; k < n; ++k){
+    uint8_t p[6];
+    for (int i = 0; i < 6; ++i) p[i] = (uint8_t)(rand() % 128);
+    gfx_clear(COL_BLACK);
+    gfx_triangle(p[0], p[1], p[2], p[3], p[4], p[5], COL_WHITE);
+    for (int i = 0; i < 6; i += 2)
+      if (ssd1351_emu_pixel(p[i], p[i + 1]) == COL_BLACK){ bad++; break; }
+  }
+  return bad;
+}
+
+// Lines, rect outlines and triangles as runs of windowed spans
+static void bench_shapes(void){
+  printf("shapes\n");
+  begin(); gfx_rect(1, 112, 127, 12, COL_WHITE);                report("gfx_rect 127x12 frame");
+  begin(); gfx_rect(109, 0, 17, 17, COL_WHITE);                 report("gfx_rect 17x17");
+  begin(); gfx_xshape(110, 1, 15, 15, COL_WHITE);               report("gfx_xshape 15x15");
+  begin(); gfx_xshape(0, 0, 128, 40, COL_WHITE);                report("gfx_xshape 128x40");
+  begin(); gfx_triangle(127, 122, 122, 127, 122, 117, COL_WHITE); report("gfx_triangle next-arrow");
+  begin(); gfx_triangle(10, 10, 100, 30, 40, 90, COL_WHITE);    report("gfx_triangle large");
+  printf("  line mismatches vs reference Bresenham: %d of 20000\n", check_lines(20000));
+  printf("  triangles missing a vertex: %d of 2000\n", check_triangles(2000));
+}
+
+int main(int argc, char **argv){
+  timer_init();
+  ssd1351_init();
+  gfx_init();
+  ssd1351_emu_set_sck_hz(8000000u);
+
+  if (wanted(argc, argv, "text"))   bench_text();
+  if (wanted(argc, argv, "shapes")) bench_shapes();
+  return 0;
+}
@@ -0,0 +1,22 @@
+/*==============================================================================
+ * @file    host_timer.c
+ * @brief   Virtual clock implementing timer.h for host programs.
+ *
+ * Link this instead of src/timer.c when building with -DHOST_SIM.
+ *============================================================================*/
+#include <stdint.h>
+#include "host_timer.h"
+
+static uint32_t s_us = 0;
+
+void host_timer_set_us(uint32_t us){ s_us = us; }
+
+void host_timer_advance_us(uint32_t us){ s_us += us; }
+
+void timer_init(void){ s_us = 0; }
+
+uint32_t millis(void){ return s_us / 1000u; }
+
+uint32_t micros(void){ return s_us; }
+
+void delay_ms(uint32_t ms){ s_us += ms * 1000u; }
@@ -0,0 +1,31 @@
+/**
+ * @file host_timer.h
+ * @brief Virtual clock behind timer.h for host programs (host/).
+ *
+ * host_timer.c implements timer_init(), millis(), micros() and delay_ms()
+ * on a counter that only moves when the program moves it, so runs are
+ * repeatable and a simulated minute takes no wall time. delay_ms() just
+ * advances the clock.
+ */
+
+#ifndef HOST_TIMER_H
+#define HOST_TIMER_H
+
+#include <stdint.h>
+#include "timer.h"
+
+/**
+ * @brief Set the virtual time.
+ *
+ * @param us Microseconds since start.
+ */
+void host_timer_set_us(uint32_t us);
+
+/**
+ * @brief Move the virtual time forward.
+ *
+ * @param us Microseconds to add.
+ */
+void host_timer_advance_us(uint32_t us);
+
+#endif /* HOST_TIMER_H */
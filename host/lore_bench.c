@@ -0,0 +1,175 @@
+/*==============================================================================
+ * @file    lore_bench.c
+ * @brief   Packed lore pages: decode check and decode cost per character.
+ *
+ * Decodes every line of every LORE_TEXT page with gfx_bpe_open() and
+ * gfx_bpe_next() and compares it with image_converter/lore_text.txt, the
+ * source lore2bpe.py packed it from, then opens each line at every offset
+ * and checks the character there (the skip path). Then times, best of 5
+ * runs, in host ns per character:
+ *   stream     open each line once and read it to the end
+ *   open+skip  open at offset k and read one character, for every k, the
+ *              access pattern of the typewriter redrawing a row
+ * Exits 1 on any mismatch. Run it after editing lore_text.txt and
+ * repacking, or after touching the decoder.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude -Ihost host/lore_bench.c \
+ *       host/host_timer.c src/gfx.c src/ssd1351.c src/ssd1351_emu.c \
+ *       src/lore_text.c -o lore_bench && ./lore_bench [lore_text.txt]
+ *============================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <time.h>
+#include "project.h"
+#include "gfx.h"
+#include "lore_text.h"
+
+#define RUNS      5
+#define REPS      2000
+#define MAX_LINES 16
+#define TEXT_MAX  64
+
+static char     s_src[LORE_PAGES][MAX_LINES][TEXT_MAX];
+static uint8_t  s_src_lines[LORE_PAGES];
+static volatile char s_sink;
+
+// Trim both ends in place, the way lore2bpe.py strips
+static char *trim(char *s){
+  while (isspace((unsigned char)*s)) s++;
+  char *e = s + strlen(s);
+  while (e > s && isspace((unsigned char)e[-1])) *--e = '\0';
+  return s;
+}
+
+// Pages in file order, which is LORE_* order
+static int load_source(const char *path){
+  FILE *f = fopen(path, "r");
+  if (!f){ perror(path); return -1; }
+  char raw[256];
+  int page = -1;
+  while (fgets(raw, sizeof(raw), f)){
+    char *l = trim(raw);
+    if (!*l || *l == '#') continue;
+    if (!strncmp(l, "page ", 5)){
+      if (++page >= LORE_PAGES) break;
+    } else if (*l == '|' && page >= 0 && s_src_lines[page] < MAX_LINES){
+      snprintf(s_src[page][s_src_lines[page]++], TEXT_MAX, "%s", trim(l + 1));
+    }
+  }
+  fclose(f);
+  if (page + 1 != LORE_PAGES){
+    printf("%s has %d pages, LORE_TEXT has %u\n", path, page + 1, (unsigned)LORE_PAGES);
+    return -1;
+  }
+  return 0;
+}
+
+static const uint8_t *next_line(const uint8_t *d){
+  while (*d++) {}
+  return d;
+}
+
+static unsigned check_page(uint8_t pg){
+  const gfx_bpe_page_t *p = &LORE_TEXT[pg];
+  const uint8_t *d = p->data;
+  unsigned bad = 0;
+
+  if (p->count != s_src_lines[pg]){
+    printf("page %u: %u lines packed, %u in the source\n",
+           (unsigned)pg, (unsigned)p->count, (unsigned)s_src_lines[pg]);
+    return 1;
+  }
+  for (uint8_t i = 0; i < p->count; i++, d = next_line(d)){
+    const char *want = s_src[pg][i];
+    char got[TEXT_MAX];
+    uint16_t n = 0;
+    gfx_bpe_reader_t r;
+    gfx_bpe_open(&r, p->bpe, d, 0);
+    for (char c; (c = gfx_bpe_next(&r)) != 0 && n < TEXT_MAX - 1; ) got[n++] = c;
+    got[n] = '\0';
+    if (strcmp(got, want)){
+      printf("page %u line %u: \"%s\", expected \"%s\"\n", (unsigned)pg, (unsigned)i, got, want);
+      bad++;
+      continue;
+    }
+    for (uint16_t k = 0; k <= n; k++){
+      gfx_bpe_open(&r, p->bpe, d, k);
+      if (gfx_bpe_next(&r) != want[k]){
+        printf("page %u line %u: skip %u wrong\n", (unsigned)pg, (unsigned)i, (unsigned)k);
+        bad++;
+        break;
+      }
+    }
+  }
+  return bad;
+}
+
+static uint32_t stream_all(void){
+  uint32_t chars = 0;
+  for (uint8_t pg = 0; pg < LORE_PAGES; pg++){
+    const gfx_bpe_page_t *p = &LORE_TEXT[pg];
+    const uint8_t *d = p->data;
+    for (uint8_t i = 0; i < p->count; i++, d = next_line(d)){
+      gfx_bpe_reader_t r;
+      gfx_bpe_open(&r, p->bpe, d, 0);
+      for (char c; (c = gfx_bpe_next(&r)) != 0; chars++) s_sink = c;
+    }
+  }
+  return chars;
+}
+
+static uint32_t open_skip_all(void){
+  uint32_t chars = 0;
+  for (uint8_t pg = 0; pg < LORE_PAGES; pg++){
+    const gfx_bpe_page_t *p = &LORE_TEXT[pg];
+    const uint8_t *d = p->data;
+    for (uint8_t i = 0; i < p->count; i++, d = next_line(d)){
+      uint16_t n = (uint16_t)strlen(s_src[pg][i]);
+      for (uint16_t k = 0; k < n; k++, chars++){
+        gfx_bpe_reader_t r;
+        gfx_bpe_open(&r, p->bpe, d, k);
+        s_sink = gfx_bpe_next(&r);
+      }
+    }
+  }
+  return chars;
+}
+
+static double now_ns(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+static void bench(const char *name, uint32_t (*pass)(void)){
+  uint32_t chars = pass();
+  double best = 1e300;
+  for (int r = 0; r < RUNS; ++r){
+    double t0 = now_ns();
+    for (int k = 0; k < REPS; ++k) (void)pass();
+    double dt = now_ns() - t0;
+    if (dt < best) best = dt;
+  }
+  printf("  %-10s %6.1f ns/char  (%u chars per pass)\n",
+         name, best / REPS / chars, (unsigned)chars);
+}
+
+int main(int argc, char **argv){
+  const char *path = (argc > 1) ? argv[1] : "image_converter/lore_text.txt";
+  if (load_source(path)) return 1;
+
+  unsigned bad = 0, lines = 0;
+  for (uint8_t pg = 0; pg < LORE_PAGES; pg++){
+    bad   += check_page(pg);
+    lines += LORE_TEXT[pg].count;
+  }
+  printf("%u pages, %u lines, %u B packed + %u codes: %s\n", (unsigned)LORE_PAGES, lines,
+         (unsigned)LORE_DATA_SIZE, (unsigned)LORE_CODES, bad ? "MISMATCH" : "all lines and skips match");
+
+  bench("stream", stream_all);
+  bench("open+skip", open_skip_all);
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+/*==============================================================================
+ * @file    pipe_bench.c
+ * @brief   CPU time of the DSP path per ADC frame and per window.
+ *
+ * Pushes 600 s of synthetic EMG at 1 kSPS (every channel alternating 2 s
+ * of flex and 2 s of rest, staggered by channel) through emg_pipe_push(),
+ * and closes each 100 ms window with emg_pipe_close(), metrics_publish()
+ * and round_acc_feed() as main.c's DSP task does. Prints the host time per
+ * frame, per window and per second of signal. Build with
+ * -DADS_FRONTEND_M04=1 for the four-channel front end.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -DADS_FRONTEND_M04=1 -Iinclude -Ihost \
+ *       host/pipe_bench.c host/host_timer.c src/emg_pipe.c src/metrics.c \
+ *       src/round_acc.c -o pipe_bench && ./pipe_bench
+ *============================================================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include "project.h"
+#include "emg_pipe.h"
+#include "metrics.h"
+#include "round_acc.h"
+#include "host_timer.h"
+
+#define SECS    600u
+#define FRAMES  (SECS * 1000u)
+
+static int16_t s_frames[FRAMES][EMG_PIPE_CH];
+
+static double now_ns(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+int main(void){
+  uint32_t x = 12345u;
+  for (uint32_t i = 0; i < FRAMES; ++i)
+    for (unsigned c = 0; c < EMG_PIPE_CH; ++c){
+      x = x * 1664525u + 1013904223u;
+      int32_t amp = ((i / 2000u + c) & 1u) ? 3000 : 40;     // flex / rest
+      s_frames[i][c] = (int16_t)((int32_t)(x >> 16) % (2 * amp + 1) - amp);
+    }
+
+  timer_init();
+
+  // Pushes alone
+  emg_pipe_init(0);
+  double t0 = now_ns();
+  for (uint32_t i = 0; i < FRAMES; ++i) emg_pipe_push(s_frames[i]);
+  double push_ns = now_ns() - t0;
+
+  // The DSP task: push every frame, close every window
+  emg_pipe_init(0);
+  emg_pipe_baseline_begin(EMG_PIPE_ALL, 3000u);
+  for (uint8_t p = 0; p < EMG_PIPE_CH && p < ROUND_ACC_SLOTS; ++p)
+    round_acc_begin(p, p, 0, FRAMES, ROUND_ACTIVE_HZ);
+
+  metrics_t m = {0};
+  double close_ns = 0.0;
+  unsigned closes = 0;
+  t0 = now_ns();
+  for (uint32_t i = 0; i < FRAMES; ++i){
+    host_timer_set_us(i * 1000u);
+    emg_pipe_push(s_frames[i]);
+    if (emg_pipe_due(i)){
+      double c0 = now_ns();
+      uint32_t from = emg_pipe_close(i, &m);
+      metrics_publish(&m);
+      round_acc_feed(&m, from);
+      close_ns += now_ns() - c0;
+      closes++;
+    }
+  }
+  double all_ns = now_ns() - t0;
+
+  printf("%u frames x %u ch, %u windows\n", (unsigned)FRAMES, (unsigned)EMG_PIPE_CH, closes);
+  printf("  push                  %8.1f ns/frame\n", push_ns / FRAMES);
+  printf("  close+publish+feed    %8.1f ns/window\n", close_ns / closes);
+  printf("  DSP path              %8.1f us per second of signal\n", all_ns / SECS / 1000.0);
+  printf("  last window Hz:");
+  for (unsigned c = 0; c < EMG_PIPE_CH; ++c) printf(" %.1f", m.hz[c]);
+  printf("\n");
+  return 0;
+}
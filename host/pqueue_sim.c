@@ -0,0 +1,91 @@
+/*==============================================================================
+ * @file    pqueue_sim.c
+ * @brief   Background calibration of queued players, 130 s scripted run.
+ *
+ * Feeds every channel with low-level noise at 1 kSPS through emg_pipe and
+ * runs pqueue_service() after each window as main.c's DSP task does. The
+ * check-in flexes are scripted (1 s of full-scale noise on one channel),
+ * and a round begins every 30 s from 20 s on. One check-in lands while the
+ * freed ch1 is refreshing its idle baseline (95-98 s) and must still be
+ * taken. Prints each round's seats and whether queued players took them,
+ * then the calibration time players had to watch. The argument is the
+ * number of seats per round; build with -DADS_FRONTEND_M04=1 for the
+ * four-channel front end.
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude -Ihost host/pqueue_sim.c \
+ *       host/host_timer.c src/emg_pipe.c src/pqueue.c -lm -o pqueue_sim && \
+ *       ./pqueue_sim [seats]
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "project.h"
+#include "emg_pipe.h"
+#include "pqueue.h"
+#include "host_timer.h"
+
+#define RUN_MS     130000u
+#define CAL_MS       3000u    // visible baseline window of a round
+#define FLEX_MS      1000u
+#define REST_AMP        5
+#define FLEX_AMP     3000
+
+// Check-in flexes: channel, start (ms); channels past EMG_PIPE_CH are skipped
+static const uint32_t k_flex[][2] = {
+  { 1u, 12000u }, { 2u, 15000u }, { 3u, 16000u }, { 0u, 41000u }, { 1u, 96000u },
+};
+static const uint32_t k_round_ms[] = { 20000u, 50000u, 80000u, 110000u };
+
+static uint32_t s_seed = 1u;
+
+static int16_t noise(int amp){
+  s_seed = s_seed * 1664525u + 1013904223u;
+  return (int16_t)((int32_t)(s_seed >> 16) % (2 * amp + 1) - amp);
+}
+
+static bool flexing(uint8_t c, uint32_t now){
+  for (unsigned i = 0; i < sizeof k_flex / sizeof k_flex[0]; i++){
+    if (k_flex[i][0] == c && now - k_flex[i][1] < FLEX_MS) return true;
+  }
+  return false;
+}
+
+int main(int argc, char **argv){
+  uint8_t seats = (argc > 1) ? (uint8_t)atoi(argv[1]) : 1u;
+  unsigned r = 0, handoffs = 0;
+  uint32_t visible_ms = 0;
+
+  timer_init();
+  emg_pipe_init(0);
+  emg_pipe_baseline_begin(EMG_PIPE_ALL, CAL_MS);
+  pqueue_init(0);
+
+  for (uint32_t now = 0; now < RUN_MS; ++now){
+    host_timer_set_us(now * 1000u);
+
+    int16_t s[EMG_PIPE_CH];
+    for (uint8_t c = 0; c < EMG_PIPE_CH; c++) s[c] = noise(flexing(c, now) ? FLEX_AMP : REST_AMP);
+    emg_pipe_push(s);
+
+    if (emg_pipe_due(now)){
+      metrics_t m;
+      (void)emg_pipe_close(now, &m);
+      pqueue_service(&m, now);
+    }
+
+    if (r < sizeof k_round_ms / sizeof k_round_ms[0] && now == k_round_ms[r]){
+      bool handed = pqueue_round_begin(seats, CAL_MS);
+      printf("t=%6u round %u: %-9s seats:", (unsigned)now, ++r, handed ? "hand-off" : "calibrate");
+      for (uint8_t i = 0; i < seats; i++) printf(" ch%u", (unsigned)pqueue_seat(i));
+      printf("  queued=%u\n", (unsigned)pqueue_ready());
+      if (handed) handoffs++;
+      else        visible_ms += CAL_MS;
+    }
+  }
+
+  printf("%u channel(s), %u seat(s): %u of %u rounds handed off, %u ms of visible calibration\n",
+         (unsigned)EMG_PIPE_CH, (unsigned)seats, handoffs, r, (unsigned)visible_ms);
+  return 0;
+}
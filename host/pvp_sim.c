@@ -0,0 +1,112 @@
+/*==============================================================================
+ * @file    pvp_sim.c
+ * @brief   PVP head-to-head on two synthetic EMG channels, end to end.
+ *
+ * Feeds two sine channels at 1 kSPS through emg_pipe, metrics, round_acc,
+ * pqueue and game_two on the virtual clock the way main.c's DSP and game
+ * tasks do, with the panel on the emulator. Each channel idles at its
+ * baseline rate until both baselines are measured, then rises by its
+ * player's flex rate. The program stops when game_two shows the winner
+ * screen and prints the baselines, both results and the time from mode
+ * entry; the results should read back the flex rates (exit status 1 if
+ * either is off by 1 Hz or more).
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude -Ihost host/pvp_sim.c \
+ *       host/host_timer.c src/gfx.c src/ssd1351.c src/ssd1351_emu.c \
+ *       src/hud.c src/game_two.c src/emg_pipe.c src/metrics.c \
+ *       src/round_acc.c src/pqueue.c src/duel.c src/rankhist.c \
+ *       src/scene.c src/game_two_logo.c src/pvp_tie_pic.c \
+ *       src/you_win_p1_pic.c src/you_win_p2_pic.c -lm -o pvp_sim && \
+ *       ./pvp_sim [p1-hz p2-hz]
+ *============================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "project.h"
+#include "gfx.h"
+#include "ssd1351.h"
+#include "emg_pipe.h"
+#include "metrics.h"
+#include "round_acc.h"
+#include "pqueue.h"
+#include "game_two.h"
+#include "host_timer.h"
+
+#define BASE_P1_HZ  10.0
+#define BASE_P2_HZ  24.0
+#define TICK_MS     16u
+#define LIMIT_MS    60000u
+
+/* ------------------------------------------ stand-ins for game_two's peers --- */
+
+static uint32_t s_result_ms;
+static float    s_r1, s_r2;
+
+bool cheevos_unlock(int id){ (void)id; return false; }
+
+void winner2_start(float p1_hz, float p2_hz){
+  if (s_result_ms) return;
+  s_result_ms = millis();
+  s_r1 = p1_hz; s_r2 = p2_hz;
+}
+
+bool winner2_tick(void){ return true; }
+
+/* ------------------------------------------------------------------------ */
+
+// One rising zero crossing per period
+static int16_t synth(double t, double hz){ return (int16_t)(800.0 * sin(2.0 * M_PI * hz * t)); }
+
+int main(int argc, char **argv){
+  double f1 = (argc > 2) ? atof(argv[1]) : 55.0;
+  double f2 = (argc > 2) ? atof(argv[2]) : 42.0;
+
+  timer_init();
+  ssd1351_init();
+  gfx_init();
+  emg_pipe_init(0);
+  pqueue_init(0);
+  game_two_init();
+
+  uint32_t flex_at = 0;
+  for (uint32_t now = 0; now < LIMIT_MS && !s_result_ms; ++now){
+    host_timer_set_us(now * 1000u);
+
+    metrics_t cur;
+    (void)metrics_read(&cur);
+    if (!flex_at && cur.base_hz[0] > 0.0f && cur.base_hz[1] > 0.0f) flex_at = now;
+
+    double t = now / 1000.0;
+    int16_t s[EMG_PIPE_CH] = {0};
+    s[0] = synth(t, BASE_P1_HZ + (flex_at ? f1 : 0.0));
+    s[1] = synth(t, BASE_P2_HZ + (flex_at ? f2 : 0.0));
+    emg_pipe_push(s);
+
+    if (emg_pipe_due(now)){
+      metrics_t m;
+      uint32_t from = emg_pipe_close(now, &m);
+      metrics_publish(&m);
+      round_acc_feed(&m, from);
+      pqueue_service(&m, now);
+    }
+    if (now % TICK_MS == 0u){
+      (void)game_two_tick();
+      gfx_jobs_run(RENDER_BUDGET_US);
+    }
+  }
+
+  metrics_t m;
+  (void)metrics_read(&m);
+  printf("baselines %.2f / %.2f Hz, flex from %u ms\n",
+         m.base_hz[0], m.base_hz[1], (unsigned)flex_at);
+  if (!s_result_ms){
+    printf("no result within %u ms\n", (unsigned)LIMIT_MS);
+    return 1;
+  }
+  printf("result at %u ms: P1 %.2f Hz (expect %.1f), P2 %.2f Hz (expect %.1f)\n",
+         (unsigned)s_result_ms, s_r1, f1, s_r2, f2);
+  return (fabs(s_r1 - f1) < 1.0 && fabs(s_r2 - f2) < 1.0) ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+/*==============================================================================
+ * @file    sched_sim.c
+ * @brief   main.c's task set on the scheduler, with modelled task costs.
+ *
+ * Registers the same tasks, periods and priorities as main.c, with bodies
+ * that only advance the virtual clock by what the real ones cost:
+ *   acq     10 us per drain of the DRDY ring (64 frames, 2 kSPS)
+ *   dsp     40 us per 100 ms window
+ *   game    1.2 ms per tick, plus a 65 ms scene to render every 2 s
+ *   render  1 ms job slices within RENDER_BUDGET_US, draining acq between
+ *   telem   5 ms printf
+ *   save    one 20 ms flash write
+ * The DRDY interrupt's notify is a 1 ms "isr" task, as its wakeups are
+ * coalesced on the target, so its misses are merged wakeups, not lost
+ * samples. Runs 10 s and prints the scheduler counters, the game tick
+ * rate, idle share and ring peak, then the same load on the old super-loop
+ * (100 ms blocking window, print, tick and render).
+ *
+ * Build and run from the repository root:
+ *   gcc -std=gnu99 -O2 -DHOST_SIM -Iinclude -Ihost host/sched_sim.c \
+ *       host/host_timer.c src/sched.c -o sched_sim && ./sched_sim
+ *============================================================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include "project.h"
+#include "sched.h"
+#include "host_timer.h"
+
+#define RUN_US         10000000u
+#define DRDY_US        500u        // 2 kSPS
+#define RING_FRAMES    64u
+#define ACQ_PERIOD_US  10000u      // as main.c
+#define DSP_DEADLINE_US 10000u
+#define GAME_PERIOD_US 16000u
+#define TELEM_PERIOD_US 500000u
+#define SAVE_PERIOD_US 250000u
+#define SCENE_EVERY_US 2000000u
+#define SCENE_US       65000u
+#define SLICE_US       1000u
+
+enum { PRIO_ACQ, PRIO_DSP, PRIO_GAME, PRIO_RENDER, PRIO_TELEM, PRIO_SAVE };
+
+static int8_t   s_acq, s_dsp, s_render;
+static uint32_t s_read_edge, s_reads, s_lost, s_ring_peak;
+static uint32_t s_dsp_t0, s_render_left, s_game_runs, s_saves;
+
+// Frames the ISR queued since the last drain; past RING_FRAMES they are lost
+static void drain_ring(void){
+  uint32_t newest = sched_clock_us() / DRDY_US, fill = newest - s_read_edge;
+  if (fill > s_ring_peak) s_ring_peak = fill;
+  if (fill > RING_FRAMES) s_lost += fill - RING_FRAMES;
+  s_reads += fill;
+  s_read_edge = newest;
+}
+
+static void task_isr(void){ sched_signal(s_acq); }
+
+static void task_acq(void){
+  sched_clock_advance(10u);
+  drain_ring();
+  if (sched_clock_us() - s_dsp_t0 >= 100000u){
+    s_dsp_t0 = sched_clock_us();
+    sched_signal(s_dsp);
+  }
+}
+
+static void task_dsp(void){ sched_clock_advance(40u); }
+
+static void task_game(void){
+  s_game_runs++;
+  sched_clock_advance(1200u);
+  if (sched_clock_us() % SCENE_EVERY_US < GAME_PERIOD_US) s_render_left += SCENE_US;
+  sched_signal(s_render);
+}
+
+// Slices within the budget, with the acq yield hook between them
+static void task_render(void){
+  uint32_t spent = 0;
+  while (s_render_left && spent + SLICE_US <= RENDER_BUDGET_US){
+    sched_clock_advance(SLICE_US);
+    s_render_left -= SLICE_US;
+    spent += SLICE_US;
+    task_acq();
+    spent += 10u;
+  }
+  sched_clock_advance(100u);
+}
+
+static void task_telem(void){ sched_clock_advance(5000u); }
+
+static void task_save(void){ if (++s_saves == 20u) sched_clock_advance(20000u); }
+
+// Old loop: 100 ms blocking Hz window, printf every 500 ms, then tick and
+// render inline; samples are only read during the window
+static void old_loop(void){
+  uint32_t t = 0, ticks = 0, print_at = 0, lost = 0, left = 0;
+  while (t < RUN_US){
+    t += 100000u;
+    if (t >= print_at){ print_at = t + TELEM_PERIOD_US; t += 5000u; lost += 10u; }
+    ticks++;
+    if (t % SCENE_EVERY_US < 102000u) left += SCENE_US;
+    uint32_t r = (left > RENDER_BUDGET_US) ? RENDER_BUDGET_US : left;
+    left -= r;
+    t += 1200u + r;
+    lost += (1200u + r) / DRDY_US;
+  }
+  printf("old loop: %.1f game ticks/s, %u samples lost\n", ticks / (RUN_US / 1e6), (unsigned)lost);
+}
+
+int main(void){
+  timer_init();
+  sched_init();
+  (void)sched_add("isr", task_isr, 1000u, 0u, PRIO_ACQ);
+  s_acq    = sched_add("acq",    task_acq,    ACQ_PERIOD_US,   0u,              PRIO_ACQ);
+  s_dsp    = sched_add("dsp",    task_dsp,    0u,              DSP_DEADLINE_US, PRIO_DSP);
+  s_render = sched_add("render", task_render, 0u,              GAME_PERIOD_US,  PRIO_RENDER);
+  (void)sched_add("game",  task_game,  GAME_PERIOD_US,  0u, PRIO_GAME);
+  (void)sched_add("telem", task_telem, TELEM_PERIOD_US, 0u, PRIO_TELEM);
+  (void)sched_add("save",  task_save,  SAVE_PERIOD_US,  0u, PRIO_SAVE);
+
+  while (sched_clock_us() < RUN_US) (void)sched_run_once();
+
+  sched_stats_t st;
+  const char *name;
+  printf("  %-6s %6s %5s %9s %9s\n", "task", "runs", "miss", "late us", "run us");
+  for (int8_t i = 0; (name = sched_stats(i, &st)) != NULL; ++i)
+    printf("  %-6s %6u %5u %9u %9u\n", name, (unsigned)st.runs, (unsigned)st.misses,
+           (unsigned)st.worst_late_us, (unsigned)st.worst_run_us);
+  printf("new loop: %.1f game ticks/s, %.1f%% idle, %u samples read, %u lost, ring peak %u/%u\n",
+         s_game_runs / (RUN_US / 1e6), sched_idle_us() * 100.0 / RUN_US,
+         (unsigned)s_reads, (unsigned)s_lost, (unsigned)s_ring_peak, (unsigned)RING_FRAMES);
+  old_loop();
+  return 0;
+}
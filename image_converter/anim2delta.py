@@ -0,0 +1,256 @@
+# anim2delta.py
+# Utility script to build a delta-frame animation (gfx_anim_t, see gfx.h)
+# from a sequence of frames:
+# - Frames are composed onto a WxH background, each source at its own offset
+# - One shared palette (<= 16 colors, reduced with png2pal4.reduce_palette
+#   when the sources need more)
+# - Frame 0 is emitted as a keyframe image (GFX_IMG_PAL4_RLE or raw)
+# - Every frame k gets the spans that change frame k-1 into frame k
+#   (frame 0 gets the loop delta from the last frame)
+#
+# Frame sources are PNG files or existing generated assets (<asset.c>:SYMBOL).
+#
+# Usage:
+#   python anim2delta.py <SYMBOL> --size WxH --frame SRC[@X,Y] [--frame ...]
+#                        [--bg 0xRGB565] [--gap N] [--base NAME]
+# Example (boot logo: TI and MSU composed in one 128x99 box):
+#   python anim2delta.py LOGO_ANIM --size 128x99 --base logo_anim_frames \
+#       --frame ../src/ti_logo.c:TI_LOGO@0,14 --frame ../src/MSU_logo.c:MSU_LOGO@14,0 \
+#       --h-dir ../include --c-dir ../src
+
+import argparse
+import sys
+from pathlib import Path
+
+import png2pal4 as p4
+
+# Bytes the driver sends to open a window (3 commands + 4 parameters)
+WINDOW_COST = 7
+
+
+def load_frame(spec, max_size):
+    """
+    Load one frame source.
+
+    Args:
+        spec (str):       "<file.png>" or "<asset.c>:<SYMBOL>".
+        max_size (tuple): Thumbnail bound for PNG input.
+
+    Returns:
+        tuple: (w, h, pal565 list, index list)
+    """
+    if spec.endswith((".png", ".jpg")):
+        return p4.load_png(Path(spec), max_size)
+    path, symbol = spec.rsplit(":", 1)
+    return p4.load_pal4_c(Path(path), symbol)
+
+
+def compose(frames, w, h, bg):
+    """
+    Place every source frame on a WxH canvas of color bg.
+
+    Args:
+        frames (list): (x, y, sw, sh, pal565, idx) per frame.
+        w, h (int):    Canvas size.
+        bg (int):      RGB565 background color.
+
+    Returns:
+        list[list[int]]: RGB565 pixels per frame, row-major.
+    """
+    out = []
+    for fx, fy, sw, sh, pal, idx in frames:
+        px = [bg] * (w * h)
+        for y in range(sh):
+            for x in range(sw):
+                if 0 <= fx + x < w and 0 <= fy + y < h:
+                    px[(fy + y) * w + fx + x] = pal[idx[y * sw + x]]
+        out.append(px)
+    return out
+
+
+def shared_palette(rgb_frames):
+    """
+    Build one palette for all frames, reducing it to 16 colors if needed.
+
+    Returns:
+        tuple: (pal565 list, list of index lists, psnr)
+    """
+    colors = sorted({c for f in rgb_frames for c in f})
+    lut = {c: i for i, c in enumerate(colors)}
+    flat = [lut[c] for f in rgb_frames for c in f]
+    q = float("inf")
+    if len(colors) > 16:
+        pal, red = p4.reduce_palette(colors, flat, 16)
+        q = p4.psnr(colors, flat, pal, red)
+        flat = red
+    else:
+        pal = colors
+    n = len(rgb_frames[0])
+    return pal, [flat[k * n:(k + 1) * n] for k in range(len(rgb_frames))], q
+
+
+def delta_spans(prev, cur, w, h, gap):
+    """
+    Changed spans from prev to cur, one list per row.
+
+    Spans separated by <= gap unchanged pixels are merged, since reopening
+    a window costs more than resending a few pixels.
+
+    Returns:
+        list[tuple]: (y, x, n) spans.
+    """
+    spans = []
+    for y in range(h):
+        row = y * w
+        x = 0
+        cur_span = None
+        while x < w:
+            if prev[row + x] != cur[row + x]:
+                if cur_span and x - (cur_span[0] + cur_span[1]) <= gap:
+                    cur_span[1] = x - cur_span[0] + 1
+                else:
+                    if cur_span:
+                        spans.append((y, cur_span[0], cur_span[1]))
+                    cur_span = [x, 1]
+            x += 1
+        if cur_span:
+            spans.append((y, cur_span[0], cur_span[1]))
+    return spans
+
+
+def encode_delta(prev, cur, w, h, gap):
+    """
+    Encode the span stream that turns prev into cur.
+
+    Returns:
+        tuple: (byte list, span count, changed pixels sent)
+    """
+    out = []
+    spans = delta_spans(prev, cur, w, h, gap)
+    sent = 0
+    for y, x, n in spans:
+        px = cur[y * w + x: y * w + x + n]
+        enc = p4.rle_encode(px, 1 << 16)     # width larger than span: no copy-up
+        if p4.rle_decode(enc, n, 1 << 16) != px:
+            raise RuntimeError("span round-trip mismatch")
+        out.extend([y, x, n])
+        out.extend(enc)
+        sent += n
+    out.append(0xFF)
+    return out, len(spans), sent
+
+
+def write_array(f, decl, values, fmt, per_line):
+    """Write a C array initializer."""
+    f.write(f"{decl} = {{\n")
+    line = "    "
+    for i, v in enumerate(values):
+        line += fmt.format(v) + ", "
+        if (i + 1) % per_line == 0:
+            f.write(line + "\n")
+            line = "    "
+    if line.strip():
+        f.write(line + "\n")
+    f.write("};\n\n")
+
+
+def main():
+    """
+    CLI entry point: load frames, build the shared palette and deltas, emit C.
+    """
+    ap = argparse.ArgumentParser(description="Frame sequence -> gfx_anim_t")
+    ap.add_argument("symbol", help="C symbol prefix, e.g. LOGO_ANIM")
+    ap.add_argument("--size", required=True, help="frame size WxH")
+    ap.add_argument("--frame", action="append", required=True,
+                    help="frame source SRC[@X,Y] (PNG or asset.c:SYMBOL)")
+    ap.add_argument("--bg", default="0x0000", help="RGB565 background (default black)")
+    ap.add_argument("--gap", type=int, default=WINDOW_COST // 2,
+                    help="merge spans across up to N unchanged pixels")
+    ap.add_argument("--max", default="128x128", help="thumbnail bound for PNG frames")
+    ap.add_argument("--base", default=None, help="output file stem")
+    ap.add_argument("--h-dir", default=".", help="output directory for .h")
+    ap.add_argument("--c-dir", default=".", help="output directory for .c")
+    args = ap.parse_args()
+
+    w, h = (int(v) for v in args.size.lower().split("x"))
+    mw, mh = (int(v) for v in args.max.lower().split("x"))
+    bg = int(args.bg, 0)
+
+    frames = []
+    for spec in args.frame:
+        pos = (0, 0)
+        if "@" in spec:
+            spec, at = spec.rsplit("@", 1)
+            pos = tuple(int(v) for v in at.split(","))
+        src = spec if spec.endswith((".png", ".jpg")) else spec.rsplit(":", 1)[0]
+        if not Path(src).is_file():
+            print(f"Input file not found: {spec}")
+            sys.exit(1)
+        sw, sh, pal, idx = load_frame(spec, (mw, mh))
+        frames.append((pos[0], pos[1], sw, sh, pal, idx))
+
+    rgb = compose(frames, w, h, bg)
+    pal, idx_frames, q = shared_palette(rgb)
+
+    # Keyframe: smallest of raw 4 bpp and RLE
+    key_raw = p4.pack_indices(idx_frames[0], 4)
+    key_rle = p4.rle_encode(idx_frames[0], w)
+    if p4.rle_decode(key_rle, w * h, w) != idx_frames[0]:
+        raise RuntimeError("keyframe round-trip mismatch")
+    key, key_kind, key_fmt = ((key_rle, "KEY_RLE", "GFX_IMG_PAL4_RLE")
+                              if len(key_rle) < len(key_raw)
+                              else (key_raw, "KEY_IDX", "GFX_IMG_PAL4"))
+
+    delta, offs, report = [], [], []
+    n = len(idx_frames)
+    for k in range(n):
+        prev = idx_frames[(k - 1) % n]
+        enc, spans, sent = encode_delta(prev, idx_frames[k], w, h, args.gap)
+        offs.append(len(delta))
+        delta.extend(enc)
+        report.append((k, spans, sent, len(enc)))
+    if len(delta) > 0xFFFF:
+        raise RuntimeError("delta stream exceeds 64 KB")
+
+    sym = args.symbol
+    base = args.base or sym.lower()
+    h_name = Path(args.h_dir) / f"{base}.h"
+    c_name = Path(args.c_dir) / f"{base}.c"
+
+    with open(h_name, "w", encoding="utf-8") as fh:
+        fh.write(f"#ifndef {sym}_FRAMES_H\n")
+        fh.write(f"#define {sym}_FRAMES_H\n\n")
+        fh.write("#include <stdint.h>\n")
+        fh.write('#include "gfx.h"\n\n')
+        fh.write(f"#define {sym}_W {w}\n")
+        fh.write(f"#define {sym}_H {h}\n")
+        fh.write(f"#define {sym}_FRAMES {n}\n\n")
+        fh.write(f"extern const gfx_anim_t {sym};\n\n")
+        fh.write(f"#endif // {sym}_FRAMES_H\n")
+
+    with open(c_name, "w", encoding="utf-8") as fc:
+        fc.write("#include <stdint.h>\n")
+        fc.write(f'#include "{base}.h"\n\n')
+        write_array(fc, f"static const uint16_t {sym}_PAL[{len(pal)}]", pal, "0x{:04X}", 8)
+        write_array(fc, f"static const uint8_t {sym}_{key_kind}[{len(key)}]", key, "0x{:02X}", 16)
+        fc.write(f"static const gfx_image_t {sym}_KEY = {{\n")
+        fc.write(f"    .w = {sym}_W, .h = {sym}_H, .fmt = {key_fmt},\n")
+        fc.write(f"    .pal = {sym}_PAL, .colors = {len(pal)},\n")
+        fc.write(f"    .data = {sym}_{key_kind}, .size = sizeof({sym}_{key_kind}),\n")
+        fc.write("};\n\n")
+        write_array(fc, f"static const uint16_t {sym}_OFFS[{sym}_FRAMES]", offs, "{}", 8)
+        write_array(fc, f"static const uint8_t {sym}_DELTA[{len(delta)}]", delta, "0x{:02X}", 16)
+        fc.write(f"const gfx_anim_t {sym} = {{\n")
+        fc.write(f"    {sym}_W, {sym}_H, {sym}_FRAMES,\n")
+        fc.write(f"    {sym}_PAL, &{sym}_KEY, {sym}_OFFS, {sym}_DELTA\n")
+        fc.write("};\n")
+
+    qs = "lossless" if q == float("inf") else f"{q:.1f} dB"
+    print(f"Generated {h_name} and {c_name} ({w}x{h}, {n} frames, {len(pal)} colors, {qs})")
+    print(f"  key {key_kind} {len(key)} bytes, delta {len(delta)} bytes")
+    for k, spans, sent, size in report:
+        print(f"  frame {k}: {spans} spans, {sent} px, {size} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,213 @@
+# lore2bpe.py
+# Utility script to pack the typewriter lore pages (lore_text.txt) into
+# byte-pair coded text for gfx_scroll_begin_bpe() (see gfx.h):
+# - One dictionary of up to 128 pair codes, trained on all pages at once
+#   (a pair is merged while it saves more than the 3 bytes it costs)
+# - Every line packed on its own and ended by 0x00
+# - LORE_<PAGE> ids plus LORE_TEXT[], one gfx_bpe_page_t per page
+#
+# lore_text.txt: "page NAME" starts a page, each "| text" line after it is
+# one line of the page, "#" lines are comments.
+#
+# Usage:
+#   python lore2bpe.py <lore_text.txt> [--h-dir DIR] [--c-dir DIR] [--codes N]
+# Example:
+#   python lore2bpe.py lore_text.txt --h-dir ../include --c-dir ../src
+
+import argparse
+import sys
+from pathlib import Path
+
+DEPTH_MAX = 8     # GFX_BPE_DEPTH
+LINES_MAX = 16    # GFX_SCROLL_LINES_MAX
+CODE_BASE = 0x80
+
+
+def load_pages(path):
+    """
+    Read the page file.
+
+    Returns:
+        list[tuple]: (NAME, [line, ...]) in file order.
+    """
+    pages = []
+    for n, raw in enumerate(path.read_text(encoding="utf-8").splitlines(), 1):
+        line = raw.strip()
+        if not line or line.startswith("#"):
+            continue
+        if line.startswith("page "):
+            name = line[5:].strip()
+            if any(p[0] == name for p in pages):
+                raise ValueError(f"line {n}: page {name} defined twice")
+            pages.append((name, []))
+        elif line.startswith("|"):
+            if not pages:
+                raise ValueError(f"line {n}: text before the first page")
+            text = line[1:].strip()
+            if any(not 0x20 <= ord(c) < 0x7F for c in text):
+                raise ValueError(f"line {n}: only printable ASCII can be packed")
+            pages[-1][1].append(text)
+        else:
+            raise ValueError(f"line {n}: expected 'page NAME' or '| text'")
+    for name, lines in pages:
+        if not 0 < len(lines) <= LINES_MAX:
+            raise ValueError(f"page {name}: needs 1..{LINES_MAX} lines")
+    return pages
+
+
+def count_pairs(seqs):
+    """
+    Count adjacent symbol pairs, not counting a pair that overlaps the
+    previous occurrence of itself (so "aaa" holds one "aa").
+    """
+    counts = {}
+    for s in seqs:
+        last = None
+        for i in range(len(s) - 1):
+            pr = (s[i], s[i + 1])
+            if pr == last:
+                last = None
+                continue
+            counts[pr] = counts.get(pr, 0) + 1
+            last = pr
+    return counts
+
+
+def replace_pair(seqs, pr, code):
+    out = []
+    for s in seqs:
+        r, i = [], 0
+        while i < len(s):
+            if i + 1 < len(s) and (s[i], s[i + 1]) == pr:
+                r.append(code)
+                i += 2
+            else:
+                r.append(s[i])
+                i += 1
+        out.append(r)
+    return out
+
+
+def train(lines, max_codes):
+    """
+    Greedy byte-pair coding over all lines.
+
+    Returns:
+        tuple: (pairs list of (a, b), packed lines as symbol lists)
+    """
+    seqs = [[ord(c) for c in t] for t in lines]
+    pairs, depth = [], {}
+    while len(pairs) < max_codes:
+        counts = count_pairs(seqs)
+        best = None
+        for pr, k in sorted(counts.items(), key=lambda e: (-e[1], e[0])):
+            if k <= 3:
+                break
+            d = 1 + max(depth.get(pr[0], 0), depth.get(pr[1], 0))
+            if d <= DEPTH_MAX:
+                best = (pr, d)
+                break
+        if best is None:
+            break
+        code = CODE_BASE + len(pairs)
+        pairs.append(best[0])
+        depth[code] = best[1]
+        seqs = replace_pair(seqs, best[0], code)
+    return pairs, seqs, max(depth.values(), default=0)
+
+
+def expand(sym, pairs):
+    if sym < CODE_BASE:
+        return chr(sym)
+    a, b = pairs[sym - CODE_BASE]
+    return expand(a, pairs) + expand(b, pairs)
+
+
+def write_array(f, decl, values, per_line=16):
+    f.write(f"{decl} = {{\n")
+    for i in range(0, len(values), per_line):
+        f.write("    " + ", ".join(f"0x{v:02X}" for v in values[i:i + per_line]) + ",\n")
+    f.write("};\n\n")
+
+
+def main():
+    """
+    CLI entry point: train the dictionary, pack every page, emit .h/.c.
+    """
+    ap = argparse.ArgumentParser(description="Lore pages -> byte-pair packed C")
+    ap.add_argument("pages", help="page file, e.g. lore_text.txt")
+    ap.add_argument("--codes", type=int, default=128, help="most pair codes (<= 128)")
+    ap.add_argument("--h-dir", default=".", help="output directory for .h")
+    ap.add_argument("--c-dir", default=".", help="output directory for .c")
+    args = ap.parse_args()
+
+    src = Path(args.pages)
+    if not src.is_file():
+        print(f"Input file not found: {src}")
+        sys.exit(1)
+    try:
+        pages = load_pages(src)
+    except ValueError as e:
+        print(f"{src}: {e}")
+        sys.exit(1)
+
+    lines = [t for _, page in pages for t in page]
+    pairs, seqs, depth = train(lines, min(args.codes, 128))
+    lens = [len(expand(CODE_BASE + k, pairs)) for k in range(len(pairs))]
+    for t, s in zip(lines, seqs):
+        if "".join(expand(c, pairs) for c in s) != t:
+            raise RuntimeError(f"round-trip mismatch: {t!r}")
+
+    data, offs, k = [], [], 0
+    for name, page in pages:
+        offs.append(len(data))
+        for s in seqs[k:k + len(page)]:
+            data.extend(s + [0])
+        k += len(page)
+    if len(data) > 0xFFFF:
+        raise RuntimeError("packed text exceeds 64 KB")
+
+    h_name = Path(args.h_dir) / "lore_text.h"
+    c_name = Path(args.c_dir) / "lore_text.c"
+
+    with open(h_name, "w", encoding="utf-8") as fh:
+        fh.write("#ifndef LORE_TEXT_H\n")
+        fh.write("#define LORE_TEXT_H\n\n")
+        fh.write("#include <stdint.h>\n")
+        fh.write('#include "gfx.h"\n\n')
+        fh.write(f"#define LORE_CODES {len(pairs)}\n")
+        fh.write(f"#define LORE_DATA_SIZE {len(data)}\n\n")
+        fh.write("typedef enum {\n")
+        for name, _ in pages:
+            fh.write(f"    LORE_{name},\n")
+        fh.write("    LORE_PAGES\n")
+        fh.write("} lore_page_t;\n\n")
+        fh.write("extern const gfx_bpe_t      LORE_BPE;\n")
+        fh.write("extern const gfx_bpe_page_t LORE_TEXT[LORE_PAGES];\n\n")
+        fh.write("#endif // LORE_TEXT_H\n")
+
+    with open(c_name, "w", encoding="utf-8") as fc:
+        fc.write("#include <stdint.h>\n")
+        fc.write('#include "lore_text.h"\n\n')
+        write_array(fc, "static const uint8_t LORE_PAIRS[LORE_CODES * 2]",
+                    [v for pr in pairs for v in pr])
+        write_array(fc, "static const uint8_t LORE_LENS[LORE_CODES]", lens)
+        write_array(fc, "static const uint8_t LORE_DATA[LORE_DATA_SIZE]", data)
+        fc.write("const gfx_bpe_t LORE_BPE = { LORE_PAIRS, LORE_LENS };\n\n")
+        fc.write("const gfx_bpe_page_t LORE_TEXT[LORE_PAGES] = {\n")
+        for (name, page), off in zip(pages, offs):
+            fc.write(f"    {{ &LORE_BPE, &LORE_DATA[{off}], {len(page)} }},  // {name}\n")
+        fc.write("};\n")
+
+    plain = sum(len(t) + 1 for t in lines)
+    packed = len(data) + 3 * len(pairs)
+    chars = sum(len(t) for t in lines)
+    print(f"Wrote {h_name} and {c_name}: {len(pages)} pages, {len(lines)} lines")
+    print(f"  plain  {plain} B text (+{4 * len(lines)} B of line pointers on the MCU)")
+    print(f"  packed {len(data)} B text + {3 * len(pairs)} B dictionary "
+          f"({len(pairs)} codes, depth {depth}) = {packed} B, "
+          f"{100.0 * packed / plain:.1f}% of plain, {8.0 * len(data) / chars:.2f} bits/char")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,13 +1,24 @@
 # png2pal4.py
-# Utility script to convert a PNG image into a 4-bit paletted C asset:
-# - 16-color RGB565 palette
-# - Packed 4-bit index array (2 pixels per byte)
+# Utility script to convert a PNG image into a paletted C asset:
+# - RGB565 palette (2..256 colors, trimmed to what the image uses)
+# - Packed 1/2/4/8-bit index array (bit depth chosen per image), or the
+#   compressed GFX_IMG_PAL4_RLE stream (see gfx.h) when that is smaller,
+#   or with --tiles an 8x8 tile map + tile dictionary (GFX_IMG_TILE8)
+# - A gfx_image_t descriptor <SYMBOL>_IMG for gfx_blit_image()
+#
+# With --psnr the palette may be reduced to reach a smaller bit depth as
+# long as the result stays at or above the given PSNR (dB, RGB888).
 #
 # Usage:
-#   python png2pal4.py <image.png> <SYMBOL_NAME>
+#   python png2pal4.py <image.png> <SYMBOL_NAME> [--rle] [--max WxH] [--colors N] [--psnr DB]
+#   python png2pal4.py --repack <asset.c> <SYMBOL_NAME> [--rle] [--tiles] [--psnr DB] [--key auto|N]
 # Example:
-#   python png2pal4.py GAME_SINGLE_LOGO.png GAME_SINGLE_LOGO
+#   python png2pal4.py GAME_SINGLE_LOGO.png GAME_SINGLE_LOGO --rle --max 128x128
+#   python png2pal4.py --repack ../src/chest.c CHEST --rle --psnr 30 --h-dir ../include --c-dir ../src
 
+import argparse
+import math
+import re
 import sys
 from pathlib import Path
 
@@ -30,79 +41,497 @@ def rgb_to_rgb565(r, g, b):
     return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
 
-def emit_pal4(image_path: Path, symbol: str):
+
+def rgb565_to_rgb(c):
+    """
+    Expand a packed RGB565 value back to 8-bit-per-channel RGB.
+
+    Args:
+        c (int): 16-bit RGB565 value.
+
+    Returns:
+        tuple: (r, g, b) in range [0, 255].
+    """
+    return (((c >> 11) & 0x1F) * 255 // 31,
+            ((c >> 5) & 0x3F) * 255 // 63,
+            (c & 0x1F) * 255 // 31)
+
+
+# Raw formats by bit depth (gfx_img_fmt_t names)
+RAW_FORMATS = {1: "GFX_IMG_IDX1", 2: "GFX_IMG_IDX2", 4: "GFX_IMG_PAL4", 8: "GFX_IMG_IDX8"}
+
+
+def pack_indices(idx, bpp):
     """
-    Convert a PNG image into a pair of C files: <symbol>.h and <symbol>.c.
+    Pack indices MSB-first at bpp bits each, continuous across rows.
+
+    Args:
+        idx (list[int]): Palette indices (each < 2**bpp).
+        bpp (int):       1, 2, 4 or 8.
+
+    Returns:
+        list[int]: Packed bytes (last byte zero-padded).
+    """
+    per = 8 // bpp
+    out = []
+    for i in range(0, len(idx), per):
+        b = 0
+        for k in range(per):
+            v = idx[i + k] if i + k < len(idx) else 0
+            b |= v << (8 - bpp * (k + 1))
+        out.append(b)
+    return out
+
+
+def unpack_indices(data, bpp, count):
+    """
+    Inverse of pack_indices().
+
+    Args:
+        data (list[int]): Packed bytes.
+        bpp (int):        1, 2, 4 or 8.
+        count (int):      Number of pixels (w*h).
+
+    Returns:
+        list[int]: Palette indices.
+    """
+    mask = (1 << bpp) - 1
+    out = []
+    for k in range(count):
+        bit = k * bpp
+        out.append((data[bit >> 3] >> (8 - bpp - (bit & 7))) & mask)
+    return out
+
+
+def compact_palette(pal565, idx):
+    """
+    Drop unused palette entries and renumber the indices to match.
+
+    Args:
+        pal565 (list[int]): RGB565 palette.
+        idx (list[int]):    Row-major palette indices.
+
+    Returns:
+        tuple: (palette, indices)
+    """
+    used = sorted(set(idx))
+    remap = {old: new for new, old in enumerate(used)}
+    return [pal565[i] for i in used], [remap[i] for i in idx]
+
+
+def psnr(pal_a, idx_a, pal_b, idx_b):
+    """
+    PSNR (dB) of image b against reference a, over RGB888 channels.
+
+    Returns:
+        float: PSNR, or infinity for identical images.
+    """
+    ca = [rgb565_to_rgb(c) for c in pal_a]
+    cb = [rgb565_to_rgb(c) for c in pal_b]
+    se = 0
+    for i, j in zip(idx_a, idx_b):
+        se += sum((x - y) ** 2 for x, y in zip(ca[i], cb[j]))
+    if se == 0:
+        return float("inf")
+    mse = se / (3 * len(idx_a))
+    return 10 * math.log10(255 ** 2 / mse)
+
+
+def reduce_palette(pal565, idx, colors):
+    """
+    Greedily merge palette entries until at most `colors` remain.
+
+    Each step folds the entry whose pixels would cost the least squared
+    error into its nearest surviving neighbour. Surviving colors keep their
+    exact RGB565 value, so flat areas are never shifted.
+
+    Args:
+        pal565 (list[int]): RGB565 palette (compacted).
+        idx (list[int]):    Row-major palette indices.
+        colors (int):       Target palette size.
+
+    Returns:
+        tuple: (palette, indices), compacted.
+    """
+    rgb = [rgb565_to_rgb(c) for c in pal565]
+    count = [0] * len(pal565)
+    for i in idx:
+        count[i] += 1
+    target = list(range(len(pal565)))
+    live = [i for i in range(len(pal565)) if count[i]]
+    while len(live) > colors:
+        best = None
+        for a in live:
+            for b in live:
+                if a != b:
+                    cost = count[a] * sum((x - y) ** 2 for x, y in zip(rgb[a], rgb[b]))
+                    if best is None or cost < best[0]:
+                        best = (cost, a, b)
+        _, a, b = best
+        target = [b if t == a else t for t in target]
+        count[b] += count[a]
+        live.remove(a)
+    return compact_palette(pal565, [target[i] for i in idx])
+
+
+def choose_depth(pal565, idx, min_psnr=None):
+    """
+    Pick the smallest bit depth for an image.
+
+    Without min_psnr the image is kept lossless and the depth is set by the
+    number of colors actually used. With min_psnr, smaller depths are tried
+    with a reduced palette and the first that meets the target wins.
+
+    Args:
+        pal565 (list[int]): RGB565 palette.
+        idx (list[int]):    Row-major palette indices.
+        min_psnr (float):   Quality target in dB, or None for lossless.
+
+    Returns:
+        tuple: (bpp, palette, indices, psnr)
+    """
+    pal, ix = compact_palette(pal565, idx)
+    for bpp in (1, 2, 4, 8):
+        if len(pal) <= (1 << bpp):
+            return bpp, pal, ix, float("inf")
+        if min_psnr is not None:
+            rp, ri = reduce_palette(pal, ix, 1 << bpp)
+            q = psnr(pal, ix, rp, ri)
+            if q >= min_psnr:
+                return bpp, rp, ri, q
+    raise RuntimeError(f"{len(pal)} colors do not fit 8 bpp")
+
+def border_key(idx, w, h, min_share=0.5):
+    """
+    Pick a transparent color key for compositing (see gfx_layer_t).
+
+    The most common index along the image border is the key, provided it
+    covers at least min_share of the border; otherwise the sprite has no
+    clear background and stays opaque.
+
+    Returns:
+        int or None: Palette index, or None for GFX_KEY_NONE.
+    """
+    border = idx[:w] + idx[(h - 1) * w:]
+    border += [idx[y * w] for y in range(1, h - 1)]
+    border += [idx[y * w + w - 1] for y in range(1, h - 1)]
+    best = max(set(border), key=border.count)
+    return best if border.count(best) >= min_share * len(border) else None
+
+
+def rle_encode(idx, w):
+    """
+    Compress a row-major list of 4-bit indices into a GFX_IMG_PAL4_RLE stream.
+
+    Token byte t:
+      0x00-0x3F  literal: t+1 indices follow, packed 2 per byte (hi first)
+      0x40-0x7F  copy-up: (t&0x3F)+2 pixels equal to the pixel one row above
+      0x80-0xEF  run:     ((t>>4)&7)+2 pixels (2..8) of color t&0x0F
+      0xF0-0xFF  long run: 9+next byte pixels (9..264) of color t&0x0F
+
+    Tokens may cross row boundaries; the decoder keeps one row of indices.
+
+    Args:
+        idx (list[int]): Palette indices, len == w*h.
+        w (int):         Image width in pixels (copy-up distance).
+
+    Returns:
+        list[int]: Encoded byte stream.
+    """
+    out = []
+    lit = []
+
+    def flush():
+        nonlocal lit
+        while lit:
+            chunk, lit = lit[:64], lit[64:]
+            out.append(len(chunk) - 1)
+            for k in range(0, len(chunk), 2):
+                lo = chunk[k + 1] if k + 1 < len(chunk) else 0
+                out.append((chunk[k] << 4) | lo)
+
+    i, n = 0, len(idx)
+    while i < n:
+        run = 1
+        while i + run < n and idx[i + run] == idx[i] and run < 264:
+            run += 1
+        up = 0
+        if i >= w:
+            while i + up < n and idx[i + up] == idx[i + up - w] and up < 65:
+                up += 1
+        # Short matches are cheaper inside a literal
+        if up >= 4 and up > run:
+            flush()
+            out.append(0x40 | (up - 2))
+            i += up
+        elif run >= 4:
+            flush()
+            if run <= 8:
+                out.append(0x80 | ((run - 2) << 4) | idx[i])
+            else:
+                out.extend([0xF0 | idx[i], run - 9])
+            i += run
+        else:
+            lit.append(idx[i])
+            i += 1
+    flush()
+    return out
+
+
+def rle_decode(data, count, w):
+    """
+    Reference decoder for rle_encode() (used to verify every emitted asset).
+
+    Args:
+        data (list[int]): Encoded stream.
+        count (int):      Number of pixels to produce (w*h).
+        w (int):          Image width in pixels.
+
+    Returns:
+        list[int]: Decoded palette indices.
+    """
+    out = []
+    p = 0
+    while len(out) < count:
+        t = data[p]
+        p += 1
+        if t < 0x40:
+            n = t + 1
+            for k in range(n):
+                b = data[p + k // 2]
+                out.append(b >> 4 if k % 2 == 0 else b & 0x0F)
+            p += (n + 1) // 2
+        elif t < 0x80:
+            for _ in range((t & 0x3F) + 2):
+                out.append(out[len(out) - w])
+        elif t < 0xF0:
+            out.extend([t & 0x0F] * (((t >> 4) & 7) + 2))
+        else:
+            out.extend([t & 0x0F] * (9 + data[p]))
+            p += 1
+    return out[:count]
+
+
+
+def tile_encode(idx, w, h):
+    """
+    Split an image into 8x8 tiles and deduplicate them (GFX_IMG_TILE8).
+
+    Partial edge tiles are padded with index 0; the blitter never reads
+    the padding because it clips to w x h.
+
+    Args:
+        idx (list[int]): Row-major 4-bit palette indices.
+        w, h (int):      Image size in pixels.
+
+    Returns:
+        tuple: (tile dictionary as list of 32-byte lists, tile map list)
+    """
+    tiles, seen, tmap = [], {}, []
+    for ty in range(0, h, 8):
+        for tx in range(0, w, 8):
+            t = []
+            for y in range(ty, ty + 8):
+                for x in range(tx, tx + 8):
+                    t.append(idx[y * w + x] if y < h and x < w else 0)
+            key = tuple(t)
+            if key not in seen:
+                seen[key] = len(tiles)
+                tiles.append(pack_indices(t, 4))
+            tmap.append(seen[key])
+    return tiles, tmap
+
+
+def tile_decode(tiles, tmap, w, h):
+    """
+    Reference decoder for tile_encode().
+
+    Returns:
+        list[int]: Row-major palette indices.
+    """
+    tw = (w + 7) // 8
+    out = []
+    for y in range(h):
+        for x in range(w):
+            b = tiles[tmap[(y // 8) * tw + x // 8]][(y % 8) * 4 + (x % 8) // 2]
+            out.append(b >> 4 if x % 2 == 0 else b & 0x0F)
+    return out
+
+def load_pal4_c(c_path: Path, symbol: str):
+    """
+    Read an already generated asset (<symbol>_PAL plus _IDX or _RLE) back in.
+
+    Used by --repack so committed assets can be re-encoded exactly, without
+    going back to (and re-quantizing) the source PNGs.
+
+    Args:
+        c_path (Path): Asset .c file.
+        symbol (str):  C symbol prefix.
+
+    Returns:
+        tuple: (w, h, pal565 list, index list)
+    """
+    src = c_path.read_text(encoding="utf-8")
+    hdr = c_path.parent.parent / "include" / (c_path.stem + ".h")
+    hsrc = hdr.read_text(encoding="utf-8") if hdr.is_file() else src
+    w = int(re.search(rf"#define\s+{symbol}_W\s+(\d+)", hsrc).group(1))
+    h = int(re.search(rf"#define\s+{symbol}_H\s+(\d+)", hsrc).group(1))
+
+    def body(name):
+        m = re.search(rf"{symbol}_{name}\[[^\]]*\]\s*=\s*\{{(.*?)\}};", src, re.S)
+        if not m:
+            return None
+        return [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]+)", m.group(1))]
+
+    pal565 = body("PAL")
+    rle = body("RLE")
+    if rle is not None:
+        return w, h, pal565, rle_decode(rle, w * h, w)
+    tmap, tdata = body("MAP"), body("TILES")
+    if tmap is not None and tdata is not None:
+        tiles = [tdata[k:k + 32] for k in range(0, len(tdata), 32)]
+        return w, h, pal565, tile_decode(tiles, tmap, w, h)
+    raw = body("IDX")
+    if pal565 is None or raw is None:
+        raise RuntimeError(f"{symbol}_PAL/_IDX not found in {c_path}")
+    bpp = 4
+    for depth, fmt in RAW_FORMATS.items():
+        if re.search(rf"\b{fmt}\b", src):
+            bpp = depth
+    return w, h, pal565, unpack_indices(raw, bpp, w * h)
+
+
+def load_png(image_path: Path, max_size, colors=16):
+    """
+    Load and quantize a PNG to at most `colors` colors.
 
     The image is:
       - Loaded as RGBA
-      - Thumbnail-constrained to 30x30 while keeping aspect ratio
-      - Quantized down to 16 colors (palette mode)
-      - Exported as:
-          * <symbol>_PAL[] : RGB565 palette (16 entries)
-          * <symbol>_IDX[] : packed 4-bit indices (2 pixels per byte)
+      - Thumbnail-constrained to max_size while keeping aspect ratio
+      - Quantized down to `colors` colors (palette mode)
 
     Args:
         image_path (Path): Path to the source PNG image.
-        symbol (str):      C symbol prefix (e.g., GAME_SINGLE_LOGO).
+        max_size (tuple):  (w, h) bound for the thumbnail.
+        colors (int):      Palette size, 2..256.
+
+    Returns:
+        tuple: (w, h, pal565 list, index list)
     """
     # Load image as RGBA
     img = Image.open(image_path).convert("RGBA")
 
     # Optionally could resize to a fixed size; here we keep aspect ratio
-    # but bound the image to 30x30 pixels.
+    # but bound the image to max_size pixels.
     # img = img.resize((96, 96), Image.LANCZOS)
-    img.thumbnail((30, 30), Image.LANCZOS)
+    img.thumbnail(max_size, Image.LANCZOS)
     w, h = img.size
 
-    # Quantize to 16 colors using an adaptive palette
-    img_q = img.convert("P", palette=Image.ADAPTIVE, colors=16)
+    # Quantize using an adaptive palette
+    img_q = img.convert("P", palette=Image.ADAPTIVE, colors=colors)
     w_q, h_q = img_q.size
     if (w_q, h_q) != (w, h):
         # Safety check: quantization should not change image dimensions
         raise RuntimeError("Unexpected size change during quantize")
 
-    # Get palette (RGB triplets, length 16*3)
-    pal = img_q.getpalette()[:16 * 3]  # 16 colors * 3 components
+    # Get palette (RGB triplets, length colors*3)
+    pal = img_q.getpalette()[:colors * 3]
     pal565 = []
     for i in range(0, len(pal), 3):
         r, g, b = pal[i], pal[i + 1], pal[i + 2]
         pal565.append(rgb_to_rgb565(r, g, b))
 
-    # Get pixel indices (0–15) for each pixel in the quantized image
+    # Get pixel indices (0..colors-1) for each pixel in the quantized image
     idx = list(img_q.getdata())
     if len(idx) != w * h:
         # Safety check: pixel count must match width*height
         raise RuntimeError("Unexpected pixel count")
 
-    # Pack 2 pixels per byte: high nibble = first pixel, low nibble = second
-    packed = []
-    for i in range(0, len(idx), 2):
-        i0 = idx[i] & 0x0F
-        if i + 1 < len(idx):
-            i1 = idx[i + 1] & 0x0F
-        else:
-            # Pad last pixel if the total count is odd
-            i1 = 0
-        packed.append((i0 << 4) | i1)
+    return w, h, pal565, idx
+
+
+def emit_pal4(w, h, pal565, idx, symbol: str, rle=False, h_dir=".", c_dir=".",
+              base=None, min_psnr=None, tiled=False, key=None):
+    """
+    Write a pair of C files: <symbol>.h and <symbol>.c.
+
+    Exported as:
+      * <symbol>_PAL[] : RGB565 palette (only the colors used)
+      * <symbol>_IDX[] : packed 1/2/4/8-bit indices at the smallest depth, or
+        <symbol>_RLE[] : GFX_IMG_PAL4_RLE stream when --rle makes it smaller, or
+        <symbol>_MAP[] + <symbol>_TILES[] : GFX_IMG_TILE8 tile map and tile
+        dictionary when --tiles makes it smaller
+      * <symbol>_IMG   : gfx_image_t descriptor for gfx_blit_image()
+
+    Args:
+        w, h (int):         Image size in pixels.
+        pal565 (list[int]): RGB565 palette entries.
+        idx (list[int]):    Row-major palette indices.
+        symbol (str):       C symbol prefix (e.g., GAME_SINGLE_LOGO).
+        rle (bool):         Try the compressed format.
+        h_dir, c_dir (str): Output directories for the header and source.
+        base (str):         File name stem (default: symbol in lower case).
+        min_psnr (float):   Quality target for palette reduction (None = lossless).
+        tiled (bool):       Try the 8x8 tile-map format.
+        key (str):          None, "auto" or a palette index: emit <symbol>_KEY.
+
+    Returns:
+        tuple: (4 bpp raw bytes, emitted index bytes, bpp, kind)
+    """
+    bpp, pal565, idx, q = choose_depth(pal565, idx, min_psnr)
+    packed = pack_indices(idx, bpp)
+    if unpack_indices(packed, bpp, w * h) != list(idx):
+        raise RuntimeError("bit-packing round-trip mismatch")
+
+    data, kind, fmt = packed, "IDX", RAW_FORMATS[bpp]
+    if rle and bpp <= 4:
+        enc = rle_encode(idx, w)
+        if rle_decode(enc, w * h, w) != list(idx):
+            raise RuntimeError("RLE round-trip mismatch")
+        if len(enc) < len(packed):
+            data, kind, fmt = enc, "RLE", "GFX_IMG_PAL4_RLE"
+    tiles = None
+    if tiled and bpp <= 4:
+        tl, tmap = tile_encode(idx, w, h)
+        if tile_decode(tl, tmap, w, h) != list(idx):
+            raise RuntimeError("tile round-trip mismatch")
+        if len(tl) <= 256 and 32 * len(tl) + len(tmap) < len(data):
+            tiles = [b for t in tl for b in t]
+            data, kind, fmt = tmap, "MAP", "GFX_IMG_TILE8"
+    key_define = None
+    if key == "auto":
+        key = border_key(idx, w, h)
+        key_define = "GFX_KEY_NONE" if key is None else str(key)
+    elif key is not None:
+        key_define = str(int(key))
+    ref = (w * h + 1) // 2
+    total = len(data) + (len(tiles) if tiles else 0)
 
     # Derive base name for C files (e.g. GAME_SINGLE_LOGO -> game_single_logo)
-    base = symbol.lower()
-    h_name = f"{base}.h"
-    c_name = f"{base}.c"
+    base = base or symbol.lower()
+    h_name = str(Path(h_dir) / f"{base}.h")
+    c_name = str(Path(c_dir) / f"{base}.c")
 
     # Emit C header: declaration of dimensions, palette, and index array
     with open(h_name, "w", encoding="utf-8") as fh:
         fh.write(f"#ifndef {symbol}_H\n")
         fh.write(f"#define {symbol}_H\n\n")
-        fh.write("#include <stdint.h>\n\n")
+        fh.write("#include <stdint.h>\n")
+        fh.write('#include "gfx.h"\n\n')
         fh.write(f"#define {symbol}_W {w}\n")
         fh.write(f"#define {symbol}_H {h}\n")
-        fh.write(f"#define {symbol}_PAL_SIZE 16\n\n")
+        fh.write(f"#define {symbol}_PAL_SIZE {len(pal565)}\n")
+        fh.write(f"#define {symbol}_{kind}_SIZE {len(data)}\n")
+        if tiles:
+            fh.write(f"#define {symbol}_TILE_COUNT {len(tiles) // 32}\n")
+        if key_define is not None:
+            fh.write(f"#define {symbol}_KEY {key_define}   // transparent index for gfx_layer_t\n")
+        fh.write("\n")
         fh.write(f"extern const uint16_t {symbol}_PAL[{symbol}_PAL_SIZE];\n")
-        fh.write(
-            f"extern const uint8_t  {symbol}_IDX[({symbol}_W * {symbol}_H) / 2];\n\n"
-        )
+        fh.write(f"extern const uint8_t  {symbol}_{kind}[{symbol}_{kind}_SIZE];\n")
+        if tiles:
+            fh.write(f"extern const uint8_t  {symbol}_TILES[{symbol}_TILE_COUNT * 32];\n")
+        fh.write(f"extern const gfx_image_t {symbol}_IMG;\n\n")
         fh.write(f"#endif // {symbol}_H\n")
 
     # Emit C file: definitions of palette and packed index data
@@ -122,40 +551,82 @@ def emit_pal4(image_path: Path, symbol: str):
             fc.write(line + "\n")
         fc.write("};\n\n")
 
-        # Index data
-        fc.write(
-            f"const uint8_t {symbol}_IDX[({symbol}_W * {symbol}_H) / 2] = {{\n"
-        )
-        line = "    "
-        for i, b in enumerate(packed):
-            line += f"0x{b:02X}, "
-            if (i + 1) % 16 == 0:
+        def write_bytes(decl, values):
+            fc.write(f"{decl} = {{\n")
+            line = "    "
+            for i, b in enumerate(values):
+                line += f"0x{b:02X}, "
+                if (i + 1) % 16 == 0:
+                    fc.write(line + "\n")
+                    line = "    "
+            if line.strip():
                 fc.write(line + "\n")
-                line = "    "
-        if line.strip():
-            fc.write(line + "\n")
+            fc.write("};\n\n")
+
+        # Index data (tile map for GFX_IMG_TILE8)
+        write_bytes(f"const uint8_t {symbol}_{kind}[{symbol}_{kind}_SIZE]", data)
+        if tiles:
+            write_bytes(f"const uint8_t {symbol}_TILES[{symbol}_TILE_COUNT * 32]", tiles)
+
+        # Descriptor
+        fc.write(f"const gfx_image_t {symbol}_IMG = {{\n")
+        fc.write(f"    .w = {symbol}_W, .h = {symbol}_H, .fmt = {fmt},\n")
+        fc.write(f"    .pal = {symbol}_PAL, .colors = {symbol}_PAL_SIZE,\n")
+        fc.write(f"    .data = {symbol}_{kind}, .size = {symbol}_{kind}_SIZE,\n")
+        if tiles:
+            fc.write(f"    .tiles = {symbol}_TILES,\n")
         fc.write("};\n")
 
-    print(f"Generated {h_name} and {c_name} for {image_path.name} ({w}x{h})")
+    qs = "lossless" if q == float("inf") else f"{q:.1f} dB"
+    print(f"Generated {h_name} and {c_name} ({w}x{h}, {len(pal565)} colors, "
+          f"{bpp} bpp {kind}, {qs}, {total}/{ref} bytes = {total / ref:.2f})")
+    return ref, total, bpp, kind
 
 
 def main():
     """
     CLI entry point: parse arguments, validate paths, and call emit_pal4().
     """
-    if len(sys.argv) != 3:
-        print("Usage: python png2pal4.py <image.png> <SYMBOL_NAME>")
-        print("Example: python png2pal4.py GAME_SINGLE_LOGO.png GAME_SINGLE_LOGO")
-        sys.exit(1)
-
-    img_path = Path(sys.argv[1])
-    symbol = sys.argv[2]
+    ap = argparse.ArgumentParser(description="PNG -> paletted C asset")
+    ap.add_argument("source", help="PNG image, or asset .c file with --repack")
+    ap.add_argument("symbol", help="C symbol prefix, e.g. GAME_SINGLE_LOGO")
+    ap.add_argument("--rle", action="store_true",
+                    help="emit GFX_IMG_PAL4_RLE when it is smaller than raw")
+    ap.add_argument("--repack", action="store_true",
+                    help="re-encode an existing <symbol>.c instead of a PNG")
+    ap.add_argument("--max", default="30x30",
+                    help="thumbnail bound for PNG input, WxH (default 30x30)")
+    ap.add_argument("--colors", type=int, default=16,
+                    help="quantizer palette size for PNG input, 2..256 (default 16)")
+    ap.add_argument("--tiles", action="store_true",
+                    help="emit GFX_IMG_TILE8 (8x8 tile map) when it is smaller")
+    ap.add_argument("--key", default=None,
+                    help="emit <SYMBOL>_KEY: a palette index, or 'auto' to use the "
+                         "dominant border color (GFX_KEY_NONE if there is none)")
+    ap.add_argument("--psnr", type=float, default=None,
+                    help="allow palette reduction down to this PSNR in dB "
+                         "(default: lossless)")
+    ap.add_argument("--h-dir", default=".", help="output directory for .h")
+    ap.add_argument("--c-dir", default=".", help="output directory for .c")
+    args = ap.parse_args()
 
-    if not img_path.is_file():
-        print(f"Input file not found: {img_path}")
+    src = Path(args.source)
+    if not src.is_file():
+        print(f"Input file not found: {src}")
         sys.exit(1)
+    if not 2 <= args.colors <= 256:
+        print("--colors must be in 2..256")
+        sys.exit(1)
+
+    if args.repack:
+        w, h, pal565, idx = load_pal4_c(src, args.symbol)
+    else:
+        mw, mh = (int(v) for v in args.max.lower().split("x"))
+        w, h, pal565, idx = load_png(src, (mw, mh), args.colors)
 
-    emit_pal4(img_path, symbol)
+    base = src.stem if args.repack else None
+    emit_pal4(w, h, pal565, idx, args.symbol, args.rle, args.h_dir, args.c_dir,
+              base, args.psnr, args.tiles, args.key)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,290 @@
+# story2bc.py
+# Utility script to compile the Story mode script (story_script.txt) into
+# the bytecode that game_story.c interprets (see include/story_script.h):
+# - g_story_bc:      one opcode byte per op plus its operands
+# - g_story_str:     NUL-terminated strings, each stored once
+# - g_story_img:     the images the script declares, by img operand
+# - g_story_img_key: their transparent palette index (SYMBOL_KEY if keyed)
+#
+# Colors, cheevos, lore pages (lore_text.h) and images stay symbolic in
+# the generated C, so the script does not need to know their values.
+#
+# Usage:
+#   python story2bc.py <script.txt> <out.c> [--dump]
+# Example:
+#   python story2bc.py story_script.txt ../src/story_script.c
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+# Must match story_op_t in story_script.h (same order)
+OPS = [
+    ("end",     []),
+    ("screen",  []),
+    ("defer",   ["prio"]),
+    ("clear",   []),
+    ("art",     ["img", "pos", "pos"]),
+    ("header",  ["str", "u16"]),
+    ("text",    ["u8", "u8", "str", "u16", "u8"]),
+    ("bar",     ["u8", "u8", "u8", "u8", "u16"]),
+    ("mark",    []),
+    ("lore",    ["u8"]),
+    ("type",    ["u16", "u8"]),
+    ("wait",    ["u16"]),
+    ("chapter", ["str", "str", "u16", "img", "img"]),
+    ("foe",     ["u8", "u8", "u16"]),
+    ("choose",  ["u16"]),
+    ("battle",  ["u16"]),
+    ("result",  ["u16", "addr"]),
+    ("loot",    []),
+    ("died",    ["addr"]),
+    ("giveup",  ["u16", "addr"]),
+    ("unlock",  ["u8"]),
+    ("jump",    ["addr"]),
+    ("call",    ["addr"]),
+    ("ret",     []),
+]
+OPCODE = {name: i for i, (name, _) in enumerate(OPS)}
+
+# Operand bytes per kind
+SIZE = {"u8": 1, "u16": 2, "str": 2, "img": 1, "pos": 1, "prio": 1,
+        "addr": 2}
+
+STR_NAME    = 0xFFFF      # STORY_STR_NAME
+IMG_SPECIAL = {"@art": "STORY_IMG_ART", "@foe": "STORY_IMG_FOE"}
+PRIO        = {"hud": "GFX_PRIO_HUD", "art": "GFX_PRIO_ART", "off": "STORY_DEFER_OFF"}
+
+TOKEN = re.compile(r'"((?:[^"\\]|\\.)*)"|(#.*)|(\S+)')
+
+
+class ScriptError(Exception):
+    pass
+
+
+def tokenize(line):
+    """
+    Split one script line into tokens, dropping a trailing comment.
+
+    Returns:
+        list[tuple]: ("s", text) for quoted strings, ("w", word) otherwise.
+    """
+    out = []
+    for s, comment, w in TOKEN.findall(line):
+        if comment:
+            break
+        out.append(("w", w) if w else ("s", s.replace('\\"', '"')))
+    return out
+
+
+def c_string(b):
+    """
+    Quote a byte string as a C literal: non-ASCII and control bytes become
+    octal escapes, a "?" after "?" is escaped so no trigraph can form.
+    """
+    out, prev = [], 0
+    for c in b:
+        if c in (0x22, 0x5C):
+            out.append("\\" + chr(c))
+        elif c == 0x3F and prev == 0x3F:
+            out.append("\\?")
+        elif 0x20 <= c < 0x7F:
+            out.append(chr(c))
+        else:
+            out.append(f"\\{c:03o}")
+        prev = c
+    return '"' + "".join(out) + '"'
+
+
+class Compiler:
+    def __init__(self):
+        self.images = []          # (symbol, keyed)
+        self.img_index = {}
+        self.labels = {}
+        self.ops = []             # (lineno, name, args, addr)
+        self.pool = bytearray()
+        self.pool_lines = []      # (offset, bytes) in pool order
+        self.shared = {}
+        self.addr = 0
+
+    def add_string(self, text):
+        b = text.encode("utf-8")
+        if b"\0" in b:
+            raise ScriptError("NUL in string")
+        if b in self.shared:
+            return self.shared[b]
+        off = len(self.pool)
+        self.pool += b + b"\0"
+        self.pool_lines.append((off, b))
+        self.shared[b] = off
+        return off
+
+    def parse(self, text):
+        """
+        First pass: declarations, labels and ops; every op's address is
+        known afterwards.
+        """
+        for n, raw in enumerate(text.splitlines(), 1):
+            toks = tokenize(raw.strip())
+            if not toks:
+                continue
+            kind, word = toks[0]
+            if kind == "w" and word.endswith(":") and len(toks) == 1:
+                label = word[:-1]
+                if label in self.labels:
+                    raise ScriptError(f"line {n}: label '{label}' defined twice")
+                self.labels[label] = self.addr
+                continue
+            if word == "image":
+                sym = toks[1][1]
+                keyed = len(toks) > 2 and toks[2][1] == "keyed"
+                if sym in self.img_index:
+                    raise ScriptError(f"line {n}: image {sym} declared twice")
+                self.img_index[sym] = len(self.images)
+                self.images.append((sym, keyed))
+                continue
+            if word not in OPCODE:
+                raise ScriptError(f"line {n}: unknown op '{word}'")
+            kinds = OPS[OPCODE[word]][1]
+            args = toks[1:]
+            if len(args) != len(kinds):
+                raise ScriptError(f"line {n}: {word} takes {len(kinds)} operands")
+            self.ops.append((n, word, args, self.addr))
+            self.addr += 1 + sum(SIZE[k] for k in kinds)
+
+    def operand(self, n, kind, tok):
+        """
+        Encode one operand as a list of C expressions, one per byte.
+        """
+        t, v = tok
+        if kind == "str":
+            if t == "w" and v == "@name":
+                return [f"SB16(0x{STR_NAME:04X})"]
+            if t != "s":
+                raise ScriptError(f"line {n}: expected a string, got {v}")
+            return [f"SB16({self.add_string(v)})"]
+        if t == "s":
+            raise ScriptError(f"line {n}: unexpected string \"{v}\"")
+        if kind == "img":
+            if v in IMG_SPECIAL:
+                return [IMG_SPECIAL[v]]
+            if v not in self.img_index:
+                raise ScriptError(f"line {n}: image {v} not declared")
+            return [str(self.img_index[v])]
+        if kind == "pos":
+            return ["STORY_CENTER"] if v == "center" else [str(self.number(n, v, 0xFE))]
+        if kind == "prio":
+            if v not in PRIO:
+                raise ScriptError(f"line {n}: defer takes hud, art or off")
+            return [PRIO[v]]
+        if kind == "addr":
+            if v not in self.labels:
+                raise ScriptError(f"line {n}: unknown label '{v}'")
+            return [f"SB16({self.labels[v]})"]
+        if kind == "u16":
+            return [f"SB16({v})" if v[0].isalpha() else f"SB16({self.number(n, v, 0xFFFF)})"]
+        return [v] if v[0].isalpha() else [str(self.number(n, v, 0xFF))]
+
+    @staticmethod
+    def number(n, v, top):
+        try:
+            x = int(v, 0)
+        except ValueError:
+            raise ScriptError(f"line {n}: bad number '{v}'") from None
+        if not 0 <= x <= top:
+            raise ScriptError(f"line {n}: {v} out of range 0..{top}")
+        return x
+
+    def assemble(self):
+        """
+        Second pass: encode every op.
+
+        Returns:
+            list[tuple]: (addr, source line, C byte expressions) per op.
+        """
+        out = []
+        for n, name, args, addr in self.ops:
+            kinds = OPS[OPCODE[name]][1]
+            body = [f"SOP_{name.upper()}"]
+            for kind, tok in zip(kinds, args):
+                body += self.operand(n, kind, tok)
+            out.append((addr, n, name, body))
+        if self.addr > 0xFFFF:
+            raise ScriptError("program exceeds 64 KB")
+        if len(self.pool) >= STR_NAME:
+            raise ScriptError("string pool exceeds 64 KB")
+        if len(self.images) >= 0xFD:
+            raise ScriptError("too many images")
+        if not self.ops or self.ops[-1][1] not in ("end", "jump", "ret", "giveup"):
+            print("warning: script does not end with end/jump/ret")
+        return out
+
+
+def emit(path, src_name, comp, code):
+    with open(path, "w", encoding="utf-8") as fc:
+        fc.write(f"// Generated by story2bc.py from {src_name}; edit the script, not this file.\n")
+        fc.write("#include <stdint.h>\n")
+        fc.write('#include "project.h"\n')
+        fc.write('#include "cheevos.h"\n')
+        fc.write('#include "lore_text.h"\n')
+        fc.write('#include "story_script.h"\n')
+        for sym, _ in comp.images:
+            fc.write(f'#include "{sym.lower()}.h"\n')
+        fc.write("\n")
+
+        fc.write(f"const uint8_t g_story_bc[{comp.addr}] = {{\n")
+        for addr, _, name, body in code:
+            fc.write(f"  /* {addr:5d} */ " + ", ".join(body) + ",\n")
+        fc.write("};\n\n")
+        fc.write(f"const uint16_t g_story_bc_len = {comp.addr}u;\n\n")
+
+        fc.write("const char g_story_str[] =\n")
+        for off, b in comp.pool_lines:
+            fc.write(f"  /* {off:5d} */ {c_string(b)} \"\\0\"\n")
+        fc.write("  ;\n\n")
+
+        fc.write(f"const gfx_image_t *const g_story_img[{len(comp.images)}] = {{\n")
+        for sym, _ in comp.images:
+            fc.write(f"  &{sym}_IMG,\n")
+        fc.write("};\n\n")
+        fc.write(f"const uint16_t g_story_img_key[{len(comp.images)}] = {{\n")
+        for sym, keyed in comp.images:
+            fc.write(f"  {sym + '_KEY' if keyed else 'GFX_KEY_NONE'},\n")
+        fc.write("};\n")
+
+
+def main():
+    """
+    CLI entry point: parse, assemble, emit the C file and print the sizes.
+    """
+    ap = argparse.ArgumentParser(description="Story script -> bytecode C file")
+    ap.add_argument("script", help="script source, e.g. story_script.txt")
+    ap.add_argument("out", help="output .c, e.g. ../src/story_script.c")
+    ap.add_argument("--dump", action="store_true", help="list every op with its address")
+    args = ap.parse_args()
+
+    src = Path(args.script)
+    if not src.is_file():
+        print(f"Input file not found: {src}")
+        sys.exit(1)
+
+    comp = Compiler()
+    try:
+        comp.parse(src.read_text(encoding="utf-8"))
+        code = comp.assemble()
+    except ScriptError as e:
+        print(f"{src}: {e}")
+        sys.exit(1)
+
+    emit(args.out, src.name, comp, code)
+
+    if args.dump:
+        for addr, n, name, body in code:
+            print(f"{addr:5d}  line {n:4d}  {name:8s} {len(body)} B")
+    print(f"Wrote {args.out}: {len(code)} ops, {comp.addr} B code, "
+          f"{len(comp.pool)} B strings, {len(comp.images)} images")
+
+
+if __name__ == "__main__":
+    main()
@@ -2,12 +2,15 @@
 #define MSU_LOGO_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define MSU_LOGO_W 100
 #define MSU_LOGO_H 99
 #define MSU_LOGO_PAL_SIZE 16
+#define MSU_LOGO_RLE_SIZE 1686
 
 extern const uint16_t MSU_LOGO_PAL[MSU_LOGO_PAL_SIZE];
-extern const uint8_t  MSU_LOGO_IDX[(MSU_LOGO_W * MSU_LOGO_H) / 2];
+extern const uint8_t  MSU_LOGO_RLE[MSU_LOGO_RLE_SIZE];
+extern const gfx_image_t MSU_LOGO_IMG;
 
 #endif // MSU_LOGO_H
@@ -75,3 +75,39 @@ int  ads_drdy_edge_count_ms(uint32_t window_ms);
  * @return 0 on success, non-zero on configuration error.
  */
 int  ads_configure_start(void);   // returns 0 on success
+
+/** Channels in one ADS131M02 frame. */
+#define ADS_CHANNELS       2u
+/** Frames the capture ring holds (power of two). */
+#define ADS_CAPTURE_DEPTH  64u
+
+/** One conversion: a sample per channel (scaled to 16 bits). */
+typedef struct {
+  int16_t ch[ADS_CHANNELS];
+} ads_frame_t;
+
+/**
+ * @brief Read every frame from the DRDY interrupt into a ring.
+ *
+ * On each DRDY falling edge the GPIO interrupt reads the frame, stores both
+ * channels and calls notify (interrupt context: it should only flag work).
+ * Frames survive until ads_capture_read() as long as the ring does not
+ * fill; when it is full the newest frame is dropped and counted.
+ *
+ * @param notify Called after each stored frame; may be NULL.
+ */
+void     ads_capture_start(void (*notify)(void));
+
+/**
+ * @brief Take captured frames, oldest first.
+ *
+ * @param[out] dst Destination for up to max frames.
+ * @param max      Capacity of dst.
+ * @return Number of frames copied.
+ */
+uint32_t ads_capture_read(ads_frame_t *dst, uint32_t max);
+
+/**
+ * @brief Frames dropped because the capture ring was full.
+ */
+uint32_t ads_capture_dropped(void);
@@ -13,12 +13,12 @@
 #include <stdbool.h>
 
 // HARDWARE CONFIGURATION
-// SPI Module
+// SPI Module (shared with the OLED, see project.h)
 #define ADS_SPI_BASE        SSI0_BASE
 
-// GPIO Pins
-#define ADS_GPIO_PORT       GPIO_PORTA_BASE
-#define ADS_CS_PIN          GPIO_PIN_3
+// GPIO Pins (PA3 is the OLED's CS)
+#define ADS_GPIO_PORT       GPIO_PORTB_BASE
+#define ADS_CS_PIN          GPIO_PIN_5
 
 #define ADS_DRDY_PORT       GPIO_PORTB_BASE
 #define ADS_DRDY_PIN        GPIO_PIN_0
@@ -29,6 +29,10 @@
 #define ADS_CLKIN_PORT      GPIO_PORTB_BASE
 #define ADS_CLKIN_PIN       GPIO_PIN_6  // PWM output for clock
 
+// CAPTURE
+#define ADS_NUM_CHANNELS    4    // channels per conversion frame
+#define ADS_CAPTURE_FRAMES  64u  // frames the DRDY capture ring holds (power of two)
+
 // REGISTER ADDRESSES
 #define ADS_REG_ID          0x00
 #define ADS_REG_STATUS      0x01
@@ -77,6 +81,13 @@ typedef enum {
  */
 extern const float ADS_FSR_TABLE[8];
 
+/**
+ * @brief One conversion: a sample per channel, scaled to 16 bits.
+ */
+typedef struct {
+    int16_t ch[ADS_NUM_CHANNELS];
+} ADS_Frame;
+
 // FUNCTION PROTOTYPES
 // Initialization
 
@@ -159,6 +170,33 @@ bool ADS_IsDataReady(void);
  */
 void ADS_ReadAllChannels(int32_t *ch1, int32_t *ch2, int32_t *ch3, int32_t *ch4);
 
+/**
+ * @brief Read every conversion from the DRDY interrupt into a ring.
+ *
+ * On each DRDY falling edge (PB0) the GPIO interrupt reads all four
+ * channels, stores them as one ADS_Frame and calls notify (interrupt
+ * context: it should only flag work). When the ring is full the newest
+ * frame is dropped and counted.
+ *
+ * @param notify Called after each stored frame; may be NULL.
+ */
+void ADS_CaptureStart(void (*notify)(void));
+
+/**
+ * @brief Take captured frames, oldest first.
+ *
+ * @param[out] dst Destination for up to max frames.
+ * @param max      Capacity of dst.
+ *
+ * @return Number of frames copied.
+ */
+uint32_t ADS_CaptureRead(ADS_Frame *dst, uint32_t max);
+
+/**
+ * @brief Frames dropped because the capture ring was full.
+ */
+uint32_t ADS_CaptureDropped(void);
+
 // Utility functions
 
 /**
@@ -87,8 +87,9 @@ void cheevos_draw_panel_page(uint8_t page);
 /**
  * @brief Draw a transient "Achievement Unlocked!" toast overlay.
  *
- * Safe to call every frame from the main render loop. Does nothing if
- * no recent unlock is pending display.
+ * Safe to call every frame from the main render loop. Draws the toast
+ * once into the gfx overlay band and removes it when it times out; frames
+ * in between send nothing. Does nothing if no recent unlock is pending.
  */
 void cheevos_draw_toast(void);
 
@@ -2,12 +2,15 @@
 #define CHEST_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define CHEST_W 128
 #define CHEST_H 85
 #define CHEST_PAL_SIZE 16
+#define CHEST_RLE_SIZE 1627
 
 extern const uint16_t CHEST_PAL[CHEST_PAL_SIZE];
-extern const uint8_t  CHEST_IDX[(CHEST_W * CHEST_H) / 2];
+extern const uint8_t  CHEST_RLE[CHEST_RLE_SIZE];
+extern const gfx_image_t CHEST_IMG;
 
 #endif // CHEST_H
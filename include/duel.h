@@ -0,0 +1,56 @@
+/**
+ * @file duel.h
+ * @brief Sequential winner test for a two-player flex round.
+ *
+ * Each player's round is a series of DSP windows (EMG_PIPE_WINDOW_MS each);
+ * the round accumulators give their mean, variance and lag-1
+ * autocorrelation over the time the player was active, and the standard
+ * error uses the effective number of windows. A lead counts as significant
+ * when the difference of the means exceeds the tie margin (TIE_MARGIN_PCT
+ * of the higher mean) by more than DUEL_Z standard errors. A significant
+ * lead by the same player for DUEL_HOLD_MS (and not before DUEL_MIN_MS)
+ * decides the round early. At the end of the round a player wins if the
+ * difference is both larger than the margin and DUEL_Z standard errors;
+ * anything else is a tie.
+ */
+
+#ifndef DUEL_H
+#define DUEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "round_acc.h"
+
+/** Outcome of duel_step(). */
+typedef enum {
+  DUEL_OPEN = 0,   ///< Not decided yet; keep playing.
+  DUEL_P1,         ///< Player 1 wins.
+  DUEL_P2,         ///< Player 2 wins.
+  DUEL_TIE         ///< No justified winner at the end of the round.
+} duel_verdict_t;
+
+/** Test state for one round. */
+typedef struct {
+  int8_t   leader;        ///< 0 or 1 while a lead is significant, else -1.
+  uint32_t lead_from_ms;  ///< Round time at which that lead became significant.
+} duel_t;
+
+/**
+ * @brief Start a new round.
+ */
+void duel_reset(duel_t *d);
+
+/**
+ * @brief Feed the round so far and get a verdict.
+ *
+ * @param d     Test state.
+ * @param p1    Player 1 statistics (round_acc_peek() / round_acc_done()).
+ * @param p2    Player 2 statistics.
+ * @param t_ms  Time since the round started.
+ * @param final true at the end of the round: never returns DUEL_OPEN.
+ * @return The verdict; DUEL_OPEN while an early call is not justified.
+ */
+duel_verdict_t duel_step(duel_t *d, const round_stats_t *p1,
+                         const round_stats_t *p2, uint32_t t_ms, bool final);
+
+#endif /* DUEL_H */
@@ -0,0 +1,86 @@
+/**
+ * @file emg_pipe.h
+ * @brief Per-channel EMG pipeline: zero-cross Hz, envelope and baseline.
+ *
+ * Every ADC frame is pushed sample by sample into one independent pipeline
+ * per channel (rising zero-cross counter and rectified envelope). Every
+ * EMG_PIPE_WINDOW_MS the DSP closes the window: each channel turns its
+ * count into Hz, updates its own baseline, subtracts and scales it, and the
+ * results fill one metrics_t snapshot.
+ */
+
+#ifndef EMG_PIPE_H
+#define EMG_PIPE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "metrics.h"
+
+/** Channels processed (one player each). */
+#define EMG_PIPE_CH         METRICS_CH
+/** Zero-cross counting window (ms). */
+#define EMG_PIPE_WINDOW_MS  100u
+/** Channel mask covering every channel. */
+#define EMG_PIPE_ALL        ((uint8_t)((1u << EMG_PIPE_CH) - 1u))
+
+/**
+ * @brief Reset every channel and start the first window at now_ms.
+ */
+void emg_pipe_init(uint32_t now_ms);
+
+/**
+ * @brief Push one ADC frame (one sample per channel).
+ *
+ * @param s EMG_PIPE_CH samples, channel 0 first.
+ */
+void emg_pipe_push(const int16_t *s);
+
+/**
+ * @brief true once the current window has run EMG_PIPE_WINDOW_MS.
+ */
+bool emg_pipe_due(uint32_t now_ms);
+
+/**
+ * @brief Close the window: Hz, baselines and a full snapshot.
+ *
+ * @param now_ms   End of the window.
+ * @param[out] m   Snapshot to fill (seq is left for metrics_publish()).
+ * @return Start of the window, i.e. m holds over [return, now_ms);
+ *         equal to now_ms (and m untouched) if the window is empty.
+ */
+uint32_t emg_pipe_close(uint32_t now_ms, metrics_t *m);
+
+/**
+ * @brief Start a baseline measurement on some channels.
+ *
+ * Each channel in the mask averages its raw Hz over window_ms and then
+ * subtracts that from everything it reports.
+ *
+ * @param mask      Bit n = channel n.
+ * @param window_ms Averaging time.
+ */
+void emg_pipe_baseline_begin(uint8_t mask, uint32_t window_ms);
+
+/**
+ * @brief Re-measure the baseline on some channels in the background.
+ *
+ * Same as emg_pipe_baseline_begin(), except that a channel with a finished
+ * baseline keeps reporting it until the new window replaces it.
+ */
+void emg_pipe_baseline_refresh(uint8_t mask, uint32_t window_ms);
+
+/**
+ * @brief Stop a running baseline window on some channels, discarding it.
+ *
+ * A channel that was refreshing goes back to its previous baseline; one
+ * that had none stays without.
+ */
+void emg_pipe_baseline_cancel(uint8_t mask);
+
+/**
+ * @brief true when channel ch has a baseline from a finished window and
+ *        no new window is running.
+ */
+bool emg_pipe_baseline_ready(uint8_t ch);
+
+#endif /* EMG_PIPE_H */
@@ -2,12 +2,15 @@
 #define END_CREDITS_LOGO_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define END_CREDITS_LOGO_W 128
 #define END_CREDITS_LOGO_H 73
 #define END_CREDITS_LOGO_PAL_SIZE 16
+#define END_CREDITS_LOGO_RLE_SIZE 1067
 
 extern const uint16_t END_CREDITS_LOGO_PAL[END_CREDITS_LOGO_PAL_SIZE];
-extern const uint8_t  END_CREDITS_LOGO_IDX[(END_CREDITS_LOGO_W * END_CREDITS_LOGO_H) / 2];
+extern const uint8_t  END_CREDITS_LOGO_RLE[END_CREDITS_LOGO_RLE_SIZE];
+extern const gfx_image_t END_CREDITS_LOGO_IMG;
 
 #endif // END_CREDITS_LOGO_H
@@ -2,12 +2,15 @@
 #define ENEMY_ICON_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define ENEMY_ICON_W 26
 #define ENEMY_ICON_H 30
 #define ENEMY_ICON_PAL_SIZE 16
+#define ENEMY_ICON_RLE_SIZE 245
 
 extern const uint16_t ENEMY_ICON_PAL[ENEMY_ICON_PAL_SIZE];
-extern const uint8_t  ENEMY_ICON_IDX[(ENEMY_ICON_W * ENEMY_ICON_H) / 2];
+extern const uint8_t  ENEMY_ICON_RLE[ENEMY_ICON_RLE_SIZE];
+extern const gfx_image_t ENEMY_ICON_IMG;
 
 #endif // ENEMY_ICON_H
@@ -2,12 +2,15 @@
 #define EQUIPMENT_ICON_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define EQUIPMENT_ICON_W 29
 #define EQUIPMENT_ICON_H 30
 #define EQUIPMENT_ICON_PAL_SIZE 16
+#define EQUIPMENT_ICON_RLE_SIZE 308
 
 extern const uint16_t EQUIPMENT_ICON_PAL[EQUIPMENT_ICON_PAL_SIZE];
-extern const uint8_t  EQUIPMENT_ICON_IDX[(EQUIPMENT_ICON_W * EQUIPMENT_ICON_H) / 2];
+extern const uint8_t  EQUIPMENT_ICON_RLE[EQUIPMENT_ICON_RLE_SIZE];
+extern const gfx_image_t EQUIPMENT_ICON_IMG;
 
 #endif // EQUIPMENT_ICON_H
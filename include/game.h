@@ -3,7 +3,7 @@
  * @brief Top-level game state machine and mode selection.
  *
  * Owns the OLED/game loop, routes ticks to the active mode
- * (Playground, PVP, Story, Tower, Credits), and exposes shared
+ * (Playground, PVP, Story, Tower, Credits, 4P bracket), and exposes shared
  * metrics (Hz, intensity, baseline).
  */
 
@@ -20,7 +20,8 @@ typedef enum {
   MODE_PVP       = 1,    ///< Former two-player competitive mode.
   MODE_STORY     = 2,    ///< Story campaign.
   MODE_TOWER     = 3,    ///< Tower challenge mode.
-  MODE_CREDITS   = 4     ///< End credits / roll.
+  MODE_CREDITS   = 4,    ///< End credits / roll.
+  MODE_QUAD      = 5     ///< Four-player bracket (ADS_FRONTEND_M04 builds).
 } game_mode_t;
 
 /**
@@ -30,21 +31,6 @@ typedef enum {
  */
 void game_init(void);
 
-/**
- * @brief Feed latest EMG-derived metrics from the main loop.
- *
- * @param hz            Current Hz measurement.
- * @param intensity_pct Current intensity (0–100%).
- */
-void game_set_metrics(float hz, uint8_t intensity_pct);
-
-/**
- * @brief Set the current baseline Hz.
- *
- * @param baseline_hz Baseline frequency estimate in Hz.
- */
-void game_set_baseline(float baseline_hz);
-
 /**
  * @brief Begin baseline measurement over a fixed-time window.
  *
@@ -72,7 +58,9 @@ void game_set_mode(uint8_t two_player);  // 0 = single (default), 1 = two-player
 /**
  * @brief Retrieve current metrics (Hz, intensity, baseline).
  *
- * All output pointers are optional; pass NULL to skip a value.
+ * Seat 0's channel (pqueue_seat(0)) of the latest metrics_read() snapshot;
+ * the DSP feeds it with metrics_publish(). All output pointers are optional; pass NULL to skip
+ * a value.
  *
  * @param[out] hz            Pointer to receive current Hz.
  * @param[out] intensity_pct Pointer to receive current intensity.
@@ -0,0 +1,29 @@
+/**
+ * @file game_four.h
+ * @brief Four-player bracket mode (ADS131M04 front end).
+ *
+ * All four players flex at once, one per ADC channel. The first round
+ * settles both semifinals (P1 vs P2, P3 vs P4); the second runs the final
+ * and the third-place match side by side.
+ */
+
+#ifndef GAME_FOUR_H
+#define GAME_FOUR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Initialize the four-player bracket mode.
+ */
+void game_four_init(void);
+
+/**
+ * @brief Advance the four-player bracket mode by one frame.
+ *
+ * @return true when the mode has finished and the caller may transition
+ *         back to the menu; false while the mode is still active.
+ */
+bool game_four_tick(void);
+
+#endif /* GAME_FOUR_H */
@@ -2,12 +2,15 @@
 #define GAME_OPENING_SCREEN_LOGO_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define GAME_OPENING_SCREEN_LOGO_W 128
 #define GAME_OPENING_SCREEN_LOGO_H 128
 #define GAME_OPENING_SCREEN_LOGO_PAL_SIZE 16
+#define GAME_OPENING_SCREEN_LOGO_RLE_SIZE 2563
 
 extern const uint16_t GAME_OPENING_SCREEN_LOGO_PAL[GAME_OPENING_SCREEN_LOGO_PAL_SIZE];
-extern const uint8_t  GAME_OPENING_SCREEN_LOGO_IDX[(GAME_OPENING_SCREEN_LOGO_W * GAME_OPENING_SCREEN_LOGO_H) / 2];
+extern const uint8_t  GAME_OPENING_SCREEN_LOGO_RLE[GAME_OPENING_SCREEN_LOGO_RLE_SIZE];
+extern const gfx_image_t GAME_OPENING_SCREEN_LOGO_IMG;
 
 #endif // GAME_OPENING_SCREEN_LOGO_H
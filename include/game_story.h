@@ -2,13 +2,25 @@
  * @file game_story.h
  * @brief Story mode state machine.
  *
- * Handles chapter progression, enemy images, and story-specific UI.
+ * Handles chapter progression, enemy images, and story-specific UI. The
+ * flow itself is the compiled story script (story_script.h), run one step
+ * per tick.
  */
 
 #ifndef GAME_STORY_H
 #define GAME_STORY_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#ifdef HOST_SIM
+/** Per-opcode interpreter counters (since game_story_init()); host builds only. */
+typedef struct {
+  uint32_t runs;      ///< Times the op ran (a waiting op runs every tick).
+  uint32_t total_us;  ///< Time spent in it.
+  uint32_t worst_us;  ///< Longest single run.
+} story_op_stats_t;
+#endif
 
 /**
  * @brief Initialize story mode state.
@@ -25,4 +37,15 @@ void game_story_init(void);
  */
 bool game_story_tick(void);
 
+#ifdef HOST_SIM
+/**
+ * @brief Copy one opcode's counters (HOST_SIM only; the firmware does not
+ *        time its ops).
+ *
+ * @param op  Opcode (story_op_t).
+ * @param out Destination; zeroed for an unknown opcode.
+ */
+void game_story_op_stats(uint8_t op, story_op_stats_t *out);
+#endif
+
 #endif /* GAME_STORY_H */
@@ -2,12 +2,15 @@
 #define GAME_TOWER_LOGO_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define GAME_TOWER_LOGO_W 128
 #define GAME_TOWER_LOGO_H 77
 #define GAME_TOWER_LOGO_PAL_SIZE 16
+#define GAME_TOWER_LOGO_RLE_SIZE 1734
 
 extern const uint16_t GAME_TOWER_LOGO_PAL[GAME_TOWER_LOGO_PAL_SIZE];
-extern const uint8_t  GAME_TOWER_LOGO_IDX[(GAME_TOWER_LOGO_W * GAME_TOWER_LOGO_H) / 2];
+extern const uint8_t  GAME_TOWER_LOGO_RLE[GAME_TOWER_LOGO_RLE_SIZE];
+extern const gfx_image_t GAME_TOWER_LOGO_IMG;
 
 #endif // GAME_TOWER_LOGO_H
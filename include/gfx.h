@@ -13,6 +13,122 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * @brief Reset gfx state: clip rect, start line and full brightness.
+ *
+ * Call once after ssd1351_init().
+ */
+void gfx_init(void);
+
+/* Overlay band (toasts) */
+
+/** First panel row of the overlay band (the band runs to the bottom edge). */
+#define GFX_OVERLAY_Y  110u
+/** Rows in the overlay band. */
+#define GFX_OVERLAY_H  (128u - GFX_OVERLAY_Y)
+
+/**
+ * @brief Start drawing an overlay into the bottom band.
+ *
+ * gfx keeps a copy of what the modes drew in the band. Draws between this
+ * call and gfx_overlay_end() are the overlay itself: they reach the panel
+ * but not the copy.
+ *
+ * @return false (nothing changes) while a scrolled text page owns the panel.
+ */
+bool gfx_overlay_begin(void);
+
+/**
+ * @brief Finish drawing the overlay; the band now belongs to it.
+ *
+ * Until gfx_overlay_close(), any draw into the band only updates the copy,
+ * so an overlay costs no SPI traffic while it stays up.
+ */
+void gfx_overlay_end(void);
+
+/**
+ * @brief Remove the overlay: the band gets the modes' latest content back.
+ *
+ * One 128 x GFX_OVERLAY_H window. Also called by gfx when a text page
+ * starts scrolling, since the band would move with it.
+ */
+void gfx_overlay_close(void);
+
+/** @brief true between gfx_overlay_begin() and gfx_overlay_close(). */
+bool gfx_overlay_active(void);
+
+/* Render scheduler (deferred drawing) */
+
+/** Draw jobs that can be queued; a deferred draw that finds no room runs now. */
+#define GFX_JOBS_MAX   24u
+/** Rows a job sends per slice; gfx_jobs_run() checks its budget between slices. */
+#define GFX_JOB_ROWS   4u
+/** Job priority for headers, labels and HUD text: sent first. */
+#define GFX_PRIO_HUD   0u
+/** Job priority for clears and background art. */
+#define GFX_PRIO_ART   1u
+
+/** Scheduler counters, see gfx_jobs_stats(). */
+typedef struct {
+  uint32_t runs;         /**< gfx_jobs_run() calls that found work. */
+  uint32_t overruns;     /**< Calls that ended past their budget. */
+  uint32_t worst_us;     /**< Longest call, in microseconds. */
+  uint32_t over_us;      /**< Largest time past the budget, in microseconds. */
+  uint32_t rows;         /**< Rows sent by gfx_jobs_run() / gfx_jobs_flush(). */
+  uint32_t forced_rows;  /**< Rows sent early because an immediate draw overlapped them. */
+  uint32_t dropped;      /**< Jobs discarded because a later opaque draw hid them. */
+  uint32_t fallbacks;    /**< Deferred draws done immediately (queue or decoders full). */
+  uint8_t  queue_max;    /**< Deepest queue seen. */
+} gfx_jobs_stats_t;
+
+/**
+ * @brief Queue the following draws as jobs at priority @p prio.
+ *
+ * Until gfx_defer_end(), gfx_bar(), gfx_clear(), gfx_header(), the text
+ * calls, gfx_blit_image() and gfx_compose() record a job instead of
+ * streaming pixels. Outside a section those calls are queued too when they
+ * land on rows still queued (at GFX_PRIO_HUD, behind them); every other draw
+ * first sends the queued rows under it. Either way the panel ends up as if
+ * the calls had run in order.
+ *
+ * @param prio GFX_PRIO_HUD or GFX_PRIO_ART (lower is sent first).
+ */
+void gfx_defer_begin(uint8_t prio);
+
+/** @brief Back to immediate drawing; queued jobs stay queued. */
+void gfx_defer_end(void);
+
+/**
+ * @brief Send queued jobs, best priority first, for about @p budget_us.
+ *
+ * Works in slices of GFX_JOB_ROWS rows and calls the yield hook after each
+ * slice. It stops when another slice as long as the last one would not fit;
+ * the first slice always runs, so a call can still end past its budget
+ * (counted in gfx_jobs_stats_t::overruns).
+ *
+ * @param budget_us Time budget in microseconds.
+ */
+void gfx_jobs_run(uint32_t budget_us);
+
+/** @brief Send every queued job now. */
+void gfx_jobs_flush(void);
+
+/** @brief true when no job is queued. */
+bool gfx_jobs_idle(void);
+
+/**
+ * @brief Set a function gfx_jobs_run() calls between slices (or NULL).
+ *
+ * Lets the main loop service acquisition while a large scene streams out.
+ */
+void gfx_jobs_set_yield(void (*fn)(void));
+
+/** @brief Copy the scheduler counters into @p out. */
+void gfx_jobs_stats(gfx_jobs_stats_t *out);
+
+/** @brief Zero the scheduler counters. */
+void gfx_jobs_stats_reset(void);
+
 /**
  * @brief Clear the entire screen to a solid color.
  *
@@ -52,6 +168,41 @@ void gfx_text(uint8_t x, uint8_t y, const char* s, uint16_t color);
  */
 void gfx_text2(uint8_t x, uint8_t y, const char* s, uint16_t color, uint8_t scale);
 
+/**
+ * @brief Draw opaque scaled text (glyphs plus background) in one window.
+ *
+ * Rows are rasterized into a line buffer and streamed through a single
+ * window sized to the string, so no separate clear is needed.
+ *
+ * @param x     Left X coordinate in pixels.
+ * @param y     Top Y coordinate in pixels.
+ * @param s     Null-terminated string to draw.
+ * @param fg    RGB565 text color.
+ * @param bg    RGB565 background color.
+ * @param scale Integer scale factor (1 = 5x7, 2 = 10x14, etc.).
+ */
+void gfx_text2_bg(uint8_t x, uint8_t y, const char* s,
+                  uint16_t fg, uint16_t bg, uint8_t scale);
+
+/**
+ * @brief Repaint a fixed-size text field in one window.
+ *
+ * Text is drawn at the field's top-left corner and the rest of the w x h
+ * box is filled with bg. Replaces the gfx_bar() clear + gfx_text2() pair
+ * for values that change in place.
+ *
+ * @param x     Left X coordinate in pixels.
+ * @param y     Top Y coordinate in pixels.
+ * @param w     Field width in pixels.
+ * @param h     Field height in pixels.
+ * @param s     Null-terminated string to draw.
+ * @param fg    RGB565 text color.
+ * @param bg    RGB565 background color.
+ * @param scale Integer scale factor.
+ */
+void gfx_text2_field(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const char* s,
+                     uint16_t fg, uint16_t bg, uint8_t scale);
+
 /* Optional countdown overlay API */
 
 /**
@@ -70,6 +221,32 @@ void gfx_countdown_begin(uint32_t now_ms, uint16_t bg);
  */
 bool gfx_countdown_tick(uint32_t now_ms);
 
+/* Fade transitions (master contrast, no pixel traffic) */
+
+/** Duration of each half of a fade (out, then in), in ms. */
+#define GFX_FADE_MS  120u
+
+/**
+ * @brief Start fading the current screen out.
+ *
+ * The panel ramps to dark over GFX_FADE_MS. The caller's state machine
+ * should not draw until gfx_fade_tick() stops returning true; the first
+ * draw after that happens on a dark panel, and the panel then fades back
+ * in. Calling this during a fade continues from the current brightness.
+ *
+ * @param now_ms Current time in milliseconds.
+ * @return Time (ms) at which the panel is dark and the next scene starts.
+ */
+uint32_t gfx_fade_out(uint32_t now_ms);
+
+/**
+ * @brief Advance the fade; call once per game tick before any drawing.
+ *
+ * @param now_ms Current time in milliseconds.
+ * @return true while the old scene is still fading out (do not draw).
+ */
+bool gfx_fade_tick(uint32_t now_ms);
+
 /* Header-band helpers */
 
 /**
@@ -87,6 +264,145 @@ void gfx_header(const char* s, uint16_t color);
  */
 void gfx_clear_header_band(uint16_t color);
 
+/* Scrolling text viewport */
+
+/** Pass as gfx_scroll_t::x to center every line. */
+#define GFX_SCROLL_CENTER  0xFFu
+
+/** Most lines a gfx_scroll_t page can hold (extra lines are dropped). */
+#define GFX_SCROLL_LINES_MAX  16u
+
+/** Deepest nesting of byte-pair codes in packed text. */
+#define GFX_BPE_DEPTH  8u
+
+/**
+ * Byte-pair dictionary for packed text (emitted by lore2bpe.py).
+ *
+ * A packed line is a byte string ended by 0x00. Bytes 0x01-0x7F are
+ * characters; byte 0x80 + k stands for pairs[2k], pairs[2k+1], each a
+ * character or another code, nested at most GFX_BPE_DEPTH codes deep.
+ * Codes never span lines, so every line decodes on its own.
+ */
+typedef struct {
+  const uint8_t *pairs;   /**< Two bytes per code. */
+  const uint8_t *lens;    /**< Characters each code expands to. */
+} gfx_bpe_t;
+
+/** Page of packed lines, see gfx_scroll_begin_bpe(). */
+typedef struct {
+  const gfx_bpe_t *bpe;   /**< Dictionary. */
+  const uint8_t   *data;  /**< The lines back to back. */
+  uint8_t          count; /**< Number of lines. */
+} gfx_bpe_page_t;
+
+/** Streaming decoder for one packed line. */
+typedef struct {
+  const gfx_bpe_t *bpe;
+  const uint8_t   *p;                   /**< Next byte of the line. */
+  uint8_t          sp;                  /**< Codes waiting on stk. */
+  uint8_t          stk[GFX_BPE_DEPTH];  /**< Second halves still to expand. */
+} gfx_bpe_reader_t;
+
+/**
+ * @brief Start decoding a packed line.
+ *
+ * @param r    Decoder state.
+ * @param bpe  Dictionary.
+ * @param line First byte of the line.
+ * @param skip Characters to skip; whole codes are skipped by length.
+ */
+void gfx_bpe_open(gfx_bpe_reader_t* r, const gfx_bpe_t* bpe,
+                  const uint8_t* line, uint16_t skip);
+
+/**
+ * @brief Next character of the line, or 0 at its end.
+ */
+char gfx_bpe_next(gfx_bpe_reader_t* r);
+
+/**
+ * Text page taller than the panel, scrolled with the SSD1351 start line.
+ *
+ * Content row r is stored in GDDRAM row r & 127 and the panel shows content
+ * rows [scroll, scroll+128). Advancing the scroll writes only the rows that
+ * come into view; revealing characters writes only their glyph cells. The
+ * viewport owns the whole panel while scrolled: anything drawn at content
+ * rows 0..127 before the first scroll (header, decorations) scrolls away
+ * with the text. gfx_clear() puts the start line back to 0.
+ *
+ * Line lengths and typing offsets are laid out once by gfx_scroll_begin(),
+ * so a typewriter step costs only the glyph cells it reveals.
+ */
+typedef struct {
+  const char* const* lines;   /**< Text lines (NULL entries are skipped). */
+  const gfx_bpe_page_t* page; /**< Packed lines instead, or NULL. */
+  const uint16_t*    colors;  /**< Per-line color, or NULL to use fg. */
+  uint8_t  count;             /**< Number of lines. */
+  uint8_t  x;                 /**< Left column, or GFX_SCROLL_CENTER. */
+  uint8_t  top;               /**< Content row of the first line. */
+  uint8_t  pitch;             /**< Rows per line (font is 7 rows tall). */
+  uint16_t fg, bg;            /**< Text and background colors. */
+  uint16_t scroll;            /**< Content row shown on panel row 0. */
+  uint16_t painted;           /**< Content rows below this are in GDDRAM. */
+  uint16_t chars;             /**< Characters revealed; 0xFFFF shows all. */
+  uint8_t  cursor;            /**< Line the typewriter has reached. */
+  uint8_t  len[GFX_SCROLL_LINES_MAX];    /**< Drawn characters per line. */
+  uint16_t start[GFX_SCROLL_LINES_MAX];  /**< Characters typed before each line. */
+  uint16_t at[GFX_SCROLL_LINES_MAX];     /**< Packed: byte offset of each line. */
+} gfx_scroll_t;
+
+/**
+ * @brief Start a scrolling text page on a freshly cleared screen.
+ *
+ * Defaults: x = 4, pitch = 10, white on black, nothing revealed. Fields may
+ * be changed after this call and before the first gfx_scroll_type() or
+ * gfx_scroll_to().
+ *
+ * @param v     Viewport state (caller-owned, usually static).
+ * @param lines Text lines.
+ * @param count Number of lines (at most GFX_SCROLL_LINES_MAX).
+ * @param top   Content row of the first line (128 starts below the panel).
+ */
+void gfx_scroll_begin(gfx_scroll_t* v, const char* const* lines,
+                      uint8_t count, uint8_t top);
+
+/**
+ * @brief gfx_scroll_begin() for a packed page.
+ *
+ * Characters are decoded as they are drawn, so the page is never unpacked
+ * into RAM; a typewriter step decodes only the glyphs it reveals.
+ *
+ * @param v    Viewport state.
+ * @param page Packed lines (at most GFX_SCROLL_LINES_MAX).
+ * @param top  Content row of the first line.
+ */
+void gfx_scroll_begin_bpe(gfx_scroll_t* v, const gfx_bpe_page_t* page,
+                          uint8_t top);
+
+/**
+ * @brief Typewriter reveal: show the first @p chars characters.
+ *
+ * Counting matches the old per-mode lore typewriters (each line break
+ * consumes one character). Only the newly revealed glyph cells are written.
+ * When the line being typed runs past the bottom of the panel the view
+ * scrolls toward it by one row per call, which gives a smooth scroll at
+ * the game tick rate.
+ *
+ * @param v     Viewport state.
+ * @param chars Characters revealed so far (e.g. elapsed_ms / ms_per_char).
+ */
+void gfx_scroll_type(gfx_scroll_t* v, uint32_t chars);
+
+/**
+ * @brief Scroll forward so content row @p scroll is at the top of the panel.
+ *
+ * Writes only the rows that were not in view yet, then moves the start
+ * line. Scrolling backwards is ignored.
+ *
+ * @param v      Viewport state.
+ * @param scroll New top content row.
+ */
+void gfx_scroll_to(gfx_scroll_t* v, uint16_t scroll);
+
 /**
  * @brief Blit a raw RGB565 image to the screen.
  *
@@ -98,6 +414,67 @@ void gfx_clear_header_band(uint16_t color);
  */
 void gfx_blit565(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint16_t *pixels);
 
+/** Pixel formats for gfx_image_t. */
+typedef enum {
+  GFX_IMG_PAL4     = 0,  /**< Packed 4-bit indices, 2 per byte, hi nibble first. */
+  GFX_IMG_PAL4_RLE = 1,  /**< 4-bit indices, run-length coded (see below). */
+  GFX_IMG_IDX1     = 2,  /**< Packed 1-bit indices, 8 per byte, MSB first. */
+  GFX_IMG_IDX2     = 3,  /**< Packed 2-bit indices, 4 per byte, MSB first. */
+  GFX_IMG_IDX8     = 4,  /**< One byte per pixel, up to 256 colors. */
+  GFX_IMG_TILE8    = 5   /**< 8x8 tiles of 4-bit indices; data is the tile map. */
+} gfx_img_fmt_t;
+
+/**
+ * @brief Indexed image asset descriptor (emitted by png2pal4.py as <NAME>_IMG).
+ *
+ * GFX_IMG_PAL4_RLE token byte t, pixels in row-major order:
+ *  - 0x00-0x3F literal: t+1 indices follow, packed 2 per byte (hi first)
+ *  - 0x40-0x7F copy-up: (t&0x3F)+2 pixels equal to the pixel one row above
+ *  - 0x80-0xEF run: ((t>>4)&7)+2 pixels of color t&0x0F
+ *  - 0xF0-0xFF long run: 9 + next byte pixels of color t&0x0F
+ *
+ * Tokens may span rows. The decoder streams one row at a time and needs
+ * only a 128-byte index row plus the gfx line buffer.
+ *
+ * Raw formats (IDX1/IDX2/PAL4/IDX8) are row-major and continuous across
+ * rows (a row does not start on a byte boundary). png2pal4.py picks the
+ * smallest of these and RLE for each asset.
+ *
+ * GFX_IMG_TILE8: data is a row-major map of ceil(w/8)*ceil(h/8) one-byte
+ * tile numbers into tiles[], where each tile is 8 rows of 4 bytes (PAL4,
+ * hi nibble first). Several images may point at the same tile dictionary.
+ */
+typedef struct {
+  uint8_t         w;     /**< Width in pixels (<= 128). */
+  uint8_t         h;     /**< Height in pixels (<= 128). */
+  uint8_t         fmt;   /**< gfx_img_fmt_t. */
+  const uint16_t *pal;   /**< RGB565 palette. */
+  uint16_t        colors; /**< Entries in pal; indices at or past it draw black. */
+  const uint8_t  *data;  /**< Pixel stream in fmt. */
+  uint16_t        size;  /**< Bytes in data. */
+  const uint8_t  *tiles; /**< GFX_IMG_TILE8 only: tile dictionary, 32 bytes per tile. */
+} gfx_image_t;
+
+/**
+ * 16-color palettes (PAL4, PAL4_RLE, TILE8) whose pixel-pair lookup tables
+ * (1 KB each) gfx keeps. Palettes are recognised by address, so a palette
+ * must not change while an image using it is on screen.
+ */
+#define GFX_PAL_LUT_SLOTS  2u
+
+/**
+ * @brief Blit an indexed image asset through a single window.
+ *
+ * Rows are decoded and palette-expanded one at a time, then clipped.
+ * 16-color formats expand through a cached pixel-pair table already in
+ * panel byte order (see GFX_PAL_LUT_SLOTS).
+ *
+ * @param x   Left X coordinate.
+ * @param y   Top Y coordinate.
+ * @param img Image descriptor (e.g. &CHEST_IMG).
+ */
+void gfx_blit_image(uint8_t x, uint8_t y, const gfx_image_t *img);
+
 /**
  * @brief Draw a 4-bit (16-color) paletted image.
  *
@@ -115,6 +492,83 @@ void gfx_blit_pal4(uint8_t x, uint8_t y,
                    const uint8_t  *idx,
                    const uint16_t *pal);
 
+/** Layer key value meaning "opaque" (no transparent index). */
+#define GFX_KEY_NONE            0xFFFFu
+
+/** Maximum layers gfx_compose() merges per call. */
+#define GFX_COMPOSE_MAX_LAYERS  4
+
+/** One compositor layer: an image placed at (x, y) with an optional color key. */
+typedef struct {
+  const gfx_image_t *img;  /**< Image asset (any gfx_img_fmt_t). */
+  int16_t            x;    /**< Left edge on screen (may be off-screen). */
+  int16_t            y;    /**< Top edge on screen (may be off-screen). */
+  uint16_t           key;  /**< Palette index to treat as transparent, or GFX_KEY_NONE. */
+} gfx_layer_t;
+
+/**
+ * @brief Recompose a screen region from a background color and image layers.
+ *
+ * Each row is built in the line buffer (bg, then layers in order, skipping
+ * keyed pixels) and the region goes out through one window, so nothing
+ * under a sprite is ever erased on the panel. Use a small region (or
+ * gfx_set_clip()) to repair just a damaged area.
+ *
+ * @param x      Region left X.
+ * @param y      Region top Y.
+ * @param w      Region width.
+ * @param h      Region height.
+ * @param bg     RGB565 color where no layer covers the pixel.
+ * @param layers Layers, bottom first.
+ * @param n      Number of layers (at most GFX_COMPOSE_MAX_LAYERS).
+ */
+void gfx_compose(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t bg,
+                 const gfx_layer_t *layers, uint8_t n);
+
+/**
+ * @brief Delta-frame animation (emitted by image_converter/anim2delta.py).
+ *
+ * Frame 0 is a full keyframe image. delta + offs[k] holds the spans that
+ * turn frame k-1 into frame k (offs[0] turns the last frame back into
+ * frame 0, so the sequence can loop). Each span is:
+ *
+ *   y, x, n, then GFX_IMG_PAL4_RLE tokens for exactly n pixels
+ *   (no copy-up tokens)
+ *
+ * A y of 0xFF ends the frame.
+ */
+typedef struct {
+  uint8_t            w;      /**< Frame width in pixels. */
+  uint8_t            h;      /**< Frame height in pixels. */
+  uint8_t            frames; /**< Number of frames (>= 1). */
+  const uint16_t    *pal;    /**< RGB565 palette shared by key and spans. */
+  const gfx_image_t *key;    /**< Frame 0. */
+  const uint16_t    *offs;   /**< Per-frame byte offset into delta. */
+  const uint8_t     *delta;  /**< Span stream. */
+} gfx_anim_t;
+
+/**
+ * @brief Draw frame 0 of an animation in full.
+ *
+ * @param x Left X coordinate of the frame.
+ * @param y Top Y coordinate of the frame.
+ * @param a Animation descriptor.
+ */
+void gfx_anim_key(uint8_t x, uint8_t y, const gfx_anim_t *a);
+
+/**
+ * @brief Advance the screen from frame-1 to frame by pushing only changed spans.
+ *
+ * The caller must have drawn the previous frame (frame 0 via
+ * gfx_anim_key()). frame 0 applies the loop delta from the last frame.
+ *
+ * @param x     Left X coordinate of the frame.
+ * @param y     Top Y coordinate of the frame.
+ * @param a     Animation descriptor.
+ * @param frame Frame to show (0..frames-1).
+ */
+void gfx_anim_step(uint8_t x, uint8_t y, const gfx_anim_t *a, uint8_t frame);
+
 /* Internal tiny helpers for text layout, matching gfx_text2 spacing */
 
 /**
@@ -272,6 +726,24 @@ static inline void gfx_center_text_nl_scaled_xy(const char* s, uint16_t color, u
   __gfx_center_line_xy(y1, bot, color, sx);
 }
 
+/**
+ * @brief Restrict all gfx drawing to a rectangle.
+ *
+ * Every primitive, text and blit routine in gfx.c passes through the same
+ * clip stage; pixels outside the rectangle are not sent to the panel.
+ *
+ * @param x Left X coordinate.
+ * @param y Top Y coordinate.
+ * @param w Width in pixels.
+ * @param h Height in pixels.
+ */
+void gfx_set_clip(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+
+/**
+ * @brief Reset the clip rectangle to the full 128x128 panel.
+ */
+void gfx_reset_clip(void);
+
 /**
  * @brief Draw a single pixel.
  *
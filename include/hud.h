@@ -0,0 +1,176 @@
+/**
+ * @file hud.h
+ * @brief Retained HUD widgets: bars, numeric labels and countdowns.
+ *
+ * Each widget remembers what it last put on screen and repaints only the
+ * difference: a bar moving from 60 to 62 px sends 2 columns, a label going
+ * from 41.3 to 41.8 sends one digit cell. Widgets are plain structs owned
+ * by the caller (usually static in the mode file); *_init() draws the
+ * widget once and later updates are deltas.
+ */
+
+#ifndef HUD_H
+#define HUD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** hud_bar_t::mark_px value when no marker is shown. */
+#define HUD_NO_MARK  0xFFu
+
+/** Longest text (prefix + number + suffix) a hud_num_t can hold. */
+#define HUD_NUM_MAX  23u
+
+/**
+ * @brief Horizontal bar with an optional threshold marker and separators.
+ *
+ * Column color priority: marker, then separators, then fill/background.
+ */
+typedef struct {
+  uint8_t        x, y, w, h;   /**< Geometry in pixels. */
+  float          max;          /**< Value drawn as a full bar. */
+  uint16_t       fill, bg;     /**< Filled and empty colors. */
+  uint16_t       mark_color;   /**< Threshold marker color. */
+  uint16_t       cut_color;    /**< Separator color. */
+  const uint8_t *cuts;         /**< Separator positions in % of w, or NULL. */
+  uint8_t        n_cuts;       /**< Number of separators. */
+  uint8_t        fill_px;      /**< Columns filled on screen. */
+  uint8_t        mark_px;      /**< Marker column (from x), or HUD_NO_MARK. */
+} hud_bar_t;
+
+/**
+ * @brief Numeric label: fixed prefix, right-aligned number, fixed suffix.
+ *
+ * The text keeps a constant length, so digits stay in place and only the
+ * cells whose character changed are repainted (background included).
+ */
+typedef struct {
+  uint8_t     x, y, scale;     /**< Origin and text scale. */
+  uint8_t     width;           /**< Characters reserved for the number. */
+  uint8_t     decimals;        /**< Digits after the point (0 or 1). */
+  uint16_t    fg, bg;          /**< Text and cell background colors. */
+  const char *prefix;          /**< Text before the number ("" for none). */
+  const char *suffix;          /**< Text after the number ("" for none). */
+  char        text[HUD_NUM_MAX + 1u]; /**< What is on screen now. */
+} hud_num_t;
+
+/** @brief Seconds-left label driven by an end time. */
+typedef struct {
+  hud_num_t num;               /**< Label showing the seconds. */
+  uint32_t  end_ms;            /**< Time at which the countdown reaches 0. */
+} hud_countdown_t;
+
+/**
+ * @brief Set up a bar and draw it empty.
+ *
+ * @param b    Bar state.
+ * @param x    Left X coordinate.
+ * @param y    Top Y coordinate.
+ * @param w    Width in pixels.
+ * @param h    Height in pixels.
+ * @param max  Value that fills the whole bar.
+ * @param fill RGB565 fill color.
+ * @param bg   RGB565 empty color.
+ */
+void hud_bar_init(hud_bar_t *b, uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                  float max, uint16_t fill, uint16_t bg);
+
+/**
+ * @brief Add fixed separator columns (e.g. rank boundaries) and draw them.
+ *
+ * @param b     Bar state.
+ * @param cuts  Positions in percent of the bar width (kept by pointer).
+ * @param n     Number of positions.
+ * @param color RGB565 separator color.
+ */
+void hud_bar_cuts(hud_bar_t *b, const uint8_t *cuts, uint8_t n, uint16_t color);
+
+/**
+ * @brief Place the threshold marker at value @p v.
+ *
+ * Only the old and new marker columns are repainted.
+ *
+ * @param b     Bar state.
+ * @param v     Threshold value (same scale as hud_bar_set()).
+ * @param color RGB565 marker color.
+ */
+void hud_bar_mark(hud_bar_t *b, float v, uint16_t color);
+
+/**
+ * @brief Show value @p v; repaints only the columns between old and new fill.
+ *
+ * @param b Bar state.
+ * @param v Value; clamped to [0, max].
+ */
+void hud_bar_set(hud_bar_t *b, float v);
+
+/**
+ * @brief Same as hud_bar_set() with the fill given in pixels.
+ *
+ * @param b  Bar state.
+ * @param px Filled columns; clamped to the bar width.
+ */
+void hud_bar_set_px(hud_bar_t *b, uint8_t px);
+
+/**
+ * @brief Set up a numeric label. Nothing is drawn until the first set.
+ *
+ * @param n        Label state.
+ * @param x        Left X coordinate of the prefix.
+ * @param y        Top Y coordinate.
+ * @param scale    Text scale as in gfx_text2().
+ * @param prefix   Text before the number (kept by pointer).
+ * @param width    Characters reserved for the number, point included;
+ *                 raised to one digit (plus the point) and cut to what
+ *                 fits in HUD_NUM_MAX with the prefix and suffix.
+ * @param decimals Digits after the point (0 or 1).
+ * @param suffix   Text after the number (kept by pointer).
+ * @param fg       RGB565 text color.
+ * @param bg       RGB565 cell background color.
+ * @return false if prefix and suffix leave no room for a number; the
+ *         label then never draws.
+ */
+bool hud_num_init(hud_num_t *n, uint8_t x, uint8_t y, uint8_t scale,
+                  const char *prefix, uint8_t width, uint8_t decimals,
+                  const char *suffix, uint16_t fg, uint16_t bg);
+
+/**
+ * @brief Show value @p v, repainting only the changed character cells.
+ *
+ * Formats with integer math (no snprintf). Negative values show as 0 and
+ * values too wide for the field show as all nines.
+ *
+ * @param n Label state.
+ * @param v Value to show.
+ */
+void hud_num_set(hud_num_t *n, float v);
+
+/**
+ * @brief Set up a countdown label ending at @p end_ms.
+ *
+ * @param c      Countdown state.
+ * @param x      Left X coordinate.
+ * @param y      Top Y coordinate.
+ * @param scale  Text scale.
+ * @param prefix Text before the seconds.
+ * @param width  Characters reserved for the seconds.
+ * @param suffix Text after the seconds.
+ * @param fg     RGB565 text color.
+ * @param bg     RGB565 cell background color.
+ * @param end_ms Time (ms) at which the countdown reaches 0.
+ * @return false if the label was rejected (see hud_num_init()).
+ */
+bool hud_countdown_init(hud_countdown_t *c, uint8_t x, uint8_t y, uint8_t scale,
+                        const char *prefix, uint8_t width, const char *suffix,
+                        uint16_t fg, uint16_t bg, uint32_t end_ms);
+
+/**
+ * @brief Update the seconds left (rounded down); only a changed digit is sent.
+ *
+ * @param c      Countdown state.
+ * @param now_ms Current time in milliseconds.
+ * @return true once the end time has been reached.
+ */
+bool hud_countdown_tick(hud_countdown_t *c, uint32_t now_ms);
+
+#endif /* HUD_H */
@@ -0,0 +1,13 @@
+#ifndef LOGO_ANIM_FRAMES_H
+#define LOGO_ANIM_FRAMES_H
+
+#include <stdint.h>
+#include "gfx.h"
+
+#define LOGO_ANIM_W 128
+#define LOGO_ANIM_H 99
+#define LOGO_ANIM_FRAMES 2
+
+extern const gfx_anim_t LOGO_ANIM;
+
+#endif // LOGO_ANIM_FRAMES_H
@@ -0,0 +1,32 @@
+#ifndef LORE_TEXT_H
+#define LORE_TEXT_H
+
+#include <stdint.h>
+#include "gfx.h"
+
+#define LORE_CODES 106
+#define LORE_DATA_SIZE 1642
+
+typedef enum {
+    LORE_STORY_PROLOGUE,
+    LORE_STORY_CH1,
+    LORE_STORY_CH2,
+    LORE_STORY_CH3,
+    LORE_STORY_CH4,
+    LORE_STORY_CH5,
+    LORE_STORY_CH6,
+    LORE_STORY_CH7,
+    LORE_STORY_CH8,
+    LORE_STORY_CH9,
+    LORE_STORY_CH10,
+    LORE_STORY_EPILOGUE,
+    LORE_TOWER_INTRO,
+    LORE_TOWER_END,
+    LORE_PLAYGROUND_INTRO,
+    LORE_PAGES
+} lore_page_t;
+
+extern const gfx_bpe_t      LORE_BPE;
+extern const gfx_bpe_page_t LORE_TEXT[LORE_PAGES];
+
+#endif // LORE_TEXT_H
@@ -0,0 +1,60 @@
+/**
+ * @file metrics.h
+ * @brief Latest EMG metrics, published by the DSP and read by the game.
+ *
+ * The DSP task (or an interrupt) publishes a complete snapshot; the menu
+ * and the modes take a consistent copy in constant time. Publishing never
+ * waits, so it is safe from interrupt context, and a read never returns a
+ * half-written snapshot: two slots plus a begin/end sequence pair let a
+ * reader detect the rare case where the writer came back to its slot
+ * mid-copy, and it then simply copies again. One writer only.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "project.h"   // ADS_FRONTEND_M04
+
+/** EMG channels carried per snapshot (one per ADC channel). */
+#if ADS_FRONTEND_M04
+#define METRICS_CH  4u
+#else
+#define METRICS_CH  2u
+#endif
+
+/** One DSP result. */
+typedef struct {
+  uint32_t seq;                 ///< Publish count (set by metrics_publish()).
+  uint32_t t_ms;                ///< millis() when the DSP produced it.
+  float    hz[METRICS_CH];      ///< Zero-cross rate, baseline removed and scaled.
+  float    env[METRICS_CH];     ///< Rectified envelope (ADC counts).
+  float    base_hz[METRICS_CH]; ///< Baseline Hz (0 until the baseline window ends).
+  uint8_t  active;              ///< Bit n set while channel n is above baseline.
+  uint8_t  pct[METRICS_CH];     ///< Intensity, 0..100.
+} metrics_t;
+
+/**
+ * @brief Publish a new snapshot (single writer, ISR-safe).
+ *
+ * @param m Snapshot to copy; its seq field is ignored.
+ */
+void metrics_publish(const metrics_t *m);
+
+/**
+ * @brief Copy the latest snapshot.
+ *
+ * @param[out] out Destination (all zero before the first publish).
+ * @return false if nothing has been published yet.
+ */
+bool metrics_read(metrics_t *out);
+
+/**
+ * @brief Sequence number of the latest snapshot (0 = none yet).
+ *
+ * Cheap way to see whether metrics_read() would return anything new.
+ */
+uint32_t metrics_seq(void);
+
+#endif /* METRICS_H */
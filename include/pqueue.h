@@ -0,0 +1,74 @@
+/**
+ * @file pqueue.h
+ * @brief Player queue: seats on ADC channels and background calibration.
+ *
+ * A round seats its players on ADC channels (seat 0 = P1). Channels not
+ * seated are spares. The next player straps on a spare armband while the
+ * current round runs: the queue lets the channel settle, measures its
+ * baseline, and then waits for the player to check in with one flex above
+ * PQUEUE_JOIN_HZ. Once the arm has rested again the baseline is measured
+ * once more and the player is queued. When the next round begins and
+ * enough players are queued, their channels become the seats as they
+ * are, so the round skips its calibration phase; the channels just freed
+ * start over.
+ *
+ * pqueue_service() runs in the DSP task and the rest in the game task;
+ * neither is called from interrupt context.
+ */
+
+#ifndef PQUEUE_H
+#define PQUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "metrics.h"
+
+/** Settle time of a freed channel, and rest time after the check-in flex (ms). */
+#define PQUEUE_WARMUP_MS    2000u
+/** Background baseline window (ms). */
+#define PQUEUE_CAL_MS       3000u
+/** An idle spare's baseline is re-measured this often (ms). */
+#define PQUEUE_REFRESH_MS  20000u
+/** Hz above baseline that checks a waiting player in. */
+#define PQUEUE_JOIN_HZ       25.0f
+
+/**
+ * @brief Seat P1 on channel 0; every other channel starts warming up.
+ */
+void pqueue_init(uint32_t now_ms);
+
+/**
+ * @brief Seat the players of a new round.
+ *
+ * With at least @p seats queued players, the ones that checked in first
+ * take the seats (first in line = P1) with their baselines, and the old
+ * seats are freed. Otherwise the current seats are kept, topped up from
+ * the spares if the round needs more, and a baseline of window_ms starts
+ * on all of them.
+ *
+ * @param seats     Players in the round (1..EMG_PIPE_CH).
+ * @param window_ms Baseline window used when calibration is needed.
+ * @return true if queued players were seated and no calibration is needed.
+ */
+bool pqueue_round_begin(uint8_t seats, uint32_t window_ms);
+
+/**
+ * @brief Channel (metrics_t index) of a seat; seat n maps to channel n
+ *        until the first hand-off.
+ */
+uint8_t pqueue_seat(uint8_t seat);
+
+/**
+ * @brief Number of calibrated, checked-in players waiting for a seat.
+ */
+uint8_t pqueue_ready(void);
+
+/**
+ * @brief Advance warm-up, check-in and calibration of the spares.
+ *
+ * @param m      Snapshot just published by the DSP.
+ * @param now_ms Its time.
+ */
+void pqueue_service(const metrics_t *m, uint32_t now_ms);
+
+#endif /* PQUEUE_H */
@@ -25,6 +25,34 @@
 #define THRESH_K_SIG     3.0f
 /** Tie margin in percent (for PVP results). */
 #define TIE_MARGIN_PCT   5.0f
+/** Standard errors a PVP lead must clear beyond the tie margin. */
+#define DUEL_Z           1.96f
+/** A significant PVP lead must hold this long to end the round early (ms). */
+#define DUEL_HOLD_MS     1000u
+/** No early PVP call before this much of the round has passed (ms). */
+#define DUEL_MIN_MS      3000u
+/** Hz at or above which a flex round counts the time as active. */
+#define ROUND_ACTIVE_HZ  1.5f
+/** Time per game tick the render scheduler may spend sending queued draws (us). */
+#define RENDER_BUDGET_US 8000u
+
+// EMG front end
+
+/**
+ * 0 = ADS131M02 on SSI2 (two players), 1 = ADS131M04 on SSI0 (four players,
+ * enables the 4P bracket mode). Sets the channel count of the DSP path.
+ * Host programs may pass -DADS_FRONTEND_M04=1.
+ *
+ * ADS131M04 wiring: it shares SSI0 with the OLED (PA2 SCLK, PA5 MOSI) and
+ * adds PA4 MISO; CS PB5, DRDY PB0, RESET PB1, CLKIN PB6 (8 MHz PWM). The
+ * OLED keeps CS PA3, D/C PB2 and RST PB3. The DRDY ISR may preempt an
+ * OLED row: ssd1351_bus_suspend() parks the OLED's CS between bytes, the
+ * ISR switches SSI0 to mode 1 / 1 MHz / 16-bit for its frame, and
+ * ssd1351_bus_resume() restores mode 3 / 8 MHz / 8-bit and the CS level.
+ */
+#ifndef ADS_FRONTEND_M04
+#define ADS_FRONTEND_M04 0
+#endif
 
 // Colors (RGB565)
 
@@ -2,12 +2,15 @@
 #define PVP_TIE_PIC_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define PVP_TIE_PIC_W 100
 #define PVP_TIE_PIC_H 70
 #define PVP_TIE_PIC_PAL_SIZE 16
+#define PVP_TIE_PIC_RLE_SIZE 1192
 
 extern const uint16_t PVP_TIE_PIC_PAL[PVP_TIE_PIC_PAL_SIZE];
-extern const uint8_t  PVP_TIE_PIC_IDX[(PVP_TIE_PIC_W * PVP_TIE_PIC_H) / 2];
+extern const uint8_t  PVP_TIE_PIC_RLE[PVP_TIE_PIC_RLE_SIZE];
+extern const gfx_image_t PVP_TIE_PIC_IMG;
 
 #endif // PVP_TIE_PIC_H
@@ -0,0 +1,78 @@
+/**
+ * @file round_acc.h
+ * @brief Frame-rate independent round statistics (flex rounds).
+ *
+ * A mode opens a round on a slot with its start time and length; from then
+ * on every DSP result is integrated into the slot over exactly the time it
+ * covers, clipped to the round. Render speed no longer affects the
+ * weighting: a slow frame simply reads the same finished numbers later.
+ * Begin/done are called by the modes and feed by the DSP task; both run
+ * in task context.
+ */
+
+#ifndef ROUND_ACC_H
+#define ROUND_ACC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "metrics.h"
+
+/** Rounds that can run at the same time. */
+#define ROUND_ACC_SLOTS     4u
+/** A round also counts as done this long after its end, fed or not (ms). */
+#define ROUND_ACC_GRACE_MS  500u
+
+/** Finished round. */
+typedef struct {
+  uint32_t len_ms;     ///< Round time covered by DSP results.
+  uint32_t above_ms;   ///< Time at or above the threshold.
+  float    mean_hz;    ///< Time-weighted mean over the covered time.
+  float    active_hz;  ///< Time-weighted mean over the time above threshold.
+  float    peak_hz;    ///< Highest value during the round.
+  float    var_hz;     ///< Time-weighted variance over the time above threshold (Hz^2).
+  float    lag1;       ///< Lag-1 autocorrelation of those values, clamped to 0..0.95.
+} round_stats_t;
+
+/**
+ * @brief Start a round on a slot (restarts it if already running).
+ *
+ * @param slot      0..ROUND_ACC_SLOTS-1.
+ * @param ch        Metrics channel to integrate (metrics_t::hz index).
+ * @param start_ms  millis() at which the round starts.
+ * @param len_ms    Round length.
+ * @param thresh_hz Values below this do not count toward above_ms/active_hz.
+ */
+void round_acc_begin(uint8_t slot, uint8_t ch, uint32_t start_ms,
+                     uint32_t len_ms, float thresh_hz);
+
+/**
+ * @brief Integrate one DSP result into every open round.
+ *
+ * @param m       Result; its values hold from from_ms up to m->t_ms.
+ * @param from_ms Start of the interval the result describes.
+ */
+void round_acc_feed(const metrics_t *m, uint32_t from_ms);
+
+/**
+ * @brief Statistics of a round so far (running or finished).
+ *
+ * @param slot     Slot passed to round_acc_begin().
+ * @param[out] out Statistics over the time covered up to now.
+ * @return false if the slot was never started.
+ */
+bool round_acc_peek(uint8_t slot, round_stats_t *out);
+
+/**
+ * @brief Check for a finished round and fetch its statistics.
+ *
+ * A round is done once the DSP has covered its end, or ROUND_ACC_GRACE_MS
+ * after the end if results stopped coming.
+ *
+ * @param slot    Slot passed to round_acc_begin().
+ * @param now_ms  Current millis().
+ * @param[out] out Statistics (may be NULL).
+ * @return true once the round is done.
+ */
+bool round_acc_done(uint8_t slot, uint32_t now_ms, round_stats_t *out);
+
+#endif /* ROUND_ACC_H */
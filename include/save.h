@@ -52,4 +52,21 @@ bool     save_load(save_t *s);                 // returns true on valid CRC
  */
 bool     save_write(const save_t *s);
 
+/**
+ * @brief Mark a save block for writing by the next save_flush().
+ *
+ * Use this from gameplay code: a flash write stalls the CPU for several
+ * milliseconds, so it is left to a low-priority task.
+ *
+ * @param s Save block to persist (must stay valid until flushed).
+ */
+void     save_request(const save_t *s);
+
+/**
+ * @brief Write the block given to save_request(), if any.
+ *
+ * @return true if a write was performed and succeeded.
+ */
+bool     save_flush(void);
+
 #endif /* SAVE_H */
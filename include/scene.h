@@ -0,0 +1,115 @@
+/**
+ * @file scene.h
+ * @brief Table-driven scene runner for the mode state machines.
+ *
+ * A mode lists its screens in a const table of scene_t indexed by its state
+ * enum: what to draw on entry, what to update every tick, how long the
+ * scene lasts and which scene follows. scene_tick() walks the table, so a
+ * mode's flow and timing sit together in flash and the per-scene code is
+ * only drawing and game logic.
+ *
+ * The runner never reads a clock; the mode passes the time in (millis() on
+ * the target), so a host build can step a table at any speed.
+ */
+
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** scene_t::exit result: stay in the current scene. */
+#define SCENE_STAY   0xFFu
+/** scene_t::exit result: go to the scene's scene_t::next. */
+#define SCENE_NEXT   0xFEu
+/** scene_t::next / exit result: leave the table, scene_tick() returns true. */
+#define SCENE_END    0xFDu
+
+/** scene_t::flags: full-screen scene, the old screen fades out first and
+ *  the scene's time starts once the panel is dark. */
+#define SCENE_FADE   0x01u
+
+/** Length of each step of the shared countdown (ms). */
+#define SCENE_COUNT_MS  1000u
+
+/** What a scene action sees of the runner. */
+typedef struct {
+  uint8_t  id;     ///< Current scene (table index).
+  uint32_t now;    ///< Time of this tick (ms).
+  uint32_t t0;     ///< Time the scene started (ms).
+  uint32_t dt;     ///< Time in the scene (ms).
+  uint32_t ms;     ///< The scene's scene_t::ms.
+  bool     done;   ///< dt has reached ms (never set for ms == 0).
+} scene_ctx_t;
+
+/** Enter or tick action. */
+typedef void    (*scene_fn_t)(const scene_ctx_t *c);
+/** Exit predicate: SCENE_STAY, SCENE_NEXT, SCENE_END or a scene id. */
+typedef uint8_t (*scene_exit_fn_t)(const scene_ctx_t *c);
+
+/** One scene of a mode. Any action may be NULL. */
+typedef struct {
+  uint16_t        ms;      ///< Duration; 0 = until the exit predicate leaves.
+  uint8_t         next;    ///< Scene after the duration, or SCENE_END.
+  uint8_t         flags;   ///< SCENE_FADE or 0.
+  scene_fn_t      enter;   ///< Once, on the first tick of the scene.
+  scene_fn_t      tick;    ///< Every tick, before the exit check.
+  scene_exit_fn_t exit;    ///< Decides when and where to go; NULL = go to
+                           ///< next once ms has passed.
+} scene_t;
+
+/** Runner state, owned by the mode. */
+typedef struct {
+  const scene_t *table;
+  uint8_t        count;
+  uint8_t        cur;
+  bool           entered;
+  uint32_t       t0;
+} scene_run_t;
+
+/**
+ * @brief The shared 3 / 2 / 1 / FLEX! countdown as table entries.
+ *
+ * Four header-only scenes of SCENE_COUNT_MS with consecutive ids from
+ * @p id3, drawn over the screen before them; the last one goes to @p after.
+ */
+#define SCENE_COUNTDOWN(id3, after)                                             \
+  [(id3)]      = { SCENE_COUNT_MS, (id3) + 1, 0, scene_count_3,    NULL, NULL }, \
+  [(id3) + 1]  = { SCENE_COUNT_MS, (id3) + 2, 0, scene_count_2,    NULL, NULL }, \
+  [(id3) + 2]  = { SCENE_COUNT_MS, (id3) + 3, 0, scene_count_1,    NULL, NULL }, \
+  [(id3) + 3]  = { SCENE_COUNT_MS, (after),   0, scene_count_flex, NULL, NULL }
+
+/**
+ * @brief Run a table from its first scene.
+ *
+ * @param r      Runner state.
+ * @param table  Scenes, indexed by id.
+ * @param count  Number of scenes.
+ * @param first  Scene to start with.
+ * @param now_ms Current time.
+ */
+void scene_start(scene_run_t *r, const scene_t *table, uint8_t count,
+                 uint8_t first, uint32_t now_ms);
+
+/**
+ * @brief Switch to a scene now, fading out first if it has SCENE_FADE.
+ */
+void scene_goto(scene_run_t *r, uint8_t id, uint32_t now_ms);
+
+/**
+ * @brief Advance the current scene: enter (first tick only), tick, then
+ *        the exit predicate or the duration.
+ *
+ * @return true once the table has ended (SCENE_END or an id past the table).
+ */
+bool scene_tick(scene_run_t *r, uint32_t now_ms);
+
+/** @name Shared countdown steps (see SCENE_COUNTDOWN). */
+/**@{*/
+void scene_count_3(const scene_ctx_t *c);
+void scene_count_2(const scene_ctx_t *c);
+void scene_count_1(const scene_ctx_t *c);
+void scene_count_flex(const scene_ctx_t *c);
+/**@}*/
+
+#endif /* SCENE_H */
@@ -0,0 +1,124 @@
+/**
+ * @file sched.h
+ * @brief Cooperative run-to-completion task scheduler.
+ *
+ * Tasks are plain functions that run to completion. A task is released
+ * periodically (every period_us), by sched_signal() (event), or both. Of the
+ * released tasks the one with the lowest prio value runs next; ties go to the
+ * one released first. Each run is checked against the task's deadline,
+ * measured from its release. With nothing released the core sleeps in WFI
+ * until the next interrupt.
+ *
+ * The HOST_SIM build runs on the virtual clock of host/host_timer.c (link it
+ * and build with -Ihost): micros() and millis() only move through
+ * sched_clock_advance(), host_timer_advance_us() and idle, so the task
+ * bodies and the scheduler see one clock and a host run is fully
+ * deterministic.
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Most tasks sched_add() accepts. */
+#define SCHED_TASKS_MAX  8u
+/** Window over which sched_headroom_pct() measures idle time (us). */
+#define SCHED_LOAD_WINDOW_US  500000u
+
+/** Task body. Runs to completion; must not block. */
+typedef void (*sched_fn_t)(void);
+
+/** Per-task counters (since sched_add() or sched_stats_reset()). */
+typedef struct {
+  uint32_t runs;          ///< Completed runs.
+  uint32_t misses;        ///< Runs that finished later than release + deadline.
+  uint32_t worst_late_us; ///< Longest wait from release to start.
+  uint32_t worst_run_us;  ///< Longest single run.
+} sched_stats_t;
+
+/**
+ * @brief Drop all tasks and zero the idle counter.
+ */
+void sched_init(void);
+
+/**
+ * @brief Register a task.
+ *
+ * @param name        Short label for telemetry (not copied).
+ * @param fn          Task body.
+ * @param period_us   Release period; 0 = released only by sched_signal().
+ * @param deadline_us Allowed time from release to completion; 0 = period_us.
+ * @param prio        Lower runs first.
+ * @return Task id, or -1 when the table is full.
+ */
+int8_t sched_add(const char *name, sched_fn_t fn,
+                 uint32_t period_us, uint32_t deadline_us, uint8_t prio);
+
+/**
+ * @brief Release a task now (event trigger).
+ *
+ * Safe from interrupt context. Signals arriving while the task is already
+ * released merge into one run.
+ *
+ * @param id Task id from sched_add().
+ */
+void sched_signal(int8_t id);
+
+/**
+ * @brief Run the most urgent released task, or sleep if none is released.
+ *
+ * @return true if a task ran.
+ */
+bool sched_run_once(void);
+
+/**
+ * @brief Run tasks forever.
+ */
+void sched_run(void);
+
+/**
+ * @brief Current scheduler time in microseconds (wraps).
+ */
+uint32_t sched_clock_us(void);
+
+#ifdef HOST_SIM
+/**
+ * @brief Move the virtual clock forward (host builds only).
+ *
+ * Task bodies call this to model how long they take.
+ *
+ * @param us Microseconds to add.
+ */
+void sched_clock_advance(uint32_t us);
+#endif
+
+/**
+ * @brief Copy one task's counters.
+ *
+ * @param id  Task id from sched_add().
+ * @param out Destination.
+ * @return Task name, or NULL for an unknown id.
+ */
+const char *sched_stats(int8_t id, sched_stats_t *out);
+
+/**
+ * @brief Microseconds spent asleep since sched_init() or sched_stats_reset().
+ */
+uint32_t sched_idle_us(void);
+
+/**
+ * @brief CPU headroom: percent of the last full load window spent asleep.
+ *
+ * Updated every SCHED_LOAD_WINDOW_US by the scheduler itself and not
+ * affected by sched_stats_reset(); 100 until the first window completes.
+ */
+uint8_t sched_headroom_pct(void);
+
+/**
+ * @brief Zero every task's counters and the idle counter.
+ */
+void sched_stats_reset(void);
+
+#endif /* SCHED_H */
@@ -45,6 +45,17 @@ void ssd1351_set_window(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
  */
 void ssd1351_push_pixels(const uint16_t *src, uint32_t count);
 
+/**
+ * @brief Push bytes to the display exactly as given (panel byte order).
+ *
+ * For pixel rows already stored big-endian (high byte first), so no
+ * per-pixel swap is needed on the way out.
+ *
+ * @param src Pointer to the bytes (2 per pixel).
+ * @param n   Number of bytes to send.
+ */
+void ssd1351_push_bytes(const uint8_t *src, uint32_t n);
+
 /**
  * @brief Draw a filled rectangle.
  *
@@ -58,4 +69,43 @@ void ssd1351_push_pixels(const uint16_t *src, uint32_t count);
  */
 void ssd1351_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color);
 
+/**
+ * @brief Set the display start line (vertical scroll).
+ *
+ * Panel row 0 shows GDDRAM row @p line, and rows wrap at 128. Moving the
+ * start line scrolls the whole panel without rewriting any pixels.
+ *
+ * @param line GDDRAM row shown at the top of the panel (0..127).
+ */
+void ssd1351_set_start_line(uint8_t line);
+
+/**
+ * @brief Set the master contrast (global brightness).
+ *
+ * Scales the A/B/C segment currents in 16 steps without touching GDDRAM;
+ * 0 is dark, 15 is the init value.
+ *
+ * @param level Master contrast, 0..15.
+ */
+void ssd1351_set_contrast_master(uint8_t level);
+
+/**
+ * @brief Lend SSI0 to another device on the same bus (target builds only).
+ *
+ * Waits for the byte in flight, then raises the panel's CS for the
+ * duration. Safe to call from an ISR that preempts a transfer: the panel
+ * treats the CS pulse as a byte boundary, and the write continues where it
+ * stopped once ssd1351_bus_resume() puts CS back. The borrower may
+ * reprogram SSI0 freely in between. Does nothing before ssd1351_init().
+ */
+void ssd1351_bus_suspend(void);
+
+/**
+ * @brief Take SSI0 back after ssd1351_bus_suspend().
+ *
+ * Restores the panel's SPI mode, clock and 8-bit frames, empties the RX
+ * FIFO and returns CS to the level it had when the bus was lent.
+ */
+void ssd1351_bus_resume(void);
+
 #endif /* SSD1351_H */
@@ -0,0 +1,104 @@
+/**
+ * @file ssd1351_emu.h
+ * @brief Host-side SSD1351 emulator used when building with -DHOST_SIM.
+ *
+ * ssd1351.c routes its CS/DC/SPI traffic here instead of TivaWare. The
+ * emulator decodes the command stream into a 128x128 RGB565 GDDRAM image,
+ * writes PPM/PNG snapshots, and counts SPI bytes, CS assertions, windows
+ * and estimated wire time so drawing code can be measured without hardware.
+ *
+ * Not compiled into the firmware.
+ */
+
+#ifndef SSD1351_EMU_H
+#define SSD1351_EMU_H
+
+#ifdef HOST_SIM
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** SPI traffic counters, accumulated since the last ssd1351_emu_stats_reset(). */
+typedef struct {
+  uint32_t bytes;          /**< All bytes clocked out (command + data). */
+  uint32_t cmd_bytes;      /**< Bytes sent with DC low. */
+  uint32_t data_bytes;     /**< Bytes sent with DC high (params + pixels). */
+  uint32_t pixels;         /**< Pixels written to GDDRAM. */
+  uint32_t cs_assertions;  /**< CS high->low transitions. */
+  uint32_t windows;        /**< WRITERAM commands (one per window set-up). */
+  uint64_t wire_ns;        /**< Estimated SCK time for those bytes. */
+} ssd1351_emu_stats_t;
+
+/* Hooks called by ssd1351.c */
+
+/** @brief Drive chip-select; true = asserted (low). */
+void ssd1351_emu_cs(bool asserted);
+
+/** @brief Drive D/C; true = data, false = command. */
+void ssd1351_emu_dc(bool data);
+
+/** @brief Clock one byte out on MOSI. Ignored while CS is deasserted. */
+void ssd1351_emu_byte(uint8_t b);
+
+/** @brief Hardware reset: clears GDDRAM and controller registers. */
+void ssd1351_emu_reset(void);
+
+/** @brief SSI clock programmed by the driver (used for wire-time estimates). */
+void ssd1351_emu_sck(uint32_t hz);
+
+/* Test / tooling API */
+
+/**
+ * @brief Override the SCK used for wire-time estimates.
+ *
+ * @param hz SCK in Hz, or 0 to follow the rate the driver programs.
+ */
+void ssd1351_emu_set_sck_hz(uint32_t hz);
+
+/**
+ * @brief Copy current counters.
+ *
+ * @param out Destination.
+ */
+void ssd1351_emu_stats(ssd1351_emu_stats_t *out);
+
+/** @brief Zero all counters (call at a frame boundary for per-frame cost). */
+void ssd1351_emu_stats_reset(void);
+
+/**
+ * @brief Read a pixel as the panel shows it (start line, offset, remap).
+ *
+ * @param x Panel column.
+ * @param y Panel row.
+ * @return RGB565 value before master contrast is applied.
+ */
+uint16_t ssd1351_emu_pixel(uint8_t x, uint8_t y);
+
+/**
+ * @brief Current master contrast (0..15) as last written with 0xC7.
+ */
+uint8_t ssd1351_emu_contrast_master(void);
+
+/**
+ * @brief Write what the panel shows to a binary PPM (P6) file.
+ *
+ * Master contrast and display on/off are applied to the output.
+ *
+ * @param path Output file path.
+ * @return 0 on success, -1 on I/O error.
+ */
+int ssd1351_emu_dump_ppm(const char *path);
+
+/**
+ * @brief Write what the panel shows to an 8-bit RGB PNG file.
+ *
+ * Uses stored (uncompressed) deflate blocks so no zlib is needed.
+ *
+ * @param path Output file path.
+ * @return 0 on success, -1 on I/O error.
+ */
+int ssd1351_emu_dump_png(const char *path);
+
+#endif /* HOST_SIM */
+
+#endif /* SSD1351_EMU_H */
@@ -2,12 +2,15 @@
 #define STORY_CH1_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH1_W 128
 #define STORY_CH1_H 73
 #define STORY_CH1_PAL_SIZE 16
+#define STORY_CH1_RLE_SIZE 3460
 
 extern const uint16_t STORY_CH1_PAL[STORY_CH1_PAL_SIZE];
-extern const uint8_t  STORY_CH1_IDX[(STORY_CH1_W * STORY_CH1_H) / 2];
+extern const uint8_t  STORY_CH1_RLE[STORY_CH1_RLE_SIZE];
+extern const gfx_image_t STORY_CH1_IMG;
 
 #endif // STORY_CH1_H
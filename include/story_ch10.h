@@ -2,12 +2,15 @@
 #define STORY_CH10_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH10_W 120
 #define STORY_CH10_H 120
-#define STORY_CH10_PAL_SIZE 16
+#define STORY_CH10_PAL_SIZE 2
+#define STORY_CH10_RLE_SIZE 357
 
 extern const uint16_t STORY_CH10_PAL[STORY_CH10_PAL_SIZE];
-extern const uint8_t  STORY_CH10_IDX[(STORY_CH10_W * STORY_CH10_H) / 2];
+extern const uint8_t  STORY_CH10_RLE[STORY_CH10_RLE_SIZE];
+extern const gfx_image_t STORY_CH10_IMG;
 
 #endif // STORY_CH10_H
@@ -2,12 +2,15 @@
 #define STORY_CH2_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH2_W 128
 #define STORY_CH2_H 72
 #define STORY_CH2_PAL_SIZE 16
+#define STORY_CH2_RLE_SIZE 3637
 
 extern const uint16_t STORY_CH2_PAL[STORY_CH2_PAL_SIZE];
-extern const uint8_t  STORY_CH2_IDX[(STORY_CH2_W * STORY_CH2_H) / 2];
+extern const uint8_t  STORY_CH2_RLE[STORY_CH2_RLE_SIZE];
+extern const gfx_image_t STORY_CH2_IMG;
 
 #endif // STORY_CH2_H
@@ -2,12 +2,16 @@
 #define STORY_CH2_ENEMY_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH2_ENEMY_W 100
 #define STORY_CH2_ENEMY_H 56
 #define STORY_CH2_ENEMY_PAL_SIZE 16
+#define STORY_CH2_ENEMY_RLE_SIZE 1919
+#define STORY_CH2_ENEMY_KEY GFX_KEY_NONE   // transparent index for gfx_layer_t
 
 extern const uint16_t STORY_CH2_ENEMY_PAL[STORY_CH2_ENEMY_PAL_SIZE];
-extern const uint8_t  STORY_CH2_ENEMY_IDX[(STORY_CH2_ENEMY_W * STORY_CH2_ENEMY_H) / 2];
+extern const uint8_t  STORY_CH2_ENEMY_RLE[STORY_CH2_ENEMY_RLE_SIZE];
+extern const gfx_image_t STORY_CH2_ENEMY_IMG;
 
 #endif // STORY_CH2_ENEMY_H
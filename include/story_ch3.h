@@ -2,12 +2,15 @@
 #define STORY_CH3_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH3_W 128
 #define STORY_CH3_H 95
 #define STORY_CH3_PAL_SIZE 16
+#define STORY_CH3_RLE_SIZE 3117
 
 extern const uint16_t STORY_CH3_PAL[STORY_CH3_PAL_SIZE];
-extern const uint8_t  STORY_CH3_IDX[(STORY_CH3_W * STORY_CH3_H) / 2];
+extern const uint8_t  STORY_CH3_RLE[STORY_CH3_RLE_SIZE];
+extern const gfx_image_t STORY_CH3_IMG;
 
 #endif // STORY_CH3_H
@@ -2,12 +2,15 @@
 #define STORY_CH4_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH4_W 128
 #define STORY_CH4_H 71
 #define STORY_CH4_PAL_SIZE 16
+#define STORY_CH4_RLE_SIZE 2520
 
 extern const uint16_t STORY_CH4_PAL[STORY_CH4_PAL_SIZE];
-extern const uint8_t  STORY_CH4_IDX[(STORY_CH4_W * STORY_CH4_H) / 2];
+extern const uint8_t  STORY_CH4_RLE[STORY_CH4_RLE_SIZE];
+extern const gfx_image_t STORY_CH4_IMG;
 
 #endif // STORY_CH4_H
@@ -2,12 +2,16 @@
 #define STORY_CH4_ENEMY_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH4_ENEMY_W 128
 #define STORY_CH4_ENEMY_H 97
-#define STORY_CH4_ENEMY_PAL_SIZE 16
+#define STORY_CH4_ENEMY_PAL_SIZE 4
+#define STORY_CH4_ENEMY_RLE_SIZE 1483
+#define STORY_CH4_ENEMY_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t STORY_CH4_ENEMY_PAL[STORY_CH4_ENEMY_PAL_SIZE];
-extern const uint8_t  STORY_CH4_ENEMY_IDX[(STORY_CH4_ENEMY_W * STORY_CH4_ENEMY_H) / 2];
+extern const uint8_t  STORY_CH4_ENEMY_RLE[STORY_CH4_ENEMY_RLE_SIZE];
+extern const gfx_image_t STORY_CH4_ENEMY_IMG;
 
 #endif // STORY_CH4_ENEMY_H
@@ -2,12 +2,15 @@
 #define STORY_CH5_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH5_W 128
 #define STORY_CH5_H 69
 #define STORY_CH5_PAL_SIZE 16
+#define STORY_CH5_RLE_SIZE 3215
 
 extern const uint16_t STORY_CH5_PAL[STORY_CH5_PAL_SIZE];
-extern const uint8_t  STORY_CH5_IDX[(STORY_CH5_W * STORY_CH5_H) / 2];
+extern const uint8_t  STORY_CH5_RLE[STORY_CH5_RLE_SIZE];
+extern const gfx_image_t STORY_CH5_IMG;
 
 #endif // STORY_CH5_H
@@ -2,12 +2,15 @@
 #define STORY_CH6_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH6_W 128
 #define STORY_CH6_H 87
 #define STORY_CH6_PAL_SIZE 16
+#define STORY_CH6_RLE_SIZE 3358
 
 extern const uint16_t STORY_CH6_PAL[STORY_CH6_PAL_SIZE];
-extern const uint8_t  STORY_CH6_IDX[(STORY_CH6_W * STORY_CH6_H) / 2];
+extern const uint8_t  STORY_CH6_RLE[STORY_CH6_RLE_SIZE];
+extern const gfx_image_t STORY_CH6_IMG;
 
 #endif // STORY_CH6_H
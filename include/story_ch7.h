@@ -2,12 +2,15 @@
 #define STORY_CH7_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH7_W 128
 #define STORY_CH7_H 75
 #define STORY_CH7_PAL_SIZE 16
+#define STORY_CH7_RLE_SIZE 3103
 
 extern const uint16_t STORY_CH7_PAL[STORY_CH7_PAL_SIZE];
-extern const uint8_t  STORY_CH7_IDX[(STORY_CH7_W * STORY_CH7_H) / 2];
+extern const uint8_t  STORY_CH7_RLE[STORY_CH7_RLE_SIZE];
+extern const gfx_image_t STORY_CH7_IMG;
 
 #endif // STORY_CH7_H
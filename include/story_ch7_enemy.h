@@ -2,12 +2,16 @@
 #define STORY_CH7_ENEMY_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH7_ENEMY_W 128
 #define STORY_CH7_ENEMY_H 86
 #define STORY_CH7_ENEMY_PAL_SIZE 16
+#define STORY_CH7_ENEMY_RLE_SIZE 2602
+#define STORY_CH7_ENEMY_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t STORY_CH7_ENEMY_PAL[STORY_CH7_ENEMY_PAL_SIZE];
-extern const uint8_t  STORY_CH7_ENEMY_IDX[(STORY_CH7_ENEMY_W * STORY_CH7_ENEMY_H) / 2];
+extern const uint8_t  STORY_CH7_ENEMY_RLE[STORY_CH7_ENEMY_RLE_SIZE];
+extern const gfx_image_t STORY_CH7_ENEMY_IMG;
 
 #endif // STORY_CH7_ENEMY_H
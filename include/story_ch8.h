@@ -2,12 +2,15 @@
 #define STORY_CH8_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH8_W 128
 #define STORY_CH8_H 81
 #define STORY_CH8_PAL_SIZE 16
+#define STORY_CH8_RLE_SIZE 3822
 
 extern const uint16_t STORY_CH8_PAL[STORY_CH8_PAL_SIZE];
-extern const uint8_t  STORY_CH8_IDX[(STORY_CH8_W * STORY_CH8_H) / 2];
+extern const uint8_t  STORY_CH8_RLE[STORY_CH8_RLE_SIZE];
+extern const gfx_image_t STORY_CH8_IMG;
 
 #endif // STORY_CH8_H
@@ -2,12 +2,15 @@
 #define STORY_CH9_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_CH9_W 128
 #define STORY_CH9_H 73
 #define STORY_CH9_PAL_SIZE 16
+#define STORY_CH9_RLE_SIZE 2056
 
 extern const uint16_t STORY_CH9_PAL[STORY_CH9_PAL_SIZE];
-extern const uint8_t  STORY_CH9_IDX[(STORY_CH9_W * STORY_CH9_H) / 2];
+extern const uint8_t  STORY_CH9_RLE[STORY_CH9_RLE_SIZE];
+extern const gfx_image_t STORY_CH9_IMG;
 
 #endif // STORY_CH9_H
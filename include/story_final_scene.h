@@ -2,12 +2,15 @@
 #define STORY_FINAL_SCENE_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_FINAL_SCENE_W 128
 #define STORY_FINAL_SCENE_H 79
 #define STORY_FINAL_SCENE_PAL_SIZE 16
+#define STORY_FINAL_SCENE_RLE_SIZE 3495
 
 extern const uint16_t STORY_FINAL_SCENE_PAL[STORY_FINAL_SCENE_PAL_SIZE];
-extern const uint8_t  STORY_FINAL_SCENE_IDX[(STORY_FINAL_SCENE_W * STORY_FINAL_SCENE_H) / 2];
+extern const uint8_t  STORY_FINAL_SCENE_RLE[STORY_FINAL_SCENE_RLE_SIZE];
+extern const gfx_image_t STORY_FINAL_SCENE_IMG;
 
 #endif // STORY_FINAL_SCENE_H
@@ -2,12 +2,15 @@
 #define STORY_OPENING_SCENE_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define STORY_OPENING_SCENE_W 128
 #define STORY_OPENING_SCENE_H 91
 #define STORY_OPENING_SCENE_PAL_SIZE 16
+#define STORY_OPENING_SCENE_RLE_SIZE 800
 
 extern const uint16_t STORY_OPENING_SCENE_PAL[STORY_OPENING_SCENE_PAL_SIZE];
-extern const uint8_t  STORY_OPENING_SCENE_IDX[(STORY_OPENING_SCENE_W * STORY_OPENING_SCENE_H) / 2];
+extern const uint8_t  STORY_OPENING_SCENE_RLE[STORY_OPENING_SCENE_RLE_SIZE];
+extern const gfx_image_t STORY_OPENING_SCENE_IMG;
 
 #endif // STORY_OPENING_SCENE_H
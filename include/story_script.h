@@ -0,0 +1,80 @@
+/**
+ * @file story_script.h
+ * @brief Story mode bytecode: opcodes, operands and the compiled script.
+ *
+ * The story is written as text (image_converter/story_script.txt) and
+ * compiled on the host by image_converter/story2bc.py into
+ * src/story_script.c: a byte program, a pool of NUL-terminated strings and
+ * the table of images it draws. game_story.c interprets it.
+ *
+ * An op is one opcode byte followed by its operands; 16-bit operands are
+ * little-endian. "str" operands are byte offsets into g_story_str, "img"
+ * operands index g_story_img and "addr" operands are offsets into
+ * g_story_bc. Ops run back to back within a tick until one waits: SCREEN
+ * ends the tick, and the ops marked "waits" run over many ticks. Their time
+ * counts from the end of the last SCREEN fade or of the previous waiting op.
+ */
+
+#ifndef STORY_SCRIPT_H
+#define STORY_SCRIPT_H
+
+#include <stdint.h>
+#include "gfx.h"
+
+/** Emit a 16-bit operand (generated code). */
+#define SB16(v)  (uint8_t)((v) & 0xFFu), (uint8_t)(((v) >> 8) & 0xFFu)
+
+/** str operand: the current chapter name. */
+#define STORY_STR_NAME  0xFFFFu
+/** img operand: the current chapter art. */
+#define STORY_IMG_ART   0xFEu
+/** img operand: the current chapter enemy. */
+#define STORY_IMG_FOE   0xFDu
+/** ART position: center on this axis. */
+#define STORY_CENTER    0xFFu
+/** DEFER priority: back to immediate drawing. */
+#define STORY_DEFER_OFF 0xFFu
+
+/** Opcodes, with their operands (size in bytes). */
+typedef enum {
+  SOP_END = 0,   ///< Story finished, back to the menu.
+  SOP_SCREEN,    ///< Fade the old screen out; the next tick starts dark.
+  SOP_DEFER,     ///< prio(1): gfx_defer_begin(), or STORY_DEFER_OFF.
+  SOP_CLEAR,     ///< Clear to black.
+  SOP_ART,       ///< img(1) x(1) y(1): blit, STORY_CENTER centers.
+  SOP_HEADER,    ///< str(2) color(2): header band.
+  SOP_TEXT,      ///< x(1) y(1) str(2) color(2) scale(1).
+  SOP_BAR,       ///< x(1) y(1) w(1) h(1) color(2): filled box.
+  SOP_MARK,      ///< "More text" triangle in the bottom-right corner.
+  SOP_LORE,      ///< page(1): typewriter page LORE_TEXT[page] (lore_text.h).
+  SOP_TYPE,      ///< Waits: ms(2) ms_per_char(1): typewriter the page.
+  SOP_WAIT,      ///< Waits: ms(2).
+  SOP_CHAPTER,   ///< name str(2) enemy str(2) hz(2) art img(1) foe img(1).
+  SOP_FOE,       ///< x(1) y(1) color(2): "<enemy> STR: <hz> Hz".
+  SOP_CHOOSE,    ///< Waits: ms(2): pick item A or B with Hz.
+  SOP_BATTLE,    ///< Waits: ms(2): flex round against the chapter enemy.
+  SOP_RESULT,    ///< Waits: ms(2) lost addr(2): jumps there on a defeat.
+  SOP_LOOT,      ///< Previous and current item.
+  SOP_DIED,      ///< retry addr(2): count a death, jump there unless it
+                 ///< was one too many.
+  SOP_GIVEUP,    ///< Waits: ms(2) retry addr(2): a strong flex ends the
+                 ///< story, otherwise jumps to retry after ms.
+  SOP_UNLOCK,    ///< cheevo(1).
+  SOP_JUMP,      ///< addr(2).
+  SOP_CALL,      ///< addr(2).
+  SOP_RET,       ///< Back after the last CALL.
+  SOP_COUNT
+} story_op_t;
+
+/** Compiled program (src/story_script.c, generated). */
+extern const uint8_t  g_story_bc[];
+/** Program length in bytes. */
+extern const uint16_t g_story_bc_len;
+/** String pool. */
+extern const char     g_story_str[];
+/** Images the program draws, by img operand. */
+extern const gfx_image_t *const g_story_img[];
+/** Transparent palette index of each image (GFX_KEY_NONE if none). */
+extern const uint16_t g_story_img_key[];
+
+#endif /* STORY_SCRIPT_H */
@@ -2,12 +2,15 @@
 #define TEAM_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TEAM_W 128
 #define TEAM_H 96
 #define TEAM_PAL_SIZE 16
+#define TEAM_RLE_SIZE 3042
 
 extern const uint16_t TEAM_PAL[TEAM_PAL_SIZE];
-extern const uint8_t  TEAM_IDX[(TEAM_W * TEAM_H) / 2];
+extern const uint8_t  TEAM_RLE[TEAM_RLE_SIZE];
+extern const gfx_image_t TEAM_IMG;
 
 #endif // TEAM_H
@@ -2,12 +2,15 @@
 #define TI_LOGO_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TI_LOGO_W 128
 #define TI_LOGO_H 72
-#define TI_LOGO_PAL_SIZE 16
+#define TI_LOGO_PAL_SIZE 4
+#define TI_LOGO_RLE_SIZE 561
 
 extern const uint16_t TI_LOGO_PAL[TI_LOGO_PAL_SIZE];
-extern const uint8_t  TI_LOGO_IDX[(TI_LOGO_W * TI_LOGO_H) / 2];
+extern const uint8_t  TI_LOGO_RLE[TI_LOGO_RLE_SIZE];
+extern const gfx_image_t TI_LOGO_IMG;
 
 #endif // TI_LOGO_H
@@ -23,6 +23,18 @@ void timer_init(void);
  */
 uint32_t millis(void);
 
+/**
+ * @brief Get the number of microseconds since system start.
+ *
+ * Combines the millisecond count with the SysTick down-counter, so it is
+ * only meant for measuring short intervals (render budgets). Wraps after
+ * about 71 minutes. A SysTick wrap not yet counted by its ISR is added in,
+ * so the result never goes back while interrupts are masked (up to 1 ms).
+ *
+ * @return Microseconds elapsed since the timer subsystem was initialized.
+ */
+uint32_t micros(void);
+
 /**
  * @brief Busy-wait for a specified number of milliseconds.
  *
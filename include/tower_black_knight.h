@@ -2,12 +2,16 @@
 #define TOWER_BLACK_KNIGHT_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TOWER_BLACK_KNIGHT_W 128
 #define TOWER_BLACK_KNIGHT_H 70
 #define TOWER_BLACK_KNIGHT_PAL_SIZE 16
+#define TOWER_BLACK_KNIGHT_RLE_SIZE 1174
+#define TOWER_BLACK_KNIGHT_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t TOWER_BLACK_KNIGHT_PAL[TOWER_BLACK_KNIGHT_PAL_SIZE];
-extern const uint8_t  TOWER_BLACK_KNIGHT_IDX[(TOWER_BLACK_KNIGHT_W * TOWER_BLACK_KNIGHT_H) / 2];
+extern const uint8_t  TOWER_BLACK_KNIGHT_RLE[TOWER_BLACK_KNIGHT_RLE_SIZE];
+extern const gfx_image_t TOWER_BLACK_KNIGHT_IMG;
 
 #endif // TOWER_BLACK_KNIGHT_H
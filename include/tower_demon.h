@@ -2,12 +2,16 @@
 #define TOWER_DEMON_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TOWER_DEMON_W 96
 #define TOWER_DEMON_H 64
 #define TOWER_DEMON_PAL_SIZE 16
+#define TOWER_DEMON_RLE_SIZE 1096
+#define TOWER_DEMON_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t TOWER_DEMON_PAL[TOWER_DEMON_PAL_SIZE];
-extern const uint8_t  TOWER_DEMON_IDX[(TOWER_DEMON_W * TOWER_DEMON_H) / 2];
+extern const uint8_t  TOWER_DEMON_RLE[TOWER_DEMON_RLE_SIZE];
+extern const gfx_image_t TOWER_DEMON_IMG;
 
 #endif // TOWER_DEMON_H
@@ -2,12 +2,16 @@
 #define TOWER_DRAGON_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TOWER_DRAGON_W 100
 #define TOWER_DRAGON_H 56
 #define TOWER_DRAGON_PAL_SIZE 16
+#define TOWER_DRAGON_RLE_SIZE 1725
+#define TOWER_DRAGON_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t TOWER_DRAGON_PAL[TOWER_DRAGON_PAL_SIZE];
-extern const uint8_t  TOWER_DRAGON_IDX[(TOWER_DRAGON_W * TOWER_DRAGON_H) / 2];
+extern const uint8_t  TOWER_DRAGON_RLE[TOWER_DRAGON_RLE_SIZE];
+extern const gfx_image_t TOWER_DRAGON_IMG;
 
 #endif // TOWER_DRAGON_H
@@ -2,12 +2,16 @@
 #define TOWER_MINOTAUR_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TOWER_MINOTAUR_W 96
 #define TOWER_MINOTAUR_H 55
 #define TOWER_MINOTAUR_PAL_SIZE 16
+#define TOWER_MINOTAUR_RLE_SIZE 1918
+#define TOWER_MINOTAUR_KEY GFX_KEY_NONE   // transparent index for gfx_layer_t
 
 extern const uint16_t TOWER_MINOTAUR_PAL[TOWER_MINOTAUR_PAL_SIZE];
-extern const uint8_t  TOWER_MINOTAUR_IDX[(TOWER_MINOTAUR_W * TOWER_MINOTAUR_H) / 2];
+extern const uint8_t  TOWER_MINOTAUR_RLE[TOWER_MINOTAUR_RLE_SIZE];
+extern const gfx_image_t TOWER_MINOTAUR_IMG;
 
 #endif // TOWER_MINOTAUR_H
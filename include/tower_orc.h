@@ -2,12 +2,16 @@
 #define TOWER_ORC_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TOWER_ORC_W 96
 #define TOWER_ORC_H 76
 #define TOWER_ORC_PAL_SIZE 16
+#define TOWER_ORC_RLE_SIZE 1666
+#define TOWER_ORC_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t TOWER_ORC_PAL[TOWER_ORC_PAL_SIZE];
-extern const uint8_t  TOWER_ORC_IDX[(TOWER_ORC_W * TOWER_ORC_H) / 2];
+extern const uint8_t  TOWER_ORC_RLE[TOWER_ORC_RLE_SIZE];
+extern const gfx_image_t TOWER_ORC_IMG;
 
 #endif // TOWER_ORC_H
@@ -2,12 +2,16 @@
 #define TOWER_WEREWOLF_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define TOWER_WEREWOLF_W 96
 #define TOWER_WEREWOLF_H 64
 #define TOWER_WEREWOLF_PAL_SIZE 16
+#define TOWER_WEREWOLF_RLE_SIZE 1167
+#define TOWER_WEREWOLF_KEY 0   // transparent index for gfx_layer_t
 
 extern const uint16_t TOWER_WEREWOLF_PAL[TOWER_WEREWOLF_PAL_SIZE];
-extern const uint8_t  TOWER_WEREWOLF_IDX[(TOWER_WEREWOLF_W * TOWER_WEREWOLF_H) / 2];
+extern const uint8_t  TOWER_WEREWOLF_RLE[TOWER_WEREWOLF_RLE_SIZE];
+extern const gfx_image_t TOWER_WEREWOLF_IMG;
 
 #endif // TOWER_WEREWOLF_H
@@ -2,12 +2,15 @@
 #define YOU_DIED_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define YOU_DIED_W 128
 #define YOU_DIED_H 84
 #define YOU_DIED_PAL_SIZE 16
+#define YOU_DIED_RLE_SIZE 1081
 
 extern const uint16_t YOU_DIED_PAL[YOU_DIED_PAL_SIZE];
-extern const uint8_t  YOU_DIED_IDX[(YOU_DIED_W * YOU_DIED_H) / 2];
+extern const uint8_t  YOU_DIED_RLE[YOU_DIED_RLE_SIZE];
+extern const gfx_image_t YOU_DIED_IMG;
 
 #endif // YOU_DIED_H
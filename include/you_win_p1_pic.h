@@ -2,12 +2,15 @@
 #define YOU_WIN_P1_PIC_H
 
 #include <stdint.h>
+#include "gfx.h"
 
 #define YOU_WIN_P1_PIC_W 116
 #define YOU_WIN_P1_PIC_H 128
 #define YOU_WIN_P1_PIC_PAL_SIZE 16
+#define YOU_WIN_P1_PIC_RLE_SIZE 1335
 
 extern const uint16_t YOU_WIN_P1_PIC_PAL[YOU_WIN_P1_PIC_PAL_SIZE];
-extern const uint8_t  YOU_WIN_P1_PIC_IDX[(YOU_WIN_P1_PIC_W * YOU_WIN_P1_PIC_H) / 2];
+extern const uint8_t  YOU_WIN_P1_PIC_RLE[YOU_WIN_P1_PIC_RLE_SIZE];
+extern const gfx_image_t YOU_WIN_P1_PIC_IMG;
 
 #endif // YOU_WIN_P1_PIC_H
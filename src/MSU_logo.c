@@ -1,320 +1,122 @@
 #include <stdint.h>
-#include "msu_logo.h"
+#include "MSU_logo.h"
 
 const uint16_t MSU_LOGO_PAL[MSU_LOGO_PAL_SIZE] = {
     0x9D74, 0xD6DA, 0x538D, 0x09E6, 0x7471, 0xBE38, 0x3B0B, 0x640F, 
     0xB617, 0x2247, 0xFFFF, 0x1A48, 0x1227, 0x2268, 0x2AA9, 0xE75D, 
 };
 
-const uint8_t MSU_LOGO_IDX[(MSU_LOGO_W * MSU_LOGO_H) / 2] = {
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAF, 0x10, 0x04, 0x22, 0x2E, 0xED, 0xDE, 0xE2, 0x24, 0x00, 0x51, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA1, 0x00, 0x2E, 0xEC, 0x3C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x33, 0xBE, 0x64, 0x01, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0x10, 0x2E, 0xCC, 0xCC, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xBC, 0xCC, 
-    0xCD, 0x24, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xA1, 0x02, 0xBC, 0xCC, 0xDD, 0xDD, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xDD, 0xDD, 0xDB, 0xCC, 0xC2, 0x01, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA1, 0x4E, 0xCC, 0xBD, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDD, 0xBC, 0x3E, 0x75, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xA5, 0x2C, 0xCC, 0xDD, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDC, 0xCC, 0x25, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x2C, 0xCB, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDB, 0xC3, 0x4A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x7C, 0xCD, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 
-    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0E, 0xCB, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBD, 0xC6, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x52, 0xCC, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBD, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xCC, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xEF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x23, 0xBD, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5E, 0xCD, 0xDB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCE, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9C, 0xDB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 
-    0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xB1, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA4, 0xCB, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x4A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x4C, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 
-    0xDD, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0xDD, 0xDD, 0xBB, 0xBB, 0xBB, 0xBD, 0xBC, 
-    0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xA4, 0xCD, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 
-    0xDD, 0xBC, 0xC3, 0xCE, 0xEE, 0xE2, 0x22, 0x22, 0x6E, 0xEE, 0xDC, 0x3C, 0xCB, 0xDD, 0xDB, 0xBB, 
-    0xBD, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBD, 0xDB, 0xCC, 0xCE, 0x70, 0x01, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xF1, 0x10, 0x07, 0xEC, 0xCC, 
-    0xCD, 0xDD, 0xDB, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xCB, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBD, 0xDC, 0x3B, 0x20, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xF1, 0x02, 0xE3, 0xCC, 0xEC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBD, 0xBC, 0xC6, 0x01, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x2D, 0xCC, 0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x2C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBD, 0xDC, 0xC2, 0x0A, 0xAA, 0xAA, 0xAA, 0xA1, 0x01, 0xA1, 0x26, 0x66, 0x62, 
-    0x27, 0x40, 0x81, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x47, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x3D, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDC, 0xC2, 0x5A, 0xAA, 0xAA, 0xAA, 0x12, 0xED, 0xB1, 0xA1, 0xBC, 
-    0xCC, 0xCC, 0x33, 0xC2, 0x40, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1C, 0xBD, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDB, 0xCE, 0x0A, 0xAA, 0xAA, 0x10, 0xFA, 0x03, 0xCC, 0xE1, 
-    0xA1, 0xEB, 0xDD, 0xDC, 0xE0, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 
-    0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCC, 0x4F, 0xAA, 0xAA, 0x14, 0xE3, 0x0A, 0xFE, 
-    0xCB, 0xE1, 0xA1, 0xBB, 0xDC, 0xC4, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA0, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xE0, 0xAA, 0xAA, 0xAF, 0xE3, 0xBC, 
-    0x4A, 0xA2, 0xCB, 0xE1, 0xA5, 0xCD, 0xBC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA2, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC2, 0x1A, 0xAA, 0x10, 0xFA, 
-    0x0C, 0xEC, 0x2A, 0xA4, 0xCC, 0xE1, 0xA5, 0xCD, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x2F, 0xAA, 0xF0, 
-    0xE3, 0x0A, 0xFE, 0xCB, 0xE1, 0xA0, 0xCC, 0xE1, 0xA5, 0xCC, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC7, 0xAA, 
-    0xAA, 0x43, 0xBC, 0xEF, 0xA0, 0xCE, 0x30, 0xA1, 0xCC, 0xE1, 0xA8, 0x3E, 0x1A, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xDC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 
-    0x7A, 0xAA, 0xAA, 0x1E, 0xCD, 0xC0, 0xAF, 0xEC, 0xC7, 0xAF, 0x6C, 0xE1, 0xA8, 0x34, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBD, 0xC2, 0xAA, 0xA0, 0x4A, 0xA0, 0xCB, 0xCE, 0x1A, 0x0C, 0xCE, 0xFA, 0x23, 0x6F, 0xA0, 0x31, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xCD, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xDC, 0x2F, 0xAA, 0x0C, 0x34, 0xAA, 0x0C, 0xDC, 0x4A, 0xFE, 0xCB, 0x5A, 0x43, 0xEF, 
-    0xA0, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1C, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBD, 0xCE, 0x1A, 0xA0, 0xCD, 0xDC, 0x0A, 0xA4, 0xCB, 0xD1, 0xA0, 0xCC, 0x4A, 
-    0x5E, 0x4A, 0xA1, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 
-    0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDB, 0xC0, 0xAA, 0xA1, 0x2C, 0xDB, 0xC0, 0xAA, 0x2C, 0xC2, 0xAF, 
-    0x6C, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0x2C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x4A, 0xAA, 0xAA, 0xF7, 0xCB, 0xBD, 0x5A, 0xF2, 
-    0xCC, 0x0A, 0x11, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0x2C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC6, 0xFA, 0xA4, 0x2F, 0xAA, 0x0D, 0xCC, 
-    0xE1, 0xA1, 0xEC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0x11, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xEC, 0xDB, 0xBB, 0xBB, 0xBB, 0xDD, 0xC0, 0xAA, 0x5B, 0x3E, 0x5A, 
-    0xA5, 0xEC, 0xC6, 0x1A, 0x11, 0xAA, 0xAA, 0xAA, 0x10, 0x42, 0x2E, 0xEE, 0xE6, 0x22, 0x00, 0x1A, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x3D, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x2A, 0xAA, 0x23, 
-    0xEC, 0xC0, 0xAA, 0x12, 0xC3, 0x7A, 0xAA, 0xAA, 0xAA, 0x02, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xB2, 0x45, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x3D, 0xBB, 0xBB, 0xBB, 0xBD, 0xBC, 0x5A, 
-    0xAA, 0x06, 0xCC, 0xBC, 0x21, 0xAA, 0x42, 0x1A, 0xAA, 0xAA, 0x02, 0xCC, 0xBD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDB, 0xCC, 0x3B, 0x20, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xCD, 0xBB, 0xBB, 0xBB, 0xBD, 
-    0xC2, 0xAA, 0xAA, 0xAF, 0x06, 0xCC, 0xCE, 0x5A, 0xAA, 0xAA, 0xAA, 0x12, 0xCC, 0xDD, 0xDB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0xDB, 0xCC, 0x60, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xCD, 0xBB, 0xBB, 
-    0xBB, 0xDD, 0xC0, 0xAA, 0x15, 0xAA, 0xAF, 0x06, 0xC3, 0xC0, 0xAA, 0xAA, 0xA0, 0xEC, 0xDD, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDD, 0xCC, 0x21, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xCD, 
-    0xBB, 0xBB, 0xBB, 0xDC, 0x6F, 0xAA, 0x2C, 0x20, 0x1A, 0xAA, 0x06, 0xE1, 0xAA, 0xAA, 0x0C, 0xCD, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0xCE, 0x5A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA2, 0xCD, 0xBB, 0xBB, 0xBB, 0xD3, 0x4A, 0xA1, 0xBC, 0xCC, 0xE4, 0x5A, 0xAF, 0x1A, 0xAA, 0xA0, 
-    0xCC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 
-    0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA6, 0xCD, 0xBB, 0xBB, 0xBB, 0xBC, 0x8A, 0xA0, 0xCC, 0xCC, 0x33, 0xC2, 0x0A, 0xAA, 
-    0xAA, 0x8C, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBD, 0xCC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0xCD, 0xBB, 0xBB, 0xBD, 0xCE, 0xFA, 0xAA, 0x10, 0x02, 0x2E, 0xC3, 
-    0x2A, 0xAA, 0xA1, 0xEC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xB5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0xCD, 0xBB, 0xBB, 0xBD, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA1, 0x80, 0x1A, 0xAA, 0xA2, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCE, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xCD, 0xBB, 0xBB, 0xBD, 0xC0, 0xAA, 0xF0, 
-    0x51, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xD3, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xCD, 0xBB, 0xBB, 0xBD, 0xC0, 
-    0xAA, 0x13, 0xBE, 0xE2, 0x40, 0x0F, 0xAA, 0xAF, 0xEC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC0, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xCD, 0xBB, 0xBB, 
-    0xBD, 0x35, 0xAA, 0x8C, 0xBC, 0xCC, 0x33, 0xC1, 0xAA, 0xA0, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC2, 0xFA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xCD, 
-    0xBB, 0xBB, 0xBD, 0x31, 0xAA, 0x0C, 0xDD, 0xCE, 0x70, 0x1A, 0xAA, 0xFE, 0xCD, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xDC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA0, 0x3D, 0xBB, 0xBB, 0xBD, 0x31, 0xAA, 0x0C, 0xDC, 0x21, 0xAA, 0xAA, 0xAA, 0x0C, 0xDB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xDC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA0, 0x3D, 0xBB, 0xBB, 0xBD, 0x35, 0xAA, 0x0C, 0xC4, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 
-    0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xDB, 0xDB, 0xBB, 0xBD, 0xC0, 0xAA, 0x43, 0x7A, 0xAA, 0xAA, 0xAA, 
-    0xAF, 0xEC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC7, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x6C, 0xDB, 0xBB, 0xBD, 0xC0, 0xAA, 0x4D, 0x1A, 0xAA, 
-    0xAA, 0xAA, 0xA8, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCE, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 0xDB, 0xBB, 0xBD, 0xC0, 0xAA, 0x24, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x3D, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0xDB, 0xBB, 0xDD, 0xBB, 0xDC, 0x0A, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x4C, 0xDB, 0xBB, 0xBD, 0xC2, 
-    0xAA, 0x45, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x3D, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDC, 0x2A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5C, 0xDB, 0xBB, 
-    0xBD, 0xC2, 0xAA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x3D, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xCC, 0x24, 0x05, 0x50, 0x42, 0xCC, 0xDD, 
-    0xC8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 
-    0xCD, 0xBB, 0xBD, 0xCE, 0xFA, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x3D, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC, 0x20, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0x02, 0xCD, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xA2, 0xCD, 0xBB, 0xBD, 0xCE, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x3D, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC7, 0xFA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAF, 0x7C, 0xBB, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xA0, 0xCD, 0xBB, 0xBB, 0xD3, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x3D, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x2A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xCC, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xBC, 0xDB, 0xBB, 0xD3, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA0, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDB, 
-    0xE0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xEC, 0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6C, 0xDB, 0xBB, 0xDC, 0x4A, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA5, 0xBB, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBD, 0xCC, 0x4F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x43, 0xDB, 0xBB, 0xDC, 0x2A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xEC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xDB, 0xCE, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0xCE, 0x1A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8C, 0xBD, 0xBB, 0xDC, 
-    0xEF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDC, 0xC6, 0x05, 0xFA, 0xAA, 0xAA, 0xAA, 0xA2, 0xCC, 
-    0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF6, 0xCD, 
-    0xBB, 0xDC, 0xDF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x03, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDC, 0xCC, 0xE2, 0x22, 0x2F, 0xAA, 
-    0xA0, 0xCB, 0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA7, 0xCD, 0xBB, 0xDC, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8C, 0xDB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDD, 0xCC, 0xC3, 
-    0x9F, 0xAA, 0xA0, 0xCE, 0xC7, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA0, 0xCD, 0xBB, 0xDB, 0xB1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xCD, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xDD, 0xDB, 0xEF, 0xAA, 0xA0, 0xCD, 0xBC, 0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xDB, 0xDB, 0xDB, 0xB1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 
-    0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xDC, 0xEA, 0xAA, 0xA0, 0x3D, 0xDC, 0x6F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 0xDB, 0xDB, 0xB1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xA0, 0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xEA, 0xAA, 0xA0, 0xCD, 0xDD, 0xC4, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 0xDB, 0xDC, 0xD1, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xA1, 0xCB, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xEA, 0xAA, 0xA0, 0x3C, 0xCC, 0xCC, 0x0A, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x43, 0xDB, 0xDC, 0xDF, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x6C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xEF, 0xAA, 0xA1, 0x00, 0x2E, 0xEC, 
-    0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x43, 0xDB, 0xDC, 
-    0xEF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x7C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xEF, 0xAA, 0xAA, 0xAA, 
-    0xAF, 0x15, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 
-    0xDB, 0xDC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x03, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0xE1, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0x0C, 0xBB, 0xDC, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xDB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 
-    0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0x0C, 0xBB, 0xD3, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8B, 0xBD, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xDC, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xBD, 0xBC, 0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0x5B, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xDB, 0xB5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xDD, 0xCE, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x1B, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x03, 0xDD, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0x5B, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDD, 0xDD, 0xDB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x43, 0xDD, 0xC0, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xDD, 0xBC, 0xCC, 
-    0xCD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0x34, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2C, 0xDC, 0xEF, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x43, 0xDB, 0xBB, 0xBB, 0xBB, 0xDD, 0xDB, 0xC3, 
-    0xCE, 0x24, 0xEC, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0x37, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xEC, 
-    0xDC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x7C, 0xDB, 0xBB, 0xDD, 0xDD, 0xCC, 
-    0xCD, 0x20, 0x0F, 0xAA, 0x12, 0xCB, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xC2, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xA8, 0xCD, 0xC6, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x6C, 0xDD, 0xDB, 0xCC, 
-    0x3C, 0x67, 0x01, 0xAA, 0xAA, 0xAA, 0xAA, 0x4C, 0xCD, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 
-    0xC2, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xA7, 0xCD, 0xC8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xCB, 0xCC, 
-    0x3C, 0xE2, 0x05, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x6C, 0xBD, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBD, 0xBD, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0xB3, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 
-    0xCC, 0xE2, 0x40, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF4, 0xCC, 0xDD, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x7C, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xA1, 0x01, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x82, 
-    0xCC, 0xDB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xC3, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAF, 0x0D, 0xCD, 0xDB, 0xBB, 0xBB, 0xBB, 0xDC, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0C, 0xC4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x2C, 0xCD, 0xDB, 0xBB, 0xBB, 0xDC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x22, 0x5A, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x6C, 0xCD, 0xDB, 0xBB, 0xDC, 0x6F, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x1A, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF0, 0xE3, 0xBD, 0xDB, 0xDB, 0xD1, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x14, 0xDC, 0xBD, 
-    0xDD, 0x30, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0x12, 0xCC, 0xBD, 0xC4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0x52, 0xBC, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x14, 0xDC, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
+const uint8_t MSU_LOGO_RLE[MSU_LOGO_RLE_SIZE] = {
+    0xFA, 0xFC, 0xBF, 0xFA, 0x4E, 0x14, 0xF1, 0x00, 0x42, 0x22, 0xEE, 0xDD, 0xEE, 0x22, 0x40, 0x05, 
+    0x10, 0xFA, 0x42, 0x07, 0x10, 0x02, 0xEE, 0xC3, 0xFC, 0x04, 0x07, 0x33, 0xBE, 0x64, 0x01, 0xFA, 
+    0x3B, 0x03, 0x10, 0x2E, 0xBC, 0xFD, 0x08, 0x00, 0xB0, 0xAC, 0x03, 0xD2, 0x41, 0xFA, 0x35, 0x06, 
+    0x10, 0x2B, 0xCC, 0xC0, 0xBD, 0xFB, 0x08, 0xBD, 0x06, 0xBC, 0xCC, 0x20, 0x10, 0xFA, 0x30, 0x08, 
+    0x14, 0xEC, 0xCB, 0xDD, 0xD0, 0xFB, 0x12, 0x08, 0xDD, 0xDB, 0xC3, 0xE7, 0x50, 0xFA, 0x2C, 0x07, 
+    0x52, 0xCC, 0xCD, 0xDD, 0xFB, 0x19, 0x06, 0xDD, 0xCC, 0xC2, 0x50, 0xFA, 0x28, 0x06, 0x52, 0xCC, 
+    0xBD, 0xD0, 0xFB, 0x1E, 0x05, 0xDD, 0xBC, 0x34, 0xFA, 0x25, 0x06, 0x17, 0xCC, 0xDD, 0xD0, 0xFB, 
+    0x23, 0x02, 0xDC, 0x00, 0xFA, 0x24, 0x04, 0x0E, 0xCB, 0xD0, 0xFB, 0x25, 0x03, 0xDC, 0x6F, 0xFA, 
+    0x22, 0x05, 0x52, 0xCC, 0xDD, 0xFB, 0x26, 0x02, 0xDC, 0x00, 0xFA, 0x22, 0x04, 0x0C, 0xCD, 0xD0, 
+    0xFB, 0x27, 0x03, 0xDC, 0xEF, 0xFA, 0x20, 0x04, 0x12, 0x3B, 0xD0, 0xFB, 0x29, 0x02, 0xDC, 0x00, 
+    0xFA, 0x20, 0x04, 0x5E, 0xCD, 0xD0, 0xFB, 0x29, 0x03, 0xDC, 0xE1, 0xFA, 0x1F, 0x03, 0x09, 0xCD, 
+    0xFB, 0x2B, 0x02, 0xDC, 0x40, 0xFA, 0x1F, 0x03, 0x0C, 0xCD, 0xFB, 0x2B, 0x03, 0xDC, 0xB1, 0xFA, 
+    0x1E, 0x03, 0x4C, 0xBD, 0xFB, 0x11, 0xFD, 0x05, 0x4D, 0x00, 0x40, 0xFA, 0x1E, 0x03, 0x4C, 0xDD, 
+    0xFB, 0x0E, 0xAD, 0xFC, 0x05, 0xBD, 0xDB, 0x03, 0xDB, 0xC1, 0xFA, 0x1D, 0x03, 0x4C, 0xDD, 0xFB, 
+    0x0B, 0x07, 0xDD, 0xDB, 0xCC, 0x3C, 0xAE, 0xB2, 0x0C, 0x6E, 0xEE, 0xDC, 0x3C, 0xCB, 0xDD, 0xD0, 
+    0x43, 0x01, 0xC2, 0xFA, 0x1D, 0x03, 0x0C, 0xBD, 0xFB, 0x0A, 0x0C, 0xDD, 0xBC, 0xCC, 0xE7, 0x00, 
+    0x11, 0xF0, 0xEA, 0x06, 0xF1, 0x10, 0x07, 0xE0, 0xAC, 0xAD, 0x02, 0xBC, 0x50, 0xFA, 0x1C, 0x03, 
+    0x0C, 0xBD, 0xFB, 0x09, 0x08, 0xDD, 0xC3, 0xB2, 0x01, 0xF0, 0xFA, 0x0B, 0x0A, 0xF1, 0x02, 0xE3, 
+    0xCC, 0xEC, 0x20, 0xFA, 0x1C, 0x03, 0x1E, 0xCD, 0xFB, 0x08, 0x06, 0xDB, 0xCC, 0x60, 0x10, 0xFA, 
+    0x02, 0xAF, 0xFA, 0x04, 0x06, 0x10, 0x2D, 0xCC, 0x80, 0xFA, 0x1B, 0x03, 0xF2, 0xCD, 0xFB, 0x07, 
+    0x05, 0xDD, 0xCC, 0x20, 0xEA, 0x05, 0x10, 0x1A, 0x12, 0xA6, 0x06, 0x22, 0x74, 0x08, 0x10, 0xFA, 
+    0x00, 0x02, 0x14, 0x70, 0xFA, 0x1C, 0x02, 0x43, 0xD0, 0xFB, 0x06, 0x05, 0xDD, 0xCC, 0x25, 0xDA, 
+    0x08, 0x12, 0xED, 0xB1, 0xA1, 0xB0, 0xBC, 0x06, 0x33, 0xC2, 0x40, 0x10, 0xFA, 0x26, 0x02, 0x1C, 
+    0xB0, 0x4D, 0x04, 0xDB, 0xCE, 0x00, 0xBA, 0x14, 0x10, 0xFA, 0x03, 0xCC, 0xE1, 0xA1, 0xEB, 0xDD, 
+    0xDC, 0xE0, 0x10, 0xFA, 0x2A, 0x02, 0x2C, 0xD0, 0xFB, 0x05, 0x04, 0xDC, 0xC4, 0xF0, 0xAA, 0x09, 
+    0x14, 0xE3, 0x0A, 0xFE, 0xCB, 0x42, 0x06, 0xBB, 0xDC, 0xC4, 0xF0, 0xFA, 0x2B, 0x02, 0x0C, 0xD0, 
+    0xFB, 0x05, 0x03, 0xDC, 0xE0, 0xBA, 0x08, 0xFE, 0x3B, 0xC4, 0xAA, 0x20, 0x43, 0x05, 0x5C, 0xDB, 
+    0xC0, 0xFA, 0x2D, 0x00, 0x20, 0x4D, 0x14, 0xDC, 0x21, 0xAA, 0xA1, 0x0F, 0xA0, 0xCE, 0xC2, 0xAA, 
+    0x4C, 0xC0, 0x44, 0x01, 0xC0, 0xFA, 0x2D, 0x02, 0x0C, 0xD0, 0x4B, 0x13, 0xDC, 0x2F, 0xAA, 0xF0, 
+    0xE3, 0x0A, 0xFE, 0xCB, 0xE1, 0xA0, 0x45, 0x01, 0xC4, 0xFA, 0x2E, 0x02, 0x2C, 0xD0, 0xFB, 0x03, 
+    0x02, 0xDC, 0x70, 0xAA, 0x0D, 0x43, 0xBC, 0xEF, 0xA0, 0xCE, 0x30, 0xA1, 0x43, 0x03, 0x83, 0xE1, 
+    0xFA, 0x2D, 0x01, 0x1D, 0x4B, 0x02, 0xDC, 0x70, 0xBA, 0x0E, 0x1E, 0xCD, 0xC0, 0xAF, 0xEC, 0xC7, 
+    0xAF, 0x60, 0x44, 0x00, 0x40, 0xFA, 0x2E, 0x02, 0x0C, 0xD0, 0xFB, 0x02, 0x1E, 0xDC, 0x2A, 0xAA, 
+    0x04, 0xAA, 0x0C, 0xBC, 0xE1, 0xA0, 0xCC, 0xEF, 0xA2, 0x36, 0xFA, 0x03, 0x10, 0xFA, 0x2E, 0x00, 
+    0x20, 0x4A, 0x1E, 0xDC, 0x2F, 0xAA, 0x0C, 0x34, 0xAA, 0x0C, 0xDC, 0x4A, 0xFE, 0xCB, 0x5A, 0x43, 
+    0xEF, 0xA0, 0xC0, 0xFA, 0x2E, 0x01, 0x1C, 0xFB, 0x02, 0x1F, 0xDC, 0xE1, 0xAA, 0x0C, 0xDD, 0xC0, 
+    0xAA, 0x4C, 0xBD, 0x1A, 0x0C, 0xC4, 0xA5, 0xE4, 0xAA, 0x10, 0xFA, 0x2E, 0x02, 0x0C, 0xD0, 0xFB, 
+    0x00, 0x18, 0xDB, 0xC0, 0xAA, 0xA1, 0x2C, 0xDB, 0xC0, 0xAA, 0x2C, 0xC2, 0xAF, 0x6C, 0x00, 0xFA, 
+    0x36, 0x00, 0x20, 0x4A, 0x01, 0xC4, 0xBA, 0x0F, 0xF7, 0xCB, 0xBD, 0x5A, 0xF2, 0xCC, 0x0A, 0x11, 
+    0xFA, 0x37, 0x49, 0x15, 0xDC, 0x6F, 0xAA, 0x42, 0xFA, 0xA0, 0xDC, 0xCE, 0x1A, 0x1E, 0xC0, 0xFA, 
+    0x00, 0x05, 0xFF, 0x11, 0x1F, 0xFA, 0x2A, 0x01, 0x1E, 0x47, 0x15, 0xDD, 0xC0, 0xAA, 0x5B, 0x3E, 
+    0x5A, 0xA5, 0xEC, 0xC6, 0x1A, 0x11, 0xCA, 0x04, 0x10, 0x42, 0x20, 0xAE, 0x05, 0x62, 0x20, 0x01, 
+    0xFA, 0x25, 0x02, 0x03, 0xD0, 0xEB, 0x12, 0xDC, 0x2A, 0xAA, 0x23, 0xEC, 0xC0, 0xAA, 0x12, 0xC3, 
+    0x70, 0xDA, 0x02, 0x02, 0xD0, 0xFC, 0x04, 0x03, 0xB2, 0x45, 0x73, 0x13, 0xDB, 0xC5, 0xAA, 0xA0, 
+    0x6C, 0xCB, 0xC2, 0x1A, 0xA4, 0x21, 0xBA, 0x04, 0x02, 0xCC, 0xB0, 0xFD, 0x03, 0x07, 0xBC, 0xC3, 
+    0xB2, 0x0F, 0x67, 0x00, 0xC0, 0x47, 0x01, 0xC2, 0xBA, 0x07, 0xF0, 0x6C, 0xCC, 0xE5, 0xDA, 0x06, 
+    0x12, 0xCC, 0xDD, 0xD0, 0xFB, 0x04, 0x07, 0xDD, 0xDB, 0xCC, 0x60, 0xFA, 0x1E, 0x00, 0x40, 0x46, 
+    0x11, 0xDD, 0xC0, 0xAA, 0x15, 0xAA, 0xAF, 0x06, 0xC3, 0xC0, 0xBA, 0x04, 0x0E, 0xCD, 0xD0, 0xFB, 
+    0x0A, 0x06, 0xDD, 0xDC, 0xC2, 0x10, 0xFA, 0x1C, 0x00, 0x20, 0x47, 0x10, 0xC6, 0xFA, 0xA2, 0xC2, 
+    0x01, 0xAA, 0xA0, 0x6E, 0x10, 0xAA, 0x03, 0x0C, 0xCD, 0xFB, 0x0F, 0x04, 0xDD, 0xCE, 0x50, 0x6C, 
+    0x0F, 0x34, 0xAA, 0x1B, 0xCC, 0xCE, 0x45, 0xAA, 0xF1, 0xAA, 0x03, 0x0C, 0xCD, 0xFB, 0x12, 0x03, 
+    0xDC, 0xC0, 0xFA, 0x1A, 0x00, 0x60, 0x46, 0x05, 0xBC, 0x8A, 0xA0, 0xAC, 0x04, 0x33, 0xC2, 0x00, 
+    0xBA, 0x03, 0x8C, 0xCD, 0xFB, 0x14, 0x03, 0xDC, 0xC0, 0x68, 0x0F, 0xDC, 0xEF, 0xAA, 0xA1, 0x00, 
+    0x22, 0xEC, 0x32, 0xAA, 0x03, 0x1E, 0xCD, 0xFB, 0x16, 0x03, 0xDC, 0xB5, 0x69, 0x00, 0x20, 0xFA, 
+    0x00, 0x03, 0x18, 0x01, 0xAA, 0x02, 0x2C, 0xD0, 0xFB, 0x18, 0x03, 0xDC, 0xE1, 0xFA, 0x17, 0x00, 
+    0x20, 0x47, 0x06, 0x0A, 0xAF, 0x05, 0x10, 0xFA, 0x01, 0x02, 0x0C, 0xD0, 0xFB, 0x1A, 0x02, 0xD3, 
+    0x20, 0x6B, 0x0E, 0x13, 0xBE, 0xE2, 0x40, 0x0F, 0xAA, 0xAF, 0xE0, 0x63, 0x03, 0xBD, 0xC0, 0xFA, 
+    0x16, 0x00, 0x40, 0x46, 0x13, 0x35, 0xAA, 0x8C, 0xBC, 0xCC, 0x33, 0xC1, 0xAA, 0xA0, 0xCD, 0xFB, 
+    0x1C, 0x03, 0xDC, 0x2F, 0x66, 0x10, 0x1A, 0xA0, 0xCD, 0xDC, 0xE7, 0x01, 0xAA, 0xAF, 0xE0, 0x65, 
+    0x03, 0xBD, 0xC0, 0xFA, 0x15, 0x01, 0x03, 0x4C, 0x02, 0xC2, 0x10, 0xCA, 0x02, 0x0C, 0xD0, 0xFB, 
+    0x1E, 0x02, 0xDC, 0x20, 0x66, 0x00, 0x50, 0x42, 0x01, 0xC4, 0xEA, 0x00, 0x20, 0x67, 0x03, 0xBD, 
+    0xC5, 0xFA, 0x14, 0x03, 0x1D, 0xBD, 0x43, 0x06, 0xC0, 0xAA, 0x43, 0x70, 0xEA, 0x01, 0xFE, 0x6A, 
+    0x00, 0x70, 0xFA, 0x14, 0x02, 0xF6, 0xC0, 0x49, 0x01, 0xD1, 0xEA, 0x01, 0x8C, 0xFB, 0x21, 0x03, 
+    0xDC, 0xE1, 0xFA, 0x14, 0x00, 0x20, 0x49, 0x01, 0x24, 0xFA, 0x00, 0x02, 0x03, 0xD0, 0xFB, 0x17, 
+    0x0C, 0xDD, 0xDB, 0xBB, 0xDD, 0xBB, 0xDC, 0x00, 0xFA, 0x14, 0x00, 0x40, 0x46, 0x04, 0x2A, 0xA4, 
+    0x50, 0xFA, 0x00, 0x00, 0x40, 0x5E, 0x01, 0xDD, 0xEC, 0x04, 0xDD, 0xDC, 0x20, 0xFA, 0x14, 0x00, 
+    0x50, 0x49, 0x00, 0x00, 0xFA, 0x01, 0x5E, 0x10, 0xDC, 0xC2, 0x40, 0x55, 0x04, 0x2C, 0xCD, 0xDC, 
+    0x80, 0xFA, 0x13, 0x03, 0x1E, 0xCD, 0x43, 0x03, 0xEF, 0xAF, 0x68, 0x02, 0xC2, 0x00, 0xEA, 0x05, 
+    0x02, 0xCD, 0xC2, 0xFA, 0x14, 0x00, 0x20, 0x46, 0x00, 0x10, 0xFA, 0x03, 0x5C, 0x03, 0xDC, 0x7F, 
+    0xFA, 0x01, 0x05, 0xF7, 0xCB, 0xB1, 0xFA, 0x13, 0x00, 0x00, 0x43, 0x03, 0xBD, 0x30, 0x67, 0x02, 
+    0xDC, 0x20, 0xFA, 0x05, 0x03, 0x2C, 0xC4, 0xFA, 0x13, 0x03, 0x1B, 0xCD, 0x50, 0x01, 0x0C, 0x5A, 
+    0x02, 0xBE, 0x00, 0xFA, 0x04, 0x04, 0x1E, 0xCE, 0x10, 0xFA, 0x13, 0x00, 0x60, 0x44, 0x01, 0xC4, 
+    0xFA, 0x03, 0x03, 0x5B, 0xBD, 0xFB, 0x11, 0x04, 0xDC, 0xC4, 0xF0, 0xFA, 0x03, 0x03, 0x0C, 0xC0, 
+    0xFA, 0x13, 0x01, 0x43, 0x44, 0x00, 0x20, 0xFA, 0x03, 0x02, 0xFE, 0xC0, 0x59, 0x06, 0xBD, 0xBC, 
+    0xE0, 0xF0, 0xFA, 0x01, 0x04, 0x1E, 0xCE, 0x10, 0xFA, 0x12, 0x03, 0x8C, 0xBD, 0x42, 0x01, 0xEF, 
+    0xFA, 0x03, 0x00, 0x20, 0x5B, 0x08, 0xBD, 0xDC, 0xC6, 0x05, 0xF0, 0xEA, 0x03, 0x2C, 0xC4, 0xFA, 
+    0x12, 0x02, 0xF6, 0xC0, 0x43, 0x00, 0xD0, 0x4B, 0x01, 0x03, 0x5B, 0x07, 0xBB, 0xDD, 0xCC, 0xCE, 
+    0xA2, 0x08, 0xFA, 0xAA, 0x0C, 0xBE, 0x10, 0xFA, 0x12, 0x00, 0x70, 0x45, 0x00, 0x10, 0xFA, 0x03, 
+    0x01, 0x8C, 0x5D, 0x09, 0xBB, 0xDD, 0xDC, 0xCC, 0x39, 0x44, 0x02, 0xEC, 0x70, 0xFA, 0x12, 0x00, 
+    0x00, 0x43, 0x01, 0xBB, 0x4B, 0x03, 0xFE, 0xCD, 0xFB, 0x19, 0x04, 0xDD, 0xDB, 0xE0, 0x44, 0x03, 
+    0xDB, 0xC8, 0xFA, 0x11, 0x03, 0x1D, 0xBD, 0x4F, 0x01, 0xA2, 0x62, 0x04, 0xBB, 0xDC, 0xE0, 0xAA, 
+    0x06, 0x03, 0xDD, 0xC6, 0xF0, 0xFA, 0x11, 0x01, 0x2C, 0x51, 0x00, 0x00, 0x6C, 0x05, 0xCD, 0xDD, 
+    0xC4, 0x5D, 0x01, 0xCD, 0x4C, 0x03, 0x1C, 0xBD, 0x69, 0x00, 0x30, 0xBC, 0x00, 0x00, 0xFA, 0x10, 
+    0x01, 0x43, 0x43, 0x00, 0xF0, 0xFA, 0x04, 0x02, 0xF6, 0xC0, 0x65, 0x0C, 0xFA, 0xAA, 0x10, 0x02, 
+    0xEE, 0xCD, 0x10, 0x5C, 0x00, 0xE0, 0x4C, 0x01, 0xA7, 0x6A, 0xAA, 0x04, 0xF1, 0x50, 0x00, 0xFA, 
+    0x0F, 0x01, 0x0C, 0x42, 0x00, 0x20, 0xFA, 0x06, 0x01, 0x03, 0x65, 0x00, 0x10, 0xFA, 0x1B, 0x06, 
+    0x0C, 0xBB, 0xDC, 0x40, 0x4E, 0x00, 0xC0, 0x7F, 0x4E, 0x01, 0x30, 0xFA, 0x06, 0x03, 0x8B, 0xBD, 
+    0x62, 0x00, 0xD0, 0x66, 0x03, 0xDB, 0xC8, 0xFA, 0x06, 0x00, 0x50, 0x64, 0x02, 0xBB, 0x50, 0x64, 
+    0x04, 0xDD, 0xCE, 0xF0, 0xFA, 0x06, 0x00, 0x10, 0x63, 0x03, 0xBB, 0xC0, 0x63, 0x04, 0x3D, 0xDC, 
+    0x20, 0xFA, 0x07, 0x00, 0x50, 0x4D, 0xBD, 0xFB, 0x09, 0x00, 0xD0, 0x64, 0x00, 0x40, 0x42, 0x00, 
+    0x00, 0xFA, 0x07, 0x02, 0x0C, 0xD0, 0xFB, 0x01, 0x03, 0xDD, 0xDB, 0xAC, 0x00, 0xD0, 0x50, 0x01, 
+    0x34, 0xFA, 0x1B, 0x05, 0x2C, 0xDC, 0xEF, 0xFA, 0x07, 0x01, 0x43, 0x46, 0x0D, 0xDD, 0xDB, 0xC3, 
+    0xCE, 0x24, 0xEC, 0xDD, 0x4F, 0x00, 0x70, 0xFA, 0x1A, 0x05, 0x1E, 0xCD, 0xC0, 0xFA, 0x08, 0x01, 
+    0x7C, 0x42, 0xAD, 0x0E, 0xCC, 0xCD, 0x20, 0x0F, 0xAA, 0x12, 0xCB, 0xD0, 0x4D, 0x01, 0xC2, 0xFA, 
+    0x1A, 0x05, 0x8C, 0xDC, 0x6F, 0xFA, 0x07, 0x0E, 0xF6, 0xCD, 0xDD, 0xBC, 0xC3, 0xC6, 0x70, 0x10, 
+    0xEA, 0x04, 0x4C, 0xCD, 0xD0, 0x4D, 0x00, 0xF0, 0xFA, 0x19, 0x04, 0x7C, 0xDC, 0x80, 0xFA, 0x08, 
+    0x0B, 0x1C, 0xBC, 0xC3, 0xCE, 0x20, 0x5F, 0xFA, 0x03, 0x04, 0x56, 0xCB, 0xD0, 0x4A, 0x02, 0xBD, 
+    0x10, 0xFA, 0x18, 0x04, 0x1E, 0xB3, 0x40, 0xFA, 0x09, 0x07, 0x0C, 0xCE, 0x24, 0x01, 0xFA, 0x08, 
+    0x05, 0xF4, 0xCC, 0xDD, 0xFB, 0x01, 0x02, 0xDC, 0x50, 0xFA, 0x18, 0x03, 0x7C, 0xC2, 0xFA, 0x0A, 
+    0x03, 0x10, 0x1F, 0xFA, 0x0E, 0x04, 0x82, 0xCC, 0xD0, 0x49, 0x00, 0x00, 0xFA, 0x17, 0x04, 0x0C, 
+    0x32, 0xF0, 0xFA, 0x26, 0x05, 0xF0, 0xDC, 0xDD, 0x47, 0x00, 0x40, 0xFA, 0x16, 0x03, 0x0C, 0xC4, 
+    0xFA, 0x2A, 0x05, 0x12, 0xCC, 0xDD, 0x45, 0x00, 0x20, 0xFA, 0x15, 0x03, 0x02, 0x25, 0xFA, 0x2D, 
+    0x05, 0x06, 0xCC, 0xDD, 0x43, 0x01, 0x6F, 0xFA, 0x14, 0x01, 0x11, 0xFA, 0x30, 0x0B, 0xF0, 0xE3, 
+    0xBD, 0xDB, 0xDB, 0xD1, 0xFA, 0x51, 0x09, 0x14, 0xDC, 0xBD, 0xDD, 0x30, 0xFA, 0x53, 0x07, 0x12, 
+    0xCC, 0xBD, 0xC4, 0xFA, 0x55, 0x05, 0x52, 0xBC, 0xC2, 0xFA, 0x57, 0x04, 0x14, 0xDC, 0x10, 0xFA, 
+    0x58, 0x01, 0x10, 0x7F, 0xFA, 0x8E, 
+};
+
+const gfx_image_t MSU_LOGO_IMG = {
+    .w = MSU_LOGO_W, .h = MSU_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = MSU_LOGO_PAL, .colors = MSU_LOGO_PAL_SIZE,
+    .data = MSU_LOGO_RLE, .size = MSU_LOGO_RLE_SIZE,
 };
@@ -3,7 +3,8 @@
  * @brief Minimal SPI bring-up and single-channel read helper for ADS131M02.
  *
  * Configures SSI2 on TM4C for communication with the ADS131M02 and
- * provides a blocking function to read a sign-extended sample from CH1.
+ * provides a blocking function to read a sign-extended sample from CH1,
+ * plus a DRDY-interrupt capture ring for the scheduler's acquisition task.
  */
 
 #include <stdint.h>
@@ -138,17 +139,11 @@ void ads_init(void){
 }
 
 /**
- * @brief Blocking read of one sign-extended CH1 sample.
- *
- * Waits for DRDY falling edge, then reads STATUS + CH1 + CH2 (each
- * 24-bit) and returns a downscaled 16-bit sample from CH1.
+ * @brief Read the frame DRDY announced: STATUS + CH1 + CH2 (each 24-bit).
  *
- * @return 16-bit signed sample from CH1.
+ * Each channel is sign-extended and scaled down to 16 bits.
  */
-int16_t ads_read_sample_ch1_blocking(void){
-  // Wait for DRDY falling edge (active low)
-  while(!ADS_DRDY_IS_LOW()){}
-  // One frame typically: STATUS + CH1 + CH2 (each 24-bit).
+static void ads_read_frame(ads_frame_t *f){
   ADS_CS_LOW();
   uint32_t status = ads_read_word24();
   uint32_t ch1    = ads_read_word24();
@@ -156,11 +151,77 @@ int16_t ads_read_sample_ch1_blocking(void){
   ADS_CS_HIGH();
 
   (void)status;
-  (void)ch2;
 
   // Sign-extend 24-bit to 32, then scale to 16-bit for our processing
   // (If part is set to 32-bit words, adjust parsing.)
   int32_t s1 = (ch1 & 0x800000) ? (int32_t)(ch1 | 0xFF000000) : (int32_t)ch1;
+  int32_t s2 = (ch2 & 0x800000) ? (int32_t)(ch2 | 0xFF000000) : (int32_t)ch2;
   // Quick downscale: >> 8 (keep MSB significance)
-  return (int16_t)(s1 >> 8);
+  f->ch[0] = (int16_t)(s1 >> 8);
+  f->ch[1] = (int16_t)(s2 >> 8);
+}
+
+/**
+ * @brief Blocking read of one sign-extended CH1 sample.
+ *
+ * Waits for DRDY falling edge, then reads STATUS + CH1 + CH2 (each
+ * 24-bit) and returns a downscaled 16-bit sample from CH1.
+ *
+ * @return 16-bit signed sample from CH1.
+ */
+int16_t ads_read_sample_ch1_blocking(void){
+  // Wait for DRDY falling edge (active low)
+  while(!ADS_DRDY_IS_LOW()){}
+  ads_frame_t f;
+  ads_read_frame(&f);
+  return f.ch[0];
+}
+
+/* DRDY-driven capture ring (single producer: ISR, single consumer: task) */
+static ads_frame_t       s_cap[ADS_CAPTURE_DEPTH];
+static volatile uint32_t s_cap_head = 0;   // written by the ISR
+static volatile uint32_t s_cap_tail = 0;   // written by ads_capture_read()
+static volatile uint32_t s_cap_dropped = 0;
+static void (*s_cap_notify)(void) = 0;
+
+static void ads_drdy_isr(void){
+  GPIOIntClear(ADS_GPIOE_BASE, ADS_PIN_DRDY);
+  ads_frame_t f;
+  ads_read_frame(&f);                           // DRDY is already low
+
+  uint32_t h = s_cap_head;
+  if (h - s_cap_tail >= ADS_CAPTURE_DEPTH){
+    s_cap_dropped++;
+    return;
+  }
+  s_cap[h & (ADS_CAPTURE_DEPTH - 1u)] = f;
+  s_cap_head = h + 1u;
+  if (s_cap_notify) s_cap_notify();
+}
+
+/**
+ * @brief Start interrupt-driven capture of both channels (see ads131m02.h).
+ */
+void ads_capture_start(void (*notify)(void)){
+  s_cap_notify = notify;
+  GPIOIntTypeSet(ADS_GPIOE_BASE, ADS_PIN_DRDY, GPIO_FALLING_EDGE);
+  GPIOIntRegister(ADS_GPIOE_BASE, ads_drdy_isr);
+  GPIOIntClear(ADS_GPIOE_BASE, ADS_PIN_DRDY);
+  GPIOIntEnable(ADS_GPIOE_BASE, ADS_PIN_DRDY);
+}
+
+/**
+ * @brief Pop up to max captured frames, oldest first.
+ */
+uint32_t ads_capture_read(ads_frame_t *dst, uint32_t max){
+  uint32_t t = s_cap_tail, n = 0;
+  uint32_t h = s_cap_head;
+  while (t != h && n < max){
+    dst[n++] = s_cap[t & (ADS_CAPTURE_DEPTH - 1u)];
+    t++;
+  }
+  s_cap_tail = t;
+  return n;
 }
+
+uint32_t ads_capture_dropped(void){ return s_cap_dropped; }
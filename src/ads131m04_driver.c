@@ -11,6 +11,7 @@
  */
 
 #include "ads131m04_driver.h"
+#include "ssd1351.h"
 
 // TivaWare includes
 #include "inc/hw_memmap.h"
@@ -73,8 +74,8 @@ void ADS_Init(void) {
     GPIOPinConfigure(GPIO_PA5_SSI0TX);
     GPIOPinTypeSSI(GPIO_PORTA_BASE, GPIO_PIN_2 | GPIO_PIN_4 | GPIO_PIN_5);
     
-    // Configure CS pin (PA3) as GPIO output
-    GPIOPinTypeGPIOOutput(GPIO_PORTA_BASE, GPIO_PIN_3);
+    // Configure CS pin (PB5) as GPIO output
+    GPIOPinTypeGPIOOutput(ADS_GPIO_PORT, ADS_CS_PIN);
     CS_HIGH();
     
     // Configure DRDY pin (PB0) as input
@@ -170,6 +171,30 @@ void ADS_HardwareReset(void) {
 
 // LOW-LEVEL SPI
 
+/**
+ * Take SSI0 from the OLED (possibly mid-row: ssd1351 parks its CS) and
+ * select the ADC: SPI mode 1, 1 MHz, 16-bit frames
+ */
+static void ADS_Select(void) {
+    uint32_t temp;
+    
+    ssd1351_bus_suspend();
+    SSIDisable(ADS_SPI_BASE);
+    SSIConfigSetExpClk(ADS_SPI_BASE, SysCtlClockGet(),
+                       SSI_FRF_MOTO_MODE_1, SSI_MODE_MASTER, 1000000, 16);
+    SSIEnable(ADS_SPI_BASE);
+    while(SSIDataGetNonBlocking(ADS_SPI_BASE, &temp)) {}   // OLED leftovers
+    CS_LOW();
+}
+
+/**
+ * Deselect the ADC and hand SSI0 back to the OLED
+ */
+static void ADS_Deselect(void) {
+    CS_HIGH();
+    ssd1351_bus_resume();
+}
+
 /**
  * Transfer one 16-bit word via SPI
  */
@@ -191,13 +216,13 @@ void ADS_TransferWord(uint16_t tx_data, uint16_t *rx_data) {
 void ADS_SendCommand(uint16_t command) {
     uint16_t response;
     
-    CS_LOW();
+    ADS_Select();
     DELAY_US(1);
     
     ADS_TransferWord(command, &response);
     
     DELAY_US(1);
-    CS_HIGH();
+    ADS_Deselect();
 }
 
 
@@ -211,14 +236,14 @@ uint16_t ADS_ReadRegister(uint8_t reg_addr) {
     
     command = ADS_CMD_RREG(reg_addr, 0);  // Read 1 register
     
-    CS_LOW();
+    ADS_Select();
     DELAY_US(1);
     
     ADS_TransferWord(command, &response);
     ADS_TransferWord(ADS_CMD_NULL, &reg_value);
     
     DELAY_US(1);
-    CS_HIGH();
+    ADS_Deselect();
     
     return reg_value;
 }
@@ -231,14 +256,14 @@ void ADS_WriteRegister(uint8_t reg_addr, uint16_t value) {
     
     command = ADS_CMD_WREG(reg_addr, 0);  // Write 1 register
     
-    CS_LOW();
+    ADS_Select();
     DELAY_US(1);
     
     ADS_TransferWord(command, &response);
     ADS_TransferWord(value, &response);
     
     DELAY_US(1);
-    CS_HIGH();
+    ADS_Deselect();
     
     DELAY_US(10);  // Allow register write to complete
 }
@@ -287,21 +312,21 @@ bool ADS_IsDataReady(void) {
 }
 
 /**
- * Read all four channels
+ * Read the frame DRDY announced: STATUS + four 24-bit channels
+ * (sign-extended to 32 bits)
  */
-void ADS_ReadAllChannels(int32_t *ch1, int32_t *ch2, int32_t *ch3, int32_t *ch4) {
+static void ADS_ReadFrame24(int32_t channel_data[ADS_NUM_CHANNELS]) {
     uint16_t status_word;
     uint16_t word_high, word_low;
-    int32_t channel_data[4];
     
-    CS_LOW();
+    ADS_Select();
     DELAY_US(1);
     
     // Send NULL command and receive status
     ADS_TransferWord(ADS_CMD_NULL, &status_word);
     
     // Read each channel (24 bits = 1.5 words at 16-bit transfers)
-    for(int ch = 0; ch < 4; ch++) {
+    for(int ch = 0; ch < ADS_NUM_CHANNELS; ch++) {
         // Read high 16 bits
         ADS_TransferWord(0x0000, &word_high);
         
@@ -320,7 +345,16 @@ void ADS_ReadAllChannels(int32_t *ch1, int32_t *ch2, int32_t *ch3, int32_t *ch4)
     }
     
     DELAY_US(1);
-    CS_HIGH();
+    ADS_Deselect();
+}
+
+/**
+ * Read all four channels
+ */
+void ADS_ReadAllChannels(int32_t *ch1, int32_t *ch2, int32_t *ch3, int32_t *ch4) {
+    int32_t channel_data[ADS_NUM_CHANNELS];
+    
+    ADS_ReadFrame24(channel_data);
     
     // Output
     if(ch1) *ch1 = channel_data[0];
@@ -329,6 +363,68 @@ void ADS_ReadAllChannels(int32_t *ch1, int32_t *ch2, int32_t *ch3, int32_t *ch4)
     if(ch4) *ch4 = channel_data[3];
 }
 
+// INTERRUPT CAPTURE
+// DRDY-driven ring (single producer: ISR, single consumer: task)
+static ADS_Frame         cap_ring[ADS_CAPTURE_FRAMES];
+static volatile uint32_t cap_head = 0;      // written by the ISR
+static volatile uint32_t cap_tail = 0;      // written by ADS_CaptureRead()
+static volatile uint32_t cap_dropped = 0;
+static void (*cap_notify)(void) = 0;
+
+/**
+ * DRDY falling edge: read the frame (borrowing SSI0, even mid OLED row)
+ * and queue it scaled to 16 bits
+ */
+static void ADS_DrdyISR(void) {
+    int32_t channel_data[ADS_NUM_CHANNELS];
+    
+    GPIOIntClear(ADS_DRDY_PORT, ADS_DRDY_PIN);
+    ADS_ReadFrame24(channel_data);              // DRDY is already low
+    
+    uint32_t h = cap_head;
+    if(h - cap_tail >= ADS_CAPTURE_FRAMES) {
+        cap_dropped++;
+        return;
+    }
+    
+    // Quick downscale: >> 8 (keep MSB significance), as the DSP expects
+    ADS_Frame *f = &cap_ring[h & (ADS_CAPTURE_FRAMES - 1u)];
+    for(int ch = 0; ch < ADS_NUM_CHANNELS; ch++) {
+        f->ch[ch] = (int16_t)(channel_data[ch] >> 8);
+    }
+    cap_head = h + 1u;
+    if(cap_notify) cap_notify();
+}
+
+/**
+ * Start interrupt-driven capture of all four channels
+ */
+void ADS_CaptureStart(void (*notify)(void)) {
+    cap_notify = notify;
+    GPIOIntTypeSet(ADS_DRDY_PORT, ADS_DRDY_PIN, GPIO_FALLING_EDGE);
+    GPIOIntRegister(ADS_DRDY_PORT, ADS_DrdyISR);
+    GPIOIntClear(ADS_DRDY_PORT, ADS_DRDY_PIN);
+    GPIOIntEnable(ADS_DRDY_PORT, ADS_DRDY_PIN);
+}
+
+/**
+ * Pop up to max captured frames, oldest first
+ */
+uint32_t ADS_CaptureRead(ADS_Frame *dst, uint32_t max) {
+    uint32_t t = cap_tail, n = 0;
+    uint32_t h = cap_head;
+    while(t != h && n < max) {
+        dst[n++] = cap_ring[t & (ADS_CAPTURE_FRAMES - 1u)];
+        t++;
+    }
+    cap_tail = t;
+    return n;
+}
+
+uint32_t ADS_CaptureDropped(void) {
+    return cap_dropped;
+}
+
 // UTILITY
 /**
  * Convert ADC value to voltage
@@ -57,8 +57,10 @@ static const char *NAMES[CHEEVO_COUNT] = {
 
 /** Current toast achievement ID (if any). */
 static cheevo_t  g_toast_id    = (cheevo_t)(-1);
-/** Time (ms) when toast should expire. */
+/** Time (ms) when toast should expire (0 = no toast). */
 static uint32_t  g_toast_until = 0;
+/** true once the current toast is on screen. */
+static bool      g_toast_shown = false;
 
 /**
  * @brief Bind the achievement system to the active save.
@@ -72,7 +74,7 @@ void cheevos_bind_save(save_t *s){
 /**
  * @brief Unlock a specific achievement ID.
  *
- * Writes to the save (with CRC) and sets up the unlock toast.
+ * Queues a save write (with CRC) and sets up the unlock toast.
  *
  * @param id Achievement ID to unlock.
  * @return true if this call newly unlocked the achievement,
@@ -89,10 +91,11 @@ bool cheevos_unlock(cheevo_t id){
     }
 
     g_save->cheevos_bits |= mask;
-    (void)save_write(g_save);
+    save_request(g_save);
 
     g_toast_id    = id;
     g_toast_until = millis() + 2000u;   // show for ~2 seconds
+    g_toast_shown = false;              // (re)draw on the next frame
 
     return true;    // newly unlocked
 }
@@ -154,8 +157,9 @@ void cheevos_draw_panel(void){
 /**
  * @brief Draw the transient "Achievement Unlocked!" toast, if active.
  *
- * Must be called regularly. When the toast times out, it stops drawing
- * and clears its internal timer.
+ * Must be called regularly. The toast is drawn once into the gfx overlay
+ * band and then left alone: mode drawing under it is held back by gfx
+ * and put back when the toast times out.
  */
 void cheevos_draw_toast(void){
     // No save bound or no active toast -> nothing to draw
@@ -164,18 +168,26 @@ void cheevos_draw_toast(void){
     if (g_toast_id < 0 || g_toast_id >= CHEEVO_COUNT) return;
 
     uint32_t now = millis();
-    if (now >= g_toast_until){
-        // Toast expired; clear it and stop drawing
+    if (g_toast_shown){
+        if ((int32_t)(now - g_toast_until) < 0 && gfx_overlay_active()) return;
+        // Toast expired (or a scrolling page took the band); give it back
+        gfx_overlay_close();
         g_toast_until = 0u;
+        g_toast_shown = false;
         return;
     }
+    if (!gfx_overlay_begin()) return;   // band busy: retried next frame
+    g_toast_until = now + 2000u;        // 2 s from when it is actually seen
 
     const char *label = NAMES[g_toast_id] ? NAMES[g_toast_id] : "???";
 
     // Simple banner at bottom of screen
-    const uint8_t y = 110;  // last ~18 px of 128x128
+    const uint8_t y = GFX_OVERLAY_Y;  // last ~18 px of 128x128
 
-    gfx_bar(0, y,   128, 18, COL_DKGRAY);
+    gfx_bar(0, y,   128, GFX_OVERLAY_H, COL_DKGRAY);
     gfx_text2(2, y + 1,  "Achievement Unlocked!", COL_YELLOW, 1);
     gfx_text2(2, y + 9,  label,                   COL_WHITE,  1);
+
+    gfx_overlay_end();
+    g_toast_shown = true;
 }
@@ -6,345 +6,113 @@ const uint16_t CHEST_PAL[CHEST_PAL_SIZE] = {
     0x51C8, 0xD5B2, 0xCB89, 0x89C5, 0xAC6D, 0xAD12, 0x3188, 0xEE4F, 
 };
 
-const uint8_t CHEST_IDX[(CHEST_W * CHEST_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0xDD, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 
-    0x13, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x88, 0x86, 0x66, 0x66, 0x66, 0x66, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 
-    0xD1, 0x11, 0x9C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
-    0x11, 0x9D, 0x46, 0x6D, 0xD2, 0x26, 0x66, 0x66, 0x43, 0x33, 0x33, 0x13, 0x33, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xD9, 0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 0x9D, 0xDD, 0xDD, 0xDD, 0x31, 0x33, 0x33, 
-    0x33, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
-    0x36, 0x66, 0x68, 0x63, 0xC4, 0x4C, 0xC9, 0x33, 0xDD, 0x99, 0x93, 0x33, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x31, 0x13, 0x39, 0x99, 0x93, 0x34, 0x44, 
-    0x66, 0xD1, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x61, 
-    0x60, 0x00, 0x00, 0x46, 0x00, 0x86, 0x22, 0xCC, 0x00, 0x88, 0x66, 0x66, 0x49, 0xDD, 0xC9, 0x99, 
-    0x99, 0x93, 0x33, 0x39, 0x39, 0xDD, 0xC4, 0x46, 0x66, 0x6D, 0x66, 0x68, 0x22, 0x86, 0xDE, 0x00, 
-    0x00, 0x63, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 
-    0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x82, 0x28, 0x28, 
-    0x86, 0x66, 0x66, 0xC4, 0x66, 0x20, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x66, 0x00, 
-    0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x88, 0x68, 
-    0x22, 0x22, 0x88, 0x82, 0x28, 0x28, 0x88, 0x82, 0x88, 0x00, 0x22, 0x00, 0x00, 0x00, 0x66, 0x00, 
-    0x00, 0x0D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xD6, 
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x02, 0x88, 0x22, 
-    0x86, 0x82, 0x22, 0x68, 0x28, 0x28, 0x88, 0x88, 0x88, 0x22, 0x22, 0x20, 0x00, 0x00, 0x86, 0x00, 
-    0x00, 0x06, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x06, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x28, 0x22, 0x22, 0x02, 0x22, 0x86, 0x64, 
-    0xCD, 0xD4, 0x44, 0x88, 0x28, 0x28, 0x86, 0x62, 0x82, 0x22, 0x28, 0x22, 0x22, 0x00, 0x02, 0x00, 
-    0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0xD0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x06, 0x20, 0x22, 0x22, 0x26, 0x44, 0x6C, 
-    0x42, 0x24, 0x94, 0x42, 0x22, 0x22, 0x24, 0x62, 0x82, 0x22, 0x22, 0x22, 0x22, 0x20, 0x08, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x02, 0x62, 0x22, 0x22, 0x22, 0x26, 0x22, 0x25, 
-    0x54, 0xCC, 0x44, 0x02, 0x22, 0x22, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x00, 
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x62, 0x22, 0x22, 0x22, 0x45, 0x4C, 0x33, 
-    0x11, 0x13, 0x94, 0x42, 0x22, 0x22, 0x44, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x39, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x4C, 0xC5, 
-    0xCA, 0x4A, 0x54, 0x7B, 0x22, 0x22, 0x22, 0x22, 0x24, 0x42, 0x22, 0x22, 0x22, 0x20, 0x02, 0x62, 
-    0x22, 0x00, 0xC9, 0x33, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x95, 0xC4, 
-    0x4C, 0xC4, 0xC4, 0x06, 0x66, 0x66, 0x66, 0x45, 0x55, 0x55, 0x99, 0x59, 0x5C, 0x44, 0x44, 0x44, 
-    0x44, 0x45, 0x42, 0xB4, 0x45, 0x99, 0x99, 0x99, 0x39, 0x9C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0x33, 
-    0x39, 0x95, 0x33, 0x33, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x33, 0x33, 0x31, 0x33, 0x33, 0x33, 
-    0x33, 0x95, 0x42, 0xB3, 0x13, 0x33, 0x33, 0x33, 0x31, 0x33, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x13, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x35, 
-    0x55, 0x59, 0x37, 0x73, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 
-    0x33, 0x31, 0x11, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x97, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x15, 0x75, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x13, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x37, 0x70, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x13, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x3F, 0x5F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x13, 0x92, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x13, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x33, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x31, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x3C, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0xC1, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x31, 0x11, 0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x30, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x01, 
-    0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x11, 0x13, 0x52, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x25, 
-    0x11, 0x11, 0x13, 0x33, 0xFF, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x11, 0x33, 0x42, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x27, 
-    0x31, 0x11, 0x13, 0x33, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x11, 0x33, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x51, 0x11, 0x13, 0x33, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x13, 0x35, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x43, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x13, 0x37, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0xB9, 0x11, 0x11, 0x3F, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x11, 0x9B, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xB4, 0x11, 0x11, 0x3F, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x33, 0x4B, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xBB, 0x31, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 
-    0x13, 0x7B, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xBB, 0x51, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 
-    0x35, 0xB7, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xBB, 0x73, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x37, 0xBB, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xBB, 0xB5, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x5B, 0x7B, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xBB, 0xB7, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 
-    0x7B, 0x7B, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x2B, 
-    0xBB, 0xBB, 0x75, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x95, 0x55, 0x55, 
-    0x7B, 0xBB, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0xB7, 0xA9, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x35, 0xA7, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x74, 
-    0x53, 0x11, 0x13, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x54, 0xB2, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x27, 0x45, 0x31, 
-    0x11, 0x11, 0x13, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x35, 0x72, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x4A, 0x59, 0x99, 
-    0x99, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0x95, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x95, 0xA4, 0x72, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x22, 0x22, 0x22, 
-    0x22, 0x2B, 0xBB, 0x77, 0x77, 0x77, 0x77, 0x70, 0xAA, 0xA0, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0xB2, 0x22, 0x22, 0x22, 0x72, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0xB7, 0x44, 0x44, 0x44, 0x44, 0x47, 0x70, 0xAA, 0xAA, 0xAA, 0x05, 0x55, 0x55, 0x55, 
-    0xF3, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0xA7, 0x44, 0x47, 0x77, 0x77, 0x77, 
-    0xB2, 0x22, 0x22, 0x26, 0x42, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 0x82, 0x66, 0x22, 0x22, 0x62, 
-    0x22, 0x22, 0x27, 0x77, 0x77, 0x77, 0x74, 0x47, 0x74, 0x77, 0xAA, 0xAA, 0xAA, 0x55, 0x0A, 0xA5, 
-    0x55, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x00, 0x44, 0x77, 0x77, 0x77, 0x77, 0x77, 0xBB, 
-    0x22, 0x22, 0x22, 0x26, 0x62, 0x20, 0x28, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x86, 0x66, 0x64, 0x44, 0x22, 0x22, 0x22, 0x62, 
-    0x22, 0x22, 0x24, 0x47, 0x77, 0x44, 0x44, 0x47, 0x75, 0xA7, 0x74, 0xAA, 0x0A, 0x5A, 0x05, 0x55, 
-    0x5A, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x77, 0x74, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x64, 0x66, 0x68, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x88, 0x86, 0x66, 0x66, 0x4C, 0xCC, 0xC5, 0x99, 0x66, 0x00, 0x22, 0x68, 
-    0x22, 0x22, 0x26, 0x44, 0x47, 0x44, 0x44, 0x47, 0x74, 0x47, 0x77, 0x77, 0x77, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xA0, 0x0A, 0xAA, 0x77, 0xA4, 0x4A, 0xA4, 0x47, 0x77, 0x77, 0x74, 0x77, 0x7B, 0xB2, 0x04, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x45, 0xC4, 0x44, 0x66, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0xE8, 0x86, 0x66, 0x66, 0x64, 0x4C, 0xCC, 0x55, 0x99, 0x99, 0x99, 0x39, 0x44, 0x00, 0x02, 0x68, 
-    0x22, 0x22, 0x26, 0x64, 0x44, 0x44, 0x74, 0x4B, 0x77, 0x77, 0x77, 0x77, 0x74, 0x44, 0xA4, 0x44, 
-    0x44, 0x44, 0x47, 0x77, 0x44, 0x44, 0x44, 0xA4, 0x74, 0x47, 0x77, 0x74, 0x77, 0xB2, 0x22, 0x04, 
-    0x22, 0x22, 0x22, 0x26, 0x60, 0x00, 0xC9, 0x95, 0xCC, 0xC4, 0x44, 0x66, 0x66, 0x68, 0x8E, 0x00, 
-    0x44, 0x44, 0xC4, 0xCC, 0xCC, 0x55, 0x55, 0x99, 0x99, 0x99, 0x33, 0x33, 0x66, 0x00, 0x02, 0x66, 
-    0x22, 0x22, 0x26, 0x66, 0x64, 0x74, 0x44, 0x4B, 0x77, 0x77, 0x74, 0x47, 0x74, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x77, 0x7B, 0x74, 0x40, 0x22, 0x22, 0x26, 
-    0x22, 0x22, 0x22, 0x26, 0x20, 0x00, 0x93, 0x33, 0x99, 0x99, 0x5C, 0xCC, 0x44, 0x44, 0x46, 0x66, 
-    0x55, 0xCC, 0xCC, 0x59, 0x99, 0x99, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x00, 0x02, 0x68, 
-    0x82, 0x22, 0x22, 0x86, 0x66, 0x44, 0x44, 0x42, 0x77, 0x44, 0x77, 0x47, 0x74, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x7B, 0xBB, 0x44, 0x42, 0x22, 0x22, 0x26, 
-    0x22, 0x22, 0x20, 0x28, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x39, 0x99, 0x95, 0x5C, 0xCC, 0x44, 
-    0x55, 0xCC, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x46, 0x00, 0x02, 0x68, 
-    0x22, 0x22, 0x28, 0x66, 0x66, 0x66, 0x06, 0x62, 0x66, 0x44, 0x47, 0x7B, 0xB4, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x47, 0x44, 0x44, 0x44, 0x44, 0x62, 0x22, 0x26, 0x82, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x00, 0x08, 0x80, 0x00, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0x99, 0x95, 0xCC, 
-    0x5C, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x46, 0x00, 0x00, 0x68, 
-    0x20, 0x00, 0x08, 0x88, 0x66, 0x66, 0x66, 0x82, 0x66, 0x68, 0x88, 0x22, 0x24, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x44, 0x44, 0x66, 0x62, 0x22, 0x28, 0x22, 0x22, 0x22, 0x22, 
-    0x20, 0x00, 0x00, 0x06, 0x60, 0x00, 0x31, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x99, 0x99, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x60, 0x00, 0x00, 0x86, 
-    0x80, 0x00, 0x02, 0x22, 0x22, 0x22, 0x66, 0x62, 0x86, 0x62, 0x22, 0x22, 0x22, 0x64, 0x44, 0x44, 
-    0x74, 0x44, 0x44, 0x44, 0x02, 0x42, 0x20, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x31, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x9D, 0x60, 0x00, 0x00, 0x88, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x24, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x82, 0x24, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3D, 0xD6, 0x60, 0x00, 0x06, 0x00, 0x00, 0xEE, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x26, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xE0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x28, 0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x6D, 0x31, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x39, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0xD1, 0x11, 0x31, 0x11, 0x11, 0x13, 0x33, 0x33, 
-    0x33, 0x31, 0x33, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x33, 0x3D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x31, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD1, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xC3, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
-    0x0E, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x62, 
-    0x22, 0x22, 0x62, 0x28, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 
-    0x88, 0x00, 0x02, 0x22, 0x82, 0x88, 0x20, 0x68, 0x67, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x77, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 
-    0x82, 0x22, 0x22, 0x82, 0x64, 0x44, 0x44, 0x44, 0x44, 0x4A, 0xAA, 0xA5, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xAA, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x77, 
-    0x77, 0x28, 0x82, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x22, 0x22, 
-    0x22, 0x26, 0x04, 0x47, 0x44, 0x44, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xA4, 0x44, 0x44, 0x77, 
-    0x74, 0x44, 0x44, 0x44, 0x74, 0x48, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x22, 0x22, 
-    0x06, 0x74, 0x74, 0x74, 0x44, 0xAA, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x5F, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xAA, 0xA4, 0x44, 
-    0x44, 0x44, 0x47, 0x77, 0x4B, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x8E, 0xEE, 0xE0, 0x0E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 0x68, 0x22, 
-    0x40, 0x74, 0x44, 0x44, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 
-    0xFF, 0x3F, 0xF3, 0x33, 0x3F, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 
-    0xA4, 0x44, 0x44, 0x44, 0x44, 0x7B, 0xB2, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t CHEST_RLE[CHEST_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x28, 0x04, 0x6D, 
+    0xDD, 0x60, 0xF0, 0x2F, 0x04, 0xC3, 0x13, 0x60, 0xF0, 0x0A, 0x00, 0x60, 0xF0, 0x06, 0x02, 0x88, 
+    0x80, 0xF6, 0x00, 0x00, 0xE0, 0xE0, 0xB6, 0x06, 0xD1, 0x11, 0x9C, 0x80, 0xF0, 0x2E, 0x0C, 0x41, 
+    0x11, 0x9D, 0x46, 0x6D, 0xD2, 0x20, 0xB6, 0x00, 0x40, 0xB3, 0x03, 0x13, 0x33, 0xFD, 0x02, 0xA9, 
+    0xF1, 0x00, 0x00, 0x90, 0xDD, 0x01, 0x31, 0xC3, 0x03, 0x11, 0x94, 0xF0, 0x2F, 0x02, 0x61, 0x30, 
+    0xA6, 0x0F, 0x86, 0x3C, 0x44, 0xCC, 0x93, 0x3D, 0xD9, 0x99, 0xA3, 0xF1, 0x0A, 0xD3, 0x03, 0x11, 
+    0x33, 0xA9, 0x09, 0x33, 0x44, 0x46, 0x6D, 0x14, 0xF0, 0x2E, 0x04, 0xE0, 0x61, 0x60, 0xB0, 0x0D, 
+    0x46, 0x00, 0x86, 0x22, 0xCC, 0x00, 0x88, 0xA6, 0x04, 0x49, 0xDD, 0xC0, 0xC9, 0xA3, 0x07, 0x93, 
+    0x9D, 0xDC, 0x44, 0xA6, 0x0A, 0xD6, 0x66, 0x82, 0x28, 0x6D, 0xE0, 0xA0, 0x02, 0x63, 0x60, 0xF0, 
+    0x30, 0x01, 0xD1, 0xC0, 0x01, 0x4E, 0xF0, 0x08, 0x07, 0xC8, 0x22, 0x82, 0x88, 0xB6, 0x06, 0xC4, 
+    0x66, 0x20, 0x20, 0xD0, 0x00, 0x80, 0xD0, 0x01, 0x66, 0xB0, 0x01, 0x9D, 0x78, 0x00, 0xD0, 0xC0, 
+    0x00, 0x60, 0xF0, 0x09, 0x06, 0x60, 0x28, 0x86, 0x80, 0xA2, 0x06, 0x88, 0x82, 0x28, 0x20, 0xA8, 
+    0x06, 0x28, 0x80, 0x02, 0x20, 0x4B, 0x01, 0xD4, 0xF0, 0x2E, 0x03, 0x60, 0xD6, 0xC0, 0x00, 0x80, 
+    0xF0, 0x02, 0xE2, 0x42, 0x09, 0x22, 0x86, 0x82, 0x22, 0x68, 0x45, 0x02, 0x88, 0x80, 0xB2, 0xB0, 
+    0x00, 0x80, 0x44, 0x02, 0x66, 0x80, 0xF0, 0x2C, 0x03, 0xE0, 0x61, 0xF0, 0x06, 0x00, 0x20, 0x42, 
+    0x00, 0x80, 0xA2, 0x0E, 0x02, 0x22, 0x86, 0x64, 0xCD, 0xD4, 0x44, 0x80, 0x44, 0x03, 0x66, 0x28, 
+    0xA2, 0x00, 0x80, 0xA2, 0x03, 0x00, 0x02, 0xC0, 0x01, 0x46, 0xF0, 0x2C, 0x03, 0x60, 0x6D, 0xF0, 
+    0x05, 0x08, 0x22, 0x20, 0x00, 0x62, 0x00, 0xB2, 0x0B, 0x64, 0x46, 0xC4, 0x22, 0x49, 0x44, 0xC2, 
+    0x00, 0x40, 0x45, 0xC2, 0x02, 0x00, 0x80, 0xC0, 0x00, 0x20, 0xF0, 0x2D, 0x03, 0x60, 0x66, 0x50, 
+    0x01, 0x26, 0xE2, 0x0B, 0x62, 0x22, 0x55, 0x4C, 0xC4, 0x40, 0xB2, 0x00, 0x40, 0xF2, 0x05, 0x02, 
+    0x00, 0x20, 0xD0, 0x00, 0x60, 0xF0, 0x2E, 0x00, 0xD0, 0xF0, 0x01, 0xF2, 0x01, 0x46, 0x0C, 0x45, 
+    0x4C, 0x33, 0x11, 0x13, 0x94, 0x40, 0x44, 0x01, 0x48, 0xF2, 0x06, 0x46, 0x00, 0x80, 0xF0, 0x2A, 
+    0x04, 0x63, 0x39, 0x20, 0xF0, 0x04, 0xF2, 0x06, 0x0C, 0x44, 0xCC, 0x5C, 0xA4, 0xA5, 0x47, 0xB0, 
+    0xF2, 0x00, 0x01, 0x44, 0xE2, 0x0E, 0x00, 0x26, 0x22, 0x20, 0x0C, 0x93, 0x39, 0x20, 0xF0, 0x27, 
+    0x0C, 0x49, 0x95, 0xC4, 0x4C, 0xC4, 0xC4, 0x00, 0xD6, 0x00, 0x40, 0xB5, 0x05, 0x99, 0x59, 0x5C, 
+    0xF4, 0x00, 0x06, 0x54, 0x2B, 0x44, 0x50, 0xC9, 0x02, 0x39, 0x90, 0xFC, 0x01, 0x06, 0xD3, 0x33, 
+    0x99, 0x50, 0xB3, 0x00, 0x60, 0x6F, 0xF3, 0x0C, 0x01, 0x11, 0xD3, 0x00, 0x10, 0xE3, 0x00, 0x90, 
+    0x42, 0x01, 0x31, 0xE3, 0x04, 0x13, 0x31, 0x10, 0xF3, 0x0A, 0xF0, 0x28, 0x02, 0x61, 0x10, 0xF3, 
+    0x03, 0xF1, 0x0C, 0x00, 0x30, 0xA5, 0x04, 0x93, 0x77, 0x30, 0xF1, 0x09, 0xF3, 0x00, 0x05, 0x11, 
+    0x13, 0x34, 0xF0, 0x29, 0x00, 0x90, 0xF1, 0x02, 0xF3, 0x04, 0x01, 0x13, 0xF1, 0x05, 0x02, 0x97, 
+    0x50, 0xF1, 0x04, 0x01, 0x33, 0xF1, 0x07, 0x02, 0x33, 0x20, 0xF0, 0x29, 0x00, 0x60, 0xF1, 0x01, 
+    0xF3, 0x05, 0x4D, 0x02, 0x57, 0x50, 0xF1, 0x16, 0x02, 0x33, 0xD0, 0xF0, 0x2B, 0x00, 0x30, 0xF1, 
+    0x02, 0xC3, 0x04, 0x11, 0x33, 0x30, 0xF1, 0x06, 0x03, 0x37, 0x70, 0x5F, 0x00, 0x60, 0xF0, 0x2B, 
+    0x00, 0x40, 0xF1, 0x03, 0x58, 0x02, 0xF5, 0xF0, 0x5E, 0x03, 0x92, 0x22, 0xF0, 0x29, 0x01, 0x23, 
+    0x4D, 0xB1, 0x4E, 0xF1, 0x1A, 0x01, 0x34, 0x72, 0x02, 0x20, 0xC0, 0x7F, 0xB1, 0x01, 0x33, 0xB2, 
+    0xF0, 0x26, 0xA2, 0x00, 0x30, 0x7F, 0x43, 0x00, 0xC0, 0x71, 0xB2, 0x00, 0xC0, 0x50, 0x00, 0x30, 
+    0x71, 0x00, 0x00, 0xD2, 0xF0, 0x22, 0xC2, 0x00, 0x00, 0xC1, 0xF3, 0x0B, 0xF1, 0x0F, 0xF3, 0x04, 
+    0xB1, 0x01, 0x35, 0xE2, 0xF0, 0x21, 0xE2, 0x00, 0x50, 0x46, 0x02, 0xFF, 0xF0, 0xF3, 0x07, 0xF1, 
+    0x08, 0xF3, 0x09, 0xA1, 0x02, 0x33, 0x40, 0xF2, 0x00, 0x6F, 0x01, 0x73, 0x46, 0xF3, 0x07, 0xF1, 
+    0x11, 0x4F, 0x00, 0xB0, 0x6F, 0xF2, 0x01, 0x00, 0x50, 0x7E, 0x02, 0x33, 0x50, 0x48, 0x00, 0x20, 
+    0x6F, 0x01, 0x43, 0xA1, 0xF3, 0x09, 0xF1, 0x11, 0xF3, 0x03, 0x43, 0x00, 0x70, 0x7A, 0x01, 0xB9, 
+    0x43, 0x01, 0xFF, 0x65, 0xF3, 0x05, 0xA1, 0x03, 0x9B, 0xBB, 0xF2, 0x01, 0x6D, 0x02, 0xBB, 0x40, 
+    0x6C, 0x00, 0x10, 0x4D, 0x02, 0x33, 0x40, 0x70, 0xF2, 0x01, 0x03, 0xBB, 0xB3, 0x42, 0xF3, 0x07, 
+    0xF1, 0x10, 0xF3, 0x05, 0x04, 0x11, 0x13, 0x70, 0x7D, 0x00, 0x50, 0x6B, 0x00, 0x10, 0x4C, 0x04, 
+    0x33, 0x5B, 0x70, 0x4A, 0x00, 0x20, 0x6F, 0x02, 0x73, 0x30, 0x6A, 0x00, 0x10, 0xF3, 0x06, 0x00, 
+    0x70, 0xAB, 0x7A, 0x01, 0xB5, 0xE3, 0xF1, 0x2B, 0x02, 0x5B, 0x70, 0x7E, 0x00, 0x70, 0xF3, 0x0B, 
+    0xF1, 0x0D, 0xF3, 0x08, 0x01, 0x97, 0x7F, 0x02, 0xBB, 0x70, 0xC5, 0x61, 0x02, 0x11, 0x10, 0xF3, 
+    0x00, 0x00, 0x90, 0xB5, 0x00, 0x70, 0xBB, 0xF2, 0x01, 0xF0, 0x1D, 0xF2, 0x01, 0x03, 0xB7, 0xA9, 
+    0xC3, 0xF1, 0x2D, 0x04, 0x35, 0xA7, 0xB0, 0xF2, 0x01, 0xF0, 0x1E, 0xE2, 0x06, 0x74, 0x53, 0x11, 
+    0x10, 0xC3, 0xF1, 0x2F, 0x03, 0x35, 0x4B, 0x6D, 0x00, 0x00, 0xA2, 0x03, 0x74, 0x53, 0xC1, 0x7C, 
+    0x05, 0x11, 0x13, 0x57, 0xB2, 0xF0, 0x21, 0x04, 0x20, 0x4A, 0x50, 0xB9, 0xF5, 0x03, 0xF3, 0x1E, 
+    0x01, 0x99, 0xF5, 0x06, 0x04, 0x95, 0xA4, 0x70, 0x6B, 0x01, 0x66, 0xF2, 0x00, 0x02, 0xBB, 0xB0, 
+    0xF7, 0x00, 0x06, 0x0A, 0xAA, 0x0A, 0xA0, 0xF5, 0x11, 0xAA, 0x01, 0x00, 0xF7, 0x01, 0x00, 0xB0, 
+    0xD2, 0x00, 0x70, 0xA2, 0xF0, 0x22, 0x01, 0x4C, 0xF2, 0x01, 0x01, 0xB7, 0xF4, 0x00, 0x02, 0x77, 
+    0x00, 0xCA, 0x00, 0x00, 0xD5, 0x01, 0xF3, 0xF5, 0x02, 0xEA, 0x03, 0x74, 0x44, 0x4C, 0x06, 0x64, 
+    0x22, 0x02, 0x20, 0xF0, 0x1B, 0x07, 0x22, 0x28, 0x82, 0x66, 0xA2, 0x00, 0x60, 0xC2, 0xE7, 0x42, 
+    0x02, 0x47, 0x70, 0xCA, 0x04, 0x55, 0x0A, 0xA0, 0xA5, 0x00, 0x00, 0xFA, 0x01, 0x05, 0x5A, 0x00, 
+    0x44, 0xF7, 0x01, 0x01, 0xBB, 0xD2, 0x01, 0x66, 0x42, 0x03, 0x82, 0x22, 0xF0, 0x15, 0x01, 0x88, 
+    0xA6, 0x02, 0x44, 0x40, 0xC2, 0x45, 0x04, 0x44, 0x77, 0x70, 0xB4, 0x0D, 0x77, 0x5A, 0x77, 0x4A, 
+    0xA0, 0xA5, 0xA0, 0xA5, 0x01, 0xAA, 0x4B, 0x02, 0x77, 0x70, 0x49, 0x01, 0x77, 0xF2, 0x01, 0x09, 
+    0x00, 0x64, 0x66, 0x68, 0x82, 0xF0, 0x0B, 0x02, 0x88, 0x80, 0xB6, 0x00, 0x40, 0xAC, 0x0A, 0x59, 
+    0x96, 0x60, 0x02, 0x26, 0x80, 0xB2, 0x03, 0x64, 0x44, 0x46, 0x01, 0x44, 0xD7, 0xFA, 0x00, 0x0D, 
+    0x00, 0xAA, 0xA7, 0x7A, 0x44, 0xAA, 0x44, 0xC7, 0x08, 0x47, 0x77, 0xBB, 0x20, 0x40, 0x4A, 0x0A, 
+    0x45, 0xC4, 0x44, 0x66, 0x88, 0x20, 0xF0, 0x00, 0x02, 0xE8, 0x80, 0xC6, 0x06, 0x44, 0xCC, 0xC5, 
+    0x50, 0xC9, 0x06, 0x39, 0x44, 0x00, 0x00, 0x47, 0x00, 0x60, 0xB4, 0x03, 0x74, 0x4B, 0xF7, 0x00, 
+    0x03, 0x44, 0x4A, 0xE4, 0x02, 0x77, 0x70, 0xC4, 0x04, 0xA4, 0x74, 0x40, 0x45, 0x02, 0xB2, 0x20, 
+    0x48, 0x0E, 0x66, 0x00, 0x0C, 0x99, 0x5C, 0xCC, 0x44, 0x40, 0xB6, 0x04, 0x88, 0xE0, 0x00, 0xA4, 
+    0x01, 0xC4, 0xAC, 0xA5, 0xC9, 0xA3, 0x01, 0x66, 0x43, 0x00, 0x60, 0x45, 0x03, 0x66, 0x47, 0xA4, 
+    0x44, 0x01, 0x44, 0x43, 0xF4, 0x0D, 0x07, 0x77, 0x7B, 0x74, 0x40, 0xB2, 0x00, 0x60, 0x46, 0x07, 
+    0x20, 0x00, 0x93, 0x33, 0xA9, 0x03, 0x5C, 0xCC, 0xB4, 0x04, 0x66, 0x65, 0x50, 0xAC, 0x00, 0x50, 
+    0xD9, 0xF3, 0x01, 0x45, 0x01, 0x88, 0xB2, 0x03, 0x86, 0x66, 0xB4, 0x06, 0x27, 0x74, 0x47, 0x70, 
+    0x5B, 0x05, 0xBB, 0xB4, 0x44, 0xC2, 0x44, 0x02, 0x02, 0x80, 0xA0, 0xF3, 0x00, 0xA9, 0x06, 0x55, 
+    0xCC, 0xC4, 0x40, 0x42, 0x01, 0x99, 0xF3, 0x07, 0x02, 0x13, 0x40, 0x45, 0xB2, 0x00, 0x80, 0xC6, 
+    0x0C, 0x06, 0x62, 0x66, 0x44, 0x47, 0x7B, 0xB0, 0xF4, 0x07, 0x00, 0x70, 0xE4, 0x00, 0x60, 0xA2, 
+    0x01, 0x68, 0xF2, 0x02, 0x04, 0x00, 0x08, 0x80, 0x42, 0x00, 0x10, 0xF3, 0x02, 0xA9, 0x06, 0x5C, 
+    0xC5, 0xC9, 0x90, 0xF3, 0x0B, 0x43, 0x03, 0x06, 0x82, 0xA0, 0x02, 0x88, 0x80, 0xC6, 0x0A, 0x82, 
+    0x66, 0x68, 0x88, 0x22, 0x20, 0xF4, 0x09, 0x00, 0x20, 0xA4, 0x01, 0x66, 0x43, 0x00, 0x80, 0xF2, 
+    0x00, 0xC0, 0x01, 0x66, 0x43, 0x00, 0x10, 0xF3, 0x04, 0xA9, 0xF3, 0x0D, 0x02, 0x11, 0x60, 0xB0, 
+    0x02, 0x86, 0x80, 0xA0, 0xD2, 0x06, 0x66, 0x62, 0x86, 0x60, 0xD2, 0x00, 0x60, 0xB4, 0x00, 0x70, 
+    0xD4, 0x06, 0x02, 0x42, 0x20, 0x40, 0xF2, 0x07, 0x00, 0x80, 0xD0, 0x00, 0x60, 0xA0, 0x00, 0x30, 
+    0xB1, 0xF3, 0x1B, 0x01, 0x9D, 0x45, 0x00, 0x80, 0xF0, 0x00, 0xE2, 0x01, 0x44, 0xF2, 0x0E, 0x03, 
+    0x82, 0x24, 0x4B, 0xF0, 0x02, 0x00, 0xE0, 0xB0, 0x44, 0x02, 0x11, 0x10, 0xF3, 0x13, 0x03, 0xDD, 
+    0x66, 0xA0, 0x00, 0x60, 0xA0, 0x01, 0xEE, 0xF0, 0x03, 0xB2, 0x00, 0x60, 0x56, 0xF2, 0x04, 0xF0, 
+    0x07, 0x01, 0x66, 0x4A, 0x01, 0x11, 0xF3, 0x0D, 0x02, 0x9C, 0x60, 0xE0, 0x00, 0xE0, 0x44, 0xF0, 
+    0x04, 0x07, 0x86, 0x28, 0x22, 0x20, 0xF2, 0x14, 0x02, 0x02, 0x20, 0xF0, 0x0A, 0x43, 0x02, 0x6D, 
+    0x30, 0x58, 0x02, 0x9C, 0x60, 0xF0, 0x04, 0x00, 0xE0, 0xF0, 0x0A, 0xA2, 0x01, 0x00, 0xF2, 0x14, 
+    0xF0, 0x0E, 0x00, 0x60, 0xD0, 0x05, 0x6D, 0x11, 0x13, 0xC1, 0xE3, 0x04, 0x13, 0x3D, 0x60, 0xF0, 
+    0x2D, 0xB2, 0xF0, 0x26, 0x01, 0x43, 0xF1, 0x02, 0xA3, 0x01, 0xD6, 0xF0, 0x2C, 0x01, 0x22, 0xF0, 
+    0x22, 0x01, 0x6E, 0xF0, 0x02, 0x01, 0x43, 0x48, 0x01, 0xD6, 0xF0, 0x0E, 0x00, 0xE0, 0xF0, 0x53, 
+    0x02, 0x6D, 0x30, 0xD1, 0xF0, 0x05, 0x01, 0xEE, 0xF0, 0x60, 0x01, 0x6D, 0x51, 0xF0, 0x64, 0x02, 
+    0xEC, 0x30, 0x7F, 0xF0, 0x36, 0x06, 0x69, 0x0E, 0x0E, 0xE0, 0xF0, 0x74, 0x01, 0xEE, 0xF0, 0xFF, 
+    0xF0, 0xA6, 0x02, 0xEE, 0xE0, 0xF0, 0x39, 0x02, 0xEE, 0xE0, 0xF0, 0x23, 0x00, 0x80, 0xF2, 0x00, 
+    0xC6, 0xB2, 0x03, 0x62, 0x28, 0xF2, 0x01, 0x6D, 0xF0, 0x15, 0x12, 0xE8, 0x80, 0x00, 0x22, 0x28, 
+    0x28, 0x82, 0x06, 0x86, 0x70, 0xF4, 0x15, 0x04, 0x77, 0x00, 0x00, 0xF2, 0x03, 0xF0, 0x19, 0x01, 
+    0xEE, 0xF0, 0x0F, 0x03, 0x88, 0x28, 0xB2, 0x02, 0x82, 0x60, 0xF4, 0x01, 0xAA, 0xF5, 0x0F, 0x02, 
+    0xAA, 0xA0, 0xF4, 0x03, 0xA7, 0x02, 0x28, 0x80, 0xD2, 0xF0, 0x0F, 0x01, 0xEE, 0xF0, 0x0A, 0x02, 
+    0xEE, 0x00, 0xD2, 0x04, 0x60, 0x44, 0x70, 0xA4, 0x02, 0x55, 0xA0, 0xF5, 0x1E, 0x02, 0xAA, 0xA0, 
+    0x46, 0xD4, 0x03, 0x74, 0x48, 0xA2, 0xF0, 0x20, 0x02, 0x88, 0x80, 0xA2, 0x0C, 0x06, 0x74, 0x74, 
+    0x74, 0x44, 0xAA, 0xA0, 0xF5, 0x0F, 0xAF, 0xF5, 0x07, 0xAA, 0xE4, 0x05, 0x77, 0x74, 0xB8, 0xE2, 
+    0xF0, 0x04, 0x00, 0x80, 0xAE, 0x03, 0x00, 0xEE, 0xF0, 0x06, 0x0A, 0x22, 0x28, 0x68, 0x22, 0x40, 
+    0x70, 0xB4, 0x01, 0xAA, 0xF5, 0x08, 0xDF, 0x02, 0x3F, 0xF0, 0xA3, 0x02, 0xFF, 0xF0, 0xF5, 0x09, 
+    0x02, 0xAA, 0xA0, 0xF4, 0x00, 0x02, 0x7B, 0xB0, 0xE2, 0xF0, 0x02, 
+};
+
+const gfx_image_t CHEST_IMG = {
+    .w = CHEST_W, .h = CHEST_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = CHEST_PAL, .colors = CHEST_PAL_SIZE,
+    .data = CHEST_RLE, .size = CHEST_RLE_SIZE,
 };
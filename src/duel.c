@@ -0,0 +1,58 @@
+/*==============================================================================
+ * @file    duel.c
+ * @brief   Sequential winner test for two-player flex rounds.
+ *
+ * This file is part of the EMG flex-frequency game project and follows the
+ * project coding standard for file-level documentation.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "project.h"
+#include "emg_pipe.h"
+#include "duel.h"
+
+void duel_reset(duel_t *d){
+  d->leader       = -1;
+  d->lead_from_ms = 0;
+}
+
+// Squared standard error of one player's active mean. Consecutive windows
+// are correlated, so n windows count as n * (1 - rho) / (1 + rho).
+static float se2(const round_stats_t *r){
+  float n = (float)r->above_ms / (float)EMG_PIPE_WINDOW_MS;
+  n *= (1.0f - r->lag1) / (1.0f + r->lag1);
+  return r->var_hz / ((n > 1.0f) ? n : 1.0f);
+}
+
+duel_verdict_t duel_step(duel_t *d, const round_stats_t *p1,
+                         const round_stats_t *p2, uint32_t t_ms, bool final){
+  float a = p1->active_hz, b = p2->active_hz;
+  float diff   = (a > b) ? a - b : b - a;
+  float margin = TIE_MARGIN_PCT * 0.01f * ((a > b) ? a : b);
+  float zse2   = DUEL_Z * DUEL_Z * (se2(p1) + se2(p2));   // (z * SE)^2
+  int8_t ahead = (a > b) ? 0 : 1;
+
+  if (final){
+    // Winner only if the gap is both real and bigger than the margin
+    if (diff > margin && diff * diff > zse2){
+      return ahead ? DUEL_P2 : DUEL_P1;
+    }
+    return DUEL_TIE;
+  }
+
+  // Early: the whole confidence interval must clear the tie margin
+  float excess = diff - margin;
+  bool  lead   = excess > 0.0f && excess * excess > zse2;
+  if (!lead){
+    d->leader = -1;
+    return DUEL_OPEN;
+  }
+  if (d->leader != ahead){
+    d->leader       = ahead;
+    d->lead_from_ms = t_ms;
+  }
+  if (t_ms >= DUEL_MIN_MS && t_ms - d->lead_from_ms >= DUEL_HOLD_MS){
+    return ahead ? DUEL_P2 : DUEL_P1;
+  }
+  return DUEL_OPEN;
+}
@@ -0,0 +1,151 @@
+/*==============================================================================
+ * @file    emg_pipe.c
+ * @brief   Per-channel zero-cross Hz, envelope and baseline pipelines.
+ *
+ * This file is part of the EMG flex-frequency game project and follows the
+ * project coding standard for file-level documentation.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "timer.h"
+#include "game.h"
+#include "emg_pipe.h"
+
+#define HZ_MULT        1.0f     // tweak this to scale the displayed Hz
+#define HZ_HYST        8        // zero-cross hysteresis (counts)
+#define ENV_SHIFT      5        // envelope smoothing: 1/32 per sample
+#define HZ_FULL_SCALE  250.0f   // Hz shown as 100 % intensity
+
+typedef struct {
+  int16_t  prev;
+  bool     prev_ok;
+  uint32_t rises;
+  int32_t  env_q;               // rectified envelope, << ENV_SHIFT
+
+  bool     base_done;
+  bool     base_valid;          // base_hz comes from a finished window
+  uint32_t base_until_ms;
+  float    base_acc;
+  uint32_t base_n;
+  float    base_hz;
+} emg_chan_t;
+
+static emg_chan_t s_ch[EMG_PIPE_CH];
+static uint32_t   s_win_ms = 0;
+
+void emg_pipe_init(uint32_t now_ms){
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    s_ch[c] = (emg_chan_t){0};
+    s_ch[c].base_done = true;   // no baseline until one is requested
+  }
+  s_win_ms = now_ms;
+}
+
+void emg_pipe_push(const int16_t *s){
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    emg_chan_t *ch = &s_ch[c];
+    int16_t v = s[c];
+    int32_t a = (v < 0) ? -(int32_t)v : v;
+    ch->env_q += a - (ch->env_q >> ENV_SHIFT);
+    if (ch->prev_ok){
+      int16_t pz = (ch->prev >  HZ_HYST) ? +1 : (ch->prev < -HZ_HYST ? -1 : 0);
+      int16_t cz = (v        >  HZ_HYST) ? +1 : (v        < -HZ_HYST ? -1 : 0);
+      if (pz < 0 && cz >= 0) ch->rises++;
+    } else {
+      ch->prev_ok = true;
+    }
+    ch->prev = v;
+  }
+}
+
+bool emg_pipe_due(uint32_t now_ms){
+  return (now_ms - s_win_ms) >= EMG_PIPE_WINDOW_MS;
+}
+
+// Start a window on the masked channels; keep = report the old baseline
+// until the new one is done
+static void baseline_start(uint8_t mask, uint32_t window_ms, bool keep){
+  uint32_t until = millis() + window_ms;
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    if (!(mask & (1u << c))) continue;
+    emg_chan_t *ch = &s_ch[c];
+    ch->base_done     = false;
+    ch->base_acc      = 0.0f;
+    ch->base_n        = 0;
+    ch->base_until_ms = until;
+    if (!keep || !ch->base_valid){
+      ch->base_hz    = 0.0f;
+      ch->base_valid = false;
+    }
+  }
+}
+
+void emg_pipe_baseline_begin(uint8_t mask, uint32_t window_ms){
+  baseline_start(mask, window_ms, false);
+}
+
+void emg_pipe_baseline_refresh(uint8_t mask, uint32_t window_ms){
+  baseline_start(mask, window_ms, true);
+}
+
+void emg_pipe_baseline_cancel(uint8_t mask){
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    if (mask & (1u << c)) s_ch[c].base_done = true;
+  }
+}
+
+bool emg_pipe_baseline_ready(uint8_t ch){
+  return ch < EMG_PIPE_CH && s_ch[ch].base_valid && s_ch[ch].base_done;
+}
+
+void baseline_begin(uint32_t window_ms){
+  emg_pipe_baseline_begin(EMG_PIPE_ALL, window_ms);
+}
+
+static void baseline_update(uint8_t c, float hz, uint32_t now_ms){
+  emg_chan_t *ch = &s_ch[c];
+  if (ch->base_done) return;
+
+  if ((int32_t)(now_ms - ch->base_until_ms) < 0){
+    ch->base_acc += hz;
+    ch->base_n++;
+    return;
+  }
+
+  ch->base_hz    = (ch->base_n ? (ch->base_acc / (float)ch->base_n) : 0.0f);
+  ch->base_done  = true;
+  ch->base_valid = true;
+  printf("[BASELINE] ch%u %.2f Hz (n=%lu)\n", (unsigned)c, ch->base_hz,
+         (unsigned long)ch->base_n);
+}
+
+uint32_t emg_pipe_close(uint32_t now_ms, metrics_t *m){
+  uint32_t from = s_win_ms;
+  uint32_t ms   = now_ms - from;
+  if (ms == 0) return now_ms;
+  s_win_ms = now_ms;
+
+  *m = (metrics_t){0};
+  m->t_ms = now_ms;
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    emg_chan_t *ch = &s_ch[c];
+    float raw = (float)ch->rises * 1000.0f / (float)ms;
+    ch->rises = 0;
+
+    baseline_update(c, raw, now_ms);
+
+    // subtract baseline (floor at 0), then scale for display / gameplay
+    float adj = raw - ch->base_hz;
+    if (adj < 0.0f) adj = 0.0f;
+
+    m->hz[c]      = adj * HZ_MULT;
+    m->env[c]     = (float)ch->env_q / (float)(1 << ENV_SHIFT);
+    m->base_hz[c] = ch->base_hz;
+    if (adj > 0.0f) m->active |= (uint8_t)(1u << c);
+
+    float pct = m->hz[c] * 100.0f / HZ_FULL_SCALE;
+    m->pct[c] = (pct >= 100.0f) ? 100u : (uint8_t)pct;
+  }
+  return from;
+}
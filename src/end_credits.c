@@ -3,7 +3,7 @@
  * @brief End-credits sequence state machine.
  *
  * Walks through logos, team members, sponsors, and an achievements
- * slideshow, using a simple timed state machine advanced by tick().
+ * slideshow, using a timed scene table advanced by tick().
  */
 
 #include <stdio.h>
@@ -14,244 +14,200 @@
 #include "project.h"
 
 #include "team.h"
-#include "msu_logo.h"
+#include "MSU_logo.h"
 #include "ti_logo.h"
 #include "end_credits_logo.h"
 #include "cheevos.h"
+#include "scene.h"
 
 /**
  * @brief Internal states for the end-credits sequence.
  */
 typedef enum {
   ST_LOGO = 0,
-  MEMBER_1,
-  MEMBER_2,
-  MEMBER_3,
-  MEMBER_4,
+  ECS_ROLL_MEMBERS,
   SPONSOR,
   ECS_TEAM,
   ECS_THANKS_TI,
-  FACILITATOR,
-  PROFRESSOR,
+  ECS_ROLL_FACULTY,
   ECS_THANKS_MSU,
-  ECS_CHEEVOS
+  ECS_CHEEVOS,        /**< Achievements page 0; pages 1..3 follow. */
+  ECS_CHEEVOS_2,
+  ECS_CHEEVOS_3,
+  ECS_CHEEVOS_4,
+  ECS_SCENES
 } ecs_state_t;
 
-/** Current end-credits state. */
-static ecs_state_t g_s;
-/** Start time (ms) of current state. */
-static uint32_t    g_t0;
-/** Dirty flag: true when screen needs a full redraw for current state. */
-static bool        g_dirty;
-
-/** Current achievements page index in ECS_CHEEVOS; 0xFF = unset. */
-static uint8_t g_ecs_cheevo_page = 0xFF;
+/** Scene runner for the sequence. */
+static scene_run_t g_run;
+
+/** Team member roll: name in the member color, role below, blank spacer. */
+static const char* const g_members_lines[] = {
+  "SYMAEDCHIT LEO",  "as: Lead Programmer",   "",
+  "ERVIN ALIAJ",     "as: PCB Designer",      "",
+  "ANDREW PEREZ",    "as: Power Designer",    "",
+  "PRATIJIT PODDER", "as: Analog Filterings"
+};
+static const uint16_t g_members_colors[] = {
+  COL_RED,    COL_WHITE, COL_BLACK,
+  COL_BLUE,   COL_WHITE, COL_BLACK,
+  COL_GREEN,  COL_WHITE, COL_BLACK,
+  COL_PURPLE, COL_WHITE
+};
+
+/** Faculty roll. */
+static const char* const g_faculty_lines[] = {
+  "JOYDEEP MITRA", "as: the Facilitator", "",
+  "SUBIR BISWAS",  "as: the Profressor"
+};
+static const uint16_t g_faculty_colors[] = {
+  COL_RED, COL_WHITE, COL_BLACK,
+  COL_RED, COL_WHITE
+};
+
+/** Scrolling page shared by the roll states (display start-line scroll). */
+static gfx_scroll_t g_roll;
 
 /**
- * @brief Transition helper: set new state, reset timer, mark dirty.
+ * @brief Clear the screen and set up a centered roll entering from below.
  *
- * @param ns Next state to enter.
+ * @param lines  Credit lines.
+ * @param colors Per-line colors.
+ * @param count  Number of lines.
  */
-static void s_goto(ecs_state_t ns){
-  g_s     = ns;
-  g_t0    = millis();
-  g_dirty = true;
+static void roll_begin(const char* const* lines, const uint16_t* colors, uint8_t count){
+  gfx_clear(COL_BLACK);
+  gfx_scroll_begin(&g_roll, lines, count, 128);
+  g_roll.colors = colors;
+  g_roll.x      = GFX_SCROLL_CENTER;
+  g_roll.chars  = 0xFFFFu;              // no typewriter: every line is shown
 }
 
 /**
- * @brief Start the end-credits sequence from the initial logo state.
- */
-void end_credits_start(void){
-  s_goto(ST_LOGO);
-}
-
-/**
- * @brief Advance the end-credits sequence by one frame.
+ * @brief Advance the roll so the last line leaves the top at the end of
+ *        the scene.
  *
- * This function is non-blocking; it renders or updates only as needed.
+ * Only rows entering at the bottom are written each tick.
  *
- * @return true when the end-credits sequence has fully finished and
- *         the caller may exit to another mode; false while credits
- *         are still ongoing.
+ * @param c Scene time; c->ms is the roll duration.
  */
-bool end_credits_tick(void){
-  uint32_t dt = millis() - g_t0;
-
-  switch(g_s){
-
-    case ST_LOGO: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        uint8_t x = (uint8_t)((128 - END_CREDITS_LOGO_W) / 2);
-        uint8_t y = (uint8_t)((128 - END_CREDITS_LOGO_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      END_CREDITS_LOGO_W, END_CREDITS_LOGO_H,
-                      END_CREDITS_LOGO_IDX,
-                      END_CREDITS_LOGO_PAL);
-      }
-      if (dt >= 5000u) s_goto(MEMBER_1);
-    } break;
+static void roll_tick(const scene_ctx_t *c){
+  uint32_t travel = 128u + (uint32_t)g_roll.count * g_roll.pitch;
+  uint32_t dt     = (c->dt > c->ms) ? c->ms : c->dt;
+  gfx_scroll_to(&g_roll, (uint16_t)(dt * travel / c->ms));
+}
 
-    case MEMBER_1: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("SYMAEDCHIT LEO", COL_RED);
-        gfx_text2(6, 40, "as: Lead Programmer", COL_WHITE, 1);
-      }
-      if (dt >= 2000u) s_goto(MEMBER_2);
-    } break;
+static void logo_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  uint8_t x = (uint8_t)((128 - END_CREDITS_LOGO_W) / 2);
+  uint8_t y = (uint8_t)((128 - END_CREDITS_LOGO_H) / 2);
 
-    case MEMBER_2: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("ERVIN ALIAJ", COL_BLUE);
-        gfx_text2(6, 40, "as: PCB Designer", COL_WHITE, 1);
-      }
-      if (dt >= 2000u) s_goto(MEMBER_3);
-    } break;
+  gfx_blit_image(x, y, &END_CREDITS_LOGO_IMG);
+}
 
-    case MEMBER_3: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("ANDREW PEREZ", COL_GREEN);
-        gfx_text2(6, 40, "as: Power Designer", COL_WHITE, 1);
-      }
-      if (dt >= 2000u) s_goto(MEMBER_4);
-    } break;
+static void members_enter(const scene_ctx_t *c){
+  (void)c;
+  roll_begin(g_members_lines, g_members_colors,
+             (uint8_t)(sizeof(g_members_lines)/sizeof(g_members_lines[0])));
+}
 
-    case MEMBER_4: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("PRATIJIT PODDER", COL_PURPLE);
-        gfx_text2(6, 40, "as: Analog Filterings", COL_WHITE, 1);
-      }
-      if (dt >= 2000u) s_goto(ECS_TEAM);
-    } break;
+static void team_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("TEAM #12", COL_WHITE);
+  gfx_bar(0, 18, 128, 1, COL_DKGRAY);
 
-    case ECS_TEAM: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("TEAM #12", COL_WHITE);
-        gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+  uint8_t x = (uint8_t)((128 - TEAM_W) / 2);
+  uint8_t y = (uint8_t)((128 - TEAM_H) / 2);
 
-        uint8_t x = (uint8_t)((128 - TEAM_W) / 2);
-        uint8_t y = (uint8_t)((128 - TEAM_H) / 2);
+  gfx_blit_image(x, y, &TEAM_IMG);
 
-        gfx_blit_pal4(x, y,
-                      TEAM_W, TEAM_H,
-                      TEAM_IDX,
-                      TEAM_PAL);
-      }
-      gfx_text2(6, 20, "Leo", COL_RED, 1);
-      gfx_text2(35, 120, "Ervin", COL_BLUE, 1);
-      gfx_text2(55, 20, "Pratijit", COL_GREEN, 1);
-      gfx_text2(85, 120, "Andrew", COL_PURPLE, 1);
-      if (dt >=3000u) s_goto(SPONSOR);
-    } break;
+  gfx_text2(6, 20, "Leo", COL_RED, 1);
+  gfx_text2(35, 120, "Ervin", COL_BLUE, 1);
+  gfx_text2(55, 20, "Pratijit", COL_GREEN, 1);
+  gfx_text2(85, 120, "Andrew", COL_PURPLE, 1);
+}
 
-    case SPONSOR: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("GERASIMOS MADALVANOS", COL_RED);
-        gfx_text2(6, 40, "as: TI Sponsor", COL_WHITE, 1);
-      }
-      if (dt >= 3000u) s_goto(ECS_THANKS_TI);
-    } break;
+static void sponsor_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("GERASIMOS MADALVANOS", COL_RED);
+  gfx_text2(6, 40, "as: TI Sponsor", COL_WHITE, 1);
+}
 
-    case ECS_THANKS_TI: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("THANKS TO:", COL_WHITE);
-        gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+static void thanks_ti_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("THANKS TO:", COL_WHITE);
+  gfx_bar(0, 18, 128, 1, COL_DKGRAY);
 
-        uint8_t x = (uint8_t)((128 - TI_LOGO_W) / 2);
-        uint8_t y = (uint8_t)((128 - TI_LOGO_H) / 2);
+  uint8_t x = (uint8_t)((128 - TI_LOGO_W) / 2);
+  uint8_t y = (uint8_t)((128 - TI_LOGO_H) / 2);
 
-        gfx_blit_pal4(x, y,
-                      TI_LOGO_W, TI_LOGO_H,
-                      TI_LOGO_IDX,
-                      TI_LOGO_PAL);
-      }
-      if (dt >= 3000u) s_goto(FACILITATOR);
-    } break;
+  gfx_blit_image(x, y, &TI_LOGO_IMG);
+}
 
-    case FACILITATOR: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("JOYDEEP MITRA", COL_RED);
-        gfx_text2(6, 40, "as: the Facilitator", COL_WHITE, 1);
-      }
-      if (dt >= 3000u) s_goto(PROFRESSOR);
-    } break;
+static void faculty_enter(const scene_ctx_t *c){
+  (void)c;
+  roll_begin(g_faculty_lines, g_faculty_colors,
+             (uint8_t)(sizeof(g_faculty_lines)/sizeof(g_faculty_lines[0])));
+}
 
-    case PROFRESSOR: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("SUBIR BISWAS", COL_RED);
-        gfx_text2(6, 40, "as: the Profressor", COL_WHITE, 1);
-      }
-      if (dt >= 3000u) s_goto(ECS_THANKS_MSU);
-    } break;
+static void thanks_msu_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("THANKS TO:", COL_WHITE);
+  gfx_bar(0, 18, 128, 1, COL_DKGRAY);
 
-    case ECS_THANKS_MSU: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("THANKS TO:", COL_WHITE);
-        gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+  uint8_t x = (uint8_t)((128 - MSU_LOGO_W) / 2);
+  uint8_t y = (uint8_t)(((128 - MSU_LOGO_H) / 2) + 10);
 
-        uint8_t x = (uint8_t)((128 - MSU_LOGO_W) / 2);
-        uint8_t y = (uint8_t)(((128 - MSU_LOGO_H) / 2) + 10);
+  gfx_blit_image(x, y, &MSU_LOGO_IMG);
+}
 
-        gfx_blit_pal4(x, y,
-                      MSU_LOGO_W, MSU_LOGO_H,
-                      MSU_LOGO_IDX,
-                      MSU_LOGO_PAL);
-      }
-      if (dt >= 3000u){
-        s_goto(ECS_CHEEVOS);
-      }
-    } break;
+/** One achievements page per scene, from ECS_CHEEVOS on. */
+static void cheevos_enter(const scene_ctx_t *c){
+  gfx_clear(COL_BLACK);
+  cheevos_draw_panel_page((uint8_t)(c->id - ECS_CHEEVOS));
+}
 
-    case ECS_CHEEVOS: {
-      if (g_dirty) {
-        g_dirty = false;
-      }
+/**
+ * @brief The sequence. Every credits screen is a full scene whose time
+ *        starts once the old screen has faded to dark; the achievements
+ *        pages after the first just replace each other.
+ */
+static const scene_t k_scenes[ECS_SCENES] = {
+  //                      ms     next              flags       enter             tick       exit
+  [ST_LOGO]          = { 5000u, ECS_ROLL_MEMBERS, SCENE_FADE, logo_enter,       NULL,      NULL },
+  [ECS_ROLL_MEMBERS] = { 8000u, ECS_TEAM,         SCENE_FADE, members_enter,    roll_tick, NULL },
+  [ECS_TEAM]         = { 3000u, SPONSOR,          SCENE_FADE, team_enter,       NULL,      NULL },
+  [SPONSOR]          = { 3000u, ECS_THANKS_TI,    SCENE_FADE, sponsor_enter,    NULL,      NULL },
+  [ECS_THANKS_TI]    = { 3000u, ECS_ROLL_FACULTY, SCENE_FADE, thanks_ti_enter,  NULL,      NULL },
+  [ECS_ROLL_FACULTY] = { 6000u, ECS_THANKS_MSU,   SCENE_FADE, faculty_enter,    roll_tick, NULL },
+  [ECS_THANKS_MSU]   = { 3000u, ECS_CHEEVOS,      SCENE_FADE, thanks_msu_enter, NULL,      NULL },
+  [ECS_CHEEVOS]      = { 3000u, ECS_CHEEVOS_2,    SCENE_FADE, cheevos_enter,    NULL,      NULL },
+  [ECS_CHEEVOS_2]    = { 3000u, ECS_CHEEVOS_3,    0,          cheevos_enter,    NULL,      NULL },
+  [ECS_CHEEVOS_3]    = { 3000u, ECS_CHEEVOS_4,    0,          cheevos_enter,    NULL,      NULL },
+  [ECS_CHEEVOS_4]    = { 3000u, SCENE_END,        0,          cheevos_enter,    NULL,      NULL },
+};
 
-      // Decide which page we *want* to show based on dt
-      uint8_t page;
-      if (dt < 3000u) {
-        page = 0;
-      } else if (dt < 6000u) {
-        page = 1;
-      } else if (dt < 9000u) {
-        page = 2;
-      } else if (dt < 12000u) {
-        page = 3;
-      } else {
-        // After 20s total, reset tracker and finish credits
-        g_ecs_cheevo_page = 0xFF;
-        return true;
-      }
+/**
+ * @brief Start the end-credits sequence from the initial logo state.
+ */
+void end_credits_start(void){
+  scene_start(&g_run, k_scenes, ECS_SCENES, ST_LOGO, millis());
+}
 
-      // Only redraw when we *change* page or on first entry
-      if (page != g_ecs_cheevo_page) {
-        g_ecs_cheevo_page = page;
-        gfx_clear(COL_BLACK);
-        cheevos_draw_panel_page(page);
-      }
-    } break;
-  }
-  return false;
+/**
+ * @brief Advance the end-credits sequence by one frame.
+ *
+ * This function is non-blocking; it renders or updates only as needed.
+ *
+ * @return true when the end-credits sequence has fully finished and
+ *         the caller may exit to another mode; false while credits
+ *         are still ongoing.
+ */
+bool end_credits_tick(void){
+  return scene_tick(&g_run, millis());
 }
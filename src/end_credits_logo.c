@@ -6,297 +6,78 @@ const uint16_t END_CREDITS_LOGO_PAL[END_CREDITS_LOGO_PAL_SIZE] = {
     0x2295, 0x9D7B, 0xFD68, 0x9A82, 0xB63C, 0x74BA, 0x61A1, 0x4BB8, 
 };
 
-const uint8_t END_CREDITS_LOGO_IDX[(END_CREDITS_LOGO_W * END_CREDITS_LOGO_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x30, 0x00, 0x00, 0x33, 0x33, 0x33, 0x00, 0x00, 
-    0x00, 0x03, 0x33, 0x33, 0x00, 0x03, 0x33, 0x33, 0x30, 0x00, 0x00, 0x33, 0x30, 0x03, 0x33, 0x33, 
-    0x33, 0x33, 0x00, 0x00, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x70, 0x07, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x07, 0x11, 0x11, 0x11, 0x00, 0x71, 0x11, 0x11, 0x11, 0x70, 0x03, 0x11, 0x10, 0x71, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x71, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x18, 0x07, 0x11, 0x11, 0x11, 0x11, 0x80, 
-    0x31, 0x11, 0x11, 0x11, 0xD2, 0x71, 0x11, 0x11, 0x11, 0x18, 0x03, 0x11, 0x14, 0x71, 0x11, 0x11, 
-    0x11, 0x11, 0x82, 0x11, 0x11, 0x11, 0x11, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0xCC, 0x11, 0x1F, 0x07, 0x11, 0x1C, 0xC1, 0x11, 0xF0, 
-    0x31, 0x11, 0xCC, 0xCC, 0xF2, 0x71, 0x11, 0xCC, 0x11, 0x1D, 0x03, 0x11, 0x14, 0x0C, 0xC1, 0x11, 
-    0x1C, 0xCC, 0x80, 0x11, 0x1C, 0xC1, 0x11, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x42, 0x11, 0x1F, 0x27, 0x11, 0x94, 0x21, 0x11, 0xF2, 
-    0x31, 0x11, 0x42, 0x22, 0x22, 0x71, 0x19, 0x42, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x20, 0x11, 
-    0x14, 0x22, 0x20, 0x11, 0x14, 0x29, 0x11, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x98, 0x27, 0x11, 0x92, 0x01, 0x11, 0xF2, 
-    0x31, 0x11, 0x40, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x14, 0x03, 0x04, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x38, 0x42, 0x07, 0x11, 0x92, 0x01, 0x11, 0xF2, 
-    0x31, 0x11, 0x40, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x20, 0x07, 0x11, 0x92, 0x01, 0x11, 0xF2, 
-    0x31, 0x11, 0x40, 0x31, 0x30, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x14, 0x03, 0x71, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x00, 0x07, 0x11, 0x92, 0x01, 0x11, 0xF2, 
-    0x31, 0x11, 0x89, 0x11, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x10, 0x91, 0x11, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x00, 0x07, 0x11, 0x90, 0x11, 0x11, 0xF2, 
-    0x31, 0x11, 0x11, 0x11, 0xD2, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0x11, 0x02, 
-    0x31, 0x11, 0x11, 0x11, 0x02, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0x98, 0x42, 
-    0x31, 0x11, 0x11, 0xF4, 0x42, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0xD2, 0x20, 
-    0x31, 0x11, 0xD4, 0x22, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x1D, 0x49, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x00, 0x00, 0x07, 0x11, 0x1C, 0x11, 0x12, 0x00, 
-    0x31, 0x11, 0x42, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x1D, 0x44, 0x27, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x03, 0x13, 0x07, 0x11, 0xD8, 0x11, 0x10, 0x00, 
-    0x31, 0x11, 0x40, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x00, 0x02, 0x20, 0x07, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x01, 0x10, 0x07, 0x11, 0x92, 0x11, 0x1C, 0x20, 
-    0x31, 0x11, 0x40, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x00, 0x07, 0x10, 0x07, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x27, 0x11, 0x92, 0x31, 0x11, 0x80, 
-    0x31, 0x11, 0x40, 0x00, 0x00, 0x71, 0x19, 0x20, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x14, 0x07, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x80, 0x11, 0x1F, 0x27, 0x11, 0x92, 0x01, 0x11, 0xC2, 
-    0x31, 0x11, 0x80, 0x00, 0x00, 0x71, 0x19, 0x80, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x18, 0x27, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0E, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xE0, 0x00, 0xEE, 0xE0, 0x00, 0x71, 0x11, 0x11, 0x11, 0x1F, 0x27, 0x11, 0x92, 0x03, 0x11, 0x14, 
-    0x01, 0x11, 0x11, 0x11, 0x00, 0x71, 0x11, 0x11, 0x11, 0x1F, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x06, 0x66, 0x60, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA6, 0x66, 
-    0x6B, 0x0B, 0x66, 0x6B, 0x00, 0x31, 0x11, 0x11, 0x11, 0x18, 0x29, 0x11, 0x92, 0x00, 0x11, 0x19, 
-    0x01, 0x11, 0x11, 0x11, 0xD2, 0x71, 0x11, 0x11, 0x11, 0x18, 0x23, 0x11, 0x14, 0x00, 0x03, 0x11, 
-    0x14, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x03, 0x11, 0x11, 0x1C, 0x84, 0x07, 0x11, 0xD2, 0x00, 0x31, 0x1C, 
-    0xD1, 0x11, 0x11, 0x11, 0xF2, 0x71, 0x11, 0x11, 0x1C, 0x84, 0x03, 0x11, 0xC4, 0x00, 0x03, 0x11, 
-    0xC4, 0x00, 0x00, 0x09, 0x11, 0x11, 0x1F, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x5A, 0xAA, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x02, 0x44, 0x44, 0x22, 0x00, 0x02, 0x42, 0x00, 0x00, 0x24, 
-    0x42, 0x24, 0x44, 0x44, 0x42, 0x00, 0x24, 0x44, 0x44, 0x22, 0x00, 0x02, 0x42, 0x00, 0x00, 0x02, 
-    0x42, 0x00, 0x00, 0x00, 0x24, 0x44, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA6, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0xA6, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0xA6, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xB6, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0E, 0xEB, 0xE0, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x0E, 0xBB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x66, 0xB0, 0xB0, 0x00, 0x1A, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x6B, 0x0B, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 
-    0x00, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x03, 0x33, 0x33, 0x30, 
-    0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x03, 0x33, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x5A, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xA6, 0x66, 
-    0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 0x11, 0x11, 0x11, 0x13, 0x00, 0x31, 0x11, 0x11, 0x11, 
-    0x70, 0x07, 0x11, 0xC0, 0x01, 0x11, 0x00, 0x31, 0x11, 0x20, 0x71, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x56, 0x66, 
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0xD2, 0x11, 0x11, 0x11, 0x11, 0x12, 0x07, 0x11, 0x11, 0x11, 0x11, 0x20, 0x31, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x80, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x66, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0xD2, 0x11, 0x11, 0x11, 0x11, 0x18, 0x07, 0x11, 0x11, 0x11, 0x11, 0xF0, 0x31, 0x11, 0x11, 0x11, 
-    0x19, 0x27, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x80, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x66, 0x66, 0xB0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x11, 0x18, 0x22, 
-    0x22, 0x11, 0x10, 0x20, 0x11, 0x18, 0x07, 0x11, 0xD4, 0x41, 0x11, 0xF2, 0x31, 0x1C, 0x42, 0xC1, 
-    0x1D, 0x27, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x80, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x6B, 0xE0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x1F, 0x23, 0x11, 0x18, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0xC1, 
-    0x1D, 0x27, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x80, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x1F, 0x23, 0x11, 0x18, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x71, 
-    0x1D, 0x27, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x80, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x66, 0x66, 0x66, 0x66, 0x6B, 0xE0, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x1F, 0x23, 0x11, 0x18, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x71, 
-    0x1D, 0x27, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x40, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x66, 0x66, 0x66, 0x66, 0x6E, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x10, 0x23, 0x11, 0x18, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x71, 
-    0x1D, 0x27, 0x11, 0xC4, 0x71, 0x11, 0xD2, 0x31, 0x11, 0x87, 0x11, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x66, 0xB0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x1F, 0x01, 0x11, 0x18, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x11, 
-    0x1D, 0x27, 0x11, 0x11, 0x11, 0x11, 0xD2, 0x31, 0x11, 0x11, 0x11, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x66, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x18, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x11, 0x11, 0x11, 
-    0x19, 0x27, 0x11, 0x11, 0x11, 0x11, 0xD2, 0x31, 0x11, 0x11, 0x11, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x11, 0x11, 0x19, 0x84, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x11, 0x11, 0x11, 
-    0x98, 0x20, 0x11, 0x11, 0x11, 0x11, 0xD2, 0x31, 0x11, 0x11, 0x11, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x11, 0x11, 0x18, 0x22, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x11, 0x11, 0x98, 
-    0x42, 0x00, 0x11, 0x1D, 0x41, 0x11, 0xD2, 0x31, 0x11, 0xD4, 0x91, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x20, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x19, 0x11, 0x19, 0x20, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x11, 0x98, 0x42, 
-    0x20, 0x03, 0x11, 0xC4, 0x21, 0x11, 0xD2, 0x31, 0xD8, 0x42, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x18, 0x01, 0x11, 0x40, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x11, 0x42, 0x20, 
-    0x00, 0x03, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x00, 0x22, 0x20, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x28, 0x88, 0x01, 0x11, 0x08, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x18, 0x21, 0x11, 0xD0, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x00, 
-    0x00, 0x03, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x00, 0x02, 0x00, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x21, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x1F, 0x27, 0x11, 0x12, 0x07, 0x11, 0xD2, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x00, 
-    0x00, 0x03, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x00, 0x71, 0x00, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x1F, 0x20, 0x11, 0x1F, 0x07, 0x11, 0x94, 0x01, 0x11, 0xF2, 0x01, 0x1C, 0x40, 0x00, 
-    0x00, 0x03, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x01, 0x11, 0x82, 0x71, 0x1C, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x10, 0x20, 0x71, 0x11, 0x27, 0x11, 0x11, 0x11, 0x11, 0x82, 0x01, 0x1C, 0x40, 0x00, 
-    0x00, 0x03, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x31, 0x11, 0x11, 0x11, 0x19, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x10, 0x20, 0x31, 0x11, 0x83, 0x11, 0x11, 0x11, 0x11, 0x82, 0x01, 0x11, 0x40, 0x00, 
-    0x00, 0x07, 0x11, 0xC4, 0x01, 0x11, 0xD2, 0x01, 0x11, 0x11, 0x11, 0x1F, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xE0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x07, 0x99, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x18, 0x20, 
-    0x00, 0x11, 0x10, 0x20, 0x07, 0x11, 0x92, 0x31, 0x11, 0x11, 0xC8, 0x40, 0x31, 0x19, 0x40, 0x00, 
-    0x00, 0x03, 0x11, 0x94, 0x07, 0x11, 0xD2, 0x00, 0x91, 0x11, 0x11, 0xD4, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 
-    0x00, 0x02, 0x44, 0x20, 0x00, 0x24, 0x44, 0x00, 0x44, 0x44, 0x42, 0x20, 0x00, 0x24, 0x20, 0x00, 
-    0x00, 0x00, 0x02, 0x42, 0x00, 0x24, 0x42, 0x00, 0x02, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0xA5, 0x55, 0x6E, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x5A, 0xAA, 0x6B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA5, 0xAA, 0xAA, 0x6E, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xBB, 0xB5, 0x66, 0x66, 0x66, 0x6B, 0xBB, 0xE0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x66, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x66, 0xB0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t END_CREDITS_LOGO_RLE[END_CREDITS_LOGO_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x8B, 0xB3, 0xB0, 0xC3, 0xD0, 0xB3, 0x02, 0x00, 0x00, 
+    0xC3, 0xB0, 0x04, 0x33, 0x30, 0x00, 0xF3, 0x00, 0xA0, 0xB3, 0xF0, 0x35, 0xD1, 0x03, 0x70, 0x07, 
+    0xD1, 0xA0, 0x00, 0x70, 0xC1, 0x02, 0x00, 0x70, 0xD1, 0x08, 0x70, 0x03, 0x11, 0x10, 0x70, 0xF1, 
+    0x00, 0x02, 0x00, 0x70, 0xD1, 0xF0, 0x33, 0x00, 0x30, 0xE1, 0x00, 0x80, 0x47, 0x03, 0x18, 0x03, 
+    0xD1, 0x01, 0xD2, 0x46, 0x01, 0x18, 0x43, 0x00, 0x40, 0x48, 0x01, 0x82, 0xE1, 0x00, 0xD0, 0xF0, 
+    0x32, 0x09, 0x71, 0x11, 0xCC, 0x11, 0x1F, 0x43, 0x05, 0xCC, 0x11, 0x1F, 0x43, 0xAC, 0x00, 0xF0, 
+    0x43, 0x05, 0xCC, 0x11, 0x1D, 0x44, 0x02, 0x0C, 0xC0, 0xA1, 0x0E, 0xCC, 0xC8, 0x01, 0x11, 0xCC, 
+    0x11, 0x1C, 0x20, 0x7B, 0x02, 0x94, 0x20, 0x42, 0x06, 0x27, 0x11, 0x94, 0x20, 0x42, 0x00, 0x20, 
+    0x42, 0x00, 0x40, 0xB2, 0x0A, 0x71, 0x19, 0x42, 0x11, 0x1F, 0x20, 0x44, 0x09, 0x02, 0x01, 0x11, 
+    0x42, 0x22, 0x42, 0x06, 0x42, 0x91, 0x1F, 0x40, 0x7C, 0x05, 0x20, 0x11, 0x98, 0x43, 0x01, 0x20, 
+    0x48, 0xB0, 0x42, 0x01, 0x20, 0x4A, 0x01, 0x03, 0x42, 0x03, 0x00, 0x03, 0x42, 0x05, 0x03, 0x04, 
+    0x22, 0x7E, 0x04, 0x38, 0x42, 0x00, 0x73, 0x00, 0x20, 0xF0, 0x36, 0x44, 0x03, 0x00, 0x20, 0x50, 
+    0x02, 0x31, 0x30, 0x5F, 0x04, 0x03, 0x71, 0x90, 0x7F, 0xB0, 0x4D, 0x04, 0x89, 0x11, 0x00, 0x5E, 
+    0x06, 0x09, 0x11, 0x19, 0x20, 0x7F, 0x46, 0x00, 0x00, 0xA1, 0x44, 0xA1, 0x01, 0xD2, 0x5D, 0xB1, 
+    0x01, 0x94, 0x7F, 0x45, 0xC1, 0x00, 0x00, 0x47, 0x00, 0x00, 0x7F, 0x70, 0x02, 0x98, 0x40, 0x45, 
+    0x02, 0xF4, 0x40, 0x7F, 0x70, 0x03, 0xD2, 0x20, 0x42, 0x05, 0xD4, 0x22, 0x00, 0x5D, 0x02, 0xD4, 
+    0x90, 0x7F, 0x4A, 0x05, 0xC1, 0x11, 0x20, 0x43, 0x01, 0x42, 0xA0, 0x5B, 0x04, 0xD4, 0x42, 0x70, 
+    0x7F, 0x42, 0x02, 0x31, 0x30, 0x42, 0x05, 0xD8, 0x11, 0x10, 0x45, 0xB0, 0x59, 0x05, 0x00, 0x22, 
+    0x00, 0x7F, 0x43, 0x02, 0x11, 0x00, 0x42, 0x06, 0x92, 0x11, 0x1C, 0x20, 0x66, 0x01, 0x71, 0x7F, 
+    0x44, 0x04, 0x11, 0x1F, 0x20, 0x43, 0x04, 0x31, 0x11, 0x80, 0x64, 0x04, 0x31, 0x11, 0x40, 0x7F, 
+    0x03, 0x11, 0x98, 0x49, 0x05, 0x01, 0x11, 0xC2, 0x42, 0x00, 0x80, 0x47, 0x00, 0x80, 0x58, 0x01, 
+    0x82, 0x5A, 0xAE, 0xF0, 0x02, 0xFE, 0x02, 0x05, 0x00, 0x0E, 0xEE, 0x44, 0xC1, 0x46, 0x05, 0x31, 
+    0x11, 0x40, 0xD1, 0x43, 0xC1, 0x54, 0xB1, 0x57, 0xA6, 0x01, 0x0B, 0xF0, 0x00, 0xDA, 0xA6, 0x09, 
+    0xB0, 0xB6, 0x66, 0xB0, 0x03, 0xE1, 0x02, 0x82, 0x90, 0x43, 0x04, 0x01, 0x11, 0x90, 0x46, 0x01, 
+    0xD2, 0x47, 0x00, 0x80, 0x4F, 0x00, 0x00, 0xE1, 0x01, 0x02, 0xF0, 0x0D, 0x01, 0xE6, 0xA0, 0x42, 
+    0x01, 0x1A, 0xF5, 0x02, 0x44, 0x08, 0x00, 0x0B, 0xB0, 0x00, 0x30, 0xB1, 0x0F, 0xC8, 0x40, 0x71, 
+    0x1D, 0x20, 0x03, 0x11, 0xCD, 0xD1, 0x00, 0xF0, 0x46, 0x07, 0xC8, 0x40, 0x31, 0x1C, 0x45, 0x00, 
+    0xC0, 0x43, 0x01, 0x09, 0xB1, 0x01, 0xF4, 0x62, 0x02, 0xAA, 0xA0, 0x53, 0x02, 0x00, 0x20, 0xA4, 
+    0x07, 0x22, 0x00, 0x02, 0x42, 0xA0, 0x04, 0x24, 0x42, 0x20, 0xC4, 0x03, 0x20, 0x02, 0xB4, 0x07, 
+    0x22, 0x00, 0x02, 0x42, 0xB0, 0x02, 0x24, 0x20, 0xC0, 0x00, 0x20, 0xA4, 0x01, 0x22, 0xF0, 0x0E, 
+    0x4B, 0xF5, 0x00, 0x00, 0xA0, 0x4E, 0xF0, 0x50, 0x4B, 0x00, 0xA0, 0xF5, 0x00, 0x7F, 0x7F, 0x7F, 
+    0x7A, 0x00, 0xA0, 0x7F, 0x7F, 0x7F, 0xF0, 0x1D, 0x00, 0xB0, 0x53, 0x00, 0x50, 0x7F, 0xF0, 0x20, 
+    0x03, 0xEE, 0xBE, 0x56, 0x03, 0xEB, 0xBE, 0xF0, 0x58, 0x02, 0x66, 0xB0, 0x56, 0x02, 0xB6, 0x60, 
+    0xF0, 0x08, 0xF3, 0x00, 0x01, 0x00, 0xD3, 0xD0, 0xA3, 0xB0, 0xC3, 0xB0, 0x01, 0x33, 0xA0, 0x0C, 
+    0x33, 0x00, 0x03, 0x33, 0x00, 0x03, 0x30, 0xF0, 0x0C, 0x05, 0xB0, 0x5A, 0xAA, 0xF5, 0x00, 0x01, 
+    0xAA, 0x44, 0xF0, 0x0B, 0xF1, 0x00, 0x01, 0x00, 0xE1, 0x03, 0x20, 0x00, 0xD1, 0x03, 0x30, 0x03, 
+    0xD1, 0x17, 0x70, 0x07, 0x11, 0xC0, 0x01, 0x11, 0x00, 0x31, 0x11, 0x20, 0x71, 0x1C, 0xF0, 0x0B, 
+    0x03, 0xEB, 0x5A, 0xF5, 0x01, 0x07, 0xA5, 0x56, 0x66, 0xBE, 0x5C, 0x01, 0xD2, 0xF1, 0x00, 0x02, 
+    0x20, 0x70, 0xE1, 0x00, 0x20, 0x47, 0x07, 0x10, 0x00, 0x11, 0xC4, 0x42, 0x01, 0xD2, 0x42, 0x00, 
+    0x80, 0x43, 0x00, 0x40, 0xF0, 0x0C, 0x4C, 0xA6, 0xF0, 0x0E, 0x52, 0x00, 0x80, 0x48, 0x00, 0xF0, 
+    0x48, 0x02, 0x92, 0x70, 0x68, 0xFA, 0x03, 0xA6, 0x00, 0xB0, 0xF0, 0x10, 0x05, 0x24, 0x11, 0x18, 
+    0xA2, 0x05, 0x11, 0x10, 0x20, 0x46, 0x02, 0xD4, 0x40, 0x42, 0x0A, 0x23, 0x11, 0xC4, 0x2C, 0x11, 
+    0xD0, 0x6A, 0x00, 0x00, 0xF5, 0x02, 0x04, 0x66, 0x6B, 0xE0, 0xF0, 0x12, 0x43, 0x08, 0x00, 0x01, 
+    0x11, 0xF2, 0x30, 0x47, 0x01, 0x20, 0x43, 0x00, 0x00, 0x42, 0x00, 0x00, 0x6F, 0x00, 0xE0, 0xF6, 
+    0x04, 0xF0, 0x01, 0x02, 0x33, 0x30, 0x72, 0x00, 0x70, 0x6E, 0x01, 0x0E, 0xF6, 0x01, 0x01, 0xBE, 
+    0xF0, 0x01, 0x03, 0x11, 0x12, 0x7F, 0x44, 0x00, 0x40, 0x5B, 0x01, 0x0B, 0xF6, 0x00, 0x00, 0xE0, 
+    0xF0, 0x02, 0x04, 0x11, 0x18, 0x20, 0x57, 0x00, 0x00, 0x60, 0x00, 0x70, 0x47, 0x02, 0x87, 0x10, 
+    0x5A, 0xA0, 0x03, 0xE6, 0x6B, 0xF0, 0x05, 0x5C, 0x01, 0xF0, 0xA1, 0x51, 0x00, 0x10, 0x45, 0xC1, 
+    0x44, 0xB1, 0x5F, 0x00, 0xE0, 0x6A, 0xC1, 0x4E, 0xC1, 0x00, 0x90, 0x71, 0x01, 0x0A, 0x70, 0x02, 
+    0x98, 0x40, 0x52, 0x03, 0x98, 0x20, 0x7B, 0x00, 0x70, 0xF1, 0x04, 0x00, 0x70, 0x57, 0x02, 0x82, 
+    0x20, 0x50, 0x04, 0x98, 0x42, 0x00, 0x42, 0x01, 0xD4, 0x47, 0x02, 0xD4, 0x90, 0x78, 0x01, 0x92, 
+    0x52, 0x06, 0x91, 0x11, 0x92, 0x00, 0x4E, 0x0C, 0x98, 0x42, 0x20, 0x03, 0x11, 0xC4, 0x20, 0x45, 
+    0x04, 0xD8, 0x42, 0x70, 0x79, 0x00, 0x40, 0x52, 0x05, 0x80, 0x11, 0x14, 0x4F, 0x02, 0x42, 0x20, 
+    0xA0, 0x43, 0x00, 0x00, 0x43, 0x05, 0x00, 0x22, 0x20, 0x6B, 0x09, 0x02, 0x88, 0x80, 0x11, 0x10, 
+    0xB8, 0x54, 0x04, 0x21, 0x11, 0xD0, 0x4E, 0x01, 0xC4, 0xC0, 0x4B, 0x02, 0x02, 0x00, 0x6D, 0xA0, 
+    0x05, 0x21, 0x11, 0x82, 0xF0, 0x05, 0x49, 0x06, 0xF2, 0x71, 0x11, 0x20, 0x62, 0x01, 0x71, 0x72, 
+    0x00, 0x00, 0x5E, 0x04, 0x01, 0x11, 0xF0, 0x42, 0x01, 0x94, 0x5B, 0x04, 0x11, 0x18, 0x20, 0x7F, 
+    0x4E, 0x08, 0x02, 0x07, 0x11, 0x12, 0x70, 0xE1, 0x00, 0x80, 0x55, 0x00, 0x30, 0xE1, 0x00, 0x90, 
+    0x7F, 0x4D, 0x05, 0x31, 0x11, 0x83, 0x4B, 0x00, 0x10, 0x45, 0x00, 0x70, 0x48, 0x00, 0x00, 0xE1, 
+    0x00, 0xF0, 0x6D, 0x02, 0x79, 0x90, 0x5C, 0x06, 0x07, 0x11, 0x92, 0x30, 0xB1, 0x07, 0xC8, 0x40, 
+    0x31, 0x19, 0x45, 0x06, 0x31, 0x19, 0x40, 0x70, 0x43, 0x01, 0x09, 0xB1, 0x02, 0xD4, 0x20, 0x5D, 
+    0xF0, 0x08, 0x01, 0x22, 0x4D, 0x03, 0x02, 0x44, 0x42, 0x0D, 0x02, 0x44, 0x20, 0x00, 0x24, 0x44, 
+    0x00, 0xB4, 0x07, 0x22, 0x00, 0x02, 0x42, 0xE0, 0x0C, 0x24, 0x20, 0x02, 0x44, 0x20, 0x00, 0x20, 
+    0xB4, 0x00, 0x20, 0xF0, 0x12, 0x08, 0x55, 0x5A, 0x55, 0x56, 0xE0, 0xF0, 0x6E, 0x08, 0xAA, 0xA5, 
+    0xAA, 0xA6, 0xB0, 0xF0, 0x6E, 0x02, 0xAA, 0x50, 0xAA, 0x01, 0x6E, 0xF0, 0x6A, 0x04, 0xEB, 0xBB, 
+    0x50, 0xD6, 0x03, 0xBB, 0xBE, 0xF0, 0x67, 0x02, 0xE6, 0x60, 0xFB, 0x01, 0x02, 0x66, 0xB0, 0xF0, 
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x30, 
+};
+
+const gfx_image_t END_CREDITS_LOGO_IMG = {
+    .w = END_CREDITS_LOGO_W, .h = END_CREDITS_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = END_CREDITS_LOGO_PAL, .colors = END_CREDITS_LOGO_PAL_SIZE,
+    .data = END_CREDITS_LOGO_RLE, .size = END_CREDITS_LOGO_RLE_SIZE,
 };
@@ -6,30 +6,27 @@ const uint16_t ENEMY_ICON_PAL[ENEMY_ICON_PAL_SIZE] = {
     0x8A07, 0xFFFF, 0x5040, 0x7081, 0x6840, 0x90A1, 0x3020, 0xEF5C, 
 };
 
-const uint8_t ENEMY_ICON_IDX[(ENEMY_ICON_W * ENEMY_ICON_H) / 2] = {
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x93, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x30, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x91, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1B, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x94, 0x09, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x1C, 0x79, 0x99, 0x95, 0xF9, 0x99, 0x98, 0xBF, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x1C, 0x49, 0x99, 0x90, 0x19, 0x99, 0x3B, 0x0F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1C, 0x2F, 
-    0x99, 0x3A, 0x49, 0x99, 0x1C, 0x0F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1C, 0xC1, 0x9F, 0x4C, 0x03, 
-    0xF9, 0x22, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1C, 0xD2, 0x40, 0xBB, 0xC0, 0x61, 0x2C, 0x09, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x3B, 0xDC, 0xCC, 0xCB, 0xCA, 0xAA, 0xDC, 0x69, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x90, 0x2D, 0xDB, 0xCB, 0xCC, 0xCC, 0xDA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF1, 
-    0xCD, 0xDD, 0xBD, 0xDB, 0xAB, 0xC0, 0xF3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x16, 0xBD, 0xD2, 0xDD, 
-    0xDC, 0xAB, 0xA0, 0x67, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAD, 0xD2, 0x2D, 0xDD, 0x2C, 0xAA, 
-    0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xEB, 0xD2, 0x2D, 0x22, 0x2B, 0xE0, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x1B, 0xEA, 0xED, 0x2C, 0x2D, 0xAE, 0xEA, 0x05, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x1B, 0xAB, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x43, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xA2, 0xDB, 
-    0xCD, 0xAA, 0xBD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF0, 0xEA, 0xBA, 0xD2, 0xBA, 0xCA, 
-    0xEA, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF1, 0x0E, 0xAB, 0xBB, 0xAC, 0xAE, 0xE1, 0x1F, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x4E, 0xAE, 0xAA, 0xAA, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x4E, 0xBE, 0xEA, 0xEE, 0xAE, 0xA3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 
-    0xA0, 0xAA, 0xAA, 0xA0, 0x15, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0xAC, 0xBB, 0xBC, 
-    0xA3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x00, 0xAB, 0xA0, 0xA3, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x59, 0x1A, 0x49, 0x57, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
+const uint8_t ENEMY_ICON_RLE[ENEMY_ICON_RLE_SIZE] = {
+    0xF9, 0x18, 0x00, 0x30, 0xF9, 0x02, 0x01, 0x3F, 0xF9, 0x03, 0x00, 0x40, 0xF9, 0x02, 0x01, 0x11, 
+    0xF9, 0x02, 0x01, 0x30, 0x4A, 0x00, 0x40, 0xF9, 0x02, 0x02, 0x1B, 0xF0, 0xF9, 0x01, 0x01, 0x40, 
+    0x4A, 0x01, 0xC7, 0xA9, 0x01, 0x5F, 0xA9, 0x02, 0x8B, 0xF0, 0x4A, 0x00, 0x40, 0xA9, 0x07, 0x01, 
+    0x99, 0x93, 0xB0, 0x4B, 0x0B, 0x2F, 0x99, 0x3A, 0x49, 0x99, 0x1C, 0x4C, 0x0C, 0xC1, 0x9F, 0x4C, 
+    0x03, 0xF9, 0x22, 0x00, 0xF9, 0x02, 0x0D, 0x1C, 0xD2, 0x40, 0xBB, 0xC0, 0x61, 0x2C, 0x4A, 0x02, 
+    0x3B, 0xD0, 0xAC, 0x07, 0xBC, 0xAA, 0xAD, 0xC6, 0xF9, 0x03, 0x06, 0x02, 0xDD, 0xBC, 0xB0, 0xAC, 
+    0x02, 0xDA, 0x10, 0xF9, 0x02, 0x0F, 0xF1, 0xCD, 0xDD, 0xBD, 0xDB, 0xAB, 0xC0, 0xF3, 0xF9, 0x01, 
+    0x0F, 0x16, 0xBD, 0xD2, 0xDD, 0xDC, 0xAB, 0xA0, 0x67, 0xF9, 0x02, 0x0D, 0x0A, 0xDD, 0x22, 0xDD, 
+    0xD2, 0xCA, 0xA5, 0xF9, 0x03, 0x02, 0x1E, 0xB0, 0x42, 0x05, 0x22, 0x2B, 0xE0, 0xF9, 0x03, 0x0F, 
+    0x1B, 0xEA, 0xED, 0x2C, 0x2D, 0xAE, 0xEA, 0x05, 0x4A, 0x02, 0xAB, 0xE0, 0xFA, 0x00, 0x01, 0x43, 
+    0xF9, 0x02, 0x0C, 0x1A, 0x2D, 0xBC, 0xDA, 0xAB, 0xDA, 0x00, 0xF9, 0x03, 0x0E, 0xF0, 0xEA, 0xBA, 
+    0xD2, 0xBA, 0xCA, 0xEA, 0x40, 0x4A, 0x0E, 0x10, 0xEA, 0xBB, 0xBA, 0xCA, 0xEE, 0x11, 0xF0, 0xF9, 
+    0x03, 0x03, 0x4E, 0xAE, 0xAA, 0x02, 0xEA, 0x00, 0xF9, 0x06, 0x0B, 0x4E, 0xBE, 0xEA, 0xEE, 0xAE, 
+    0xA3, 0xF9, 0x05, 0x03, 0x10, 0xA0, 0xBA, 0x02, 0x01, 0x50, 0xF9, 0x06, 0x08, 0x3A, 0xCB, 0xBB, 
+    0xCA, 0x30, 0xF9, 0x08, 0x06, 0x30, 0x0A, 0xBA, 0x00, 0x52, 0x07, 0x59, 0x1A, 0x49, 0x57, 0xF9, 
+    0x0C, 0x01, 0x43, 0xF9, 0x36, 
+};
+
+const gfx_image_t ENEMY_ICON_IMG = {
+    .w = ENEMY_ICON_W, .h = ENEMY_ICON_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = ENEMY_ICON_PAL, .colors = ENEMY_ICON_PAL_SIZE,
+    .data = ENEMY_ICON_RLE, .size = ENEMY_ICON_RLE_SIZE,
 };
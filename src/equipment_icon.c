@@ -6,33 +6,31 @@ const uint16_t EQUIPMENT_ICON_PAL[EQUIPMENT_ICON_PAL_SIZE] = {
     0xF4B2, 0xAB0C, 0x7C30, 0xBE18, 0xFFFF, 0x2124, 0x4A49, 0xB5B6, 
 };
 
-const uint8_t EQUIPMENT_ICON_IDX[(EQUIPMENT_ICON_W * EQUIPMENT_ICON_H) / 2] = {
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC8, 0x77, 0x77, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0x19, 0x64, 0x44, 0x66, 0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xC2, 0x55, 0x55, 0x55, 0x46, 0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0x03, 0x54, 0x66, 0x45, 0x47, 0x81, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x00, 
-    0xE5, 0x46, 0x85, 0x46, 0x81, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xCC, 0x13, 
-    0x47, 0x65, 0x66, 0x8C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x12, 0xED, 0xF1, 0x1C, 0x15, 0x46, 
-    0x47, 0x71, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFE, 0x33, 0xE2, 0x11, 0x1C, 0x54, 0x74, 0x68, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0xEE, 0x00, 0x2F, 0xF1, 0xC9, 0x74, 0x44, 0x68, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x3E, 0x00, 0x02, 0x22, 0xF1, 0x16, 0x56, 0x86, 0x8C, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCF, 0x3E, 0x00, 0x22, 0x21, 0x11, 0x1C, 0x95, 0x67, 0x81, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0x2D, 0xDD, 0x30, 0x02, 0x20, 0x0D, 0xF2, 0x56, 0x71, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 
-    0xD0, 0x3D, 0x33, 0x03, 0xE0, 0x2B, 0xD5, 0x44, 0x8C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x03, 0xD3, 
-    0x3E, 0x00, 0x00, 0x2F, 0x20, 0x34, 0x68, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x3D, 0xD3, 0x00, 
-    0x00, 0x22, 0x22, 0x85, 0x36, 0x68, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x13, 0x33, 0xDD, 0xDE, 0xE0, 
-    0x00, 0x00, 0x45, 0x54, 0x6C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xE3, 0x3D, 0xDD, 0x0E, 0x00, 0x21, 
-    0xE4, 0x45, 0x78, 0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x33, 0xDD, 0xD0, 0xE0, 0x2F, 0x21, 0x53, 
-    0x44, 0x78, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xF3, 0xD3, 0x3D, 0x0E, 0xFF, 0x02, 0xC1, 0xA5, 0x44, 
-    0x7C, 0xCC, 0xCC, 0xCC, 0xC2, 0xDD, 0x33, 0xD0, 0x00, 0xF2, 0xE0, 0xF1, 0x1C, 0x25, 0x76, 0x1C, 
-    0xCC, 0xCC, 0xC2, 0x33, 0xD3, 0xD3, 0x3E, 0x20, 0x30, 0x1C, 0x1F, 0xFC, 0x17, 0x71, 0xCC, 0xCC, 
-    0xCC, 0x1D, 0xD3, 0xEE, 0x33, 0x3D, 0xD0, 0xF1, 0x1F, 0x21, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0x2D, 0xD3, 0x00, 0x00, 0x02, 0xF1, 0x12, 0xF2, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC1, 0xEE, 
-    0xD3, 0x02, 0x22, 0xF1, 0x1F, 0x20, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC1, 0x3E, 0xD3, 
-    0x02, 0xF1, 0xF2, 0x22, 0x2C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC1, 0x3E, 0x33, 0x32, 
-    0x00, 0x22, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC1, 0x2E, 0xE3, 0xE2, 0x21, 
-    0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x10, 0x02, 0x11, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC1, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 
+const uint8_t EQUIPMENT_ICON_RLE[EQUIPMENT_ICON_RLE_SIZE] = {
+    0xFC, 0x09, 0x00, 0x10, 0xFC, 0x0F, 0x00, 0x80, 0xA7, 0x00, 0x10, 0xFC, 0x0C, 0x09, 0x19, 0x64, 
+    0x44, 0x66, 0x78, 0xFC, 0x0A, 0x00, 0x20, 0xC5, 0x03, 0x46, 0x78, 0xFC, 0x09, 0x0B, 0x03, 0x54, 
+    0x66, 0x45, 0x47, 0x81, 0xFC, 0x08, 0x0C, 0x20, 0x0E, 0x54, 0x68, 0x54, 0x68, 0x10, 0xFC, 0x07, 
+    0x0C, 0xFF, 0xCC, 0x13, 0x47, 0x65, 0x66, 0x80, 0xFC, 0x04, 0x0F, 0x12, 0xED, 0xF1, 0x1C, 0x15, 
+    0x46, 0x47, 0x71, 0xFC, 0x03, 0x0F, 0xFE, 0x33, 0xE2, 0x11, 0x1C, 0x54, 0x74, 0x68, 0xFC, 0x03, 
+    0x11, 0x10, 0xEE, 0x00, 0x2F, 0xF1, 0xC9, 0x74, 0x44, 0x68, 0xFC, 0x02, 0x0F, 0x03, 0xE0, 0x00, 
+    0x22, 0x2F, 0x11, 0x65, 0x68, 0x4A, 0x07, 0xF3, 0xE0, 0x02, 0x22, 0xA1, 0x06, 0xC9, 0x56, 0x78, 
+    0x10, 0xFC, 0x01, 0x11, 0x2D, 0xDD, 0x30, 0x02, 0x20, 0x0D, 0xF2, 0x56, 0x71, 0xFC, 0x02, 0x11, 
+    0x2D, 0x03, 0xD3, 0x30, 0x3E, 0x02, 0xBD, 0x54, 0x48, 0xFC, 0x02, 0x05, 0x03, 0xD3, 0x3E, 0xA0, 
+    0x06, 0x2F, 0x20, 0x34, 0x60, 0x4A, 0x04, 0x23, 0xDD, 0x30, 0xA0, 0xA2, 0x05, 0x85, 0x36, 0x68, 
+    0xFC, 0x01, 0x08, 0x13, 0x33, 0xDD, 0xDE, 0xE0, 0xB0, 0x04, 0x45, 0x54, 0x60, 0xFC, 0x02, 0x00, 
+    0xE0, 0x43, 0x0C, 0x0E, 0x00, 0x21, 0xE4, 0x45, 0x78, 0x70, 0xFC, 0x01, 0x00, 0x20, 0x46, 0x0A, 
+    0x2F, 0x21, 0x53, 0x44, 0x78, 0x10, 0xFC, 0x00, 0x12, 0xF3, 0xD3, 0x3D, 0x0E, 0xFF, 0x02, 0xC1, 
+    0xA5, 0x44, 0x70, 0xEC, 0x15, 0x2D, 0xD3, 0x3D, 0x00, 0x0F, 0x2E, 0x0F, 0x11, 0xC2, 0x57, 0x61, 
+    0xCC, 0x15, 0x23, 0x3D, 0x3D, 0x33, 0xE2, 0x03, 0x01, 0xC1, 0xFF, 0xC1, 0x77, 0x45, 0x11, 0x1D, 
+    0xD3, 0xEE, 0x33, 0x3D, 0xD0, 0xF1, 0x1F, 0x21, 0xFC, 0x03, 0x03, 0x2D, 0xD3, 0xB0, 0x06, 0x2F, 
+    0x11, 0x2F, 0x20, 0xFC, 0x04, 0x0F, 0x1E, 0xED, 0x30, 0x22, 0x2F, 0x11, 0xF2, 0x01, 0xFC, 0x05, 
+    0x09, 0x13, 0xED, 0x30, 0x2F, 0x1F, 0xA2, 0xFC, 0x07, 0x0B, 0x13, 0xE3, 0x33, 0x20, 0x02, 0x2F, 
+    0xFC, 0x09, 0x09, 0x12, 0xEE, 0x3E, 0x22, 0x11, 0xFC, 0x0C, 0x05, 0x10, 0x02, 0x11, 0xFC, 0x10, 
+    0x01, 0x11, 0xFC, 0x06, 
+};
+
+const gfx_image_t EQUIPMENT_ICON_IMG = {
+    .w = EQUIPMENT_ICON_W, .h = EQUIPMENT_ICON_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = EQUIPMENT_ICON_PAL, .colors = EQUIPMENT_ICON_PAL_SIZE,
+    .data = EQUIPMENT_ICON_RLE, .size = EQUIPMENT_ICON_RLE_SIZE,
 };
@@ -13,11 +13,14 @@
 #include "gfx.h"
 #include "ssd1351.h"
 #include "game.h"
+#include "metrics.h"
+#include "pqueue.h"
 
 #include "game_single.h"
 #include "game_two.h"
 #include "game_story.h"
 #include "game_tower.h"
+#include "game_four.h"
 #include "end_credits.h"
 #include "mode_splash.h"
 #include "menu.h"
@@ -29,7 +32,8 @@ typedef enum {
   MODE_PVP,
   MODE_STORY,
   MODE_TOWER,
-  MODE_CREDITS
+  MODE_CREDITS,
+  MODE_QUAD
 } game_mode_t;
 
 // Global game state
@@ -58,7 +62,7 @@ void game_init(void){
   }
 }
 
-// Set the current game mode (e.g., playground, PVP, story, tower, credits).
+// Set the current game mode (e.g., playground, PVP, story, tower, credits, 4P).
 void game_set_mode(uint8_t mode){
   // Use the mode that was selected by the menu
   g_mode = mode;
@@ -80,6 +84,11 @@ void game_set_mode(uint8_t mode){
     case MODE_CREDITS:
       end_credits_init();
       break;
+#if ADS_FRONTEND_M04
+    case MODE_QUAD:
+      game_four_init();
+      break;
+#endif
     default:
       // Fallback to playground if an invalid mode is set
       g_mode = MODE_PLAYGROUND;
@@ -88,34 +97,20 @@ void game_set_mode(uint8_t mode){
   }
 }
 
-// Get current EMG/Hz metrics from the active mode.
-// The active mode fills out hz, pct (percentile), and base (baseline Hz).
+// Get current EMG/Hz metrics from the DSP's latest snapshot, for whoever
+// sits in seat 0 (P1). Any pointer may be NULL.
 void game_get_metrics(float *hz, uint8_t *pct, float *base){
-  if (!hz || !pct || !base) return;
-
-  switch (g_mode){
-    case MODE_PLAYGROUND:
-      game_single_metrics(hz, pct, base);
-      break;
-    case MODE_PVP:
-      game_two_metrics(hz, pct, base);
-      break;
-    case MODE_STORY:
-      game_story_metrics(hz, pct, base);
-      break;
-    case MODE_TOWER:
-      game_tower_metrics(hz, pct, base);
-      break;
-    default:
-      *hz   = 0.0f;
-      *pct  = 0u;
-      *base = 0.0f;
-      break;
-  }
+  metrics_t m;
+  uint8_t   ch = pqueue_seat(0);
+  (void)metrics_read(&m);
+  if (hz)   *hz   = m.hz[ch];
+  if (pct)  *pct  = m.pct[ch];
+  if (base) *base = m.base_hz[ch];
 }
 
 // Main per-frame update for the entire game.
-// Returns when the game loop has finished one tick.
+// Returns when the game loop has finished one tick. Queued scene draws are
+// sent separately by the render task (gfx_jobs_run()).
 void game_tick(void){
   if (!g_inited){
     // Ensure initialization is complete before ticking
@@ -123,6 +118,11 @@ void game_tick(void){
     return;
   }
 
+  // Scene change in progress: hold every state machine until the panel is dark
+  if (gfx_fade_tick(millis())){
+    return;
+  }
+
   // If we are currently in the menu, tick the menu.
   if (g_in_menu){
     uint8_t mode = 0xFFu;
@@ -165,6 +165,15 @@ void game_tick(void){
       }
       break;
 
+#if ADS_FRONTEND_M04
+    case MODE_QUAD:
+      if (game_four_tick()){
+        g_in_menu = 1;
+        menu_start();
+      }
+      break;
+#endif
+
     case MODE_CREDITS:
     default:
       if (end_credits_tick()){
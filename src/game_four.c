@@ -0,0 +1,274 @@
+/*==============================================================================
+ * @file    game_four.c
+ * @brief   Four-player bracket mode: 4-lane live HUD and bracket scoring.
+ *
+ * This file is part of the EMG flex-frequency game project and follows the
+ * project coding standard for file-level documentation.
+ *============================================================================*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "timer.h"
+#include "gfx.h"
+#include "hud.h"
+#include "game.h"
+#include "project.h"
+#include "sched.h"  // sched_headroom_pct()
+#include "round_acc.h"
+#include "metrics.h"
+#include "pqueue.h"
+#include "game_four.h"
+#include "scene.h"
+
+#if ADS_FRONTEND_M04   // needs all four channels in metrics_t
+
+#define LANES        4u
+#define FLEX_MS      10000u
+
+typedef enum {
+  ST_INTRO = 0,
+  ST_READY,
+  ST_COUNT_3,
+  ST_COUNT_2,
+  ST_COUNT_1,
+  ST_FLEX_CUE,
+  ST_FLEXING,
+  ST_MATCHES,
+  ST_PODIUM,
+  ST_SCENES
+} fp_state_t;
+
+/* One head-to-head inside a round: lane a against lane b */
+typedef struct {
+  uint8_t     a, b;
+  const char *tag;
+} match_t;
+
+static scene_run_t g_run;
+
+static uint8_t  g_round;                 // 0 = semifinals, 1 = finals
+static match_t  g_match[2];              // both matches of the current round
+static float    g_hz[LANES];             // lane active Hz, current round
+static uint32_t g_above_ms[LANES];       // lane time above ROUND_ACTIVE_HZ
+static uint8_t  g_win[2], g_lose[2];     // per match of the current round
+static bool     g_close[2];              // decided on time, Hz within margin
+static uint8_t  g_place[LANES];          // lanes, 1st..4th
+
+static const uint16_t k_player_col[LANES] = { COL_BLUE, COL_RED, COL_GREEN, COL_YELLOW };
+
+static inline void ui_sep_h(uint8_t y){
+  gfx_bar(0, y, 128, 1, COL_DKGRAY);
+}
+
+/* Does lane a beat lane b? Hz within TIE_MARGIN_PCT goes to the longer
+ * active time, then to the higher Hz (lane a on an exact tie). */
+static bool beats(uint8_t a, uint8_t b, bool *close){
+  float ha = g_hz[a], hb = g_hz[b];
+  float hi = (ha > hb) ? ha : hb;
+  float d  = (ha > hb) ? ha - hb : hb - ha;
+  *close = (d * 100.0f <= TIE_MARGIN_PCT * hi);
+  if (!*close) return ha > hb;
+  if (g_above_ms[a] != g_above_ms[b]) return g_above_ms[a] > g_above_ms[b];
+  return ha >= hb;
+}
+
+static void bracket_decide(void){
+  for (uint8_t i = 0; i < 2u; i++){
+    bool a_wins = beats(g_match[i].a, g_match[i].b, &g_close[i]);
+    g_win[i]  = a_wins ? g_match[i].a : g_match[i].b;
+    g_lose[i] = a_wins ? g_match[i].b : g_match[i].a;
+  }
+  if (g_round == 1u){
+    g_place[0] = g_win[0];  g_place[1] = g_lose[0];   // final
+    g_place[2] = g_win[1];  g_place[3] = g_lose[1];   // third place
+  }
+}
+
+/* Semifinal winners meet in the final, losers play for third */
+static void bracket_advance(void){
+  g_match[0] = (match_t){ g_win[0],  g_win[1],  "FINAL" };
+  g_match[1] = (match_t){ g_lose[0], g_lose[1], "3RD"   };
+  g_round    = 1u;
+}
+
+static const char *lane_tag(uint8_t p){
+  for (uint8_t i = 0; i < 2u; i++){
+    if (g_match[i].a == p || g_match[i].b == p) return g_match[i].tag;
+  }
+  return "";
+}
+
+/* 4-lane HUD: a 27 px lane per player with Hz, match tag and a bar */
+#define LANE_Y0     19
+#define LANE_H      27
+#define LANE_BX     4
+#define LANE_BW     120
+#define LANE_BH     10
+
+static hud_num_t       g_hz_label[LANES];
+static hud_bar_t       g_flex_bar[LANES];
+static hud_num_t       g_cpu_free;
+static hud_countdown_t g_flex_left;
+
+static void draw_lanes_static(void){
+  gfx_bar(0, 18, 128, 110, COL_BLACK);
+  ui_sep_h(18);
+
+  for (uint8_t p = 0; p < LANES; p++){
+    uint8_t y0 = (uint8_t)(LANE_Y0 + p * LANE_H);
+    char line[8];
+    snprintf(line, sizeof(line), "P%u", (unsigned)(p + 1u));
+    gfx_text2(LANE_BX, y0 + 2, line, k_player_col[p], 1);
+    gfx_text2(92, y0 + 2, lane_tag(p), COL_GRAY, 1);
+
+    hud_num_init(&g_hz_label[p], 22, y0 + 2, 1, "", 5, 1, " Hz", COL_WHITE, COL_BLACK);
+    hud_bar_init(&g_flex_bar[p], LANE_BX, y0 + 12, LANE_BW, LANE_BH, 250.0f,
+                 k_player_col[p], COL_DKGRAY);
+    hud_bar_mark(&g_flex_bar[p], ROUND_ACTIVE_HZ, COL_WHITE);
+    ui_sep_h((uint8_t)(y0 + LANE_H - 1));
+  }
+}
+
+static void draw_lanes_dynamic(const float *hz){
+  for (uint8_t p = 0; p < LANES; p++){
+    hud_num_set(&g_hz_label[p], hz[p]);
+    hud_bar_set(&g_flex_bar[p], hz[p]);
+  }
+}
+
+/*------------------------------- scenes ------------------------------------*/
+
+static float g_live_hz[LANES];   // this tick, each lane on its seat's channel
+
+static void intro_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("4P BRACKET", COL_WHITE);
+  ui_sep_h(18);
+  gfx_text2(6, 34, "Semifinals:", COL_WHITE, 1);
+  gfx_text2(18, 48, "P1", k_player_col[0], 1);
+  gfx_text2(36, 48, "vs", COL_GRAY, 1);
+  gfx_text2(54, 48, "P2", k_player_col[1], 1);
+  gfx_text2(18, 60, "P3", k_player_col[2], 1);
+  gfx_text2(36, 60, "vs", COL_GRAY, 1);
+  gfx_text2(54, 60, "P4", k_player_col[3], 1);
+  gfx_text2(6, 80, "Winners: final", COL_WHITE, 1);
+  gfx_text2(6, 92, "Losers: 3rd place", COL_WHITE, 1);
+}
+
+static void ready_enter(const scene_ctx_t *c){
+  (void)c;
+  (void)pqueue_round_begin(LANES, 3000u);   // no spares: always calibrates
+  gfx_header(g_round ? "FINALS P1-P4" : "READY P1-P4?", COL_WHITE);
+  ui_sep_h(18);
+}
+
+static void flexing_enter(const scene_ctx_t *c){
+  for (uint8_t p = 0; p < LANES; p++){
+    round_acc_begin(p, pqueue_seat(p), c->t0, c->ms, ROUND_ACTIVE_HZ);
+  }
+  draw_lanes_static();
+
+  // Seconds left on the left of the header, CPU headroom on the right
+  gfx_clear_header_band(COL_BLACK);
+  hud_countdown_init(&g_flex_left, 4, 2, 2, "", 2, "s",
+                     COL_RED, COL_BLACK, c->t0 + c->ms);
+  hud_num_init(&g_cpu_free, 74, 6, 1, "free ", 3, 0, "%", COL_GRAY, COL_BLACK);
+}
+
+static void flexing_tick(const scene_ctx_t *c){
+  hud_countdown_tick(&g_flex_left, c->now);
+  hud_num_set(&g_cpu_free, (float)sched_headroom_pct());
+  draw_lanes_dynamic(g_live_hz);
+}
+
+static uint8_t flexing_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
+
+  round_stats_t r[LANES];
+  for (uint8_t p = 0; p < LANES; p++){
+    if (!round_acc_done(p, c->now, &r[p])) return SCENE_STAY;
+  }
+  for (uint8_t p = 0; p < LANES; p++){
+    g_hz[p]       = r[p].active_hz;
+    g_above_ms[p] = r[p].above_ms;
+  }
+  bracket_decide();
+  return SCENE_NEXT;
+}
+
+static void matches_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header(g_round ? "FINALS" : "SEMIFINALS", COL_WHITE);
+  ui_sep_h(18);
+  ui_sep_h(72);
+
+  for (uint8_t i = 0; i < 2u; i++){
+    const match_t *mt = &g_match[i];
+    uint8_t y = (uint8_t)(26 + i * 54);
+    char line[32];
+    gfx_text2(6, y, mt->tag, COL_GRAY, 1);
+    snprintf(line, sizeof(line), "P%u %5.1f", (unsigned)(mt->a + 1u), g_hz[mt->a]);
+    gfx_text2(6, y + 11, line, k_player_col[mt->a], 1);
+    snprintf(line, sizeof(line), "P%u %5.1f", (unsigned)(mt->b + 1u), g_hz[mt->b]);
+    gfx_text2(68, y + 11, line, k_player_col[mt->b], 1);
+    snprintf(line, sizeof(line), "P%u wins%s", (unsigned)(g_win[i] + 1u),
+             g_close[i] ? " on time" : "");
+    gfx_text2(6, y + 25, line, k_player_col[g_win[i]], 1);
+  }
+}
+
+// Semifinals lead back to the countdown for the finals
+static uint8_t matches_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
+  if (g_round != 0u) return SCENE_NEXT;
+  bracket_advance();
+  return ST_READY;
+}
+
+static void podium_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("PODIUM", COL_GOLD);
+  ui_sep_h(18);
+
+  static const char *k_place[LANES] = { "1st", "2nd", "3rd", "4th" };
+  for (uint8_t i = 0; i < LANES; i++){
+    uint8_t p = g_place[i];
+    char line[32];
+    snprintf(line, sizeof(line), "%s  P%u  %5.1f Hz", k_place[i],
+             (unsigned)(p + 1u), g_hz[p]);
+    gfx_text2(6, (uint8_t)(30 + i * 22), line, k_player_col[p], 1);
+  }
+}
+
+// Countdown and flex scenes draw over the screen before them; only the
+// full-screen scenes fade.
+static const scene_t k_scenes[ST_SCENES] = {
+  //                ms       next        flags       enter          tick          exit
+  [ST_INTRO]    = { 4000u,   ST_READY,   SCENE_FADE, intro_enter,   NULL,         NULL         },
+  [ST_READY]    = { 2000u,   ST_COUNT_3, 0,          ready_enter,   NULL,         NULL         },
+  SCENE_COUNTDOWN(ST_COUNT_3, ST_FLEXING),
+  [ST_FLEXING]  = { FLEX_MS, ST_MATCHES, 0,          flexing_enter, flexing_tick, flexing_exit },
+  [ST_MATCHES]  = { 5000u,   ST_PODIUM,  SCENE_FADE, matches_enter, NULL,         matches_exit },
+  [ST_PODIUM]   = { 6000u,   SCENE_END,  SCENE_FADE, podium_enter,  NULL,         NULL         },
+};
+
+void game_four_init(void){
+  g_round    = 0u;
+  g_match[0] = (match_t){ 0u, 1u, "SF1" };
+  g_match[1] = (match_t){ 2u, 3u, "SF2" };
+  scene_start(&g_run, k_scenes, ST_SCENES, ST_INTRO, millis());
+}
+
+bool game_four_tick(void){
+  metrics_t m;
+  (void)metrics_read(&m);
+  for (uint8_t p = 0; p < LANES; p++) g_live_hz[p] = m.hz[pqueue_seat(p)];
+
+  return scene_tick(&g_run, millis());
+}
+
+#endif /* ADS_FRONTEND_M04 */
@@ -6,517 +6,172 @@ const uint16_t GAME_OPENING_SCREEN_LOGO_PAL[GAME_OPENING_SCREEN_LOGO_PAL_SIZE] =
     0x1391, 0x8D35, 0x25F8, 0x53B0, 0xADF8, 0x0E17, 0x55F8, 0x4B4F, 
 };
 
-const uint8_t GAME_OPENING_SCREEN_LOGO_IDX[(GAME_OPENING_SCREEN_LOGO_W * GAME_OPENING_SCREEN_LOGO_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 
-    0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x01, 
-    0x52, 0x22, 0x24, 0x44, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x42, 0x22, 0x24, 0x44, 0x41, 
-    0x54, 0x44, 0x44, 0x44, 0x22, 0x42, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x24, 0x42, 0x22, 0x44, 0x34, 0x44, 0x48, 
-    0x52, 0x24, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x24, 0x44, 0x44, 0x33, 0x34, 0x44, 0x44, 0x25, 
-    0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x24, 0x22, 0x24, 0x33, 0x33, 0x33, 0x34, 0x42, 0x22, 0x22, 0x28, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x20, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x42, 0x20, 0x00, 0x00, 0x08, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x20, 0x00, 0x22, 0x02, 0x23, 0x44, 0x3A, 0x33, 0x33, 0x44, 0x42, 0x20, 0x00, 0x00, 0x00, 0x08, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x00, 0x02, 0x22, 0x24, 0x44, 0x43, 0x13, 0x33, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 
-    0x00, 0x22, 0x22, 0x43, 0x44, 0x11, 0x33, 0x34, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x20, 
-    0x02, 0x44, 0x24, 0x33, 0x31, 0x13, 0x34, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x20, 
-    0x04, 0xA4, 0x43, 0xAA, 0x11, 0x34, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x02, 
-    0x43, 0x34, 0x31, 0x11, 0x13, 0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x42, 0x24, 
-    0x33, 0x43, 0x11, 0x11, 0x33, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 
-    0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x44, 0x42, 0x41, 
-    0x34, 0x41, 0x11, 0x13, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
-    0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x4E, 0xE4, 0x24, 0x11, 
-    0x33, 0x11, 0x11, 0x33, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x51, 
-    0x11, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x11, 0xE4, 0x27, 0x11, 
-    0x11, 0x11, 0x13, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x15, 0x55, 0x55, 
-    0x55, 0x55, 0x51, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0E, 0x11, 0x14, 0x41, 0x11, 
-    0x11, 0x11, 0x33, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x55, 0x77, 0x71, 0x55, 0x85, 
-    0x55, 0x55, 0x17, 0x77, 0x85, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x90, 0x00, 0x00, 0x56, 0x55, 
-    0x55, 0x55, 0x00, 0x00, 0x02, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x27, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x44, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x55, 
-    0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0xA3, 0x44, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 
-    0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x11, 0x34, 0x44, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 
-    0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 
-    0x11, 0x34, 0x42, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 
-    0x55, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 
-    0x1A, 0x1A, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x55, 
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 
-    0x11, 0x13, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x55, 
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x3A, 
-    0x11, 0x34, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 
-    0x55, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 
-    0x11, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 
-    0x55, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x11, 
-    0x11, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 
-    0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 
-    0x3D, 0x44, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 
-    0x51, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x41, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 
-    0x33, 0x42, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x85, 
-    0x81, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xE1, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 
-    0x33, 0x42, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x77, 0x77, 0x90, 0x41, 0x11, 0x11, 0x13, 0x33, 0x11, 0x13, 
-    0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x66, 0x60, 0x65, 0x92, 0x11, 0x11, 0x34, 0x33, 0x3D, 0x33, 
-    0x32, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 
-    0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x22, 0x56, 0x6C, 0x02, 0x22, 0x00, 0x22, 0x24, 0x22, 
-    0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x96, 0x65, 0x0F, 0x55, 0x5B, 0x00, 0xF5, 0x5B, 
-    0x09, 0x55, 0x59, 0x02, 0x00, 0x00, 0x0B, 0x65, 0x5B, 0xB0, 0x0F, 0x55, 0x56, 0x66, 0x50, 0x25, 
-    0x55, 0x55, 0x70, 0x00, 0x00, 0x00, 0xF6, 0x65, 0x20, 0x00, 0xB5, 0x55, 0x70, 0x0B, 0x55, 0xF9, 
-    0xB5, 0x52, 0x00, 0x09, 0x55, 0xB0, 0x55, 0x55, 0x55, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x05, 0x66, 0x00, 0x66, 0x60, 0x22, 0x06, 0x60, 
-    0x00, 0x56, 0x50, 0x22, 0x00, 0x00, 0xF6, 0x90, 0x96, 0x50, 0x09, 0x66, 0xB9, 0x96, 0x50, 0x07, 
-    0x66, 0x97, 0x66, 0x00, 0x00, 0x05, 0x69, 0xC6, 0x60, 0x00, 0x05, 0x55, 0x00, 0x00, 0x56, 0x20, 
-    0x05, 0x65, 0x00, 0x00, 0x56, 0x00, 0x96, 0x6F, 0xC5, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x02, 0x0F, 0x66, 0x90, 0x56, 0x50, 0x34, 0x05, 0x50, 
-    0x20, 0x56, 0x50, 0x20, 0x00, 0x0C, 0x6B, 0x00, 0x0B, 0x50, 0x02, 0x66, 0x90, 0x02, 0x50, 0x09, 
-    0x66, 0x00, 0xB6, 0x50, 0x00, 0x76, 0xB0, 0x09, 0x65, 0x00, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x56, 0x20, 0x00, 0xB5, 0x00, 0x26, 0x67, 0x00, 0xB6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x02, 0x0B, 0x66, 0x90, 0x56, 0x52, 0x33, 0x25, 0x50, 
-    0x20, 0x56, 0x50, 0x00, 0x00, 0x07, 0x69, 0x00, 0x0C, 0x50, 0x02, 0x66, 0x90, 0x00, 0xB0, 0x09, 
-    0x66, 0x20, 0x96, 0x60, 0x00, 0x56, 0xC0, 0x00, 0x56, 0xC0, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x66, 0x50, 0x00, 0xB5, 0x00, 0x26, 0x6B, 0x00, 0x06, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x0B, 0x66, 0x70, 0x56, 0x52, 0x33, 0x25, 0x50, 
-    0x22, 0x56, 0x50, 0x00, 0x00, 0x07, 0x67, 0x00, 0x00, 0x50, 0x02, 0x66, 0x90, 0x00, 0x90, 0x09, 
-    0x66, 0x00, 0x96, 0x62, 0x09, 0x65, 0x00, 0x00, 0x56, 0xB0, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x65, 0x6C, 0x00, 0xB5, 0x00, 0x26, 0x6B, 0x00, 0x05, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x0B, 0x66, 0x90, 0x56, 0x52, 0x3D, 0x25, 0x50, 
-    0x42, 0x56, 0x50, 0x00, 0x00, 0x07, 0x65, 0x00, 0x00, 0x70, 0x02, 0x66, 0x90, 0x00, 0x00, 0x09, 
-    0x66, 0x00, 0x96, 0x50, 0x0B, 0x65, 0x00, 0x00, 0xB5, 0x50, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x55, 0x65, 0x00, 0xB5, 0x00, 0x26, 0x6B, 0x00, 0x07, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x05, 0x66, 0x20, 0x56, 0x50, 0x41, 0x25, 0x50, 
-    0x42, 0x56, 0x50, 0x00, 0x00, 0x09, 0x66, 0x50, 0x00, 0x00, 0x02, 0x66, 0x90, 0x09, 0x00, 0x09, 
-    0x66, 0x00, 0x56, 0x50, 0x05, 0x55, 0x00, 0x00, 0x75, 0x50, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x7B, 0x66, 0xC0, 0xB5, 0x00, 0x26, 0x6B, 0x00, 0x09, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x06, 0x65, 0x00, 0x56, 0x50, 0x43, 0x25, 0x50, 
-    0x22, 0x56, 0x50, 0x00, 0x00, 0x00, 0x56, 0x65, 0x00, 0x00, 0x02, 0x66, 0x90, 0x99, 0x00, 0x09, 
-    0x66, 0x09, 0x65, 0x20, 0x05, 0x55, 0x00, 0x00, 0x75, 0x52, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x70, 0x65, 0x50, 0xB5, 0x00, 0x26, 0x6B, 0x00, 0x0C, 0x66, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0xF6, 0x69, 0x22, 0x56, 0x50, 0x33, 0x45, 0x50, 
-    0x22, 0x56, 0x50, 0x00, 0x00, 0x00, 0x26, 0x56, 0x50, 0x00, 0x00, 0x66, 0x5B, 0x69, 0x00, 0x09, 
-    0x65, 0x56, 0x69, 0x00, 0x05, 0x5B, 0x00, 0x00, 0x75, 0x6C, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x70, 0x55, 0x60, 0x75, 0x00, 0x26, 0x67, 0x00, 0x02, 0x66, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x55, 0x65, 0x92, 0x42, 0x56, 0x50, 0x33, 0x25, 0x50, 
-    0x22, 0x56, 0x50, 0x00, 0x00, 0x00, 0x0C, 0x65, 0x65, 0x00, 0x00, 0x65, 0x5B, 0x69, 0x00, 0x09, 
-    0x65, 0x97, 0x65, 0x70, 0x05, 0x5B, 0x00, 0x00, 0x75, 0x59, 0x05, 0x65, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x70, 0x96, 0x6B, 0xB5, 0x00, 0x26, 0x67, 0x00, 0x02, 0x66, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x5B, 0x90, 0x23, 0x12, 0x56, 0x50, 0x43, 0x25, 0x50, 
-    0x22, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x56, 0xB0, 0x00, 0x56, 0x90, 0x99, 0x00, 0x09, 
-    0x65, 0x00, 0x76, 0x60, 0x05, 0x5B, 0x00, 0x00, 0x75, 0x52, 0x05, 0x55, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x70, 0x05, 0x55, 0x55, 0x00, 0x26, 0x67, 0x00, 0x02, 0x66, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x00, 0x24, 0xA1, 0x12, 0x56, 0x50, 0x43, 0x25, 0x50, 
-    0x20, 0x56, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x56, 0x90, 0x09, 0x00, 0x09, 
-    0x55, 0x00, 0x05, 0x57, 0x05, 0x5B, 0x00, 0x00, 0x75, 0x50, 0x05, 0x55, 0x00, 0x00, 0x55, 0x00, 
-    0x05, 0x70, 0x09, 0x55, 0x55, 0x00, 0x26, 0x67, 0x00, 0x0C, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x66, 0x02, 0x44, 0x11, 0x14, 0x56, 0x50, 0x44, 0x25, 0x50, 
-    0x20, 0x56, 0x50, 0x00, 0x09, 0x09, 0x00, 0x00, 0x05, 0x59, 0x02, 0x55, 0x90, 0x00, 0x00, 0x09, 
-    0x55, 0x00, 0x05, 0x58, 0x05, 0x58, 0x00, 0x00, 0x75, 0x50, 0x05, 0x55, 0x00, 0x00, 0x85, 0x00, 
-    0x05, 0x70, 0x00, 0x85, 0x55, 0x00, 0x25, 0x57, 0x00, 0x09, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x4E, 0x11, 0x14, 0x56, 0x50, 0x24, 0x25, 0x50, 
-    0x20, 0x56, 0x50, 0x00, 0x07, 0x0B, 0x00, 0x00, 0x07, 0x57, 0x00, 0x55, 0x90, 0x00, 0x09, 0x09, 
-    0x55, 0x00, 0x08, 0x55, 0x07, 0x58, 0x00, 0x00, 0x85, 0x80, 0x08, 0x58, 0x00, 0x00, 0x85, 0x00, 
-    0x05, 0x70, 0x00, 0x95, 0x55, 0x00, 0x25, 0x57, 0x00, 0x07, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x56, 0x02, 0x47, 0x11, 0x14, 0xB6, 0x50, 0x42, 0x25, 0x50, 
-    0x00, 0x55, 0x80, 0x00, 0xC7, 0x05, 0xC0, 0x00, 0x09, 0x59, 0x00, 0x55, 0x90, 0x00, 0x27, 0x09, 
-    0x55, 0x00, 0x08, 0x58, 0x09, 0x55, 0x00, 0x00, 0x85, 0x70, 0x0B, 0x58, 0x00, 0x00, 0x85, 0x00, 
-    0x05, 0x70, 0x00, 0x08, 0x58, 0x00, 0x25, 0x57, 0x00, 0x08, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x22, 0x47, 0x11, 0x14, 0xB6, 0x50, 0x22, 0x05, 0xB0, 
-    0x00, 0x55, 0x80, 0x00, 0x87, 0x05, 0x80, 0x00, 0x07, 0x52, 0x02, 0x55, 0x90, 0x00, 0x89, 0x09, 
-    0x55, 0x00, 0x05, 0x57, 0x00, 0x55, 0x20, 0x00, 0x55, 0x00, 0x07, 0x55, 0x00, 0x00, 0x58, 0x00, 
-    0x08, 0x70, 0x00, 0x09, 0x58, 0x00, 0x05, 0x57, 0x00, 0xC5, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x22, 0x71, 0x11, 0x11, 0x76, 0x59, 0x00, 0x76, 0x92, 
-    0x20, 0x85, 0x80, 0x09, 0x59, 0x08, 0x59, 0x00, 0x05, 0x80, 0x02, 0x55, 0x90, 0x07, 0x5C, 0x09, 
-    0x55, 0x00, 0x75, 0x50, 0x00, 0x95, 0x80, 0x07, 0x57, 0x00, 0x0C, 0x55, 0x70, 0x07, 0x57, 0x00, 
-    0x08, 0x70, 0x00, 0x00, 0x58, 0x00, 0x05, 0x57, 0x02, 0x55, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x02, 0x41, 0x11, 0x11, 0x2B, 0x66, 0x55, 0x6B, 0x24, 
-    0x22, 0x55, 0x55, 0x55, 0x52, 0x07, 0x55, 0x77, 0x85, 0x20, 0x07, 0x55, 0x55, 0x55, 0x52, 0x08, 
-    0x55, 0x78, 0x55, 0xC0, 0x00, 0x07, 0x57, 0x75, 0x80, 0x00, 0x00, 0x75, 0x58, 0x85, 0x80, 0x00, 
-    0x25, 0x80, 0x00, 0x00, 0x95, 0x00, 0x75, 0x55, 0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x27, 0x11, 0x11, 0x12, 0x9B, 0x55, 0x72, 0x3A, 
-    0x27, 0x77, 0x77, 0x77, 0x70, 0x02, 0x09, 0x88, 0x70, 0x00, 0x27, 0x77, 0x77, 0x77, 0x70, 0x97, 
-    0x77, 0x17, 0x90, 0x00, 0x00, 0x00, 0x98, 0x87, 0x00, 0x00, 0x00, 0x09, 0x78, 0x19, 0x00, 0x00, 
-    0x77, 0x77, 0x00, 0x00, 0x01, 0x02, 0x77, 0x77, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x47, 0x11, 0x11, 0x11, 0x42, 0x22, 0x24, 0x31, 
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x56, 0x90, 0x27, 0x71, 0x11, 0x11, 0x13, 0x41, 0x11, 0x11, 
-    0x11, 0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x56, 0x50, 0x02, 0x77, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 
-    0x11, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x57, 0x99, 0x79, 0x02, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 
-    0x11, 0x1A, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x71, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 
-    0x11, 0x11, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x24, 0x71, 0x11, 0x11, 0x11, 0x34, 0x11, 0x11, 
-    0x11, 0x11, 0x14, 0x32, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x00, 0x02, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x22, 0x71, 0x11, 0x11, 0x11, 0x13, 0x31, 0x11, 
-    0x11, 0x41, 0x11, 0xA3, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x20, 0x00, 0x02, 0x22, 0x00, 0x24, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x71, 0x11, 0x11, 0x11, 0x13, 0x41, 0x11, 
-    0x11, 0x33, 0x11, 0x13, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x20, 0x00, 0x24, 0x20, 0x02, 0x44, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42, 0x47, 0x11, 0x11, 0x11, 0x11, 0x43, 0x11, 
-    0x11, 0x11, 0x31, 0x11, 0x1A, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x24, 0x20, 0x24, 0x44, 0x20, 0x24, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x2E, 0x11, 0x88, 0x11, 0x1D, 0x34, 0x31, 
-    0x11, 0x11, 0x13, 0x33, 0x11, 0x13, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 
-    0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 
-    0x44, 0x22, 0x24, 0x44, 0x22, 0x43, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x42, 0x11, 0x18, 0x11, 0x13, 0x34, 0x43, 
-    0x11, 0x11, 0x11, 0x13, 0x31, 0x13, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x22, 0x00, 0x00, 0x02, 0x44, 
-    0x44, 0x42, 0x43, 0x44, 0x44, 0x33, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x71, 0x18, 0x81, 0x13, 0x34, 0x43, 
-    0x31, 0x11, 0x11, 0x11, 0x33, 0x11, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x00, 0x00, 0x00, 0x22, 0x43, 
-    0x34, 0x44, 0x33, 0x44, 0x33, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA4, 0x21, 0x81, 0x88, 0x11, 0x34, 0x24, 
-    0x31, 0x11, 0x1D, 0x11, 0x33, 0x31, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x42, 0x00, 0x00, 0x02, 0x24, 0x33, 
-    0x34, 0x43, 0x3A, 0xA4, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x21, 0x88, 0x11, 0x11, 0x14, 0x22, 
-    0x33, 0xDD, 0x11, 0x41, 0x13, 0x3D, 0x11, 0x34, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x42, 0x00, 0x00, 0x02, 0x43, 0x3A, 
-    0xAA, 0x33, 0xAA, 0x33, 0x33, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x47, 0x18, 0x11, 0x11, 0x1D, 0x42, 
-    0x23, 0x33, 0x31, 0x34, 0x11, 0x33, 0xD1, 0x13, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x24, 0x34, 0x44, 0x20, 0x00, 0x22, 0x43, 0xA1, 
-    0xA4, 0x3A, 0x34, 0x43, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x22, 0x43, 0x33, 0x33, 0x33, 0x13, 0x33, 0x33, 0x33, 0x34, 0x20, 0x00, 0x00, 0x20, 0x04, 0x11, 
-    0x11, 0x40, 0x02, 0x22, 0x22, 0x22, 0x22, 0x24, 0x43, 0x34, 0x42, 0x22, 0x24, 0x44, 0x31, 0x1A, 
-    0xA3, 0x33, 0x44, 0x34, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x71, 0x18, 0x11, 0x11, 0x11, 
-    0x34, 0x44, 0x44, 0x43, 0x33, 0x31, 0x33, 0x33, 0x33, 0x33, 0x34, 0x00, 0x22, 0x22, 0x24, 0x11, 
-    0x11, 0x42, 0x02, 0x22, 0x22, 0x22, 0x22, 0x43, 0x33, 0x32, 0x22, 0x24, 0x43, 0x33, 0x11, 0xAA, 
-    0x33, 0x33, 0x43, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x18, 0x88, 0x81, 0x11, 
-    0x13, 0x42, 0x22, 0x24, 0x44, 0x33, 0x33, 0x33, 0x31, 0x33, 0x33, 0x42, 0x22, 0x42, 0x24, 0x11, 
-    0x11, 0x42, 0x22, 0x42, 0x22, 0x24, 0x44, 0x33, 0x33, 0x42, 0x22, 0x43, 0x3A, 0xA1, 0x11, 0x13, 
-    0x33, 0x34, 0x33, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x18, 0x88, 0x88, 0x11, 
-    0x11, 0x34, 0x34, 0x42, 0x02, 0x43, 0x33, 0x3D, 0x34, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x11, 
-    0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x44, 0x43, 0x3A, 0x11, 0x11, 0x11, 0xA3, 
-    0x33, 0x33, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x02, 0x71, 0x71, 0x88, 0x85, 0x11, 
-    0x11, 0xD3, 0x34, 0x22, 0x20, 0x24, 0x33, 0x33, 0x33, 0x44, 0x33, 0x33, 0x33, 0x33, 0x44, 0x11, 
-    0x11, 0xA3, 0x33, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0xA3, 
-    0x34, 0x44, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x21, 0x11, 0x18, 0x85, 0x58, 
-    0x11, 0x11, 0x34, 0x42, 0x24, 0x22, 0x44, 0x33, 0x33, 0x33, 0x34, 0x33, 0x44, 0x34, 0x44, 0x11, 
-    0x11, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x3A, 0x31, 0x11, 0x11, 0x1A, 0xA3, 0x33, 
-    0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x23, 0x41, 0x11, 0x18, 0x88, 0x88, 
-    0x81, 0x11, 0x13, 0x33, 0x43, 0x34, 0x24, 0x43, 0x33, 0x33, 0x33, 0x33, 0x42, 0x43, 0x42, 0x31, 
-    0x11, 0xA3, 0x34, 0x43, 0x33, 0x33, 0x33, 0x33, 0x3A, 0xAA, 0x11, 0x11, 0x11, 0xAA, 0x34, 0x44, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x11, 0x11, 0x11, 0x18, 0x88, 
-    0x88, 0x11, 0x13, 0x33, 0x33, 0x33, 0x42, 0x43, 0x33, 0x33, 0x33, 0x33, 0x34, 0x44, 0x44, 0x41, 
-    0x11, 0x13, 0x33, 0x3A, 0x31, 0x11, 0xA3, 0x3A, 0x1A, 0x11, 0x11, 0x11, 0x1A, 0x44, 0x33, 0x42, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x41, 0x11, 0x11, 0x11, 0x88, 
-    0x88, 0x81, 0x11, 0x33, 0x34, 0x33, 0x33, 0x44, 0x33, 0x33, 0x33, 0x33, 0x24, 0x34, 0x24, 0x33, 
-    0x11, 0x13, 0x33, 0x3A, 0x11, 0x11, 0x1A, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA4, 0x44, 0x42, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x41, 0x11, 0x11, 0x11, 
-    0x88, 0x88, 0x11, 0x13, 0x33, 0x33, 0x33, 0x34, 0x42, 0x33, 0x33, 0x43, 0x34, 0x44, 0x24, 0x33, 
-    0x11, 0xAA, 0x3A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x24, 0x22, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x24, 0x11, 0x11, 0x11, 
-    0x88, 0x88, 0x81, 0x11, 0x31, 0x13, 0x43, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33, 
-    0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x41, 0x11, 0x11, 
-    0x11, 0x88, 0x81, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x44, 0x42, 0x33, 
-    0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22, 0x20, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x11, 0x17, 
-    0x11, 0x18, 0x88, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3A, 0x13, 0x33, 0x33, 0x33, 0x44, 0x22, 0x43, 
-    0x13, 0xA1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x42, 0x22, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0x17, 
-    0x71, 0x11, 0x88, 0x81, 0x11, 0x11, 0x11, 0x11, 0xA3, 0x33, 0x33, 0x33, 0x33, 0x34, 0x22, 0x44, 
-    0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x4A, 0x34, 0x22, 0x42, 0x20, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x11, 
-    0x1E, 0x11, 0x11, 0x88, 0x11, 0x11, 0x11, 0x11, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 
-    0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0xA4, 0x44, 0x11, 0x34, 0x44, 0x20, 0x00, 0x00, 0x22, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
-    0x1E, 0x24, 0x11, 0x11, 0x81, 0x11, 0x11, 0x11, 0x14, 0x11, 0x33, 0xA3, 0x33, 0x33, 0x34, 0x44, 
-    0x34, 0xA1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x34, 0x22, 0x22, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x41, 0x42, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x3A, 0x33, 0x33, 0x34, 0x24, 
-    0x33, 0x31, 0x11, 0xA1, 0x11, 0x11, 0x11, 0xAA, 0xA3, 0x44, 0x42, 0x22, 0x20, 0x22, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x14, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x34, 0x33, 0x34, 0x24, 
-    0x33, 0x4A, 0x33, 0x3A, 0xA1, 0xAA, 0xA3, 0x44, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0xA3, 0x4E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA4, 0x44, 0x44, 0x24, 
-    0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x41, 0xA4, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x11, 0x11, 0x41, 0x11, 0x34, 0x44, 0x44, 0x43, 
-    0x33, 0x44, 0x44, 0x44, 0x22, 0x24, 0x20, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x24, 0x11, 0x11, 0x11, 0x17, 0x11, 0x44, 0x44, 0x11, 0x34, 0x44, 0x44, 0x44, 0x44, 0x33, 
-    0x33, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x41, 0x1A, 0x31, 0x11, 0x44, 0x34, 0x22, 0x43, 0x34, 0x22, 0x44, 0x42, 0x22, 0x33, 
-    0x34, 0x02, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x44, 0x44, 0x4A, 0x32, 0x22, 0x20, 0x24, 0x33, 0x42, 0x20, 0x22, 0x00, 0x43, 
-    0x34, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x22, 0x44, 0x33, 0x20, 0x00, 0x00, 0x24, 0x44, 0x20, 0x00, 0x00, 0x43, 
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x42, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x23, 
-    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x44, 0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x03, 
-    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t GAME_OPENING_SCREEN_LOGO_RLE[GAME_OPENING_SCREEN_LOGO_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x8E, 0x01, 0x77, 0xF0, 0x75, 
+    0x02, 0x55, 0x90, 0xF0, 0x73, 0x03, 0x25, 0x57, 0xF0, 0x74, 0x02, 0x55, 0x90, 0xF0, 0x74, 0x02, 
+    0x85, 0x20, 0xF0, 0x74, 0x01, 0x75, 0xF0, 0x6D, 0x02, 0x22, 0x20, 0xB0, 0x01, 0x15, 0xA2, 0x02, 
+    0x44, 0x40, 0xA2, 0xF0, 0x5C, 0x05, 0x22, 0x00, 0x24, 0xA2, 0xA4, 0x01, 0x15, 0xD4, 0x02, 0x22, 
+    0x40, 0xA2, 0xF0, 0x55, 0xC2, 0x07, 0x44, 0x22, 0x24, 0x43, 0xA4, 0x06, 0x85, 0x22, 0x44, 0x40, 
+    0xF2, 0x01, 0xF0, 0x52, 0xC2, 0xB4, 0x02, 0x33, 0x30, 0xB4, 0x02, 0x25, 0x50, 0xF2, 0x03, 0x00, 
+    0x00, 0xA2, 0xF0, 0x46, 0x00, 0x20, 0xE0, 0x05, 0x24, 0x22, 0x24, 0xD3, 0x01, 0x44, 0xC2, 0x02, 
+    0x85, 0x20, 0xF0, 0x54, 0x01, 0x22, 0xD0, 0x00, 0x20, 0xB4, 0xE3, 0x02, 0x42, 0x20, 0xC0, 0x7F, 
+    0xF0, 0x15, 0x00, 0x20, 0x43, 0x09, 0x22, 0x02, 0x23, 0x44, 0x3A, 0xA3, 0x04, 0x44, 0x42, 0x20, 
+    0xE0, 0x7F, 0xF0, 0x14, 0x05, 0x22, 0x20, 0x00, 0xA2, 0xA4, 0x08, 0x31, 0x33, 0x34, 0x44, 0x20, 
+    0xF0, 0x02, 0x7F, 0xF0, 0x14, 0x04, 0x42, 0x00, 0x00, 0xA2, 0x0B, 0x43, 0x44, 0x11, 0x33, 0x34, 
+    0x42, 0xF0, 0x04, 0x00, 0x50, 0x59, 0x00, 0x20, 0xF0, 0x37, 0x00, 0x40, 0x42, 0x0F, 0x24, 0x42, 
+    0x43, 0x33, 0x11, 0x33, 0x44, 0x22, 0xF0, 0x05, 0x5A, 0x01, 0x02, 0xF0, 0x35, 0x00, 0x40, 0x43, 
+    0x0D, 0x4A, 0x44, 0x3A, 0xA1, 0x13, 0x44, 0x22, 0xF0, 0x07, 0x02, 0x55, 0x90, 0xF0, 0x12, 0x00, 
+    0x20, 0xF0, 0x33, 0x0A, 0x24, 0x42, 0x02, 0x43, 0x34, 0x30, 0xA1, 0x04, 0x34, 0x42, 0x20, 0xF0, 
+    0x07, 0x03, 0x75, 0x55, 0xF0, 0x13, 0x00, 0x20, 0xF0, 0x31, 0x0A, 0x24, 0x44, 0x22, 0x43, 0x34, 
+    0x30, 0xA1, 0x04, 0x33, 0x42, 0x20, 0xF0, 0x08, 0x03, 0x75, 0x51, 0xF0, 0x4B, 0x02, 0x20, 0x00, 
+    0xA4, 0x05, 0x24, 0x13, 0x44, 0xA1, 0x04, 0x34, 0x22, 0x20, 0xF0, 0x09, 0x00, 0x10, 0x7F, 0xF0, 
+    0x0C, 0x0C, 0x22, 0x04, 0xEE, 0x42, 0x41, 0x13, 0x30, 0xA1, 0x04, 0x33, 0x22, 0x20, 0xF0, 0x08, 
+    0x08, 0x27, 0x51, 0x11, 0x70, 0x20, 0xF0, 0x47, 0x08, 0x40, 0x21, 0x1E, 0x42, 0x70, 0xD1, 0x04, 
+    0x33, 0x42, 0x20, 0xF0, 0x05, 0x02, 0x27, 0x10, 0xF5, 0x01, 0x02, 0x17, 0x90, 0xF0, 0x43, 0x08, 
+    0x22, 0x0E, 0x11, 0x14, 0x40, 0xD1, 0x04, 0x33, 0x42, 0x20, 0xF0, 0x04, 0x01, 0x91, 0xF5, 0x08, 
+    0x00, 0x70, 0xF0, 0x41, 0x02, 0x20, 0x20, 0xF1, 0x04, 0x03, 0x33, 0x22, 0xF0, 0x03, 0x0A, 0x21, 
+    0x55, 0x77, 0x71, 0x55, 0x80, 0xB5, 0x07, 0x17, 0x77, 0x85, 0x59, 0xF0, 0x3E, 0x02, 0x24, 0x20, 
+    0xF1, 0x04, 0x02, 0x33, 0x40, 0x4D, 0x01, 0x79, 0xB0, 0x01, 0x56, 0xC5, 0xB0, 0x02, 0x27, 0x70, 
+    0xF0, 0x3E, 0x02, 0x42, 0x70, 0xF1, 0x03, 0x07, 0x33, 0x44, 0x20, 0x02, 0xF0, 0x09, 0x00, 0x70, 
+    0xC5, 0x00, 0x70, 0xF0, 0x45, 0x02, 0x21, 0x70, 0xF1, 0x04, 0x00, 0xA0, 0x43, 0x00, 0x20, 0x51, 
+    0x00, 0x20, 0x7F, 0xF0, 0x0B, 0x00, 0x70, 0xF1, 0x03, 0x09, 0x31, 0x13, 0x44, 0x42, 0x24, 0xF0, 
+    0x0B, 0x7F, 0xF0, 0x0A, 0x00, 0x20, 0xF1, 0x03, 0x01, 0x31, 0x43, 0x03, 0x22, 0x42, 0x58, 0x00, 
+    0x90, 0xF0, 0x44, 0x4A, 0x0A, 0x33, 0x11, 0xA1, 0xA4, 0x22, 0x20, 0xF0, 0x0B, 0x00, 0x90, 0xC5, 
+    0xF0, 0x45, 0x01, 0x27, 0x49, 0xB1, 0x00, 0x30, 0x56, 0x00, 0x70, 0x7F, 0xF0, 0x09, 0x01, 0x24, 
+    0xF1, 0x01, 0x0A, 0x33, 0x3A, 0x11, 0x34, 0x22, 0x20, 0xF0, 0x0D, 0xB5, 0x00, 0x10, 0xF0, 0x44, 
+    0x01, 0x4E, 0xF1, 0x00, 0xB3, 0x44, 0xF0, 0x0E, 0x7F, 0x51, 0x00, 0x70, 0xE1, 0xA3, 0xA1, 0x5D, 
+    0x00, 0x10, 0x7F, 0x4C, 0xF1, 0x00, 0x01, 0x33, 0xA1, 0x04, 0x3D, 0x44, 0x20, 0xC0, 0x00, 0x20, 
+    0xF0, 0x08, 0x00, 0x10, 0x42, 0x00, 0x70, 0xF0, 0x43, 0x00, 0x20, 0x4F, 0x02, 0x34, 0x20, 0x44, 
+    0x00, 0x20, 0xF0, 0x09, 0x03, 0x18, 0x58, 0x7F, 0xF0, 0x05, 0x02, 0x44, 0xE0, 0x4F, 0xB0, 0x00, 
+    0x20, 0xF0, 0x0A, 0x00, 0x70, 0xA1, 0x7F, 0xD0, 0x01, 0x99, 0xA7, 0x02, 0x90, 0x40, 0xC1, 0x00, 
+    0x30, 0x43, 0x03, 0x33, 0x42, 0x44, 0xF0, 0x0B, 0x04, 0x27, 0x11, 0x10, 0xF0, 0x3F, 0x09, 0x70, 
+    0x66, 0x60, 0x65, 0x92, 0xA1, 0x0A, 0x34, 0x33, 0x3D, 0x33, 0x32, 0x20, 0xB0, 0x00, 0x20, 0x53, 
+    0x04, 0x04, 0x44, 0x20, 0xF0, 0x3F, 0x14, 0x66, 0x62, 0x25, 0x66, 0xC0, 0x22, 0x20, 0x02, 0x22, 
+    0x42, 0x20, 0xD0, 0x00, 0x20, 0x53, 0xF0, 0x45, 0x1C, 0x56, 0x60, 0x09, 0x66, 0x50, 0xF5, 0x55, 
+    0xB0, 0x0F, 0x55, 0xB0, 0x95, 0x55, 0x90, 0x20, 0xB0, 0x11, 0xB6, 0x55, 0xBB, 0x00, 0xF5, 0x55, 
+    0x66, 0x65, 0x02, 0xB5, 0x00, 0x70, 0xD0, 0x1F, 0xF6, 0x65, 0x20, 0x00, 0xB5, 0x55, 0x70, 0x0B, 
+    0x55, 0xF9, 0xB5, 0x52, 0x00, 0x09, 0x55, 0xB0, 0xC5, 0x00, 0x90, 0x5B, 0x16, 0x05, 0x66, 0x00, 
+    0x66, 0x60, 0x22, 0x06, 0x60, 0x00, 0x56, 0x50, 0x20, 0x43, 0x19, 0xF6, 0x90, 0x96, 0x50, 0x09, 
+    0x66, 0xB9, 0x96, 0x50, 0x07, 0x66, 0x97, 0x66, 0xB0, 0x05, 0x56, 0x9C, 0x66, 0xA0, 0x02, 0x55, 
+    0x50, 0xA0, 0x07, 0x56, 0x20, 0x05, 0x65, 0xA0, 0x0B, 0x56, 0x00, 0x96, 0x6F, 0xC5, 0x65, 0x59, 
+    0x11, 0x20, 0xF6, 0x69, 0x05, 0x65, 0x03, 0x40, 0x55, 0x02, 0x44, 0xA0, 0x26, 0xC6, 0xB0, 0x00, 
+    0xB5, 0x00, 0x26, 0x69, 0x00, 0x25, 0x00, 0x96, 0x60, 0x0B, 0x65, 0x00, 0x07, 0x6B, 0x00, 0x96, 
+    0x50, 0x42, 0x00, 0x60, 0x44, 0x17, 0x50, 0x00, 0x55, 0x62, 0x00, 0x0B, 0x50, 0x02, 0x66, 0x70, 
+    0x0B, 0x65, 0x5A, 0x00, 0xB0, 0x45, 0x03, 0x23, 0x32, 0x47, 0xB0, 0x06, 0x76, 0x90, 0x00, 0xC0, 
+    0x47, 0x01, 0x0B, 0x43, 0x10, 0x20, 0x96, 0x60, 0x00, 0x56, 0xC0, 0x00, 0x56, 0xC0, 0x4D, 0x02, 
+    0x66, 0x50, 0x48, 0x06, 0xB0, 0x00, 0x66, 0x90, 0x57, 0x00, 0x00, 0x42, 0x00, 0x70, 0x4A, 0x00, 
+    0x20, 0x49, 0x00, 0x70, 0xA0, 0x48, 0x00, 0x90, 0x43, 0x00, 0x00, 0x42, 0x04, 0x20, 0x96, 0x50, 
+    0xA0, 0x02, 0x56, 0xB0, 0x4E, 0x02, 0x56, 0xC0, 0x4B, 0x02, 0x56, 0x50, 0x5C, 0x00, 0x90, 0x44, 
+    0x00, 0xD0, 0x42, 0x00, 0x40, 0x4A, 0x00, 0x50, 0xA0, 0x00, 0x70, 0x47, 0x00, 0x00, 0x47, 0x03, 
+    0x50, 0x0B, 0x44, 0x02, 0xB5, 0x50, 0x4D, 0x03, 0x55, 0x65, 0x4B, 0x02, 0x76, 0x60, 0x59, 0x03, 
+    0x56, 0x62, 0x42, 0x02, 0x04, 0x10, 0x4D, 0x03, 0x96, 0x65, 0xC0, 0x44, 0x00, 0x90, 0x46, 0x00, 
+    0x50, 0x42, 0x01, 0x55, 0x43, 0x00, 0x70, 0x4F, 0x04, 0x7B, 0x66, 0xC0, 0x4A, 0x03, 0x96, 0x69, 
+    0x58, 0x03, 0x66, 0x50, 0x44, 0x00, 0x30, 0x42, 0x00, 0x20, 0x48, 0x04, 0x05, 0x66, 0x50, 0x48, 
+    0x00, 0x90, 0x46, 0x03, 0x96, 0x52, 0x4A, 0x00, 0x20, 0x4D, 0x03, 0x06, 0x55, 0x4A, 0x03, 0xC6, 
+    0x67, 0x57, 0x05, 0xF6, 0x69, 0x22, 0x42, 0x02, 0x33, 0x40, 0x4D, 0x04, 0x26, 0x56, 0x50, 0xB0, 
+    0x04, 0x66, 0x5B, 0x60, 0x44, 0x05, 0x55, 0x66, 0x90, 0x42, 0x00, 0xB0, 0x44, 0x01, 0x6C, 0x4E, 
+    0x04, 0x55, 0x60, 0x70, 0x44, 0x04, 0x70, 0x00, 0x20, 0x58, 0x06, 0x55, 0x65, 0x92, 0x40, 0x45, 
+    0x00, 0x20, 0x4D, 0x05, 0x0C, 0x65, 0x65, 0x43, 0x00, 0x50, 0x48, 0x04, 0x97, 0x65, 0x70, 0x49, 
+    0x01, 0x59, 0x4E, 0x04, 0x96, 0x6B, 0xB0, 0x64, 0x05, 0xB9, 0x02, 0x31, 0x43, 0x00, 0x40, 0x50, 
+    0x0D, 0x00, 0x55, 0x6B, 0x00, 0x05, 0x69, 0x09, 0x45, 0x04, 0x00, 0x76, 0x60, 0x4A, 0x03, 0x20, 
+    0x55, 0x4B, 0x00, 0x00, 0xB5, 0x62, 0x05, 0x00, 0x24, 0xA1, 0x4B, 0x00, 0x00, 0x4B, 0x03, 0x05, 
+    0x55, 0x45, 0x00, 0x00, 0x43, 0x07, 0x55, 0x00, 0x05, 0x57, 0x49, 0x00, 0x00, 0x4F, 0x00, 0x90, 
+    0x4B, 0x03, 0xC6, 0x69, 0x56, 0x06, 0x24, 0x41, 0x11, 0x40, 0x43, 0x00, 0x40, 0x4B, 0x02, 0x90, 
+    0x90, 0xB0, 0x07, 0x55, 0x90, 0x25, 0x59, 0xC0, 0x46, 0x04, 0x80, 0x55, 0x80, 0x4E, 0x00, 0x80, 
+    0x46, 0x01, 0x08, 0x44, 0x01, 0x55, 0x42, 0x00, 0x90, 0x56, 0x05, 0x55, 0x00, 0x4E, 0x46, 0x00, 
+    0x20, 0x4C, 0x02, 0x70, 0xB0, 0xB0, 0x04, 0x75, 0x70, 0x00, 0x45, 0x00, 0x90, 0x45, 0x04, 0x85, 
+    0x50, 0x70, 0x44, 0x07, 0x85, 0x80, 0x08, 0x58, 0x4C, 0x00, 0x90, 0x4A, 0x02, 0x75, 0x50, 0xF0, 
+    0x0C, 0x06, 0x55, 0x60, 0x24, 0x70, 0x42, 0x05, 0xB6, 0x50, 0x42, 0x42, 0x0C, 0x00, 0x55, 0x80, 
+    0x00, 0xC7, 0x05, 0xC0, 0xA0, 0x02, 0x95, 0x90, 0x46, 0x01, 0x27, 0x47, 0x04, 0x80, 0x95, 0x50, 
+    0x44, 0x03, 0x70, 0x0B, 0x4E, 0x03, 0x08, 0x58, 0x47, 0x02, 0x85, 0x80, 0x55, 0x01, 0x52, 0x49, 
+    0x04, 0x22, 0x05, 0xB0, 0x47, 0x04, 0x87, 0x05, 0x80, 0xA0, 0x04, 0x75, 0x20, 0x20, 0x44, 0x01, 
+    0x89, 0x45, 0x12, 0x55, 0x70, 0x05, 0x52, 0x00, 0x05, 0x50, 0x00, 0x75, 0x50, 0xA0, 0x05, 0x58, 
+    0x00, 0x08, 0x43, 0x00, 0x90, 0x42, 0x00, 0x00, 0x43, 0x03, 0xC5, 0x59, 0x58, 0x00, 0x70, 0xB1, 
+    0x0C, 0x76, 0x59, 0x00, 0x76, 0x92, 0x20, 0x80, 0x42, 0x0C, 0x95, 0x90, 0x85, 0x90, 0x00, 0x58, 
+    0x00, 0x45, 0x02, 0x75, 0xC0, 0x44, 0x19, 0x75, 0x50, 0x00, 0x95, 0x80, 0x07, 0x57, 0x00, 0x0C, 
+    0x55, 0x70, 0x07, 0x57, 0x47, 0x00, 0x00, 0x47, 0x03, 0x25, 0x57, 0xF0, 0x0D, 0x05, 0x55, 0x50, 
+    0x24, 0xB1, 0x0B, 0x2B, 0x66, 0x55, 0x6B, 0x24, 0x22, 0xD5, 0x0C, 0x20, 0x75, 0x57, 0x78, 0x52, 
+    0x00, 0x70, 0xD5, 0x09, 0x20, 0x85, 0x57, 0x85, 0x5C, 0xA0, 0x05, 0x75, 0x77, 0x58, 0xB0, 0x0C, 
+    0x75, 0x58, 0x85, 0x80, 0x00, 0x25, 0x80, 0xB0, 0x04, 0x95, 0x00, 0x70, 0xC5, 0x00, 0x70, 0xF0, 
+    0x0E, 0x42, 0x02, 0x02, 0x70, 0xB1, 0x09, 0x29, 0xB5, 0x57, 0x23, 0xA2, 0xE7, 0x0B, 0x00, 0x20, 
+    0x98, 0x87, 0x00, 0x02, 0xE7, 0x07, 0x09, 0x77, 0x71, 0x79, 0xD0, 0x03, 0x98, 0x87, 0xD0, 0x04, 
+    0x97, 0x81, 0x90, 0xA0, 0xA7, 0xB0, 0x02, 0x10, 0x20, 0xB7, 0x00, 0x90, 0xF0, 0x10, 0x43, 0x00, 
+    0x40, 0x44, 0x01, 0x14, 0xA2, 0x04, 0x43, 0x14, 0x20, 0xF0, 0x13, 0xB2, 0xF0, 0x29, 0x01, 0x22, 
+    0xF0, 0x0B, 0x07, 0x65, 0x69, 0x02, 0x77, 0xC1, 0x01, 0x34, 0xD1, 0x03, 0x44, 0x22, 0xF0, 0x0E, 
+    0x00, 0x40, 0xA1, 0x00, 0x70, 0xF0, 0x28, 0x01, 0x22, 0xF0, 0x0B, 0x09, 0xB6, 0x56, 0x50, 0x02, 
+    0x77, 0xC1, 0x46, 0x02, 0x14, 0x40, 0x56, 0x00, 0x70, 0x7F, 0xF0, 0x01, 0x08, 0x75, 0x79, 0x97, 
+    0x90, 0x20, 0xE1, 0x01, 0x33, 0xD1, 0x01, 0xA2, 0x5B, 0x00, 0x10, 0xF0, 0x25, 0x03, 0x20, 0x22, 
+    0xF0, 0x13, 0x01, 0x27, 0x4E, 0x03, 0x14, 0x42, 0x7F, 0x00, 0x20, 0xC0, 0xB2, 0xF0, 0x10, 0x04, 
+    0x22, 0x42, 0x40, 0x47, 0x00, 0x40, 0xF1, 0x00, 0x05, 0x43, 0x20, 0x02, 0x55, 0x00, 0x70, 0xF0, 
+    0x16, 0x05, 0x22, 0x00, 0x02, 0xB0, 0xD2, 0xF0, 0x11, 0x03, 0x24, 0x22, 0x46, 0x02, 0x13, 0x30, 
+    0xB1, 0x06, 0x41, 0x11, 0xA3, 0x20, 0x74, 0xA2, 0xA0, 0x06, 0x22, 0x20, 0x02, 0x40, 0xB2, 0xF0, 
+    0x12, 0x02, 0x24, 0x40, 0x49, 0x00, 0x40, 0xB1, 0x09, 0x33, 0x11, 0x13, 0x34, 0x22, 0x78, 0x06, 
+    0x24, 0x20, 0x02, 0x40, 0x42, 0xF0, 0x15, 0x04, 0x44, 0x24, 0x70, 0xE1, 0x01, 0x43, 0xC1, 0x00, 
+    0x30, 0xA1, 0x03, 0xA4, 0x42, 0x53, 0x00, 0x40, 0xF0, 0x12, 0x0C, 0x22, 0x24, 0x20, 0x24, 0x44, 
+    0x20, 0x20, 0xA4, 0x00, 0x20, 0xF0, 0x16, 0x0F, 0x24, 0x42, 0xE1, 0x18, 0x81, 0x11, 0xD3, 0x43, 
+    0xC1, 0x07, 0x33, 0x31, 0x11, 0x34, 0x70, 0x04, 0x44, 0x42, 0x20, 0x43, 0x05, 0x24, 0x34, 0x22, 
+    0xF0, 0x18, 0x06, 0x43, 0x42, 0x11, 0x10, 0x42, 0x04, 0x33, 0x44, 0x30, 0xD1, 0x01, 0x33, 0x42, 
+    0x00, 0x20, 0xF0, 0x06, 0x00, 0x40, 0xA1, 0x00, 0x20, 0xF0, 0x07, 0x04, 0x22, 0x02, 0x20, 0xB0, 
+    0x00, 0x20, 0xB4, 0x02, 0x24, 0x30, 0xA4, 0x03, 0x33, 0x42, 0xF0, 0x19, 0x08, 0x24, 0x44, 0x71, 
+    0x18, 0x80, 0x45, 0x00, 0x30, 0xD1, 0x06, 0x33, 0x11, 0x34, 0x20, 0x61, 0x03, 0x22, 0x42, 0xC0, 
+    0x10, 0x22, 0x43, 0x34, 0x44, 0x33, 0x44, 0x33, 0x34, 0x20, 0xF0, 0x1B, 0x0E, 0x4A, 0x42, 0x18, 
+    0x18, 0x81, 0x13, 0x42, 0x40, 0x43, 0x00, 0xD0, 0x42, 0x05, 0x31, 0x14, 0x42, 0x5E, 0x00, 0x20, 
+    0xA4, 0x44, 0x03, 0x22, 0x43, 0x42, 0x03, 0x33, 0xAA, 0x42, 0x00, 0x20, 0xF0, 0x1C, 0x01, 0x24, 
+    0x42, 0x00, 0x80, 0xB1, 0x14, 0x42, 0x23, 0x3D, 0xD1, 0x14, 0x11, 0x33, 0xD1, 0x13, 0x44, 0x20, 
+    0x4E, 0x00, 0x40, 0xF0, 0x04, 0xB4, 0x45, 0x09, 0x43, 0x3A, 0xAA, 0x33, 0xAA, 0xA3, 0x00, 0x40, 
+    0x64, 0x05, 0x02, 0x44, 0x71, 0x44, 0x03, 0xD4, 0x22, 0xA3, 0x0D, 0x13, 0x41, 0x13, 0x3D, 0x11, 
+    0x33, 0x42, 0x4D, 0x00, 0x20, 0xE0, 0x1F, 0x20, 0x00, 0x22, 0x43, 0x44, 0x42, 0x00, 0x02, 0x24, 
+    0x3A, 0x1A, 0x43, 0xA3, 0x44, 0x33, 0x42, 0xF0, 0x1F, 0x02, 0x27, 0x70, 0xF1, 0x00, 0x03, 0x32, 
+    0x24, 0xD3, 0x00, 0x10, 0xE3, 0x01, 0x42, 0xB0, 0x00, 0x20, 0x45, 0x02, 0x40, 0x00, 0xF2, 0x01, 
+    0x05, 0x44, 0x33, 0x44, 0xA2, 0x10, 0x44, 0x43, 0x11, 0xAA, 0x33, 0x34, 0x43, 0x44, 0x20, 0xF0, 
+    0x20, 0x06, 0x22, 0x47, 0x11, 0x80, 0xC1, 0x00, 0x30, 0xC4, 0xA3, 0x00, 0x10, 0xF3, 0x00, 0x02, 
+    0x40, 0x00, 0xB2, 0x44, 0x00, 0x20, 0x48, 0x00, 0x40, 0xA3, 0xA2, 0x08, 0x44, 0x33, 0x31, 0x1A, 
+    0xA0, 0xA3, 0x04, 0x43, 0x42, 0x20, 0xF0, 0x23, 0x03, 0x22, 0x11, 0xA8, 0xA1, 0x01, 0x34, 0xA2, 
+    0x02, 0x44, 0x40, 0xD3, 0x00, 0x10, 0xA3, 0x04, 0x42, 0x22, 0x40, 0x47, 0x02, 0x22, 0x40, 0xA2, 
+    0x02, 0x44, 0x40, 0xA3, 0x08, 0x42, 0x22, 0x43, 0x3A, 0xA0, 0xA1, 0xA3, 0x04, 0x43, 0x34, 0x20, 
+    0xF0, 0x24, 0x02, 0x27, 0x70, 0x43, 0x00, 0x80, 0xA1, 0x08, 0x34, 0x34, 0x42, 0x02, 0x40, 0xA3, 
+    0x02, 0xD3, 0x40, 0xC3, 0xC4, 0x43, 0xF4, 0x00, 0xC3, 0x05, 0x44, 0x43, 0x3A, 0xC1, 0x00, 0xA0, 
+    0xB3, 0x02, 0x42, 0x20, 0xF0, 0x21, 0x0C, 0x22, 0x20, 0x27, 0x17, 0x18, 0x88, 0x50, 0xA1, 0x09, 
+    0xD3, 0x34, 0x22, 0x20, 0x24, 0xC3, 0x01, 0x44, 0xE3, 0x44, 0x03, 0xA3, 0x33, 0x4A, 0xA3, 0xE1, 
+    0x07, 0xA3, 0x34, 0x44, 0x20, 0x69, 0x05, 0x04, 0x24, 0x22, 0xA1, 0x04, 0x88, 0x55, 0x80, 0xA1, 
+    0x09, 0x34, 0x42, 0x24, 0x22, 0x44, 0xD3, 0x06, 0x43, 0x34, 0x43, 0x40, 0x44, 0xA3, 0xA4, 0xF3, 
+    0x00, 0x01, 0xA3, 0xC1, 0x08, 0xAA, 0x33, 0x34, 0x42, 0x20, 0xF0, 0x25, 0x04, 0x24, 0x23, 0x40, 
+    0x44, 0xA8, 0xA1, 0x09, 0x33, 0x34, 0x33, 0x42, 0x44, 0xF3, 0x00, 0x0E, 0x42, 0x43, 0x42, 0x31, 
+    0x11, 0xA3, 0x34, 0x40, 0xF3, 0x01, 0x02, 0xAA, 0xA0, 0xC1, 0x07, 0xAA, 0x34, 0x44, 0x22, 0xF0, 
+    0x28, 0x02, 0x24, 0x40, 0xD1, 0xB8, 0x44, 0xA3, 0x01, 0x42, 0x48, 0x00, 0x30, 0xC4, 0xA1, 0xA3, 
+    0x0A, 0xA3, 0x11, 0x1A, 0x33, 0xA1, 0xA0, 0xD1, 0x06, 0xA4, 0x43, 0x34, 0x20, 0xF0, 0x2B, 0x02, 
+    0x24, 0x40, 0xD1, 0xB8, 0x06, 0x11, 0x13, 0x33, 0x40, 0xA3, 0x01, 0x44, 0xE3, 0x07, 0x24, 0x34, 
+    0x24, 0x33, 0x46, 0xB1, 0x00, 0xA0, 0xF1, 0x01, 0x00, 0xA0, 0xA4, 0x01, 0x22, 0xF0, 0x2D, 0x03, 
+    0x22, 0x24, 0xD1, 0xA8, 0x02, 0x11, 0x10, 0xE3, 0x02, 0x44, 0x20, 0xA3, 0x04, 0x43, 0x34, 0x40, 
+    0x45, 0x03, 0xAA, 0x3A, 0xF1, 0x08, 0x05, 0x42, 0x42, 0x22, 0xF0, 0x30, 0x03, 0x22, 0x24, 0x48, 
+    0x08, 0x81, 0x11, 0x31, 0x13, 0x40, 0xA3, 0x00, 0x40, 0xE3, 0xA4, 0x42, 0x00, 0x30, 0xF1, 0x0A, 
+    0x00, 0x40, 0xA2, 0xF0, 0x34, 0x02, 0x22, 0x40, 0xD1, 0x44, 0xA1, 0xF3, 0x05, 0x07, 0x44, 0x42, 
+    0x33, 0x13, 0x51, 0x04, 0x42, 0x22, 0x00, 0x7C, 0x0D, 0x00, 0x24, 0x11, 0x17, 0x11, 0x18, 0x88, 
+    0xF1, 0x00, 0x03, 0x33, 0xA1, 0x47, 0x06, 0x22, 0x43, 0x13, 0xA0, 0xF1, 0x07, 0x01, 0xA4, 0xC2, 
+    0xF0, 0x37, 0x0B, 0x2E, 0x11, 0x77, 0x11, 0x18, 0x88, 0xF1, 0x00, 0x00, 0xA0, 0xF3, 0x01, 0x42, 
+    0x02, 0x43, 0x30, 0xF1, 0x04, 0xA4, 0x05, 0xA3, 0x42, 0x24, 0x45, 0x01, 0x22, 0xF0, 0x31, 0x05, 
+    0x24, 0x11, 0x1E, 0xA1, 0x01, 0x88, 0xE1, 0x01, 0x34, 0xF3, 0x01, 0xA4, 0x4B, 0x0B, 0xAA, 0x44, 
+    0x41, 0x13, 0x44, 0x42, 0xB0, 0x02, 0x22, 0x20, 0xF0, 0x34, 0x05, 0x41, 0x1E, 0x24, 0xA1, 0x00, 
+    0x80, 0xE1, 0x05, 0x41, 0x13, 0x3A, 0xC3, 0x42, 0x01, 0x4A, 0xF1, 0x07, 0x02, 0xA3, 0x40, 0xA2, 
+    0x00, 0x00, 0xB2, 0xF0, 0x36, 0x05, 0x24, 0x14, 0x24, 0xF1, 0x08, 0x01, 0x3A, 0x44, 0x08, 0x24, 
+    0x33, 0x31, 0x11, 0xA0, 0xD1, 0x06, 0xAA, 0xA3, 0x44, 0x40, 0xA2, 0x00, 0x00, 0xA2, 0xF0, 0x39, 
+    0x04, 0x21, 0x14, 0x20, 0xF1, 0x09, 0x02, 0x33, 0x40, 0x46, 0x0E, 0x4A, 0x33, 0x3A, 0xA1, 0xAA, 
+    0xA3, 0x44, 0x40, 0xF2, 0x02, 0xF0, 0x3C, 0x04, 0x4A, 0x34, 0xE0, 0xF1, 0x09, 0x00, 0xA0, 0xB4, 
+    0x43, 0xF4, 0x02, 0xF2, 0x03, 0xF0, 0x3E, 0x04, 0x24, 0x1A, 0x40, 0xF1, 0x00, 0x00, 0xA0, 0xA1, 
+    0x04, 0x41, 0x11, 0x30, 0xC4, 0x00, 0x30, 0x46, 0x04, 0x22, 0x24, 0x20, 0xB0, 0xA2, 0xF0, 0x42, 
+    0x02, 0x22, 0x40, 0xD1, 0x02, 0x71, 0x10, 0xA4, 0x02, 0x11, 0x30, 0xF4, 0x00, 0xA3, 0xE2, 0xF0, 
+    0x4F, 0x20, 0x22, 0x41, 0x1A, 0x31, 0x11, 0x44, 0x34, 0x22, 0x43, 0x34, 0x22, 0x44, 0x42, 0x22, 
+    0x33, 0x34, 0x00, 0x7F, 0xF0, 0x18, 0x00, 0x20, 0xB4, 0x01, 0xA3, 0xA2, 0x0D, 0x02, 0x43, 0x34, 
+    0x22, 0x02, 0x20, 0x04, 0x43, 0xF0, 0x59, 0xA2, 0x04, 0x44, 0x33, 0x20, 0xB0, 0x04, 0x24, 0x44, 
+    0x20, 0xB0, 0x43, 0xF0, 0x5E, 0x00, 0x20, 0xA4, 0x00, 0x20, 0xB0, 0xA2, 0xB0, 0x03, 0x23, 0x32, 
+    0xF0, 0x61, 0x04, 0x22, 0x44, 0x20, 0xD0, 0x01, 0x22, 0xB0, 0x7F, 0xF0, 0x26, 0x02, 0x22, 0x20, 
+    0xF0, 0x04, 0x01, 0x33, 0xF0, 0x60, 0x00, 0x20, 0xF0, 0x0B, 0x00, 0x40, 0x7F, 0xF0, 0x35, 0x01, 
+    0x24, 0xF0, 0x75, 0x01, 0x22, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 
+    0xFF, 0xF0, 0x86, 
+};
+
+const gfx_image_t GAME_OPENING_SCREEN_LOGO_IMG = {
+    .w = GAME_OPENING_SCREEN_LOGO_W, .h = GAME_OPENING_SCREEN_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = GAME_OPENING_SCREEN_LOGO_PAL, .colors = GAME_OPENING_SCREEN_LOGO_PAL_SIZE,
+    .data = GAME_OPENING_SCREEN_LOGO_RLE, .size = GAME_OPENING_SCREEN_LOGO_RLE_SIZE,
 };
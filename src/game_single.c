@@ -11,22 +11,21 @@
 #include <string.h>
 #include "timer.h"
 #include "gfx.h"
+#include "hud.h"
 #include "ssd1351.h"
-#include "game.h"         // baseline_begin(), game_get_metrics()
+#include "game.h"         // game_get_metrics()
 #include "project.h"
 #include "result1.h"
 #include "rankhist.h"
 #include "team.h"
 #include "game_single_logo.h"
 #include "cheevos.h"
+#include "round_acc.h"
+#include "pqueue.h"
+#include "scene.h"
+#include "lore_text.h"
 
 /* helpers local to single-player */
-static float clampf(float v, float lo, float hi){
-  if (v < lo) return lo;
-  if (v > hi) return hi;
-  return v;
-}
-
 static inline void ui_sep_h(uint8_t y){
   gfx_bar(0, y, 128, 1, COL_DKGRAY);
 }
@@ -54,80 +53,21 @@ typedef enum {
   ST_COUNT_3, ST_COUNT_2, ST_COUNT_1,
   ST_FLEX_CUE, ST_FLEXING,
   ST_RESULT, ST_RANKS,
-  ST_OVERALL_RANKS
+  ST_OVERALL_RANKS,
+  ST_SCENES
 } sp_state_t;
 
-static sp_state_t g_state;
-static uint32_t   g_t0_ms;           // state start time
-static bool       g_drawn_once = false;
-static unsigned   g_last_rank_pct = 0;
+static scene_run_t g_run;
+static unsigned    g_last_rank_pct = 0;
+
+/* P1's metrics for this tick */
+static float g_hz;
+static float g_base;
 
 /* stats for the 10 s flex window */
-static float    g_sum_hz = 0.0f;
-static uint32_t g_cnt_hz = 0;
+static round_stats_t g_round;
 
-static bool        g_dirty;   // true = need to (re)draw this state's screen
-
-static void goto_state(sp_state_t s){
-  g_state = s;
-  g_t0_ms = millis();
-  g_drawn_once = false;
-  g_dirty = true;       // mark the new state as needing a redraw
-  // e.g., when you successfully enter an admin menu
-  cheevos_unlock(ACH_TUTORIAL);
-  if (s == ST_COUNTDOWN_LABEL) baseline_begin(3000u);
-}
-
-// Typewriter-style lore: slowly reveal text over time.
-// NOTE: does NOT clear the screen or draw header; caller does that once via g_dirty.
-static void playground_draw_lore_typewriter(const char* const* lines,
-                                            uint8_t count,
-                                            uint32_t dt,
-                                            uint16_t ms_per_char)
-{
-  uint32_t chars = dt / ms_per_char;  // total characters across all lines
-  uint8_t  y     = 24;                // first line Y
-
-  for (uint8_t i = 0; i < count; ++i) {
-    const char* s = lines[i];
-    if (!s) {
-      continue;
-    }
-
-    size_t len = strlen(s);
-    if (chars == 0u) {
-      break;  // nothing left to draw
-    }
-
-    uint32_t this_chars = chars;
-    if (this_chars > len) {
-      this_chars = len;
-    }
-
-    // Draw prefix of this line
-    char buf[32];  // adjust if ever have >31-char lines
-    if (this_chars > sizeof(buf) - 1u) {
-      this_chars = sizeof(buf) - 1u;
-    }
-    memcpy(buf, s, this_chars);
-    buf[this_chars] = '\0';
-
-    // Draw only the visible prefix; earlier characters are redrawn in-place
-    gfx_text2(4, y, buf, COL_WHITE, 1);
-
-    y = (uint8_t)(y + 10u);
-    if (y > 120u) {
-      break;  // off-screen
-    }
-
-    // Consume characters for this line (+1 “newline” spacer)
-    if (chars > (uint32_t)len + 1u) {
-      chars -= (uint32_t)len + 1u;
-    } else {
-      chars = 0u;
-    }
-  }
-}
+static gfx_scroll_t g_lore_view;  // tutorial text page
 
 // Live flex bar geometry (single-player)
 #define FLEX_BX  6
@@ -135,20 +75,8 @@ static void playground_draw_lore_typewriter(const char* const* lines,
 #define FLEX_BW  116
 #define FLEX_BH  18
 
-static const char* g_playground_intro_lines[] = {
-  "Hello newbie!",
-  "Welcome to the world",
-  "of PULSEBOUND!",
-  "A place of muscle,",
-  "but don't worry!",
-  "I'll help you!",
-  "Remember 2 rules:",
-  "1. Flex.",
-  "2. Win.",
-  "Got it? Goodluck!"
-};
-static const uint8_t g_playground_intro_count =
-    sizeof(g_playground_intro_lines)/sizeof(g_playground_intro_lines[0]);
+static hud_num_t g_hz_label;
+static hud_bar_t g_flex_bar;
 
 static void draw_flex_static(float baseline_hz)
 {
@@ -169,217 +97,141 @@ static void draw_flex_static(float baseline_hz)
   const char *rlabel = "250 Hz";
   uint8_t rx = FLEX_BX + FLEX_BW - (uint8_t)(6 * 1 * strlen(rlabel));
   gfx_text2(rx, FLEX_BY + FLEX_BH + 6, rlabel, COL_WHITE, 1);
+
+  // live widgets: empty bar now, label on the first update
+  hud_num_init(&g_hz_label, 6, 28, 2, "Hz: ", 5, 1, "", COL_WHITE, COL_BLACK);
+  hud_bar_init(&g_flex_bar, FLEX_BX, FLEX_BY, FLEX_BW, FLEX_BH, 250.0f, COL_RED, COL_GRAY);
 }
 
 static void draw_flex_dynamic(float hz)
 {
-  // update Hz text
+  // both widgets repaint only what changed since the last tick
+  hud_num_set(&g_hz_label, hz);
+  hud_bar_set(&g_flex_bar, hz);
+}
+
+/*------------------------------- scenes ------------------------------------*/
+
+static void logo_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  uint8_t x = (uint8_t)((128 - GAME_SINGLE_LOGO_W) / 2);
+  uint8_t y = (uint8_t)((128 - GAME_SINGLE_LOGO_H) / 2);
+
+  gfx_blit_image(x, y, &GAME_SINGLE_LOGO_IMG);
+}
+
+static void pmode_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_header("Mode: Playground", COL_WHITE);
+  ui_sep_h(18);
+}
+
+static void tutorial_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("Playground", COL_WHITE);
+  gfx_scroll_begin_bpe(&g_lore_view, &LORE_TEXT[LORE_PLAYGROUND_INTRO], 24);
+}
+
+static void tutorial_tick(const scene_ctx_t *c){
+  gfx_scroll_type(&g_lore_view, c->dt / 40u);
+}
+
+// A player calibrated in the queue goes straight to the countdown
+static uint8_t tutorial_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
+  return pqueue_round_begin(1u, 3000u) ? ST_COUNT_3 : ST_COUNTDOWN_LABEL;
+}
+
+static void label_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_header("READY?", COL_WHITE);
+  ui_sep_h(18);
+}
+
+static void flexing_enter(const scene_ctx_t *c){
+  gfx_header("FLEXING", COL_WHITE);
+  draw_flex_static(g_base);
+  round_acc_begin(0u, pqueue_seat(0), c->t0, c->ms, ROUND_ACTIVE_HZ);
+}
+
+static void flexing_tick(const scene_ctx_t *c){
+  (void)c;
+  draw_flex_dynamic(g_hz);
+}
+
+static uint8_t flexing_exit(const scene_ctx_t *c){
+  return (c->done && round_acc_done(0u, c->now, &g_round)) ? SCENE_NEXT : SCENE_STAY;
+}
+
+static void result_enter(const scene_ctx_t *c){
+  (void)c;
+  float avg_hz = g_round.mean_hz;
+
+  gfx_clear(COL_BLACK);
+  gfx_header("RESULT", COL_WHITE);
+  ui_sep_h(18);
+
   char line[32];
-  snprintf(line, sizeof(line), "Hz: %.1f", hz);
-  gfx_bar(6, 28, 120, 16, COL_BLACK);
-  gfx_text2(6, 28, line, COL_WHITE, 2);
-
-  // update red bar only
-  gfx_bar(FLEX_BX, FLEX_BY, FLEX_BW, FLEX_BH, COL_GRAY);
-  uint8_t fw = (uint8_t)((clampf(hz, 0.0f, 250.0f) * (float)FLEX_BW) / 250.0f);
-  gfx_bar(FLEX_BX, FLEX_BY, fw, FLEX_BH, COL_RED);
+  snprintf(line, sizeof(line), "Avg: %.1f Hz", avg_hz);
+  gfx_text2(4, 28, line, COL_WHITE, 1);
+
+  snprintf(line, sizeof(line), "Base: %.1f Hz", g_base);
+  gfx_text2(4, 38, line, COL_WHITE, 1);
+
+  unsigned pct_rank = rankhist_percentile(avg_hz);
+  g_last_rank_pct = pct_rank;
+
+  snprintf(line, sizeof(line), "You beat %u%%!", pct_rank);
+  gfx_text2(4, 52, line, COL_CYAN, 1);
+
+  // Unlock cheevo based on rank
+  int idx = rank_index_from_percent(pct_rank);
+  cheevos_unlock_for_rank(idx);
 }
 
-void game_single_init(void){
-  g_sum_hz = 0.0f;
-  g_cnt_hz = 0;
-  goto_state(ST_LOGO);
+static void ranks_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("RANK HISTORY", COL_WHITE);
+  ui_sep_h(18);
+
+  rankhist_draw(4, 24, 120, 90, g_last_rank_pct);
 }
 
-bool game_single_tick(void){
-  uint32_t now = millis();
-  uint32_t dt  = now - g_t0_ms;
-
-  float   hz   = 0.0f;
-  float   base = 0.0f;
-  uint8_t pct  = 0;
-  game_get_metrics(&hz, &pct, &base);
-
-  switch (g_state){
-
-    case ST_LOGO: {
-      if (!g_drawn_once){
-        g_drawn_once = true;
-        gfx_clear(COL_BLACK);
-        uint8_t x = (uint8_t)((128 - GAME_SINGLE_LOGO_W) / 2);
-        uint8_t y = (uint8_t)((128 - GAME_SINGLE_LOGO_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      GAME_SINGLE_LOGO_W, GAME_SINGLE_LOGO_H,
-                      GAME_SINGLE_LOGO_IDX,
-                      GAME_SINGLE_LOGO_PAL);
-      }
-      if (dt >= 3000u){
-        goto_state(ST_PMODE);
-      }
-    } break;
-
-    case ST_PMODE: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_header("Mode: Playground", COL_WHITE);
-        ui_sep_h(18);
-      }
-      if (dt >= 3000u){
-        goto_state(ST_TUTORIAL);
-      }
-    } break;
-
-    case ST_TUTORIAL: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("Playground", COL_WHITE);
-      }
-
-      playground_draw_lore_typewriter(
-          g_playground_intro_lines,
-          g_playground_intro_count,
-          dt,
-          40u);
-
-      if (dt >= 10000u){
-        goto_state(ST_COUNTDOWN_LABEL);
-      }
-    } break;
-
-    case ST_COUNTDOWN_LABEL: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_header("READY?", COL_WHITE);
-        ui_sep_h(18);
-      }
-      if (dt >= 2000u){
-        goto_state(ST_COUNT_3);
-      }
-    } break;
-
-    case ST_COUNT_3: {
-      gfx_header("3", COL_WHITE);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_COUNT_2);
-      }
-    } break;
-
-    case ST_COUNT_2: {
-      gfx_header("2", COL_YELLOW);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_COUNT_1);
-      }
-    } break;
-
-    case ST_COUNT_1: {
-      gfx_header("1", COL_GREEN);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_FLEX_CUE);
-      }
-    } break;
-
-    case ST_FLEX_CUE: {
-      gfx_header("FLEX!", COL_RED);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_FLEXING);
-      }
-    } break;
-
-    case ST_FLEXING: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_header("FLEXING", COL_WHITE);
-        draw_flex_static(base);
-      }
-
-      draw_flex_dynamic(hz);
-      g_sum_hz += hz;
-      g_cnt_hz++;
-
-      if (dt >= 10000u){
-        goto_state(ST_RESULT);
-      }
-    } break;
-
-    case ST_RESULT: {
-      if (g_dirty){
-        g_dirty = false;
-
-        float avg_hz = (g_cnt_hz ? (g_sum_hz / (float)g_cnt_hz) : 0.0f);
-
-        gfx_clear(COL_BLACK);
-        gfx_header("RESULT", COL_WHITE);
-        ui_sep_h(18);
-
-        char line[32];
-        snprintf(line, sizeof(line), "Avg: %.1f Hz", avg_hz);
-        gfx_text2(4, 28, line, COL_WHITE, 1);
-
-        snprintf(line, sizeof(line), "Base: %.1f Hz", base);
-        gfx_text2(4, 38, line, COL_WHITE, 1);
-
-        unsigned pct_rank = rankhist_percentile(avg_hz);
-        g_last_rank_pct = pct_rank;
-
-        snprintf(line, sizeof(line), "You beat %u%%!", pct_rank);
-        gfx_text2(4, 52, line, COL_CYAN, 1);
-
-        // Unlock cheevo based on rank
-        int idx = rank_index_from_percent(pct_rank);
-        cheevos_unlock_for_rank(idx);
-      }
-
-      if (dt >= 6000u){
-        goto_state(ST_RANKS);
-      }
-    } break;
-
-    case ST_RANKS: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("RANK HISTORY", COL_WHITE);
-        ui_sep_h(18);
-
-        rankhist_draw(4, 24, 120, 90, g_last_rank_pct);
-      }
-
-      if (dt >= 8000u){
-        goto_state(ST_OVERALL_RANKS);
-      }
-    } break;
-
-    case ST_OVERALL_RANKS: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("TEAM RANKS", COL_WHITE);
-        ui_sep_h(18);
-
-        team_draw(4, 24, 120, 90);
-      }
-
-      if (dt >= 8000u){
-        goto_state(ST_LOGO);
-      }
-    } break;
-
-    default:
-      goto_state(ST_LOGO);
-      break;
-  }
-
-  return false;
+static void overall_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("TEAM RANKS", COL_WHITE);
+  ui_sep_h(18);
+
+  team_draw(4, 24, 120, 90);
 }
 
-// Single-player metrics: simple wrapper using global game metrics.
-void game_single_metrics(float *hz, uint8_t *pct, float *base){
-  game_get_metrics(hz, pct, base);
+// Countdown and flex scenes draw over the screen before them; only the
+// full-screen scenes fade.
+static const scene_t k_scenes[ST_SCENES] = {
+  //                      ms      next                flags       enter           tick           exit
+  [ST_LOGO]            = { 3000u, ST_PMODE,           SCENE_FADE, logo_enter,     NULL,          NULL          },
+  [ST_PMODE]           = { 3000u, ST_TUTORIAL,        0,          pmode_enter,    NULL,          NULL          },
+  [ST_TUTORIAL]        = {10000u, ST_COUNTDOWN_LABEL, SCENE_FADE, tutorial_enter, tutorial_tick, tutorial_exit },
+  [ST_COUNTDOWN_LABEL] = { 2000u, ST_COUNT_3,         0,          label_enter,    NULL,          NULL          },
+  SCENE_COUNTDOWN(ST_COUNT_3, ST_FLEXING),
+  [ST_FLEXING]         = {10000u, ST_RESULT,          0,          flexing_enter,  flexing_tick,  flexing_exit  },
+  [ST_RESULT]          = { 6000u, ST_RANKS,           SCENE_FADE, result_enter,   NULL,          NULL          },
+  [ST_RANKS]           = { 8000u, ST_OVERALL_RANKS,   SCENE_FADE, ranks_enter,    NULL,          NULL          },
+  [ST_OVERALL_RANKS]   = { 8000u, ST_LOGO,            SCENE_FADE, overall_enter,  NULL,          NULL          },
+};
+
+void game_single_init(void){
+  g_round = (round_stats_t){0};
+  cheevos_unlock(ACH_TUTORIAL);
+  scene_start(&g_run, k_scenes, ST_SCENES, ST_LOGO, millis());
 }
 
+bool game_single_tick(void){
+  game_get_metrics(&g_hz, NULL, &g_base);
+
+  return scene_tick(&g_run, millis());
+}
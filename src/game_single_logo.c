@@ -6,345 +6,227 @@ const uint16_t GAME_SINGLE_LOGO_PAL[GAME_SINGLE_LOGO_PAL_SIZE] = {
     0xAD13, 0xD655, 0x5ACA, 0xE71A, 0xCDD3, 0x9183, 0xDACB, 0x5AF4, 
 };
 
-const uint8_t GAME_SINGLE_LOGO_IDX[(GAME_SINGLE_LOGO_W * GAME_SINGLE_LOGO_H) / 2] = {
-    0x44, 0xAA, 0xAA, 0xAA, 0xA4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x00, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x0A, 
-    0x44, 0x44, 0x41, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x44, 0x44, 0x44, 0xA8, 
-    0x00, 0x88, 0x88, 0x88, 0x88, 0xCB, 0xBB, 0xBB, 0xBB, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x2A, 0xAA, 0xAA, 0xA2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0xAB, 0xB8, 
-    0x44, 0x44, 0x41, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x44, 0x44, 0x4A, 0xA8, 
-    0xB0, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xBB, 0xBB, 0xBB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x2A, 0xAA, 0xAA, 0xA2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x0B, 0xB7, 
-    0x44, 0x44, 0x44, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x44, 0x44, 0xAA, 0xA8, 
-    0xB0, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xBB, 0xBB, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x12, 0xAA, 0xAA, 0xAA, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xA0, 0xBB, 0x8A, 
-    0x44, 0x44, 0x11, 0x44, 0x11, 0x11, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x44, 0xAA, 0xAA, 0x78, 
-    0xBB, 0x88, 0x88, 0x88, 0x88, 0x88, 0xBB, 0xBB, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x12, 0x2A, 0xAA, 0xAA, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x8B, 0xB8, 0x8A, 
-    0x44, 0x44, 0x12, 0x14, 0x41, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x1A, 0xAA, 0xAA, 0xA7, 0x88, 
-    0xBB, 0x88, 0x88, 0x88, 0x88, 0x88, 0xBB, 0xBB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0x2A, 0xAA, 0xAA, 0xA2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x0B, 0xB0, 0x8A, 
-    0x44, 0x44, 0x4A, 0x14, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA8, 0x67, 0xAA, 0xA8, 0x88, 
-    0xCB, 0x88, 0x88, 0x88, 0x88, 0x88, 0xC9, 0xB9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0xAA, 0xAA, 0xAA, 0xA2, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x02, 0x22, 
-    0x22, 0x22, 0x02, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xA0, 0xBB, 0xB0, 0x8A, 
-    0x44, 0x44, 0x4A, 0xA4, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x78, 0x87, 0xAA, 0x78, 0x88, 
-    0x8B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB8, 0x76, 0x60, 0x00, 0x66, 0x66, 0x66, 0x60, 0x00, 
-    0x21, 0x11, 0xAA, 0xAA, 0xAA, 0xAA, 0x24, 0x41, 0x11, 0x11, 0x11, 0x44, 0x41, 0x11, 0x10, 0x22, 
-    0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x80, 0x00, 0x08, 0x80, 
-    0x14, 0x44, 0x41, 0xAA, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x78, 0x87, 0x77, 0x88, 0x88, 
-    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xC6, 0x77, 0x66, 0x66, 0x73, 0x33, 0x37, 0x60, 0x00, 
-    0x22, 0x11, 0x2A, 0xAA, 0xAA, 0xAA, 0x22, 0x4D, 0x55, 0x55, 0x55, 0xD4, 0x4D, 0x55, 0xA0, 0x22, 
-    0x20, 0x15, 0x55, 0x55, 0x52, 0x02, 0x55, 0x50, 0x25, 0x55, 0xA0, 0xA0, 0x55, 0x55, 0x50, 0x88, 
-    0x55, 0x55, 0x55, 0x57, 0x14, 0x45, 0x55, 0x55, 0x5D, 0x14, 0xD5, 0x50, 0x0E, 0x55, 0x78, 0xE5, 
-    0x5E, 0xE5, 0x5E, 0x88, 0xE5, 0x55, 0x55, 0x50, 0x33, 0x37, 0x77, 0x33, 0x33, 0x36, 0x00, 0x00, 
-    0x22, 0x11, 0x2A, 0xAA, 0xAA, 0xAA, 0xA2, 0x4D, 0x55, 0x55, 0x55, 0x5A, 0x05, 0x55, 0xF0, 0x22, 
-    0x22, 0x55, 0x55, 0x55, 0x50, 0x02, 0x55, 0x00, 0xA5, 0x55, 0x00, 0x05, 0x55, 0x55, 0x50, 0x08, 
-    0x55, 0x55, 0x55, 0x55, 0x0A, 0x75, 0x55, 0x55, 0x55, 0x04, 0xD5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x55, 0x55, 0x55, 0x00, 0xE5, 0x55, 0x55, 0x55, 0x7A, 0x33, 0x33, 0x33, 0x23, 0x60, 0x00, 0x00, 
-    0x21, 0x11, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0x0D, 0x55, 0x00, 0x05, 0x57, 0x05, 0x55, 0xF0, 0x22, 
-    0x02, 0x55, 0x50, 0x05, 0x50, 0x0A, 0x55, 0x00, 0xA5, 0x55, 0x0F, 0xE5, 0x5E, 0x75, 0x55, 0x00, 
-    0x55, 0x50, 0x00, 0x55, 0x0F, 0xE5, 0x50, 0x00, 0x55, 0xF0, 0xD5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x70, 0x55, 0x00, 0xE5, 0x50, 0x70, 0x55, 0x70, 0x33, 0x33, 0x32, 0x23, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x0D, 0x55, 0xF0, 0x05, 0x57, 0x0D, 0x55, 0xF0, 0x22, 
-    0x02, 0x55, 0x00, 0x05, 0x50, 0x0A, 0x55, 0x00, 0xA5, 0x55, 0x00, 0xE5, 0x00, 0x0E, 0x55, 0x00, 
-    0x05, 0x50, 0x00, 0x55, 0x00, 0x05, 0x5F, 0x00, 0x55, 0xF0, 0xD5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x5F, 0x00, 0x55, 0x00, 0x75, 0x50, 0x00, 0x55, 0x70, 0x23, 0x33, 0x32, 0x36, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x0D, 0x55, 0xF0, 0xD5, 0x57, 0x0D, 0x55, 0xF0, 0x22, 
-    0x02, 0x55, 0x00, 0xA5, 0x50, 0x0A, 0x55, 0x00, 0xA5, 0x55, 0x00, 0xE5, 0x00, 0x0E, 0x57, 0x00, 
-    0xE5, 0x50, 0x4D, 0x55, 0x00, 0x55, 0x5F, 0x0D, 0x55, 0xF0, 0xD5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0x75, 0x50, 0x07, 0x55, 0x70, 0x22, 0x23, 0x23, 0x70, 0x00, 0x00, 0x00, 
-    0x21, 0x14, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x55, 0xF0, 0xD5, 0x57, 0x05, 0x55, 0xF0, 0x22, 
-    0x02, 0x55, 0x00, 0xA5, 0x50, 0x0A, 0x55, 0x00, 0x05, 0x55, 0x00, 0xE5, 0x00, 0x0E, 0xF0, 0x08, 
-    0xE5, 0x50, 0x0D, 0x55, 0x00, 0xD5, 0x5F, 0x0D, 0x55, 0xF0, 0xD5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x07, 0x55, 0x00, 0xE5, 0x50, 0x07, 0x55, 0x70, 0x22, 0x22, 0x23, 0x60, 0x00, 0x00, 0x00, 
-    0x21, 0x14, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x55, 0xF0, 0xD5, 0x57, 0xFE, 0x55, 0xFF, 0x24, 
-    0x01, 0x55, 0x00, 0xA5, 0x50, 0x0A, 0x55, 0x00, 0xA5, 0x50, 0x00, 0xE5, 0x00, 0x00, 0x8E, 0x88, 
-    0xE5, 0x50, 0x0D, 0x55, 0x00, 0xD5, 0x5F, 0x00, 0x55, 0xF0, 0xE5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x07, 0x55, 0x00, 0x05, 0x50, 0x07, 0x55, 0x70, 0xA2, 0x22, 0x36, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x44, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x55, 0xF0, 0x05, 0x57, 0x0E, 0x55, 0xF0, 0x77, 
-    0xA7, 0x55, 0x00, 0xD5, 0x50, 0x0A, 0x55, 0x50, 0x55, 0x50, 0x00, 0xE5, 0x00, 0x8E, 0x55, 0xF8, 
-    0xE5, 0x50, 0x05, 0x55, 0x00, 0xD5, 0x5F, 0x0E, 0x55, 0xF0, 0xE5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x07, 0x55, 0x00, 0xE5, 0x50, 0x07, 0x55, 0x70, 0xA2, 0x23, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x44, 0x2A, 0xAA, 0xAA, 0xAA, 0x77, 0x6E, 0x55, 0xE0, 0x55, 0x57, 0x0E, 0x55, 0xF8, 0x00, 
-    0x00, 0x55, 0x55, 0x55, 0x50, 0x0A, 0x55, 0x55, 0x55, 0x50, 0x00, 0xE5, 0x00, 0x05, 0x55, 0x00, 
-    0xE5, 0x50, 0x55, 0x55, 0x00, 0xD5, 0x50, 0x0D, 0x55, 0xF0, 0xE5, 0x5F, 0x0D, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0xE5, 0x50, 0x07, 0x55, 0x70, 0x87, 0x23, 0x60, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x44, 0xAA, 0xAA, 0xAA, 0x06, 0x66, 0x6E, 0x55, 0x55, 0x55, 0x0F, 0xF0, 0x55, 0xF8, 0x00, 
-    0x00, 0x55, 0x55, 0x55, 0x50, 0x0A, 0x55, 0x55, 0x05, 0x50, 0x00, 0xE5, 0x00, 0x55, 0x55, 0x00, 
-    0xE5, 0x55, 0x55, 0x00, 0x00, 0xD5, 0x50, 0x0D, 0x55, 0xF0, 0xE5, 0x5F, 0x0D, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0x75, 0x50, 0x07, 0x55, 0x70, 0x88, 0x37, 0x60, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x44, 0xAA, 0xAA, 0x06, 0x66, 0x77, 0x60, 0x55, 0x55, 0x0F, 0x0F, 0xA0, 0x55, 0xF8, 0x00, 
-    0x00, 0x55, 0x55, 0x05, 0x50, 0x0A, 0x55, 0x0F, 0x00, 0x50, 0x00, 0xE5, 0x00, 0x05, 0x55, 0x00, 
-    0xE5, 0x55, 0x55, 0x00, 0x04, 0xD5, 0x50, 0x0D, 0x55, 0xF0, 0xE5, 0x5F, 0xF7, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0xE5, 0x50, 0x00, 0x55, 0x70, 0x88, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x42, 0xAA, 0xA6, 0x88, 0x8A, 0x23, 0x2D, 0x55, 0x0F, 0x0F, 0xA7, 0x6E, 0x55, 0xF8, 0x00, 
-    0x00, 0x55, 0x0F, 0x05, 0x50, 0x0A, 0x5A, 0x00, 0xF5, 0x50, 0x00, 0xE5, 0x00, 0x8E, 0x55, 0x00, 
-    0xE5, 0x50, 0x55, 0x00, 0x44, 0xD5, 0x5F, 0x00, 0x55, 0xF0, 0xE5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0xE5, 0x50, 0x0C, 0x55, 0x70, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x4A, 0xAA, 0xA6, 0x88, 0x82, 0x11, 0x1D, 0x55, 0x00, 0x76, 0x66, 0x6E, 0x55, 0xF8, 0x00, 
-    0x00, 0x55, 0xE0, 0xA5, 0x50, 0x0A, 0xA0, 0x0A, 0x65, 0x50, 0x00, 0xE5, 0x00, 0x0E, 0x55, 0x00, 
-    0xE5, 0x50, 0x05, 0x50, 0x44, 0xD5, 0x5F, 0x0E, 0x55, 0xFF, 0xE5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0xE5, 0x50, 0x0C, 0x55, 0x70, 0x07, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x42, 0xAA, 0xA6, 0x88, 0x82, 0x11, 0x20, 0x55, 0x0F, 0x77, 0x76, 0x70, 0x55, 0xF8, 0x00, 
-    0x00, 0x55, 0x0F, 0xA5, 0x50, 0x0A, 0xAA, 0x77, 0x60, 0x50, 0x00, 0xE5, 0x00, 0x0E, 0x55, 0x00, 
-    0xE5, 0x50, 0x05, 0x50, 0x04, 0x55, 0x5F, 0xFE, 0x55, 0xF0, 0xE5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0xE5, 0x50, 0x0C, 0x55, 0x70, 0x77, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x44, 0x42, 0x2A, 0x68, 0x82, 0x13, 0x60, 0x55, 0x0F, 0x33, 0x33, 0x25, 0x55, 0xF0, 0x00, 
-    0x00, 0x55, 0x0F, 0x75, 0x50, 0x0A, 0x35, 0x00, 0x80, 0x50, 0x00, 0xE5, 0x00, 0x0E, 0x55, 0x00, 
-    0xE5, 0x50, 0x05, 0x55, 0x00, 0x55, 0x5F, 0x0E, 0x55, 0xF0, 0xE5, 0x5F, 0x0E, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0x75, 0x50, 0x08, 0x55, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x44, 0x41, 0x22, 0xA6, 0x62, 0x36, 0x30, 0x55, 0x00, 0x21, 0x11, 0x30, 0x55, 0xEE, 0xEE, 
-    0x00, 0x55, 0x0F, 0x75, 0x50, 0x0A, 0x55, 0x57, 0xE5, 0x55, 0x00, 0xE5, 0x5E, 0xE5, 0x55, 0x00, 
-    0xE5, 0x5F, 0x01, 0x55, 0x00, 0x55, 0x50, 0x75, 0x55, 0xF0, 0xE5, 0x5E, 0xEE, 0x55, 0x00, 0xE5, 
-    0x50, 0x0E, 0x55, 0x0F, 0xE5, 0x50, 0x7E, 0x55, 0x70, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x44, 0x12, 0x22, 0x2A, 0xA3, 0x37, 0x30, 0x55, 0xF0, 0x11, 0x23, 0x6E, 0x55, 0x55, 0x55, 
-    0x78, 0x55, 0x0F, 0x75, 0x50, 0x0F, 0x05, 0x55, 0x55, 0x50, 0x00, 0xE5, 0x55, 0x55, 0x55, 0x00, 
-    0xE5, 0x5F, 0x0A, 0x55, 0x5F, 0x75, 0x55, 0x55, 0x55, 0xF0, 0xE5, 0x55, 0x55, 0x55, 0xF0, 0xE5, 
-    0x50, 0x0E, 0x55, 0x00, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x44, 0x22, 0x22, 0x2A, 0x22, 0x33, 0x30, 0x55, 0xF0, 0x37, 0x77, 0x70, 0x55, 0x55, 0x55, 
-    0x0F, 0x55, 0x0F, 0x65, 0x50, 0x00, 0x65, 0x55, 0x55, 0x00, 0x00, 0xCE, 0x55, 0x55, 0x55, 0x00, 
-    0xE5, 0x50, 0xFA, 0x75, 0x57, 0xF5, 0x55, 0x55, 0x50, 0x00, 0x8E, 0x55, 0x55, 0x50, 0x08, 0xE5, 
-    0x50, 0x0E, 0x55, 0x0F, 0xE5, 0x55, 0x55, 0x57, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x44, 0x22, 0x22, 0xAA, 0x21, 0x11, 0x12, 0xAF, 0xFF, 0x60, 0x73, 0x33, 0xAF, 0xFF, 0xFF, 
-    0xF0, 0x60, 0xFF, 0x66, 0xFF, 0xF0, 0x66, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 
-    0x88, 0x00, 0x08, 0x70, 0xFF, 0xFA, 0xFF, 0xFF, 0x00, 0xF8, 0xCC, 0x8F, 0xFF, 0x00, 0x88, 0x08, 
-    0xF0, 0x00, 0x7F, 0xFF, 0x77, 0xFF, 0xFF, 0xF0, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x44, 0x44, 0x12, 0xAA, 0xAA, 0x21, 0x11, 0x23, 0x76, 0x77, 0x73, 0x33, 0x11, 0x37, 0x71, 0x26, 
-    0x66, 0x06, 0x66, 0x66, 0x68, 0x88, 0x66, 0x68, 0x88, 0x88, 0x8C, 0x00, 0xB0, 0x00, 0x00, 0x00, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x08, 0x88, 0x80, 0x00, 0x0C, 0xC6, 0x67, 0x60, 0x00, 
-    0xC8, 0x66, 0x7A, 0xA2, 0x11, 0x2A, 0xA8, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x44, 0x44, 0x12, 0xAA, 0xA2, 0x11, 0x11, 0x23, 0x33, 0x33, 0x22, 0x11, 0x23, 0x60, 0x72, 0x20, 
-    0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x88, 0x88, 0x88, 0x88, 0xCC, 0xC0, 
-    0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x0C, 0x00, 0x03, 0x36, 0xCC, 0x00, 
-    0x00, 0x67, 0x32, 0x11, 0x11, 0x12, 0x37, 0x87, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
-    0x44, 0x44, 0x22, 0x04, 0x12, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x27, 0x66, 0x73, 0x32, 0x30, 
-    0x00, 0x00, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x00, 0x00, 0x00, 0x17, 0x0C, 0xC0, 0x06, 
-    0x66, 0x73, 0x22, 0x11, 0x23, 0x76, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
-    0x44, 0x44, 0x22, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x77, 0x33, 0x33, 0x23, 0x00, 
-    0x00, 0x06, 0x67, 0x77, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x88, 0x00, 0x08, 0x88, 0x88, 0x88, 
-    0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x00, 0x90, 0x62, 0x20, 0x00, 0x06, 0x77, 
-    0x73, 0x32, 0x11, 0x13, 0x76, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 
-    0x44, 0x44, 0x20, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 0x66, 0x33, 0x33, 0x32, 0x16, 0x00, 
-    0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 
-    0x0B, 0xB0, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x6C, 0x06, 0x31, 0x36, 0x00, 0x77, 0x73, 
-    0x32, 0x21, 0x11, 0x70, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x67, 
-    0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x12, 0x73, 0x33, 0x21, 0x11, 0x11, 0x26, 0x00, 
-    0x00, 0x66, 0x66, 0x66, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x88, 0x88, 0x88, 0x88, 0xC0, 0xBB, 
-    0xBB, 0xBB, 0xB0, 0x08, 0x88, 0x8A, 0x88, 0x88, 0x80, 0x00, 0x72, 0x13, 0x33, 0x37, 0x33, 0x32, 
-    0x11, 0x11, 0x17, 0x66, 0x00, 0x07, 0x77, 0x77, 0x00, 0x00, 0x66, 0x00, 0x00, 0x60, 0x66, 0x67, 
-    0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x12, 0x37, 0x60, 0x00, 
-    0x06, 0x60, 0x00, 0x66, 0x7A, 0x66, 0x66, 0x66, 0x66, 0x66, 0x88, 0x88, 0x88, 0x88, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0x00, 0x88, 0x88, 0xA8, 0x88, 0x00, 0x63, 0x21, 0x13, 0x32, 0x22, 0x11, 0x11, 
-    0x11, 0x11, 0x77, 0x76, 0x07, 0x31, 0x11, 0x13, 0x60, 0x00, 0x66, 0x60, 0x06, 0x66, 0x67, 0x66, 
-    0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 
-    0x06, 0x00, 0x00, 0x06, 0x32, 0xA6, 0x66, 0x66, 0x66, 0x88, 0x88, 0x86, 0x68, 0x8B, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0x88, 0x8A, 0x86, 0x33, 0x21, 0x11, 0x33, 0x22, 0x21, 0x11, 0x11, 
-    0x44, 0x12, 0x76, 0x67, 0x31, 0x11, 0x11, 0x12, 0x76, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x67, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x43, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x67, 0x22, 0x2A, 0x66, 0x68, 0x88, 0x88, 0x88, 0x86, 0x88, 0x0B, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xB0, 0x88, 0x88, 0x88, 0x80, 0x73, 0x22, 0x11, 0x11, 0x32, 0x22, 0x21, 0x11, 0x44, 
-    0x41, 0x26, 0x06, 0x73, 0x11, 0x11, 0x44, 0x41, 0x77, 0x66, 0x06, 0x06, 0x66, 0x66, 0x66, 0x67, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x41, 0x11, 0x11, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x63, 0x20, 0x2A, 0xA6, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8C, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xC8, 0x86, 0x77, 0x77, 0x77, 0x7A, 0xA3, 0x32, 0x11, 0x23, 0x32, 0x22, 0x21, 0x14, 0x44, 
-    0x13, 0x66, 0x77, 0x31, 0x11, 0x11, 0x44, 0x12, 0x76, 0x66, 0x66, 0x06, 0x66, 0x67, 0x66, 0x73, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x72, 0x00, 0x02, 0xA6, 0x88, 0x88, 0x8C, 0x99, 0x98, 0x88, 0x0B, 0xBB, 0xBB, 
-    0x88, 0x67, 0x77, 0x73, 0x33, 0x22, 0x2A, 0x2A, 0x77, 0x78, 0x86, 0x23, 0x22, 0x21, 0x44, 0x11, 
-    0x26, 0x77, 0x73, 0x21, 0x11, 0x11, 0x11, 0x27, 0x77, 0x76, 0x66, 0x06, 0x66, 0x66, 0x67, 0x32, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x21, 0x11, 0x11, 0x11, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x32, 0x04, 0x02, 0x2A, 0x68, 0x89, 0x99, 0x99, 0x99, 0x88, 0x8B, 0xB0, 0x86, 
-    0x77, 0x77, 0x77, 0x73, 0x33, 0x22, 0x22, 0x21, 0xA8, 0x88, 0x86, 0x23, 0x32, 0x14, 0x41, 0x11, 
-    0x77, 0x77, 0x22, 0x12, 0x11, 0x11, 0x12, 0x60, 0x72, 0x77, 0x66, 0x66, 0x76, 0x66, 0x77, 0x22, 
-    0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x11, 0x11, 0x11, 0x11, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x21, 0x00, 0x22, 0x2A, 0xA6, 0x89, 0x99, 0x99, 0x99, 0xC8, 0xCB, 0x86, 0x77, 
-    0x77, 0x77, 0x77, 0x73, 0x33, 0x22, 0x22, 0x22, 0x27, 0x88, 0x88, 0x32, 0x32, 0x12, 0x21, 0x12, 
-    0x73, 0x32, 0x22, 0x11, 0x12, 0x27, 0x76, 0x06, 0x77, 0x77, 0x37, 0x67, 0x76, 0x66, 0x73, 0x22, 
-    0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x66, 0x21, 0x44, 0x02, 0x22, 0xAA, 0x88, 0x99, 0x99, 0x99, 0x99, 0xC8, 0x63, 0x37, 
-    0x77, 0x77, 0x77, 0x73, 0x33, 0x22, 0x22, 0x22, 0x1A, 0x88, 0x88, 0x87, 0x32, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x11, 0x11, 0x37, 0x76, 0x73, 0x21, 0x22, 0x77, 0x77, 0x67, 0x76, 0x67, 0x33, 0x32, 
-    0x44, 0x44, 0x44, 0x02, 0x2A, 0xAA, 0xA2, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x66, 0x67, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x68, 0x09, 0x99, 0x99, 0x99, 0x86, 0x33, 0x37, 
-    0x77, 0x77, 0x73, 0x33, 0x33, 0x32, 0x22, 0x22, 0x11, 0xA8, 0x88, 0x88, 0x62, 0x22, 0x11, 0x22, 
-    0x11, 0x11, 0x14, 0x17, 0x67, 0x31, 0x11, 0x11, 0x11, 0x37, 0x77, 0x76, 0x76, 0x67, 0x73, 0x37, 
-    0x22, 0x22, 0x02, 0x22, 0x2A, 0xA0, 0x0A, 0x21, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x67, 0x73, 0x12, 0x76, 0x7A, 0x22, 0x22, 0xA6, 0x89, 0x99, 0x99, 0x99, 0x87, 0x33, 0x33, 
-    0x37, 0x77, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x21, 0xA7, 0x88, 0x8C, 0x82, 0x22, 0x11, 0x11, 
-    0x11, 0x14, 0x17, 0x66, 0x32, 0x11, 0x11, 0x14, 0x41, 0x27, 0x77, 0x76, 0x76, 0x77, 0x77, 0x77, 
-    0x22, 0x22, 0x22, 0x22, 0xAA, 0x00, 0x0A, 0xA2, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x73, 0x73, 0x11, 0x30, 0x00, 0x66, 0x7A, 0x2A, 0x68, 0x99, 0x99, 0x99, 0x82, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x21, 0x1A, 0x88, 0x88, 0x83, 0x22, 0x11, 0x11, 
-    0x14, 0x17, 0x60, 0x72, 0x11, 0x11, 0x11, 0x44, 0x41, 0x27, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x22, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0xAA, 0x22, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x37, 0x32, 0x22, 0x30, 0x00, 0x00, 0x00, 0x67, 0x66, 0x89, 0x99, 0x99, 0x87, 0x23, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x22, 0x12, 0x78, 0x88, 0x83, 0x32, 0x11, 0x14, 
-    0x11, 0x8B, 0x73, 0x21, 0x11, 0x11, 0x14, 0x44, 0x41, 0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 
-    0x00, 0x22, 0x22, 0x22, 0x2A, 0xA2, 0x22, 0x22, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x67, 0x33, 0x21, 0x22, 0x36, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC9, 0x99, 0x99, 0xC6, 0x23, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x11, 0xA7, 0x87, 0x33, 0x73, 0x21, 0x12, 
-    0x60, 0x88, 0x62, 0x22, 0x11, 0x11, 0x44, 0x44, 0x12, 0x77, 0x37, 0x77, 0x33, 0x77, 0x77, 0x21, 
-    0x44, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x63, 0x33, 0x11, 0x21, 0x26, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xC9, 0x99, 0x96, 0x22, 0x23, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x22, 0x21, 0x27, 0x3D, 0xD3, 0x77, 0x21, 0x70, 
-    0x67, 0x77, 0x6A, 0x21, 0x11, 0x44, 0x44, 0x41, 0x17, 0x77, 0x33, 0x77, 0x33, 0x77, 0x72, 0x11, 
-    0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x63, 0x33, 0x12, 0x21, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0x90, 0x67, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0xDD, 0xDD, 0x33, 0x23, 0x67, 
-    0x32, 0x11, 0x22, 0x11, 0x44, 0x44, 0x11, 0x12, 0x77, 0x77, 0x77, 0x73, 0x77, 0x77, 0x11, 0x11, 
-    0x20, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x33, 0x32, 0x22, 0x22, 0x27, 0x00, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x99, 0x9C, 0x00, 
-    0x00, 0x67, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0xDD, 0xDD, 0xD3, 0x33, 0x33, 
-    0x21, 0x11, 0x11, 0x44, 0x41, 0x27, 0x77, 0x73, 0x22, 0x22, 0x37, 0x77, 0x77, 0x71, 0x11, 0x11, 
-    0x21, 0x12, 0x22, 0x24, 0x44, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x33, 0x32, 0x22, 0x22, 0x27, 0x66, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x99, 0x99, 
-    0x99, 0x9C, 0x00, 0x66, 0x33, 0x22, 0x23, 0x33, 0x33, 0x3D, 0xDD, 0xDD, 0xDD, 0xD3, 0x72, 0x21, 
-    0x11, 0x11, 0x44, 0x17, 0x60, 0x06, 0x77, 0x21, 0x11, 0x11, 0x27, 0x77, 0x77, 0x11, 0x11, 0x11, 
-    0x72, 0x11, 0x44, 0x44, 0x44, 0x44, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
-    0x33, 0x22, 0x22, 0x22, 0x23, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x00, 0x67, 0x37, 0x77, 0x76, 0x3D, 0xDD, 0xDD, 0xDD, 0xD3, 0x73, 0x21, 
-    0x11, 0x14, 0x27, 0x00, 0x67, 0x32, 0x11, 0x44, 0x44, 0x11, 0x27, 0x77, 0x21, 0x11, 0x11, 0x11, 
-    0x62, 0x44, 0x44, 0x44, 0x44, 0x42, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 
-    0x33, 0x22, 0x22, 0x22, 0x23, 0x37, 0x76, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC9, 0x99, 0x99, 0x99, 0x99, 0x9C, 0x00, 0x00, 0x00, 0x71, 0x1D, 0xDD, 0xDD, 0xD1, 0x33, 0x22, 
-    0x11, 0x42, 0x06, 0x77, 0x32, 0x11, 0x14, 0x44, 0x44, 0x12, 0x22, 0x71, 0x11, 0x11, 0x11, 0x11, 
-    0x07, 0x44, 0x44, 0x44, 0x44, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 
-    0x33, 0x22, 0x22, 0x23, 0x33, 0x33, 0x37, 0x76, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xC9, 0x9C, 0x00, 0xCC, 0x99, 0xC0, 0x00, 0x00, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x17, 0x72, 
-    0x11, 0x13, 0x37, 0x72, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x27, 0x21, 0x11, 0x11, 0x11, 0x11, 
-    0x06, 0x24, 0x44, 0x44, 0x41, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 
-    0x32, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x37, 0x76, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x1D, 0x11, 0x13, 0x31, 
-    0x12, 0x21, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x60, 0x74, 0x44, 0x44, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x33, 
-    0x31, 0x12, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x32, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x27, 0x63, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x66, 0x62, 0x44, 0x44, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x33, 
-    0x24, 0x44, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x11, 0x11, 0x11, 0x11, 0xD7, 
-    0x73, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x37, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x66, 0x67, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x33, 
-    0x14, 0x44, 0x41, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x37, 0x77, 0x66, 0x60, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x66, 0x66, 0x24, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x33, 
-    0x44, 0x44, 0x44, 0x41, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x37, 0x77, 0x66, 0x60, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xD1, 0x11, 0x11, 0x11, 0x13, 
-    0x73, 0x33, 0x23, 0x77, 0xAA, 0xAA, 0xAA, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x60, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 
-    0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x37, 0x77, 0x66, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x60, 0x0D, 0xDD, 0x11, 0x11, 0x11, 0x11, 
-    0x33, 0x33, 0x36, 0x67, 0x77, 0x66, 0x66, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x37, 0x77, 0x66, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x60, 0x03, 0x1D, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x16, 0x66, 0x88, 0x86, 0x66, 0x62, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x33, 0x32, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x37, 0x77, 0x66, 
-    0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x1D, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x17, 0x88, 0x88, 0x86, 0x66, 0x67, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x33, 0x31, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x37, 0x77, 
-    0x76, 0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 0x00, 0x00, 0x06, 0x60, 0x3D, 0xD1, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x68, 0x88, 0x88, 0x66, 0x68, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x26, 0x9B, 
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x33, 0x34, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x37, 0x77, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x66, 0x60, 0x00, 0x73, 0x70, 0x71, 0xD1, 0xD1, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x78, 0x88, 0x88, 0x88, 0x68, 0x71, 0x11, 0x11, 0x11, 0x11, 0x7C, 0xBB, 0xBB, 
-    0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x03, 0x33, 0x24, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0x22, 0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 
-    0x77, 0x77, 0x77, 0x77, 0x73, 0x77, 0x77, 0x66, 0x63, 0x33, 0x76, 0x63, 0xD1, 0xD1, 0x11, 0x1D, 
-    0x11, 0x11, 0x11, 0x18, 0x88, 0x88, 0x86, 0x66, 0x61, 0x11, 0x11, 0x11, 0x69, 0xBB, 0xBB, 0xBB, 
-    0x66, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x33, 0x33, 0x24, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x77, 0x77, 0x33, 0x33, 0x33, 0x33, 0x77, 0x77, 0x32, 0x37, 0x77, 0x63, 0xDD, 0xDD, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x17, 0x88, 0x88, 0x86, 0x66, 0x6A, 0x11, 0x11, 0x69, 0xBB, 0xBB, 0xBB, 0x99, 
-    0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x66, 0x00, 0x00, 0x60, 0x33, 0x33, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x12, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 
-    0x37, 0x73, 0x33, 0x33, 0x33, 0x73, 0x33, 0x32, 0x12, 0x33, 0x77, 0x77, 0xD1, 0x1D, 0x3D, 0xD1, 
-    0x11, 0x11, 0x11, 0x12, 0x88, 0x88, 0x66, 0x88, 0x86, 0x11, 0x79, 0xBB, 0xBB, 0xB9, 0x99, 0x9C, 
-    0x66, 0x60, 0x00, 0x00, 0x00, 0x60, 0x03, 0x33, 0x00, 0x00, 0x00, 0x06, 0x63, 0x33, 0x32, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0xAA, 0x22, 0x44, 0x12, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 
-    0x37, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x11, 0x33, 0x33, 0x37, 0x3D, 0x33, 0x3D, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x68, 0x88, 0x88, 0x99, 0x98, 0xAA, 0x66, 0x89, 0x99, 0x99, 0x9C, 0x88, 
-    0x66, 0x66, 0x00, 0x00, 0x66, 0x60, 0x33, 0x33, 0x30, 0x00, 0x00, 0x66, 0x63, 0x33, 0x32, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x42, 0xA6, 0x66, 0xA2, 0x12, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x3D, 0xD1, 
-    0x11, 0x11, 0x11, 0x11, 0xA8, 0x88, 0x8C, 0x99, 0x9B, 0x8A, 0xAA, 0x68, 0x99, 0x9C, 0x88, 0x88, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x66, 0x03, 0x33, 0x34, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x40, 0xA6, 0x88, 0x86, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x11, 0x11, 0x23, 0x33, 0xD3, 0xD1, 0xDD, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x16, 0x88, 0x89, 0x99, 0x99, 0x9A, 0x27, 0x66, 0x88, 0x88, 0x88, 0x86, 
-    0x66, 0x66, 0x66, 0x66, 0x67, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x33, 0x24, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x40, 0xA6, 0x68, 0x88, 0x86, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x11, 0x11, 0x11, 0x11, 0x1D, 0x3D, 0xD1, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x28, 0x88, 0x8C, 0x99, 0x99, 0xB8, 0xA6, 0x66, 0x88, 0x88, 0x88, 0x7A, 
-    0x77, 0x66, 0x66, 0x66, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x14, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0xA6, 0x68, 0x8C, 0xC8, 0x62, 0x22, 0x22, 0x22, 0x32, 0x22, 0x22, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x11, 0x11, 0x11, 0x1D, 0xD3, 0x7D, 0xD1, 0x11, 
-    0x11, 0x11, 0x27, 0xCB, 0xBB, 0xB8, 0x8C, 0x99, 0x99, 0x99, 0xA7, 0x66, 0x88, 0x88, 0x6A, 0x2A, 
-    0x77, 0x77, 0x77, 0x77, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x72, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0xA6, 0x66, 0x88, 0xCC, 0x67, 0x21, 0x12, 0x22, 0x33, 0x33, 0x33, 
-    0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x21, 0x11, 0x11, 0x13, 0x33, 0x0E, 0x3D, 0x11, 0x11, 
-    0x13, 0x69, 0xBB, 0xBB, 0xBB, 0xB9, 0x88, 0xC9, 0x99, 0x9B, 0x6A, 0x88, 0x88, 0x6A, 0xAA, 0x6C, 
-    0x77, 0x77, 0x77, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x72, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0xA6, 0x66, 0x88, 0xCC, 0xC6, 0x72, 0x11, 0x12, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x22, 0x33, 0x33, 0x33, 0x32, 0x21, 0x11, 0x11, 0xDD, 0xD3, 0x00, 0x3D, 0x13, 0x7C, 
-    0x9B, 0xBB, 0xBB, 0xBB, 0xB9, 0x99, 0x88, 0xCC, 0x99, 0x99, 0x96, 0x6C, 0xC7, 0xA6, 0x89, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x33, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x34, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x40, 0xA6, 0x66, 0x88, 0xCC, 0xC8, 0x67, 0x21, 0x11, 0x23, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x1D, 0xDD, 0xDD, 0xDD, 0x37, 0xCB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xB9, 0x99, 0x99, 0x88, 0xC9, 0x99, 0xB9, 0xB9, 0x8C, 0x99, 0x99, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x73, 0x33, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x77, 0x24, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x42, 0x66, 0x66, 0x68, 0x8C, 0xCC, 0x86, 0x72, 0x11, 0x12, 0x33, 0x33, 
-    0x33, 0x00, 0x33, 0x33, 0x22, 0x22, 0x22, 0x11, 0x11, 0xDD, 0xDD, 0xD3, 0x7C, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xB9, 0x99, 0x99, 0x99, 0x98, 0x99, 0x9B, 0xB9, 0xBB, 0xBB, 0xB9, 0x99, 0x99, 0x99, 
-    0x77, 0x77, 0x37, 0x77, 0x37, 0x67, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x72, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x42, 0x66, 0x66, 0x68, 0x88, 0xCC, 0xC8, 0x6A, 0x11, 0x12, 0x23, 0x33, 
-    0x33, 0x33, 0x03, 0x33, 0x33, 0x32, 0x22, 0x11, 0x1D, 0xDD, 0xD7, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xB9, 0x99, 0x9C, 0xCC, 0x88, 0x9C, 0x9B, 0xBB, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 
-    0x77, 0x73, 0x37, 0x77, 0x76, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x71, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x42, 0x06, 0x66, 0x66, 0x88, 0xCC, 0xCC, 0x86, 0x21, 0x11, 0x22, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x66, 0x21, 0x1D, 0x30, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0x99, 0x99, 0x9C, 0x88, 0x88, 0x88, 0x88, 0xBB, 0xBB, 0x99, 0x99, 0x99, 0x99, 0x9C, 0x99, 0x99, 
-    0x77, 0x77, 0x37, 0x77, 0x76, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x24, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0xA6, 0x66, 0x66, 0x88, 0xCC, 0x88, 0xC8, 0x62, 0x11, 0x12, 0x23, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x67, 0x12, 0x69, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x99, 
-    0x99, 0xC8, 0x88, 0x88, 0x86, 0x7A, 0xAC, 0xBB, 0xBB, 0xB9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x76, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x14, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x26, 0x66, 0x66, 0x68, 0x8C, 0x88, 0x8C, 0x87, 0x21, 0x11, 0x22, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x27, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0x99, 
-    0x88, 0x88, 0x86, 0x7A, 0xAA, 0xA8, 0x9B, 0x99, 0x99, 0xBB, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x33, 0x77, 0x77, 0x77, 0x66, 0x67, 0x33, 0x33, 0x33, 0x33, 0x33, 0x72, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x4A, 0x66, 0x66, 0x68, 0x88, 0x88, 0xCC, 0xC6, 0x72, 0x11, 0x12, 
-    0x23, 0x33, 0x33, 0x33, 0x33, 0x7C, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0x99, 0x99, 0xC8, 
-    0x88, 0x86, 0xAA, 0x2A, 0x78, 0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x37, 0x77, 0x77, 0x77, 0x67, 0x77, 0x33, 0x33, 0x33, 0x33, 0x37, 0x24, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x66, 0x66, 0x66, 0x88, 0xC8, 0xCC, 0xC8, 0x67, 0x21, 0x11, 
-    0x22, 0x33, 0x33, 0x36, 0xCB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0x99, 0x99, 0xC8, 0x88, 
-    0x87, 0xAA, 0xAA, 0x8C, 0xBB, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x21, 0x22, 0x14, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xA6, 0x66, 0x66, 0x88, 0x8C, 0xCC, 0xCC, 0x86, 0x72, 0x11, 
-    0x11, 0x13, 0x30, 0x9B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x99, 0x99, 0x99, 0x9C, 0x88, 0x88, 0x6A, 
-    0xAA, 0xA6, 0x89, 0xB9, 0x99, 0x99, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x33, 0x33, 0x33, 0x33, 0x37, 0x77, 0x77, 0x72, 0x14, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x26, 0x66, 0x66, 0x88, 0x8C, 0xCC, 0xCC, 0x88, 0x67, 0x21, 
-    0x12, 0x7C, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x99, 0x99, 0x99, 0xC8, 0x88, 0x66, 0xAA, 0xAA, 
-    0xA8, 0x9B, 0xB9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x33, 0x33, 0x33, 0x33, 0x22, 0x70, 0x00, 0x60, 0x06, 0x72, 0x14, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4A, 0x66, 0x66, 0x68, 0x8C, 0xCC, 0xC8, 0x88, 0x86, 0x77, 
-    0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x99, 0x99, 0x9C, 0x88, 0x88, 0x6A, 0xAA, 0xAA, 0x78, 
-    0x9B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9C, 
-    0x77, 0x77, 0x77, 0x73, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x60, 0x00, 0x66, 0x60, 0x06, 0x72, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x76, 0x66, 0x68, 0x8C, 0xCC, 0x88, 0x88, 0x89, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0x99, 0x9C, 0xC8, 0x88, 0x88, 0x7A, 0xAA, 0xAA, 0x88, 0x9B, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xC9, 0x99, 0x99, 0xCC, 0xCC, 
+const uint8_t GAME_SINGLE_LOGO_RLE[GAME_SINGLE_LOGO_RLE_SIZE] = {
+    0x01, 0x44, 0xDA, 0xF4, 0x0B, 0x02, 0x00, 0x00, 0xF2, 0x14, 0x02, 0x80, 0xA0, 0xB4, 0xA1, 0xF2, 
+    0x02, 0xA1, 0xC4, 0x03, 0xA8, 0x00, 0xE8, 0x00, 0xC0, 0xEB, 0x00, 0xC0, 0xF0, 0x03, 0x02, 0x44, 
+    0x20, 0xCA, 0x00, 0x20, 0x52, 0xF2, 0x14, 0x04, 0x1A, 0xBB, 0x80, 0x51, 0xB1, 0xB4, 0x03, 0xAA, 
+    0x8B, 0x47, 0x00, 0x80, 0xDB, 0x00, 0xC0, 0xF0, 0x04, 0x01, 0x11, 0x58, 0xF2, 0x16, 0x04, 0xA0, 
+    0xBB, 0x70, 0xC4, 0xA1, 0xE2, 0xC1, 0xA4, 0x00, 0xA0, 0x52, 0x00, 0xC0, 0xF0, 0x05, 0x03, 0x11, 
+    0x12, 0xCA, 0x00, 0x20, 0x6D, 0x05, 0xA0, 0xBB, 0x8A, 0xA4, 0x03, 0x11, 0x44, 0xA1, 0xB2, 0xD1, 
+    0x01, 0x44, 0xAA, 0x03, 0x78, 0xBB, 0xF8, 0x01, 0xBB, 0x00, 0x60, 0xF0, 0x05, 0x04, 0x21, 0x12, 
+    0x20, 0x72, 0x04, 0xA8, 0xBB, 0x80, 0x45, 0x03, 0x21, 0x44, 0xA1, 0x02, 0x22, 0x20, 0xD1, 0xCA, 
+    0x01, 0x78, 0x4F, 0x00, 0x80, 0xF0, 0x06, 0x03, 0x21, 0x11, 0x44, 0x01, 0xA2, 0xF4, 0x06, 0x00, 
+    0x10, 0x5C, 0x03, 0x0B, 0xB0, 0x44, 0x05, 0x4A, 0x14, 0x44, 0xF1, 0x03, 0x0A, 0xA8, 0x67, 0xAA, 
+    0xA8, 0x88, 0xC0, 0x49, 0x04, 0xC9, 0xB9, 0x60, 0x51, 0xDA, 0x01, 0x20, 0xF4, 0x05, 0x01, 0x00, 
+    0xD2, 0x02, 0x02, 0x00, 0xF2, 0x08, 0x02, 0xA0, 0xB0, 0x49, 0x00, 0xA0, 0xA4, 0xF1, 0x02, 0x06, 
+    0x78, 0x87, 0xAA, 0x70, 0xA8, 0x49, 0x09, 0x88, 0xB8, 0x76, 0x60, 0x00, 0xD6, 0x4C, 0x03, 0xA2, 
+    0x44, 0xD1, 0x02, 0x44, 0x40, 0xA1, 0x00, 0x00, 0xA2, 0x00, 0x00, 0xF2, 0x0B, 0x01, 0xA8, 0xA0, 
+    0x03, 0x88, 0x01, 0xA4, 0x02, 0x1A, 0xA0, 0xA4, 0x4C, 0x01, 0x77, 0xA8, 0x00, 0x60, 0xF8, 0x04, 
+    0x03, 0xC6, 0x77, 0xA6, 0x00, 0x70, 0xA3, 0x00, 0x70, 0x43, 0x03, 0x21, 0x12, 0x46, 0x02, 0x24, 
+    0xD0, 0xC5, 0x06, 0xD4, 0x4D, 0x55, 0xA0, 0x42, 0x01, 0x01, 0xC5, 0x0E, 0x20, 0x25, 0x55, 0x02, 
+    0x55, 0x5A, 0x0A, 0x00, 0xB5, 0x02, 0x08, 0x80, 0xD5, 0x03, 0x71, 0x44, 0xC5, 0x17, 0xD1, 0x4D, 
+    0x55, 0x00, 0xE5, 0x57, 0x8E, 0x55, 0xEE, 0x55, 0xE8, 0x8E, 0xC5, 0x06, 0x03, 0x33, 0x77, 0x70, 
+    0xB3, 0x00, 0x60, 0xA0, 0x4A, 0x00, 0xA0, 0x47, 0x06, 0x5A, 0x05, 0x55, 0xF0, 0x42, 0x00, 0x20, 
+    0xD5, 0x00, 0x00, 0x42, 0x08, 0x00, 0xA5, 0x55, 0x00, 0x00, 0xC5, 0x01, 0x00, 0x46, 0x03, 0x50, 
+    0xA7, 0xD5, 0x00, 0x00, 0x42, 0x00, 0xF0, 0x42, 0x02, 0x00, 0xE0, 0xD5, 0x01, 0x00, 0x45, 0x02, 
+    0x57, 0xA0, 0xC3, 0x02, 0x23, 0x60, 0xB0, 0x03, 0x21, 0x11, 0xFA, 0x00, 0x0A, 0x20, 0xD5, 0x50, 
+    0x00, 0x55, 0x70, 0x46, 0x00, 0x00, 0x42, 0x01, 0x00, 0x42, 0x00, 0xA0, 0x47, 0x1E, 0xFE, 0x55, 
+    0xE7, 0x55, 0x50, 0x05, 0x55, 0x00, 0x05, 0x50, 0xFE, 0x55, 0x00, 0x05, 0x5F, 0x00, 0x4B, 0x02, 
+    0x07, 0x00, 0x45, 0x06, 0x07, 0x05, 0x57, 0x00, 0xB3, 0x02, 0x22, 0x30, 0xC0, 0x42, 0x00, 0x20, 
+    0xFA, 0x00, 0x42, 0x00, 0xF0, 0x44, 0x00, 0xD0, 0x48, 0x00, 0x00, 0x4E, 0x06, 0x0E, 0x50, 0x00, 
+    0xE0, 0x42, 0x00, 0x00, 0x46, 0x04, 0x00, 0x55, 0xF0, 0x51, 0x01, 0xF0, 0x43, 0x04, 0x75, 0x50, 
+    0x00, 0x43, 0x00, 0x20, 0x43, 0x01, 0x36, 0x58, 0x00, 0xD0, 0x4F, 0x00, 0xA0, 0x54, 0x08, 0x70, 
+    0x0E, 0x55, 0x04, 0xD0, 0x42, 0x00, 0x50, 0x42, 0x00, 0xD0, 0x4F, 0x02, 0x00, 0xE0, 0x47, 0x00, 
+    0x70, 0x43, 0x05, 0x22, 0x32, 0x37, 0xD0, 0x03, 0x21, 0x14, 0x48, 0x00, 0xA0, 0x48, 0x00, 0x50, 
+    0x54, 0x00, 0x00, 0x49, 0x03, 0xF0, 0x08, 0x42, 0x00, 0x00, 0x43, 0x00, 0xD0, 0x56, 0x00, 0x70, 
+    0x42, 0x00, 0xE0, 0x4A, 0x03, 0x22, 0x36, 0x54, 0x00, 0x30, 0x46, 0x09, 0xFE, 0x55, 0xFF, 0x24, 
+    0x01, 0x4C, 0x03, 0xA5, 0x50, 0x45, 0x03, 0x08, 0xE8, 0x4E, 0x00, 0x00, 0x42, 0x00, 0xE0, 0x51, 
+    0x00, 0x00, 0x47, 0x05, 0xA2, 0x22, 0x36, 0xE0, 0x02, 0x21, 0x40, 0x4A, 0x00, 0x70, 0x42, 0x04, 
+    0x05, 0x57, 0x00, 0x42, 0x04, 0x07, 0x7A, 0x70, 0x42, 0x00, 0xD0, 0x45, 0x02, 0x50, 0x50, 0x47, 
+    0x04, 0x8E, 0x55, 0xF0, 0x44, 0x00, 0x50, 0x47, 0x00, 0xE0, 0x56, 0x00, 0xE0, 0x4A, 0x01, 0x33, 
+    0xF0, 0x00, 0x00, 0x10, 0x49, 0x08, 0x77, 0x6E, 0x55, 0xE0, 0x50, 0x46, 0x00, 0x80, 0xA0, 0xD5, 
+    0x44, 0xA5, 0x45, 0x05, 0x05, 0x55, 0x00, 0x42, 0xA5, 0x43, 0x02, 0x00, 0xD0, 0x47, 0x00, 0xD0, 
+    0x47, 0x00, 0xE0, 0x4C, 0x04, 0x87, 0x23, 0x60, 0x4B, 0xCA, 0x00, 0x00, 0xA6, 0x00, 0xE0, 0xC5, 
+    0x03, 0x0F, 0xF0, 0x54, 0x00, 0x00, 0x47, 0xA5, 0x43, 0x02, 0x55, 0x50, 0xA0, 0x5C, 0x00, 0x70, 
+    0x48, 0x02, 0x83, 0x70, 0x49, 0x00, 0x40, 0x44, 0x07, 0x06, 0x66, 0x77, 0x60, 0xA5, 0x04, 0x0F, 
+    0x0F, 0xA0, 0x4B, 0x00, 0x00, 0x45, 0x03, 0x0F, 0x00, 0x46, 0x00, 0x00, 0x4C, 0x00, 0x40, 0x4C, 
+    0x01, 0xF7, 0x4C, 0x00, 0xE0, 0x42, 0x00, 0x00, 0x44, 0x01, 0x76, 0xF0, 0x01, 0x19, 0x44, 0x42, 
+    0xAA, 0xA6, 0x88, 0x8A, 0x23, 0x2D, 0x55, 0x0F, 0x0F, 0xA7, 0x6E, 0x48, 0x01, 0x0F, 0x45, 0x04, 
+    0xA0, 0x0F, 0x50, 0x46, 0x01, 0x8E, 0x45, 0x00, 0x00, 0x42, 0x00, 0x40, 0x42, 0x02, 0xF0, 0x00, 
+    0x46, 0x01, 0x0E, 0x51, 0x00, 0xC0, 0x43, 0x01, 0x77, 0xF0, 0x02, 0x02, 0x44, 0x40, 0xAA, 0x42, 
+    0x03, 0x21, 0x11, 0x42, 0x01, 0x07, 0xA6, 0x49, 0x02, 0xE0, 0xA0, 0x43, 0x04, 0xA0, 0x0A, 0x60, 
+    0x47, 0x00, 0x00, 0x47, 0x02, 0x05, 0x50, 0x46, 0x04, 0xE5, 0x5F, 0xF0, 0x5C, 0x02, 0x07, 0x60, 
+    0x4C, 0x00, 0x20, 0x48, 0x0B, 0x20, 0x55, 0x0F, 0x77, 0x76, 0x70, 0x48, 0x01, 0x0F, 0x45, 0x04, 
+    0xA7, 0x76, 0x00, 0x54, 0x06, 0x04, 0x55, 0x5F, 0xF0, 0x42, 0x00, 0x00, 0x5C, 0x00, 0x70, 0x4E, 
+    0x05, 0x44, 0x22, 0xA6, 0x42, 0x01, 0x36, 0x43, 0xA3, 0x04, 0x25, 0x55, 0xF0, 0xB0, 0x42, 0x00, 
+    0x70, 0x43, 0x04, 0x35, 0x00, 0x80, 0x54, 0x02, 0x50, 0x00, 0x42, 0x00, 0x00, 0x57, 0x00, 0x70, 
+    0x42, 0x00, 0x80, 0x44, 0xF0, 0x03, 0xB4, 0x09, 0x12, 0x2A, 0x66, 0x23, 0x63, 0x42, 0x08, 0x02, 
+    0x11, 0x13, 0x05, 0x50, 0xAE, 0x4A, 0x07, 0x55, 0x57, 0xE5, 0x55, 0x42, 0x03, 0x5E, 0xE5, 0x45, 
+    0x02, 0xF0, 0x10, 0x45, 0x02, 0x07, 0x50, 0x45, 0x01, 0xEE, 0x4C, 0x06, 0xFE, 0x55, 0x07, 0xE0, 
+    0x43, 0x00, 0x60, 0x4E, 0x00, 0x10, 0xA2, 0x04, 0xAA, 0x33, 0x70, 0x42, 0x07, 0xF0, 0x11, 0x23, 
+    0x6E, 0xC5, 0x01, 0x78, 0x47, 0x01, 0xF0, 0xC5, 0x00, 0x00, 0x43, 0xB5, 0x45, 0x05, 0xA5, 0x55, 
+    0xF7, 0xD5, 0x43, 0xB5, 0x00, 0xF0, 0x48, 0x01, 0x0E, 0xD5, 0x02, 0x00, 0x70, 0xF0, 0x04, 0xA4, 
+    0xB2, 0x04, 0xA2, 0x23, 0x30, 0x44, 0x00, 0x30, 0xA7, 0x00, 0x00, 0xC5, 0x01, 0x0F, 0x42, 0x00, 
+    0x60, 0x42, 0x01, 0x06, 0xB5, 0xA0, 0x01, 0xCE, 0x49, 0x07, 0x0F, 0xA7, 0x55, 0x7F, 0xC5, 0x04, 
+    0x00, 0x08, 0xE0, 0xB5, 0x02, 0x00, 0x80, 0x47, 0x00, 0xF0, 0x45, 0x03, 0x70, 0xF6, 0x53, 0x02, 
+    0xAA, 0x20, 0xA1, 0x0B, 0x2A, 0xFF, 0xF6, 0x07, 0x33, 0x3A, 0xCF, 0x0C, 0x06, 0x0F, 0xF6, 0x6F, 
+    0xFF, 0x06, 0x60, 0xAF, 0xC0, 0x00, 0x80, 0xD0, 0x0B, 0x88, 0x00, 0x08, 0x70, 0xFF, 0xFA, 0xAF, 
+    0x19, 0x00, 0xF8, 0xCC, 0x8F, 0xFF, 0x00, 0x88, 0x08, 0xF0, 0x00, 0x7F, 0xFF, 0x77, 0xBF, 0x02, 
+    0x0F, 0x70, 0xF0, 0x04, 0x00, 0x60, 0xA4, 0x01, 0x12, 0xAA, 0x42, 0x14, 0x23, 0x76, 0x77, 0x73, 
+    0x33, 0x11, 0x37, 0x71, 0x26, 0x66, 0x00, 0xC6, 0x05, 0x88, 0x86, 0x66, 0xC8, 0x03, 0xC0, 0x0B, 
+    0x47, 0xF8, 0x02, 0x01, 0x00, 0xA8, 0xA0, 0x19, 0xCC, 0x66, 0x76, 0x00, 0x0C, 0x86, 0x67, 0xAA, 
+    0x21, 0x12, 0xAA, 0x88, 0x87, 0xF0, 0x05, 0x48, 0x00, 0x20, 0xA1, 0x00, 0x20, 0xB3, 0x0A, 0x22, 
+    0x11, 0x23, 0x60, 0x72, 0x20, 0xC0, 0xF6, 0x05, 0xF8, 0x00, 0x04, 0xCC, 0xC0, 0x00, 0xF8, 0x08, 
+    0x0B, 0x00, 0x0C, 0x00, 0x03, 0x36, 0xCC, 0xA0, 0x03, 0x67, 0x32, 0xB1, 0x05, 0x23, 0x78, 0x76, 
+    0xF0, 0x04, 0x00, 0x60, 0x43, 0x04, 0x22, 0x04, 0x10, 0x43, 0xA1, 0x0C, 0x22, 0x11, 0x27, 0x66, 
+    0x73, 0x32, 0x30, 0xB0, 0x03, 0x66, 0x67, 0x52, 0xA8, 0x02, 0x00, 0x00, 0xF8, 0x05, 0x00, 0x60, 
+    0xC0, 0x16, 0x17, 0x0C, 0xC0, 0x06, 0x66, 0x73, 0x22, 0x11, 0x23, 0x76, 0x77, 0x70, 0xF0, 0x06, 
+    0x46, 0x01, 0x44, 0xF1, 0x03, 0x03, 0x33, 0x77, 0xA3, 0x01, 0x23, 0xB0, 0x03, 0x66, 0x77, 0x4D, 
+    0x02, 0x00, 0x00, 0x48, 0x00, 0x00, 0x4E, 0x04, 0x90, 0x62, 0x20, 0xA0, 0x11, 0x67, 0x77, 0x33, 
+    0x21, 0x11, 0x37, 0x60, 0x00, 0x66, 0xF0, 0x05, 0x02, 0x66, 0x70, 0x43, 0x00, 0x00, 0x4A, 0x03, 
+    0x23, 0x66, 0xB3, 0x02, 0x21, 0x60, 0x45, 0xF6, 0x05, 0xF8, 0x02, 0x07, 0x00, 0x0B, 0xB0, 0x00, 
+    0x4A, 0x14, 0x6C, 0x06, 0x31, 0x36, 0x00, 0x77, 0x73, 0x32, 0x21, 0x11, 0x70, 0xD0, 0x01, 0x76, 
+    0xF0, 0x03, 0x00, 0x60, 0x45, 0xB4, 0xE1, 0x05, 0x27, 0x33, 0x32, 0xB1, 0x00, 0x20, 0x43, 0xC6, 
+    0x00, 0x70, 0xF6, 0x02, 0xE8, 0x01, 0xC0, 0xDB, 0x01, 0x00, 0xA8, 0x00, 0xA0, 0xB8, 0x05, 0x00, 
+    0x07, 0x21, 0xA3, 0x04, 0x73, 0x33, 0x20, 0xB1, 0x05, 0x76, 0x60, 0x00, 0xB7, 0xA0, 0x01, 0x66, 
+    0xA0, 0x00, 0x60, 0x55, 0x02, 0x22, 0x20, 0xA1, 0x03, 0x23, 0x76, 0xA0, 0x08, 0x66, 0x00, 0x06, 
+    0x67, 0xA0, 0x50, 0xFB, 0x01, 0x01, 0x00, 0xA8, 0x0F, 0xA8, 0x88, 0x00, 0x63, 0x21, 0x13, 0x32, 
+    0x22, 0xE1, 0x06, 0x77, 0x76, 0x07, 0x30, 0xA1, 0x01, 0x36, 0x43, 0x02, 0x60, 0x00, 0xA6, 0x02, 
+    0x76, 0x60, 0x4F, 0xD1, 0x00, 0x30, 0xE0, 0x00, 0x60, 0xB0, 0x03, 0x63, 0x2A, 0xD6, 0xB8, 0x03, 
+    0x66, 0x88, 0xFB, 0x04, 0x12, 0x00, 0x88, 0x8A, 0x86, 0x33, 0x21, 0x11, 0x33, 0x22, 0x20, 0xB1, 
+    0x08, 0x44, 0x12, 0x76, 0x67, 0x30, 0xC1, 0x05, 0x27, 0x60, 0x00, 0xF6, 0x01, 0x00, 0x70, 0xF4, 
+    0x01, 0xF1, 0x03, 0x01, 0x43, 0xF0, 0x05, 0x08, 0x67, 0x22, 0x2A, 0x66, 0x60, 0xE8, 0x03, 0x68, 
+    0x80, 0xFB, 0x01, 0x00, 0x00, 0xD8, 0x04, 0x07, 0x32, 0x20, 0xA1, 0x00, 0x30, 0xA2, 0x0C, 0x11, 
+    0x14, 0x44, 0x12, 0x60, 0x67, 0x30, 0xA1, 0x0A, 0x44, 0x41, 0x77, 0x66, 0x06, 0x00, 0x53, 0x00, 
+    0x40, 0xE1, 0x01, 0x42, 0xF0, 0x06, 0x07, 0x63, 0x20, 0x2A, 0xA6, 0xF8, 0x02, 0x00, 0xC0, 0xEB, 
+    0x03, 0xC8, 0x86, 0xD7, 0x08, 0xAA, 0x33, 0x21, 0x12, 0x30, 0x45, 0x09, 0x44, 0x41, 0x36, 0x67, 
+    0x73, 0xB1, 0x04, 0x44, 0x12, 0x70, 0xB6, 0x43, 0x04, 0x76, 0x67, 0x30, 0xF4, 0x02, 0xF1, 0x00, 
+    0x02, 0x44, 0x30, 0xF0, 0x06, 0x05, 0x72, 0x00, 0x02, 0x45, 0x07, 0xC9, 0x99, 0x88, 0x80, 0xBB, 
+    0x02, 0x88, 0x60, 0xA7, 0x10, 0x33, 0x32, 0x22, 0xA2, 0xA7, 0x77, 0x88, 0x62, 0x30, 0x42, 0x0A, 
+    0x44, 0x11, 0x26, 0x77, 0x73, 0x20, 0xD1, 0x00, 0x20, 0xA7, 0x46, 0x04, 0x66, 0x73, 0x20, 0xF4, 
+    0x01, 0x00, 0x20, 0xE1, 0x02, 0x44, 0x20, 0xF0, 0x06, 0x0B, 0x63, 0x20, 0x40, 0x22, 0xA6, 0x88, 
+    0xD9, 0x07, 0x88, 0x8B, 0xB0, 0x86, 0xD7, 0x44, 0x03, 0x22, 0x1A, 0xA8, 0x0A, 0x62, 0x33, 0x21, 
+    0x44, 0x11, 0x10, 0xA7, 0x03, 0x22, 0x12, 0xB1, 0x06, 0x26, 0x07, 0x27, 0x70, 0xA6, 0x06, 0x76, 
+    0x66, 0x77, 0x20, 0x48, 0x02, 0x22, 0x20, 0xE1, 0x01, 0x43, 0x4E, 0x09, 0x21, 0x00, 0x22, 0x2A, 
+    0xA6, 0x46, 0x05, 0xC8, 0xCB, 0x86, 0xF7, 0x00, 0x46, 0x02, 0x22, 0x70, 0xA8, 0x19, 0x32, 0x32, 
+    0x12, 0x21, 0x12, 0x73, 0x32, 0x22, 0x11, 0x12, 0x27, 0x76, 0x06, 0xA7, 0x03, 0x37, 0x67, 0x43, 
+    0x00, 0x30, 0x48, 0xB2, 0xE1, 0x4D, 0x0D, 0x66, 0x21, 0x44, 0x02, 0x22, 0xAA, 0x88, 0xE9, 0x04, 
+    0xC8, 0x63, 0x30, 0x4F, 0x01, 0x1A, 0xB8, 0x01, 0x73, 0xF2, 0x02, 0xA1, 0x09, 0x37, 0x76, 0x73, 
+    0x21, 0x22, 0xA7, 0x43, 0x03, 0x73, 0x33, 0x45, 0x02, 0x02, 0x20, 0xAA, 0x00, 0x20, 0xC1, 0x00, 
+    0x30, 0xF0, 0x04, 0x03, 0x66, 0x67, 0xF2, 0x00, 0x03, 0xA6, 0x80, 0xD9, 0x02, 0x86, 0x30, 0x46, 
+    0xC3, 0x44, 0x01, 0x1A, 0xB8, 0x07, 0x62, 0x22, 0x11, 0x22, 0xB1, 0x05, 0x41, 0x76, 0x73, 0xD1, 
+    0x00, 0x30, 0xA7, 0x00, 0x60, 0x42, 0x03, 0x73, 0x37, 0xA2, 0x00, 0x00, 0xA2, 0x05, 0xAA, 0x00, 
+    0xA2, 0xA1, 0x00, 0x20, 0xF0, 0x05, 0x09, 0x67, 0x73, 0x12, 0x76, 0x7A, 0xA2, 0x02, 0xA6, 0x80, 
+    0x46, 0x00, 0x70, 0xB3, 0x02, 0x77, 0x70, 0xD3, 0xC2, 0x07, 0x1A, 0x78, 0x88, 0xC8, 0x43, 0xB1, 
+    0x06, 0x41, 0x76, 0x63, 0x20, 0xB1, 0x03, 0x44, 0x12, 0x45, 0xC7, 0xE2, 0x0A, 0xAA, 0x00, 0x0A, 
+    0xA2, 0x11, 0x20, 0xF0, 0x05, 0x12, 0x67, 0x37, 0x31, 0x13, 0x00, 0x06, 0x67, 0xA2, 0xA6, 0x80, 
+    0x45, 0x00, 0x20, 0xF3, 0x06, 0x45, 0x01, 0x1A, 0xB8, 0x00, 0x30, 0x45, 0x06, 0x41, 0x76, 0x07, 
+    0x20, 0xC1, 0x00, 0x40, 0x46, 0xF7, 0x00, 0x48, 0xAA, 0x04, 0x22, 0x02, 0x30, 0x4D, 0x05, 0x37, 
+    0x32, 0x22, 0x42, 0xA0, 0x04, 0x67, 0x66, 0x80, 0x44, 0x01, 0x72, 0x52, 0x03, 0x21, 0x27, 0x43, 
+    0x00, 0x30, 0x42, 0x07, 0x41, 0x18, 0xB7, 0x32, 0xC1, 0xA4, 0x01, 0x13, 0xF7, 0x03, 0x02, 0x30, 
+    0x00, 0xD2, 0x01, 0xAA, 0xC2, 0x00, 0x30, 0xF0, 0x05, 0x09, 0x67, 0x33, 0x21, 0x22, 0x36, 0xF0, 
+    0x00, 0x01, 0xCC, 0xB9, 0x01, 0xC6, 0x4C, 0xE2, 0x15, 0x11, 0xA7, 0x87, 0x33, 0x73, 0x21, 0x12, 
+    0x60, 0x88, 0x62, 0x22, 0xA1, 0xA4, 0x09, 0x12, 0x77, 0x37, 0x77, 0x33, 0xA7, 0x04, 0x21, 0x44, 
+    0x00, 0xF2, 0x04, 0x00, 0x70, 0xF0, 0x06, 0x08, 0x63, 0x33, 0x11, 0x21, 0x20, 0x4A, 0x01, 0xCC, 
+    0xA9, 0x03, 0x62, 0x22, 0xF3, 0x03, 0xE2, 0x16, 0x12, 0x73, 0xDD, 0x37, 0x72, 0x17, 0x06, 0x77, 
+    0x76, 0xA2, 0x11, 0x10, 0xB4, 0x06, 0x11, 0x77, 0x73, 0x30, 0x45, 0x00, 0x20, 0xA1, 0x4B, 0x00, 
+    0x70, 0xF0, 0x07, 0x43, 0x00, 0x20, 0x4B, 0x02, 0x00, 0x00, 0xAC, 0x03, 0x90, 0x67, 0xF3, 0x03, 
+    0xF2, 0x02, 0x00, 0x30, 0xAD, 0x0D, 0x33, 0x23, 0x67, 0x32, 0x11, 0x22, 0x11, 0xA4, 0x03, 0x11, 
+    0x12, 0xD7, 0x00, 0x30, 0xA7, 0xA1, 0x02, 0x20, 0x10, 0xF2, 0x02, 0x00, 0x70, 0xF0, 0x07, 0x03, 
+    0x63, 0x33, 0xC2, 0x05, 0x70, 0x06, 0x66, 0xF0, 0x00, 0x05, 0xCC, 0x99, 0x9C, 0xA0, 0x01, 0x67, 
+    0xA3, 0xF2, 0x02, 0x01, 0x33, 0x43, 0x00, 0xD0, 0xB3, 0x00, 0x20, 0xB1, 0x04, 0x44, 0x41, 0x20, 
+    0xA7, 0x00, 0x30, 0xA2, 0x00, 0x30, 0xC7, 0xB1, 0x01, 0x21, 0x43, 0x06, 0x44, 0x40, 0x24, 0x20, 
+    0xF0, 0x08, 0x49, 0xB6, 0xF0, 0x03, 0x00, 0xC0, 0xD9, 0x09, 0xC0, 0x06, 0x63, 0x32, 0x22, 0xC3, 
+    0xED, 0x03, 0x37, 0x22, 0xB1, 0x0A, 0x44, 0x17, 0x60, 0x06, 0x77, 0x20, 0xB1, 0x00, 0x20, 0xB7, 
+    0xC1, 0x03, 0x72, 0x11, 0xE4, 0x01, 0x26, 0xF0, 0x07, 0x03, 0x66, 0x33, 0xD2, 0x00, 0x30, 0xC6, 
+    0xF0, 0x04, 0x00, 0xC0, 0xF9, 0x01, 0x04, 0x00, 0x67, 0x30, 0xA7, 0x00, 0x60, 0x49, 0x00, 0x30, 
+    0x43, 0x0A, 0x42, 0x70, 0x06, 0x73, 0x21, 0x10, 0xA4, 0x44, 0x00, 0x20, 0xD1, 0x01, 0x62, 0xF4, 
+    0x00, 0x01, 0x26, 0xF0, 0x07, 0x02, 0x66, 0x30, 0x48, 0x02, 0x37, 0x70, 0xB6, 0xF0, 0x05, 0x00, 
+    0xC0, 0xF9, 0x01, 0x00, 0xC0, 0xC0, 0x02, 0x71, 0x10, 0xCD, 0x11, 0x13, 0x32, 0x21, 0x14, 0x20, 
+    0x67, 0x73, 0x21, 0x11, 0xB4, 0x04, 0x12, 0x22, 0x70, 0xF1, 0x00, 0x01, 0x07, 0xE4, 0x01, 0x27, 
+    0xF0, 0x08, 0x48, 0xC3, 0x01, 0x77, 0xA6, 0xF0, 0x06, 0x0A, 0xC9, 0x9C, 0x00, 0xCC, 0x99, 0xC0, 
+    0xC0, 0x00, 0xD0, 0xF1, 0x00, 0x0A, 0x77, 0x21, 0x11, 0x33, 0x77, 0x20, 0xF1, 0x01, 0x04, 0x22, 
+    0x27, 0x20, 0x48, 0x01, 0x62, 0xC4, 0x01, 0x13, 0xF0, 0x09, 0x03, 0x60, 0x33, 0xD2, 0xD3, 0x01, 
+    0x77, 0x4F, 0xD0, 0x02, 0xCC, 0xC0, 0xD0, 0x00, 0x30, 0xB1, 0x0C, 0xD1, 0x11, 0x33, 0x11, 0x22, 
+    0x11, 0x20, 0xF1, 0x02, 0x04, 0x22, 0x27, 0x70, 0xF1, 0x01, 0x02, 0x60, 0x70, 0xB4, 0x01, 0x13, 
+    0xF0, 0x0A, 0x05, 0x63, 0x33, 0x11, 0xD2, 0xC3, 0x04, 0x77, 0x66, 0x60, 0xF0, 0x15, 0x00, 0x70, 
+    0xF1, 0x02, 0x04, 0x33, 0x22, 0x20, 0xF1, 0x03, 0x05, 0x22, 0x27, 0x63, 0x49, 0x02, 0x66, 0x20, 
+    0xA4, 0x01, 0x76, 0xF0, 0x09, 0x07, 0x60, 0x33, 0x24, 0x44, 0xE2, 0xC3, 0x04, 0x77, 0x66, 0x60, 
+    0xF0, 0x14, 0x01, 0xDD, 0xE1, 0x06, 0xD7, 0x73, 0x22, 0x20, 0xF1, 0x03, 0x03, 0x23, 0x73, 0xF1, 
+    0x02, 0x07, 0x66, 0x67, 0x44, 0x43, 0xF0, 0x0B, 0x42, 0x00, 0x10, 0xA4, 0x00, 0x10, 0xE2, 0xB3, 
+    0x05, 0x77, 0x76, 0x66, 0xF0, 0x12, 0x00, 0x30, 0xF1, 0x01, 0x01, 0x33, 0x42, 0xF2, 0x00, 0xA1, 
+    0x00, 0x20, 0xF1, 0x04, 0xA6, 0x02, 0x24, 0x70, 0xF0, 0x0B, 0x00, 0x60, 0x42, 0xD4, 0x00, 0x10, 
+    0x49, 0x07, 0x33, 0x77, 0x76, 0x66, 0xF0, 0x10, 0x02, 0x71, 0xD0, 0x47, 0x07, 0x73, 0x33, 0x23, 
+    0x77, 0xCA, 0x00, 0x20, 0xF1, 0x08, 0x05, 0x00, 0x60, 0x32, 0xF0, 0x0C, 0x04, 0x60, 0x33, 0x20, 
+    0xF4, 0x00, 0xD2, 0xD3, 0x05, 0x77, 0x76, 0x66, 0xF0, 0x0A, 0x07, 0x66, 0x60, 0x0D, 0xDD, 0xE1, 
+    0xB3, 0x04, 0x66, 0x77, 0x70, 0xA6, 0x00, 0x70, 0x51, 0x03, 0x00, 0x66, 0x61, 0x01, 0x41, 0xC2, 
+    0xE3, 0x05, 0x77, 0x76, 0x66, 0x54, 0x01, 0x31, 0x47, 0xB1, 0x05, 0x66, 0x68, 0x88, 0xA6, 0x00, 
+    0x20, 0x52, 0xF0, 0x0D, 0x02, 0x60, 0x30, 0x4B, 0x02, 0x44, 0x10, 0xB2, 0xF3, 0x00, 0x02, 0x77, 
+    0x70, 0xC6, 0xF0, 0x04, 0x04, 0x60, 0x00, 0x70, 0x4D, 0x00, 0x70, 0xB8, 0xA6, 0x00, 0x70, 0xF1, 
+    0x06, 0x00, 0x70, 0x5D, 0x00, 0x10, 0xF4, 0x04, 0x00, 0x10, 0xB2, 0xF3, 0x01, 0xA7, 0xF6, 0x01, 
+    0xE0, 0x05, 0x66, 0x03, 0xDD, 0xF1, 0x04, 0x00, 0x60, 0xB8, 0x03, 0x66, 0x68, 0xF1, 0x03, 0x03, 
+    0x26, 0x9B, 0xC0, 0x00, 0x60, 0xF0, 0x09, 0x01, 0x60, 0xA3, 0xF4, 0x06, 0x00, 0x10, 0xB2, 0x4B, 
+    0xF7, 0x01, 0xA6, 0x0B, 0x00, 0x07, 0x37, 0x07, 0x1D, 0x1D, 0xF1, 0x02, 0x00, 0x70, 0xD8, 0x02, 
+    0x68, 0x70, 0xF1, 0x00, 0x01, 0x7C, 0xAB, 0x01, 0x66, 0xF0, 0x0C, 0x01, 0x66, 0x43, 0x00, 0x20, 
+    0xF4, 0x08, 0x00, 0x10, 0x4B, 0x00, 0x30, 0xF7, 0x01, 0x00, 0x30, 0xA7, 0x09, 0x66, 0x63, 0x33, 
+    0x76, 0x63, 0x45, 0x00, 0xD0, 0xD1, 0xC8, 0xA6, 0xD1, 0x01, 0x69, 0xCB, 0x45, 0x00, 0x60, 0xF0, 
+    0x07, 0x01, 0x66, 0xA3, 0x51, 0x03, 0x12, 0x22, 0xF3, 0x02, 0xA7, 0xE3, 0xA7, 0x07, 0x32, 0x37, 
+    0x77, 0x63, 0xAD, 0xF1, 0x02, 0x00, 0x70, 0x47, 0x00, 0xA0, 0xA1, 0x01, 0x69, 0xCB, 0x04, 0x99, 
+    0x66, 0x60, 0xF0, 0x02, 0x05, 0x30, 0x00, 0x66, 0x43, 0x00, 0x00, 0xA3, 0xF4, 0x09, 0x00, 0x10, 
+    0xC2, 0xF3, 0x01, 0x01, 0x77, 0xD3, 0x00, 0x70, 0xA3, 0x04, 0x21, 0x23, 0x30, 0xA7, 0x06, 0xD1, 
+    0x1D, 0x3D, 0xD0, 0xE1, 0x00, 0x20, 0xA8, 0x09, 0x66, 0x88, 0x86, 0x11, 0x79, 0xBB, 0xA9, 0x00, 
+    0xC0, 0x48, 0x05, 0x60, 0x03, 0x33, 0xD0, 0x01, 0x66, 0xA3, 0x00, 0x20, 0xF4, 0x03, 0x03, 0xAA, 
+    0x22, 0x47, 0x00, 0x20, 0x50, 0xB3, 0x02, 0x21, 0x10, 0xB3, 0x06, 0x73, 0xD3, 0x33, 0xD0, 0xF1, 
+    0x01, 0x00, 0x60, 0xB8, 0x08, 0x99, 0x98, 0xAA, 0x66, 0x80, 0xC9, 0x02, 0xC8, 0x80, 0xA6, 0xA0, 
+    0x03, 0x66, 0x60, 0xB3, 0xB0, 0x00, 0x60, 0x50, 0x06, 0x2A, 0x66, 0x6A, 0x20, 0x46, 0x01, 0x22, 
+    0xF3, 0x0C, 0x03, 0x21, 0x11, 0xF3, 0x01, 0x01, 0xDD, 0xF1, 0x00, 0x00, 0xA0, 0xA8, 0x0E, 0xC9, 
+    0x99, 0xB8, 0xAA, 0xA6, 0x89, 0x99, 0xC0, 0xA8, 0xF6, 0x01, 0xF3, 0x02, 0x03, 0x06, 0x60, 0xA3, 
+    0xF4, 0x03, 0x07, 0x0A, 0x68, 0x88, 0x67, 0xF2, 0x02, 0xF3, 0x09, 0x00, 0x20, 0x42, 0x0A, 0x12, 
+    0x33, 0x3D, 0x3D, 0x1D, 0xD0, 0xF1, 0x02, 0x03, 0x68, 0x88, 0xC9, 0x04, 0xA2, 0x76, 0x60, 0xD8, 
+    0xF6, 0x01, 0x00, 0x70, 0xF3, 0x03, 0x01, 0x00, 0xA3, 0x00, 0x20, 0x4D, 0x00, 0x60, 0xA8, 0x00, 
+    0x60, 0xF2, 0x03, 0x54, 0xB1, 0x03, 0xD3, 0xDD, 0xF1, 0x02, 0x00, 0x20, 0xA8, 0x00, 0xC0, 0xA9, 
+    0x03, 0xB8, 0xA6, 0x46, 0x03, 0x7A, 0x77, 0xC6, 0x00, 0x30, 0x4B, 0xC3, 0x00, 0x10, 0xF4, 0x04, 
+    0x43, 0x03, 0xCC, 0x86, 0xD2, 0x00, 0x30, 0xB2, 0x55, 0x03, 0xDD, 0x37, 0x47, 0x02, 0x27, 0xC0, 
+    0xAB, 0x45, 0x03, 0x99, 0xA7, 0x44, 0x03, 0x6A, 0x2A, 0xE7, 0xF3, 0x09, 0x01, 0x72, 0xF4, 0x05, 
+    0x0C, 0xA6, 0x66, 0x88, 0xCC, 0x67, 0x21, 0x10, 0x42, 0xB3, 0x02, 0x22, 0x20, 0x4A, 0xC1, 0x06, 
+    0x33, 0x30, 0xE3, 0xD0, 0xB1, 0x02, 0x36, 0x90, 0xDB, 0x03, 0x98, 0x8C, 0xA9, 0x02, 0xB6, 0xA0, 
+    0xA8, 0x05, 0x6A, 0xAA, 0x6C, 0xD7, 0xF3, 0x09, 0x00, 0x70, 0x56, 0x06, 0xC6, 0x72, 0x11, 0x10, 
+    0x45, 0xA3, 0x01, 0x22, 0xD3, 0x00, 0x20, 0x44, 0x0C, 0xDD, 0xD3, 0x00, 0x3D, 0x13, 0x7C, 0x90, 
+    0xEB, 0x01, 0x99, 0x42, 0x00, 0xC0, 0xB9, 0x0A, 0x66, 0xCC, 0x7A, 0x68, 0x99, 0x90, 0xE7, 0x02, 
+    0x33, 0x70, 0xF3, 0x04, 0x02, 0x77, 0x30, 0xF4, 0x05, 0x00, 0x00, 0x47, 0x07, 0x86, 0x72, 0x11, 
+    0x12, 0xF3, 0x02, 0xF2, 0x00, 0xA1, 0xDD, 0x02, 0x37, 0xC0, 0xFB, 0x01, 0xB9, 0x0B, 0x88, 0xC9, 
+    0x99, 0xB9, 0xB9, 0x8C, 0xE9, 0xD7, 0x00, 0x30, 0x4D, 0x03, 0x77, 0x72, 0xF4, 0x05, 0x00, 0x20, 
+    0xB6, 0x0C, 0x88, 0xCC, 0xC8, 0x67, 0x21, 0x11, 0x20, 0xC3, 0x01, 0x00, 0xA3, 0xC2, 0xA1, 0xBD, 
+    0x02, 0x37, 0xC0, 0xFB, 0x02, 0xE9, 0x06, 0x89, 0x99, 0xBB, 0x90, 0xBB, 0x49, 0x07, 0x37, 0x77, 
+    0x37, 0x67, 0x4B, 0x00, 0x20, 0xF4, 0x06, 0x46, 0x06, 0x8C, 0xCC, 0x86, 0xA0, 0x42, 0x00, 0x20, 
+    0xD3, 0x00, 0x00, 0xC3, 0x44, 0xAD, 0x01, 0x7C, 0xFB, 0x03, 0xA9, 0x0A, 0xCC, 0xC8, 0x89, 0xC9, 
+    0xBB, 0xB0, 0xA9, 0x00, 0x80, 0xF9, 0x00, 0x03, 0x77, 0x73, 0x42, 0x03, 0x76, 0x66, 0x4B, 0x00, 
+    0x10, 0x4E, 0x00, 0x00, 0xB6, 0x43, 0x08, 0xC8, 0x62, 0x11, 0x12, 0x20, 0xF3, 0x04, 0x08, 0x76, 
+    0x62, 0x11, 0xD3, 0x00, 0xFB, 0x03, 0xB9, 0x00, 0xC0, 0xE8, 0xAB, 0xF9, 0x00, 0x00, 0xC0, 0x45, 
+    0x00, 0x70, 0x50, 0x02, 0x77, 0x20, 0xF4, 0x08, 0x00, 0xA0, 0x47, 0x0A, 0x88, 0xC8, 0x62, 0x11, 
+    0x12, 0x20, 0x4C, 0x04, 0x71, 0x26, 0x90, 0xFB, 0x03, 0xA9, 0x00, 0xC0, 0xC8, 0x04, 0x67, 0xAA, 
+    0xC0, 0xBB, 0xF9, 0x04, 0xF7, 0x00, 0x4B, 0x02, 0x33, 0x10, 0xF4, 0x08, 0x00, 0x20, 0xC6, 0x0E, 
+    0x88, 0xC8, 0x88, 0xC8, 0x72, 0x11, 0x12, 0x20, 0xF3, 0x02, 0x03, 0x22, 0x7C, 0xFB, 0x05, 0x02, 
+    0x99, 0x90, 0xB8, 0x01, 0x67, 0xAA, 0x02, 0x89, 0xB0, 0xA9, 0x01, 0xBB, 0xF9, 0x03, 0x01, 0x33, 
+    0xC7, 0x03, 0x66, 0x67, 0xF3, 0x01, 0x01, 0x72, 0xF4, 0x0A, 0x00, 0xA0, 0x45, 0x0D, 0x88, 0x8C, 
+    0xCC, 0x67, 0x21, 0x11, 0x22, 0xF3, 0x00, 0x01, 0x7C, 0xFB, 0x04, 0xB9, 0x00, 0xC0, 0xA8, 0x08, 
+    0x6A, 0xA2, 0xA7, 0x89, 0xB0, 0xF9, 0x0B, 0x00, 0x30, 0xD7, 0x02, 0x67, 0x70, 0x48, 0x01, 0x72, 
+    0xF4, 0x0B, 0x00, 0x20, 0xC6, 0x02, 0x88, 0xC0, 0x42, 0x08, 0x86, 0x72, 0x11, 0x12, 0x20, 0xB3, 
+    0x01, 0x6C, 0xFB, 0x05, 0xB9, 0x00, 0xC0, 0xA8, 0x00, 0x70, 0xAA, 0x03, 0x8C, 0xBB, 0xF9, 0x0D, 
+    0xF7, 0x01, 0xF3, 0x03, 0x04, 0x21, 0x22, 0x10, 0xF4, 0x08, 0x00, 0xA0, 0x45, 0x00, 0x80, 0xBC, 
+    0x03, 0x86, 0x72, 0xB1, 0x03, 0x33, 0x09, 0xFB, 0x02, 0xD9, 0x00, 0xC0, 0xA8, 0x00, 0x60, 0xAA, 
+    0x03, 0x68, 0x9B, 0xB9, 0x00, 0xC0, 0x5B, 0x00, 0x70, 0xF3, 0x01, 0xC7, 0x01, 0x21, 0xF4, 0x06, 
+    0x00, 0x20, 0x4C, 0x08, 0x86, 0x72, 0x11, 0x27, 0xC0, 0xFB, 0x03, 0xC9, 0x05, 0xC8, 0x88, 0x66, 
+    0xBA, 0x03, 0x89, 0xBB, 0xF9, 0x12, 0xF7, 0x01, 0xE3, 0x0C, 0x22, 0x70, 0x00, 0x60, 0x06, 0x72, 
+    0x10, 0xF4, 0x05, 0x00, 0xA0, 0xB6, 0x44, 0xA8, 0x03, 0x67, 0x78, 0xFB, 0x04, 0xB9, 0x00, 0xC0, 
+    0xA8, 0x00, 0x60, 0xBA, 0x03, 0x78, 0x9B, 0xF9, 0x14, 0x00, 0xC0, 0xD7, 0xF3, 0x00, 0xA2, 0x00, 
+    0x60, 0x42, 0x06, 0x66, 0x00, 0x67, 0x20, 0xF4, 0x04, 0x01, 0x27, 0x47, 0xB8, 0x00, 0x90, 0xFB, 
+    0x04, 0xA9, 0x01, 0xCC, 0xB8, 0x00, 0x70, 0xBA, 0x03, 0x88, 0x9B, 0xF9, 0x0D, 0x00, 0xC0, 0xB9, 
+    0xAC, 
+};
+
+const gfx_image_t GAME_SINGLE_LOGO_IMG = {
+    .w = GAME_SINGLE_LOGO_W, .h = GAME_SINGLE_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = GAME_SINGLE_LOGO_PAL, .colors = GAME_SINGLE_LOGO_PAL_SIZE,
+    .data = GAME_SINGLE_LOGO_RLE, .size = GAME_SINGLE_LOGO_RLE_SIZE,
 };
@@ -1,6 +1,7 @@
 /*==============================================================================
  * @file    game_story.c
- * @brief   Story mode state machine, battles, choices, and lore screens.
+ * @brief   Story mode: interpreter for the story bytecode, with the battle,
+ *          choice and result screens it drives.
  *
  * This file is part of the EMG flex-frequency game project and follows the
  * project coding standard for file-level documentation.
@@ -9,1042 +10,486 @@
 #include <string.h>
 #include "timer.h"
 #include "gfx.h"
+#include "hud.h"
 #include "project.h"
 #include "game.h"          // game_get_metrics(...)
+#include "game_story.h"
 #include "choice_input.h"
-#include "story_data.h"
 #include "story_items.h"
-#include "game_story_logo.h"
-#include "story_opening_scene.h"
-#include "story_final_scene.h"
-#include "story_ch1.h"
-#include "story_ch2.h"
-#include "story_ch3.h"
-#include "story_ch4.h"
-#include "story_ch5.h"
-#include "story_ch6.h"
-#include "story_ch7.h"
-#include "story_ch8.h"
-#include "story_ch9.h"
-#include "story_ch10.h"
-#include "story_ch1_enemy.h"
-#include "story_ch2_enemy.h"
-#include "story_ch3_enemy.h"
-#include "story_ch4_enemy.h"
-#include "story_ch5_enemy.h"
-#include "story_ch6_enemy.h"
-#include "story_ch7_enemy.h"
-#include "story_ch8_enemy.h"
-#include "story_ch9_enemy.h"
-#include "story_ch10_enemy.h"
-#include "you_died.h"
+#include "story_script.h"
+#include "lore_text.h"
 #include "chest.h"
 #include "equipment_icon.h"
 #include "cheevos.h"
+#include "round_acc.h"
+#include "pqueue.h"
 #include "enemy_icon.h"
 
 #define STORY_FLEX_MENU_HZ 20.0f     // Hz needed to exit to menu after too many deaths
 #define STORY_CHOICE_SPLIT_HZ 20.0f  // A/B split threshold in Hz
 #define STORY_BAR_MAX_HZ 200.0f      // max scale for story battle bar tweak if...
-#define CHOICE_BAR_MAX_HZ 20.0f      // adjust based on what player Hz looks like
+#define CHOICE_BAR_MAX_HZ 80.0f      // full scale of the A/B choice bar
+#define STORY_DEATHS_MAX 3u          // deaths before the flex-to-menu screen
+#define STORY_OPS_PER_TICK 32u       // runaway guard for a script that never waits
+#define STORY_CALL_DEPTH 4u
 
+// What an op tells the interpreter
 typedef enum {
-  STS_LOGO = 0,
-  STS_BRAND,        // story “title card”
-  STS_INTRO,        // show chapter title + enemy
-  STS_CHOOSE,       // A/B choice via Hz
-  STS_BATTLE,       // 10 s flex window; accumulate avg
-  STS_RESULT,       // show pass/fail vs enemy
-  STS_REWARD,       // echo chosen item
-  STS_DEATH,        // you died screen (on defeat)
-  STS_NEXT,         // advance chapter
-  STS_ENDING,       // final scene
-  STS_LORE_BRAND,   // global story intro lore text
-  STS_LORE_CHAPTER, // per-chapter lore text
-  STS_LORE_ENDING,  // lore text before the final ending scene
-  STS_FLEX_RETURN   // flex after too many deaths to go back to menu
-} story_state_t;
-
-static story_state_t g_s;
-static uint32_t      g_t0;
-static uint8_t       g_chapter;        // 0..9
+  STEP_NEXT = 0,   // continue with the following op this tick
+  STEP_YIELD,      // continue with the following op next tick
+  STEP_HOLD,       // run this op again next tick
+  STEP_GOTO,       // g_pc was set
+  STEP_END         // story over
+} story_step_t;
+
+// Operand bytes of each op (see story_script.h)
+static const uint8_t k_op_len[SOP_COUNT] = {
+  [SOP_END]     = 0, [SOP_SCREEN] = 0, [SOP_DEFER]  = 1, [SOP_CLEAR]   = 0,
+  [SOP_ART]     = 3, [SOP_HEADER] = 4, [SOP_TEXT]   = 7, [SOP_BAR]     = 6,
+  [SOP_MARK]    = 0, [SOP_LORE]   = 1, [SOP_TYPE]   = 3, [SOP_WAIT]    = 2,
+  [SOP_CHAPTER] = 8, [SOP_FOE]    = 4, [SOP_CHOOSE] = 2, [SOP_BATTLE]  = 2,
+  [SOP_RESULT]  = 4, [SOP_LOOT]   = 0, [SOP_DIED]   = 2, [SOP_GIVEUP]  = 4,
+  [SOP_UNLOCK]  = 1, [SOP_JUMP]   = 2, [SOP_CALL]   = 2, [SOP_RET]     = 0,
+};
+
+// Interpreter state
+static uint16_t      g_pc;             // offset of the current op
+static uint16_t      g_stack[STORY_CALL_DEPTH];
+static uint8_t       g_sp;
+static bool          g_entered;        // current waiting op has drawn its screen
+static uint32_t      g_t0;             // start of the current waiting op (ms)
+static uint32_t      g_now;            // time of this tick (ms)
+#ifdef HOST_SIM
+static story_op_stats_t g_op_stats[SOP_COUNT];
+#endif
+
+// Current chapter (SOP_CHAPTER)
+static const char   *g_name;
+static const char   *g_enemy;
+static uint16_t      g_enemy_hz;
+static uint8_t       g_art;            // img operands
+static uint8_t       g_foe;
+
+static float         g_hz;             // P1's Hz this tick
 static story_item_t  g_equipped;       // last choice (A/B)
 static story_item_t  g_prev_equipped;  // previous item
-static float         g_sum_hz;
-static uint32_t      g_cnt_hz;
+static round_stats_t g_round;          // last battle's flex round
 
 // Current chapter’s A/B item options
 static const story_item_t *g_itemA;
 static const story_item_t *g_itemB;
 
-static bool          g_dirty;          // true = need to (re)draw this state's screen
+static gfx_scroll_t  g_lore_view;      // lore page scrolled by the display start line
+static hud_bar_t     g_hz_bar;         // choice / battle Hz bar with threshold marker
+static hud_countdown_t g_flex_left;    // "Flex... Ns left" in battle
 
 // 3 deaths needed to exit
 static uint8_t       g_story_deaths = 0u;
 
-// Per-chapter enemy sprite descriptor for Story mode
-typedef struct {
-  uint8_t w;
-  uint8_t h;
-  const uint8_t  *idx;
-  const uint16_t *pal;
-} enemy_sprite_t;
-
-// Per-chapter intro sprite descriptor (chapter opening art)
-typedef struct {
-  uint8_t w;
-  uint8_t h;
-  const uint8_t  *idx;
-  const uint16_t *pal;
-} intro_sprite_t;
-
-// One entry per chapter (0..9)
-static const intro_sprite_t g_intro_sprites[STORY_CHAPTERS] = {
-  // chapter 0 -> story_ch1.png
-  { STORY_CH1_W,  STORY_CH1_H,  STORY_CH1_IDX,  STORY_CH1_PAL  },
-  // chapter 1 -> story_ch2.png
-  { STORY_CH2_W,  STORY_CH2_H,  STORY_CH2_IDX,  STORY_CH2_PAL  },
-  // chapter 2 -> story_ch3.png
-  { STORY_CH3_W,  STORY_CH3_H,  STORY_CH3_IDX,  STORY_CH3_PAL  },
-  // chapter 3 -> story_ch4.png
-  { STORY_CH4_W,  STORY_CH4_H,  STORY_CH4_IDX,  STORY_CH4_PAL  },
-  // chapter 4 -> story_ch5.png
-  { STORY_CH5_W,  STORY_CH5_H,  STORY_CH5_IDX,  STORY_CH5_PAL  },
-  // chapter 5 -> story_ch6.png
-  { STORY_CH6_W,  STORY_CH6_H,  STORY_CH6_IDX,  STORY_CH6_PAL  },
-  // chapter 6 -> story_ch7.png
-  { STORY_CH7_W,  STORY_CH7_H,  STORY_CH7_IDX,  STORY_CH7_PAL  },
-  // chapter 7 -> story_ch8.png
-  { STORY_CH8_W,  STORY_CH8_H,  STORY_CH8_IDX,  STORY_CH8_PAL  },
-  // chapter 8 -> story_ch9.png
-  { STORY_CH9_W,  STORY_CH9_H,  STORY_CH9_IDX,  STORY_CH9_PAL  },
-  // chapter 9 -> story_ch10.png
-  { STORY_CH10_W, STORY_CH10_H, STORY_CH10_IDX, STORY_CH10_PAL },
-};
-
-// One entry per chapter (0..9)
-static const enemy_sprite_t g_enemy_sprites[STORY_CHAPTERS] = {
-  // chapter 0 -> story_ch1.png
-  { STORY_CH1_ENEMY_W,  STORY_CH1_ENEMY_H,  STORY_CH1_ENEMY_IDX,  STORY_CH1_ENEMY_PAL  },
-  // chapter 1 -> story_ch2.png
-  { STORY_CH2_ENEMY_W,  STORY_CH2_ENEMY_H,  STORY_CH2_ENEMY_IDX,  STORY_CH2_ENEMY_PAL  },
-  // chapter 2 -> story_ch3.png
-  { STORY_CH3_ENEMY_W,  STORY_CH3_ENEMY_H,  STORY_CH3_ENEMY_IDX,  STORY_CH3_ENEMY_PAL  },
-  // chapter 3 -> story_ch4.png
-  { STORY_CH4_ENEMY_W,  STORY_CH4_ENEMY_H,  STORY_CH4_ENEMY_IDX,  STORY_CH4_ENEMY_PAL  },
-  // chapter 4 -> story_ch5.png
-  { STORY_CH5_ENEMY_W,  STORY_CH5_ENEMY_H,  STORY_CH5_ENEMY_IDX,  STORY_CH5_ENEMY_PAL  },
-  // chapter 5 -> story_ch6.png
-  { STORY_CH6_ENEMY_W,  STORY_CH6_ENEMY_H,  STORY_CH6_ENEMY_IDX,  STORY_CH6_ENEMY_PAL  },
-  // chapter 6 -> story_ch7.png
-  { STORY_CH7_ENEMY_W,  STORY_CH7_ENEMY_H,  STORY_CH7_ENEMY_IDX,  STORY_CH7_ENEMY_PAL  },
-  // chapter 7 -> story_ch8.png
-  { STORY_CH8_ENEMY_W,  STORY_CH8_ENEMY_H,  STORY_CH8_ENEMY_IDX,  STORY_CH8_ENEMY_PAL  },
-  // chapter 8 -> story_ch9.png
-  { STORY_CH9_ENEMY_W,  STORY_CH9_ENEMY_H,  STORY_CH9_ENEMY_IDX,  STORY_CH9_ENEMY_PAL  },
-  // chapter 9 -> story_ch10.png
-  { STORY_CH10_ENEMY_W, STORY_CH10_ENEMY_H, STORY_CH10_ENEMY_IDX, STORY_CH10_ENEMY_PAL },
-};
-
-// Lore text data
-// Global intro lore lines
-static const char* g_lore_brand_lines[] = {
-  "You wake up from",
-  "a dream. Eyes",
-  "blinkng from the",
-  "dry air. Casting",
-  "your eyes outside,",
-  "you enjoy the sun.",
-  "Finally getting up,",
-  "you start your day."
-};
-static const uint8_t g_lore_brand_count =
-    sizeof(g_lore_brand_lines)/sizeof(g_lore_brand_lines[0]);
-
-// Per-chapter lore: multi-line text per chapter
-
-static const char* g_lore_ch1_lines[] = {
-  "Long ago,",
-  "EMG warriors trained",
-  "to fight evil. Now,",
-  "the realms grow into",
-  "chaos. Peace is now",
-  "gone.",
-  "Hence, a new",
-  "challenger rises..."
-};
-static const uint8_t g_lore_ch1_count =
-    sizeof(g_lore_ch1_lines)/sizeof(g_lore_ch1_lines[0]);
-
-static const char* g_lore_ch2_lines[] = {
-  "After your daily",
-  "morning session, you",
-  "walk towards the tra",
-  "-ining grounds. Here",
-  "you start to get",
-  "serious! An iron dum",
-  "-my catches your eye",
-  ". You stare at it",
-  "and then strike!!!"
-};
-static const uint8_t g_lore_ch2_count =
-    sizeof(g_lore_ch2_lines)/sizeof(g_lore_ch2_lines[0]);
-
-static const char* g_lore_ch3_lines[] = {
-  "HEY! Says a villager",
-  "You stop training. H",
-  "-e says the villager",
-  "kids explored the",
-  "catacombs and haven'",
-  "-t returned! Hence,",
-  "you bravely travel",
-  "to the catacombs",
-  "to save the kids."
-};
-static const uint8_t g_lore_ch3_count =
-    sizeof(g_lore_ch3_lines)/sizeof(g_lore_ch3_lines[0]);
-
-static const char* g_lore_ch4_lines[] = {
-  "The village thanks y",
-  "-our efforts. Giving",
-  "a sum of silver. Wit",
-  "-h this money obtain",
-  "you head off to the",
-  "kingdom to become a",
-  "pulse-knight! Howeve",
-  "-r along the way you",
-  "are stopped by a gro",
-  "-up of... bandits?!"
-};
-static const uint8_t g_lore_ch4_count =
-    sizeof(g_lore_ch4_lines)/sizeof(g_lore_ch4_lines[0]);
-
-static const char* g_lore_ch5_lines[] = {
-  "After defeating the",
-  "bandits you continue",
-  "onward. Soon several",
-  "days you come across",
-  "a knight camp near t",
-  "-he kingdom. You see",
-  "to test your skills.",
-  "A training knight is",
-  "angered by your ego.",
-  "He challenges you!"
-};
-static const uint8_t g_lore_ch5_count =
-    sizeof(g_lore_ch5_lines)/sizeof(g_lore_ch5_lines[0]);
-
-static const char* g_lore_ch6_lines[] = {
-  "Several days gone by",
-  "since your arrival.",
-  "You soon hear some",
-  "news about a tourna",
-  "-ment, you enter, ho",
-  "-ping to make a name",
-  "for yourself. After",
-  "many duels you enter",
-  "the final. A knight",
-  "prepares his weapon."
-};
-static const uint8_t g_lore_ch6_count =
-    sizeof(g_lore_ch6_lines)/sizeof(g_lore_ch6_lines[0]);
-
-static const char* g_lore_ch7_lines[] = {
-  "Winning the tourney",
-  "gave you the pass",
-  "to Arcane Tower. Hap",
-  "-ppily accepting the",
-  "reward, you head to",
-  "a floating tower in",
-  "the sky. Entering in",
-  "-side Arcane Tower,",
-  "an gramps wants your",
-  "help. But you must",
-  "defeat him first."
-};
-static const uint8_t g_lore_ch7_count =
-    sizeof(g_lore_ch7_lines)/sizeof(g_lore_ch7_lines[0]);
-
-static const char* g_lore_ch8_lines[] = {
-  "The sorcerer needs h",
-  "-elp to locate the D",
-  "emon Castle. He need",
-  "a dragon's heart. So",
-  "after traveling,",
-  "the dragon's lair is",
-  "infront of you. Step",
-  "by step you traverse",
-  "inside. Soon you see",
-  "the dragon staring.",
-  "It roars & charges!"
-};
-static const uint8_t g_lore_ch8_count =
-    sizeof(g_lore_ch8_lines)/sizeof(g_lore_ch8_lines[0]);
-
-static const char* g_lore_ch9_lines[] = {
-  "Returning to Arcane",
-  "Tower givin the Sorc",
-  "-erer the dragon he",
-  "-art, he gives you",
-  "the location of the",
-  "Demon Castle. Many",
-  "years past in your",
-  "jourey. The hellish",
-  "enviroment homes the",
-  "Demon King. Entering",
-  "he sits on throne."
-};
-static const uint8_t g_lore_ch9_count =
-    sizeof(g_lore_ch9_lines)/sizeof(g_lore_ch9_lines[0]);
-
-static const char* g_lore_ch10_lines[] = {
-  "[wow. WONDERFUL!!!]",
-  "A unkown voice enter",
-  "your head. [You did",
-  "it, this wasn't supp",
-  "-osed to happen...",
-  "i'll remove you :)].",
-  "Opening your eyes, a",
-  "figure smile at you.",
-  "They raise their arm",
-  "but you rush in!!!"
-};
-static const uint8_t g_lore_ch10_count =
-    sizeof(g_lore_ch10_lines)/sizeof(g_lore_ch10_lines[0]);
-
-// Table of chapter-lore blocks
-typedef struct {
-  const char* const* lines;
-  uint8_t count;
-} lore_block_t;
-
-static const lore_block_t g_lore_chapters[STORY_CHAPTERS] = {
-  { g_lore_ch1_lines,  g_lore_ch1_count  }, // chapter 0
-  { g_lore_ch2_lines,  g_lore_ch2_count  }, // chapter 1
-  { g_lore_ch3_lines,  g_lore_ch3_count  }, // chapter 2
-  { g_lore_ch4_lines,  g_lore_ch4_count  }, // chapter 3
-  { g_lore_ch5_lines,  g_lore_ch5_count  }, // chapter 4
-  { g_lore_ch6_lines,  g_lore_ch6_count  }, // chapter 5
-  { g_lore_ch7_lines,  g_lore_ch7_count  }, // chapter 6
-  { g_lore_ch8_lines,  g_lore_ch8_count  }, // chapter 7
-  { g_lore_ch9_lines,  g_lore_ch9_count  }, // chapter 8
-  { g_lore_ch10_lines, g_lore_ch10_count }  // chapter 9
-};
-
-// Ending lore lines
-static const char* g_lore_ending_lines[] = {
-  "You slowly open your",
-  "eyes. Mind is cloudy",
-  "The dead Demon King",
-  "lays at your feet.",
-  "... you saved the wo",
-  "ld. you raise a hand",
-  "to the sky:YOU SAVED",
-  "the world! You went",
-  "back and spent your",
-  "life a hero! @&($#)"
-};
-static const uint8_t g_lore_ending_count =
-    sizeof(g_lore_ending_lines)/sizeof(g_lore_ending_lines[0]);
-
-// Draw a simple lore screen: header + multiple lines of text.
-static void draw_lore_screen(const char* title,
-                             const char* const* lines,
-                             uint8_t count)
-{
-  gfx_clear(COL_BLACK);
-  gfx_header(title, COL_WHITE);
+/*------------------------------ operands -----------------------------------*/
 
-  uint8_t y = 24;  // start below header
-  for (uint8_t i = 0; i < count; ++i) {
-    if (lines[i] && lines[i][0] != '\0') {
-      gfx_text2(4, y, lines[i], COL_WHITE, 1);
-    }
-    y = (uint8_t)(y + 10);
-    if (y > 120u) break;
-  }
+static uint16_t rd16(const uint8_t *p){
+  return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
 }
 
-// Typewriter-style lore: slowly reveal text over time.
-// NOTE: does NOT clear the screen or draw header; caller does that once via g_dirty.
-static void story_draw_lore_typewriter(const char* const* lines,
-                                       uint8_t count,
-                                       uint32_t dt,
-                                       uint16_t ms_per_char)
-{
-  uint32_t chars = dt / ms_per_char;  // total characters across all lines
-  uint8_t  y     = 24;                // first line Y
-
-  for (uint8_t i = 0; i < count; ++i) {
-    const char* s = lines[i];
-    if (!s) {
-      continue;
-    }
-
-    size_t len = strlen(s);
-    if (chars == 0u) {
-      break;  // nothing left to draw
-    }
-
-    uint32_t this_chars = chars;
-    if (this_chars > len) {
-      this_chars = len;
-    }
-
-    // Draw prefix of this line
-    char buf[32];  // adjust if ever have >31-char lines
-    if (this_chars > sizeof(buf) - 1u) {
-      this_chars = sizeof(buf) - 1u;
-    }
-    memcpy(buf, s, this_chars);
-    buf[this_chars] = '\0';
-
-    // Draw only the visible prefix; earlier characters are redrawn in-place
-    gfx_text2(4, y, buf, COL_WHITE, 1);
-
-    y = (uint8_t)(y + 10u);
-    if (y > 120u) {
-      break;  // off-screen
-    }
-
-    // Consume characters for this line (+1 “newline” spacer)
-    if (chars > (uint32_t)len + 1u) {
-      chars -= (uint32_t)len + 1u;
-    } else {
-      chars = 0u;
-    }
-  }
+static const char *str_at(uint16_t off){
+  return (off == STORY_STR_NAME) ? g_name : &g_story_str[off];
 }
 
-// Draw the enemy battle Hz bar at the bottom of the screen.
-// hz        = current player Hz
-// target_hz = enemy's target Hz for this chapter
-static void draw_enemy_hz_bar(float hz, float target_hz)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 112;     // bottom band
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 12;
-
-  if (target_hz <= 0.0f) target_hz = 1.0f;
-
-  float max_hz = STORY_BAR_MAX_HZ;
-  if (max_hz < 1.0f) max_hz = 1.0f;
-
-  // Clamp target to the bar’s max so the red line stays on-screen
-  if (target_hz > max_hz) target_hz = max_hz;
-
-  if (hz < 0.0f) hz = 0.0f;
-  // Clear the band once per frame
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
-
-  // Current Hz bar (green-ish)
-  uint8_t cur_w = (uint8_t)((hz / max_hz) * (float)bar_w + 0.5f);
-  if (cur_w > bar_w) cur_w = bar_w;
-  if (cur_w > 0u){
-    gfx_bar(bar_x, bar_y, cur_w, bar_h, COL_GREEN);
-  }
+static uint8_t img_id(uint8_t i){
+  return (i == STORY_IMG_ART) ? g_art : (i == STORY_IMG_FOE) ? g_foe : i;
+}
 
-  // Threshold line (enemy required Hz) as a 1-px wide red bar
-  uint8_t th_x = bar_x + (uint8_t)((target_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x < bar_x) th_x = bar_x;
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+// Time in the current waiting op; the first call draws its screen
+static uint32_t wait_dt(bool *first){
+  *first    = !g_entered;
+  g_entered = true;
+  return g_now - g_t0;
 }
 
-// Chest choice Hz bar (Story):
-// A on the left, B on the right, bar sits over the chest image.
-static void story_choice_bar_static(void)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 60;    // roughly across the chest
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 8;
-
-  // baseline band
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
-
-  // A / B labels just above the bar
-  gfx_text2(bar_x,           bar_y - 10, "A", COL_CYAN,   1);
-  gfx_text2(bar_x + bar_w - 6, bar_y - 10, "B", COL_YELLOW, 1);
-
-  // draw static threshold marker once (we'll redraw it in the dynamic pass anyway)
-  float max_hz = 80.0f;
-  float th_hz  = STORY_CHOICE_SPLIT_HZ;
-  if (th_hz < 0.0f)     th_hz = 0.0f;
-  if (th_hz > max_hz)   th_hz = max_hz;
-  uint8_t th_x = bar_x + (uint8_t)((th_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+// A waiting op is over: the next one counts from now
+static story_step_t wait_over(story_step_t s){
+  g_entered = false;
+  g_t0      = g_now;
+  return s;
 }
 
-static void draw_choice_bar(float hz, float need_hz)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 55;
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 10;
+static story_step_t jump(uint16_t addr){
+  g_pc = addr;
+  return STEP_GOTO;
+}
 
-  if (need_hz <= 0.0f) need_hz = 1.0f;
-  float max_hz = CHOICE_BAR_MAX_HZ;
-  if (max_hz < 1.0f) max_hz = 1.0f;
+/*--------------------------- composite screens -----------------------------*/
 
-  if (hz < 0.0f) hz = 0.0f;
-  if (hz > max_hz) hz = max_hz;
+static void choose_draw(void){
+  gfx_defer_begin(GFX_PRIO_ART);
+  gfx_clear(COL_BLACK);
 
-  if (need_hz > max_hz) need_hz = max_hz;
+  // Chest in center
+  uint8_t cx = (uint8_t)((128 - CHEST_W) / 2);
+  uint8_t cy = (uint8_t)((128 - CHEST_H) / 2);
 
-  // Background
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
+  gfx_blit_image(cx, cy, &CHEST_IMG);
+  gfx_defer_begin(GFX_PRIO_HUD);
 
-  // Current Hz (green)
-  uint8_t cur_w = (uint8_t)((hz / max_hz) * (float)bar_w + 0.5f);
-  if (cur_w > bar_w) cur_w = bar_w;
-  if (cur_w > 0u){
-    gfx_bar(bar_x, bar_y, cur_w, bar_h, COL_GREEN);
-  }
+  // Randomly pick two distinct items from STORY_ITEMS[]
+  uint8_t i0, i1;
+  story_items_pick_two(&i0, &i1);
+  g_itemA = &STORY_ITEMS[i0];
+  g_itemB = &STORY_ITEMS[i1];
 
-  // Threshold red line at need_hz
-  uint8_t th_x = bar_x + (uint8_t)((need_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x < bar_x) th_x = bar_x;
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+  gfx_header("CHOOSE", COL_WHITE);
 
-  // Labels A / B (if this bar is for item choice)
-  gfx_text2(bar_x + 2,           bar_y - 8, "A", COL_WHITE, 1);
-  gfx_text2(bar_x + bar_w - 8u,  bar_y - 8, "B", COL_WHITE, 1);
-}
+  char lineA[40];
+  char lineB[40];
+  snprintf(lineA, sizeof(lineA), "A) %s", g_itemA->name);
+  snprintf(lineB, sizeof(lineB), "B) %s", g_itemB->name);
 
-// Dynamic fill for choice bar (Story)
-// Call every tick with current hz.
-static void story_choice_bar_update(float hz)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 55;
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 10;
-
-  float max_hz = 80.0f;
-  if (hz < 0.0f)     hz = 0.0f;
-  if (hz > max_hz)   hz = max_hz;
-
-  // Clear band back to baseline
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
-
-  // Fill according to current Hz
-  uint8_t cur_w = (uint8_t)((hz / max_hz) * (float)bar_w + 0.5f);
-  if (cur_w > bar_w) cur_w = bar_w;
-  if (cur_w > 0u){
-    gfx_bar(bar_x, bar_y, cur_w, bar_h, COL_GREEN);
-  }
+  gfx_text2(0, 110, lineA, COL_CYAN,   1);
+  gfx_text2(0, 120, lineB, COL_YELLOW, 1);
+  choice_draw_hint(80);
 
-  // Re-draw threshold marker on top
-  float th_hz = STORY_CHOICE_SPLIT_HZ;
-  if (th_hz < 0.0f)     th_hz = 0.0f;
-  if (th_hz > max_hz)   th_hz = max_hz;
-  uint8_t th_x = bar_x + (uint8_t)((th_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+  // A/B bar over the chest, red marker at the split
+  gfx_text2(6,   47, "A", COL_WHITE, 1);
+  gfx_text2(116, 47, "B", COL_WHITE, 1);
+  gfx_defer_end();
+  hud_bar_init(&g_hz_bar, 4, 55, 120, 10, CHOICE_BAR_MAX_HZ, COL_GREEN, COL_DKGRAY);
+  hud_bar_mark(&g_hz_bar, STORY_CHOICE_SPLIT_HZ, COL_RED);
 }
 
-static void story_unlock_for_chapter(uint8_t ch){
-  switch(ch){
-    case 0:  // Chapter 1 – Scarecrow
-      cheevos_unlock(ACH_CH1);
-      cheevos_unlock(ACH_SCARECROW);
-      break;
-    case 1:  // Chapter 2 – Training Dummy
-      cheevos_unlock(ACH_CH2);
-      cheevos_unlock(ACH_TRAINING_DUMMY);
-      break;
-    case 2:  // Chapter 3 – Rat King
-      cheevos_unlock(ACH_CH3);
-      cheevos_unlock(ACH_RAT_KING);
-      break;
-    case 3:  // Chapter 4 – Bandits
-      cheevos_unlock(ACH_CH4);
-      cheevos_unlock(ACH_BANDITS);
-      break;
-    case 4:  // Chapter 5 – Knight
-      cheevos_unlock(ACH_CH5);
-      cheevos_unlock(ACH_KNIGHT);
-      break;
-    case 5:  // Chapter 6 – Champion
-      cheevos_unlock(ACH_CH6);
-      cheevos_unlock(ACH_CHAMPION);
-      break;
-    case 6:  // Chapter 7 – Sorcerer
-      cheevos_unlock(ACH_CH7);
-      cheevos_unlock(ACH_SORCERER);
-      break;
-    case 7:  // Chapter 8 – Dragon
-      cheevos_unlock(ACH_CH8);
-      cheevos_unlock(ACH_DRAGON);
-      break;
-    case 8:  // Chapter 9 – Demon King
-      cheevos_unlock(ACH_CH9);
-      cheevos_unlock(ACH_DEMON_KING);
-      break;
-    case 9:  // Chapter 10 – Game Admin
-      cheevos_unlock(ACH_CH10);
-      cheevos_unlock(ACH_GAME_ADMIN);
-      break;
-    default:
-      break;
+static void choose_update(void){
+  // live bar update using current Hz
+  hud_bar_set(&g_hz_bar, g_hz);
+
+  // Live Hz-based choice: last one wins before timeout
+  choice_t ch = choice_from_hz(g_hz, STORY_CHOICE_SPLIT_HZ);
+  const story_item_t *cur = (ch == CHOICE_A) ? g_itemA : g_itemB;
+  if (cur) {
+    g_prev_equipped = g_equipped;  // remember old item
+    g_equipped      = *cur;        // new item becomes current
   }
 }
 
-static void s_goto(story_state_t ns){
-  g_s    = ns;
-  g_t0   = millis();
-  g_dirty = true;
+static void battle_draw(uint16_t ms){
+  gfx_defer_begin(GFX_PRIO_HUD);
+  gfx_header("BATTLE", COL_RED);
+  gfx_defer_begin(GFX_PRIO_ART);
+
+  // Enemy stands in front of this chapter's scene: both are merged
+  // row by row and sent once, everything below the header in one pass
+  const gfx_image_t *bg = g_story_img[g_art];
+  const gfx_image_t *es = g_story_img[g_foe];
+  gfx_layer_t layers[2] = {
+    { bg, (int16_t)((128 - bg->w) / 2), 20, GFX_KEY_NONE },
+    { es, (int16_t)((128 - es->w) / 2), 16, g_story_img_key[g_foe] },
+  };
+  gfx_compose(0, 18, 128, 110, COL_BLACK, layers, 2);
+
+  // Countdown band and enemy Hz bar at the bottom
+  gfx_defer_begin(GFX_PRIO_HUD);
+  gfx_bar(0, 96, 128, 12, COL_BLACK);
+  gfx_defer_end();
+  hud_countdown_init(&g_flex_left, 6, 96, 1, "Flex... ", 1, "s left",
+                     COL_WHITE, COL_BLACK, g_t0 + ms);
+  hud_bar_init(&g_hz_bar, 4, 112, 120, 12, STORY_BAR_MAX_HZ, COL_GREEN, COL_DKGRAY);
+  round_acc_begin(0u, pqueue_seat(0), g_t0, ms, ROUND_ACTIVE_HZ);
 }
 
-void game_story_init(void){
-  g_chapter  = 0;
-  g_equipped = STORY_ITEM_A;
-  g_prev_equipped = STORY_ITEM_A;   // start with same
-  g_sum_hz   = 0.0f;
-  g_cnt_hz   = 0u;
-  g_itemA    = &STORY_ITEM_A;
-  g_itemB    = &STORY_ITEM_B;
-  g_story_deaths = 0u;
-  cheevos_unlock(ACH_STORY_START);
-  s_goto(STS_LOGO);
+// Effective player and enemy Hz of the last battle
+static float result_you(void){
+  return g_round.active_hz * g_equipped.player_mult;
+}
+static float result_foe(void){
+  return (float)g_enemy_hz * g_equipped.enemy_mult;
 }
 
-bool game_story_tick(void){
-  uint32_t dt = millis() - g_t0;
-
-  float   hz   = 0.0f;
-  float   base = 0.0f;
-  uint8_t pct  = 0;
-  game_get_metrics(&hz, &pct, &base);
-  (void)base;
-  (void)pct;
-
-  switch(g_s){
-
-    case STS_LOGO: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        
-        uint8_t x = (uint8_t)((128 - GAME_STORY_LOGO_W) / 2);
-        uint8_t y = (uint8_t)((128 - GAME_STORY_LOGO_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      GAME_STORY_LOGO_W, GAME_STORY_LOGO_H,
-                      GAME_STORY_LOGO_IDX,
-                      GAME_STORY_LOGO_PAL);
-
-
-      }
-      if (dt >= 5000u) { //5000
-        s_goto(STS_LORE_BRAND);
-      }
-    } break;
-
-    case STS_LORE_BRAND: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("Prologue", COL_WHITE);
-        // any static art/lines go here ONCE
-        gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);
+static void battle_update(void){
+  hud_countdown_tick(&g_flex_left, g_now);
 
-      }
+  // Use the *effective* enemy Hz based on items (red line = foe target)
+  hud_bar_set(&g_hz_bar, g_hz);
+  hud_bar_mark(&g_hz_bar, result_foe(), COL_RED);
+}
 
-      // Only text updates each tick; no clears
-      draw_lore_typewriter(g_lore_brand_lines,
-                          g_lore_brand_count,
-                          dt,
-                          40u);   // ms per char
+static void result_draw(void){
+  float you = result_you();
+  float foe = result_foe();
 
-      if (dt >= 8000u){ //13000
-        s_goto(STS_BRAND);
-      }
-    } break;
+  gfx_clear(COL_BLACK);
 
-    case STS_BRAND: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
+//  uint8_t x = (uint8_t)(98);
+//  uint8_t y = (uint8_t)(0);
 
-        // Draw global story opening scene image, centered
-        uint8_t x = (uint8_t)((128 - STORY_OPENING_SCENE_W) / 2);
-        uint8_t y = (uint8_t)((128 - STORY_OPENING_SCENE_H) / 2);
+//  gfx_blit_image(x, y, &ENEMY_ICON_IMG);
 
-        gfx_blit_pal4(x, y,
-                      STORY_OPENING_SCENE_W, STORY_OPENING_SCENE_H,
-                      STORY_OPENING_SCENE_IDX,
-                      STORY_OPENING_SCENE_PAL);
-      }
-      if (dt >= 5000u){ //5000
-        s_goto(STS_LORE_CHAPTER);
-      }
-    } break;
+  // seperator for VICTOR and defeat
+  gfx_rect(0, 67, 187, 1, COL_GRAY);
 
-    case STS_LORE_CHAPTER: {
-      const story_chapter_t* c = &g_story[g_chapter];
-      const lore_block_t*    lb = &g_lore_chapters[g_chapter];
-
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        
-        gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);
+  gfx_header("RESULT", COL_WHITE);
+  char l1[40]; snprintf(l1, sizeof(l1), "You: %.1f Hz", you);
+  char l2[40]; snprintf(l2, sizeof(l2), "Enemy: %.1f Hz", foe);
+  gfx_text2(6, 36, l1, COL_CYAN, 1);
+  gfx_text2(6, 50, l2, COL_YELLOW, 1);
+  gfx_text2(6, 76,
+            (you >= foe) ? "VICTORY" : "DEFEAT",
+            (you >= foe) ? COL_GREEN  : COL_RED,
+            3);
+}
 
-        gfx_header(c->name, COL_WHITE);
-        // any static decorations per chapter go here once
-      }
+static void loot_draw(void){
+  gfx_clear(COL_BLACK);
 
-      draw_lore_typewriter(lb->lines,
-                          lb->count,
-                          dt,
-                          50u);
+//  uint8_t x = (uint8_t)(98);
+//  uint8_t y = (uint8_t)(0);
 
-      if (dt >= 13000u){ //13000
-        s_goto(STS_INTRO);
-      }
-    } break;
-
-    case STS_INTRO: {
-      const story_chapter_t* c = &g_story[g_chapter];
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        // Chapter name in header
-        gfx_header(c->name, COL_WHITE);
-
-        // Draw chapter-specific intro art for this chapter
-        const intro_sprite_t *is = &g_intro_sprites[g_chapter];
-
-        uint8_t ix = (uint8_t)((128 - is->w) / 2);
-        uint8_t iy = 20;   // leave header band at top
-        
-        gfx_blit_pal4(ix, iy,
-                      is->w, is->h,
-                      is->idx,
-                      is->pal);
-
-        // Overlay target info near the bottom over a small band
-        gfx_bar(0, 104, 128, 24, COL_DKGRAY);
-        char line[40];
-        snprintf(line, sizeof(line), "%s STR: %u Hz",
-                 c->enemy, (unsigned)c->enemy_hz);
-        gfx_text2(1, 106, line, COL_YELLOW, 1);
-        gfx_text2(1, 118, "Choose an item (A/B) with Hz", COL_WHITE, 1);
-      }
-      if (dt >= 7000u){ //7000
-        s_goto(STS_CHOOSE);
-      }
-    } break;
-
-    case STS_CHOOSE: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        // Chest in center
-        uint8_t cx = (uint8_t)((128 - CHEST_W) / 2);
-        uint8_t cy = (uint8_t)((128 - CHEST_H) / 2);
-
-        gfx_blit_pal4(cx, cy,
-                      CHEST_W, CHEST_H,
-                      CHEST_IDX,
-                      CHEST_PAL);
-
-        // Randomly pick two distinct items from STORY_ITEMS[]
-        uint8_t i0, i1;
-        story_items_pick_two(&i0, &i1);
-        g_itemA = &STORY_ITEMS[i0];
-        g_itemB = &STORY_ITEMS[i1];
-
-        gfx_header("CHOOSE", COL_WHITE);
-
-        char lineA[40];
-        char lineB[40];
-        snprintf(lineA, sizeof(lineA), "A) %s", g_itemA->name);
-        snprintf(lineB, sizeof(lineB), "B) %s", g_itemB->name);
-
-        gfx_text2(0, 110, lineA, COL_CYAN,   1);
-        gfx_text2(0, 120, lineB, COL_YELLOW, 1);
-        choice_draw_hint(80);
-
-        // draw static A/B bar over the chest
-        //story_choice_bar_static();
-        draw_choice_bar(hz, STORY_CHOICE_SPLIT_HZ);
-      }
+//  gfx_blit_image(x, y, &EQUIPMENT_ICON_IMG);
 
-      // live bar update using current Hz
-      story_choice_bar_update(hz);
+  // Draw background for equipment and items, also green rectangle of current equiped item.
+  gfx_bar(0, 38, 128, 32, COL_DKGRAY);
+  gfx_bar(0, 70, 128, 64, COL_GRAY);
+  gfx_rect(1, 84, 127, 12, COL_GREEN);
 
-      // Live Hz-based choice: last one wins before timeout
-      choice_t ch = choice_from_hz(hz, STORY_CHOICE_SPLIT_HZ);
-      const story_item_t *cur = (ch == CHOICE_A) ? g_itemA : g_itemB;
-      if (cur) {
-        g_prev_equipped = g_equipped;  // remember old item
-        g_equipped      = *cur;        // new item becomes current
-      }
+  gfx_header("LOOT", COL_WHITE);
 
-      if (dt >= 5000u) { //5000
-        g_sum_hz = 0.0f;
-        g_cnt_hz = 0u;
-        s_goto(STS_BATTLE);
-      }
-    } break;
+  gfx_text2(30, 30, "Equipment:", COL_WHITE, 1);
 
-    case STS_BATTLE: {
-      const uint32_t FLEX_MS = 5000u;
-      const story_chapter_t* c = &g_story[g_chapter];
+  gfx_text2(6, 42, "Prev:", COL_WHITE, 1);
+  gfx_text2(6, 54, g_prev_equipped.name, COL_RED, 1);
 
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("BATTLE", COL_RED);
+  gfx_text2(6, 74, "Now:",  COL_WHITE, 1);
+  gfx_text2(6, 86, g_equipped.name,     COL_GREEN, 1);
+}
 
-        // Draw this chapter's enemy image once
-        const enemy_sprite_t *es = &g_enemy_sprites[g_chapter];
+static void giveup_draw(void){
+  gfx_clear(COL_BLACK);
 
-        uint8_t ex = (uint8_t)((128 - es->w) / 2);
-        uint8_t ey = 16;  // top area; leaves bottom for Hz bar + text
+  // X UI
+  gfx_xshape(110, 1, 15, 15, COL_RED);           // danger indicator
+  gfx_rect(109, 0, 17, 17, COL_RED);
 
-        gfx_blit_pal4(ex, ey,
-                      es->w, es->h,
-                      es->idx,
-                      es->pal);
-      }
+  gfx_header("REST & RESET", COL_WHITE);
+  gfx_bar(0, 18, 128, 1, COL_DKGRAY);
 
-      if (dt >= FLEX_MS){
-        s_goto(STS_RESULT);
-        break;
-      }
+  gfx_text2(4, 36, "You have fallen...", COL_RED,   1);
+  gfx_text2(4, 48, "Flex to go back",    COL_WHITE, 1);
+  gfx_text2(4, 60, "home. Failure...",            COL_WHITE, 1);
 
-      // Countdown + bar logic
-      uint8_t remain_s = (uint8_t)((FLEX_MS - dt) / 1000u);
-      char line[32];
-      snprintf(line, sizeof(line), "Flex... %us left", (unsigned)remain_s);
-      gfx_bar(0, 96, 128, 12, COL_BLACK);
-      gfx_text2(6, 96, line, COL_WHITE, 1);
+  char line[40];
+  snprintf(line, sizeof(line),
+          "Need: %.1f Hz", STORY_FLEX_MENU_HZ);
+  gfx_text2(4, 82, line, COL_CYAN, 1);
+}
 
-      // Use the *effective* enemy Hz based on items
-      float foe_target = (float)c->enemy_hz * g_equipped.enemy_mult;
-      draw_enemy_hz_bar(hz, foe_target);
+/*------------------------------ interpreter --------------------------------*/
+
+// Run the op at g_pc; a points at its operands
+static story_step_t story_op(uint8_t op, const uint8_t *a){
+  bool     first;
+  uint32_t dt;
+
+  switch (op){
+    case SOP_SCREEN:
+      // Drawing resumes on the first tick after the fade, time counts
+      // from when the panel is dark
+      g_entered = false;
+      g_t0      = gfx_fade_out(g_now);
+      return STEP_YIELD;
+
+    case SOP_DEFER:
+      if (a[0] == STORY_DEFER_OFF) gfx_defer_end();
+      else                         gfx_defer_begin(a[0]);
+      return STEP_NEXT;
+
+    case SOP_CLEAR:
+      gfx_clear(COL_BLACK);
+      return STEP_NEXT;
+
+    case SOP_ART: {
+      const gfx_image_t *im = g_story_img[img_id(a[0])];
+      uint8_t x = (a[1] == STORY_CENTER) ? (uint8_t)((128 - im->w) / 2) : a[1];
+      uint8_t y = (a[2] == STORY_CENTER) ? (uint8_t)((128 - im->h) / 2) : a[2];
+      gfx_blit_image(x, y, im);
+      return STEP_NEXT;
+    }
 
+    case SOP_HEADER:
+      gfx_header(str_at(rd16(a)), rd16(a + 2));
+      return STEP_NEXT;
+
+    case SOP_TEXT:
+      gfx_text2(a[0], a[1], str_at(rd16(a + 2)), rd16(a + 4), a[6]);
+      return STEP_NEXT;
+
+    case SOP_BAR:
+      gfx_bar(a[0], a[1], a[2], a[3], rd16(a + 4));
+      return STEP_NEXT;
+
+    case SOP_MARK:
+      gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);
+      return STEP_NEXT;
+
+    case SOP_LORE:
+      gfx_scroll_begin_bpe(&g_lore_view, &LORE_TEXT[a[0]], 24);
+      return STEP_NEXT;
+
+    case SOP_TYPE:
+      // Only new characters are drawn each tick; no clears
+      dt = wait_dt(&first);
+      gfx_scroll_type(&g_lore_view, dt / a[2]);   // ms per char
+      return (dt >= rd16(a)) ? wait_over(STEP_NEXT) : STEP_HOLD;
+
+    case SOP_WAIT:
+      dt = wait_dt(&first);
+      return (dt >= rd16(a)) ? wait_over(STEP_NEXT) : STEP_HOLD;
+
+    case SOP_CHAPTER:
+      g_name     = str_at(rd16(a));
+      g_enemy    = str_at(rd16(a + 2));
+      g_enemy_hz = rd16(a + 4);
+      g_art      = a[6];
+      g_foe      = a[7];
+      return STEP_NEXT;
+
+    case SOP_FOE: {
+      char line[40];
+      snprintf(line, sizeof(line), "%s STR: %u Hz",
+               g_enemy, (unsigned)g_enemy_hz);
+      gfx_text2(a[0], a[1], line, rd16(a + 2), 1);
+      return STEP_NEXT;
+    }
 
-      if (hz >= 1.5f){
-        g_sum_hz += hz;
-        g_cnt_hz++;
+    case SOP_CHOOSE:
+      dt = wait_dt(&first);
+      if (first) choose_draw();
+      choose_update();
+      return (dt >= rd16(a)) ? wait_over(STEP_NEXT) : STEP_HOLD;
+
+    case SOP_BATTLE:
+      dt = wait_dt(&first);
+      if (first) battle_draw(rd16(a));
+      battle_update();
+      if (dt >= rd16(a) && round_acc_done(0u, g_now, &g_round)){
+        return wait_over(STEP_NEXT);
       }
-    } break;
-
-
-    case STS_RESULT: {
-      const story_chapter_t* c = &g_story[g_chapter];
-      float avg = (g_cnt_hz ? (g_sum_hz / (float)g_cnt_hz) : 0.0f);
-      float you  = avg * g_equipped.player_mult;
-      float foe  = (float)c->enemy_hz * g_equipped.enemy_mult;
-
-      if (g_dirty) {
-        g_dirty = false; 
-        gfx_clear(COL_BLACK);
-
-//        uint8_t x = (uint8_t)(98);
-//        uint8_t y = (uint8_t)(0);
-
-//        gfx_blit_pal4(x, y,
-//                      ENEMY_ICON_W, ENEMY_ICON_H,
-//                      ENEMY_ICON_IDX,
-//                      ENEMY_ICON_PAL);
-
-        // seperator for VICTOR and defeat
-        gfx_rect(0, 67, 187, 1, COL_GRAY);
-
-        gfx_header("RESULT", COL_WHITE);
-        char l1[40]; snprintf(l1, sizeof(l1), "You: %.1f Hz", you);
-        char l2[40]; snprintf(l2, sizeof(l2), "Enemy: %.1f Hz", foe);
-        gfx_text2(6, 36, l1, COL_CYAN, 1);
-        gfx_text2(6, 50, l2, COL_YELLOW, 1);
-        gfx_text2(6, 76,
-                  (you >= foe) ? "VICTORY" : "DEFEAT",
-                  (you >= foe) ? COL_GREEN  : COL_RED,
-                  3);
+      return STEP_HOLD;
+
+    case SOP_RESULT:
+      dt = wait_dt(&first);
+      if (first) result_draw();
+      if (dt < rd16(a)) return STEP_HOLD;
+      // Win → continue normal flow, lose → the death screens
+      return (result_you() >= result_foe()) ? wait_over(STEP_NEXT)
+                                            : wait_over(jump(rd16(a + 2)));
+
+    case SOP_LOOT:
+      loot_draw();
+      return STEP_NEXT;
+
+    case SOP_DIED:
+      // Count this death; too many go on to flex-to-menu instead of a retry
+      g_story_deaths++;
+      return (g_story_deaths >= STORY_DEATHS_MAX) ? STEP_NEXT : jump(rd16(a));
+
+    case SOP_GIVEUP:
+      dt = wait_dt(&first);
+      if (first) giveup_draw();
+      // Strong flex -> back to main menu; otherwise retry the chapter
+      if (g_hz >= STORY_FLEX_MENU_HZ) {
+        g_story_deaths = 0u;   // optional reset
+        return wait_over(STEP_END);
       }
-      if (dt >= 2000u) {
-        if (you >= foe) {
-          // Win → continue normal flow
-          story_unlock_for_chapter(g_chapter);
-          s_goto(STS_REWARD);
-        } else {
-          // Lose → show you died + retry this chapter
-          s_goto(STS_DEATH);
-        }
-      }
-    } break;
-
-    case STS_REWARD: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-//        uint8_t x = (uint8_t)(98);
-//        uint8_t y = (uint8_t)(0);
-
-//        gfx_blit_pal4(x, y,
-//                      EQUIPMENT_ICON_W, EQUIPMENT_ICON_H,
-//                      EQUIPMENT_ICON_IDX,
-//                      EQUIPMENT_ICON_PAL);
-
-        // Draw background for equipment and items, also green rectangle of current equiped item.
-        gfx_bar(0, 38, 128, 32, COL_DKGRAY);
-        gfx_bar(0, 70, 128, 64, COL_GRAY);
-        gfx_rect(1, 84, 127, 12, COL_GREEN);
+      return (dt >= rd16(a)) ? wait_over(jump(rd16(a + 2))) : STEP_HOLD;
 
-        gfx_header("LOOT", COL_WHITE);
+    case SOP_UNLOCK:
+      cheevos_unlock((cheevo_t)a[0]);
+      return STEP_NEXT;
 
-        gfx_text2(30, 30, "Equipment:", COL_WHITE, 1);
+    case SOP_JUMP:
+      return jump(rd16(a));
 
-        gfx_text2(6, 42, "Prev:", COL_WHITE, 1);
-        gfx_text2(6, 54, g_prev_equipped.name, COL_RED, 1);
+    case SOP_CALL:
+      if (g_sp >= STORY_CALL_DEPTH) return STEP_END;
+      g_stack[g_sp++] = (uint16_t)(g_pc + 1u + k_op_len[SOP_CALL]);
+      return jump(rd16(a));
 
-        gfx_text2(6, 74, "Now:",  COL_WHITE, 1);
-        gfx_text2(6, 86, g_equipped.name,     COL_GREEN, 1);
+    case SOP_RET:
+      if (g_sp == 0u) return STEP_END;
+      return jump(g_stack[--g_sp]);
 
-      }
-      if (dt >= 5000u){
-        s_goto(STS_NEXT);
-      }
-    } break;
-
-    case STS_DEATH: {
-      if (g_dirty) {
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        // Center the YOU_DIED image
-        uint8_t x = (uint8_t)((128 - YOU_DIED_W) / 2);
-        uint8_t y = (uint8_t)((128 - YOU_DIED_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      YOU_DIED_W, YOU_DIED_H,
-                      YOU_DIED_IDX,
-                      YOU_DIED_PAL);
-
-        if (g_story_deaths + 1u <1u) {
-          gfx_text2(30, 110, "Retrying...", COL_RED, 1);
-        } else {
-          gfx_text2(10, 110, "Too many deaths...", COL_RED, 1);
-        }
-      }
-
-      if (dt >= 3000u) {
-        // Count this death
-        g_story_deaths++;
-
-        // Reset counters regardless
-        g_sum_hz = 0.0f;
-        g_cnt_hz = 0u;
-
-        if (g_story_deaths >= 3u) {
-          // go to flex-to-menu screen instead of retry
-          s_goto(STS_FLEX_RETURN);
-        } else {
-          // retry same chapter from intro
-          s_goto(STS_INTRO);
-        }
-      }
-    } break;
-
-    case STS_FLEX_RETURN: {
-        // hz already computed at top of game_story_tick
-
-        if (g_dirty) {
-            g_dirty = false;
-            gfx_clear(COL_BLACK);
-
-            // X UI
-            gfx_xshape(110, 1, 15, 15, COL_RED);           // danger indicator
-            gfx_rect(109, 0, 17, 17, COL_RED);
-
-            gfx_header("REST & RESET", COL_WHITE);
-            gfx_bar(0, 18, 128, 1, COL_DKGRAY);
-
-            gfx_text2(4, 36, "You have fallen...", COL_RED,   1);
-            gfx_text2(4, 48, "Flex to go back",    COL_WHITE, 1);
-            gfx_text2(4, 60, "home. Failure...",            COL_WHITE, 1);
-
-            char line[40];
-            snprintf(line, sizeof(line),
-                    "Need: %.1f Hz", STORY_FLEX_MENU_HZ);
-            gfx_text2(4, 82, line, COL_CYAN, 1);
-        }
-
-        // strong flex -> back to main menu
-        if (hz >= STORY_FLEX_MENU_HZ) {
-            g_story_deaths = 0u;   // optional reset
-            return true;           // tell game.c Story is done -> menu
-        }
-
-        // wait 5 seconds -> retry same chapter
-        if (dt >= 5000u) {
-            g_sum_hz = 0.0f;
-            g_cnt_hz = 0u;
-            s_goto(STS_INTRO);     // restart chapter intro
-        }
-    } break;
-
-    case STS_NEXT: {
-      uint8_t next = (uint8_t)(g_chapter + 1u);
-      if (next >= STORY_CHAPTERS){
-        s_goto(STS_LORE_ENDING);
-      } else {
-        g_chapter = next;
-        s_goto(STS_LORE_CHAPTER);
-      }
-    } break;
-
-    case STS_LORE_ENDING: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("Epilogue", COL_WHITE);
-      }
-
-      draw_lore_typewriter(g_lore_ending_lines,
-                          g_lore_ending_count,
-                          dt,
-                          80u);
+    case SOP_END:
+    default:
+      return STEP_END;
+  }
+}
 
-      if (dt >= 8000u){
-        s_goto(STS_ENDING);
-      }
-    } break;
+// Run ops until one waits; true once the story is over
+static bool story_run(uint32_t now_ms){
+  g_now = now_ms;
+
+  for (uint8_t n = 0; n < STORY_OPS_PER_TICK; n++){
+    if (g_pc >= g_story_bc_len) return true;
+
+    uint8_t  op = g_story_bc[g_pc];
+    if (op >= SOP_COUNT) return true;
+
+#ifdef HOST_SIM
+    uint32_t t0 = micros();
+    story_step_t s = story_op(op, &g_story_bc[g_pc + 1u]);
+    uint32_t us = micros() - t0;
+
+    story_op_stats_t *st = &g_op_stats[op];
+    st->runs++;
+    st->total_us += us;
+    if (us > st->worst_us) st->worst_us = us;
+#else
+    story_step_t s = story_op(op, &g_story_bc[g_pc + 1u]);
+#endif
+
+    switch (s){
+      case STEP_NEXT:  g_pc = (uint16_t)(g_pc + 1u + k_op_len[op]); break;
+      case STEP_YIELD: g_pc = (uint16_t)(g_pc + 1u + k_op_len[op]); return false;
+      case STEP_HOLD:  return false;
+      case STEP_GOTO:  break;
+      case STEP_END:
+      default:         return true;
+    }
+  }
+  return false;
+}
 
-    case STS_ENDING: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
+void game_story_init(void){
+  g_pc       = 0u;
+  g_sp       = 0u;
+  g_entered  = false;
+  g_t0       = millis();
+  g_hz       = 0.0f;
+  g_name     = "";
+  g_enemy    = "";
+  g_enemy_hz = 0u;
+  g_art      = 0u;
+  g_foe      = 0u;
+  g_equipped = STORY_ITEM_A;
+  g_prev_equipped = STORY_ITEM_A;   // start with same
+  g_round    = (round_stats_t){0};
+  g_itemA    = &STORY_ITEM_A;
+  g_itemB    = &STORY_ITEM_B;
+  g_story_deaths = 0u;
+#ifdef HOST_SIM
+  memset(g_op_stats, 0, sizeof(g_op_stats));
+#endif
 
-        gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);
+  // Up to the first fade, as the old state machine did on entry
+  (void)story_run(millis());
+}
 
-        // Draw final story scene image, centered
-        uint8_t x = (uint8_t)((128 - STORY_FINAL_SCENE_W) / 2);
-        uint8_t y = (uint8_t)((128 - STORY_FINAL_SCENE_H) / 2);
+bool game_story_tick(void){
+  game_get_metrics(&g_hz, NULL, NULL);
 
-        gfx_blit_pal4(x, y,
-                      STORY_FINAL_SCENE_W, STORY_FINAL_SCENE_H,
-                      STORY_FINAL_SCENE_IDX,
-                      STORY_FINAL_SCENE_PAL);
-        cheevos_unlock(ACH_STORY_CLEAR);
-      }
-      if (dt >= 5000u){
-        return true;    // tell game.c that Story mode is finished
-      }
-    } break;
-  }
+  return story_run(millis());   // true once Story mode is finished
+}
 
-  // not finished yet
-  return false;
+#ifdef HOST_SIM
+void game_story_op_stats(uint8_t op, story_op_stats_t *out){
+  *out = (op < SOP_COUNT) ? g_op_stats[op] : (story_op_stats_t){0};
 }
+#endif
@@ -6,293 +6,198 @@ const uint16_t GAME_STORY_LOGO_PAL[GAME_STORY_LOGO_PAL_SIZE] = {
     0x8DBB, 0x345B, 0x19CC, 0x239B, 0x9535, 0x9B12, 0x5399, 0xE2AC, 
 };
 
-const uint8_t GAME_STORY_LOGO_IDX[(GAME_STORY_LOGO_W * GAME_STORY_LOGO_H) / 2] = {
-    0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x88, 0x11, 0x81, 0x33, 0x33, 0x33, 0x33, 0x0B, 0x99, 0xBB, 0xBB, 0xB9, 0xBB, 0xBB, 0x09, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB9, 0x00, 0x99, 0xBB, 0x90, 0x99, 0x99, 0x9B, 0xB9, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x09, 0x00, 0x09, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x00, 0x09, 0x99, 0x99, 0x99, 
-    0x99, 0x90, 0x09, 0x90, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x81, 0x33, 0x11, 0x33, 0x33, 0x31, 0x08, 0x00, 0x09, 0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x90, 0x09, 0x99, 0x00, 0x99, 0x90, 0x09, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x90, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x90, 0x99, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x11, 0x33, 0x13, 0x33, 0x33, 0x31, 0x00, 0x00, 0x09, 0x99, 0x09, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-    0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x31, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x81, 0x09, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x33, 
-    0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 
-    0x00, 0x00, 0x09, 0x00, 0x00, 0xE0, 0x08, 0x13, 0x8E, 0xEE, 0xEE, 0xEE, 0x00, 0x99, 0x90, 0xEE, 
-    0x0E, 0x09, 0x99, 0x90, 0x00, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x11, 0x33, 
-    0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x91, 0x00, 0x00, 
-    0x00, 0x00, 0x9D, 0x77, 0x77, 0x77, 0xF8, 0x10, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x07, 0x77, 
-    0x77, 0x7D, 0x99, 0x07, 0x77, 0x77, 0x77, 0xFC, 0x68, 0xC7, 0x77, 0x00, 0xC7, 0x77, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x33, 0x11, 0x33, 
-    0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x09, 0x00, 
-    0x00, 0x09, 0x07, 0x77, 0x77, 0x77, 0x7D, 0x10, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0x77, 0x77, 
-    0x77, 0x77, 0x59, 0x07, 0x77, 0x77, 0x77, 0x70, 0x51, 0xC7, 0x77, 0xE0, 0xD7, 0x77, 0xB0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x33, 0x33, 
-    0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 
-    0x00, 0x09, 0xD7, 0x77, 0x77, 0x77, 0x70, 0x00, 0x77, 0x77, 0x77, 0x77, 0x70, 0xBF, 0x77, 0x77, 
-    0x77, 0x77, 0xD9, 0x07, 0x77, 0x77, 0x77, 0x77, 0x50, 0xC7, 0x77, 0xE0, 0xD7, 0x77, 0xB0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x90, 0x31, 0x90, 0x00, 
-    0x00, 0x09, 0xD7, 0x70, 0xEE, 0xD7, 0x7F, 0xB1, 0x30, 0xE7, 0x77, 0x5B, 0xEB, 0x9F, 0x77, 0x0B, 
-    0xB0, 0x77, 0xD9, 0x07, 0x77, 0xDB, 0xE7, 0x77, 0x50, 0xC7, 0x77, 0xEB, 0xD7, 0x77, 0xB9, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 
-    0x00, 0x09, 0xD7, 0x70, 0x00, 0xD7, 0x5B, 0x01, 0x31, 0x07, 0x77, 0xE9, 0x00, 0x9F, 0x77, 0x09, 
-    0x9F, 0x77, 0xD9, 0x07, 0x77, 0x59, 0x07, 0x77, 0x50, 0xC7, 0x77, 0xE9, 0xD7, 0x77, 0xB9, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x11, 0x33, 0x11, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x01, 0x33, 0x31, 0x10, 0x00, 
-    0x00, 0x09, 0xD7, 0x70, 0x01, 0x30, 0x00, 0x83, 0x31, 0x07, 0x77, 0xE9, 0x00, 0x9F, 0x77, 0x0B, 
-    0x9F, 0x77, 0xD9, 0x07, 0x77, 0x59, 0x07, 0x77, 0x50, 0xC7, 0x77, 0xE0, 0xD7, 0x77, 0xB0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x11, 0x13, 0x11, 0x31, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x01, 0x11, 0x33, 0x33, 0x11, 0x00, 
-    0x08, 0x00, 0xD7, 0x70, 0x01, 0x33, 0xFF, 0x13, 0x33, 0x87, 0x77, 0xE9, 0x00, 0x0F, 0x77, 0x09, 
-    0x9F, 0x77, 0xD0, 0x10, 0x77, 0x59, 0x07, 0x77, 0x50, 0xC7, 0x77, 0xE0, 0xC7, 0x77, 0xB0, 0x88, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x33, 0x33, 0x31, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x11, 0x11, 0x13, 0x33, 0x33, 0x18, 
-    0x88, 0x80, 0xC7, 0x70, 0x08, 0x07, 0x7F, 0x01, 0x33, 0x87, 0x77, 0xE9, 0x00, 0x0F, 0x77, 0x09, 
-    0x0F, 0x77, 0xD0, 0x10, 0x77, 0xD0, 0x87, 0x77, 0x5B, 0xD7, 0x77, 0xB0, 0xF7, 0x77, 0xE0, 0x88, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x13, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x11, 
-    0x88, 0x80, 0xC7, 0x70, 0xD7, 0x77, 0x70, 0x01, 0x33, 0x07, 0x77, 0xE9, 0x00, 0x0F, 0x77, 0x09, 
-    0x0F, 0x77, 0xD0, 0x17, 0x77, 0x50, 0x07, 0x77, 0x5B, 0xD7, 0x77, 0xD0, 0x77, 0x77, 0xE0, 0x31, 
-    0x00, 0x00, 0x01, 0x00, 0x01, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x33, 0x13, 
-    0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x33, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x81, 
-    0x11, 0x80, 0xC7, 0x77, 0x77, 0x77, 0x70, 0x01, 0x33, 0x87, 0x77, 0xE9, 0x00, 0x0F, 0x77, 0x09, 
-    0x0F, 0x77, 0xD0, 0x37, 0x77, 0xDF, 0x77, 0x77, 0x5B, 0xD7, 0x77, 0x77, 0x77, 0x77, 0xE0, 0x33, 
-    0x00, 0x01, 0x31, 0x13, 0x13, 0x13, 0x31, 0x00, 0x13, 0x31, 0x00, 0x01, 0x33, 0x11, 0x13, 0x31, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x33, 0x33, 0x31, 0x81, 
-    0x18, 0x81, 0xC7, 0x77, 0x77, 0x77, 0x70, 0x01, 0x33, 0x37, 0x77, 0xE0, 0x00, 0x0F, 0x77, 0x09, 
-    0x1F, 0x77, 0xD0, 0x17, 0x77, 0x77, 0x77, 0x70, 0xBB, 0xD7, 0x77, 0x77, 0x77, 0x77, 0xB0, 0x33, 
-    0x10, 0x11, 0x33, 0x11, 0x11, 0x11, 0x33, 0x33, 0x13, 0x33, 0x31, 0x33, 0x33, 0x33, 0x11, 0x33, 
-    0x13, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x33, 0x38, 0xC1, 
-    0x16, 0x10, 0xD7, 0x77, 0x70, 0x07, 0x70, 0x01, 0x33, 0x37, 0x77, 0xE0, 0x11, 0x1F, 0x77, 0x09, 
-    0x1F, 0x77, 0xD9, 0x10, 0x77, 0x77, 0x77, 0xDB, 0xB0, 0x57, 0x77, 0x70, 0xD7, 0x77, 0xB0, 0x66, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x33, 0x31, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x33, 0x33, 0x31, 0x13, 0x31, 0x11, 0x11, 0x86, 0x51, 
-    0x66, 0x65, 0x07, 0x70, 0xE9, 0xD7, 0x70, 0x08, 0x33, 0x37, 0x77, 0xE0, 0x13, 0x1F, 0x77, 0x00, 
-    0x1F, 0x77, 0xD0, 0x10, 0x77, 0x77, 0x77, 0x5B, 0x26, 0xC7, 0x7F, 0x5B, 0x57, 0x77, 0xBB, 0x86, 
-    0x66, 0x80, 0x66, 0x00, 0x00, 0x01, 0x13, 0x31, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x33, 0x11, 0x11, 0x13, 0x31, 0x11, 0x33, 0x13, 0x31, 0x11, 0x31, 0x11, 0x18, 0x55, 0x56, 
-    0x56, 0x55, 0x00, 0x5B, 0x08, 0x07, 0x70, 0x08, 0x33, 0x37, 0x77, 0xE0, 0x33, 0x3F, 0x77, 0x00, 
-    0x1F, 0x77, 0xD0, 0x17, 0x77, 0xD0, 0x77, 0x0B, 0x26, 0xDF, 0x5B, 0xB9, 0xD7, 0x77, 0xBB, 0x86, 
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x33, 0x13, 0x11, 0x11, 0x33, 0x11, 0x33, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x11, 0x11, 0x13, 0x33, 0x18, 0x66, 0x61, 0x86, 0x55, 0x55, 
-    0x56, 0x55, 0x56, 0xB5, 0x60, 0x07, 0x70, 0x90, 0x13, 0x37, 0x77, 0xE8, 0x33, 0x3F, 0x77, 0x00, 
-    0x1F, 0x77, 0xD9, 0x80, 0x77, 0x55, 0x77, 0x75, 0xB6, 0x60, 0x9B, 0x20, 0xD7, 0x77, 0xB9, 0x00, 
-    0x08, 0x81, 0x00, 0x00, 0x00, 0x01, 0x13, 0x33, 0x31, 0x31, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x33, 0x13, 0x31, 0x11, 0x11, 0xC1, 0x38, 0x56, 0x55, 0x55, 0x55, 0x55, 
-    0x56, 0x56, 0xCD, 0x07, 0x52, 0x07, 0x70, 0x08, 0x13, 0x37, 0x77, 0xE0, 0x33, 0x3F, 0x77, 0x00, 
-    0x1F, 0x77, 0xD9, 0x87, 0x77, 0x5B, 0x07, 0x70, 0xB6, 0x00, 0x05, 0x50, 0xD7, 0x77, 0xB9, 0x00, 
-    0x08, 0x13, 0x11, 0x80, 0x10, 0x01, 0x11, 0x33, 0x11, 0x33, 0x81, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 0x18, 0x24, 0x40, 0x66, 0x56, 0x24, 0x25, 0x55, 0x52, 
-    0x55, 0x26, 0xD7, 0x70, 0xB2, 0x07, 0x70, 0x01, 0x33, 0x37, 0x77, 0xE0, 0x13, 0x3F, 0x77, 0xD0, 
-    0x1F, 0x77, 0xD9, 0x87, 0x77, 0x5B, 0xD7, 0x77, 0x5B, 0x6D, 0xF7, 0xE9, 0xD7, 0x77, 0xB0, 0x00, 
-    0x00, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x33, 0x11, 0x31, 0x11, 0x11, 0x13, 0x11, 0x16, 0x44, 0x40, 0x42, 0x56, 0x24, 0x25, 0x55, 0x55, 
-    0x55, 0x26, 0x07, 0x70, 0x55, 0x07, 0x70, 0xB0, 0x61, 0x37, 0x77, 0xE0, 0x11, 0x1F, 0x77, 0xF0, 
-    0x3F, 0x77, 0xD0, 0x87, 0x77, 0xD9, 0x00, 0x77, 0x0B, 0xD7, 0x77, 0x5E, 0xD7, 0x77, 0xB0, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x31, 0x11, 0x10, 0x08, 0x13, 0x13, 0x31, 0x11, 0x13, 0x11, 0x11, 0x11, 
-    0x33, 0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 0x64, 0x44, 0x44, 0x02, 0x26, 0x55, 0x25, 0x55, 0x55, 
-    0x55, 0x56, 0x07, 0x77, 0x77, 0x77, 0x70, 0xB2, 0x46, 0xC7, 0x77, 0xE0, 0x31, 0x1F, 0x77, 0x77, 
-    0x77, 0x77, 0xD0, 0x17, 0x77, 0xD9, 0x00, 0x77, 0x7B, 0x57, 0x77, 0x77, 0x77, 0x77, 0x00, 0x00, 
-    0x81, 0x11, 0x00, 0x81, 0x80, 0x81, 0x10, 0x00, 0x13, 0x31, 0x11, 0x11, 0x11, 0x31, 0x11, 0x13, 
-    0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x36, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x45, 0x55, 0x55, 
-    0x55, 0x55, 0x07, 0x77, 0x77, 0x77, 0x70, 0xB2, 0x44, 0x07, 0x77, 0xE0, 0x13, 0x10, 0x77, 0x77, 
-    0x77, 0x77, 0xE0, 0x87, 0x77, 0xD0, 0x83, 0x77, 0x7D, 0xB7, 0x77, 0x77, 0x77, 0x7F, 0x91, 0x10, 
-    0x01, 0x11, 0x18, 0x11, 0x80, 0x81, 0x10, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 
-    0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x84, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x44, 
-    0x45, 0x52, 0x2D, 0xF7, 0x77, 0x77, 0x0B, 0x22, 0x42, 0x07, 0x77, 0x50, 0x31, 0x11, 0x07, 0x77, 
-    0x77, 0x0D, 0x08, 0x8F, 0x77, 0xD0, 0x33, 0xF7, 0x70, 0xB5, 0xF7, 0x77, 0x77, 0xFE, 0x08, 0x31, 
-    0x13, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 
-    0x33, 0x33, 0x18, 0x81, 0x11, 0x11, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x46, 0x65, 0x26, 0x55, 0xEB, 0xEB, 0xB2, 0x22, 0x00, 0x44, 0x22, 0xB9, 0x11, 0x11, 0x10, 0x0E, 
-    0x00, 0x00, 0x08, 0x18, 0x0E, 0x00, 0x13, 0x38, 0x0E, 0xBB, 0x0E, 0xEE, 0x00, 0x00, 0x81, 0x31, 
-    0x13, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x06, 
-    0x33, 0x31, 0x08, 0x08, 0x80, 0x11, 0x82, 0x44, 0x42, 0x22, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x40, 0x44, 0x22, 0x26, 0x02, 0x22, 0x44, 0x40, 0x04, 0x22, 0x22, 0x81, 0x11, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x81, 0x11, 0x10, 0x0E, 0x00, 0x00, 0x11, 0x11, 0x13, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x11, 0x11, 0x13, 0x38, 0x66, 
-    0x33, 0x31, 0x00, 0x00, 0x00, 0x01, 0x82, 0x44, 0x44, 0x22, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x40, 0x06, 0x50, 0x02, 0x44, 0x40, 0x40, 0x40, 0x54, 0x00, 0x61, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x11, 0x11, 0x00, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x66, 
-    0x33, 0x33, 0x31, 0x00, 0x00, 0x81, 0x16, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x44, 0x40, 0x40, 0x06, 0x44, 0x44, 0x0C, 0x81, 0x13, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x18, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x66, 
-    0x33, 0x33, 0x33, 0x10, 0x00, 0x81, 0x38, 0x22, 0x24, 0x44, 0xAA, 0x4A, 0xA4, 0xA4, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x04, 0x44, 0x44, 0x64, 0x44, 0x44, 0xCC, 0x00, 0x01, 0x08, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x05, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x66, 
-    0x11, 0x33, 0x31, 0x10, 0x00, 0x81, 0x31, 0x22, 0x44, 0x4A, 0xAA, 0x4A, 0xA4, 0xAA, 0x44, 0x44, 
-    0x44, 0xAA, 0xAA, 0x44, 0x44, 0x40, 0x44, 0x44, 0x40, 0x64, 0x44, 0x44, 0xC1, 0x11, 0x11, 0x18, 
-    0x11, 0x11, 0x00, 0x13, 0x33, 0x11, 0x10, 0x00, 0x01, 0x00, 0x08, 0x11, 0x00, 0x00, 0x81, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 0x11, 0x00, 0x00, 
-    0x33, 0x33, 0x38, 0x00, 0x00, 0x11, 0x33, 0x5A, 0x42, 0x4A, 0xAA, 0x4A, 0xA4, 0xAA, 0xA4, 0x44, 
-    0x4A, 0xA4, 0xAA, 0xA4, 0x44, 0x00, 0x00, 0x44, 0x46, 0x64, 0x44, 0xA5, 0xC1, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x11, 0x18, 0x11, 0x80, 0x88, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x33, 0x33, 0x80, 0x00, 0x08, 0x11, 0x33, 0xC6, 0x22, 0x4A, 0xAA, 0x4A, 0xAA, 0xAA, 0xA4, 0x44, 
-    0xAA, 0xA4, 0xAA, 0xA4, 0x44, 0x06, 0x60, 0x44, 0x40, 0x54, 0x44, 0x44, 0x60, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x81, 0x10, 0x81, 0x11, 0x18, 0x88, 0x80, 0x00, 
-    0x00, 0x88, 0x81, 0x81, 0x31, 0x00, 0x08, 0x00, 0x13, 0x18, 0x88, 0x08, 0x11, 0x11, 0x80, 0x06, 
-    0x33, 0x31, 0x01, 0x80, 0x81, 0x13, 0x33, 0x13, 0x62, 0x4A, 0xAA, 0x44, 0xAA, 0xAA, 0xAA, 0x44, 
-    0xAA, 0xA4, 0xAA, 0xA4, 0x44, 0x66, 0x40, 0x44, 0x40, 0x54, 0x44, 0x44, 0x60, 0x00, 0x00, 0x00, 
-    0x88, 0x88, 0x88, 0x18, 0x81, 0x18, 0x88, 0x88, 0x11, 0x10, 0x88, 0x81, 0x88, 0x88, 0x00, 0x00, 
-    0x08, 0x88, 0x88, 0x88, 0x11, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x00, 0x00, 
-    0x33, 0x33, 0x10, 0x08, 0x01, 0x11, 0x13, 0x33, 0x82, 0x24, 0xAA, 0x44, 0xAA, 0xAA, 0xAA, 0x44, 
-    0xAA, 0xA4, 0xAA, 0xA4, 0x44, 0x60, 0xA5, 0x44, 0x44, 0x54, 0x44, 0x45, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x81, 0x11, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x18, 0x81, 0x11, 0x18, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x18, 0x88, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x88, 0x80, 0x00, 0x00, 0x06, 
-    0x33, 0x33, 0x31, 0x00, 0x01, 0x31, 0x13, 0x33, 0x36, 0x44, 0x4A, 0x42, 0xAA, 0xAA, 0xAA, 0x42, 
-    0xAA, 0xA4, 0xAA, 0xAA, 0x44, 0x04, 0x45, 0x44, 0xA6, 0x52, 0x54, 0x46, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x88, 0x11, 0x18, 0x18, 0x81, 0x11, 0x11, 0x11, 0x88, 0x08, 0x00, 
-    0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x88, 0x88, 0x18, 0x08, 0x11, 0x18, 0x00, 0x00, 
-    0x33, 0x33, 0x33, 0x00, 0x81, 0x31, 0x13, 0x33, 0x31, 0x24, 0x4A, 0x42, 0xAA, 0xAA, 0xAA, 0x42, 
-    0xAA, 0xA4, 0xAA, 0xAA, 0x44, 0x5A, 0x40, 0xA4, 0x46, 0x55, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x11, 0x08, 0x88, 0x08, 0x18, 0x88, 
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x80, 0x81, 0x11, 0x08, 0x80, 0x08, 0x88, 0x05, 
-    0x13, 0x33, 0x33, 0x11, 0x11, 0x33, 0x11, 0x33, 0x33, 0x51, 0x4A, 0x44, 0xAA, 0xA4, 0xAA, 0xA2, 
-    0xAA, 0x44, 0xAA, 0xAA, 0x42, 0x5A, 0x44, 0xAA, 0xA5, 0x60, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x11, 0x11, 0x18, 0x81, 0x18, 0x80, 0x81, 0x00, 0x11, 0x88, 
-    0x80, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x00, 0x08, 0x88, 0x00, 0x00, 0x65, 
-    0x13, 0x33, 0x33, 0x33, 0x13, 0x33, 0x33, 0x33, 0x33, 0x83, 0x5A, 0x4A, 0xAA, 0xA4, 0xAA, 0xA4, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x4A, 0x04, 0x42, 0x46, 0x00, 0x00, 0x50, 0x00, 0x09, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x81, 0x80, 0x08, 0x88, 0x11, 0x13, 0x18, 0x88, 0x88, 0x88, 
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x5A, 0x4A, 0xAA, 0xA4, 0xAA, 0xA4, 
-    0xAA, 0xAA, 0xA4, 0xAA, 0xA2, 0x4A, 0x44, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x66, 0x06, 0x08, 0x08, 0x18, 0x13, 0x33, 0x18, 0x00, 0x88, 0x08, 0x83, 0x38, 0x00, 0x00, 
-    0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x5A, 0x4A, 0xA4, 0xA4, 0xAA, 0xA4, 
-    0xAA, 0xAA, 0xA4, 0x4A, 0xA4, 0xAA, 0xA4, 0x20, 0x00, 0x00, 0x00, 0x06, 0x66, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x66, 0x61, 0x13, 0x33, 0x33, 0x31, 0x80, 0x11, 0x83, 0x33, 0x31, 0x88, 0x33, 
-    0x18, 0x13, 0x18, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x08, 0x06, 0x56, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x64, 0x4A, 0xA4, 0x44, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x44, 0x44, 0xAA, 0x44, 0xA4, 0x50, 0x00, 0x00, 0x06, 0x66, 0x66, 0x00, 0x88, 0x80, 
-    0x68, 0x00, 0x88, 0x81, 0x33, 0x33, 0x18, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x31, 
-    0x13, 0x31, 0x18, 0x08, 0x81, 0x08, 0x05, 0x06, 0x61, 0x00, 0x00, 0x00, 0x08, 0x00, 0x65, 0x65, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x13, 0x12, 0xAA, 0xA4, 0x44, 0xAA, 0xAA, 
-    0xAA, 0x44, 0x44, 0x44, 0xAA, 0x44, 0x44, 0x60, 0x00, 0x06, 0x66, 0x66, 0x66, 0xCC, 0x66, 0x66, 
-    0x66, 0x66, 0x13, 0x31, 0x10, 0x11, 0x66, 0x66, 0xC8, 0x81, 0x11, 0x13, 0x33, 0x33, 0x11, 0x18, 
-    0x08, 0x06, 0x66, 0x6C, 0x88, 0x60, 0x55, 0x65, 0x63, 0x30, 0x66, 0x00, 0x00, 0x06, 0x65, 0x55, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x36, 0x65, 0xA2, 0x44, 0x4A, 0xAA, 
-    0xA4, 0x45, 0x44, 0x44, 0xAA, 0x44, 0x42, 0x02, 0x26, 0x66, 0x66, 0x66, 0x66, 0x6C, 0x66, 0x66, 
-    0x66, 0x01, 0x01, 0x11, 0x1C, 0x10, 0x10, 0x61, 0x06, 0x55, 0x68, 0x03, 0x33, 0x33, 0x11, 0x31, 
-    0x18, 0x06, 0x88, 0x81, 0x06, 0x66, 0x66, 0x65, 0x61, 0x31, 0x11, 0x00, 0x88, 0x66, 0x55, 0x55, 
-    0x11, 0x11, 0x13, 0x80, 0x11, 0x18, 0x18, 0x81, 0x31, 0x13, 0x18, 0x11, 0x52, 0x24, 0x4A, 0xAA, 
-    0xA4, 0x06, 0x44, 0x44, 0xAA, 0x44, 0x45, 0x02, 0x26, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x6C, 0xC8, 0x11, 0xC0, 0x01, 0x31, 0x66, 0x68, 0x22, 0x55, 0x08, 0x80, 0x11, 0x08, 0x00, 0x11, 
-    0x18, 0x18, 0x66, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x66, 0x00, 0x66, 0x65, 0x55, 
-    0x11, 0x81, 0x31, 0x80, 0x61, 0x11, 0x11, 0x13, 0x33, 0x33, 0x18, 0x13, 0x82, 0x24, 0x44, 0xAA, 
-    0xA4, 0x56, 0x44, 0x44, 0xAA, 0x42, 0x56, 0x02, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x6C, 
-    0xC6, 0x6C, 0x0C, 0x66, 0x66, 0xCC, 0xCC, 0x15, 0x22, 0x55, 0x60, 0x25, 0x88, 0x50, 0x56, 0x06, 
-    0x00, 0x83, 0x38, 0x52, 0x66, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x86, 0x66, 0x65, 0x55, 
-    0x08, 0x08, 0x86, 0x25, 0x55, 0x11, 0x11, 0x11, 0x33, 0x33, 0x31, 0x81, 0x16, 0x24, 0x44, 0xAA, 
-    0xA4, 0x56, 0x40, 0x44, 0xAA, 0x45, 0xC0, 0x05, 0x22, 0x22, 0x22, 0x22, 0x25, 0x66, 0x66, 0x66, 
-    0x66, 0xC6, 0x65, 0x56, 0x52, 0x6C, 0xCC, 0x62, 0x52, 0x55, 0x55, 0x25, 0x88, 0x56, 0x56, 0x65, 
-    0x55, 0x56, 0x66, 0x22, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x86, 0x55, 0x55, 0x55, 
-    0x11, 0x11, 0x85, 0x22, 0x25, 0x11, 0x11, 0x13, 0x33, 0x33, 0x31, 0x00, 0x18, 0x24, 0x44, 0x4A, 
-    0xA4, 0x56, 0x44, 0x4A, 0xA4, 0x64, 0xC0, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0x22, 
-    0x66, 0x65, 0x65, 0x56, 0x22, 0x66, 0x66, 0x62, 0x55, 0x52, 0x25, 0x26, 0x86, 0x56, 0x08, 0x85, 
-    0x52, 0x66, 0x05, 0x66, 0xC6, 0x11, 0x1C, 0xCC, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x55, 0x55, 
-    0x13, 0x33, 0x18, 0x52, 0x26, 0x11, 0x11, 0x13, 0x33, 0x31, 0x31, 0x00, 0x00, 0x22, 0x44, 0x4A, 
-    0xA4, 0x50, 0x44, 0x4A, 0xA5, 0x04, 0xC1, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 
-    0x22, 0x55, 0x65, 0x25, 0x25, 0xC5, 0x66, 0x22, 0x22, 0x26, 0x10, 0x26, 0x02, 0x56, 0x56, 0x00, 
-    0x62, 0x26, 0x6C, 0x6C, 0x66, 0x61, 0x10, 0x01, 0x1C, 0x66, 0x66, 0x66, 0x66, 0x55, 0x56, 0x55, 
-    0x11, 0x31, 0x11, 0x62, 0x50, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x24, 0x44, 
-    0x44, 0x56, 0x44, 0x44, 0xA0, 0x05, 0x80, 0x00, 0x00, 0x02, 0x22, 0x22, 0x42, 0x22, 0x24, 0x42, 
-    0x24, 0x55, 0x25, 0x26, 0x22, 0xC5, 0xC6, 0x22, 0x22, 0x28, 0x33, 0x00, 0x05, 0x55, 0x62, 0x26, 
-    0x62, 0x25, 0x66, 0x66, 0x6C, 0x60, 0x0C, 0xCC, 0x00, 0x06, 0x66, 0x66, 0x66, 0x55, 0x55, 0x55, 
-    0x86, 0x81, 0x11, 0x52, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x56, 0x24, 0x44, 
-    0x44, 0x66, 0x40, 0x44, 0x40, 0x06, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x42, 0x42, 0x24, 0x44, 
-    0x44, 0x62, 0x22, 0x25, 0x22, 0x55, 0xC5, 0x22, 0x22, 0x01, 0x11, 0x88, 0x00, 0x01, 0x36, 0x56, 
-    0x52, 0x22, 0x22, 0x55, 0x6C, 0x00, 0x00, 0xC6, 0x66, 0x66, 0x66, 0x65, 0x56, 0x06, 0x55, 0x55, 
-    0x55, 0x55, 0x58, 0x80, 0x50, 0x88, 0x11, 0x88, 0x18, 0x11, 0x80, 0x00, 0x00, 0x00, 0x64, 0x44, 
-    0x44, 0xC6, 0x44, 0x45, 0x56, 0x06, 0x02, 0x2E, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x42, 0x24, 0x44, 
-    0x44, 0x52, 0x65, 0x26, 0x25, 0x22, 0xC8, 0x55, 0x25, 0x68, 0x81, 0x33, 0x33, 0x13, 0x38, 0x13, 
-    0x02, 0x24, 0x44, 0x44, 0x25, 0x66, 0x65, 0x55, 0x55, 0x56, 0x22, 0x22, 0x25, 0x66, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x81, 0x08, 0x88, 0x18, 0x88, 0x88, 0x81, 0x80, 0x00, 0x00, 0x00, 0x62, 0x44, 
-    0x45, 0x66, 0x44, 0x45, 0x60, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0x24, 0x44, 
-    0x44, 0x56, 0x62, 0x25, 0x56, 0x22, 0x55, 0x22, 0x22, 0x22, 0x25, 0x08, 0x10, 0x08, 0x11, 0x33, 
-    0x02, 0x42, 0x25, 0x52, 0x6C, 0x65, 0x22, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x55, 0x52, 0x55, 
-    0x55, 0x55, 0x55, 0x58, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x08, 0x80, 0x62, 0x44, 
-    0x44, 0x6C, 0x64, 0x45, 0x68, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 0x44, 
-    0x44, 0x56, 0x52, 0x25, 0x65, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x22, 0x81, 0x33, 
-    0x05, 0x22, 0x52, 0x42, 0x66, 0x0C, 0x54, 0x44, 0x42, 0x44, 0x44, 0x44, 0x22, 0x22, 0x25, 0x55, 
-    0x55, 0x55, 0x55, 0x66, 0x60, 0x06, 0x68, 0x8C, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x02, 0x44, 
-    0x44, 0x45, 0x64, 0x45, 0xC8, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 0x44, 
-    0x44, 0x5C, 0x62, 0x26, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x22, 0x08, 0x13, 
-    0x80, 0x02, 0x44, 0x26, 0xC6, 0x66, 0x64, 0x44, 0x44, 0x44, 0x4A, 0x44, 0x22, 0x52, 0x25, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 0x00, 0x00, 0x88, 0x88, 0x0E, 0x56, 0x02, 0x24, 
-    0x44, 0x56, 0x62, 0x45, 0x00, 0x00, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 0x44, 
-    0x24, 0xC6, 0x62, 0x26, 0x52, 0x22, 0x50, 0x56, 0x02, 0x22, 0x22, 0x25, 0x06, 0x20, 0x13, 0x11, 
-    0x80, 0x52, 0x44, 0x42, 0x55, 0x55, 0x64, 0x44, 0x44, 0x4A, 0xAA, 0xA4, 0x44, 0x42, 0x25, 0x55, 
-    0x52, 0x25, 0x25, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x88, 0x88, 0x02, 0x22, 0x22, 0x24, 
-    0x44, 0x65, 0xC4, 0x45, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0x44, 
-    0x52, 0xC6, 0x65, 0x25, 0x65, 0x55, 0x50, 0x00, 0x00, 0x55, 0x22, 0x22, 0x05, 0x2B, 0x00, 0x00, 
-    0x00, 0x52, 0x44, 0xA4, 0x44, 0xA4, 0x4A, 0x44, 0xA4, 0x4A, 0xA4, 0x44, 0x4A, 0xA2, 0x25, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x25, 0x25, 0x56, 0x66, 0x66, 0x66, 0x06, 0x08, 0x02, 0x22, 0x22, 0x24, 
-    0x44, 0x66, 0xC2, 0x45, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 
-    0x52, 0xC6, 0x25, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x05, 0x25, 0x25, 0x80, 0x02, 0x00, 
-    0x55, 0x52, 0x24, 0xA4, 0x44, 0xA4, 0x4A, 0x44, 0x44, 0x4A, 0x42, 0x44, 0x22, 0x25, 0x55, 0x55, 
-    0x55, 0x52, 0x25, 0x55, 0x22, 0x25, 0x55, 0x66, 0x66, 0x66, 0x00, 0x66, 0x62, 0x22, 0x22, 0x24, 
-    0x44, 0x6C, 0x55, 0x25, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 
-    0x52, 0xCC, 0x55, 0x50, 0x00, 0x00, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x25, 0x55, 
-    0x55, 0x52, 0x24, 0xA4, 0x4A, 0xA4, 0xAA, 0x44, 0x44, 0x4A, 0x42, 0x44, 0x25, 0x55, 0x55, 0x55, 
-    0x22, 0x22, 0x22, 0x55, 0x22, 0x22, 0x25, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x22, 0x24, 
-    0x24, 0x6C, 0x66, 0x55, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 
-    0x52, 0xCC, 0x52, 0x50, 0x88, 0x00, 0x13, 0x33, 0x80, 0x80, 0x08, 0x88, 0x00, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x44, 0x4A, 0xA4, 0xAA, 0x44, 0x44, 0x4A, 0x44, 0x42, 0x55, 0x55, 0x55, 0x55, 
-    0x25, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x25, 0x22, 
-    0x22, 0x5C, 0x60, 0x66, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 
-    0x62, 0xCC, 0x22, 0x50, 0x81, 0x18, 0x13, 0x31, 0x88, 0x10, 0x00, 0x60, 0x05, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x24, 0x4A, 0xAA, 0xA4, 0x22, 0x42, 0x24, 0x22, 0x42, 0x25, 0x55, 0x55, 0x55, 
-    0x22, 0x52, 0x22, 0x22, 0x22, 0x22, 0x55, 0x66, 0x66, 0x66, 0x56, 0x66, 0x65, 0x56, 0x66, 0x52, 
-    0x22, 0x25, 0x00, 0x66, 0x06, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0xC5, 0xC6, 0x25, 0x08, 0x33, 0x33, 0x33, 0x33, 0x13, 0x16, 0x55, 0x50, 0x00, 0xE2, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x24, 0x4A, 0xAA, 0x44, 0x22, 0x22, 0x22, 0x22, 0x44, 0x42, 0x55, 0x55, 0x55, 
-    0x44, 0x22, 0x22, 0x24, 0x42, 0x22, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x65, 0x56, 0x66, 0x65, 
-    0x22, 0x25, 0x00, 0x66, 0x06, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x65, 0xC0, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x86, 0x55, 0x50, 0x00, 0x52, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x4A, 0xAA, 0x44, 0x22, 0x22, 0x22, 0x22, 0x44, 0x44, 0x25, 0x55, 0x55, 
-    0x44, 0x42, 0x24, 0x44, 0x44, 0x22, 0x25, 0x55, 0x55, 0x56, 0x55, 0x55, 0x56, 0x65, 0x66, 0x66, 
-    0x66, 0x25, 0x00, 0x06, 0x66, 0x66, 0x66, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x55, 0xC8, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x80, 0x55, 0x55, 0x60, 0x22, 0x25, 0x52, 
-    0x22, 0x22, 0x22, 0x22, 0x4A, 0xAA, 0x42, 0x22, 0x22, 0x22, 0x22, 0x24, 0x42, 0x25, 0x55, 0x55, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x25, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x56, 0x55, 
-    0x66, 0x55, 0x65, 0x56, 0x00, 0x66, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x6C, 0xC1, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x18, 0x80, 0x55, 0x55, 0xE0, 0x22, 0x25, 0x52, 
-    0x22, 0x22, 0x22, 0x22, 0x4A, 0xA4, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x55, 0x55, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x25, 0x55, 0x52, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x56, 0x00, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0xCC, 0x81, 0x13, 0x33, 0x33, 0x33, 0x31, 0x18, 0x08, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x22, 
-    0x22, 0x22, 0x22, 0x52, 0x4A, 0xA4, 0x42, 0x22, 0x22, 0x22, 0x22, 0x42, 0x22, 0x25, 0x55, 0x55, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x22, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x56, 0x66, 0x55, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0xC0, 0x11, 0x11, 0x33, 0x38, 0x88, 0x88, 0x88, 0x88, 0x05, 0x55, 0x55, 0x22, 0x25, 0x55, 0x22, 
-    0x25, 0x55, 0x52, 0x52, 0x4A, 0xA4, 0x22, 0x22, 0x22, 0x22, 0x24, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 0x22, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB2, 0x22, 0x22, 0x22, 0x22, 
-    0x68, 0x11, 0x33, 0x33, 0x00, 0x00, 0x08, 0x80, 0x00, 0x05, 0x55, 0x22, 0x22, 0x22, 0x22, 0x55, 
-    0x52, 0x25, 0x52, 0x22, 0x44, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x22, 0x22, 0x22, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x66, 0x56, 0x55, 0x56, 0x52, 0x22, 0xB0, 0x00, 0x60, 0x00, 0x22, 0x22, 
-    0x68, 0x81, 0x18, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x24, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 0x42, 0x22, 0x22, 
+const uint8_t GAME_STORY_LOGO_RLE[GAME_STORY_LOGO_RLE_SIZE] = {
+    0xB1, 0xF3, 0x01, 0xF0, 0x68, 0x05, 0x88, 0x11, 0x81, 0xE3, 0x03, 0x0B, 0x99, 0xBB, 0x00, 0x90, 
+    0xAB, 0x01, 0x09, 0xFB, 0x08, 0x08, 0x90, 0x09, 0x9B, 0xB9, 0x00, 0xB9, 0x01, 0xBB, 0xF9, 0x2B, 
+    0xF0, 0x04, 0xE1, 0x45, 0x02, 0x00, 0x00, 0xF9, 0x15, 0xB0, 0x03, 0x90, 0x00, 0xF9, 0x13, 0xA0, 
+    0xF9, 0x01, 0x06, 0x00, 0x99, 0x09, 0x90, 0xF0, 0x0D, 0x05, 0x31, 0x81, 0x33, 0x45, 0x09, 0x10, 
+    0x80, 0x00, 0x99, 0x00, 0xF9, 0x0E, 0x0E, 0x00, 0x90, 0x09, 0x99, 0x00, 0x99, 0x90, 0x00, 0xF9, 
+    0x0A, 0x02, 0x00, 0x90, 0xA0, 0xF9, 0x03, 0x02, 0x09, 0x90, 0xC0, 0x00, 0x80, 0x53, 0x00, 0x10, 
+    0x42, 0xC3, 0x00, 0x10, 0xB0, 0x02, 0x99, 0x90, 0x57, 0x00, 0x80, 0xF9, 0x03, 0x01, 0x00, 0x52, 
+    0xF0, 0x23, 0x04, 0x33, 0x11, 0x10, 0xF3, 0x01, 0x42, 0xF9, 0x07, 0x00, 0x00, 0xF9, 0x02, 0x03, 
+    0x08, 0x10, 0xE9, 0x00, 0x00, 0xF9, 0x0D, 0x01, 0x08, 0xF0, 0x1F, 0x02, 0x13, 0x10, 0x4D, 0x00, 
+    0x10, 0xF0, 0x02, 0xE9, 0xB0, 0x00, 0x90, 0xA0, 0x06, 0xE0, 0x08, 0x13, 0x80, 0xDE, 0x00, 0x00, 
+    0x42, 0x05, 0x0E, 0xE0, 0xE0, 0xA9, 0xE0, 0x01, 0x95, 0x48, 0x00, 0x80, 0xF0, 0x13, 0x05, 0x18, 
+    0x33, 0x11, 0x43, 0x00, 0x10, 0x52, 0x03, 0x09, 0x91, 0xE0, 0x01, 0x9D, 0xC7, 0x03, 0xF8, 0x10, 
+    0xF7, 0x00, 0x03, 0x09, 0x90, 0xC7, 0x03, 0xD9, 0x90, 0xD7, 0x0D, 0xFC, 0x68, 0xC7, 0x77, 0x00, 
+    0xC7, 0x77, 0xF0, 0x13, 0x01, 0x81, 0x50, 0x01, 0x31, 0x4A, 0x03, 0x03, 0x09, 0xB0, 0x01, 0x90, 
+    0xE7, 0x00, 0xD0, 0x4B, 0x00, 0xD0, 0xE7, 0x00, 0x50, 0x47, 0x03, 0x70, 0x51, 0x42, 0x06, 0xE0, 
+    0xD7, 0x77, 0xB0, 0xF0, 0x13, 0x01, 0x11, 0xB3, 0x02, 0x11, 0x10, 0xF3, 0x03, 0x00, 0x10, 0xF0, 
+    0x01, 0x01, 0x33, 0xD0, 0x01, 0x9D, 0xE7, 0x01, 0x00, 0x49, 0x01, 0xBF, 0xE7, 0x00, 0xD0, 0x48, 
+    0x02, 0x75, 0x00, 0x64, 0x01, 0x11, 0xF3, 0x0D, 0xE0, 0x04, 0x90, 0x31, 0x90, 0x48, 0x1A, 0x0E, 
+    0xED, 0x77, 0xFB, 0x13, 0x0E, 0x77, 0x75, 0xBE, 0xB9, 0xF7, 0x70, 0xBB, 0x00, 0x46, 0x02, 0xDB, 
+    0xE0, 0x48, 0x00, 0xB0, 0x43, 0x00, 0x90, 0xF0, 0x10, 0x00, 0x10, 0xF3, 0x0F, 0x00, 0x10, 0xE0, 
+    0x02, 0x13, 0x10, 0xD0, 0x43, 0x11, 0x00, 0xD7, 0x5B, 0x01, 0x31, 0x07, 0x77, 0xE9, 0x00, 0x43, 
+    0x02, 0x99, 0xF0, 0x46, 0x02, 0x59, 0x00, 0x48, 0x00, 0x90, 0x59, 0x0A, 0x11, 0x00, 0x01, 0x13, 
+    0x31, 0x10, 0xF3, 0x0B, 0xB0, 0x05, 0x13, 0x33, 0x11, 0x4A, 0x06, 0x13, 0x00, 0x08, 0x30, 0x4D, 
+    0x00, 0xB0, 0x55, 0x00, 0x00, 0x43, 0xF0, 0x0D, 0x45, 0x00, 0x10, 0x42, 0x00, 0x10, 0xF3, 0x09, 
+    0x04, 0x10, 0x01, 0x10, 0x42, 0x08, 0x31, 0x10, 0x00, 0x80, 0x00, 0x45, 0x07, 0x3F, 0xF1, 0x33, 
+    0x38, 0x45, 0x00, 0x00, 0x42, 0x00, 0x90, 0x43, 0x02, 0x01, 0x00, 0x4E, 0x00, 0xC0, 0x43, 0x01, 
+    0x88, 0xF0, 0x0D, 0x03, 0x10, 0x11, 0xB3, 0x53, 0xB1, 0xB3, 0x00, 0x10, 0xA8, 0x01, 0x0C, 0x42, 
+    0x06, 0x80, 0x77, 0xF0, 0x10, 0x4E, 0x00, 0x00, 0x47, 0x02, 0xD0, 0x80, 0x42, 0x0B, 0xBD, 0x77, 
+    0x7B, 0x0F, 0x77, 0x7E, 0x46, 0x00, 0x10, 0xF0, 0x0A, 0x44, 0xF3, 0x04, 0x05, 0x11, 0x33, 0x13, 
+    0xC1, 0xC3, 0x01, 0x11, 0x46, 0x00, 0xD0, 0xA7, 0x00, 0x00, 0x42, 0x00, 0x00, 0x52, 0x05, 0x77, 
+    0x75, 0x00, 0x47, 0x01, 0xD0, 0xA7, 0x03, 0xE0, 0x31, 0x47, 0x04, 0x11, 0x33, 0x10, 0xF0, 0x01, 
+    0x00, 0x10, 0xB3, 0x02, 0x13, 0x10, 0x4D, 0x00, 0x30, 0x4B, 0x03, 0x81, 0x11, 0x43, 0xC7, 0x43, 
+    0x00, 0x80, 0x51, 0x05, 0x37, 0x77, 0xDF, 0xA7, 0x44, 0xC7, 0x0D, 0xE0, 0x33, 0x00, 0x01, 0x31, 
+    0x13, 0x13, 0x44, 0x0F, 0x13, 0x31, 0x00, 0x01, 0x33, 0x11, 0x13, 0x31, 0xF3, 0x03, 0x43, 0xD1, 
+    0xB3, 0x06, 0x18, 0x11, 0x88, 0x10, 0x4C, 0x00, 0x30, 0x42, 0xA0, 0x43, 0x00, 0x10, 0x43, 0x00, 
+    0x10, 0xE7, 0x01, 0x0B, 0x49, 0x09, 0xB0, 0x33, 0x10, 0x11, 0x33, 0xC1, 0xA3, 0x00, 0x10, 0xA3, 
+    0x00, 0x10, 0xC3, 0x04, 0x11, 0x33, 0x10, 0xF3, 0x00, 0xA1, 0x48, 0x0C, 0x11, 0x33, 0x38, 0xC1, 
+    0x16, 0x10, 0xD0, 0xA7, 0x01, 0x00, 0x4B, 0x02, 0x11, 0x10, 0x48, 0x02, 0x91, 0x00, 0xC7, 0x04, 
+    0xDB, 0xB0, 0x50, 0xA7, 0x01, 0x0D, 0x43, 0x04, 0x66, 0x00, 0x00, 0xF1, 0x00, 0x05, 0x33, 0x31, 
+    0x11, 0xF3, 0x05, 0x01, 0x11, 0xB3, 0xD1, 0xB3, 0x03, 0x11, 0x33, 0xB1, 0x0E, 0x86, 0x51, 0x66, 
+    0x65, 0x07, 0x70, 0xE9, 0xD0, 0x42, 0x00, 0x80, 0x47, 0x00, 0x30, 0x43, 0x00, 0x00, 0x43, 0x00, 
+    0x00, 0x46, 0x0A, 0x5B, 0x26, 0xC7, 0x7F, 0x5B, 0x50, 0x42, 0x08, 0xB8, 0x66, 0x68, 0x06, 0x60, 
+    0xB0, 0x01, 0x11, 0x43, 0x00, 0x10, 0x4F, 0xB1, 0x01, 0x33, 0x43, 0x00, 0x10, 0x42, 0x00, 0x10, 
+    0x43, 0x0F, 0x85, 0x55, 0x65, 0x65, 0x50, 0x05, 0xB0, 0x80, 0x4B, 0x02, 0x33, 0x30, 0x4A, 0x11, 
+    0x77, 0x7D, 0x07, 0x70, 0xB2, 0x6D, 0xF5, 0xBB, 0x9D, 0x46, 0xF0, 0x01, 0x42, 0x02, 0x31, 0x30, 
+    0xA1, 0x06, 0x33, 0x11, 0x33, 0x30, 0xF1, 0x02, 0xA3, 0xB1, 0x0A, 0x33, 0x31, 0x86, 0x66, 0x18, 
+    0x60, 0xB5, 0x08, 0x65, 0x55, 0x6B, 0x56, 0x00, 0x42, 0x02, 0x90, 0x10, 0x44, 0x00, 0x80, 0x4B, 
+    0x12, 0x98, 0x07, 0x75, 0x57, 0x77, 0x5B, 0x66, 0x09, 0xB2, 0x00, 0x43, 0x06, 0x90, 0x00, 0x88, 
+    0x10, 0x4A, 0x02, 0x31, 0x30, 0x42, 0xF1, 0x08, 0x04, 0x33, 0x13, 0x30, 0xB1, 0x05, 0xC1, 0x38, 
+    0x56, 0xF5, 0x00, 0x08, 0x65, 0x6C, 0xD0, 0x75, 0x20, 0x42, 0x01, 0x08, 0x45, 0x00, 0x00, 0x4D, 
+    0x0F, 0x77, 0x75, 0xB0, 0x77, 0x0B, 0x60, 0x00, 0x55, 0x49, 0x06, 0x13, 0x11, 0x80, 0x10, 0x42, 
+    0x07, 0x13, 0x31, 0x13, 0x38, 0x54, 0xA1, 0x0B, 0x82, 0x44, 0x06, 0x65, 0x62, 0x42, 0xA5, 0x09, 
+    0x25, 0x52, 0x6D, 0x77, 0x0B, 0x44, 0x01, 0x13, 0x45, 0x00, 0x10, 0x43, 0x00, 0xD0, 0x4B, 0x0B, 
+    0xD7, 0x77, 0x5B, 0x6D, 0xF7, 0xE9, 0x43, 0xB0, 0x02, 0x11, 0x10, 0xA3, 0xF1, 0x00, 0x05, 0x33, 
+    0x11, 0x33, 0xE1, 0x04, 0x33, 0x11, 0x30, 0xC1, 0x0A, 0x31, 0x11, 0x64, 0x44, 0x04, 0x20, 0x47, 
+    0x00, 0x50, 0x42, 0x05, 0x07, 0x70, 0x55, 0x42, 0x03, 0xB0, 0x61, 0x45, 0x07, 0x11, 0xF7, 0x7F, 
+    0x03, 0x42, 0x00, 0x00, 0x42, 0x0D, 0xD9, 0x00, 0x77, 0x0B, 0xD7, 0x77, 0x5E, 0x47, 0xD1, 0x43, 
+    0x07, 0x00, 0x81, 0x31, 0x33, 0xA1, 0x00, 0x30, 0x48, 0xD1, 0x03, 0x33, 0x16, 0xB4, 0x05, 0x02, 
+    0x26, 0x55, 0x46, 0x00, 0x50, 0x42, 0xC7, 0x05, 0x0B, 0x24, 0x6C, 0x43, 0x00, 0x30, 0x43, 0xC7, 
+    0x02, 0xD0, 0x10, 0x47, 0x02, 0x7B, 0x50, 0xF7, 0x00, 0xA0, 0x0A, 0x81, 0x11, 0x00, 0x81, 0x80, 
+    0x80, 0x42, 0x03, 0x01, 0x33, 0xD1, 0x00, 0x30, 0xA1, 0xA3, 0xF1, 0x00, 0x01, 0x36, 0xF4, 0x01, 
+    0x02, 0x00, 0x40, 0xF5, 0x00, 0x4B, 0x01, 0x40, 0x43, 0x03, 0x13, 0x10, 0xE7, 0x02, 0xE0, 0x80, 
+    0x42, 0x07, 0x08, 0x37, 0x77, 0xDB, 0xE7, 0x05, 0xF9, 0x11, 0x00, 0xA1, 0x01, 0x81, 0x46, 0x00, 
+    0x80, 0xF1, 0x06, 0x00, 0x80, 0xA3, 0xE1, 0x00, 0x80, 0xF4, 0x06, 0x0A, 0x02, 0x44, 0x45, 0x52, 
+    0x2D, 0xF0, 0xB7, 0x05, 0x0B, 0x22, 0x42, 0x42, 0x06, 0x50, 0x31, 0x11, 0x00, 0xB7, 0x05, 0x0D, 
+    0x08, 0x8F, 0x42, 0x08, 0x33, 0xF7, 0x70, 0xB5, 0xF0, 0xB7, 0x06, 0xFE, 0x08, 0x31, 0x10, 0xA3, 
+    0xF1, 0x00, 0x00, 0x80, 0xF1, 0x06, 0x01, 0x80, 0x43, 0x01, 0x88, 0xB1, 0x00, 0x00, 0xF4, 0x0B, 
+    0x16, 0x66, 0x52, 0x65, 0x5E, 0xBE, 0xBB, 0x22, 0x20, 0x04, 0x42, 0x2B, 0x90, 0xB1, 0x02, 0x00, 
+    0xE0, 0xB0, 0x12, 0x81, 0x80, 0xE0, 0x01, 0x33, 0x80, 0xEB, 0xB0, 0xEE, 0xE0, 0xA0, 0x01, 0x81, 
+    0x4E, 0xF1, 0x07, 0x12, 0x06, 0x33, 0x31, 0x08, 0x08, 0x80, 0x11, 0x82, 0x44, 0x40, 0xA2, 0xF4, 
+    0x05, 0x10, 0x04, 0x42, 0x22, 0x60, 0x22, 0x24, 0x44, 0x00, 0x40, 0xA2, 0x00, 0x80, 0xC1, 0xD0, 
+    0x06, 0x11, 0x10, 0x00, 0x80, 0xA1, 0x02, 0x00, 0xE0, 0xA0, 0xB1, 0xF3, 0x02, 0xD1, 0xD3, 0xB1, 
+    0x03, 0x33, 0x86, 0x44, 0xC0, 0x44, 0x00, 0x40, 0x42, 0x00, 0x20, 0xF4, 0x05, 0x13, 0x00, 0x65, 
+    0x00, 0x24, 0x44, 0x04, 0x04, 0x05, 0x40, 0x06, 0xF1, 0x0A, 0x01, 0x08, 0xA1, 0xB0, 0x00, 0x80, 
+    0xF1, 0x1C, 0x00, 0x00, 0x43, 0x02, 0x33, 0x10, 0xA0, 0x05, 0x81, 0x16, 0x42, 0xF4, 0x11, 0x01, 
+    0x00, 0x44, 0x01, 0x06, 0xA4, 0x05, 0x0C, 0x81, 0x13, 0xF1, 0x04, 0x00, 0x30, 0xC1, 0x03, 0x00, 
+    0x08, 0xF1, 0x04, 0x03, 0x80, 0x00, 0xF1, 0x0C, 0x00, 0x80, 0x46, 0x01, 0x31, 0x43, 0x0E, 0x38, 
+    0x22, 0x24, 0x44, 0xAA, 0x4A, 0xA4, 0xA0, 0x4F, 0x00, 0x00, 0xB4, 0x00, 0x60, 0xB4, 0x07, 0xCC, 
+    0x00, 0x01, 0x08, 0xF1, 0x09, 0x03, 0x05, 0x00, 0xF1, 0x07, 0x58, 0x05, 0x11, 0x33, 0x31, 0x45, 
+    0x06, 0x12, 0x24, 0x44, 0xA0, 0x45, 0x00, 0xA0, 0xC4, 0xAA, 0xB4, 0x00, 0x00, 0xB4, 0x00, 0x00, 
+    0x45, 0xC1, 0x43, 0x08, 0x00, 0x13, 0x33, 0x11, 0x10, 0xA0, 0x06, 0x10, 0x00, 0x81, 0x10, 0xA0, 
+    0x00, 0x80, 0xF1, 0x03, 0x00, 0x30, 0xF1, 0x04, 0x04, 0x33, 0x11, 0x10, 0xA0, 0xB3, 0x00, 0x80, 
+    0xA0, 0x07, 0x11, 0x33, 0x5A, 0x42, 0x48, 0x00, 0xA0, 0xA4, 0x08, 0xAA, 0x4A, 0xAA, 0x44, 0x40, 
+    0xA0, 0x03, 0x44, 0x46, 0x42, 0x01, 0xA5, 0x45, 0x00, 0x10, 0xC0, 0x00, 0x80, 0xF0, 0x0F, 0x0A, 
+    0x81, 0x11, 0x81, 0x18, 0x08, 0x80, 0xC1, 0x01, 0x33, 0xF1, 0x03, 0x44, 0x00, 0x80, 0xA0, 0x00, 
+    0x80, 0x42, 0x02, 0xC6, 0x20, 0x46, 0xAA, 0x03, 0x44, 0x4A, 0x48, 0x01, 0x66, 0x42, 0x01, 0x05, 
+    0xB4, 0x00, 0x60, 0xF0, 0x04, 0x48, 0x04, 0x81, 0x10, 0x80, 0xA1, 0xA8, 0xB0, 0x15, 0x88, 0x81, 
+    0x81, 0x31, 0x00, 0x08, 0x00, 0x13, 0x18, 0x88, 0x08, 0xA1, 0x14, 0x80, 0x06, 0x33, 0x31, 0x01, 
+    0x80, 0x81, 0x13, 0x33, 0x13, 0x60, 0x44, 0x00, 0x40, 0xCA, 0x4A, 0x02, 0x66, 0x40, 0x51, 0xC8, 
+    0x04, 0x18, 0x81, 0x10, 0xB8, 0x00, 0x10, 0x42, 0x02, 0x88, 0x10, 0xA8, 0xB0, 0xD8, 0x03, 0x11, 
+    0x88, 0xF0, 0x04, 0x02, 0x81, 0x10, 0xA0, 0xA3, 0x04, 0x10, 0x08, 0x00, 0xA1, 0x06, 0x33, 0x38, 
+    0x22, 0x40, 0x55, 0x02, 0x0A, 0x50, 0xA4, 0x43, 0x00, 0x50, 0xF0, 0x02, 0x04, 0x88, 0x11, 0x10, 
+    0xF8, 0x03, 0x02, 0x18, 0x80, 0xA1, 0xF8, 0x02, 0x00, 0x10, 0xA8, 0x03, 0x00, 0x08, 0xD0, 0x02, 
+    0x88, 0x80, 0xC0, 0x00, 0x60, 0xB3, 0x05, 0x10, 0x00, 0x13, 0x43, 0x07, 0x36, 0x44, 0x4A, 0x42, 
+    0x45, 0x00, 0x20, 0x45, 0x10, 0xA4, 0x40, 0x44, 0x54, 0x4A, 0x65, 0x25, 0x44, 0x60, 0xF0, 0x05, 
+    0x0C, 0x80, 0x00, 0x88, 0x11, 0x18, 0x18, 0x80, 0xD1, 0x03, 0x88, 0x08, 0xA0, 0x01, 0x88, 0xF0, 
+    0x00, 0x02, 0x81, 0x10, 0xA8, 0x07, 0x18, 0x08, 0x11, 0x18, 0xA0, 0xC3, 0x02, 0x00, 0x80, 0x46, 
+    0x01, 0x12, 0x55, 0x0C, 0x5A, 0x40, 0xA4, 0x46, 0x55, 0x02, 0x20, 0xF0, 0x0B, 0xF8, 0x00, 0x08, 
+    0x11, 0x08, 0x88, 0x08, 0x10, 0xA8, 0xF0, 0x00, 0xD8, 0x0F, 0x08, 0x11, 0x10, 0x88, 0x00, 0x88, 
+    0x80, 0x51, 0xB3, 0xA1, 0x03, 0x33, 0x11, 0xA3, 0x10, 0x51, 0x4A, 0x44, 0xAA, 0xA4, 0xAA, 0xA2, 
+    0xAA, 0x40, 0x44, 0x0C, 0x25, 0xA4, 0x4A, 0xAA, 0x56, 0x00, 0x00, 0x43, 0x00, 0x10, 0xF0, 0x04, 
+    0x01, 0x88, 0xC1, 0x0C, 0x88, 0x11, 0x88, 0x08, 0x10, 0x01, 0x10, 0x42, 0x02, 0x81, 0x80, 0xF0, 
+    0x02, 0xA8, 0x05, 0x00, 0x08, 0x88, 0xA0, 0x00, 0x60, 0x45, 0x02, 0x33, 0x10, 0xF3, 0x00, 0x04, 
+    0x83, 0x5A, 0x40, 0xAA, 0x42, 0x00, 0x40, 0xFA, 0x00, 0x08, 0x44, 0xA0, 0x44, 0x24, 0x60, 0xA0, 
+    0x00, 0x50, 0xA0, 0x00, 0x90, 0x4D, 0x0D, 0x88, 0x18, 0x00, 0x88, 0x81, 0x11, 0x31, 0xE8, 0xF0, 
+    0x14, 0x01, 0x65, 0xF3, 0x0B, 0x4F, 0x0B, 0x4A, 0xAA, 0x24, 0xA4, 0x44, 0x02, 0x43, 0xF0, 0x02, 
+    0x1A, 0x66, 0x60, 0x60, 0x80, 0x81, 0x81, 0x33, 0x31, 0x80, 0x08, 0x80, 0x88, 0x33, 0x80, 0xD0, 
+    0x01, 0x88, 0xF0, 0x00, 0x00, 0x80, 0xF0, 0x06, 0x00, 0x50, 0x58, 0x00, 0x40, 0x4A, 0x08, 0x4A, 
+    0xA4, 0xAA, 0xA4, 0x20, 0xE0, 0x02, 0x66, 0x60, 0xF0, 0x02, 0xA6, 0x01, 0x11, 0xC3, 0x05, 0x18, 
+    0x01, 0x18, 0xA3, 0x0A, 0x18, 0x83, 0x31, 0x81, 0x31, 0x80, 0xB0, 0x02, 0x80, 0x60, 0xF0, 0x01, 
+    0x07, 0x88, 0x08, 0x06, 0x56, 0xF3, 0x09, 0x03, 0x13, 0x64, 0x42, 0x00, 0x40, 0x42, 0xBA, 0xA4, 
+    0x06, 0xAA, 0x44, 0xA4, 0x50, 0xC0, 0xB6, 0x0D, 0x00, 0x88, 0x80, 0x68, 0x00, 0x88, 0x81, 0xA3, 
+    0x04, 0x18, 0x11, 0x10, 0xF3, 0x02, 0x15, 0x13, 0x31, 0x13, 0x31, 0x18, 0x08, 0x81, 0x08, 0x05, 
+    0x06, 0x61, 0xD0, 0x06, 0x80, 0x06, 0x56, 0x50, 0xF3, 0x04, 0xC1, 0x03, 0x31, 0x2A, 0x49, 0xC4, 
+    0x42, 0x02, 0x44, 0x60, 0xA0, 0xD6, 0x01, 0xCC, 0xE6, 0x07, 0x13, 0x31, 0x10, 0x11, 0xA6, 0x02, 
+    0xC8, 0x80, 0xA1, 0x44, 0x05, 0x11, 0x80, 0x80, 0xA6, 0x0E, 0xC8, 0x86, 0x05, 0x56, 0x56, 0x33, 
+    0x06, 0x60, 0xB0, 0x03, 0x66, 0x55, 0x4A, 0xF1, 0x00, 0x08, 0x36, 0x65, 0xA2, 0x44, 0x40, 0xAA, 
+    0x02, 0x44, 0x50, 0x47, 0x03, 0x20, 0x22, 0xF6, 0x01, 0x45, 0x02, 0x01, 0x00, 0xA1, 0x0D, 0xC1, 
+    0x01, 0x06, 0x10, 0x65, 0x56, 0x80, 0x45, 0x0A, 0x31, 0x18, 0x06, 0x88, 0x81, 0x00, 0xC6, 0x0C, 
+    0x56, 0x13, 0x11, 0x10, 0x08, 0x86, 0x60, 0xA5, 0xB1, 0x15, 0x38, 0x01, 0x11, 0x81, 0x88, 0x13, 
+    0x11, 0x31, 0x81, 0x15, 0x22, 0x45, 0x01, 0x06, 0x47, 0x00, 0x50, 0x42, 0x00, 0x50, 0xF6, 0x05, 
+    0x25, 0xCC, 0x81, 0x1C, 0x00, 0x13, 0x16, 0x66, 0x82, 0x25, 0x50, 0x88, 0x01, 0x10, 0x80, 0x01, 
+    0x11, 0x81, 0x86, 0x60, 0xF6, 0x04, 0x08, 0x06, 0x66, 0x00, 0x66, 0x60, 0x43, 0x06, 0x81, 0x31, 
+    0x80, 0x60, 0xC1, 0xB3, 0x04, 0x18, 0x13, 0x80, 0x42, 0x00, 0x40, 0x42, 0x00, 0x50, 0x46, 0x03, 
+    0x25, 0x60, 0xD2, 0xF6, 0x00, 0x06, 0xCC, 0x66, 0xC0, 0xC0, 0xA6, 0xAC, 0x01, 0x15, 0x42, 0x16, 
+    0x60, 0x25, 0x88, 0x50, 0x56, 0x06, 0x00, 0x83, 0x38, 0x52, 0x66, 0x50, 0xF6, 0x03, 0x01, 0x88, 
+    0xA6, 0x0C, 0x55, 0x50, 0x80, 0x88, 0x62, 0x55, 0x50, 0xC1, 0xB3, 0x04, 0x18, 0x11, 0x60, 0x49, 
+    0x00, 0x00, 0x43, 0x04, 0x5C, 0x00, 0x50, 0xF2, 0x00, 0x00, 0x50, 0xE6, 0x0F, 0xC6, 0x65, 0x56, 
+    0x52, 0x6C, 0xCC, 0x62, 0x52, 0xA5, 0x43, 0x03, 0x65, 0x66, 0xA5, 0x05, 0x66, 0x62, 0x20, 0xF6, 
+    0x06, 0x01, 0x86, 0xC5, 0xA1, 0x04, 0x85, 0x22, 0x20, 0x44, 0xC3, 0x04, 0x10, 0x01, 0x80, 0x42, 
+    0x00, 0x40, 0x44, 0x0A, 0x44, 0xAA, 0x46, 0x4C, 0x00, 0x00, 0xF2, 0x03, 0x07, 0x44, 0x22, 0x66, 
+    0x65, 0x42, 0x01, 0x22, 0xB6, 0x20, 0x25, 0x55, 0x22, 0x52, 0x68, 0x65, 0x60, 0x88, 0x55, 0x26, 
+    0x60, 0x56, 0x6C, 0x61, 0x11, 0xCC, 0xC0, 0xF6, 0x02, 0x44, 0x08, 0x33, 0x31, 0x85, 0x22, 0x60, 
+    0x47, 0x00, 0x10, 0x42, 0x03, 0x00, 0x22, 0x45, 0x00, 0x00, 0x43, 0x04, 0x50, 0x4C, 0x10, 0x4C, 
+    0x11, 0x22, 0x42, 0x22, 0x55, 0x65, 0x25, 0x25, 0xC5, 0x66, 0xB2, 0x1E, 0x61, 0x02, 0x60, 0x25, 
+    0x65, 0x60, 0x06, 0x22, 0x66, 0xC6, 0xC6, 0x66, 0x11, 0x00, 0x11, 0xC0, 0xE6, 0x13, 0x55, 0x56, 
+    0x55, 0x11, 0x31, 0x11, 0x62, 0x50, 0x11, 0x13, 0xE1, 0x44, 0x00, 0x20, 0xB4, 0x01, 0x56, 0xA4, 
+    0x04, 0xA0, 0x05, 0x80, 0xC0, 0xB2, 0x00, 0x40, 0xA2, 0x0F, 0x44, 0x22, 0x45, 0x52, 0x52, 0x62, 
+    0x2C, 0x5C, 0x44, 0x10, 0x83, 0x30, 0x00, 0x55, 0x56, 0x22, 0x66, 0x22, 0x50, 0xB6, 0x09, 0xC6, 
+    0x00, 0xCC, 0xC0, 0x00, 0x48, 0x0B, 0x55, 0x58, 0x68, 0x11, 0x15, 0x22, 0x42, 0xE1, 0x00, 0x80, 
+    0xA0, 0x01, 0x56, 0x44, 0x09, 0x66, 0x40, 0x44, 0x40, 0x06, 0xD0, 0x45, 0x00, 0x40, 0x42, 0x03, 
+    0x44, 0x46, 0xA2, 0x06, 0x52, 0x25, 0x5C, 0x50, 0xA2, 0x0E, 0x01, 0x11, 0x88, 0x00, 0x01, 0x36, 
+    0x56, 0x50, 0xB2, 0x03, 0x55, 0x6C, 0xA0, 0x00, 0xC0, 0xE6, 0x04, 0x55, 0x60, 0x60, 0xF5, 0x00, 
+    0x0F, 0x88, 0x05, 0x08, 0x81, 0x18, 0x81, 0x81, 0x18, 0xD0, 0x00, 0x60, 0xB4, 0x0E, 0xC6, 0x44, 
+    0x45, 0x56, 0x06, 0x02, 0x2E, 0xB0, 0xF2, 0x00, 0x46, 0x13, 0x52, 0x65, 0x26, 0x25, 0x22, 0xC8, 
+    0x55, 0x25, 0x68, 0x81, 0xA3, 0x08, 0x13, 0x38, 0x13, 0x02, 0x20, 0xB4, 0x04, 0x25, 0x66, 0x60, 
+    0xC5, 0x00, 0x60, 0xB2, 0x01, 0x56, 0x48, 0x07, 0x58, 0x10, 0x88, 0x81, 0xC8, 0x48, 0x05, 0x24, 
+    0x44, 0x56, 0x43, 0x00, 0x60, 0xA0, 0xF2, 0x04, 0x01, 0x44, 0x45, 0x0A, 0x66, 0x22, 0x55, 0x62, 
+    0x25, 0x50, 0xD2, 0x18, 0x50, 0x81, 0x00, 0x81, 0x13, 0x30, 0x24, 0x22, 0x55, 0x26, 0xC6, 0x52, 
+    0x20, 0xF4, 0x02, 0x04, 0x25, 0x55, 0x20, 0xF5, 0x00, 0x01, 0x86, 0xF8, 0x03, 0xA0, 0x01, 0x88, 
+    0x44, 0x03, 0x46, 0xC6, 0x42, 0x00, 0x80, 0x4E, 0x00, 0x20, 0xD4, 0x07, 0x56, 0x52, 0x25, 0x65, 
+    0xF2, 0x04, 0x05, 0x66, 0x62, 0x28, 0x42, 0x0B, 0x52, 0x25, 0x24, 0x26, 0x60, 0xC5, 0xA4, 0x00, 
+    0x20, 0xC4, 0xB2, 0xF5, 0x00, 0x09, 0x66, 0x60, 0x06, 0x68, 0x8C, 0xC8, 0xD0, 0x43, 0x01, 0x45, 
+    0x42, 0x00, 0xC0, 0x58, 0x05, 0xC6, 0x22, 0x65, 0xF2, 0x05, 0x43, 0x0C, 0x08, 0x13, 0x80, 0x02, 
+    0x44, 0x26, 0xC0, 0xA6, 0xE4, 0x00, 0xA0, 0x42, 0x00, 0x50, 0x49, 0xA5, 0xC6, 0xA0, 0xA8, 0x0F, 
+    0x0E, 0x56, 0x02, 0x24, 0x44, 0x56, 0x62, 0x45, 0xA0, 0x00, 0xB0, 0x51, 0x03, 0x24, 0xC6, 0x46, 
+    0x04, 0x50, 0x56, 0x00, 0xC2, 0x10, 0x50, 0x62, 0x01, 0x31, 0x18, 0x05, 0x24, 0x44, 0x20, 0xA5, 
+    0x45, 0xAA, 0xA4, 0x44, 0x03, 0x22, 0x52, 0xC5, 0xF6, 0x00, 0x43, 0xC2, 0x06, 0x44, 0x46, 0x5C, 
+    0x40, 0x42, 0xF2, 0x09, 0xA4, 0x08, 0x52, 0xC6, 0x65, 0x25, 0x60, 0xA5, 0xB0, 0x01, 0x55, 0xA2, 
+    0x03, 0x05, 0x2B, 0xC0, 0x42, 0x0A, 0xA4, 0x44, 0xA4, 0x4A, 0x44, 0xA0, 0x42, 0xA4, 0x01, 0xAA, 
+    0x44, 0xD5, 0x04, 0x25, 0x25, 0x50, 0xD6, 0x02, 0x06, 0x00, 0x4A, 0x04, 0x6C, 0x24, 0x50, 0xF2, 
+    0x0C, 0x45, 0x03, 0x25, 0x26, 0xF0, 0x01, 0x12, 0x60, 0x05, 0x25, 0x25, 0x80, 0x02, 0x00, 0x55, 
+    0x52, 0x20, 0x49, 0x0A, 0x44, 0x4A, 0x42, 0x44, 0x22, 0x20, 0xE5, 0x01, 0x22, 0x42, 0x04, 0x22, 
+    0x55, 0x50, 0x45, 0x03, 0x06, 0x66, 0x48, 0x03, 0xC5, 0x52, 0x54, 0x00, 0x20, 0x43, 0x03, 0xC5, 
+    0x55, 0xB0, 0x03, 0x88, 0x11, 0xF0, 0x00, 0x03, 0x88, 0x02, 0xC5, 0x44, 0x03, 0xAA, 0x4A, 0x4A, 
+    0xD5, 0xC2, 0x43, 0x01, 0x22, 0x45, 0xC6, 0x44, 0x06, 0x24, 0x6C, 0x66, 0x50, 0x5C, 0x14, 0x25, 
+    0x08, 0x80, 0x01, 0x33, 0x38, 0x08, 0x00, 0x88, 0x80, 0x00, 0xF2, 0x03, 0x00, 0x40, 0x4C, 0x02, 
+    0x44, 0x20, 0xE5, 0x01, 0x25, 0xF2, 0x01, 0x00, 0x50, 0x4E, 0x00, 0x50, 0xA2, 0x06, 0x5C, 0x60, 
+    0x66, 0xB0, 0x55, 0x04, 0x62, 0xCC, 0x20, 0x42, 0x10, 0x11, 0x81, 0x33, 0x18, 0x81, 0x00, 0x06, 
+    0x00, 0x50, 0xF2, 0x04, 0x42, 0x0D, 0xAA, 0x42, 0x24, 0x22, 0x42, 0x24, 0x22, 0x46, 0x01, 0x25, 
+    0x4F, 0x00, 0x50, 0xA6, 0x05, 0x55, 0x66, 0x65, 0xA2, 0x06, 0x50, 0x06, 0x60, 0x60, 0xF2, 0x0D, 
+    0x07, 0xC5, 0xC6, 0x25, 0x08, 0xE3, 0x0A, 0x13, 0x16, 0x55, 0x50, 0x00, 0xE0, 0x4F, 0x01, 0x44, 
+    0xE2, 0x03, 0x44, 0x42, 0xC5, 0x01, 0x44, 0xB2, 0x01, 0x44, 0x43, 0x02, 0x55, 0x50, 0xE6, 0x43, 
+    0x01, 0x65, 0x48, 0x02, 0x00, 0x00, 0xF2, 0x0A, 0x06, 0x65, 0xC0, 0x11, 0x10, 0xF3, 0x02, 0x00, 
+    0x80, 0x45, 0x00, 0x50, 0xF2, 0x04, 0x4F, 0x01, 0x42, 0x45, 0x02, 0x42, 0x20, 0xB4, 0x02, 0x22, 
+    0x20, 0xC5, 0x00, 0x60, 0xB5, 0x02, 0x66, 0x50, 0xC6, 0x42, 0x00, 0x00, 0xD6, 0xF2, 0x09, 0x03, 
+    0x55, 0xC8, 0xF3, 0x04, 0x02, 0x18, 0x00, 0xA5, 0x06, 0x60, 0x22, 0x25, 0x50, 0x4C, 0xF2, 0x01, 
+    0x02, 0x44, 0x20, 0x47, 0xE4, 0xA2, 0xF5, 0x01, 0x12, 0x66, 0x65, 0x65, 0x56, 0x65, 0x56, 0x55, 
+    0x60, 0x06, 0x60, 0xF2, 0x0B, 0x03, 0x6C, 0xC1, 0xF3, 0x03, 0x01, 0x18, 0x44, 0x00, 0xE0, 0x50, 
+    0x00, 0x40, 0x49, 0xA2, 0x56, 0x00, 0x20, 0xC5, 0x00, 0x60, 0xF5, 0x03, 0x42, 0xF2, 0x0C, 0x04, 
+    0xCC, 0x81, 0x10, 0xE3, 0x05, 0x11, 0x80, 0x80, 0x43, 0xC5, 0xE2, 0x00, 0x50, 0x4D, 0x00, 0x40, 
+    0x56, 0x00, 0x20, 0xF5, 0x0E, 0x04, 0x66, 0x65, 0x50, 0x53, 0x00, 0x00, 0xA1, 0x02, 0x33, 0x30, 
+    0xF8, 0x00, 0x00, 0x00, 0xB5, 0x02, 0x22, 0x20, 0x44, 0xA5, 0x45, 0xF2, 0x00, 0x00, 0x40, 0xF2, 
+    0x01, 0xF4, 0x03, 0xC2, 0xF5, 0x11, 0xF2, 0x01, 0x00, 0xB0, 0xF2, 0x00, 0x03, 0x68, 0x11, 0xA3, 
+    0xB0, 0x01, 0x88, 0xA0, 0x02, 0x55, 0x50, 0xE2, 0x0C, 0x55, 0x52, 0x25, 0x52, 0x22, 0x44, 0x40, 
+    0xF2, 0x0C, 0xF4, 0x04, 0xD2, 0xF5, 0x0B, 0x13, 0x66, 0x56, 0x55, 0x56, 0x52, 0x22, 0xB0, 0x00, 
+    0x60, 0x00, 0x44, 0x05, 0x81, 0x18, 0x11, 0xF0, 0x02, 0x49, 0xF2, 0x02, 0x4C, 0xA4, 0xB2, 
+};
+
+const gfx_image_t GAME_STORY_LOGO_IMG = {
+    .w = GAME_STORY_LOGO_W, .h = GAME_STORY_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = GAME_STORY_LOGO_PAL, .colors = GAME_STORY_LOGO_PAL_SIZE,
+    .data = GAME_STORY_LOGO_RLE, .size = GAME_STORY_LOGO_RLE_SIZE,
 };
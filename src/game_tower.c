@@ -10,6 +10,7 @@
 #include <string.h>
 #include "timer.h"
 #include "gfx.h"
+#include "hud.h"
 #include "project.h"
 #include "game.h"
 #include "choice_input.h"
@@ -25,13 +26,17 @@
 #include "chest.h"
 #include "story_items.h"
 #include "cheevos.h"
+#include "round_acc.h"
+#include "pqueue.h"
 #include "enemy_icon.h"
 #include "equipment_icon.h"
+#include "scene.h"
+#include "lore_text.h"
 
 #define TOWER_FLEX_MENU_HZ 20.0f   // Hz needed to exit to menu after too many deaths
 #define TOWER_CHOICE_SPLIT_HZ 20.0f   // NEW: A/B split threshold in Hz
 #define TOWER_BAR_MAX_HZ 200.0f   // or 220/250 if highest floors are huge
-#define CHOICE_BAR_MAX_HZ 20.0f   // adjust based on what “normal” player Hz looks like
+#define CHOICE_BAR_MAX_HZ 80.0f   // full scale of the A/B choice bar
 
 typedef enum {
   TWS_LOGO = 0,
@@ -44,99 +49,19 @@ typedef enum {
   TWS_DEATH,
   TWS_NEXT,
   TWS_ENDING,
-  TWS_FLEX_RETURN
+  TWS_FLEX_RETURN,
+  TWS_SCENES
 } tower_state_t;
 
-// Tower lore text blocks
-
-static const char* g_tower_intro_lines[] = {
-  "You gaze at the sky-",
-  "high tower with anti",
-  "-cipation. Some say",
-  "it's filled with mys",
-  "-teries and unknown.",
-  "Other say it's unbea",
-  "-table. However, you",
-  "beg to differ. Takin",
-  "-g steps, you enter."
-};
-static const uint8_t g_tower_intro_count =
-    sizeof(g_tower_intro_lines)/sizeof(g_tower_intro_lines[0]);
-
-static const char* g_tower_end_lines[] = {
-  "The dragon lays dead",
-  "at your feet. You've",
-  "conquered the tower.",
-  "However you weren't",
-  "unscathed. Dragging",
-  "your feet, you reach",
-  "the edge and look do",
-  "-wn. With eyes close",
-  "you let yourself go."
-};
-static const uint8_t g_tower_end_count =
-    sizeof(g_tower_end_lines)/sizeof(g_tower_end_lines[0]);
-
-// Typewriter-style lore: slowly reveal text over time.
-// NOTE: does NOT clear the screen or draw header; caller does that once via g_dirty.
-static void tower_draw_lore_typewriter(const char* const* lines,
-                                 uint8_t count,
-                                 uint32_t dt,
-                                 uint16_t ms_per_char)
-{
-  uint32_t chars = dt / ms_per_char;  // total characters across all lines
-  uint8_t  y     = 24;                // first line Y
-
-  for (uint8_t i = 0; i < count; ++i) {
-    const char* s = lines[i];
-    if (!s) {
-      continue;
-    }
-
-    size_t len = strlen(s);
-    if (chars == 0u) {
-      break;  // nothing left to draw
-    }
-
-    uint32_t this_chars = chars;
-    if (this_chars > len) {
-      this_chars = len;
-    }
-
-    // Draw prefix of this line
-    char buf[32];  // adjust if you ever have >31-char lines
-    if (this_chars > sizeof(buf) - 1u) {
-      this_chars = sizeof(buf) - 1u;
-    }
-    memcpy(buf, s, this_chars);
-    buf[this_chars] = '\0';
-
-    // Draw only the visible prefix; earlier characters are redrawn in-place
-    gfx_text2(4, y, buf, COL_WHITE, 1);
-
-    y = (uint8_t)(y + 10u);
-    if (y > 120u) {
-      break;  // off-screen
-    }
-
-    // Consume characters for this line (+1 “newline” spacer)
-    if (chars > (uint32_t)len + 1u) {
-      chars -= (uint32_t)len + 1u;
-    } else {
-      chars = 0u;
-    }
-  }
-}
-
-static tower_state_t g_ts;
-static uint32_t      g_t0;
+static scene_run_t   g_run;
+static float         g_hz;           // P1's Hz this tick
 static uint8_t       g_floor;        // 0..24
-static float         g_sum_hz;
-static uint32_t      g_cnt_hz;
+static round_stats_t g_round;        // last battle's flex round
 static float         g_player_mult;  // cumulative item effects on player
 static uint8_t       g_last_choice_b; // 1 if last choice was B (enemy buff), else 0
 static float         g_last_you;
 static float         g_last_enemy;
+static gfx_scroll_t  g_lore_view;    // intro/ending lore page
 
 // Per-floor item state (shared item definitions)
 static story_item_t        g_tower_equipped;
@@ -145,167 +70,397 @@ static const story_item_t *g_tower_itemA;
 static const story_item_t *g_tower_itemB;
 static float               g_enemy_mult_floor;
 
-static bool          g_dirty;        // true = need to (re)draw this state's screen
+static hud_bar_t     g_hz_bar;       // choice / battle Hz bar with threshold marker
+static hud_countdown_t g_flex_left;  // "Flex... Ns left" in battle
 
 static uint8_t       g_tower_deaths = 0u;
 
-// Draw the Tower battle Hz bar at the bottom of the screen.
-// hz        = current player Hz
-// target_hz = enemy's target Hz for this floor
-static void tower_draw_hz_bar(float hz, float target_hz)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 112;     // bottom band
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 12;
+static void tower_maybe_unlock_floor_cheevo(uint8_t floor){
+  // floor is 0-based (0..24)
+  switch(floor){
+    case 4:   // just cleared floor 5
+      cheevos_unlock(ACH_TOWER_5);
+      break;
+    case 9:   // just cleared floor 10
+      cheevos_unlock(ACH_TOWER_10);
+      break;
+    case 14:  // just cleared floor 15
+      cheevos_unlock(ACH_TOWER_15);
+      break;
+    case 19:  // just cleared floor 20
+      cheevos_unlock(ACH_TOWER_20);
+      break;
+    case 23:  // just cleared floor 24
+      cheevos_unlock(ACH_TOWER_24);
+      break;
+    case 24:  // just cleared floor 25 (final boss)
+      cheevos_unlock(ACH_TOWER_CLEAR);
+      break;
+    default:
+      break;
+  }
+}
 
-  if (target_hz <= 0.0f) target_hz = 1.0f;
+/*------------------------------- scenes ------------------------------------*/
 
-  float max_hz = TOWER_BAR_MAX_HZ;
-  if (max_hz < 1.0f) max_hz = 1.0f;
+static void logo_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_defer_begin(GFX_PRIO_ART);
+  gfx_clear(COL_BLACK);
 
-  if (target_hz > max_hz) target_hz = max_hz;
+  uint8_t x = (uint8_t)((128 - GAME_TOWER_LOGO_W) / 2);
+  uint8_t y = (uint8_t)((128 - GAME_TOWER_LOGO_H) / 2);
 
-  // Clear band
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
+  gfx_blit_image(x, y, &GAME_TOWER_LOGO_IMG);
+  gfx_defer_end();
+}
 
-  // Current Hz bar (green)
-  uint8_t cur_w = (uint8_t)((hz / max_hz) * (float)bar_w + 0.5f);
-  if (cur_w > bar_w) cur_w = bar_w;
-  if (cur_w > 0u){
-    gfx_bar(bar_x, bar_y, cur_w, bar_h, COL_GREEN);
-  }
+static void intro_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("TOWER MODE", COL_WHITE);
+  gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);
+  gfx_scroll_begin_bpe(&g_lore_view, &LORE_TEXT[LORE_TOWER_INTRO], 24);
+}
 
-  // Threshold line (red)
-  uint8_t th_x = bar_x + (uint8_t)((target_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x < bar_x) th_x = bar_x;
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+static void lore_tick(const scene_ctx_t *c){
+  gfx_scroll_type(&g_lore_view, c->dt / 80u);
 }
 
-// Chest choice Hz bar (Tower): same visual as Story.
-static void tower_choice_bar_static(void)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 60;
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 8;
-
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
-
-  gfx_text2(bar_x,             bar_y - 10, "A", COL_CYAN,   1);
-  gfx_text2(bar_x + bar_w - 6, bar_y - 10, "B", COL_YELLOW, 1);
-
-  float max_hz = 80.0f;
-  float th_hz  = TOWER_CHOICE_SPLIT_HZ;
-  if (th_hz < 0.0f)     th_hz = 0.0f;
-  if (th_hz > max_hz)   th_hz = max_hz;
-  uint8_t th_x = bar_x + (uint8_t)((th_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+static void floor_intro_enter(const scene_ctx_t *c){
+  (void)c;
+  uint16_t foe = g_tower_enemy_hz[g_floor];
+
+  gfx_clear(COL_BLACK);
+
+//  uint8_t x = (uint8_t)(98);
+//  uint8_t y = (uint8_t)(0);
+
+//  gfx_blit_image(x, y, &ENEMY_ICON_IMG);
+
+  // Draw background for equipment and items, also green rectangle of current equiped item.
+  gfx_bar(0, 64, 128, 20, COL_DKGRAY);
+  gfx_bar(0, 82, 128, 64, COL_GRAY);
+  gfx_rect(1, 112, 127, 12, COL_GREEN);
+
+  gfx_header("FLOOR", COL_WHITE);
+
+  // Decide enemy type string based on floor range
+  const char *enemy = "Unknown";
+  if      (g_floor <= 4u)  enemy = "Minotaur";
+  else if (g_floor <= 9u)  enemy = "Werewolf";
+  else if (g_floor <= 14u) enemy = "Orc";
+  else if (g_floor <= 19u) enemy = "Black Knight";
+  else if (g_floor <= 23u) enemy = "Demon";
+  else                     enemy = "Dragon";
+
+  char line[40];
+
+  // Enemy type
+  snprintf(line, sizeof(line), "Enemy: %s", enemy);
+  gfx_text2(4, 40, line, COL_YELLOW, 1);
+
+  // Hz needed to defeat (per-floor target)
+  snprintf(line, sizeof(line), "Need: %u Hz", (unsigned)foe);
+  gfx_text2(4, 52, line, COL_WHITE, 1);
+
+  gfx_text2(30, 70, "Equipment:", COL_WHITE, 1);
+
+  gfx_text2(6, 84, "Prev:", COL_WHITE, 1);
+  gfx_text2(6, 94, g_tower_prev_equipped.name, COL_RED, 1);
+
+  gfx_text2(6, 104, "Now:",  COL_WHITE, 1);
+  gfx_text2(6, 114, g_tower_equipped.name,     COL_GREEN, 1);
 }
 
-static void draw_choice_bar(float hz, float need_hz)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 55;
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 10;
+static void choose_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_defer_begin(GFX_PRIO_ART);
+  gfx_clear(COL_BLACK);
+
+  // Chest center-screen
+  uint8_t cx = (uint8_t)((128 - CHEST_W) / 2);
+  uint8_t cy = (uint8_t)((128 - CHEST_H) / 2);
 
-  if (need_hz <= 0.0f) need_hz = 1.0f;
-  float max_hz = CHOICE_BAR_MAX_HZ;
-  if (max_hz < 1.0f) max_hz = 1.0f;
+  gfx_blit_image(cx, cy, &CHEST_IMG);
+  gfx_defer_begin(GFX_PRIO_HUD);
 
-  if (hz < 0.0f) hz = 0.0f;
-  if (hz > max_hz) hz = max_hz;
+  // Random two items out of STORY_ITEMS[]
+  uint8_t i0, i1;
+  story_items_pick_two(&i0, &i1);
+  g_tower_itemA = &STORY_ITEMS[i0];
+  g_tower_itemB = &STORY_ITEMS[i1];
+
+  gfx_header("CHOOSE", COL_WHITE);
+
+  char lineA[40];
+  char lineB[40];
+  snprintf(lineA, sizeof(lineA), "A) %s", g_tower_itemA->name);
+  snprintf(lineB, sizeof(lineB), "B) %s", g_tower_itemB->name);
+
+  gfx_text2(0, 110, lineA, COL_CYAN,   1);
+  gfx_text2(0, 120, lineB, COL_YELLOW, 1);
+  choice_draw_hint(80);
+
+  g_enemy_mult_floor = 1.0f;   // reset per floor
+
+  // A/B bar over chest, red marker at the split
+  gfx_text2(6,   47, "A", COL_WHITE, 1);
+  gfx_text2(116, 47, "B", COL_WHITE, 1);
+  gfx_defer_end();
+  hud_bar_init(&g_hz_bar, 4, 55, 120, 10, CHOICE_BAR_MAX_HZ, COL_GREEN, COL_DKGRAY);
+  hud_bar_mark(&g_hz_bar, TOWER_CHOICE_SPLIT_HZ, COL_RED);
+}
+
+static void choose_tick(const scene_ctx_t *c){
+  (void)c;
+  // live update of Hz bar
+  hud_bar_set(&g_hz_bar, g_hz);
+}
 
-  if (need_hz > max_hz) need_hz = max_hz;
+// The side the Hz is on when time runs out is the pick
+static uint8_t choose_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
+
+  choice_t ch = choice_from_hz(g_hz, TOWER_CHOICE_SPLIT_HZ);
+  const story_item_t *cur = (ch == CHOICE_A) ? g_tower_itemA : g_tower_itemB;
+  if (cur) {
+    g_tower_prev_equipped = g_tower_equipped;            // remember old
+    g_tower_equipped      = *cur;                        // set new
+    g_player_mult        *= g_tower_equipped.player_mult;  // stacks across floors
+    g_enemy_mult_floor   *= g_tower_equipped.enemy_mult;   // only this floor
+  }
+  return SCENE_NEXT;
+}
 
-  // Background
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
+static void battle_enter(const scene_ctx_t *c){
+  gfx_defer_begin(GFX_PRIO_ART);
+  gfx_clear(COL_BLACK);
+  gfx_defer_begin(GFX_PRIO_HUD);
+  gfx_header("BATTLE", COL_RED);
+  gfx_defer_begin(GFX_PRIO_ART);
+
+  // Select enemy sprite based on floor:
+  // 0-4: minotaur, 5-9: werewolf, 10-14: orc, 15-19: black knight,
+  // 20-24: demon, 25: dragon.
+  const gfx_image_t *eimg = NULL;
+
+  // Final floor: always Dragon
+  // (Assumes last floor index is TOWER_FLOORS-1)
+  bool final_floor = ((uint8_t)(g_floor + 1u) >= TOWER_FLOORS);
+
+  if (final_floor) {
+    eimg = &TOWER_DRAGON_IMG;
+  } else {
+    // Non-final floors: random among 5 enemies
+    uint32_t r = c->now;
+    r ^= (uint32_t)g_floor * 17u;     // cheap decorrelation
+    uint8_t pick = (uint8_t)(r % 5u); // 0..4
+
+    switch (pick) {
+      case 0: // Minotaur
+        eimg = &TOWER_MINOTAUR_IMG;
+        break;
+      case 1: // Werewolf
+        eimg = &TOWER_WEREWOLF_IMG;
+        break;
+      case 2: // Orc
+        eimg = &TOWER_ORC_IMG;
+        break;
+      case 3: // Black Knight
+        eimg = &TOWER_BLACK_KNIGHT_IMG;
+        break;
+      default: // 4: Demon
+        eimg = &TOWER_DEMON_IMG;
+        break;
+    }
+  }
 
-  // Current Hz (green)
-  uint8_t cur_w = (uint8_t)((hz / max_hz) * (float)bar_w + 0.5f);
-  if (cur_w > bar_w) cur_w = bar_w;
-  if (cur_w > 0u){
-    gfx_bar(bar_x, bar_y, cur_w, bar_h, COL_GREEN);
+  // Draw enemy centered, leaving bottom band for Hz bar & text
+  if (eimg){
+    uint8_t ex = (uint8_t)((128 - eimg->w) / 2);
+    uint8_t ey = 16;   // under header, above bottom bar
+    gfx_blit_image(ex, ey, eimg);
   }
 
-  // Threshold red line at need_hz
-  uint8_t th_x = bar_x + (uint8_t)((need_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x < bar_x) th_x = bar_x;
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+  // countdown band near bottom, Hz bar overlaid at the very bottom
+  gfx_defer_begin(GFX_PRIO_HUD);
+  gfx_bar(0, 96, 128, 12, COL_BLACK);
+  gfx_defer_end();
+  hud_countdown_init(&g_flex_left, 6, 96, 1, "Flex... ", 1, "s left",
+                     COL_WHITE, COL_BLACK, c->t0 + c->ms);
+  hud_bar_init(&g_hz_bar, 4, 112, 120, 12, TOWER_BAR_MAX_HZ, COL_GREEN, COL_DKGRAY);
+  round_acc_begin(0u, pqueue_seat(0), c->t0, c->ms, ROUND_ACTIVE_HZ);
+}
+
+static void battle_tick(const scene_ctx_t *c){
+  hud_countdown_tick(&g_flex_left, c->now);
+
+  // red line = this floor's effective enemy Hz
+  float foe_target = (float)g_tower_enemy_hz[g_floor] * g_enemy_mult_floor;
+  hud_bar_set(&g_hz_bar, g_hz);
+  hud_bar_mark(&g_hz_bar, foe_target, COL_RED);
+}
 
-  // Labels A / B (if this bar is for item choice)
-  gfx_text2(bar_x + 2,           bar_y - 8, "A", COL_WHITE, 1);
-  gfx_text2(bar_x + bar_w - 8u,  bar_y - 8, "B", COL_WHITE, 1);
+static uint8_t battle_exit(const scene_ctx_t *c){
+  return (c->done && round_acc_done(0u, c->now, &g_round)) ? SCENE_NEXT : SCENE_STAY;
 }
 
-static void tower_choice_bar_update(float hz)
-{
-  const uint8_t bar_x = 4;
-  const uint8_t bar_y = 55;
-  const uint8_t bar_w = 120;
-  const uint8_t bar_h = 10;
+static void result_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK); 
 
-  float max_hz = 80.0f;
-  if (hz < 0.0f)     hz = 0.0f;
-  if (hz > max_hz)   hz = max_hz;
+  // seperator for VICTOR and defeat
+  gfx_rect(0, 67, 187, 1, COL_GRAY);
 
-  gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
+  uint16_t foe0 = g_tower_enemy_hz[g_floor];
+  g_last_enemy  = (float)foe0 * g_enemy_mult_floor;
 
-  uint8_t cur_w = (uint8_t)((hz / max_hz) * (float)bar_w + 0.5f);
-  if (cur_w > bar_w) cur_w = bar_w;
-  if (cur_w > 0u){
-    gfx_bar(bar_x, bar_y, cur_w, bar_h, COL_GREEN);
+  float avg     = g_round.active_hz;
+  g_last_you    = avg * g_player_mult;
+
+  gfx_header("RESULT", COL_WHITE);
+  char l1[40]; snprintf(l1, sizeof(l1), "You: %.1f Hz", g_last_you);
+  char l2[40]; snprintf(l2, sizeof(l2), "Enemy: %.1f Hz", g_last_enemy);
+  gfx_text2(6, 36, l1, COL_CYAN,   1);
+  gfx_text2(6, 50, l2, COL_YELLOW, 1);
+  gfx_text2(6, 76,
+            (g_last_you >= g_last_enemy) ? "VICTORY" : "DEFEAT",
+            (g_last_you >= g_last_enemy) ? COL_GREEN : COL_RED,
+            3);
+}
+
+static uint8_t result_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
+  return (g_last_you >= g_last_enemy) ? TWS_REWARD     // floor cleared
+                                      : TWS_DEATH;     // floor failed
+}
+
+static void reward_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+
+//  uint8_t x = (uint8_t)(98);
+//  uint8_t y = (uint8_t)(0);
+
+//  gfx_blit_image(x, y, &EQUIPMENT_ICON_IMG);
+
+  // Draw background for equipment and items, also green rectangle of current equiped item.
+  gfx_bar(0, 58, 128, 32, COL_DKGRAY);
+  gfx_bar(0, 90, 128, 64, COL_GRAY);
+  gfx_rect(1, 104, 127, 12, COL_GREEN);
+  
+  gfx_header("REWARD", COL_WHITE);
+
+  gfx_text2(35, 40, "Equipped:", COL_WHITE, 1);
+
+  gfx_text2(6, 62, "Prev:", COL_WHITE, 1);
+  gfx_text2(6, 474, g_tower_prev_equipped.name, COL_RED, 1);
+
+  gfx_text2(6, 94, "Now:",  COL_WHITE, 1);
+  gfx_text2(6, 106, g_tower_equipped.name,     COL_GREEN, 1);
+}
+
+static void death_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_defer_begin(GFX_PRIO_ART);
+  gfx_clear(COL_BLACK);
+
+  // Center the YOU_DIED image
+  uint8_t x = (uint8_t)((128 - YOU_DIED_W) / 2);
+  uint8_t y = (uint8_t)((128 - YOU_DIED_H) / 2);
+
+  gfx_blit_image(x, y, &YOU_DIED_IMG);
+  gfx_defer_begin(GFX_PRIO_HUD);
+
+  if (g_tower_deaths + 1u < 1u) {
+    gfx_text2(30, 110, "Retrying...", COL_RED, 1);
+  } else {
+    gfx_text2(4, 110, "Too many deaths...", COL_RED, 1);
   }
+  gfx_defer_end();
+}
+
+static uint8_t death_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
 
-  float th_hz = TOWER_CHOICE_SPLIT_HZ;
-  if (th_hz < 0.0f)     th_hz = 0.0f;
-  if (th_hz > max_hz)   th_hz = max_hz;
-  uint8_t th_x = bar_x + (uint8_t)((th_hz / max_hz) * (float)bar_w + 0.5f);
-  if (th_x >= (uint8_t)(bar_x + bar_w)) th_x = (uint8_t)(bar_x + bar_w - 1u);
-  gfx_bar(th_x, bar_y, 1, bar_h, COL_RED);
+  // Count this death; too many go to flex-to-menu instead of a retry
+  g_tower_deaths++;
+  return (g_tower_deaths >= 3u) ? TWS_FLEX_RETURN : TWS_FLOOR_INTRO;
 }
 
-static void tower_maybe_unlock_floor_cheevo(uint8_t floor){
-  // floor is 0-based (0..24)
-  switch(floor){
-    case 4:   // just cleared floor 5
-      cheevos_unlock(ACH_TOWER_5);
-      break;
-    case 9:   // just cleared floor 10
-      cheevos_unlock(ACH_TOWER_10);
-      break;
-    case 14:  // just cleared floor 15
-      cheevos_unlock(ACH_TOWER_15);
-      break;
-    case 19:  // just cleared floor 20
-      cheevos_unlock(ACH_TOWER_20);
-      break;
-    case 23:  // just cleared floor 24
-      cheevos_unlock(ACH_TOWER_24);
-      break;
-    case 24:  // just cleared floor 25 (final boss)
-      cheevos_unlock(ACH_TOWER_CLEAR);
-      break;
-    default:
-      break;
+static void flex_return_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("GO BACK", COL_WHITE);
+  gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+
+  gfx_text2(4, 36, "You have fallen...", COL_RED,   1);
+  gfx_text2(4, 48, "in the Tower.",            COL_RED,   1);
+  gfx_text2(4, 60, "Flex to return...",   COL_WHITE, 1);
+  gfx_text2(4, 72, "you're weak.",           COL_WHITE, 1);
+
+  // X UI
+  gfx_xshape(110, 1, 15, 15, COL_RED);           // danger indicator
+  gfx_rect(109, 0, 17, 17, COL_RED);
+
+  char line[40];
+  snprintf(line, sizeof(line),
+           "Need: %.1f Hz", TOWER_FLEX_MENU_HZ);
+  gfx_text2(4, 92, line, COL_CYAN, 1);
+}
+
+// Strong flex -> back to main menu; otherwise retry the floor
+static uint8_t flex_return_exit(const scene_ctx_t *c){
+  if (g_hz >= TOWER_FLEX_MENU_HZ) {
+    g_tower_deaths = 0u;   // optional reset
+    return SCENE_END;
+  }
+  return c->done ? SCENE_NEXT : SCENE_STAY;
+}
+
+static uint8_t next_exit(const scene_ctx_t *c){
+  (void)c;
+  tower_maybe_unlock_floor_cheevo(g_floor);
+  uint8_t next = (uint8_t)(g_floor + 1u);
+  if (next >= TOWER_FLOORS){
+    return TWS_ENDING;
   }
+  g_floor = next;
+  return TWS_FLOOR_INTRO;
 }
 
-static void t_goto(tower_state_t ns){
-  g_ts   = ns;
-  g_t0   = millis();
-  g_dirty = true;
+static void ending_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+
+  gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);        
+
+  gfx_header("TOWER CLEARED!", COL_WHITE);
+  gfx_scroll_begin_bpe(&g_lore_view, &LORE_TEXT[LORE_TOWER_END], 24);
 }
 
+// TWS_NEXT only dispatches; every other scene repaints the whole screen,
+// so the old one fades out first and the scene timer starts when it is dark.
+static const scene_t k_scenes[TWS_SCENES] = {
+  //                     ms     next             flags       enter              tick         exit
+  [TWS_LOGO]        = { 5000u, TWS_INTRO,       SCENE_FADE, logo_enter,        NULL,        NULL             },
+  [TWS_INTRO]       = { 8000u, TWS_FLOOR_INTRO, SCENE_FADE, intro_enter,       lore_tick,   NULL             },
+  [TWS_FLOOR_INTRO] = { 7000u, TWS_CHOOSE,      SCENE_FADE, floor_intro_enter, NULL,        NULL             },
+  [TWS_CHOOSE]      = { 5000u, TWS_BATTLE,      SCENE_FADE, choose_enter,      choose_tick, choose_exit      },
+  [TWS_BATTLE]      = { 5000u, TWS_RESULT,      SCENE_FADE, battle_enter,      battle_tick, battle_exit      },
+  [TWS_RESULT]      = { 5000u, TWS_REWARD,      SCENE_FADE, result_enter,      NULL,        result_exit      },
+  [TWS_REWARD]      = { 5000u, TWS_NEXT,        SCENE_FADE, reward_enter,      NULL,        NULL             },
+  [TWS_DEATH]       = { 3000u, TWS_FLOOR_INTRO, SCENE_FADE, death_enter,       NULL,        death_exit       },
+  [TWS_NEXT]        = {    0u, TWS_FLOOR_INTRO, 0,          NULL,              NULL,        next_exit        },
+  [TWS_ENDING]      = { 8000u, SCENE_END,       SCENE_FADE, ending_enter,      lore_tick,   NULL             },
+  [TWS_FLEX_RETURN] = { 5000u, TWS_FLOOR_INTRO, SCENE_FADE, flex_return_enter, NULL,        flex_return_exit },
+};
+
 void game_tower_init(void){
   g_floor         = 0u;
   g_player_mult   = 1.0f;
-  g_sum_hz        = 0.0f;
-  g_cnt_hz        = 0u;
+  g_round         = (round_stats_t){0};
   g_last_choice_b = 0u;        // no longer critical, but fine to leave
   g_enemy_mult_floor = 1.0f;
   g_tower_itemA   = &STORY_ITEMS[0];
@@ -314,440 +469,11 @@ void game_tower_init(void){
   g_tower_prev_equipped = STORY_ITEMS[0];
   g_tower_deaths  = 0u;
   cheevos_unlock(ACH_TOWER_START);
-  t_goto(TWS_LOGO);
+  scene_start(&g_run, k_scenes, TWS_SCENES, TWS_LOGO, millis());
 }
 
 bool game_tower_tick(void){
-  uint32_t dt = millis() - g_t0;
-
-  float   hz   = 0.0f;
-  float   base = 0.0f;
-  uint8_t pct  = 0;
-  game_get_metrics(&hz, &pct, &base);
-  (void)base;
-  (void)pct;
-
-  switch(g_ts){
-
-    case TWS_LOGO: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        uint8_t x = (uint8_t)((128 - GAME_TOWER_LOGO_W) / 2);
-        uint8_t y = (uint8_t)((128 - GAME_TOWER_LOGO_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      GAME_TOWER_LOGO_W, GAME_TOWER_LOGO_H,
-                      GAME_TOWER_LOGO_IDX,
-                      GAME_TOWER_LOGO_PAL);
-      }
-      if (dt >= 5000u){
-        t_goto(TWS_INTRO);
-      }
-    } break;
-
-    case TWS_INTRO: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("TOWER MODE", COL_WHITE);
-        gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);
-      }
-
-      tower_draw_lore_typewriter(g_tower_intro_lines,
-                                g_tower_intro_count,
-                                dt,
-                                80u);
-
-      if (dt >= 8000u){
-        t_goto(TWS_FLOOR_INTRO);
-      }
-    } break;
-
-    case TWS_FLOOR_INTRO: {
-      if (g_dirty){
-        g_dirty = false;
-        uint16_t foe = g_tower_enemy_hz[g_floor];
-
-        gfx_clear(COL_BLACK);
-
-//        uint8_t x = (uint8_t)(98);
-//        uint8_t y = (uint8_t)(0);
-
-//        gfx_blit_pal4(x, y,
-//                      ENEMY_ICON_W, ENEMY_ICON_H,
-//                      ENEMY_ICON_IDX,
-//                      ENEMY_ICON_PAL);
-
-        // Draw background for equipment and items, also green rectangle of current equiped item.
-        gfx_bar(0, 64, 128, 20, COL_DKGRAY);
-        gfx_bar(0, 82, 128, 64, COL_GRAY);
-        gfx_rect(1, 112, 127, 12, COL_GREEN);
-
-        gfx_header("FLOOR", COL_WHITE);
-
-        // Decide enemy type string based on floor range
-        const char *enemy = "Unknown";
-        if      (g_floor <= 4u)  enemy = "Minotaur";
-        else if (g_floor <= 9u)  enemy = "Werewolf";
-        else if (g_floor <= 14u) enemy = "Orc";
-        else if (g_floor <= 19u) enemy = "Black Knight";
-        else if (g_floor <= 23u) enemy = "Demon";
-        else                     enemy = "Dragon";
-
-        char line[40];
-
-        // Enemy type
-        snprintf(line, sizeof(line), "Enemy: %s", enemy);
-        gfx_text2(4, 40, line, COL_YELLOW, 1);
-
-        // Hz needed to defeat (per-floor target)
-        snprintf(line, sizeof(line), "Need: %u Hz", (unsigned)foe);
-        gfx_text2(4, 52, line, COL_WHITE, 1);
-
-        gfx_text2(30, 70, "Equipment:", COL_WHITE, 1);
-
-        gfx_text2(6, 84, "Prev:", COL_WHITE, 1);
-        gfx_text2(6, 94, g_tower_prev_equipped.name, COL_RED, 1);
-
-        gfx_text2(6, 104, "Now:",  COL_WHITE, 1);
-        gfx_text2(6, 114, g_tower_equipped.name,     COL_GREEN, 1);
-      }
-
-      // After a short delay, move on to the chest (item choice) screen
-      if (dt >= 7000u){
-        t_goto(TWS_CHOOSE);
-      }
-    } break;
-
-    case TWS_CHOOSE: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        // Chest center-screen
-        uint8_t cx = (uint8_t)((128 - CHEST_W) / 2);
-        uint8_t cy = (uint8_t)((128 - CHEST_H) / 2);
-
-        gfx_blit_pal4(cx, cy,
-                      CHEST_W, CHEST_H,
-                      CHEST_IDX,
-                      CHEST_PAL);
-
-        // Random two items out of STORY_ITEMS[]
-        uint8_t i0, i1;
-        story_items_pick_two(&i0, &i1);
-        g_tower_itemA = &STORY_ITEMS[i0];
-        g_tower_itemB = &STORY_ITEMS[i1];
-
-        gfx_header("CHOOSE", COL_WHITE);
-
-        char lineA[40];
-        char lineB[40];
-        snprintf(lineA, sizeof(lineA), "A) %s", g_tower_itemA->name);
-        snprintf(lineB, sizeof(lineB), "B) %s", g_tower_itemB->name);
-
-        gfx_text2(0, 110, lineA, COL_CYAN,   1);
-        gfx_text2(0, 120, lineB, COL_YELLOW, 1);
-        choice_draw_hint(80);
-
-        g_enemy_mult_floor = 1.0f;   // reset per floor
-
-        // static A/B bar over chest
-        //tower_choice_bar_static();
-        draw_choice_bar(hz, TOWER_CHOICE_SPLIT_HZ);
-      }
-
-      // live update of Hz bar
-      tower_choice_bar_update(hz);
-
-      choice_t ch = choice_from_hz(hz, TOWER_CHOICE_SPLIT_HZ);
-      const story_item_t *cur = (ch == CHOICE_A) ? g_tower_itemA : g_tower_itemB;
-
-      if (dt >= 5000u){
-        if (cur) {
-          g_tower_prev_equipped = g_tower_equipped;            // remember old
-          g_tower_equipped      = *cur;                        // set new
-          g_player_mult        *= g_tower_equipped.player_mult;  // stacks across floors
-          g_enemy_mult_floor   *= g_tower_equipped.enemy_mult;   // only this floor
-        }
-        g_sum_hz = 0.0f;
-        g_cnt_hz = 0u;
-        t_goto(TWS_BATTLE);
-      }
-    } break;
-
-    case TWS_BATTLE: {
-      const uint32_t FLEX_MS = 5000u;
-
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("BATTLE", COL_RED);
-
-        // Select enemy sprite based on floor:
-        // 0-4: minotaur, 5-9: werewolf, 10-14: orc, 15-19: black knight,
-        // 20-24: demon, 25: dragon.
-        uint8_t ew = 0, eh = 0;
-        const uint8_t  *eidx = NULL;
-        const uint16_t *epal = NULL;
-
-        // Final floor: always Dragon
-        // (Assumes last floor index is TOWER_FLOORS-1)
-        bool final_floor = ((uint8_t)(g_floor + 1u) >= TOWER_FLOORS);
-
-        if (final_floor) {
-          ew   = TOWER_DRAGON_W;
-          eh   = TOWER_DRAGON_H;
-          eidx = TOWER_DRAGON_IDX;
-          epal = TOWER_DRAGON_PAL;
-        } else {
-          // Non-final floors: random among 5 enemies
-          uint32_t r = millis();
-          r ^= (uint32_t)g_floor * 17u;     // cheap decorrelation
-          uint8_t pick = (uint8_t)(r % 5u); // 0..4
-
-          switch (pick) {
-            case 0: // Minotaur
-              ew   = TOWER_MINOTAUR_W;
-              eh   = TOWER_MINOTAUR_H;
-              eidx = TOWER_MINOTAUR_IDX;
-              epal = TOWER_MINOTAUR_PAL;
-              break;
-            case 1: // Werewolf
-              ew   = TOWER_WEREWOLF_W;
-              eh   = TOWER_WEREWOLF_H;
-              eidx = TOWER_WEREWOLF_IDX;
-              epal = TOWER_WEREWOLF_PAL;
-              break;
-            case 2: // Orc
-              ew   = TOWER_ORC_W;
-              eh   = TOWER_ORC_H;
-              eidx = TOWER_ORC_IDX;
-              epal = TOWER_ORC_PAL;
-              break;
-            case 3: // Black Knight
-              ew   = TOWER_BLACK_KNIGHT_W;
-              eh   = TOWER_BLACK_KNIGHT_H;
-              eidx = TOWER_BLACK_KNIGHT_IDX;
-              epal = TOWER_BLACK_KNIGHT_PAL;
-              break;
-            default: // 4: Demon
-              ew   = TOWER_DEMON_W;
-              eh   = TOWER_DEMON_H;
-              eidx = TOWER_DEMON_IDX;
-              epal = TOWER_DEMON_PAL;
-              break;
-          }
-        }
-
-        // Draw enemy centered, leaving bottom band for Hz bar & text
-        if (eidx && epal){
-          uint8_t ex = (uint8_t)((128 - ew) / 2);
-          uint8_t ey = 16;   // under header, above bottom bar
-          gfx_blit_pal4(ex, ey,
-                        ew, eh,
-                        eidx,
-                        epal);
-        }
-      }
-
-      if (dt >= FLEX_MS){
-        t_goto(TWS_RESULT);
-        break;
-      }
-
-      // countdown text near bottom, but above Hz bar
-      uint8_t remain_s = (uint8_t)((FLEX_MS - dt) / 1000u);
-      char line[32];
-      snprintf(line, sizeof(line), "Flex... %us left", (unsigned)remain_s);
-      gfx_bar(0, 96, 128, 12, COL_BLACK);
-      gfx_text2(6, 96, line, COL_WHITE, 1);
-
-      // Live Hz bar overlaid at the very bottom
-      {
-        float foe_target = (float)g_tower_enemy_hz[g_floor] * g_enemy_mult_floor;
-        tower_draw_hz_bar(hz, foe_target);
-      }
-
-      if (hz >= 1.5f){
-        g_sum_hz += hz;
-        g_cnt_hz++;
-      }
-    } break;
-
-    case TWS_RESULT: {
-      if (g_dirty) {
-        g_dirty = false;
-        gfx_clear(COL_BLACK); 
-
-        // seperator for VICTOR and defeat
-        gfx_rect(0, 67, 187, 1, COL_GRAY);
-
-        uint16_t foe0 = g_tower_enemy_hz[g_floor];
-        g_last_enemy  = (float)foe0 * g_enemy_mult_floor;
-
-        float avg     = (g_cnt_hz ? (g_sum_hz / (float)g_cnt_hz) : 0.0f);
-        g_last_you    = avg * g_player_mult;
-
-        gfx_header("RESULT", COL_WHITE);
-        char l1[40]; snprintf(l1, sizeof(l1), "You: %.1f Hz", g_last_you);
-        char l2[40]; snprintf(l2, sizeof(l2), "Enemy: %.1f Hz", g_last_enemy);
-        gfx_text2(6, 36, l1, COL_CYAN,   1);
-        gfx_text2(6, 50, l2, COL_YELLOW, 1);
-        gfx_text2(6, 76,
-                  (g_last_you >= g_last_enemy) ? "VICTORY" : "DEFEAT",
-                  (g_last_you >= g_last_enemy) ? COL_GREEN : COL_RED,
-                  3);
-      }
-
-      if (dt >= 5000u) {
-        if (g_last_you >= g_last_enemy) {
-          t_goto(TWS_REWARD);  // floor cleared
-        } else {
-          t_goto(TWS_DEATH);   // floor failed
-        }
-      }
-    } break;
-
-    case TWS_REWARD: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-//        uint8_t x = (uint8_t)(98);
-//        uint8_t y = (uint8_t)(0);
-
-//        gfx_blit_pal4(x, y,
-//                      EQUIPMENT_ICON_W, EQUIPMENT_ICON_H,
-//                      EQUIPMENT_ICON_IDX,
-//                      EQUIPMENT_ICON_PAL);
-
-        // Draw background for equipment and items, also green rectangle of current equiped item.
-        gfx_bar(0, 58, 128, 32, COL_DKGRAY);
-        gfx_bar(0, 90, 128, 64, COL_GRAY);
-        gfx_rect(1, 104, 127, 12, COL_GREEN);
-        
-        gfx_header("REWARD", COL_WHITE);
-
-        gfx_text2(35, 40, "Equipped:", COL_WHITE, 1);
-
-        gfx_text2(6, 62, "Prev:", COL_WHITE, 1);
-        gfx_text2(6, 474, g_tower_prev_equipped.name, COL_RED, 1);
-
-        gfx_text2(6, 94, "Now:",  COL_WHITE, 1);
-        gfx_text2(6, 106, g_tower_equipped.name,     COL_GREEN, 1);
-      }
-      if (dt >= 5000u){
-        t_goto(TWS_NEXT);
-      }
-    } break;
-
-    case TWS_DEATH: {
-      if (g_dirty) {
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        // Center the YOU_DIED image
-        uint8_t x = (uint8_t)((128 - YOU_DIED_W) / 2);
-        uint8_t y = (uint8_t)((128 - YOU_DIED_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      YOU_DIED_W, YOU_DIED_H,
-                      YOU_DIED_IDX,
-                      YOU_DIED_PAL);
-
-        if (g_tower_deaths + 1u < 1u) {
-          gfx_text2(30, 110, "Retrying...", COL_RED, 1);
-        } else {
-          gfx_text2(4, 110, "Too many deaths...", COL_RED, 1);
-        }
-      }
-
-      if (dt >= 3000u) {
-        // Count this death
-        g_tower_deaths++;
-
-        // Reset counters and retry logic
-        g_sum_hz = 0.0f;
-        g_cnt_hz = 0u;
-
-        if (g_tower_deaths >= 3u) {
-          // go to flex-to-menu instead of floor intro
-          t_goto(TWS_FLEX_RETURN);
-        } else {
-          t_goto(TWS_FLOOR_INTRO);
-        }
-      }
-    } break;
-
-    case TWS_FLEX_RETURN: {
-      if (g_dirty) {
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("GO BACK", COL_WHITE);
-        gfx_bar(0, 18, 128, 1, COL_DKGRAY);
-
-        gfx_text2(4, 36, "You have fallen...", COL_RED,   1);
-        gfx_text2(4, 48, "in the Tower.",            COL_RED,   1);
-        gfx_text2(4, 60, "Flex to return...",   COL_WHITE, 1);
-        gfx_text2(4, 72, "you're weak.",           COL_WHITE, 1);
-
-        // X UI
-        gfx_xshape(110, 1, 15, 15, COL_RED);           // danger indicator
-        gfx_rect(109, 0, 17, 17, COL_RED);
-
-        char line[40];
-        snprintf(line, sizeof(line),
-                 "Need: %.1f Hz", TOWER_FLEX_MENU_HZ);
-        gfx_text2(4, 92, line, COL_CYAN, 1);
-        }
-        // strong flex -> back to main menu
-        if (hz >= TOWER_FLEX_MENU_HZ) {
-            g_tower_deaths = 0u;   // optional reset
-            return true;           // tell is done -> menu
-        }
-
-        // wait 5 seconds -> retry same chapter
-        if (dt >= 5000u) {
-            g_sum_hz = 0.0f;
-            g_cnt_hz = 0u;
-            t_goto(TWS_FLOOR_INTRO);     // restart chapter intro
-        }
-
-    } break;
-
-    case TWS_NEXT: {
-      tower_maybe_unlock_floor_cheevo(g_floor);
-      uint8_t next = (uint8_t)(g_floor + 1u);
-      if (next >= TOWER_FLOORS){
-        t_goto(TWS_ENDING);
-      } else {
-        g_floor = next;
-        t_goto(TWS_FLOOR_INTRO);
-      }
-    } break;
-
-    case TWS_ENDING: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-
-        gfx_triangle(127, 122,  122, 127,  122, 117, COL_WHITE);        
-
-        gfx_header("TOWER CLEARED!", COL_WHITE);
-      }
-
-      tower_draw_lore_typewriter(g_tower_end_lines,
-                                g_tower_end_count,
-                                dt,
-                                80u);
-
-      if (dt >= 8000u){
-        return true;
-      }
-    } break;
-  }
-  return false;       // not finished yet
+  game_get_metrics(&g_hz, NULL, NULL);
+
+  return scene_tick(&g_run, millis());       // true once finished
 }
@@ -6,313 +6,120 @@ const uint16_t GAME_TOWER_LOGO_PAL[GAME_TOWER_LOGO_PAL_SIZE] = {
     0x1A53, 0x09F2, 0xA165, 0xA1CB, 0xD1A9, 0xC5D1, 0x5A71, 0x69CD, 
 };
 
-const uint8_t GAME_TOWER_LOGO_IDX[(GAME_TOWER_LOGO_W * GAME_TOWER_LOGO_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x34, 0x11, 0x13, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x33, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x04, 0x10, 0x03, 0x11, 0x11, 0x34, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x04, 0x30, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x00, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0xAA, 0xA4, 0x00, 0xAA, 
-    0xA0, 0x04, 0xAA, 0xA0, 0x00, 0x4A, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x22, 0x22, 0x22, 0x22, 0x2F, 0x0A, 0x22, 0x22, 0x22, 0x24, 0x00, 0x22, 0x2F, 0x64, 0x22, 
-    0x26, 0x04, 0x22, 0xC6, 0x04, 0x22, 0x22, 0x22, 0x29, 0x02, 0x22, 0x22, 0x22, 0x2A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0A, 0x22, 0x22, 0x22, 0x22, 0x20, 0x62, 0x22, 0x22, 0x22, 0x2B, 0x60, 0x22, 0x20, 0x90, 0x22, 
-    0x28, 0x64, 0x22, 0xC8, 0x62, 0x22, 0x22, 0x22, 0x28, 0x62, 0x22, 0x22, 0x22, 0x2C, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0xFF, 0xB2, 0x22, 0xFF, 0xF8, 0x62, 0x22, 0xF0, 0xB2, 0x2C, 0x90, 0x22, 0x20, 0x90, 0x22, 
-    0x29, 0x64, 0x22, 0xC9, 0x62, 0x22, 0xB0, 0xFF, 0x08, 0x62, 0x22, 0xB0, 0xB2, 0x22, 0x96, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x06, 0x62, 0x22, 0x96, 0x66, 0x62, 0x22, 0x89, 0xF2, 0x2C, 0x96, 0x22, 0x20, 0x90, 0x22, 
-    0x29, 0x64, 0x22, 0xC9, 0x62, 0x22, 0xF9, 0x66, 0x66, 0x62, 0x22, 0xE9, 0xF2, 0x22, 0x96, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x00, 0x02, 0x22, 0x86, 0x42, 0x2C, 0x96, 0x22, 0x20, 0x90, 0x22, 
-    0x29, 0x64, 0x22, 0xC9, 0x62, 0x22, 0xF9, 0x00, 0x00, 0x02, 0x22, 0xE6, 0x42, 0x22, 0x96, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x00, 0x02, 0x22, 0x86, 0x42, 0x2C, 0x96, 0x22, 0x20, 0x90, 0x22, 
-    0x29, 0x64, 0x22, 0xC9, 0x62, 0x22, 0xF9, 0x00, 0x40, 0x02, 0x22, 0xE9, 0x42, 0x22, 0x96, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x43, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x00, 0x42, 0x22, 0x86, 0x42, 0x2C, 0x96, 0x22, 0x20, 0x90, 0x22, 
-    0x29, 0x64, 0x22, 0xC9, 0x62, 0x22, 0xF9, 0x4A, 0x26, 0x02, 0x22, 0xE9, 0x42, 0x22, 0x86, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x43, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x00, 0x42, 0x22, 0x86, 0xA2, 0x2C, 0x96, 0x22, 0x20, 0x90, 0x22, 
-    0x28, 0x64, 0x22, 0xC9, 0x62, 0x22, 0xBB, 0x22, 0x28, 0x62, 0x22, 0xE9, 0xA2, 0x22, 0x86, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x44, 0x31, 0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x00, 0x42, 0x22, 0x88, 0xA2, 0x2C, 0x96, 0x22, 0x20, 0x90, 0x22, 
-    0x28, 0x64, 0x22, 0xC9, 0x62, 0x22, 0x22, 0x22, 0x28, 0x62, 0x22, 0xBC, 0x22, 0x22, 0x86, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x11, 0x11, 0x50, 0x65, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x06, 0xF2, 0x22, 0x88, 0xA2, 0x2C, 0x86, 0x22, 0x20, 0x90, 0x22, 
-    0x28, 0x64, 0x22, 0xC9, 0x62, 0x22, 0x22, 0x2C, 0xE8, 0x62, 0x22, 0x22, 0x22, 0x2B, 0x86, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x43, 0x11, 0x11, 0x11, 0x15, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x96, 0x55, 0x12, 0x22, 0x88, 0xA2, 0x2C, 0x86, 0x22, 0x20, 0x90, 0x22, 
-    0x28, 0x64, 0x22, 0xC9, 0x62, 0x22, 0x22, 0xE8, 0x86, 0x62, 0x22, 0x22, 0x22, 0x08, 0x86, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x04, 0x43, 0x11, 0x33, 0x11, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x95, 0x55, 0x12, 0x22, 0x88, 0xB2, 0x2C, 0x86, 0x22, 0x2E, 0x96, 0x22, 
-    0x28, 0x64, 0x22, 0xC8, 0x62, 0x22, 0xB8, 0x86, 0x66, 0x02, 0x22, 0x22, 0x22, 0xE6, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x34, 0x41, 0x11, 0x31, 0x11, 0x56, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x95, 0x88, 0x12, 0x22, 0x88, 0xB2, 0x2C, 0x86, 0x22, 0x2E, 0x86, 0x22, 
-    0x28, 0x64, 0x22, 0xC8, 0x62, 0x22, 0x09, 0x60, 0x00, 0x02, 0x22, 0xFB, 0x22, 0xC9, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x34, 0x11, 0x13, 0x11, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x95, 0x80, 0xE2, 0x22, 0x88, 0xB2, 0x2C, 0x86, 0x22, 0x2E, 0x81, 0x22, 
-    0x28, 0x64, 0x22, 0xC8, 0x62, 0x22, 0xF9, 0x00, 0x00, 0x02, 0x22, 0x8F, 0x22, 0x28, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x43, 0x11, 0x13, 0x31, 0x55, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x95, 0x00, 0xE2, 0x22, 0x88, 0xB2, 0x2C, 0x86, 0x22, 0x2E, 0x81, 0x22, 
-    0x28, 0x64, 0x22, 0xC8, 0x62, 0x22, 0xF9, 0x00, 0x00, 0x02, 0x22, 0xE9, 0x22, 0x2B, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x11, 0x11, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x85, 0x80, 0xE2, 0x22, 0x88, 0x42, 0x2C, 0x86, 0x22, 0x2E, 0x85, 0x22, 
-    0x28, 0x64, 0x22, 0xC8, 0x62, 0x22, 0x09, 0x00, 0x00, 0x02, 0x22, 0xE9, 0xA2, 0x22, 0x90, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x22, 0x86, 0x58, 0x12, 0x22, 0x0F, 0xA2, 0x2C, 0x86, 0x22, 0x2B, 0xFA, 0x22, 
-    0x2B, 0xFA, 0x22, 0xC8, 0x62, 0x22, 0xBF, 0xAA, 0x40, 0x02, 0x22, 0xE8, 0x02, 0x22, 0xB6, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 
-    0x60, 0x00, 0x42, 0x22, 0x86, 0x58, 0x12, 0x22, 0x22, 0x22, 0x2C, 0x86, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0xC8, 0x62, 0x22, 0x22, 0x22, 0x26, 0x02, 0x22, 0xE8, 0x0A, 0x22, 0xC9, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x50, 0x00, 0x42, 0x22, 0x96, 0x55, 0x50, 0x22, 0x22, 0x22, 0x2E, 0x85, 0x42, 0x22, 0x22, 0x2B, 
-    0x22, 0x22, 0x22, 0xE8, 0x62, 0x22, 0x22, 0x22, 0x28, 0x62, 0x22, 0xE8, 0x04, 0x22, 0x2F, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x56, 0x00, 0x0A, 0xBB, 0x86, 0x55, 0x55, 0x0B, 0xBB, 0xBB, 0xE8, 0x85, 0x51, 0xBB, 0xBB, 0xE8, 
-    0xFB, 0xBB, 0xBE, 0x86, 0x6A, 0xBB, 0xBB, 0xBB, 0xB8, 0x6A, 0xBB, 0x89, 0x00, 0xAB, 0xBB, 0x90, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x66, 0x00, 0x00, 0x69, 0x66, 0x55, 0x55, 0x55, 0x88, 0x88, 0x85, 0x56, 0x66, 0x69, 0x98, 0x96, 
-    0x60, 0x69, 0x99, 0x66, 0x00, 0x69, 0x99, 0x98, 0x89, 0x60, 0x69, 0x96, 0x00, 0x06, 0x99, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x55, 0x11, 0x00, 0x00, 0x66, 0x56, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x56, 0x60, 0x00, 0x06, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x55, 0x55, 0x55, 0x60, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x55, 0x55, 0x56, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x56, 0x66, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xE8, 0x55, 0x55, 0x66, 0x00, 0x00, 
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x56, 0x65, 0x60, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x65, 0x5E, 0x55, 0x56, 0x66, 0x00, 0x05, 
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x56, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x11, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x60, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x06, 0x55, 0x55, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x05, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x56, 0x00, 0x06, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x65, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x51, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x06, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x13, 0x34, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x13, 0x43, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x43, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x44, 0x43, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x31, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x33, 0x40, 0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x03, 0x31, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x11, 0x33, 0x44, 0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x04, 0x33, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x33, 0x34, 0x43, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x13, 0x33, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
-    0x11, 0x31, 0x33, 0x33, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x10, 0x07, 0x01, 0x11, 0x14, 0x33, 0x13, 0x01, 0x30, 0x00, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 
-    0x11, 0x11, 0x13, 0x40, 0x04, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x07, 0x71, 0x11, 0x11, 0x00, 0x03, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x13, 0x33, 0x34, 0x00, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x30, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x31, 
-    0x33, 0x33, 0x43, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x31, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x33, 
-    0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x04, 0x00, 0x11, 0x11, 0x30, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x30, 
-    0x31, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x11, 0x11, 0x00, 0x40, 0x11, 0x11, 0x30, 0x03, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 
-    0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x31, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x31, 0x13, 0x03, 0x30, 
-    0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x10, 0x70, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x33, 0x11, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x33, 0x31, 0x31, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x33, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x44, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x13, 0x00, 0x01, 0x77, 0x71, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x33, 0x00, 0x00, 0x03, 0x31, 0x11, 0x13, 0x13, 
-    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-    0x31, 0x13, 0x40, 0x00, 0x01, 0x30, 0x43, 0x44, 0x31, 0x33, 0x43, 0x34, 0x11, 0x11, 0x11, 0x13, 
-    0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x10, 0x70, 0x10, 0x11, 0x11, 0x11, 0x13, 0x00, 0x11, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x13, 0x31, 0x30, 0x03, 0x11, 0x11, 0x11, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
-    0x31, 0x34, 0x00, 0x03, 0x11, 0x30, 0x33, 0x34, 0x04, 0x31, 0x33, 0x33, 0x31, 0x11, 0x11, 0x34, 
-    0x11, 0x11, 0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x17, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x31, 0x11, 0x11, 0x33, 0x31, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
-    0x34, 0x00, 0x00, 0x03, 0x11, 0x33, 0x33, 0x34, 0x00, 0x31, 0x33, 0x44, 0x41, 0x11, 0x31, 0x33, 
-    0x77, 0x70, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x31, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x34, 0x00, 0x03, 0x33, 0x11, 0x33, 0x33, 0x34, 0x04, 0x43, 0x33, 0x44, 0x31, 0x11, 0x31, 0x13, 
-    0x00, 0x77, 0x77, 0x13, 0x11, 0x11, 0x13, 0x11, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x11, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x43, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x03, 0x31, 0x11, 
-    0x11, 0x30, 0x43, 0x13, 0x33, 0x33, 0x34, 0x44, 0x44, 0x44, 0x34, 0x44, 0x31, 0x33, 0x13, 0x33, 
-    0x77, 0x77, 0x77, 0x71, 0x13, 0x33, 0x33, 0x31, 0x11, 0x13, 0x34, 0x43, 0x31, 0x11, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 0x13, 
-    0x31, 0x33, 0x33, 0x33, 0x33, 0x44, 0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x44, 0x31, 0x34, 0x31, 
-    0x77, 0x00, 0x77, 0x77, 0x77, 0x71, 0x10, 0x11, 0x11, 0x33, 0x30, 0x04, 0x43, 0x31, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x10, 
-    0x00, 0x33, 0x00, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x43, 0x11, 0x40, 0x43, 
-    0x77, 0x77, 0x00, 0x77, 0x70, 0xD7, 0x7D, 0x71, 0x11, 0x31, 0x10, 0x00, 0x00, 0x00, 0x31, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x30, 0x43, 0x33, 0x11, 0x11, 0x11, 0x11, 0x13, 0x40, 
-    0x00, 0x00, 0x00, 0x31, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x01, 0x13, 0x04, 0x04, 
-    0x17, 0x77, 0xDD, 0xD7, 0x70, 0x0D, 0x00, 0x77, 0xD7, 0x71, 0x30, 0x04, 0x00, 0x00, 0x03, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x34, 0x04, 0x40, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x30, 0x00, 0x00, 0x00, 0x03, 0x34, 0x44, 0x31, 0x14, 0x44, 0x04, 
-    0x10, 0x07, 0xDD, 0xD0, 0xDD, 0x00, 0x00, 0xDD, 0xD0, 0x71, 0x40, 0x00, 0x00, 0x00, 0x00, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x11, 0x43, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x43, 0x44, 0x33, 0x31, 0x30, 0x00, 0x00, 
-    0x11, 0x10, 0x77, 0x70, 0xDD, 0x00, 0xD0, 0x00, 0x0D, 0xD7, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x40, 0x44, 
-    0x40, 0x41, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x34, 0x44, 0x40, 0x00, 0x00, 
-    0x31, 0x11, 0x77, 0x7D, 0x77, 0xDD, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x77, 0x11, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x34, 0x00, 0x01, 
-    0x30, 0x00, 0x11, 0x17, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x04, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x11, 0x11, 0x17, 0x77, 0x77, 0x77, 0x77, 0x7D, 0x00, 0x00, 0x00, 0x77, 0x10, 0x31, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0xDD, 0xDD, 0xDD, 0xD0, 0x07, 0x70, 0x70, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x11, 0x17, 0x77, 0x07, 
-    0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t GAME_TOWER_LOGO_RLE[GAME_TOWER_LOGO_RLE_SIZE] = {
+    0xF0, 0x3C, 0x08, 0x43, 0x41, 0x11, 0x33, 0x40, 0xF0, 0x70, 0x42, 0x04, 0x13, 0x34, 0x40, 0xF0, 
+    0x6A, 0x04, 0x41, 0x00, 0x30, 0x43, 0x03, 0x40, 0x04, 0xF0, 0x6B, 0x04, 0x40, 0x43, 0x00, 0xA4, 
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x3A, 0x00, 0x40, 0xFA, 0x00, 0x02, 0x40, 0x00, 0xCA, 0x16, 0x40, 
+    0x00, 0xAA, 0xA4, 0x00, 0xAA, 0xA0, 0x04, 0xAA, 0xA0, 0x00, 0x40, 0xCA, 0x01, 0x00, 0xDA, 0x00, 
+    0x40, 0xF0, 0x3D, 0x00, 0xA0, 0xF2, 0x00, 0x02, 0xF0, 0xA0, 0xD2, 0x14, 0x40, 0x02, 0x22, 0xF6, 
+    0x42, 0x22, 0x60, 0x42, 0x2C, 0x60, 0x40, 0xD2, 0x01, 0x90, 0xE2, 0x00, 0xA0, 0xF0, 0x28, 0x00, 
+    0x40, 0x5B, 0x01, 0x06, 0xE2, 0x01, 0xB6, 0x42, 0x07, 0x09, 0x02, 0x22, 0x86, 0x42, 0x01, 0x86, 
+    0xE2, 0x01, 0x86, 0xE2, 0x01, 0xC6, 0xF0, 0x26, 0x00, 0x40, 0xF0, 0x0B, 0x0A, 0x4F, 0xFB, 0x22, 
+    0x2F, 0xFF, 0x80, 0x42, 0x06, 0xF0, 0xB2, 0x2C, 0x90, 0x48, 0x00, 0x90, 0x43, 0x00, 0x90, 0x42, 
+    0x04, 0xB0, 0xFF, 0x00, 0x43, 0x07, 0xB0, 0xB2, 0x22, 0x96, 0xF0, 0x24, 0x00, 0x40, 0x53, 0x07, 
+    0x00, 0x66, 0x22, 0x29, 0xA6, 0x05, 0x22, 0x28, 0x9F, 0x42, 0x00, 0x60, 0x52, 0x01, 0xF9, 0xB6, 
+    0x05, 0x22, 0x2E, 0x9F, 0x6F, 0xA4, 0xF0, 0x0D, 0x00, 0x40, 0x43, 0x02, 0x00, 0x00, 0x42, 0x01, 
+    0x64, 0x59, 0xB0, 0x42, 0x01, 0x64, 0x6E, 0x03, 0x43, 0x33, 0x7F, 0x02, 0x00, 0x40, 0x44, 0x00, 
+    0x90, 0x6E, 0x04, 0x43, 0x31, 0x30, 0xF0, 0x0E, 0x46, 0x00, 0x40, 0x5F, 0x03, 0x4A, 0x26, 0x48, 
+    0x00, 0x80, 0x67, 0x05, 0x43, 0x33, 0x11, 0xF0, 0x0F, 0x4C, 0x00, 0xA0, 0x4C, 0x00, 0x80, 0x48, 
+    0x06, 0xBB, 0x22, 0x28, 0x60, 0x43, 0x00, 0xA0, 0x6C, 0x02, 0x43, 0x10, 0x43, 0x00, 0x50, 0x5F, 
+    0x00, 0x80, 0x58, 0xB2, 0x43, 0x01, 0xBC, 0xA2, 0x68, 0x01, 0x33, 0xA1, 0x04, 0x50, 0x65, 0x60, 
+    0x58, 0x01, 0x6F, 0x47, 0x00, 0x80, 0x56, 0x01, 0xCE, 0x43, 0xB2, 0x00, 0xB0, 0x66, 0x01, 0x43, 
+    0xD1, 0x02, 0x55, 0x60, 0xF0, 0x0B, 0x44, 0x02, 0x55, 0x10, 0x5F, 0x03, 0xE8, 0x86, 0x46, 0x01, 
+    0x08, 0x65, 0x00, 0x40, 0x42, 0x06, 0x33, 0x11, 0x55, 0x50, 0xF0, 0x0C, 0x43, 0x00, 0x50, 0x46, 
+    0x00, 0xB0, 0x46, 0x02, 0xE9, 0x60, 0x47, 0x00, 0x80, 0x42, 0x06, 0xB8, 0x86, 0x66, 0x00, 0xD2, 
+    0x02, 0xE6, 0x60, 0xF0, 0x1A, 0x0E, 0x44, 0x34, 0x41, 0x11, 0x31, 0x11, 0x56, 0x60, 0x59, 0x01, 
+    0x88, 0x4E, 0x00, 0x80, 0x4D, 0x02, 0x09, 0x60, 0xA0, 0x08, 0x22, 0x2F, 0xB2, 0x2C, 0x90, 0xF0, 
+    0x1B, 0x07, 0x33, 0x34, 0x11, 0x13, 0xA1, 0x00, 0x50, 0xF0, 0x0E, 0x45, 0x01, 0x0E, 0x4E, 0x00, 
+    0x10, 0x4C, 0x01, 0xF9, 0xB0, 0x09, 0x22, 0x28, 0xF2, 0x22, 0x86, 0xF0, 0x1A, 0x03, 0x44, 0x43, 
+    0x42, 0x04, 0x31, 0x55, 0x60, 0x5B, 0x00, 0x00, 0x69, 0x05, 0xE9, 0x22, 0x2B, 0x62, 0x01, 0x04, 
+    0xA1, 0x02, 0x33, 0x40, 0xF0, 0x12, 0x42, 0x02, 0x85, 0x80, 0x45, 0x00, 0x40, 0x48, 0x00, 0x50, 
+    0x4C, 0x00, 0x00, 0x49, 0x04, 0xA2, 0x22, 0x90, 0xF0, 0x1B, 0x00, 0x30, 0x44, 0xF0, 0x00, 0x00, 
+    0x60, 0x55, 0x09, 0x65, 0x81, 0x22, 0x20, 0xFA, 0x46, 0x08, 0xBF, 0xA2, 0x22, 0xBF, 0xA0, 0x46, 
+    0x04, 0xBF, 0xAA, 0x40, 0x44, 0x06, 0x80, 0x22, 0x2B, 0x60, 0xF0, 0x19, 0x00, 0x40, 0xA1, 0x01, 
+    0x33, 0xF0, 0x01, 0x4B, 0x02, 0x60, 0x60, 0x4D, 0xB2, 0x44, 0xF2, 0x02, 0x44, 0xB2, 0x00, 0x60, 
+    0x45, 0x04, 0xA2, 0x2C, 0x90, 0x65, 0x00, 0x10, 0xF0, 0x11, 0x00, 0x50, 0x45, 0x05, 0x96, 0x55, 
+    0x50, 0xD2, 0x03, 0xE8, 0x54, 0xC2, 0x00, 0xB0, 0xC2, 0x00, 0xE0, 0x48, 0x01, 0x86, 0x44, 0x05, 
+    0x42, 0x22, 0xF6, 0x64, 0x00, 0x30, 0xF0, 0x02, 0x01, 0x66, 0x4C, 0x07, 0x60, 0x00, 0xAB, 0xB8, 
+    0x42, 0x01, 0x50, 0xBB, 0x05, 0xE8, 0x85, 0x51, 0xAB, 0x02, 0xE8, 0xF0, 0xAB, 0x04, 0xE8, 0x66, 
+    0xA0, 0xDB, 0x0D, 0x86, 0xAB, 0xB8, 0x90, 0x0A, 0xBB, 0xB9, 0xF0, 0x18, 0xB1, 0xF0, 0x03, 0x02, 
+    0x65, 0x60, 0xF0, 0x03, 0x00, 0x60, 0x42, 0x03, 0x06, 0x96, 0x43, 0x01, 0x55, 0xB8, 0x01, 0x55, 
+    0xA6, 0x0F, 0x99, 0x89, 0x66, 0x06, 0x99, 0x96, 0x60, 0x06, 0xA9, 0x10, 0x88, 0x96, 0x06, 0x99, 
+    0x60, 0x00, 0x69, 0x96, 0x60, 0x6F, 0x03, 0x00, 0x06, 0xF0, 0x0C, 0x05, 0xE5, 0x55, 0x11, 0xA0, 
+    0x03, 0x66, 0x56, 0xF0, 0x3F, 0x00, 0x30, 0x51, 0x01, 0x56, 0xF0, 0x0B, 0xA5, 0xC0, 0xA5, 0xF0, 
+    0x3F, 0x03, 0x11, 0x14, 0xF0, 0x07, 0x04, 0x55, 0x56, 0x60, 0xA0, 0x00, 0x60, 0xF0, 0x04, 0x00, 
+    0x50, 0xB0, 0x00, 0x60, 0xC5, 0x00, 0x60, 0xF0, 0x3E, 0x02, 0x11, 0x40, 0xF0, 0x07, 0x00, 0x60, 
+    0xB5, 0x00, 0x60, 0xF0, 0x0E, 0xC5, 0x02, 0x66, 0x60, 0xF0, 0x3D, 0x01, 0x13, 0xF0, 0x07, 0x03, 
+    0x65, 0xE8, 0xA5, 0x01, 0x66, 0xA0, 0x00, 0x50, 0xF0, 0x05, 0xE5, 0x03, 0x66, 0x56, 0xF0, 0x3C, 
+    0x4A, 0x00, 0x40, 0x45, 0x05, 0x5E, 0x55, 0x56, 0x43, 0x00, 0x50, 0x49, 0x02, 0x50, 0x60, 0xF5, 
+    0x04, 0xF0, 0x3C, 0x00, 0x10, 0xF0, 0x02, 0x01, 0x34, 0xD0, 0xC5, 0x42, 0xF0, 0x03, 0x00, 0x10, 
+    0xA5, 0x02, 0x11, 0x10, 0x7F, 0x56, 0x02, 0x03, 0x30, 0xE0, 0xB5, 0xF0, 0x06, 0xF5, 0x05, 0x01, 
+    0x66, 0xF0, 0x3C, 0x55, 0x00, 0x60, 0xA5, 0x00, 0x60, 0x52, 0x01, 0x00, 0xC5, 0xF0, 0x3E, 0x4B, 
+    0x00, 0x40, 0xF0, 0x01, 0x03, 0x15, 0x55, 0xF0, 0x06, 0x08, 0x66, 0x55, 0x60, 0x00, 0x60, 0xA5, 
+    0xF0, 0x3F, 0x4B, 0xF0, 0x02, 0xA5, 0xF0, 0x07, 0x01, 0x65, 0xA0, 0x00, 0x60, 0xA5, 0xF0, 0x40, 
+    0x01, 0x13, 0xF0, 0x0E, 0x51, 0xC0, 0x01, 0x55, 0xF0, 0x43, 0x02, 0x11, 0x30, 0xF0, 0x74, 0xA1, 
+    0x00, 0x30, 0xF0, 0x72, 0xE1, 0xF0, 0x26, 0x01, 0x51, 0xF0, 0x3E, 0xE1, 0x00, 0x30, 0xF0, 0x24, 
+    0x04, 0x55, 0x51, 0x10, 0xF0, 0x3C, 0xF1, 0x00, 0xF0, 0x22, 0x03, 0x55, 0x06, 0xF0, 0x03, 0x04, 
+    0x13, 0x34, 0x30, 0x7F, 0x69, 0x00, 0x60, 0xF0, 0x04, 0x04, 0x31, 0x34, 0x30, 0x7F, 0x00, 0x10, 
+    0xF0, 0x22, 0x00, 0x50, 0xF0, 0x08, 0x7F, 0x09, 0x11, 0x10, 0x00, 0x41, 0x33, 0xF0, 0x2A, 0x04, 
+    0x44, 0x33, 0x40, 0x7F, 0x06, 0x30, 0x03, 0x11, 0x10, 0xF0, 0x29, 0x04, 0x44, 0x43, 0x40, 0x7F, 
+    0x01, 0x11, 0xA0, 0x02, 0x31, 0x30, 0xD0, 0x00, 0x10, 0xF0, 0x1C, 0x08, 0x31, 0x33, 0x40, 0x43, 
+    0x40, 0xF0, 0x2E, 0x4E, 0x03, 0x03, 0x31, 0x45, 0x01, 0x11, 0xF0, 0x19, 0x01, 0x31, 0x42, 0x00, 
+    0x40, 0x7F, 0xB1, 0x08, 0x30, 0x04, 0x33, 0x11, 0x10, 0x46, 0x00, 0x10, 0xF0, 0x17, 0x08, 0x11, 
+    0x33, 0x34, 0x43, 0x30, 0x7F, 0x07, 0x10, 0x11, 0x13, 0x33, 0xC1, 0x46, 0x01, 0x11, 0xF0, 0x15, 
+    0x05, 0x31, 0x11, 0x31, 0xA3, 0x04, 0x00, 0x04, 0x30, 0x78, 0x03, 0x00, 0x70, 0xA1, 0x07, 0x43, 
+    0x31, 0x30, 0x13, 0x47, 0x00, 0x10, 0xF0, 0x12, 0x00, 0x30, 0xE1, 0x06, 0x34, 0x00, 0x43, 0x30, 
+    0xF0, 0x2B, 0xE1, 0x02, 0x07, 0x70, 0xB1, 0x07, 0x00, 0x03, 0x00, 0x11, 0xA0, 0x4E, 0x00, 0x50, 
+    0xF0, 0x05, 0xC1, 0xA3, 0x05, 0x40, 0x01, 0x14, 0xF0, 0x2D, 0x00, 0x40, 0xD1, 0x00, 0x00, 0xC1, 
+    0x06, 0x30, 0x34, 0x00, 0x00, 0x43, 0x03, 0x00, 0x11, 0xF0, 0x03, 0x4D, 0xA3, 0x00, 0x10, 0xA3, 
+    0x04, 0x43, 0x33, 0x10, 0xF0, 0x12, 0x01, 0x33, 0xF0, 0x13, 0x00, 0x30, 0xD1, 0x00, 0x00, 0xD1, 
+    0x00, 0x00, 0x43, 0x01, 0x11, 0xB0, 0x4B, 0xF0, 0x05, 0x03, 0x33, 0x30, 0xF3, 0x00, 0xF0, 0x13, 
+    0x01, 0x31, 0x5B, 0x01, 0x04, 0xF1, 0x05, 0x05, 0x40, 0x04, 0x00, 0xA1, 0x00, 0x30, 0xF0, 0x14, 
+    0x0A, 0x33, 0x43, 0x30, 0x31, 0x33, 0x30, 0xF0, 0x15, 0x03, 0x31, 0x13, 0xF0, 0x14, 0xF1, 0x00, 
+    0x02, 0x70, 0x00, 0xA1, 0x02, 0x00, 0x40, 0x46, 0x00, 0x30, 0xF0, 0x13, 0x00, 0x40, 0xA0, 0x02, 
+    0x33, 0x30, 0xF0, 0x15, 0x04, 0x31, 0x11, 0x40, 0xF0, 0x06, 0x08, 0x44, 0x31, 0x13, 0x03, 0x30, 
+    0xB0, 0x00, 0x30, 0xE1, 0x01, 0x07, 0x43, 0x02, 0x10, 0x00, 0x43, 0x02, 0x11, 0x10, 0x4C, 0x00, 
+    0x10, 0xF0, 0x07, 0x02, 0x33, 0x30, 0xF0, 0x15, 0x06, 0x33, 0x31, 0x13, 0x30, 0x48, 0x04, 0x33, 
+    0x31, 0x30, 0xF1, 0x01, 0x00, 0x30, 0xB0, 0xF1, 0x08, 0x02, 0x00, 0x00, 0xD1, 0x4C, 0x01, 0x51, 
+    0xF0, 0x01, 0x01, 0x40, 0xA3, 0x01, 0x13, 0xF0, 0x15, 0x02, 0x31, 0x10, 0xC0, 0x00, 0x10, 0xB0, 
+    0x00, 0x30, 0xF1, 0x07, 0x05, 0x44, 0x00, 0x04, 0xE1, 0x00, 0x00, 0xE1, 0x07, 0x30, 0x00, 0x17, 
+    0x77, 0x4D, 0x03, 0x13, 0x33, 0xB0, 0x01, 0x33, 0xA1, 0x04, 0x31, 0x33, 0x10, 0xF0, 0x13, 0x06, 
+    0x33, 0x31, 0x13, 0x40, 0x43, 0x0D, 0x30, 0x43, 0x44, 0x31, 0x33, 0x43, 0x34, 0xD1, 0x00, 0x30, 
+    0xC1, 0x00, 0x30, 0xC1, 0x04, 0x07, 0x01, 0x00, 0xD1, 0x06, 0x30, 0x01, 0x17, 0x70, 0xF0, 0x03, 
+    0x00, 0x10, 0x42, 0x04, 0x13, 0x00, 0x30, 0xD1, 0x00, 0x30, 0xF0, 0x17, 0x15, 0x31, 0x31, 0x34, 
+    0x00, 0x03, 0x11, 0x30, 0x33, 0x34, 0x04, 0x31, 0xB3, 0xB1, 0x01, 0x34, 0xB1, 0x00, 0x30, 0x45, 
+    0xF1, 0x05, 0x03, 0x30, 0x01, 0x4E, 0x03, 0x00, 0x03, 0xB1, 0x02, 0x33, 0x30, 0x64, 0x00, 0x40, 
+    0xB0, 0x42, 0xA3, 0x02, 0x40, 0x00, 0x42, 0x0D, 0x44, 0x41, 0x11, 0x31, 0x33, 0x77, 0x70, 0xF1, 
+    0x10, 0x02, 0x00, 0x10, 0xF0, 0x03, 0x04, 0x33, 0x00, 0x30, 0xD1, 0x00, 0x30, 0xF0, 0x1B, 0x01, 
+    0x41, 0x44, 0x01, 0x33, 0x48, 0x02, 0x44, 0x30, 0x42, 0x00, 0x30, 0x43, 0x03, 0x13, 0x00, 0xA7, 
+    0x01, 0x13, 0xB1, 0x00, 0x30, 0xB1, 0xA3, 0xD1, 0x00, 0x30, 0xF0, 0x04, 0xE1, 0x03, 0x43, 0x33, 
+    0xF0, 0x16, 0x05, 0x33, 0x00, 0x33, 0xB1, 0x04, 0x30, 0x43, 0x10, 0xC3, 0xD4, 0x01, 0x34, 0x42, 
+    0x05, 0x33, 0x13, 0x33, 0xD7, 0x01, 0x11, 0xC3, 0x44, 0x03, 0x44, 0x33, 0xC1, 0x4F, 0xA4, 0xF0, 
+    0x1A, 0x01, 0x33, 0xC1, 0x02, 0x33, 0x10, 0xE3, 0x01, 0x44, 0xD0, 0xD4, 0x09, 0x31, 0x34, 0x31, 
+    0x77, 0x00, 0xD7, 0x02, 0x11, 0x00, 0xA1, 0x08, 0x33, 0x30, 0x04, 0x43, 0x30, 0xB1, 0x4C, 0x00, 
+    0x30, 0xF0, 0x1D, 0x00, 0x30, 0xF1, 0x00, 0x0A, 0x00, 0x03, 0x30, 0x03, 0x11, 0x30, 0xF0, 0x01, 
+    0xB4, 0x06, 0x31, 0x14, 0x04, 0x30, 0xA7, 0x0A, 0x00, 0x77, 0x70, 0xD7, 0x7D, 0x70, 0x42, 0x01, 
+    0x11, 0xD0, 0x00, 0x30, 0x4D, 0x00, 0x30, 0xF0, 0x16, 0x07, 0x31, 0x30, 0x43, 0x33, 0xF1, 0x00, 
+    0x01, 0x34, 0xD0, 0x04, 0x31, 0x11, 0x40, 0xF0, 0x00, 0x23, 0x34, 0x44, 0x01, 0x13, 0x04, 0x04, 
+    0x17, 0x77, 0xDD, 0xD7, 0x70, 0x0D, 0x00, 0x77, 0xD7, 0x71, 0x30, 0x04, 0xB0, 0x01, 0x31, 0xF0, 
+    0x23, 0x00, 0x30, 0xA1, 0x00, 0x30, 0xF1, 0x00, 0x03, 0x34, 0x04, 0x46, 0x04, 0x01, 0x11, 0x30, 
+    0xE0, 0x00, 0x30, 0x42, 0x04, 0x31, 0x14, 0x40, 0x42, 0x01, 0x00, 0x42, 0x02, 0x0D, 0xD0, 0xA0, 
+    0x06, 0xDD, 0xD0, 0x71, 0x40, 0xF0, 0x00, 0x00, 0x30, 0xF0, 0x1B, 0x04, 0x31, 0x14, 0x30, 0xF1, 
+    0x08, 0x00, 0x40, 0xF0, 0x00, 0x00, 0x30, 0xA0, 0x01, 0x33, 0xE0, 0x08, 0x43, 0x44, 0x33, 0x31, 
+    0x30, 0xB0, 0x06, 0x11, 0x10, 0x77, 0x70, 0x43, 0x00, 0xD0, 0xA0, 0x06, 0xDD, 0x71, 0x00, 0x30, 
+    0xF0, 0x17, 0x0C, 0x44, 0x04, 0x40, 0x44, 0x40, 0x41, 0x30, 0xF1, 0x0A, 0x00, 0x30, 0xF0, 0x0F, 
+    0x05, 0x34, 0x00, 0x03, 0xA4, 0xB0, 0x10, 0x31, 0x11, 0x77, 0x7D, 0x77, 0xDD, 0x00, 0x0D, 0xD0, 
+    0xB0, 0x04, 0x77, 0x11, 0x30, 0xF0, 0x15, 0x0F, 0x43, 0x40, 0x00, 0x13, 0x00, 0x01, 0x11, 0x77, 
+    0xF1, 0x05, 0xE0, 0x00, 0x40, 0xF0, 0x07, 0x06, 0x34, 0x00, 0x04, 0x40, 0xF0, 0x00, 0x42, 0x02, 
+    0x11, 0x10, 0xF7, 0x01, 0x00, 0xD0, 0xC0, 0x06, 0x77, 0x10, 0x31, 0x10, 0xF0, 0x04, 0x07, 0x31, 
+    0x00, 0x04, 0x04, 0x45, 0xF1, 0x00, 0xB7, 0xF1, 0x03, 0x00, 0x30, 0xF0, 0x00, 0x01, 0x13, 0xF0, 
+    0x05, 0x00, 0x40, 0xF0, 0x07, 0x02, 0x33, 0x30, 0xF1, 0x02, 0xA7, 0xDD, 0x05, 0x00, 0x77, 0x07, 
+    0xF0, 0x04, 0x02, 0x11, 0x10, 0xA3, 0xE1, 0x03, 0x77, 0x70, 0xF7, 0x01, 0xF1, 0x02, 0x00, 0x30, 
+    0xE0, 0x03, 0x40, 0x04, 0xF0, 0x16, 
+};
+
+const gfx_image_t GAME_TOWER_LOGO_IMG = {
+    .w = GAME_TOWER_LOGO_W, .h = GAME_TOWER_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = GAME_TOWER_LOGO_PAL, .colors = GAME_TOWER_LOGO_PAL_SIZE,
+    .data = GAME_TOWER_LOGO_RLE, .size = GAME_TOWER_LOGO_RLE_SIZE,
 };
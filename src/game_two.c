@@ -12,10 +12,10 @@
 #include <string.h>
 #include "timer.h"
 #include "gfx.h"
+#include "hud.h"
 #include "ssd1351.h"
-#include "game.h"   // baseline_begin(), game_get_metrics()
+#include "game.h"
 #include "project.h"
-#include "intermission.h"
 #include "winner2.h"
 #include "rankhist.h"
 #include "game_two_logo.h"
@@ -23,6 +23,11 @@
 #include "you_win_p2_pic.h"
 #include "pvp_tie_pic.h"
 #include "cheevos.h"
+#include "round_acc.h"
+#include "metrics.h"
+#include "pqueue.h"
+#include "duel.h"
+#include "scene.h"
 
 static float clampf(float v, float lo, float hi){
   if (v < lo) return lo;
@@ -75,373 +80,313 @@ typedef enum {
   ST_WINNER,
   ST_DECLARE,
   ST_RANKS2,
-  ST_OVERALL_RANKS2
+  ST_OVERALL_RANKS2,
+  ST_SCENES
 } tp_state_t;
 
-static tp_state_t g_state;
-static uint32_t   g_t0_ms;
-static bool       g_drawn_once = false;
+static scene_run_t g_run;
 
-static uint8_t  g_player      = 1;
 static float    g_p1_avg_hz   = 0.0f;
 static float    g_p2_avg_hz   = 0.0f;
 static unsigned g_p1_rank_pct = 0;
 static unsigned g_p2_rank_pct = 0;
 
-static bool     g_dirty;   // true = need to (re)draw this state's screen
+static duel_t         g_duel;
+static duel_verdict_t g_verdict  = DUEL_TIE;
+static uint32_t       g_round_ms = 0;   // how long the round actually ran
 
-static void goto_state(tp_state_t s){
-  g_state      = s;
-  g_t0_ms      = millis();
-  g_drawn_once = false;
-  g_dirty      = true;
+/* Both players' metrics for this tick, each on their seat's channel */
+static float g_hz[2], g_base_hz[2];
 
-  if (s == ST_COUNTDOWN_LABEL){
-    baseline_begin(3000u);
-  }
-}
+/* Split screen: P1 panel on top, P2 below, each with Hz and a bar */
+#define FLEX_BX     6
+#define FLEX_BW     116
+#define FLEX_BH     14
+#define PANEL_Y0    19
+#define PANEL_H     55
 
-#define FLEX_BX  6
-#define FLEX_BY  64
-#define FLEX_BW  116
-#define FLEX_BH  18
+static const uint16_t k_player_col[2] = { COL_BLUE, COL_RED };
 
-static void draw_flex_static(float baseline_hz){
+static hud_num_t g_hz_label[2];
+static hud_bar_t g_flex_bar[2];
+static hud_countdown_t g_flex_left;
+
+static void draw_flex_static(const float *baseline_hz){
   gfx_bar(0, 18, 128, 110, COL_BLACK);
   ui_sep_h(18);
-  ui_sep_h(60);
+  ui_sep_h(PANEL_Y0 + PANEL_H - 1);
   ui_sep_v(0,   18, 110);
   ui_sep_v(127, 18, 110);
 
-  char bline[32];
-  snprintf(bline, sizeof(bline), "Baseline: %.1f", baseline_hz);
-  gfx_text2(6, 44, bline, COL_YELLOW, 1);
+  for (uint8_t p = 0; p < 2u; p++){
+    uint8_t y0 = (uint8_t)(PANEL_Y0 + p * PANEL_H);
+    char line[24];
+    snprintf(line, sizeof(line), "P%u", (unsigned)(p + 1u));
+    gfx_text2(FLEX_BX, y0 + 3, line, k_player_col[p], 1);
+    snprintf(line, sizeof(line), "Base: %.1f", baseline_hz[p]);
+    gfx_text2(58, y0 + 3, line, COL_YELLOW, 1);
+
+    hud_num_init(&g_hz_label[p], FLEX_BX, y0 + 15, 2, "Hz: ", 5, 1, "", COL_WHITE, COL_BLACK);
+    hud_bar_init(&g_flex_bar[p], FLEX_BX, y0 + 34, FLEX_BW, FLEX_BH, 250.0f,
+                 k_player_col[p], COL_GRAY);
+  }
+}
 
-  gfx_text2(FLEX_BX, FLEX_BY + FLEX_BH + 6, "0 Hz", COL_WHITE, 1);
-  const char *rlabel = "250 Hz";
-  uint8_t rx = FLEX_BX + FLEX_BW - (uint8_t)(6 * 1 * strlen(rlabel));
-  gfx_text2(rx, FLEX_BY + FLEX_BH + 6, rlabel, COL_WHITE, 1);
+static void draw_flex_dynamic(const float *hz){
+  for (uint8_t p = 0; p < 2u; p++){
+    hud_num_set(&g_hz_label[p], hz[p]);
+    hud_bar_set(&g_flex_bar[p], hz[p]);
+  }
 }
 
-static void draw_flex_dynamic(float hz){
-  char line[32];
-  snprintf(line, sizeof(line), "Hz: %.1f", hz);
-  gfx_bar(6, 28, 120, 16, COL_BLACK);
-  gfx_text2(6, 28, line, COL_WHITE, 2);
+/*------------------------------- scenes ------------------------------------*/
+
+static void logo_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  uint8_t x = (uint8_t)((128 - GAME_TWO_LOGO_W) / 2);
+  uint8_t y = (uint8_t)((128 - GAME_TWO_LOGO_H) / 2);
 
-  gfx_bar(FLEX_BX, FLEX_BY, FLEX_BW, FLEX_BH, COL_GRAY);
-  uint8_t fw = (uint8_t)((clampf(hz, 0.0f, 250.0f) * (float)FLEX_BW) / 250.0f);
-  gfx_bar(FLEX_BX, FLEX_BY, fw, FLEX_BH, COL_GREEN);
+  gfx_blit_image(x, y, &GAME_TWO_LOGO_IMG);
 }
 
-void game_two_init(void){
-  g_player = 1u;
-  goto_state(ST_LOGO);
+static void pmode_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_header("Mode: PVP", COL_WHITE);
+  ui_sep_h(18);
 }
 
-bool game_two_tick(void){
-  uint32_t now = millis();
-  uint32_t dt  = now - g_t0_ms;
+// Two players calibrated in the queue go straight to the countdown, with
+// their armbands' channels on a band across the logo under it
+static uint8_t pmode_exit(const scene_ctx_t *c){
+  if (!c->done) return SCENE_STAY;
+  if (!pqueue_round_begin(2u, 3000u)) return ST_COUNTDOWN_LABEL;
+
+  gfx_bar(0, 42, 128, 44, COL_BLACK);
+  for (uint8_t p = 0; p < 2u; p++){
+    char line[12];
+    snprintf(line, sizeof(line), "P%u=ch%u", (unsigned)(p + 1u), (unsigned)pqueue_seat(p));
+    gfx_text2(31, (uint8_t)(46 + p * 22), line, k_player_col[p], 2);
+  }
+  return ST_COUNT_3;
+}
+
+static void label_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_header("READY P1+P2?", COL_WHITE);
+  ui_sep_h(18);
+}
+
+static void flexing_enter(const scene_ctx_t *c){
+  round_acc_begin(0u, pqueue_seat(0), c->t0, c->ms, ROUND_ACTIVE_HZ);
+  round_acc_begin(1u, pqueue_seat(1), c->t0, c->ms, ROUND_ACTIVE_HZ);
+  duel_reset(&g_duel);
+  draw_flex_static(g_base_hz);
+
+  // "FLEX: 10" centered; afterwards only the seconds digits change
+  gfx_clear_header_band(COL_BLACK);
+  hud_countdown_init(&g_flex_left, 20, 2, 2, "FLEX: ", 2, "",
+                     COL_RED, COL_BLACK, c->t0 + c->ms);
+}
 
-  float   hz   = 0.0f;
-  float   base = 0.0f;
-  uint8_t pct  = 0;
-  game_get_metrics(&hz, &pct, &base);
+static void flexing_tick(const scene_ctx_t *c){
+  hud_countdown_tick(&g_flex_left, c->now);
+  draw_flex_dynamic(g_hz);
+}
 
-  if (intermission_active()){
-    if (intermission_tick()){
-      goto_state(ST_COUNTDOWN_LABEL);
+// Sequential test on the round so far; a clear lead ends it early,
+// otherwise the full round decides (or calls a tie)
+static uint8_t flexing_exit(const scene_ctx_t *c){
+  round_stats_t r1, r2;
+  bool full = c->done && round_acc_done(0u, c->now, &r1) && round_acc_done(1u, c->now, &r2);
+  if (!full){
+    if (!c->done && round_acc_peek(0u, &r1) && round_acc_peek(1u, &r2)){
+      g_verdict = duel_step(&g_duel, &r1, &r2, c->dt, false);
+    } else {
+      g_verdict = DUEL_OPEN;
     }
-    return false;
+  } else {
+    g_verdict = duel_step(&g_duel, &r1, &r2, c->dt, true);
+  }
+  if (g_verdict == DUEL_OPEN) return SCENE_STAY;
+
+  g_round_ms    = c->done ? c->ms : c->dt;
+  g_p1_avg_hz   = r1.active_hz;
+  g_p2_avg_hz   = r2.active_hz;
+  g_p1_rank_pct = (unsigned)((clampf(g_p1_avg_hz, 0.0f, 250.0f) * 100.0f / 250.0f) + 0.5f);
+  g_p2_rank_pct = (unsigned)((clampf(g_p2_avg_hz, 0.0f, 250.0f) * 100.0f / 250.0f) + 0.5f);
+  return SCENE_NEXT;
+}
+
+static void results_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("SCORES", COL_WHITE);
+  ui_sep_h(18);
+  ui_sep_h(60);
+
+  char l1[32];
+  snprintf(l1, sizeof(l1), "P1 Avg Hz: %.1f", g_p1_avg_hz);
+  gfx_text2(6, 28, l1, COL_BLUE, 1);
+  const char* r1 = rank_from_percent(g_p1_rank_pct);
+  char l1r[32];
+  snprintf(l1r, sizeof(l1r), "Rank: %s", r1);
+  gfx_text2(6, 38, l1r, COL_BLUE, 1);
+
+  char l2[32];
+  snprintf(l2, sizeof(l2), "P2 Avg Hz: %.1f", g_p2_avg_hz);
+  gfx_text2(6, 70, l2, COL_RED, 1);
+  const char* r2 = rank_from_percent(g_p2_rank_pct);
+  char l2r[32];
+  snprintf(l2r, sizeof(l2r), "Rank: %s", r2);
+  gfx_text2(6, 80, l2r, COL_RED, 1);
+
+  // How the round was decided
+  char ld[32];
+  if (g_verdict == DUEL_TIE){
+    snprintf(ld, sizeof(ld), "Tie (no clear gap)");
+  } else {
+    snprintf(ld, sizeof(ld), "P%u called at %.1f s", (g_verdict == DUEL_P1) ? 1u : 2u,
+             (float)g_round_ms / 1000.0f);
+  }
+  gfx_text2(6, 104, ld, COL_YELLOW, 1);
+}
+
+static void winner_enter(const scene_ctx_t *c){
+  (void)c;
+  winner2_start(g_p1_avg_hz, g_p2_avg_hz);
+}
+
+static uint8_t winner_exit(const scene_ctx_t *c){
+  (void)c;
+  return winner2_tick() ? SCENE_NEXT : SCENE_STAY;
+}
+
+static void declare_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("WINNER?", COL_RED);
+
+  if (g_verdict == DUEL_P1){
+    uint8_t x = (uint8_t)((128 - YOU_WIN_P1_PIC_W) / 2);
+    uint8_t y = (uint8_t)((128 - YOU_WIN_P1_PIC_H) / 2);
+
+    gfx_blit_image(x, y, &YOU_WIN_P1_PIC_IMG);
+  } else if (g_verdict == DUEL_P2){
+    uint8_t x = (uint8_t)((128 - YOU_WIN_P2_PIC_W) / 2);
+    uint8_t y = (uint8_t)((128 - YOU_WIN_P2_PIC_H) / 2);
+
+    gfx_blit_image(x, y, &YOU_WIN_P2_PIC_IMG);
+  } else {
+    uint8_t x = (uint8_t)((128 - PVP_TIE_PIC_W) / 2);
+    uint8_t y = (uint8_t)((128 - PVP_TIE_PIC_H) / 2);
+
+    gfx_blit_image(x, y, &PVP_TIE_PIC_IMG);
+  }
+  (void)cheevos_unlock(ACH_FIRST_WIN_PVP);
+}
+
+static void ranks_enter(const scene_ctx_t *c){
+  (void)c;
+  gfx_clear(COL_BLACK);
+  gfx_header("RANKINGS", COL_RED);
+  ui_sep_h(18);
+
+  static const char* ranks[] = {
+    "Challenger 1%","Grandmaster 3%","Master 5%","Diamond 10%",
+    "Platinum 20%","Gold 35%","Silver 55%","Bronze 75%","Iron 100%"
+  };
+  const int base_y = 24;
+  const int row_h  = 10;
+
+  for (int i = 0; i < 9; ++i){
+    gfx_text2(0, base_y + i*row_h, ranks[i], COL_WHITE, 1);
+  }
+
+  int i1 = rank_index_from_percent(g_p1_rank_pct);
+  int i2 = rank_index_from_percent(g_p2_rank_pct);
+  if (i1 < 0) i1 = 0; if (i1 > 8) i1 = 8;
+  if (i2 < 0) i2 = 0; if (i2 > 8) i2 = 8;
+
+  for (int i = 0; i < 9; ++i){
+    uint16_t col =
+      (i == i1 && i == i2) ? COL_MAGENTA :
+      (i == i1)             ? COL_CYAN    :
+      (i == i2)             ? COL_YELLOW  :
+                               COL_WHITE;
+    gfx_text2(0, base_y + i*row_h, ranks[i], col, 1);
   }
 
-  switch (g_state){
-
-    case ST_LOGO: {
-      if (!g_drawn_once){
-        g_drawn_once = true;
-        gfx_clear(COL_BLACK);
-        uint8_t x = (uint8_t)((128 - GAME_TWO_LOGO_W) / 2);
-        uint8_t y = (uint8_t)((128 - GAME_TWO_LOGO_H) / 2);
-
-        gfx_blit_pal4(x, y,
-                      GAME_TWO_LOGO_W, GAME_TWO_LOGO_H,
-                      GAME_TWO_LOGO_IDX,
-                      GAME_TWO_LOGO_PAL);
-      }
-      if (dt >= 3000u){
-        goto_state(ST_PMODE);
-      }
-    } break;
-
-    case ST_PMODE: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_header("Mode: PVP", COL_WHITE);
-        ui_sep_h(18);
-      }
-      if (dt >= 3000u){
-        goto_state(ST_COUNTDOWN_LABEL);
-      }
-    } break;
-
-    case ST_COUNTDOWN_LABEL: {
-      if (g_dirty){
-        g_dirty = false;
-        char hdr[20];
-        snprintf(hdr, sizeof(hdr), "READY P%u?", (unsigned)g_player);
-        gfx_header(hdr, COL_WHITE);
-        ui_sep_h(18);
-      }
-      if (dt >= 2000u){
-        goto_state(ST_COUNT_3);
-      }
-    } break;
-
-    case ST_COUNT_3: {
-      gfx_header("3", COL_WHITE);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_COUNT_2);
-      }
-    } break;
-
-    case ST_COUNT_2: {
-      gfx_header("2", COL_YELLOW);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_COUNT_1);
-      }
-    } break;
-
-    case ST_COUNT_1: {
-      gfx_header("1", COL_GREEN);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_FLEX_CUE);
-      }
-    } break;
-
-    case ST_FLEX_CUE: {
-      gfx_header("FLEX!", COL_RED);
-      ui_sep_h(18);
-      if (dt >= 1000u){
-        goto_state(ST_FLEXING);
-      }
-    } break;
-
-    case ST_FLEXING: {
-      static float    sum_hz = 0.0f;
-      static uint32_t cnt_hz = 0u;
-
-      if (!g_drawn_once){
-        sum_hz       = 0.0f;
-        cnt_hz       = 0u;
-        g_drawn_once = true;
-        draw_flex_static(base);
-      }
-
-      const uint32_t FLEX_MS = 10000u;
-      if (dt >= FLEX_MS){
-        float    avg      = (cnt_hz > 0u) ? (sum_hz / (float)cnt_hz) : 0.0f;
-        float    pct250   = clampf(avg, 0.0f, 250.0f);
-        unsigned rank_pct = (unsigned)((pct250 * 100.0f / 250.0f) + 0.5f);
-
-        if (g_player == 1u){
-          g_p1_avg_hz   = avg;
-          g_p1_rank_pct = rank_pct;
-          g_player      = 2u;
-          g_drawn_once  = false;
-          intermission_begin(15000u, "GET READY P2");
-          return false;
-        } else {
-          g_p2_avg_hz   = avg;
-          g_p2_rank_pct = rank_pct;
-          g_drawn_once  = false;
-          goto_state(ST_RESULTS2);
-        }
-        break;
-      }
-
-      uint8_t remain_s = (uint8_t)((FLEX_MS - dt) / 1000u);
-      char hdr[24];
-      snprintf(hdr, sizeof(hdr), "FLEX: %u", (unsigned)remain_s);
-      gfx_header(hdr, COL_RED);
-
-      if (hz >= 1.5f){
-        sum_hz += hz;
-        cnt_hz++;
-      }
-
-      draw_flex_dynamic(hz);
-    } break;
-
-    case ST_RESULTS2: {
-      if (g_dirty){
-        g_dirty = false;
-        gfx_clear(COL_BLACK);
-        gfx_header("SCORES", COL_WHITE);
-        ui_sep_h(18);
-        ui_sep_h(60);
-
-        char l1[32];
-        snprintf(l1, sizeof(l1), "P1 Avg Hz: %.1f", g_p1_avg_hz);
-        gfx_text2(6, 28, l1, COL_BLUE, 1);
-        const char* r1 = rank_from_percent(g_p1_rank_pct);
-        char l1r[32];
-        snprintf(l1r, sizeof(l1r), "Rank: %s", r1);
-        gfx_text2(6, 38, l1r, COL_BLUE, 1);
-
-        char l2[32];
-        snprintf(l2, sizeof(l2), "P2 Avg Hz: %.1f", g_p2_avg_hz);
-        gfx_text2(6, 70, l2, COL_RED, 1);
-        const char* r2 = rank_from_percent(g_p2_rank_pct);
-        char l2r[32];
-        snprintf(l2r, sizeof(l2r), "Rank: %s", r2);
-        gfx_text2(6, 80, l2r, COL_RED, 1);
-      }
-      if (dt >= 5000u){
-        goto_state(ST_WINNER);
-      }
-    } break;
-
-    case ST_WINNER: {
-      if (!g_drawn_once){
-        g_drawn_once = true;
-        winner2_start(g_p1_avg_hz, g_p2_avg_hz);
-      }
-      if (winner2_tick()){
-        goto_state(ST_DECLARE);
-      }
-    } break;
-
-    case ST_DECLARE: {
-      if (!g_drawn_once){
-        g_drawn_once = true;
-        gfx_clear(COL_BLACK);
-        gfx_header("WINNER?", COL_RED);
-
-        if (g_p1_avg_hz > g_p2_avg_hz){
-          uint8_t x = (uint8_t)((128 - YOU_WIN_P1_PIC_W) / 2);
-          uint8_t y = (uint8_t)((128 - YOU_WIN_P1_PIC_H) / 2);
-
-          gfx_blit_pal4(x, y,
-                        YOU_WIN_P1_PIC_W, YOU_WIN_P1_PIC_H,
-                        YOU_WIN_P1_PIC_IDX,
-                        YOU_WIN_P1_PIC_PAL);
-        } else if (g_p2_avg_hz > g_p1_avg_hz){
-          uint8_t x = (uint8_t)((128 - YOU_WIN_P2_PIC_W) / 2);
-          uint8_t y = (uint8_t)((128 - YOU_WIN_P2_PIC_H) / 2);
-
-          gfx_blit_pal4(x, y,
-                        YOU_WIN_P2_PIC_W, YOU_WIN_P2_PIC_H,
-                        YOU_WIN_P2_PIC_IDX,
-                        YOU_WIN_P2_PIC_PAL);
-        } else {
-          uint8_t x = (uint8_t)((128 - PVP_TIE_PIC_W) / 2);
-          uint8_t y = (uint8_t)((128 - PVP_TIE_PIC_H) / 2);
-
-          gfx_blit_pal4(x, y,
-                        PVP_TIE_PIC_W, PVP_TIE_PIC_H,
-                        PVP_TIE_PIC_IDX,
-                        PVP_TIE_PIC_PAL);
-        }
-      }
-      // Pseudocode inside PVP result state
-      (void)cheevos_unlock(ACH_FIRST_WIN_PVP);
-      
-      if (dt >= 5000u){
-        goto_state(ST_RANKS2);
-      }
-    } break;
-
-    case ST_RANKS2: {
-      if (!g_drawn_once){
-        g_drawn_once = true;
-        gfx_clear(COL_BLACK);
-        gfx_header("RANKINGS", COL_RED);
-        ui_sep_h(18);
-
-        static const char* ranks[] = {
-          "Challenger 1%","Grandmaster 3%","Master 5%","Diamond 10%",
-          "Platinum 20%","Gold 35%","Silver 55%","Bronze 75%","Iron 100%"
-        };
-        const int base_y = 24;
-        const int row_h  = 10;
-
-        for (int i = 0; i < 9; ++i){
-          gfx_text2(0, base_y + i*row_h, ranks[i], COL_WHITE, 1);
-        }
-
-        int i1 = rank_index_from_percent(g_p1_rank_pct);
-        int i2 = rank_index_from_percent(g_p2_rank_pct);
-        if (i1 < 0) i1 = 0; if (i1 > 8) i1 = 8;
-        if (i2 < 0) i2 = 0; if (i2 > 8) i2 = 8;
-
-        for (int i = 0; i < 9; ++i){
-          uint16_t col =
-            (i == i1 && i == i2) ? COL_MAGENTA :
-            (i == i1)             ? COL_CYAN    :
-            (i == i2)             ? COL_YELLOW  :
-                                     COL_WHITE;
-          gfx_text2(0, base_y + i*row_h, ranks[i], col, 1);
-        }
-
-        gfx_text2(70, base_y + i1*row_h, "<-P1", COL_RED,    1);
-        gfx_text2(98, base_y + i2*row_h, "<-P2", COL_YELLOW, 1);
-      }
-
-      if (dt >= 6000u){
-        goto_state(ST_OVERALL_RANKS2);
-      }
-    } break;
-
-    case ST_OVERALL_RANKS2: {
-      if (!g_drawn_once){
-        g_drawn_once = true;
-
-        int i1 = rank_index_from_percent(g_p1_rank_pct);
-        int i2 = rank_index_from_percent(g_p2_rank_pct);
-        if (i1 < 0) i1 = 0; if (i1 > 8) i1 = 8;
-        if (i2 < 0) i2 = 0; if (i2 > 8) i2 = 8;
-
-        rankhist_add_two(1, i1);
-        rankhist_add_two(2, i2);
-
-        uint16_t h1[9], h2[9];
-        rankhist_get_two(h1, h2);
-
-        gfx_clear(COL_BLACK);
-        gfx_header("OVERALL RANKS", COL_WHITE);
-        ui_sep_h(18);
-
-        static const char* ranks[] = {
-          "Challenger","Grandmaster","Master","Diamond",
-          "Platinum","Gold","Silver","Bronze","Iron"
-        };
-
-        const int base_y = 24;
-        const int row_h  = 10;
-        for (int i = 0; i < 9; ++i){
-          char line[32];
-          snprintf(line, sizeof(line), "%-11s P1:%1u P2:%1u",
-                   ranks[i], (unsigned)h1[i], (unsigned)h2[i]);
-
-          uint16_t col =
-            (i == i1 && i == i2) ? COL_MAGENTA :
-            (i == i1)             ? COL_CYAN    :
-            (i == i2)             ? COL_YELLOW  :
-                                     COL_WHITE;
-
-          gfx_text2(0, base_y + i*row_h, line, col, 1);
-        }
-      }
-
-      if (dt >= 6000u){
-        return true;
-      }
-    } break;
+  gfx_text2(70, base_y + i1*row_h, "<-P1", COL_RED,    1);
+  gfx_text2(98, base_y + i2*row_h, "<-P2", COL_YELLOW, 1);
+}
+
+static void overall_enter(const scene_ctx_t *c){
+  (void)c;
+  int i1 = rank_index_from_percent(g_p1_rank_pct);
+  int i2 = rank_index_from_percent(g_p2_rank_pct);
+  if (i1 < 0) i1 = 0; if (i1 > 8) i1 = 8;
+  if (i2 < 0) i2 = 0; if (i2 > 8) i2 = 8;
+
+  rankhist_add_two(1, i1);
+  rankhist_add_two(2, i2);
+
+  uint16_t h1[9], h2[9];
+  rankhist_get_two(h1, h2);
+
+  gfx_clear(COL_BLACK);
+  gfx_header("OVERALL RANKS", COL_WHITE);
+  ui_sep_h(18);
+
+  static const char* ranks[] = {
+    "Challenger","Grandmaster","Master","Diamond",
+    "Platinum","Gold","Silver","Bronze","Iron"
+  };
+
+  const int base_y = 24;
+  const int row_h  = 10;
+  for (int i = 0; i < 9; ++i){
+    char line[32];
+    snprintf(line, sizeof(line), "%-11s P1:%1u P2:%1u",
+             ranks[i], (unsigned)h1[i], (unsigned)h2[i]);
+
+    uint16_t col =
+      (i == i1 && i == i2) ? COL_MAGENTA :
+      (i == i1)             ? COL_CYAN    :
+      (i == i2)             ? COL_YELLOW  :
+                               COL_WHITE;
+
+    gfx_text2(0, base_y + i*row_h, line, col, 1);
+  }
+}
+
+// Countdown and flex scenes draw over the screen before them; only the
+// full-screen scenes fade.
+static const scene_t k_scenes[ST_SCENES] = {
+  //                       ms      next                flags       enter           tick          exit
+  [ST_LOGO]             = { 3000u, ST_PMODE,           SCENE_FADE, logo_enter,     NULL,         NULL         },
+  [ST_PMODE]            = { 3000u, ST_COUNTDOWN_LABEL, 0,          pmode_enter,    NULL,         pmode_exit   },
+  [ST_COUNTDOWN_LABEL]  = { 2000u, ST_COUNT_3,         0,          label_enter,    NULL,         NULL         },
+  SCENE_COUNTDOWN(ST_COUNT_3, ST_FLEXING),
+  [ST_FLEXING]          = {10000u, ST_RESULTS2,        0,          flexing_enter,  flexing_tick, flexing_exit },
+  [ST_RESULTS2]         = { 5000u, ST_WINNER,          SCENE_FADE, results_enter,  NULL,         NULL         },
+  [ST_WINNER]           = {    0u, ST_DECLARE,         SCENE_FADE, winner_enter,   NULL,         winner_exit  },
+  [ST_DECLARE]          = { 5000u, ST_RANKS2,          SCENE_FADE, declare_enter,  NULL,         NULL         },
+  [ST_RANKS2]           = { 6000u, ST_OVERALL_RANKS2,  SCENE_FADE, ranks_enter,    NULL,         NULL         },
+  [ST_OVERALL_RANKS2]   = { 6000u, SCENE_END,          SCENE_FADE, overall_enter,  NULL,         NULL         },
+};
+
+void game_two_init(void){
+  scene_start(&g_run, k_scenes, ST_SCENES, ST_LOGO, millis());
+}
+
+bool game_two_tick(void){
+  metrics_t m;
+  (void)metrics_read(&m);
+  for (uint8_t p = 0; p < 2u; p++){
+    g_hz[p]      = m.hz[pqueue_seat(p)];
+    g_base_hz[p] = m.base_hz[pqueue_seat(p)];
   }
 
-  return false;
+  return scene_tick(&g_run, millis());
 }
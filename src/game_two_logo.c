@@ -6,313 +6,159 @@ const uint16_t GAME_TWO_LOGO_PAL[GAME_TWO_LOGO_PAL_SIZE] = {
     0xA125, 0x19B3, 0x5B53, 0x298A, 0xD1C9, 0x4BBA, 0x9D7B, 0x9B44, 
 };
 
-const uint8_t GAME_TWO_LOGO_IDX[(GAME_TWO_LOGO_W * GAME_TWO_LOGO_H) / 2] = {
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x22, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 
-    0x00, 0x00, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x33, 0x33, 0x3E, 0x00, 
-    0x00, 0x05, 0x33, 0x33, 0x0E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0x00, 0x53, 0x33, 0x3D, 0xE0, 
-    0x00, 0x05, 0x33, 0x33, 0xD4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xA4, 0x53, 0x33, 0x3A, 0x4E, 
-    0x00, 0x03, 0x33, 0x3C, 0xD4, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x53, 0x33, 0x30, 0x4E, 
-    0xE1, 0x03, 0x33, 0x35, 0x74, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x74, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x1E, 0x03, 0x33, 0x3C, 0xDD, 0x40, 0x33, 0x33, 0x00, 0x03, 0x33, 0x30, 0x4E, 
-    0xE1, 0x03, 0x33, 0x30, 0x04, 0x33, 0x33, 0xCD, 0xDD, 0xA3, 0x33, 0x35, 0x74, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x1E, 0xD7, 0xA3, 0x33, 0x3C, 0x77, 0x40, 0x33, 0x33, 0x00, 0x03, 0x33, 0x35, 0x74, 
-    0xE1, 0x53, 0x33, 0x30, 0x0E, 0x33, 0x33, 0xCD, 0x44, 0x03, 0x33, 0x35, 0x74, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0xD6, 0x77, 0xA3, 0x33, 0x3C, 0x77, 0x70, 0x33, 0x33, 0x00, 0xE3, 0x33, 0x3C, 0xD4, 
-    0x01, 0x53, 0x33, 0x3A, 0x4E, 0xC3, 0x33, 0xCD, 0x4E, 0x03, 0x33, 0x35, 0x74, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x16, 0x77, 0x77, 0xD3, 0x33, 0x35, 0x77, 0x00, 0x33, 0x33, 0x00, 0xE5, 0x33, 0x33, 0xD4, 
-    0x00, 0x53, 0x33, 0x3D, 0x4E, 0xC3, 0x33, 0xCD, 0x4E, 0x03, 0x33, 0x35, 0x74, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x66, 0x77, 0xDD, 0xD3, 0x33, 0x35, 0x04, 0x40, 0x33, 0x33, 0x04, 0xE5, 0x33, 0x33, 0xA4, 
-    0xE0, 0x33, 0x33, 0xCD, 0x4E, 0xC3, 0x33, 0xCD, 0x4E, 0x03, 0x33, 0x35, 0x74, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x1A, 0x97, 0x77, 0xD4, 0x43, 0x33, 0x35, 0x04, 0x00, 0x33, 0x33, 0x04, 0xE0, 0x33, 0x33, 0x04, 
-    0xE0, 0x33, 0x33, 0x50, 0x4E, 0xC3, 0x33, 0xCD, 0x4E, 0x03, 0x33, 0x35, 0x04, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0xE9, 0x67, 0x7D, 0xD4, 0x43, 0x33, 0x35, 0x04, 0x00, 0x33, 0x33, 0x04, 0xE0, 0x33, 0x33, 0x04, 
-    0xE0, 0x33, 0x33, 0x00, 0xEE, 0xC3, 0x33, 0xCD, 0x4E, 0x03, 0x33, 0x35, 0x04, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0xA9, 0x67, 0x7D, 0x44, 0x43, 0x33, 0x35, 0x04, 0x00, 0x33, 0x33, 0x04, 0xE0, 0x33, 0x33, 0x54, 
-    0x45, 0x33, 0x33, 0x04, 0xEE, 0x03, 0x33, 0xCD, 0x4E, 0x03, 0x33, 0x35, 0x04, 0xE1, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x96, 0x67, 0x7D, 0x44, 0x43, 0x33, 0x35, 0x04, 0x45, 0x33, 0x33, 0x04, 0xEE, 0x03, 0x33, 0xCD, 
-    0x45, 0x33, 0x33, 0xD4, 0xEE, 0x03, 0x33, 0xCD, 0x4E, 0x53, 0x33, 0x35, 0x04, 0xE1, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1E, 
-    0x96, 0x67, 0xDD, 0x44, 0x43, 0x33, 0x35, 0x00, 0x33, 0x33, 0x33, 0x04, 0xE0, 0x53, 0x33, 0x3D, 
-    0x45, 0x33, 0x33, 0xD4, 0xE1, 0x03, 0x33, 0xCD, 0x03, 0x33, 0x33, 0x35, 0x04, 0xE1, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x1E, 0xE0, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x10, 0x01, 0x11, 0x14, 
-    0x96, 0x67, 0xDD, 0x44, 0x43, 0x33, 0x3C, 0xC3, 0x33, 0x33, 0x33, 0x04, 0xE0, 0x53, 0x33, 0x3A, 
-    0x43, 0x33, 0x35, 0x74, 0xE1, 0x53, 0x33, 0x3C, 0x33, 0x33, 0x33, 0x35, 0x0E, 0xE1, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x1E, 0xD7, 0x70, 0x4E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 
-    0x96, 0x67, 0x7D, 0x44, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3C, 0xA4, 0xE0, 0x03, 0x33, 0x30, 
-    0xD3, 0x33, 0x35, 0x04, 0xE1, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x0E, 0xE1, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x1D, 0x74, 0x44, 0x40, 0x4E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 
-    0x96, 0x67, 0x7D, 0x44, 0x43, 0x33, 0x33, 0x33, 0x33, 0x3C, 0xA7, 0x74, 0xE0, 0x03, 0x33, 0x30, 
-    0x03, 0x33, 0x30, 0x0E, 0xE1, 0x53, 0x33, 0x33, 0x33, 0x33, 0x30, 0xD7, 0x4E, 0xE1, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x01, 0x16, 0x7D, 0x44, 0x44, 0x40, 0x40, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 
-    0x99, 0x67, 0x7D, 0x44, 0x43, 0x33, 0x33, 0x33, 0x3C, 0x07, 0x77, 0x7E, 0xE1, 0x13, 0x33, 0x35, 
-    0x03, 0x33, 0x30, 0x4E, 0x01, 0x53, 0x33, 0x33, 0x33, 0x30, 0xD0, 0x40, 0x00, 0x00, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x01, 0x16, 0x67, 0xD4, 0x44, 0x44, 0x04, 0x0E, 0x44, 0xEE, 0x01, 0x11, 0x11, 0x1E, 
-    0x99, 0x96, 0x77, 0xD4, 0xD3, 0x33, 0x33, 0x33, 0x07, 0x77, 0x77, 0xD1, 0x11, 0x15, 0x33, 0x3C, 
-    0xC3, 0x33, 0x3D, 0x4E, 0x01, 0xC3, 0x33, 0x33, 0x30, 0xA7, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x00, 0x00, 0x01, 0x1A, 0x96, 0x67, 0x44, 0x40, 0x44, 0x04, 0x00, 0x04, 0x44, 0xE1, 0x11, 0x11, 
-    0x99, 0x96, 0x77, 0xD4, 0xD3, 0x33, 0x33, 0x07, 0x77, 0x77, 0x77, 0xE1, 0x11, 0x15, 0x33, 0x33, 
-    0x33, 0x33, 0xCD, 0x4E, 0x11, 0xC3, 0x33, 0x30, 0xD7, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x00, 0x00, 0x01, 0x1E, 0x66, 0x66, 0x77, 0x74, 0x47, 0x40, 0x0E, 0x42, 0x2A, 0xDE, 0x11, 0x11, 
-    0xA9, 0x99, 0x67, 0x77, 0xD3, 0x33, 0x3C, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x10, 0x33, 0x33, 
-    0x33, 0x33, 0x50, 0x4E, 0x11, 0x53, 0x33, 0xC4, 0x72, 0x00, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x0F, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x00, 0x00, 0x01, 0x11, 0xE9, 0x66, 0x66, 0x7D, 0x7D, 0xAB, 0x22, 0x22, 0x22, 0x26, 0x01, 0x11, 
-    0xE9, 0x99, 0x96, 0x77, 0xD3, 0x33, 0x3C, 0x77, 0x77, 0x77, 0x7E, 0x11, 0x11, 0x10, 0x33, 0x33, 
-    0x33, 0x33, 0x00, 0xEE, 0x11, 0x53, 0x33, 0xC7, 0x60, 0x20, 0x2A, 0xAA, 0xA0, 0x00, 0x0A, 0xA2, 
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x00, 0x00, 0x01, 0x11, 0x10, 0x96, 0x66, 0x66, 0x77, 0x44, 0xA2, 0x22, 0x22, 0x22, 0x11, 0x11, 
-    0x1A, 0x99, 0x99, 0x67, 0xA3, 0x33, 0x3C, 0x77, 0x77, 0x77, 0xA1, 0x11, 0x11, 0x10, 0x33, 0x33, 
-    0x33, 0x33, 0x04, 0xEE, 0x11, 0x53, 0x33, 0x37, 0x66, 0x22, 0x22, 0x2A, 0x00, 0x00, 0x00, 0xAA, 
-    0xA2, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x0B, 0x96, 0x66, 0x67, 0xD4, 0xDB, 0xB2, 0x22, 0x22, 0x20, 0x11, 
-    0x11, 0xA9, 0x99, 0x97, 0xA3, 0x33, 0x3C, 0x77, 0x77, 0x76, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 
-    0x33, 0x33, 0xD4, 0xE0, 0x11, 0x53, 0x33, 0x37, 0x66, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0xAA, 
-    0xA2, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x1E, 0xBB, 0xB9, 0x66, 0x7D, 0x9B, 0x00, 0xB2, 0x22, 0x02, 0x00, 
-    0x11, 0xE9, 0x99, 0x99, 0x03, 0x33, 0x3C, 0x77, 0x76, 0x60, 0x11, 0x11, 0x11, 0x11, 0x53, 0x33, 
-    0x33, 0x33, 0xD4, 0xE1, 0x11, 0x53, 0x33, 0x37, 0x66, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0xAA, 
-    0xAA, 0x2A, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x16, 0xBB, 0x66, 0x66, 0x99, 0xBB, 0x00, 0xB0, 0x0F, 0x00, 
-    0x00, 0xA9, 0x69, 0x99, 0x03, 0x33, 0x3C, 0x77, 0x9A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x53, 0x33, 
-    0x33, 0x3C, 0x44, 0xE1, 0x11, 0x53, 0x33, 0x37, 0x66, 0x22, 0x22, 0xA0, 0x00, 0x00, 0xAA, 0xAA, 
-    0xAA, 0x2A, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0xAB, 0xB6, 0x76, 0x99, 0x99, 0x96, 0x9B, 0xB0, 0x0F, 
-    0x00, 0x00, 0x09, 0x99, 0x03, 0x33, 0x3C, 0x77, 0x41, 0x12, 0x20, 0x01, 0x10, 0x01, 0x03, 0x33, 
-    0x33, 0x35, 0x0E, 0xE1, 0x11, 0x53, 0x33, 0x37, 0x66, 0x22, 0x22, 0xA0, 0x00, 0x0A, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1E, 0xBB, 0x96, 0x69, 0x69, 0x79, 0xB9, 0x66, 0xA2, 
-    0x00, 0xF0, 0x00, 0x69, 0xB3, 0x33, 0x35, 0x7E, 0x11, 0x00, 0xB2, 0x00, 0x0F, 0x01, 0x03, 0x33, 
-    0x33, 0x30, 0x4E, 0x01, 0x11, 0x53, 0x33, 0x36, 0xA2, 0x22, 0x22, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x16, 0xBB, 0xBB, 0x9B, 0xBB, 0x97, 0x44, 0x4D, 
-    0x60, 0x20, 0xF0, 0x00, 0x23, 0x33, 0x35, 0x4E, 0x01, 0x20, 0x2B, 0x20, 0xFF, 0x01, 0x03, 0x33, 
-    0x33, 0x30, 0x4E, 0x01, 0x11, 0x53, 0x33, 0x36, 0xA2, 0x88, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0x2A, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0xBB, 0xBB, 0xB6, 0xD4, 0x44, 0x44, 
-    0x77, 0x76, 0xA2, 0xF0, 0x03, 0x33, 0x3C, 0x74, 0x12, 0xB2, 0x02, 0xB2, 0x00, 0x01, 0x13, 0x33, 
-    0x33, 0x3D, 0x4E, 0x01, 0x11, 0x33, 0x33, 0x36, 0x90, 0x00, 0x0F, 0x0A, 0xAA, 0xAA, 0xA0, 0x00, 
-    0x2A, 0x2A, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x20, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x69, 0x99, 0x96, 0x7D, 0x44, 0x44, 
-    0x44, 0x4D, 0x76, 0x62, 0x2F, 0x00, 0x0A, 0x77, 0xE2, 0xB2, 0x00, 0x20, 0x20, 0x00, 0x10, 0x00, 
-    0x00, 0x0D, 0x4E, 0x11, 0x11, 0x00, 0x00, 0x06, 0xA0, 0x80, 0x0F, 0xAA, 0xAA, 0xA2, 0x00, 0x00, 
-    0x02, 0x20, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x99, 0x96, 0x7D, 0xD4, 0x44, 
-    0x44, 0x44, 0x44, 0x4D, 0x60, 0x0A, 0xA0, 0x47, 0xA2, 0xB2, 0x20, 0x22, 0x2B, 0x00, 0x01, 0x0E, 
-    0x44, 0x44, 0xEE, 0x11, 0x11, 0x10, 0x66, 0x6A, 0xA0, 0x80, 0x0F, 0xAA, 0xAA, 0xA2, 0xFF, 0x00, 
-    0x00, 0x20, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x96, 0x66, 0xDD, 0xD4, 
-    0x44, 0x44, 0x44, 0x44, 0xA6, 0x96, 0xA2, 0x00, 0x00, 0x2B, 0xB2, 0x22, 0x20, 0x00, 0x00, 0x01, 
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x20, 0x00, 0x00, 0xFF, 0xFF, 0x22, 0x22, 0xA0, 0xFF, 0xF0, 
-    0x00, 0x20, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x66, 0x66, 0x74, 
-    0x44, 0x44, 0x44, 0xE4, 0x66, 0x99, 0x66, 0xA2, 0xF0, 0x00, 0x2B, 0xB0, 0x22, 0x2B, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xF8, 0x8F, 0x00, 0x02, 0x22, 0x22, 0x20, 0xFF, 0xFF, 
-    0xF2, 0x2E, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x02, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x67, 0xD4, 
-    0x44, 0x44, 0x44, 0xE0, 0x00, 0x69, 0x96, 0x66, 0x62, 0xF0, 0x00, 0x20, 0xB0, 0x20, 0x0F, 0xF0, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xF8, 0x8F, 0x00, 0x00, 0x22, 0x22, 0x2B, 0x00, 0x00, 
-    0x02, 0x21, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA9, 0x99, 0x67, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x20, 0x00, 0xAA, 0x66, 0x60, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x2F, 0xFF, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xF0, 0x8F, 0x20, 0x22, 0x22, 0x22, 0x22, 0xB0, 0x00, 
-    0x22, 0x21, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA9, 0x96, 0x6D, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x62, 0xF0, 0x00, 0x00, 0x6B, 0xB0, 0xBB, 0x20, 0x00, 0x02, 0xB0, 0x0F, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2F, 0xF0, 0x8F, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x02, 
-    0x22, 0x21, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x96, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0xA9, 0xB2, 0xF0, 0x00, 0x00, 0x0B, 0x99, 0x66, 0x22, 0x00, 0x00, 0x0F, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0F, 0xF0, 0x8F, 0xBB, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x0F, 
-    0xFF, 0xF0, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x66, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x6B, 0xAA, 0x20, 0xFF, 0x00, 0x06, 0x9A, 0xAA, 0x69, 0x00, 0xF0, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0xFF, 0x00, 0x22, 0x20, 0x0F, 0xFF, 0xFF, 0xF8, 
-    0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x96, 0x66, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x6B, 0x0A, 0xBA, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0xA6, 0x60, 0xB2, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0x80, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x96, 0x67, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x4D, 0x6B, 0x1A, 0xB6, 0x62, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x92, 0x02, 0x0F, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x08, 0x88, 0x88, 0x51, 
-    0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE9, 0x66, 0x66, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x4D, 0x96, 0x1A, 0xB6, 0x66, 0x92, 0x20, 0xF0, 0x00, 0x20, 0x6B, 0x02, 0x0F, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x08, 0x83, 0xCC, 0x50, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x00, 0x01, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE9, 0x66, 0x67, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x4A, 0xBA, 0x10, 0xB6, 0x69, 0x9B, 0xB9, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x08, 0x88, 0x08, 0x88, 
-    0x88, 0xC0, 0x00, 0x0C, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA9, 0x66, 0x67, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x46, 0xB0, 0x1E, 0xB9, 0x96, 0x60, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 
-    0x00, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x88, 0x88, 0x0C, 0xC8, 0x88, 
-    0x88, 0x50, 0x00, 0x00, 0xC0, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA9, 0x66, 0x67, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x46, 0xB1, 0x11, 0x99, 0x96, 0x6B, 0x0B, 0xB0, 0x2A, 0x00, 0x00, 0x0B, 0x0F, 
-    0xF0, 0x08, 0xC5, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x88, 0x88, 0x0C, 0xCC, 0xC8, 
-    0x88, 0x50, 0x00, 0x00, 0x0C, 0x51, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x69, 0x66, 0x67, 0x7D, 0x44, 
-    0x44, 0x44, 0x44, 0x46, 0x61, 0x11, 0xA9, 0x66, 0x9B, 0xB0, 0xB9, 0x99, 0x92, 0xF0, 0x00, 0x00, 
-    0xF0, 0x85, 0x55, 0x55, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x08, 0x88, 0x80, 0xC5, 0x55, 0x50, 
-    0x88, 0x05, 0x50, 0x00, 0x00, 0xC5, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x96, 0x67, 0x7D, 0xD4, 
-    0x44, 0x44, 0x44, 0xD6, 0xA1, 0x11, 0x09, 0x66, 0x9B, 0x0B, 0x0B, 0xBB, 0xBB, 0xBB, 0xB0, 0x00, 
-    0x08, 0x05, 0x55, 0x55, 0x51, 0x11, 0x11, 0x11, 0x00, 0x00, 0x88, 0x88, 0x0C, 0x55, 0x00, 0x05, 
-    0x88, 0x88, 0xCC, 0x55, 0x00, 0x05, 0xC0, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x66, 0x67, 0x7D, 0xD4, 
-    0x44, 0x44, 0x44, 0xD9, 0xA1, 0x11, 0x19, 0x96, 0x9B, 0x0B, 0xB0, 0xBB, 0xB0, 0xBB, 0x20, 0x20, 
-    0x08, 0x0C, 0x55, 0x55, 0xC0, 0x11, 0x11, 0x11, 0x00, 0x88, 0x88, 0x88, 0x05, 0x50, 0x00, 0x00, 
-    0xC8, 0x88, 0x88, 0x8C, 0x50, 0x00, 0x05, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x96, 0x67, 0x77, 0xDD, 
-    0x44, 0x44, 0x44, 0xD9, 0xA1, 0x11, 0x1A, 0x99, 0x9B, 0x0B, 0x0B, 0xB0, 0xBB, 0xBB, 0x20, 0x20, 
-    0x88, 0x8C, 0x55, 0x55, 0xC1, 0x11, 0x11, 0x10, 0x88, 0x88, 0x88, 0x88, 0x05, 0x50, 0x00, 0x00, 
-    0x58, 0x88, 0x88, 0x88, 0x05, 0x00, 0x00, 0x50, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x96, 0x67, 0x77, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xA9, 0xA1, 0x11, 0x11, 0xBB, 0xBB, 0xB0, 0xBB, 0xBB, 0xBB, 0xBB, 0x22, 0x20, 
-    0xF8, 0x8C, 0xC5, 0x55, 0x01, 0x11, 0x11, 0x10, 0x88, 0x88, 0x88, 0x88, 0x05, 0x50, 0x00, 0x00, 
-    0x05, 0x88, 0x88, 0x88, 0x80, 0x55, 0x00, 0x05, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x96, 0x66, 0x77, 0x7D, 
-    0xDD, 0xDD, 0xDD, 0x69, 0xA1, 0x11, 0x11, 0x10, 0xBB, 0xB0, 0xBB, 0xBB, 0xBB, 0xB0, 0x22, 0x20, 
-    0xF8, 0x88, 0xCC, 0xCC, 0x02, 0x01, 0x11, 0x10, 0x80, 0xC8, 0x88, 0x88, 0x05, 0x55, 0x00, 0x00, 
-    0x05, 0xC8, 0x88, 0x88, 0x88, 0x05, 0x00, 0x00, 0x50, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x96, 0x66, 0x77, 0x7D, 
-    0xDD, 0xDD, 0xDD, 0x69, 0xA1, 0x11, 0x11, 0x11, 0xB0, 0x00, 0xBB, 0xBB, 0xBB, 0xB0, 0x22, 0x2F, 
-    0xF8, 0x88, 0x83, 0xC0, 0x00, 0x02, 0x01, 0x08, 0x05, 0x58, 0x88, 0x88, 0x8C, 0x55, 0x55, 0x00, 
-    0x55, 0x5C, 0x88, 0x80, 0x08, 0x80, 0x50, 0x00, 0x05, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x99, 0x66, 0x77, 0x77, 
-    0x7D, 0xDD, 0xDD, 0x69, 0xA1, 0x11, 0x11, 0x11, 0x20, 0x00, 0xBB, 0xB0, 0x00, 0x00, 0x22, 0x20, 
-    0x0F, 0x88, 0x88, 0x88, 0x00, 0x00, 0x02, 0x00, 0xC5, 0x50, 0x88, 0x88, 0x80, 0xC5, 0x55, 0x55, 
-    0x55, 0x55, 0xC0, 0x88, 0x10, 0x88, 0x85, 0x00, 0x05, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x99, 0x66, 0x67, 0x77, 
-    0x77, 0x7D, 0xD7, 0x69, 0xA1, 0x11, 0x11, 0x11, 0x20, 0xBB, 0xBB, 0x00, 0x22, 0x22, 0x22, 0x20, 
-    0xF0, 0x00, 0x88, 0x88, 0xC0, 0x00, 0x00, 0xB2, 0x05, 0x50, 0x80, 0x08, 0x88, 0xC5, 0x55, 0x55, 
-    0x55, 0x55, 0xCC, 0xC8, 0x01, 0x08, 0x88, 0xC5, 0x50, 0x50, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x99, 0x99, 0x66, 0x66, 0x77, 
-    0x77, 0x77, 0x76, 0x69, 0xA1, 0x11, 0x11, 0x11, 0x00, 0x0B, 0xB0, 0x02, 0x22, 0x22, 0x22, 0x20, 
-    0x00, 0x10, 0x08, 0x80, 0x55, 0xC0, 0x00, 0x00, 0xB2, 0x00, 0x01, 0x08, 0x88, 0x0C, 0x55, 0x55, 
-    0x55, 0x55, 0x5C, 0xC8, 0x51, 0x10, 0x88, 0x8C, 0x50, 0x05, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x99, 0x99, 0x66, 0x66, 0x66, 
-    0x77, 0x77, 0x76, 0x69, 0xA1, 0x11, 0x11, 0x11, 0x12, 0xB0, 0x00, 0x22, 0x22, 0x22, 0x22, 0x20, 
-    0x01, 0x11, 0x00, 0x88, 0x55, 0x55, 0x08, 0x00, 0x0B, 0xB0, 0x01, 0x10, 0x88, 0x8C, 0x55, 0x55, 
-    0x55, 0x55, 0x5C, 0xCC, 0x51, 0x11, 0x00, 0x50, 0x00, 0x05, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE6, 0x99, 0x96, 0x66, 0x66, 0x66, 
-    0x67, 0x77, 0x76, 0x69, 0x91, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 
-    0x11, 0x11, 0x10, 0x88, 0x05, 0x55, 0x55, 0xC0, 0x00, 0x0B, 0xB2, 0x00, 0x88, 0x8C, 0xC5, 0x55, 
-    0x55, 0x55, 0x55, 0xCC, 0x01, 0x10, 0x50, 0x00, 0x00, 0x05, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xA6, 0x66, 0x67, 0x76, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x9A, 0x11, 0x11, 0x11, 0x11, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 
-    0x11, 0x11, 0x11, 0x08, 0x80, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0xB2, 0x08, 0x8C, 0xC5, 0x55, 
-    0x55, 0x55, 0x55, 0xCC, 0xC5, 0x0C, 0x00, 0x00, 0x00, 0x55, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x67, 0x77, 0x47, 0x76, 0x66, 
-    0x66, 0x66, 0x67, 0x66, 0x66, 0xE1, 0x11, 0x11, 0x11, 0x10, 0x02, 0x22, 0x22, 0x22, 0x20, 0x01, 
-    0x11, 0x11, 0x11, 0x10, 0x80, 0x05, 0x55, 0x55, 0x5C, 0x50, 0x20, 0x0B, 0x02, 0x00, 0xC5, 0x55, 
-    0x55, 0x55, 0x5C, 0xC5, 0x50, 0x55, 0x00, 0x00, 0x55, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x96, 0x67, 0x04, 0x44, 0x06, 0x66, 
-    0x66, 0x66, 0x77, 0xDD, 0x77, 0xA1, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x08, 0x80, 0x05, 0x55, 0xC0, 0x11, 0x10, 0x20, 0x0B, 0x02, 0x05, 0x55, 
-    0x55, 0x50, 0x55, 0x05, 0xC5, 0x50, 0x00, 0x55, 0x50, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x96, 0x74, 0x44, 0x44, 0x47, 0x66, 
-    0x66, 0x67, 0x74, 0x44, 0x4D, 0x6E, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x20, 0x0F, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x80, 0x00, 0x80, 0x11, 0x11, 0x10, 0x20, 0xBB, 0x02, 0x05, 
-    0x55, 0x55, 0x55, 0xCC, 0x55, 0x55, 0x55, 0xC0, 0x80, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x67, 0x74, 0x44, 0x44, 0x47, 0x66, 
-    0x66, 0x67, 0x44, 0x44, 0x44, 0x7A, 0x11, 0x11, 0x11, 0x11, 0x10, 0x22, 0x22, 0x2F, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x88, 0x01, 0x11, 0x11, 0x11, 0x00, 0x0B, 0xBB, 0x02, 
-    0xCC, 0x55, 0x5C, 0x55, 0x55, 0x55, 0x08, 0x80, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x11, 0x11, 0xE9, 0x67, 0xD4, 0x44, 0x44, 0x07, 0x99, 
-    0x99, 0x67, 0x44, 0x44, 0x44, 0x47, 0xE1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0xF0, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x08, 0x80, 0x0B, 0x08, 
-    0xC0, 0x00, 0x00, 0x55, 0x5C, 0x88, 0x05, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x11, 0x11, 0xA9, 0x77, 0x44, 0x44, 0x44, 0x7D, 0xE9, 
-    0x99, 0x97, 0x74, 0x44, 0x44, 0x44, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x8C, 0xC0, 0x0C, 
-    0x00, 0x00, 0x00, 0x5C, 0x08, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x11, 0x66, 0x77, 0x44, 0x44, 0x40, 0x7E, 0x10, 
-    0xB9, 0x97, 0x70, 0x44, 0x44, 0x44, 0x7E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x80, 0xC5, 0x05, 
-    0x00, 0x00, 0x00, 0x58, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x1E, 0x97, 0x74, 0x44, 0x44, 0x40, 0x71, 0x11, 
-    0xA9, 0x96, 0x77, 0x04, 0x44, 0x44, 0x47, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x8C, 0xC5, 0x0C, 
-    0x50, 0x00, 0x05, 0x80, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x1A, 0x97, 0x74, 0x44, 0x44, 0x07, 0x41, 0x11, 
-    0x1A, 0x99, 0x67, 0x70, 0x44, 0x44, 0x47, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x80, 0xC5, 0xC8, 
-    0xC5, 0x55, 0x58, 0x00, 0x22, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x16, 0x67, 0xD4, 0x44, 0x44, 0x77, 0x11, 0x11, 
-    0x11, 0xA9, 0x67, 0x77, 0x44, 0x44, 0x44, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 0x80, 0xCC, 0x58, 
-    0x80, 0xC0, 0x88, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0xE9, 0x77, 0x44, 0x44, 0x40, 0x7D, 0x11, 0x11, 
-    0x11, 0x1A, 0x97, 0x77, 0x04, 0x44, 0x44, 0x7E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x88, 0x88, 0xCC, 0x55, 
-    0x88, 0x88, 0x80, 0x00, 0x02, 0xBB, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t GAME_TWO_LOGO_RLE[GAME_TWO_LOGO_RLE_SIZE] = {
+    0xF2, 0x2A, 0xF0, 0x29, 0xF2, 0x45, 0x7F, 0xF2, 0x37, 0x7F, 0xF2, 0x1A, 0x00, 0x00, 0xD2, 0xF0, 
+    0x02, 0x7F, 0xF2, 0x1E, 0xC0, 0x05, 0x22, 0x20, 0x02, 0xF0, 0x04, 0x01, 0x22, 0xB0, 0x01, 0x22, 
+    0x7F, 0xF2, 0x0F, 0x00, 0x00, 0x48, 0x01, 0x02, 0xF0, 0x10, 0x7F, 0xF2, 0x0E, 0x01, 0x00, 0x4A, 
+    0xF0, 0x42, 0xF2, 0x19, 0xE0, 0x58, 0xF5, 0x02, 0xA0, 0xB5, 0xD0, 0xA5, 0x01, 0x00, 0xF5, 0x02, 
+    0x6D, 0xF0, 0x03, 0x01, 0x22, 0xF0, 0x0E, 0xF3, 0x03, 0x02, 0x00, 0x00, 0xB3, 0x00, 0xE0, 0xB0, 
+    0x00, 0x50, 0xA3, 0x01, 0x0E, 0xF3, 0x03, 0xF0, 0x05, 0xF2, 0x16, 0xF0, 0x04, 0x63, 0x03, 0xC0, 
+    0x05, 0xA3, 0x01, 0xDE, 0x47, 0x01, 0xD4, 0xF3, 0x04, 0x68, 0xF0, 0x06, 0x00, 0x20, 0xF0, 0x0F, 
+    0xF3, 0x04, 0x01, 0xA4, 0x43, 0x05, 0xA4, 0xE0, 0x00, 0xA3, 0x00, 0xC0, 0x4E, 0x00, 0x40, 0x65, 
+    0xF0, 0x1D, 0x01, 0x11, 0x4C, 0x01, 0x00, 0x43, 0x04, 0x04, 0xEE, 0x10, 0x43, 0x01, 0x57, 0x4C, 
+    0x02, 0x57, 0x40, 0x7F, 0xE0, 0xA1, 0x00, 0xE0, 0x43, 0x04, 0xCD, 0xD4, 0x00, 0x44, 0x00, 0x00, 
+    0x4C, 0x01, 0x00, 0x43, 0x04, 0xCD, 0xDD, 0xA0, 0x7F, 0xF0, 0x04, 0xA1, 0x03, 0xED, 0x7A, 0x43, 
+    0x01, 0x77, 0x4B, 0x05, 0x57, 0x4E, 0x15, 0x44, 0x00, 0xE0, 0x44, 0x02, 0x44, 0x00, 0x45, 0x00, 
+    0xE0, 0x7F, 0x46, 0x02, 0xD6, 0x70, 0x47, 0x00, 0x70, 0x45, 0x00, 0xE0, 0xA3, 0x03, 0xCD, 0x40, 
+    0x44, 0x03, 0xA4, 0xEC, 0x44, 0x00, 0xE0, 0x7F, 0xF0, 0x04, 0x03, 0x11, 0x16, 0xA7, 0x00, 0xD0, 
+    0xA3, 0x03, 0x57, 0x70, 0x46, 0x00, 0x50, 0xA3, 0x03, 0xD4, 0x00, 0x43, 0x00, 0xD0, 0x7F, 0xF0, 
+    0x0D, 0x08, 0x11, 0x16, 0x67, 0x7D, 0xD0, 0x44, 0x02, 0x04, 0x40, 0x44, 0x00, 0x40, 0x44, 0x03, 
+    0xA4, 0xE0, 0xA3, 0x00, 0xC0, 0x5C, 0xB0, 0x72, 0x0A, 0x11, 0x1A, 0x97, 0x77, 0xD4, 0x40, 0x45, 
+    0x00, 0x00, 0x46, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x45, 0x01, 0x50, 0x4E, 0x00, 0x00, 0x49, 0xE0, 
+    0x72, 0x05, 0xE9, 0x67, 0x7D, 0x5E, 0x02, 0x00, 0xE0, 0x61, 0x00, 0x00, 0x6E, 0x03, 0x11, 0x1A, 
+    0x43, 0x00, 0x40, 0x55, 0x03, 0x54, 0x45, 0x43, 0x03, 0x4E, 0xE0, 0x4E, 0x00, 0x10, 0xF0, 0x09, 
+    0x6F, 0x02, 0x09, 0x60, 0x4C, 0x01, 0x45, 0x45, 0x06, 0xE0, 0x33, 0x3C, 0xD0, 0x44, 0x00, 0xD0, 
+    0x49, 0x00, 0x50, 0x47, 0x01, 0x11, 0xF0, 0x09, 0x57, 0xC1, 0xF0, 0x04, 0x03, 0x11, 0x1E, 0x42, 
+    0x00, 0xD0, 0x48, 0x00, 0x00, 0xC3, 0x04, 0x04, 0xE0, 0x50, 0xA3, 0x48, 0x00, 0x10, 0x44, 0x00, 
+    0x00, 0xC3, 0x45, 0x01, 0x11, 0xF0, 0x08, 0x54, 0x04, 0x11, 0xEE, 0x00, 0xC1, 0xB0, 0x03, 0x11, 
+    0x00, 0xA1, 0x00, 0x40, 0x4B, 0x01, 0xCC, 0xD3, 0x47, 0x01, 0xA4, 0xA3, 0x05, 0x57, 0x4E, 0x15, 
+    0xA3, 0x00, 0xC0, 0xD3, 0x02, 0x50, 0xE0, 0x44, 0x00, 0x10, 0xF0, 0x08, 0x52, 0x07, 0x1E, 0xD7, 
+    0x70, 0x4E, 0xF1, 0x08, 0x00, 0xA0, 0x42, 0x00, 0x70, 0x46, 0xE3, 0x05, 0xCA, 0x4E, 0x00, 0xA3, 
+    0x01, 0x0D, 0x43, 0x00, 0x00, 0x46, 0xE3, 0x00, 0x00, 0x58, 0x00, 0x00, 0xB2, 0x00, 0x00, 0x4C, 
+    0x01, 0xD7, 0xA4, 0x02, 0x04, 0xE0, 0x61, 0x03, 0xCA, 0x77, 0x47, 0x00, 0x00, 0xA3, 0x02, 0x00, 
+    0xE0, 0x4B, 0x03, 0x0D, 0x74, 0x58, 0x02, 0x00, 0x00, 0x4D, 0x04, 0x11, 0x67, 0xD0, 0xB4, 0x02, 
+    0x04, 0x00, 0xF1, 0x04, 0x02, 0x49, 0x90, 0x4D, 0x01, 0xC0, 0xA7, 0x03, 0xEE, 0x11, 0xA3, 0x00, 
+    0x50, 0x44, 0x02, 0x4E, 0x00, 0x48, 0x03, 0x0D, 0x04, 0xB0, 0x58, 0xB0, 0x4B, 0x02, 0x67, 0xD0, 
+    0xB4, 0x08, 0x04, 0x0E, 0x44, 0xEE, 0x00, 0xC1, 0x09, 0xE9, 0x99, 0x67, 0x7D, 0x4D, 0xD3, 0x00, 
+    0x00, 0xB7, 0x00, 0xD0, 0xA1, 0x05, 0x53, 0x33, 0xCC, 0xA3, 0x00, 0xD0, 0x42, 0x00, 0xC0, 0xC3, 
+    0x03, 0x0A, 0x7A, 0xF0, 0x01, 0x5A, 0x00, 0x00, 0x49, 0x13, 0xA9, 0x66, 0x74, 0x44, 0x04, 0x40, 
+    0x40, 0x00, 0x44, 0x4E, 0xB1, 0x4C, 0x00, 0x00, 0xD7, 0x00, 0xE0, 0x46, 0xB3, 0x04, 0xCD, 0x4E, 
+    0x10, 0x44, 0x03, 0x0D, 0x7A, 0xF0, 0x02, 0x03, 0xF0, 0x11, 0xF0, 0x12, 0x48, 0x00, 0xE0, 0xA6, 
+    0x0F, 0x77, 0x74, 0x47, 0x40, 0x0E, 0x42, 0x2A, 0xDE, 0xA1, 0x07, 0xA9, 0x99, 0x67, 0x77, 0x43, 
+    0x00, 0xC0, 0xE7, 0xB1, 0x00, 0x00, 0xE3, 0x01, 0x50, 0x42, 0x07, 0x53, 0x33, 0xC4, 0x72, 0xB0, 
+    0xAA, 0xA0, 0x01, 0xF0, 0x5A, 0x00, 0x00, 0x47, 0x02, 0x1E, 0x90, 0xA6, 0x05, 0x7D, 0x7D, 0xAB, 
+    0xD2, 0x05, 0x60, 0x11, 0x1E, 0xA9, 0x00, 0x60, 0x4D, 0x00, 0xE0, 0x4C, 0x02, 0x00, 0xE0, 0x46, 
+    0x05, 0x76, 0x02, 0x02, 0xAA, 0xA0, 0x05, 0xAA, 0x20, 0x01, 0xF0, 0x13, 0x47, 0x02, 0x10, 0x90, 
+    0xB6, 0x04, 0x77, 0x44, 0xA0, 0xD2, 0xB1, 0x00, 0xA0, 0xA9, 0x02, 0x67, 0xA0, 0x49, 0x00, 0xA0, 
+    0xC1, 0x48, 0x00, 0x40, 0x46, 0x03, 0x37, 0x66, 0xB2, 0x00, 0xA0, 0xC0, 0x06, 0xAA, 0xA2, 0x01, 
+    0x10, 0x5E, 0x00, 0x00, 0xA1, 0x02, 0x0B, 0x90, 0xA6, 0x05, 0x7D, 0x4D, 0xBB, 0xC2, 0x00, 0x00, 
+    0xA1, 0x00, 0xA0, 0xA9, 0x4A, 0x00, 0x60, 0xE1, 0xE3, 0x03, 0xD4, 0xE0, 0x4D, 0xD0, 0x42, 0x03, 
+    0x20, 0x11, 0xF0, 0x17, 0xB1, 0x17, 0xEB, 0xBB, 0x96, 0x67, 0xD9, 0xB0, 0x0B, 0x22, 0x20, 0x20, 
+    0x01, 0x1E, 0xB9, 0x00, 0x00, 0x46, 0x02, 0x66, 0x00, 0xE1, 0x00, 0x50, 0x48, 0x00, 0x10, 0x57, 
+    0x05, 0xA2, 0xA1, 0x11, 0xF0, 0x17, 0xC1, 0x02, 0x6B, 0xB0, 0xA6, 0x09, 0x99, 0xBB, 0x00, 0xB0, 
+    0x0F, 0xA0, 0x02, 0xA9, 0x60, 0x49, 0x01, 0x9A, 0xF1, 0x01, 0x45, 0x01, 0xC4, 0x4F, 0x00, 0xA0, 
+    0xB0, 0xCA, 0x69, 0x06, 0x1A, 0xBB, 0x67, 0x60, 0xB9, 0x06, 0x69, 0xBB, 0x00, 0xF0, 0xB0, 0x49, 
+    0x0C, 0x41, 0x12, 0x20, 0x01, 0x10, 0x01, 0x00, 0xC3, 0x02, 0x50, 0xE0, 0x53, 0xFA, 0x00, 0x50, 
+    0xC2, 0xF0, 0x03, 0xD1, 0x19, 0xEB, 0xB9, 0x66, 0x96, 0x97, 0x9B, 0x96, 0x6A, 0x20, 0x0F, 0x00, 
+    0x06, 0x9B, 0xA3, 0x0C, 0x57, 0xE1, 0x10, 0x0B, 0x20, 0x00, 0xF0, 0x47, 0x03, 0x04, 0xE0, 0x46, 
+    0x01, 0x6A, 0xB2, 0x02, 0xA0, 0x00, 0xFA, 0x02, 0x50, 0xB0, 0x02, 0x22, 0x20, 0x4F, 0x02, 0x11, 
+    0x60, 0xAB, 0x12, 0x9B, 0xBB, 0x97, 0x44, 0x4D, 0x60, 0x20, 0xF0, 0x00, 0x20, 0x43, 0x0A, 0x4E, 
+    0x01, 0x20, 0x2B, 0x20, 0xF0, 0x57, 0x04, 0x88, 0xFF, 0x00, 0xFA, 0x02, 0x00, 0x20, 0x42, 0x00, 
+    0x10, 0xF0, 0x05, 0x01, 0x22, 0xB0, 0x02, 0x22, 0x20, 0x4F, 0x01, 0x10, 0xCB, 0x01, 0x6D, 0xB4, 
+    0x08, 0x77, 0x76, 0xA2, 0xF0, 0x00, 0xA3, 0x0F, 0xC7, 0x41, 0x2B, 0x20, 0x2B, 0x20, 0x00, 0x11, 
+    0xC3, 0x00, 0xD0, 0x44, 0xB3, 0x01, 0x69, 0xA0, 0x46, 0x03, 0x00, 0x02, 0x45, 0x00, 0x10, 0xF0, 
+    0x03, 0xE2, 0x01, 0x00, 0x51, 0x02, 0x1E, 0x60, 0xA9, 0x02, 0x67, 0xD0, 0xD4, 0x0D, 0xD7, 0x66, 
+    0x22, 0xF0, 0x00, 0xA7, 0x7E, 0x42, 0x07, 0x02, 0x02, 0x00, 0x01, 0xC0, 0x02, 0xD4, 0xE0, 0xA1, 
+    0xB0, 0x06, 0x6A, 0x08, 0x00, 0xF0, 0xBA, 0x00, 0x20, 0xB0, 0x05, 0x22, 0x01, 0x11, 0xF0, 0x06, 
+    0xF2, 0x01, 0x51, 0x02, 0x11, 0x40, 0x44, 0x00, 0xD0, 0xF4, 0x01, 0x18, 0xD6, 0x00, 0xAA, 0x04, 
+    0x7A, 0x2B, 0x22, 0x02, 0x22, 0xB0, 0x00, 0x10, 0xE0, 0xA4, 0x00, 0xE0, 0x43, 0x05, 0x10, 0x66, 
+    0x6A, 0x4A, 0x01, 0xFF, 0xA0, 0x54, 0x00, 0x00, 0x4C, 0xF1, 0x07, 0x07, 0x69, 0x66, 0x6D, 0xDD, 
+    0xF4, 0x00, 0x05, 0xA6, 0x96, 0xA2, 0xA0, 0x02, 0x2B, 0xB0, 0xA2, 0xC0, 0x01, 0x11, 0xB0, 0xC1, 
+    0x00, 0x20, 0xB0, 0xAF, 0xA2, 0x04, 0xA0, 0xFF, 0xF0, 0x55, 0xA0, 0xB2, 0xE0, 0xF1, 0x07, 0x02, 
+    0xE9, 0x90, 0xA6, 0x00, 0x70, 0xD4, 0x15, 0xE4, 0x66, 0x99, 0x66, 0xA2, 0xF0, 0x00, 0x2B, 0xB0, 
+    0x22, 0x2B, 0xA0, 0xF1, 0x03, 0x08, 0x2F, 0xF8, 0x8F, 0x00, 0x00, 0xC2, 0x42, 0x04, 0xFF, 0x22, 
+    0xE0, 0x58, 0x01, 0x02, 0xC0, 0xF1, 0x09, 0xA9, 0x02, 0x67, 0xD0, 0x46, 0x05, 0x00, 0x06, 0x99, 
+    0xA6, 0x0D, 0x2F, 0x00, 0x02, 0x0B, 0x02, 0x00, 0xFF, 0x54, 0x00, 0x00, 0xB2, 0x00, 0xB0, 0xB0, 
+    0x01, 0x22, 0xA1, 0xF0, 0x0B, 0xB2, 0xB0, 0xF1, 0x0A, 0x00, 0xA0, 0x43, 0xF4, 0x01, 0x08, 0x20, 
+    0x00, 0xAA, 0x66, 0x60, 0xE0, 0x07, 0x2B, 0x02, 0xFF, 0xF0, 0x4C, 0x04, 0x08, 0xF2, 0x00, 0xE2, 
+    0x04, 0xB0, 0x00, 0x20, 0x62, 0x00, 0x00, 0x53, 0x02, 0x66, 0xD0, 0xF4, 0x01, 0x02, 0x62, 0xF0, 
+    0xB0, 0x06, 0x6B, 0xB0, 0xBB, 0x20, 0xA0, 0x03, 0x2B, 0x00, 0x51, 0x02, 0x00, 0x00, 0xF2, 0x00, 
+    0x00, 0x00, 0xA2, 0x61, 0x00, 0x00, 0xF1, 0x08, 0x04, 0x99, 0x96, 0x70, 0x49, 0x04, 0xA9, 0xB2, 
+    0xF0, 0xC0, 0x06, 0xB9, 0x96, 0x62, 0x20, 0xB0, 0x4A, 0x01, 0x00, 0x43, 0x02, 0xBB, 0xB0, 0x48, 
+    0xAF, 0x00, 0x00, 0xA1, 0x6D, 0x03, 0xE9, 0x96, 0x4B, 0x14, 0x6B, 0xAA, 0x20, 0xFF, 0x00, 0x06, 
+    0x9A, 0xAA, 0x69, 0x00, 0xF0, 0xA0, 0xF1, 0x02, 0x0C, 0x00, 0x01, 0xFF, 0x00, 0x22, 0x20, 0x00, 
+    0xCF, 0x02, 0x80, 0x00, 0xD1, 0x5C, 0x00, 0x00, 0xF1, 0x06, 0x02, 0xA9, 0x60, 0x4E, 0x13, 0x0A, 
+    0xBA, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0xA6, 0x60, 0xB2, 0x4C, 0xA1, 0x02, 0x0F, 0x00, 0xDF, 0xB8, 
+    0x00, 0x00, 0xF1, 0x01, 0xF0, 0x09, 0x49, 0xF1, 0x07, 0x04, 0x99, 0x66, 0x70, 0x49, 0x0C, 0xD6, 
+    0xB1, 0xAB, 0x66, 0x20, 0x0F, 0xF0, 0xB0, 0x06, 0x69, 0x20, 0x20, 0xF0, 0x4E, 0x01, 0x11, 0xD0, 
+    0xB8, 0x06, 0x51, 0x11, 0x00, 0x00, 0xC1, 0x69, 0x01, 0xE9, 0xA6, 0x4A, 0x01, 0x96, 0x43, 0x0C, 
+    0x69, 0x22, 0x0F, 0x00, 0x02, 0x06, 0xB0, 0x54, 0x03, 0x11, 0x00, 0xF8, 0x01, 0x07, 0x08, 0x83, 
+    0xCC, 0x50, 0xC1, 0x53, 0x02, 0x10, 0x00, 0xF1, 0x07, 0x43, 0x00, 0x70, 0x49, 0x0C, 0xAB, 0xA1, 
+    0x0B, 0x66, 0x99, 0xBB, 0x90, 0xA0, 0x00, 0xF0, 0xA0, 0x02, 0x2F, 0x00, 0x52, 0x08, 0x11, 0x00, 
+    0x08, 0x88, 0x00, 0xB8, 0x00, 0xC0, 0xA0, 0x01, 0xC0, 0xD1, 0x52, 0xF1, 0x09, 0x00, 0xA0, 0x4E, 
+    0x0C, 0x6B, 0x01, 0xEB, 0x99, 0x66, 0x02, 0xB0, 0xF0, 0x00, 0x07, 0x2F, 0xF0, 0x01, 0x10, 0xF1, 
+    0x06, 0x01, 0x00, 0xA8, 0x02, 0x0C, 0xC0, 0xB8, 0x00, 0x50, 0xB0, 0x01, 0xC0, 0xD1, 0xF0, 0x08, 
+    0xF1, 0x0B, 0x51, 0x03, 0x11, 0x19, 0x42, 0x06, 0xB0, 0xBB, 0x02, 0xA0, 0xB0, 0x09, 0xB0, 0xFF, 
+    0x00, 0x8C, 0x50, 0xF1, 0x02, 0xA0, 0x45, 0x01, 0xCC, 0x47, 0x02, 0x0C, 0x50, 0xD1, 0x62, 0x00, 
+    0x60, 0x4F, 0x0C, 0x61, 0x11, 0xA9, 0x66, 0x9B, 0xB0, 0xB0, 0xA9, 0x01, 0x2F, 0xB0, 0x02, 0xF0, 
+    0x80, 0xB5, 0x00, 0x00, 0xE1, 0xA0, 0xA8, 0x01, 0x0C, 0xA5, 0x05, 0x08, 0x80, 0x55, 0xB0, 0x01, 
+    0xC5, 0xA1, 0xF0, 0x09, 0xF1, 0x0B, 0x02, 0x99, 0x90, 0x43, 0x00, 0xD0, 0xD4, 0x06, 0xD6, 0xA1, 
+    0x11, 0x00, 0x43, 0x02, 0x0B, 0x00, 0xEB, 0xA0, 0x01, 0x80, 0xC5, 0xD1, 0xA0, 0xA8, 0x07, 0x0C, 
+    0x55, 0x00, 0x05, 0xA8, 0x0C, 0xCC, 0x55, 0x00, 0x05, 0xC0, 0x11, 0x10, 0x65, 0x00, 0x60, 0x4C, 
+    0x00, 0x90, 0x42, 0x02, 0x19, 0x90, 0x43, 0x0A, 0xB0, 0xBB, 0xB0, 0xBB, 0x20, 0x20, 0x42, 0x00, 
+    0xC0, 0xA5, 0x01, 0xC0, 0x46, 0xC8, 0x02, 0x05, 0x50, 0xB0, 0x00, 0xC0, 0xC8, 0x01, 0xC5, 0xA0, 
+    0x04, 0x50, 0x11, 0x10, 0x61, 0x03, 0xE9, 0x99, 0x42, 0x02, 0x7D, 0xD0, 0x4B, 0x02, 0xA9, 0x90, 
+    0x42, 0x03, 0x0B, 0xB0, 0xAB, 0x42, 0x02, 0x88, 0x80, 0x44, 0xC1, 0x00, 0x00, 0xE8, 0x46, 0x00, 
+    0x50, 0xD8, 0x01, 0x05, 0xA0, 0x04, 0x50, 0x11, 0x10, 0x6B, 0xCD, 0x00, 0xA0, 0x44, 0x00, 0x10, 
+    0xBB, 0x00, 0x00, 0xEB, 0x0C, 0x22, 0x20, 0xF8, 0x8C, 0xC5, 0x55, 0x00, 0x55, 0x01, 0x05, 0xD8, 
+    0x07, 0x05, 0x50, 0x00, 0x50, 0x4E, 0xF1, 0x0B, 0x44, 0x03, 0x67, 0x77, 0xDD, 0x00, 0x60, 0x45, 
+    0x01, 0x10, 0x49, 0x00, 0x00, 0x45, 0x00, 0x80, 0xAC, 0x02, 0x02, 0x00, 0x44, 0x01, 0x0C, 0x46, 
+    0x00, 0x50, 0x44, 0x00, 0xC0, 0xD8, 0x00, 0x00, 0x42, 0x02, 0x05, 0x00, 0xA1, 0x77, 0x03, 0x1B, 
+    0x00, 0x4A, 0x00, 0xF0, 0x42, 0x02, 0x83, 0xC0, 0xA0, 0x07, 0x20, 0x10, 0x80, 0x55, 0xC8, 0x00, 
+    0xC0, 0xA5, 0x0E, 0x00, 0x55, 0x5C, 0x88, 0x80, 0x08, 0x80, 0x50, 0xA0, 0x00, 0x50, 0x65, 0x00, 
+    0x90, 0x43, 0x01, 0x77, 0x4D, 0x00, 0x20, 0x44, 0xB0, 0x05, 0x22, 0x20, 0x0F, 0xC8, 0xB0, 0x06, 
+    0x20, 0x0C, 0x55, 0x00, 0xB8, 0x01, 0x0C, 0xF5, 0x00, 0x09, 0xC0, 0x88, 0x10, 0x88, 0x85, 0x42, 
+    0x00, 0x50, 0x67, 0x00, 0x60, 0xC7, 0x02, 0xDD, 0x70, 0x4A, 0xAB, 0x01, 0x00, 0xD2, 0x04, 0x0F, 
+    0x00, 0x00, 0xA8, 0x00, 0xC0, 0xB0, 0x02, 0xB2, 0x00, 0x42, 0x04, 0x00, 0x88, 0x80, 0x49, 0x11, 
+    0xCC, 0x80, 0x10, 0x88, 0x8C, 0x55, 0x05, 0x01, 0x11, 0x64, 0x00, 0x60, 0xD7, 0x00, 0x60, 0x48, 
+    0x06, 0x00, 0x0B, 0xB0, 0x00, 0xE2, 0x0B, 0x00, 0x01, 0x00, 0x88, 0x05, 0x5C, 0xB0, 0x05, 0xB2, 
+    0x00, 0x01, 0x42, 0x01, 0x0C, 0xF5, 0x00, 0x0E, 0xCC, 0x85, 0x11, 0x08, 0x88, 0xC5, 0x00, 0x50, 
+    0x5F, 0x00, 0xA0, 0x46, 0x01, 0x66, 0x4E, 0x05, 0x12, 0xB0, 0x00, 0xF2, 0x00, 0x08, 0x00, 0x11, 
+    0x10, 0x08, 0x80, 0xA5, 0x0E, 0x08, 0x00, 0x0B, 0xB0, 0x01, 0x10, 0x88, 0x80, 0x4A, 0x07, 0xC5, 
+    0x11, 0x10, 0x05, 0xA0, 0x01, 0x50, 0x5D, 0x04, 0xE6, 0x99, 0x90, 0xE6, 0x45, 0x00, 0x90, 0xF1, 
+    0x00, 0xF2, 0x03, 0x01, 0x00, 0xB1, 0x03, 0x08, 0x80, 0xB5, 0x00, 0xC0, 0xA0, 0x03, 0xBB, 0x20, 
+    0x43, 0x00, 0xC0, 0xF5, 0x00, 0x06, 0xCC, 0x01, 0x10, 0x50, 0xC0, 0x01, 0x55, 0x5D, 0x00, 0xA0, 
+    0xA6, 0x01, 0x77, 0xF6, 0x04, 0x01, 0x9A, 0xE1, 0x01, 0x00, 0x4F, 0x04, 0x10, 0x88, 0x00, 0xD5, 
+    0xB0, 0x02, 0xB2, 0x00, 0x4D, 0x03, 0xC5, 0x0C, 0xC0, 0x00, 0x50, 0x4C, 0x01, 0x00, 0xF1, 0x08, 
+    0x08, 0x66, 0x67, 0x77, 0x47, 0x70, 0xE6, 0x00, 0x70, 0xA6, 0x00, 0xE0, 0xE1, 0x01, 0x00, 0xE2, 
+    0x01, 0x00, 0xE1, 0x03, 0x08, 0x00, 0xC5, 0x0A, 0xC5, 0x02, 0x00, 0xB0, 0x20, 0x00, 0x47, 0x06, 
+    0xCC, 0x55, 0x05, 0x50, 0xA0, 0x05, 0x55, 0x50, 0x01, 0xF0, 0x05, 0xF1, 0x06, 0x09, 0x09, 0x66, 
+    0x70, 0x44, 0x40, 0xD6, 0x06, 0x77, 0xDD, 0x77, 0xA0, 0xF1, 0x00, 0x46, 0x00, 0x00, 0x48, 0x15, 
+    0x10, 0x88, 0x00, 0x55, 0x5C, 0x01, 0x11, 0x02, 0x00, 0xB0, 0x20, 0xC5, 0x11, 0x05, 0x50, 0x5C, 
+    0x55, 0x00, 0x05, 0x55, 0x00, 0x01, 0x5C, 0x03, 0xA9, 0x67, 0xC4, 0x00, 0x70, 0xB6, 0x01, 0x77, 
+    0xA4, 0x02, 0xD6, 0xE0, 0xF1, 0x00, 0xC2, 0x02, 0x00, 0xF0, 0x48, 0x08, 0x11, 0x08, 0x80, 0x00, 
+    0x80, 0x42, 0x09, 0x11, 0x02, 0x0B, 0xB0, 0x20, 0xD5, 0x01, 0xCC, 0xC5, 0x05, 0xC0, 0x80, 0x01, 
+    0x4D, 0xF1, 0x07, 0x02, 0x66, 0x70, 0x4C, 0xC4, 0x01, 0x7A, 0xF1, 0x00, 0x00, 0x00, 0xB2, 0x02, 
+    0xF0, 0x00, 0x4A, 0x06, 0x10, 0x08, 0x88, 0x00, 0xD1, 0x0D, 0x00, 0x0B, 0xBB, 0x02, 0xCC, 0x55, 
+    0x5C, 0xC5, 0x04, 0x08, 0x80, 0x00, 0xA1, 0xF0, 0x0C, 0x02, 0x10, 0x00, 0xB1, 0x04, 0xE9, 0x67, 
+    0xD0, 0xB4, 0x01, 0x07, 0xA9, 0x46, 0x02, 0x47, 0xE0, 0xF1, 0x01, 0x04, 0x22, 0x2F, 0x00, 0xF1, 
+    0x08, 0x02, 0x00, 0x00, 0xE1, 0x08, 0x08, 0x80, 0x0B, 0x08, 0xC0, 0xB0, 0x08, 0x55, 0x5C, 0x88, 
+    0x05, 0x00, 0xB1, 0xF0, 0x0C, 0x02, 0x11, 0x10, 0x44, 0x03, 0xA9, 0x77, 0xC4, 0x02, 0x7D, 0xE0, 
+    0xA9, 0x01, 0x77, 0xD4, 0x00, 0xD0, 0xF1, 0x02, 0x02, 0x20, 0x00, 0xF1, 0x14, 0x07, 0x08, 0x8C, 
+    0xC0, 0x0C, 0xC0, 0x05, 0x5C, 0x08, 0x00, 0xD1, 0xF0, 0x0E, 0x46, 0x01, 0x66, 0x45, 0x05, 0x07, 
+    0xE1, 0x0B, 0x42, 0x00, 0x00, 0xC4, 0x01, 0x7E, 0xF1, 0x21, 0x07, 0x08, 0x80, 0xC5, 0x05, 0x45, 
+    0x02, 0x80, 0x00, 0xC1, 0xF0, 0x11, 0x45, 0x03, 0xE9, 0x77, 0xC4, 0x0B, 0x07, 0x11, 0x1A, 0x99, 
+    0x67, 0x70, 0xC4, 0x00, 0x70, 0x6B, 0x05, 0xCC, 0x50, 0xC5, 0xA0, 0x02, 0x58, 0x00, 0x45, 0xF0, 
+    0x12, 0x45, 0x00, 0xA0, 0x46, 0x02, 0x07, 0x40, 0xA1, 0x06, 0xA9, 0x96, 0x77, 0x00, 0x44, 0x00, 
+    0x40, 0x6A, 0x05, 0x0C, 0x5C, 0x8C, 0xA5, 0x04, 0x80, 0x02, 0x20, 0xA1, 0xF0, 0x14, 0x44, 0x03, 
+    0x66, 0x7D, 0xB4, 0x01, 0x77, 0xC1, 0x00, 0xA0, 0x42, 0x00, 0x70, 0xC4, 0x00, 0xD0, 0xF1, 0x20, 
+    0x00, 0x80, 0x42, 0x08, 0xC5, 0x88, 0x0C, 0x08, 0x80, 0xA0, 0x01, 0x2A, 0xF0, 0x15, 0xC1, 0x03, 
+    0xE9, 0x77, 0xB4, 0x02, 0x07, 0xD0, 0xD1, 0x05, 0xA9, 0x77, 0x70, 0xB4, 0x01, 0x7E, 0xF1, 0x1D, 
+    0x01, 0x00, 0xA8, 0x03, 0xCC, 0x55, 0xB8, 0xA0, 0x04, 0x2B, 0xB2, 0xA0, 0xF0, 0x09, 
+};
+
+const gfx_image_t GAME_TWO_LOGO_IMG = {
+    .w = GAME_TWO_LOGO_W, .h = GAME_TWO_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = GAME_TWO_LOGO_PAL, .colors = GAME_TWO_LOGO_PAL_SIZE,
+    .data = GAME_TWO_LOGO_RLE, .size = GAME_TWO_LOGO_RLE_SIZE,
 };
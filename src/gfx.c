@@ -13,6 +13,7 @@
 #include "project.h"
 #include "ssd1351.h"
 #include "gfx.h"
+#include "timer.h"
 
 // 5x7 font
 // Each byte: bit0=row0 (top), bit6=row6 (bottom).
@@ -120,36 +121,367 @@ static const uint8_t F[96][5] = {
 /* 0x7F     */ {0,0,0,0,0}
 };
 
+// Shared clip stage
+// Every primitive in this file funnels its output through _fill_rect() (solid
+// spans) or _clip_box() (streamed boxes), which trim against s_clip. Signed
+// coordinates let callers pass shapes that hang off the panel edges.
+typedef struct { int16_t x0, y0, x1, y1; } clip_t;   // half-open [x0,x1)
+static clip_t s_clip = { 0, 0, 128, 128 };
+
+void gfx_set_clip(uint8_t x, uint8_t y, uint8_t w, uint8_t h){
+  int x1 = x + w, y1 = y + h;
+  s_clip.x0 = x;  s_clip.y0 = y;
+  s_clip.x1 = (int16_t)(x1 > 128 ? 128 : x1);
+  s_clip.y1 = (int16_t)(y1 > 128 ? 128 : y1);
+}
+
+void gfx_reset_clip(void){
+  s_clip.x0 = 0;   s_clip.y0 = 0;
+  s_clip.x1 = 128; s_clip.y1 = 128;
+}
+
+// Trim (x,y,w,h) to the clip rect; false when nothing is left
+static bool _clip_rect(int* x, int* y, int* w, int* h){
+  int x0 = *x, y0 = *y, x1 = *x + *w, y1 = *y + *h;
+  if (x0 < s_clip.x0) x0 = s_clip.x0;
+  if (y0 < s_clip.y0) y0 = s_clip.y0;
+  if (x1 > s_clip.x1) x1 = s_clip.x1;
+  if (y1 > s_clip.y1) y1 = s_clip.y1;
+  if (x1 <= x0 || y1 <= y0) return false;
+  *x = x0; *y = y0; *w = x1 - x0; *h = y1 - y0;
+  return true;
+}
+
+static void _jobs_before_draw(int x, int y, int w, int h, bool drop);
+
+// Clip a box that is about to be streamed now; queued jobs under it go first
+static bool _clip_box(int* x, int* y, int* w, int* h){
+  if (!_clip_rect(x, y, w, h)) return false;
+  _jobs_before_draw(*x, *y, *w, *h, true);
+  return true;
+}
+
+// Overlay band and panel output
+// Every window and solid fill below goes out through _out_window() /
+// _out_row() / _out_rect(). GDDRAM rows [GFX_OVERLAY_Y, 128) are also kept
+// in s_band, so while an overlay owns the band, mode drawing there only
+// updates the copy and gfx_overlay_close() puts the latest content back.
+enum { BAND_FREE = 0, BAND_PAINT, BAND_OWNED };
+
+static uint16_t s_band[GFX_OVERLAY_H][128];
+static uint8_t  s_band_state = BAND_FREE;
+
+static struct { uint8_t x, w, y, h, row; } s_win;   // current window + row cursor
+
+// RGB565 in panel byte order when stored to memory (the MCU is little-endian)
+#define BE16(c)  ((uint16_t)(((c) >> 8) | ((c) << 8)))
+
+static void _band_store(uint8_t x, uint8_t y, uint8_t w, const uint16_t* px, uint16_t c){
+  if (s_band_state == BAND_PAINT) return;           // the overlay itself is not kept
+  uint16_t* d = &s_band[y - GFX_OVERLAY_Y][x];
+  if (px) memcpy(d, px, (size_t)w * 2u);
+  else    for (uint8_t i = 0; i < w; ++i) d[i] = c;
+}
+
+// Rows of [y, y+h) the panel may receive: everything but an owned band
+static uint8_t _panel_rows(uint8_t y, uint8_t h){
+  if (s_band_state != BAND_OWNED || y + h <= GFX_OVERLAY_Y) return h;
+  return (y >= GFX_OVERLAY_Y) ? 0 : (uint8_t)(GFX_OVERLAY_Y - y);
+}
+
+static void _out_window(uint8_t x, uint8_t y, uint8_t w, uint8_t h){
+  s_win.x = x; s_win.w = w; s_win.y = y; s_win.h = h; s_win.row = 0;
+  uint8_t ph = _panel_rows(y, h);
+  if (ph) ssd1351_set_window(x, y, w, ph);
+}
+
+// One full window row (n == window width)
+static void _out_row(const uint16_t* px, uint32_t n){
+  uint8_t y = (uint8_t)(s_win.y + s_win.row++);
+  if (y >= GFX_OVERLAY_Y) _band_store(s_win.x, y, s_win.w, px, 0);
+  if (s_win.row <= _panel_rows(s_win.y, s_win.h)) ssd1351_push_pixels(px, n);
+}
+
+// Same for a row already in panel byte order (BE16 pixels, see the palette
+// LUTs); only the band copy is swapped back
+static void _out_row_be(const uint16_t* px, uint32_t n){
+  uint8_t y = (uint8_t)(s_win.y + s_win.row++);
+  if (y >= GFX_OVERLAY_Y && s_band_state != BAND_PAINT){
+    uint16_t* d = &s_band[y - GFX_OVERLAY_Y][s_win.x];
+    for (uint32_t i = 0; i < n; ++i) d[i] = BE16(px[i]);
+  }
+  if (s_win.row <= _panel_rows(s_win.y, s_win.h)) ssd1351_push_bytes((const uint8_t*)px, n * 2u);
+}
+
+static void _out_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color){
+  for (uint8_t r = (y > GFX_OVERLAY_Y) ? y : GFX_OVERLAY_Y; r < y + h; ++r)
+    _band_store(x, r, w, 0, color);
+  uint8_t ph = _panel_rows(y, h);
+  if (ph) ssd1351_draw_rect(x, y, w, ph, color);
+}
+
+// Render jobs
+// Between gfx_defer_begin() and gfx_defer_end(), opaque boxes (fills, text
+// boxes, glyph strings, images, compositions) are queued instead of being
+// streamed, and gfx_jobs_run() sends them GFX_JOB_ROWS rows at a time, best
+// priority first, within a per-tick budget. A later draw that lands on
+// queued rows is queued behind them when it can be, otherwise it first sends
+// them (or drops jobs it hides completely). A job never sends a row before
+// older jobs under it have, so the panel always ends up as if everything had
+// been drawn in call order.
+enum { JOB_NONE = 0, JOB_FILL, JOB_TEXT, JOB_GLYPHS, JOB_IMAGE, JOB_COMPOSE };
+
+#define JOB_TEXT_MAX   31u     // longer strings are drawn immediately
+#define JOB_DECODERS   4u      // RLE decoders shared by image/compose jobs
+#define JOB_NO_DEC     0xFFu
+
+typedef struct {
+  uint8_t  kind;
+  uint8_t  prio;
+  uint16_t seq;                // call order
+  uint8_t  x, y, w, h;         // clipped box
+  uint8_t  done;               // rows of the box already sent
+  uint8_t  scale;              // TEXT, GLYPHS
+  uint8_t  n;                  // COMPOSE: layer count
+  int16_t  ox, oy;             // TEXT: text origin in the box; IMAGE, GLYPHS: on the panel
+  uint16_t fg, bg;
+  uint8_t  dec[GFX_COMPOSE_MAX_LAYERS];   // decoder slot per RLE image/layer
+  const gfx_image_t *img;
+  union {
+    char        text[JOB_TEXT_MAX + 1u];
+    gfx_layer_t layers[GFX_COMPOSE_MAX_LAYERS];
+  } u;
+} gfx_job_t;
+
+static gfx_job_t s_jobs[GFX_JOBS_MAX];
+static uint8_t   s_jobs_n;                 // slots in use
+static uint16_t  s_job_seq;
+static uint8_t   s_defer;                  // 1 + priority while deferring, 0 = draw now
+static uint8_t   s_job_rd_used;            // bit k: decoder k belongs to a job
+static bool      s_forcing;                // rows sent on behalf of an immediate draw
+static void    (*s_yield)(void);
+static gfx_jobs_stats_t s_jstats;
+
+static bool _seq_before(uint16_t a, uint16_t b){
+  return (int16_t)(a - b) < 0;
+}
+
+static void _job_free(gfx_job_t* j){
+  for (uint8_t k = 0; k < GFX_COMPOSE_MAX_LAYERS; ++k)
+    if (j->dec[k] != JOB_NO_DEC) s_job_rd_used &= (uint8_t)~(1u << j->dec[k]);
+  j->kind = JOB_NONE;
+  s_jobs_n--;
+}
+
+static uint8_t _job_decoder(gfx_job_t* j, uint8_t k){
+  for (uint8_t d = 0; d < JOB_DECODERS; ++d){
+    if (s_job_rd_used & (1u << d)) continue;
+    s_job_rd_used |= (uint8_t)(1u << d);
+    j->dec[k] = d;
+    return d;
+  }
+  return JOB_NO_DEC;
+}
+
+// Remaining rows of j meet the box [x,x+w) x [y0,y1)
+static bool _job_hits(const gfx_job_t* j, int x, int w, int y0, int y1){
+  return j->kind != JOB_NONE
+      && j->y + j->done < y1 && y0 < j->y + j->h
+      && j->x < x + w && x < j->x + j->w;
+}
+
+// Remaining rows of j lie inside the box
+static bool _job_hidden(const gfx_job_t* j, int x, int y, int w, int h){
+  return j->kind != JOB_NONE
+      && x <= j->x && j->x + j->w <= x + w
+      && y <= j->y + j->done && j->y + j->h <= y + h;
+}
+
+// Queue a job for an already clipped box. Outside a deferred section only a
+// box landing on queued rows is queued (behind them, at GFX_PRIO_HUD), so it
+// does not have to push them out first. 0 means draw it now.
+static gfx_job_t* _job_new(uint8_t kind, int x, int y, int w, int h){
+  uint8_t q = s_defer;
+  for (uint8_t i = 0; !q && s_jobs_n && i < GFX_JOBS_MAX; ++i){
+    if (_job_hits(&s_jobs[i], x, w, y, y + h)) q = (uint8_t)(GFX_PRIO_HUD + 1u);
+  }
+  if (!q) return 0;
+  if (kind != JOB_GLYPHS){                     // opaque: older jobs it hides go
+    for (uint8_t i = 0; i < GFX_JOBS_MAX; ++i){
+      if (_job_hidden(&s_jobs[i], x, y, w, h)){ _job_free(&s_jobs[i]); s_jstats.dropped++; }
+    }
+  }
+  for (uint8_t i = 0; i < GFX_JOBS_MAX; ++i){
+    gfx_job_t* j = &s_jobs[i];
+    if (j->kind != JOB_NONE) continue;
+    j->kind = kind;
+    j->prio = (uint8_t)(q - 1u);
+    j->seq  = s_job_seq++;
+    j->x = (uint8_t)x; j->y = (uint8_t)y; j->w = (uint8_t)w; j->h = (uint8_t)h;
+    j->done = 0;
+    memset(j->dec, JOB_NO_DEC, sizeof(j->dec));
+    if (++s_jobs_n > s_jstats.queue_max) s_jstats.queue_max = s_jobs_n;
+    return j;
+  }
+  s_jstats.fallbacks++;
+  return 0;
+}
+
+// One solid window fill, clipped
+static void _fill_rect(int x, int y, int w, int h, uint16_t color){
+  if (!_clip_rect(&x, &y, &w, &h)) return;
+  gfx_job_t* j = _job_new(JOB_FILL, x, y, w, h);
+  if (j){ j->fg = color; return; }
+  _jobs_before_draw(x, y, w, h, true);
+  _out_rect((uint8_t)x, (uint8_t)y, (uint8_t)w, (uint8_t)h, color);
+}
+
 static void draw_pixel_run(uint8_t x, uint8_t y, uint8_t w, uint16_t color){
-  ssd1351_draw_rect(x, y, w, 1, color);
+  _fill_rect(x, y, w, 1, color);
 }
 
-static void put_char_scaled(uint8_t x, uint8_t y, char c, uint16_t color, uint8_t scale){
+static const uint8_t* glyph(char c){
   uint8_t uc = (uint8_t)c;
-  const uint8_t* p = (uc >= 32 && uc < 128) ? F[uc - 32] : F[0]; // fallback to space
-  for(int col=0; col<5; col++){
-    for(int row=0; row<7; row++){
-      if(p[col] & (1<<row)){
-        uint8_t px = x + col*scale;
-        uint8_t py = y + row*scale;
-        // draw a scale×scale block
-        for(uint8_t dy=0; dy<scale; dy++){
-          draw_pixel_run(px, py+dy, scale, color);
-        }
-      }
+  return (uc >= 32 && uc < 128) ? F[uc - 32] : F[0]; // fallback to space
+}
+
+// Transparent glyph: one rect per horizontal run of lit pixels in a font row
+// (scale rows tall), instead of one rect per lit pixel row.
+static void put_char_scaled(uint8_t x, uint8_t y, char c, uint16_t color, uint8_t scale){
+  const uint8_t* p = glyph(c);
+  for(int row=0; row<7; row++){
+    int col = 0;
+    while(col < 5){
+      if(!(p[col] & (1<<row))){ col++; continue; }
+      int start = col;
+      while(col < 5 && (p[col] & (1<<row))) col++;
+      uint8_t px = (uint8_t)(x + start*scale);
+      uint8_t py = (uint8_t)(y + row*scale);
+      if(scale == 1) draw_pixel_run(px, py, (uint8_t)(col - start), color);
+      else _fill_rect(px, py, (col - start)*scale, scale, color);
     }
   }
 }
 
+// Characters of s gfx_text2 draws at x (the rest would cross the right edge)
+static uint8_t _text2_fit(uint8_t x, const char* s, uint8_t scale){
+  uint8_t n = 0;
+  while(s[n] && n < JOB_TEXT_MAX && x + n*(5*scale + 1) + 5*scale <= 128) n++;
+  return n;
+}
+
+// Queued gfx_text2: one job over the string's bounding box
+static bool _text2_job(uint8_t x, uint8_t y, const char* s, uint16_t color, uint8_t scale){
+  uint8_t n = _text2_fit(x, s, scale);
+  if(s[n] && n == JOB_TEXT_MAX) return false;     // too long to copy
+  if(n == 0) return true;
+  int bx = x, by = y, bw = n*(5*scale + 1) - 1, bh = 7*scale;
+  if(!_clip_rect(&bx, &by, &bw, &bh)) return true;
+  gfx_job_t* j = _job_new(JOB_GLYPHS, bx, by, bw, bh);
+  if(!j) return false;
+  memcpy(j->u.text, s, n);
+  j->u.text[n] = '\0';
+  j->ox = x; j->oy = y;
+  j->fg = color; j->scale = scale;
+  return true;
+}
+
 void gfx_text2(uint8_t x, uint8_t y, const char* s, uint16_t color, uint8_t scale){
   if(scale==0) scale=1;
   const uint8_t spacing = 1;                    
+  uint8_t defer = s_defer;
+  if(defer || s_jobs_n){
+    if(_text2_job(x, y, s, color, scale)) return;
+    s_defer = 0;                                  // not queued: the runs go out now
+  }
   while(*s){
     if (x + 5*scale > 128) break;               // don't draw past right edge
     put_char_scaled(x, y, *s, color, scale);
     x += (5*scale) + spacing;                  
     s++;
   }
+  s_defer = defer;
+}
+
+// Opaque text: one line buffer, one window for the whole box
+static uint16_t s_line[128];
+
+// Rasterize font row `row` (0..6, or -1 for a blank row) of string s into
+// s_line[0..w), with the first glyph starting at column tx.
+static void _text_raster_row(uint8_t w, int tx, const char* s, int row,
+                             uint16_t fg, uint16_t bg, uint8_t scale){
+  for(uint8_t i=0; i<w; i++) s_line[i] = bg;
+  if(row < 0) return;
+  int cx = tx;
+  for(const char* q=s; *q; ++q){
+    if(cx + 5*scale > w) break;                  // same cut-off as gfx_text2
+    const uint8_t* p = glyph(*q);
+    for(int col=0; col<5; col++){
+      if(!(p[col] & (1<<row))) continue;
+      for(int k=0; k<scale; k++){
+        int px = cx + col*scale + k;
+        if(px >= 0) s_line[px] = fg;             // left edge may be clipped
+      }
+    }
+    cx += 5*scale + 1;
+  }
+}
+
+// Rows [a,b) of a clipped text box (cx,cy,cw) with the text origin at
+// (ox,oy) inside it, through one window
+static void _text_rows(uint8_t cx, uint8_t cy, uint8_t cw, int a, int b,
+                       int ox, int oy, const char* s,
+                       uint16_t fg, uint16_t bg, uint8_t scale){
+  _out_window(cx, (uint8_t)(cy + a), cw, (uint8_t)(b - a));
+  int built = -2;                                 // font row held in s_line
+  for(int yy=a; yy<b; yy++){
+    int row = -1;
+    if(yy >= oy && yy < oy + 7*scale) row = (yy - oy) / scale;
+    if(row != built){
+      _text_raster_row(cw, ox, s, row, fg, bg, scale);
+      built = row;
+    }
+    _out_row(s_line, cw);
+  }
+}
+
+// Fill the box (x,y,w,h) with bg and draw s at offset (tx,ty) inside it.
+// The box is clipped to the panel; pixels go out through a single window.
+static void _text_box(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                      uint8_t tx, uint8_t ty, const char* s,
+                      uint16_t fg, uint16_t bg, uint8_t scale){
+  if(scale==0) scale=1;
+  int cx = x, cy = y, cw = w, ch = h;
+  if(!_clip_rect(&cx, &cy, &cw, &ch)) return;
+  int ox = tx - (cx - x);                         // text origin inside the clipped box
+  int oy = ty - (cy - y);
+
+  if(strlen(s) <= JOB_TEXT_MAX){
+    gfx_job_t* j = _job_new(JOB_TEXT, cx, cy, cw, ch);
+    if(j){
+      strcpy(j->u.text, s);
+      j->ox = (int16_t)ox; j->oy = (int16_t)oy;
+      j->fg = fg; j->bg = bg; j->scale = scale;
+      return;
+    }
+  }
+  _jobs_before_draw(cx, cy, cw, ch, true);
+  _text_rows((uint8_t)cx, (uint8_t)cy, (uint8_t)cw, 0, ch, ox, oy, s, fg, bg, scale);
+}
+
+void gfx_text2_bg(uint8_t x, uint8_t y, const char* s,
+                  uint16_t fg, uint16_t bg, uint8_t scale){
+  if(scale==0) scale=1;
+  size_t len = 0; for(const char* p=s; *p; ++p) len++;
+  if(len == 0) return;
+  uint32_t w = (uint32_t)len * (5u*scale + 1u) - 1u;
+  if(w > 128u) w = 128u;
+  _text_box(x, y, (uint8_t)w, (uint8_t)(7u*scale), 0, 0, s, fg, bg, scale);
+}
+
+void gfx_text2_field(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const char* s,
+                     uint16_t fg, uint16_t bg, uint8_t scale){
+  _text_box(x, y, w, h, 0, 0, s, fg, bg, scale);
 }
 
 // Legacy 1 wrapper
@@ -158,11 +490,59 @@ void gfx_text(uint8_t x, uint8_t y, const char* s, uint16_t color){
 }
 
 void gfx_bar(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t fill){
-  ssd1351_draw_rect(x,y,w,h,fill);
+  _fill_rect(x,y,w,h,fill);
+}
+
+// Display start line as last programmed (see the scrolling viewport below)
+static uint8_t s_start_line;
+
+static void _set_start_line(uint8_t line){
+  if(line == s_start_line) return;
+  if(line != 0) gfx_overlay_close();   // the band would scroll with the page
+  ssd1351_set_start_line(line);
+  s_start_line = line;
+}
+
+void gfx_init(void){
+  gfx_reset_clip();
+  s_band_state = BAND_FREE;
+  memset(s_jobs, 0, sizeof(s_jobs));
+  s_jobs_n = 0;
+  s_job_rd_used = 0;
+  s_defer = 0;
+  s_start_line = 0;
+  ssd1351_set_start_line(0);
+  ssd1351_set_contrast_master(15);
+}
+
+bool gfx_overlay_begin(void){
+  if(s_start_line != 0) return false;         // a scrolled page owns the panel
+  _jobs_before_draw(0, GFX_OVERLAY_Y, 128, GFX_OVERLAY_H, false);  // the copy needs them
+  s_band_state = BAND_PAINT;
+  return true;
+}
+
+void gfx_overlay_end(void){
+  if(s_band_state == BAND_PAINT) s_band_state = BAND_OWNED;
+}
+
+void gfx_overlay_close(void){
+  if(s_band_state == BAND_FREE) return;
+  s_band_state = BAND_FREE;
+  _out_window(0, GFX_OVERLAY_Y, 128, GFX_OVERLAY_H);
+  for(uint8_t r=0; r<GFX_OVERLAY_H; ++r){
+    memcpy(s_line, s_band[r], sizeof(s_line));   // _out_row stores it back as is
+    _out_row(s_line, 128);
+  }
+}
+
+bool gfx_overlay_active(void){
+  return s_band_state != BAND_FREE;
 }
 
 void gfx_clear(uint16_t color){
-  ssd1351_draw_rect(0,0,128,128,color);
+  _fill_rect(0,0,128,128,color);
+  _set_start_line(0);            // whole GDDRAM is one color: re-anchor for free
 }
 
 // Non-blocking countdown overlay 
@@ -181,6 +561,7 @@ static struct {
   uint8_t idx;
   uint32_t next_ms;
   uint8_t band_y, band_h;
+  uint8_t lx, lw, lh;          // box of the label currently on screen
   uint16_t bg;
 } _cd = {0};
 
@@ -198,22 +579,43 @@ static void _clear_band_tiled(uint8_t y, uint8_t h, uint16_t color){
   uint8_t end = (uint8_t)((y + h) > 128 ? 128 : (y + h));
   for(uint8_t yy = y; yy < end; ){
     uint8_t hh = (uint8_t)((end - yy) > 8 ? 8 : (end - yy));
-    ssd1351_draw_rect(0, yy, 128, hh, color);
+    _fill_rect(0, yy, 128, hh, color);
     yy = (uint8_t)(yy + hh);
   }
 }
 
-// Draw one centered line at y with largest scale that fits safely
-static void _draw_centered_line(uint8_t y, const char* s, uint16_t color){
+// Layout of one centered line at y with largest scale that fits safely
+static uint8_t _centered_line_layout(uint8_t y, const char* s, uint8_t* x, uint8_t* w){
   uint8_t scale = 1;
   for(uint8_t try=1; try<=8; ++try){
-    uint8_t w = _text_width_px(s, try);
+    uint8_t tw = _text_width_px(s, try);
     uint16_t h = (uint16_t)(7u*try);
-    if(w <= 124 && (y + h) <= 124) scale = try; else break;
+    if(tw <= 124 && (y + h) <= 124) scale = try; else break;
   }
-  uint8_t w = _text_width_px(s, scale);
-  uint8_t x = (w < 128) ? (uint8_t)((128 - w)/2) : 0;
+  *w = _text_width_px(s, scale);
+  *x = (*w < 128) ? (uint8_t)((128 - *w)/2) : 0;
+  return scale;
+}
+
+// Draw one centered countdown label over a cleared band and remember its box
+static void _draw_centered_line(uint8_t y, const char* s, uint16_t color){
+  uint8_t x, w;
+  uint8_t scale = _centered_line_layout(y, s, &x, &w);
   gfx_text2(x, y, s, color, scale);
+  _cd.lx = x; _cd.lw = w; _cd.lh = (uint8_t)(7u*scale);
+}
+
+// Swap labels by redrawing only the union of the old and new label boxes:
+// one window, background and glyphs together, instead of clearing the band.
+static void _swap_centered_line(uint8_t y, const char* s, uint16_t color){
+  uint8_t x, w;
+  uint8_t scale = _centered_line_layout(y, s, &x, &w);
+  uint8_t h  = (uint8_t)(7u*scale);
+  uint8_t x0 = (x < _cd.lx) ? x : _cd.lx;
+  uint8_t x1 = ((x + w) > (_cd.lx + _cd.lw)) ? (uint8_t)(x + w) : (uint8_t)(_cd.lx + _cd.lw);
+  uint8_t uh = (h > _cd.lh) ? h : _cd.lh;
+  _text_box(x0, y, (uint8_t)(x1 - x0), uh, (uint8_t)(x - x0), 0, s, color, _cd.bg, scale);
+  _cd.lx = x; _cd.lw = w; _cd.lh = h;
 }
 
 void gfx_countdown_begin(uint32_t now_ms, uint16_t bg){
@@ -235,13 +637,69 @@ bool gfx_countdown_tick(uint32_t now_ms){
       _cd.active = false;
       return true;
     }
-    _clear_band_tiled(_cd.band_y, _cd.band_h, _cd.bg);
-    _draw_centered_line(40, _cd_seq[_cd.idx].label, _cd_seq[_cd.idx].color);
+    _swap_centered_line(40, _cd_seq[_cd.idx].label, _cd_seq[_cd.idx].color);
     _cd.next_ms = now_ms + 1000u;
   }
   return false;
 }
 
+// Fade transitions
+// Only the master contrast register changes while fading: one 2-byte command
+// per step, no pixels. OUT ramps 15 -> 0, DARK lets the caller draw the next
+// scene on the dark panel (and holds until its deferred jobs are out), IN
+// ramps back up.
+typedef enum { FADE_IDLE = 0, FADE_OUT, FADE_DARK, FADE_IN } fade_phase_t;
+
+static struct {
+  fade_phase_t phase;
+  uint32_t     t0;             // start of the current ramp
+  uint8_t      level;          // master contrast last written
+} _fade = { FADE_IDLE, 0, 15 };
+
+static void _fade_level(uint8_t level){
+  if(level == _fade.level) return;
+  ssd1351_set_contrast_master(level);
+  _fade.level = level;
+}
+
+uint32_t gfx_fade_out(uint32_t now_ms){
+  if(_fade.phase != FADE_OUT){
+    // Continue from the current brightness (e.g. a state change mid fade-in)
+    _fade.t0    = now_ms - (uint32_t)(15u - _fade.level) * GFX_FADE_MS / 15u;
+    _fade.phase = FADE_OUT;
+  }
+  return _fade.t0 + GFX_FADE_MS;
+}
+
+bool gfx_fade_tick(uint32_t now_ms){
+  uint32_t e = now_ms - _fade.t0;
+  switch(_fade.phase){
+    case FADE_OUT:
+      if(e >= GFX_FADE_MS){
+        _fade_level(0);
+        _fade.phase = FADE_DARK;
+        return false;                              // caller draws the new scene now
+      }
+      _fade_level((uint8_t)(15u - 15u * e / GFX_FADE_MS));
+      return true;
+    case FADE_DARK:
+      if(s_jobs_n) return false;                   // scene still streaming in
+      _fade.t0    = now_ms;
+      _fade.phase = FADE_IN;
+      return false;
+    case FADE_IN:
+      if(e >= GFX_FADE_MS){
+        _fade_level(15);
+        _fade.phase = FADE_IDLE;
+      }else{
+        _fade_level((uint8_t)(15u * e / GFX_FADE_MS));
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
 // Header helpers (band-only clear + centered draw)
 static uint8_t _hdr_text_width_px(const char* s, uint8_t scale){
   if(scale==0) scale=1;
@@ -255,104 +713,689 @@ static uint8_t _hdr_text_width_px(const char* s, uint8_t scale){
 void gfx_clear_header_band(uint16_t color){
   for(uint8_t y=0; y<18; ){
     uint8_t h = (uint8_t)((18 - y) > 8 ? 8 : (18 - y));
-    ssd1351_draw_rect(0, y, 128, h, color);
+    _fill_rect(0, y, 128, h, color);
     y = (uint8_t)(y + h);
   }
 }
 
-// Draw centered header line, auto scale (1 or 2), band-only clear
+// Draw centered header line, auto scale (1 or 2), band and text in one pass
 void gfx_header(const char* s, uint16_t color){
   // choose largest scale that fits header band width/height safely
   uint8_t scale = (_hdr_text_width_px(s,2) <= 124 && (2*7) <= 16) ? 2 : 1;
   uint8_t w = _hdr_text_width_px(s, scale);
   uint8_t x = (w < 128) ? (uint8_t)((128 - w)/2) : 0;
 
-  gfx_clear_header_band(COL_BLACK);      // erase header band only
-  gfx_text2(x, 2, s, color, scale);      // draw text at y=2 inside band
+  _text_box(0, 0, 128, 18, x, 2, s, color, COL_BLACK, scale);  // text at y=2 inside band
 }
 
-void gfx_blit565(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint16_t *pixels){
-  for (uint8_t j = 0; j < h; ++j){
-    const uint16_t *row = pixels + (uint16_t)j * w;
-    for (uint8_t i = 0; i < w; ++i){
-      ssd1351_draw_rect((uint8_t)(x + i), (uint8_t)(y + j), 1, 1, row[i]);
+// Scrolling text viewport
+// Content row r is kept in GDDRAM row r & 127. Rows are rasterized from the
+// viewport state (lines + characters revealed), so a row written when it
+// scrolls into view and a glyph cell written when it is typed always agree.
+
+#define SCROLL_LINE_MAX  31u     // same cap as the old lore typewriter buffers
+
+// Packed text: codes are expanded first half first, the second halves wait
+// on a small stack, so a line is decoded without ever being unpacked
+void gfx_bpe_open(gfx_bpe_reader_t* r, const gfx_bpe_t* bpe,
+                  const uint8_t* line, uint16_t skip){
+  r->bpe = bpe;
+  r->p   = line;
+  r->sp  = 0;
+  while(skip){
+    uint8_t c;
+    if(r->sp){
+      c = r->stk[--r->sp];
+    }else{
+      c = *r->p;
+      if(!c) return;                             // line shorter than skip
+      r->p++;
+    }
+    // Whole codes that fit are skipped, larger ones are split
+    while((c & 0x80u) && bpe->lens[c & 0x7Fu] > skip){
+      const uint8_t* pr = &bpe->pairs[(c & 0x7Fu) * 2u];
+      r->stk[r->sp++] = pr[1];
+      c = pr[0];
+    }
+    skip = (uint16_t)(skip - ((c & 0x80u) ? bpe->lens[c & 0x7Fu] : 1u));
+  }
+}
+
+char gfx_bpe_next(gfx_bpe_reader_t* r){
+  uint8_t c;
+  if(r->sp){
+    c = r->stk[--r->sp];
+  }else{
+    c = *r->p;
+    if(!c) return 0;                             // stay on the terminator
+    r->p++;
+  }
+  while(c & 0x80u){
+    const uint8_t* pr = &r->bpe->pairs[(c & 0x7Fu) * 2u];
+    r->stk[r->sp++] = pr[1];
+    c = pr[0];
+  }
+  return (char)c;
+}
+
+static void _scroll_reset(gfx_scroll_t* v, uint8_t count, uint8_t top){
+  v->colors  = 0;
+  v->count   = count;
+  v->x       = 4;
+  v->top     = top;
+  v->pitch   = 10;
+  v->fg      = COL_WHITE;
+  v->bg      = COL_BLACK;
+  v->scroll  = 0;
+  v->painted = 128;              // rows 0..127 are whatever the caller drew
+  v->chars   = 0;
+  v->cursor  = 0;
+}
+
+// Layout, once per page: line breaks consume one character each, which
+// keeps the reveal timing of the old per-mode lore typewriters
+static void _scroll_layout(gfx_scroll_t* v, uint8_t i, size_t n, bool present,
+                           uint16_t* off){
+  v->len[i]   = (uint8_t)(n > SCROLL_LINE_MAX ? SCROLL_LINE_MAX : n);
+  v->start[i] = *off;
+  if(present) *off = (uint16_t)(*off + n + 1u);
+}
+
+void gfx_scroll_begin(gfx_scroll_t* v, const char* const* lines,
+                      uint8_t count, uint8_t top){
+  if(count > GFX_SCROLL_LINES_MAX) count = GFX_SCROLL_LINES_MAX;
+  v->lines = lines;
+  v->page  = 0;
+  _scroll_reset(v, count, top);
+
+  uint16_t off = 0;
+  for(uint8_t i=0; i<count; ++i){
+    _scroll_layout(v, i, lines[i] ? strlen(lines[i]) : 0, lines[i] != 0, &off);
+  }
+}
+
+void gfx_scroll_begin_bpe(gfx_scroll_t* v, const gfx_bpe_page_t* page,
+                          uint8_t top){
+  uint8_t count = page->count;
+  if(count > GFX_SCROLL_LINES_MAX) count = GFX_SCROLL_LINES_MAX;
+  v->lines = 0;
+  v->page  = page;
+  _scroll_reset(v, count, top);
+
+  // Line lengths come from the code lengths; nothing is decoded here
+  const uint8_t* lens = page->bpe->lens;
+  uint16_t off = 0, at = 0;
+  for(uint8_t i=0; i<count; ++i){
+    size_t n = 0;
+    v->at[i] = at;
+    for(uint8_t c; (c = page->data[at++]) != 0; ){
+      n += (c & 0x80u) ? lens[c & 0x7Fu] : 1u;
+    }
+    _scroll_layout(v, i, n, true, &off);
+  }
+}
+
+static uint8_t _scroll_line_x(const gfx_scroll_t* v, uint8_t i){
+  if(v->x != GFX_SCROLL_CENTER) return v->x;
+  uint16_t w = (uint16_t)(v->len[i] * 6u - 1u);  // full line: no drift while typing
+  return (v->len[i] && w < 128) ? (uint8_t)((128 - w)/2) : 0;
+}
+
+// Characters of line i revealed by `chars`
+static uint8_t _scroll_revealed(const gfx_scroll_t* v, uint8_t i, uint32_t chars){
+  if(chars <= v->start[i]) return 0;
+  chars -= v->start[i];
+  return (uint8_t)(chars < v->len[i] ? chars : v->len[i]);
+}
+
+// Rasterize columns [x0,x1) of content row r into s_line; only the glyphs
+// overlapping those columns are looked at
+static void _scroll_raster_row(const gfx_scroll_t* v, uint16_t r,
+                               uint8_t x0, uint8_t x1){
+  for(uint8_t k=x0; k<x1; ++k) s_line[k] = v->bg;
+  int rel = (int)r - v->top;
+  int i   = (rel >= 0) ? rel / v->pitch : -1;
+  int row = (rel >= 0) ? rel % v->pitch : -1;
+  if(i < 0 || i >= v->count || row >= 7 || (v->lines && !v->lines[i])) return;
+
+  uint8_t     n  = _scroll_revealed(v, (uint8_t)i, v->chars);
+  uint8_t     lx = _scroll_line_x(v, (uint8_t)i);
+  uint16_t    fg = v->colors ? v->colors[i] : v->fg;
+  uint8_t     k0 = (x0 > lx) ? (uint8_t)((x0 - lx)/6u) : 0;
+  const char* s  = v->lines ? v->lines[i] : 0;
+  gfx_bpe_reader_t rd;
+  if(!s && k0 < n) gfx_bpe_open(&rd, v->page->bpe, v->page->data + v->at[i], k0);
+  for(uint8_t k = k0; k < n; ++k){
+    int cx = lx + k*6;
+    if(cx >= x1 || cx + 5 > 128) break;          // same cut-off as gfx_text2
+    const uint8_t* p = glyph(s ? s[k] : gfx_bpe_next(&rd));
+    for(int col=0; col<5; col++){
+      int px = cx + col;
+      if(px >= x0 && px < x1 && (p[col] & (1<<row))) s_line[px] = fg;
+    }
+  }
+}
+
+// Write content rows [a,b), columns [x0,x1), limited to what is in view.
+// One window per run of rows that does not cross the GDDRAM wrap.
+static void _scroll_paint(const gfx_scroll_t* v, uint16_t a, uint16_t b,
+                          uint8_t x0, uint8_t x1){
+  uint16_t end = (uint16_t)(v->scroll + 128u);
+  if(a < v->scroll) a = v->scroll;
+  if(b > end) b = end;
+  if(x1 > 128) x1 = 128;
+  if(x1 <= x0) return;
+  while(a < b){
+    uint8_t  g = (uint8_t)(a & 127u);
+    uint16_t n = (uint16_t)(b - a);
+    if(n > (uint16_t)(128u - g)) n = (uint16_t)(128u - g);
+    _jobs_before_draw(x0, g, x1 - x0, n, true);
+    _out_window(x0, g, (uint8_t)(x1 - x0), (uint8_t)n);
+    for(uint16_t k=0; k<n; ++k){
+      _scroll_raster_row(v, (uint16_t)(a + k), x0, x1);
+      _out_row(&s_line[x0], (uint32_t)(x1 - x0));
+    }
+    a = (uint16_t)(a + n);
+  }
+}
+
+void gfx_scroll_to(gfx_scroll_t* v, uint16_t scroll){
+  if(scroll <= v->scroll) return;
+  v->scroll = scroll;
+  uint16_t end = (uint16_t)(scroll + 128u);
+  if(v->painted < end){
+    _scroll_paint(v, v->painted, end, 0, 128);
+    v->painted = end;
+  }
+  _set_start_line((uint8_t)(scroll & 127u));
+}
+
+void gfx_scroll_type(gfx_scroll_t* v, uint32_t chars){
+  if(chars > 0xFFFFu) chars = 0xFFFFu;
+  uint32_t before = v->chars;
+  if(chars == 0) return;                         // nothing typed yet
+  if(chars > before) v->chars = (uint16_t)chars;
+
+  // Lines before the cursor are complete; start at the line being typed
+  for(uint8_t i=v->cursor; i<v->count && chars > v->start[i]; ++i){
+    if(v->lines && !v->lines[i]) continue;
+    v->cursor = i;
+    uint32_t a = _scroll_revealed(v, i, before);
+    uint32_t b = _scroll_revealed(v, i, chars);
+    if(b > a){                                   // newly revealed glyph cells only
+      uint16_t y  = (uint16_t)(v->top + i * v->pitch);
+      uint16_t lx = _scroll_line_x(v, i);
+      uint16_t x0 = (uint16_t)(lx + a*6u);
+      uint16_t x1 = (uint16_t)(lx + b*6u - 1u);
+      if(x0 < 128) _scroll_paint(v, y, (uint16_t)(y + 7u), (uint8_t)x0,
+                                 (uint8_t)(x1 > 128 ? 128 : x1));
     }
   }
+
+  // Follow the cursor one row per call until its line is fully in view
+  uint16_t need = (uint16_t)(v->top + v->cursor * v->pitch + v->pitch);
+  if(need > (uint16_t)(v->scroll + 128u)) gfx_scroll_to(v, (uint16_t)(v->scroll + 1u));
+}
+
+void gfx_blit565(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint16_t *pixels){
+  int cx = x, cy = y, cw = w, ch = h;
+  if (!_clip_box(&cx, &cy, &cw, &ch)) return;
+  _out_window((uint8_t)cx, (uint8_t)cy, (uint8_t)cw, (uint8_t)ch);
+  for (int j = 0; j < ch; ++j){
+    const uint16_t *row = pixels + (uint32_t)(cy - y + j) * w + (cx - x);
+    _out_row(row, (uint32_t)cw);
+  }
 }
 
 void gfx_clear_rect(uint8_t x, uint8_t y,
                     uint8_t w, uint8_t h,
                     uint16_t color)
 {
-    ssd1351_set_window(x, y, x + w - 1, y + h - 1);
+    _fill_rect(x, y, w, h, color);
+}
+
+// Indexed image streaming
+// RLE images are decoded one row at a time into s_rd.row (palette indices),
+// looked up into s_line and pushed through a single window. The row buffer
+// persists between rows, which is what makes RLE copy-up tokens free.
+// Raw 1/2/4/8 bpp images need no state: each visible span is expanded
+// straight into s_line by a per-depth kernel.
+enum { OP_LIT = 0, OP_UP, OP_RUN };
+
+typedef struct {
+  const uint8_t *p;      // next stream byte
+  uint16_t left;         // RLE: pixels left in current token
+  uint8_t  op;           // RLE: current token kind
+  uint8_t  color;        // RLE: run color
+  uint8_t  lo;           // RLE literal: next nibble is the low half
+  uint8_t  row[128];     // current row of indices (previous row on entry)
+} rle_state_t;
+
+static rle_state_t s_rd;
+
+static void _rle_begin(rle_state_t *st, const uint8_t *data){
+  st->p    = data;
+  st->left = 0;
+  st->lo   = 0;
+}
+
+static void _rle_row(rle_state_t *st, uint8_t w){
+  uint8_t *row = st->row;
+  uint8_t x = 0;
+  while (x < w){
+    if (st->left == 0){
+      uint8_t t = *st->p++;
+      if (t < 0x40)      { st->op = OP_LIT; st->left = (uint16_t)(t + 1u); st->lo = 0; }
+      else if (t < 0x80) { st->op = OP_UP;  st->left = (uint16_t)((t & 0x3Fu) + 2u); }
+      else if (t < 0xF0) { st->op = OP_RUN; st->left = (uint16_t)(((t >> 4) & 7u) + 2u); st->color = t & 0x0Fu; }
+      else               { st->op = OP_RUN; st->left = (uint16_t)(9u + *st->p++);      st->color = t & 0x0Fu; }
+    }
+    uint8_t n = (st->left > (uint16_t)(w - x)) ? (uint8_t)(w - x) : (uint8_t)st->left;
+    st->left = (uint16_t)(st->left - n);
+
+    if (st->op == OP_RUN){
+      memset(&row[x], st->color, n);
+    } else if (st->op == OP_LIT){
+      for (uint8_t i = 0; i < n; ++i){
+        if (st->lo){ row[x + i] = *st->p++ & 0x0Fu; st->lo = 0; }
+        else       { row[x + i] = *st->p >> 4;      st->lo = 1; }
+      }
+      if (st->left == 0 && st->lo){ st->p++; st->lo = 0; }   // pad nibble
+    }
+    // OP_UP: row[] still holds the row above at these columns
+    x = (uint8_t)(x + n);
+  }
+}
+
+// Raw span kernels, one per depth. bit is the stream offset of the first
+// pixel; indices are packed MSB-first, so the shift is a pure function of
+// bit & 7 and the loop body has no branches. The _key variants leave out[i]
+// untouched where the index equals key (compositor sprites).
+#define GFX_IDX_SPAN_KERNEL(BPP)                                             \
+static void _idx##BPP##_span(const uint8_t *d, uint32_t bit, int n,          \
+                             const uint16_t *pal, uint16_t *out){            \
+  for (int i = 0; i < n; ++i, bit += (BPP)){                                 \
+    uint8_t b = d[bit >> 3];                                                 \
+    out[i] = pal[(b >> (8u - (BPP) - (bit & 7u))) & ((1u << (BPP)) - 1u)];   \
+  }                                                                          \
+}                                                                            \
+static void _idx##BPP##_key_span(const uint8_t *d, uint32_t bit, int n,      \
+                                 const uint16_t *pal, uint16_t key,          \
+                                 uint16_t *out){                             \
+  for (int i = 0; i < n; ++i, bit += (BPP)){                                 \
+    uint8_t b = d[bit >> 3];                                                 \
+    uint8_t v = (uint8_t)((b >> (8u - (BPP) - (bit & 7u))) & ((1u << (BPP)) - 1u)); \
+    out[i] = (v == key) ? out[i] : pal[v];                                   \
+  }                                                                          \
+}
+
+GFX_IDX_SPAN_KERNEL(1)
+GFX_IDX_SPAN_KERNEL(2)
+GFX_IDX_SPAN_KERNEL(4)
+GFX_IDX_SPAN_KERNEL(8)
+
+typedef void (*idx_span_fn)(const uint8_t*, uint32_t, int, const uint16_t*, uint16_t*);
+typedef void (*idx_key_span_fn)(const uint8_t*, uint32_t, int, const uint16_t*, uint16_t, uint16_t*);
+
+static uint8_t _raw_bpp(uint8_t fmt){
+  switch (fmt){
+    case GFX_IMG_IDX1: return 1;
+    case GFX_IMG_IDX2: return 2;
+    case GFX_IMG_PAL4: return 4;
+    case GFX_IMG_IDX8: return 8;
+    default:           return 0;
+  }
+}
+
+// The row helpers below send rows [j0,j1) of a clipped box (cx,cy,cw) into
+// the window already open on them, so a render job can stream a box in
+// slices with the same code as an immediate blit.
+// 16-color palette LUTs
+// lut[b] is the pixel pair for packed index byte b (high nibble first),
+// both colors already in panel byte order, so a 4 bpp byte expands with one
+// load and one store and the row goes out without a per-pixel swap.
+// (uint16_t)lut[i << 4] is color i alone (RLE rows, odd edges). Tables are
+// built once per palette and kept for the GFX_PAL_LUT_SLOTS palettes used
+// most recently; palettes are keyed by address (assets are const). Only
+// the image's own colors are read; missing entries of a short palette are
+// black.
+typedef struct {
+  const uint16_t *pal;
+  uint32_t        used;       // LRU stamp
+  uint32_t        lut[256];
+} pal_lut_t;
+
+static pal_lut_t s_pal_lut[GFX_PAL_LUT_SLOTS];
+static uint32_t  s_pal_clock;
+
+static const uint32_t *_pal_lut(const gfx_image_t *img){
+  const uint16_t *pal = img->pal;
+  pal_lut_t *slot = &s_pal_lut[0];
+  for (uint8_t k = 0; k < GFX_PAL_LUT_SLOTS; ++k){
+    pal_lut_t *e = &s_pal_lut[k];
+    if (e->pal == pal){ e->used = ++s_pal_clock; return e->lut; }
+    if (e->used < slot->used) slot = e;
+  }
+  uint16_t be[16];
+  for (uint8_t i = 0; i < 16; ++i) be[i] = (i < img->colors) ? BE16(pal[i]) : 0u;
+  for (uint16_t b = 0; b < 256; ++b)
+    slot->lut[b] = be[b >> 4] | ((uint32_t)be[b & 15u] << 16);
+  slot->pal  = pal;
+  slot->used = ++s_pal_clock;
+  return slot->lut;
+}
+
+// 4 bpp span through a LUT into out[] (BE16 pixels); bit is a multiple of 4
+static void _idx4_lut_span(const uint8_t *d, uint32_t bit, int n,
+                           const uint32_t *lut, uint16_t *out){
+  const uint8_t *p = d + (bit >> 3);
+  int i = 0;
+  if ((bit & 4u) && n > 0) out[i++] = (uint16_t)lut[(*p++ & 0x0Fu) << 4];
+  for (; i + 1 < n; i += 2) memcpy(&out[i], &lut[*p++], 4);  // one (unaligned) store
+  if (i < n) out[i] = (uint16_t)lut[*p];
+}
+
+static void _blit_raw(int x, int y, int cx, int cy, int cw, int j0, int j1,
+                      const gfx_image_t *img, uint8_t bpp){
+  idx_span_fn span = (bpp == 1) ? _idx1_span
+                   : (bpp == 2) ? _idx2_span
+                   : (bpp == 4) ? _idx4_span
+                   :              _idx8_span;
+  uint32_t stride = (uint32_t)img->w * bpp;             // bits per row
+  uint32_t bit    = (uint32_t)(cy - y + j0) * stride + (uint32_t)(cx - x) * bpp;
+  if (bpp == 4){
+    const uint32_t *lut = _pal_lut(img);
+    for (int j = j0; j < j1; ++j, bit += stride){
+      _idx4_lut_span(img->data, bit, cw, lut, s_line);
+      _out_row_be(s_line, (uint32_t)cw);
+    }
+    return;
+  }
+  for (int j = j0; j < j1; ++j, bit += stride){
+    span(img->data, bit, cw, img->pal, s_line);
+    _out_row(s_line, (uint32_t)cw);
+  }
+}
+
+// Tile maps: each output row touches one 4-byte row of every tile it
+// crosses, so nothing beyond the line buffer is expanded in RAM.
+static void _blit_tiles(int x, int y, int cx, int cy, int cw, int j0, int j1,
+                        const gfx_image_t *img){
+  uint8_t tw = (uint8_t)((img->w + 7u) >> 3);
+  int u0 = cx - x;                                     // first image column
+  const uint32_t *lut = _pal_lut(img);
+  for (int j = j0; j < j1; ++j){
+    int v = cy - y + j;
+    const uint8_t *map = img->data + (uint32_t)(v >> 3) * tw;
+    uint32_t trow = (uint32_t)(v & 7) * 4u;
+    int u = u0, i = 0;
+    while (i < cw){
+      int n = 8 - (u & 7);                             // pixels left in this tile
+      if (n > cw - i) n = cw - i;
+      const uint8_t *t = img->tiles + (uint32_t)map[u >> 3] * 32u + trow;
+      _idx4_lut_span(t, (uint32_t)(u & 7) * 4u, n, lut, &s_line[i]);
+      i += n;
+      u += n;
+    }
+    _out_row_be(s_line, (uint32_t)cw);
+  }
+}
+
+// RLE rows continue from st; j0 == 0 starts the stream
+static void _blit_rle(int x, int y, int cx, int cy, int cw, int j0, int j1,
+                      const gfx_image_t *img, rle_state_t *st){
+  if (j0 == 0){
+    _rle_begin(st, img->data);
+    for (int j = y; j < cy; ++j) _rle_row(st, img->w);    // rows above the clip still decode
+  }
+  const uint32_t *lut = _pal_lut(img);
+  const uint8_t  *src = &st->row[cx - x];
+  for (int j = j0; j < j1; ++j){
+    _rle_row(st, img->w);
+    for (int i = 0; i < cw; ++i) s_line[i] = (uint16_t)lut[src[i] << 4];
+    _out_row_be(s_line, (uint32_t)cw);
+  }
+}
+
+static void _image_rows(int x, int y, int cx, int cy, int cw, int j0, int j1,
+                        const gfx_image_t *img, rle_state_t *st){
+  uint8_t bpp = _raw_bpp(img->fmt);
+  _out_window((uint8_t)cx, (uint8_t)(cy + j0), (uint8_t)cw, (uint8_t)(j1 - j0));
+  if (bpp)                           _blit_raw(x, y, cx, cy, cw, j0, j1, img, bpp);
+  else if (img->fmt == GFX_IMG_TILE8) _blit_tiles(x, y, cx, cy, cw, j0, j1, img);
+  else                               _blit_rle(x, y, cx, cy, cw, j0, j1, img, st);
+}
+
+void gfx_blit_image(uint8_t x, uint8_t y, const gfx_image_t *img){
+  if (!img || !img->data || !img->pal) return;
+  int cx = x, cy = y, cw = img->w, ch = img->h;
+  if (!_clip_rect(&cx, &cy, &cw, &ch)) return;
+
+  uint8_t bpp = _raw_bpp(img->fmt);
+  if (img->fmt == GFX_IMG_TILE8 && !img->tiles) return;
+  if (bpp == 0 && img->fmt != GFX_IMG_PAL4_RLE && img->fmt != GFX_IMG_TILE8) return;
+
+  gfx_job_t *j = _job_new(JOB_IMAGE, cx, cy, cw, ch);
+  if (j){
+    j->img = img; j->ox = x; j->oy = y;
+    if (img->fmt != GFX_IMG_PAL4_RLE || _job_decoder(j, 0) != JOB_NO_DEC) return;
+    _job_free(j);                                   // no decoder free: draw now
+    s_jstats.fallbacks++;
+  }
+  _jobs_before_draw(cx, cy, cw, ch, true);
+  _image_rows(x, y, cx, cy, cw, 0, ch, img, &s_rd);
+}
+
+// Row compositor
+// Each output row starts as bg and every layer, bottom to top, writes its
+// pixels for that row over it (keyed indices are skipped). RLE layers keep
+// their own decoder state so all layers can advance one row at a time.
+static rle_state_t s_layer_rd[GFX_COMPOSE_MAX_LAYERS];
+
+static bool _layer_ok(const gfx_layer_t *l){
+  const gfx_image_t *img = l->img;
+  if (!img || !img->data || !img->pal) return false;
+  if (img->fmt == GFX_IMG_TILE8) return img->tiles != 0;
+  return img->fmt == GFX_IMG_PAL4_RLE || _raw_bpp(img->fmt) != 0;
+}
+
+// Write n pixels of image row v, starting at image column u, into out.
+static void _layer_span(const gfx_layer_t *l, const rle_state_t *st,
+                        int v, int u, int n, uint16_t *out){
+  const gfx_image_t *img = l->img;
+  uint16_t key = l->key;                 // GFX_KEY_NONE never matches an index
+  uint8_t  bpp = _raw_bpp(img->fmt);
+
+  if (bpp){
+    idx_key_span_fn span = (bpp == 1) ? _idx1_key_span
+                         : (bpp == 2) ? _idx2_key_span
+                         : (bpp == 4) ? _idx4_key_span
+                         :              _idx8_key_span;
+    span(img->data, ((uint32_t)v * img->w + (uint32_t)u) * bpp, n, img->pal, key, out);
+  } else if (img->fmt == GFX_IMG_TILE8){
+    const uint8_t *map = img->data + (uint32_t)(v >> 3) * ((img->w + 7u) >> 3);
+    uint32_t trow = (uint32_t)(v & 7) * 4u;
+    int i = 0;
+    while (i < n){
+      int k = 8 - (u & 7);
+      if (k > n - i) k = n - i;
+      const uint8_t *t = img->tiles + (uint32_t)map[u >> 3] * 32u + trow;
+      _idx4_key_span(t, (uint32_t)(u & 7) * 4u, k, img->pal, key, &out[i]);
+      i += k;
+      u += k;
+    }
+  } else {
+    const uint8_t *src = &st->row[u];    // row already decoded by the caller
+    for (int i = 0; i < n; ++i){
+      uint8_t c = src[i];
+      out[i] = (c == key) ? out[i] : img->pal[c];
+    }
+  }
+}
+
+// Rows [j0,j1) of a clipped region; st[k] is layer k's decoder
+static void _compose_rows(int cx, int cy, int cw, int j0, int j1, uint16_t bg,
+                          const gfx_layer_t *layers, uint8_t n,
+                          rle_state_t *const *st){
+  // RLE layers that start above the region decode their hidden rows first
+  for (uint8_t k = 0; k < n && j0 == 0; ++k){
+    const gfx_layer_t *l = &layers[k];
+    if (!_layer_ok(l) || l->img->fmt != GFX_IMG_PAL4_RLE) continue;
+    _rle_begin(st[k], l->img->data);
+    int skip = cy - l->y;
+    if (skip > l->img->h) skip = l->img->h;
+    for (int v = 0; v < skip; ++v) _rle_row(st[k], l->img->w);
+  }
+
+  _out_window((uint8_t)cx, (uint8_t)(cy + j0), (uint8_t)cw, (uint8_t)(j1 - j0));
+  for (int j = j0; j < j1; ++j){
+    int r = cy + j;
+    for (int i = 0; i < cw; ++i) s_line[i] = bg;
+
+    for (uint8_t k = 0; k < n; ++k){
+      const gfx_layer_t *l = &layers[k];
+      if (!_layer_ok(l)) continue;
+      int v = r - l->y;
+      if (v < 0 || v >= l->img->h) continue;
+      if (l->img->fmt == GFX_IMG_PAL4_RLE) _rle_row(st[k], l->img->w);
+
+      int a = (cx > l->x) ? cx : l->x;                       // column overlap
+      int b = (cx + cw < l->x + l->img->w) ? cx + cw : l->x + l->img->w;
+      if (a < b) _layer_span(l, st[k], v, a - l->x, b - a, &s_line[a - cx]);
+    }
+    _out_row(s_line, (uint32_t)cw);
+  }
+}
+
+void gfx_compose(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t bg,
+                 const gfx_layer_t *layers, uint8_t n){
+  int cx = x, cy = y, cw = w, ch = h;
+  if (!_clip_rect(&cx, &cy, &cw, &ch)) return;
+  if (n > GFX_COMPOSE_MAX_LAYERS) n = GFX_COMPOSE_MAX_LAYERS;
 
-    uint32_t n = (uint32_t)w * (uint32_t)h;
-    while (n--) {
-        ssd1351_push_pixel(color);
+  gfx_job_t *j = _job_new(JOB_COMPOSE, cx, cy, cw, ch);
+  if (j){
+    bool ok = true;
+    for (uint8_t k = 0; k < n && ok; ++k){
+      if (_layer_ok(&layers[k]) && layers[k].img->fmt == GFX_IMG_PAL4_RLE)
+        ok = _job_decoder(j, k) != JOB_NO_DEC;
     }
+    if (ok){
+      memcpy(j->u.layers, layers, (size_t)n * sizeof(*layers));
+      j->n = n; j->bg = bg;
+      return;
+    }
+    _job_free(j);                                   // not enough decoders: draw now
+    s_jstats.fallbacks++;
+  }
+  rle_state_t *st[GFX_COMPOSE_MAX_LAYERS];
+  for (uint8_t k = 0; k < GFX_COMPOSE_MAX_LAYERS; ++k) st[k] = &s_layer_rd[k];
+  _jobs_before_draw(cx, cy, cw, ch, true);
+  _compose_rows(cx, cy, cw, 0, ch, bg, layers, n, st);
 }
 
 // Draw a 4-bit (16-color) paletted image.
-// idx: packed indices, 2 pixels per byte (hi nibble = left, lo nibble = right)
+// idx: packed indices, 2 pixels per byte (hi nibble = left, lo nibble = right),
+// row-major and continuous across rows (odd widths share a byte).
 void gfx_blit_pal4(uint8_t x, uint8_t y,
                    uint8_t w, uint8_t h,
                    const uint8_t  *idx,
                    const uint16_t *pal)
 {
-    uint16_t xi, yi;
-    uint32_t p = 0;  // index into idx array
+    gfx_image_t img = { .w = w, .h = h, .fmt = GFX_IMG_PAL4, .pal = pal, .colors = 16u,
+                        .data = idx, .size = (uint16_t)(((uint32_t)w * h + 1u) / 2u) };
+    gfx_blit_image(x, y, &img);
+}
 
-    for (yi = 0; yi < h; ++yi) {
-        for (xi = 0; xi < w; xi += 2) {
-            uint8_t b  = idx[p++];          // two pixels
-            uint8_t i0 = (b >> 4) & 0x0F;   // left pixel index
-            uint8_t i1 =  b       & 0x0F;   // right pixel index
+// Delta animations
+// Each span is decoded with the RLE row decoder (the converter never emits
+// copy-up inside spans) and pushed through its own 1-row window.
+void gfx_anim_key(uint8_t x, uint8_t y, const gfx_anim_t *a){
+  if (!a || !a->key) return;
+  gfx_blit_image(x, y, a->key);
+}
 
-            uint16_t c0 = pal[i0];
-            uint16_t c1 = pal[i1];
+void gfx_anim_step(uint8_t x, uint8_t y, const gfx_anim_t *a, uint8_t frame){
+  if (!a || !a->delta || frame >= a->frames) return;
+  s_rd.p = a->delta + a->offs[frame];
+  for (;;){
+    uint8_t sy = *s_rd.p++;
+    if (sy == 0xFFu) break;
+    uint8_t sx = *s_rd.p++;
+    uint8_t n  = *s_rd.p++;
+    _rle_begin(&s_rd, s_rd.p);
+    _rle_row(&s_rd, n);
 
-            ssd1351_draw_rect((uint8_t)(x + xi),     (uint8_t)(y + yi), 1, 1, c0);
-            ssd1351_draw_rect((uint8_t)(x + xi + 1), (uint8_t)(y + yi), 1, 1, c1);
-        }
-    }
+    int cx = x + sx, cy = y + sy, cw = n, ch = 1;
+    if (!_clip_box(&cx, &cy, &cw, &ch)) continue;
+    const uint8_t *src = &s_rd.row[cx - (x + sx)];
+    for (int i = 0; i < cw; ++i) s_line[i] = a->pal[src[i]];
+    _out_window((uint8_t)cx, (uint8_t)cy, (uint8_t)cw, 1);
+    _out_row(s_line, (uint32_t)cw);
+  }
 }
 
 void gfx_pixel(uint8_t x, uint8_t y, uint16_t color){
     // 1x1 rect = 1 pixel
-    ssd1351_draw_rect(x, y, 1, 1, color);
+    _fill_rect(x, y, 1, 1, color);
 }
 
+// Span rasterizer
+// Lines are walked with Bresenham but emitted as runs: an x-major line is a
+// set of horizontal spans (one per y step), a y-major line a set of vertical
+// spans. Axis-aligned lines therefore cost a single window.
 static void gfx_line(int x0, int y0, int x1, int y1, uint16_t color){
+    if (y0 == y1) {
+        if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+        _fill_rect(x0, y0, x1 - x0 + 1, 1, color);
+        return;
+    }
+    if (x0 == x1) {
+        if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+        _fill_rect(x0, y0, 1, y1 - y0 + 1, color);
+        return;
+    }
+
     int dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
-    int sx = (x0 < x1) ? 1 : -1;
-    int dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);  // note: y inverted
-    int sy = (y0 < y1) ? 1 : -1;
-    int err = dx + dy;
-
-    while (1) {
-        if (x0 >= 0 && x0 < 128 && y0 >= 0 && y0 < 128) {
-            gfx_pixel((uint8_t)x0, (uint8_t)y0, color);
+    int dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
+    bool steep = dy > dx;
+    if (steep) {                       // walk along y, runs are vertical
+        int t;
+        t = x0; x0 = y0; y0 = t;
+        t = x1; x1 = y1; y1 = t;
+        t = dx; dx = dy; dy = t;
+    }
+    if (x0 > x1) {                     // always walk the major axis upward
+        int t;
+        t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+    int sy  = (y0 < y1) ? 1 : -1;
+    int err = dx / 2;
+    int run = x0;                      // start of the current run
+
+    for (int x = x0; x <= x1; ++x) {
+        err -= dy;
+        if (err < 0 || x == x1) {      // minor axis steps after this pixel
+            if (steep) _fill_rect(y0, run, 1, x - run + 1, color);
+            else       _fill_rect(run, y0, x - run + 1, 1, color);
+            y0  += sy;
+            err += dx;
+            run  = x + 1;
         }
-        if (x0 == x1 && y0 == y1) break;
-        int e2 = 2 * err;
-        if (e2 >= dy) { err += dy; x0 += sx; }
-        if (e2 <= dx) { err += dx; y0 += sy; }
     }
 }
 
 void gfx_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color){
     if (w == 0u || h == 0u) return;
 
-    int x0 = x;
-    int y0 = y;
-    int x1 = x + (int)w - 1;
-    int y1 = y + (int)h - 1;
-
-    // Top, bottom, left, right
-    gfx_line(x0, y0, x1, y0, color); // top
-    gfx_line(x0, y1, x1, y1, color); // bottom
-    gfx_line(x0, y0, x0, y1, color); // left
-    gfx_line(x1, y0, x1, y1, color); // right
+    // Top and bottom edges span the full width; sides fill the rows between
+    _fill_rect(x, y, w, 1, color);
+    if (h > 1u) _fill_rect(x, y + h - 1, w, 1, color);
+    if (h > 2u) {
+        _fill_rect(x,         y + 1, 1, h - 2, color);
+        if (w > 1u) _fill_rect(x + w - 1, y + 1, 1, h - 2, color);
+    }
 }
 
 void gfx_xshape(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color){
@@ -369,12 +1412,240 @@ void gfx_xshape(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color){
     gfx_line(x1, y0, x0, y1, color);
 }
 
+// x on edge (x0,y0)->(x1,y1) at row y, rounded to nearest (y1 > y0)
+static int _edge_x(int x0, int y0, int x1, int y1, int y){
+    int num = 2 * (x1 - x0) * (y - y0);
+    int den = 2 * (y1 - y0);
+    int q = (num >= 0) ? (num + den / 2) / den : -((-num + den / 2) / den);
+    return x0 + q;
+}
+
+// Filled triangle: sort by y, then emit one horizontal span per scanline
+// between the long edge (a->c) and the two short edges.
 void gfx_triangle(uint8_t x0, uint8_t y0,
                   uint8_t x1, uint8_t y1,
                   uint8_t x2, uint8_t y2,
                   uint16_t color)
 {
-    gfx_line(x0, y0, x1, y1, color);
-    gfx_line(x1, y1, x2, y2, color);
-    gfx_line(x2, y2, x0, y0, color);
+    int ax = x0, ay = y0, bx = x1, by = y1, cx = x2, cy = y2, t;
+    if (ay > by) { t = ax; ax = bx; bx = t; t = ay; ay = by; by = t; }
+    if (by > cy) { t = bx; bx = cx; cx = t; t = by; by = cy; cy = t; }
+    if (ay > by) { t = ax; ax = bx; bx = t; t = ay; ay = by; by = t; }
+
+    if (ay == cy) {                    // degenerate: single row
+        int lo = ax, hi = ax;
+        if (bx < lo) lo = bx;
+        if (bx > hi) hi = bx;
+        if (cx < lo) lo = cx;
+        if (cx > hi) hi = cx;
+        _fill_rect(lo, ay, hi - lo + 1, 1, color);
+        return;
+    }
+
+    for (int y = ay; y <= cy; ++y) {
+        int xl = _edge_x(ax, ay, cx, cy, y);
+        int xs;
+        if (y < by)       xs = _edge_x(ax, ay, bx, by, y);
+        else if (by < cy) xs = _edge_x(bx, by, cx, cy, y);
+        else              xs = bx;     // flat bottom row
+        if (xl > xs) { t = xl; xl = xs; xs = t; }
+        _fill_rect(xl, y, xs - xl + 1, 1, color);
+    }
+}
+
+// Render jobs: execution and scheduling (queueing is next to _fill_rect)
+static rle_state_t s_job_rd[JOB_DECODERS];
+
+// Rows [a,b) of a gfx_text2 job: the same runs put_char_scaled emits,
+// cut to the job box
+static void _glyph_rows(const gfx_job_t *j, int a, int b){
+  uint8_t s  = j->scale;
+  int     x1 = j->x + j->w;
+  for (int row = 0; row < 7; ++row){
+    int r0 = j->oy + row * s - j->y, r1 = r0 + s;
+    if (r0 < a) r0 = a;
+    if (r1 > b) r1 = b;
+    if (r0 >= r1) continue;
+    int cx = j->ox;
+    for (const char *q = j->u.text; *q; ++q, cx += 5 * s + 1){
+      const uint8_t *p = glyph(*q);
+      int col = 0;
+      while (col < 5){
+        if (!(p[col] & (1 << row))){ col++; continue; }
+        int start = col;
+        while (col < 5 && (p[col] & (1 << row))) col++;
+        int px0 = cx + start * s, px1 = cx + col * s;
+        if (px0 < j->x) px0 = j->x;
+        if (px1 > x1)   px1 = x1;
+        if (px0 < px1) _out_rect((uint8_t)px0, (uint8_t)(j->y + r0),
+                                 (uint8_t)(px1 - px0), (uint8_t)(r1 - r0), j->fg);
+      }
+    }
+  }
+}
+
+static void _job_rows(gfx_job_t *j, int a, int b){
+  switch (j->kind){
+    case JOB_FILL:
+      _out_rect(j->x, (uint8_t)(j->y + a), j->w, (uint8_t)(b - a), j->fg);
+      break;
+    case JOB_TEXT:
+      _text_rows(j->x, j->y, j->w, a, b, j->ox, j->oy, j->u.text, j->fg, j->bg, j->scale);
+      break;
+    case JOB_GLYPHS:
+      _glyph_rows(j, a, b);
+      break;
+    case JOB_IMAGE:
+      _image_rows(j->ox, j->oy, j->x, j->y, j->w, a, b, j->img,
+                  (j->dec[0] != JOB_NO_DEC) ? &s_job_rd[j->dec[0]] : &s_rd);
+      break;
+    case JOB_COMPOSE: {
+      rle_state_t *st[GFX_COMPOSE_MAX_LAYERS];
+      for (uint8_t k = 0; k < GFX_COMPOSE_MAX_LAYERS; ++k)
+        st[k] = (j->dec[k] != JOB_NO_DEC) ? &s_job_rd[j->dec[k]] : 0;
+      _compose_rows(j->x, j->y, j->w, a, b, j->bg, j->u.layers, j->n, st);
+    } break;
+    default:
+      break;
+  }
+}
+
+static void _job_count(int rows){
+  if (s_forcing) s_jstats.forced_rows += (uint32_t)rows;
+  else           s_jstats.rows        += (uint32_t)rows;
+}
+
+static void _job_advance(gfx_job_t *j, int until);
+
+// A fill has no row state, so an older fill under a slice sends just the
+// slice's rows [r0,r1): what is left above and below stays queued (the part
+// below as a second job with the same seq). Without a free slot it streams
+// down to r1 like any other job.
+static void _fill_rows(gfx_job_t *e, int r0, int r1){
+  int top = e->y + e->done, end = e->y + e->h;
+  if (r0 < top) r0 = top;
+  if (r1 > end) r1 = end;
+  if (r0 > top && r1 < end){
+    gfx_job_t *b = 0;
+    for (uint8_t i = 0; i < GFX_JOBS_MAX && !b; ++i)
+      if (s_jobs[i].kind == JOB_NONE) b = &s_jobs[i];
+    if (!b){ _job_advance(e, r1); return; }
+    *b = *e;
+    b->y = (uint8_t)r1; b->h = (uint8_t)(end - r1); b->done = 0;
+    if (++s_jobs_n > s_jstats.queue_max) s_jstats.queue_max = s_jobs_n;
+  }
+  _out_rect(e->x, (uint8_t)r0, e->w, (uint8_t)(r1 - r0), e->fg);
+  _job_count(r1 - r0);
+  if (r0 > top)      e->h = (uint8_t)(r0 - e->y);            // top part stays
+  else if (r1 < end) e->done = (uint8_t)(r1 - e->y);
+  else               _job_free(e);
+}
+
+// Send j's rows up to panel row `until`, one slice at a time; older jobs
+// under each slice send theirs first
+static void _job_advance(gfx_job_t *j, int until){
+  while (j->kind != JOB_NONE && j->y + j->done < until){
+    int r = j->y + j->done;
+    int k = j->h - j->done;
+    if (k > (int)GFX_JOB_ROWS) k = GFX_JOB_ROWS;
+    if (k > until - r) k = until - r;
+    for (uint8_t i = 0; i < GFX_JOBS_MAX; ++i){
+      gfx_job_t *e = &s_jobs[i];
+      if (e == j || !_job_hits(e, j->x, j->w, r, r + k) || !_seq_before(e->seq, j->seq)) continue;
+      if (e->kind == JOB_FILL) _fill_rows(e, r, r + k);
+      else                     _job_advance(e, r + k);
+    }
+    _job_rows(j, j->done, j->done + k);
+    j->done = (uint8_t)(j->done + k);
+    _job_count(k);
+    if (j->done >= j->h) _job_free(j);
+  }
+}
+
+// One scheduler step for j: a slice of j, or when an older streamed job still
+// has rows under that slice, a slice of that job instead (fills under it are
+// sent for just those rows). Keeps every step about one slice long.
+static void _job_step(gfx_job_t *j){
+  int r = j->y + j->done;
+  int k = j->h - j->done;
+  if (k > (int)GFX_JOB_ROWS) k = GFX_JOB_ROWS;
+  for (uint8_t i = 0; i < GFX_JOBS_MAX; ++i){
+    gfx_job_t *e = &s_jobs[i];
+    if (e == j || !_job_hits(e, j->x, j->w, r, r + k) || !_seq_before(e->seq, j->seq)) continue;
+    if (e->kind != JOB_FILL){ _job_step(e); return; }
+    _fill_rows(e, r, r + k);
+  }
+  _job_advance(j, r + k);
+}
+
+// An immediate draw is about to cover (x,y,w,h): drop the jobs it hides and
+// finish the rows of the others it touches
+static void _jobs_before_draw(int x, int y, int w, int h, bool drop){
+  if (!s_jobs_n) return;
+  for (uint8_t i = 0; drop && i < GFX_JOBS_MAX; ++i){
+    if (_job_hidden(&s_jobs[i], x, y, w, h)){ _job_free(&s_jobs[i]); s_jstats.dropped++; }
+  }
+  s_forcing = true;
+  for (uint8_t i = 0; i < GFX_JOBS_MAX; ++i){
+    if (_job_hits(&s_jobs[i], x, w, y, y + h)) _job_advance(&s_jobs[i], y + h);
+  }
+  s_forcing = false;
+}
+
+static gfx_job_t *_job_next(void){
+  gfx_job_t *best = 0;
+  for (uint8_t i = 0; i < GFX_JOBS_MAX; ++i){
+    gfx_job_t *j = &s_jobs[i];
+    if (j->kind == JOB_NONE) continue;
+    if (!best || j->prio < best->prio ||
+        (j->prio == best->prio && _seq_before(j->seq, best->seq))) best = j;
+  }
+  return best;
+}
+
+void gfx_defer_begin(uint8_t prio){
+  s_defer = (uint8_t)(prio + 1u);
+}
+
+void gfx_defer_end(void){
+  s_defer = 0;
+}
+
+void gfx_jobs_run(uint32_t budget_us){
+  if (!s_jobs_n) return;
+  uint32_t t0 = micros(), el = 0, step;
+  s_jstats.runs++;
+  do {                                  // stop when the next step would not fit
+    _job_step(_job_next());
+    if (s_yield) s_yield();
+    step = micros() - t0 - el;
+    el  += step;
+  } while (s_jobs_n && el + step <= budget_us);
+
+  if (el > s_jstats.worst_us) s_jstats.worst_us = el;
+  if (el > budget_us){
+    s_jstats.overruns++;
+    if (el - budget_us > s_jstats.over_us) s_jstats.over_us = el - budget_us;
+  }
+}
+
+void gfx_jobs_flush(void){
+  gfx_job_t *j;
+  while ((j = _job_next()) != 0) _job_advance(j, j->y + j->h);
+}
+
+bool gfx_jobs_idle(void){
+  return s_jobs_n == 0;
+}
+
+void gfx_jobs_set_yield(void (*fn)(void)){
+  s_yield = fn;
+}
+
+void gfx_jobs_stats(gfx_jobs_stats_t *out){
+  if (out) *out = s_jstats;
+}
+
+void gfx_jobs_stats_reset(void){
+  memset(&s_jstats, 0, sizeof(s_jstats));
 }
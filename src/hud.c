@@ -0,0 +1,191 @@
+/*==============================================================================
+ * @file    hud.c
+ * @brief   Retained HUD widgets (bars, numeric labels, countdowns).
+ *
+ * This file is part of the EMG flex-frequency game project and follows the
+ * project coding standard for file-level documentation.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "gfx.h"
+#include "hud.h"
+
+/* ---------------------------------------------------------------- bars --- */
+
+static uint8_t bar_px(const hud_bar_t *b, float v){
+  if (b->max <= 0.0f || v <= 0.0f) return 0;
+  float px = (v / b->max) * (float)b->w + 0.5f;
+  return (px >= (float)b->w) ? b->w : (uint8_t)px;
+}
+
+static bool is_cut(const hud_bar_t *b, uint8_t c){
+  for (uint8_t i = 0; i < b->n_cuts; ++i){
+    if ((uint8_t)((b->cuts[i] * b->w) / 100u) == c) return true;
+  }
+  return false;
+}
+
+static uint16_t column_color(const hud_bar_t *b, uint8_t c){
+  if (c == b->mark_px) return b->mark_color;
+  if (is_cut(b, c))    return b->cut_color;
+  return (c < b->fill_px) ? b->fill : b->bg;
+}
+
+// Repaint columns [c0,c1) from the current state, one rect per color run
+static void bar_paint(const hud_bar_t *b, uint8_t c0, uint8_t c1){
+  if (c1 > b->w) c1 = b->w;
+  while (c0 < c1){
+    uint16_t col = column_color(b, c0);
+    uint8_t  end = (uint8_t)(c0 + 1u);
+    while (end < c1 && column_color(b, end) == col) end++;
+    gfx_bar((uint8_t)(b->x + c0), b->y, (uint8_t)(end - c0), b->h, col);
+    c0 = end;
+  }
+}
+
+void hud_bar_init(hud_bar_t *b, uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                  float max, uint16_t fill, uint16_t bg){
+  b->x = x; b->y = y; b->w = w; b->h = h;
+  b->max        = max;
+  b->fill       = fill;
+  b->bg         = bg;
+  b->mark_color = bg;
+  b->cut_color  = bg;
+  b->cuts       = 0;
+  b->n_cuts     = 0;
+  b->fill_px    = 0;
+  b->mark_px    = HUD_NO_MARK;
+  gfx_bar(x, y, w, h, bg);
+}
+
+void hud_bar_cuts(hud_bar_t *b, const uint8_t *cuts, uint8_t n, uint16_t color){
+  b->cuts      = cuts;
+  b->n_cuts    = n;
+  b->cut_color = color;
+  for (uint8_t i = 0; i < n; ++i){
+    uint8_t c = (uint8_t)((cuts[i] * b->w) / 100u);
+    bar_paint(b, c, (uint8_t)(c + 1u));
+  }
+}
+
+void hud_bar_mark(hud_bar_t *b, float v, uint16_t color){
+  uint8_t m = bar_px(b, v);
+  if (m >= b->w) m = (uint8_t)(b->w - 1u);
+  if (m == b->mark_px && color == b->mark_color) return;
+
+  uint8_t old = b->mark_px;
+  b->mark_px    = m;
+  b->mark_color = color;
+  if (old != HUD_NO_MARK && old != m) bar_paint(b, old, (uint8_t)(old + 1u));
+  bar_paint(b, m, (uint8_t)(m + 1u));
+}
+
+void hud_bar_set_px(hud_bar_t *b, uint8_t px){
+  if (px > b->w) px = b->w;
+  if (px == b->fill_px) return;
+  uint8_t c0 = (px < b->fill_px) ? px : b->fill_px;
+  uint8_t c1 = (px < b->fill_px) ? b->fill_px : px;
+  b->fill_px = px;
+  bar_paint(b, c0, c1);
+}
+
+void hud_bar_set(hud_bar_t *b, float v){
+  hud_bar_set_px(b, bar_px(b, v));
+}
+
+/* ------------------------------------------------------ numeric labels --- */
+
+// prefix + right-aligned number + suffix, always the same length
+static void num_format(const hud_num_t *n, float v, char *out){
+  uint32_t scale = (n->decimals > 0u) ? 10u : 1u;
+  uint32_t limit = 1u;                         // 10^(digits that fit)
+  uint8_t  digits = (uint8_t)(n->width - (n->decimals > 0u ? 1u : 0u));
+  for (uint8_t i = 0; i < digits; ++i) limit *= 10u;
+
+  uint32_t q = (v > 0.0f) ? (uint32_t)(v * (float)scale + 0.5f) : 0u;
+  if (q >= limit) q = limit - 1u;
+
+  size_t p = strlen(n->prefix);
+  memcpy(out, n->prefix, p);
+  char *num = out + p;
+  memset(num, ' ', n->width);
+
+  int i = (int)n->width - 1;
+  if (n->decimals > 0u){
+    num[i--] = (char)('0' + q % 10u);
+    num[i--] = '.';
+    q /= 10u;
+  }
+  while (i >= 0){                              // width 2 with a point: ".d"
+    num[i--] = (char)('0' + q % 10u);
+    q /= 10u;
+    if (q == 0u) break;
+  }
+
+  strcpy(num + n->width, n->suffix);
+}
+
+bool hud_num_init(hud_num_t *n, uint8_t x, uint8_t y, uint8_t scale,
+                  const char *prefix, uint8_t width, uint8_t decimals,
+                  const char *suffix, uint16_t fg, uint16_t bg){
+  n->x = x; n->y = y;
+  n->scale    = scale ? scale : 1u;
+  n->prefix   = prefix ? prefix : "";
+  n->suffix   = suffix ? suffix : "";
+  n->decimals = decimals ? 1u : 0u;
+  n->width    = width;
+  n->fg = fg; n->bg = bg;
+  n->text[0]  = '\0';                          // first set draws everything
+
+  // At least one digit (plus the point); a label with no room for that is
+  // rejected with width 0 and never drawn
+  uint8_t least = n->decimals ? 2u : 1u;
+  size_t  fixed = strlen(n->prefix) + strlen(n->suffix);
+  if (fixed + least > HUD_NUM_MAX){ n->width = 0u; return false; }
+  if (n->width < least) n->width = least;
+  if (fixed + n->width > HUD_NUM_MAX) n->width = (uint8_t)(HUD_NUM_MAX - fixed);
+  return true;
+}
+
+void hud_num_set(hud_num_t *n, float v){
+  if (n->width == 0u) return;                  // rejected by hud_num_init()
+  char next[HUD_NUM_MAX + 1u];
+  num_format(n, v, next);
+
+  uint8_t len  = (uint8_t)strlen(next);
+  uint8_t cw   = (uint8_t)(5u * n->scale + 1u);
+  bool    full = (n->text[0] == '\0');
+
+  // Repaint each run of changed cells with one opaque text box
+  uint8_t i = 0;
+  while (i < len){
+    if (!full && next[i] == n->text[i]){ i++; continue; }
+    uint8_t j = (uint8_t)(i + 1u);
+    while (j < len && (full || next[j] != n->text[j])) j++;
+
+    char run[HUD_NUM_MAX + 1u];
+    memcpy(run, next + i, (size_t)(j - i));
+    run[j - i] = '\0';
+    gfx_text2_field((uint8_t)(n->x + i * cw), n->y, (uint8_t)((j - i) * cw),
+                    (uint8_t)(7u * n->scale), run, n->fg, n->bg, n->scale);
+    i = j;
+  }
+  memcpy(n->text, next, (size_t)len + 1u);
+}
+
+/* ----------------------------------------------------------- countdown --- */
+
+bool hud_countdown_init(hud_countdown_t *c, uint8_t x, uint8_t y, uint8_t scale,
+                        const char *prefix, uint8_t width, const char *suffix,
+                        uint16_t fg, uint16_t bg, uint32_t end_ms){
+  c->end_ms = end_ms;
+  return hud_num_init(&c->num, x, y, scale, prefix, width, 0u, suffix, fg, bg);
+}
+
+bool hud_countdown_tick(hud_countdown_t *c, uint32_t now_ms){
+  int32_t rem = (int32_t)(c->end_ms - now_ms);
+  if (rem < 0) rem = 0;
+  hud_num_set(&c->num, (float)((uint32_t)rem / 1000u));
+  return rem == 0;
+}
@@ -62,10 +62,7 @@ bool intermission_tick(void){
     uint8_t x = (uint8_t)((128 - GAME_TWO_LOGO_W) / 2);
     uint8_t y = (uint8_t)((128 - GAME_TWO_LOGO_H) / 2);
 
-    gfx_blit_pal4(x, y,
-                  GAME_TWO_LOGO_W, GAME_TWO_LOGO_H,
-                  GAME_TWO_LOGO_IDX,
-                  GAME_TWO_LOGO_PAL);
+    gfx_blit_image(x, y, &GAME_TWO_LOGO_IMG);
   }
 
   // seconds remaining (ceil to next)
@@ -77,12 +74,10 @@ bool intermission_tick(void){
   if (rem_s != g_last_rem_s) {
     g_last_rem_s = rem_s;
 
-    // clear just the digits area (small rectangle to the right of the label)
-    gfx_bar(g_digits_x, g_digits_y, 40, 12, COL_BLACK);
-
+    // repaint just the digits field (small box to the right of the label)
     char num[8];
     snprintf(num, sizeof(num), "%us", rem_s);
-    gfx_text2(g_digits_x, g_digits_y, num, COL_YELLOW, 1);
+    gfx_text2_field(g_digits_x, g_digits_y, 40, 12, num, COL_YELLOW, COL_BLACK, 1);
   }
 
   if ((int32_t)(millis() - g_end_ms) >= 0){
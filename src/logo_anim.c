@@ -8,10 +8,12 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "timer.h"      // millis()
-#include "gfx.h"        // gfx_bar
-#include "project.h"    // COL_BLACK
-#include "ti_logo.h"    // TI_LOGO_W, TI_LOGO_H, TI_LOGO[]
-#include "msu_logo.h"   // MSU_LOGO_W, MSU_LOGO_H, MSU_LOGO[]
+#include "gfx.h"        // gfx_anim_key, gfx_anim_step
+#include "logo_anim_frames.h"   // LOGO_ANIM (TI + MSU, built by anim2delta.py)
+
+/* Frame box: 128x99 (fits both logos), centered vertically */
+#define LOGO_BOX_X  ((128 - LOGO_ANIM_W) / 2)
+#define LOGO_BOX_Y  ((128 - LOGO_ANIM_H) / 2)
 
 static bool     g_active         = false;
 static uint32_t g_t0_ms          = 0;
@@ -39,42 +41,20 @@ bool logo_anim_tick(void)
     }
 
     /* Switch frame every 200 ms (so over 2s get ~10 flips) */
-    uint32_t frame = (elapsed / 200u) & 1u;  // 0 or 1
+    uint32_t frame = (elapsed / 200u) % LOGO_ANIM_FRAMES;  // 0 = TI, 1 = MSU
 
     if (frame != g_last_frame_idx) {
-        g_last_frame_idx = frame;
-
-        /* Compute a bounding box that fits BOTH logos,
-           can clear once and draw either centered inside. */
-        uint8_t box_w = (TI_LOGO_W  > MSU_LOGO_W)  ? TI_LOGO_W  : MSU_LOGO_W;
-        uint8_t box_h = (TI_LOGO_H  > MSU_LOGO_H)  ? TI_LOGO_H  : MSU_LOGO_H;
-
-        uint8_t box_x = (uint8_t)((128 - box_w) / 2);
-        uint8_t box_y = (uint8_t)((128 - box_h) / 2);
-
-        /* Clear just the logo region before drawing the new one. */
-        gfx_bar(box_x, box_y, box_w, box_h, COL_BLACK);
-
-        if (frame == 0u) {
-            /* TI logo centered in box */
-            uint8_t x = (uint8_t)((128 - TI_LOGO_W) / 2);
-            uint8_t y = (uint8_t)((128 - TI_LOGO_H) / 2);
-
-            gfx_blit_pal4(x, y,
-                        TI_LOGO_W, TI_LOGO_H,
-                        TI_LOGO_IDX,
-                        TI_LOGO_PAL);
-        } else {
-            uint8_t x = (uint8_t)((128 - TI_LOGO_W) / 2);
-            uint8_t y = (uint8_t)((128 - TI_LOGO_H) / 2);
-
-            gfx_blit_pal4(x, y,
-                        TI_LOGO_W, TI_LOGO_H,
-                        TI_LOGO_IDX,
-                        TI_LOGO_PAL);
+        if (g_last_frame_idx == (uint32_t)-1) {
+            /* First frame: full keyframe (TI logo + black box) */
+            gfx_anim_key(LOGO_BOX_X, LOGO_BOX_Y, &LOGO_ANIM);
+            g_last_frame_idx = 0u;
+        }
+        /* Only the spans that differ between the two logos are sent */
+        while (g_last_frame_idx != frame) {
+            g_last_frame_idx = (g_last_frame_idx + 1u) % LOGO_ANIM_FRAMES;
+            gfx_anim_step(LOGO_BOX_X, LOGO_BOX_Y, &LOGO_ANIM, (uint8_t)g_last_frame_idx);
         }
     }
 
     return false;  // still animating
 }
-
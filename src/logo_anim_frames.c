@@ -0,0 +1,377 @@
+#include <stdint.h>
+#include "logo_anim_frames.h"
+
+static const uint16_t LOGO_ANIM_PAL[16] = {
+    0x0000, 0x1227, 0x1A48, 0x2268, 0x2AA9, 0x3B0B, 0x538D, 0x7471, 
+    0x9D74, 0xBE38, 0xC800, 0xD6DA, 0xDB4D, 0xE75D, 0xED55, 0xFFFF, 
+};
+
+static const uint8_t LOGO_ANIM_KEY_RLE[589] = {
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xC7, 0xFF, 0xFF, 
+    0xFF, 0x1E, 0x00, 0xE0, 0xFC, 0x06, 0x00, 0xE0, 0xFF, 0x66, 0xFA, 0x08, 0xFF, 0x66, 0x7F, 0x7F, 
+    0x7F, 0x7F, 0x54, 0x00, 0xE0, 0xBC, 0x00, 0xE0, 0xFF, 0x56, 0x58, 0xCA, 0x00, 0xC0, 0xFF, 0x56, 
+    0x5E, 0x00, 0xE0, 0xFF, 0x56, 0x57, 0x00, 0xE0, 0xCA, 0xFF, 0x57, 0x7F, 0x7F, 0x55, 0x00, 0xC0, 
+    0x7F, 0x7C, 0xFF, 0x5E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFA, 0x06, 0x03, 0xEF, 0xFC, 0xCA, 
+    0x02, 0xFF, 0xF0, 0xFA, 0x05, 0x00, 0xE0, 0xFF, 0x46, 0x5C, 0x03, 0xCF, 0xFE, 0x7F, 0x70, 0x02, 
+    0xFF, 0xF0, 0xCA, 0x7F, 0x7D, 0x03, 0xEF, 0xFC, 0x7F, 0x72, 0x00, 0xE0, 0xCA, 0x02, 0xFF, 0xF0, 
+    0xFA, 0x06, 0x7F, 0x61, 0x00, 0xC0, 0x7F, 0x7C, 0x03, 0xEF, 0xFC, 0x7F, 0x7C, 0xCA, 0x03, 0xCF, 
+    0xFE, 0x7F, 0x6C, 0xAC, 0x00, 0xF0, 0x46, 0x03, 0xEF, 0xFE, 0xAC, 0x7F, 0x67, 0xDF, 0x00, 0xE0, 
+    0xCA, 0xEF, 0x7F, 0x7F, 0xFA, 0x00, 0x00, 0xC0, 0xFF, 0x46, 0xFA, 0x05, 0x00, 0xC0, 0xDF, 0x00, 
+    0xC0, 0x4B, 0x00, 0xE0, 0xFA, 0x03, 0xFF, 0x32, 0x00, 0xE0, 0xFC, 0x0A, 0x54, 0xCA, 0x00, 0xC0, 
+    0xDF, 0x00, 0xC0, 0xFA, 0x03, 0x00, 0xE0, 0x79, 0xFA, 0x18, 0x00, 0xE0, 0x4B, 0x00, 0xE0, 0xDF, 
+    0xFA, 0x05, 0xFF, 0x32, 0xFA, 0x18, 0xDF, 0x00, 0xE0, 0xCA, 0xEF, 0xFA, 0x06, 0x7F, 0x7D, 0x00, 
+    0xA0, 0xFF, 0x30, 0x00, 0xE0, 0xFA, 0x17, 0xAC, 0x03, 0xEF, 0xFC, 0x47, 0xBC, 0xFA, 0x07, 0x00, 
+    0xE0, 0xFF, 0x30, 0x00, 0xC0, 0xFA, 0x1A, 0x02, 0xEF, 0xF0, 0xCA, 0x03, 0xCF, 0xFE, 0xFA, 0x0C, 
+    0x78, 0x00, 0xF0, 0xFA, 0x1A, 0x00, 0xF0, 0x46, 0x03, 0xEF, 0xFC, 0x7F, 0xFF, 0x07, 0xFA, 0x18, 
+    0x00, 0xC0, 0x4A, 0xFA, 0x0D, 0x7A, 0x00, 0xF0, 0x61, 0x00, 0xE0, 0xCA, 0x00, 0xF0, 0x7F, 0xFF, 
+    0x0C, 0x00, 0xC0, 0xFA, 0x15, 0x03, 0xEF, 0xFC, 0x46, 0x00, 0xE0, 0x7F, 0xFF, 0x0B, 0x00, 0xC0, 
+    0xFA, 0x14, 0x02, 0xFF, 0xF0, 0xCA, 0x03, 0xCF, 0xFC, 0x7F, 0xFF, 0x0C, 0x64, 0x02, 0xEF, 0xF0, 
+    0xFA, 0x0E, 0x7E, 0x00, 0xF0, 0xFA, 0x12, 0x00, 0xC0, 0x7F, 0xFF, 0x1A, 0x00, 0xC0, 0xFA, 0x11, 
+    0x03, 0xEF, 0xFE, 0xCA, 0x02, 0xFF, 0xE0, 0x7F, 0xFF, 0x0F, 0xFA, 0x11, 0x03, 0xFF, 0xFC, 0x46, 
+    0x00, 0xC0, 0x7F, 0xFF, 0x0F, 0x00, 0xC0, 0x5A, 0xCA, 0x03, 0xCF, 0xFE, 0x7F, 0xFF, 0x0F, 0x00, 
+    0xE0, 0xFA, 0x0F, 0x03, 0xCF, 0xFF, 0xCE, 0xAF, 0xAE, 0x7F, 0xFF, 0x0C, 0xFA, 0x0F, 0x00, 0xE0, 
+    0xFF, 0x07, 0x50, 0x01, 0xCE, 0xFF, 0x3A, 0x00, 0xE0, 0xFA, 0x02, 0x02, 0xCC, 0xC0, 0xFA, 0x00, 
+    0xFF, 0x08, 0x00, 0xC0, 0xFA, 0x05, 0x01, 0xCE, 0xFF, 0x3E, 0xFA, 0x00, 0x00, 0xC0, 0xBF, 0x64, 
+    0x00, 0xE0, 0xFF, 0x41, 0x00, 0xE0, 0xDA, 0x00, 0xC0, 0xDF, 0x56, 0xFA, 0x02, 0x00, 0xE0, 0xFF, 
+    0x44, 0x00, 0xE0, 0xCA, 0xEF, 0x00, 0xE0, 0x5E, 0x00, 0xE0, 0xFF, 0x47, 0x04, 0xEC, 0xAA, 0xC0, 
+    0xFF, 0x01, 0x00, 0xC0, 0xBA, 0x00, 0xE0, 0xFF, 0x06, 0x00, 0xE0, 0xDA, 0x00, 0xC0, 0xFF, 0x59, 
+    0xCA, 0x00, 0xE0, 0x53, 0x00, 0xE0, 0xFF, 0x5A, 0x00, 0xC0, 0xCA, 0x01, 0xCE, 0xFF, 0x03, 0x00, 
+    0xC0, 0xBA, 0xFF, 0x5D, 0xFA, 0x10, 0xFF, 0x5E, 0x00, 0xC0, 0xFA, 0x0E, 0xFF, 0x60, 0xFA, 0x0D, 
+    0xFF, 0x61, 0x00, 0xC0, 0xFA, 0x0B, 0x00, 0xE0, 0xFF, 0x61, 0x00, 0xE0, 0xFA, 0x0B, 0xFF, 0x63, 
+    0xFA, 0x0A, 0x00, 0xE0, 0xFF, 0x63, 0x00, 0xE0, 0xFA, 0x09, 0xFF, 0x65, 0xFA, 0x08, 0x00, 0xE0, 
+    0xFF, 0x65, 0x00, 0xE0, 0x7F, 0xFF, 0x36, 0x00, 0xC0, 0xFA, 0x06, 0xFF, 0x68, 0x7F, 0xFF, 0x36, 
+    0x00, 0xE0, 0x7F, 0xFF, 0x36, 0x00, 0xC0, 0x7F, 0xFF, 0x36, 0x00, 0xC0, 0xFA, 0x03, 0x00, 0xE0, 
+    0xFF, 0x6A, 0x00, 0xC0, 0xFA, 0x02, 0x00, 0xC0, 0xFF, 0x6B, 0x00, 0xE0, 0xFA, 0x02, 0xFF, 0x6D, 
+    0x00, 0xC0, 0xFA, 0x00, 0x00, 0xE0, 0xFF, 0x6E, 0x00, 0xE0, 0xCA, 0x00, 0xC0, 0xFF, 0xA8, 0xF0, 
+    0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x47, 
+};
+
+static const gfx_image_t LOGO_ANIM_KEY = {
+    .w = LOGO_ANIM_W, .h = LOGO_ANIM_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = LOGO_ANIM_PAL, .colors = 16,
+    .data = LOGO_ANIM_KEY_RLE, .size = sizeof(LOGO_ANIM_KEY_RLE),
+};
+
+static const uint16_t LOGO_ANIM_OFFS[LOGO_ANIM_FRAMES] = {
+    0, 2048, 
+};
+
+static const uint8_t LOGO_ANIM_DELTA[4977] = {
+    0x00, 0x0E, 0x64, 0xF0, 0x5B, 0x01, 0x0E, 0x64, 0xF0, 0x5B, 0x02, 0x0E, 0x64, 0xF0, 0x5B, 0x03, 
+    0x0E, 0x64, 0xF0, 0x5B, 0x04, 0x0E, 0x64, 0xF0, 0x5B, 0x05, 0x0E, 0x64, 0xF0, 0x5B, 0x06, 0x0E, 
+    0x64, 0xF0, 0x5B, 0x07, 0x0E, 0x64, 0xF0, 0x5B, 0x08, 0x0E, 0x64, 0xF0, 0x5B, 0x09, 0x0E, 0x64, 
+    0xF0, 0x5B, 0x0A, 0x0E, 0x64, 0xF0, 0x5B, 0x0B, 0x0E, 0x64, 0xF0, 0x5B, 0x0C, 0x0E, 0x64, 0xF0, 
+    0x5B, 0x0D, 0x0E, 0x64, 0xF0, 0x5B, 0x0E, 0x00, 0x0E, 0xFF, 0x05, 0x0E, 0x2B, 0x3A, 0xFF, 0x31, 
+    0x0E, 0x72, 0x0E, 0xFF, 0x05, 0x0F, 0x00, 0x0E, 0xFF, 0x05, 0x0F, 0x2A, 0x3B, 0xFF, 0x32, 0x0F, 
+    0x72, 0x0E, 0xFF, 0x05, 0x10, 0x00, 0x0E, 0xFF, 0x05, 0x10, 0x29, 0x3B, 0xCF, 0x00, 0xE0, 0xFC, 
+    0x06, 0x00, 0xE0, 0xFF, 0x1B, 0x10, 0x72, 0x0E, 0xFF, 0x05, 0x11, 0x00, 0x0E, 0xFF, 0x05, 0x11, 
+    0x28, 0x3C, 0xDF, 0xFA, 0x08, 0xFF, 0x1B, 0x11, 0x72, 0x0E, 0xFF, 0x05, 0x12, 0x00, 0x0E, 0xFF, 
+    0x05, 0x12, 0x27, 0x3C, 0xEF, 0xFA, 0x08, 0xFF, 0x1A, 0x12, 0x72, 0x0E, 0xFF, 0x05, 0x13, 0x00, 
+    0x0E, 0xFF, 0x05, 0x13, 0x26, 0x3D, 0xFF, 0x00, 0xFA, 0x08, 0xFF, 0x1A, 0x13, 0x72, 0x0E, 0xFF, 
+    0x05, 0x14, 0x00, 0x0E, 0xFF, 0x05, 0x14, 0x25, 0x3D, 0xFF, 0x01, 0xFA, 0x08, 0xFF, 0x00, 0x00, 
+    0xE0, 0xBC, 0x00, 0xE0, 0xFF, 0x09, 0x14, 0x72, 0x0E, 0xFF, 0x05, 0x15, 0x00, 0x0E, 0xFF, 0x05, 
+    0x15, 0x24, 0x3E, 0xFF, 0x02, 0xFA, 0x08, 0xFF, 0x00, 0xCA, 0x00, 0xC0, 0xFF, 0x09, 0x15, 0x72, 
+    0x0E, 0xFF, 0x05, 0x16, 0x00, 0x0E, 0xFF, 0x05, 0x16, 0x23, 0x1F, 0xFF, 0x03, 0xFA, 0x08, 0x01, 
+    0xFF, 0x16, 0x49, 0x07, 0xCA, 0x00, 0xE0, 0x16, 0x56, 0x0B, 0xFF, 0x02, 0x16, 0x72, 0x0E, 0xFF, 
+    0x05, 0x17, 0x00, 0x0E, 0xFF, 0x05, 0x17, 0x22, 0x1E, 0xFF, 0x04, 0xFA, 0x08, 0x17, 0x48, 0x07, 
+    0x00, 0xE0, 0xCA, 0x17, 0x5A, 0x07, 0xDF, 0x17, 0x72, 0x0E, 0xFF, 0x05, 0x18, 0x00, 0x0E, 0xFF, 
+    0x05, 0x18, 0x21, 0x33, 0xFF, 0x05, 0xFA, 0x08, 0xEF, 0x00, 0xE0, 0xCA, 0xBF, 0x18, 0x5D, 0x03, 
+    0x02, 0xFF, 0xF0, 0x18, 0x72, 0x0E, 0xFF, 0x05, 0x19, 0x00, 0x0E, 0xFF, 0x05, 0x19, 0x21, 0x34, 
+    0xFF, 0x05, 0xFA, 0x08, 0xEF, 0x00, 0xC0, 0xCA, 0xCF, 0x19, 0x72, 0x0E, 0xFF, 0x05, 0x1A, 0x00, 
+    0x0E, 0xFF, 0x05, 0x1A, 0x20, 0x31, 0xFF, 0x06, 0xFA, 0x08, 0xFF, 0x08, 0x1A, 0x72, 0x0E, 0xFF, 
+    0x05, 0x1B, 0x00, 0x0E, 0xFF, 0x05, 0x1B, 0x20, 0x2F, 0xFF, 0x06, 0xFA, 0x08, 0xFF, 0x06, 0x1B, 
+    0x72, 0x0E, 0xFF, 0x05, 0x1C, 0x00, 0x0E, 0xFF, 0x05, 0x1C, 0x1F, 0x2E, 0xFF, 0x07, 0xFA, 0x08, 
+    0xFF, 0x04, 0x1C, 0x72, 0x0E, 0xFF, 0x05, 0x1D, 0x00, 0x0E, 0xFF, 0x05, 0x1D, 0x1F, 0x2D, 0xFF, 
+    0x07, 0xFA, 0x08, 0xFF, 0x03, 0x1D, 0x72, 0x0E, 0xFF, 0x05, 0x1E, 0x00, 0x0E, 0xFF, 0x05, 0x1E, 
+    0x1E, 0x42, 0xFF, 0x08, 0xFA, 0x0C, 0x03, 0xEF, 0xFC, 0xCA, 0x02, 0xFF, 0xF0, 0xFA, 0x05, 0x00, 
+    0xE0, 0x1E, 0x72, 0x0E, 0xFF, 0x05, 0x1F, 0x00, 0x0E, 0xFF, 0x05, 0x1F, 0x1E, 0x42, 0xFF, 0x08, 
+    0xFA, 0x0C, 0x03, 0xEF, 0xFC, 0xBA, 0x03, 0xCF, 0xFE, 0xFA, 0x05, 0x00, 0xE0, 0x1F, 0x72, 0x0E, 
+    0xFF, 0x05, 0x20, 0x00, 0x0E, 0xFF, 0x05, 0x20, 0x1D, 0x43, 0xFF, 0x09, 0xFA, 0x0C, 0x02, 0xFF, 
+    0xF0, 0xCA, 0x03, 0xCF, 0xFE, 0xFA, 0x05, 0x00, 0xE0, 0x20, 0x72, 0x0E, 0xFF, 0x05, 0x21, 0x00, 
+    0x0E, 0xFF, 0x05, 0x21, 0x1D, 0x43, 0xFF, 0x09, 0xFA, 0x0C, 0x02, 0xFF, 0xF0, 0xCA, 0x03, 0xEF, 
+    0xFC, 0xFA, 0x05, 0x00, 0xE0, 0x21, 0x72, 0x0E, 0xFF, 0x05, 0x22, 0x00, 0x0E, 0xFF, 0x05, 0x22, 
+    0x1D, 0x43, 0xFF, 0x09, 0xFA, 0x0C, 0x02, 0xFF, 0xE0, 0xCA, 0x02, 0xFF, 0xF0, 0xFA, 0x06, 0x00, 
+    0xE0, 0x22, 0x72, 0x0E, 0xFF, 0x05, 0x23, 0x00, 0x0E, 0xFF, 0x05, 0x23, 0x1C, 0x44, 0xFF, 0x0A, 
+    0xFA, 0x0B, 0x03, 0xCF, 0xFE, 0xCA, 0x02, 0xFF, 0xF0, 0xFA, 0x06, 0x00, 0xE0, 0x23, 0x72, 0x0E, 
+    0xFF, 0x05, 0x24, 0x00, 0x0E, 0xFF, 0x05, 0x24, 0x1C, 0x44, 0xFF, 0x0A, 0xFA, 0x0B, 0x03, 0xEF, 
+    0xFC, 0xCA, 0x02, 0xFF, 0xF0, 0xFA, 0x06, 0x00, 0xE0, 0x24, 0x72, 0x0E, 0xFF, 0x05, 0x25, 0x00, 
+    0x0E, 0xFF, 0x05, 0x25, 0x1C, 0x0F, 0xFF, 0x06, 0x25, 0x2F, 0x31, 0xFA, 0x0B, 0x02, 0xEF, 0xF0, 
+    0xCA, 0x03, 0xCF, 0xFE, 0xFA, 0x06, 0x00, 0xE0, 0x25, 0x72, 0x0E, 0xFF, 0x05, 0x26, 0x00, 0x0E, 
+    0xFF, 0x05, 0x26, 0x1C, 0x44, 0xFF, 0x0A, 0xFA, 0x07, 0xAC, 0x02, 0xFF, 0xF0, 0xCA, 0x03, 0xEF, 
+    0xFE, 0xAC, 0xFA, 0x02, 0x00, 0xE0, 0x26, 0x72, 0x0E, 0xFF, 0x05, 0x27, 0x00, 0x0E, 0xFF, 0x05, 
+    0x27, 0x1B, 0x23, 0xFF, 0x0B, 0xFA, 0x06, 0x27, 0x42, 0x1E, 0x03, 0xFF, 0xFE, 0xCA, 0xEF, 0xFA, 
+    0x02, 0x00, 0xE0, 0x27, 0x72, 0x0E, 0xFF, 0x05, 0x28, 0x00, 0x0E, 0xFF, 0x05, 0x28, 0x1B, 0x45, 
+    0xFF, 0x0B, 0xFA, 0x06, 0xDF, 0x00, 0xE0, 0xCA, 0xEF, 0xFA, 0x02, 0x00, 0xC0, 0x28, 0x72, 0x0E, 
+    0xFF, 0x05, 0x29, 0x00, 0x0E, 0xFF, 0x05, 0x29, 0x1B, 0x45, 0xFF, 0x0B, 0xFA, 0x05, 0x00, 0xC0, 
+    0xDF, 0x00, 0xC0, 0xCA, 0xDF, 0x00, 0xE0, 0xFA, 0x03, 0x29, 0x72, 0x0E, 0xFF, 0x05, 0x2A, 0x00, 
+    0x0E, 0xFF, 0x05, 0x2A, 0x1B, 0x46, 0x00, 0xE0, 0xFC, 0x0A, 0xFA, 0x05, 0x00, 0xC0, 0xDF, 0xCA, 
+    0x00, 0xC0, 0xDF, 0x00, 0xC0, 0xFA, 0x03, 0x00, 0xE0, 0x2A, 0x72, 0x0E, 0xFF, 0x05, 0x2B, 0x00, 
+    0x0E, 0xFF, 0x05, 0x2B, 0x1B, 0x46, 0x00, 0xE0, 0xFA, 0x18, 0x00, 0xE0, 0xDF, 0xCA, 0x00, 0xE0, 
+    0xDF, 0xFA, 0x05, 0x2B, 0x72, 0x0E, 0xFF, 0x05, 0x2C, 0x00, 0x0E, 0xFF, 0x05, 0x2C, 0x1B, 0x47, 
+    0x00, 0xF0, 0xFA, 0x18, 0xDF, 0x00, 0xE0, 0xCA, 0xEF, 0xFA, 0x06, 0x2C, 0x72, 0x0E, 0xFF, 0x05, 
+    0x2D, 0x00, 0x0E, 0xFF, 0x05, 0x2D, 0x1B, 0x48, 0x00, 0xF0, 0xFA, 0x18, 0xDF, 0x00, 0xE0, 0xCA, 
+    0xEF, 0xFA, 0x07, 0x2D, 0x72, 0x0E, 0xFF, 0x05, 0x2E, 0x00, 0x0E, 0xFF, 0x05, 0x2E, 0x1B, 0x49, 
+    0x01, 0xFE, 0xFA, 0x17, 0xAC, 0x03, 0xEF, 0xFC, 0xCA, 0x02, 0xFF, 0xF0, 0xBC, 0xFA, 0x07, 0x00, 
+    0xE0, 0x2E, 0x72, 0x0E, 0xFF, 0x05, 0x2F, 0x00, 0x0E, 0xFF, 0x05, 0x2F, 0x1B, 0x49, 0x02, 0xFF, 
+    0xC0, 0xFA, 0x1A, 0x02, 0xEF, 0xF0, 0xCA, 0x03, 0xCF, 0xFE, 0xFA, 0x0C, 0x00, 0xE0, 0x2F, 0x72, 
+    0x0E, 0xFF, 0x05, 0x30, 0x00, 0x0E, 0xFF, 0x05, 0x30, 0x1B, 0x49, 0x02, 0xFF, 0xF0, 0xFA, 0x1A, 
+    0x02, 0xFF, 0xF0, 0xCA, 0x03, 0xEF, 0xFC, 0xFA, 0x0C, 0x00, 0xE0, 0x30, 0x72, 0x0E, 0xFF, 0x05, 
+    0x31, 0x00, 0x0E, 0xFF, 0x05, 0x31, 0x1B, 0x49, 0xAF, 0xFA, 0x18, 0x03, 0xCF, 0xFF, 0xCA, 0x02, 
+    0xEF, 0xF0, 0xFA, 0x0D, 0x00, 0xE0, 0x31, 0x72, 0x0E, 0xFF, 0x05, 0x32, 0x00, 0x0E, 0xFF, 0x05, 
+    0x32, 0x1B, 0x49, 0xBF, 0xFA, 0x17, 0x03, 0xCF, 0xFE, 0xCA, 0x02, 0xFF, 0xF0, 0xFA, 0x0D, 0x00, 
+    0xE0, 0x32, 0x72, 0x0E, 0xFF, 0x05, 0x33, 0x00, 0x0E, 0xFF, 0x05, 0x33, 0x1B, 0x49, 0xCF, 0x00, 
+    0xC0, 0xFA, 0x15, 0x03, 0xEF, 0xFC, 0xCA, 0x02, 0xFF, 0xE0, 0xFA, 0x0D, 0x00, 0xE0, 0x33, 0x72, 
+    0x0E, 0xFF, 0x05, 0x34, 0x00, 0x0E, 0xFF, 0x05, 0x34, 0x1B, 0x49, 0xDF, 0x00, 0xC0, 0xFA, 0x14, 
+    0x02, 0xFF, 0xF0, 0xCA, 0x03, 0xCF, 0xFC, 0xFA, 0x0D, 0x00, 0xE0, 0x34, 0x72, 0x0E, 0xFF, 0x05, 
+    0x35, 0x00, 0x0E, 0xFF, 0x05, 0x35, 0x1B, 0x49, 0xEF, 0xFA, 0x14, 0x02, 0xFF, 0xF0, 0xCA, 0x02, 
+    0xEF, 0xF0, 0xFA, 0x0E, 0x00, 0xE0, 0x35, 0x72, 0x0E, 0xFF, 0x05, 0x36, 0x00, 0x0E, 0xFF, 0x05, 
+    0x36, 0x1B, 0x49, 0xFF, 0x00, 0xFA, 0x12, 0x03, 0xCF, 0xFF, 0xCA, 0x02, 0xEF, 0xF0, 0xFA, 0x0E, 
+    0x00, 0xE0, 0x36, 0x72, 0x0E, 0xFF, 0x05, 0x37, 0x00, 0x0E, 0xFF, 0x05, 0x37, 0x1B, 0x49, 0xFF, 
+    0x00, 0x00, 0xC0, 0xFA, 0x11, 0x03, 0xEF, 0xFE, 0xCA, 0x02, 0xFF, 0xE0, 0xFA, 0x0E, 0x00, 0xE0, 
+    0x37, 0x72, 0x0E, 0xFF, 0x05, 0x38, 0x00, 0x0E, 0xFF, 0x05, 0x38, 0x1B, 0x49, 0xFF, 0x01, 0xFA, 
+    0x11, 0x03, 0xFF, 0xFC, 0xCA, 0x02, 0xFF, 0xC0, 0xFA, 0x0E, 0x00, 0xE0, 0x38, 0x72, 0x0E, 0xFF, 
+    0x05, 0x39, 0x00, 0x0E, 0xFF, 0x05, 0x39, 0x1C, 0x48, 0xFF, 0x00, 0x00, 0xC0, 0xFA, 0x10, 0x02, 
+    0xFF, 0xF0, 0xCA, 0x03, 0xCF, 0xFE, 0xFA, 0x0E, 0x00, 0xE0, 0x39, 0x72, 0x0E, 0xFF, 0x05, 0x3A, 
+    0x00, 0x0E, 0xFF, 0x05, 0x3A, 0x1C, 0x48, 0xFF, 0x00, 0x00, 0xE0, 0xFA, 0x0F, 0x03, 0xCF, 0xFF, 
+    0xCE, 0xAF, 0xAE, 0xFA, 0x0A, 0x00, 0xE0, 0x3A, 0x72, 0x0E, 0xFF, 0x05, 0x3B, 0x00, 0x0E, 0xFF, 
+    0x05, 0x3B, 0x1C, 0x48, 0xFF, 0x01, 0xFA, 0x0F, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0xE0, 0xFA, 0x08, 
+    0x02, 0xCE, 0xF0, 0x3B, 0x72, 0x0E, 0xFF, 0x05, 0x3C, 0x00, 0x0E, 0xFF, 0x05, 0x3C, 0x1C, 0x48, 
+    0xFF, 0x01, 0x00, 0xE0, 0xFA, 0x02, 0x02, 0xCC, 0xC0, 0xFA, 0x00, 0xFF, 0x08, 0x00, 0xC0, 0xFA, 
+    0x05, 0x01, 0xCE, 0xAF, 0x3C, 0x72, 0x0E, 0xFF, 0x05, 0x3D, 0x00, 0x0E, 0xFF, 0x05, 0x3D, 0x1D, 
+    0x48, 0xFF, 0x01, 0xFA, 0x00, 0x00, 0xC0, 0xBF, 0xEA, 0xFF, 0x08, 0x00, 0xC0, 0xFA, 0x03, 0x00, 
+    0xE0, 0xEF, 0x3D, 0x72, 0x0E, 0xFF, 0x05, 0x3E, 0x00, 0x0E, 0xFF, 0x05, 0x3E, 0x1D, 0x3E, 0xFF, 
+    0x01, 0x00, 0xE0, 0xDA, 0x00, 0xC0, 0xDF, 0xDA, 0xFF, 0x08, 0xFA, 0x02, 0x00, 0xE0, 0x3E, 0x61, 
+    0x04, 0xAF, 0x3E, 0x72, 0x0E, 0xFF, 0x05, 0x3F, 0x00, 0x0E, 0xFF, 0x05, 0x3F, 0x1D, 0x12, 0xFF, 
+    0x02, 0x00, 0xE0, 0xCA, 0x3F, 0x33, 0x26, 0xAF, 0x00, 0xE0, 0xCA, 0xFF, 0x08, 0xFA, 0x00, 0x00, 
+    0xE0, 0x3F, 0x61, 0x05, 0xBF, 0x3F, 0x72, 0x0E, 0xFF, 0x05, 0x40, 0x00, 0x0E, 0xFF, 0x05, 0x40, 
+    0x1E, 0x10, 0xFF, 0x02, 0x04, 0xEC, 0xAA, 0xC0, 0x40, 0x33, 0x24, 0xBF, 0x00, 0xC0, 0xBA, 0x00, 
+    0xE0, 0xFF, 0x06, 0x00, 0xE0, 0xDA, 0x00, 0xC0, 0x40, 0x62, 0x04, 0xAF, 0x40, 0x72, 0x0E, 0xFF, 
+    0x05, 0x41, 0x00, 0x0E, 0xFF, 0x05, 0x41, 0x1E, 0x09, 0xFF, 0x00, 0x41, 0x33, 0x25, 0xCF, 0xCA, 
+    0x00, 0xE0, 0xFF, 0x05, 0x00, 0xE0, 0xCA, 0x02, 0xEF, 0xF0, 0x41, 0x62, 0x05, 0xBF, 0x41, 0x72, 
+    0x0E, 0xFF, 0x05, 0x42, 0x00, 0x0E, 0xFF, 0x05, 0x42, 0x1E, 0x0A, 0xFF, 0x01, 0x42, 0x34, 0x27, 
+    0xBF, 0x00, 0xC0, 0xCA, 0x01, 0xCE, 0xFF, 0x03, 0x00, 0xC0, 0xBA, 0xDF, 0x42, 0x63, 0x04, 0xAF, 
+    0x42, 0x72, 0x0E, 0xFF, 0x05, 0x43, 0x00, 0x0E, 0xFF, 0x05, 0x43, 0x1E, 0x0A, 0xFF, 0x01, 0x43, 
+    0x34, 0x34, 0xCF, 0xFA, 0x10, 0xFF, 0x0C, 0x43, 0x72, 0x0E, 0xFF, 0x05, 0x44, 0x00, 0x0E, 0xFF, 
+    0x05, 0x44, 0x1F, 0x09, 0xFF, 0x00, 0x44, 0x34, 0x34, 0xCF, 0x00, 0xC0, 0xFA, 0x0E, 0xFF, 0x0D, 
+    0x44, 0x72, 0x0E, 0xFF, 0x05, 0x45, 0x00, 0x0E, 0xFF, 0x05, 0x45, 0x1F, 0x09, 0xFF, 0x00, 0x45, 
+    0x34, 0x35, 0xDF, 0xFA, 0x0D, 0xFF, 0x0F, 0x45, 0x72, 0x0E, 0xFF, 0x05, 0x46, 0x00, 0x0E, 0xFF, 
+    0x05, 0x46, 0x1F, 0x09, 0xFF, 0x00, 0x46, 0x35, 0x2A, 0xCF, 0x00, 0xC0, 0xFA, 0x0B, 0x00, 0xE0, 
+    0xFF, 0x05, 0x46, 0x63, 0x07, 0xDF, 0x46, 0x72, 0x0E, 0xFF, 0x05, 0x47, 0x00, 0x0E, 0xFF, 0x05, 
+    0x47, 0x20, 0x08, 0xEF, 0x47, 0x35, 0x2A, 0xCF, 0x00, 0xE0, 0xFA, 0x0B, 0xFF, 0x06, 0x47, 0x63, 
+    0x07, 0xDF, 0x47, 0x72, 0x0E, 0xFF, 0x05, 0x48, 0x00, 0x0E, 0xFF, 0x05, 0x48, 0x20, 0x08, 0xEF, 
+    0x48, 0x35, 0x2A, 0xDF, 0xFA, 0x0A, 0x00, 0xE0, 0xFF, 0x06, 0x48, 0x63, 0x08, 0xEF, 0x48, 0x72, 
+    0x0E, 0xFF, 0x05, 0x49, 0x00, 0x0E, 0xFF, 0x05, 0x49, 0x20, 0x08, 0xEF, 0x49, 0x35, 0x37, 0xDF, 
+    0x00, 0xE0, 0xFA, 0x09, 0xFF, 0x14, 0x49, 0x72, 0x0E, 0xFF, 0x05, 0x4A, 0x00, 0x0E, 0xFF, 0x05, 
+    0x4A, 0x20, 0x08, 0xEF, 0x4A, 0x36, 0x2A, 0xDF, 0xFA, 0x08, 0x00, 0xE0, 0xFF, 0x08, 0x4A, 0x67, 
+    0x05, 0xBF, 0x4A, 0x72, 0x0E, 0xFF, 0x05, 0x4B, 0x00, 0x0E, 0xFF, 0x05, 0x4B, 0x20, 0x07, 0xDF, 
+    0x4B, 0x36, 0x2A, 0xDF, 0x00, 0xE0, 0xFA, 0x07, 0x00, 0xE0, 0xFF, 0x08, 0x4B, 0x72, 0x0E, 0xFF, 
+    0x05, 0x4C, 0x00, 0x0E, 0xFF, 0x05, 0x4C, 0x20, 0x07, 0xDF, 0x4C, 0x36, 0x2A, 0xEF, 0x00, 0xC0, 
+    0xFA, 0x06, 0xFF, 0x09, 0x4C, 0x72, 0x0E, 0xFF, 0x05, 0x4D, 0x00, 0x0E, 0xFF, 0x05, 0x4D, 0x20, 
+    0x07, 0xDF, 0x4D, 0x36, 0x2A, 0xFF, 0x00, 0xFA, 0x06, 0xFF, 0x09, 0x4D, 0x72, 0x0E, 0xFF, 0x05, 
+    0x4E, 0x00, 0x0E, 0xFF, 0x05, 0x4E, 0x20, 0x07, 0xDF, 0x4E, 0x36, 0x2A, 0xFF, 0x00, 0x00, 0xE0, 
+    0xFA, 0x05, 0xFF, 0x09, 0x4E, 0x72, 0x0E, 0xFF, 0x05, 0x4F, 0x00, 0x0E, 0xFF, 0x05, 0x4F, 0x20, 
+    0x07, 0xDF, 0x4F, 0x36, 0x2A, 0xFF, 0x01, 0x00, 0xC0, 0xFA, 0x04, 0xFF, 0x09, 0x4F, 0x72, 0x0E, 
+    0xFF, 0x05, 0x50, 0x00, 0x0E, 0xFF, 0x05, 0x50, 0x20, 0x06, 0xCF, 0x50, 0x36, 0x2A, 0xFF, 0x02, 
+    0x00, 0xC0, 0xFA, 0x03, 0x00, 0xE0, 0xFF, 0x08, 0x50, 0x72, 0x0E, 0xFF, 0x05, 0x51, 0x00, 0x0E, 
+    0xFF, 0x05, 0x51, 0x20, 0x06, 0xCF, 0x51, 0x36, 0x2A, 0xFF, 0x03, 0x00, 0xC0, 0xFA, 0x02, 0x00, 
+    0xC0, 0xFF, 0x08, 0x51, 0x72, 0x0E, 0xFF, 0x05, 0x52, 0x00, 0x0E, 0xFF, 0x05, 0x52, 0x20, 0x06, 
+    0xCF, 0x52, 0x36, 0x2A, 0xFF, 0x04, 0x00, 0xE0, 0xFA, 0x02, 0xFF, 0x08, 0x52, 0x72, 0x0E, 0xFF, 
+    0x05, 0x53, 0x00, 0x0E, 0xFF, 0x05, 0x53, 0x1F, 0x06, 0xCF, 0x53, 0x36, 0x2A, 0xFF, 0x06, 0x00, 
+    0xC0, 0xFA, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x53, 0x72, 0x0E, 0xFF, 0x05, 0x54, 0x00, 0x0E, 0xFF, 
+    0x05, 0x54, 0x1F, 0x06, 0xCF, 0x54, 0x35, 0x2C, 0xFF, 0x09, 0x00, 0xE0, 0xCA, 0x00, 0xC0, 0xFF, 
+    0x09, 0x54, 0x72, 0x0E, 0xFF, 0x05, 0x55, 0x00, 0x0E, 0xFF, 0x05, 0x55, 0x1F, 0x05, 0xBF, 0x55, 
+    0x35, 0x0C, 0xFF, 0x03, 0x55, 0x4D, 0x14, 0xFF, 0x0B, 0x55, 0x72, 0x0E, 0xFF, 0x05, 0x56, 0x0E, 
+    0x64, 0xF0, 0x5B, 0x57, 0x0E, 0x64, 0xF0, 0x5B, 0x58, 0x0E, 0x64, 0xF0, 0x5B, 0x59, 0x0E, 0x64, 
+    0xF0, 0x5B, 0x5A, 0x0E, 0x64, 0xF0, 0x5B, 0x5B, 0x0E, 0x64, 0xF0, 0x5B, 0x5C, 0x0E, 0x64, 0xF0, 
+    0x5B, 0x5D, 0x0E, 0x64, 0xF0, 0x5B, 0x5E, 0x0E, 0x64, 0xF0, 0x5B, 0x5F, 0x0E, 0x64, 0xF0, 0x5B, 
+    0x60, 0x0E, 0x64, 0xF0, 0x5B, 0x61, 0x0E, 0x64, 0xF0, 0x5B, 0x62, 0x0E, 0x64, 0xF0, 0x5B, 0xFF, 
+    0x00, 0x0E, 0x64, 0xFF, 0x5B, 0x01, 0x0E, 0x64, 0xFF, 0x5B, 0x02, 0x0E, 0x64, 0xFF, 0x34, 0xBD, 
+    0xFF, 0x19, 0x03, 0x0E, 0x64, 0xFF, 0x2C, 0x14, 0xDB, 0x88, 0x76, 0x66, 0x44, 0x33, 0x44, 0x66, 
+    0x78, 0x89, 0xB0, 0xFF, 0x11, 0x04, 0x0E, 0x64, 0xFF, 0x28, 0x05, 0xB8, 0x86, 0x44, 0xF1, 0x08, 
+    0x05, 0x24, 0x57, 0x8B, 0xFF, 0x0D, 0x05, 0x0E, 0x64, 0xFF, 0x25, 0x03, 0xB8, 0x64, 0xB1, 0xF3, 
+    0x08, 0x00, 0x20, 0xA1, 0x03, 0x36, 0x7B, 0xFF, 0x0A, 0x06, 0x0E, 0x64, 0xFF, 0x22, 0x06, 0xB8, 
+    0x62, 0x11, 0x10, 0xB3, 0xF2, 0x08, 0xB3, 0x06, 0x21, 0x11, 0x68, 0xB0, 0xFF, 0x07, 0x07, 0x0E, 
+    0x64, 0xFF, 0x20, 0x08, 0xB7, 0x41, 0x12, 0x33, 0x30, 0xF2, 0x12, 0x08, 0x33, 0x32, 0x11, 0x47, 
+    0x90, 0xFF, 0x05, 0x08, 0x0E, 0x64, 0xFF, 0x1E, 0x07, 0x96, 0x11, 0x13, 0x33, 0xF2, 0x19, 0x06, 
+    0x33, 0x11, 0x16, 0x90, 0xFF, 0x03, 0x09, 0x0E, 0x64, 0xFF, 0x1C, 0x06, 0x96, 0x11, 0x23, 0x30, 
+    0xF2, 0x1E, 0x05, 0x33, 0x21, 0x17, 0xFF, 0x02, 0x0A, 0x0E, 0x64, 0xFF, 0x1A, 0x06, 0xB7, 0x11, 
+    0x33, 0x30, 0xF2, 0x23, 0x02, 0x31, 0x80, 0xFF, 0x02, 0x0B, 0x0E, 0x64, 0xFF, 0x19, 0x04, 0x84, 
+    0x12, 0x30, 0xF2, 0x25, 0x03, 0x31, 0x5D, 0xFF, 0x02, 0x0C, 0x0E, 0x64, 0xFF, 0x17, 0x05, 0x96, 
+    0x11, 0x33, 0xF2, 0x26, 0x02, 0x31, 0x80, 0xFF, 0x03, 0x0D, 0x0E, 0x64, 0xFF, 0x16, 0x04, 0x81, 
+    0x13, 0x30, 0xF2, 0x27, 0x03, 0x31, 0x4D, 0xFF, 0x03, 0x0E, 0x00, 0x0E, 0xF0, 0x05, 0x0E, 0x2B, 
+    0x3A, 0x04, 0xB6, 0x12, 0x30, 0xF2, 0x29, 0x02, 0x31, 0x80, 0x0E, 0x72, 0x0E, 0xF0, 0x05, 0x0F, 
+    0x00, 0x0E, 0xF0, 0x05, 0x0F, 0x2A, 0x3B, 0x04, 0x94, 0x13, 0x30, 0xF2, 0x29, 0x03, 0x31, 0x4B, 
+    0x0F, 0x72, 0x0E, 0xF0, 0x05, 0x10, 0x00, 0x0E, 0xF0, 0x05, 0x10, 0x29, 0x3B, 0x03, 0x83, 0x13, 
+    0xF2, 0x2B, 0x02, 0x31, 0x70, 0x10, 0x72, 0x0E, 0xF0, 0x05, 0x11, 0x00, 0x0E, 0xF0, 0x05, 0x11, 
+    0x28, 0x3C, 0x03, 0x81, 0x13, 0xF2, 0x2B, 0x03, 0x31, 0x2B, 0x11, 0x72, 0x0E, 0xF0, 0x05, 0x12, 
+    0x00, 0x0E, 0xF0, 0x05, 0x12, 0x27, 0x3C, 0x03, 0x71, 0x23, 0xF2, 0x11, 0xF3, 0x05, 0xF2, 0x04, 
+    0x02, 0x31, 0x70, 0x12, 0x72, 0x0E, 0xF0, 0x05, 0x13, 0x00, 0x0E, 0xF0, 0x05, 0x13, 0x26, 0x3D, 
+    0x03, 0x71, 0x33, 0xF2, 0x0E, 0xA3, 0xF1, 0x05, 0xB3, 0xD2, 0x03, 0x32, 0x1B, 0x13, 0x72, 0x0E, 
+    0xF0, 0x05, 0x14, 0x00, 0x0E, 0xF0, 0x05, 0x14, 0x25, 0x3D, 0x03, 0x71, 0x33, 0xF2, 0x0B, 0x03, 
+    0x33, 0x32, 0xA1, 0xA4, 0xB6, 0x04, 0x54, 0x44, 0x30, 0xA1, 0x03, 0x23, 0x33, 0xA2, 0x02, 0x31, 
+    0x60, 0x14, 0x72, 0x0E, 0xF0, 0x05, 0x15, 0x00, 0x0E, 0xF0, 0x05, 0x15, 0x24, 0x3E, 0x03, 0x81, 
+    0x23, 0xF2, 0x0A, 0x0C, 0x33, 0x21, 0x11, 0x47, 0x88, 0xBB, 0xD0, 0xEF, 0x06, 0xDB, 0xB8, 0x87, 
+    0x40, 0xA1, 0xA3, 0x02, 0x21, 0x90, 0x15, 0x72, 0x0E, 0xF0, 0x05, 0x16, 0x00, 0x0E, 0xF0, 0x05, 
+    0x16, 0x23, 0x1F, 0x03, 0x81, 0x23, 0xF2, 0x09, 0x08, 0x33, 0x11, 0x26, 0x8B, 0xD0, 0x16, 0x49, 
+    0x07, 0xDF, 0x16, 0x56, 0x0B, 0x0A, 0xDB, 0x86, 0x41, 0x11, 0x41, 0x60, 0x16, 0x72, 0x0E, 0xF0, 
+    0x05, 0x17, 0x00, 0x0E, 0xF0, 0x05, 0x17, 0x22, 0x1E, 0x03, 0xB4, 0x13, 0xF2, 0x08, 0x08, 0x32, 
+    0x11, 0x58, 0xBF, 0xF0, 0x17, 0x48, 0x07, 0x00, 0xF0, 0xAD, 0x01, 0xFF, 0x17, 0x5A, 0x07, 0x06, 
+    0xB8, 0x63, 0x11, 0x90, 0x17, 0x72, 0x0E, 0xF0, 0x05, 0x18, 0x00, 0x0E, 0xF0, 0x05, 0x18, 0x21, 
+    0x33, 0x03, 0xD6, 0x13, 0xF2, 0x07, 0x05, 0x33, 0x11, 0x68, 0xEF, 0x05, 0xB8, 0xBF, 0xB6, 0xA5, 
+    0x06, 0x66, 0x77, 0x89, 0xB0, 0x18, 0x5D, 0x03, 0x02, 0xB7, 0x70, 0x18, 0x72, 0x0E, 0xF0, 0x05, 
+    0x19, 0x00, 0x0E, 0xF0, 0x05, 0x19, 0x21, 0x34, 0x02, 0x71, 0x30, 0xF2, 0x06, 0x05, 0x33, 0x11, 
+    0x69, 0xDF, 0x08, 0xB6, 0x43, 0x2B, 0xFB, 0x20, 0xE1, 0x03, 0x67, 0x8B, 0x19, 0x72, 0x0E, 0xF0, 
+    0x05, 0x1A, 0x00, 0x0E, 0xF0, 0x05, 0x1A, 0x20, 0x31, 0x03, 0xB1, 0x23, 0xF2, 0x05, 0x04, 0x32, 
+    0x14, 0x80, 0xBF, 0x14, 0xB8, 0xDF, 0x81, 0x11, 0x4B, 0xFB, 0x42, 0x33, 0x31, 0x48, 0xB0, 0x1A, 
+    0x72, 0x0E, 0xF0, 0x05, 0x1B, 0x00, 0x0E, 0xF0, 0x05, 0x1B, 0x20, 0x2F, 0x02, 0x61, 0x30, 0xF2, 
+    0x05, 0x04, 0x31, 0x17, 0xD0, 0xAF, 0x14, 0xB7, 0x41, 0x8F, 0xD4, 0x12, 0x4B, 0xFB, 0x22, 0x31, 
+    0x17, 0xD0, 0x1B, 0x72, 0x0E, 0xF0, 0x05, 0x1C, 0x00, 0x0E, 0xF0, 0x05, 0x1C, 0x1F, 0x2E, 0x02, 
+    0x81, 0x30, 0xF2, 0x05, 0x03, 0x31, 0x48, 0xBF, 0x13, 0xD4, 0x12, 0x17, 0xFF, 0x61, 0x24, 0xBF, 
+    0x91, 0x32, 0x18, 0x1C, 0x72, 0x0E, 0xF0, 0x05, 0x1D, 0x00, 0x0E, 0xF0, 0x05, 0x1D, 0x1F, 0x2D, 
+    0x02, 0x61, 0x30, 0xF2, 0x04, 0x1C, 0x31, 0x6B, 0xFF, 0xFB, 0x8D, 0xF8, 0x14, 0x16, 0xFF, 0x71, 
+    0x14, 0xBF, 0x91, 0x31, 0x80, 0x1D, 0x72, 0x0E, 0xF0, 0x05, 0x1E, 0x00, 0x0E, 0xF0, 0x05, 0x1E, 
+    0x1E, 0x42, 0x03, 0x81, 0x33, 0xF2, 0x03, 0x1C, 0x31, 0x6D, 0xFF, 0xD8, 0x41, 0x8F, 0xD4, 0x12, 
+    0x4B, 0xF8, 0x11, 0x4B, 0xF9, 0x11, 0x70, 0xFF, 0x0C, 0x1E, 0x72, 0x0E, 0xF0, 0x05, 0x1F, 0x00, 
+    0x0E, 0xF0, 0x05, 0x1F, 0x1E, 0x42, 0x02, 0x61, 0x30, 0xF2, 0x03, 0x02, 0x31, 0x70, 0xAF, 0x16, 
+    0x71, 0x21, 0x4D, 0xF8, 0x14, 0x18, 0xFB, 0x11, 0x4B, 0xF9, 0x14, 0xB0, 0xFF, 0x0C, 0x1F, 0x72, 
+    0x0E, 0xF0, 0x05, 0x20, 0x00, 0x0E, 0xF0, 0x05, 0x20, 0x1D, 0x43, 0x03, 0xB3, 0x13, 0xF2, 0x02, 
+    0x02, 0x31, 0x70, 0xBF, 0x15, 0xB4, 0x13, 0x18, 0xFD, 0x41, 0x17, 0xFD, 0x51, 0x4B, 0xF9, 0x17, 
+    0xFF, 0x0D, 0x20, 0x72, 0x0E, 0xF0, 0x05, 0x21, 0x00, 0x0E, 0xF0, 0x05, 0x21, 0x1D, 0x43, 0x02, 
+    0x81, 0x30, 0xF2, 0x02, 0x1E, 0x31, 0x6F, 0xFF, 0x87, 0xFF, 0x81, 0x21, 0x4B, 0xF8, 0x11, 0x4D, 
+    0xF6, 0x15, 0xDF, 0x81, 0xB0, 0xFF, 0x0D, 0x21, 0x72, 0x0E, 0xF0, 0x05, 0x22, 0x00, 0x0E, 0xF0, 
+    0x05, 0x22, 0x1D, 0x43, 0x02, 0x61, 0x30, 0xF2, 0x01, 0x1E, 0x31, 0x6D, 0xFF, 0x81, 0x17, 0xFF, 
+    0x81, 0x31, 0x7F, 0xD4, 0x12, 0x9F, 0x71, 0x4D, 0xF8, 0x10, 0xFF, 0x0E, 0x22, 0x72, 0x0E, 0xF0, 
+    0x05, 0x23, 0x00, 0x0E, 0xF0, 0x05, 0x23, 0x1C, 0x44, 0x01, 0xB1, 0xF2, 0x02, 0x1F, 0x31, 0x4B, 
+    0xFF, 0x81, 0x33, 0x18, 0xFF, 0x71, 0x23, 0xBF, 0x81, 0x17, 0xF9, 0x47, 0xFF, 0xB8, 0xFF, 0x0E, 
+    0x23, 0x72, 0x0E, 0xF0, 0x05, 0x24, 0x00, 0x0E, 0xF0, 0x05, 0x24, 0x1C, 0x44, 0x02, 0x81, 0x30, 
+    0xF2, 0x00, 0x18, 0x32, 0x18, 0xFF, 0xFB, 0x61, 0x32, 0x18, 0xFF, 0x61, 0x16, 0xFD, 0x51, 0x80, 
+    0xFF, 0x16, 0x24, 0x72, 0x0E, 0xF0, 0x05, 0x25, 0x00, 0x0E, 0xF0, 0x05, 0x25, 0x1C, 0x0F, 0x02, 
+    0x61, 0x30, 0xF2, 0x00, 0x02, 0x31, 0x70, 0x25, 0x2F, 0x31, 0x10, 0xFD, 0x71, 0x22, 0x39, 0xFD, 
+    0x61, 0x18, 0xFB, 0xB0, 0xFF, 0x17, 0x25, 0x72, 0x0E, 0xF0, 0x05, 0x26, 0x00, 0x0E, 0xF0, 0x05, 
+    0x26, 0x1C, 0x44, 0x02, 0x61, 0x30, 0xE2, 0x15, 0x31, 0x5D, 0xFF, 0x76, 0xDF, 0xF8, 0x31, 0x14, 
+    0xBF, 0xB4, 0x18, 0xFF, 0x00, 0x05, 0xDD, 0xBB, 0xBD, 0xFF, 0x0B, 0x26, 0x72, 0x0E, 0xF0, 0x05, 
+    0x27, 0x00, 0x0E, 0xF0, 0x05, 0x27, 0x1B, 0x23, 0x03, 0xB4, 0x13, 0xD2, 0x17, 0x33, 0x18, 0xFF, 
+    0x92, 0x14, 0x9F, 0xF9, 0x41, 0x15, 0xBF, 0xBB, 0xFF, 0x27, 0x42, 0x1E, 0x04, 0xB8, 0x76, 0x60, 
+    0xA4, 0x05, 0x56, 0x68, 0x8B, 0xFF, 0x06, 0x27, 0x72, 0x0E, 0xF0, 0x05, 0x28, 0x00, 0x0E, 0xF0, 
+    0x05, 0x28, 0x1B, 0x45, 0x02, 0x81, 0x30, 0xE2, 0x12, 0x31, 0x6F, 0xFF, 0x61, 0x41, 0x18, 0xFF, 
+    0xB6, 0x11, 0x70, 0xDF, 0x02, 0x86, 0x30, 0xF1, 0x04, 0x03, 0x26, 0x79, 0xFF, 0x03, 0x28, 0x72, 
+    0x0E, 0xF0, 0x05, 0x29, 0x00, 0x0E, 0xF0, 0x05, 0x29, 0x1B, 0x45, 0x02, 0x81, 0x30, 0xD2, 0x13, 
+    0x32, 0x19, 0xFF, 0xF8, 0x51, 0x12, 0x16, 0xBF, 0xF7, 0x6B, 0xBF, 0x04, 0x86, 0x11, 0x20, 0xF3, 
+    0x03, 0x07, 0x21, 0x11, 0x26, 0x8D, 0xFF, 0x00, 0x29, 0x72, 0x0E, 0xF0, 0x05, 0x2A, 0x00, 0x0E, 
+    0xF0, 0x05, 0x2A, 0x1B, 0x46, 0x02, 0x81, 0x30, 0xD2, 0x02, 0x31, 0x60, 0xBF, 0x07, 0xD8, 0x51, 
+    0x11, 0x49, 0xDF, 0x06, 0xB6, 0x11, 0x33, 0x30, 0xF2, 0x04, 0x07, 0x33, 0x32, 0x11, 0x58, 0xFF, 
+    0x00, 0x2A, 0x72, 0x0E, 0xF0, 0x05, 0x2B, 0x00, 0x0E, 0xF0, 0x05, 0x2B, 0x1B, 0x46, 0x02, 0x71, 
+    0x30, 0xC2, 0x11, 0x33, 0x18, 0xFF, 0xB9, 0xFF, 0xFD, 0x85, 0x11, 0x18, 0xBF, 0x04, 0x84, 0x13, 
+    0x30, 0xF2, 0x0A, 0x06, 0x33, 0x31, 0x16, 0xB0, 0xDF, 0x2B, 0x72, 0x0E, 0xF0, 0x05, 0x2C, 0x00, 
+    0x0E, 0xF0, 0x05, 0x2C, 0x1B, 0x47, 0x02, 0x61, 0x30, 0xC2, 0x11, 0x31, 0x5D, 0xFF, 0x61, 0x68, 
+    0xBF, 0xFF, 0x85, 0x4B, 0xAF, 0x03, 0x81, 0x13, 0xF2, 0x0F, 0x04, 0x33, 0x14, 0x90, 0xDF, 0x2C, 
+    0x72, 0x0E, 0xF0, 0x05, 0x2D, 0x00, 0x0E, 0xF0, 0x05, 0x2D, 0x1B, 0x48, 0x02, 0x61, 0x30, 0xC2, 
+    0x10, 0x31, 0x7F, 0xFB, 0x21, 0x11, 0x47, 0x9F, 0xFD, 0xB0, 0xAF, 0x03, 0x81, 0x13, 0xF2, 0x12, 
+    0x03, 0x31, 0x18, 0xDF, 0x2D, 0x72, 0x0E, 0xF0, 0x05, 0x2E, 0x00, 0x0E, 0xF0, 0x05, 0x2E, 0x1B, 
+    0x49, 0x02, 0x51, 0x30, 0xD2, 0x04, 0x19, 0xFF, 0x80, 0xD1, 0x01, 0x68, 0xBF, 0x03, 0x91, 0x13, 
+    0xF2, 0x14, 0x03, 0x31, 0x18, 0xDF, 0x2E, 0x72, 0x0E, 0xF0, 0x05, 0x2F, 0x00, 0x0E, 0xF0, 0x05, 
+    0x2F, 0x1B, 0x49, 0x02, 0x51, 0x30, 0xB2, 0x0F, 0x31, 0x4D, 0xFF, 0xFB, 0x88, 0x66, 0x41, 0x16, 
+    0xAF, 0x03, 0xB4, 0x13, 0xF2, 0x16, 0x03, 0x31, 0x29, 0xCF, 0x2F, 0x72, 0x0E, 0xF0, 0x05, 0x30, 
+    0x00, 0x0E, 0xF0, 0x05, 0x30, 0x1B, 0x49, 0x02, 0x51, 0x30, 0xB2, 0x02, 0x31, 0x60, 0xFF, 0x00, 
+    0x03, 0xB9, 0x8B, 0xAF, 0x02, 0x61, 0x30, 0xF2, 0x18, 0x03, 0x31, 0x4B, 0xBF, 0x30, 0x72, 0x0E, 
+    0xF0, 0x05, 0x31, 0x00, 0x0E, 0xF0, 0x05, 0x31, 0x1B, 0x49, 0x02, 0x61, 0x30, 0xB2, 0x08, 0x31, 
+    0x8F, 0xFD, 0x89, 0xB0, 0xFF, 0x01, 0x02, 0x81, 0x30, 0xF2, 0x1A, 0x02, 0x31, 0x60, 0xBF, 0x31, 
+    0x72, 0x0E, 0xF0, 0x05, 0x32, 0x00, 0x0E, 0xF0, 0x05, 0x32, 0x1B, 0x49, 0x02, 0x61, 0x30, 0xB2, 
+    0x15, 0x31, 0x8F, 0xFB, 0x12, 0x44, 0x67, 0x88, 0xDF, 0xFF, 0xD4, 0x13, 0xF2, 0x1B, 0x02, 0x31, 
+    0x80, 0xAF, 0x32, 0x72, 0x0E, 0xF0, 0x05, 0x33, 0x00, 0x0E, 0xF0, 0x05, 0x33, 0x1B, 0x49, 0x02, 
+    0x71, 0x30, 0xB2, 0x07, 0x31, 0x9F, 0xF9, 0x12, 0xC1, 0x06, 0xBF, 0xFF, 0x81, 0x30, 0xF2, 0x1C, 
+    0x06, 0x31, 0x6D, 0xFF, 0xF0, 0x33, 0x72, 0x0E, 0xF0, 0x05, 0x34, 0x00, 0x0E, 0xF0, 0x05, 0x34, 
+    0x1B, 0x49, 0x02, 0x71, 0x30, 0xB2, 0x14, 0x31, 0xBF, 0xF8, 0x13, 0x31, 0x47, 0x8B, 0xFF, 0xFD, 
+    0x41, 0x30, 0xF2, 0x1D, 0x05, 0x31, 0x8F, 0xFF, 0x34, 0x72, 0x0E, 0xF0, 0x05, 0x35, 0x00, 0x0E, 
+    0xF0, 0x05, 0x35, 0x1B, 0x49, 0x02, 0x81, 0x30, 0xB2, 0x0A, 0x31, 0xBF, 0xF8, 0x13, 0x16, 0xB0, 
+    0xCF, 0x02, 0x81, 0x30, 0xF2, 0x1E, 0x05, 0x31, 0x6F, 0xFF, 0x35, 0x72, 0x0E, 0xF0, 0x05, 0x36, 
+    0x00, 0x0E, 0xF0, 0x05, 0x36, 0x1B, 0x49, 0x02, 0x81, 0x30, 0xB2, 0x08, 0x31, 0x9F, 0xF8, 0x11, 
+    0x70, 0xEF, 0x02, 0x61, 0x30, 0xF2, 0x1F, 0x04, 0x31, 0x9F, 0xF0, 0x36, 0x72, 0x0E, 0xF0, 0x05, 
+    0x37, 0x00, 0x0E, 0xF0, 0x05, 0x37, 0x1B, 0x49, 0x03, 0xB3, 0x23, 0xA2, 0x07, 0x31, 0x8F, 0xF7, 
+    0x17, 0xEF, 0x03, 0xD4, 0x13, 0xF2, 0x1F, 0x04, 0x31, 0x7F, 0xF0, 0x37, 0x72, 0x0E, 0xF0, 0x05, 
+    0x38, 0x00, 0x0E, 0xF0, 0x05, 0x38, 0x1B, 0x49, 0x03, 0xD5, 0x13, 0xA2, 0x07, 0x31, 0x8F, 0xF7, 
+    0x3B, 0xEF, 0x01, 0x91, 0xF2, 0x21, 0x04, 0x31, 0x4B, 0xF0, 0x38, 0x72, 0x0E, 0xF0, 0x05, 0x39, 
+    0x00, 0x0E, 0xF0, 0x05, 0x39, 0x1C, 0x48, 0x02, 0x61, 0x30, 0xA2, 0x06, 0x31, 0x8F, 0xF6, 0x70, 
+    0xFF, 0x00, 0x02, 0x81, 0x30, 0xF2, 0x17, 0x0D, 0x33, 0x32, 0x22, 0x33, 0x22, 0x31, 0x8F, 0x39, 
+    0x72, 0x0E, 0xF0, 0x05, 0x3A, 0x00, 0x0E, 0xF0, 0x05, 0x3A, 0x1C, 0x48, 0x02, 0x71, 0x30, 0xA2, 
+    0x06, 0x31, 0x6F, 0xF7, 0x90, 0xFF, 0x00, 0x02, 0x71, 0x30, 0xF2, 0x15, 0x01, 0x33, 0xE1, 0x05, 
+    0x33, 0x31, 0x6F, 0x3A, 0x72, 0x0E, 0xF0, 0x05, 0x3B, 0x00, 0x0E, 0xF0, 0x05, 0x3B, 0x1C, 0x48, 
+    0x02, 0x91, 0x30, 0xA2, 0x05, 0x31, 0x6F, 0xF8, 0xFF, 0x01, 0x02, 0x71, 0x30, 0xF2, 0x14, 0x10, 
+    0x31, 0x16, 0x78, 0x99, 0x87, 0x61, 0x13, 0x31, 0x90, 0x3B, 0x72, 0x0E, 0xF0, 0x05, 0x3C, 0x00, 
+    0x0E, 0xF0, 0x05, 0x3C, 0x1C, 0x48, 0x0C, 0xB4, 0x13, 0x22, 0x23, 0x14, 0xDF, 0xD0, 0xFF, 0x01, 
+    0x02, 0x71, 0x30, 0xF2, 0x14, 0x02, 0x16, 0x80, 0xEF, 0x05, 0x86, 0x13, 0x16, 0x3C, 0x72, 0x0E, 
+    0xF0, 0x05, 0x3D, 0x00, 0x0E, 0xF0, 0x05, 0x3D, 0x1D, 0x48, 0x09, 0x61, 0x32, 0x22, 0x31, 0x4B, 
+    0xFF, 0x03, 0x02, 0x71, 0x30, 0xF2, 0x12, 0x03, 0x31, 0x7D, 0xFF, 0x01, 0x05, 0xD7, 0x12, 0x2B, 
+    0x3D, 0x72, 0x0E, 0xF0, 0x05, 0x3E, 0x00, 0x0E, 0xF0, 0x05, 0x3E, 0x1D, 0x3E, 0x02, 0x81, 0x30, 
+    0xA2, 0x02, 0x31, 0x80, 0xFF, 0x03, 0x02, 0x71, 0x30, 0xF2, 0x11, 0x02, 0x31, 0x60, 0xEF, 0x3E, 
+    0x61, 0x04, 0x03, 0x61, 0x17, 0x3E, 0x72, 0x0E, 0xF0, 0x05, 0x3F, 0x00, 0x0E, 0xF0, 0x05, 0x3F, 
+    0x1D, 0x12, 0x09, 0xB2, 0x13, 0x22, 0x23, 0x18, 0xEF, 0x3F, 0x33, 0x26, 0x02, 0x81, 0x30, 0xF2, 
+    0x11, 0x03, 0x32, 0x48, 0xBF, 0x3F, 0x61, 0x05, 0x04, 0xB4, 0x14, 0xB0, 0x3F, 0x72, 0x0E, 0xF0, 
+    0x05, 0x40, 0x00, 0x0E, 0xF0, 0x05, 0x40, 0x1E, 0x10, 0x08, 0x51, 0x32, 0x22, 0x31, 0x70, 0xDF, 
+    0x40, 0x33, 0x24, 0x03, 0x92, 0x23, 0xF2, 0x11, 0x05, 0x31, 0x17, 0xDF, 0x40, 0x62, 0x04, 0x03, 
+    0x81, 0x18, 0x40, 0x72, 0x0E, 0xF0, 0x05, 0x41, 0x00, 0x0E, 0xF0, 0x05, 0x41, 0x1E, 0x09, 0x08, 
+    0x71, 0x32, 0x22, 0x31, 0x60, 0x41, 0x33, 0x25, 0x03, 0xD4, 0x13, 0xF2, 0x12, 0x05, 0x32, 0x14, 
+    0x8D, 0x41, 0x62, 0x05, 0x04, 0xB4, 0x14, 0xB0, 0x41, 0x72, 0x0E, 0xF0, 0x05, 0x42, 0x00, 0x0E, 
+    0xF0, 0x05, 0x42, 0x1E, 0x0A, 0x09, 0x91, 0x23, 0x22, 0x31, 0x4D, 0x42, 0x34, 0x27, 0x02, 0x61, 
+    0x30, 0xF2, 0x13, 0x07, 0x33, 0x11, 0x58, 0x9D, 0x42, 0x63, 0x04, 0x03, 0x61, 0x17, 0x42, 0x72, 
+    0x0E, 0xF0, 0x05, 0x43, 0x00, 0x0E, 0xF0, 0x05, 0x43, 0x1E, 0x0A, 0x09, 0xD5, 0x13, 0x22, 0x31, 
+    0x3D, 0x43, 0x34, 0x34, 0x02, 0x81, 0x30, 0xF2, 0x15, 0x05, 0x33, 0x11, 0x14, 0xA6, 0x08, 0xDF, 
+    0xFF, 0x81, 0x24, 0xB0, 0x43, 0x72, 0x0E, 0xF0, 0x05, 0x44, 0x00, 0x0E, 0xF0, 0x05, 0x44, 0x1F, 
+    0x09, 0x08, 0x71, 0x32, 0x23, 0x13, 0xB0, 0x44, 0x34, 0x34, 0x02, 0x91, 0x30, 0xF2, 0x17, 0x02, 
+    0x33, 0x30, 0xA1, 0x09, 0x3D, 0xFF, 0xF8, 0x14, 0x17, 0x44, 0x72, 0x0E, 0xF0, 0x05, 0x45, 0x00, 
+    0x0E, 0xF0, 0x05, 0x45, 0x1F, 0x09, 0x08, 0x81, 0x32, 0x23, 0x22, 0xB0, 0x45, 0x34, 0x35, 0x03, 
+    0xD4, 0x13, 0xF2, 0x19, 0x0E, 0x33, 0x32, 0x4D, 0xFF, 0xF8, 0x13, 0x21, 0x90, 0x45, 0x72, 0x0E, 
+    0xF0, 0x05, 0x46, 0x00, 0x0E, 0xF0, 0x05, 0x46, 0x1F, 0x09, 0x08, 0xB3, 0x23, 0x23, 0x22, 0xB0, 
+    0x46, 0x35, 0x2A, 0x02, 0x61, 0x30, 0xF2, 0x1B, 0x02, 0x31, 0x40, 0x46, 0x63, 0x07, 0x06, 0x81, 
+    0x33, 0x15, 0xD0, 0x46, 0x72, 0x0E, 0xF0, 0x05, 0x47, 0x00, 0x0E, 0xF0, 0x05, 0x47, 0x20, 0x08, 
+    0x07, 0x61, 0x32, 0x32, 0x2B, 0x47, 0x35, 0x2A, 0x02, 0x81, 0x30, 0xF2, 0x1B, 0x02, 0x31, 0x40, 
+    0x47, 0x63, 0x07, 0x06, 0x81, 0x33, 0x31, 0x70, 0x47, 0x72, 0x0E, 0xF0, 0x05, 0x48, 0x00, 0x0E, 
+    0xF0, 0x05, 0x48, 0x20, 0x08, 0x07, 0x61, 0x32, 0x31, 0x3B, 0x48, 0x35, 0x2A, 0x03, 0xB1, 0x23, 
+    0xF2, 0x1A, 0x02, 0x31, 0x40, 0x48, 0x63, 0x08, 0x00, 0x80, 0xC1, 0x00, 0x80, 0x48, 0x72, 0x0E, 
+    0xF0, 0x05, 0x49, 0x00, 0x0E, 0xF0, 0x05, 0x49, 0x20, 0x08, 0x07, 0x71, 0x32, 0x31, 0x3D, 0x49, 
+    0x35, 0x37, 0x03, 0xD5, 0x13, 0xF2, 0x1A, 0x0F, 0x31, 0x4D, 0xFF, 0xFB, 0x88, 0x64, 0x41, 0x3B, 
+    0x49, 0x72, 0x0E, 0xF0, 0x05, 0x4A, 0x00, 0x0E, 0xF0, 0x05, 0x4A, 0x20, 0x08, 0x07, 0x71, 0x32, 
+    0x31, 0x4D, 0x4A, 0x36, 0x2A, 0x02, 0x71, 0x30, 0xF2, 0x1A, 0x03, 0x31, 0x4D, 0x4A, 0x67, 0x05, 
+    0x04, 0xDB, 0x98, 0x80, 0x4A, 0x72, 0x0E, 0xF0, 0x05, 0x4B, 0x00, 0x0E, 0xF0, 0x05, 0x4B, 0x20, 
+    0x07, 0x06, 0x81, 0x32, 0x31, 0x60, 0x4B, 0x36, 0x2A, 0x02, 0x81, 0x30, 0xF2, 0x1A, 0x03, 0x31, 
+    0x4B, 0x4B, 0x72, 0x0E, 0xF0, 0x05, 0x4C, 0x00, 0x0E, 0xF0, 0x05, 0x4C, 0x20, 0x07, 0x06, 0x81, 
+    0x22, 0x31, 0x70, 0x4C, 0x36, 0x2A, 0x02, 0x81, 0x30, 0xF2, 0x1A, 0x03, 0x31, 0x4B, 0x4C, 0x72, 
+    0x0E, 0xF0, 0x05, 0x4D, 0x00, 0x0E, 0xF0, 0x05, 0x4D, 0x20, 0x07, 0x06, 0x81, 0x22, 0x31, 0x80, 
+    0x4D, 0x36, 0x2A, 0x03, 0x92, 0x23, 0xF2, 0x19, 0x03, 0x31, 0x3B, 0x4D, 0x72, 0x0E, 0xF0, 0x05, 
+    0x4E, 0x00, 0x0E, 0xF0, 0x05, 0x4E, 0x20, 0x07, 0x06, 0x81, 0x23, 0x21, 0x90, 0x4E, 0x36, 0x2A, 
+    0x03, 0x92, 0x23, 0xF2, 0x19, 0x03, 0x32, 0x29, 0x4E, 0x72, 0x0E, 0xF0, 0x05, 0x4F, 0x00, 0x0E, 
+    0xF0, 0x05, 0x4F, 0x20, 0x07, 0x06, 0x81, 0x33, 0x14, 0xD0, 0x4F, 0x36, 0x2A, 0x03, 0xB2, 0x23, 
+    0xF2, 0x1B, 0x01, 0x18, 0x4F, 0x72, 0x0E, 0xF0, 0x05, 0x50, 0x00, 0x0E, 0xF0, 0x05, 0x50, 0x20, 
+    0x06, 0x05, 0x81, 0x33, 0x16, 0x50, 0x36, 0x2A, 0x03, 0x92, 0x23, 0xF2, 0x03, 0xB3, 0xF2, 0x09, 
+    0x02, 0x31, 0x80, 0x50, 0x72, 0x0E, 0xF0, 0x05, 0x51, 0x00, 0x0E, 0xF0, 0x05, 0x51, 0x20, 0x06, 
+    0x05, 0x71, 0x33, 0x18, 0x51, 0x36, 0x2A, 0x02, 0x81, 0x30, 0xF2, 0x01, 0x03, 0x33, 0x32, 0xA1, 
+    0x00, 0x30, 0xF2, 0x08, 0x02, 0x31, 0x70, 0x51, 0x72, 0x0E, 0xF0, 0x05, 0x52, 0x00, 0x0E, 0xF0, 
+    0x05, 0x52, 0x20, 0x06, 0x05, 0x61, 0x31, 0x4D, 0x52, 0x36, 0x2A, 0x02, 0x71, 0x30, 0xD2, 0x0D, 
+    0x33, 0x32, 0x11, 0x14, 0x67, 0x41, 0x33, 0xF2, 0x06, 0x02, 0x31, 0x70, 0x52, 0x72, 0x0E, 0xF0, 
+    0x05, 0x53, 0x00, 0x0E, 0xF0, 0x05, 0x53, 0x1F, 0x06, 0x05, 0xB4, 0x13, 0x18, 0x53, 0x36, 0x2A, 
+    0x05, 0x71, 0x32, 0x22, 0xA3, 0x0E, 0x11, 0x13, 0x68, 0x8D, 0xFF, 0xB6, 0x12, 0x30, 0xF2, 0x05, 
+    0x02, 0x31, 0x60, 0x53, 0x72, 0x0E, 0xF0, 0x05, 0x54, 0x00, 0x0E, 0xF0, 0x05, 0x54, 0x1F, 0x06, 
+    0x05, 0x91, 0x31, 0x5D, 0x54, 0x35, 0x2C, 0x06, 0xD5, 0x13, 0x33, 0x20, 0xA1, 0x03, 0x57, 0x8B, 
+    0xEF, 0x04, 0x71, 0x13, 0x30, 0xF2, 0x03, 0x03, 0x31, 0x6D, 0x54, 0x72, 0x0E, 0xF0, 0x05, 0x55, 
+    0x00, 0x0E, 0xF0, 0x05, 0x55, 0x1F, 0x05, 0x04, 0x71, 0x31, 0x90, 0x55, 0x35, 0x0C, 0x02, 0xB1, 
+    0x20, 0xA1, 0x04, 0x46, 0x89, 0xD0, 0x55, 0x4D, 0x14, 0x04, 0x95, 0x12, 0x30, 0xF2, 0x02, 0x03, 
+    0x32, 0x3B, 0x55, 0x72, 0x0E, 0xF0, 0x05, 0x56, 0x0E, 0x64, 0xFF, 0x07, 0x04, 0xB4, 0x21, 0x70, 
+    0xFF, 0x09, 0x07, 0x81, 0x14, 0x67, 0x8B, 0xFF, 0x08, 0x05, 0xD7, 0x11, 0x33, 0xF2, 0x01, 0x02, 
+    0x31, 0x90, 0xFF, 0x08, 0x57, 0x0E, 0x64, 0xFF, 0x07, 0x03, 0x71, 0x16, 0xFF, 0x0A, 0x03, 0xB8, 
+    0xBD, 0xFF, 0x0E, 0x04, 0x96, 0x11, 0x30, 0xF2, 0x00, 0x02, 0x31, 0x80, 0xFF, 0x08, 0x58, 0x0E, 
+    0x64, 0xFF, 0x06, 0x04, 0x81, 0x16, 0xD0, 0xFF, 0x26, 0x05, 0xD8, 0x31, 0x33, 0xD2, 0x02, 0x31, 
+    0x70, 0xFF, 0x08, 0x59, 0x0E, 0x64, 0xFF, 0x05, 0x03, 0x81, 0x17, 0xFF, 0x2A, 0x05, 0xB6, 0x11, 
+    0x33, 0xB2, 0x02, 0x31, 0x60, 0xFF, 0x08, 0x5A, 0x0E, 0x64, 0xFF, 0x04, 0x03, 0x86, 0x69, 0xFF, 
+    0x2D, 0x0C, 0x85, 0x11, 0x33, 0x22, 0x23, 0x15, 0xD0, 0xFF, 0x07, 0x5B, 0x0E, 0x64, 0xFF, 0x04, 
+    0x01, 0xBB, 0xFF, 0x30, 0x0B, 0xD8, 0x41, 0x23, 0x32, 0x32, 0x3B, 0xFF, 0x07, 0x5C, 0x0E, 0x64, 
+    0xFF, 0x41, 0x09, 0xB7, 0x31, 0x23, 0x33, 0x18, 0xFF, 0x07, 0x5D, 0x0E, 0x64, 0xFF, 0x43, 0x07, 
+    0xB6, 0x11, 0x23, 0x17, 0xFF, 0x07, 0x5E, 0x0E, 0x64, 0xFF, 0x45, 0x05, 0x96, 0x21, 0x16, 0xFF, 
+    0x07, 0x5F, 0x0E, 0x64, 0xFF, 0x47, 0x04, 0xB7, 0x31, 0xB0, 0xFF, 0x06, 0x60, 0x0E, 0x64, 0xFF, 
+    0x49, 0x02, 0xB8, 0xB0, 0xFF, 0x06, 0x61, 0x0E, 0x64, 0xFF, 0x5B, 0x62, 0x0E, 0x64, 0xFF, 0x5B, 
+    0xFF, 
+};
+
+const gfx_anim_t LOGO_ANIM = {
+    LOGO_ANIM_W, LOGO_ANIM_H, LOGO_ANIM_FRAMES,
+    LOGO_ANIM_PAL, &LOGO_ANIM_KEY, LOGO_ANIM_OFFS, LOGO_ANIM_DELTA
+};
@@ -0,0 +1,155 @@
+#include <stdint.h>
+#include "lore_text.h"
+
+static const uint8_t LORE_PAIRS[LORE_CODES * 2] = {
+    0x6F, 0x75, 0x65, 0x20, 0x79, 0x80, 0x20, 0x74, 0x69, 0x6E, 0x65, 0x72, 0x2E, 0x20, 0x20, 0x82,
+    0x68, 0x81, 0x6F, 0x6E, 0x73, 0x20, 0x20, 0x73, 0x84, 0x67, 0x68, 0x65, 0x61, 0x72, 0x65, 0x6E,
+    0x61, 0x6E, 0x6F, 0x77, 0x72, 0x61, 0x61, 0x74, 0x72, 0x20, 0x83, 0x88, 0x6F, 0x6D, 0x65, 0x64,
+    0x69, 0x74, 0x6C, 0x6C, 0x74, 0x20, 0x65, 0x73, 0x74, 0x85, 0x59, 0x80, 0x61, 0x20, 0x61, 0x79,
+    0x6F, 0x20, 0x6F, 0x72, 0x74, 0x88, 0x87, 0x20, 0x79, 0x20, 0x89, 0x20, 0x61, 0x63, 0x65, 0x6C,
+    0x65, 0x74, 0x74, 0x6F, 0x83, 0x8D, 0x90, 0x64, 0x61, 0x6C, 0x65, 0x6D, 0x65, 0x79, 0x69, 0x67,
+    0x6F, 0x66, 0x83, 0xA0, 0x87, 0x72, 0x87, 0x94, 0x8B, 0x74, 0x21, 0x20, 0x61, 0x73, 0x63, 0x93,
+    0x64, 0x65, 0x65, 0x76, 0x69, 0x73, 0x6B, 0x6E, 0x6E, 0x65, 0x82, 0x20, 0x83, 0x92, 0x85, 0x20,
+    0x92, 0x67, 0xAF, 0x68, 0x54, 0x88, 0x61, 0x64, 0x64, 0xC0, 0x65, 0x70, 0x66, 0x65, 0x68, 0x61,
+    0x69, 0x6C, 0x69, 0x8A, 0x69, 0x99, 0x6C, 0x65, 0x6C, 0x6F, 0x75, 0x6E, 0x86, 0x48, 0x86, 0x53,
+    0x20, 0x67, 0x20, 0x77, 0x27, 0x8A, 0x2C, 0x20, 0x2C, 0xA3, 0x2E, 0x2E, 0x61, 0x67, 0x65, 0x8A,
+    0x66, 0x9C, 0x68, 0x20, 0x69, 0x64, 0x69, 0x72, 0x69, 0x76, 0x70, 0x70, 0x72, 0x65, 0x72, 0x6E,
+    0x81, 0x73, 0x82, 0x94, 0x86, 0x57, 0x8E, 0x74, 0x8F, 0x9C, 0x9D, 0x8B, 0x9F, 0x8A, 0xAD, 0xA5,
+    0xB9, 0x85, 0xBB, 0xC1,
+};
+
+static const uint8_t LORE_LENS[LORE_CODES] = {
+    0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0x05, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x04, 0x05, 0x06, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x03,
+    0x03, 0x03, 0x04, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x02, 0x02, 0x03, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x05, 0x03, 0x03, 0x05, 0x05, 0x04, 0x05, 0x04, 0x05,
+};
+
+static const uint8_t LORE_DATA[LORE_DATA_SIZE] = {
+    0x9D, 0xD1, 0x61, 0x6B, 0x81, 0x75, 0x70, 0x20, 0x66, 0x72, 0x96, 0x00, 0x9E, 0x64, 0xDE, 0x61,
+    0x6D, 0x86, 0x45, 0x79, 0x9B, 0x00, 0x62, 0x6C, 0x84, 0xBB, 0x67, 0x20, 0x66, 0x72, 0x96, 0xAA,
+    0x00, 0x64, 0x72, 0xA4, 0x61, 0xDB, 0x86, 0x43, 0xB6, 0x74, 0x8C, 0x00, 0xE1, 0xAE, 0xD7, 0x80,
+    0x74, 0x73, 0x69, 0xB8, 0x2C, 0x00, 0xBD, 0x8F, 0x6A, 0x6F, 0x79, 0x95, 0x73, 0xCD, 0x2E, 0x00,
+    0x46, 0x84, 0x61, 0x99, 0xA4, 0x67, 0xA8, 0x74, 0x8C, 0x20, 0x75, 0x70, 0x2C, 0x00, 0x82, 0xB4,
+    0xE3, 0xB3, 0x64, 0x9F, 0x2E, 0x00, 0x4C, 0x89, 0x67, 0x20, 0xD6, 0x6F, 0x2C, 0x00, 0x45, 0x4D,
+    0x47, 0xD1, 0x8E, 0x72, 0x69, 0xA1, 0x73, 0xBE, 0x84, 0x97, 0x00, 0x74, 0xA0, 0x66, 0xC1, 0x9A,
+    0xB9, 0xC8, 0x86, 0x4E, 0x91, 0x2C, 0x00, 0xA2, 0xDE, 0xAC, 0x6D, 0x8A, 0x67, 0x72, 0x91, 0x20,
+    0x84, 0xA9, 0x00, 0x63, 0xC7, 0x6F, 0x73, 0x86, 0x50, 0x65, 0xA6, 0x81, 0xC9, 0x6E, 0x91, 0x00,
+    0x67, 0x89, 0x65, 0x2E, 0x00, 0x48, 0x8F, 0x63, 0x65, 0xD3, 0x9E, 0xBC, 0x77, 0x00, 0x63, 0xC7,
+    0x99, 0x8F, 0x67, 0xBF, 0x72, 0xBA, 0x9B, 0xD5, 0x2E, 0x00, 0x41, 0xD8, 0xB3, 0x64, 0x61, 0xC8,
+    0x79, 0x00, 0x6D, 0xA1, 0x6E, 0x8C, 0x8B, 0x9B, 0x73, 0x69, 0x89, 0x2C, 0x87, 0x00, 0x77, 0xAC,
+    0x6B, 0x83, 0x91, 0x8E, 0x64, 0x73, 0x95, 0x74, 0x92, 0x00, 0x2D, 0x84, 0x8C, 0xD0, 0x72, 0x80,
+    0x6E, 0x64, 0x73, 0xCE, 0x85, 0x65, 0x00, 0x82, 0xB4, 0xE3, 0xB1, 0x67, 0xA8, 0x00, 0x73, 0x85,
+    0x69, 0x80, 0x73, 0xB5, 0x41, 0x6E, 0x20, 0xDB, 0xA5, 0x64, 0x75, 0x6D, 0x00, 0x2D, 0x6D, 0xA4,
+    0xB7, 0x63, 0x8D, 0x73, 0xB3, 0xAE, 0x65, 0x00, 0x86, 0x9D, 0xB4, 0x8E, 0x81, 0x93, 0x20, 0x98,
+    0x00, 0xAB, 0xAA, 0x6E, 0xB4, 0x72, 0x69, 0x6B, 0x65, 0x21, 0x21, 0x21, 0x00, 0x48, 0x45, 0x59,
+    0xB5, 0x53, 0xE6, 0x9E, 0x76, 0xCA, 0xD6, 0x85, 0x00, 0xE5, 0xA9, 0x70, 0xBE, 0x84, 0x8C, 0xCE,
+    0x00, 0x2D, 0xE0, 0x9F, 0x73, 0x95, 0x76, 0xCA, 0xD6, 0x85, 0x00, 0x6B, 0xDA, 0x8A, 0x65, 0x78,
+    0x70, 0x6C, 0xA1, 0x97, 0xAA, 0x00, 0xB7, 0xA6, 0x96, 0x62, 0x8A, 0xAB, 0x20, 0xC7, 0x76, 0x8F,
+    0x27, 0x00, 0x2D, 0x9A, 0x72, 0xA8, 0x75, 0xDF, 0x97, 0xB5, 0x48, 0x8F, 0x63, 0x65, 0x2C, 0x00,
+    0xBD, 0x62, 0x92, 0x76, 0xA7, 0x79, 0xBE, 0x76, 0xA7, 0x00, 0xA9, 0x95, 0xB7, 0xA6, 0x96, 0x62,
+    0x73, 0x00, 0xA9, 0x8B, 0x61, 0x76, 0x81, 0xA2, 0x6B, 0xDA, 0x73, 0x2E, 0x00, 0xC2, 0x76, 0xCA,
+    0xD6, 0x81, 0x74, 0x68, 0x90, 0x6B, 0x8A, 0x79, 0x00, 0x2D, 0x80, 0x94, 0x65, 0x66, 0x66, 0xA1,
+    0x74, 0x73, 0x86, 0x47, 0xDC, 0x8C, 0x00, 0x61, 0x8B, 0x75, 0x6D, 0x20, 0xB0, 0x8B, 0xC8, 0x76,
+    0x85, 0xE2, 0x98, 0x00, 0x2D, 0x68, 0x83, 0x68, 0xC9, 0x6D, 0x89, 0x65, 0xA4, 0x6F, 0x62, 0x74,
+    0x61, 0x84, 0x00, 0xBD, 0x8D, 0xC3, 0x20, 0xB0, 0x66, 0x83, 0x6F, 0xAA, 0x00, 0x6B, 0x8C, 0x64,
+    0x96, 0xB1, 0x62, 0x65, 0x63, 0x96, 0x81, 0x61, 0x00, 0x70, 0x75, 0x6C, 0x73, 0x65, 0x2D, 0xE9,
+    0x74, 0xB5, 0x48, 0x91, 0xB9, 0x65, 0x00, 0x2D, 0x94, 0xAC, 0x89, 0x67, 0x95, 0x77, 0x9F, 0x87,
+    0x00, 0x8E, 0xE0, 0xA9, 0xDD, 0x97, 0x20, 0x62, 0xA4, 0x9E, 0x67, 0x72, 0x6F, 0x00, 0x2D, 0x75,
+    0x70, 0x20, 0xB0, 0xD5, 0x86, 0x62, 0xAB, 0x98, 0x73, 0x3F, 0x21, 0x00, 0x41, 0xD8, 0x20, 0xB8,
+    0xC6, 0x93, 0x8C, 0xAA, 0x00, 0x62, 0xAB, 0x98, 0x73, 0xA3, 0x63, 0x89, 0x74, 0x84, 0x75, 0x65,
+    0x00, 0x89, 0x77, 0x8E, 0x64, 0xCF, 0x6F, 0x89, 0x8B, 0xE8, 0xAC, 0x00, 0x64, 0x9F, 0x73, 0xA3,
+    0x63, 0x96, 0x81, 0xA6, 0x72, 0x6F, 0x73, 0x73, 0x00, 0x9E, 0xE9, 0x9A, 0x63, 0x61, 0x6D, 0x70,
+    0x20, 0xBC, 0x8E, 0x83, 0x00, 0x2D, 0x88, 0x6B, 0x8C, 0x64, 0x96, 0x86, 0xE5, 0x65, 0x65, 0x00,
+    0xA9, 0x83, 0x9B, 0x74, 0xB2, 0x8B, 0x6B, 0xCA, 0x73, 0x2E, 0x00, 0x41, 0xBE, 0x84, 0x8C, 0x20,
+    0xE9, 0x9A, 0xBA, 0x00, 0x90, 0x67, 0x85, 0x97, 0x20, 0x62, 0x79, 0xB3, 0x65, 0x67, 0x6F, 0x2E,
+    0x00, 0x48, 0x81, 0x63, 0xC7, 0x99, 0x8F, 0x67, 0x9B, 0x87, 0x21, 0x00, 0x53, 0xE8, 0xAC, 0x20,
+    0x64, 0xE6, 0x67, 0x89, 0x81, 0x62, 0x79, 0x00, 0x73, 0x84, 0x63, 0x81, 0xE1, 0x8E, 0x72, 0xDC,
+    0xAC, 0x2E, 0x00, 0xE5, 0x6F, 0xA5, 0x8D, 0x8E, 0x8B, 0x96, 0x65, 0x00, 0xBC, 0x77, 0x8A, 0x61,
+    0x62, 0x80, 0x9A, 0x61, 0x83, 0x80, 0xDF, 0x61, 0x00, 0x2D, 0x6D, 0x8F, 0x74, 0xD4, 0xE4, 0xD3,
+    0x68, 0x6F, 0x00, 0x2D, 0x70, 0x8C, 0xB1, 0x6D, 0x61, 0x6B, 0x81, 0x9E, 0x6E, 0x61, 0x6D, 0x65,
+    0x00, 0x66, 0xA1, 0xB2, 0x73, 0xA7, 0x66, 0x86, 0x41, 0xD8, 0x00, 0x6D, 0x90, 0xA4, 0x64, 0x75,
+    0xA7, 0x73, 0xA3, 0xE4, 0x00, 0xA2, 0x66, 0x84, 0xAC, 0x86, 0x41, 0x20, 0xE9, 0x74, 0x00, 0x70,
+    0x72, 0xC5, 0x8E, 0xD7, 0x68, 0xC9, 0x77, 0x65, 0x61, 0x70, 0x89, 0x2E, 0x00, 0x57, 0x84, 0x6E,
+    0x8C, 0x95, 0x74, 0x80, 0xDF, 0xAE, 0x00, 0x67, 0x61, 0x76, 0x81, 0x82, 0x95, 0x70, 0xB6, 0x73,
+    0x00, 0x74, 0xA0, 0x41, 0x72, 0x63, 0x90, 0x81, 0x54, 0x91, 0x85, 0xCE, 0x61, 0x70, 0x00, 0x2D,
+    0xDD, 0xC8, 0xA4, 0xA6, 0x63, 0xC5, 0x74, 0x8C, 0xAA, 0x00, 0xDE, 0x77, 0x8E, 0x64, 0xD4, 0x8D,
+    0xC3, 0x83, 0x6F, 0x00, 0x9E, 0x66, 0xCC, 0x93, 0x8C, 0x83, 0x91, 0xBF, 0x84, 0x00, 0xA2, 0x73,
+    0x6B, 0x79, 0x86, 0x45, 0x6E, 0x9C, 0x8C, 0x20, 0x84, 0x00, 0x2D, 0x73, 0xDA, 0x81, 0x41, 0x72,
+    0x63, 0x90, 0x81, 0x54, 0x91, 0x85, 0x2C, 0x00, 0x90, 0xD0, 0x92, 0x6D, 0x70, 0x8A, 0x77, 0x90,
+    0x74, 0x73, 0xB2, 0x00, 0x8D, 0x6C, 0x70, 0x86, 0x42, 0x75, 0x74, 0xA3, 0x6D, 0x75, 0x73, 0x74,
+    0x00, 0xB8, 0xC6, 0x93, 0x20, 0x68, 0x69, 0x6D, 0x20, 0x66, 0xDB, 0x73, 0x74, 0x2E, 0x00, 0xC2,
+    0x73, 0xA1, 0x63, 0x85, 0xBF, 0xBC, 0x97, 0x8A, 0x68, 0x00, 0x2D, 0xA7, 0x70, 0xB1, 0xCC, 0xB7,
+    0x81, 0xA2, 0x44, 0x00, 0xE7, 0x43, 0xB6, 0x74, 0xCB, 0xCE, 0x81, 0xBC, 0x97, 0x00, 0x9E, 0xC4,
+    0x89, 0xD2, 0x8D, 0xE3, 0xCF, 0x6F, 0x00, 0x61, 0xD8, 0xBE, 0x76, 0xA7, 0x8C, 0x2C, 0x00, 0xA2,
+    0xC4, 0x89, 0xD2, 0x6C, 0x61, 0x69, 0x94, 0xBA, 0x00, 0x84, 0x66, 0x72, 0x89, 0x9A, 0xB0, 0x87,
+    0xCF, 0x74, 0xC5, 0x00, 0x62, 0x79, 0xB4, 0xC5, 0x87, 0xBE, 0x76, 0x85, 0x73, 0x65, 0x00, 0x84,
+    0x73, 0x69, 0xB8, 0xCF, 0x6F, 0x89, 0x87, 0x8B, 0x65, 0x65, 0x00, 0xA2, 0xC4, 0x89, 0xB4, 0x8E,
+    0x8C, 0x2E, 0x00, 0x49, 0x9A, 0x72, 0x6F, 0x8E, 0x8A, 0x26, 0x20, 0x63, 0x68, 0x8E, 0x67, 0x9B,
+    0x21, 0x00, 0x52, 0xA8, 0x75, 0xDF, 0x8C, 0xB1, 0x41, 0x72, 0x63, 0x90, 0x65, 0x00, 0x54, 0x91,
+    0xBF, 0x67, 0xDC, 0x84, 0x95, 0x53, 0xA1, 0x63, 0x00, 0x2D, 0x85, 0x85, 0x95, 0xC4, 0xA5, 0x8D,
+    0x00, 0x2D, 0xE3, 0xD3, 0x88, 0x67, 0xDC, 0x9B, 0x87, 0x00, 0xA2, 0xCC, 0xB7, 0x69, 0xA5, 0xB0,
+    0xAA, 0x00, 0x44, 0xE7, 0x43, 0xB6, 0x74, 0xCB, 0x86, 0x4D, 0x90, 0x79, 0x00, 0x79, 0x65, 0x8E,
+    0x8A, 0x70, 0xB6, 0x9A, 0x84, 0xB2, 0x00, 0x6A, 0x80, 0x72, 0xAE, 0x86, 0xC2, 0x8D, 0x99, 0xBA,
+    0x68, 0x00, 0x8F, 0x76, 0xDB, 0x96, 0x8F, 0x9A, 0x68, 0x96, 0x9B, 0xAA, 0x00, 0x44, 0xE7, 0x4B,
+    0x8C, 0x86, 0x45, 0x6E, 0x9C, 0x8C, 0x00, 0x88, 0x73, 0x98, 0x8A, 0x89, 0x83, 0x68, 0x72, 0x89,
+    0x65, 0x2E, 0x00, 0x5B, 0x77, 0x91, 0xE2, 0x4F, 0x4E, 0x44, 0x45, 0x52, 0x46, 0x55, 0x4C, 0x21,
+    0x21, 0x21, 0x5D, 0x00, 0x41, 0x20, 0xCD, 0x6B, 0x91, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x63, 0x81,
+    0xE4, 0x00, 0xE1, 0x8D, 0xC3, 0x86, 0x5B, 0x9D, 0x20, 0x64, 0xDA, 0x00, 0x98, 0x2C, 0x83, 0x68,
+    0xC9, 0x77, 0xB6, 0x6E, 0x27, 0x74, 0x8B, 0x75, 0xDD, 0x00, 0x2D, 0x6F, 0x73, 0x97, 0xB1, 0xC7,
+    0xDD, 0x8F, 0xD5, 0x2E, 0x00, 0x69, 0x27, 0x99, 0x20, 0x72, 0xAD, 0x6F, 0x76, 0x81, 0xBD, 0x3A,
+    0x29, 0x5D, 0x2E, 0x00, 0x4F, 0x70, 0x8F, 0x8C, 0xB3, 0xAE, 0x9B, 0xD3, 0x61, 0x00, 0x66, 0xAF,
+    0x75, 0x72, 0xE0, 0x6D, 0xC8, 0x81, 0x93, 0x87, 0x2E, 0x00, 0x54, 0x8D, 0xA4, 0x92, 0xBA, 0x81,
+    0x74, 0x8D, 0x69, 0x94, 0x8E, 0x6D, 0x00, 0x62, 0x75, 0x74, 0xA3, 0x72, 0x75, 0x73, 0xD9, 0x84,
+    0x21, 0x21, 0x21, 0x00, 0xE5, 0x6C, 0x91, 0x6C, 0xA4, 0x6F, 0x70, 0x8F, 0xB2, 0x00, 0xAE, 0x9B,
+    0x86, 0x4D, 0x84, 0x64, 0x20, 0xC9, 0x63, 0x6C, 0x80, 0x64, 0x79, 0x00, 0xC2, 0xB8, 0xC3, 0x20,
+    0x44, 0xE7, 0x4B, 0x8C, 0x00, 0x6C, 0xE6, 0x93, 0xB3, 0xC6, 0xA8, 0x2E, 0x00, 0xD5, 0x86, 0x82,
+    0x8B, 0x61, 0x76, 0x97, 0x95, 0x77, 0x6F, 0x00, 0x6C, 0x64, 0x86, 0xBD, 0x92, 0xBA, 0x81, 0x9E,
+    0x68, 0xAB, 0x00, 0xA9, 0x95, 0x73, 0x6B, 0x79, 0x3A, 0x59, 0x4F, 0x55, 0x20, 0x53, 0x41, 0x56,
+    0x45, 0x44, 0x00, 0xA2, 0x77, 0xA1, 0x6C, 0x64, 0xB5, 0x9D, 0xD1, 0x8F, 0x74, 0x00, 0x62, 0xA6,
+    0x6B, 0x20, 0xAB, 0x8B, 0x70, 0x8F, 0x74, 0xB2, 0x00, 0x6C, 0x69, 0x66, 0x81, 0x9E, 0x68, 0x85,
+    0x6F, 0xB5, 0x40, 0x26, 0x28, 0x24, 0x23, 0x29, 0x00, 0x9D, 0xD0, 0x61, 0x7A, 0x81, 0x93, 0x95,
+    0x73, 0x6B, 0x79, 0x2D, 0x00, 0x68, 0xC1, 0x83, 0x91, 0xBF, 0x77, 0x98, 0xD9, 0x90, 0x74, 0x69,
+    0x00, 0x2D, 0x63, 0x69, 0x70, 0x93, 0x69, 0x89, 0xCF, 0x96, 0xE0, 0x9F, 0x00, 0x98, 0xD2, 0x66,
+    0xCA, 0x97, 0xD1, 0x98, 0xD9, 0x6D, 0x79, 0x73, 0x00, 0x2D, 0x9C, 0x69, 0xD7, 0xAB, 0x20, 0xCD,
+    0xBB, 0x91, 0x6E, 0x2E, 0x00, 0x4F, 0x74, 0x68, 0x85, 0x8B, 0x9F, 0x20, 0x98, 0xD2, 0xCD, 0x62,
+    0x65, 0x61, 0x00, 0x2D, 0x74, 0x61, 0x62, 0xCB, 0xCE, 0x91, 0xE8, 0x2C, 0x87, 0x00, 0x62, 0x65,
+    0x67, 0xB1, 0x64, 0x69, 0x66, 0x66, 0x85, 0x86, 0x54, 0x61, 0x6B, 0x84, 0x00, 0x2D, 0x67, 0xB4,
+    0xC5, 0x73, 0xD4, 0xE4, 0x2E, 0x00, 0xC2, 0xC4, 0xA5, 0x6C, 0xE6, 0xB8, 0xC3, 0x00, 0x93, 0xB3,
+    0xC6, 0xA8, 0x86, 0x9D, 0x27, 0x76, 0x65, 0x00, 0x63, 0x89, 0x71, 0x75, 0x85, 0x97, 0x95, 0x74,
+    0x91, 0x85, 0x2E, 0x00, 0x48, 0x91, 0xE8, 0xA3, 0x77, 0x85, 0x8F, 0x27, 0x74, 0x00, 0xCD, 0x73,
+    0xB7, 0x8D, 0x64, 0x86, 0x44, 0xC0, 0x67, 0x8C, 0x00, 0xE1, 0xC6, 0xA8, 0xD4, 0xDE, 0xA6, 0x68,
+    0x00, 0xA2, 0x97, 0x67, 0x81, 0xAB, 0x20, 0xCC, 0x6F, 0x6B, 0x20, 0x64, 0x6F, 0x00, 0x2D, 0x77,
+    0x6E, 0xE2, 0x98, 0xD9, 0xAE, 0xD7, 0x63, 0xCC, 0x73, 0x65, 0x00, 0xBD, 0x6C, 0xA8, 0xB2, 0x73,
+    0xA7, 0x66, 0xD0, 0x6F, 0x2E, 0x00, 0x48, 0x65, 0x99, 0xA0, 0xBC, 0x77, 0x62, 0x69, 0x65, 0x21,
+    0x00, 0x57, 0xA7, 0x63, 0x96, 0x81, 0xA9, 0x95, 0x77, 0xA1, 0x6C, 0x64, 0x00, 0xB0, 0x20, 0x50,
+    0x55, 0x4C, 0x53, 0x45, 0x42, 0x4F, 0x55, 0x4E, 0x44, 0x21, 0x00, 0x41, 0x20, 0x70, 0x6C, 0xA6,
+    0x81, 0xB0, 0x20, 0x6D, 0x75, 0x73, 0x63, 0xCB, 0x2C, 0x00, 0x62, 0x75, 0x9A, 0x64, 0x89, 0x27,
+    0x9A, 0x77, 0xA1, 0x72, 0x79, 0x21, 0x00, 0x49, 0x27, 0x99, 0x20, 0x8D, 0x6C, 0x70, 0x87, 0x21,
+    0x00, 0x52, 0xAD, 0xAD, 0x62, 0xBF, 0x32, 0x20, 0x72, 0x75, 0x6C, 0x9B, 0x3A, 0x00, 0x31, 0x86,
+    0x46, 0xCB, 0x78, 0x2E, 0x00, 0x32, 0xE2, 0x84, 0x2E, 0x00, 0x47, 0x6F, 0x9A, 0x98, 0x3F, 0x20,
+    0x47, 0x6F, 0x6F, 0x64, 0x6C, 0x75, 0x63, 0x6B, 0x21, 0x00,
+};
+
+const gfx_bpe_t LORE_BPE = { LORE_PAIRS, LORE_LENS };
+
+const gfx_bpe_page_t LORE_TEXT[LORE_PAGES] = {
+    { &LORE_BPE, &LORE_DATA[0], 8 },  // STORY_PROLOGUE
+    { &LORE_BPE, &LORE_DATA[86], 8 },  // STORY_CH1
+    { &LORE_BPE, &LORE_DATA[170], 9 },  // STORY_CH2
+    { &LORE_BPE, &LORE_DATA[269], 9 },  // STORY_CH3
+    { &LORE_BPE, &LORE_DATA[365], 10 },  // STORY_CH4
+    { &LORE_BPE, &LORE_DATA[492], 10 },  // STORY_CH5
+    { &LORE_BPE, &LORE_DATA[604], 10 },  // STORY_CH6
+    { &LORE_BPE, &LORE_DATA[717], 11 },  // STORY_CH7
+    { &LORE_BPE, &LORE_DATA[847], 11 },  // STORY_CH8
+    { &LORE_BPE, &LORE_DATA[962], 11 },  // STORY_CH9
+    { &LORE_BPE, &LORE_DATA[1075], 10 },  // STORY_CH10
+    { &LORE_BPE, &LORE_DATA[1204], 10 },  // STORY_EPILOGUE
+    { &LORE_BPE, &LORE_DATA[1321], 9 },  // TOWER_INTRO
+    { &LORE_BPE, &LORE_DATA[1430], 9 },  // TOWER_END
+    { &LORE_BPE, &LORE_DATA[1526], 10 },  // PLAYGROUND_INTRO
+};
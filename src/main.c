@@ -1,6 +1,6 @@
 /*==============================================================================
  * @file    main.c
- * @brief   Program entry, baseline EMG measurement, and main game loop.
+ * @brief   Program entry and the task set.
  *
  * This file is part of the EMG flex-frequency game project and follows the
  * project coding standard for file-level documentation.
@@ -13,74 +13,111 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/interrupt.h"
 
+#include "project.h"
 #include "timer.h"
-#include "ads131m02.h"
+#include "sched.h"
 #include "game.h"
+#include "gfx.h"
+#include "save.h"
+#include "metrics.h"
+#include "round_acc.h"
+#include "emg_pipe.h"
+#include "pqueue.h"
+
+/* EMG front end: both drivers capture DRDY frames into a ring; the DSP path
+ * takes whichever ADC project.h selects */
+#if ADS_FRONTEND_M04
+#include "ads131m04_driver.h"
+typedef ADS_Frame acq_frame_t;
+#define acq_init()                ADS_Init()
+#define acq_capture_start(fn)     ADS_CaptureStart(fn)
+#define acq_capture_read(d, n)    ADS_CaptureRead(d, n)
+#define acq_capture_dropped()     ADS_CaptureDropped()
+#else
+#include "ads131m02.h"
+typedef ads_frame_t acq_frame_t;
+#define acq_init()                ads_init()
+#define acq_capture_start(fn)     ads_capture_start(fn)
+#define acq_capture_read(d, n)    ads_capture_read(d, n)
+#define acq_capture_dropped()     ads_capture_dropped()
+#endif
+
+#define ACQ_CHUNK        16u       // frames popped per ring read
+
+/* Task periods and deadlines (us). Lower prio runs first. */
+#define ACQ_PERIOD_US    10000u    // captured frames release it too
+#define DSP_DEADLINE_US  10000u
+#define GAME_PERIOD_US   16000u
+#define TELEM_PERIOD_US 500000u
+#define SAVE_PERIOD_US  250000u
+#define SCHED_REPORT_N      10u    // telemetry runs between scheduler reports
+
+enum { PRIO_ACQ, PRIO_DSP, PRIO_GAME, PRIO_RENDER, PRIO_TELEM, PRIO_SAVE };
+
+static int8_t   g_task_acq = -1, g_task_dsp = -1, g_task_render = -1;
+
+/* Drain the capture ring; also the gfx yield hook between render slices */
+static void acq_drain(void){
+  acq_frame_t buf[ACQ_CHUNK];
+  uint32_t n;
+  while ((n = acq_capture_read(buf, ACQ_CHUNK)) != 0){
+    for (uint32_t i = 0; i < n; i++) emg_pipe_push(buf[i].ch);
+  }
 
-#define HZ_MULT  1.0f   // tweak this to scale the displayed Hz
-
-static bool     g_baseline_done = false;
-static uint32_t g_baseline_until_ms = 0;
-static float    g_baseline_acc = 0.0f;
-static uint32_t g_baseline_n = 0;
-static float    g_baseline_hz = 0.0f;
-
-void baseline_begin(uint32_t window_ms){
-  g_baseline_done = false;
-  g_baseline_acc = 0.0f;
-  g_baseline_n = 0;
-  g_baseline_until_ms = millis() + window_ms;
-  g_baseline_hz = 0.0f;
+  if (emg_pipe_due(millis())) sched_signal(g_task_dsp);
 }
 
-static inline bool baseline_update(float hz){
-  if (g_baseline_done) return false;
-
-  if ((int32_t)(millis() - g_baseline_until_ms) < 0){
-    g_baseline_acc += hz;
-    g_baseline_n++;
-    return false;
-  }
-
-  g_baseline_hz = (g_baseline_n ? (g_baseline_acc / (float)g_baseline_n) : 0.0f);
-  g_baseline_done = true;
-  printf("[BASELINE] %.2f Hz (n=%lu)\n", g_baseline_hz, (unsigned long)g_baseline_n);
-  game_set_baseline(g_baseline_hz);
-  return true;
+static void on_sample(void){ sched_signal(g_task_acq); }
+
+/* Close the Hz window, publish it, integrate it into open flex rounds and
+ * move the spare channels' calibration along */
+static void task_dsp(void){
+  metrics_t m;
+  uint32_t now  = millis();
+  uint32_t from = emg_pipe_close(now, &m);
+  if (from == now) return;
+  metrics_publish(&m);
+  round_acc_feed(&m, from);
+  pqueue_service(&m, now);
 }
 
-/* small helpers */
-static inline uint8_t clamp_u8(int v, int lo, int hi){
-  if (v < lo) return (uint8_t)lo;
-  if (v > hi) return (uint8_t)hi;
-  return (uint8_t)v;
+static void task_game(void){
+  game_tick();
+  sched_signal(g_task_render);
 }
 
-/* Rising zero-cross Hz estimate over ~window_ms using ADS samples */
-static float estimate_hz_window_ms(uint32_t window_ms){
-  const int16_t HYST = 8;
-  uint32_t start = millis();
-  int16_t prev = 0, s = 0;
-  bool first_ok = false;
+/* Stream out what the scenes queued, within this frame's budget */
+static void task_render(void){
+  gfx_jobs_run(RENDER_BUDGET_US);
+}
 
-  if (ads_read_sample_ch1_timeout(2, &s) == 0){
-    prev = s; first_ok = true;
+/* Print debug to UART/ITM; scheduler counters every few lines */
+static void task_telem(void){
+  static uint32_t n = 0;
+  metrics_t m;
+  (void)metrics_read(&m);
+  for (uint8_t c = 0; c < METRICS_CH; c++){
+    printf("%sCH%u HZ=%.1f BASE=%.1f ENV=%.0f", c ? " | " : "", (unsigned)c,
+           m.hz[c], m.base_hz[c], m.env[c]);
   }
-
-  uint32_t rises = 0;
-  while ((millis() - start) < window_ms){
-    if (ads_read_sample_ch1_timeout(2, &s) != 0) continue;
-    if (first_ok){
-      int16_t pz = (prev >  HYST) ? +1 : (prev < -HYST ? -1 : 0);
-      int16_t cz = (s    >  HYST) ? +1 : (s    < -HYST ? -1 : 0);
-      if (pz < 0 && cz >= 0) rises++;
-    } else {
-      first_ok = true;
-    }
-    prev = s;
+  printf(" | CPU free=%u%%\n", (unsigned)sched_headroom_pct());
+
+  if (++n < SCHED_REPORT_N) return;
+  n = 0;
+  sched_stats_t st;
+  const char *name;
+  for (int8_t id = 0; (name = sched_stats(id, &st)) != NULL; id++){
+    printf("[SCHED] %-6s runs=%lu miss=%lu late=%luus run=%luus\n", name,
+           (unsigned long)st.runs, (unsigned long)st.misses,
+           (unsigned long)st.worst_late_us, (unsigned long)st.worst_run_us);
   }
-  float secs = (float)window_ms / 1000.0f;
-  return (secs > 0.0f) ? (rises / secs) : 0.0f;
+  printf("[SCHED] idle=%luus adc_drop=%lu\n", (unsigned long)sched_idle_us(),
+         (unsigned long)acq_capture_dropped());
+  sched_stats_reset();
+}
+
+static void task_save(void){
+  (void)save_flush();
 }
 
 int main(void){
@@ -90,7 +127,7 @@ int main(void){
   timer_init();
 
   // ADS bringup
-  ads_init();
+  acq_init();
 
   // Enable global interrupts after peripherals are initialized
   IntMasterEnable();
@@ -98,40 +135,19 @@ int main(void){
   // Start OLED/game (non-blocking)
   game_init();
 
+  sched_init();
+  g_task_acq    = sched_add("acq",    acq_drain,   ACQ_PERIOD_US,   0u,              PRIO_ACQ);
+  g_task_dsp    = sched_add("dsp",    task_dsp,    0u,              DSP_DEADLINE_US, PRIO_DSP);
+  g_task_render = sched_add("render", task_render, 0u,              GAME_PERIOD_US,  PRIO_RENDER);
+  (void)sched_add("game",  task_game,  GAME_PERIOD_US,  0u, PRIO_GAME);
+  (void)sched_add("telem", task_telem, TELEM_PERIOD_US, 0u, PRIO_TELEM);
+  (void)sched_add("save",  task_save,  SAVE_PERIOD_US,  0u, PRIO_SAVE);
+  acq_capture_start(on_sample);
+  gfx_jobs_set_yield(acq_drain);   // keep sampling while long scenes stream out
+
+  emg_pipe_init(millis());
   baseline_begin(3000u);   // 3 s baseline window aligned with countdown
+  pqueue_init(millis());
 
-  uint32_t next_print = millis();
-  uint32_t next_tick  = millis();
-
-  while(1){
-    // Update metrics about every ~100 ms for snappy UI
-    float hz_raw = estimate_hz_window_ms(100);
-
-    // accumulate baseline during the first 3 s after game_init()
-    (void)baseline_update(hz_raw);
-
-    // subtract baseline (floor at 0) before feeding UI
-    extern float g_baseline_hz; // if not in header otherwise remove this line
-    float hz_adj = hz_raw - g_baseline_hz;
-    if (hz_adj < 0.0f) hz_adj = 0.0f;
-
-    // apply multiplier for displayed / gameplay intensity
-    float hz_scaled = hz_adj * HZ_MULT;
-
-    uint32_t now = millis();
-
-    // Print debug to UART/ITM periodically
-    if ((int32_t)(now - next_print) >= 0){
-      next_print = now + 500u;
-      printf("RAW=%.1f BASE=%.1f ADJ=%.1f SCALED=%.1f\n",
-             hz_raw, g_baseline_hz, hz_adj, hz_scaled);
-    }
-
-    // Call game tick at ~60 Hz or similar
-    if ((int32_t)(now - next_tick) >= 0){
-      next_tick = now + 16u;
-      game_tick();
-    }
-  }
+  sched_run();
 }
-
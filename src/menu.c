@@ -9,23 +9,27 @@
 #include <stdbool.h>
 #include "menu.h"
 #include "gfx.h"
+#include "hud.h"
 #include "project.h"
 #include "timer.h"
 #include "game.h"                 // game_get_metrics(), game_mode_t
 #include "choice_input.h"         // choice_from_hz(), choice_draw_hint()
 #include "game_opening_screen_logo.h" // GAME_OPENING_SCREEN_LOGO_* & bitmap
+#include "scene.h"
 
 #define TITLE_LOAD_MS 2000u   // total time for 0–100% bar (2s)
+#define SELECT_HZ     25.0f   // hold above this to enter the highlighted mode
 
 // Added MS_LOGO as first state
-typedef enum { MS_LOGO = 0, MS_TITLE, MS_SELECT, MS_ATTRACT } mstate_t;
+typedef enum { MS_LOGO = 0, MS_TITLE, MS_SELECT, MS_ATTRACT, MS_SCENES } mstate_t;
 
-static mstate_t  g_ms;
-static uint32_t  g_t0;
-static uint8_t   g_cursor;          // 0..4
+static scene_run_t g_run;
+static float     g_hz;              // P1's Hz this tick
+static uint8_t   g_cursor;          // 0..4 (0..5 with the 4P bracket)
 // Used as last scroll time while in MS_SELECT
 static uint32_t  g_last_input_ms;
-static bool      g_dirty;           // true = need to (re)draw current state
+static uint8_t   g_drawn_cursor;    // cursor the item list was last drawn with
+static hud_bar_t g_select_bar;      // live Hz bar, red marker at SELECT_HZ
 
 static const char* mode_name(uint8_t m)
 {
@@ -35,171 +39,170 @@ static const char* mode_name(uint8_t m)
     case MODE_STORY:      return "Story";
     case MODE_TOWER:      return "Tower";
     case MODE_CREDITS:    return "Credits + Trophy";
+    case MODE_QUAD:       return "4P Bracket";
     default:              return "Unknown";
     }
 }
 
-/* change menu state and mark screen dirty */
-static void menu_goto(mstate_t ns)
+/*------------------------------- scenes ------------------------------------*/
+
+/*  show game_opening_screen_logo for 3 seconds */
+static void logo_enter(const scene_ctx_t *c)
 {
-    g_ms    = ns;
-    g_t0    = millis();
-    g_dirty = true;
+    (void)c;
+    gfx_clear(COL_BLACK);
+
+    uint8_t x = (uint8_t)((128 - GAME_OPENING_SCREEN_LOGO_W) / 2);
+    uint8_t y = (uint8_t)((128 - GAME_OPENING_SCREEN_LOGO_H) / 2);
+
+    gfx_blit_image(x, y, &GAME_OPENING_SCREEN_LOGO_IMG);
 }
 
-void menu_start(void)
+static void title_enter(const scene_ctx_t *c)
 {
-    g_cursor        = 0;
-    g_last_input_ms = millis();   // also seed scroll timer
-    // Start with the logo state instead of MS_TITLE
-    menu_goto(MS_LOGO);
+    (void)c;
+    gfx_clear(COL_BLACK);
+    gfx_header("BOOTING", COL_RED);
+    gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+    gfx_text2(0, 30, "downloading:", COL_WHITE, 1);
+    gfx_text2(50, 40, "packages...", COL_WHITE, 1);
+    gfx_text2(50, 50, "patching...", COL_WHITE, 1);
+    gfx_text2(50, 60, "finalizing...", COL_WHITE, 1);
 }
 
-bool menu_tick(uint8_t *out_mode)
+static void title_tick(const scene_ctx_t *c)
 {
-    float   hz   = 0.0f;
-    float   base = 0.0f;
-    uint8_t pct  = 0;
-    game_get_metrics(&hz, &pct, &base);
-
-    uint32_t now = millis();
-
-    switch (g_ms) {
-
-    /*  show game_opening_screen_logo for 3 seconds */
-    case MS_LOGO: {
-        if (g_dirty) {
-            g_dirty = false;
-
-            gfx_clear(COL_BLACK);
-
-            uint8_t x = (uint8_t)((128 - GAME_OPENING_SCREEN_LOGO_W) / 2);
-            uint8_t y = (uint8_t)((128 - GAME_OPENING_SCREEN_LOGO_H) / 2);
-
-            gfx_blit_pal4(x, y,
-                        GAME_OPENING_SCREEN_LOGO_W, GAME_OPENING_SCREEN_LOGO_H,
-                        GAME_OPENING_SCREEN_LOGO_IDX,
-                        GAME_OPENING_SCREEN_LOGO_PAL);
-        }
-
-        // Stay on this screen for 3 seconds, then move on
-        if ((now - g_t0) >= 3000u) {
-            menu_goto(MS_TITLE);
-        }
-    } break;
-
-    case MS_TITLE: {
-        uint32_t dt = now - g_t0;
-
-        if (g_dirty) {
-            g_dirty = false;
-            gfx_clear(COL_BLACK);
-            gfx_header("BOOTING", COL_RED);
-            gfx_bar(0, 18, 128, 1, COL_DKGRAY);
-            gfx_text2(0, 30, "downloading:", COL_WHITE, 1);
-            gfx_text2(50, 40, "packages...", COL_WHITE, 1);
-            gfx_text2(50, 50, "patching...", COL_WHITE, 1);
-            gfx_text2(50, 60, "finalizing...", COL_WHITE, 1);
-        }
-
-        // Progress computation (0–100%)
-        uint8_t load_pct;
-        if (dt >= TITLE_LOAD_MS) {
-            load_pct = 100u;
-        } else {
-            // 100 steps over TITLE_LOAD_MS
-            load_pct = (uint8_t)((dt * 100u) / TITLE_LOAD_MS);
-        }
+    // Progress computation (0–100%) over the scene's length
+    uint8_t load_pct;
+    if (c->done) {
+        load_pct = 100u;
+    } else {
+        // 100 steps over TITLE_LOAD_MS
+        load_pct = (uint8_t)((c->dt * 100u) / c->ms);
+    }
 
-        // Draw progress bar + % text
+    // Draw progress bar + % text
 
-        const uint8_t bar_x = 10;
-        const uint8_t bar_y = 92;    // just under the text
-        const uint8_t bar_w = 108;
-        const uint8_t bar_h = 8;
+    const uint8_t bar_x = 10;
+    const uint8_t bar_y = 92;    // just under the text
+    const uint8_t bar_w = 108;
+    const uint8_t bar_h = 8;
 
-        // Gray baseline bar
-        gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
+    // Gray baseline bar
+    gfx_bar(bar_x, bar_y, bar_w, bar_h, COL_DKGRAY);
 
-        // Green fill according to % complete
-        uint8_t fill_w = (uint8_t)((load_pct * bar_w) / 100u);
-        if (fill_w > 0u) {
-            gfx_bar(bar_x, bar_y, fill_w, bar_h, COL_RED);
-        }
+    // Green fill according to % complete
+    uint8_t fill_w = (uint8_t)((load_pct * bar_w) / 100u);
+    if (fill_w > 0u) {
+        gfx_bar(bar_x, bar_y, fill_w, bar_h, COL_RED);
+    }
 
-        // Percentage text on top of the bar
-        char buf[8];
-        snprintf(buf, sizeof(buf), "%3u%%", load_pct);
+    // Percentage text on top of the bar
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%3u%%", load_pct);
 
-        // Rough center horizontally over the bar
-        uint8_t text_x = (uint8_t)(bar_x + (bar_w / 2) - 12);
-        uint8_t text_y = (uint8_t)(bar_y - 14);
-        gfx_text2(text_x, text_y, buf, COL_WHITE, 1);
+    // Rough center horizontally over the bar
+    uint8_t text_x = (uint8_t)(bar_x + (bar_w / 2) - 12);
+    uint8_t text_y = (uint8_t)(bar_y - 14);
+    gfx_text2(text_x, text_y, buf, COL_WHITE, 1);
+}
 
-        // When loading hits 100%, go to select
-        if (load_pct >= 100u) {
-            menu_goto(MS_SELECT);
-        }
-    } break;
-
-    case MS_SELECT: {
-        if (g_dirty) {
-            g_dirty = false;
-            gfx_clear(COL_BLACK);
-            gfx_header("PULSEBOUND", COL_WHITE);
-            gfx_bar(0, 18, 128, 1, COL_DKGRAY);
-        }
+static void select_enter(const scene_ctx_t *c)
+{
+    (void)c;
+    gfx_clear(COL_BLACK);
+    gfx_header("PULSEBOUND", COL_WHITE);
+    gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+
+    // Hints and bar
+    choice_draw_hint(90);
+    hud_bar_init(&g_select_bar, 8, 100, 112, 8, 2.0f * SELECT_HZ, COL_GREEN, COL_DKGRAY);
+    hud_bar_mark(&g_select_bar, SELECT_HZ, COL_RED);
+    g_drawn_cursor = 0xFFu;
+}
 
-        // Simple text menu
-        const char* items[] = {
-            "Playground",
-            "PVP",
-            "Story",
-            "Tower",
-            "Credits + Trophy"
-        };
-        const uint8_t n_items = (uint8_t)(sizeof(items)/sizeof(items[0]));
-
-        // Up/Down selection from Hz input
-        int choice = choice_from_hz(hz, 5);
-        if (choice >= 0) {
-            g_cursor = (uint8_t)choice;
-            g_last_input_ms = now;
-        }
+static void select_tick(const scene_ctx_t *c)
+{
+    // Simple text menu
+    const char* items[] = {
+        "Playground",
+        "PVP",
+        "Story",
+        "Tower",
+        "Credits + Trophy",
+#if ADS_FRONTEND_M04
+        "4P Bracket",
+#endif
+    };
+    const uint8_t n_items = (uint8_t)(sizeof(items)/sizeof(items[0]));
+
+    // Up/Down selection from Hz input
+    int choice = choice_from_hz(g_hz, 5);
+    if (choice >= 0) {
+        g_cursor = (uint8_t)choice;
+        g_last_input_ms = c->now;
+    }
 
-        // Draw items
+    // Draw items (only when the highlight moved)
+    if (g_cursor != g_drawn_cursor) {
         uint8_t y = 28;
         for (uint8_t i = 0; i < n_items; ++i) {
             uint16_t col = (i == g_cursor) ? COL_CYAN : COL_WHITE;
             gfx_text2(8, y, items[i], col, 1);
             y = (uint8_t)(y + 10);
         }
+        g_drawn_cursor = g_cursor;
+    }
 
-        // Hints and bar
-        choice_draw_hint(8, 90);
-        choice_draw_bar(8, 100, 112, 8, hz);
-
-        // A “select” threshold: if you maintain a high Hz for some time,
-        // confirm the current cursor as the mode to enter.
-        if ((now - g_last_input_ms) > 1500u && hz > 25.0f) {
-            if (out_mode) {
-                *out_mode = g_cursor;
-            }
-            return true;
-        }
-    } break;
-
-    case MS_ATTRACT: {
-        // Not used in this build; placeholder for idle animation.
-        // Could run an attract mode / demo loop here.
-        if (g_dirty) {
-            g_dirty = false;
-            gfx_clear(COL_BLACK);
-            gfx_header("ATTRACT", COL_WHITE);
-        }
-    } break;
+    hud_bar_set(&g_select_bar, g_hz);
+}
+
+// A “select” threshold: if you maintain a high Hz for some time,
+// confirm the current cursor as the mode to enter.
+static uint8_t select_exit(const scene_ctx_t *c)
+{
+    if ((c->now - g_last_input_ms) > 1500u && g_hz > SELECT_HZ) {
+        return SCENE_END;
     }
+    return SCENE_STAY;
+}
+
+// Not used in this build; placeholder for idle animation.
+// Could run an attract mode / demo loop here.
+static void attract_enter(const scene_ctx_t *c)
+{
+    (void)c;
+    gfx_clear(COL_BLACK);
+    gfx_header("ATTRACT", COL_WHITE);
+}
+
+/* every menu screen is a full scene, so the old one fades out first and
+ * its time starts when it is dark */
+static const scene_t k_scenes[MS_SCENES] = {
+    //               ms             next       flags       enter          tick         exit
+    [MS_LOGO]    = { 3000u,         MS_TITLE,  SCENE_FADE, logo_enter,    NULL,        NULL        },
+    [MS_TITLE]   = { TITLE_LOAD_MS, MS_SELECT, SCENE_FADE, title_enter,   title_tick,  NULL        },
+    [MS_SELECT]  = { 0u,            SCENE_END, SCENE_FADE, select_enter,  select_tick, select_exit },
+    [MS_ATTRACT] = { 0u,            SCENE_END, SCENE_FADE, attract_enter, NULL,        NULL        },
+};
 
-    return false;
+void menu_start(void)
+{
+    g_cursor        = 0;
+    g_last_input_ms = millis();   // also seed scroll timer
+    // Start with the logo state instead of MS_TITLE
+    scene_start(&g_run, k_scenes, MS_SCENES, MS_LOGO, millis());
 }
 
+bool menu_tick(uint8_t *out_mode)
+{
+    game_get_metrics(&g_hz, NULL, NULL);
+
+    if (!scene_tick(&g_run, millis())) {
+        return false;
+    }
+    if (out_mode) {
+        *out_mode = g_cursor;
+    }
+    return true;
+}
@@ -0,0 +1,47 @@
+/*==============================================================================
+ * @file    metrics.c
+ * @brief   Double-buffered, sequence-checked EMG metrics snapshot.
+ *
+ * Publish n goes to slot n & 1. s_begin is bumped before the slot is
+ * written and s_end after, so a reader that copied slot n & 1 knows the
+ * copy is whole as long as publish n + 2 (the next write to that slot) has
+ * not begun: s_begin - n < 2.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "metrics.h"
+
+#if defined(HOST_SIM)
+#define METRICS_FENCE()  __sync_synchronize()
+#elif defined(__GNUC__)
+#define METRICS_FENCE()  __asm__ volatile (" dmb" ::: "memory")
+#else
+#define METRICS_FENCE()  __asm(" dmb")
+#endif
+
+static metrics_t         s_slot[2];
+static volatile uint32_t s_begin = 0;   // publishes started
+static volatile uint32_t s_end   = 0;   // publishes finished
+
+void metrics_publish(const metrics_t *m){
+  uint32_t n = s_end + 1u;
+  s_begin = n;
+  METRICS_FENCE();
+  s_slot[n & 1u]     = *m;
+  s_slot[n & 1u].seq = n;
+  METRICS_FENCE();
+  s_end = n;
+}
+
+bool metrics_read(metrics_t *out){
+  uint32_t n;
+  do {
+    n = s_end;
+    METRICS_FENCE();
+    *out = s_slot[n & 1u];
+    METRICS_FENCE();
+  } while ((uint32_t)(s_begin - n) >= 2u);
+  return n != 0u;
+}
+
+uint32_t metrics_seq(void){ return s_end; }
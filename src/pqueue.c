@@ -0,0 +1,171 @@
+/*==============================================================================
+ * @file    pqueue.c
+ * @brief   Player queue: seat/channel mapping and spare-channel calibration.
+ *
+ * This file is part of the EMG flex-frequency game project and follows the
+ * project coding standard for file-level documentation.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "timer.h"
+#include "emg_pipe.h"
+#include "pqueue.h"
+
+typedef enum {
+  PQ_SEATED = 0,   // playing
+  PQ_WARMUP,       // freed, waiting for the armband to settle
+  PQ_CAL,          // baseline window running
+  PQ_IDLE,         // calibrated, nobody checked in yet
+  PQ_JOINED,       // check-in flex seen, waiting for the arm to rest
+  PQ_RECAL,        // baseline of the resting player
+  PQ_READY         // queued for a seat
+} pq_state_t;
+
+typedef struct {
+  pq_state_t state;
+  uint32_t   t_ms;        // entered the state / last refresh / last flex
+  uint32_t   joined_ms;   // check-in time (queue order)
+} pq_chan_t;
+
+static pq_chan_t s_ch[EMG_PIPE_CH];
+static uint8_t   s_seat[EMG_PIPE_CH];   // seat -> channel
+static uint8_t   s_seats = 0;
+
+static void enter(uint8_t c, pq_state_t st, uint32_t now_ms){
+  s_ch[c].state = st;
+  s_ch[c].t_ms  = now_ms;
+}
+
+void pqueue_init(uint32_t now_ms){
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    s_seat[c] = c;
+    enter(c, PQ_WARMUP, now_ms);
+  }
+  s_ch[0].state = PQ_SEATED;
+  s_seats = 1u;
+}
+
+// Spare channels, queued players first in check-in order, then the rest
+static uint8_t spares_by_queue(uint8_t *out){
+  uint8_t n = 0;
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    if (s_ch[c].state != PQ_READY) continue;
+    uint8_t i = n++;
+    while (i > 0 && (int32_t)(s_ch[out[i - 1]].joined_ms - s_ch[c].joined_ms) > 0){
+      out[i] = out[i - 1];
+      i--;
+    }
+    out[i] = c;
+  }
+  uint8_t ready = n;
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    pq_state_t st = s_ch[c].state;
+    if (st != PQ_SEATED && st != PQ_READY) out[n++] = c;
+  }
+  return ready;
+}
+
+bool pqueue_round_begin(uint8_t seats, uint32_t window_ms){
+  uint32_t now = millis();
+  uint8_t  q[EMG_PIPE_CH];
+  uint8_t  ready = spares_by_queue(q);
+  if (seats == 0u) seats = 1u;
+  if (seats > EMG_PIPE_CH) seats = EMG_PIPE_CH;
+
+  // Hand-off: queued players take the seats, the old ones leave
+  if (ready >= seats){
+    for (uint8_t s = 0; s < s_seats; s++) enter(s_seat[s], PQ_WARMUP, now);
+    for (uint8_t s = 0; s < seats; s++){
+      s_seat[s] = q[s];
+      s_ch[q[s]].state = PQ_SEATED;
+    }
+    s_seats = seats;
+    printf("[QUEUE] hand-off: P1 on ch%u, %u seat(s)\n",
+           (unsigned)s_seat[0], (unsigned)seats);
+    return true;
+  }
+
+  // Keep who is seated, top up from the queue, free any extra seats
+  for (uint8_t s = seats; s < s_seats; s++) enter(s_seat[s], PQ_WARMUP, now);
+  for (uint8_t s = s_seats, i = 0; s < seats; s++, i++){
+    s_seat[s] = q[i];
+    s_ch[q[i]].state = PQ_SEATED;
+  }
+  s_seats = seats;
+
+  uint8_t mask = 0;
+  for (uint8_t s = 0; s < seats; s++) mask |= (uint8_t)(1u << s_seat[s]);
+  emg_pipe_baseline_begin(mask, window_ms);
+  return false;
+}
+
+uint8_t pqueue_seat(uint8_t seat){
+  return (seat < s_seats) ? s_seat[seat] : 0u;
+}
+
+uint8_t pqueue_ready(void){
+  uint8_t n = 0;
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    if (s_ch[c].state == PQ_READY) n++;
+  }
+  return n;
+}
+
+void pqueue_service(const metrics_t *m, uint32_t now_ms){
+  for (uint8_t c = 0; c < EMG_PIPE_CH; c++){
+    pq_chan_t *ch   = &s_ch[c];
+    uint32_t   dt   = now_ms - ch->t_ms;
+    uint8_t    mask = (uint8_t)(1u << c);
+    bool       flex = m->hz[c] >= PQUEUE_JOIN_HZ;
+
+    switch (ch->state){
+      case PQ_WARMUP:
+        if (dt >= PQUEUE_WARMUP_MS){
+          emg_pipe_baseline_begin(mask, PQUEUE_CAL_MS);
+          enter(c, PQ_CAL, now_ms);
+        }
+        break;
+
+      case PQ_CAL:
+        if (emg_pipe_baseline_ready(c)) enter(c, PQ_IDLE, now_ms);
+        break;
+
+      case PQ_IDLE:
+        if (flex){
+          // A refresh would average the flex in; PQ_RECAL measures anew
+          if (!emg_pipe_baseline_ready(c)) emg_pipe_baseline_cancel(mask);
+          ch->joined_ms = now_ms;
+          enter(c, PQ_JOINED, now_ms);
+          printf("[QUEUE] ch%u checked in\n", (unsigned)c);
+        } else if (dt >= PQUEUE_REFRESH_MS){
+          // Keep the reference current for whoever straps on next
+          emg_pipe_baseline_refresh(mask, PQUEUE_CAL_MS);
+          ch->t_ms = now_ms;
+        }
+        break;
+
+      case PQ_JOINED:
+        if (flex){
+          ch->t_ms = now_ms;                     // still flexing
+        } else if (dt >= PQUEUE_WARMUP_MS){
+          emg_pipe_baseline_refresh(mask, PQUEUE_CAL_MS);
+          enter(c, PQ_RECAL, now_ms);
+        }
+        break;
+
+      case PQ_RECAL:
+        if (emg_pipe_baseline_ready(c)){
+          enter(c, PQ_READY, now_ms);
+          printf("[QUEUE] ch%u calibrated, %u waiting\n", (unsigned)c,
+                 (unsigned)pqueue_ready());
+        }
+        break;
+
+      case PQ_SEATED:
+      case PQ_READY:
+      default:
+        break;
+    }
+  }
+}
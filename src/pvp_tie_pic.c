@@ -6,224 +6,86 @@ const uint16_t PVP_TIE_PIC_PAL[PVP_TIE_PIC_PAL_SIZE] = {
     0xA8E3, 0x8A86, 0xA59B, 0x549B, 0xD535, 0x6A67, 0x09D2, 0x116C, 
 };
 
-const uint8_t PVP_TIE_PIC_IDX[(PVP_TIE_PIC_W * PVP_TIE_PIC_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x70, 
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x18, 0x22, 0x22, 0x22, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x73, 
-    0x33, 0x33, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x82, 0x22, 0x22, 0x22, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC8, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x07, 0x73, 0x33, 0x33, 0x33, 0x33, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x07, 0x73, 0x33, 0x33, 0x33, 0x33, 0x37, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0C, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x77, 0x77, 0x33, 0x33, 0x33, 0x33, 0x33, 0xB0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x73, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x88, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x73, 0x33, 0x33, 0x33, 0x33, 
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0x88, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x8C, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x77, 0x77, 0x77, 0x33, 0x33, 
-    0x33, 0x33, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xBB, 0xBB, 0xA0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 
-    0x88, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x77, 0x77, 0x77, 
-    0x73, 0x33, 0x33, 0x37, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xB7, 0x73, 0x33, 0x33, 0x7B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xC8, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xEE, 
-    0x77, 0x77, 0x77, 0x77, 0x37, 0x77, 0x00, 0x00, 0x0A, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 
-    0x00, 0xC0, 0x00, 0x88, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x28, 0x07, 0x7B, 0x00, 0x00, 0x00, 
-    0x07, 0xEE, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x37, 0xB0, 0x0B, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x37, 0x37, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xCC, 0xCC, 0x00, 
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xC0, 0x00, 0x00, 
-    0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, 0x00, 0x00, 0x0B, 0x73, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x77, 0x7E, 0xF7, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 
-    0x00, 0x03, 0x37, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xB3, 0x33, 0x33, 0x33, 
-    0x33, 0x77, 0x77, 0xFF, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x33, 
-    0x33, 0x37, 0x77, 0x7F, 0xF0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 
-    0xB3, 0x33, 0x33, 0x37, 0x77, 0xF0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x5A, 0xA0, 
-    0x00, 0x00, 0x0B, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xB3, 0x3B, 
-    0x00, 0x00, 0x03, 0x33, 0x33, 0x77, 0x70, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x88, 0x82, 0x28, 0x88, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x33, 0x33, 
-    0x33, 0x3B, 0x00, 0x00, 0x03, 0x33, 0x33, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 
-    0x22, 0x22, 0x22, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x28, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 
-    0x33, 0x33, 0x33, 0x3B, 0x00, 0x00, 0x03, 0x33, 0x37, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x11, 0x55, 0x16, 0x18, 
-    0x08, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xA0, 0x00, 0x03, 0x33, 0x3B, 0x00, 0x00, 0x03, 0x33, 0x77, 0xA0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x18, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x82, 0x22, 0xC0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xA0, 0x10, 0x07, 0x33, 0x3B, 0x00, 0x00, 0x03, 0x33, 0x70, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x03, 0x3B, 0x00, 0x00, 0x03, 0x37, 0xB0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 
-    0x22, 0xC0, 0x00, 0x0E, 0x08, 0x00, 0x00, 0xAE, 0x1C, 0x00, 0x03, 0x3B, 0x00, 0x00, 0x03, 0x37, 
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 
-    0x00, 0x22, 0x28, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 
-    0x03, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x82, 0x22, 0x22, 0x22, 0x20, 
-    0x00, 0x0A, 0x00, 0x22, 0x28, 0x00, 0x00, 0x0B, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3B, 
-    0x00, 0x00, 0xB3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x22, 0x22, 
-    0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x81, 0x00, 0x00, 0x0B, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x3B, 0x00, 0x00, 0xB3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x82, 
-    0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x01, 0x22, 0x8C, 0x00, 0x00, 0x0B, 0xAA, 0x00, 0x00, 0x00, 
-    0x00, 0x0B, 0x33, 0x3B, 0x00, 0x00, 0x03, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC8, 0x82, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x01, 0x22, 0x8C, 0x00, 0x00, 0x00, 0xAA, 0x00, 
-    0x00, 0x00, 0x0B, 0x33, 0x33, 0x3B, 0x00, 0x00, 0xB3, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x5C, 0x12, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x01, 0x22, 0x2C, 0x00, 0x00, 0x00, 
-    0xAA, 0x00, 0x00, 0x0B, 0x33, 0x33, 0x33, 0x3B, 0x00, 0x00, 0xB3, 0x3B, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x88, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x01, 0x02, 0x2C, 0x00, 
-    0x00, 0x00, 0xB5, 0x00, 0x00, 0xA3, 0x33, 0x33, 0x33, 0x3B, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x88, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x01, 0x22, 
-    0x21, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0xA3, 0x33, 0x33, 0x33, 0x3B, 0x00, 0x00, 0x03, 0x3B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x82, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 
-    0x01, 0x22, 0x22, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0xA3, 0x33, 0x33, 0x33, 0x3B, 0x00, 0x00, 
-    0x03, 0x30, 0x55, 0x55, 0x55, 0x55, 0x5C, 0xC5, 0x55, 0x55, 0xC5, 0x55, 0x55, 0x55, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x55, 0x61, 0x82, 0x22, 0x22, 0x22, 0x22, 0x20, 
-    0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 0x00, 0x03, 0xB7, 0x00, 0x00, 0xA3, 0x33, 0x33, 0x33, 0x3B, 
-    0x00, 0x00, 0xB3, 0x37, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x16, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 0x00, 0x03, 0x0E, 0x00, 0x00, 0xA3, 0x33, 0x33, 
-    0x33, 0x30, 0x00, 0x00, 0x33, 0x37, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 0x00, 0x03, 0x7E, 0x00, 0x00, 0xA3, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 0x00, 0x03, 0x7E, 0x00, 
-    0x00, 0xA3, 0x33, 0x33, 0x33, 0x33, 0xB0, 0x00, 0x33, 0x33, 0x75, 0x56, 0x66, 0x66, 0x66, 0x55, 
-    0x55, 0x56, 0x55, 0x56, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 0x00, 0x03, 
-    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 0xB3, 0x33, 0x30, 0x56, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x11, 0x16, 
-    0x66, 0x66, 0x61, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 0x22, 0xC0, 
-    0x00, 0x03, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 0x03, 0x33, 0x37, 0x56, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x66, 0x66, 0x69, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x0A, 0x00, 0x22, 
-    0x22, 0xC0, 0x00, 0x03, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 0x03, 0x33, 
-    0x33, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x22, 0x22, 0xC0, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3B, 0x00, 0x00, 
-    0xB3, 0x33, 0x33, 0x75, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 
-    0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x03, 0x33, 0x3B, 0x00, 0x00, 0x00, 0x33, 0x33, 0x77, 
-    0x0B, 0x0B, 0x33, 0x33, 0x33, 0x30, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x28, 0x88, 0x80, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x0E, 0x37, 0x77, 0x77, 0xEE, 0xEE, 0x77, 
-    0xEE, 0xEF, 0xFE, 0x33, 0x33, 0x33, 0x33, 0x37, 0x56, 0x66, 0x61, 0x11, 0x61, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x28, 0x88, 0x11, 0x98, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x00, 0xE7, 0x77, 0x77, 0xFF, 
-    0x46, 0x65, 0x00, 0x44, 0xFF, 0x77, 0x33, 0x33, 0x33, 0x37, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x88, 0x11, 0x16, 0x11, 0x98, 0x88, 0x22, 0x22, 0x22, 0x22, 0x20, 0xE7, 0x77, 
-    0x7F, 0xF4, 0x61, 0x11, 0x66, 0x66, 0x1F, 0xF7, 0x73, 0x33, 0x33, 0x33, 0x06, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x82, 
-    0x22, 0x22, 0x22, 0x22, 0x28, 0x81, 0x11, 0x11, 0x11, 0x11, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 
-    0x0E, 0xEF, 0xF4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x61, 0xFF, 0x77, 0x33, 0x33, 0x33, 0x71, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x88, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x88, 0x22, 0x22, 
-    0x22, 0x22, 0x0E, 0xFF, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F, 0xF7, 0x77, 0x33, 0x33, 
-    0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x82, 0x22, 0x22, 0x22, 0x22, 0x28, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88, 
-    0x82, 0x22, 0x22, 0x22, 0x20, 0xF4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0xFE, 0x77, 
-    0x73, 0x33, 0x74, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x41, 0x82, 0x22, 0x22, 0x22, 0x22, 0x88, 0x14, 0x11, 0x11, 0x11, 0x14, 0x44, 
-    0x44, 0x18, 0x82, 0x22, 0x22, 0x22, 0x20, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 
-    0xFE, 0x77, 0x73, 0x33, 0x70, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x22, 0x22, 0x22, 0x22, 0x22, 0x89, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x40, 0x82, 0x22, 0x22, 0x22, 0x22, 0x14, 0x11, 0x14, 0x44, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x0E, 0x77, 0x77, 0x33, 0x37, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x18, 0x22, 0x22, 0x22, 0x22, 0x28, 0x84, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x08, 0x22, 0x22, 0x22, 0x22, 0x14, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x41, 0x11, 0x11, 0x0E, 0x77, 0x77, 0x33, 0x37, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x98, 0x22, 0x22, 0x22, 0x22, 0x88, 0x14, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xD4, 0x0F, 0x08, 0x22, 0x22, 0x22, 0x22, 0x84, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0x0E, 0x77, 0x77, 0x33, 0x37, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x88, 0x22, 0x22, 0x22, 0x22, 
-    0x89, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4D, 0xDD, 0xDD, 0x4F, 0xF0, 0x82, 0x22, 0x22, 0x22, 0x8D, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x07, 0x77, 0x77, 0x33, 0x37, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x88, 0x22, 0x22, 
-    0x22, 0x28, 0x84, 0x44, 0x44, 0x44, 0x44, 0xDD, 0xDD, 0xDD, 0x4D, 0x4F, 0xFF, 0x88, 0x22, 0x22, 
-    0x22, 0x8D, 0x4D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x77, 0x73, 0x37, 0x33, 0x37, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x98, 
-    0x22, 0x22, 0x22, 0x28, 0x94, 0x44, 0x4D, 0x44, 0x44, 0x4D, 0xDD, 0xDD, 0xDD, 0x40, 0x0F, 0x08, 
-    0x82, 0x22, 0x22, 0x81, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xD4, 0x77, 0x33, 0x33, 0x33, 
-    0x70, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x14, 0x44, 
-    0x44, 0xD8, 0x82, 0x22, 0x22, 0x88, 0xDD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4D, 0xD0, 
-    0x00, 0x00, 0x88, 0x22, 0x22, 0x81, 0x41, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 0x77, 0x33, 
-    0x33, 0x33, 0x74, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x14, 
-    0x44, 0x44, 0xDD, 0xD8, 0x82, 0x22, 0x22, 0x89, 0xD4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x44, 0xD0, 0x00, 0x00, 0x08, 0x88, 0x88, 0x94, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 
-    0xF7, 0x73, 0x33, 0x37, 0x74, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0x4D, 0xD0, 0x88, 0x88, 0x88, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x1D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x14, 0x00, 0xF7, 0x77, 0x7F, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xDD, 0x00, 0x00, 0x00, 0x91, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9D, 0xDD, 0xD0, 0x00, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x44, 0x00, 0xF0, 0xD4, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xDD, 0x09, 0x99, 0x99, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x41, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x44, 0x44, 0x44, 0x44, 0x41, 0x44, 
+const uint8_t PVP_TIE_PIC_RLE[PVP_TIE_PIC_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x64, 0x01, 0xCC, 0xF0, 0x5E, 0x00, 0xC0, 0xF0, 0x0B, 0x05, 0xA0, 
+    0x07, 0x0A, 0xF0, 0x38, 0x01, 0x18, 0xC2, 0x02, 0x00, 0xC0, 0xF0, 0x07, 0x01, 0xA7, 0xB3, 0x01, 
+    0x7B, 0xF0, 0x36, 0x01, 0x18, 0xD2, 0x03, 0x02, 0x0C, 0xF0, 0x06, 0x00, 0x70, 0xE3, 0xF0, 0x35, 
+    0x01, 0xC8, 0xF2, 0x02, 0x01, 0x0C, 0xF0, 0x03, 0x01, 0x77, 0xF3, 0x00, 0x01, 0x7B, 0xF0, 0x33, 
+    0x00, 0x10, 0x4A, 0x00, 0x20, 0xF0, 0x04, 0x49, 0x02, 0x37, 0xA0, 0xF0, 0x31, 0x01, 0x58, 0xF2, 
+    0x04, 0x01, 0x0C, 0xF0, 0x00, 0x00, 0xA0, 0xA7, 0xF3, 0x01, 0x00, 0xB0, 0xF0, 0x32, 0x01, 0x88, 
+    0xF2, 0x04, 0x00, 0x10, 0xF0, 0x01, 0xB7, 0xF3, 0x00, 0xF0, 0x31, 0x01, 0xC8, 0x57, 0xC7, 0xF3, 
+    0x00, 0x00, 0x70, 0x7F, 0xE2, 0x01, 0x8C, 0xE0, 0x01, 0xAE, 0xC7, 0x52, 0x01, 0xAA, 0xAB, 0x00, 
+    0xA0, 0x7F, 0x00, 0x50, 0x45, 0x00, 0x70, 0xC3, 0x00, 0x70, 0xE0, 0x04, 0xAB, 0xB7, 0x70, 0xB3, 
+    0x01, 0x7B, 0x68, 0x00, 0x80, 0xF2, 0x02, 0xF0, 0x01, 0x03, 0xAE, 0xEE, 0xE7, 0x02, 0x37, 0x70, 
+    0x44, 0x01, 0xAB, 0xF3, 0x03, 0x00, 0x70, 0xF0, 0x14, 0x00, 0xC0, 0xA0, 0x03, 0xC0, 0x00, 0xC8, 
+    0xF2, 0x00, 0x04, 0x80, 0x77, 0xB0, 0xD0, 0x03, 0x7E, 0xEE, 0xF7, 0x00, 0x06, 0x37, 0xB0, 0x0B, 
+    0x70, 0xF3, 0x03, 0x03, 0x73, 0x7A, 0xF0, 0x09, 0xDC, 0x02, 0x00, 0x10, 0xF2, 0x00, 0xF0, 0x05, 
+    0x02, 0x28, 0xC0, 0xC0, 0x01, 0xBA, 0xF0, 0x01, 0x02, 0x77, 0x30, 0xB0, 0x01, 0xB7, 0xF3, 0x02, 
+    0x04, 0x77, 0x7E, 0xF0, 0x50, 0x01, 0xC1, 0xF2, 0x0A, 0xF0, 0x07, 0x43, 0x03, 0x33, 0x77, 0xF0, 
+    0x01, 0x01, 0x3E, 0xB0, 0x00, 0xB0, 0xF3, 0x00, 0xA7, 0x05, 0xFF, 0x00, 0x0A, 0xF0, 0x07, 0x01, 
+    0xC0, 0xF2, 0x0B, 0xF0, 0x0C, 0x02, 0x33, 0x30, 0xF0, 0x02, 0x00, 0x30, 0xD0, 0xC3, 0xA7, 0x04, 
+    0xFF, 0x00, 0xA0, 0xF0, 0x0B, 0x00, 0x10, 0xF2, 0x0C, 0x62, 0x01, 0x3B, 0xA0, 0x00, 0xB0, 0x47, 
+    0x02, 0xF0, 0xA0, 0xF0, 0x0E, 0x01, 0x18, 0xF2, 0x0C, 0x03, 0x05, 0xAA, 0xC0, 0x02, 0xBA, 0xA0, 
+    0xF0, 0x06, 0xCB, 0x45, 0x00, 0x00, 0xB3, 0x04, 0x77, 0x70, 0xA0, 0xF0, 0x10, 0x06, 0xC1, 0x88, 
+    0x82, 0x20, 0xC8, 0xF2, 0x02, 0xD0, 0x01, 0xAE, 0xF0, 0x08, 0x00, 0xA0, 0xE3, 0x4A, 0x00, 0xE0, 
+    0xF0, 0x15, 0x01, 0x51, 0xF8, 0x06, 0xD2, 0x44, 0x06, 0x00, 0x02, 0x28, 0xC0, 0x5C, 0x01, 0x7E, 
+    0xF0, 0x19, 0x0B, 0x56, 0x11, 0x15, 0x51, 0x61, 0x80, 0x47, 0x00, 0x20, 0x45, 0xA2, 0x4B, 0xA0, 
+    0x4B, 0x02, 0x77, 0xA0, 0xF0, 0x24, 0x00, 0x10, 0x4F, 0x00, 0x80, 0x4F, 0x03, 0x10, 0x07, 0x4B, 
+    0xF0, 0x27, 0x00, 0x10, 0x4E, 0xA2, 0x43, 0x00, 0xE0, 0x46, 0x04, 0x02, 0x00, 0x00, 0x48, 0x01, 
+    0x7B, 0xF0, 0x27, 0x00, 0xC0, 0x59, 0x00, 0x80, 0x43, 0x02, 0xE1, 0xC0, 0x4C, 0x00, 0xA0, 0x7F, 
+    0x03, 0x22, 0x28, 0x43, 0x02, 0x00, 0x10, 0x43, 0x00, 0xA0, 0xB0, 0x49, 0xF0, 0x28, 0x53, 0xB0, 
+    0x02, 0xBA, 0xA0, 0xF0, 0x02, 0x45, 0x02, 0xB3, 0x30, 0xF0, 0x2A, 0x50, 0x01, 0x81, 0x74, 0x02, 
+    0x55, 0x50, 0xF0, 0x0D, 0x00, 0xC0, 0x4D, 0x04, 0x12, 0x28, 0xC0, 0x4F, 0x01, 0xB3, 0x45, 0x03, 
+    0x03, 0x3A, 0x59, 0xE5, 0x01, 0xCC, 0xF0, 0x02, 0x01, 0xC8, 0x57, 0x00, 0x00, 0x47, 0x00, 0xB0, 
+    0xB3, 0x43, 0x00, 0xB0, 0x64, 0xF5, 0x03, 0x01, 0xC1, 0xF2, 0x01, 0x47, 0x00, 0x20, 0x4C, 0x00, 
+    0xB0, 0xD3, 0x46, 0x00, 0xB0, 0x6D, 0x02, 0x58, 0x80, 0x4E, 0x00, 0x00, 0x47, 0x01, 0xB5, 0xA0, 
+    0x00, 0xA0, 0xE3, 0x43, 0x00, 0x00, 0x7F, 0x42, 0x03, 0x22, 0x21, 0xB0, 0x01, 0x3B, 0xB0, 0x68, 
+    0x00, 0x60, 0xF5, 0x0D, 0x01, 0x18, 0xF2, 0x01, 0x48, 0x00, 0x20, 0x5B, 0x00, 0x00, 0xF5, 0x00, 
+    0x01, 0xCC, 0xB5, 0x00, 0xC0, 0xD5, 0xF6, 0x0A, 0x03, 0x55, 0x56, 0x50, 0x00, 0x00, 0xA2, 0x00, 
+    0xC0, 0x44, 0x00, 0x70, 0x50, 0x03, 0xB3, 0x37, 0xF5, 0x0F, 0x00, 0x10, 0xF6, 0x0D, 0x00, 0x90, 
+    0xF2, 0x02, 0x4F, 0x01, 0x0E, 0x4B, 0xB0, 0x00, 0x30, 0x5A, 0xA1, 0xF6, 0x08, 0x01, 0x18, 0x5A, 
+    0x00, 0x70, 0x4C, 0xE3, 0x01, 0x70, 0x5A, 0x01, 0x11, 0x7B, 0x03, 0xB0, 0x00, 0xA3, 0x02, 0x75, 
+    0x50, 0xD6, 0xB5, 0x03, 0x65, 0x55, 0xB6, 0xF1, 0x01, 0xF6, 0x03, 0x00, 0x90, 0xF2, 0x03, 0x4F, 
+    0x01, 0x37, 0xF0, 0x02, 0x02, 0x33, 0xB0, 0xA0, 0x00, 0xB0, 0xA3, 0x00, 0x00, 0x46, 0xF6, 0x05, 
+    0x4A, 0x02, 0x11, 0x10, 0xC6, 0x01, 0x18, 0x6F, 0x00, 0x00, 0xA3, 0x00, 0x70, 0x5E, 0xC1, 0xB6, 
+    0x00, 0x90, 0xF2, 0x04, 0x68, 0x01, 0x30, 0x63, 0x05, 0x11, 0x16, 0x18, 0x4F, 0x00, 0x00, 0x4B, 
+    0x00, 0x30, 0x50, 0x00, 0xB0, 0xB3, 0x01, 0x75, 0xF6, 0x09, 0xF1, 0x0D, 0x00, 0x80, 0xF2, 0x05, 
+    0x49, 0xB0, 0xA3, 0x00, 0xB0, 0xC0, 0xA3, 0x05, 0x77, 0x0B, 0x0B, 0xD3, 0x00, 0x00, 0xF6, 0x04, 
+    0xF1, 0x12, 0x4B, 0xA8, 0x47, 0x06, 0x22, 0x00, 0x0E, 0x30, 0xB7, 0xAE, 0x07, 0x77, 0xEE, 0xEF, 
+    0xFE, 0xF3, 0x00, 0x01, 0x75, 0xA6, 0x03, 0x11, 0x16, 0xF1, 0x15, 0x00, 0x80, 0xF2, 0x02, 0x05, 
+    0x88, 0x81, 0x19, 0xB8, 0xE2, 0x02, 0x00, 0xE0, 0xB7, 0x0D, 0xFF, 0x46, 0x65, 0x00, 0x44, 0xFF, 
+    0x77, 0x46, 0x00, 0x00, 0xF1, 0x1C, 0x00, 0x90, 0x49, 0x08, 0x88, 0x11, 0x16, 0x11, 0x90, 0x49, 
+    0x00, 0x20, 0x44, 0x06, 0xFF, 0x46, 0x11, 0x10, 0xA6, 0x04, 0x1F, 0xF7, 0x70, 0xD3, 0x01, 0x06, 
+    0xF1, 0x1B, 0x00, 0x80, 0xF2, 0x01, 0x01, 0x88, 0xF1, 0x00, 0x02, 0x88, 0x80, 0xF2, 0x00, 0x05, 
+    0x0E, 0xEF, 0xF4, 0xF1, 0x01, 0x05, 0x61, 0xFF, 0x77, 0xC3, 0x00, 0x70, 0xF1, 0x0A, 0x01, 0x44, 
+    0xF1, 0x06, 0x00, 0x80, 0xF2, 0x01, 0x01, 0x88, 0xF1, 0x02, 0x02, 0x88, 0x80, 0x48, 0x02, 0xFF, 
+    0x40, 0xF1, 0x05, 0x04, 0xFF, 0x77, 0x70, 0x58, 0xA4, 0xF1, 0x01, 0x00, 0x80, 0xF2, 0x01, 0x01, 
+    0x88, 0xF1, 0x04, 0x02, 0x88, 0x80, 0xE2, 0x02, 0x0F, 0x40, 0xF1, 0x06, 0x05, 0x4F, 0xE7, 0x77, 
+    0x42, 0x00, 0x40, 0x56, 0xF4, 0x00, 0x49, 0x03, 0x88, 0x14, 0xD1, 0xB4, 0x00, 0x10, 0x49, 0x00, 
+    0x40, 0xF1, 0x07, 0x48, 0x00, 0x00, 0x5F, 0x00, 0x80, 0xF2, 0x01, 0x01, 0x89, 0xF4, 0x06, 0x00, 
+    0x00, 0x47, 0x08, 0x21, 0x41, 0x11, 0x44, 0x40, 0xF1, 0x01, 0x00, 0x00, 0x42, 0x04, 0x73, 0x33, 
+    0x70, 0x5E, 0x00, 0x10, 0x48, 0x01, 0x88, 0xF4, 0x07, 0x02, 0x00, 0x80, 0x48, 0xF4, 0x02, 0x4D, 
+    0x00, 0x40, 0x5D, 0x00, 0x90, 0x47, 0x02, 0x88, 0x10, 0xF4, 0x04, 0x03, 0xD4, 0x0F, 0x48, 0x00, 
+    0x80, 0xF4, 0x04, 0x4C, 0xF1, 0x09, 0xF4, 0x04, 0x01, 0x18, 0x48, 0x00, 0x90, 0xF4, 0x02, 0xBD, 
+    0x04, 0x4F, 0xF0, 0x80, 0x46, 0x00, 0xD0, 0xF4, 0x07, 0x00, 0x00, 0xB7, 0x6B, 0x01, 0x88, 0xF4, 
+    0x00, 0xCD, 0x00, 0x40, 0x42, 0x02, 0xF8, 0x80, 0x47, 0x00, 0xD0, 0xF4, 0x05, 0x04, 0x77, 0x73, 
+    0x30, 0x62, 0x01, 0x49, 0x47, 0x00, 0x90, 0xA4, 0x00, 0xD0, 0xB4, 0xDD, 0x06, 0x40, 0x0F, 0x08, 
+    0x80, 0x44, 0x00, 0x10, 0xF4, 0x05, 0x03, 0xD4, 0x77, 0xC3, 0x02, 0x70, 0x40, 0x57, 0x00, 0x10, 
+    0xB4, 0x02, 0xD8, 0x80, 0xB2, 0x03, 0x88, 0xDD, 0xF4, 0x06, 0x01, 0xDD, 0xB0, 0x01, 0x88, 0x45, 
+    0xE1, 0xD4, 0x47, 0x00, 0x40, 0xF1, 0x09, 0x00, 0x40, 0xC1, 0xB4, 0x01, 0xDD, 0x47, 0x02, 0x9D, 
+    0x40, 0xF1, 0x05, 0x01, 0x44, 0x44, 0x00, 0x00, 0xB8, 0x01, 0x94, 0x47, 0xA1, 0x05, 0x44, 0x4F, 
+    0x77, 0xA3, 0x00, 0x70, 0x52, 0xF1, 0x02, 0x04, 0x44, 0xDD, 0x00, 0xD8, 0xF1, 0x0B, 0x01, 0xDD, 
+    0xF0, 0x00, 0x00, 0x40, 0xF1, 0x07, 0x03, 0x40, 0x0F, 0xA7, 0x01, 0xF4, 0xF1, 0x18, 0x01, 0xDD, 
+    0xC0, 0x00, 0x90, 0xF1, 0x0C, 0x00, 0x90, 0xAD, 0xA0, 0x00, 0xD0, 0xF1, 0x09, 0x07, 0x44, 0x00, 
+    0xF0, 0xD4, 0x52, 0x00, 0x40, 0xF1, 0x05, 0x03, 0x9D, 0xD0, 0xB9, 0x53, 0xF9, 0x00, 0x52, 0xE4, 
+    0x60, 0xF9, 0x01, 0xF1, 0x0B, 0x56, 0xF4, 0x05, 0x4F, 0x02, 0x41, 0x40, 0x54, 0x00, 0x90, 0xF1, 
+    0x07, 0xF9, 0x02, 0xF1, 0x05, 0xF4, 0x07, 0x4F, 0x01, 0x14, 0xF1, 0x02, 0xF9, 0x04, 0x76, 0x01, 
+    0x14, 0xF1, 0x05, 0x01, 0x44, 0xF1, 0x04, 0xF9, 0x05, 0xF1, 0x04, 0xF9, 0x04, 0xF1, 0x03, 0xF4, 
+    0x0B, 0x00, 0x10, 0xF4, 0x01, 0x02, 0x14, 0x40, 
+};
+
+const gfx_image_t PVP_TIE_PIC_IMG = {
+    .w = PVP_TIE_PIC_W, .h = PVP_TIE_PIC_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = PVP_TIE_PIC_PAL, .colors = PVP_TIE_PIC_PAL_SIZE,
+    .data = PVP_TIE_PIC_RLE, .size = PVP_TIE_PIC_RLE_SIZE,
 };
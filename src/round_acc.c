@@ -0,0 +1,114 @@
+/*==============================================================================
+ * @file    round_acc.c
+ * @brief   Time-weighted integration of DSP results over flex rounds.
+ *
+ * Each DSP result is a value held over [from, t). The part of that interval
+ * inside the round is added as value * ms, so the mean is exact for any
+ * split of the round into results, and no frame timing is involved.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "round_acc.h"
+
+typedef struct {
+  bool     open;
+  uint8_t  ch;
+  uint32_t start, end;      // [start, end) in ms
+  uint32_t fed_to;          // DSP coverage reached this time
+  float    thresh;
+  float    sum;             // Hz * ms over covered time
+  float    sum_above;       // Hz * ms over time at/above thresh
+  float    sq_above;        // Hz^2 * ms over the same time
+  float    lag_above;       // Hz * previous active Hz * ms (lag-1 product)
+  uint32_t lag_ms;          // time summed into lag_above
+  float    prev_hz;         // last active value, for lag_above
+  bool     prev_ok;
+  uint32_t covered, above;  // ms
+  float    peak;
+} round_t;
+
+static round_t s_rounds[ROUND_ACC_SLOTS];
+
+void round_acc_begin(uint8_t slot, uint8_t ch, uint32_t start_ms,
+                     uint32_t len_ms, float thresh_hz){
+  if (slot >= ROUND_ACC_SLOTS) return;
+  round_t *r = &s_rounds[slot];
+  *r = (round_t){0};
+  r->open   = true;
+  r->ch     = (ch < METRICS_CH) ? ch : 0u;
+  r->start  = start_ms;
+  r->end    = start_ms + len_ms;
+  r->fed_to = start_ms;
+  r->thresh = thresh_hz;
+}
+
+void round_acc_feed(const metrics_t *m, uint32_t from_ms){
+  for (uint8_t i = 0; i < ROUND_ACC_SLOTS; i++){
+    round_t *r = &s_rounds[i];
+    if (!r->open) continue;
+
+    // Clip [from, t) to [start, end); times wrap, so compare differences
+    uint32_t a = ((int32_t)(from_ms - r->start) > 0) ? from_ms : r->start;
+    uint32_t b = ((int32_t)(m->t_ms - r->end) < 0) ? m->t_ms : r->end;
+    if ((int32_t)(b - r->fed_to) > 0) r->fed_to = b;
+    if ((int32_t)(b - a) <= 0) continue;
+
+    uint32_t ms = b - a;
+    float    hz = m->hz[r->ch];
+    r->sum     += hz * (float)ms;
+    r->covered += ms;
+    if (hz > r->peak) r->peak = hz;
+    if (hz >= r->thresh){
+      r->sum_above += hz * (float)ms;
+      r->sq_above  += hz * hz * (float)ms;
+      r->above     += ms;
+      if (r->prev_ok){
+        r->lag_above += hz * r->prev_hz * (float)ms;
+        r->lag_ms    += ms;
+      }
+      r->prev_hz = hz;
+      r->prev_ok = true;
+    } else {
+      r->prev_ok = false;                  // lag pairs only within a burst
+    }
+  }
+}
+
+static void stats(const round_t *r, round_stats_t *out){
+  out->len_ms    = r->covered;
+  out->above_ms  = r->above;
+  out->mean_hz   = r->covered ? r->sum / (float)r->covered : 0.0f;
+  out->active_hz = r->above   ? r->sum_above / (float)r->above : 0.0f;
+  out->peak_hz   = r->peak;
+
+  float var = r->above ? r->sq_above / (float)r->above
+                         - out->active_hz * out->active_hz : 0.0f;
+  out->var_hz = (var > 0.0f) ? var : 0.0f;   // rounding can go below 0
+
+  // Lag-1 autocorrelation of consecutive active results
+  float rho = 0.0f;
+  if (r->lag_ms && out->var_hz > 0.0f){
+    float m = out->active_hz;
+    rho = (r->lag_above / (float)r->lag_ms - m * m) / out->var_hz;
+  }
+  out->lag1 = (rho < 0.0f) ? 0.0f : (rho > 0.95f ? 0.95f : rho);
+}
+
+bool round_acc_peek(uint8_t slot, round_stats_t *out){
+  if (slot >= ROUND_ACC_SLOTS) return false;
+  const round_t *r = &s_rounds[slot];
+  if (!r->open) return false;
+  stats(r, out);
+  return true;
+}
+
+bool round_acc_done(uint8_t slot, uint32_t now_ms, round_stats_t *out){
+  if (slot >= ROUND_ACC_SLOTS) return false;
+  const round_t *r = &s_rounds[slot];
+  if (!r->open) return false;
+  if ((int32_t)(r->fed_to - r->end) < 0 &&
+      (int32_t)(now_ms - (r->end + ROUND_ACC_GRACE_MS)) < 0) return false;
+
+  if (out) stats(r, out);
+  return true;
+}
@@ -50,3 +50,17 @@ bool save_write(const save_t *s){
   tmp.crc32 = crc32(&tmp, sizeof(tmp));
   return flash_write(SAVE_ADDR, &tmp, sizeof(tmp));
 }
+
+/* deferred writes */
+static const save_t *s_pending = 0;
+
+void save_request(const save_t *s){
+  s_pending = s;
+}
+
+bool save_flush(void){
+  const save_t *s = s_pending;
+  if (!s) return false;
+  s_pending = 0;
+  return save_write(s);
+}
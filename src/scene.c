@@ -0,0 +1,63 @@
+/*==============================================================================
+ * @file    scene.c
+ * @brief   Table-driven scene runner and the shared round countdown.
+ *
+ * This file is part of the EMG flex-frequency game project and follows the
+ * project coding standard for file-level documentation.
+ *============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "gfx.h"
+#include "project.h"
+#include "scene.h"
+
+void scene_start(scene_run_t *r, const scene_t *table, uint8_t count,
+                 uint8_t first, uint32_t now_ms){
+  r->table = table;
+  r->count = count;
+  scene_goto(r, first, now_ms);
+}
+
+void scene_goto(scene_run_t *r, uint8_t id, uint32_t now_ms){
+  r->cur     = id;
+  r->entered = false;
+  r->t0      = (r->table[id].flags & SCENE_FADE) ? gfx_fade_out(now_ms) : now_ms;
+}
+
+bool scene_tick(scene_run_t *r, uint32_t now_ms){
+  const scene_t *s = &r->table[r->cur];
+  scene_ctx_t    c;
+
+  c.id   = r->cur;
+  c.now  = now_ms;
+  c.t0   = r->t0;
+  c.dt   = now_ms - r->t0;
+  c.ms   = s->ms;
+  c.done = (s->ms != 0u) && (c.dt >= s->ms);
+
+  if (!r->entered){
+    r->entered = true;
+    if (s->enter) s->enter(&c);
+  }
+  if (s->tick) s->tick(&c);
+
+  uint8_t nx = s->exit ? s->exit(&c) : (c.done ? SCENE_NEXT : SCENE_STAY);
+  if (nx == SCENE_STAY) return false;
+  if (nx == SCENE_NEXT) nx = s->next;
+  if (nx >= r->count) return true;        // SCENE_END
+
+  scene_goto(r, nx, now_ms);
+  return false;
+}
+
+/* The countdown draws over whatever screen came before it */
+static void count_step(const char *label, uint16_t color){
+  gfx_header(label, color);
+  gfx_bar(0, 18, 128, 1, COL_DKGRAY);
+}
+
+void scene_count_3(const scene_ctx_t *c)   { (void)c; count_step("3", COL_WHITE);  }
+void scene_count_2(const scene_ctx_t *c)   { (void)c; count_step("2", COL_YELLOW); }
+void scene_count_1(const scene_ctx_t *c)   { (void)c; count_step("1", COL_GREEN);  }
+void scene_count_flex(const scene_ctx_t *c){ (void)c; count_step("FLEX!", COL_RED); }
@@ -0,0 +1,203 @@
+/*==============================================================================
+ * @file    sched.c
+ * @brief   Cooperative run-to-completion scheduler with deadline accounting.
+ *
+ * A fixed table of tasks, each released by its period and/or by an event
+ * flag. sched_run_once() picks the most urgent released task, runs it, and
+ * updates its counters; with nothing released it sleeps in WFI (target) or
+ * jumps the virtual clock (host_timer) to the next release (HOST_SIM).
+ *============================================================================*/
+
+#include <stddef.h>
+#include "sched.h"
+
+#include "timer.h"
+#ifdef HOST_SIM
+#include "host_timer.h"
+#else
+#include "driverlib/interrupt.h"
+#endif
+
+typedef struct {
+  const char       *name;
+  sched_fn_t        fn;
+  uint32_t          period_us;
+  uint32_t          deadline_us;
+  uint32_t          next_us;    // next periodic release
+  volatile uint32_t evt_us;     // time of the first unserved signal
+  volatile uint8_t  evt;        // set by sched_signal(), cleared before a run
+  uint8_t           prio;
+  sched_stats_t     st;
+} task_t;
+
+static task_t   s_tasks[SCHED_TASKS_MAX];
+static uint8_t  s_n       = 0;
+static uint32_t s_idle_us = 0;
+
+// Load window: idle time since s_win_t0, and the last full window's result
+static uint32_t s_win_t0      = 0;
+static uint32_t s_win_idle_us = 0;
+static uint8_t  s_headroom    = 100u;
+
+uint32_t sched_clock_us(void){ return micros(); }
+
+#ifdef HOST_SIM
+// The virtual clock is host_timer's, the one the task bodies read too
+void sched_clock_advance(uint32_t us){ host_timer_advance_us(us); }
+#endif
+
+void sched_init(void){
+  s_n           = 0;
+  s_idle_us     = 0;
+  s_win_t0      = sched_clock_us();
+  s_win_idle_us = 0;
+  s_headroom    = 100u;
+}
+
+static void _account_idle(uint32_t us){
+  s_idle_us     += us;
+  s_win_idle_us += us;
+}
+
+// Close the load window once it has run its length
+static void _load_window(uint32_t now){
+  uint32_t span = now - s_win_t0;
+  if (span < SCHED_LOAD_WINDOW_US) return;
+  uint32_t idle = (s_win_idle_us < span) ? s_win_idle_us : span;
+  s_headroom    = (uint8_t)(((uint64_t)idle * 100u) / span);
+  s_win_t0      = now;
+  s_win_idle_us = 0;
+}
+
+int8_t sched_add(const char *name, sched_fn_t fn,
+                 uint32_t period_us, uint32_t deadline_us, uint8_t prio){
+  if (s_n >= SCHED_TASKS_MAX || !fn) return -1;
+
+  task_t *t = &s_tasks[s_n];
+  t->name        = name;
+  t->fn          = fn;
+  t->period_us   = period_us;
+  t->deadline_us = deadline_us ? deadline_us : period_us;
+  t->next_us     = sched_clock_us() + period_us;
+  t->evt         = 0;
+  t->evt_us      = 0;
+  t->prio        = prio;
+  t->st          = (sched_stats_t){0};
+  return (int8_t)s_n++;
+}
+
+void sched_signal(int8_t id){
+  if (id < 0 || (uint8_t)id >= s_n) return;
+  task_t *t = &s_tasks[id];
+  if (!t->evt){
+    t->evt_us = sched_clock_us();
+    t->evt    = 1;
+  }
+}
+
+// Release time of task t at `now`, or false if it is not released.
+static bool _released(const task_t *t, uint32_t now, uint32_t *rel){
+  bool due = t->period_us && (int32_t)(now - t->next_us) >= 0;
+  if (t->evt){
+    uint32_t e = t->evt_us;
+    *rel = (due && (int32_t)(t->next_us - e) < 0) ? t->next_us : e;
+    return true;
+  }
+  if (due) *rel = t->next_us;
+  return due;
+}
+
+// Most urgent released task: lowest prio, then earliest release.
+static int _pick(uint32_t now, uint32_t *rel){
+  int best = -1;
+  uint32_t best_rel = 0;
+  for (uint8_t i = 0; i < s_n; i++){
+    uint32_t r;
+    if (!_released(&s_tasks[i], now, &r)) continue;
+    if (best < 0 || s_tasks[i].prio < s_tasks[best].prio ||
+        (s_tasks[i].prio == s_tasks[best].prio && (int32_t)(r - best_rel) < 0)){
+      best = i;
+      best_rel = r;
+    }
+  }
+  *rel = best_rel;
+  return best;
+}
+
+static void _idle(void){
+#ifdef HOST_SIM
+  // Jump straight to the next periodic release
+  bool any = false;
+  uint32_t now = micros(), wake = 0;
+  for (uint8_t i = 0; i < s_n; i++){
+    const task_t *t = &s_tasks[i];
+    if (!t->period_us) continue;
+    if (!any || (int32_t)(t->next_us - wake) < 0) wake = t->next_us;
+    any = true;
+  }
+  if (any && (int32_t)(wake - now) > 0){
+    _account_idle(wake - now);
+    host_timer_advance_us(wake - now);
+  }
+#else
+  // Re-check with interrupts masked so a signal raised between _pick() and
+  // the WFI still wakes us (a pending interrupt ends WFI even while masked)
+  uint32_t rel;
+  IntMasterDisable();
+  uint32_t t0 = micros();
+  bool sleep = _pick(t0, &rel) < 0;
+  if (sleep) __asm(" wfi");
+  IntMasterEnable();                 // lets the waking SysTick update millis()
+  if (sleep) _account_idle(micros() - t0);
+#endif
+}
+
+bool sched_run_once(void){
+  uint32_t rel;
+  uint32_t now = sched_clock_us();
+  _load_window(now);
+  int i = _pick(now, &rel);
+  if (i < 0){
+    _idle();
+    return false;
+  }
+
+  task_t *t = &s_tasks[i];
+  bool periodic = t->period_us && (int32_t)(now - t->next_us) >= 0;
+  t->evt = 0;                        // signals from here on release a new run
+
+  t->fn();
+
+  uint32_t end = sched_clock_us();
+  uint32_t late = now - rel, ran = end - now;
+  t->st.runs++;
+  if (end - rel > t->deadline_us) t->st.misses++;
+  if (late > t->st.worst_late_us) t->st.worst_late_us = late;
+  if (ran  > t->st.worst_run_us)  t->st.worst_run_us  = ran;
+
+  if (periodic){
+    t->next_us += t->period_us;
+    // A whole period went by: restart the cadence instead of bursting
+    if ((int32_t)(end - t->next_us) >= 0) t->next_us = end + t->period_us;
+  }
+  return true;
+}
+
+void sched_run(void){
+  for (;;) (void)sched_run_once();
+}
+
+const char *sched_stats(int8_t id, sched_stats_t *out){
+  if (id < 0 || (uint8_t)id >= s_n) return NULL;
+  if (out) *out = s_tasks[id].st;
+  return s_tasks[id].name;
+}
+
+uint32_t sched_idle_us(void){ return s_idle_us; }
+
+uint8_t sched_headroom_pct(void){ return s_headroom; }
+
+void sched_stats_reset(void){
+  for (uint8_t i = 0; i < s_n; i++) s_tasks[i].st = (sched_stats_t){0};
+  s_idle_us = 0;
+}
@@ -9,11 +9,15 @@
 #include "ssd1351.h"
 #include <stdint.h>
 #include <stdbool.h>
+#ifdef HOST_SIM
+#include "ssd1351_emu.h"
+#else
 #include "board.h"
 #include "timer.h"
 #include "driverlib/gpio.h"
 #include "driverlib/ssi.h"
 #include "driverlib/sysctl.h"
+#endif
 
 #define CMD_SET_COLUMN       0x15
 #define CMD_SET_ROW          0x75
@@ -36,10 +40,23 @@
 #define CMD_COMMANDLOCK      0xFD
 #define CMD_PRECHARGE2       0xB6
 
+#ifdef HOST_SIM
+// Host build: the same byte stream goes to the emulator (see ssd1351_emu.c)
+static inline void cs_low(void){  ssd1351_emu_cs(true); }
+static inline void cs_high(void){ ssd1351_emu_cs(false); }
+static inline void dc_cmd(void){  ssd1351_emu_dc(false); }
+static inline void dc_dat(void){  ssd1351_emu_dc(true); }
+static inline void rst_write(bool high){ if(!high) ssd1351_emu_reset(); }
+static void bw_delay_ms(uint32_t ms){ (void)ms; }
+static void ssi_send8(uint8_t b){ ssd1351_emu_byte(b); }
+#else
 static inline void cs_low(void){  GPIOPinWrite(OLED_PORTA_BASE, OLED_PIN_CS, 0); }
 static inline void cs_high(void){ GPIOPinWrite(OLED_PORTA_BASE, OLED_PIN_CS, OLED_PIN_CS); }
 static inline void dc_cmd(void){  GPIOPinWrite(OLED_PORTB_BASE, OLED_PIN_DC, 0); }
 static inline void dc_dat(void){  GPIOPinWrite(OLED_PORTB_BASE, OLED_PIN_DC, OLED_PIN_DC); }
+static inline void rst_write(bool high){
+  GPIOPinWrite(OLED_PORTB_BASE, OLED_PIN_RST, high ? OLED_PIN_RST : 0);
+}
 
 // Busy-wait delay independent of SysTick
 static void bw_delay_ms(uint32_t ms){
@@ -53,6 +70,7 @@ static void ssi_send8(uint8_t b){
   while(SSIBusy(OLED_SSI_BASE)){}
   while(SSIDataGetNonBlocking(OLED_SSI_BASE, &dump)){} // flush
 }
+#endif
 
 // Keep CS low across command+params
 static void write_cmd(uint8_t c){
@@ -86,6 +104,12 @@ void ssd1351_push_pixels(const uint16_t *src, uint32_t count){
   cs_high();
 }
 
+void ssd1351_push_bytes(const uint8_t *src, uint32_t n){
+  cs_low(); dc_dat();
+  for(uint32_t i=0;i<n;i++) ssi_send8(src[i]);
+  cs_high();
+}
+
 void ssd1351_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color){
   int x0 = x, y0 = y, x1 = x + w, y1 = y + h;
   if (x0 >= 128 || y0 >= 128 || x1 <= 0 || y1 <= 0) return;
@@ -107,15 +131,58 @@ void ssd1351_fill(uint16_t color){
   ssd1351_draw_rect(0,0,128,128,color);
 }
 
+void ssd1351_set_start_line(uint8_t line){
+  write_cmd1(CMD_STARTLINE, (uint8_t)(line & 0x7F));
+}
+
+void ssd1351_set_contrast_master(uint8_t level){
+  write_cmd1(CMD_CONTRASTMASTER, (uint8_t)(level & 0x0F));
+}
+
 // small helper to stage SSI clock & mode
+#ifdef HOST_SIM
+#define SSI_FRF_MOTO_MODE_3 3u
+static void _ssi_set(uint32_t hz, uint32_t mode){
+  (void)mode;
+  ssd1351_emu_sck(hz);
+}
+#else
+// Last format set, re-applied when another SSI0 device hands the bus back
+static volatile uint32_t s_ssi_hz   = 0;
+static volatile uint32_t s_ssi_mode = 0;
+static bool              s_parked_cs_low = false;
+
 static void _ssi_set(uint32_t hz, uint32_t mode){
+  s_ssi_hz = hz; s_ssi_mode = mode;
   SSIDisable(OLED_SSI_BASE);
   SSIConfigSetExpClk(OLED_SSI_BASE, SysCtlClockGet(),
                      mode, SSI_MODE_MASTER, hz, 8);
   SSIEnable(OLED_SSI_BASE);
 }
 
+// The byte in flight finishes; CS is parked high so the panel ignores the
+// other device's clocks. D/C is left alone.
+void ssd1351_bus_suspend(void){
+  if (!s_ssi_hz) return;                       // not initialized: nothing to park
+  while(SSIBusy(OLED_SSI_BASE)){}
+  s_parked_cs_low = (GPIOPinRead(OLED_PORTA_BASE, OLED_PIN_CS) & OLED_PIN_CS) == 0;
+  cs_high();
+}
+
+void ssd1351_bus_resume(void){
+  uint32_t dump;
+  if (!s_ssi_hz) return;
+  SSIDisable(OLED_SSI_BASE);
+  SSIConfigSetExpClk(OLED_SSI_BASE, SysCtlClockGet(),
+                     s_ssi_mode, SSI_MODE_MASTER, s_ssi_hz, 8);
+  SSIEnable(OLED_SSI_BASE);
+  while(SSIDataGetNonBlocking(OLED_SSI_BASE, &dump)){}
+  if (s_parked_cs_low) cs_low();
+}
+#endif
+
 void ssd1351_init(void){
+#ifndef HOST_SIM
   // Clocks and pins
   SysCtlPeripheralEnable(OLED_PERIPH_PORTA);
   SysCtlPeripheralEnable(OLED_PERIPH_PORTB);
@@ -128,6 +195,7 @@ void ssd1351_init(void){
   GPIOPinTypeGPIOOutput(OLED_PORTA_BASE, OLED_PIN_CS);
 
   GPIOPinTypeGPIOOutput(OLED_PORTB_BASE, OLED_PIN_DC | OLED_PIN_RST);
+#endif
 
   // Idle levels
   cs_high(); dc_dat();
@@ -136,9 +204,9 @@ void ssd1351_init(void){
   _ssi_set(4000000u, SSI_FRF_MOTO_MODE_3);
 
   // Reset with generous delays
-  GPIOPinWrite(OLED_PORTB_BASE, OLED_PIN_RST, OLED_PIN_RST); bw_delay_ms(10);
-  GPIOPinWrite(OLED_PORTB_BASE, OLED_PIN_RST, 0);            bw_delay_ms(50);
-  GPIOPinWrite(OLED_PORTB_BASE, OLED_PIN_RST, OLED_PIN_RST); bw_delay_ms(120);
+  rst_write(true);  bw_delay_ms(10);
+  rst_write(false); bw_delay_ms(50);
+  rst_write(true);  bw_delay_ms(120);
 
   // Init sequence
   write_cmd1(CMD_COMMANDLOCK,   0x12);
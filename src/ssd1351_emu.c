@@ -0,0 +1,296 @@
+/*==============================================================================
+ * @file    ssd1351_emu.c
+ * @brief   Host SSD1351 emulator: command decoder, framebuffer, SPI accounting.
+ *
+ * Only built with -DHOST_SIM. Decodes the byte stream ssd1351.c produces
+ * (column/row address, WRITERAM, remap, start line, offset, contrast,
+ * display on/off) into GDDRAM, and keeps per-frame SPI cost counters.
+ * Remap 0x74 (what ssd1351_init() programs) is the reference orientation.
+ *============================================================================*/
+
+#ifdef HOST_SIM
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "ssd1351_emu.h"
+
+#define EMU_W 128
+#define EMU_H 128
+
+#define CMD_SET_COLUMN       0x15
+#define CMD_SET_ROW          0x75
+#define CMD_WRITERAM         0x5C
+#define CMD_DISPLAYOFF       0xAE
+#define CMD_DISPLAYON        0xAF
+#define CMD_SETREMAP         0xA0
+#define CMD_STARTLINE        0xA1
+#define CMD_DISPLAYOFFSET    0xA2
+#define CMD_DISPLAYALLOFF    0xA4
+#define CMD_DISPLAYALLON     0xA5
+#define CMD_NORMALDISPLAY    0xA6
+#define CMD_INVERTDISPLAY    0xA7
+#define CMD_CONTRASTMASTER   0xC7
+
+#define REMAP_REF            0x74   // orientation the firmware is written for
+
+static struct {
+  uint16_t ram[EMU_H][EMU_W];       // GDDRAM, [row][col]
+
+  // controller registers
+  uint8_t  col0, col1, row0, row1;  // address window
+  uint8_t  col, row;                // write pointer
+  uint8_t  remap;
+  uint8_t  start_line;
+  uint8_t  offset;
+  uint8_t  contrast;                // master, 0..15
+  uint8_t  mode;                    // A4..A7
+  bool     on;
+
+  // byte decoder
+  bool     cs, dc;
+  uint8_t  cmd;                     // last command byte
+  uint8_t  args[4];
+  uint8_t  nargs;
+  bool     ram_write;               // inside a WRITERAM stream
+  bool     have_hi;
+  uint8_t  hi;
+
+  // accounting
+  uint32_t sck_prog, sck_override;
+  ssd1351_emu_stats_t st;
+} E;
+
+static void _regs_default(void){
+  E.col0 = 0; E.col1 = EMU_W - 1;
+  E.row0 = 0; E.row1 = EMU_H - 1;
+  E.col  = 0; E.row  = 0;
+  E.remap = REMAP_REF;
+  E.start_line = 0;
+  E.offset = 0;
+  E.contrast = 0x0F;
+  E.mode = CMD_NORMALDISPLAY;
+  E.on = false;
+  E.ram_write = false;
+  E.have_hi = false;
+  E.nargs = 0;
+}
+
+void ssd1351_emu_reset(void){
+  memset(E.ram, 0, sizeof(E.ram));
+  _regs_default();
+}
+
+void ssd1351_emu_sck(uint32_t hz){ E.sck_prog = hz; }
+void ssd1351_emu_set_sck_hz(uint32_t hz){ E.sck_override = hz; }
+
+void ssd1351_emu_cs(bool asserted){
+  if (asserted && !E.cs) E.st.cs_assertions++;
+  E.cs = asserted;
+}
+
+void ssd1351_emu_dc(bool data){ E.dc = data; }
+
+// Store one pixel at the write pointer and advance it inside the window
+static void _ram_put(uint16_t c){
+  if (E.col < EMU_W && E.row < EMU_H) E.ram[E.row][E.col] = c;
+  E.st.pixels++;
+
+  if (E.remap & 0x01){                // vertical address increment
+    if (E.row >= E.row1){ E.row = E.row0; E.col = (E.col >= E.col1) ? E.col0 : (uint8_t)(E.col + 1); }
+    else E.row++;
+  } else {                            // horizontal address increment
+    if (E.col >= E.col1){ E.col = E.col0; E.row = (E.row >= E.row1) ? E.row0 : (uint8_t)(E.row + 1); }
+    else E.col++;
+  }
+}
+
+// Number of parameter bytes after which a command takes effect
+static uint8_t _argc(uint8_t cmd){
+  switch (cmd){
+    case CMD_SET_COLUMN:
+    case CMD_SET_ROW:        return 2;
+    case CMD_SETREMAP:
+    case CMD_STARTLINE:
+    case CMD_DISPLAYOFFSET:
+    case CMD_CONTRASTMASTER: return 1;
+    default:                 return 0;   // ignored / no state we model
+  }
+}
+
+static void _apply(void){
+  switch (E.cmd){
+    case CMD_SET_COLUMN:
+      E.col0 = E.args[0] & 0x7F; E.col1 = E.args[1] & 0x7F; E.col = E.col0;
+      break;
+    case CMD_SET_ROW:
+      E.row0 = E.args[0] & 0x7F; E.row1 = E.args[1] & 0x7F; E.row = E.row0;
+      break;
+    case CMD_SETREMAP:       E.remap = E.args[0];              break;
+    case CMD_STARTLINE:      E.start_line = E.args[0] & 0x7F;  break;
+    case CMD_DISPLAYOFFSET:  E.offset = E.args[0] & 0x7F;      break;
+    case CMD_CONTRASTMASTER: E.contrast = E.args[0] & 0x0F;    break;
+    default: break;
+  }
+}
+
+void ssd1351_emu_byte(uint8_t b){
+  if (!E.cs) return;                  // controller ignores the bus
+
+  E.st.bytes++;
+  uint32_t sck = E.sck_override ? E.sck_override : E.sck_prog;
+  if (sck) E.st.wire_ns += (8ull * 1000000000ull) / sck;
+
+  if (!E.dc){                         // command byte
+    E.st.cmd_bytes++;
+    E.cmd = b;
+    E.nargs = 0;
+    E.ram_write = false;
+    E.have_hi = false;
+    switch (b){
+      case CMD_WRITERAM:
+        E.ram_write = true;
+        E.col = E.col0; E.row = E.row0;
+        E.st.windows++;
+        break;
+      case CMD_DISPLAYON:  E.on = true;  break;
+      case CMD_DISPLAYOFF: E.on = false; break;
+      case CMD_DISPLAYALLOFF:
+      case CMD_DISPLAYALLON:
+      case CMD_NORMALDISPLAY:
+      case CMD_INVERTDISPLAY: E.mode = b; break;
+      default: break;
+    }
+    return;
+  }
+
+  E.st.data_bytes++;
+  if (E.ram_write){                   // 65k colour: high byte then low byte
+    if (!E.have_hi){ E.hi = b; E.have_hi = true; }
+    else { _ram_put((uint16_t)((E.hi << 8) | b)); E.have_hi = false; }
+    return;
+  }
+
+  uint8_t need = _argc(E.cmd);
+  if (E.nargs < sizeof(E.args)) E.args[E.nargs] = b;
+  E.nargs++;
+  if (need && E.nargs == need) _apply();
+}
+
+void ssd1351_emu_stats(ssd1351_emu_stats_t *out){ if (out) *out = E.st; }
+void ssd1351_emu_stats_reset(void){ memset(&E.st, 0, sizeof(E.st)); }
+uint8_t ssd1351_emu_contrast_master(void){ return E.contrast; }
+
+uint16_t ssd1351_emu_pixel(uint8_t x, uint8_t y){
+  x &= 0x7F; y &= 0x7F;
+  // Deviations from the reference remap flip the scan direction
+  uint8_t cx = ((E.remap ^ REMAP_REF) & 0x02) ? (uint8_t)(EMU_W - 1 - x) : x;
+  uint8_t ry = ((E.remap ^ REMAP_REF) & 0x10) ? (uint8_t)(EMU_H - 1 - y) : y;
+  ry = (uint8_t)((ry + E.start_line + E.offset) & 0x7F);
+  uint16_t c = E.ram[ry][cx];
+  if ((E.remap ^ REMAP_REF) & 0x04)   // colour order A<->C
+    c = (uint16_t)(((c & 0x1F) << 11) | (c & 0x07E0) | (c >> 11));
+  return c;
+}
+
+// Panel output as 8-bit RGB, after display mode and master contrast
+static void _rgb888(uint8_t x, uint8_t y, uint8_t out[3]){
+  uint16_t c;
+  if (!E.on || E.mode == CMD_DISPLAYALLOFF) c = 0x0000;
+  else if (E.mode == CMD_DISPLAYALLON)      c = 0xFFFF;
+  else {
+    c = ssd1351_emu_pixel(x, y);
+    if (E.mode == CMD_INVERTDISPLAY) c = (uint16_t)~c;
+  }
+  uint32_t r = ((c >> 11) & 0x1F) * 255u / 31u;
+  uint32_t g = ((c >>  5) & 0x3F) * 255u / 63u;
+  uint32_t b = ( c        & 0x1F) * 255u / 31u;
+  uint32_t k = (uint32_t)E.contrast + 1u;          // 1..16
+  out[0] = (uint8_t)(r * k / 16u);
+  out[1] = (uint8_t)(g * k / 16u);
+  out[2] = (uint8_t)(b * k / 16u);
+}
+
+int ssd1351_emu_dump_ppm(const char *path){
+  FILE *f = fopen(path, "wb");
+  if (!f) return -1;
+  fprintf(f, "P6\n%d %d\n255\n", EMU_W, EMU_H);
+  for (uint8_t y = 0; y < EMU_H; ++y){
+    for (uint8_t x = 0; x < EMU_W; ++x){
+      uint8_t px[3]; _rgb888(x, y, px);
+      fwrite(px, 1, 3, f);
+    }
+  }
+  return fclose(f) ? -1 : 0;
+}
+
+// PNG writer
+static uint32_t _crc_tab[256];
+
+static uint32_t _crc32(uint32_t crc, const uint8_t *p, uint32_t n){
+  if (!_crc_tab[1]){
+    for (uint32_t i = 0; i < 256; ++i){
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+      _crc_tab[i] = c;
+    }
+  }
+  crc = ~crc;
+  while (n--) crc = _crc_tab[(crc ^ *p++) & 0xFFu] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void _put32(uint8_t *p, uint32_t v){
+  p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16);
+  p[2] = (uint8_t)(v >> 8);  p[3] = (uint8_t)v;
+}
+
+static void _chunk(FILE *f, const char *type, const uint8_t *data, uint32_t n){
+  uint8_t hdr[8];
+  _put32(hdr, n);
+  memcpy(hdr + 4, type, 4);
+  fwrite(hdr, 1, 8, f);
+  if (n) fwrite(data, 1, n, f);
+  uint32_t crc = _crc32(0, hdr + 4, 4);
+  crc = _crc32(crc, data, n);
+  uint8_t t[4]; _put32(t, crc);
+  fwrite(t, 1, 4, f);
+}
+
+int ssd1351_emu_dump_png(const char *path){
+  enum { ROW = 1 + EMU_W * 3, RAW = EMU_H * ROW };   // filter byte + RGB
+  static uint8_t z[2 + 5 + RAW + 4];                 // zlib: one stored block
+
+  uint8_t *raw = z + 7;
+  for (uint8_t y = 0; y < EMU_H; ++y){
+    uint8_t *r = raw + (uint32_t)y * ROW;
+    r[0] = 0;                                        // filter: none
+    for (uint8_t x = 0; x < EMU_W; ++x) _rgb888(x, y, r + 1 + x * 3);
+  }
+
+  z[0] = 0x78; z[1] = 0x01;                          // deflate, 32K window
+  z[2] = 0x01;                                       // final stored block
+  z[3] = (uint8_t)(RAW & 0xFF);  z[4] = (uint8_t)(RAW >> 8);
+  z[5] = (uint8_t)(~RAW & 0xFF); z[6] = (uint8_t)((~RAW >> 8) & 0xFF);
+
+  uint32_t a = 1, b = 0;                             // adler32 of raw
+  for (uint32_t i = 0; i < RAW; ++i){ a = (a + raw[i]) % 65521u; b = (b + a) % 65521u; }
+  _put32(raw + RAW, (b << 16) | a);
+
+  FILE *f = fopen(path, "wb");
+  if (!f) return -1;
+  static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+  fwrite(sig, 1, 8, f);
+
+  uint8_t ihdr[13];
+  _put32(ihdr, EMU_W); _put32(ihdr + 4, EMU_H);
+  ihdr[8] = 8;  ihdr[9] = 2;                         // 8-bit truecolour
+  ihdr[10] = 0; ihdr[11] = 0; ihdr[12] = 0;
+  _chunk(f, "IHDR", ihdr, sizeof(ihdr));
+  _chunk(f, "IDAT", z, sizeof(z));
+  _chunk(f, "IEND", NULL, 0);
+  return fclose(f) ? -1 : 0;
+}
+
+#endif /* HOST_SIM */
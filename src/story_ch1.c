@@ -6,297 +6,228 @@ const uint16_t STORY_CH1_PAL[STORY_CH1_PAL_SIZE] = {
     0xD6DA, 0x49A5, 0x8B6A, 0x6514, 0x744D, 0xF92A, 0xDA49, 0xD0F5, 
 };
 
-const uint8_t STORY_CH1_IDX[(STORY_CH1_W * STORY_CH1_H) / 2] = {
-    0x01, 0x10, 0x00, 0x00, 0x03, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x22, 0x77, 0x32, 0x12, 0x42, 
-    0x12, 0x11, 0x14, 0x04, 0x40, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x80, 0x00, 0x00, 0x01, 0x10, 0x11, 0x11, 0x11, 0x11, 0x20, 0x33, 0x33, 0x01, 0x12, 0x13, 
-    0x25, 0x41, 0x10, 0x31, 0x31, 0x10, 0x00, 0x11, 0x10, 0x10, 0x00, 0x00, 0x00, 0x11, 0x30, 0x00, 
-    0x11, 0x01, 0x10, 0x00, 0x01, 0x13, 0x11, 0x00, 0x00, 0x00, 0x72, 0x27, 0x33, 0x32, 0x45, 0x4C, 
-    0x40, 0x21, 0x44, 0x04, 0x08, 0x80, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x80, 0x04, 0x00, 0x11, 0x31, 0x31, 0x13, 0x13, 0x13, 0x33, 0x11, 0x11, 0x11, 0x13, 
-    0x11, 0x11, 0x33, 0x11, 0x11, 0x11, 0x10, 0x01, 0x13, 0x33, 0x12, 0x20, 0x20, 0x00, 0x30, 0x00, 
-    0x01, 0x11, 0x01, 0x01, 0x11, 0x11, 0x13, 0x00, 0x00, 0x03, 0x27, 0x00, 0x33, 0x22, 0x44, 0x50, 
-    0x85, 0x42, 0x21, 0x40, 0x88, 0x88, 0x88, 0x80, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x80, 0x00, 0x41, 0x11, 0x11, 0x31, 0x31, 0x13, 0x31, 0x31, 0x11, 0x32, 0x82, 0x21, 0x10, 
-    0x11, 0x03, 0x03, 0x21, 0x11, 0x11, 0x13, 0x13, 0x00, 0x13, 0x02, 0x20, 0x20, 0x00, 0x00, 0x00, 
-    0x13, 0x00, 0x01, 0x03, 0x31, 0x01, 0x10, 0x00, 0x00, 0x00, 0x30, 0x00, 0x31, 0x22, 0x12, 0x88, 
-    0x55, 0x52, 0x11, 0x44, 0x08, 0x00, 0x88, 0x00, 0x05, 0x50, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x80, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x11, 0x15, 0x52, 0x42, 0x11, 
-    0x11, 0x10, 0x34, 0x21, 0x13, 0x11, 0x13, 0x11, 0x11, 0x31, 0x12, 0x29, 0x20, 0x00, 0x00, 0x00, 
-    0x11, 0x01, 0x33, 0x03, 0x00, 0x03, 0x30, 0x03, 0x00, 0x33, 0x32, 0x33, 0x03, 0x22, 0x22, 0x40, 
-    0x45, 0x21, 0x04, 0x04, 0x55, 0x08, 0x88, 0x05, 0x55, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x00, 0x14, 0x04, 0x01, 0x11, 0x11, 0x11, 0x21, 0x13, 0x01, 0x22, 0x44, 0x21, 0x22, 0x13, 
-    0x00, 0x12, 0x01, 0x11, 0x13, 0x10, 0x31, 0x11, 0x11, 0x10, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x00, 0x33, 0x30, 0x10, 0x00, 0x00, 0x01, 0x30, 0x33, 0x32, 0x13, 0x00, 0x32, 0x22, 0xC4, 
-    0x21, 0x2C, 0x10, 0x05, 0x55, 0x80, 0x88, 0x85, 0xC5, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x13, 0x01, 0xC1, 0x25, 0x20, 0x12, 0x11, 
-    0x01, 0xA0, 0x00, 0x11, 0x30, 0x00, 0x03, 0x20, 0x21, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x11, 0x00, 0x01, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x03, 0x33, 0x31, 0x42, 
-    0x22, 0x12, 0x24, 0x55, 0x55, 0x58, 0x88, 0x85, 0xC5, 0x80, 0x00, 0x55, 0x88, 0x88, 0x88, 0x88, 
-    0x80, 0x00, 0x40, 0x01, 0x14, 0x01, 0x11, 0x22, 0x2C, 0x41, 0x32, 0x14, 0x21, 0x01, 0x11, 0x11, 
-    0x11, 0x10, 0x01, 0x30, 0x03, 0x30, 0x30, 0x13, 0x22, 0x11, 0x12, 0x42, 0x00, 0x03, 0x00, 0x00, 
-    0x14, 0x11, 0x00, 0x00, 0x01, 0x00, 0x32, 0x01, 0x13, 0x00, 0x33, 0x23, 0x30, 0x03, 0x32, 0x21, 
-    0x13, 0x22, 0xC2, 0x24, 0x5C, 0x58, 0x50, 0x05, 0xC0, 0x55, 0x55, 0x55, 0x88, 0x88, 0x88, 0x88, 
-    0x85, 0x88, 0x55, 0x40, 0x11, 0x11, 0x11, 0x11, 0x20, 0x52, 0x12, 0x22, 0x10, 0x01, 0xC2, 0x11, 
-    0x13, 0x00, 0x91, 0x03, 0x00, 0x02, 0x21, 0x21, 0x21, 0x30, 0x1A, 0x02, 0x00, 0x03, 0x30, 0x00, 
-    0x11, 0x13, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x27, 
-    0x33, 0x32, 0x22, 0xCC, 0xCC, 0x58, 0x05, 0x55, 0x00, 0x55, 0x55, 0x55, 0x88, 0x88, 0x88, 0x88, 
-    0x00, 0x85, 0x05, 0x54, 0x44, 0x11, 0x11, 0x11, 0x11, 0x2C, 0x14, 0x41, 0x31, 0x21, 0x14, 0x11, 
-    0x11, 0x10, 0x11, 0x00, 0x00, 0x20, 0x22, 0x21, 0x10, 0x00, 0x20, 0x02, 0x77, 0x71, 0x30, 0x02, 
-    0x12, 0x10, 0x30, 0x33, 0x00, 0x30, 0x00, 0x31, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x32, 0x23, 
-    0x33, 0x32, 0x24, 0x55, 0x4C, 0x58, 0x04, 0x40, 0x80, 0x55, 0x55, 0x55, 0x00, 0x88, 0x88, 0x80, 
-    0x50, 0x55, 0x00, 0x54, 0x40, 0x11, 0x21, 0x21, 0x01, 0x14, 0x44, 0x11, 0x31, 0x21, 0x11, 0x30, 
-    0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x44, 0x42, 0x72, 0x22, 0x33, 0x33, 
-    0x10, 0x30, 0x03, 0x30, 0x00, 0x00, 0x00, 0x03, 0x14, 0x13, 0x00, 0x00, 0x30, 0x30, 0x33, 0x23, 
-    0x00, 0x72, 0x24, 0x00, 0x4C, 0x58, 0x05, 0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x88, 0x88, 0x80, 
-    0x50, 0x50, 0x55, 0x54, 0x01, 0x00, 0x01, 0xC0, 0x01, 0x44, 0x41, 0x11, 0x11, 0x11, 0x13, 0x00, 
-    0x19, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x22, 0x77, 0x22, 0x23, 0x11, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x00, 0x01, 0x30, 0x30, 0x33, 0x00, 
-    0x70, 0x31, 0x24, 0x44, 0x5C, 0xCB, 0x55, 0xCC, 0x40, 0x55, 0x55, 0x55, 0x58, 0x88, 0x88, 0x00, 
-    0x55, 0x55, 0x44, 0x44, 0x44, 0x14, 0x00, 0x14, 0x45, 0x41, 0x00, 0x11, 0x11, 0x11, 0x10, 0x30, 
-    0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x22, 0x72, 0x70, 0x12, 
-    0x11, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x03, 0x01, 0x13, 0x00, 0x03, 0x13, 0x00, 0x00, 0x00, 
-    0x33, 0x31, 0x2C, 0x44, 0x5C, 0xBC, 0x45, 0xCC, 0x45, 0x55, 0x55, 0xC5, 0x88, 0x88, 0x88, 0x00, 
-    0x55, 0x55, 0x40, 0x10, 0x40, 0x04, 0x44, 0x44, 0x14, 0x41, 0x4C, 0x11, 0x11, 0x13, 0x31, 0x33, 
-    0x11, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB2, 0x70, 0x00, 
-    0x11, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x31, 0x10, 0x00, 0x00, 
-    0x03, 0x31, 0x2C, 0x14, 0x45, 0x05, 0x44, 0x55, 0x54, 0x45, 0x55, 0x25, 0x00, 0x88, 0x88, 0x80, 
-    0x55, 0x55, 0x54, 0x00, 0x40, 0x14, 0x44, 0x44, 0x1C, 0x54, 0x40, 0x11, 0x11, 0x11, 0x13, 0x31, 
-    0x11, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x03, 0x01, 0x10, 0x00, 0x31, 0x13, 0x30, 0x00, 
-    0x03, 0x11, 0xC1, 0x1C, 0xC5, 0x55, 0x44, 0x45, 0x5C, 0xC5, 0x55, 0x55, 0x58, 0x88, 0x88, 0x80, 
-    0x55, 0x55, 0x54, 0x40, 0x00, 0x14, 0x01, 0x40, 0x24, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x90, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x30, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00, 0x13, 0x00, 0x11, 0x13, 0x00, 0x03, 0x73, 0x33, 
-    0x03, 0x21, 0x2C, 0xC2, 0x2C, 0xCC, 0xC5, 0x44, 0x5C, 0xB5, 0x55, 0x22, 0x55, 0x58, 0x88, 0x05, 
-    0x55, 0x55, 0x55, 0x54, 0x44, 0x44, 0x10, 0x4C, 0x24, 0xC1, 0x11, 0x11, 0x11, 0x31, 0x11, 0x14, 
-    0x11, 0x90, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x33, 0x01, 0x21, 0x20, 0x00, 0x00, 0x00, 0x33, 
-    0x00, 0x03, 0x2C, 0xC2, 0x2C, 0xC2, 0xC5, 0x54, 0x4C, 0x55, 0x55, 0x55, 0x55, 0x50, 0x80, 0x55, 
-    0x05, 0x55, 0x55, 0xB4, 0x42, 0x24, 0x41, 0xC4, 0x41, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x9A, 0x10, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x30, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x12, 0x22, 0x22, 0x2C, 0x45, 0xC4, 0x4C, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x5B, 0xCC, 0x41, 0x12, 0x40, 0x04, 0x41, 0x00, 0x42, 0x21, 0x22, 0x21, 0x31, 0x19, 
-    0xAA, 0xA9, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-    0x12, 0x23, 0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x30, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x2C, 0xC4, 0xC4, 0x45, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x5C, 0xBB, 0x04, 0xC2, 0x40, 0x10, 0xC4, 0x40, 0x00, 0x01, 0x12, 0x11, 0x11, 0x11, 
-    0xA9, 0x90, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x12, 0x33, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x32, 0x22, 0x44, 0x22, 0x22, 0x22, 0xCC, 0x55, 0xC5, 0x55, 0x55, 0xBC, 0x55, 0x50, 0x00, 0x55, 
-    0x05, 0x55, 0x5C, 0xCC, 0xBC, 0xCC, 0xC4, 0x01, 0x2C, 0x04, 0x44, 0x00, 0x01, 0x11, 0x01, 0x99, 
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x12, 0x13, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
-    0x12, 0x22, 0xC4, 0x22, 0x22, 0x22, 0x2C, 0xC0, 0x05, 0x50, 0x50, 0x00, 0x55, 0x55, 0x50, 0x55, 
-    0x55, 0x05, 0x55, 0xC0, 0x00, 0x00, 0x0A, 0xAA, 0x11, 0x2C, 0xC4, 0x40, 0x01, 0x11, 0x19, 0x90, 
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x90, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x22, 0x23, 0x00, 0x13, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x11, 0x1C, 0x22, 0x22, 0x22, 0x22, 0x20, 0xD6, 0x66, 0x66, 0x66, 0xBB, 0x50, 0x6E, 0x05, 
-    0x00, 0xD6, 0xB5, 0x40, 0xD6, 0x66, 0x66, 0x66, 0xBC, 0x22, 0xC4, 0xC4, 0x01, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x00, 0x11, 0x01, 0x00, 0x03, 0x33, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x12, 0x22, 0x25, 0x52, 0x22, 0x2F, 0x66, 0x66, 0x66, 0x66, 0xBB, 0x50, 0x6E, 0x05, 
-    0x00, 0xD6, 0xB0, 0x50, 0x66, 0x66, 0x66, 0x66, 0xBB, 0x22, 0xBC, 0xC5, 0x41, 0x11, 0x90, 0x00, 
-    0x00, 0x09, 0x99, 0x99, 0x11, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x30, 0x11, 0x11, 0x11, 0x03, 0x10, 0x31, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x1C, 0x22, 0x4C, 0x22, 0x24, 0x4A, 0x25, 0x0D, 0x6B, 0xBB, 0xB5, 0x50, 0x6E, 0x05, 
-    0x50, 0xD6, 0xB0, 0x50, 0x6E, 0xB5, 0x5B, 0xBB, 0xB2, 0x2C, 0xBC, 0xCC, 0x44, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x01, 0x11, 0x10, 0x01, 0x10, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x1C, 0x22, 0x4C, 0x22, 0x22, 0xA2, 0x24, 0x0D, 0x60, 0xB2, 0x55, 0x50, 0x6E, 0x05, 
-    0x00, 0xD6, 0xB0, 0x50, 0x6E, 0x05, 0x55, 0xBC, 0x2C, 0xCC, 0xC2, 0x22, 0x22, 0x19, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x40, 0x11, 0x11, 0x10, 0x00, 0x33, 0x13, 0x11, 0x03, 0x00, 0x03, 0x31, 0x00, 0x00, 0x00, 
-    0x03, 0x32, 0xC2, 0x22, 0x2C, 0x22, 0x22, 0x22, 0x44, 0xFD, 0x60, 0xB2, 0xC5, 0x50, 0x6E, 0x05, 
-    0x50, 0xD6, 0xB5, 0x50, 0x6E, 0x05, 0x55, 0x5B, 0xCC, 0xCC, 0xC2, 0x22, 0x22, 0xA9, 0x00, 0x00, 
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x00, 0x01, 0x11, 0x10, 0x03, 0x00, 0x31, 0x30, 0x03, 0x30, 0x03, 0x11, 0x03, 0x30, 0x00, 
-    0x00, 0x31, 0x22, 0x22, 0x22, 0x27, 0x22, 0x22, 0x42, 0xFD, 0x60, 0xB5, 0x25, 0x50, 0x66, 0xDD, 
-    0xDD, 0x66, 0xBB, 0x20, 0x66, 0xDD, 0xD6, 0xB5, 0xCC, 0xC2, 0x22, 0x22, 0x24, 0x49, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x13, 0x00, 0x33, 0x00, 0x01, 0x11, 0x13, 0x00, 0x33, 0x13, 0x03, 0x21, 0x00, 
-    0x00, 0x01, 0x22, 0x22, 0x52, 0x22, 0x22, 0x22, 0x2C, 0x0D, 0x6B, 0xC4, 0x2C, 0x50, 0x66, 0x66, 
-    0x66, 0x66, 0xBB, 0x40, 0x66, 0x66, 0x66, 0x05, 0x5C, 0xCC, 0x22, 0x2A, 0x2A, 0x00, 0x01, 0x20, 
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x00, 0x31, 0x13, 0x11, 0x21, 0x13, 0x33, 0x00, 0x03, 0x11, 0x12, 0x31, 
-    0x30, 0x03, 0x12, 0x25, 0x04, 0x22, 0x22, 0x22, 0x22, 0xFD, 0x6B, 0x22, 0x2C, 0x50, 0x6E, 0xBC, 
-    0xC0, 0xD6, 0xBB, 0x40, 0x6E, 0xB5, 0x55, 0xB5, 0x5C, 0xCC, 0x22, 0xA2, 0x21, 0x10, 0x02, 0x20, 
-    0x00, 0x09, 0x90, 0x00, 0x01, 0x00, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x10, 0x00, 0x03, 0x11, 0x12, 0x19, 0x13, 0x00, 0x01, 0x11, 0x11, 0x11, 0x33, 
-    0x31, 0x02, 0x22, 0x45, 0x44, 0x22, 0x22, 0x12, 0x22, 0xFD, 0x6B, 0x22, 0x22, 0xCF, 0x6E, 0x04, 
-    0xC0, 0xD6, 0xBB, 0x40, 0x6E, 0x0C, 0x55, 0x55, 0x55, 0x54, 0x22, 0xA2, 0x29, 0x99, 0x02, 0x20, 
-    0x00, 0x09, 0x19, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x01, 0x00, 0x00, 0x00, 0x31, 0x03, 0x24, 0x13, 0x11, 0x12, 0x23, 0x33, 0x12, 
-    0x12, 0x12, 0x2A, 0x4A, 0x42, 0x32, 0x22, 0x22, 0x21, 0x0D, 0x6B, 0x22, 0x22, 0xCF, 0x6E, 0x04, 
-    0x40, 0xD6, 0xBC, 0xC0, 0x6E, 0x00, 0x05, 0x00, 0x44, 0x44, 0x22, 0x22, 0x20, 0x19, 0x02, 0x10, 
-    0x00, 0x99, 0x99, 0x00, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x10, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x12, 0x22, 0x70, 0x22, 
-    0x12, 0x22, 0x24, 0x44, 0x22, 0x23, 0x22, 0x22, 0x23, 0x0D, 0x6B, 0xCA, 0x42, 0x40, 0x6E, 0x04, 
-    0x40, 0xD6, 0xBC, 0x20, 0x66, 0xED, 0xDD, 0xDD, 0xBB, 0x55, 0x22, 0x22, 0x10, 0x20, 0x01, 0x11, 
-    0x00, 0x91, 0x19, 0x00, 0x01, 0x00, 0x0A, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x11, 0x00, 0x00, 0x11, 0x10, 0x13, 0x02, 0x77, 0x27, 0x32, 
-    0x31, 0x2A, 0x44, 0x42, 0x12, 0x12, 0x22, 0x22, 0x22, 0x0D, 0x60, 0xC4, 0x44, 0x0F, 0x6E, 0x02, 
-    0x40, 0xD6, 0xBC, 0x2F, 0x66, 0x66, 0x66, 0x66, 0xBB, 0x55, 0x22, 0xA1, 0x90, 0x19, 0x0A, 0x41, 
-    0x10, 0x11, 0x10, 0x99, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x10, 0x00, 0x0A, 0xA0, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x77, 0x77, 0x72, 
-    0x12, 0xA4, 0x44, 0x22, 0x12, 0x22, 0x00, 0x00, 0x22, 0x22, 0x2B, 0x44, 0x40, 0x04, 0xAC, 0xC2, 
-    0xC2, 0xA4, 0xBC, 0x22, 0xA2, 0x25, 0xA2, 0x20, 0xB5, 0x54, 0x22, 0xA1, 0x00, 0x99, 0x0A, 0x00, 
-    0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x0A, 0x40, 0x19, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 
-    0x22, 0x24, 0x21, 0x72, 0x12, 0x22, 0x00, 0x00, 0x22, 0x17, 0x22, 0x44, 0x44, 0x44, 0x22, 0x22, 
-    0x2C, 0xC4, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x42, 0x22, 0x22, 0x10, 0x91, 0x9A, 0x01, 
-    0x11, 0x11, 0x11, 0x99, 0x19, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x90, 0x00, 0x12, 0x01, 0x90, 0x01, 0xA0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x30, 0x02, 
-    0x30, 0x02, 0x00, 0x00, 0x32, 0x22, 0x00, 0x00, 0x22, 0x37, 0x22, 0x24, 0xCC, 0x42, 0x22, 0x22, 
-    0x2C, 0xC2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x52, 0x22, 0x22, 0x23, 0x21, 0x91, 0x01, 
-    0x01, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x41, 0x00, 0x00, 0x01, 0xAE, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0A, 0x22, 0x20, 0x00, 
-    0x00, 0x22, 0x12, 0x30, 0x0A, 0xAA, 0x22, 0x22, 0x2A, 0x0A, 0x22, 0x24, 0xAA, 0x22, 0x20, 0x0A, 
-    0xAA, 0xAA, 0xAA, 0xCC, 0x20, 0xAA, 0x22, 0x22, 0x40, 0x0A, 0x22, 0x20, 0xE0, 0x22, 0x90, 0x09, 
-    0x30, 0x00, 0x00, 0x09, 0x39, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x10, 0xD6, 0x66, 0xB7, 0x00, 0x3F, 0x6E, 0x02, 0x20, 0x00, 
-    0xF6, 0xB7, 0x93, 0x30, 0xD6, 0x66, 0xBC, 0xAA, 0x2F, 0xD6, 0x02, 0x40, 0xF6, 0xB2, 0x1F, 0xD6, 
-    0x66, 0x66, 0x66, 0xBB, 0x20, 0xD6, 0x02, 0x2B, 0x20, 0xF6, 0xBB, 0x2F, 0xD6, 0xB2, 0x1F, 0x6E, 
-    0x00, 0x30, 0x00, 0xD6, 0xB0, 0x00, 0x0F, 0xD6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x01, 0x90, 0x09, 0x00, 0x0F, 0xEE, 0xEE, 0xB2, 0x33, 0x3F, 0x6E, 0x02, 0x20, 0x00, 
-    0xD6, 0xB7, 0x00, 0x00, 0xDE, 0xEE, 0xBA, 0x22, 0x30, 0xD6, 0x02, 0x40, 0xD6, 0xB2, 0x1F, 0xD6, 
-    0xEE, 0xEE, 0xEE, 0xBC, 0x2F, 0xD6, 0xBA, 0x20, 0x20, 0xF6, 0xBB, 0x40, 0xD6, 0x00, 0x2F, 0x6E, 
-    0xB9, 0x00, 0x00, 0xD6, 0xB0, 0x00, 0x00, 0xEE, 0xEE, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x40, 0x01, 0x10, 0x09, 0x0F, 0xD0, 0x00, 0x00, 0xD6, 0xB7, 0x0F, 0x6E, 0x00, 0x00, 0x00, 
-    0xF6, 0xB7, 0x0F, 0xD6, 0x07, 0x30, 0xD6, 0xB7, 0x00, 0xD6, 0x02, 0xAE, 0xEA, 0xB2, 0x1F, 0xD6, 
-    0x07, 0x22, 0x22, 0x22, 0x2F, 0xD6, 0x66, 0xBB, 0x20, 0xF6, 0xBB, 0x50, 0xD6, 0x02, 0xAF, 0x66, 
-    0x6E, 0x00, 0x00, 0xD6, 0xB0, 0x0F, 0x6E, 0x00, 0x00, 0xD6, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0xD6, 0xB7, 0x0F, 0x6E, 0x00, 0x00, 0x00, 
-    0xF6, 0xB7, 0x00, 0xD0, 0x00, 0x00, 0xF6, 0xB7, 0x00, 0xD6, 0x00, 0xD6, 0xB7, 0x22, 0x2F, 0xD0, 
-    0x07, 0x22, 0x22, 0x22, 0x2F, 0xD6, 0xEE, 0xB0, 0x20, 0xF6, 0xBB, 0x40, 0xD6, 0x02, 0x1F, 0x66, 
-    0xEE, 0xB9, 0x00, 0xD6, 0xB0, 0x0F, 0x6E, 0x00, 0x00, 0xD0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x09, 0x91, 0x3F, 0x60, 0xB0, 0x00, 0xD6, 0xB7, 0x0F, 0x6E, 0x00, 0xD6, 0x00, 
-    0xD6, 0xB7, 0x00, 0xD6, 0xB0, 0x00, 0xD6, 0xB7, 0x00, 0xD6, 0xB0, 0xEE, 0xB2, 0x21, 0xC0, 0xD6, 
-    0xBA, 0xAA, 0x22, 0x22, 0x2F, 0xD6, 0x00, 0xD6, 0xB0, 0xF6, 0xBB, 0x2F, 0xD6, 0x02, 0x0F, 0x6E, 
-    0x00, 0xD6, 0x00, 0xD6, 0xB0, 0x0F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x09, 0x90, 0x01, 0x54, 0x1F, 0xD6, 0x66, 0x66, 0x66, 0xB7, 0x0F, 0x6E, 0x00, 0xD6, 0x00, 
-    0xD6, 0xB7, 0x00, 0xD6, 0x66, 0x66, 0x66, 0xB7, 0x00, 0xD6, 0x66, 0x07, 0x22, 0x22, 0x2F, 0xD6, 
-    0x66, 0x66, 0xB7, 0x22, 0x2F, 0xD6, 0x00, 0xD6, 0xB0, 0xD6, 0xBB, 0x20, 0xD6, 0xB1, 0x1F, 0x6E, 
-    0x00, 0xDE, 0x00, 0xD6, 0xB0, 0x0F, 0x6E, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x00, 0x91, 0xA2, 0x3F, 0xD6, 0xEE, 0xEE, 0x66, 0xB7, 0x0F, 0x6E, 0x00, 0xD6, 0x00, 
-    0xF6, 0xB7, 0x00, 0xD6, 0xEE, 0xEE, 0x66, 0xB7, 0x30, 0xD6, 0xEE, 0xB2, 0x22, 0x22, 0x10, 0xD6, 
-    0xEE, 0xEE, 0xB7, 0x22, 0x2F, 0xD0, 0x02, 0x20, 0xD6, 0x66, 0xBB, 0x2F, 0xD6, 0xB0, 0x9F, 0x6E, 
-    0x00, 0x00, 0xD6, 0x66, 0xB0, 0x0F, 0x6E, 0x00, 0xD6, 0x66, 0xB0, 0x00, 0x09, 0x99, 0x11, 0x99, 
-    0x00, 0x00, 0x00, 0x01, 0x09, 0x3F, 0x6E, 0x02, 0x30, 0xD6, 0xB7, 0x0F, 0x60, 0xB0, 0xEE, 0xB0, 
-    0xD6, 0xB7, 0x90, 0xD6, 0x02, 0x20, 0xD6, 0xB2, 0x10, 0xD6, 0x00, 0xD6, 0xB7, 0x22, 0x3F, 0xD6, 
-    0x02, 0x22, 0x22, 0x22, 0x2F, 0xD0, 0x02, 0x20, 0xD6, 0x66, 0xBB, 0x20, 0xD6, 0xB3, 0xAF, 0x6E, 
-    0x09, 0x00, 0xD0, 0x66, 0xB0, 0x0F, 0x6E, 0x00, 0xD0, 0x66, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x6E, 0x00, 0x00, 0xD6, 0xB7, 0x0F, 0xD6, 0x66, 0x00, 0xD6, 
-    0x66, 0xB7, 0x1F, 0xD0, 0x00, 0x10, 0xD6, 0xB2, 0x10, 0xD6, 0x00, 0xD6, 0xB2, 0x22, 0x2F, 0xD0, 
-    0x03, 0x77, 0x22, 0x22, 0x2F, 0xD0, 0x02, 0x22, 0x20, 0xD6, 0xBB, 0x2F, 0xD6, 0x02, 0x2F, 0x6E, 
-    0x09, 0x09, 0x90, 0xD6, 0xB0, 0x0F, 0x6E, 0x00, 0x30, 0xD6, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0xD6, 0xB7, 0x0F, 0xD6, 0xEE, 0x00, 0xDE, 
-    0x66, 0xB7, 0x00, 0xD0, 0x00, 0x30, 0xD6, 0xB7, 0x20, 0xD0, 0x00, 0x30, 0xD6, 0xB7, 0x0F, 0xD0, 
-    0xB0, 0x2A, 0xA2, 0x22, 0x2F, 0xD0, 0x02, 0x22, 0x20, 0xF6, 0xBB, 0x2F, 0xD6, 0x04, 0x1F, 0x6E, 
-    0x09, 0x19, 0x00, 0xD6, 0xB0, 0x90, 0x6E, 0xB9, 0x00, 0xD0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x60, 0x00, 0x30, 0xD6, 0xB7, 0x0F, 0x6E, 0x03, 0x70, 0x00, 
-    0xF6, 0xB7, 0x00, 0xD6, 0x00, 0x30, 0xF6, 0xB7, 0x30, 0xD6, 0x00, 0x30, 0xF6, 0xB7, 0x0F, 0xD6, 
-    0x66, 0x66, 0x66, 0xB7, 0x2F, 0xD6, 0x02, 0x22, 0xC0, 0xF6, 0xBB, 0x20, 0xD6, 0x00, 0x1F, 0x6E, 
-    0x09, 0x19, 0x00, 0xD6, 0xB3, 0x90, 0x00, 0xD6, 0x66, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xDE, 0x00, 0x10, 0xD6, 0xB7, 0x00, 0xDE, 0x00, 0x00, 0x00, 
-    0xD6, 0xB7, 0x00, 0xDE, 0x00, 0x30, 0xD6, 0xB7, 0x00, 0xDE, 0x00, 0x00, 0xD6, 0xB7, 0x10, 0xDE, 
-    0xEE, 0x0E, 0xE6, 0xB0, 0x20, 0xDE, 0x02, 0x24, 0x4A, 0xD6, 0xBC, 0x20, 0xD0, 0x01, 0x0F, 0x6A, 
-    0x01, 0x19, 0x00, 0xD0, 0xB1, 0x19, 0x00, 0xD0, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x12, 0x21, 0x20, 0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x00, 
-    0x07, 0x27, 0x01, 0x27, 0x70, 0x00, 0x07, 0x73, 0x00, 0x27, 0x73, 0x70, 0x32, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x2B, 0xB2, 0x24, 0x40, 0x4C, 0xC4, 0x22, 0x24, 0xC1, 0x00, 0x92, 
-    0x21, 0x99, 0x00, 0x13, 0x20, 0x49, 0x09, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x29, 0x92, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x30, 0x22, 0xA2, 0x22, 0x22, 
-    0x22, 0x22, 0x20, 0x72, 0x22, 0x22, 0x22, 0x40, 0x00, 0x01, 0x01, 0x1C, 0x44, 0x42, 0x00, 0x01, 
-    0x11, 0x19, 0x99, 0x11, 0x00, 0x00, 0x91, 0x11, 0x91, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0x03, 0x22, 0x22, 0x22, 0x33, 0x22, 0x03, 0x03, 0x12, 0x22, 0x12, 0x22, 0x22, 0x24, 0x20, 0x22, 
-    0x22, 0x37, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x01, 0x19, 0x2A, 0x10, 0x01, 0x91, 0x11, 0x99, 0x99, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0x23, 0x22, 0x00, 0x33, 0x23, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x00, 0x23, 0x00, 0x01, 0x11, 0x11, 0x12, 0x22, 0x11, 0x22, 0x22, 0x22, 
-    0x22, 0x12, 0x22, 0x22, 0x2C, 0x45, 0x54, 0x00, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x13, 0x00, 
-    0x11, 0x99, 0x24, 0x10, 0x01, 0x90, 0x99, 0x99, 0x19, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 
-    0x02, 0x21, 0x33, 0x12, 0x22, 0x22, 0x22, 0x21, 0x11, 0x1A, 0xAA, 0xAA, 0xA1, 0x22, 0x12, 0x22, 
-    0x22, 0x24, 0x24, 0x55, 0x55, 0x50, 0x04, 0x00, 0x11, 0x33, 0x30, 0x13, 0x00, 0x00, 0x33, 0x30, 
-    0x12, 0x19, 0x24, 0x10, 0x11, 0x10, 0x00, 0x99, 0x19, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x02, 0x20, 0x72, 0x22, 
-    0x12, 0x22, 0x32, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x11, 0x11, 0x19, 0x03, 0x10, 0x00, 0x00, 
-    0x22, 0x22, 0x25, 0x50, 0x00, 0x00, 0x4A, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x33, 0x30, 
-    0x31, 0x19, 0x14, 0x04, 0x01, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x07, 0x77, 0x00, 0x33, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x22, 0x25, 0xA5, 0x50, 0x00, 0x4A, 0x01, 0x11, 0x90, 0x00, 0x00, 0x31, 0x31, 0x00, 0x00, 
-    0x11, 0x00, 0x01, 0x10, 0x11, 0x09, 0x12, 0x1A, 0xAA, 0x40, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x22, 0x25, 0x25, 0xA0, 0x21, 0x44, 0x41, 0x10, 0x00, 0x00, 0x00, 0x33, 0x01, 0x11, 0x12, 
-    0x21, 0x12, 0x21, 0x10, 0xA2, 0xA2, 0x21, 0x22, 0x11, 0x40, 0x11, 0x11, 0x90, 0x09, 0x90, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x24, 0x22, 0x25, 0x25, 0x4C, 0x24, 0x4A, 0x13, 0x30, 0x00, 0x00, 0x00, 0x09, 0x11, 0xAA, 
-    0x44, 0x44, 0x44, 0x44, 0xA2, 0xA2, 0x11, 0x22, 0x11, 0x41, 0x11, 0x11, 0x10, 0x00, 0x11, 0x00, 
-    0x00, 0x00, 0x03, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x2A, 0x42, 0x2A, 0x24, 0x44, 0x44, 0x4A, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 
-    0xAA, 0xAA, 0x22, 0xA4, 0xA2, 0x29, 0x12, 0x22, 0x4A, 0x00, 0x11, 0x10, 0x10, 0x09, 0x11, 0x00, 
-    0x00, 0x03, 0x03, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x4A, 0x44, 0x22, 0xA4, 0x44, 0x44, 0x20, 0x11, 0x22, 0x22, 0x21, 0x11, 0x12, 
-    0xA2, 0xA2, 0x11, 0x1A, 0x20, 0x02, 0xA4, 0xA4, 0x41, 0x10, 0x00, 0x11, 0x00, 0x00, 0x11, 0x91, 
-    0x00, 0x00, 0x00, 0x33, 0x03, 0x00, 0x03, 0x30, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x54, 0x24, 0x44, 0x44, 0x44, 0xC2, 0x44, 0x2A, 0xA2, 0x21, 0x24, 0xAA, 0x22, 0x11, 
-    0x12, 0x21, 0x12, 0x22, 0x10, 0x02, 0x2A, 0xA4, 0x11, 0x00, 0x00, 0x11, 0x99, 0x91, 0x10, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x91, 0x00, 0x00, 
-    0x00, 0x00, 0x4A, 0x92, 0x41, 0x24, 0x42, 0x22, 0x45, 0x4A, 0x24, 0x42, 0x11, 0x12, 0xA4, 0xA2, 
-    0xAA, 0x11, 0x12, 0x11, 0x11, 0x12, 0x4A, 0x2A, 0x2A, 0x01, 0x10, 0x11, 0x99, 0x99, 0x11, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x2A, 0x14, 0x42, 0x4C, 0x12, 0x21, 0x24, 0x41, 0x2A, 0x44, 0xAA, 0x21, 0x11, 0x91, 
-    0x22, 0x11, 0x33, 0x00, 0x01, 0x21, 0x2A, 0xAA, 0x11, 0x00, 0x11, 0x09, 0x09, 0x19, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x30, 0x73, 0x30, 0x77, 0x00, 0x30, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x30, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x0A, 0x22, 0x24, 0x44, 0x2C, 0x41, 0x14, 0x54, 0x44, 0x4A, 0x44, 0x44, 0xA2, 0x22, 
-    0x10, 0x00, 0x00, 0x20, 0x00, 0x11, 0x2A, 0xA0, 0x01, 0x01, 0x11, 0x10, 0x09, 0x99, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0x73, 0x32, 0x77, 0x77, 0x77, 0x73, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 0x77, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0xA0, 0x44, 0x44, 0xA2, 0x22, 0x31, 0xA4, 0x54, 0x54, 0x44, 0x44, 0x44, 0x44, 
-    0xA2, 0x10, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x09, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x03, 
-    0x73, 0x72, 0x37, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 0x22, 0x77, 0x20, 0x00, 0x00, 
-    0x00, 0x30, 0x01, 0x4A, 0x44, 0x44, 0x44, 0x42, 0x21, 0x40, 0xA1, 0x44, 0x44, 0x4A, 0x44, 0x4A, 
-    0x44, 0xA1, 0x19, 0x00, 0x00, 0x00, 0x01, 0x10, 0x11, 0x01, 0x11, 0x00, 0x00, 0x91, 0x01, 0x11, 
-    0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x03, 
-    0x73, 0x37, 0x77, 0x77, 0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 0x22, 0x77, 0x22, 0x00, 0x00, 
-    0x19, 0x20, 0x01, 0x14, 0x44, 0x40, 0x44, 0x41, 0x22, 0xA5, 0x44, 0x44, 0x54, 0x42, 0x22, 0x44, 
-    0xA2, 0x44, 0xAA, 0xA2, 0x19, 0x99, 0x11, 0x31, 0x01, 0x01, 0x11, 0x00, 0x09, 0x91, 0x11, 0x11, 
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x77, 0x37, 0x77, 0x12, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 0x27, 0x77, 0x72, 0x73, 0x01, 
-    0xA1, 0x00, 0x91, 0x11, 0x40, 0x11, 0x04, 0x42, 0x21, 0x22, 0x24, 0x44, 0x45, 0x4A, 0x22, 0x4A, 
-    0xAA, 0x22, 0xAA, 0x4A, 0xAA, 0xAA, 0xA1, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x01, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 
-    0x03, 0x33, 0x33, 0x37, 0x27, 0x72, 0x77, 0x37, 0x77, 0x73, 0x11, 0x37, 0x73, 0x11, 0x77, 0x71, 
-    0x02, 0x11, 0x10, 0x11, 0x40, 0x11, 0x12, 0x22, 0x22, 0x22, 0x00, 0x24, 0x44, 0x40, 0x04, 0x44, 
-    0x44, 0x4A, 0x22, 0x22, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x11, 0x99, 0x00, 0x00, 0x00, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x11, 
-    0x03, 0x33, 0x33, 0x77, 0x32, 0x77, 0x73, 0x33, 0x77, 0x33, 0x12, 0x73, 0x32, 0x22, 0x20, 0x13, 
-    0x14, 0x11, 0x02, 0x11, 0x11, 0x13, 0x11, 0x30, 0x01, 0x22, 0x23, 0x12, 0x45, 0x44, 0x00, 0x04, 
-    0x44, 0x04, 0x04, 0x44, 0x44, 0x4A, 0x0A, 0xA0, 0x00, 0x10, 0x90, 0x00, 0x00, 0x03, 0x01, 0x11, 
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x23, 
-    0x33, 0x30, 0x33, 0x37, 0x79, 0x37, 0x33, 0x03, 0x39, 0x00, 0x32, 0x33, 0x11, 0x12, 0x31, 0x01, 
-    0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x02, 0x22, 0x00, 0x24, 0x44, 0x04, 0x40, 
-    0x00, 0x04, 0x04, 0x40, 0x44, 0x0A, 0x4A, 0x11, 0xAA, 0x11, 0x19, 0x00, 0x00, 0xA0, 0x01, 0x90, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 
-    0x37, 0x33, 0x73, 0x33, 0x72, 0x30, 0x33, 0x03, 0x00, 0x03, 0x33, 0x31, 0x12, 0x13, 0x31, 0xA1, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x10, 0x22, 0x25, 0x44, 0x45, 
-    0x40, 0x04, 0x44, 0x00, 0x04, 0x40, 0x4A, 0x01, 0xA0, 0x0A, 0x01, 0x09, 0x91, 0x40, 0x11, 0x10, 
-    0x10, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x33, 
-    0x72, 0x37, 0x32, 0x23, 0x37, 0x73, 0x00, 0x99, 0x93, 0x30, 0x33, 0x32, 0x2C, 0x10, 0x12, 0x41, 
-    0x1C, 0x00, 0x14, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x22, 0x2A, 0x22, 0x22, 
-    0x24, 0x44, 0x04, 0x00, 0x44, 0x04, 0xA4, 0x04, 0xAA, 0x10, 0x00, 0xAA, 0xA1, 0x00, 0x11, 0x11, 
+const uint8_t STORY_CH1_RLE[STORY_CH1_RLE_SIZE] = {
+    0x02, 0x01, 0x10, 0xC0, 0x00, 0x30, 0xB1, 0xD0, 0x12, 0x22, 0x77, 0x32, 0x12, 0x42, 0x12, 0x11, 
+    0x14, 0x04, 0x40, 0xB0, 0xF8, 0x0C, 0xC0, 0x02, 0x11, 0x00, 0xE1, 0x01, 0x20, 0xA3, 0x18, 0x01, 
+    0x12, 0x13, 0x25, 0x41, 0x10, 0x31, 0x31, 0x10, 0x00, 0x11, 0x10, 0x10, 0xD0, 0x0A, 0x11, 0x30, 
+    0x00, 0x11, 0x01, 0x10, 0xA0, 0x04, 0x11, 0x31, 0x10, 0xC0, 0x18, 0x72, 0x27, 0x33, 0x32, 0x45, 
+    0x4C, 0x40, 0x21, 0x44, 0x04, 0x08, 0x80, 0x00, 0xF8, 0x0F, 0x12, 0x00, 0x40, 0x01, 0x13, 0x13, 
+    0x11, 0x31, 0x31, 0x33, 0x30, 0xD1, 0x00, 0x30, 0xA1, 0x01, 0x33, 0xD1, 0x0E, 0x00, 0x11, 0x33, 
+    0x31, 0x22, 0x02, 0x00, 0x00, 0x42, 0x06, 0x01, 0x11, 0x01, 0x00, 0xC1, 0x00, 0x30, 0xB0, 0x14, 
+    0x32, 0x70, 0x03, 0x32, 0x24, 0x45, 0x08, 0x54, 0x22, 0x14, 0x00, 0xD8, 0xA0, 0xF8, 0x07, 0x03, 
+    0x00, 0x04, 0xB1, 0x44, 0x14, 0x31, 0x31, 0x11, 0x32, 0x82, 0x21, 0x10, 0x11, 0x03, 0x03, 0x20, 
+    0xC1, 0x07, 0x31, 0x30, 0x01, 0x30, 0x45, 0xA0, 0x0C, 0x13, 0x00, 0x01, 0x03, 0x31, 0x01, 0x10, 
+    0xD0, 0x1F, 0x30, 0x00, 0x31, 0x22, 0x12, 0x88, 0x55, 0x52, 0x11, 0x44, 0x08, 0x00, 0x88, 0x00, 
+    0x05, 0x50, 0x50, 0x02, 0x00, 0x00, 0xE1, 0xB3, 0x07, 0x11, 0x15, 0x52, 0x42, 0xB1, 0x06, 0x03, 
+    0x42, 0x11, 0x30, 0x43, 0x08, 0x11, 0x13, 0x11, 0x22, 0x90, 0x47, 0x18, 0x10, 0x13, 0x30, 0x30, 
+    0x00, 0x33, 0x00, 0x30, 0x03, 0x33, 0x23, 0x30, 0x30, 0xA2, 0x14, 0x40, 0x45, 0x21, 0x04, 0x04, 
+    0x55, 0x08, 0x88, 0x05, 0x55, 0x00, 0xF8, 0x06, 0x05, 0x00, 0x14, 0x04, 0x46, 0x14, 0x21, 0x13, 
+    0x01, 0x22, 0x44, 0x21, 0x22, 0x13, 0x00, 0x12, 0x00, 0xA1, 0x03, 0x31, 0x03, 0xC1, 0x04, 0x01, 
+    0x11, 0x90, 0xE0, 0x08, 0x11, 0x00, 0x33, 0x30, 0x10, 0xC0, 0x01, 0x13, 0x43, 0x1A, 0x13, 0x00, 
+    0x32, 0x22, 0xC4, 0x21, 0x2C, 0x10, 0x05, 0x55, 0x80, 0x88, 0x85, 0xC0, 0x51, 0x01, 0x01, 0xA0, 
+    0x03, 0x11, 0x00, 0xB1, 0x15, 0x30, 0x1C, 0x12, 0x52, 0x01, 0x21, 0x10, 0x1A, 0x00, 0x01, 0x13, 
+    0xA0, 0x03, 0x32, 0x02, 0xA1, 0x00, 0x90, 0xF0, 0x01, 0x0B, 0x31, 0x11, 0x00, 0x01, 0x33, 0x11, 
+    0xE0, 0x04, 0x32, 0x22, 0x00, 0xA3, 0x08, 0x14, 0x22, 0x21, 0x22, 0x40, 0xB5, 0xA8, 0x08, 0x5C, 
+    0x58, 0x00, 0x05, 0x50, 0xF8, 0x00, 0x19, 0x00, 0x04, 0x00, 0x11, 0x40, 0x11, 0x12, 0x22, 0xC4, 
+    0x13, 0x21, 0x42, 0x10, 0xE1, 0x18, 0x00, 0x13, 0x00, 0x33, 0x03, 0x01, 0x32, 0x21, 0x11, 0x24, 
+    0x20, 0x00, 0x30, 0xA0, 0x01, 0x14, 0x43, 0x2A, 0x00, 0x10, 0x03, 0x20, 0x11, 0x30, 0x03, 0x32, 
+    0x33, 0x00, 0x33, 0x22, 0x11, 0x32, 0x2C, 0x22, 0x45, 0xC5, 0x85, 0x00, 0x5C, 0x00, 0xC5, 0xF8, 
+    0x00, 0x06, 0x58, 0x85, 0x54, 0x00, 0xE1, 0x26, 0x20, 0x52, 0x12, 0x22, 0x10, 0x01, 0xC2, 0x11, 
+    0x13, 0x00, 0x91, 0x03, 0x00, 0x02, 0x21, 0x21, 0x21, 0x30, 0x1A, 0x00, 0x43, 0x00, 0x30, 0x42, 
+    0x02, 0x11, 0x30, 0xC0, 0x01, 0x10, 0xB1, 0xF0, 0x02, 0x09, 0x32, 0x27, 0x33, 0x32, 0x22, 0xAC, 
+    0x06, 0x58, 0x05, 0x55, 0x00, 0x4D, 0x09, 0x00, 0x85, 0x05, 0x54, 0x44, 0xE1, 0x0B, 0x2C, 0x14, 
+    0x41, 0x31, 0x21, 0x14, 0xB1, 0x02, 0x01, 0x10, 0xA0, 0x24, 0x20, 0x22, 0x21, 0x10, 0x00, 0x20, 
+    0x02, 0x77, 0x71, 0x30, 0x02, 0x12, 0x10, 0x30, 0x33, 0x00, 0x30, 0x00, 0x30, 0xA1, 0x4A, 0xA3, 
+    0x05, 0x22, 0x45, 0x54, 0x42, 0x03, 0x44, 0x08, 0x45, 0x01, 0x00, 0xB8, 0x17, 0x05, 0x05, 0x50, 
+    0x05, 0x44, 0x01, 0x12, 0x12, 0x10, 0x11, 0x44, 0x41, 0x44, 0x06, 0x13, 0x01, 0x11, 0x90, 0xF0, 
+    0x01, 0x00, 0x90, 0xA0, 0x08, 0x14, 0x44, 0x27, 0x22, 0x20, 0xA3, 0x06, 0x10, 0x30, 0x03, 0x30, 
+    0xE0, 0x04, 0x31, 0x41, 0x30, 0xA0, 0x0F, 0x30, 0x30, 0x33, 0x23, 0x00, 0x72, 0x24, 0x00, 0x43, 
+    0x01, 0x5C, 0xF5, 0x02, 0x47, 0x11, 0x05, 0x55, 0x40, 0x10, 0x00, 0x1C, 0x00, 0x14, 0x44, 0xE1, 
+    0x06, 0x30, 0x01, 0x91, 0x10, 0xF0, 0x06, 0x0E, 0x12, 0x02, 0x27, 0x72, 0x22, 0x31, 0x13, 0x30, 
+    0xF0, 0x05, 0x07, 0x11, 0x21, 0x00, 0x01, 0x44, 0x13, 0x00, 0x70, 0x31, 0x24, 0x44, 0x5C, 0xCB, 
+    0x55, 0xCC, 0x40, 0xD5, 0xB8, 0x01, 0x00, 0xA5, 0xC4, 0x0B, 0x14, 0x00, 0x14, 0x45, 0x41, 0x00, 
+    0xD1, 0x01, 0x03, 0xA0, 0x01, 0x11, 0xF0, 0x08, 0x0B, 0x72, 0x22, 0x72, 0x70, 0x12, 0x11, 0xD0, 
+    0x01, 0x33, 0xA0, 0x0A, 0x30, 0x11, 0x30, 0x00, 0x31, 0x30, 0xC0, 0x05, 0x33, 0x31, 0x2C, 0x42, 
+    0x02, 0xBC, 0x40, 0x42, 0xB5, 0x01, 0xC5, 0xC8, 0x45, 0x05, 0x01, 0x04, 0x00, 0xB4, 0x05, 0x14, 
+    0x41, 0x4C, 0xB1, 0x08, 0x33, 0x13, 0x31, 0x11, 0x00, 0x50, 0x0C, 0x00, 0x07, 0xB2, 0x70, 0x00, 
+    0x11, 0x30, 0x45, 0xD0, 0xA1, 0x05, 0x00, 0x03, 0x11, 0xC0, 0x43, 0x13, 0x14, 0x45, 0x05, 0x44, 
+    0x55, 0x54, 0x45, 0x55, 0x25, 0x00, 0xB8, 0x43, 0x06, 0x54, 0x00, 0x40, 0x10, 0x44, 0x04, 0xC5, 
+    0x44, 0x00, 0xD1, 0x01, 0x33, 0xA1, 0x02, 0x00, 0x10, 0xF0, 0x11, 0x01, 0x11, 0xD0, 0x03, 0x10, 
+    0x03, 0xA0, 0x01, 0x30, 0x46, 0x01, 0x33, 0x43, 0x10, 0x11, 0xC1, 0x1C, 0xC5, 0x55, 0x44, 0x45, 
+    0x5C, 0xC0, 0xC5, 0xC8, 0x45, 0x0A, 0x40, 0x00, 0x14, 0x01, 0x40, 0x20, 0xA4, 0xF1, 0x04, 0x04, 
+    0x90, 0x09, 0x90, 0xF0, 0x10, 0x02, 0x30, 0x30, 0xC0, 0x1F, 0x30, 0x02, 0x10, 0x01, 0x30, 0x01, 
+    0x11, 0x30, 0x00, 0x37, 0x33, 0x30, 0x32, 0x12, 0xCC, 0x22, 0xAC, 0x11, 0x54, 0x45, 0xCB, 0x55, 
+    0x52, 0x25, 0x55, 0x88, 0x80, 0xE5, 0xB4, 0x06, 0x10, 0x4C, 0x24, 0xC0, 0xD1, 0x00, 0x30, 0xA1, 
+    0x00, 0x40, 0x43, 0x02, 0x00, 0x90, 0xF0, 0x0F, 0x01, 0x22, 0x45, 0x0D, 0x00, 0x01, 0x10, 0x03, 
+    0x30, 0x12, 0x12, 0xD0, 0x05, 0x33, 0x00, 0x03, 0x45, 0x06, 0x2C, 0x55, 0x44, 0xC0, 0xF5, 0x00, 
+    0x05, 0x08, 0x05, 0x50, 0xB5, 0x0F, 0xB4, 0x42, 0x24, 0x41, 0xC4, 0x41, 0x11, 0x00, 0xF1, 0x01, 
+    0x06, 0x9A, 0x10, 0x00, 0x90, 0x62, 0x01, 0x33, 0xC0, 0x01, 0x31, 0xF0, 0x03, 0x01, 0x31, 0xC2, 
+    0x07, 0xC4, 0x5C, 0x44, 0xC4, 0xF5, 0x0B, 0x21, 0xBC, 0xC4, 0x11, 0x24, 0x00, 0x44, 0x10, 0x04, 
+    0x22, 0x12, 0x22, 0x13, 0x11, 0x9A, 0xAA, 0x90, 0x11, 0xF0, 0x0E, 0x06, 0x20, 0x12, 0x23, 0x20, 
+    0x45, 0xF0, 0x01, 0x02, 0x32, 0x30, 0xE0, 0xE2, 0x06, 0xCC, 0x4C, 0x44, 0x50, 0x53, 0x0D, 0xCB, 
+    0xB0, 0x4C, 0x24, 0x01, 0x0C, 0x44, 0xA0, 0x02, 0x11, 0x20, 0xC1, 0x02, 0xA9, 0x90, 0xB0, 0x01, 
+    0x13, 0xF0, 0x0E, 0x07, 0x21, 0x23, 0x33, 0x13, 0xF0, 0x0E, 0x05, 0x32, 0x22, 0x44, 0xC2, 0x04, 
+    0xCC, 0x55, 0xC0, 0xB5, 0x0A, 0xBC, 0x55, 0x50, 0x00, 0x55, 0x00, 0x43, 0x02, 0xCC, 0xB0, 0xAC, 
+    0x12, 0x40, 0x12, 0xC0, 0x44, 0x40, 0x00, 0x11, 0x10, 0x19, 0x90, 0xE0, 0x00, 0x90, 0xF0, 0x0F, 
+    0x06, 0x21, 0x21, 0x32, 0x10, 0xF0, 0x0A, 0x00, 0x30, 0xA0, 0x04, 0x12, 0x22, 0xC0, 0x45, 0x0B, 
+    0x2C, 0xC0, 0x05, 0x50, 0x50, 0x00, 0xB5, 0x00, 0x00, 0xA5, 0x04, 0x05, 0x55, 0xC0, 0xC0, 0x09, 
+    0xAA, 0xA1, 0x12, 0xCC, 0x44, 0x43, 0x02, 0x19, 0x90, 0xA0, 0x00, 0x90, 0xC0, 0x02, 0x90, 0x30, 
+    0xF0, 0x0B, 0x0B, 0x12, 0x22, 0x30, 0x01, 0x30, 0x03, 0xF0, 0x0B, 0x04, 0x31, 0x11, 0xC0, 0xF2, 
+    0x00, 0x01, 0x0D, 0xD6, 0x10, 0xBB, 0x50, 0x6E, 0x05, 0x00, 0xD6, 0xB5, 0x40, 0xD0, 0xD6, 0x07, 
+    0xBC, 0x22, 0xC4, 0xC4, 0x43, 0x00, 0x10, 0xF0, 0x00, 0x04, 0x91, 0x00, 0x10, 0xF0, 0x0D, 0x0D, 
+    0x22, 0x00, 0x11, 0x01, 0x00, 0x03, 0x33, 0xB0, 0x01, 0x33, 0xF0, 0x02, 0x02, 0x11, 0x10, 0xA2, 
+    0x01, 0x55, 0xA2, 0x00, 0xF0, 0xE6, 0x4B, 0x02, 0x05, 0x00, 0xE6, 0x0C, 0xBB, 0x22, 0xBC, 0xC5, 
+    0x41, 0x11, 0x90, 0xC0, 0xB9, 0x04, 0x11, 0x01, 0x10, 0xF0, 0x0C, 0x01, 0x30, 0xC1, 0x08, 0x03, 
+    0x10, 0x31, 0x00, 0x30, 0xF0, 0x06, 0x12, 0x33, 0x1C, 0x22, 0x4C, 0x22, 0x24, 0x4A, 0x25, 0x0D, 
+    0x60, 0xAB, 0x00, 0x50, 0x44, 0x00, 0x50, 0x46, 0x03, 0xEB, 0x55, 0xAB, 0x0A, 0x22, 0xCB, 0xCC, 
+    0xC4, 0x40, 0x10, 0xF0, 0x05, 0x03, 0x91, 0x19, 0xF0, 0x0B, 0x02, 0x11, 0x00, 0xA1, 0x05, 0x00, 
+    0x11, 0x01, 0xE0, 0x00, 0x30, 0xF0, 0x02, 0x00, 0x10, 0x47, 0x0B, 0x2A, 0x22, 0x40, 0xD6, 0x0B, 
+    0x25, 0x45, 0x00, 0x00, 0x47, 0x06, 0x05, 0x55, 0xBC, 0x20, 0xAC, 0xB2, 0x01, 0x19, 0xF0, 0x04, 
+    0x05, 0x90, 0x01, 0x13, 0xF0, 0x09, 0x02, 0x14, 0x00, 0xB1, 0x0A, 0x00, 0x03, 0x31, 0x31, 0x10, 
+    0x30, 0x42, 0x01, 0x31, 0xD0, 0x03, 0x33, 0x2C, 0xA2, 0x43, 0x04, 0x22, 0x44, 0xF0, 0x43, 0x00, 
+    0xC0, 0x45, 0x00, 0x50, 0x42, 0x00, 0x50, 0x46, 0x01, 0x5B, 0xBC, 0xB2, 0x00, 0xA0, 0x46, 0x00, 
+    0x90, 0xC0, 0x03, 0x10, 0x11, 0xF0, 0x0A, 0x03, 0x90, 0x00, 0x44, 0x11, 0x30, 0x03, 0x13, 0x00, 
+    0x33, 0x00, 0x31, 0x10, 0x33, 0xB0, 0x01, 0x31, 0xD2, 0x00, 0x70, 0x43, 0x00, 0x20, 0x43, 0x01, 
+    0x52, 0x42, 0x00, 0x60, 0xAD, 0x10, 0x66, 0xBB, 0x20, 0x66, 0xDD, 0xD6, 0xB5, 0xCC, 0xC0, 0xC2, 
+    0x05, 0x44, 0x90, 0x01, 0xF0, 0x03, 0x00, 0x10, 0x53, 0x00, 0x00, 0xB1, 0x07, 0x30, 0x03, 0x30, 
+    0x00, 0xA1, 0x0A, 0x30, 0x03, 0x31, 0x30, 0x32, 0x10, 0xB0, 0x43, 0x00, 0x50, 0xE2, 0x08, 0xC0, 
+    0xD6, 0xBC, 0x42, 0xC0, 0x42, 0xC6, 0x03, 0xBB, 0x40, 0xC6, 0x10, 0x05, 0x5C, 0xCC, 0x22, 0x2A, 
+    0x2A, 0x00, 0x01, 0x20, 0xA0, 0x00, 0x30, 0xE0, 0x59, 0x22, 0x10, 0x03, 0x11, 0x31, 0x12, 0x11, 
+    0x33, 0x30, 0x00, 0x31, 0x11, 0x23, 0x13, 0x00, 0x31, 0x22, 0x50, 0x40, 0xE2, 0x05, 0xFD, 0x6B, 
+    0x22, 0x43, 0x05, 0xEB, 0xCC, 0x0D, 0x44, 0x05, 0xEB, 0x55, 0x5B, 0x45, 0x07, 0xA2, 0x21, 0x10, 
+    0x02, 0x43, 0x01, 0x99, 0xA0, 0x05, 0x10, 0x09, 0x11, 0xF0, 0x0B, 0xA1, 0xA0, 0x0B, 0x31, 0x11, 
+    0x21, 0x91, 0x30, 0x00, 0xD1, 0x0A, 0x33, 0x31, 0x02, 0x22, 0x45, 0x40, 0x43, 0x00, 0x10, 0x48, 
+    0x06, 0x2C, 0xF6, 0xE0, 0x40, 0x48, 0x01, 0x0C, 0xD5, 0x00, 0x40, 0x43, 0x02, 0x99, 0x90, 0x46, 
+    0x09, 0x19, 0x00, 0x11, 0x00, 0x11, 0xF0, 0x0C, 0x04, 0x11, 0x10, 0x10, 0xC0, 0x1C, 0x31, 0x03, 
+    0x24, 0x13, 0x11, 0x12, 0x23, 0x33, 0x12, 0x12, 0x12, 0x2A, 0x4A, 0x42, 0x30, 0xC2, 0x01, 0x10, 
+    0x4B, 0x00, 0x40, 0x42, 0x01, 0xCC, 0x42, 0x04, 0x00, 0x50, 0x00, 0xA4, 0xB2, 0x08, 0x01, 0x90, 
+    0x21, 0x00, 0x00, 0xA9, 0x4C, 0x00, 0x90, 0xF0, 0x06, 0x02, 0x10, 0x90, 0x45, 0x03, 0x00, 0x03, 
+    0xD1, 0x07, 0x22, 0x27, 0x02, 0x21, 0xA2, 0x06, 0x44, 0x42, 0x22, 0x30, 0xB2, 0x00, 0x30, 0x42, 
+    0x05, 0xCA, 0x42, 0x40, 0x48, 0x04, 0x20, 0x66, 0xE0, 0xBD, 0x03, 0xBB, 0x55, 0xA2, 0x16, 0x10, 
+    0x20, 0x01, 0x11, 0x00, 0x91, 0x19, 0x00, 0x01, 0x00, 0x0A, 0x10, 0xB0, 0x01, 0x11, 0xF0, 0x07, 
+    0x00, 0x10, 0xA0, 0x02, 0x11, 0x10, 0xA0, 0x18, 0x11, 0x10, 0x13, 0x02, 0x77, 0x27, 0x32, 0x31, 
+    0x2A, 0x44, 0x42, 0x12, 0x10, 0xD2, 0x0D, 0x0D, 0x60, 0xC4, 0x44, 0x0F, 0x6E, 0x02, 0x45, 0x00, 
+    0xF0, 0xE6, 0x44, 0x11, 0xA1, 0x90, 0x19, 0x0A, 0x41, 0x10, 0x11, 0x10, 0x99, 0x43, 0x00, 0x10, 
+    0x44, 0xF0, 0x08, 0x00, 0x10, 0x43, 0x03, 0xAA, 0x01, 0x42, 0xD0, 0xB7, 0x0C, 0x21, 0x2A, 0x44, 
+    0x42, 0x21, 0x22, 0x20, 0xA0, 0xB2, 0x1E, 0xB4, 0x44, 0x00, 0x4A, 0xCC, 0x2C, 0x2A, 0x4B, 0xC2, 
+    0x2A, 0x22, 0x5A, 0x22, 0x0B, 0x55, 0x40, 0x42, 0x08, 0x00, 0x99, 0x0A, 0x00, 0x10, 0xB0, 0x02, 
+    0x11, 0x10, 0xA0, 0x00, 0x20, 0x56, 0x00, 0x90, 0x43, 0x03, 0x40, 0x19, 0x48, 0xA0, 0x00, 0x30, 
+    0xA2, 0x03, 0x42, 0x17, 0x49, 0x03, 0x17, 0x22, 0xC4, 0xB2, 0x04, 0xCC, 0x44, 0x40, 0xF2, 0x01, 
+    0x02, 0x55, 0x40, 0xB2, 0x06, 0x10, 0x91, 0x9A, 0x00, 0xD1, 0x03, 0x99, 0x19, 0x43, 0x00, 0x10, 
+    0xF0, 0x07, 0x0E, 0x90, 0x00, 0x12, 0x01, 0x90, 0x01, 0xA0, 0x10, 0xF0, 0x00, 0x0B, 0x33, 0x11, 
+    0x30, 0x02, 0x30, 0x02, 0xA0, 0x00, 0x30, 0x47, 0x08, 0x37, 0x22, 0x24, 0xCC, 0x40, 0xC2, 0x01, 
+    0xCC, 0xF2, 0x04, 0x02, 0x55, 0x50, 0xC2, 0x0C, 0x32, 0x19, 0x10, 0x10, 0x11, 0x00, 0x30, 0xE0, 
+    0x02, 0x11, 0x30, 0xF0, 0x09, 0x02, 0x14, 0x10, 0xB0, 0x02, 0x1A, 0xE0, 0xA0, 0x00, 0x70, 0xC0, 
+    0x03, 0xA2, 0x22, 0xB0, 0x09, 0x22, 0x12, 0x30, 0x0A, 0xAA, 0xB2, 0x02, 0xA0, 0xA0, 0x42, 0x06, 
+    0xAA, 0x22, 0x20, 0x00, 0xDA, 0x05, 0xCC, 0x20, 0xAA, 0xA2, 0x10, 0x40, 0x0A, 0x22, 0x20, 0xE0, 
+    0x22, 0x90, 0x09, 0x30, 0xC0, 0x02, 0x93, 0x90, 0xD0, 0x00, 0x90, 0xF0, 0x07, 0x02, 0x14, 0x10, 
+    0xD0, 0x0E, 0x10, 0xD6, 0x66, 0xB7, 0x00, 0x3F, 0x6E, 0x00, 0x43, 0x1E, 0xF6, 0xB7, 0x93, 0x30, 
+    0xD6, 0x66, 0xBC, 0xAA, 0x2F, 0xD6, 0x02, 0x40, 0xF6, 0xB2, 0x1F, 0xD0, 0xD6, 0x22, 0xBB, 0x20, 
+    0xD6, 0x02, 0x2B, 0x20, 0xF6, 0xBB, 0x2F, 0xD6, 0xB2, 0x1F, 0x6E, 0x00, 0x30, 0x00, 0xD6, 0xB0, 
+    0xA0, 0x04, 0xFD, 0x66, 0x60, 0x4F, 0x0A, 0x10, 0x19, 0x00, 0x90, 0x00, 0xF0, 0xAE, 0x03, 0xB2, 
+    0x33, 0x48, 0x03, 0xD6, 0xB7, 0xA0, 0x09, 0xDE, 0xEE, 0xBA, 0x22, 0x30, 0x44, 0x00, 0xD0, 0x45, 
+    0xCE, 0x09, 0xBC, 0x2F, 0xD6, 0xBA, 0x20, 0x44, 0x0B, 0x40, 0xD6, 0x00, 0x2F, 0x6E, 0xB9, 0xA0, 
+    0x45, 0x00, 0x00, 0xAE, 0x01, 0xB9, 0xF0, 0x04, 0x05, 0x24, 0x00, 0x11, 0x42, 0x01, 0xFD, 0xB0, 
+    0x04, 0xD6, 0xB7, 0x00, 0x42, 0xB0, 0x00, 0xF0, 0x42, 0x0B, 0xFD, 0x60, 0x73, 0x0D, 0x6B, 0x70, 
+    0x43, 0x03, 0xAE, 0xEA, 0x44, 0x01, 0x07, 0xD2, 0x06, 0xFD, 0x66, 0x6B, 0xB0, 0x44, 0x00, 0x50, 
+    0x42, 0x06, 0x2A, 0xF6, 0x66, 0xE0, 0x47, 0x02, 0xF6, 0xE0, 0xA0, 0x02, 0xD6, 0xB0, 0xF0, 0x04, 
+    0x00, 0x10, 0xE0, 0x02, 0xF6, 0xE0, 0x55, 0x01, 0x0D, 0xB0, 0x00, 0xF0, 0x46, 0x0A, 0x0D, 0x6B, 
+    0x72, 0x22, 0xFD, 0x00, 0x4A, 0x03, 0xEE, 0xB0, 0x44, 0x00, 0x40, 0x43, 0x07, 0x1F, 0x66, 0xEE, 
+    0xB9, 0x4D, 0x00, 0x00, 0x4C, 0x0C, 0x00, 0x01, 0x09, 0x91, 0x3F, 0x60, 0xB0, 0x4B, 0x04, 0xD6, 
+    0x00, 0xD0, 0x44, 0x05, 0x6B, 0x00, 0x0D, 0x45, 0x0F, 0xB0, 0xEE, 0xB2, 0x21, 0xC0, 0xD6, 0xBA, 
+    0xAA, 0x46, 0x04, 0x00, 0xD6, 0xB0, 0x43, 0x01, 0x2F, 0x42, 0x07, 0x0F, 0x6E, 0x00, 0xD6, 0x4C, 
+    0xF0, 0x08, 0x09, 0x99, 0x00, 0x15, 0x41, 0xFD, 0xD6, 0x52, 0xC6, 0x44, 0x03, 0x66, 0x07, 0xB2, 
+    0x01, 0xFD, 0xB6, 0x01, 0xB7, 0x4A, 0x00, 0xD0, 0x42, 0x05, 0x0D, 0x6B, 0x11, 0x44, 0x00, 0xE0, 
+    0x49, 0x04, 0x90, 0x90, 0x90, 0xF0, 0x06, 0x0A, 0x10, 0x09, 0x1A, 0x23, 0xFD, 0x60, 0xAE, 0x4C, 
+    0x00, 0xF0, 0x45, 0xAE, 0x42, 0x06, 0x30, 0xD6, 0xEE, 0xB0, 0xB2, 0x03, 0x10, 0xD6, 0xAE, 0x45, 
+    0x07, 0x00, 0x22, 0x0D, 0x66, 0x42, 0x05, 0xFD, 0x6B, 0x09, 0x43, 0x04, 0x00, 0xD6, 0x60, 0x46, 
+    0x05, 0x0D, 0x66, 0x6B, 0xA0, 0x06, 0x99, 0x91, 0x19, 0x90, 0xD0, 0x0B, 0x10, 0x93, 0xF6, 0xE0, 
+    0x23, 0x0D, 0x44, 0x27, 0x0B, 0x0E, 0xEB, 0x0D, 0x6B, 0x79, 0x0D, 0x60, 0x22, 0x0D, 0x6B, 0x21, 
+    0x0D, 0x60, 0x0D, 0x6B, 0x72, 0x23, 0xFD, 0x60, 0xE2, 0x4C, 0x05, 0x0D, 0x6B, 0x3A, 0x42, 0x04, 
+    0x90, 0x0D, 0x00, 0x49, 0x00, 0x00, 0x45, 0xF0, 0x07, 0x00, 0x10, 0x43, 0x01, 0x00, 0x45, 0x12, 
+    0xD6, 0x66, 0x00, 0xD6, 0x66, 0xB7, 0x1F, 0xD0, 0x00, 0x10, 0x4C, 0xA2, 0x06, 0xFD, 0x00, 0x37, 
+    0x70, 0x49, 0x03, 0x22, 0x0D, 0x42, 0x05, 0xFD, 0x60, 0x22, 0x44, 0x03, 0x99, 0x0D, 0x47, 0x02, 
+    0x30, 0xD0, 0x54, 0x01, 0x00, 0x4D, 0x05, 0xEE, 0x00, 0xDE, 0x42, 0x01, 0x00, 0x42, 0x00, 0x30, 
+    0x42, 0x15, 0x72, 0x0D, 0x00, 0x03, 0x0D, 0x6B, 0x70, 0xFD, 0x0B, 0x02, 0xAA, 0x4B, 0x00, 0xF0, 
+    0x46, 0x01, 0x41, 0x43, 0x02, 0x19, 0x00, 0x43, 0x09, 0x90, 0x6E, 0xB9, 0x00, 0xD0, 0x57, 0x03, 
+    0x00, 0x03, 0x45, 0x08, 0x6E, 0x03, 0x70, 0x00, 0xF0, 0x44, 0x00, 0x60, 0x42, 0x07, 0xF6, 0xB7, 
+    0x30, 0xD6, 0x42, 0x00, 0xF0, 0x44, 0xD6, 0x05, 0xB7, 0x2F, 0xD6, 0x42, 0x00, 0xC0, 0x44, 0x04, 
+    0x0D, 0x60, 0x00, 0x4B, 0x0A, 0x39, 0x00, 0x0D, 0x66, 0x6B, 0x70, 0xF0, 0x0D, 0x06, 0x30, 0xDE, 
+    0x00, 0x10, 0x44, 0x02, 0x0D, 0xE0, 0xC0, 0x00, 0xD0, 0x44, 0x00, 0xE0, 0x42, 0x07, 0xD6, 0xB7, 
+    0x00, 0xDE, 0xA0, 0x29, 0xD6, 0xB7, 0x10, 0xDE, 0xEE, 0x0E, 0xE6, 0xB0, 0x20, 0xDE, 0x02, 0x24, 
+    0x4A, 0xD6, 0xBC, 0x20, 0xD0, 0x01, 0x0F, 0x6A, 0x01, 0x43, 0x0C, 0x0B, 0x11, 0x90, 0x0D, 0x00, 
+    0xE0, 0x30, 0xF0, 0x0C, 0x0B, 0x22, 0x01, 0x22, 0x12, 0x00, 0x77, 0xA0, 0x01, 0x77, 0xC0, 0x07, 
+    0x72, 0x70, 0x12, 0x77, 0xA0, 0x0B, 0x77, 0x30, 0x02, 0x77, 0x37, 0x03, 0xF2, 0x09, 0x01, 0xBB, 
+    0x42, 0x1D, 0x04, 0xCC, 0x42, 0x22, 0x4C, 0x10, 0x09, 0x22, 0x19, 0x90, 0x01, 0x32, 0x04, 0x90, 
+    0x91, 0xA2, 0x00, 0x10, 0x55, 0x05, 0x99, 0x21, 0x22, 0xF0, 0x08, 0x03, 0x22, 0x23, 0xF0, 0x03, 
+    0x08, 0x30, 0x32, 0x30, 0x22, 0xA0, 0xF2, 0x01, 0x01, 0x07, 0xD2, 0x00, 0x40, 0xA0, 0x0B, 0x10, 
+    0x11, 0xC4, 0x44, 0x20, 0x00, 0xA1, 0x04, 0x99, 0x91, 0x10, 0xA0, 0x07, 0x91, 0x11, 0x91, 0x12, 
+    0x54, 0x05, 0x11, 0x12, 0x21, 0xF0, 0x06, 0x02, 0x70, 0x30, 0xC2, 0x0C, 0x33, 0x22, 0x03, 0x03, 
+    0x12, 0x22, 0x10, 0xC2, 0x02, 0x42, 0x00, 0xA2, 0x01, 0x37, 0xF2, 0x01, 0x01, 0x40, 0xF1, 0x04, 
+    0xA0, 0x0C, 0x11, 0x92, 0xA1, 0x00, 0x19, 0x11, 0x10, 0xA9, 0x02, 0x10, 0x10, 0xF0, 0x0F, 0x0E, 
+    0x12, 0x00, 0x22, 0x32, 0x20, 0x03, 0x32, 0x30, 0xF2, 0x03, 0x06, 0x00, 0x23, 0x00, 0x00, 0xC1, 
+    0x04, 0x22, 0x21, 0x10, 0xE2, 0x00, 0x10, 0xC2, 0x05, 0xC4, 0x55, 0x40, 0x47, 0x0D, 0x33, 0x00, 
+    0x13, 0x00, 0x11, 0x99, 0x24, 0x43, 0x00, 0x00, 0xA9, 0x03, 0x19, 0x11, 0x57, 0xF0, 0x08, 0x08, 
+    0x23, 0x02, 0x21, 0x33, 0x10, 0xE2, 0xA1, 0xCA, 0x03, 0x12, 0x21, 0xC2, 0x02, 0x42, 0x40, 0xB5, 
+    0x01, 0x00, 0x43, 0x05, 0x33, 0x30, 0x13, 0xA0, 0x06, 0x33, 0x30, 0x12, 0x10, 0x43, 0x05, 0x11, 
+    0x10, 0x00, 0x42, 0x00, 0x90, 0x56, 0x00, 0x30, 0xF0, 0x00, 0x0F, 0x33, 0x00, 0x22, 0x07, 0x22, 
+    0x21, 0x22, 0x23, 0xF2, 0x01, 0x02, 0x00, 0x00, 0xB1, 0x03, 0x90, 0x31, 0xB0, 0xB2, 0x01, 0x55, 
+    0xB0, 0x02, 0x4A, 0x00, 0xA1, 0xE0, 0x00, 0x10, 0x42, 0x0C, 0x31, 0x19, 0x14, 0x04, 0x01, 0x00, 
+    0x00, 0xF1, 0x01, 0xF0, 0x07, 0x09, 0x77, 0x70, 0x03, 0x32, 0x22, 0xF0, 0x00, 0x00, 0x10, 0xF0, 
+    0x0E, 0x01, 0x19, 0xF0, 0x04, 0x00, 0x30, 0x42, 0x02, 0xA5, 0x50, 0x47, 0x00, 0x90, 0xB0, 0x03, 
+    0x31, 0x31, 0xA0, 0x14, 0x11, 0x00, 0x01, 0x10, 0x11, 0x09, 0x12, 0x1A, 0xAA, 0x40, 0x00, 0x4A, 
+    0x01, 0x33, 0xF0, 0x01, 0x01, 0x33, 0xF0, 0x29, 0x00, 0x70, 0x42, 0x0A, 0x25, 0xA0, 0x21, 0x44, 
+    0x41, 0x10, 0xD0, 0x02, 0x33, 0x00, 0xA1, 0x14, 0x22, 0x11, 0x22, 0x11, 0x0A, 0x2A, 0x22, 0x12, 
+    0x21, 0x14, 0x00, 0xA1, 0x04, 0x90, 0x09, 0x90, 0xF0, 0x3C, 0x10, 0x24, 0x22, 0x25, 0x25, 0x4C, 
+    0x24, 0x4A, 0x13, 0x30, 0xE0, 0x04, 0x91, 0x1A, 0xA0, 0xE4, 0x42, 0x00, 0x10, 0x44, 0xC1, 0x04, 
+    0x00, 0x01, 0x10, 0xD0, 0x02, 0x33, 0x10, 0x79, 0x05, 0xA4, 0x22, 0xA2, 0xC4, 0x02, 0xA1, 0x10, 
+    0x47, 0x00, 0x00, 0xA1, 0xAA, 0x17, 0x22, 0xA4, 0xA2, 0x29, 0x12, 0x22, 0x4A, 0x00, 0x11, 0x10, 
+    0x10, 0x09, 0x45, 0x04, 0x30, 0x31, 0x30, 0xF0, 0x02, 0x00, 0x90, 0xF0, 0x0E, 0x00, 0x20, 0xF0, 
+    0x0E, 0x09, 0x20, 0x04, 0xA4, 0x42, 0x2A, 0xB4, 0x03, 0x20, 0x11, 0xB2, 0xA1, 0x18, 0x2A, 0x2A, 
+    0x21, 0x11, 0xA2, 0x00, 0x2A, 0x4A, 0x44, 0x11, 0x00, 0x01, 0x10, 0xA0, 0x03, 0x11, 0x91, 0xC0, 
+    0x0D, 0x33, 0x03, 0x00, 0x03, 0x30, 0x00, 0x91, 0xF0, 0x17, 0x00, 0x10, 0xF0, 0x05, 0x03, 0x15, 
+    0x42, 0xD4, 0x23, 0xC2, 0x44, 0x2A, 0xA2, 0x21, 0x24, 0xAA, 0x22, 0x11, 0x12, 0x21, 0x12, 0x22, 
+    0x10, 0x02, 0x2A, 0xA4, 0x11, 0xA0, 0x08, 0x11, 0x99, 0x91, 0x10, 0x00, 0x45, 0x04, 0x00, 0x30, 
+    0x10, 0xE0, 0x00, 0x90, 0xF0, 0x06, 0x00, 0x70, 0xF0, 0x0A, 0x04, 0x30, 0x09, 0x10, 0xE0, 0x21, 
+    0x4A, 0x92, 0x41, 0x24, 0x42, 0x22, 0x45, 0x4A, 0x24, 0x42, 0x11, 0x12, 0xA4, 0xA2, 0xAA, 0x11, 
+    0x12, 0xB1, 0x09, 0x24, 0xA2, 0xA2, 0xA0, 0x11, 0x44, 0x02, 0x91, 0x10, 0x48, 0x01, 0x03, 0xA0, 
+    0x01, 0x23, 0xF0, 0x04, 0x02, 0x10, 0x20, 0xF0, 0x06, 0xA3, 0x00, 0x70, 0xF0, 0x07, 0x37, 0x2A, 
+    0x14, 0x42, 0x4C, 0x12, 0x21, 0x24, 0x41, 0x2A, 0x44, 0xAA, 0x21, 0x11, 0x91, 0x22, 0x11, 0x33, 
+    0x00, 0x01, 0x21, 0x2A, 0xAA, 0x11, 0x00, 0x11, 0x09, 0x09, 0x19, 0xA1, 0xF0, 0x16, 0x0C, 0x33, 
+    0x07, 0x33, 0x07, 0x70, 0x03, 0x00, 0xF7, 0x03, 0x04, 0x30, 0x00, 0x20, 0xE0, 0x0D, 0xA2, 0x22, 
+    0x44, 0x42, 0xC4, 0x11, 0x45, 0xA4, 0x00, 0xA0, 0xA4, 0x04, 0xA2, 0x22, 0x10, 0xB0, 0x04, 0x20, 
+    0x00, 0x10, 0x42, 0x03, 0x00, 0x10, 0xA1, 0x03, 0x00, 0x99, 0x53, 0x00, 0x10, 0xF0, 0x05, 0x04, 
+    0x77, 0x33, 0x20, 0xD7, 0x00, 0x30, 0xF7, 0x01, 0x04, 0x22, 0x77, 0x20, 0xF0, 0x01, 0x02, 0x1A, 
+    0x00, 0xA4, 0x0A, 0xA2, 0x22, 0x31, 0xA4, 0x54, 0x50, 0xF4, 0x00, 0x02, 0xA2, 0x10, 0xE0, 0x00, 
+    0x30, 0xF1, 0x01, 0xB0, 0x53, 0xF0, 0x03, 0x08, 0x33, 0x03, 0x73, 0x72, 0x30, 0xF7, 0x06, 0xA2, 
+    0x48, 0x05, 0x30, 0x01, 0x4A, 0xD4, 0x06, 0x22, 0x14, 0x0A, 0x10, 0xB4, 0x0A, 0xA4, 0x44, 0xA4, 
+    0x4A, 0x11, 0x90, 0xD0, 0x05, 0x11, 0x01, 0x10, 0x45, 0x02, 0x91, 0x00, 0x45, 0x01, 0x32, 0xF0, 
+    0x0C, 0x02, 0x33, 0x00, 0x42, 0x00, 0x30, 0xB7, 0x00, 0x10, 0x50, 0x00, 0x20, 0xA0, 0x06, 0x19, 
+    0x20, 0x01, 0x10, 0xA4, 0x08, 0x04, 0x44, 0x12, 0x2A, 0x50, 0xA4, 0x18, 0x54, 0x42, 0x22, 0x44, 
+    0xA2, 0x44, 0xAA, 0xA2, 0x19, 0x99, 0x11, 0x31, 0x00, 0x46, 0x01, 0x99, 0xB1, 0xB0, 0x54, 0xC0, 
+    0x03, 0x37, 0x73, 0x42, 0x00, 0x20, 0x4B, 0xA7, 0x19, 0x27, 0x30, 0x1A, 0x10, 0x09, 0x11, 0x14, 
+    0x01, 0x10, 0x44, 0x22, 0x12, 0x22, 0xA4, 0x0D, 0x54, 0xA2, 0x24, 0xAA, 0xA2, 0x2A, 0xA4, 0xCA, 
+    0xC1, 0x00, 0x00, 0x43, 0x01, 0x00, 0xA1, 0xF0, 0x16, 0x02, 0x13, 0x00, 0xC3, 0x07, 0x72, 0x77, 
+    0x27, 0x73, 0xA7, 0x12, 0x31, 0x13, 0x77, 0x31, 0x17, 0x77, 0x10, 0x21, 0x11, 0x00, 0x44, 0x00, 
+    0x10, 0xD2, 0x02, 0x00, 0x20, 0xA4, 0x01, 0x00, 0xC4, 0x00, 0xA0, 0xA2, 0xCA, 0xA0, 0x03, 0x11, 
+    0x99, 0xC0, 0xB1, 0xF0, 0x0D, 0x00, 0x30, 0xB0, 0x02, 0x31, 0x10, 0x44, 0x12, 0x77, 0x32, 0x77, 
+    0x73, 0x33, 0x77, 0x33, 0x12, 0x73, 0x30, 0xA2, 0x08, 0x01, 0x31, 0x41, 0x10, 0x20, 0xB1, 0x19, 
+    0x31, 0x13, 0x00, 0x12, 0x22, 0x31, 0x24, 0x54, 0x40, 0x00, 0x44, 0x40, 0x40, 0xC4, 0x03, 0xA0, 
+    0xAA, 0x42, 0x01, 0x09, 0xC0, 0x06, 0x30, 0x11, 0x10, 0x30, 0xF0, 0x11, 0x02, 0x91, 0x20, 0xA3, 
+    0x20, 0x03, 0x33, 0x77, 0x93, 0x73, 0x30, 0x33, 0x90, 0x03, 0x23, 0x31, 0x11, 0x23, 0x10, 0x11, 
+    0x41, 0x30, 0xE1, 0x00, 0x30, 0xC0, 0x0B, 0x22, 0x20, 0x02, 0x44, 0x40, 0x44, 0xA0, 0x42, 0x0E, 
+    0x04, 0x40, 0xA4, 0xA1, 0x1A, 0xA1, 0x11, 0x90, 0xA0, 0x06, 0xA0, 0x01, 0x90, 0x30, 0xF0, 0x13, 
+    0x0E, 0x72, 0x33, 0x73, 0x37, 0x33, 0x37, 0x23, 0x00, 0x42, 0x02, 0x00, 0x00, 0xA3, 0x09, 0x11, 
+    0x21, 0x33, 0x1A, 0x10, 0xF1, 0x02, 0xE0, 0x2C, 0x22, 0x10, 0x22, 0x25, 0x44, 0x45, 0x40, 0x04, 
+    0x44, 0x00, 0x04, 0x40, 0x4A, 0x01, 0xA0, 0x0A, 0x01, 0x09, 0x91, 0x40, 0x11, 0x10, 0x10, 0xB0, 
+    0x01, 0x33, 0xF0, 0x0B, 0x2F, 0x72, 0x33, 0x72, 0x37, 0x32, 0x23, 0x37, 0x73, 0x00, 0x99, 0x93, 
+    0x30, 0x33, 0x32, 0x2C, 0x10, 0x12, 0x41, 0x1C, 0x00, 0x14, 0x11, 0x10, 0x09, 0xC0, 0xB2, 0x42, 
+    0x00, 0xA0, 0xB2, 0x19, 0x44, 0x40, 0x40, 0x04, 0x40, 0x4A, 0x40, 0x4A, 0xA1, 0x00, 0x0A, 0xAA, 
+    0x10, 0x42, 0x00, 0x10, 
+};
+
+const gfx_image_t STORY_CH1_IMG = {
+    .w = STORY_CH1_W, .h = STORY_CH1_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH1_PAL, .colors = STORY_CH1_PAL_SIZE,
+    .data = STORY_CH1_RLE, .size = STORY_CH1_RLE_SIZE,
 };
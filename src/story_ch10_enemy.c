@@ -6,318 +6,91 @@ const uint16_t STORY_CH10_ENEMY_PAL[STORY_CH10_ENEMY_PAL_SIZE] = {
     0x64B4, 0x55BA, 0x663B, 0x434E, 0x8DD8, 0x4BD0, 0x8576, 0x23F8, 
 };
 
-const uint8_t STORY_CH10_ENEMY_IDX[(STORY_CH10_ENEMY_W * STORY_CH10_ENEMY_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x66, 0x33, 0x36, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x67, 0x22, 0x22, 0x22, 0x22, 0x22, 0x73, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x32, 
-    0x33, 0x32, 0x22, 0x22, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 
-    0x23, 0x32, 0x33, 0x33, 0x72, 0x22, 0x72, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x22, 0x27, 0x22, 
-    0x27, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x55, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x22, 0x22, 
-    0x27, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x27, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
-    0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x50, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x72, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x22, 0x22, 0x27, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x72, 
-    0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x27, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 
-    0x37, 0x22, 0x22, 0x22, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x37, 0x37, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x37, 0x73, 0x22, 0x22, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x72, 0x77, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x27, 0x22, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x22, 0x27, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x32, 0x72, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x22, 
-    0x27, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x27, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x6A, 0x92, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 
-    0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x6A, 0x22, 0x22, 0x22, 0x27, 0x27, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x72, 0x22, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 
-    0x22, 0x22, 0x27, 0x22, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x22, 0x27, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
-    0x00, 0x06, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x22, 0x22, 0x22, 0x27, 0x73, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x73, 0x77, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x22, 0x22, 0x22, 0x22, 0x27, 
-    0x37, 0x33, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x22, 0x22, 0x73, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x72, 0x27, 0x23, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x22, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x22, 0x22, 0x22, 0x26, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x22, 0x22, 0x22, 0x77, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 
-    0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x09, 0x92, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 
-    0x22, 0x22, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0x22, 0x72, 0x73, 0x33, 0x33, 0x33, 0x32, 0x22, 0x27, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0x67, 0x27, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x72, 0x27, 0x23, 0x32, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x92, 0x30, 0x22, 0x72, 0x23, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x77, 0x22, 0x22, 0x75, 0x72, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 
-    0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x92, 0x26, 0x07, 0x22, 0x23, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x23, 0x03, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x22, 0x00, 
-    0x63, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0xF2, 0x23, 0x50, 0x32, 0x72, 0x60, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 
-    0x22, 0x70, 0x36, 0x56, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x56, 0x65, 0x22, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x52, 0x22, 0x23, 0x61, 0x98, 0xB6, 0x00, 0x05, 0x56, 0x56, 0xB3, 0x4C, 0x52, 0x22, 0x27, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x07, 0x22, 0x22, 0x65, 0xA4, 0x1A, 0x44, 0x49, 0x44, 0x44, 0x1A, 0x80, 0x72, 
-    0x22, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x22, 0x23, 0x08, 0x14, 0x41, 0x4A, 0x11, 0x44, 0x13, 
-    0x02, 0x22, 0x22, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x05, 0x05, 0x65, 0x55, 0x60, 0x00, 0x00, 
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x22, 0x22, 0x75, 0xB9, 0x41, 0x4A, 0x11, 
-    0x48, 0x55, 0x22, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x60, 0x68, 
-    0x88, 0x8B, 0x00, 0x32, 0x22, 0x22, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x50, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x22, 0x22, 
-    0x22, 0x36, 0x55, 0x56, 0x72, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x55, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x60, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 
-    0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x32, 0x22, 0x22, 0x22, 
-    0x22, 0x60, 0x62, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x26, 0x00, 0x67, 
-    0x22, 0x23, 0x60, 0x03, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x22, 
-    0x76, 0x00, 0x00, 0x00, 0x06, 0x22, 0x72, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x99, 0x22, 0x22, 0x23, 0x66, 0x63, 0x22, 0x22, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x99, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x49, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0x80, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x11, 0x11, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x94, 0x11, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x14, 0x92, 0x22, 0x22, 0x29, 0x41, 
-    0x11, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x14, 0xAA, 0xA4, 
-    0x41, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x60, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBC, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x48, 0x60, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x84, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xB8, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4E, 0xB0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0xC4, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x14, 0xCD, 
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x65, 0x00, 0x08, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x4A, 
-    0xA4, 0x11, 0x11, 0x11, 0x14, 0xA4, 0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x06, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x1D, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x41, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1C, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x11, 0x11, 0x11, 
-    0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 
-    0x11, 0x14, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x11, 
-    0x11, 0x11, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x41, 
-    0x11, 0x11, 0x11, 0x14, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 
-    0x11, 0x11, 0x11, 0x11, 0x49, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x49, 0x41, 0x11, 0x11, 0x11, 0x11, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x48, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x48, 0x11, 0x11, 0x11, 0x11, 0x11, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x18, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x84, 0x11, 0x11, 0x11, 0x11, 0x11, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x19, 0x61, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x64, 0x11, 0x11, 0x11, 0x11, 0x11, 0x60, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x14, 0x6C, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0xB0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x70, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0xA1, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x11, 0x11, 
-    0x11, 0x11, 0x14, 0x70, 0xA1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x85, 0xA1, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x90, 0x84, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x66, 
-    0xA1, 0x11, 0x11, 0x11, 0x11, 0x11, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x74, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x14, 0x66, 0xA1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x41, 0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x7A, 0x41, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x4A, 0x66, 0xA4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x3A, 0x41, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x4A, 0x56, 0xA4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x45, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x6A, 0x91, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9A, 0x06, 0xA4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x20, 
-    0x6A, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x92, 0x05, 0x94, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x1A, 0x20, 0x09, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x97, 0x00, 0x2A, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t STORY_CH10_ENEMY_RLE[STORY_CH10_ENEMY_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xD0, 0x02, 0x73, 0x70, 0xF0, 0x98, 0x07, 0x66, 0x63, 0x33, 0x66, 0xF0, 0x50, 
+    0x01, 0x67, 0xF2, 0x01, 0x02, 0x73, 0x50, 0xF0, 0x4A, 0x00, 0x30, 0xF2, 0x07, 0x00, 0x70, 0xF0, 
+    0x47, 0x01, 0x57, 0xF2, 0x0A, 0x00, 0x60, 0xF0, 0x44, 0x00, 0x60, 0xF2, 0x0D, 0x00, 0x30, 0xF0, 
+    0x42, 0x00, 0x50, 0xF2, 0x04, 0x04, 0x32, 0x33, 0x30, 0xC2, 0x00, 0x30, 0xF0, 0x41, 0xF2, 0x02, 
+    0x02, 0x72, 0x30, 0x43, 0x07, 0x37, 0x22, 0x27, 0x23, 0xF0, 0x3F, 0x00, 0x70, 0xB2, 0x04, 0x72, 
+    0x22, 0x70, 0xF3, 0x00, 0xE2, 0x00, 0x50, 0xF0, 0x0B, 0x06, 0x65, 0x55, 0x00, 0x50, 0xF0, 0x22, 
+    0x00, 0x60, 0xC2, 0x00, 0x70, 0xF3, 0x05, 0xD2, 0x00, 0x70, 0xF0, 0x3D, 0x00, 0x70, 0xD2, 0xF3, 
+    0x07, 0xC2, 0x00, 0x50, 0xF0, 0x3B, 0x00, 0x50, 0xE2, 0xF3, 0x0A, 0x03, 0x77, 0x23, 0xF0, 0x23, 
+    0x00, 0x50, 0xF0, 0x0E, 0x00, 0x30, 0xB2, 0x01, 0x77, 0xF3, 0x08, 0x00, 0x70, 0xC2, 0x7F, 0x07, 
+    0x00, 0x07, 0x22, 0x27, 0xF3, 0x08, 0x02, 0x23, 0x70, 0xD2, 0x00, 0x60, 0xF0, 0x39, 0x00, 0x50, 
+    0xE2, 0xF3, 0x0B, 0x04, 0x73, 0x72, 0x30, 0xF0, 0x39, 0x01, 0x69, 0x55, 0x02, 0x77, 0x30, 0xB2, 
+    0x00, 0x70, 0xF0, 0x39, 0x05, 0x69, 0x72, 0x77, 0xF3, 0x0C, 0x02, 0x72, 0x70, 0x7F, 0x45, 0x02, 
+    0x22, 0x20, 0x4E, 0x05, 0x22, 0x33, 0x27, 0xD2, 0xF0, 0x39, 0x53, 0xF3, 0x02, 0x01, 0x27, 0xF0, 
+    0x39, 0x02, 0x6A, 0x90, 0xF2, 0x00, 0xF3, 0x06, 0xD2, 0x00, 0x50, 0xF0, 0x38, 0x01, 0x6A, 0xD2, 
+    0x02, 0x72, 0x70, 0xF3, 0x07, 0x00, 0x70, 0xA2, 0x00, 0x70, 0xF0, 0x1F, 0x00, 0x50, 0xB0, 0x00, 
+    0x50, 0x5A, 0x00, 0x20, 0xF3, 0x02, 0xE2, 0x00, 0x70, 0x6A, 0xF0, 0x11, 0x43, 0x00, 0x70, 0xF3, 
+    0x0F, 0x01, 0x27, 0x6D, 0x00, 0x50, 0xD0, 0xA6, 0x4C, 0xA2, 0x01, 0x77, 0xF3, 0x08, 0x05, 0x73, 
+    0x77, 0x23, 0xF0, 0x39, 0x01, 0x69, 0xF2, 0x00, 0x05, 0x73, 0x73, 0x37, 0xF3, 0x04, 0x7F, 0xB0, 
+    0x00, 0x50, 0x43, 0x00, 0x70, 0xF3, 0x0C, 0x02, 0x72, 0x20, 0x66, 0x00, 0x50, 0xC0, 0x00, 0x50, 
+    0xF0, 0x0D, 0xB2, 0x50, 0x01, 0x77, 0xD2, 0x00, 0x60, 0x6A, 0xC0, 0x00, 0x50, 0xF0, 0x07, 0x00, 
+    0x90, 0xC2, 0x01, 0x77, 0xF3, 0x05, 0xF2, 0x00, 0x64, 0xF0, 0x04, 0x50, 0x00, 0x90, 0xC2, 0xF3, 
+    0x09, 0x69, 0x00, 0x50, 0xF0, 0x15, 0x00, 0x70, 0x42, 0x02, 0x72, 0x70, 0xE3, 0xA2, 0x00, 0x70, 
+    0xF2, 0x02, 0x00, 0x50, 0xF0, 0x20, 0x00, 0x50, 0xA0, 0x00, 0x50, 0x55, 0x05, 0x67, 0x27, 0x22, 
+    0xF3, 0x05, 0x08, 0x72, 0x27, 0x23, 0x32, 0x70, 0xF0, 0x1C, 0x00, 0x50, 0xF0, 0x00, 0x53, 0x09, 
+    0x69, 0x23, 0x02, 0x27, 0x22, 0xF3, 0x02, 0x01, 0x77, 0xA2, 0x02, 0x75, 0x70, 0x65, 0x02, 0x00, 
+    0x50, 0x4A, 0x00, 0x50, 0xF0, 0x06, 0x07, 0x59, 0x22, 0x60, 0x72, 0x4B, 0x0A, 0x33, 0x22, 0x23, 
+    0x03, 0x22, 0x30, 0xF0, 0x21, 0x00, 0x50, 0xD0, 0x00, 0x50, 0x4F, 0x08, 0x02, 0x92, 0x20, 0x06, 
+    0x30, 0xA2, 0xE3, 0x0A, 0xF2, 0x23, 0x50, 0x32, 0x72, 0x60, 0x70, 0x00, 0x00, 0x50, 0x09, 0x39, 
+    0x22, 0x70, 0x36, 0x56, 0xF3, 0x01, 0x05, 0x66, 0x56, 0x65, 0xA2, 0xF0, 0x26, 0x03, 0x60, 0x05, 
+    0xF0, 0x0A, 0x00, 0x50, 0xA2, 0x13, 0x36, 0x19, 0x8B, 0x60, 0x00, 0x55, 0x65, 0x6B, 0x34, 0xC5, 
+    0xA2, 0x00, 0x70, 0xF0, 0x17, 0x01, 0x55, 0xF0, 0x1C, 0x00, 0x70, 0xA2, 0x09, 0x65, 0xA4, 0x1A, 
+    0x44, 0x49, 0xA4, 0x04, 0x1A, 0x80, 0x70, 0xA2, 0x00, 0x60, 0xF0, 0x15, 0x00, 0x50, 0xD0, 0x00, 
+    0x50, 0xF0, 0x17, 0x00, 0x50, 0xB2, 0x0F, 0x30, 0x81, 0x44, 0x14, 0xA1, 0x14, 0x41, 0x30, 0xB2, 
+    0x00, 0x70, 0xF0, 0x12, 0x01, 0x55, 0xE0, 0x01, 0x55, 0xB0, 0x07, 0x50, 0x56, 0x55, 0x56, 0xC0, 
+    0x00, 0x50, 0xF0, 0x05, 0x00, 0x70, 0xB2, 0x03, 0x75, 0xB9, 0x45, 0x02, 0x85, 0x50, 0xC2, 0x00, 
+    0x50, 0xF0, 0x10, 0x00, 0x50, 0xF0, 0x10, 0x00, 0x50, 0xC0, 0x00, 0x60, 0xF0, 0x06, 0xD2, 0x02, 
+    0x60, 0x60, 0xA8, 0x03, 0xB0, 0x03, 0xC2, 0x00, 0x30, 0xF0, 0x1F, 0x06, 0x50, 0x00, 0x50, 0x50, 
+    0xF0, 0x03, 0x00, 0x50, 0xF0, 0x06, 0x00, 0x60, 0xE2, 0x06, 0x36, 0x55, 0x56, 0x70, 0xE2, 0xF0, 
+    0x2C, 0x00, 0x50, 0xF0, 0x0E, 0x00, 0x30, 0xF2, 0x0C, 0x00, 0x50, 0xF0, 0x0B, 0x00, 0x50, 0x5F, 
+    0x00, 0x50, 0xA0, 0x03, 0x50, 0x05, 0xF0, 0x06, 0x00, 0x30, 0xF2, 0x0A, 0x00, 0x60, 0xF0, 0x21, 
+    0x01, 0x55, 0xB0, 0x00, 0x50, 0xD0, 0xA5, 0xF0, 0x0A, 0x00, 0x30, 0xF2, 0x08, 0x00, 0x60, 0xF0, 
+    0x49, 0x00, 0x60, 0xF2, 0x06, 0x00, 0x60, 0xF0, 0x0E, 0x00, 0x50, 0xF0, 0x12, 0x00, 0x50, 0xE0, 
+    0x01, 0x55, 0xF0, 0x0B, 0x02, 0x30, 0x50, 0xF2, 0x03, 0x03, 0x70, 0x53, 0xF0, 0x48, 0x04, 0x22, 
+    0x00, 0x30, 0xF2, 0x00, 0x03, 0x60, 0x62, 0x76, 0x00, 0x50, 0xF0, 0x03, 0x00, 0x50, 0xF0, 0x03, 
+    0x10, 0x72, 0x26, 0x00, 0x67, 0x22, 0x23, 0x60, 0x03, 0x20, 0x77, 0xF0, 0x04, 0x00, 0x60, 0xF0, 
+    0x03, 0x05, 0x82, 0x22, 0x76, 0xD0, 0x03, 0x62, 0x27, 0x7D, 0x07, 0x50, 0x05, 0x00, 0x05, 0xF0, 
+    0x03, 0x01, 0x99, 0xB2, 0x04, 0x36, 0x66, 0x30, 0xC2, 0x7C, 0xF0, 0x0B, 0x45, 0xF2, 0x01, 0x00, 
+    0x90, 0x65, 0x00, 0x50, 0xF0, 0x11, 0x01, 0x55, 0xF0, 0x05, 0x03, 0x41, 0x49, 0xF2, 0x03, 0x02, 
+    0x44, 0x80, 0xF0, 0x47, 0x00, 0xB0, 0xA1, 0x00, 0xA0, 0xF2, 0x00, 0x04, 0x94, 0x11, 0x40, 0xF0, 
+    0x47, 0x00, 0x40, 0xB1, 0x01, 0x49, 0xC2, 0x01, 0x94, 0xA1, 0x00, 0x60, 0xF0, 0x25, 0x00, 0x50, 
+    0xF0, 0x16, 0x00, 0x80, 0xE1, 0x05, 0x4A, 0xAA, 0x44, 0xC1, 0x00, 0x40, 0x7F, 0xE0, 0x04, 0x50, 
+    0x00, 0x80, 0xF1, 0x0D, 0x00, 0x40, 0xF0, 0x41, 0x01, 0x64, 0xF1, 0x0F, 0x01, 0x4B, 0xF0, 0x2F, 
+    0x00, 0x50, 0xF0, 0x05, 0x00, 0x80, 0xF1, 0x13, 0x01, 0xE6, 0xF0, 0x05, 0x00, 0x50, 0xF0, 0x0F, 
+    0x04, 0x60, 0x00, 0x60, 0xF0, 0x02, 0x00, 0x50, 0xF0, 0x02, 0x01, 0xB4, 0xF1, 0x16, 0x00, 0x80, 
+    0xF0, 0x03, 0x03, 0x50, 0x05, 0xF0, 0x27, 0x01, 0x6C, 0xF1, 0x19, 0x01, 0x4D, 0xF0, 0x0D, 0x00, 
+    0x50, 0xF0, 0x1C, 0x01, 0xBC, 0xF1, 0x1D, 0x02, 0x48, 0x60, 0xE0, 0x00, 0x50, 0xF0, 0x24, 0x02, 
+    0x68, 0x40, 0xF1, 0x22, 0x02, 0x48, 0xB0, 0xF0, 0x15, 0x00, 0x50, 0xF0, 0x08, 0x02, 0xB8, 0x40, 
+    0xF1, 0x28, 0x02, 0x4E, 0xB0, 0xF0, 0x17, 0x00, 0x50, 0xF0, 0x00, 0x02, 0x8C, 0x40, 0xF1, 0x00, 
+    0xF4, 0x04, 0xF1, 0x02, 0xF4, 0x05, 0xE1, 0x03, 0x4C, 0xD6, 0xF0, 0x16, 0x06, 0x65, 0x00, 0x08, 
+    0x40, 0xF1, 0x06, 0xF4, 0x00, 0x02, 0xAA, 0x40, 0xD1, 0x01, 0x4A, 0xF4, 0x01, 0xF1, 0x06, 0x01, 
+    0x48, 0xF0, 0x18, 0x01, 0x64, 0xF1, 0x13, 0x01, 0x44, 0xB1, 0x01, 0x44, 0xF1, 0x13, 0x01, 0x45, 
+    0xF0, 0x15, 0x03, 0x64, 0x14, 0xF1, 0x36, 0x02, 0x41, 0x40, 0xF0, 0x15, 0x00, 0x40, 0xF1, 0x3A, 
+    0x02, 0x41, 0xC0, 0xF0, 0x13, 0x02, 0x81, 0x40, 0xF1, 0x3A, 0x02, 0x41, 0xD0, 0xF0, 0x11, 0x01, 
+    0x54, 0xF1, 0x3E, 0x00, 0x40, 0xF0, 0x11, 0x00, 0x80, 0xF1, 0x3E, 0x02, 0x41, 0xB0, 0xF0, 0x10, 
+    0x00, 0x40, 0xF1, 0x40, 0x00, 0xC0, 0xF0, 0x0F, 0x00, 0x60, 0xF1, 0x41, 0x01, 0x45, 0xF0, 0x0E, 
+    0x00, 0x80, 0xF1, 0x42, 0x00, 0x60, 0xF0, 0x0E, 0x00, 0x40, 0xF1, 0x42, 0x00, 0x80, 0x7F, 0xF1, 
+    0x19, 0x00, 0xC0, 0xF0, 0x0D, 0x00, 0x50, 0x7F, 0xF1, 0x02, 0x00, 0x40, 0xF0, 0x0D, 0x00, 0x60, 
+    0x47, 0x00, 0x40, 0xF1, 0x39, 0x56, 0xF1, 0x00, 0x01, 0x44, 0xF1, 0x2E, 0x01, 0x44, 0x47, 0x00, 
+    0x50, 0x7F, 0x60, 0x00, 0x60, 0xF0, 0x0C, 0x00, 0xD0, 0x48, 0x00, 0x90, 0xF1, 0x2D, 0x01, 0x49, 
+    0x47, 0x00, 0x10, 0x5F, 0x00, 0x80, 0x75, 0x00, 0x80, 0xF1, 0x01, 0x54, 0x00, 0x80, 0xF1, 0x01, 
+    0x01, 0x88, 0xF1, 0x2C, 0x01, 0x84, 0x69, 0x01, 0x96, 0xF1, 0x2B, 0x01, 0x46, 0x6A, 0x02, 0x46, 
+    0xC0, 0xF1, 0x2A, 0x01, 0x63, 0xF1, 0x02, 0x00, 0xB0, 0x5E, 0x02, 0x16, 0x60, 0xF1, 0x29, 0x02, 
+    0x40, 0x80, 0x6B, 0x02, 0x70, 0x40, 0xF1, 0x28, 0x02, 0x80, 0xA0, 0xF1, 0x02, 0x00, 0xD0, 0xF0, 
+    0x0C, 0x00, 0xE0, 0xF1, 0x01, 0x03, 0x47, 0x0A, 0x70, 0x00, 0x50, 0x4A, 0x00, 0x80, 0xF0, 0x0C, 
+    0x00, 0x40, 0x49, 0x03, 0x90, 0x84, 0xF1, 0x26, 0x02, 0x46, 0x60, 0x4A, 0x00, 0xC0, 0x5F, 0x02, 
+    0x20, 0x70, 0x7D, 0x00, 0x40, 0xF0, 0x0B, 0x00, 0x50, 0x4D, 0x01, 0xA4, 0xF1, 0x24, 0x05, 0x4A, 
+    0x66, 0xA4, 0x5D, 0x00, 0x60, 0x4C, 0x00, 0x30, 0x6F, 0x00, 0x50, 0x4C, 0x00, 0x50, 0x52, 0xF1, 
+    0x02, 0x05, 0x42, 0x06, 0xA9, 0xF1, 0x24, 0x02, 0x9A, 0x00, 0x4B, 0x01, 0x16, 0xF0, 0x0A, 0x00, 
+    0xB0, 0xF1, 0x02, 0x00, 0xA0, 0x42, 0x01, 0x24, 0xF1, 0x22, 0x05, 0x49, 0x20, 0x59, 0x5E, 0x00, 
+    0x80, 0x4C, 0x01, 0x09, 0x6B, 0x06, 0xA9, 0x70, 0x02, 0xA0, 0xF1, 0x02, 0x00, 0xD0, 0xF0, 0x01, 
+};
+
+const gfx_image_t STORY_CH10_ENEMY_IMG = {
+    .w = STORY_CH10_ENEMY_W, .h = STORY_CH10_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH10_ENEMY_PAL, .colors = STORY_CH10_ENEMY_PAL_SIZE,
+    .data = STORY_CH10_ENEMY_RLE, .size = STORY_CH10_ENEMY_RLE_SIZE,
 };
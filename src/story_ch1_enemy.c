@@ -6,329 +6,168 @@ const uint16_t STORY_CH1_ENEMY_PAL[STORY_CH1_ENEMY_PAL_SIZE] = {
     0xCD51, 0xA5D8, 0x730A, 0x6A45, 0xC4EE, 0x81A1, 0x2881, 0xC3C6, 
 };
 
-const uint8_t STORY_CH1_ENEMY_IDX[(STORY_CH1_ENEMY_W * STORY_CH1_ENEMY_H) / 2] = {
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0xA0, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x09, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xAA, 0xA5, 0xBA, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x96, 0x66, 0x69, 0x00, 0x99, 0x99, 0x96, 0x66, 0x66, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x0A, 0x55, 
-    0xB3, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x66, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0xA5, 
-    0xB4, 0x30, 0x11, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x67, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x96, 0x69, 0x96, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x05, 
-    0xB4, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x66, 0x67, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x0A, 
-    0xB4, 0x43, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 
-    0x96, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x1B, 
-    0x24, 0x43, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x09, 0x96, 0x96, 0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0xAB, 
-    0xB4, 0x43, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x0A, 0x5B, 
-    0xB2, 0x44, 0x3C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x00, 0x01, 0x0A, 0x5B, 
-    0x22, 0x43, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x66, 0x66, 0x66, 0x67, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x0B, 0xB2, 
-    0x22, 0x24, 0xCC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x0A, 0xB5, 0x55, 
-    0x55, 0x55, 0x52, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x55, 0x5E, 0xE5, 0x5E, 
-    0xBB, 0x5E, 0x5B, 0x5E, 0x55, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x5B, 0xEE, 
-    0xBA, 0xAE, 0x54, 0x45, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x52, 0x55, 
-    0xAA, 0xAA, 0x44, 0x42, 0xBB, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x55, 0x55, 0xB4, 0xAA, 
-    0xAA, 0xA4, 0x44, 0x34, 0x24, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x99, 0x99, 
-    0x99, 0x66, 0x66, 0x66, 0x69, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5B, 0xBB, 0xBA, 
-    0xAA, 0xA4, 0x44, 0x33, 0x23, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x76, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xBA, 0x55, 
-    0xBB, 0xBA, 0xBB, 0x88, 0x38, 0x00, 0x00, 0x00, 0x00, 0x99, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x60, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0xAB, 
-    0x55, 0x5B, 0xB3, 0x08, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x96, 0x66, 0x66, 0x66, 
-    0x66, 0x77, 0x00, 0x03, 0x30, 0x00, 0x08, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x42, 0x2B, 
-    0xBA, 0xA4, 0x43, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x66, 0x67, 0x78, 
-    0x83, 0x33, 0x22, 0x22, 0x43, 0x30, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x33, 0x43, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xBB, 
-    0xBB, 0xB2, 0x43, 0x88, 0x00, 0x00, 0x00, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x66, 0x08, 0xCC, 
-    0x22, 0x22, 0xD2, 0x22, 0x40, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-    0x42, 0x22, 0x22, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 
-    0xBB, 0xB2, 0x43, 0x88, 0x80, 0x00, 0x09, 0x99, 0x99, 0x96, 0x66, 0x00, 0x00, 0x0C, 0x22, 0x22, 
-    0x22, 0x22, 0xD2, 0x22, 0x30, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-    0x22, 0x22, 0x22, 0xDD, 0x22, 0x22, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x4B, 0xB5, 
-    0x55, 0xBB, 0xB4, 0x33, 0xCC, 0xC8, 0x88, 0x88, 0x88, 0x83, 0x88, 0xCC, 0x32, 0x22, 0x22, 0x22, 
-    0x22, 0x2D, 0xD2, 0x22, 0x30, 0x88, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-    0x22, 0x22, 0x22, 0xDD, 0xD2, 0x22, 0x22, 0x22, 0x43, 0x43, 0x00, 0x00, 0x43, 0x34, 0xB2, 0x2B, 
-    0xBB, 0xBB, 0xBB, 0x22, 0x3C, 0xCC, 0x0C, 0x02, 0x2C, 0xC2, 0x2C, 0xF0, 0x22, 0x22, 0x22, 0x22, 
-    0xD2, 0xDD, 0xDD, 0xD2, 0x30, 0x80, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x67, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0xB5, 0xDD, 0xD2, 0x2D, 0xDD, 0xD2, 0x22, 0x22, 0xD5, 0x55, 0x5B, 0x25, 0x55, 0x52, 0x24, 0x24, 
-    0xB2, 0x2B, 0x22, 0x22, 0xC0, 0xF2, 0x22, 0x22, 0x22, 0xF2, 0xD2, 0x02, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0xDD, 0xDD, 0xD3, 0x00, 0x80, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-    0xB5, 0x55, 0x5D, 0x2D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD5, 0x55, 0x55, 0x55, 0x22, 0x4B, 
-    0x22, 0xB5, 0x22, 0x25, 0x30, 0x2F, 0x22, 0x22, 0x2F, 0x2D, 0xD2, 0xF2, 0x22, 0xD2, 0x2D, 0xDD, 
-    0x22, 0xDD, 0x2D, 0xD8, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 
-    0x45, 0x55, 0x55, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD5, 0xD5, 0x55, 0x55, 0x55, 0xD5, 0x54, 
-    0x2B, 0x55, 0xB2, 0xB5, 0x20, 0x22, 0x22, 0x22, 0x2F, 0x2D, 0xD2, 0x22, 0x2D, 0xD2, 0x2D, 0xDD, 
-    0x2D, 0xDD, 0x25, 0x20, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x45, 0x55, 0x55, 0x5D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD5, 0xDD, 0x55, 0x55, 0x5D, 0xD5, 0x5B, 
-    0x25, 0xBB, 0xB4, 0x44, 0x20, 0x22, 0x22, 0xF2, 0x22, 0x2D, 0xD2, 0x22, 0x25, 0x22, 0xDD, 0xD2, 
-    0x2D, 0xDD, 0xD5, 0x07, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x55, 0x55, 0x55, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD5, 0xDD, 0x55, 0x55, 0x22, 0xDD, 0x52, 
-    0x25, 0x44, 0xB2, 0x34, 0x2F, 0x2F, 0x22, 0xC2, 0x22, 0xF2, 0xDD, 0x22, 0xDD, 0x22, 0xDD, 0xDD, 
-    0x55, 0x24, 0x38, 0x76, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x55, 0x55, 0x55, 0x55, 0xDD, 0xDD, 0x5D, 0xDD, 0xD5, 0x55, 0x5D, 0x55, 0x22, 0x22, 0x52, 
-    0x25, 0x44, 0x22, 0x24, 0x22, 0x2C, 0x22, 0xC2, 0x22, 0x22, 0xDD, 0x22, 0x5D, 0x2D, 0xDD, 0xD4, 
-    0x00, 0x87, 0x76, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x4B, 0x55, 0x55, 0x5D, 0xDD, 0x55, 0x55, 0x55, 0x5D, 0x55, 0xD2, 0x22, 0x5B, 
-    0xB5, 0xAA, 0xB2, 0x2B, 0x52, 0x22, 0x22, 0xCF, 0x22, 0x22, 0x22, 0x2D, 0xD2, 0x2D, 0xD2, 0x07, 
-    0x77, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x25, 0x55, 0xDD, 0x55, 0x55, 0x5D, 0x55, 0x52, 0x22, 0x55, 
-    0xB5, 0x44, 0x44, 0xA5, 0x52, 0x2D, 0x22, 0xFF, 0x22, 0x22, 0x22, 0x25, 0x22, 0xD2, 0x38, 0x70, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x55, 0x55, 0x55, 0x5D, 0x55, 0x52, 0x22, 0x55, 
-    0xA5, 0x40, 0x34, 0xAB, 0x52, 0x25, 0x2F, 0x20, 0x2D, 0x22, 0xF2, 0xDD, 0xD2, 0x40, 0x76, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x35, 0x55, 0x55, 0x5D, 0x55, 0x55, 0x22, 0x5A, 
-    0xA5, 0x40, 0x3A, 0xAB, 0x52, 0x2D, 0x2C, 0x20, 0xF2, 0xD2, 0xF2, 0x52, 0x00, 0x76, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xD5, 0x5D, 0xD5, 0x55, 0x55, 0x5A, 
-    0xA5, 0x40, 0x3A, 0xAA, 0x5D, 0xD2, 0x50, 0x0C, 0xF2, 0xD2, 0x22, 0x20, 0x76, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD5, 0x5D, 0xD5, 0x55, 0x55, 0x5A, 
-    0xA5, 0x40, 0x3A, 0xAA, 0x52, 0xD2, 0xD2, 0x0C, 0x22, 0xD2, 0x2F, 0x09, 0x00, 0x00, 0x00, 0x99, 
-    0x66, 0x66, 0x66, 0x66, 0x99, 0x99, 0x69, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x5D, 0xD5, 0x55, 0x55, 0x5B, 
-    0xA5, 0x40, 0x3A, 0xAA, 0x54, 0x2D, 0x22, 0x20, 0x22, 0xD2, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x69, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0x55, 0x5D, 0xD5, 0x55, 0x55, 0xBB, 
-    0xAB, 0x40, 0x3A, 0xAA, 0xA4, 0x02, 0x22, 0x20, 0x22, 0x22, 0x2C, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0xA0, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1A, 0x55, 0x5D, 0xD5, 0x5D, 0xD5, 0xAA, 
-    0xAB, 0x30, 0x4A, 0x44, 0x4B, 0x00, 0x22, 0x20, 0x22, 0xD2, 0x20, 0x01, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0xAA, 0xA0, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x1A, 0x55, 0x5D, 0xD5, 0x5D, 0x55, 0xAA, 
-    0xAB, 0x40, 0x4B, 0xA4, 0x45, 0x2C, 0x22, 0x22, 0x2D, 0x22, 0x2F, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x0A, 0x55, 0x5D, 0xD5, 0x52, 0x55, 0xAA, 
-    0xAB, 0x43, 0x44, 0x44, 0x3A, 0x22, 0x02, 0xFF, 0x2D, 0x22, 0x22, 0xC0, 0x00, 0x1A, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x33, 0x33, 
-    0x34, 0xAA, 0xA3, 0x33, 0x33, 0x30, 0x00, 0x03, 0x33, 0x3B, 0x55, 0x5D, 0xD5, 0x5B, 0x55, 0xAA, 
-    0xAB, 0x43, 0xAA, 0x30, 0x03, 0xB2, 0x22, 0xFC, 0xC2, 0x22, 0x22, 0xC0, 0x01, 0xAA, 0xA0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xBB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAB, 0xBB, 0xAA, 0x44, 0xAA, 0x44, 0x34, 0x44, 0xAA, 0x4B, 0x55, 0x5D, 0xD5, 0x55, 0x5B, 0xAA, 
-    0xAB, 0x44, 0xAB, 0xA4, 0x80, 0xA2, 0x22, 0x2C, 0xC2, 0x22, 0x22, 0xC0, 0x44, 0x4A, 0x30, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x34, 0x33, 0x34, 0x44, 0x44, 0x43, 0x33, 0x33, 
-    0x44, 0x44, 0x44, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x35, 0x55, 0x5D, 0xD5, 0x5E, 0x5B, 0xAA, 
-    0xAB, 0x44, 0xAB, 0xA4, 0x03, 0xAB, 0x22, 0x2F, 0xC0, 0x22, 0x22, 0x2C, 0x33, 0x33, 0x30, 0x00, 
-    0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x35, 0x55, 0x5D, 0x55, 0x5E, 0xBB, 0xAA, 
-    0xAB, 0x44, 0xAB, 0xAA, 0x03, 0xA5, 0x22, 0x22, 0xCC, 0x22, 0x22, 0x2C, 0xCC, 0xCC, 0xCC, 0x33, 
-    0x33, 0x33, 0x33, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xCC, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x45, 0x55, 0x5D, 0x55, 0x5E, 0xBB, 0xAA, 
-    0xAB, 0x44, 0x4A, 0xAA, 0x03, 0x45, 0x22, 0x22, 0xC0, 0x22, 0x2F, 0xFC, 0xCC, 0x88, 0xCC, 0x8C, 
-    0x33, 0x33, 0xC3, 0x3C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xCC, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x8C, 0x88, 0x88, 0x88, 0x88, 0x88, 0xC8, 0x88, 0x88, 0x88, 0x88, 0x88, 0xC8, 0x88, 0x88, 0x88, 
-    0xC8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x45, 0x55, 0x5D, 0x55, 0x5E, 0x5A, 0xAA, 
-    0xAB, 0x44, 0x4A, 0xAA, 0x33, 0x4E, 0x52, 0x22, 0xCC, 0x22, 0x22, 0xFC, 0x88, 0x88, 0x88, 0x88, 
-    0x8C, 0xCC, 0x83, 0x33, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x83, 0x38, 0x88, 0x88, 0x88, 0x8C, 0x3C, 0x88, 0x88, 0xC8, 0x88, 0x88, 0xC3, 0xC3, 0x88, 0x88, 
-    0xCC, 0x33, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x25, 0x55, 0x5D, 0x55, 0x5E, 0xEA, 0xAA, 
-    0xAB, 0x4A, 0xAB, 0xAA, 0x03, 0xAE, 0x52, 0x22, 0x2C, 0x22, 0x22, 0xFC, 0xC8, 0xCC, 0x88, 0x8C, 
-    0xCC, 0xCC, 0x3C, 0x33, 0x3C, 0x33, 0xC3, 0x33, 0x3C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 
-    0x83, 0x38, 0x8C, 0xC3, 0x33, 0x3C, 0x3C, 0x8C, 0x33, 0x33, 0x88, 0xC3, 0x33, 0x33, 0x88, 0x88, 
-    0x8C, 0x3C, 0x8C, 0xC8, 0x88, 0x83, 0x88, 0xCC, 0x88, 0x25, 0xD5, 0x55, 0x55, 0x5E, 0xE5, 0xBB, 
-    0xBB, 0xAA, 0xAB, 0xAA, 0x04, 0x5E, 0xE2, 0x22, 0x20, 0x22, 0x22, 0xF0, 0xC8, 0x83, 0x33, 0x33, 
-    0xCC, 0x33, 0x3C, 0x83, 0x38, 0x88, 0x83, 0x33, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0x33, 
-    0x83, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x3C, 0xC8, 0x33, 0x33, 0x38, 0xC3, 0x33, 0x33, 0x88, 0x8C, 
-    0xC3, 0xCC, 0x88, 0xCC, 0x88, 0x83, 0x88, 0x8C, 0xCC, 0xDD, 0xDD, 0x5D, 0x55, 0x5E, 0xEE, 0x5B, 
-    0xBB, 0xAA, 0xAB, 0xAA, 0x3A, 0xEE, 0xE5, 0x22, 0x2F, 0x22, 0x22, 0x20, 0xCC, 0x83, 0x33, 0x38, 
-    0xC3, 0x3C, 0x88, 0xCC, 0xC8, 0x88, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x38, 0x33, 0x33, 0x33, 0x33, 
-    0xCC, 0xC3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x88, 0xC3, 0xC8, 0x8C, 0x33, 0x33, 0x88, 0x88, 
-    0xC3, 0x88, 0x88, 0xC3, 0xC8, 0x88, 0x88, 0x8C, 0xC3, 0xD2, 0xDD, 0xDD, 0x55, 0x5E, 0xEE, 0x55, 
-    0x55, 0xBB, 0xA5, 0xB4, 0x3A, 0xB5, 0xEE, 0x22, 0x22, 0x22, 0x22, 0x20, 0xCC, 0x83, 0xC8, 0x88, 
-    0xC3, 0x88, 0x88, 0x38, 0x88, 0x8C, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC3, 0x33, 0x33, 0x23, 
-    0x3C, 0x3C, 0x33, 0x3C, 0x3C, 0x33, 0x3C, 0x33, 0x88, 0x88, 0x88, 0x88, 0x44, 0x3C, 0x33, 0x8C, 
-    0xCC, 0x88, 0x8C, 0xC3, 0x38, 0x88, 0x88, 0x83, 0x34, 0x22, 0x2D, 0xDD, 0x55, 0x5E, 0xEE, 0xBB, 
-    0x55, 0xBB, 0xBB, 0xA3, 0x80, 0xAB, 0xEE, 0x52, 0x22, 0x22, 0x22, 0x20, 0xCC, 0xC8, 0x33, 0x88, 
-    0xC3, 0xCC, 0xC8, 0xC3, 0x8C, 0xCC, 0x34, 0x33, 0x33, 0x33, 0xC3, 0x33, 0x8C, 0x33, 0x33, 0xB4, 
-    0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x38, 0x83, 0xC8, 0x88, 0x88, 0x33, 0xB2, 0x33, 0x33, 0x83, 
-    0x3C, 0xCC, 0xC3, 0x33, 0xCC, 0x88, 0x88, 0xC3, 0x34, 0x22, 0xDD, 0xDD, 0x55, 0x5E, 0xE5, 0xAA, 
-    0xBB, 0xAA, 0x44, 0x43, 0x08, 0x4B, 0x5E, 0xE2, 0x22, 0x22, 0x22, 0x20, 0xCC, 0x8C, 0x43, 0xCC, 
-    0x33, 0x33, 0x33, 0x83, 0x3C, 0xCC, 0x44, 0x33, 0x3C, 0x33, 0x33, 0x38, 0x88, 0x33, 0x33, 0x24, 
-    0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x3C, 0xC3, 0x3C, 0xCC, 0x33, 0x34, 0xB4, 0x33, 0x38, 0x83, 
-    0x38, 0xC3, 0x33, 0x33, 0x33, 0x38, 0x33, 0x34, 0x32, 0x22, 0xDD, 0xDD, 0x55, 0x5E, 0xEB, 0xAA, 
-    0xBB, 0xAB, 0x44, 0x03, 0x30, 0x0A, 0xA5, 0xEB, 0x22, 0x22, 0x22, 0x22, 0xCC, 0xC3, 0x33, 0x33, 
-    0x33, 0x43, 0x33, 0xCC, 0x3C, 0x33, 0x44, 0x43, 0x33, 0x33, 0x33, 0x38, 0xC3, 0x33, 0x33, 0x34, 
-    0x33, 0x33, 0x33, 0x33, 0x34, 0x43, 0x33, 0x33, 0x33, 0x3C, 0x33, 0x32, 0xB4, 0x33, 0x3C, 0xC3, 
-    0x3C, 0x33, 0x33, 0x43, 0x33, 0x33, 0x33, 0x44, 0x32, 0x22, 0x5D, 0x5D, 0x55, 0x55, 0xEB, 0xBB, 
-    0xBB, 0xBB, 0x43, 0x03, 0x30, 0x04, 0xAB, 0xE5, 0x22, 0x22, 0x22, 0x22, 0xCC, 0xC3, 0x33, 0x33, 
-    0x34, 0x23, 0x33, 0x33, 0xC3, 0x44, 0x24, 0x44, 0x33, 0x33, 0x33, 0x3C, 0x33, 0x33, 0x33, 0x33, 
-    0x43, 0x32, 0x23, 0x33, 0x42, 0x3C, 0x34, 0x33, 0x33, 0x3C, 0x33, 0x34, 0xB3, 0x33, 0x33, 0xCC, 
-    0x43, 0x33, 0x34, 0x43, 0x33, 0x33, 0x42, 0x24, 0x42, 0x22, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xBB, 
-    0xBB, 0xBB, 0x43, 0x03, 0x40, 0x03, 0x4B, 0x5B, 0x22, 0x22, 0x22, 0x22, 0x2C, 0xC3, 0x33, 0x33, 
-    0x34, 0x24, 0x33, 0x34, 0x34, 0x44, 0x23, 0x34, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x43, 0x42, 0x24, 0x34, 0x22, 0x43, 0x34, 0x43, 0x33, 0x44, 0x43, 0x34, 0x23, 0x43, 0x43, 0x3C, 
-    0x43, 0x33, 0x34, 0x43, 0x42, 0x24, 0x2B, 0x22, 0x22, 0x22, 0xD5, 0x5D, 0x55, 0x55, 0xBA, 0xBB, 
-    0xBB, 0xBB, 0x40, 0x00, 0x30, 0x33, 0x4A, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x2C, 0x33, 0x33, 0x43, 
-    0x33, 0x44, 0x33, 0x34, 0x44, 0x33, 0x24, 0xC3, 0x33, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 
-    0x44, 0x42, 0x42, 0x42, 0x24, 0x44, 0x43, 0x44, 0x34, 0x24, 0x44, 0x34, 0x33, 0x44, 0x43, 0x33, 
-    0x43, 0x34, 0x42, 0x22, 0x22, 0x22, 0xBB, 0x22, 0x22, 0x2B, 0x55, 0x5D, 0x55, 0x55, 0xAA, 0xBB, 
-    0xBB, 0xBB, 0x40, 0x00, 0x30, 0x33, 0x44, 0x44, 0x42, 0x22, 0x22, 0x20, 0x23, 0x33, 0x34, 0x43, 
-    0x33, 0x44, 0x3C, 0x34, 0x43, 0x33, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x33, 0x34, 0x43, 
-    0x44, 0x44, 0x22, 0x42, 0x44, 0x42, 0x44, 0x44, 0x42, 0x44, 0x44, 0x44, 0x34, 0x42, 0x43, 0x33, 
-    0x24, 0x2B, 0xBB, 0x22, 0xB2, 0x22, 0x52, 0x22, 0x22, 0x25, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xBA, 
-    0xAB, 0xBB, 0x43, 0x80, 0x30, 0x04, 0x44, 0x44, 0x45, 0xD2, 0x22, 0x23, 0x34, 0x43, 0x44, 0x44, 
-    0x44, 0x44, 0x3C, 0x34, 0x3C, 0x33, 0x44, 0x33, 0x33, 0x34, 0x43, 0x43, 0x33, 0x33, 0x32, 0x43, 
-    0x34, 0x44, 0x22, 0x22, 0x44, 0x22, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x32, 0x22, 0x24, 0x34, 
-    0x22, 0xBB, 0x22, 0x22, 0x24, 0x32, 0x22, 0x22, 0x22, 0x22, 0x25, 0x55, 0x55, 0x55, 0xA4, 0xB4, 
-    0x4B, 0xBB, 0x43, 0x83, 0x38, 0x84, 0x34, 0x44, 0x45, 0x52, 0x22, 0x23, 0xC4, 0x44, 0x24, 0x43, 
-    0x44, 0x42, 0x33, 0x33, 0x3C, 0x33, 0x44, 0x33, 0x43, 0x34, 0x24, 0x42, 0x43, 0x33, 0x42, 0x44, 
-    0x32, 0x42, 0x22, 0x22, 0x44, 0x44, 0x44, 0x42, 0x43, 0x44, 0x44, 0x42, 0x42, 0x24, 0x22, 0x32, 
-    0x22, 0x22, 0x44, 0x2B, 0x24, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB5, 0x55, 0x55, 0x44, 0xB4, 
-    0x4B, 0xB4, 0x43, 0x83, 0x3C, 0x34, 0x43, 0x44, 0x4B, 0x52, 0x22, 0x33, 0x32, 0x42, 0x24, 0x34, 
-    0x32, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x24, 0x43, 0x22, 0x22, 0x22, 0x43, 0x22, 0x32, 
-    0x42, 0x42, 0x22, 0x24, 0x44, 0x44, 0x43, 0x42, 0x44, 0x44, 0x44, 0x22, 0x22, 0x44, 0x44, 0x22, 
-    0x42, 0xB2, 0x44, 0x22, 0x22, 0x22, 0x42, 0x22, 0x22, 0xB2, 0x22, 0x22, 0x55, 0x55, 0x44, 0x24, 
-    0x44, 0x44, 0x44, 0xC3, 0x3C, 0x34, 0x43, 0x42, 0x42, 0x22, 0x22, 0x44, 0x42, 0x42, 0x23, 0x34, 
-    0x32, 0x24, 0x33, 0xC3, 0x33, 0x33, 0x33, 0x22, 0x22, 0x44, 0x34, 0x22, 0x22, 0x23, 0x44, 0x34, 
-    0x22, 0x22, 0x22, 0x24, 0x34, 0x44, 0x43, 0x42, 0x42, 0x44, 0x22, 0x22, 0x22, 0x44, 0x34, 0x22, 
-    0x42, 0xB2, 0x34, 0x22, 0x22, 0x22, 0x44, 0x22, 0x22, 0xB5, 0x55, 0x22, 0x25, 0x55, 0x43, 0x44, 
-    0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x44, 0x42, 0x22, 0x33, 0x43, 0x24, 0x42, 0x42, 0x2C, 0x34, 
-    0x44, 0x24, 0x33, 0xCC, 0x33, 0x33, 0x33, 0x22, 0x22, 0x44, 0xC4, 0x22, 0x22, 0x24, 0x33, 0x42, 
-    0x22, 0x22, 0x22, 0x24, 0x44, 0x44, 0x4C, 0x42, 0x22, 0x42, 0x22, 0x22, 0x22, 0x33, 0x44, 0x42, 
-    0x42, 0x22, 0x34, 0x22, 0x22, 0x22, 0x34, 0x22, 0x22, 0x55, 0x55, 0x22, 0x22, 0x25, 0x43, 0x22, 
-    0x44, 0x34, 0x44, 0x33, 0x33, 0x3C, 0x44, 0x22, 0x44, 0x33, 0x43, 0x44, 0x42, 0x42, 0x23, 0x22, 
-    0x24, 0x44, 0x43, 0x33, 0x33, 0x33, 0x33, 0x42, 0x24, 0x4B, 0xC4, 0x22, 0x22, 0x24, 0x33, 0x22, 
-    0x22, 0x22, 0x22, 0x24, 0x24, 0x44, 0x4C, 0x22, 0x22, 0x22, 0x42, 0x22, 0x42, 0x22, 0x23, 0x44, 
-    0x42, 0x22, 0x34, 0x22, 0x24, 0x22, 0x33, 0x22, 0x22, 0x55, 0x55, 0xB5, 0x22, 0x25, 0x43, 0x24, 
-    0x44, 0x44, 0x34, 0x44, 0x44, 0x43, 0x34, 0x22, 0x43, 0x33, 0x24, 0x32, 0x22, 0x42, 0x24, 0x22, 
-    0x24, 0x44, 0x44, 0x33, 0x34, 0x24, 0x44, 0x42, 0x22, 0x22, 0x32, 0x22, 0x22, 0x24, 0x33, 0x2B, 
-    0x2B, 0x22, 0x22, 0x22, 0x24, 0x32, 0x43, 0x22, 0x22, 0x22, 0x42, 0x22, 0x42, 0x22, 0x23, 0x44, 
-    0x42, 0x22, 0x33, 0x44, 0x44, 0x22, 0x43, 0x22, 0x22, 0x22, 0x55, 0x52, 0x22, 0x2B, 0x43, 0x24, 
-    0x44, 0x43, 0x34, 0x44, 0x42, 0x23, 0x32, 0xBB, 0x44, 0x44, 0x24, 0x22, 0x42, 0x22, 0x23, 0x22, 
-    0x24, 0x24, 0x22, 0x44, 0x22, 0x22, 0x44, 0x24, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0xBB, 
-    0xB2, 0x22, 0x22, 0x22, 0x24, 0x42, 0x43, 0x22, 0x22, 0x22, 0x22, 0x24, 0x22, 0x44, 0x23, 0x34, 
-    0x32, 0x22, 0x34, 0x43, 0x34, 0x22, 0x43, 0x22, 0x22, 0x22, 0x55, 0x52, 0x22, 0x22, 0x4C, 0x24, 
-    0x44, 0x43, 0x44, 0x44, 0x22, 0x24, 0x32, 0xB2, 0x44, 0x22, 0x22, 0x22, 0x24, 0x22, 0x24, 0x42, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x23, 0x22, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0xB5, 
-    0xB2, 0x22, 0x22, 0x22, 0x24, 0x22, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 
-    0x32, 0x24, 0x34, 0x22, 0x3C, 0x22, 0x24, 0x22, 0x22, 0x22, 0x55, 0x52, 0x22, 0x22, 0x4C, 0x22, 
-    0x43, 0x34, 0x44, 0x24, 0x22, 0x22, 0x32, 0x52, 0x44, 0x22, 0x22, 0x22, 0x24, 0x22, 0xB2, 0x42, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x22, 0x2B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xBB, 
-    0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 0x22, 0x22, 0x24, 0x24, 0x42, 0x22, 0x22, 0x22, 0x33, 
-    0x32, 0x24, 0x32, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 0x25, 0xB2, 0x22, 0x24, 0x3C, 0x22, 
-    0x4C, 0x32, 0x44, 0x24, 0x22, 0x22, 0x32, 0xB2, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xB2, 0x32, 0x2B, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x22, 0xBB, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x4B, 0x24, 0x22, 0x22, 0x3C, 
-    0x42, 0x22, 0x42, 0x24, 0x2B, 0x22, 0x32, 0x22, 0x22, 0x22, 0x25, 0x22, 0x24, 0x24, 0x33, 0x44, 
-    0x24, 0x34, 0x43, 0x44, 0x22, 0x22, 0x32, 0xB2, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x22, 0x2B, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x22, 0xBB, 
-    0x22, 0x22, 0x22, 0x24, 0x22, 0x22, 0x22, 0x2B, 0xB2, 0x24, 0x24, 0x42, 0x43, 0x24, 0x22, 0x38, 
-    0x34, 0x22, 0x42, 0x43, 0x22, 0x22, 0x33, 0x22, 0x22, 0x22, 0x25, 0x22, 0x23, 0x44, 0x44, 0x42, 
-    0x22, 0x22, 0x44, 0x34, 0x22, 0x22, 0x32, 0x52, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 0x2B, 0x22, 0x22, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x52, 
-    0x22, 0x22, 0x22, 0x23, 0x44, 0x22, 0x22, 0x2B, 0x22, 0x44, 0x22, 0x22, 0x44, 0x43, 0x22, 0x3C, 
-    0x34, 0x22, 0x22, 0x44, 0x22, 0x22, 0x2C, 0xC2, 0x22, 0x22, 0x25, 0x22, 0x23, 0x42, 0x44, 0x42, 
-    0x22, 0x22, 0x44, 0x33, 0x22, 0x22, 0x22, 0xB4, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x2B, 0x22, 0x22, 0x2B, 0xB2, 0x42, 0x22, 0x22, 0x22, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x2B, 0xB2, 
+const uint8_t STORY_CH1_ENEMY_RLE[STORY_CH1_ENEMY_RLE_SIZE] = {
+    0xF1, 0x5D, 0xF0, 0x11, 0xF1, 0x5C, 0xF0, 0x10, 0x01, 0x99, 0xF1, 0x58, 0xF0, 0x0F, 0xD9, 0xF1, 
+    0x54, 0xF0, 0x13, 0x7F, 0xF1, 0x17, 0xF0, 0x14, 0xF9, 0x00, 0xF1, 0x4F, 0xF0, 0x16, 0x7F, 0xF1, 
+    0x13, 0x01, 0x01, 0xF0, 0x17, 0xF9, 0x01, 0xF1, 0x32, 0x04, 0xAA, 0x00, 0x00, 0xF1, 0x0A, 0xF0, 
+    0x11, 0x06, 0x99, 0x90, 0x99, 0x90, 0x7F, 0xB1, 0x07, 0xAA, 0xA5, 0xBA, 0x00, 0xF1, 0x03, 0xF0, 
+    0x0B, 0x00, 0x90, 0xA6, 0x02, 0x90, 0x00, 0xB9, 0xB6, 0x00, 0x90, 0x7F, 0xA1, 0x08, 0x00, 0x0A, 
+    0x55, 0xB3, 0x00, 0xF1, 0x01, 0xF0, 0x0A, 0x01, 0x66, 0xC7, 0xE6, 0xA7, 0x00, 0x60, 0xF9, 0x02, 
+    0xF1, 0x34, 0x0D, 0x0A, 0x5B, 0x43, 0x01, 0x10, 0x10, 0x11, 0xF0, 0x08, 0x02, 0x96, 0x60, 0xF7, 
+    0x0E, 0xA6, 0x05, 0x96, 0x69, 0x96, 0xF1, 0x35, 0x07, 0x05, 0xB4, 0x48, 0x01, 0xF0, 0x0B, 0x00, 
+    0x90, 0xA6, 0xF7, 0x11, 0xD6, 0xF1, 0x33, 0x0B, 0x01, 0x0A, 0xB4, 0x43, 0x80, 0x01, 0xF0, 0x0D, 
+    0x02, 0x99, 0x90, 0xB6, 0xF7, 0x11, 0xF1, 0x34, 0x07, 0x01, 0xB2, 0x44, 0x33, 0xF0, 0x15, 0x03, 
+    0x99, 0x69, 0xC6, 0x7F, 0xF1, 0x04, 0x05, 0x01, 0x0A, 0xBB, 0x42, 0x00, 0xC0, 0xF0, 0x18, 0xB9, 
+    0xD6, 0x7F, 0xB1, 0x0D, 0x01, 0x10, 0xA5, 0xBB, 0x24, 0x43, 0xC8, 0xF0, 0x11, 0x04, 0x99, 0x90, 
+    0x00, 0xF9, 0x03, 0xD6, 0x79, 0x06, 0x01, 0x11, 0x00, 0x00, 0x43, 0x06, 0x22, 0x43, 0xCC, 0x30, 
+    0xF0, 0x10, 0xF9, 0x0D, 0xF6, 0x00, 0x73, 0xC1, 0x04, 0x00, 0x0B, 0xB0, 0xA2, 0x03, 0x4C, 0xCC, 
+    0xF0, 0x15, 0xF9, 0x09, 0xF6, 0x00, 0xF1, 0x2B, 0x08, 0x00, 0x01, 0x00, 0x0A, 0xB0, 0xE5, 0x02, 
+    0x22, 0x30, 0xF0, 0x0C, 0xF9, 0x11, 0x78, 0xE0, 0x00, 0xA0, 0xF5, 0x05, 0x01, 0xB4, 0x6A, 0xF6, 
+    0x01, 0xF1, 0x23, 0xF0, 0x03, 0xF5, 0x0A, 0xF0, 0x0C, 0xB9, 0x00, 0x00, 0x7D, 0xF0, 0x09, 0x10, 
+    0xB5, 0x55, 0xEE, 0x55, 0xEB, 0xB5, 0xE5, 0xB5, 0xE0, 0xA5, 0x00, 0x30, 0xF0, 0x0B, 0x02, 0x90, 
+    0x00, 0xF9, 0x08, 0xF6, 0x02, 0xF1, 0x19, 0xF0, 0x0C, 0xC5, 0x09, 0xBE, 0xEB, 0xAA, 0xE5, 0x44, 
+    0xB5, 0x00, 0x40, 0xF0, 0x0A, 0x02, 0x99, 0x90, 0x4C, 0x02, 0x69, 0x90, 0xF6, 0x03, 0xF1, 0x0F, 
+    0xB0, 0x01, 0x11, 0xF0, 0x0F, 0xC5, 0x02, 0x25, 0x50, 0xAA, 0x08, 0x44, 0x42, 0xBB, 0x55, 0x30, 
+    0x54, 0xF9, 0x05, 0xF6, 0x06, 0xF1, 0x0E, 0xF0, 0x17, 0x00, 0x40, 0xA5, 0x01, 0xB4, 0xBA, 0x08, 
+    0x44, 0x43, 0x42, 0x42, 0x30, 0xF0, 0x02, 0x03, 0x90, 0x00, 0xD9, 0xD6, 0x02, 0x99, 0x90, 0xF6, 
+    0x0B, 0xF1, 0x0C, 0xA0, 0x03, 0x11, 0x01, 0xF0, 0x13, 0x01, 0x55, 0xAB, 0x46, 0x02, 0x32, 0x30, 
+    0xE0, 0xA9, 0xF6, 0x0A, 0x02, 0x00, 0x00, 0xF7, 0x03, 0xA6, 0x00, 0x70, 0x52, 0xF0, 0x20, 0x0F, 
+    0x4B, 0xBA, 0x55, 0xBB, 0xBA, 0xBB, 0x88, 0x38, 0x49, 0xF6, 0x09, 0xC0, 0xF7, 0x0A, 0x02, 0x11, 
+    0x10, 0xF0, 0x2F, 0x0B, 0x44, 0x4A, 0xB5, 0x55, 0xBB, 0x30, 0x49, 0xA0, 0x02, 0x99, 0x90, 0xF6, 
+    0x00, 0x06, 0x77, 0x00, 0x03, 0x30, 0xA0, 0x00, 0x80, 0xF7, 0x09, 0xF0, 0x31, 0x0D, 0x33, 0x42, 
+    0x2B, 0xBA, 0xA4, 0x43, 0x88, 0xF0, 0x08, 0x0A, 0x96, 0x66, 0x77, 0x88, 0x33, 0x30, 0xA2, 0x04, 
+    0x43, 0x30, 0x80, 0xF7, 0x0A, 0xF0, 0x16, 0x06, 0x33, 0x34, 0x33, 0x30, 0xF0, 0x0D, 0x01, 0x34, 
+    0xBB, 0x00, 0x20, 0x4B, 0xF9, 0x00, 0x05, 0x66, 0x08, 0xCC, 0xA2, 0x00, 0xD0, 0x42, 0x02, 0x08, 
+    0x80, 0xF7, 0x0B, 0xF0, 0x15, 0x02, 0x34, 0x40, 0xD2, 0x01, 0x33, 0xF0, 0x0B, 0x00, 0xA0, 0x47, 
+    0x00, 0x80, 0xA0, 0xC9, 0x02, 0x66, 0x60, 0xB0, 0x00, 0xC0, 0xE2, 0x42, 0x00, 0x30, 0xA0, 0x6F, 
+    0x01, 0x44, 0xC2, 0x01, 0xDD, 0xA2, 0x01, 0x44, 0xF0, 0x01, 0x12, 0x90, 0x00, 0x4B, 0xB5, 0x55, 
+    0xBB, 0xB4, 0x33, 0xCC, 0xC0, 0xE8, 0x05, 0x38, 0x8C, 0xC3, 0xF2, 0x01, 0x00, 0xD0, 0x44, 0x01, 
+    0x88, 0x7A, 0x00, 0xD0, 0xD2, 0x03, 0x43, 0x43, 0xA0, 0x06, 0x43, 0x34, 0xB2, 0x20, 0xDB, 0x11, 
+    0x22, 0x3C, 0xCC, 0x0C, 0x02, 0x2C, 0xC2, 0x2C, 0xF0, 0xE2, 0x01, 0xD2, 0xBD, 0x42, 0x00, 0x00, 
+    0xF7, 0x04, 0x03, 0x67, 0x66, 0x5F, 0x08, 0x04, 0xB5, 0xDD, 0xD2, 0x20, 0xAD, 0xB2, 0x00, 0xD0, 
+    0xA5, 0x01, 0xB2, 0xA5, 0x08, 0x22, 0x42, 0x4B, 0x22, 0xB0, 0xA2, 0x02, 0xC0, 0xF0, 0xD2, 0x04, 
+    0xF2, 0xD2, 0x00, 0xF2, 0x02, 0xBD, 0x01, 0x30, 0x51, 0xA7, 0xF0, 0x15, 0x02, 0x34, 0xB0, 0xA5, 
+    0x00, 0xD0, 0x43, 0xFD, 0x01, 0xD5, 0x0F, 0x22, 0x4B, 0x22, 0xB5, 0x22, 0x25, 0x30, 0x2F, 0xB2, 
+    0x0E, 0xF2, 0xDD, 0x2F, 0x22, 0x2D, 0x22, 0xDD, 0xD0, 0x42, 0x03, 0x2D, 0xD8, 0xF7, 0x0F, 0x5D, 
+    0x01, 0xA4, 0xB5, 0xFD, 0x04, 0x00, 0x50, 0x46, 0x0D, 0xD5, 0x54, 0x2B, 0x55, 0xB2, 0xB5, 0x20, 
+    0xD2, 0x43, 0x03, 0x22, 0x2D, 0x45, 0x06, 0xDD, 0xD2, 0x52, 0x00, 0x74, 0x01, 0x03, 0x44, 0x00, 
+    0x50, 0x4C, 0x00, 0xD0, 0xB5, 0x0C, 0xDD, 0x55, 0xB2, 0x5B, 0xBB, 0x44, 0x40, 0x44, 0x00, 0xF0, 
+    0xA2, 0x44, 0x06, 0x52, 0x2D, 0xDD, 0x20, 0x42, 0x04, 0xD5, 0x07, 0x60, 0x74, 0x01, 0x00, 0xD5, 
+    0x50, 0x1F, 0x22, 0xDD, 0x52, 0x25, 0x44, 0xB2, 0x34, 0x2F, 0x2F, 0x22, 0xC2, 0x22, 0xF2, 0xDD, 
+    0x22, 0xDD, 0x43, 0x07, 0xD5, 0x52, 0x43, 0x87, 0xD6, 0x71, 0x00, 0x40, 0xE5, 0xAD, 0x00, 0x50, 
+    0x43, 0x03, 0x55, 0x5D, 0x42, 0x01, 0x22, 0x44, 0x07, 0x22, 0x24, 0x22, 0x2C, 0x44, 0x00, 0x20, 
+    0x43, 0x02, 0x5D, 0x20, 0xAD, 0x05, 0x40, 0x08, 0x77, 0xF6, 0x01, 0x70, 0xA0, 0x02, 0x44, 0xB0, 
+    0xB5, 0x02, 0xDD, 0xD0, 0xD5, 0x03, 0xD5, 0x5D, 0x42, 0x09, 0xBB, 0x5A, 0xAB, 0x22, 0xB5, 0xB2, 
+    0x01, 0xCF, 0xD2, 0x07, 0xDD, 0x22, 0xDD, 0x20, 0xA7, 0xF6, 0x0B, 0x6C, 0xC0, 0x06, 0x42, 0x55, 
+    0x5D, 0xD0, 0x46, 0x00, 0x50, 0x42, 0x02, 0x5B, 0x50, 0xA4, 0x08, 0xA5, 0x52, 0x2D, 0x22, 0xF0, 
+    0x46, 0x08, 0x52, 0x2D, 0x23, 0x87, 0x00, 0xF6, 0x15, 0x6B, 0xA0, 0x00, 0xB0, 0xD5, 0x47, 0x1C, 
+    0xA5, 0x40, 0x34, 0xAB, 0x52, 0x25, 0x2F, 0x20, 0x2D, 0x22, 0xF2, 0xDD, 0xD2, 0x40, 0x70, 0xF6, 
+    0x1A, 0xF0, 0x25, 0x02, 0x90, 0x30, 0x48, 0x04, 0x52, 0x25, 0xA0, 0x43, 0x00, 0xA0, 0x43, 0x0F, 
+    0xD2, 0xC2, 0x0F, 0x2D, 0x2F, 0x25, 0x20, 0x07, 0xF6, 0x1C, 0xF0, 0x29, 0x06, 0xB5, 0xD5, 0x5D, 
+    0xD0, 0xC5, 0x46, 0x08, 0xA5, 0xDD, 0x25, 0x00, 0xC0, 0x42, 0x04, 0x22, 0x20, 0x70, 0xF6, 0x1C, 
+    0x01, 0x77, 0xF0, 0x2A, 0x00, 0x20, 0x53, 0x07, 0x2D, 0x2D, 0x20, 0xC2, 0x42, 0x02, 0xF0, 0x90, 
+    0xC0, 0x01, 0x99, 0xE6, 0xA9, 0x02, 0x69, 0x90, 0xF6, 0x08, 0xF0, 0x2A, 0x01, 0x35, 0x48, 0x00, 
+    0xB0, 0x47, 0x06, 0x42, 0xD2, 0x22, 0x00, 0x43, 0x00, 0xC0, 0xF0, 0x19, 0x03, 0x96, 0x69, 0xF0, 
+    0x27, 0x01, 0x11, 0xB0, 0x00, 0x40, 0x48, 0x03, 0xBB, 0xAB, 0x44, 0x02, 0xA4, 0x00, 0xA2, 0x00, 
+    0x00, 0xB2, 0x02, 0xC0, 0x10, 0xF0, 0x1F, 0x02, 0x10, 0xA0, 0xA0, 0xF1, 0x0E, 0xF0, 0x01, 0xF1, 
+    0x02, 0x00, 0xA0, 0x45, 0x10, 0xDD, 0x5A, 0xAA, 0xB3, 0x04, 0xA4, 0x44, 0xB0, 0x00, 0x44, 0x03, 
+    0xD2, 0x20, 0x47, 0x00, 0x10, 0xF0, 0x17, 0xEA, 0x06, 0x11, 0x10, 0x01, 0x10, 0xB0, 0x03, 0xAA, 
+    0xA0, 0x49, 0x00, 0x30, 0xD0, 0x4F, 0x00, 0x50, 0x43, 0x09, 0x40, 0x4B, 0xA4, 0x45, 0x2C, 0xB2, 
+    0x04, 0xD2, 0x22, 0xF0, 0xB0, 0x00, 0x10, 0xF0, 0x1B, 0xFA, 0x0B, 0xD0, 0x02, 0x10, 0x30, 0x4B, 
+    0xA0, 0x03, 0x11, 0x10, 0x46, 0x00, 0x20, 0x45, 0x00, 0x30, 0xA4, 0x07, 0x3A, 0x22, 0x02, 0xFF, 
+    0x43, 0x07, 0x2C, 0x00, 0x01, 0xA1, 0xF0, 0x19, 0xFA, 0x14, 0xB3, 0x03, 0x4A, 0xAA, 0xC3, 0xA0, 
+    0xA3, 0x00, 0xB0, 0x45, 0x00, 0xB0, 0x46, 0x0C, 0xAA, 0x30, 0x03, 0xB2, 0x22, 0xFC, 0xC0, 0xB2, 
+    0x06, 0xC0, 0x01, 0xAA, 0xA0, 0xF0, 0x18, 0xFA, 0x06, 0xAB, 0xFA, 0x07, 0x11, 0xBB, 0xBA, 0xA4, 
+    0x4A, 0xA4, 0x43, 0x44, 0x4A, 0xA4, 0x46, 0x02, 0x55, 0xB0, 0x43, 0x07, 0x4A, 0xBA, 0x48, 0x0A, 
+    0xA2, 0x47, 0x04, 0x44, 0x4A, 0x30, 0xF0, 0x17, 0xF3, 0x09, 0x05, 0x43, 0x43, 0x33, 0xC4, 0xB3, 
+    0xC4, 0x02, 0x33, 0x40, 0xF3, 0x01, 0xA5, 0x42, 0x00, 0xE0, 0x4A, 0x09, 0x03, 0xAB, 0x22, 0x2F, 
+    0xC0, 0xB2, 0x00, 0xC0, 0xB3, 0xC0, 0xF3, 0x14, 0xF8, 0x29, 0x44, 0x04, 0x55, 0x5E, 0xB0, 0x48, 
+    0x04, 0xA0, 0x3A, 0x50, 0xA2, 0x01, 0xCC, 0x44, 0xCC, 0xE3, 0x00, 0xC0, 0xF3, 0x02, 0x02, 0xCC, 
+    0xC0, 0x7B, 0x00, 0x40, 0x4F, 0x01, 0x4A, 0x42, 0x00, 0x40, 0x44, 0x0E, 0x02, 0x22, 0xFF, 0xCC, 
+    0xC8, 0x8C, 0xC8, 0xC0, 0xA3, 0x03, 0xC3, 0x3C, 0xF3, 0x03, 0x01, 0xCC, 0x49, 0x00, 0xC0, 0xF8, 
+    0x01, 0x00, 0xC0, 0xF8, 0x02, 0x00, 0xC0, 0xD8, 0x00, 0xC0, 0x59, 0x00, 0x50, 0xAA, 0x45, 0x04, 
+    0x33, 0x4E, 0x50, 0x42, 0x00, 0xC0, 0xA2, 0x01, 0xFC, 0xF8, 0x00, 0x07, 0xCC, 0xC8, 0x33, 0x3C, 
+    0xF3, 0x0E, 0x02, 0x83, 0x30, 0xE8, 0x02, 0xC3, 0xC0, 0xA8, 0x00, 0xC0, 0x44, 0x02, 0x3C, 0x30, 
+    0x43, 0x02, 0xC3, 0x30, 0xF8, 0x05, 0x00, 0x20, 0x47, 0x00, 0xE0, 0x44, 0x07, 0xAA, 0xBA, 0xA0, 
+    0x3A, 0x43, 0x00, 0x20, 0x45, 0x06, 0xC8, 0xCC, 0x88, 0x80, 0xBC, 0x08, 0x3C, 0x33, 0x3C, 0x33, 
+    0xC0, 0xA3, 0x00, 0xC0, 0xF3, 0x02, 0x00, 0x40, 0x45, 0x01, 0xCC, 0xA3, 0x42, 0x00, 0xC0, 0xA3, 
+    0x02, 0x88, 0xC0, 0xB3, 0xB8, 0x05, 0xC3, 0xC8, 0xCC, 0xA8, 0x04, 0x38, 0x8C, 0xC0, 0x42, 0x00, 
+    0xD0, 0xC5, 0x02, 0xEE, 0x50, 0xAB, 0x00, 0xA0, 0x44, 0x03, 0x45, 0xEE, 0xA2, 0x00, 0x00, 0x43, 
+    0x03, 0x0C, 0x88, 0xB3, 0x08, 0xCC, 0x33, 0x3C, 0x83, 0x30, 0xA8, 0xB3, 0x09, 0xCC, 0x33, 0xCC, 
+    0x33, 0xCC, 0xA3, 0x02, 0x83, 0xC0, 0xF3, 0x01, 0x02, 0xCC, 0x80, 0xB3, 0x48, 0x08, 0xCC, 0x3C, 
+    0xC8, 0x8C, 0xC0, 0x44, 0x03, 0x8C, 0xCC, 0xAD, 0x01, 0x5D, 0x43, 0x01, 0xE5, 0x47, 0x09, 0x3A, 
+    0xEE, 0xE5, 0x22, 0x2F, 0xB2, 0x02, 0x0C, 0xC0, 0x43, 0x0D, 0x8C, 0x33, 0xC8, 0x8C, 0xCC, 0x88, 
+    0x8C, 0xF3, 0x01, 0x00, 0x80, 0xE3, 0x01, 0xCC, 0x49, 0x0A, 0x33, 0x88, 0x8C, 0x3C, 0x88, 0xC0, 
+    0x45, 0x02, 0x8C, 0x30, 0xA8, 0x02, 0xC3, 0xC0, 0xC8, 0x04, 0xCC, 0x3D, 0x20, 0xAD, 0x45, 0x0E, 
+    0x55, 0x5B, 0xBA, 0x5B, 0x43, 0xAB, 0x5E, 0xE0, 0xF2, 0x00, 0x43, 0x05, 0xC8, 0x88, 0xC3, 0xA8, 
+    0x00, 0x30, 0xA8, 0x00, 0xC0, 0xF3, 0x03, 0x00, 0xC0, 0xB3, 0x11, 0x23, 0x3C, 0x3C, 0x33, 0x3C, 
+    0x3C, 0x33, 0x3C, 0x33, 0xE8, 0x10, 0x44, 0x3C, 0x33, 0x8C, 0xCC, 0x88, 0x8C, 0xC3, 0x30, 0xC8, 
+    0x05, 0x33, 0x42, 0x22, 0x47, 0x01, 0xBB, 0x42, 0x0A, 0xBB, 0xA3, 0x80, 0xAB, 0xEE, 0x50, 0x49, 
+    0x03, 0xC8, 0x33, 0x42, 0x0B, 0xCC, 0xC8, 0xC3, 0x8C, 0xCC, 0x34, 0xC3, 0x05, 0xC3, 0x33, 0x8C, 
+    0xA3, 0x03, 0xB4, 0x33, 0x45, 0x07, 0x33, 0xC3, 0x88, 0x3C, 0xB8, 0x03, 0x33, 0xB2, 0xA3, 0x02, 
+    0x83, 0x30, 0xAC, 0x04, 0x33, 0x3C, 0xC0, 0xA8, 0x00, 0xC0, 0x43, 0xAD, 0x43, 0x11, 0x5A, 0xAB, 
+    0xBA, 0xA4, 0x44, 0x30, 0x84, 0xB5, 0xEE, 0x49, 0x05, 0x8C, 0x43, 0xCC, 0xC3, 0x06, 0x83, 0x3C, 
+    0xCC, 0x40, 0x42, 0x00, 0xC0, 0xB3, 0x02, 0x88, 0x80, 0xA3, 0x00, 0x20, 0x42, 0xC3, 0x19, 0x43, 
+    0x33, 0xCC, 0x33, 0xCC, 0xC3, 0x33, 0x4B, 0x43, 0x33, 0x88, 0x33, 0x8C, 0xE3, 0x06, 0x83, 0x33, 
+    0x43, 0x20, 0x49, 0x00, 0xB0, 0x43, 0x0C, 0xB4, 0x40, 0x33, 0x00, 0xAA, 0x5E, 0xB0, 0xE2, 0x02, 
+    0xCC, 0xC0, 0xD3, 0x0C, 0x43, 0x33, 0xCC, 0x3C, 0x33, 0x44, 0x40, 0xE3, 0x01, 0x8C, 0xC3, 0x49, 
+    0x00, 0x40, 0xE3, 0x42, 0x00, 0x20, 0x43, 0x04, 0xCC, 0x33, 0xC0, 0xA3, 0x00, 0x40, 0xD3, 0x00, 
+    0x40, 0x43, 0x02, 0x5D, 0x50, 0x42, 0x01, 0x5E, 0xDB, 0x01, 0x43, 0x43, 0x04, 0x4A, 0xBE, 0x50, 
+    0x4F, 0x01, 0x42, 0xB3, 0x07, 0xC3, 0x44, 0x24, 0x44, 0xD3, 0x00, 0xC0, 0xE3, 0x0D, 0x43, 0x32, 
+    0x23, 0x33, 0x42, 0x3C, 0x34, 0x47, 0x01, 0x4B, 0xB3, 0x02, 0xCC, 0x40, 0xA3, 0x00, 0x40, 0x44, 
+    0x04, 0x42, 0x24, 0x40, 0x42, 0xE5, 0x49, 0x07, 0x40, 0x03, 0x4B, 0x5B, 0xF2, 0x00, 0x48, 0x0B, 
+    0x43, 0x33, 0x43, 0x44, 0x42, 0x33, 0x42, 0x00, 0x40, 0xF3, 0x03, 0x1E, 0x43, 0x42, 0x24, 0x34, 
+    0x22, 0x43, 0x34, 0x43, 0x33, 0x44, 0x43, 0x34, 0x23, 0x43, 0x43, 0x30, 0x47, 0x05, 0x42, 0x24, 
+    0x2B, 0xC2, 0x03, 0xD5, 0x5D, 0xA5, 0x01, 0xBA, 0x45, 0x09, 0x00, 0x03, 0x03, 0x34, 0xAB, 0xF2, 
+    0x01, 0x00, 0xC0, 0xA3, 0x04, 0x43, 0x33, 0x40, 0x43, 0x06, 0x44, 0x33, 0x24, 0xC0, 0xA3, 0x49, 
+    0x0A, 0x43, 0x44, 0x42, 0x42, 0x42, 0x20, 0xA4, 0x17, 0x34, 0x43, 0x42, 0x44, 0x43, 0x43, 0x34, 
+    0x44, 0x33, 0x34, 0x33, 0x44, 0xD2, 0x00, 0xB0, 0x44, 0x01, 0xB5, 0x45, 0x00, 0xA0, 0x4E, 0xA4, 
+    0xC2, 0x01, 0x02, 0xA3, 0x00, 0x40, 0x45, 0x08, 0xC3, 0x44, 0x33, 0x34, 0x40, 0xF3, 0x02, 0x04, 
+    0x43, 0x33, 0x40, 0x43, 0x08, 0x42, 0x24, 0x24, 0x44, 0x20, 0xB4, 0x00, 0x20, 0xC4, 0x03, 0x34, 
+    0x42, 0x42, 0x0C, 0x24, 0x2B, 0xBB, 0x22, 0xB2, 0x22, 0x50, 0xC2, 0xF5, 0x00, 0x04, 0xAA, 0xBA, 
+    0xA0, 0x42, 0x05, 0x38, 0x03, 0x00, 0xC4, 0x01, 0x5D, 0xA2, 0x04, 0x33, 0x44, 0x30, 0xE4, 0x42, 
+    0x01, 0x3C, 0x47, 0x03, 0x44, 0x34, 0xC3, 0x03, 0x24, 0x33, 0x43, 0x04, 0x22, 0x44, 0x20, 0x44, 
+    0xC4, 0x01, 0x23, 0xA2, 0x06, 0x43, 0x42, 0x2B, 0xB0, 0xB2, 0x01, 0x43, 0xF2, 0x01, 0x46, 0x03, 
+    0x4B, 0x44, 0x44, 0x05, 0x33, 0x88, 0x43, 0x43, 0x00, 0x50, 0x43, 0x0B, 0xC4, 0x44, 0x24, 0x43, 
+    0x44, 0x42, 0xB3, 0x45, 0x12, 0x43, 0x34, 0x24, 0x42, 0x43, 0x33, 0x42, 0x44, 0x32, 0x40, 0xB2, 
+    0xD4, 0x02, 0x24, 0x30, 0x44, 0x06, 0x42, 0x24, 0x22, 0x30, 0xB2, 0x06, 0x44, 0x2B, 0x24, 0x40, 
+    0xF2, 0x02, 0x00, 0xB0, 0xB5, 0x00, 0x40, 0x44, 0x00, 0x40, 0x43, 0x08, 0xC3, 0x44, 0x34, 0x44, 
+    0xB0, 0x42, 0x0D, 0x33, 0x32, 0x42, 0x24, 0x34, 0x32, 0x44, 0xF3, 0x01, 0x05, 0x22, 0x24, 0x43, 
+    0xC2, 0x06, 0x43, 0x22, 0x32, 0x40, 0x44, 0xC4, 0x02, 0x34, 0x20, 0xC4, 0xA2, 0xA4, 0x04, 0x22, 
+    0x42, 0xB0, 0x42, 0xB2, 0x00, 0x40, 0xB2, 0x00, 0xB0, 0xB2, 0x44, 0x00, 0x20, 0xD4, 0x00, 0xC0, 
+    0x46, 0x01, 0x24, 0xB2, 0x02, 0x44, 0x40, 0x42, 0x00, 0x30, 0x42, 0x04, 0x24, 0x33, 0xC0, 0x48, 
+    0x04, 0x24, 0x43, 0x40, 0xB2, 0x04, 0x34, 0x43, 0x40, 0xD2, 0x01, 0x43, 0x46, 0x02, 0x24, 0x40, 
+    0xC2, 0x02, 0x44, 0x30, 0x45, 0x00, 0x30, 0x46, 0x00, 0x40, 0x43, 0x05, 0x55, 0x52, 0x22, 0x42, 
+    0x00, 0x30, 0xE4, 0xC3, 0x0A, 0x44, 0x42, 0x22, 0x33, 0x43, 0x20, 0x44, 0x04, 0xC3, 0x44, 0x40, 
+    0x43, 0x00, 0xC0, 0x4A, 0x00, 0xC0, 0x44, 0x03, 0x43, 0x34, 0xE2, 0xC4, 0x05, 0xC4, 0x22, 0x24, 
+    0xD2, 0x08, 0x33, 0x44, 0x42, 0x42, 0x20, 0x47, 0x00, 0x30, 0x43, 0xA5, 0xB2, 0x07, 0x54, 0x32, 
+    0x24, 0x43, 0x46, 0x06, 0xC4, 0x42, 0x24, 0x40, 0x42, 0x00, 0x40, 0x44, 0x03, 0x32, 0x22, 0xA4, 
+    0xF3, 0x00, 0x05, 0x42, 0x24, 0x4B, 0x48, 0xF2, 0x00, 0x01, 0x42, 0x43, 0xC2, 0x04, 0x42, 0x22, 
+    0x40, 0xA2, 0x02, 0x34, 0x40, 0x47, 0x04, 0x42, 0x23, 0x30, 0x46, 0x01, 0xB5, 0x45, 0xB4, 0x00, 
+    0x30, 0xC4, 0x01, 0x33, 0x42, 0x07, 0x33, 0x32, 0x43, 0x22, 0x42, 0x00, 0x40, 0x45, 0x05, 0x43, 
+    0x33, 0x42, 0xA4, 0xB2, 0x00, 0x30, 0xC2, 0x42, 0x02, 0xB2, 0xB0, 0xD2, 0x04, 0x43, 0x24, 0x30, 
+    0x55, 0x00, 0x30, 0xA4, 0x02, 0x22, 0x40, 0x43, 0x04, 0x22, 0x55, 0x50, 0xA2, 0x00, 0xB0, 0x45, 
+    0x00, 0x30, 0x43, 0x06, 0x22, 0x33, 0x2B, 0xB0, 0xA4, 0x04, 0x24, 0x22, 0x40, 0xA2, 0x00, 0x30, 
+    0x42, 0x05, 0x24, 0x22, 0x44, 0xA2, 0x03, 0x44, 0x24, 0xF2, 0x03, 0x04, 0x33, 0xBB, 0xB0, 0xE2, 
+    0x01, 0x44, 0x47, 0x0C, 0x22, 0x24, 0x22, 0x44, 0x23, 0x34, 0x30, 0x42, 0x03, 0x44, 0x33, 0x50, 
+    0x02, 0x24, 0xC0, 0x44, 0xA4, 0x09, 0x22, 0x24, 0x32, 0xB2, 0x44, 0xD2, 0x05, 0x42, 0x22, 0x44, 
+    0xF2, 0x03, 0x06, 0xB2, 0x32, 0x2B, 0xB0, 0xF2, 0x01, 0x03, 0x44, 0xB5, 0x48, 0x03, 0x22, 0x44, 
+    0xF2, 0x07, 0x0F, 0x33, 0x32, 0x24, 0x34, 0x22, 0x3C, 0x22, 0x24, 0x4F, 0x07, 0x24, 0x33, 0x44, 
+    0x42, 0x42, 0x03, 0x23, 0x25, 0x4B, 0x01, 0xB2, 0x4B, 0x00, 0x20, 0x42, 0x00, 0x20, 0x49, 0x04, 
+    0x22, 0xBB, 0x50, 0xF2, 0x02, 0x00, 0x40, 0xC2, 0x03, 0x42, 0x44, 0x4C, 0xC2, 0x00, 0x30, 0xF2, 
+    0x00, 0x01, 0x5B, 0xA2, 0x01, 0x43, 0x42, 0x02, 0xC3, 0x20, 0x48, 0x00, 0xB0, 0x48, 0xB2, 0x4C, 
+    0x06, 0xB2, 0x32, 0x2B, 0xB0, 0x4B, 0xF2, 0x0C, 0x04, 0x44, 0xB2, 0x40, 0x43, 0x0D, 0xC4, 0x22, 
+    0x24, 0x22, 0x42, 0xB2, 0x23, 0x47, 0x10, 0x22, 0x24, 0x24, 0x33, 0x44, 0x24, 0x34, 0x43, 0x40, 
+    0x55, 0xF2, 0x06, 0x01, 0x52, 0x56, 0x00, 0x40, 0xD2, 0x12, 0xBB, 0x22, 0x42, 0x44, 0x24, 0x32, 
+    0x42, 0x23, 0x83, 0x40, 0x42, 0x01, 0x43, 0xA2, 0x01, 0x33, 0x49, 0x00, 0x30, 0xB4, 0xB2, 0x02, 
+    0x44, 0x30, 0x45, 0x02, 0x52, 0x40, 0xF2, 0x10, 0x03, 0x42, 0x2B, 0xA2, 0x49, 0x01, 0xB5, 0xE2, 
+    0x02, 0x34, 0x40, 0x44, 0x03, 0x22, 0x44, 0xA2, 0x07, 0x44, 0x43, 0x22, 0x3C, 0x42, 0x03, 0x22, 
+    0x44, 0xB2, 0x01, 0xCC, 0x4A, 0x00, 0x20, 0x49, 0x00, 0x30, 0xC2, 0x01, 0xB4, 0x4F, 0x00, 0xB0, 
+    0xB2, 0x01, 0xBB, 0x42, 0xB2, 0x4A, 0x01, 0xB2, 
+};
+
+const gfx_image_t STORY_CH1_ENEMY_IMG = {
+    .w = STORY_CH1_ENEMY_W, .h = STORY_CH1_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH1_ENEMY_PAL, .colors = STORY_CH1_ENEMY_PAL_SIZE,
+    .data = STORY_CH1_ENEMY_RLE, .size = STORY_CH1_ENEMY_RLE_SIZE,
 };
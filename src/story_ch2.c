@@ -6,293 +6,239 @@ const uint16_t STORY_CH2_PAL[STORY_CH2_PAL_SIZE] = {
     0xDE56, 0xACD1, 0xE8B5, 0xF14B, 0x5D75, 0xDA8A, 0x2D54, 0x596B, 
 };
 
-const uint8_t STORY_CH2_IDX[(STORY_CH2_W * STORY_CH2_H) / 2] = {
-    0x88, 0x88, 0x42, 0x23, 0x24, 0x04, 0x42, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 
-    0x00, 0x30, 0x00, 0x12, 0x00, 0x03, 0x13, 0x00, 0x00, 0x00, 0x21, 0x11, 0x14, 0x59, 0x99, 0x98, 
-    0x78, 0x97, 0x77, 0x77, 0x99, 0x14, 0x11, 0x11, 0x11, 0x11, 0x95, 0x15, 0x11, 0x51, 0x30, 0x54, 
-    0x30, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x02, 0x02, 0x12, 0x00, 0x00, 0x02, 0x22, 
-    0x05, 0x87, 0x42, 0x23, 0x24, 0x24, 0x44, 0x30, 0x00, 0x02, 0x30, 0x00, 0x00, 0x33, 0x10, 0x00, 
-    0x00, 0x30, 0x00, 0x23, 0x00, 0x31, 0x30, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x59, 0x99, 0x97, 
-    0x77, 0x97, 0x77, 0x77, 0x99, 0x44, 0x44, 0x11, 0x11, 0x11, 0x19, 0x54, 0x11, 0x51, 0x20, 0x45, 
-    0x30, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x03, 0x34, 0x44, 0x20, 0x00, 0x01, 0x22, 
-    0x02, 0x05, 0x42, 0x33, 0x22, 0x15, 0x55, 0x30, 0x00, 0x02, 0x20, 0x00, 0x00, 0x33, 0x10, 0x00, 
-    0x00, 0x20, 0x00, 0x33, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x11, 0x11, 0x14, 0x59, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x99, 0x95, 0x54, 0x44, 0x11, 0x11, 0x15, 0x95, 0x11, 0x51, 0x20, 0x15, 
-    0x33, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x53, 0x00, 0x03, 0x24, 0x44, 0x20, 0x00, 0x01, 0x11, 
-    0x02, 0x47, 0x42, 0x23, 0x22, 0x47, 0x77, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x33, 0x10, 0x00, 
-    0x00, 0x20, 0x00, 0x20, 0x03, 0x20, 0x10, 0x00, 0x22, 0x11, 0x11, 0x11, 0x14, 0x55, 0x99, 0x99, 
-    0x77, 0x77, 0x77, 0x77, 0x99, 0x99, 0x95, 0x55, 0x54, 0x44, 0x94, 0x45, 0x14, 0x41, 0x20, 0x19, 
-    0x22, 0x00, 0x17, 0x30, 0x00, 0x00, 0x01, 0x73, 0x00, 0x03, 0x24, 0x44, 0x10, 0x00, 0x02, 0x22, 
-    0x40, 0x07, 0x42, 0x23, 0x44, 0x58, 0x77, 0x10, 0x00, 0x02, 0x23, 0x00, 0x00, 0x33, 0x10, 0x00, 
-    0x03, 0x20, 0x03, 0x20, 0x03, 0x00, 0x30, 0x02, 0x30, 0x00, 0x02, 0x22, 0x11, 0x11, 0x14, 0x55, 
-    0x99, 0x99, 0x99, 0x95, 0x54, 0x41, 0x11, 0x11, 0x11, 0x11, 0x44, 0x15, 0x11, 0x51, 0x20, 0x19, 
-    0x22, 0x00, 0x17, 0x30, 0x00, 0x30, 0x01, 0x53, 0x00, 0x03, 0x14, 0x44, 0x40, 0x03, 0x01, 0x50, 
-    0x33, 0x27, 0x42, 0x23, 0x45, 0x78, 0x78, 0x40, 0x00, 0x02, 0x22, 0x00, 0x00, 0x33, 0x10, 0x00, 
-    0x03, 0x20, 0x03, 0x20, 0x02, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01, 0x11, 0x14, 0x14, 0x55, 
-    0x99, 0x99, 0x99, 0x55, 0x95, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x15, 0x12, 0x54, 0x20, 0x19, 
-    0x22, 0x00, 0x17, 0x30, 0x00, 0x30, 0x01, 0x53, 0x00, 0x03, 0x11, 0x14, 0x40, 0x03, 0x02, 0x92, 
-    0x00, 0x05, 0x42, 0x23, 0x49, 0x78, 0x88, 0x40, 0x00, 0x02, 0x14, 0x30, 0x00, 0x33, 0x10, 0x00, 
-    0x33, 0x20, 0x03, 0x20, 0x02, 0x00, 0x03, 0x20, 0x00, 0x02, 0x11, 0x11, 0x11, 0x11, 0x95, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0x51, 0x11, 0x11, 0x41, 0x44, 0x15, 0x12, 0x44, 0x20, 0x19, 
-    0x22, 0x00, 0x18, 0x30, 0x00, 0x20, 0x01, 0x53, 0x00, 0x03, 0x11, 0x44, 0x40, 0x03, 0x19, 0x75, 
-    0x00, 0x04, 0x42, 0x23, 0x49, 0x88, 0x88, 0x50, 0x00, 0x02, 0x14, 0x20, 0x03, 0x23, 0x20, 0x00, 
-    0x33, 0x20, 0x03, 0x20, 0x32, 0x00, 0x32, 0x00, 0x00, 0x03, 0x11, 0x11, 0x14, 0x41, 0x59, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x55, 0x41, 0x11, 0x14, 0x44, 0x15, 0x12, 0x14, 0x20, 0x19, 
-    0x22, 0x00, 0x17, 0x30, 0x00, 0x12, 0x01, 0x53, 0x00, 0x32, 0x14, 0x44, 0x40, 0x19, 0x53, 0x95, 
-    0x00, 0x33, 0x32, 0x23, 0x49, 0x88, 0x88, 0x53, 0x00, 0x02, 0x44, 0x10, 0x03, 0x23, 0x10, 0x00, 
-    0x33, 0x20, 0x03, 0x20, 0x32, 0x00, 0x20, 0x00, 0x32, 0x11, 0x11, 0x11, 0x44, 0x55, 0x59, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x54, 0x11, 0x11, 0x54, 0x14, 0x13, 0x14, 0x20, 0x19, 
-    0x22, 0x30, 0x19, 0x30, 0x00, 0x31, 0x01, 0x52, 0x02, 0x23, 0x44, 0x44, 0x55, 0x52, 0x02, 0x94, 
-    0x00, 0x32, 0x00, 0x22, 0x49, 0x08, 0x88, 0x53, 0x30, 0x03, 0x45, 0x43, 0x03, 0x33, 0x10, 0x00, 
-    0x33, 0x20, 0x03, 0x20, 0x32, 0x32, 0x30, 0x00, 0x00, 0x00, 0x01, 0x12, 0x11, 0x11, 0x11, 0x44, 
-    0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x11, 0x11, 0x11, 0x19, 0x45, 0x13, 0x14, 0x20, 0x19, 
-    0x22, 0x20, 0x17, 0x10, 0x03, 0x03, 0x31, 0x52, 0x03, 0x02, 0x44, 0x57, 0x91, 0x03, 0x11, 0x94, 
-    0x00, 0x32, 0x30, 0x03, 0x35, 0x00, 0x88, 0x53, 0x30, 0x03, 0x45, 0x43, 0x03, 0x33, 0x20, 0x00, 
-    0x33, 0x20, 0x03, 0x30, 0x32, 0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0x11, 0x11, 0x11, 
-    0x44, 0x44, 0x44, 0x44, 0x41, 0x55, 0x11, 0x11, 0x11, 0x11, 0x14, 0x95, 0x43, 0x14, 0x20, 0x19, 
-    0x22, 0x00, 0x18, 0x10, 0x02, 0x23, 0x01, 0x71, 0x03, 0x03, 0x49, 0x91, 0x03, 0x11, 0x21, 0x94, 
-    0x00, 0x02, 0x00, 0x00, 0x03, 0x17, 0x00, 0x93, 0x00, 0x03, 0x40, 0x53, 0x03, 0x33, 0x13, 0x00, 
-    0x33, 0x20, 0x02, 0x30, 0x32, 0x20, 0x30, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x11, 0x11, 0x55, 
-    0x99, 0x55, 0x59, 0x44, 0x54, 0x55, 0x11, 0x11, 0x11, 0x11, 0x14, 0x45, 0x43, 0x14, 0x20, 0x19, 
-    0x22, 0x00, 0x18, 0x10, 0x02, 0x22, 0x02, 0x41, 0x00, 0x34, 0x94, 0x22, 0x11, 0x11, 0x14, 0x54, 
-    0x03, 0x03, 0x30, 0x00, 0x21, 0x00, 0x48, 0x92, 0x30, 0x03, 0x57, 0x52, 0x03, 0x33, 0x13, 0x00, 
-    0x33, 0x20, 0x02, 0x30, 0x32, 0x00, 0x30, 0x00, 0x00, 0x02, 0x21, 0x11, 0x11, 0x11, 0x44, 0x59, 
-    0x99, 0x99, 0x95, 0x55, 0x59, 0x95, 0x41, 0x14, 0x44, 0x41, 0x14, 0x15, 0x43, 0x14, 0x20, 0x17, 
-    0x22, 0x03, 0x18, 0x10, 0x01, 0x12, 0x31, 0x11, 0x01, 0x94, 0x22, 0x11, 0x11, 0x11, 0x11, 0x45, 
-    0x00, 0x00, 0x00, 0x00, 0x31, 0x41, 0x03, 0x12, 0x30, 0x00, 0x98, 0x72, 0x03, 0x22, 0x13, 0x00, 
-    0x23, 0x23, 0x02, 0x30, 0x32, 0x00, 0x00, 0x00, 0x33, 0x22, 0x11, 0x11, 0x11, 0x14, 0x55, 0x59, 
-    0x99, 0x99, 0x95, 0x99, 0x99, 0x95, 0x54, 0x55, 0x44, 0x41, 0x14, 0x14, 0x43, 0x14, 0x20, 0x19, 
-    0x22, 0x03, 0x18, 0x10, 0x01, 0x42, 0x21, 0x11, 0x25, 0x12, 0x11, 0x11, 0x11, 0x11, 0x21, 0x45, 
-    0x00, 0x00, 0x00, 0x00, 0x25, 0x14, 0x21, 0x02, 0x20, 0x00, 0x48, 0x72, 0x33, 0x33, 0x13, 0x00, 
-    0x32, 0x23, 0x32, 0x20, 0x32, 0x00, 0x00, 0x00, 0x30, 0x32, 0x01, 0x22, 0x11, 0x11, 0x11, 0x11, 
-    0x44, 0x44, 0x45, 0x54, 0x54, 0x55, 0x14, 0x44, 0x11, 0x11, 0x14, 0x14, 0x42, 0x44, 0x23, 0x19, 
-    0x22, 0x03, 0x18, 0x10, 0x01, 0x41, 0x24, 0x21, 0x02, 0x11, 0x11, 0x11, 0x11, 0x22, 0x01, 0x45, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x11, 0x11, 0x00, 0x00, 0x18, 0x71, 0x33, 0x33, 0x13, 0x00, 
-    0x32, 0x23, 0x32, 0x20, 0x22, 0x33, 0x30, 0x00, 0x30, 0x33, 0x31, 0x11, 0x11, 0x14, 0x44, 0x44, 
-    0x55, 0x95, 0x55, 0x95, 0x55, 0x54, 0x15, 0x54, 0x44, 0x11, 0x14, 0x15, 0x41, 0x54, 0x23, 0x17, 
-    0x22, 0x03, 0x18, 0x10, 0x01, 0x41, 0x14, 0x11, 0x00, 0x11, 0x11, 0x11, 0x13, 0x30, 0x34, 0x45, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x00, 0x00, 0x18, 0x81, 0x33, 0x23, 0x13, 0x03, 
-    0x32, 0x23, 0x30, 0x20, 0x22, 0x33, 0x33, 0x32, 0x32, 0x22, 0x31, 0x11, 0x11, 0x44, 0x44, 0x45, 
-    0x59, 0x95, 0x55, 0x55, 0x55, 0x54, 0x44, 0x41, 0x44, 0x11, 0x44, 0x15, 0x41, 0x54, 0x22, 0x17, 
-    0x22, 0x03, 0x15, 0x20, 0x01, 0x59, 0x54, 0x11, 0x00, 0x11, 0x11, 0x23, 0x21, 0x22, 0x31, 0x55, 
-    0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x03, 0x11, 0x00, 0x00, 0x32, 0x51, 0x23, 0x23, 0x12, 0x03, 
-    0x22, 0x22, 0x20, 0x23, 0x22, 0x32, 0x33, 0x33, 0x22, 0x21, 0x21, 0x21, 0x11, 0x44, 0x44, 0x55, 
-    0x55, 0x55, 0x59, 0x55, 0x95, 0x54, 0x44, 0x41, 0x44, 0x14, 0x44, 0x15, 0x11, 0x54, 0x22, 0x17, 
-    0x22, 0x02, 0x44, 0x20, 0x19, 0x54, 0x15, 0x23, 0x01, 0x11, 0x22, 0x11, 0x12, 0x21, 0x14, 0x55, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x00, 0x03, 0x30, 0x00, 0x31, 0x31, 0x13, 0x33, 0x42, 0x33, 
-    0x23, 0x11, 0x20, 0x22, 0x22, 0x32, 0x33, 0x31, 0x1F, 0x23, 0x21, 0x11, 0x11, 0x44, 0x41, 0x41, 
-    0x11, 0x45, 0x59, 0x55, 0x99, 0x54, 0x44, 0x41, 0x44, 0x44, 0x44, 0x15, 0x41, 0x54, 0x11, 0x17, 
-    0x22, 0x03, 0x45, 0x21, 0x94, 0x44, 0x44, 0x20, 0x11, 0x22, 0x21, 0x12, 0x11, 0x45, 0x94, 0x54, 
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x01, 0x21, 0x30, 0xFA, 0xBB, 0xBB, 0xBB, 0xBB, 0x40, 0x2F, 0xAB, 
-    0xBB, 0xBB, 0xB4, 0x13, 0x22, 0x32, 0x20, 0xAB, 0xBB, 0xB0, 0x31, 0x12, 0x0A, 0xB4, 0x01, 0x1A, 
-    0xB0, 0xC4, 0x55, 0x55, 0x0B, 0xBC, 0x55, 0x0A, 0xB4, 0x00, 0x4A, 0xBD, 0xC1, 0x54, 0x11, 0xAB, 
-    0x60, 0x03, 0x11, 0x1A, 0xBB, 0xBB, 0xC1, 0x00, 0x00, 0x32, 0x11, 0x11, 0x59, 0x95, 0x54, 0x54, 
-    0x00, 0x00, 0x30, 0x33, 0x00, 0x03, 0x22, 0x42, 0x0A, 0x66, 0x66, 0x66, 0x66, 0xDE, 0x3F, 0xA6, 
-    0x66, 0x66, 0x64, 0xE3, 0x22, 0x32, 0x00, 0xA6, 0x66, 0x00, 0x02, 0x12, 0x0A, 0x69, 0xE3, 0xFA, 
-    0x6D, 0x01, 0x44, 0x55, 0x0B, 0x6C, 0xC5, 0x0B, 0x69, 0xC0, 0x4A, 0x6D, 0x01, 0x54, 0x22, 0xA6, 
-    0x60, 0x01, 0x55, 0xFA, 0x66, 0x66, 0x01, 0x00, 0x00, 0x21, 0x11, 0x41, 0x97, 0x55, 0x52, 0x44, 
-    0x00, 0x03, 0x00, 0x32, 0x30, 0x03, 0x33, 0x00, 0xF0, 0x44, 0xD6, 0x64, 0x44, 0x9E, 0x0F, 0xA6, 
-    0x64, 0x44, 0x40, 0x00, 0x10, 0x20, 0x0B, 0x44, 0x44, 0xD9, 0x01, 0x12, 0x0A, 0x69, 0xE3, 0x1A, 
-    0x6D, 0xC4, 0x11, 0x15, 0x0B, 0x6C, 0x95, 0x0B, 0x69, 0xC0, 0x4A, 0x6D, 0x90, 0x54, 0x21, 0xAB, 
-    0x6C, 0xC5, 0x00, 0x0B, 0x4D, 0x4D, 0x94, 0x10, 0x02, 0x49, 0x41, 0x40, 0x15, 0x59, 0x52, 0x31, 
-    0x00, 0x00, 0x00, 0x03, 0x20, 0x03, 0x32, 0x00, 0x00, 0x00, 0x06, 0x60, 0x03, 0x20, 0x0F, 0xA6, 
-    0xD0, 0x10, 0x4A, 0x6D, 0x00, 0x20, 0xB6, 0xC1, 0x22, 0x0B, 0x6C, 0x02, 0x0A, 0x69, 0xE3, 0x1A, 
-    0x66, 0x66, 0xC0, 0x31, 0x0B, 0x6C, 0xC5, 0x0B, 0x69, 0xC0, 0x4A, 0x66, 0x66, 0xC0, 0x00, 0x0B, 
-    0x6C, 0x54, 0xAB, 0x69, 0xE1, 0x10, 0xB6, 0x9E, 0x17, 0x77, 0x22, 0x00, 0x09, 0x55, 0x43, 0x34, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x32, 0x22, 0x30, 0x00, 0xA6, 0x6C, 0x03, 0x30, 0x0F, 0xA6, 
-    0xD0, 0x30, 0x70, 0x6B, 0x00, 0x2A, 0xB6, 0xC1, 0x02, 0xAB, 0x6C, 0x12, 0x0A, 0x60, 0xC3, 0x1A, 
-    0x66, 0xD6, 0xC1, 0x12, 0x0B, 0x6C, 0xC5, 0x0B, 0x69, 0xC0, 0x4A, 0x66, 0xD6, 0xC9, 0x05, 0xAB, 
-    0x6C, 0x05, 0x0B, 0x69, 0xE0, 0x10, 0xB6, 0x9E, 0x48, 0x55, 0x00, 0x00, 0x09, 0x95, 0x44, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x03, 0x22, 0x13, 0x00, 0xA6, 0x6C, 0x03, 0x00, 0x0F, 0xA6, 
-    0xDC, 0x04, 0x0A, 0x6D, 0x00, 0x2A, 0xB6, 0xC4, 0x44, 0xAB, 0x6C, 0x13, 0x0A, 0x60, 0xC2, 0xFA, 
-    0x6D, 0x00, 0xA6, 0x4E, 0xAB, 0x6C, 0xC5, 0x0B, 0x69, 0x00, 0x4A, 0x6D, 0x00, 0xA6, 0x4C, 0xAB, 
-    0x6C, 0x95, 0x0B, 0x69, 0xE4, 0x49, 0x55, 0x10, 0x47, 0x52, 0x00, 0x02, 0x49, 0x55, 0x54, 0x00, 
-    0x00, 0x03, 0x30, 0x00, 0x33, 0x00, 0x00, 0x33, 0x23, 0x00, 0xA6, 0x6C, 0x03, 0x00, 0x0F, 0xA6, 
-    0x66, 0x66, 0x64, 0xE2, 0x40, 0x2A, 0xB6, 0x66, 0x66, 0x66, 0x6C, 0x00, 0x0A, 0x60, 0xC3, 0x1A, 
-    0x6D, 0x00, 0xA6, 0x9E, 0xAB, 0x6C, 0x05, 0x0B, 0x60, 0x00, 0x4A, 0x6D, 0x00, 0xA6, 0x90, 0xAB, 
-    0x6C, 0x50, 0x0B, 0x69, 0x04, 0x40, 0x04, 0x40, 0x59, 0x10, 0x11, 0x17, 0x79, 0x97, 0x52, 0x00, 
-    0x00, 0x00, 0x23, 0x00, 0x03, 0x23, 0x00, 0x03, 0x23, 0x00, 0xA6, 0x6C, 0x12, 0x00, 0x0F, 0xA6, 
-    0x66, 0x66, 0x64, 0xE0, 0x00, 0x0A, 0xB6, 0x66, 0x66, 0x66, 0x6C, 0x00, 0x0A, 0x69, 0xE3, 0xFA, 
-    0x6D, 0xE1, 0x41, 0x0D, 0xB6, 0x6C, 0x04, 0xAB, 0x64, 0x08, 0x4A, 0x6D, 0x04, 0x40, 0x0D, 0xB6, 
-    0x6C, 0x05, 0x0B, 0x69, 0x0A, 0xBB, 0xB6, 0x40, 0x99, 0x41, 0x75, 0x47, 0x99, 0x54, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x03, 0x23, 0x33, 0x32, 0x22, 0x00, 0xA6, 0x6C, 0x10, 0x40, 0x0F, 0xA6, 
-    0x6C, 0x11, 0x10, 0xDB, 0xC4, 0x2A, 0xB6, 0x95, 0x41, 0x0B, 0x6C, 0x00, 0x0A, 0x69, 0xE3, 0xFA, 
-    0x6D, 0xE1, 0x2F, 0xA6, 0x66, 0x6C, 0x04, 0xAB, 0x60, 0x00, 0x4A, 0x6D, 0xE4, 0x50, 0xA6, 0x66, 
-    0x6C, 0x98, 0x0B, 0x69, 0xCA, 0x66, 0x66, 0x90, 0x77, 0x91, 0x75, 0x15, 0x44, 0x00, 0x02, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x22, 0x22, 0x22, 0x13, 0xA6, 0x6C, 0x12, 0x13, 0x01, 0xA6, 
-    0xDE, 0x33, 0xFA, 0x6D, 0x03, 0x2A, 0xB6, 0xC1, 0x02, 0xAB, 0x6C, 0x00, 0x0A, 0x69, 0xE3, 0xFA, 
-    0x6D, 0xE1, 0x1F, 0x04, 0xD6, 0x6C, 0x10, 0x0A, 0x69, 0xE0, 0x4A, 0x6D, 0xE4, 0x54, 0xDD, 0xD6, 
-    0x6C, 0x08, 0x0B, 0x69, 0xC4, 0x00, 0xB6, 0x90, 0x77, 0x52, 0x42, 0x03, 0x57, 0x95, 0x33, 0x00, 
-    0x00, 0x30, 0x00, 0x03, 0x03, 0x00, 0x00, 0x32, 0x22, 0x20, 0xA6, 0x6C, 0x13, 0x23, 0x0F, 0xA6, 
-    0xDE, 0x32, 0xFA, 0x6D, 0xE3, 0x2A, 0xB6, 0xC1, 0x32, 0xAB, 0x6C, 0x03, 0x0A, 0x69, 0xE3, 0x1A, 
-    0x6D, 0xE1, 0x11, 0x11, 0x0B, 0x6C, 0x12, 0x0A, 0x69, 0xE0, 0x4A, 0x6D, 0x04, 0x54, 0x11, 0x0B, 
-    0x6C, 0x15, 0x0B, 0x69, 0x08, 0x00, 0xB6, 0x9E, 0x75, 0x00, 0x00, 0x00, 0x17, 0x78, 0x94, 0x30, 
-    0x00, 0x30, 0x00, 0x11, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0xA6, 0x6C, 0x12, 0x41, 0x0F, 0xA6, 
-    0xDE, 0x02, 0x1A, 0x6D, 0xE3, 0x2A, 0xB6, 0xC0, 0x30, 0xAB, 0x6C, 0x03, 0x0A, 0x69, 0xE3, 0xFA, 
-    0x6D, 0xE1, 0x12, 0x12, 0xAB, 0x6C, 0x12, 0x0B, 0x69, 0xE2, 0x4A, 0x6D, 0xE4, 0x54, 0x91, 0x0B, 
-    0x6C, 0x04, 0x4D, 0xD0, 0x0D, 0xDB, 0x44, 0x10, 0x73, 0x00, 0x00, 0x00, 0x01, 0x77, 0x77, 0x40, 
-    0x00, 0x33, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x6C, 0x12, 0x11, 0x01, 0x06, 
-    0x6E, 0x32, 0xF0, 0x6B, 0xE3, 0x20, 0xB6, 0xC0, 0x30, 0x0B, 0x6C, 0x00, 0x0A, 0x60, 0xE3, 0xFA, 
-    0x6D, 0x02, 0x22, 0x12, 0x0B, 0x6C, 0x12, 0x0A, 0x69, 0xE2, 0x4A, 0x6D, 0xE4, 0x54, 0x51, 0x0B, 
-    0x6C, 0x04, 0x15, 0x0A, 0x66, 0x66, 0x01, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x17, 0x77, 0x93, 
-    0x00, 0x03, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0xD0, 0x10, 0x03, 0x0F, 0xA6, 
-    0xD0, 0x32, 0xFA, 0x0D, 0xE3, 0x20, 0xB0, 0xC0, 0x30, 0x0B, 0x0C, 0x03, 0xFB, 0x09, 0xE3, 0xFA, 
-    0x04, 0x04, 0x13, 0x11, 0x0B, 0xDC, 0x12, 0x0B, 0x09, 0xC2, 0x4A, 0x0D, 0xE4, 0x55, 0x54, 0x0D, 
-    0xD0, 0x52, 0x12, 0x3B, 0x0D, 0xDD, 0xC1, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0x97, 0x53, 
-    0x00, 0x03, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x11, 0x00, 0x00, 0x03, 0x01, 
-    0x11, 0x02, 0x22, 0x21, 0x12, 0x23, 0x20, 0x00, 0x32, 0x22, 0x11, 0x22, 0x22, 0x11, 0x12, 0x22, 
-    0x11, 0x14, 0x11, 0x14, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x14, 0x55, 0x45, 0x47, 0x54, 0x52, 
-    0x01, 0x52, 0x11, 0x30, 0x00, 0x09, 0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x41, 
-    0x00, 0x03, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x43, 0x00, 0x00, 0x03, 0x31, 
-    0x00, 0x03, 0x32, 0x03, 0x22, 0x33, 0x33, 0x03, 0x33, 0x33, 0x30, 0x33, 0x33, 0x33, 0x32, 0x22, 
-    0x22, 0x11, 0x22, 0x21, 0x22, 0x12, 0x22, 0x12, 0x22, 0x21, 0x44, 0x54, 0x55, 0x22, 0x11, 0x43, 
-    0x00, 0x95, 0x51, 0x30, 0x30, 0x04, 0x12, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x00, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x03, 0x20, 
-    0x00, 0x02, 0x32, 0x03, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x30, 0x22, 0x22, 0x20, 0x03, 0x22, 
-    0x22, 0x11, 0x21, 0x22, 0x22, 0x22, 0x22, 0x12, 0x22, 0x22, 0x14, 0x11, 0x21, 0x20, 0x24, 0x43, 
-    0x00, 0x27, 0x41, 0x30, 0x20, 0x01, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x02, 0x40, 
-    0x00, 0x00, 0x00, 0x30, 0x20, 0x33, 0x00, 0xF0, 0x00, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x20, 0x30, 
-    0xF0, 0x01, 0x13, 0xF0, 0x03, 0x02, 0x30, 0x20, 0x00, 0x01, 0x21, 0x00, 0x0D, 0x00, 0x0D, 0x13, 
-    0x01, 0x25, 0x41, 0x00, 0x00, 0x03, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x66, 0x6C, 0x00, 0x02, 0xFA, 
-    0x66, 0x66, 0x66, 0x9E, 0x30, 0x30, 0x00, 0x0B, 0x66, 0x6D, 0xE0, 0x00, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0xE3, 0x00, 0x20, 0x06, 0x6E, 0x11, 0xAB, 0x66, 0x66, 0x66, 0x00, 
-    0x22, 0x03, 0x1F, 0x06, 0x66, 0x6C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA6, 0xDD, 0x6C, 0x00, 0x02, 0xFA, 
-    0x66, 0x6D, 0xD6, 0x9C, 0x30, 0x00, 0xF3, 0x0B, 0x0D, 0x6D, 0xE3, 0x00, 0x00, 0xB6, 0x90, 0x00, 
-    0x0B, 0x69, 0xE0, 0xFA, 0x6D, 0xE3, 0x00, 0x20, 0xA6, 0x6E, 0x12, 0x0B, 0x66, 0x6D, 0xDD, 0xCF, 
-    0x00, 0x00, 0x1F, 0xA6, 0xDD, 0x6C, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x4E, 0x00, 0x0B, 0x64, 0x00, 0xFA, 
-    0x6D, 0xE0, 0x01, 0xA6, 0xDE, 0x00, 0x0B, 0x6C, 0x00, 0x0A, 0xB6, 0xC0, 0x00, 0xB6, 0x90, 0x00, 
-    0x0B, 0x69, 0xE0, 0xFA, 0x66, 0xB6, 0xC0, 0x2F, 0xA6, 0x6E, 0x22, 0x0B, 0x69, 0xC1, 0x00, 0xB6, 
-    0xC0, 0x30, 0xA6, 0xDE, 0x00, 0x0A, 0x6D, 0xE0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x90, 0x00, 0x0B, 0x69, 0xE0, 0xFA, 
-    0x6D, 0xE0, 0x0F, 0xA6, 0xDE, 0x00, 0xA6, 0x6C, 0x00, 0x0A, 0x66, 0x00, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x66, 0x66, 0x00, 0x23, 0xA6, 0x6E, 0x12, 0x0B, 0x6C, 0xC3, 0x00, 0xB6, 
-    0xC0, 0x10, 0xA6, 0xDE, 0x00, 0xFA, 0x6D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x9E, 0x00, 0x33, 0x10, 0x00, 0xFA, 
-    0x6D, 0xE0, 0x0F, 0xA6, 0xD0, 0x00, 0xA6, 0x6C, 0x00, 0x0A, 0x66, 0xC0, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0xC0, 0x0B, 0x11, 0xA6, 0x6E, 0x12, 0x0B, 0x6C, 0xC3, 0x00, 0xB6, 
-    0xC0, 0x3F, 0xA6, 0x4E, 0x30, 0xF0, 0x29, 0xC0, 0x00, 0x00, 0x03, 0x33, 0x30, 0x00, 0x32, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFA, 
-    0x66, 0xDB, 0xBB, 0x41, 0x10, 0x00, 0xA6, 0x6C, 0x00, 0x0A, 0x66, 0xC0, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0x0A, 0xB6, 0xCE, 0xA6, 0x6E, 0x12, 0x0B, 0x6C, 0xC3, 0x20, 0xB6, 
-    0xC0, 0x00, 0x44, 0x0D, 0xBB, 0xB1, 0x04, 0x50, 0x00, 0x00, 0x03, 0x33, 0x30, 0x32, 0x12, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x90, 0x00, 0xBB, 0xB1, 0x03, 0xFA, 
-    0x66, 0x66, 0x66, 0x9E, 0x00, 0x00, 0xA6, 0x6C, 0x00, 0x0A, 0x66, 0xC0, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0xE0, 0x04, 0x94, 0xA6, 0x6E, 0x12, 0x0B, 0x6C, 0xC3, 0x20, 0xB6, 
-    0xC0, 0x30, 0x51, 0xA6, 0x66, 0x6C, 0x04, 0x50, 0x00, 0x00, 0x32, 0x23, 0x23, 0x21, 0x32, 0x20, 
-    0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x90, 0xAB, 0x66, 0x69, 0x03, 0xFA, 
-    0x6B, 0x44, 0x44, 0x04, 0x00, 0x00, 0xA6, 0x6C, 0x00, 0x0A, 0x66, 0xC0, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0xE3, 0x00, 0xA6, 0x66, 0x6E, 0x12, 0x0B, 0x6C, 0xC3, 0x20, 0xB6, 
-    0xC0, 0x30, 0x11, 0x4D, 0x44, 0x40, 0x44, 0x00, 0x00, 0x03, 0x21, 0x23, 0x22, 0x42, 0x32, 0x13, 
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x90, 0x0B, 0xDB, 0x69, 0x03, 0xFA, 
-    0x6D, 0x00, 0x0F, 0xA6, 0xDE, 0x00, 0xA6, 0x6C, 0x02, 0x0A, 0x66, 0xC0, 0x00, 0xB6, 0x90, 0x32, 
-    0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0xE3, 0x2F, 0xA0, 0xD6, 0x6E, 0x12, 0x0B, 0x6C, 0xC2, 0x20, 0xB6, 
-    0xC0, 0x0F, 0xAB, 0x41, 0x30, 0x0A, 0x6D, 0xE0, 0x00, 0x03, 0x22, 0x22, 0x24, 0x43, 0x30, 0x42, 
-    0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x90, 0x00, 0x0B, 0x69, 0x03, 0xFA, 
-    0x6D, 0xE3, 0x0F, 0xA6, 0xDE, 0x00, 0x06, 0x6E, 0x00, 0x00, 0x66, 0xC0, 0x00, 0xB6, 0x90, 0x30, 
-    0x0B, 0x69, 0x03, 0xFA, 0x6D, 0xE3, 0x22, 0x21, 0xA6, 0x6E, 0x12, 0x0B, 0x6C, 0xC2, 0x20, 0xB6, 
-    0xC0, 0x00, 0xA6, 0xDE, 0x30, 0x0A, 0x6D, 0xE0, 0x00, 0x33, 0x22, 0x22, 0x15, 0x23, 0x03, 0x72, 
-    0x00, 0x32, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0F, 0xB6, 0x90, 0x3F, 0x0B, 0x69, 0x03, 0xFA, 
-    0x6D, 0xE3, 0x0F, 0xA6, 0xDE, 0x00, 0x0B, 0xDC, 0xFF, 0xFA, 0xBD, 0xE0, 0x00, 0xB6, 0x91, 0x04, 
-    0xAB, 0x6C, 0x03, 0xFA, 0x6D, 0xE3, 0x21, 0x23, 0xA6, 0x6E, 0x11, 0xAB, 0x69, 0x00, 0x40, 0xB6, 
-    0xC0, 0x0F, 0xA0, 0x4C, 0x0F, 0x0B, 0x69, 0xE0, 0x00, 0x22, 0x22, 0x31, 0x54, 0x30, 0x03, 0x72, 
-    0x00, 0x32, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA6, 0x66, 0x6C, 0x00, 0x00, 0xFA, 
-    0x6D, 0xE0, 0x0F, 0xA6, 0xDE, 0x30, 0x00, 0x0B, 0x66, 0x6D, 0xE0, 0x00, 0x00, 0x0F, 0xA6, 0x66, 
-    0x6C, 0x00, 0x20, 0xFA, 0x6D, 0xE3, 0x23, 0x3F, 0xA6, 0x6E, 0x12, 0xAB, 0x66, 0x66, 0x66, 0xC1, 
-    0x12, 0x33, 0x51, 0xA6, 0x66, 0x6C, 0x05, 0x10, 0x00, 0x12, 0x22, 0x25, 0x43, 0x33, 0x02, 0x72, 
-    0x00, 0x33, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x0F, 0xA6, 0x66, 0x60, 0x00, 0x00, 0xFA, 
-    0x6D, 0x03, 0x0F, 0xA6, 0xD0, 0x30, 0x00, 0x0B, 0x66, 0x6D, 0xE0, 0x00, 0x00, 0x0F, 0xA6, 0x66, 
-    0x60, 0x03, 0x30, 0xFA, 0x6D, 0xE3, 0x33, 0x33, 0xA6, 0x60, 0x12, 0xAB, 0x66, 0x66, 0x66, 0x02, 
-    0x32, 0x23, 0x51, 0xA6, 0x66, 0x6C, 0x04, 0x40, 0x00, 0x23, 0x42, 0x45, 0x23, 0x02, 0x32, 0x73, 
-    0x00, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x11, 0x10, 0x00, 0x03, 0x03, 
-    0x21, 0x01, 0x00, 0x31, 0x10, 0x30, 0x03, 0x11, 0x11, 0x11, 0x02, 0x11, 0x11, 0x11, 0x44, 0x41, 
-    0x10, 0x31, 0x44, 0x44, 0x45, 0x04, 0x44, 0x42, 0x24, 0x5C, 0x42, 0x44, 0x15, 0x41, 0x14, 0x01, 
-    0x22, 0x33, 0x51, 0x42, 0x11, 0x10, 0x15, 0x40, 0x00, 0x22, 0x54, 0x04, 0x33, 0x02, 0x01, 0x73, 
-    0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x30, 
-    0x00, 0x01, 0x20, 0x00, 0x03, 0x32, 0x22, 0x44, 0x23, 0x44, 0x45, 0x55, 0x55, 0x55, 0x77, 0x51, 
-    0x00, 0x14, 0x98, 0x75, 0x55, 0x05, 0x55, 0x55, 0x44, 0x50, 0x54, 0x52, 0x25, 0x42, 0x35, 0x53, 
-    0x22, 0x22, 0x92, 0x23, 0x32, 0x22, 0x17, 0x10, 0x03, 0x41, 0x55, 0x53, 0x20, 0x03, 0x01, 0x53, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x23, 
-    0x00, 0x02, 0x20, 0x33, 0x32, 0x24, 0x41, 0x54, 0x11, 0x45, 0x55, 0x50, 0x07, 0x71, 0x14, 0x20, 
-    0x00, 0x14, 0x45, 0x55, 0x77, 0x77, 0x77, 0x74, 0x45, 0x77, 0x55, 0x42, 0x15, 0x12, 0x25, 0x53, 
-    0x22, 0x39, 0x71, 0x23, 0x21, 0x12, 0x47, 0x40, 0x02, 0x44, 0x57, 0x22, 0x30, 0x03, 0x31, 0x44, 
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x12, 
-    0x00, 0x02, 0x20, 0x33, 0x31, 0x55, 0x44, 0x55, 0x45, 0x50, 0x57, 0x54, 0x55, 0x55, 0x44, 0x41, 
-    0x22, 0x22, 0x22, 0x15, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0x55, 0x54, 0x97, 0x22, 0x25, 0x43, 
-    0x22, 0x17, 0x93, 0x23, 0x11, 0x44, 0x17, 0x10, 0x03, 0x14, 0x74, 0x32, 0x33, 0x23, 0x22, 0x74, 
-    0x00, 0x33, 0x00, 0x00, 0x20, 0x02, 0x03, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x03, 0x21, 
-    0x00, 0x02, 0x12, 0x21, 0x31, 0x55, 0x11, 0x45, 0x55, 0x77, 0x77, 0x52, 0x00, 0x32, 0x33, 0x22, 
-    0x44, 0x44, 0x44, 0x44, 0x77, 0x79, 0x78, 0x88, 0x87, 0x42, 0x23, 0x41, 0x97, 0x79, 0x57, 0x42, 
-    0x21, 0x57, 0x53, 0x33, 0x45, 0x44, 0x58, 0x10, 0x00, 0x17, 0x73, 0x12, 0x32, 0x22, 0x22, 0x42, 
-    0x00, 0x23, 0x00, 0x00, 0x03, 0x02, 0x30, 0x30, 0x00, 0x00, 0x24, 0x22, 0x23, 0x00, 0x03, 0x32, 
-    0x00, 0x02, 0x25, 0x50, 0x21, 0x55, 0x44, 0x45, 0x50, 0x77, 0x77, 0x77, 0x54, 0x77, 0x54, 0x77, 
-    0x77, 0x77, 0x88, 0x88, 0x88, 0x84, 0x98, 0x88, 0x87, 0x12, 0x33, 0x11, 0x78, 0x87, 0x87, 0x22, 
-    0x22, 0x27, 0x53, 0x23, 0x45, 0x45, 0x77, 0x12, 0x00, 0x17, 0x22, 0x44, 0x34, 0x32, 0x22, 0x03, 
-    0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x04, 0x22, 0x12, 0x00, 0x00, 0x33, 
-    0x00, 0x02, 0x15, 0x55, 0x21, 0x55, 0x55, 0x50, 0x07, 0x77, 0x77, 0x77, 0x75, 0x78, 0x59, 0x87, 
-    0x77, 0x88, 0x77, 0x88, 0x88, 0x85, 0x78, 0x88, 0x87, 0x42, 0x33, 0x21, 0x78, 0x77, 0x87, 0x97, 
-    0x79, 0x78, 0x43, 0x23, 0x15, 0x55, 0x77, 0x30, 0x00, 0x15, 0x22, 0x52, 0x22, 0x22, 0x44, 0x01, 
-    0x00, 0x23, 0x00, 0x00, 0x00, 0x30, 0x33, 0x32, 0x00, 0x00, 0x01, 0x44, 0x42, 0x00, 0x00, 0x01, 
-    0x55, 0x55, 0x55, 0x55, 0x11, 0x57, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x59, 0x87, 
-    0x88, 0x88, 0x57, 0x88, 0x88, 0x84, 0x98, 0x88, 0x87, 0x42, 0x33, 0x14, 0x48, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x43, 0x23, 0x47, 0x97, 0x87, 0x30, 0x00, 0x14, 0x24, 0x42, 0x43, 0x23, 0x94, 0x01, 
-    0x00, 0x23, 0x00, 0x00, 0x00, 0x30, 0x02, 0x33, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x02, 
-    0x55, 0x55, 0x55, 0x54, 0x14, 0x10, 0x50, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x78, 0x59, 0x88, 
-    0x88, 0x88, 0x45, 0x95, 0x78, 0x85, 0x98, 0x88, 0x88, 0x42, 0x33, 0x22, 0x47, 0x77, 0x88, 0x87, 
-    0x88, 0x89, 0x22, 0x23, 0x32, 0x24, 0x77, 0x30, 0x00, 0x22, 0x25, 0x24, 0x12, 0x44, 0x74, 0x31, 
-    0x00, 0x33, 0x33, 0x00, 0x02, 0x32, 0x00, 0x20, 0x00, 0x00, 0x02, 0x22, 0x33, 0x33, 0x23, 0x01, 
-    0x55, 0x55, 0x55, 0x54, 0x21, 0x15, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x57, 0x77, 
-    0x88, 0x74, 0x34, 0x78, 0x88, 0x75, 0x58, 0x88, 0x88, 0x54, 0x22, 0x14, 0x15, 0x77, 0x95, 0x85, 
-    0x88, 0x87, 0x59, 0x55, 0x59, 0x57, 0x95, 0x30, 0x00, 0x35, 0x54, 0x44, 0x24, 0x55, 0x42, 0x33, 
-    0x00, 0x33, 0x32, 0x03, 0x00, 0x32, 0x00, 0x03, 0x00, 0x00, 0x02, 0x24, 0x44, 0x55, 0x55, 0x04, 
-    0x55, 0x55, 0x55, 0x52, 0x15, 0x15, 0x70, 0x07, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x97, 0x77, 
-    0x75, 0x12, 0x14, 0x59, 0x88, 0x75, 0x48, 0x88, 0x88, 0x88, 0x85, 0x55, 0x44, 0x55, 0x52, 0x54, 
-    0x88, 0x88, 0x88, 0x80, 0x88, 0x88, 0x55, 0x00, 0x00, 0x27, 0x54, 0x52, 0x44, 0x50, 0x40, 0x00, 
-    0x00, 0x32, 0x33, 0x33, 0x20, 0x23, 0x30, 0x00, 0x00, 0x00, 0x02, 0x24, 0x55, 0x55, 0x55, 0x01, 
-    0x05, 0x55, 0x55, 0x42, 0x14, 0x45, 0x00, 0x55, 0x93, 0x97, 0x77, 0x77, 0x97, 0x77, 0x77, 0x77, 
-    0x50, 0x00, 0x30, 0x00, 0x98, 0x77, 0x97, 0x88, 0x88, 0x88, 0x89, 0x54, 0x44, 0x77, 0x88, 0x72, 
-    0x78, 0x88, 0x88, 0x88, 0x77, 0x77, 0x75, 0x30, 0x00, 0x34, 0x45, 0x54, 0x52, 0x27, 0x40, 0x00, 
-    0x00, 0x22, 0x33, 0x33, 0x30, 0x03, 0x30, 0x00, 0x00, 0x00, 0x02, 0x34, 0x55, 0x55, 0x55, 0x31, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x57, 0x21, 0x50, 0x01, 0x97, 0x85, 0x17, 0x77, 0x77, 0x77, 
-    0x50, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x73, 
-    0x98, 0x88, 0x88, 0x88, 0x87, 0x87, 0x52, 0x00, 0x00, 0x00, 0x32, 0x32, 0x42, 0x17, 0x50, 0x00, 
-    0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x24, 0x55, 0x55, 0x51, 0x04, 
-    0x45, 0x55, 0x55, 0x55, 0x57, 0x74, 0x57, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x87, 0x77, 0x77, 
-    0x43, 0x00, 0x00, 0x00, 0x22, 0x17, 0x88, 0x88, 0x88, 0x08, 0x98, 0x88, 0x88, 0x88, 0x88, 0x82, 
-    0x70, 0x88, 0x88, 0x88, 0x87, 0x87, 0x55, 0x45, 0x54, 0x54, 0x49, 0x99, 0x99, 0x07, 0x50, 0x00, 
-    0x00, 0x33, 0x33, 0x33, 0x00, 0x00, 0x22, 0x03, 0x22, 0x22, 0x24, 0x45, 0x55, 0x55, 0x50, 0x00, 
-    0x35, 0x55, 0x55, 0x55, 0x57, 0x71, 0x18, 0x10, 0x70, 0x15, 0x41, 0x00, 0x04, 0x89, 0x98, 0x78, 
-    0x10, 0x00, 0x00, 0x00, 0x19, 0x78, 0x88, 0x88, 0x09, 0x01, 0x40, 0x88, 0x88, 0x08, 0x88, 0x81, 
-    0x70, 0x88, 0x88, 0x88, 0x88, 0x87, 0x70, 0x57, 0x08, 0x07, 0x90, 0x88, 0x88, 0x77, 0x50, 0x00, 
-    0x00, 0x33, 0x33, 0x33, 0x33, 0x30, 0x22, 0x34, 0x44, 0x44, 0x45, 0x55, 0x55, 0x55, 0x42, 0x31, 
-    0x24, 0x05, 0x55, 0x55, 0x05, 0x75, 0x37, 0x74, 0x75, 0x78, 0x88, 0x70, 0x09, 0x82, 0x18, 0x78, 
-    0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x88, 0x80, 0x93, 0x90, 0x15, 0x90, 0x88, 0x88, 0x80, 0x53, 
-    0x90, 0x88, 0x77, 0x78, 0x88, 0x77, 0x78, 0x19, 0x08, 0x07, 0x98, 0x88, 0x87, 0x70, 0x40, 0x30, 
-    0x00, 0x33, 0x00, 0x32, 0x22, 0x20, 0x21, 0x24, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x24, 0x25, 
-    0x51, 0x55, 0x55, 0x55, 0x04, 0x47, 0x19, 0x74, 0x75, 0x58, 0x77, 0x80, 0x28, 0x70, 0x18, 0x78, 
-    0x40, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x80, 0x20, 0x50, 0x10, 0x10, 0x88, 0x88, 0x80, 0x40, 
-    0x18, 0x79, 0x55, 0x57, 0x77, 0x75, 0x45, 0x31, 0x49, 0x99, 0x98, 0x88, 0x87, 0x55, 0x13, 0x30, 
-    0x00, 0x03, 0x00, 0x22, 0x22, 0x23, 0x32, 0x14, 0x44, 0x45, 0x55, 0x55, 0x55, 0x54, 0x24, 0x24, 
-    0x42, 0x45, 0x55, 0x55, 0x54, 0x37, 0x55, 0x74, 0x95, 0x58, 0x77, 0x80, 0x18, 0x70, 0x98, 0x89, 
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x88, 0x88, 0x80, 0x10, 0x91, 0x90, 0x48, 0x88, 0x88, 0x88, 0x54, 
-    0x18, 0x87, 0x77, 0x78, 0x88, 0x75, 0x20, 0x00, 0x32, 0x22, 0x19, 0x88, 0x87, 0x75, 0x23, 0x00, 
-    0x00, 0x33, 0x00, 0x32, 0x11, 0x42, 0x22, 0x14, 0x45, 0x55, 0x14, 0x55, 0x44, 0x42, 0x22, 0x30, 
-    0x41, 0x24, 0x45, 0x55, 0x55, 0x25, 0x51, 0x74, 0x49, 0x47, 0x77, 0x70, 0x18, 0x71, 0x77, 0x82, 
-    0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x78, 0x88, 0x51, 0x81, 0x70, 0x45, 0x88, 0x87, 0x87, 0x59, 
-    0x49, 0x08, 0x88, 0x88, 0x88, 0x75, 0x41, 0x30, 0x03, 0x23, 0x30, 0x57, 0x77, 0x77, 0x23, 0x00, 
-    0x00, 0x03, 0x00, 0x32, 0x44, 0x44, 0x11, 0x15, 0x55, 0x54, 0x04, 0x54, 0x44, 0x40, 0x22, 0x30, 
-    0x00, 0x44, 0x44, 0x54, 0x45, 0x44, 0x52, 0x54, 0x15, 0x25, 0x55, 0x50, 0x10, 0x51, 0x00, 0x73, 
-    0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x77, 0x77, 0x54, 0x71, 0x71, 0x11, 0x58, 0x77, 0x85, 0x55, 
-    0x95, 0x08, 0x88, 0x88, 0x88, 0x89, 0x42, 0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x77, 0x23, 0x00, 
-    0x00, 0x03, 0x30, 0x22, 0x44, 0x44, 0x24, 0x14, 0x44, 0x51, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x25, 0x42, 0x52, 0x14, 0x24, 0x24, 0x45, 0x40, 0x15, 0x41, 0x55, 0x02, 
-    0x30, 0x00, 0x00, 0x00, 0x57, 0x77, 0x77, 0x77, 0x44, 0x91, 0x54, 0x40, 0x27, 0x77, 0x75, 0x95, 
-    0x84, 0x88, 0x88, 0x88, 0x88, 0x84, 0x23, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x77, 0x75, 0x55, 
-    0x00, 0x02, 0x22, 0x44, 0x44, 0x44, 0x21, 0x21, 0x24, 0x43, 0x14, 0x22, 0x22, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x24, 0x42, 0x44, 0x25, 0x25, 0x14, 0x55, 0x40, 0x40, 0x44, 0x00, 0x51, 
-    0x10, 0x00, 0x00, 0x00, 0x57, 0x77, 0x77, 0x78, 0x45, 0x94, 0x95, 0x50, 0x05, 0x77, 0x74, 0x91, 
-    0x91, 0x78, 0x88, 0x88, 0x88, 0x84, 0x23, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x88, 0x87, 0x77, 
+const uint8_t STORY_CH2_RLE[STORY_CH2_RLE_SIZE] = {
+    0xA8, 0x09, 0x42, 0x23, 0x24, 0x04, 0x42, 0xB0, 0x01, 0x22, 0xD0, 0x00, 0x10, 0xB0, 0x0B, 0x30, 
+    0x00, 0x12, 0x00, 0x03, 0x13, 0xC0, 0x00, 0x20, 0xA1, 0x01, 0x45, 0xA9, 0x03, 0x87, 0x89, 0xB7, 
+    0x03, 0x99, 0x14, 0xE1, 0x11, 0x95, 0x15, 0x11, 0x51, 0x30, 0x54, 0x30, 0x00, 0x17, 0xD0, 0x0A, 
+    0x15, 0x30, 0x00, 0x20, 0x21, 0x20, 0xB0, 0x06, 0x22, 0x20, 0x58, 0x70, 0x44, 0x04, 0x24, 0x44, 
+    0x30, 0x43, 0x00, 0x30, 0xB0, 0x01, 0x33, 0x48, 0x06, 0x23, 0x00, 0x31, 0x30, 0xD0, 0xB1, 0x44, 
+    0x02, 0x77, 0x70, 0x46, 0xA4, 0xD1, 0x02, 0x95, 0x40, 0x42, 0x03, 0x20, 0x45, 0x51, 0x05, 0x33, 
+    0x44, 0x42, 0xA0, 0x10, 0x12, 0x20, 0x20, 0x54, 0x23, 0x32, 0x21, 0x55, 0x50, 0x44, 0x00, 0x20, 
+    0x4B, 0x09, 0x20, 0x00, 0x33, 0x00, 0x22, 0xC0, 0x01, 0x22, 0x49, 0x00, 0x90, 0xE7, 0x07, 0x99, 
+    0x95, 0x54, 0x44, 0xB1, 0x02, 0x59, 0x50, 0x44, 0x03, 0x15, 0x33, 0x50, 0x00, 0x20, 0x47, 0x10, 
+    0x11, 0x02, 0x47, 0x42, 0x23, 0x22, 0x47, 0x77, 0x20, 0x55, 0x0B, 0x20, 0x03, 0x20, 0x10, 0x00, 
+    0x22, 0xD1, 0x02, 0x45, 0x50, 0x4D, 0x01, 0x99, 0xA5, 0x09, 0x44, 0x49, 0x44, 0x51, 0x44, 0x42, 
+    0x02, 0x92, 0x20, 0x42, 0x00, 0x30, 0x45, 0x00, 0x70, 0x47, 0x00, 0x10, 0xA0, 0x05, 0x22, 0x24, 
+    0x00, 0x43, 0x06, 0x44, 0x58, 0x77, 0x10, 0x44, 0x00, 0x30, 0x49, 0x04, 0x32, 0x00, 0x30, 0x42, 
+    0x06, 0x00, 0x30, 0x02, 0x30, 0xA0, 0x02, 0x22, 0x20, 0xB1, 0x02, 0x45, 0x50, 0xD9, 0x03, 0x55, 
+    0x44, 0xF1, 0x00, 0x06, 0x44, 0x15, 0x11, 0x50, 0x4D, 0x04, 0x30, 0x01, 0x50, 0x43, 0x00, 0x10, 
+    0xA4, 0x09, 0x00, 0x30, 0x15, 0x03, 0x32, 0x44, 0x05, 0x57, 0x87, 0x84, 0x44, 0x00, 0x20, 0x51, 
+    0x00, 0x20, 0xA0, 0x01, 0x32, 0xD0, 0xA1, 0x00, 0x40, 0x48, 0x03, 0x55, 0x95, 0xF1, 0x01, 0x07, 
+    0x41, 0x15, 0x12, 0x54, 0x57, 0x01, 0x11, 0x44, 0x06, 0x29, 0x20, 0x00, 0x50, 0x43, 0x03, 0x97, 
+    0x88, 0x45, 0x02, 0x14, 0x30, 0x47, 0x00, 0x30, 0x4A, 0x01, 0x32, 0xA0, 0x00, 0x20, 0xE1, 0x01, 
+    0x95, 0xF9, 0x04, 0x01, 0x55, 0xB1, 0x03, 0x41, 0x44, 0x42, 0x00, 0x40, 0x48, 0x00, 0x80, 0x42, 
+    0x00, 0x20, 0x49, 0x00, 0x40, 0x43, 0x07, 0x19, 0x75, 0x00, 0x04, 0x44, 0xA8, 0x00, 0x50, 0x45, 
+    0x06, 0x20, 0x03, 0x23, 0x20, 0x49, 0x05, 0x32, 0x00, 0x32, 0xB0, 0x00, 0x30, 0xB1, 0x03, 0x44, 
+    0x15, 0xF9, 0x06, 0x02, 0x55, 0x40, 0xA1, 0x00, 0x40, 0x44, 0x00, 0x10, 0x48, 0x00, 0x70, 0x42, 
+    0x01, 0x12, 0x44, 0x02, 0x32, 0x10, 0xA4, 0x0B, 0x01, 0x95, 0x39, 0x50, 0x03, 0x33, 0x48, 0x00, 
+    0x30, 0x42, 0x02, 0x44, 0x10, 0x43, 0x00, 0x10, 0x4D, 0x05, 0x20, 0x00, 0x32, 0xC1, 0x03, 0x44, 
+    0x55, 0x4E, 0x03, 0x99, 0x54, 0xA1, 0x05, 0x54, 0x14, 0x13, 0x46, 0x03, 0x30, 0x19, 0x42, 0x09, 
+    0x31, 0x01, 0x52, 0x02, 0x23, 0xA4, 0x12, 0x55, 0x52, 0x02, 0x94, 0x00, 0x32, 0x00, 0x22, 0x49, 
+    0x00, 0x43, 0x0A, 0x30, 0x03, 0x45, 0x43, 0x03, 0x30, 0x4D, 0x02, 0x32, 0x30, 0xE0, 0x02, 0x11, 
+    0x20, 0xC1, 0x02, 0x44, 0x40, 0xF5, 0x02, 0x01, 0x44, 0xD1, 0x02, 0x94, 0x50, 0x48, 0x0A, 0x20, 
+    0x17, 0x10, 0x03, 0x03, 0x30, 0x42, 0x0C, 0x30, 0x24, 0x45, 0x79, 0x10, 0x31, 0x10, 0x44, 0x07, 
+    0x30, 0x03, 0x35, 0x00, 0x4E, 0x00, 0x20, 0x47, 0x05, 0x30, 0x32, 0x12, 0xF0, 0x00, 0x04, 0x12, 
+    0x00, 0x20, 0xC1, 0xF4, 0x00, 0x02, 0x15, 0x50, 0xF1, 0x00, 0x03, 0x49, 0x54, 0x47, 0x1A, 0x00, 
+    0x18, 0x10, 0x02, 0x23, 0x01, 0x71, 0x03, 0x03, 0x49, 0x91, 0x03, 0x11, 0x20, 0x43, 0x01, 0x02, 
+    0xB0, 0x07, 0x31, 0x70, 0x09, 0x30, 0x42, 0x01, 0x05, 0x43, 0x01, 0x13, 0x45, 0x00, 0x20, 0x42, 
+    0x02, 0x20, 0x30, 0x48, 0x01, 0x22, 0x43, 0x0B, 0x55, 0x99, 0x55, 0x59, 0x44, 0x54, 0x4A, 0x00, 
+    0x40, 0x52, 0x0C, 0x20, 0x24, 0x10, 0x03, 0x49, 0x42, 0x20, 0xB1, 0x1A, 0x45, 0x40, 0x30, 0x33, 
+    0x00, 0x02, 0x10, 0x04, 0x89, 0x23, 0x00, 0x35, 0x75, 0x20, 0x50, 0x00, 0x00, 0x46, 0x01, 0x22, 
+    0xD1, 0x02, 0x44, 0x50, 0xC9, 0xA5, 0x05, 0x99, 0x54, 0x11, 0xA4, 0x03, 0x11, 0x41, 0x46, 0x04, 
+    0x72, 0x20, 0x30, 0x43, 0x0C, 0x11, 0x23, 0x11, 0x10, 0x19, 0x42, 0x20, 0xE1, 0x01, 0x45, 0xE0, 
+    0x06, 0x31, 0x41, 0x03, 0x10, 0x42, 0x08, 0x09, 0x87, 0x20, 0x32, 0x20, 0x42, 0x03, 0x23, 0x23, 
+    0x46, 0xA0, 0x03, 0x33, 0x22, 0xD1, 0x02, 0x45, 0x50, 0x46, 0xB9, 0x04, 0x55, 0x45, 0x50, 0x45, 
+    0x00, 0x40, 0x45, 0x00, 0x90, 0x48, 0x09, 0x42, 0x21, 0x11, 0x25, 0x12, 0xE1, 0x00, 0x20, 0x49, 
+    0x0F, 0x25, 0x14, 0x21, 0x02, 0x20, 0x00, 0x48, 0x72, 0xA3, 0x42, 0x06, 0x32, 0x23, 0x32, 0x20, 
+    0x48, 0x06, 0x03, 0x20, 0x12, 0x20, 0xE1, 0xB4, 0x0A, 0x55, 0x45, 0x45, 0x51, 0x44, 0x40, 0xB1, 
+    0x42, 0x04, 0x24, 0x42, 0x30, 0x4B, 0x06, 0x12, 0x42, 0x10, 0x20, 0xE1, 0x02, 0x22, 0x00, 0x49, 
+    0x03, 0x01, 0x44, 0xA1, 0xA0, 0x03, 0x18, 0x71, 0x4E, 0x04, 0x22, 0x33, 0x30, 0x44, 0x01, 0x33, 
+    0xC1, 0xB4, 0x06, 0x55, 0x95, 0x55, 0x90, 0xA5, 0x06, 0x41, 0x55, 0x44, 0x40, 0x43, 0x03, 0x54, 
+    0x15, 0x42, 0x00, 0x70, 0x4A, 0x05, 0x14, 0x11, 0x00, 0xD1, 0x04, 0x33, 0x03, 0x40, 0x49, 0x02, 
+    0x00, 0x20, 0x48, 0x04, 0x81, 0x33, 0x20, 0x42, 0x00, 0x30, 0x43, 0x00, 0x00, 0x45, 0x06, 0x33, 
+    0x23, 0x22, 0x20, 0x44, 0xB4, 0x02, 0x55, 0x90, 0x42, 0xB5, 0xA4, 0x00, 0x10, 0x42, 0x00, 0x40, 
+    0x46, 0x00, 0x20, 0x45, 0x07, 0x52, 0x00, 0x15, 0x95, 0x47, 0x08, 0x23, 0x21, 0x22, 0x31, 0x50, 
+    0x47, 0x05, 0x31, 0x00, 0x03, 0x44, 0x04, 0x32, 0x51, 0x20, 0x42, 0x02, 0x20, 0x30, 0xB2, 0x06, 
+    0x02, 0x32, 0x23, 0x20, 0xA3, 0x06, 0x22, 0x21, 0x21, 0x20, 0x45, 0xD5, 0x03, 0x95, 0x59, 0x48, 
+    0x00, 0x40, 0x42, 0x00, 0x10, 0x48, 0x1A, 0x24, 0x42, 0x01, 0x95, 0x41, 0x52, 0x30, 0x11, 0x12, 
+    0x21, 0x11, 0x22, 0x11, 0x40, 0x48, 0x08, 0x11, 0x31, 0x00, 0x03, 0x30, 0x42, 0x10, 0x13, 0x11, 
+    0x33, 0x34, 0x23, 0x32, 0x31, 0x12, 0x00, 0xA2, 0x43, 0x05, 0x11, 0xF2, 0x32, 0xB1, 0x08, 0x44, 
+    0x41, 0x41, 0x11, 0x40, 0x44, 0x00, 0x90, 0x46, 0xA4, 0x07, 0x15, 0x41, 0x54, 0x11, 0x43, 0x05, 
+    0x34, 0x52, 0x19, 0xB4, 0x11, 0x20, 0x11, 0x22, 0x21, 0x12, 0x11, 0x45, 0x94, 0x54, 0xA0, 0x00, 
+    0x30, 0xC0, 0x06, 0x12, 0x13, 0x0F, 0xA0, 0xEB, 0x04, 0x40, 0x2F, 0xA0, 0xCB, 0x02, 0x41, 0x30, 
+    0x42, 0x02, 0x20, 0xA0, 0xAB, 0x10, 0x03, 0x11, 0x20, 0xAB, 0x40, 0x11, 0xAB, 0x0C, 0x40, 0xA5, 
+    0x10, 0x0B, 0xBC, 0x55, 0x0A, 0xB4, 0x00, 0x4A, 0xBD, 0xC0, 0x43, 0x09, 0xAB, 0x60, 0x03, 0x11, 
+    0x1A, 0xAB, 0x01, 0xC1, 0xA0, 0x01, 0x32, 0xA1, 0x04, 0x59, 0x95, 0x50, 0x47, 0x0B, 0x33, 0x00, 
+    0x03, 0x22, 0x42, 0x0A, 0xE6, 0x04, 0xDE, 0x3F, 0xA0, 0xC6, 0x01, 0x4E, 0x43, 0x09, 0x00, 0xA6, 
+    0x66, 0x00, 0x02, 0x42, 0x0B, 0x69, 0xE3, 0xFA, 0x6D, 0x01, 0x44, 0x42, 0x1D, 0x6C, 0xC5, 0x0B, 
+    0x69, 0xC0, 0x4A, 0x6D, 0x01, 0x54, 0x22, 0xA6, 0x60, 0x01, 0x55, 0xFA, 0xA6, 0x00, 0x00, 0x43, 
+    0x0C, 0x21, 0x11, 0x41, 0x97, 0x55, 0x52, 0x40, 0x42, 0x19, 0x30, 0x03, 0x23, 0x00, 0x33, 0x30, 
+    0x0F, 0x04, 0x4D, 0x66, 0x44, 0x49, 0xE0, 0x42, 0xA4, 0x08, 0x00, 0x01, 0x02, 0x00, 0xB0, 0xA4, 
+    0x03, 0xD9, 0x01, 0x46, 0x08, 0x1A, 0x6D, 0xC4, 0x11, 0x10, 0x43, 0x00, 0x90, 0x49, 0x27, 0x90, 
+    0x54, 0x21, 0xAB, 0x6C, 0xC5, 0x00, 0x0B, 0x4D, 0x4D, 0x94, 0x10, 0x02, 0x49, 0x41, 0x40, 0x15, 
+    0x59, 0x52, 0x31, 0xD0, 0x01, 0x32, 0x42, 0x00, 0x20, 0xD0, 0x06, 0x66, 0x00, 0x32, 0x00, 0x42, 
+    0x16, 0xD0, 0x10, 0x4A, 0x6D, 0x00, 0x20, 0xB6, 0xC1, 0x22, 0x0B, 0x6C, 0x00, 0x48, 0x06, 0x66, 
+    0x6C, 0x03, 0x10, 0x42, 0x00, 0xC0, 0x48, 0x03, 0x66, 0x6C, 0xA0, 0x20, 0xB6, 0xC5, 0x4A, 0xB6, 
+    0x9E, 0x11, 0x0B, 0x69, 0xE1, 0x77, 0x72, 0x20, 0x00, 0x95, 0x54, 0x33, 0x40, 0xE0, 0x12, 0x33, 
+    0x00, 0x32, 0x22, 0x30, 0x00, 0xA6, 0x6C, 0x03, 0x30, 0x45, 0x09, 0x30, 0x70, 0x6B, 0x00, 0x2A, 
+    0x42, 0x06, 0x02, 0xAB, 0x6C, 0x10, 0x42, 0x01, 0x0C, 0x43, 0x05, 0xD6, 0xC1, 0x12, 0x4E, 0x0C, 
+    0xD6, 0xC9, 0x05, 0xAB, 0x6C, 0x05, 0x00, 0x42, 0x00, 0x00, 0x44, 0x03, 0x48, 0x55, 0xB0, 0x05, 
+    0x99, 0x54, 0x44, 0xF0, 0x00, 0x42, 0x05, 0x03, 0x22, 0x13, 0x46, 0x00, 0x00, 0x44, 0x06, 0xC0, 
+    0x40, 0xA6, 0xD0, 0x45, 0x02, 0x44, 0x40, 0x43, 0x00, 0x30, 0x43, 0x0B, 0x2F, 0xA6, 0xD0, 0x0A, 
+    0x64, 0xEA, 0x47, 0x00, 0x00, 0x42, 0x06, 0xD0, 0x0A, 0x64, 0xC0, 0x42, 0x00, 0x90, 0x44, 0x14, 
+    0x44, 0x95, 0x51, 0x04, 0x75, 0x20, 0x00, 0x24, 0x95, 0x55, 0x40, 0xB0, 0x01, 0x33, 0x46, 0x03, 
+    0x03, 0x32, 0x4D, 0xB6, 0x03, 0x4E, 0x24, 0x43, 0xD6, 0x02, 0xC0, 0x00, 0x43, 0x01, 0x31, 0x45, 
+    0x00, 0x90, 0x43, 0x00, 0x00, 0x42, 0x00, 0x00, 0x48, 0x01, 0x90, 0x42, 0x01, 0x50, 0x42, 0x15, 
+    0x04, 0x40, 0x04, 0x40, 0x59, 0x10, 0x11, 0x17, 0x79, 0x97, 0x52, 0xC0, 0x0A, 0x23, 0x00, 0x03, 
+    0x23, 0x00, 0x00, 0x47, 0x01, 0x12, 0x4B, 0xA0, 0x4E, 0x18, 0x9E, 0x3F, 0xA6, 0xDE, 0x14, 0x10, 
+    0xDB, 0x66, 0xC0, 0x4A, 0xB6, 0x40, 0x80, 0x43, 0x0A, 0x44, 0x00, 0xDB, 0x66, 0xC0, 0x50, 0x43, 
+    0x14, 0xAB, 0xBB, 0x64, 0x09, 0x94, 0x17, 0x54, 0x79, 0x95, 0x41, 0x30, 0xE0, 0x01, 0x33, 0x42, 
+    0x05, 0x33, 0x32, 0x22, 0x45, 0x01, 0x04, 0x44, 0x12, 0xC1, 0x11, 0x0D, 0xBC, 0x42, 0xAB, 0x69, 
+    0x54, 0x10, 0xB0, 0x4E, 0x02, 0x2F, 0xA0, 0xA6, 0x44, 0x02, 0x00, 0x00, 0x42, 0x04, 0xE4, 0x50, 
+    0xA0, 0xA6, 0x02, 0xC9, 0x80, 0x42, 0x01, 0xCA, 0xA6, 0x0F, 0x90, 0x77, 0x91, 0x75, 0x15, 0x44, 
+    0x00, 0x02, 0xF0, 0x02, 0x02, 0x32, 0x30, 0xC2, 0x01, 0x13, 0x43, 0x10, 0x21, 0x30, 0x1A, 0x6D, 
+    0xE3, 0x3F, 0xA6, 0xD0, 0x30, 0x42, 0x04, 0xC1, 0x02, 0xA0, 0x4F, 0x0E, 0x1F, 0x04, 0xD6, 0x6C, 
+    0x10, 0x0A, 0x69, 0xE0, 0x46, 0x07, 0x4D, 0xDD, 0x66, 0xC0, 0x44, 0x03, 0x40, 0x0B, 0x43, 0x0B, 
+    0x52, 0x42, 0x03, 0x57, 0x95, 0x33, 0xA0, 0x00, 0x30, 0xA0, 0x02, 0x30, 0x30, 0xA0, 0x00, 0x30, 
+    0xA2, 0x00, 0x00, 0x43, 0x04, 0x32, 0x30, 0xF0, 0x43, 0x00, 0x20, 0x42, 0x00, 0xE0, 0x45, 0x00, 
+    0x30, 0x44, 0x00, 0x30, 0x44, 0x00, 0x10, 0x44, 0x08, 0x11, 0x10, 0xB6, 0xC1, 0x20, 0x48, 0x0B, 
+    0x04, 0x54, 0x11, 0x0B, 0x6C, 0x15, 0x42, 0x01, 0x08, 0x43, 0x02, 0xE7, 0x50, 0xC0, 0x06, 0x17, 
+    0x78, 0x94, 0x30, 0x45, 0x02, 0x11, 0x30, 0xE0, 0x01, 0x20, 0x44, 0x02, 0x24, 0x10, 0x44, 0x02, 
+    0x02, 0x10, 0x48, 0x02, 0x03, 0x00, 0x4A, 0x00, 0xF0, 0x44, 0x03, 0x21, 0x2A, 0x44, 0x04, 0xB6, 
+    0x9E, 0x20, 0x42, 0x04, 0xE4, 0x54, 0x90, 0x43, 0x0F, 0x04, 0x4D, 0xD0, 0x0D, 0xDB, 0x44, 0x10, 
+    0x73, 0xD0, 0x00, 0x10, 0xA7, 0x00, 0x40, 0x42, 0x04, 0x30, 0x21, 0x20, 0xF0, 0x00, 0x03, 0x20, 
+    0x00, 0x43, 0x11, 0x11, 0x01, 0x06, 0x6E, 0x32, 0xF0, 0x6B, 0xE3, 0x20, 0x44, 0x00, 0x00, 0x42, 
+    0x04, 0x00, 0xA6, 0x00, 0x44, 0x06, 0x02, 0x22, 0x12, 0x00, 0x44, 0x00, 0xA0, 0x4A, 0x00, 0x50, 
+    0x45, 0x03, 0x15, 0x0A, 0xA6, 0x04, 0x01, 0x04, 0x50, 0xF0, 0x00, 0x0C, 0x17, 0x77, 0x93, 0x00, 
+    0x03, 0x21, 0x10, 0xF0, 0x02, 0x15, 0x30, 0x06, 0xD0, 0x10, 0x03, 0x0F, 0xA6, 0xD0, 0x32, 0xFA, 
+    0x0D, 0x43, 0x00, 0x00, 0x44, 0x07, 0x0C, 0x03, 0xFB, 0x09, 0x42, 0x0A, 0x04, 0x04, 0x13, 0x11, 
+    0x0B, 0xD0, 0x42, 0x07, 0xB0, 0x9C, 0x24, 0xA0, 0x42, 0x15, 0x55, 0x40, 0xDD, 0x05, 0x21, 0x23, 
+    0xB0, 0xDD, 0xDC, 0x10, 0x53, 0xF0, 0x01, 0x03, 0x59, 0x75, 0x45, 0xF0, 0x03, 0x05, 0x30, 0x00, 
+    0x11, 0xB0, 0x05, 0x30, 0x11, 0x10, 0xA2, 0x0E, 0x11, 0x22, 0x32, 0x00, 0x03, 0x22, 0x21, 0x10, 
+    0xA2, 0x0D, 0x11, 0x12, 0x22, 0x11, 0x14, 0x11, 0x14, 0xD1, 0x00, 0x20, 0xB1, 0x11, 0x45, 0x54, 
+    0x54, 0x75, 0x45, 0x20, 0x15, 0x21, 0x13, 0xA0, 0x04, 0x95, 0x40, 0x10, 0xF0, 0x02, 0x04, 0x33, 
+    0x04, 0x10, 0x43, 0x00, 0x30, 0xF0, 0x05, 0x03, 0x32, 0x43, 0x44, 0x0B, 0x31, 0x00, 0x03, 0x32, 
+    0x03, 0x22, 0xA3, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xD3, 0xB2, 0x0C, 0x11, 0x22, 0x21, 0x22, 0x12, 
+    0x22, 0x10, 0xA2, 0x1B, 0x14, 0x45, 0x45, 0x52, 0x21, 0x14, 0x30, 0x09, 0x55, 0x13, 0x03, 0x00, 
+    0x41, 0x23, 0xF0, 0x07, 0x05, 0x20, 0x03, 0x32, 0xF0, 0x07, 0x01, 0x12, 0xC0, 0x01, 0x32, 0xA0, 
+    0x00, 0x20, 0x42, 0xC3, 0xC0, 0x01, 0x30, 0xB2, 0x02, 0x00, 0x30, 0x45, 0x00, 0x10, 0xE2, 0x43, 
+    0x0A, 0x21, 0x41, 0x12, 0x12, 0x02, 0x40, 0x42, 0x0B, 0x27, 0x41, 0x30, 0x20, 0x01, 0x52, 0xF0, 
+    0x0B, 0x01, 0x32, 0xF0, 0x0B, 0x00, 0x30, 0xA0, 0x01, 0x24, 0xD0, 0x08, 0x30, 0x20, 0x33, 0x00, 
+    0xF0, 0xA0, 0x00, 0x30, 0xB0, 0x15, 0xF0, 0x02, 0x03, 0x0F, 0x00, 0x11, 0x3F, 0x00, 0x30, 0x23, 
+    0x02, 0xA0, 0x12, 0x12, 0x10, 0x00, 0xD0, 0x00, 0xD1, 0x30, 0x12, 0x54, 0x10, 0xB0, 0x02, 0x31, 
+    0x40, 0xF0, 0x0B, 0x01, 0x23, 0xF0, 0x07, 0x00, 0xA0, 0xA6, 0x00, 0xC0, 0x42, 0x01, 0xFA, 0xC6, 
+    0x04, 0x9E, 0x30, 0x30, 0xA0, 0x05, 0xB6, 0x66, 0xDE, 0xB0, 0x12, 0xB6, 0x90, 0x30, 0x0B, 0x69, 
+    0xE3, 0xFA, 0x6D, 0xE3, 0x00, 0x42, 0x06, 0x66, 0xE1, 0x1A, 0xB0, 0xC6, 0x08, 0x00, 0x22, 0x03, 
+    0x1F, 0x00, 0xA6, 0x02, 0xC0, 0x20, 0xF0, 0x07, 0x00, 0x30, 0xF0, 0x0B, 0x04, 0xFA, 0x6D, 0xD0, 
+    0x49, 0x12, 0xDD, 0x69, 0xC3, 0x00, 0x0F, 0x30, 0xB0, 0xD6, 0xDE, 0x30, 0x46, 0x00, 0x00, 0x44, 
+    0x00, 0x00, 0x48, 0x00, 0xA0, 0x42, 0x01, 0x20, 0x42, 0x04, 0xDD, 0xDC, 0xF0, 0xA0, 0x0A, 0x1F, 
+    0xA6, 0xDD, 0x6C, 0x03, 0x30, 0xF0, 0x05, 0x01, 0x22, 0xF0, 0x0A, 0x24, 0xA6, 0x4E, 0x00, 0x0B, 
+    0x64, 0x00, 0xFA, 0x6D, 0xE0, 0x01, 0xA6, 0xDE, 0x00, 0x0B, 0x6C, 0x00, 0x0A, 0xB6, 0xC0, 0x50, 
+    0x06, 0x6B, 0x6C, 0x02, 0xF0, 0x42, 0x00, 0x20, 0x42, 0x15, 0x9C, 0x10, 0x0B, 0x6C, 0x03, 0x0A, 
+    0x6D, 0xE0, 0x00, 0xA6, 0xDE, 0xC0, 0x00, 0x30, 0xC0, 0x01, 0x33, 0xF0, 0x0B, 0x02, 0xB6, 0x90, 
+    0xA0, 0x03, 0xB6, 0x9E, 0x46, 0x00, 0xF0, 0x44, 0x01, 0xA6, 0x44, 0x01, 0x66, 0xA0, 0x42, 0x00, 
+    0x30, 0x44, 0x00, 0x30, 0x42, 0x05, 0x66, 0x00, 0x23, 0x42, 0x00, 0x10, 0x42, 0x02, 0xCC, 0x30, 
+    0x44, 0x00, 0x10, 0x45, 0x00, 0xF0, 0x48, 0xD0, 0x57, 0x07, 0xE0, 0x03, 0x31, 0x00, 0x4A, 0x00, 
+    0x00, 0x4A, 0x00, 0xC0, 0x50, 0x06, 0xDC, 0x00, 0xB1, 0x10, 0x50, 0x0C, 0x3F, 0xA6, 0x4E, 0x30, 
+    0xF0, 0x29, 0xC0, 0xC0, 0xA3, 0x42, 0x00, 0x20, 0x55, 0xF0, 0x00, 0x0A, 0xFA, 0x66, 0xDB, 0xBB, 
+    0x41, 0x10, 0x5F, 0x05, 0x0A, 0xB6, 0xCE, 0x4A, 0x00, 0x20, 0x43, 0x0C, 0x00, 0x44, 0x0D, 0xBB, 
+    0xB1, 0x04, 0x50, 0x49, 0x02, 0x32, 0x10, 0x59, 0x05, 0xBB, 0xB1, 0x03, 0x42, 0xA6, 0x01, 0x9E, 
+    0xA0, 0x5C, 0x05, 0xE0, 0x04, 0x94, 0x50, 0x04, 0x30, 0x51, 0xA0, 0xA6, 0x00, 0xC0, 0x46, 0x0F, 
+    0x32, 0x23, 0x23, 0x21, 0x32, 0x20, 0x00, 0x33, 0x50, 0x05, 0xAB, 0x66, 0x69, 0x43, 0x00, 0xB0, 
+    0xA4, 0x01, 0x04, 0x61, 0x03, 0x30, 0x0A, 0xA6, 0x4F, 0x09, 0x11, 0x4D, 0x44, 0x40, 0x44, 0xB0, 
+    0x0F, 0x32, 0x12, 0x32, 0x24, 0x23, 0x21, 0x30, 0x00, 0x51, 0x03, 0x0B, 0xDB, 0x45, 0x08, 0xD0, 
+    0x00, 0xFA, 0x6D, 0xE0, 0x45, 0x00, 0x20, 0x4B, 0x00, 0x20, 0x4A, 0x04, 0x2F, 0xA0, 0xD0, 0x48, 
+    0x00, 0x20, 0x44, 0x0C, 0x0F, 0xAB, 0x41, 0x30, 0x0A, 0x6D, 0xE0, 0x44, 0xA2, 0x09, 0x44, 0x33, 
+    0x04, 0x20, 0x03, 0x4D, 0x00, 0xA0, 0x42, 0x01, 0x00, 0x47, 0x01, 0xE3, 0x46, 0x03, 0x06, 0x6E, 
+    0xA0, 0x49, 0x00, 0x00, 0x42, 0x00, 0x00, 0x46, 0x03, 0x22, 0x1A, 0x50, 0x04, 0x0A, 0x6D, 0xE0, 
+    0x48, 0x00, 0x30, 0x43, 0x06, 0x15, 0x23, 0x03, 0x70, 0x42, 0x00, 0x20, 0xA0, 0x00, 0x30, 0xE0, 
+    0x06, 0xFB, 0x69, 0x03, 0xF0, 0x53, 0x09, 0xBD, 0xCF, 0xFF, 0xAB, 0xDE, 0x44, 0x06, 0x10, 0x4A, 
+    0xB6, 0xC0, 0x47, 0x02, 0x12, 0x30, 0x43, 0x07, 0x1A, 0xB6, 0x90, 0x04, 0x44, 0x0A, 0xFA, 0x04, 
+    0xC0, 0xF0, 0xB6, 0x90, 0x42, 0xA2, 0x05, 0x31, 0x54, 0x30, 0x53, 0x03, 0x00, 0xFA, 0xA6, 0x00, 
+    0xC0, 0xA0, 0x43, 0x00, 0x00, 0x44, 0x00, 0x30, 0xA0, 0x05, 0xB6, 0x66, 0xDE, 0xC0, 0x01, 0xFA, 
+    0xA6, 0x04, 0xC0, 0x02, 0x00, 0x45, 0x02, 0x33, 0xF0, 0x43, 0x02, 0x2A, 0xB0, 0xC6, 0x08, 0xC1, 
+    0x12, 0x33, 0x51, 0xA0, 0xA6, 0x07, 0xC0, 0x51, 0x00, 0x01, 0xA2, 0x06, 0x54, 0x33, 0x30, 0x20, 
+    0x43, 0x00, 0x30, 0xB0, 0x02, 0x33, 0x30, 0x4B, 0xB0, 0x42, 0x01, 0x03, 0x43, 0x00, 0x00, 0x55, 
+    0x03, 0x00, 0x33, 0x45, 0xA3, 0x03, 0xA6, 0x60, 0x48, 0x04, 0x02, 0x32, 0x20, 0x48, 0x12, 0x44, 
+    0x00, 0x02, 0x34, 0x24, 0x52, 0x30, 0x23, 0x27, 0x30, 0x46, 0x00, 0x30, 0xF0, 0x02, 0x04, 0x13, 
+    0x11, 0x10, 0xA0, 0x0B, 0x30, 0x32, 0x10, 0x10, 0x03, 0x11, 0x42, 0x00, 0x30, 0xC1, 0x01, 0x02, 
+    0xC1, 0x07, 0x44, 0x41, 0x10, 0x31, 0xB4, 0x01, 0x50, 0xA4, 0x1E, 0x22, 0x45, 0xC4, 0x24, 0x41, 
+    0x54, 0x11, 0x40, 0x12, 0x23, 0x35, 0x14, 0x21, 0x11, 0x01, 0x50, 0x43, 0x0A, 0x25, 0x40, 0x43, 
+    0x30, 0x20, 0x10, 0x42, 0x00, 0x00, 0x43, 0x01, 0x03, 0xF0, 0x01, 0x00, 0x20, 0xE0, 0x01, 0x33, 
+    0xA0, 0x01, 0x12, 0xA0, 0x0B, 0x33, 0x22, 0x24, 0x42, 0x34, 0x44, 0xD5, 0x0E, 0x77, 0x51, 0x00, 
+    0x14, 0x98, 0x75, 0x55, 0x00, 0xB5, 0x0F, 0x44, 0x50, 0x54, 0x52, 0x25, 0x42, 0x35, 0x53, 0xA2, 
+    0x1A, 0x92, 0x23, 0x32, 0x22, 0x17, 0x10, 0x03, 0x41, 0x55, 0x53, 0x20, 0x03, 0x01, 0x50, 0x42, 
+    0xC0, 0x01, 0x33, 0xF0, 0x00, 0x00, 0x10, 0xE0, 0x15, 0x22, 0x30, 0x00, 0x22, 0x03, 0x33, 0x22, 
+    0x44, 0x15, 0x41, 0x14, 0xA5, 0x08, 0x00, 0x77, 0x11, 0x42, 0x00, 0x42, 0x03, 0x45, 0x55, 0xD7, 
+    0x0D, 0x44, 0x57, 0x75, 0x54, 0x21, 0x51, 0x22, 0x43, 0x1D, 0x39, 0x71, 0x23, 0x21, 0x12, 0x47, 
+    0x40, 0x02, 0x44, 0x57, 0x22, 0x30, 0x03, 0x31, 0x44, 0xD0, 0x03, 0x20, 0x02, 0x50, 0x02, 0x31, 
+    0x20, 0x47, 0x0E, 0x15, 0x54, 0x45, 0x54, 0x55, 0x05, 0x75, 0x40, 0xA5, 0x03, 0x44, 0x41, 0xC2, 
+    0x00, 0x10, 0x46, 0xA7, 0x30, 0x95, 0x55, 0x49, 0x72, 0x22, 0x54, 0x32, 0x21, 0x79, 0x32, 0x31, 
+    0x14, 0x41, 0x71, 0x00, 0x31, 0x47, 0x43, 0x23, 0x32, 0x32, 0x27, 0x40, 0x03, 0x30, 0xA0, 0x05, 
+    0x20, 0x02, 0x03, 0x45, 0x02, 0x20, 0x30, 0x44, 0x01, 0x21, 0x42, 0x03, 0x12, 0x21, 0x42, 0x05, 
+    0x11, 0x45, 0x55, 0xA7, 0x09, 0x52, 0x00, 0x32, 0x33, 0x22, 0xE4, 0x04, 0x77, 0x79, 0x70, 0xA8, 
+    0x27, 0x74, 0x22, 0x34, 0x19, 0x77, 0x95, 0x74, 0x22, 0x15, 0x75, 0x33, 0x34, 0x54, 0x45, 0x81, 
+    0x00, 0x01, 0x77, 0x31, 0x23, 0xB2, 0x04, 0x42, 0x00, 0x20, 0x43, 0x06, 0x03, 0x02, 0x30, 0x30, 
+    0xB0, 0x05, 0x24, 0x22, 0x23, 0x42, 0x01, 0x32, 0x42, 0x0D, 0x25, 0x50, 0x21, 0x55, 0x44, 0x45, 
+    0x50, 0xC7, 0x05, 0x54, 0x77, 0x54, 0xC7, 0xD8, 0x01, 0x49, 0x43, 0x0B, 0x12, 0x33, 0x11, 0x78, 
+    0x87, 0x87, 0xB2, 0x03, 0x75, 0x32, 0x42, 0x04, 0x57, 0x71, 0x20, 0x42, 0x0B, 0x22, 0x44, 0x34, 
+    0x32, 0x22, 0x03, 0x47, 0x05, 0x00, 0x02, 0x02, 0xC0, 0x04, 0x42, 0x21, 0x20, 0xA0, 0x01, 0x33, 
+    0x42, 0x03, 0x15, 0x55, 0x42, 0x04, 0x55, 0x50, 0x00, 0xE7, 0x0C, 0x57, 0x85, 0x98, 0x77, 0x78, 
+    0x87, 0x70, 0xB8, 0x01, 0x57, 0x43, 0x24, 0x42, 0x33, 0x21, 0x78, 0x77, 0x87, 0x97, 0x79, 0x78, 
+    0x43, 0x23, 0x15, 0x55, 0x77, 0x30, 0x00, 0x15, 0x22, 0x50, 0xB2, 0x03, 0x44, 0x01, 0x48, 0x05, 
+    0x30, 0x33, 0x32, 0xB0, 0x03, 0x14, 0x44, 0x43, 0x01, 0x01, 0xE5, 0x02, 0x11, 0x50, 0xF7, 0x05, 
+    0x02, 0x57, 0x70, 0x42, 0xA8, 0x00, 0x50, 0x44, 0x01, 0x49, 0x47, 0x02, 0x14, 0x40, 0xF8, 0x02, 
+    0x42, 0x04, 0x47, 0x97, 0x80, 0x44, 0x09, 0x42, 0x44, 0x24, 0x32, 0x39, 0x4D, 0x03, 0x02, 0x33, 
+    0xB0, 0xA2, 0xC0, 0x00, 0x20, 0xD5, 0x06, 0x41, 0x41, 0x05, 0x00, 0x4B, 0x02, 0x85, 0x90, 0xC8, 
+    0x07, 0x45, 0x95, 0x78, 0x85, 0x43, 0x00, 0x80, 0x42, 0x16, 0x22, 0x47, 0x77, 0x88, 0x87, 0x88, 
+    0x89, 0x22, 0x23, 0x32, 0x24, 0x70, 0x43, 0x0F, 0x22, 0x25, 0x24, 0x12, 0x44, 0x74, 0x31, 0x00, 
+    0xA3, 0x08, 0x00, 0x02, 0x32, 0x00, 0x20, 0xC0, 0x02, 0x22, 0x20, 0xA3, 0x03, 0x23, 0x01, 0x46, 
+    0x04, 0x21, 0x15, 0x00, 0xF7, 0x03, 0x13, 0x57, 0x75, 0x77, 0x78, 0x87, 0x43, 0x47, 0x88, 0x87, 
+    0x55, 0xB8, 0x1B, 0x54, 0x22, 0x14, 0x15, 0x77, 0x95, 0x85, 0x88, 0x87, 0x59, 0x55, 0x59, 0x57, 
+    0x95, 0x42, 0x0D, 0x35, 0x54, 0x44, 0x24, 0x55, 0x42, 0x33, 0x43, 0x04, 0x20, 0x30, 0x00, 0x42, 
+    0x01, 0x03, 0x45, 0x02, 0x44, 0x40, 0xA5, 0x01, 0x04, 0xD5, 0x07, 0x21, 0x51, 0x57, 0x00, 0x4B, 
+    0x00, 0x90, 0xA7, 0x06, 0x51, 0x21, 0x45, 0x90, 0x42, 0x00, 0x40, 0xE8, 0x0A, 0x55, 0x54, 0x45, 
+    0x55, 0x25, 0x40, 0xD8, 0x00, 0x00, 0xA8, 0x01, 0x55, 0xA0, 0x0A, 0x27, 0x54, 0x52, 0x44, 0x50, 
+    0x40, 0xB0, 0x01, 0x32, 0xA3, 0x04, 0x20, 0x23, 0x30, 0xE0, 0x02, 0x22, 0x40, 0xC5, 0x02, 0x01, 
+    0x00, 0xB5, 0x0C, 0x42, 0x14, 0x45, 0x00, 0x55, 0x93, 0x90, 0xB7, 0x00, 0x90, 0xD7, 0x0D, 0x50, 
+    0x00, 0x30, 0x00, 0x98, 0x77, 0x97, 0xD8, 0x0B, 0x95, 0x44, 0x47, 0x78, 0x87, 0x27, 0xD8, 0xB7, 
+    0x0E, 0x53, 0x00, 0x03, 0x44, 0x55, 0x45, 0x22, 0x70, 0x44, 0x00, 0x20, 0x43, 0x02, 0x30, 0x00, 
+    0x49, 0x00, 0x30, 0x45, 0x01, 0x31, 0xF5, 0x01, 0x0E, 0x75, 0x57, 0x21, 0x50, 0x01, 0x97, 0x85, 
+    0x10, 0x49, 0xA0, 0x01, 0x70, 0xF8, 0x0B, 0x02, 0x73, 0x90, 0xE8, 0x04, 0x78, 0x75, 0x20, 0xC0, 
+    0x08, 0x32, 0x32, 0x42, 0x17, 0x50, 0xB0, 0xE3, 0xF0, 0x02, 0x01, 0x32, 0x44, 0x03, 0x10, 0x44, 
+    0xE5, 0x07, 0x77, 0x45, 0x70, 0x05, 0xE0, 0x01, 0x48, 0xB7, 0x01, 0x43, 0xC0, 0x03, 0x22, 0x17, 
+    0xC8, 0x02, 0x08, 0x90, 0xF8, 0x01, 0x02, 0x27, 0x00, 0x49, 0x07, 0x54, 0x55, 0x45, 0x44, 0xB9, 
+    0x00, 0x00, 0x4B, 0xA0, 0x03, 0x22, 0x03, 0xB2, 0x01, 0x44, 0xC5, 0x03, 0x00, 0x03, 0x48, 0x0A, 
+    0x11, 0x81, 0x07, 0x01, 0x54, 0x10, 0x43, 0x05, 0x99, 0x87, 0x81, 0xD0, 0x02, 0x19, 0x70, 0xB8, 
+    0x05, 0x09, 0x01, 0x40, 0xA8, 0x00, 0x00, 0xA8, 0x00, 0x10, 0x47, 0x0C, 0x88, 0x77, 0x05, 0x70, 
+    0x80, 0x79, 0x00, 0xA8, 0x00, 0x70, 0x4B, 0x06, 0x33, 0x30, 0x22, 0x30, 0xC4, 0xD5, 0x06, 0x42, 
+    0x31, 0x24, 0x00, 0xB5, 0x18, 0x05, 0x75, 0x37, 0x74, 0x75, 0x78, 0x88, 0x70, 0x09, 0x82, 0x18, 
+    0x78, 0x40, 0xD0, 0x0F, 0x80, 0x00, 0x88, 0x80, 0x93, 0x90, 0x15, 0x90, 0xB8, 0x12, 0x05, 0x39, 
+    0x08, 0x87, 0x77, 0x88, 0x87, 0x77, 0x81, 0x90, 0x43, 0xA8, 0x05, 0x77, 0x04, 0x03, 0x43, 0x02, 
+    0x00, 0x30, 0xA2, 0x03, 0x02, 0x12, 0xB4, 0xE5, 0x05, 0x24, 0x25, 0x51, 0xC5, 0x05, 0x04, 0x47, 
+    0x19, 0x42, 0x09, 0x58, 0x77, 0x80, 0x28, 0x70, 0x4A, 0x01, 0x70, 0xB8, 0x07, 0x02, 0x05, 0x01, 
+    0x01, 0x45, 0x08, 0x40, 0x18, 0x79, 0x55, 0x50, 0xA7, 0x05, 0x54, 0x53, 0x14, 0xA9, 0x43, 0x03, 
+    0x55, 0x13, 0x42, 0x03, 0x03, 0x00, 0xB2, 0x03, 0x33, 0x21, 0xA4, 0xE5, 0x07, 0x42, 0x42, 0x44, 
+    0x24, 0xC5, 0x07, 0x43, 0x75, 0x57, 0x49, 0x45, 0x07, 0x18, 0x70, 0x98, 0x89, 0xE0, 0x00, 0x70, 
+    0xC8, 0x07, 0x01, 0x09, 0x19, 0x04, 0xD8, 0x04, 0x54, 0x18, 0x80, 0xA7, 0x0E, 0x88, 0x87, 0x52, 
+    0x00, 0x03, 0x22, 0x21, 0x90, 0x42, 0x03, 0x75, 0x23, 0xA0, 0x0A, 0x33, 0x00, 0x32, 0x11, 0x42, 
+    0x20, 0x42, 0x13, 0x55, 0x51, 0x45, 0x54, 0x44, 0x22, 0x23, 0x04, 0x12, 0x44, 0xB5, 0x08, 0x25, 
+    0x51, 0x74, 0x49, 0x40, 0xA7, 0x42, 0x04, 0x17, 0x78, 0x20, 0xE0, 0x00, 0x50, 0xA7, 0x15, 0x88, 
+    0x85, 0x18, 0x17, 0x04, 0x58, 0x88, 0x78, 0x75, 0x94, 0x90, 0xD8, 0x0C, 0x75, 0x41, 0x30, 0x03, 
+    0x23, 0x30, 0x50, 0xB7, 0x44, 0x00, 0x00, 0x43, 0xA4, 0x02, 0x11, 0x10, 0xA5, 0x03, 0x40, 0x45, 
+    0xA4, 0x00, 0x00, 0x42, 0x01, 0x00, 0xA4, 0x0C, 0x54, 0x45, 0x44, 0x52, 0x54, 0x15, 0x20, 0xA5, 
+    0x08, 0x01, 0x05, 0x10, 0x07, 0x30, 0x4B, 0x14, 0x77, 0x75, 0x47, 0x17, 0x11, 0x15, 0x87, 0x78, 
+    0x55, 0x59, 0x50, 0x46, 0x03, 0x89, 0x42, 0xE0, 0x4C, 0x02, 0x30, 0x20, 0x43, 0x08, 0x24, 0x14, 
+    0x44, 0x51, 0x10, 0xF4, 0x0A, 0x18, 0x25, 0x42, 0x52, 0x14, 0x24, 0x24, 0x45, 0x40, 0x15, 0x41, 
+    0x55, 0x02, 0x30, 0x4D, 0x08, 0x44, 0x91, 0x54, 0x40, 0x20, 0xA7, 0x04, 0x59, 0x58, 0x40, 0xF8, 
+    0x00, 0x02, 0x42, 0x30, 0xE0, 0x0F, 0x98, 0x88, 0x77, 0x75, 0x55, 0x00, 0x02, 0x22, 0xC4, 0x09, 
+    0x21, 0x21, 0x24, 0x43, 0x14, 0xA2, 0x4D, 0x17, 0x44, 0x24, 0x42, 0x52, 0x51, 0x45, 0x54, 0x04, 
+    0x04, 0x40, 0x05, 0x11, 0x4C, 0x13, 0x84, 0x59, 0x49, 0x55, 0x00, 0x57, 0x77, 0x49, 0x19, 0x17, 
+    0x55, 0x05, 0x88, 0x87, 0x77, 
+};
+
+const gfx_image_t STORY_CH2_IMG = {
+    .w = STORY_CH2_W, .h = STORY_CH2_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH2_PAL, .colors = STORY_CH2_PAL_SIZE,
+    .data = STORY_CH2_RLE, .size = STORY_CH2_RLE_SIZE,
 };
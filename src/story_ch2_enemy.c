@@ -6,180 +6,131 @@ const uint16_t STORY_CH2_ENEMY_PAL[STORY_CH2_ENEMY_PAL_SIZE] = {
     0x21A9, 0x8487, 0x3B9A, 0x43DA, 0x41C6, 0x4B93, 0x5C55, 0x3B32, 
 };
 
-const uint8_t STORY_CH2_ENEMY_IDX[(STORY_CH2_ENEMY_W * STORY_CH2_ENEMY_H) / 2] = {
-    0x33, 0x37, 0x33, 0xFB, 0xBB, 0x00, 0x0B, 0xBB, 0xB0, 0x00, 0xBB, 0xAA, 0xAA, 0xAA, 0xBA, 0xB0, 
-    0xB0, 0x0B, 0xB0, 0x0B, 0xBB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xBA, 0xAD, 0xDE, 0x00, 0x23, 0x27, 0x33, 0x32, 0x37, 0x73, 0x33, 0x27, 0x72, 0x52, 0x57, 0x27, 
-    0x42, 0x22, 0x33, 0x37, 0x33, 0x3F, 0xB0, 0x00, 0x00, 0x0B, 0xBB, 0x00, 0xBA, 0xAA, 0xBB, 0xBB, 
-    0xBB, 0x00, 0xB0, 0xB0, 0x00, 0xBB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xBE, 0x00, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x37, 0x33, 0x77, 0x57, 0x55, 
-    0x55, 0x22, 0x33, 0x32, 0x77, 0x37, 0x33, 0x33, 0xD0, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xED, 0x27, 0x23, 0x33, 0xD2, 0x72, 0x75, 0x33, 0x33, 0x35, 
-    0x72, 0x75, 0x52, 0x23, 0x37, 0x73, 0x57, 0x57, 0x77, 0x33, 0xFB, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xAA, 0xBB, 0xBA, 0xAA, 0xAA, 0xBD, 0xAA, 
-    0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xEA, 0xAD, 0x02, 0xDF, 0x33, 0x33, 0x34, 0x22, 0x77, 
-    0x75, 0x33, 0x27, 0x47, 0x57, 0x77, 0x37, 0x72, 0x77, 0x55, 0x55, 0x33, 0x3F, 0x00, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB0, 
-    0x00, 0xEB, 0xBB, 0xBB, 0xAA, 0xAA, 0xAA, 0xAA, 0xBE, 0x2D, 0xD2, 0x33, 0xFF, 0xFD, 0x3D, 0xE2, 
-    0xDE, 0x27, 0x55, 0x77, 0x77, 0x53, 0x55, 0x77, 0x33, 0x33, 0x55, 0x55, 0x57, 0x33, 0xFB, 0xBB, 
-    0x0B, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xB0, 0x00, 0x02, 0x02, 0xBB, 0xBB, 0xAA, 0xAA, 0xAA, 0xAA, 0xEE, 0xDD, 0xDF, 0xDD, 0xDD, 0xAA, 
-    0xBB, 0xAE, 0xE2, 0x24, 0x77, 0x72, 0x35, 0x33, 0x35, 0x33, 0x33, 0x32, 0x55, 0x55, 0x55, 0x3F, 
-    0xBB, 0x0B, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 
-    0x00, 0x00, 0x0E, 0x24, 0xC5, 0x54, 0xDB, 0xBB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xDE, 0xD2, 0xEA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xDE, 0xD0, 0x27, 0x73, 0x33, 0x73, 0x35, 0x52, 0x33, 0x32, 0x55, 0x55, 
-    0x55, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xD5, 0x55, 0x55, 0x55, 0x53, 0x0B, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEE, 
-    0x2D, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xED, 0xD2, 0x77, 0x77, 0x33, 0x33, 0x35, 0x54, 0x2D, 0xD3, 
-    0x55, 0x55, 0x55, 0x83, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x45, 0x55, 0xC5, 0x58, 0x0B, 0xBA, 0xBB, 0xBB, 0xBA, 
-    0xAA, 0x0B, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBE, 0xED, 0x33, 0x33, 0x33, 0x33, 0x33, 0x85, 
-    0x53, 0xDD, 0x55, 0x55, 0x53, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x45, 0x5C, 0x44, 0x8F, 0x0B, 0xBB, 0xBB, 
-    0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xD3, 0xD3, 0xFF, 0x3F, 0x33, 
-    0x3D, 0xF5, 0xC5, 0x52, 0x55, 0x58, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x22, 0x22, 0x22, 0x22, 0x2D, 0xB0, 
-    0x00, 0xBB, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0xDE, 0x0D, 0xFF, 
-    0xFD, 0xFF, 0x33, 0xD2, 0x42, 0x85, 0x85, 0x80, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xE0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB0, 0x0B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0x0D, 0xDD, 0x3E, 0xFF, 0x3D, 0xFF, 0x3C, 0x2D, 0x33, 0x30, 0x00, 0x00, 0x00, 0xE3, 0x33, 0x3D, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xE0, 0x00, 0x00, 0xE2, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0xD0, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0x84, 0x30, 0x33, 0x23, 0xD0, 0x00, 0x00, 0x37, 
-    0x77, 0x73, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xDE, 0xE0, 0x00, 0x0D, 0x22, 0x22, 0x22, 
-    0x20, 0x22, 0x22, 0x22, 0x22, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0x2D, 0x88, 0x33, 0x83, 0x2D, 
-    0xED, 0x85, 0x55, 0x55, 0x30, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0xEE, 0x2E, 0x00, 0x00, 0xE2, 0x22, 
-    0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x22, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x42, 0x55, 0x82, 
-    0x38, 0x83, 0x33, 0x33, 0x55, 0x55, 0x8D, 0x00, 0x00, 0xE0, 0xE2, 0xE2, 0x02, 0x20, 0x20, 0x0E, 
-    0x22, 0x22, 0x22, 0x20, 0x02, 0x22, 0x02, 0x22, 0x22, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x35, 0x33, 0x38, 0x88, 0x83, 0x33, 0x33, 0x88, 0x3E, 0x00, 0x00, 0x00, 0xE2, 0xE2, 0x22, 0x22, 
-    0x3D, 0x02, 0x22, 0x22, 0x22, 0x02, 0x22, 0x02, 0x00, 0x22, 0x22, 0xCD, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x24, 0x33, 0x37, 0x38, 0x88, 0x88, 0x88, 0x83, 0x33, 0x2E, 0x00, 0x00, 0xE0, 0x33, 0x33, 
-    0x72, 0x22, 0x22, 0xD2, 0x32, 0x22, 0x20, 0x22, 0x22, 0x20, 0x22, 0x22, 0x22, 0xC0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x23, 0x47, 0x58, 0x88, 0x88, 0x88, 0x88, 0x83, 0x88, 0x33, 0xD2, 0x33, 
-    0x27, 0x73, 0x73, 0x32, 0x23, 0x32, 0x32, 0x22, 0x22, 0x22, 0x02, 0x20, 0x00, 0x22, 0x22, 0x52, 
-    0xDD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x42, 0x85, 0x38, 0x83, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x32, 0x77, 0x77, 0x77, 0x77, 0x27, 0x23, 0x32, 0x22, 0x22, 0x20, 0x26, 0x62, 0x22, 0x00, 0x22, 
-    0x24, 0x58, 0x55, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x73, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x83, 0x77, 0x77, 0x77, 0x77, 0x22, 0x77, 0x22, 0x22, 0x22, 0x0D, 0x22, 0x02, 0x22, 
-    0x20, 0x22, 0x24, 0x20, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xF3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x73, 0x73, 0x58, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x83, 0x83, 0x22, 0x37, 0x47, 0x74, 0x47, 0x77, 0x32, 0x32, 0x22, 0x20, 0x22, 
-    0x22, 0x22, 0x20, 0x22, 0x2C, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x33, 0x3F, 0xFF, 0xDD, 0x00, 0x00, 0x0D, 0x77, 0x77, 0x37, 0x75, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0x33, 0x22, 0x37, 0x77, 0x77, 0x47, 0x77, 0x37, 0x33, 0x22, 
-    0x22, 0x02, 0x20, 0x02, 0x02, 0x22, 0x24, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x33, 0x33, 0xFF, 0x33, 0x00, 0xD3, 0x33, 0x78, 0x88, 
-    0x77, 0x78, 0x88, 0x85, 0x88, 0x88, 0x88, 0x83, 0x77, 0x74, 0x22, 0x77, 0x77, 0x77, 0x77, 0x73, 
-    0x77, 0x22, 0x22, 0x20, 0x00, 0x22, 0x02, 0x22, 0x2C, 0x52, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0x83, 0xD3, 0xF3, 0x33, 0x33, 0x33, 
-    0x85, 0x88, 0x85, 0x88, 0x88, 0x85, 0x88, 0x88, 0x88, 0x88, 0x37, 0x77, 0x22, 0x77, 0x77, 0x77, 
-    0x47, 0x77, 0x77, 0x22, 0x22, 0x22, 0x02, 0x00, 0x22, 0x22, 0x2C, 0x33, 0x3D, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x38, 0x8D, 0xD3, 0x33, 0x33, 
-    0x33, 0x33, 0x28, 0x38, 0x55, 0x33, 0x33, 0x55, 0x88, 0x88, 0x88, 0x88, 0x87, 0x77, 0x47, 0x77, 
-    0x77, 0x72, 0x77, 0x77, 0x77, 0x72, 0x22, 0x20, 0x00, 0x22, 0x22, 0x22, 0x2C, 0x55, 0x54, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD3, 0xD0, 0x00, 0x00, 0x38, 0x33, 0x38, 
-    0x83, 0x88, 0x88, 0x88, 0x24, 0x45, 0x57, 0x33, 0x77, 0x58, 0x88, 0x88, 0x88, 0x83, 0x85, 0x77, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2C, 0x2C, 0x55, 
-    0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xDD, 0xD0, 0x0F, 0xF3, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x38, 0x83, 0x44, 0x77, 0x77, 0x73, 0x73, 0x58, 0x88, 0x88, 0x88, 0x33, 
-    0x77, 0x73, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2C, 
-    0x2C, 0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0xD3, 0xFF, 0xFF, 0x33, 
-    0x33, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x44, 0x74, 0x44, 0x77, 0x45, 0x88, 0x83, 0x88, 
-    0x88, 0x83, 0x77, 0x77, 0x77, 0x77, 0x57, 0x77, 0x77, 0x55, 0x77, 0x75, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x54, 0x2C, 0xC2, 0x33, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x33, 0x33, 0x33, 0x88, 
-    0x88, 0x32, 0x33, 0x33, 0x33, 0x33, 0x55, 0x33, 0x33, 0x33, 0x77, 0x77, 0x74, 0x43, 0x75, 0x88, 
-    0x88, 0x88, 0x55, 0x33, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x55, 0x57, 0x77, 0x75, 0x22, 0x22, 
-    0x22, 0x22, 0x25, 0x52, 0x24, 0x55, 0x73, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF3, 0x83, 0x88, 
-    0x33, 0x83, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x77, 0x77, 0x77, 0x33, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x33, 0x77, 0x77, 0x77, 0x77, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 
-    0x2C, 0x22, 0x22, 0x22, 0x25, 0xC2, 0x24, 0x77, 0x73, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x83, 0x33, 0x33, 0x33, 0x33, 0x32, 0x33, 0x33, 0x33, 0x32, 0x22, 0x44, 0x77, 
-    0x73, 0x73, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0x27, 0x77, 0x77, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x42, 0x22, 0x22, 0x55, 0x22, 0x24, 0x57, 0x73, 0x20, 0x00, 0x00, 0x00, 0x0E, 
-    0x33, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x88, 0x33, 0x88, 0x33, 0x82, 0x24, 
-    0x74, 0x47, 0x42, 0x33, 0x85, 0x88, 0x88, 0x88, 0x88, 0x82, 0x00, 0x04, 0x45, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x74, 0x46, 0x22, 0x2C, 0x42, 0x22, 0x22, 0x55, 0x77, 0x3D, 0xE0, 0x00, 
-    0x00, 0xE0, 0x44, 0x44, 0x37, 0x58, 0x88, 0x88, 0x53, 0x38, 0x83, 0x38, 0x88, 0x88, 0x88, 0x88, 
-    0x82, 0x44, 0x77, 0x77, 0x44, 0x72, 0x35, 0x88, 0x88, 0x88, 0x88, 0x87, 0x40, 0x04, 0x45, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x49, 0x99, 0x44, 0x5C, 0xCC, 0xC4, 0x45, 0x57, 0x55, 0x33, 
-    0x20, 0x00, 0xE2, 0x44, 0x44, 0x44, 0x47, 0x88, 0x88, 0x58, 0x52, 0x27, 0x58, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x83, 0x44, 0x77, 0x57, 0x44, 0x73, 0x85, 0x88, 0x88, 0x88, 0x88, 0x85, 0x55, 0x44, 
-    0x57, 0x75, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x49, 0x99, 0x44, 0xCC, 0xCC, 0xC4, 0xC4, 0x44, 
-    0x45, 0x32, 0xE0, 0x00, 0x24, 0x44, 0x44, 0x47, 0x77, 0x78, 0x33, 0x85, 0x82, 0x4C, 0x88, 0x83, 
-    0x88, 0x38, 0x32, 0x83, 0x32, 0x44, 0x77, 0x77, 0xCC, 0x58, 0x88, 0x88, 0x84, 0x48, 0x88, 0x84, 
-    0xC4, 0xCC, 0x44, 0x44, 0x74, 0xC5, 0x55, 0x55, 0x55, 0x44, 0xC9, 0x49, 0x02, 0xCC, 0xCC, 0x4C, 
-    0xC4, 0x94, 0xC5, 0x44, 0x42, 0x22, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x24, 0x4C, 0xCC, 
-    0x44, 0x44, 0xCC, 0xC4, 0x44, 0x44, 0x44, 0x44, 0x57, 0x45, 0x5C, 0x58, 0x88, 0x88, 0x8C, 0xC5, 
-    0x88, 0x80, 0x44, 0xCC, 0x44, 0x44, 0x4C, 0x55, 0x55, 0x55, 0x55, 0x44, 0xC4, 0x44, 0x42, 0xCC, 
-    0x44, 0x44, 0xC4, 0x44, 0xC5, 0x5C, 0x5C, 0x4C, 0x4C, 0xCC, 0x44, 0x44, 0x4C, 0x44, 0x44, 0x44, 
-    0xC5, 0xC5, 0xCC, 0x4C, 0xCC, 0xC4, 0x4C, 0xCC, 0xC4, 0x44, 0x20, 0x60, 0x45, 0x22, 0x38, 0x88, 
-    0x8C, 0xC5, 0x80, 0x00, 0x47, 0xCC, 0x47, 0x77, 0x4C, 0x55, 0x55, 0x55, 0x55, 0x44, 0xC4, 0x44, 
-    0x52, 0xCC, 0x24, 0x44, 0xC4, 0x44, 0xC5, 0x5C, 0x5C, 0x24, 0xCC, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0xC5, 0x55, 0x44, 0x44, 0xC4, 0xC4, 0x4C, 0x44, 0x44, 0x44, 0x44, 0x42, 0x45, 0x42, 
-    0x32, 0x44, 0x2C, 0xC4, 0x00, 0x04, 0xC4, 0xC5, 0x55, 0x57, 0x7C, 0x55, 0x55, 0x55, 0x57, 0x44, 
-    0xC4, 0x45, 0x52, 0x4C, 0x24, 0x24, 0xC5, 0x55, 0xC5, 0x5C, 0x54, 0x24, 0x44, 0x24, 0x24, 0x44, 
-    0x44, 0x42, 0x44, 0x44, 0xCC, 0x5C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x26, 0x66, 
-    0xC5, 0x40, 0x26, 0x66, 0x2C, 0x54, 0x00, 0x00, 0x02, 0x4C, 0x42, 0x22, 0x25, 0xC4, 0x22, 0x22, 
-    0x26, 0x0C, 0x54, 0x22, 0x22, 0x4C, 0x24, 0x44, 0x42, 0x24, 0x55, 0x4C, 0x54, 0x22, 0x42, 0x22, 
-    0x22, 0x22, 0x24, 0x42, 0x24, 0x22, 0x4C, 0x5C, 0x22, 0x22, 0x24, 0x44, 0x22, 0x42, 0x24, 0x44, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x66, 0x66, 0x66, 0x61, 0x66, 0x66, 0x14, 0x41, 
-    0x66, 0x66, 0x66, 0x69, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x26, 0x60, 0x11, 0x11, 0x11, 0x99, 
-    0x10, 0x06, 0x66, 0x06, 0x66, 0x66, 0x66, 0x66, 0x44, 0x44, 0x42, 0x24, 0x42, 0x22, 0x22, 0x22, 
-    0x22, 0x4C, 0x66, 0x91, 0x96, 0x69, 0x99, 0x61, 0x96, 0x16, 0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x99, 0x96, 0x91, 0x11, 0x10, 0x20, 0x2C, 0x22, 0x49, 0x11, 0x19, 0x99, 
-    0x91, 0x11, 0x11, 0x99, 0x91, 0x19, 0x91, 0x96, 0x91, 0x11, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x22, 0x45, 0x66, 0x11, 0x06, 0x66, 0x99, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x91, 0x11, 0x19, 0x96, 0x69, 0x11, 0x11, 0x45, 0x55, 0x54, 0x69, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x60, 0x11, 
-    0x19, 0x99, 0x91, 0x11, 0x19, 0x44, 0x61, 0x19, 0x96, 0x66, 0x66, 0x66, 0x91, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x91, 0x11, 0x11, 0x99, 0x16, 0x62, 0x25, 0x55, 0x5C, 
-    0x22, 0x61, 0x19, 0x11, 0x91, 0x11, 0x96, 0x69, 0x19, 0x91, 0x11, 0x11, 0x19, 0x11, 0x99, 0x66, 
-    0x99, 0x11, 0x99, 0x91, 0x69, 0x11, 0x19, 0x96, 0x11, 0x11, 0x96, 0x66, 0x66, 0x66, 0x61, 0x11, 
-    0x11, 0x16, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 0x66, 0x96, 0x69, 0x66, 0x66, 0x66, 0x00, 0x00, 
-    0x22, 0x22, 0x22, 0x26, 0x66, 0x99, 0x11, 0x99, 0x99, 0x99, 0x19, 0x96, 0x99, 0x99, 0x99, 0x66, 
-    0x96, 0x66, 0x99, 0x16, 0x99, 0x19, 0x11, 0x11, 0x19, 0x11, 0x99, 0x91, 0x96, 0x66, 0x66, 0x69, 
-    0x69, 0x66, 0x66, 0x66, 0x66, 0x69, 0x19, 0x99, 0x99, 0x66, 0x99, 0x69, 0x66, 0x66, 0x66, 0x66, 
-    0x20, 0x20, 0x22, 0x22, 0x22, 0x54, 0x91, 0x11, 0x19, 0x99, 0x19, 0x91, 0x19, 0x99, 0x96, 0x69, 
-    0x66, 0x66, 0x99, 0x66, 0x19, 0x99, 0x91, 0x96, 0x91, 0x11, 0x99, 0x99, 0x11, 0x66, 0x66, 0x69, 
-    0x69, 0x91, 0x99, 0x19, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x49, 0x91, 0x66, 0x19, 0x61, 0x11, 0x19, 0x19, 
-    0x19, 0x69, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x69, 0x99, 0x69, 0x96, 0x99, 0x91, 0x19, 0x19, 
-    0x11, 0x11, 0x91, 0x91, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x99, 0x99, 0x61, 0x99, 0x96, 
-    0x66, 0x66, 0x66, 0x22, 0x22, 0x2C, 0x22, 0x22, 0x22, 0x22, 0x54, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x11, 0x11, 0x16, 0x69, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x96, 0x19, 0x96, 0x69, 0x69, 0x99, 0x99, 0x11, 0x91, 0x19, 0x11, 0x69, 
-    0x91, 0x99, 0x00, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xC2, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91, 0x11, 0x11, 0x11, 0x16, 0x96, 0x16, 0x61, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x19, 0x91, 0x99, 0x99, 0x11, 0x11, 0x96, 0x19, 
-    0x99, 0x99, 0x99, 0x96, 0x45, 0x55, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x44, 
-    0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x99, 
-    0x11, 0x96, 0x66, 0x96, 0x66, 0x66, 0x04, 0x44, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2C, 
-    0x25, 0x55, 0x54, 0x44, 0x01, 0x10, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 
-    0x11, 0x16, 0x61, 0x11, 0x11, 0x61, 0x11, 0x11, 0x11, 0x96, 0x99, 0x66, 0x66, 0x66, 0x66, 0x96, 
-    0x69, 0x99, 0x19, 0x66, 0x69, 0x66, 0x16, 0x66, 0x66, 0x66, 0x0C, 0x52, 0x02, 0x2C, 0x22, 0x22, 
-    0x22, 0x25, 0x54, 0x44, 0xC0, 0x25, 0x44, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x16, 0x19, 0x61, 0x91, 0x11, 0x11, 0x11, 0x11, 0x96, 0x69, 0x66, 0x69, 0x66, 
-    0x66, 0x11, 0x11, 0x11, 0x11, 0x19, 0x19, 0x69, 0x66, 0x66, 0x60, 0x02, 0x42, 0x02, 0x25, 0x55, 
-    0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xCC, 0x40, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x16, 0x11, 0x16, 0x61, 0x11, 0x11, 0x11, 0x11, 0x19, 0x66, 0x96, 
-    0x11, 0x11, 0x11, 0x11, 0x99, 0x11, 0x11, 0x11, 0x19, 0x11, 0x66, 0x69, 0x94, 0x5C, 0x22, 0xC5, 
-    0x55, 0x54, 0x77, 0x55, 0x75, 0x77, 0x74, 0x44, 0x44, 0x44, 0x10, 0x91, 0x11, 0x44, 0x11, 0x41, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x61, 0x19, 0x11, 0x11, 0x11, 0x11, 
-    0x66, 0x11, 0x61, 0x41, 0x61, 0x11, 0x96, 0x11, 0x11, 0x11, 0x66, 0x61, 0x19, 0x69, 0x90, 0x44, 
-    0x45, 0x54, 0x44, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 0x44, 0x41, 0x01, 0x66, 0x61, 0x11, 0x16, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 
-    0x11, 0x11, 0x41, 0x11, 0x11, 0x61, 0x11, 0x99, 0x46, 0x99, 0x41, 0x11, 0x66, 0x11, 0x11, 0x10, 
-    0x61, 0x66, 0x19, 0x91, 0x11, 0x11, 0x11, 0x99, 0x11, 0x11, 0x66, 0x14, 0x44, 0x44, 0x16, 0x61, 
-    0x11, 0x16, 0x11, 0x11, 0x01, 0x16, 0x11, 0x11, 0x11, 0x16, 0x61, 0x11, 0x14, 0x19, 0x96, 0x69, 
+const uint8_t STORY_CH2_ENEMY_RLE[STORY_CH2_ENEMY_RLE_SIZE] = {
+    0x0C, 0x33, 0x37, 0x33, 0xFB, 0xBB, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x0B, 0xB0, 0xCA, 0x0D, 0xBA, 
+    0xB0, 0xB0, 0x0B, 0xB0, 0x0B, 0xBB, 0xFA, 0x0D, 0x23, 0xBA, 0xAD, 0xDE, 0x00, 0x23, 0x27, 0x33, 
+    0x32, 0x37, 0x73, 0x33, 0x27, 0x72, 0x52, 0x57, 0x27, 0x42, 0x22, 0x44, 0x02, 0x3F, 0xB0, 0xC0, 
+    0x08, 0xBB, 0xB0, 0x0B, 0xAA, 0xA0, 0xCB, 0x0A, 0x00, 0xB0, 0xB0, 0x00, 0xBB, 0xB0, 0xFA, 0x10, 
+    0x06, 0xBE, 0x00, 0x22, 0x20, 0xF3, 0x01, 0x06, 0x73, 0x37, 0x75, 0x70, 0xA5, 0x07, 0x22, 0x33, 
+    0x32, 0x77, 0x43, 0x01, 0x3D, 0x47, 0xFB, 0x00, 0xF0, 0x01, 0xAB, 0xEA, 0x00, 0xB0, 0xFA, 0x08, 
+    0x04, 0xBE, 0xD2, 0x70, 0x42, 0x05, 0xD2, 0x72, 0x75, 0xB3, 0x16, 0x57, 0x27, 0x55, 0x22, 0x33, 
+    0x77, 0x35, 0x75, 0x77, 0x73, 0x3F, 0xB0, 0xA0, 0xFB, 0x00, 0xF0, 0x05, 0x05, 0xBA, 0xAB, 0xBB, 
+    0xBA, 0x04, 0xBD, 0xAA, 0xB0, 0xFA, 0x03, 0x08, 0xEE, 0xAA, 0xD0, 0x2D, 0xF0, 0xB3, 0x16, 0x42, 
+    0x27, 0x77, 0x53, 0x32, 0x74, 0x75, 0x77, 0x73, 0x77, 0x27, 0x70, 0xA5, 0x05, 0x33, 0x3F, 0x00, 
+    0xFB, 0x00, 0xF0, 0x05, 0xFB, 0x03, 0x03, 0x00, 0x0E, 0xBB, 0xEA, 0x15, 0xBE, 0x2D, 0xD2, 0x33, 
+    0xFF, 0xFD, 0x3D, 0xE2, 0xDE, 0x27, 0x55, 0xA7, 0x05, 0x53, 0x55, 0x77, 0xA3, 0xB5, 0x07, 0x73, 
+    0x3F, 0xBB, 0xB0, 0xBB, 0xF0, 0x07, 0xFB, 0x02, 0xA0, 0x02, 0x20, 0x20, 0x4A, 0x05, 0xEE, 0xDD, 
+    0xDF, 0xAD, 0x13, 0xAA, 0xBB, 0xAE, 0xE2, 0x24, 0x77, 0x72, 0x35, 0x33, 0x35, 0xB3, 0x00, 0x20, 
+    0xC5, 0x04, 0x3F, 0xBB, 0x00, 0xBB, 0xF0, 0x0B, 0xAB, 0xB0, 0x07, 0xE2, 0x4C, 0x55, 0x4D, 0x49, 
+    0x06, 0xAA, 0xDE, 0xD2, 0xE0, 0xFA, 0x00, 0x0F, 0xDE, 0xD0, 0x27, 0x73, 0x33, 0x73, 0x35, 0x52, 
+    0x4B, 0xF0, 0x1A, 0x00, 0xD0, 0xE5, 0x01, 0x30, 0x49, 0x03, 0xEE, 0x2D, 0xFA, 0x00, 0x04, 0xBE, 
+    0xDD, 0x20, 0xA7, 0xB3, 0x06, 0x55, 0x42, 0xDD, 0x30, 0xC5, 0x01, 0x83, 0x64, 0x0B, 0x45, 0x55, 
+    0xC5, 0x58, 0x0B, 0xBA, 0xBB, 0x04, 0xAA, 0xA0, 0xB0, 0xFA, 0x03, 0x03, 0xBE, 0xED, 0xF3, 0x01, 
+    0x05, 0x85, 0x53, 0xDD, 0xB5, 0x02, 0x3F, 0xD0, 0xF0, 0x1C, 0x09, 0x84, 0x55, 0xC4, 0x48, 0xF0, 
+    0xCB, 0xFA, 0x0B, 0x17, 0x0D, 0x3D, 0x3F, 0xF3, 0xF3, 0x33, 0xDF, 0x5C, 0x55, 0x25, 0x55, 0x8D, 
+    0xF0, 0x1C, 0x00, 0xE0, 0xF2, 0x01, 0x04, 0xDB, 0x00, 0x00, 0x4B, 0xFB, 0x01, 0x15, 0xAD, 0xE0, 
+    0xDF, 0xFF, 0xDF, 0xF3, 0x3D, 0x24, 0x28, 0x58, 0x58, 0xF0, 0x00, 0x02, 0xDD, 0xE0, 0xF0, 0x08, 
+    0x00, 0xE0, 0xD0, 0x00, 0xD0, 0xF2, 0x04, 0xB0, 0xFB, 0x03, 0x01, 0x00, 0xFB, 0x02, 0x12, 0x0D, 
+    0xDD, 0x3E, 0xFF, 0x3D, 0xFF, 0x3C, 0x2D, 0x33, 0x30, 0xD0, 0x00, 0xE0, 0xA3, 0x00, 0xD0, 0xF0, 
+    0x05, 0x01, 0xEE, 0x44, 0x00, 0xE0, 0xF2, 0x06, 0x00, 0xD0, 0xD0, 0xAB, 0xF0, 0x02, 0x00, 0xB0, 
+    0xF0, 0x03, 0x0E, 0xFD, 0x00, 0x0F, 0x84, 0x30, 0x33, 0x23, 0xD0, 0xB0, 0x00, 0x30, 0xA7, 0x01, 
+    0x3D, 0xF0, 0x02, 0x02, 0xEE, 0xD0, 0x44, 0x00, 0xD0, 0xD2, 0x00, 0x00, 0xE2, 0x01, 0xCD, 0xF0, 
+    0x1F, 0x0E, 0xF2, 0x2D, 0x88, 0x33, 0x83, 0x2D, 0xED, 0x80, 0xB5, 0x00, 0x30, 0xE0, 0x06, 0xE0, 
+    0xEE, 0xE2, 0xE0, 0xA0, 0x00, 0xE0, 0xF2, 0x01, 0x00, 0x00, 0x6E, 0x0A, 0x0D, 0x42, 0x55, 0x82, 
+    0x38, 0x80, 0xB3, 0xA5, 0x01, 0x8D, 0xA0, 0x0D, 0xE0, 0xE2, 0xE2, 0x02, 0x20, 0x20, 0x0E, 0xD2, 
+    0x05, 0x00, 0x22, 0x20, 0x6E, 0x07, 0x02, 0x23, 0x53, 0x33, 0xA8, 0xB3, 0x03, 0x88, 0x3E, 0xC0, 
+    0x42, 0xA2, 0x02, 0x3D, 0x00, 0xD2, 0x07, 0x02, 0x22, 0x02, 0x00, 0x6F, 0x04, 0x43, 0x33, 0x70, 
+    0x43, 0xA8, 0x03, 0x33, 0x32, 0x43, 0x01, 0xE0, 0xA3, 0x00, 0x70, 0xB2, 0x02, 0xD2, 0x30, 0xA2, 
+    0x00, 0x00, 0xB2, 0x00, 0x00, 0xC2, 0x00, 0xC0, 0xF0, 0x23, 0x05, 0x22, 0x34, 0x75, 0xF8, 0x01, 
+    0x13, 0x38, 0x83, 0x3D, 0x23, 0x32, 0x77, 0x37, 0x33, 0x22, 0x33, 0x44, 0x08, 0x22, 0x20, 0x22, 
+    0x00, 0x00, 0xA2, 0x04, 0x52, 0xDD, 0xD0, 0xF0, 0x20, 0x09, 0x43, 0x42, 0x85, 0x38, 0x83, 0xF8, 
+    0x01, 0x01, 0x32, 0xE7, 0x01, 0x27, 0x42, 0xB2, 0x06, 0x02, 0x66, 0x22, 0x20, 0x43, 0x05, 0x45, 
+    0x85, 0x5C, 0xF0, 0x20, 0x05, 0x77, 0x74, 0x73, 0xF8, 0x06, 0x00, 0x30, 0x47, 0x02, 0x27, 0x70, 
+    0xC2, 0x04, 0x0D, 0x22, 0x00, 0xA2, 0x43, 0x04, 0x20, 0x0D, 0xD0, 0xF0, 0x12, 0x02, 0xF3, 0x30, 
+    0x4C, 0x03, 0x37, 0x35, 0xF8, 0x03, 0x11, 0x38, 0x32, 0x23, 0x74, 0x77, 0x44, 0x77, 0x73, 0x23, 
+    0xA2, 0x00, 0x00, 0xD2, 0x42, 0x02, 0xC2, 0xD0, 0xF0, 0x14, 0x08, 0xF3, 0x33, 0xFF, 0xFD, 0xD0, 
+    0xB0, 0x00, 0xD0, 0xA7, 0x03, 0x37, 0x75, 0x4A, 0x00, 0x30, 0x43, 0xA7, 0x43, 0x02, 0x73, 0x30, 
+    0xA2, 0x06, 0x02, 0x20, 0x02, 0x00, 0xA2, 0x02, 0x40, 0xF0, 0x5F, 0x11, 0x3F, 0xF3, 0x30, 0x0D, 
+    0x33, 0x37, 0x88, 0x87, 0x77, 0xA8, 0x00, 0x50, 0x46, 0x05, 0x77, 0x74, 0x22, 0xF7, 0x00, 0x02, 
+    0x37, 0x70, 0xB2, 0x03, 0x00, 0x02, 0x44, 0x04, 0xC5, 0x2F, 0xF0, 0x5A, 0x06, 0x88, 0x83, 0xD3, 
+    0xF0, 0xD3, 0x05, 0x85, 0x88, 0x85, 0xB8, 0x46, 0x04, 0x83, 0x77, 0x70, 0x46, 0x00, 0x40, 0xB7, 
+    0xC2, 0x03, 0x02, 0x00, 0xB2, 0x04, 0xC3, 0x33, 0xD0, 0xF0, 0x12, 0x05, 0xE3, 0x88, 0xDD, 0xF3, 
+    0x00, 0x05, 0x28, 0x38, 0x55, 0xA3, 0x00, 0x50, 0x47, 0x04, 0x87, 0x77, 0x40, 0xC7, 0x00, 0x20, 
+    0xD7, 0xA2, 0x02, 0x00, 0x00, 0xD2, 0x05, 0xC5, 0x55, 0x42, 0xF0, 0x09, 0x03, 0xDD, 0x3D, 0xB0, 
+    0x07, 0x38, 0x33, 0x38, 0x83, 0xC8, 0x0A, 0x24, 0x45, 0x57, 0x33, 0x77, 0x50, 0xE8, 0x02, 0x38, 
+    0x50, 0xF7, 0x08, 0xF2, 0x03, 0x00, 0xC0, 0x43, 0x01, 0x53, 0xF0, 0x08, 0x00, 0xF0, 0xAD, 0x03, 
+    0x00, 0xFF, 0xF3, 0x03, 0x04, 0x88, 0x34, 0x40, 0xB7, 0x02, 0x37, 0x30, 0x46, 0x05, 0x33, 0x77, 
+    0x73, 0xF7, 0x06, 0x00, 0x30, 0x4C, 0x03, 0x73, 0x33, 0xF0, 0x04, 0x06, 0xEE, 0x00, 0x0D, 0x30, 
+    0xAF, 0xA3, 0x01, 0x22, 0xF3, 0x03, 0x0D, 0x44, 0x74, 0x44, 0x77, 0x45, 0x88, 0x83, 0xB8, 0x42, 
+    0xB7, 0x00, 0x50, 0xB7, 0x05, 0x55, 0x77, 0x75, 0xF2, 0x01, 0x08, 0x54, 0x2C, 0xC2, 0x33, 0xE0, 
+    0xF0, 0x03, 0x00, 0xD0, 0xC3, 0xA8, 0x01, 0x32, 0xE3, 0x01, 0x55, 0xC3, 0xB7, 0x03, 0x44, 0x37, 
+    0x42, 0x05, 0x88, 0x85, 0x53, 0x47, 0x02, 0x77, 0x70, 0xA5, 0xA7, 0x48, 0x07, 0x55, 0x22, 0x45, 
+    0x57, 0x4A, 0x09, 0xEF, 0x38, 0x38, 0x83, 0x38, 0xF3, 0x0C, 0xC7, 0x01, 0x33, 0xF8, 0x01, 0x48, 
+    0xF5, 0x00, 0x42, 0x00, 0xC0, 0x46, 0x05, 0xC2, 0x24, 0x77, 0x4A, 0xF3, 0x01, 0x49, 0x00, 0x20, 
+    0xD3, 0x09, 0x22, 0x24, 0x47, 0x77, 0x37, 0x49, 0x02, 0x83, 0x20, 0xB7, 0xF5, 0x07, 0x00, 0x40, 
+    0xB2, 0x0A, 0x55, 0x22, 0x24, 0x57, 0x73, 0x20, 0xE0, 0x04, 0xE3, 0x33, 0x70, 0xF3, 0x06, 0x16, 
+    0x88, 0x83, 0x38, 0x83, 0x38, 0x22, 0x47, 0x44, 0x74, 0x23, 0x38, 0x50, 0xF8, 0x00, 0x05, 0x20, 
+    0x00, 0x44, 0xF5, 0x06, 0x08, 0x74, 0x46, 0x22, 0x2C, 0x40, 0xB2, 0x06, 0x55, 0x77, 0x3D, 0xE0, 
+    0xB0, 0x01, 0xE0, 0xA4, 0x02, 0x37, 0x50, 0xB8, 0x04, 0x53, 0x38, 0x80, 0x43, 0xD8, 0x02, 0x24, 
+    0x40, 0xA7, 0x04, 0x44, 0x72, 0x30, 0x48, 0x01, 0x74, 0x51, 0x06, 0x49, 0x99, 0x44, 0x50, 0xAC, 
+    0x0E, 0x44, 0x55, 0x75, 0x53, 0x32, 0x00, 0x0E, 0x20, 0xD4, 0x00, 0x70, 0xA8, 0x06, 0x58, 0x52, 
+    0x27, 0x50, 0xF8, 0x03, 0x00, 0x30, 0x42, 0x00, 0x50, 0x42, 0x01, 0x38, 0x48, 0x0A, 0x55, 0x54, 
+    0x45, 0x77, 0x55, 0x40, 0xF5, 0x00, 0x00, 0x40, 0x44, 0xBC, 0x01, 0x4C, 0xA4, 0x07, 0x53, 0x2E, 
+    0x00, 0x02, 0xC4, 0xA7, 0x16, 0x83, 0x38, 0x58, 0x24, 0xC8, 0x88, 0x38, 0x83, 0x83, 0x28, 0x33, 
+    0x20, 0x42, 0x04, 0x77, 0xCC, 0x50, 0xC8, 0x01, 0x44, 0xA8, 0x04, 0x4C, 0x4C, 0xC0, 0xA4, 0x02, 
+    0x74, 0xC0, 0xD5, 0x07, 0x44, 0xC9, 0x49, 0x02, 0xAC, 0x0D, 0x4C, 0xC4, 0x94, 0xC5, 0x44, 0x42, 
+    0x22, 0xF4, 0x03, 0x07, 0x24, 0x24, 0x4C, 0xCC, 0xA4, 0x02, 0xCC, 0xC0, 0xF4, 0x00, 0x04, 0x57, 
+    0x45, 0x50, 0x46, 0x07, 0xCC, 0x58, 0x88, 0x04, 0x45, 0x01, 0x4C, 0xE5, 0x02, 0x44, 0xC0, 0xA4, 
+    0x02, 0x2C, 0xC0, 0xA4, 0x0F, 0xC4, 0x44, 0xC5, 0x5C, 0x5C, 0x4C, 0x4C, 0xCC, 0xB4, 0x00, 0xC0, 
+    0xC4, 0x06, 0xC5, 0xC5, 0xCC, 0x40, 0xAC, 0x01, 0x44, 0xAC, 0x0B, 0x44, 0x42, 0x06, 0x04, 0x52, 
+    0x23, 0x46, 0x0A, 0x00, 0x04, 0x7C, 0xC4, 0x77, 0x70, 0x4E, 0x04, 0x52, 0xCC, 0x20, 0x4B, 0x03, 
+    0x24, 0xCC, 0xF4, 0x05, 0x03, 0xC5, 0x55, 0xA4, 0x01, 0xC4, 0x42, 0xF4, 0x00, 0x13, 0x24, 0x54, 
+    0x23, 0x24, 0x42, 0xCC, 0x40, 0x00, 0x4C, 0x4C, 0xA5, 0x01, 0x77, 0x46, 0x00, 0x70, 0x43, 0x0C, 
+    0x55, 0x24, 0xC2, 0x42, 0x4C, 0x55, 0x50, 0x43, 0x07, 0x42, 0x44, 0x42, 0x42, 0xC4, 0x00, 0x20, 
+    0x43, 0x02, 0xC5, 0xC0, 0xF4, 0x07, 0x0E, 0x26, 0x66, 0xC5, 0x40, 0x26, 0x66, 0x2C, 0x50, 0x42, 
+    0x05, 0x00, 0x24, 0xC4, 0xA2, 0x02, 0x5C, 0x40, 0xB2, 0x04, 0x60, 0xC5, 0x40, 0xA2, 0x42, 0x08, 
+    0x44, 0x42, 0x24, 0x55, 0x40, 0x42, 0x01, 0x24, 0xE2, 0x0A, 0x44, 0x22, 0x42, 0x24, 0xC5, 0xC0, 
+    0xB2, 0x0A, 0x44, 0x42, 0x24, 0x22, 0x44, 0x40, 0xF6, 0x05, 0x00, 0x00, 0xE6, 0x00, 0x10, 0xA6, 
+    0x03, 0x14, 0x41, 0xD6, 0x00, 0x90, 0xB6, 0xE2, 0x02, 0x66, 0x00, 0xC1, 0x08, 0x99, 0x10, 0x06, 
+    0x66, 0x00, 0xF6, 0x00, 0xB4, 0x03, 0x22, 0x44, 0xF2, 0x00, 0x14, 0x4C, 0x66, 0x91, 0x96, 0x69, 
+    0x99, 0x61, 0x96, 0x16, 0x99, 0x90, 0xF1, 0x08, 0x04, 0x99, 0x96, 0x90, 0xA1, 0x0B, 0x02, 0x02, 
+    0xC2, 0x24, 0x91, 0x11, 0xA9, 0xB1, 0x0F, 0x99, 0x91, 0x19, 0x91, 0x96, 0x91, 0x11, 0x41, 0xF4, 
+    0x05, 0x0F, 0x22, 0x45, 0x66, 0x11, 0x06, 0x66, 0x99, 0x66, 0xF1, 0x0B, 0x00, 0x90, 0xA1, 0x04, 
+    0x99, 0x66, 0x90, 0xA1, 0x00, 0x40, 0xA5, 0x01, 0x46, 0x42, 0xF1, 0x11, 0x05, 0x06, 0x01, 0x11, 
+    0xA9, 0xA1, 0x07, 0x94, 0x46, 0x11, 0x99, 0xD6, 0x00, 0x90, 0xF1, 0x0B, 0x01, 0x99, 0xB1, 0x06, 
+    0x99, 0x16, 0x62, 0x20, 0xA5, 0x13, 0xC2, 0x26, 0x11, 0x91, 0x19, 0x11, 0x19, 0x66, 0x91, 0x99, 
+    0xC1, 0x10, 0x91, 0x19, 0x96, 0x69, 0x91, 0x19, 0x99, 0x16, 0x90, 0x42, 0x01, 0x96, 0xA1, 0x46, 
+    0x00, 0x60, 0xC1, 0x00, 0x60, 0xF1, 0x00, 0x08, 0x99, 0x96, 0x69, 0x66, 0x90, 0xC6, 0xA0, 0xD2, 
+    0x06, 0x66, 0x69, 0x91, 0x10, 0xC9, 0x03, 0x19, 0x96, 0xC9, 0x03, 0x66, 0x96, 0x43, 0x04, 0x69, 
+    0x91, 0x90, 0xB1, 0x05, 0x91, 0x19, 0x99, 0x46, 0x02, 0x96, 0x90, 0xF6, 0x00, 0x01, 0x91, 0xB9, 
+    0x05, 0x66, 0x99, 0x69, 0xE6, 0x02, 0x20, 0x20, 0x45, 0x02, 0x54, 0x90, 0xA1, 0x07, 0x99, 0x91, 
+    0x99, 0x11, 0xA9, 0x02, 0x66, 0x90, 0xA6, 0x04, 0x99, 0x66, 0x10, 0xA9, 0x06, 0x19, 0x69, 0x11, 
+    0x10, 0xA9, 0x01, 0x11, 0xB6, 0x08, 0x96, 0x99, 0x19, 0x91, 0x90, 0xF6, 0x12, 0xF2, 0x03, 0x09, 
+    0x54, 0x99, 0x16, 0x61, 0x96, 0xA1, 0x06, 0x91, 0x91, 0x96, 0x90, 0xF1, 0x03, 0x0F, 0x69, 0x99, 
+    0x69, 0x96, 0x99, 0x91, 0x19, 0x19, 0xA1, 0x03, 0x91, 0x91, 0xF6, 0x04, 0xB9, 0x04, 0x61, 0x99, 
+    0x90, 0xD6, 0xB2, 0x00, 0xC0, 0xE2, 0x01, 0x54, 0xF1, 0x16, 0x00, 0x90, 0xB1, 0x02, 0x66, 0x90, 
+    0xF1, 0x01, 0x08, 0x96, 0x19, 0x96, 0x69, 0x60, 0xB9, 0x12, 0x11, 0x91, 0x19, 0x11, 0x69, 0x91, 
+    0x99, 0x00, 0x22, 0x00, 0xF2, 0x06, 0x02, 0xC2, 0x00, 0xF1, 0x0C, 0x00, 0x90, 0xE1, 0x05, 0x69, 
+    0x61, 0x66, 0xF1, 0x02, 0xC6, 0x03, 0x19, 0x91, 0xA9, 0xA1, 0x02, 0x96, 0x10, 0xE9, 0x04, 0x64, 
+    0x55, 0x50, 0xF2, 0x08, 0x03, 0x54, 0x44, 0xF1, 0x07, 0xA9, 0xF1, 0x0F, 0x00, 0x90, 0xF6, 0x07, 
+    0x08, 0x99, 0x11, 0x96, 0x66, 0x90, 0xB6, 0x05, 0x04, 0x44, 0x20, 0xF2, 0x04, 0x01, 0xC2, 0xA5, 
+    0x08, 0x44, 0x40, 0x11, 0x01, 0x00, 0xF1, 0x06, 0x00, 0x00, 0xB1, 0x01, 0x66, 0xB1, 0x00, 0x60, 
+    0xD1, 0x03, 0x96, 0x99, 0xE6, 0x0E, 0x96, 0x69, 0x99, 0x19, 0x66, 0x69, 0x66, 0x10, 0xD6, 0x07, 
+    0x0C, 0x52, 0x02, 0x2C, 0xD2, 0x0A, 0x55, 0x44, 0x4C, 0x02, 0x54, 0x40, 0xA1, 0xA0, 0xF1, 0x08, 
+    0x05, 0x61, 0x96, 0x19, 0xF1, 0x00, 0x02, 0x96, 0x60, 0x42, 0x00, 0x90, 0xA6, 0xF1, 0x00, 0x04, 
+    0x91, 0x96, 0x90, 0xB6, 0x0B, 0x00, 0x24, 0x20, 0x22, 0x55, 0x5C, 0xF5, 0x04, 0x05, 0xCC, 0x40, 
+    0x00, 0xF1, 0x0C, 0x07, 0x41, 0x61, 0x11, 0x66, 0xF1, 0x01, 0x04, 0x96, 0x69, 0x60, 0xE1, 0x01, 
+    0x99, 0xD1, 0x0D, 0x91, 0x16, 0x66, 0x99, 0x45, 0xC2, 0x2C, 0xA5, 0x09, 0x47, 0x75, 0x57, 0x57, 
+    0x77, 0xD4, 0x0A, 0x10, 0x91, 0x11, 0x44, 0x11, 0x40, 0xF1, 0x0B, 0x04, 0x96, 0x11, 0x90, 0xE1, 
+    0x08, 0x66, 0x11, 0x61, 0x41, 0x60, 0x42, 0x00, 0x60, 0xC1, 0x11, 0x66, 0x61, 0x19, 0x69, 0x90, 
+    0x44, 0x45, 0x54, 0x44, 0xB1, 0xF4, 0x01, 0x05, 0x10, 0x16, 0x66, 0xA1, 0x00, 0x60, 0xF1, 0x06, 
+    0x00, 0x40, 0xF1, 0x06, 0x00, 0x40, 0xA1, 0x00, 0x40, 0xB1, 0x0A, 0x61, 0x11, 0x99, 0x46, 0x99, 
+    0x40, 0x43, 0xB1, 0x07, 0x06, 0x16, 0x61, 0x99, 0xD1, 0x01, 0x99, 0xA1, 0x02, 0x66, 0x10, 0xB4, 
+    0x00, 0x10, 0x49, 0x03, 0x01, 0x16, 0xD1, 0x01, 0x66, 0xA1, 0x06, 0x41, 0x99, 0x66, 0x90, 
+};
+
+const gfx_image_t STORY_CH2_ENEMY_IMG = {
+    .w = STORY_CH2_ENEMY_W, .h = STORY_CH2_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH2_ENEMY_PAL, .colors = STORY_CH2_ENEMY_PAL_SIZE,
+    .data = STORY_CH2_ENEMY_RLE, .size = STORY_CH2_ENEMY_RLE_SIZE,
 };
@@ -6,385 +6,206 @@ const uint16_t STORY_CH3_PAL[STORY_CH3_PAL_SIZE] = {
     0x9AEA, 0xE94A, 0xDAAA, 0xD344, 0x1D13, 0x2AE9, 0x58CB, 0x6D34, 
 };
 
-const uint8_t STORY_CH3_IDX[(STORY_CH3_W * STORY_CH3_H) / 2] = {
-    0x44, 0x00, 0x04, 0x44, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x00, 0x04, 0x44, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x40, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x44, 0x04, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x02, 0x20, 0x00, 0x42, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x12, 0x24, 0x24, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x12, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x22, 0x24, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x22, 0x22, 0x22, 0x22, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x11, 0x22, 0x23, 0x22, 0x20, 0x04, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x23, 0x22, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x22, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x11, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 
-    0x11, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x23, 0x32, 0x24, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x12, 0x22, 0x32, 0x24, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x20, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 
-    0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x21, 0x22, 0x24, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 
-    0x00, 0x11, 0x11, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x11, 0x11, 0x11, 0x00, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x01, 
-    0x11, 0x11, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x11, 0x12, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 
-    0x11, 0x01, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x11, 0x11, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x11, 0x10, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x22, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 
-    0x11, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x32, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x00, 0x00, 0x00, 0x01, 0x21, 0x11, 0x10, 0x10, 
-    0x01, 0x11, 0x11, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x01, 0x33, 
-    0x30, 0x00, 0x00, 0x00, 0x10, 0x01, 0x21, 0x11, 0x00, 0x00, 0x00, 0x01, 0x21, 0x11, 0x10, 0x00, 
-    0x00, 0x11, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x12, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x00, 
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0x10, 0x00, 0x40, 0x21, 0x11, 0x11, 0x10, 0x12, 0x33, 
-    0x30, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x01, 0x21, 0x11, 0x00, 0x00, 
-    0x00, 0x12, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x10, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x44, 0x40, 0x01, 0x11, 0x11, 0x10, 0x12, 0x33, 
-    0xB2, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x30, 0x11, 0x00, 0x00, 0x01, 0x21, 0x10, 0x00, 0x00, 
-    0x00, 0x01, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x82, 0x11, 0x11, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x00, 0x01, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x00, 0x00, 0x11, 0x11, 0x01, 0x33, 0x33, 
-    0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0x01, 0x32, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x40, 0x00, 0x11, 0x21, 0x02, 0x3B, 0x3B, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x82, 0x13, 0x33, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x88, 0x00, 0x20, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x14, 0x00, 0x11, 0x11, 0x13, 0x3B, 0x3B, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x13, 0x10, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42, 0x02, 0x33, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x10, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x32, 0x22, 0x00, 0x01, 0x10, 0x13, 0xBB, 0x3B, 
-    0x30, 0x00, 0x00, 0x00, 0x01, 0x11, 0x31, 0x13, 0x10, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x33, 0x32, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x00, 0x01, 0x10, 0x23, 0x33, 0x37, 
-    0x30, 0x44, 0x00, 0x00, 0x00, 0x03, 0x31, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x10, 0x03, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x33, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x31, 0x00, 0x00, 0x00, 0x27, 0x33, 0x33, 
-    0x32, 0x44, 0x00, 0x00, 0x00, 0x13, 0x31, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 
-    0x01, 0x20, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x33, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x00, 0x01, 0x11, 0x37, 0x33, 0x77, 
-    0x73, 0x04, 0x40, 0x00, 0x00, 0x33, 0x33, 0x03, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x33, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x00, 0x01, 0x10, 0x27, 0x33, 0x07, 
-    0x7B, 0x04, 0x40, 0x00, 0x02, 0x32, 0x33, 0x03, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x02, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x19, 0x59, 0x00, 0x41, 0x11, 0x37, 0xA9, 0xAA, 
-    0xB0, 0x20, 0x00, 0x00, 0x0A, 0xA5, 0x30, 0x00, 0x30, 0x00, 0x40, 0x11, 0x0E, 0x00, 0x40, 0x10, 
-    0x00, 0x99, 0x08, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0D, 0x00, 0x00, 0x01, 0x23, 0x01, 0x22, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x65, 0x55, 0xAC, 0x02, 0x00, 0x0E, 0x65, 0x55, 0xF0, 
-    0x00, 0x06, 0x55, 0x55, 0x55, 0x5A, 0xC0, 0x00, 0x06, 0x55, 0x5F, 0xD0, 0x11, 0x07, 0x69, 0x55, 
-    0xA0, 0x20, 0x00, 0x0E, 0x65, 0x55, 0xF0, 0x00, 0x30, 0x9A, 0xC0, 0x10, 0x00, 0x9A, 0xC1, 0x16, 
-    0x55, 0x55, 0x50, 0xD0, 0x00, 0x00, 0x09, 0x55, 0x5C, 0x00, 0x01, 0x01, 0x12, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x08, 0x0D, 0x0E, 0x09, 0x88, 0x88, 0x00, 
-    0x40, 0x0E, 0x08, 0xA5, 0xA8, 0x30, 0xD0, 0xE9, 0x98, 0x88, 0x80, 0x02, 0x02, 0xA9, 0x98, 0xAA, 
-    0x88, 0x8D, 0x00, 0x00, 0x88, 0x88, 0x08, 0x82, 0x00, 0x9B, 0x80, 0x20, 0x09, 0x5A, 0xC1, 0x16, 
-    0x5A, 0x88, 0x80, 0x83, 0x00, 0xE0, 0x98, 0x88, 0x80, 0x0D, 0x01, 0x01, 0x11, 0x11, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x65, 0xAC, 0x0E, 0x65, 0xF4, 0x0E, 0x65, 
-    0xF4, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x00, 0xE6, 0x5F, 0x22, 0x86, 0x5F, 0x03, 0x65, 0xA0, 0x70, 
-    0x65, 0xAC, 0x0E, 0x65, 0xF0, 0x38, 0x65, 0x0D, 0x10, 0x95, 0x5A, 0xC0, 0x95, 0x5A, 0xC1, 0x16, 
-    0x50, 0xD0, 0x06, 0x50, 0xD0, 0x09, 0xBC, 0x00, 0x09, 0x5C, 0x01, 0x02, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xAC, 0x00, 0xE3, 0x80, 0x0E, 0x95, 0xF0, 0x0E, 0x65, 
-    0xF4, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x00, 0xE6, 0x5F, 0x02, 0x06, 0x5F, 0x03, 0x65, 0xA0, 0x70, 
-    0xAB, 0x8C, 0x0E, 0x65, 0x00, 0x38, 0x65, 0x00, 0x00, 0x95, 0x88, 0x89, 0x88, 0x5A, 0xC1, 0x16, 
-    0x50, 0xD1, 0xE6, 0x50, 0xD0, 0x09, 0xBC, 0x00, 0x00, 0x80, 0x11, 0x01, 0x12, 0x22, 0x21, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x02, 0x33, 0x0E, 0x95, 0xA9, 0x99, 0x95, 
-    0xF4, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x00, 0xE6, 0x5A, 0x99, 0x99, 0x5F, 0x03, 0x65, 0xA0, 0x70, 
-    0x37, 0x20, 0x0E, 0x65, 0x00, 0x38, 0x65, 0x00, 0x36, 0x9A, 0xC0, 0x9B, 0xC0, 0x9B, 0xC1, 0x16, 
-    0x5A, 0x99, 0x98, 0x80, 0x40, 0x01, 0x08, 0x99, 0x0D, 0x00, 0x11, 0x02, 0x12, 0x22, 0x22, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x01, 0x33, 0x0E, 0x95, 0x55, 0x55, 0x55, 
-    0xF0, 0x00, 0x10, 0x65, 0xAC, 0x00, 0x00, 0xE6, 0x55, 0x55, 0x55, 0x5F, 0x03, 0x65, 0xAF, 0x33, 
-    0x33, 0x24, 0x0E, 0x65, 0x00, 0x38, 0x65, 0x00, 0x36, 0x9A, 0xC1, 0x08, 0xD0, 0x9B, 0xC1, 0x16, 
-    0x55, 0x55, 0x50, 0x03, 0x10, 0x00, 0x09, 0x55, 0xBC, 0x00, 0x12, 0x01, 0x12, 0x22, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xAC, 0x00, 0x01, 0x33, 0x0E, 0x65, 0x08, 0x28, 0x95, 
-    0xF4, 0x10, 0x31, 0x65, 0xAC, 0x00, 0x00, 0xE6, 0x58, 0x83, 0x89, 0x5F, 0x03, 0x65, 0xA0, 0x33, 
-    0x33, 0x24, 0x0E, 0x65, 0xF0, 0x38, 0x65, 0x0D, 0x16, 0x9A, 0xC0, 0x21, 0x00, 0x9B, 0xC1, 0x16, 
-    0x58, 0x03, 0x80, 0x98, 0x40, 0x00, 0xE1, 0x02, 0x80, 0x0D, 0x01, 0x01, 0x12, 0x22, 0x20, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x65, 0xAC, 0x00, 0x09, 0xA0, 0x0E, 0x65, 0xF2, 0x0E, 0x65, 
-    0xF4, 0x00, 0x10, 0x65, 0xAC, 0x10, 0x02, 0xE6, 0x5F, 0x22, 0x86, 0x5F, 0x03, 0x65, 0xA0, 0x33, 
-    0x69, 0xA0, 0x0E, 0x65, 0xF0, 0x38, 0x65, 0x0D, 0x16, 0x9A, 0xC0, 0x21, 0x00, 0x9B, 0xC1, 0x16, 
-    0x50, 0xD1, 0x06, 0x50, 0xD0, 0x09, 0x5D, 0x00, 0x09, 0x5C, 0x01, 0x01, 0x12, 0x22, 0x20, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x65, 0x8C, 0x00, 0x65, 0xAC, 0x00, 0x65, 0xF2, 0x0E, 0x65, 
-    0xF0, 0x12, 0x32, 0x65, 0xAC, 0x12, 0x12, 0xE6, 0x5F, 0x22, 0x86, 0x5F, 0x03, 0x65, 0xA0, 0x33, 
-    0x65, 0xAC, 0x0E, 0x65, 0xF0, 0x3A, 0x65, 0xFD, 0x16, 0x9A, 0xC0, 0x21, 0x00, 0x9B, 0xC1, 0x16, 
-    0x50, 0xD1, 0xE6, 0x50, 0xD0, 0x09, 0xBC, 0x00, 0x09, 0xBC, 0x01, 0x01, 0x22, 0x22, 0x10, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0A, 0x99, 0xA0, 0x80, 0x00, 0x65, 0xF2, 0x0E, 0x65, 
-    0xF4, 0x13, 0x22, 0x65, 0xAC, 0x02, 0x22, 0xE6, 0x5F, 0x22, 0x86, 0x5F, 0x03, 0x7B, 0x0A, 0x99, 
-    0x90, 0x0D, 0x00, 0x1E, 0x09, 0x95, 0x80, 0x03, 0x30, 0x9A, 0xC0, 0x21, 0x00, 0x9B, 0xC1, 0x16, 
-    0x5A, 0x99, 0x58, 0x00, 0x00, 0x00, 0x0A, 0x59, 0x90, 0x0D, 0x01, 0x01, 0x12, 0x21, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x65, 0x55, 0xAC, 0x33, 0x0E, 0x65, 0xF0, 0x0E, 0x65, 
-    0xF4, 0x11, 0x11, 0x65, 0xAC, 0x11, 0x00, 0xE6, 0x5F, 0x22, 0x86, 0x5F, 0x03, 0x77, 0x69, 0x55, 
-    0xA0, 0x20, 0x00, 0x0E, 0x65, 0x55, 0xF0, 0x33, 0x36, 0x9A, 0xC0, 0x11, 0x00, 0x9A, 0xC1, 0x16, 
-    0x55, 0x55, 0x50, 0x01, 0x00, 0x00, 0x09, 0x55, 0xBC, 0x00, 0x11, 0x02, 0x22, 0x11, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x33, 0x00, 0x18, 0x03, 0x00, 0x11, 
-    0xD0, 0x01, 0x11, 0x11, 0x0D, 0x00, 0x00, 0x01, 0x20, 0x23, 0x33, 0x20, 0x03, 0x77, 0x33, 0x83, 
-    0x0D, 0x04, 0x00, 0x00, 0x18, 0x28, 0x82, 0x33, 0x33, 0x00, 0xD0, 0x11, 0x00, 0x10, 0x01, 0x10, 
-    0x22, 0x22, 0x20, 0x21, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x01, 0x33, 0x00, 0x23, 0x33, 0x01, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x13, 0x33, 0x32, 0x01, 0xB3, 0x33, 0x23, 0x37, 
-    0x20, 0x44, 0x00, 0x00, 0x11, 0x01, 0x10, 0x01, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x01, 0x11, 0x22, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x00, 0x33, 0x00, 0x23, 0x22, 0x13, 0x10, 
-    0x10, 0x11, 0x11, 0x11, 0x31, 0x21, 0x00, 0x00, 0x11, 0x22, 0x32, 0x02, 0x33, 0x23, 0x33, 0x37, 
-    0x02, 0x44, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x12, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x40, 0x00, 0x00, 0x33, 0x00, 0x2B, 0x20, 0x11, 0x10, 
-    0x11, 0x11, 0x11, 0x21, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x01, 0x32, 0x11, 0x11, 0x11, 
-    0x32, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x22, 0x22, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x33, 0x00, 0x27, 0x20, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x32, 0x20, 0x22, 0x20, 0x00, 0x21, 0x00, 0x04, 0x01, 0x31, 0x00, 0x01, 0x11, 
-    0x22, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x10, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x11, 0x22, 0x22, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x33, 0x00, 0x2B, 0x32, 0x11, 0x00, 
-    0x02, 0x13, 0x11, 0x30, 0x21, 0x11, 0x10, 0x00, 0x11, 0x00, 0x40, 0x02, 0x22, 0x11, 0x13, 0x31, 
-    0x32, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x01, 0x22, 0x22, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x23, 0x00, 0x23, 0x33, 0x22, 0x21, 
-    0x13, 0x13, 0x21, 0x11, 0x13, 0x21, 0x00, 0x01, 0x32, 0x00, 0x44, 0x13, 0x33, 0x21, 0x23, 0x31, 
-    0x12, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x02, 0x31, 0x22, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x13, 0x32, 0x22, 0x01, 
-    0x10, 0x01, 0x23, 0x00, 0x12, 0x32, 0x00, 0x00, 0x11, 0x02, 0x40, 0x12, 0x31, 0x21, 0x23, 0x32, 
-    0x01, 0x40, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x12, 0x22, 0x22, 0x42, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x23, 0x00, 0x13, 0x31, 0x11, 0x12, 
-    0x12, 0x32, 0x22, 0x22, 0x33, 0x22, 0x11, 0x11, 0x11, 0x04, 0x42, 0x33, 0x77, 0x32, 0x33, 0x31, 
-    0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x12, 0x21, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x22, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x44, 0x02, 0x80, 0x00, 0x04, 0x44, 0x00, 0x00, 0x28, 0x00, 0x12, 0x03, 0x33, 0x33, 
-    0x33, 0x3B, 0x77, 0x77, 0x7B, 0x33, 0x33, 0x33, 0x73, 0x20, 0x00, 0x11, 0x11, 0x12, 0x23, 0x31, 
-    0x21, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x21, 
-    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x22, 0x22, 0x21, 0x11, 
-    0x00, 0x04, 0xD4, 0x02, 0x02, 0x00, 0x04, 0x44, 0x00, 0x01, 0x28, 0x00, 0x12, 0x33, 0x33, 0x33, 
-    0x33, 0x07, 0x77, 0x77, 0x77, 0xB3, 0x33, 0x30, 0x77, 0x20, 0x40, 0x13, 0x23, 0x37, 0x31, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x04, 0x44, 0x21, 0x11, 
-    0x00, 0x4D, 0xD4, 0x12, 0x88, 0x40, 0x44, 0x44, 0x00, 0x02, 0x23, 0x00, 0x03, 0x02, 0x22, 0x22, 
-    0x22, 0x23, 0x32, 0x22, 0x21, 0x11, 0x00, 0x11, 0x11, 0x00, 0x22, 0x33, 0x33, 0x00, 0x03, 0x33, 
-    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x11, 0x10, 0x00, 0x11, 0x21, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x33, 0x10, 0x00, 0x44, 0x44, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x4D, 0xD2, 0x22, 0x22, 0x00, 0x44, 0x44, 0x00, 0x22, 0x23, 0x40, 0x02, 0x31, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x12, 0x11, 0x00, 0x00, 0x11, 0x11, 0x31, 0x37, 0x73, 
-    0x31, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x21, 0x44, 0x44, 0x40, 0x17, 0x30, 0x00, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 
-    0x00, 0x44, 0x42, 0x22, 0x22, 0x00, 0x44, 0x40, 0x00, 0x02, 0x23, 0x00, 0x00, 0x23, 0x01, 0x21, 
-    0x12, 0x22, 0x22, 0x10, 0x00, 0x10, 0x00, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x37, 0x77, 
-    0x30, 0x00, 0x00, 0x00, 0x11, 0x00, 0x12, 0x21, 0x01, 0x31, 0x00, 0x00, 0x00, 0x11, 0x31, 0x10, 
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x01, 0x22, 0x21, 0x00, 0x02, 0x00, 
-    0x00, 0x44, 0x42, 0x21, 0x22, 0x00, 0x44, 0x40, 0x00, 0x00, 0x28, 0x00, 0x00, 0x23, 0x00, 0x00, 
-    0x11, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x11, 0x11, 0x30, 0x77, 0x77, 0xBB, 
-    0x30, 0x04, 0x40, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x01, 0x23, 0x10, 0x00, 0x00, 0x01, 0x12, 
-    0x12, 0x33, 0x21, 0x00, 0x00, 0x00, 0x40, 0x30, 0x10, 0x00, 0x00, 0x02, 0x20, 0x22, 0x22, 0x10, 
-    0x00, 0x04, 0x04, 0x21, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x13, 0x00, 0x00, 
-    0x01, 0x21, 0x11, 0x00, 0x01, 0x01, 0x12, 0x22, 0x33, 0x33, 0x33, 0x37, 0x77, 0x77, 0x7B, 0xBB, 
-    0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x01, 0x23, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x21, 0x22, 0x22, 0x10, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x40, 0x00, 0x23, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x01, 0x11, 0x23, 0x33, 0x3B, 0xB7, 0x7B, 0x33, 0x77, 0x7B, 0x3B, 0xB3, 
-    0x00, 0x04, 0x40, 0x00, 0x10, 0x00, 0x13, 0x73, 0x10, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x33, 0x00, 0x10, 0x00, 0x02, 0x02, 0x22, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x40, 0x00, 0x22, 0x00, 0x00, 
-    0x12, 0x22, 0x11, 0x11, 0x11, 0x22, 0x33, 0x3B, 0x77, 0x77, 0x3B, 0xB7, 0x70, 0x77, 0xBB, 0xB3, 
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x11, 0x23, 0xB3, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x00, 0x04, 0x01, 0x22, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x12, 
-    0x23, 0x33, 0x22, 0x22, 0x21, 0x23, 0x37, 0x77, 0x7B, 0x77, 0xBB, 0x77, 0x77, 0x7B, 0x33, 0x22, 
-    0x04, 0x44, 0x40, 0x00, 0x00, 0x13, 0x11, 0x00, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x01, 0x22, 0x33, 
-    0x33, 0x33, 0x22, 0x21, 0x22, 0x13, 0x33, 0x37, 0x73, 0x33, 0x33, 0x77, 0x77, 0x33, 0x33, 0x14, 
-    0x00, 0x4D, 0x40, 0x00, 0x00, 0x12, 0x11, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x32, 0x00, 0x00, 0x00, 0x20, 0x13, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x02, 0x21, 0x22, 0x22, 0x33, 0x33, 
-    0x33, 0x33, 0x22, 0x33, 0x12, 0x13, 0x73, 0x37, 0x77, 0xB3, 0x33, 0x77, 0x77, 0x33, 0x33, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x11, 0x21, 0x10, 0x00, 0x00, 0x00, 
-    0x02, 0x0A, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x23, 0x33, 
-    0x33, 0x33, 0x22, 0x23, 0x23, 0x31, 0x33, 0x37, 0x72, 0x00, 0x00, 0x00, 0x23, 0x11, 0x11, 0x00, 
-    0x0D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 
-    0x02, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x10, 0x00, 0x00, 0x00, 0x02, 0x22, 0x12, 0x33, 0x33, 
-    0x33, 0x22, 0x22, 0x22, 0x32, 0x31, 0x23, 0x33, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x32, 0x10, 0x00, 
-    0x44, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x10, 0x00, 
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x20, 0x22, 0x11, 0x33, 0x33, 
-    0x21, 0x01, 0x11, 0x11, 0x11, 0x22, 0x13, 0x33, 0x20, 0x00, 0x00, 0x01, 0x01, 0x21, 0x00, 0x00, 
-    0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x02, 0x00, 0x00, 0x00, 0x01, 0x12, 0x12, 0x33, 0x21, 
-    0x11, 0x22, 0x11, 0x22, 0x21, 0x12, 0x12, 0x30, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x33, 
-    0x32, 0x11, 0x33, 0x20, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x22, 0x00, 0x00, 0x00, 0x12, 0x21, 0x12, 0x22, 0x23, 
-    0x22, 0x21, 0x22, 0x22, 0x22, 0x13, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x13, 
-    0xB3, 0x33, 0x33, 0x22, 0x32, 0x22, 0x22, 0x20, 0x00, 0x40, 0x00, 0x00, 0x11, 0x21, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x22, 0x02, 0x11, 0x22, 0x32, 
-    0x22, 0x22, 0x22, 0x23, 0x22, 0x12, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x01, 
-    0x21, 0x22, 0x22, 0x11, 0x11, 0x21, 0x22, 0x33, 0x22, 0x20, 0x01, 0x10, 0x11, 0x01, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x12, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x23, 0x33, 0x21, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 
-    0x00, 0x01, 0x21, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x01, 0x12, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x33, 0x33, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x01, 
-    0x00, 0x00, 0x01, 0x11, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x11, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x01, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x22, 0x22, 0x22, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x12, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x11, 0x11, 
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x22, 0x22, 0x22, 0x22, 0x33, 0x22, 0x22, 0x12, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x12, 0x22, 0x22, 0x22, 
-    0x22, 0x11, 0x12, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x10, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x22, 0x22, 0x21, 0x12, 0x22, 0x22, 0x11, 0x22, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xD0, 0x22, 0x00, 0x00, 0x00, 0x21, 0x21, 0x12, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x12, 0x11, 0x12, 0x21, 0x21, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0D, 0x00, 0x83, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x21, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x02, 0x00, 0x00, 0x01, 0x11, 0x01, 0x22, 0x22, 
-    0x12, 0x22, 0x22, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x10, 0x00, 
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x22, 0x22, 0x21, 
-    0x00, 0x00, 0x44, 0x00, 0x00, 0x11, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x11, 0x21, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x12, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x22, 0x00, 0x00, 0x42, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t STORY_CH3_RLE[STORY_CH3_RLE_SIZE] = {
+    0x04, 0x44, 0x00, 0x00, 0xB4, 0x02, 0x00, 0x40, 0xF0, 0x38, 0x00, 0x10, 0xF0, 0x10, 0x01, 0x11, 
+    0xF0, 0x0D, 0x46, 0x02, 0x04, 0x40, 0xF0, 0x39, 0x00, 0x10, 0x58, 0xF0, 0x10, 0x02, 0x40, 0x00, 
+    0xA4, 0xF0, 0x4B, 0x05, 0x11, 0x00, 0x01, 0xF0, 0x6E, 0xA1, 0xE0, 0xA1, 0xF0, 0x6C, 0xE1, 0xF0, 
+    0x14, 0x0A, 0x40, 0x04, 0x00, 0x40, 0x00, 0x40, 0xF0, 0x48, 0xA1, 0xF0, 0x18, 0x03, 0x40, 0x44, 
+    0xF0, 0x48, 0xA1, 0xF0, 0x1E, 0x02, 0x44, 0x00, 0x42, 0x02, 0x44, 0x40, 0xF0, 0x42, 0xC1, 0xF0, 
+    0x1D, 0x01, 0x44, 0xF0, 0x42, 0x03, 0x10, 0x00, 0xD1, 0xF0, 0x1F, 0x00, 0x40, 0xF0, 0x3F, 0x03, 
+    0x11, 0x01, 0x42, 0x00, 0x00, 0xB1, 0xF0, 0x20, 0x7F, 0xF0, 0x06, 0xB1, 0xF0, 0x99, 0x02, 0x44, 
+    0x40, 0xF0, 0x00, 0x00, 0x40, 0xF0, 0x6A, 0x03, 0x42, 0x24, 0x7F, 0xF0, 0x0B, 0x01, 0x11, 0xF0, 
+    0x14, 0x04, 0x11, 0x02, 0x20, 0x44, 0x00, 0x20, 0x59, 0x01, 0x11, 0xF0, 0x2E, 0x01, 0x11, 0xF0, 
+    0x14, 0x08, 0x22, 0x11, 0x22, 0x42, 0x40, 0xA2, 0xF0, 0x04, 0x00, 0x40, 0xF0, 0x01, 0x00, 0x10, 
+    0x6F, 0x00, 0x10, 0xE0, 0x01, 0x11, 0xF0, 0x14, 0x00, 0x10, 0xA2, 0x01, 0x11, 0xD2, 0xF0, 0x0F, 
+    0x70, 0xB0, 0x04, 0x11, 0x13, 0x10, 0xF0, 0x04, 0x02, 0x11, 0x10, 0x52, 0x02, 0x22, 0x20, 0xB4, 
+    0xF0, 0x0E, 0x04, 0x11, 0x10, 0x10, 0xF0, 0x3A, 0xB1, 0xF0, 0x04, 0x00, 0x10, 0x43, 0xB2, 0x59, 
+    0x02, 0x21, 0x10, 0xF0, 0x3C, 0xA1, 0xF0, 0x05, 0x0D, 0x11, 0x01, 0x12, 0x22, 0x32, 0x22, 0x00, 
+    0x55, 0xA1, 0xF0, 0x2A, 0x03, 0x10, 0x01, 0xF0, 0x0A, 0x02, 0x11, 0x10, 0xF0, 0x04, 0x49, 0xF0, 
+    0x0E, 0x6D, 0x00, 0x10, 0xA0, 0x00, 0x10, 0xA0, 0x03, 0x11, 0x01, 0xF0, 0x07, 0x02, 0x11, 0x10, 
+    0xF0, 0x07, 0x01, 0x11, 0xB2, 0x78, 0x01, 0x11, 0xF0, 0x07, 0x06, 0x10, 0x01, 0x01, 0x10, 0xD0, 
+    0x01, 0x11, 0xB0, 0xA1, 0x42, 0x00, 0x10, 0xF0, 0x04, 0x09, 0x11, 0x12, 0x23, 0x32, 0x24, 0xF0, 
+    0x10, 0x00, 0x10, 0xF0, 0x16, 0x00, 0x10, 0xF0, 0x0C, 0x01, 0x11, 0xF0, 0x05, 0xF1, 0x00, 0xF0, 
+    0x04, 0x01, 0x12, 0x42, 0x00, 0x20, 0x42, 0x00, 0x40, 0xF0, 0x0D, 0x03, 0x10, 0x01, 0xF0, 0x14, 
+    0x00, 0x10, 0xB0, 0x00, 0x10, 0x5E, 0x00, 0x00, 0xA1, 0xB0, 0x00, 0x10, 0x4B, 0xE2, 0x02, 0x04, 
+    0x40, 0x56, 0xF0, 0x14, 0x08, 0x11, 0x10, 0x00, 0x11, 0x10, 0xF0, 0x05, 0x01, 0x11, 0xF0, 0x05, 
+    0x08, 0x11, 0x01, 0x00, 0x01, 0x10, 0x52, 0x04, 0x12, 0x22, 0x40, 0x55, 0x02, 0x00, 0x10, 0xF0, 
+    0x00, 0x00, 0x10, 0x5A, 0x00, 0x10, 0x4F, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x10, 0x42, 0x02, 0x00, 
+    0x00, 0xA1, 0x02, 0x02, 0x10, 0xF0, 0x02, 0x01, 0x12, 0xC1, 0x02, 0x00, 0x40, 0xF0, 0x18, 0x00, 
+    0x10, 0xF0, 0x11, 0x51, 0x00, 0x10, 0xF0, 0x01, 0xB1, 0x00, 0x00, 0xB1, 0x03, 0x21, 0x01, 0xF0, 
+    0x03, 0x43, 0x00, 0x20, 0x42, 0xF0, 0x18, 0x00, 0x10, 0xF0, 0x0A, 0xA1, 0x04, 0x00, 0x01, 0x10, 
+    0xF0, 0x06, 0xC1, 0xD0, 0xB1, 0x09, 0x00, 0x01, 0x10, 0x11, 0x01, 0x4D, 0x00, 0x20, 0xB1, 0xA2, 
+    0xF0, 0x0D, 0x01, 0x12, 0xC0, 0x04, 0x11, 0x00, 0x10, 0x52, 0x00, 0x10, 0x42, 0x03, 0x10, 0x12, 
+    0x4A, 0x03, 0x01, 0x22, 0x45, 0xC1, 0x44, 0x03, 0x00, 0x12, 0x4B, 0x08, 0x00, 0x21, 0x12, 0x32, 
+    0x10, 0xF0, 0x11, 0x00, 0x10, 0xB0, 0xA1, 0xF0, 0x08, 0x01, 0x44, 0xF1, 0x01, 0x02, 0x23, 0x10, 
+    0x49, 0x03, 0x11, 0x22, 0xD0, 0x01, 0x12, 0x43, 0x02, 0x10, 0x00, 0xB1, 0x00, 0x30, 0x4B, 0x05, 
+    0x10, 0x01, 0x11, 0xF0, 0x13, 0x00, 0x10, 0x43, 0x02, 0x11, 0x10, 0xF0, 0x02, 0x03, 0x12, 0x22, 
+    0xC0, 0xE1, 0x04, 0x01, 0x33, 0x30, 0xD0, 0x07, 0x10, 0x01, 0x21, 0x11, 0x4C, 0xA0, 0xA1, 0x00, 
+    0x20, 0x4A, 0x04, 0x20, 0x00, 0x20, 0xA0, 0x01, 0x12, 0x57, 0x00, 0x20, 0x44, 0xB0, 0x00, 0x10, 
+    0xE0, 0x08, 0x22, 0x10, 0x00, 0x40, 0x20, 0xC1, 0x02, 0x01, 0x20, 0x48, 0x00, 0x00, 0xC1, 0x02, 
+    0x01, 0x10, 0x48, 0xC0, 0x01, 0x12, 0x4D, 0xB0, 0x04, 0x22, 0x01, 0x20, 0x56, 0x01, 0x12, 0x42, 
+    0x05, 0x11, 0x00, 0x01, 0xF0, 0x03, 0x07, 0x21, 0x14, 0x44, 0x00, 0x49, 0x01, 0xB2, 0xE0, 0x04, 
+    0x12, 0x13, 0x30, 0x4A, 0xE0, 0x03, 0x11, 0x21, 0xF0, 0x02, 0x00, 0x20, 0xB0, 0x01, 0x82, 0xB1, 
+    0x00, 0x20, 0x5A, 0xA0, 0x4B, 0x04, 0x01, 0x11, 0x20, 0xA0, 0xA1, 0x01, 0x01, 0xB3, 0x47, 0x06, 
+    0x01, 0x12, 0x11, 0x10, 0xC0, 0x02, 0x11, 0x10, 0xF0, 0x01, 0x01, 0x21, 0xF0, 0x03, 0x44, 0x06, 
+    0x03, 0x01, 0x32, 0x20, 0x4A, 0x00, 0x40, 0x48, 0x00, 0x30, 0x42, 0x03, 0x00, 0x01, 0xF0, 0x06, 
+    0x04, 0x12, 0x21, 0x40, 0x43, 0x08, 0x21, 0x02, 0x3B, 0x3B, 0x20, 0xF0, 0x02, 0x02, 0x11, 0x00, 
+    0x45, 0x02, 0x12, 0x10, 0xF0, 0x02, 0x00, 0x10, 0x51, 0x05, 0x82, 0x13, 0x33, 0x4B, 0x01, 0x04, 
+    0xE0, 0x08, 0x28, 0x80, 0x02, 0x00, 0x10, 0xF0, 0x08, 0x04, 0x23, 0x11, 0x40, 0x42, 0x03, 0x11, 
+    0x13, 0x42, 0x00, 0x30, 0xF0, 0x01, 0x04, 0x13, 0x11, 0x30, 0x51, 0x03, 0x13, 0x32, 0xF0, 0x07, 
+    0x04, 0x44, 0x20, 0x20, 0x57, 0x05, 0x30, 0x02, 0x01, 0x52, 0x0D, 0x33, 0x22, 0x20, 0x00, 0x11, 
+    0x01, 0x3B, 0x4A, 0x01, 0x11, 0x49, 0x01, 0x22, 0xF0, 0x02, 0x03, 0x80, 0x21, 0xF0, 0x09, 0x05, 
+    0x21, 0x23, 0x33, 0x4C, 0x00, 0x40, 0x48, 0x01, 0x01, 0xF0, 0x0C, 0x00, 0x10, 0xA2, 0x44, 0x00, 
+    0x20, 0xA3, 0x04, 0x73, 0x04, 0x40, 0xD0, 0x04, 0x33, 0x11, 0x20, 0xC0, 0x01, 0x11, 0xF0, 0x00, 
+    0x06, 0x11, 0x00, 0x31, 0x10, 0xF0, 0x07, 0x02, 0x12, 0x10, 0xB3, 0xF0, 0x0C, 0x42, 0x01, 0x01, 
+    0x55, 0x01, 0x31, 0xC0, 0x01, 0x27, 0xB3, 0x00, 0x20, 0x46, 0x00, 0x10, 0x42, 0x00, 0x10, 0x4C, 
+    0x08, 0x11, 0x01, 0x20, 0x00, 0x80, 0x50, 0x00, 0x30, 0x51, 0x00, 0x40, 0xD0, 0x00, 0x80, 0x57, 
+    0x02, 0x01, 0x10, 0x43, 0x0D, 0x11, 0x13, 0x73, 0x37, 0x77, 0x30, 0x44, 0xB0, 0xA3, 0x03, 0x03, 
+    0x11, 0x49, 0x02, 0x11, 0x10, 0xD0, 0x00, 0x30, 0x54, 0x01, 0x22, 0x53, 0x02, 0x22, 0x10, 0xF0, 
+    0x0F, 0x03, 0x10, 0x22, 0x43, 0x08, 0x02, 0x73, 0x30, 0x77, 0xB0, 0x45, 0x02, 0x23, 0x20, 0x43, 
+    0xB0, 0x45, 0xF0, 0x00, 0x01, 0xB1, 0x50, 0x00, 0x00, 0xB2, 0x50, 0x01, 0x14, 0xB0, 0x00, 0x10, 
+    0xA0, 0x00, 0x40, 0xF0, 0x04, 0x00, 0x40, 0x42, 0x11, 0x95, 0x90, 0x04, 0x11, 0x13, 0x7A, 0x9A, 
+    0xAB, 0x02, 0xC0, 0x0B, 0xAA, 0x53, 0x00, 0x03, 0x00, 0x04, 0x42, 0x0C, 0xE0, 0x04, 0x01, 0x00, 
+    0x09, 0x90, 0x80, 0xC0, 0x00, 0xE0, 0xA0, 0x00, 0xD0, 0xB0, 0x07, 0x12, 0x30, 0x12, 0x22, 0xF0, 
+    0x04, 0x12, 0x4D, 0x65, 0x55, 0xAC, 0x02, 0x00, 0x0E, 0x65, 0x55, 0xF0, 0xA0, 0x00, 0x60, 0xD5, 
+    0x01, 0xAC, 0xA0, 0x0F, 0x65, 0x55, 0xFD, 0x01, 0x10, 0x76, 0x95, 0x5A, 0x44, 0x05, 0xE6, 0x55, 
+    0x5F, 0x43, 0x0D, 0x9A, 0xC0, 0x10, 0x00, 0x9A, 0xC1, 0x16, 0xB5, 0x01, 0x0D, 0xC0, 0x0C, 0x95, 
+    0x55, 0xC0, 0x00, 0x10, 0x11, 0x20, 0xF0, 0x0B, 0x0B, 0x98, 0x88, 0x08, 0x0D, 0x0E, 0x09, 0xA8, 
+    0x12, 0x00, 0x40, 0x0E, 0x08, 0xA5, 0xA8, 0x30, 0xD0, 0xE9, 0x90, 0xA8, 0x0E, 0x00, 0x20, 0x2A, 
+    0x99, 0x8A, 0xA8, 0x88, 0xD0, 0xA0, 0xA8, 0x0E, 0x08, 0x82, 0x00, 0x9B, 0x80, 0x20, 0x09, 0x50, 
+    0x44, 0x0B, 0xA8, 0x88, 0x08, 0x30, 0x0E, 0x09, 0xA8, 0x02, 0x00, 0xD0, 0x43, 0x02, 0x11, 0x10, 
+    0xA2, 0xF0, 0x03, 0x15, 0x65, 0xAC, 0x00, 0x65, 0xAC, 0x0E, 0x65, 0xF4, 0x0E, 0x65, 0xF4, 0xA0, 
+    0x03, 0x65, 0xAC, 0xA0, 0x2B, 0xE6, 0x5F, 0x22, 0x86, 0x5F, 0x03, 0x65, 0xA0, 0x70, 0x65, 0xAC, 
+    0x0E, 0x65, 0xF0, 0x38, 0x65, 0x0D, 0x10, 0x95, 0x5A, 0xC0, 0x95, 0x45, 0x15, 0x0D, 0x00, 0x65, 
+    0x0D, 0x00, 0x9B, 0xC0, 0x00, 0x95, 0xC0, 0x10, 0xF2, 0x00, 0x50, 0x09, 0xE3, 0x80, 0x0E, 0x95, 
+    0xF0, 0x54, 0x02, 0x02, 0x00, 0x49, 0x02, 0xAB, 0x80, 0x43, 0x00, 0x00, 0x44, 0x0A, 0x00, 0x09, 
+    0x58, 0x88, 0x98, 0x80, 0x47, 0x01, 0x1E, 0x4A, 0x07, 0x08, 0x01, 0x10, 0x11, 0xA2, 0x01, 0x11, 
+    0x51, 0x03, 0x02, 0x33, 0x42, 0x00, 0xA0, 0xA9, 0x50, 0x00, 0xA0, 0xA9, 0x48, 0x03, 0x37, 0x20, 
+    0x4A, 0x0B, 0x36, 0x9A, 0xC0, 0x9B, 0xC0, 0x9B, 0x43, 0x11, 0xA9, 0x99, 0x88, 0x04, 0x00, 0x10, 
+    0x89, 0x90, 0xD0, 0x42, 0x00, 0x20, 0x43, 0x01, 0x21, 0xF0, 0x04, 0x45, 0x00, 0x10, 0x44, 0xC5, 
+    0x04, 0xF0, 0x00, 0x10, 0x4A, 0xC5, 0x44, 0x00, 0xF0, 0xA3, 0x01, 0x24, 0x4F, 0x03, 0x10, 0x8D, 
+    0x46, 0xA5, 0x03, 0x00, 0x31, 0xA0, 0x0A, 0x95, 0x5B, 0xC0, 0x01, 0x20, 0x10, 0x44, 0xF0, 0x05, 
+    0x4A, 0x0D, 0x65, 0x08, 0x28, 0x95, 0xF4, 0x10, 0x31, 0x49, 0x04, 0x88, 0x38, 0x90, 0x45, 0x00, 
+    0x00, 0x48, 0x00, 0xF0, 0x44, 0x01, 0xD1, 0x42, 0x03, 0x02, 0x10, 0x46, 0x14, 0x80, 0x38, 0x09, 
+    0x84, 0x00, 0x0E, 0x10, 0x28, 0x00, 0xD0, 0x10, 0x45, 0x02, 0x02, 0x20, 0xF0, 0x00, 0x01, 0x44, 
+    0x46, 0x02, 0x9A, 0x00, 0x42, 0x0B, 0xF2, 0x0E, 0x65, 0xF4, 0x00, 0x10, 0x42, 0x0B, 0x10, 0x02, 
+    0xE6, 0x5F, 0x22, 0x86, 0x48, 0x03, 0x69, 0xA0, 0x5B, 0x12, 0x0D, 0x10, 0x65, 0x0D, 0x00, 0x95, 
+    0xD0, 0x00, 0x95, 0xC0, 0x54, 0x0D, 0x00, 0x65, 0x8C, 0x00, 0x65, 0xAC, 0x00, 0x47, 0x04, 0x01, 
+    0x23, 0x20, 0x43, 0x01, 0x21, 0x52, 0x02, 0x5A, 0xC0, 0x45, 0x03, 0xA6, 0x5F, 0x53, 0x00, 0xE0, 
+    0x45, 0x01, 0xBC, 0x42, 0x00, 0xB0, 0x43, 0xA2, 0x00, 0x10, 0x4A, 0x0C, 0x00, 0x01, 0x00, 0xA9, 
+    0x9A, 0x08, 0x00, 0x49, 0x03, 0x41, 0x32, 0x43, 0x02, 0x02, 0x20, 0x4B, 0x17, 0x7B, 0x0A, 0x99, 
+    0x90, 0x0D, 0x00, 0x1E, 0x09, 0x95, 0x80, 0x03, 0x30, 0x4D, 0x04, 0xA9, 0x95, 0x80, 0xD0, 0x06, 
+    0xA5, 0x99, 0x00, 0xD0, 0x42, 0x05, 0x12, 0x21, 0x02, 0x4C, 0x0F, 0x0D, 0x65, 0x55, 0xAC, 0x33, 
+    0x0E, 0x65, 0xF0, 0x45, 0x02, 0x11, 0x10, 0x42, 0x03, 0x11, 0x00, 0x4B, 0x07, 0x76, 0x95, 0x5A, 
+    0x02, 0xA0, 0x0A, 0xE6, 0x55, 0x5F, 0x03, 0x33, 0x60, 0x42, 0x00, 0x10, 0x42, 0x00, 0xA0, 0x43, 
+    0xA5, 0x02, 0x00, 0x10, 0xB0, 0x0D, 0x95, 0x5B, 0xC0, 0x01, 0x10, 0x22, 0x21, 0x51, 0xB0, 0x0F, 
+    0xD3, 0x30, 0x01, 0x80, 0x30, 0x01, 0x1D, 0x00, 0xB1, 0x01, 0x0D, 0xB0, 0x08, 0x12, 0x02, 0x33, 
+    0x32, 0x00, 0x42, 0x07, 0x33, 0x83, 0x0D, 0x04, 0xA0, 0x05, 0x18, 0x28, 0x82, 0xA3, 0x02, 0x00, 
+    0xD0, 0x43, 0x05, 0x10, 0x01, 0x10, 0xB2, 0x01, 0x02, 0x44, 0x04, 0x10, 0x00, 0xD0, 0xF0, 0x12, 
+    0x01, 0xD4, 0xA0, 0x00, 0x10, 0x42, 0x05, 0x23, 0x33, 0x01, 0xB0, 0xB1, 0x00, 0x30, 0xD0, 0x00, 
+    0x10, 0xA3, 0x0D, 0x20, 0x1B, 0x33, 0x32, 0x33, 0x72, 0x04, 0x44, 0x08, 0x10, 0x11, 0x00, 0x11, 
+    0x10, 0xA0, 0x42, 0x01, 0x00, 0xD1, 0x03, 0x00, 0x01, 0x44, 0xE0, 0x0A, 0x22, 0x00, 0x11, 0x12, 
+    0x22, 0x10, 0x51, 0x00, 0x00, 0x44, 0x07, 0x22, 0x13, 0x10, 0x10, 0xC1, 0x03, 0x31, 0x21, 0x43, 
+    0x09, 0x12, 0x23, 0x20, 0x23, 0x32, 0xA3, 0x02, 0x70, 0x20, 0x45, 0x00, 0x20, 0xC0, 0x00, 0x10, 
+    0xB0, 0x4B, 0x00, 0x10, 0x4F, 0x03, 0x12, 0x11, 0xD2, 0x57, 0x06, 0xB2, 0x01, 0x11, 0x00, 0xC1, 
+    0x02, 0x21, 0x20, 0xD0, 0x00, 0x10, 0xA0, 0x04, 0x40, 0x13, 0x20, 0xC1, 0x01, 0x32, 0xC0, 0x45, 
+    0x02, 0x11, 0x10, 0x48, 0x00, 0x00, 0x56, 0x00, 0x20, 0xA1, 0xB2, 0x00, 0x40, 0xF0, 0x04, 0x00, 
+    0x40, 0x49, 0x01, 0x72, 0xD0, 0xA1, 0x0B, 0x32, 0x20, 0x22, 0x20, 0x00, 0x21, 0x45, 0x0A, 0x10, 
+    0x00, 0x11, 0x12, 0x20, 0x40, 0x48, 0x02, 0x11, 0x10, 0xB0, 0x4B, 0x03, 0x01, 0x00, 0x4D, 0x01, 
+    0x22, 0x54, 0xC0, 0x43, 0x0F, 0xB3, 0x21, 0x10, 0x00, 0x21, 0x31, 0x13, 0x02, 0xA1, 0x13, 0x00, 
+    0x01, 0x10, 0x04, 0x00, 0x22, 0x21, 0x11, 0x33, 0x13, 0x46, 0x00, 0x10, 0x51, 0x04, 0x00, 0x01, 
+    0x10, 0xB0, 0x4E, 0x01, 0x10, 0x43, 0x00, 0x40, 0xF0, 0x05, 0x01, 0x44, 0xB0, 0x00, 0x20, 0x42, 
+    0x0B, 0x33, 0x32, 0x22, 0x11, 0x31, 0x32, 0xA1, 0x17, 0x32, 0x10, 0x00, 0x13, 0x20, 0x04, 0x41, 
+    0x33, 0x32, 0x12, 0x33, 0x11, 0x4D, 0x06, 0x00, 0x01, 0x00, 0x00, 0x46, 0x00, 0x10, 0xF0, 0x07, 
+    0x00, 0x20, 0xA0, 0x06, 0x10, 0x00, 0x23, 0x10, 0x50, 0xC0, 0x17, 0x28, 0x00, 0x13, 0x32, 0x22, 
+    0x01, 0x10, 0x01, 0x23, 0x00, 0x12, 0x32, 0xA0, 0x09, 0x11, 0x02, 0x40, 0x12, 0x31, 0x43, 0x03, 
+    0x20, 0x14, 0xB0, 0x44, 0xA0, 0x00, 0x10, 0xA0, 0x5C, 0x01, 0x21, 0xB2, 0x03, 0x42, 0x24, 0x4D, 
+    0x00, 0x40, 0x43, 0x00, 0x30, 0x43, 0xA1, 0x03, 0x21, 0x23, 0xB2, 0x03, 0x33, 0x22, 0xC1, 0x0E, 
+    0x04, 0x42, 0x33, 0x77, 0x32, 0x33, 0x31, 0x10, 0xD0, 0x45, 0x01, 0x11, 0xB0, 0x05, 0x12, 0x21, 
+    0x11, 0xF0, 0x00, 0x00, 0x10, 0xF0, 0x06, 0x01, 0x20, 0xF2, 0x00, 0xA0, 0x04, 0x44, 0x02, 0x80, 
+    0x43, 0x00, 0x40, 0x44, 0x05, 0x80, 0x01, 0x20, 0xE3, 0x00, 0xB0, 0xB7, 0x00, 0xB0, 0xC3, 0x05, 
+    0x73, 0x20, 0x00, 0xB1, 0x06, 0x22, 0x33, 0x12, 0x10, 0x49, 0x02, 0x12, 0x20, 0x44, 0xA0, 0x05, 
+    0x11, 0x23, 0x21, 0x44, 0x01, 0x11, 0xE0, 0x00, 0x10, 0xC0, 0x00, 0x40, 0xB2, 0x0C, 0x11, 0x10, 
+    0x00, 0x4D, 0x40, 0x20, 0x20, 0x47, 0x00, 0x10, 0x44, 0xE3, 0x00, 0x00, 0xD7, 0x00, 0xB0, 0xA3, 
+    0x0D, 0x07, 0x72, 0x04, 0x01, 0x32, 0x33, 0x73, 0xB1, 0xC0, 0x00, 0x20, 0x43, 0x01, 0x11, 0xA0, 
+    0x01, 0x11, 0xE0, 0x04, 0x11, 0x33, 0x10, 0xF0, 0x03, 0x01, 0x33, 0xE0, 0x02, 0x44, 0x40, 0x44, 
+    0x09, 0x4D, 0xD4, 0x12, 0x88, 0x40, 0xA4, 0x0A, 0x00, 0x02, 0x23, 0x00, 0x03, 0x00, 0xE2, 0x01, 
+    0x33, 0xA2, 0x04, 0x11, 0x10, 0x00, 0xA1, 0x03, 0x00, 0x22, 0xA3, 0x06, 0x00, 0x03, 0x33, 0x00, 
+    0x45, 0x00, 0x10, 0xA0, 0xA1, 0x43, 0x02, 0x21, 0x10, 0xF0, 0x00, 0x07, 0x12, 0x33, 0x10, 0x00, 
+    0xA4, 0x49, 0xF0, 0x00, 0x02, 0x4D, 0xD0, 0xB2, 0x00, 0x00, 0x45, 0x09, 0x22, 0x23, 0x40, 0x02, 
+    0x31, 0xC0, 0xB1, 0xB0, 0x03, 0x11, 0x12, 0x42, 0x01, 0x00, 0xA1, 0x06, 0x31, 0x37, 0x73, 0x30, 
+    0x46, 0x02, 0x10, 0x00, 0xB1, 0xD0, 0x02, 0x12, 0x10, 0xF0, 0x00, 0x03, 0x12, 0x21, 0xB4, 0x02, 
+    0x01, 0x70, 0x43, 0x04, 0x12, 0x22, 0x10, 0x47, 0x01, 0x44, 0x48, 0xA0, 0x02, 0x22, 0x30, 0xA0, 
+    0x06, 0x23, 0x01, 0x21, 0x10, 0xB2, 0x42, 0x03, 0x10, 0x00, 0xB1, 0x01, 0x00, 0xD1, 0x04, 0x37, 
+    0x77, 0x30, 0xD0, 0x43, 0x06, 0x22, 0x10, 0x13, 0x10, 0xC0, 0x08, 0x11, 0x31, 0x10, 0x00, 0x10, 
+    0xF0, 0x02, 0x02, 0x20, 0x20, 0x4A, 0x00, 0x20, 0x47, 0x00, 0x10, 0x49, 0x02, 0x02, 0x80, 0x45, 
+    0x08, 0x00, 0x01, 0x12, 0x21, 0x10, 0x42, 0xA0, 0xA1, 0x01, 0x22, 0xA1, 0x01, 0x30, 0xA7, 0x06, 
+    0xBB, 0x30, 0x04, 0x40, 0xD0, 0x02, 0x12, 0x10, 0xA0, 0x03, 0x12, 0x31, 0xC0, 0x08, 0x11, 0x21, 
+    0x23, 0x32, 0x10, 0xC0, 0x04, 0x40, 0x30, 0x10, 0xC0, 0x02, 0x22, 0x00, 0xA2, 0x00, 0x10, 0xA0, 
+    0x05, 0x40, 0x42, 0x11, 0xA0, 0x00, 0x40, 0xC0, 0x01, 0x22, 0xA0, 0x00, 0x10, 0x43, 0x0F, 0x01, 
+    0x21, 0x11, 0x00, 0x01, 0x01, 0x12, 0x22, 0xD3, 0xC7, 0x05, 0xBB, 0xB1, 0x04, 0xF0, 0x00, 0xA2, 
+    0xB0, 0x03, 0x12, 0x31, 0xF0, 0x01, 0x02, 0x12, 0x10, 0xA2, 0x05, 0x10, 0x00, 0x33, 0xD0, 0xD2, 
+    0x43, 0xF0, 0x01, 0x45, 0x06, 0x12, 0x40, 0x00, 0x20, 0x45, 0xC1, 0x04, 0x01, 0x11, 0x20, 0xA3, 
+    0x1F, 0xBB, 0x77, 0xB3, 0x37, 0x77, 0xB3, 0xBB, 0x30, 0x00, 0x44, 0x00, 0x01, 0x00, 0x01, 0x37, 
+    0x31, 0xD0, 0x02, 0x12, 0x10, 0xF0, 0x03, 0x00, 0x10, 0xB0, 0x00, 0x10, 0x42, 0x00, 0x10, 0x43, 
+    0x00, 0x00, 0xB2, 0xF0, 0x06, 0x4C, 0x00, 0x20, 0xA0, 0x03, 0x12, 0x22, 0xC1, 0x05, 0x22, 0x33, 
+    0x3B, 0xA7, 0x08, 0x3B, 0xB7, 0x70, 0x77, 0xB0, 0x45, 0xC0, 0x08, 0x12, 0x11, 0x23, 0xB3, 0x10, 
+    0xD0, 0xA1, 0xF0, 0x06, 0x02, 0x12, 0x20, 0xD0, 0x05, 0x40, 0x12, 0x22, 0xF0, 0x06, 0x00, 0x20, 
+    0xD0, 0x01, 0x11, 0xD0, 0x06, 0x11, 0x22, 0x33, 0x30, 0xB2, 0x03, 0x12, 0x33, 0xA7, 0x04, 0xB7, 
+    0x7B, 0xB0, 0xB7, 0x05, 0xB3, 0x32, 0x20, 0xA4, 0x44, 0x08, 0x31, 0x10, 0x01, 0x22, 0x10, 0xF0, 
+    0x00, 0x01, 0x11, 0x4E, 0x00, 0x10, 0xF0, 0x01, 0x04, 0x22, 0x01, 0x10, 0xF0, 0x03, 0x02, 0x11, 
+    0x40, 0xE0, 0x07, 0x20, 0x01, 0x01, 0x22, 0xC3, 0x06, 0x22, 0x21, 0x22, 0x10, 0xA3, 0x01, 0x77, 
+    0xB3, 0xA7, 0xA3, 0x05, 0x14, 0x00, 0x4D, 0x45, 0x00, 0x20, 0x42, 0x02, 0x00, 0x00, 0xA1, 0xF0, 
+    0x02, 0x01, 0x23, 0xF0, 0x01, 0x05, 0x10, 0x01, 0x32, 0x45, 0x04, 0x01, 0x33, 0x10, 0xF0, 0x01, 
+    0xA1, 0xD0, 0x02, 0x22, 0x10, 0xA2, 0xE3, 0x08, 0x22, 0x33, 0x12, 0x13, 0x70, 0x42, 0x01, 0x7B, 
+    0x4A, 0xF0, 0x03, 0x01, 0x12, 0x44, 0x05, 0x01, 0x12, 0x11, 0xE0, 0x03, 0x20, 0xA1, 0xF0, 0x03, 
+    0x02, 0x13, 0x30, 0xE0, 0x4B, 0xB1, 0x00, 0x20, 0xE0, 0xC2, 0x47, 0x06, 0x23, 0x23, 0x31, 0x30, 
+    0x42, 0x00, 0x20, 0xC0, 0x01, 0x23, 0xA1, 0x04, 0x00, 0x0D, 0x40, 0xF0, 0x00, 0x01, 0x22, 0xF0, 
+    0x00, 0xA1, 0x45, 0x01, 0x20, 0x47, 0x05, 0x11, 0x01, 0x11, 0xF0, 0x00, 0x02, 0x11, 0x10, 0xF0, 
+    0x02, 0x04, 0x11, 0x12, 0x10, 0x49, 0x01, 0x12, 0xC3, 0xC2, 0x08, 0x32, 0x31, 0x23, 0x33, 0xB0, 
+    0xE0, 0x09, 0x13, 0x21, 0x00, 0x04, 0x4D, 0xF0, 0x01, 0x48, 0x05, 0x00, 0x13, 0x21, 0xA0, 0x01, 
+    0x11, 0xE0, 0x02, 0x10, 0x00, 0xB1, 0x48, 0xF0, 0x03, 0xC1, 0xD0, 0x05, 0x20, 0x22, 0x11, 0xA3, 
+    0x02, 0x21, 0x00, 0xD1, 0x06, 0x22, 0x13, 0x33, 0x20, 0xC0, 0x04, 0x10, 0x12, 0x10, 0xB0, 0x01, 
+    0x44, 0xF0, 0x00, 0xB1, 0xF0, 0x00, 0x02, 0x13, 0x30, 0xB1, 0xF0, 0x02, 0x00, 0x10, 0xA2, 0x48, 
+    0xF0, 0x03, 0xC1, 0x01, 0x02, 0xD0, 0x17, 0x11, 0x21, 0x23, 0x32, 0x11, 0x12, 0x21, 0x12, 0x22, 
+    0x11, 0x21, 0x23, 0xF0, 0x00, 0x01, 0x11, 0xF0, 0x0A, 0xB1, 0x02, 0x00, 0x10, 0xD0, 0x00, 0x10, 
+    0xA3, 0x0A, 0x21, 0x13, 0x32, 0x00, 0x12, 0x10, 0xF0, 0x04, 0x00, 0x20, 0xF0, 0x04, 0xC1, 0x01, 
+    0x02, 0x45, 0x04, 0x12, 0x21, 0x10, 0xA2, 0x04, 0x32, 0x22, 0x10, 0xC2, 0x04, 0x13, 0x21, 0x20, 
+    0xF0, 0x0C, 0x00, 0x40, 0xF0, 0x07, 0x02, 0x11, 0x10, 0xC0, 0x02, 0x13, 0xB0, 0xB3, 0x02, 0x22, 
+    0x30, 0xC2, 0x03, 0x00, 0x04, 0xB0, 0x05, 0x11, 0x21, 0x11, 0xE0, 0xA1, 0x04, 0x00, 0x01, 0x10, 
+    0xD0, 0x08, 0x22, 0x02, 0x11, 0x22, 0x30, 0xE2, 0x05, 0x32, 0x21, 0x23, 0x4C, 0x00, 0x10, 0xF0, 
+    0x11, 0x02, 0x11, 0x10, 0xC0, 0x02, 0x12, 0x10, 0xA2, 0xA1, 0x10, 0x21, 0x22, 0x33, 0x22, 0x20, 
+    0x01, 0x10, 0x11, 0x00, 0x4C, 0x04, 0x00, 0x01, 0x10, 0xD0, 0x01, 0x21, 0x42, 0xF2, 0x03, 0x06, 
+    0x33, 0x32, 0x12, 0x10, 0xC0, 0x00, 0x10, 0xF0, 0x07, 0x01, 0x11, 0xF0, 0x05, 0x05, 0x10, 0x00, 
+    0x11, 0xE0, 0x01, 0x12, 0xC1, 0xF2, 0x01, 0x07, 0x10, 0x00, 0x11, 0x22, 0xF0, 0x00, 0x00, 0x10, 
+    0xA0, 0x01, 0x12, 0xF0, 0x00, 0xF2, 0x07, 0xA3, 0x02, 0x21, 0x10, 0x45, 0xF0, 0x08, 0x00, 0x10, 
+    0xF0, 0x0B, 0x05, 0x11, 0x10, 0x01, 0xB0, 0x04, 0x11, 0x12, 0x10, 0xF2, 0x05, 0xC0, 0x00, 0x20, 
+    0xF0, 0x02, 0x01, 0x11, 0xF0, 0x01, 0x03, 0x12, 0x11, 0xF2, 0x08, 0x00, 0x10, 0xF0, 0x26, 0xD1, 
+    0xB0, 0xA1, 0xF2, 0x02, 0x01, 0x33, 0xC2, 0x01, 0x02, 0xE0, 0x02, 0x11, 0x10, 0xF0, 0x02, 0x02, 
+    0x22, 0x10, 0xF2, 0x08, 0x00, 0x10, 0xF0, 0x24, 0x03, 0x11, 0x10, 0xA1, 0x02, 0x01, 0x10, 0xD0, 
+    0x01, 0x11, 0xE2, 0x01, 0x33, 0xA2, 0x00, 0x10, 0xB2, 0xD0, 0x02, 0x11, 0x10, 0xF0, 0x03, 0x01, 
+    0x20, 0x48, 0x02, 0x11, 0x10, 0x66, 0xD1, 0x01, 0x00, 0xD1, 0x01, 0x01, 0xF0, 0x04, 0x01, 0x11, 
+    0xD2, 0x01, 0x11, 0xB2, 0x01, 0x11, 0x48, 0x09, 0x00, 0x01, 0x00, 0xD0, 0x22, 0xC0, 0x05, 0x21, 
+    0x21, 0x12, 0xF1, 0x05, 0xF0, 0x16, 0x05, 0x11, 0x10, 0x00, 0xA1, 0xC0, 0x00, 0x10, 0xF0, 0x09, 
+    0x06, 0x11, 0x21, 0x12, 0x10, 0x42, 0x01, 0x12, 0xB1, 0xF0, 0x01, 0x07, 0x11, 0x0D, 0x00, 0x83, 
+    0xC0, 0xF1, 0x0C, 0xF0, 0x17, 0x42, 0xF0, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x01, 0x11, 0xF0, 0x01, 
+    0xD1, 0x05, 0x21, 0x11, 0x22, 0x4B, 0x07, 0x21, 0x04, 0x00, 0x02, 0xB0, 0x04, 0x11, 0x10, 0x10, 
+    0xA2, 0x00, 0x10, 0xB2, 0xB1, 0xF0, 0x0A, 0xC1, 0xF0, 0x0A, 0x05, 0x11, 0x10, 0x11, 0xC0, 0x00, 
+    0x10, 0x4A, 0x02, 0x00, 0x00, 0xD1, 0xB2, 0x43, 0x01, 0x44, 0xA0, 0x04, 0x11, 0x00, 0x00, 0xA2, 
+    0xC0, 0xF1, 0x00, 0x00, 0x20, 0xD1, 0xC0, 0xF1, 0x0F, 0x01, 0x00, 0xE1, 0xF0, 0x01, 0x02, 0x11, 
+    0x10, 0x52, 0x01, 0x00, 0xE1, 0x45, 0xC0, 0x43, 0x03, 0x02, 0x81, 0x4C, 0xF2, 0x00, 0xF0, 0x01, 
+    0xD1, 0xE0, 0x05, 0x11, 0x10, 0x00, 0xF1, 0x02, 0xF0, 0x01, 0x01, 0x11, 0xA0, 0x00, 0x10, 0xF0, 
+    0x09, 0xF1, 0x00, 0x49, 0xF0, 0x05, 0xD1, 0x01, 0x22, 0xA0, 0x00, 0x40, 0xB2, 0xF0, 0x0D, 0xF1, 
+    0x09, 0xF0, 0x03, 0x01, 0x11, 0xF0, 0x0F, 0x4E, 0xE0, 0x01, 0x11, 0xA0, 0xE1, 0xD0, 0x02, 0x44, 
+    0x40, 0xF0, 0x13, 0xF1, 0x00, 0xA0, 0x4B, 0x03, 0x00, 0x11, 0xF0, 0x0F, 0x4D, 0x00, 0x10, 0xB0, 
+    0x00, 0x10, 0x44, 0x03, 0x00, 0x10, 0x49, 0xC0, 0x00, 0x10, 0xD0, 0xB1, 0xE0, 0xF1, 0x09, 0xF0, 
+    0x07, 0x01, 0x21, 0xF0, 0x0F, 0x4D, 0xD1, 0xB0, 0xA1, 0xF0, 0x07, 0x46, 0xF0, 0x03, 0xF1, 0x08, 
+    0x03, 0x00, 0x01, 0xF0, 0x07, 0x01, 0x11, 0xF0, 0x1D, 0x45, 0x01, 0x11, 0xF0, 0x0D, 0x01, 0x12, 
+    0xF0, 0x0B, 0x00, 0x10, 0xF0, 0x01, 0xC1, 0xF0, 0x0A, 0x01, 0x11, 0xF0, 0x0E, 
+};
+
+const gfx_image_t STORY_CH3_IMG = {
+    .w = STORY_CH3_W, .h = STORY_CH3_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH3_PAL, .colors = STORY_CH3_PAL_SIZE,
+    .data = STORY_CH3_RLE, .size = STORY_CH3_RLE_SIZE,
 };
@@ -6,240 +6,158 @@ const uint16_t STORY_CH3_ENEMY_PAL[STORY_CH3_ENEMY_PAL_SIZE] = {
     0xDE99, 0x9307, 0x41E8, 0xDE17, 0x10A3, 0x18E4, 0x20C2, 0x3144, 
 };
 
-const uint8_t STORY_CH3_ENEMY_IDX[(STORY_CH3_ENEMY_W * STORY_CH3_ENEMY_H) / 2] = {
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0x00, 0xCC, 0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xC0, 0x03, 0x0C, 0xF0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xC0, 0xF3, 0x0C, 0xFC, 0xCC, 0x11, 0xC0, 0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0x02, 0x10, 0x00, 0x00, 0x10, 0x11, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x03, 0x20, 0x02, 0xF1, 0x10, 0x10, 0xCC, 0xCE, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0x21, 0x13, 0x13, 0x10, 0x11, 0xEF, 0x1F, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x13, 0x11, 0x11, 0x1E, 0x00, 0x01, 
-    0x01, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x04, 0x10, 0x10, 0xEE, 
-    0xFF, 0x10, 0x10, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x02, 0x02, 0x10, 
-    0x0F, 0xF1, 0x1F, 0x0E, 0x1E, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCF, 0x0C, 0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x0F, 
-    0x55, 0x23, 0x12, 0x21, 0xFF, 0x01, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0x03, 0x01, 0x3C, 0xF0, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0x54, 0x61, 0x23, 0xF0, 0x11, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x02, 0xF3, 0x01, 0xEF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0x02, 0x54, 0x3F, 0x0E, 0xEF, 0x31, 0xF0, 0xFF, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0xF6, 0x13, 0xF1, 0xF3, 0x0C, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x0E, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x2C, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x26, 0x31, 0x30, 0x3C, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x01, 0x72, 0x1E, 0x0E, 0xFF, 0xEF, 0xFE, 0xE1, 0x2F, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x1C, 0xCC, 0xCC, 0xCC, 0xEC, 0xCC, 0xC0, 0x52, 0x11, 0x03, 0x10, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x02, 0x43, 0x3F, 0x00, 0xEE, 0xEF, 0x0E, 
-    0xF2, 0x2F, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xFC, 0xCC, 0xCC, 0xCF, 0x1F, 0xCC, 0xCF, 0x63, 0x10, 
-    0x13, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x31, 0x30, 0x01, 0x0E, 
-    0xEE, 0xE0, 0x22, 0x0F, 0xCC, 0xCC, 0xCC, 0xCC, 0x03, 0x30, 0xCC, 0x00, 0x23, 0x11, 0xFC, 0x03, 
-    0x41, 0x10, 0x1F, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x13, 0x1E, 
-    0xF1, 0x0E, 0xCE, 0x02, 0x20, 0xFF, 0xCC, 0xC0, 0x0C, 0xCC, 0x24, 0x10, 0xC0, 0x05, 0x21, 0x11, 
-    0x14, 0x22, 0x31, 0x0E, 0x0C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 
-    0x12, 0x2E, 0x1F, 0xEE, 0xF2, 0x22, 0xF0, 0xFE, 0x0C, 0xF1, 0x20, 0x06, 0x63, 0xF1, 0xFC, 0x04, 
-    0x20, 0x11, 0x03, 0x23, 0x21, 0x0E, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xC2, 0x34, 0x20, 0x0E, 0xE0, 0x21, 0xF0, 0xFF, 0xF0, 0x21, 0x25, 0x54, 0x62, 0x6F, 0xF3, 
-    0x1F, 0xF3, 0x3F, 0x1E, 0xE1, 0x31, 0x32, 0x23, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0x25, 0x12, 0x0E, 0xEF, 0x12, 0x1E, 0xEF, 0xFF, 0xC2, 0x74, 0x25, 0x46, 0x26, 
-    0x5F, 0xE1, 0x30, 0x25, 0x2F, 0x31, 0x13, 0x21, 0x11, 0x12, 0x20, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0x54, 0x25, 0x20, 0xF3, 0x0F, 0xEF, 0x3E, 0xEC, 0xC2, 0x66, 0x22, 
-    0x64, 0x31, 0x1E, 0xE0, 0x0C, 0x65, 0x20, 0x0F, 0x11, 0x10, 0x12, 0x10, 0xF0, 0x3F, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x05, 0x43, 0x42, 0xFF, 0xFF, 0xF0, 0x32, 0x2F, 0x03, 0x54, 
-    0x46, 0x52, 0x44, 0x11, 0x00, 0x01, 0x01, 0x62, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0x2F, 0xF0, 0x14, 
-    0x2F, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x54, 0x02, 0x21, 0xFF, 0xF0, 0x20, 0x22, 0x2F, 
-    0x14, 0x52, 0x11, 0x24, 0x22, 0x2F, 0x0F, 0x00, 0xE2, 0x42, 0x11, 0x10, 0xFF, 0xF0, 0xF0, 0x02, 
-    0x21, 0x12, 0x44, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x40, 0x02, 0x22, 0xF1, 0x0A, 0xFC, 
-    0xCF, 0xF0, 0x45, 0x22, 0x31, 0x13, 0x24, 0x41, 0x00, 0x00, 0x04, 0x2F, 0x03, 0x1F, 0xFE, 0xEE, 
-    0x0E, 0xEE, 0x01, 0x11, 0x23, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 0x05, 0x2F, 0x25, 0x0F, 0x02, 
-    0x0C, 0xFC, 0xCC, 0xF2, 0x25, 0x53, 0x31, 0xFE, 0x24, 0x61, 0xEF, 0xF0, 0xF2, 0x10, 0xF1, 0xFF, 
-    0xFE, 0xEE, 0xEC, 0xEE, 0xEE, 0x12, 0x24, 0x3C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x0F, 0x22, 0x22, 0x22, 
-    0x22, 0x03, 0xF0, 0xFF, 0xFF, 0x24, 0x21, 0x44, 0x21, 0x10, 0x00, 0x24, 0x21, 0x0F, 0x11, 0x02, 
-    0x21, 0x0E, 0x0F, 0xEE, 0xEE, 0xEE, 0xCC, 0xE3, 0x03, 0x30, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 
-    0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x55, 0x23, 
-    0x33, 0x02, 0x2F, 0x2F, 0xC0, 0xFF, 0xFF, 0x22, 0x22, 0x12, 0x21, 0xF0, 0x0F, 0x12, 0x21, 0x21, 
-    0x11, 0x02, 0x21, 0x0E, 0xFF, 0xEE, 0xEE, 0xEC, 0xCC, 0xCC, 0xC1, 0x3E, 0xCC, 0xCC, 0xCC, 0xDC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x24, 
-    0x21, 0xFF, 0xFE, 0x22, 0x04, 0x4F, 0xFF, 0xFF, 0xFD, 0xFF, 0x12, 0x21, 0x11, 0xF0, 0xEF, 0xEF, 
-    0x0F, 0x02, 0x21, 0xF1, 0x20, 0xEE, 0x0F, 0x0E, 0xEE, 0xC0, 0xEE, 0xCC, 0xC0, 0xFC, 0xCC, 0xCC, 
-    0xCC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xF2, 0x23, 0x31, 0x00, 0x0F, 0x2F, 0x28, 0x4C, 0xFF, 0xC0, 0x0C, 0xEF, 0x24, 0x22, 0x3F, 0xF1, 
-    0x00, 0x0E, 0x0F, 0x12, 0x66, 0x42, 0x22, 0x1E, 0x0F, 0x00, 0xEE, 0x0C, 0x0F, 0xEC, 0xCE, 0x0C, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 
-    0x0F, 0x22, 0x43, 0x12, 0x31, 0xF0, 0xFF, 0x02, 0xB7, 0x2C, 0xF0, 0xFC, 0xEC, 0x0F, 0x24, 0x22, 
-    0x31, 0x10, 0x00, 0x11, 0xF1, 0x11, 0x26, 0x42, 0x12, 0x1E, 0xEE, 0xFF, 0xEE, 0x0C, 0xCF, 0xEC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0x22, 0x22, 0x24, 0x21, 0xFF, 0xF1, 0x0F, 0xF0, 0x27, 0x54, 0x2E, 0xF1, 0x1E, 0xCC, 0xEF, 
-    0x32, 0x22, 0x22, 0x10, 0xF0, 0x00, 0xE0, 0x31, 0x03, 0x1E, 0x03, 0x2E, 0xEE, 0x0F, 0x0E, 0xEC, 
-    0xCE, 0xFE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xF2, 0xFF, 0xF1, 0x20, 0x0C, 0xC0, 0xCF, 0x02, 0x55, 0x44, 0x20, 0x11, 0x11, 
-    0xCC, 0xC0, 0x22, 0x22, 0x23, 0x0F, 0x00, 0xEE, 0xEE, 0x13, 0xF0, 0x33, 0x32, 0x2E, 0xEC, 0xE0, 
-    0xFE, 0xFF, 0xCC, 0xF1, 0x1F, 0xFC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF4, 0xEE, 0xEE, 0x10, 0x0C, 0xCC, 0xCF, 0x28, 0x52, 0x22, 0x10, 
-    0x13, 0x12, 0x10, 0xC0, 0x22, 0x22, 0x1F, 0xFF, 0x0E, 0xE0, 0xE0, 0x0E, 0xFE, 0xF3, 0x13, 0x2E, 
-    0xCC, 0xCE, 0xEE, 0xE1, 0x0C, 0xCD, 0xCC, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x0F, 0xCC, 0xCF, 0x1C, 0x0C, 0xCC, 0xD0, 0x55, 0x23, 
-    0x22, 0x13, 0x23, 0x32, 0x11, 0xF0, 0x32, 0x23, 0x0E, 0x00, 0x0F, 0x0E, 0xEE, 0xEE, 0xEF, 0xFF, 
-    0x22, 0x20, 0xFC, 0xCC, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCF, 0xF0, 0xCC, 0xCC, 0xF4, 
-    0x42, 0x21, 0x31, 0x12, 0x32, 0x66, 0x21, 0x10, 0x12, 0x31, 0xFE, 0xEF, 0x1F, 0xEE, 0xEE, 0xEE, 
-    0xEF, 0xF0, 0x24, 0x20, 0x00, 0xCC, 0xEE, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCD, 
-    0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xFF, 0xCD, 
-    0xCC, 0x25, 0x23, 0x31, 0x11, 0x13, 0x26, 0x23, 0x22, 0x3E, 0x02, 0x11, 0x00, 0xE0, 0xFF, 0x0E, 
-    0xE0, 0x0E, 0x0E, 0x01, 0x32, 0x1E, 0x00, 0xEC, 0xEE, 0xCC, 0xCC, 0xCC, 0xCD, 0xCC, 0xCD, 0xDC, 
-    0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCF, 0xCD, 0xCF, 0x52, 0x32, 0x31, 0x1F, 0x01, 0x22, 0x31, 0x22, 0x1E, 0x01, 0x11, 0x1F, 0xEE, 
-    0xFF, 0xFF, 0xEF, 0x1E, 0x0E, 0xF2, 0x13, 0x0C, 0xC1, 0x1E, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xF1, 0xCD, 0xC2, 0x72, 0x22, 0x10, 0x0F, 0x01, 0x12, 0x22, 0x22, 0x0E, 0xF2, 0x11, 
-    0x21, 0xFE, 0xFF, 0xEF, 0xEE, 0x10, 0xFF, 0xF2, 0x23, 0xCC, 0x01, 0x11, 0xFF, 0x00, 0xFF, 0x1F, 
-    0x00, 0xFC, 0xDC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0xC0, 0x28, 0x52, 0x1F, 0x00, 0x00, 0x01, 0x0F, 0x32, 0x3F, 0x0E, 
-    0xF1, 0x22, 0x21, 0x20, 0xEE, 0xEE, 0xFE, 0xFF, 0xEF, 0x0F, 0x21, 0xCE, 0x01, 0x01, 0xF1, 0x32, 
-    0x22, 0x31, 0x11, 0x11, 0xDC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF4, 0x85, 0x22, 0xFF, 0xF0, 0x0E, 0x0E, 0x00, 0x13, 
-    0x20, 0xEC, 0xCE, 0x22, 0x22, 0x30, 0xFE, 0xEC, 0xF0, 0xEF, 0x00, 0x12, 0x11, 0xCC, 0x0F, 0x01, 
-    0xEF, 0x23, 0x1F, 0x00, 0xFF, 0xEF, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x25, 0x52, 0x11, 0x0F, 0xFF, 0x00, 0x0E, 
-    0x0E, 0x3F, 0xEE, 0xCC, 0xCC, 0x0F, 0x22, 0xF0, 0xF0, 0xEE, 0xE1, 0xF0, 0x11, 0xF2, 0x1E, 0xCE, 
-    0x00, 0x30, 0xEE, 0x1F, 0x0E, 0xEE, 0xE1, 0x2D, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x37, 0x52, 0x31, 0xFF, 0x00, 
-    0xEE, 0xEE, 0xEE, 0xE1, 0xFC, 0xC0, 0xCC, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x1F, 0x10, 0xFF, 
-    0x0E, 0xE0, 0x01, 0x33, 0xCE, 0xFF, 0xEC, 0xCC, 0xCE, 0x3F, 0xCD, 0xCC, 0xDD, 0xCC, 0xCC, 0xCC, 
-    0xCD, 0xCC, 0xCD, 0xCC, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xD0, 0x27, 0x52, 0x1F, 
-    0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xE0, 0xFE, 0xCC, 0xCC, 0xCC, 0x0F, 0x0E, 0xFF, 0xFF, 0xFE, 0xEE, 
-    0xEC, 0xCE, 0xCE, 0xEE, 0x01, 0x19, 0x0C, 0xF1, 0xEC, 0xCD, 0xCC, 0x01, 0xCD, 0xCC, 0xDD, 0xDD, 
-    0xCC, 0xDD, 0xDD, 0xDC, 0xCD, 0xCD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x65, 
-    0x52, 0x1F, 0xEE, 0x0F, 0xFE, 0xCC, 0xCE, 0xE1, 0xE0, 0xCC, 0xCC, 0xCC, 0xCE, 0x0E, 0xEE, 0xEF, 
-    0xFF, 0xEE, 0xEC, 0xCC, 0xCC, 0xE0, 0x01, 0x19, 0x1C, 0xE1, 0x0C, 0xCC, 0xCC, 0xEF, 0xCD, 0xCC, 
-    0xDC, 0xDC, 0xCC, 0xCD, 0xDC, 0xCC, 0xCD, 0xDC, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCD, 0x64, 0x42, 0x10, 0xE0, 0xF0, 0xCC, 0xCC, 0xEE, 0xE3, 0x0F, 0xEC, 0xCC, 0xCF, 0xCC, 0xEE, 
-    0xEE, 0xEE, 0xEF, 0xFE, 0xCC, 0xCC, 0xCE, 0xE0, 0x0F, 0x13, 0x3C, 0xC0, 0xFC, 0xDC, 0xCD, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xDC, 0xDC, 0xCD, 0xDD, 0xCD, 0xDD, 0xDC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCF, 0x22, 0x23, 0x00, 0xFF, 0xE0, 0x0C, 0xEF, 0xE0, 0xE1, 0x1E, 0x0C, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCE, 0xCC, 0xCE, 0xEC, 0xCC, 0xCC, 0xCC, 0xE0, 0x0F, 0x03, 0x90, 0xCC, 0xFD, 0xDD, 
-    0xDD, 0xDD, 0xCD, 0xDC, 0xCC, 0xDD, 0xDD, 0xDC, 0xDD, 0xDC, 0xCD, 0xDC, 0xDC, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x23, 0x21, 0xF0, 0xFF, 0xC0, 0x0C, 0xEF, 0x10, 0xE0, 0x1E, 0xF0, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0xE0, 0x03, 0x41, 0xCD, 
-    0xCD, 0xDD, 0xDD, 0xDC, 0xDC, 0xCD, 0xCD, 0xDD, 0xDD, 0xDD, 0xCC, 0xDC, 0xCD, 0xDC, 0xDD, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x31, 0x31, 0x00, 0x0E, 0xCC, 0x0E, 0x0E, 0xF0, 0x0E, 
-    0x30, 0xE0, 0xEE, 0xFE, 0xCC, 0xEE, 0xEE, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0xEF, 0x13, 
-    0x33, 0xCD, 0xDC, 0xCC, 0xCD, 0xDC, 0xCC, 0xCC, 0xCD, 0xDD, 0xDD, 0xDD, 0xDC, 0xCC, 0xCD, 0xDD, 
-    0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCD, 0x11, 0x1F, 0x00, 0x0E, 0xCC, 0x0E, 0xFF, 
-    0x03, 0x0E, 0xF1, 0xC0, 0xFE, 0xCC, 0xEE, 0x0E, 0xE0, 0xF0, 0xEE, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 
-    0x0F, 0x12, 0x33, 0xCD, 0xDC, 0xCC, 0xDD, 0xDC, 0xCC, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xCC, 
-    0xCD, 0xDD, 0xDD, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0x0F, 0xFF, 0xEE, 0xEE, 0xCC, 
-    0xCE, 0xF0, 0x02, 0x3E, 0xE1, 0x0E, 0x0F, 0x0E, 0x00, 0xFE, 0x0F, 0x00, 0xEE, 0xEE, 0xEE, 0x0C, 
-    0xCC, 0xEE, 0x0F, 0x32, 0x31, 0xCD, 0xDD, 0xDC, 0xDD, 0xDD, 0xCD, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDC, 0xFF, 0xF0, 0xEE, 
-    0xEE, 0xCC, 0x01, 0x1E, 0x34, 0x20, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xEE, 0xEE, 
-    0xE0, 0x1E, 0xCC, 0xEE, 0x0F, 0x22, 0x1F, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xCC, 0xDD, 0xDD, 0xDD, 0xDC, 0xCC, 0xCC, 0xCC, 0xDD, 0xCC, 0xCC, 0xDD, 0xCF, 0x20, 
-    0x00, 0x0E, 0xCE, 0xCC, 0x02, 0x3E, 0xF2, 0x3F, 0x10, 0x01, 0x11, 0xF1, 0x10, 0x0F, 0x0F, 0xF0, 
-    0xF0, 0xEE, 0x01, 0x30, 0xCC, 0xC0, 0x0F, 0x31, 0xFF, 0xCF, 0xFD, 0xDD, 0xCD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDC, 0xDD, 0xCD, 0xDD, 0xCD, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xDD, 0xCC, 0xCC, 0xDC, 
-    0xC0, 0x2F, 0xF0, 0x0E, 0xEE, 0xCC, 0xE2, 0x1F, 0x02, 0x30, 0x31, 0x11, 0x13, 0x33, 0x11, 0x11, 
-    0x13, 0x1F, 0xF0, 0xE0, 0x11, 0x31, 0xCC, 0xCE, 0x0F, 0x11, 0xFF, 0xE1, 0xFD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCD, 0xDD, 0xDD, 0xDC, 0xCC, 0xCC, 0xDD, 0xDD, 
-    0xDD, 0xCF, 0x22, 0x22, 0xF0, 0x00, 0xEC, 0xCC, 0xF3, 0xF0, 0xE2, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x31, 0x12, 0x11, 0x1F, 0x00, 0xE0, 0x11, 0x11, 0xCC, 0xF0, 0xFF, 0x10, 0xF0, 0x00, 0xDD, 0xDD, 
-    0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDC, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xCC, 0xDD, 
-    0xDD, 0xDD, 0xDC, 0x24, 0x56, 0x22, 0x02, 0x0F, 0xEC, 0xCC, 0x0F, 0xEE, 0xF3, 0x11, 0x11, 0x12, 
-    0x22, 0x23, 0x22, 0x31, 0x11, 0xF0, 0x00, 0x00, 0x11, 0x31, 0xCC, 0xEF, 0x11, 0x00, 0x10, 0x0D, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCC, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xF1, 0x22, 0x13, 0xF2, 0x0F, 0xF0, 0xCC, 0xFF, 0xEF, 0xF1, 0x10, 
-    0x13, 0x32, 0x22, 0x21, 0x32, 0x23, 0xFF, 0xF0, 0x0F, 0xF1, 0x11, 0x10, 0xCE, 0xFF, 0x20, 0x10, 
-    0x10, 0xC0, 0xD0, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xCC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCF, 0x11, 0xEF, 0x00, 0xEF, 0xFE, 0xCC, 0xF0, 0xEF, 
-    0x1F, 0x01, 0x11, 0x13, 0x13, 0x21, 0x13, 0x32, 0xF0, 0xF0, 0x0F, 0xFF, 0x10, 0x0E, 0xF0, 0x13, 
-    0x21, 0x22, 0x22, 0x1C, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDF, 0x11, 0xFF, 0x0C, 0xFF, 0xEC, 0xCC, 
-    0xEE, 0xEF, 0xEE, 0x12, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0xF0, 0x00, 0xFF, 0x0F, 0x0E, 0xEF, 
-    0xFF, 0x00, 0x10, 0x11, 0x02, 0x23, 0xD0, 0xDD, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xCD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xF0, 0x0E, 0xFE, 
-    0xCC, 0xCC, 0xEE, 0xE0, 0x00, 0x22, 0x2F, 0x11, 0x32, 0x22, 0x1F, 0xFF, 0x00, 0x0F, 0xF0, 0xF0, 
-    0xEE, 0xE0, 0xCF, 0xE0, 0xEF, 0xFE, 0xF0, 0x1F, 0xD0, 0xDD, 0x0D, 0xCD, 0x03, 0x01, 0xFF, 0x1F, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0x21, 0xE0, 
-    0xEE, 0xE1, 0x1C, 0xCC, 0xEE, 0xE0, 0xF3, 0x24, 0x21, 0x13, 0x22, 0x13, 0x21, 0x1F, 0xF0, 0xFF, 
-    0x00, 0xFE, 0xEE, 0xEE, 0xCE, 0xEE, 0xE0, 0xFE, 0xF0, 0xFF, 0x0D, 0xDD, 0xCD, 0x02, 0x21, 0x11, 
-    0x11, 0x1F, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 
-    0x21, 0xF0, 0xEC, 0xEE, 0xF0, 0xCC, 0xEE, 0xEE, 0xF2, 0x22, 0x23, 0x22, 0x31, 0x01, 0x32, 0x31, 
-    0xF0, 0xFF, 0x0E, 0xEE, 0xE0, 0xF0, 0xCC, 0xEE, 0xE0, 0xEE, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0x3F, 
-    0xE0, 0x0E, 0xFF, 0x11, 0xFD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDF, 0x21, 0xFC, 0x0C, 0xCC, 0xC0, 0xCC, 0xEE, 0xEE, 0x02, 0x22, 0x11, 0x22, 0x31, 0xF1, 
-    0x32, 0x21, 0x10, 0xFF, 0xEE, 0xEE, 0x0F, 0xF1, 0x0E, 0x00, 0xF1, 0xF0, 0xE0, 0x00, 0xF0, 0x0F, 
-    0x2F, 0xCD, 0x0D, 0xDD, 0xD0, 0xF1, 0x1C, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xD0, 0xD0, 0x1F, 0xCC, 0xFC, 0xC0, 0xCC, 0xCE, 0xF0, 0xEE, 0xF3, 0x23, 0xF1, 0x23, 
-    0x21, 0x01, 0x23, 0x31, 0xF0, 0x00, 0xEE, 0xEF, 0x11, 0xF1, 0x1F, 0xEC, 0xEF, 0x1F, 0x1F, 0x00, 
-    0x0F, 0xEE, 0xCC, 0x0D, 0xD0, 0xDD, 0xDD, 0xF0, 0x1F, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xD0, 0xC2, 0x1E, 0xEC, 0xFC, 0xC0, 0xCC, 0xC0, 0x00, 0xEE, 0xF1, 0x11, 
-    0x0F, 0x11, 0x31, 0x13, 0x31, 0x10, 0x00, 0xEE, 0xEE, 0xE0, 0x11, 0x1F, 0x10, 0xE0, 0xEE, 0xFF, 
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xF0, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x0D, 0xF2, 0x1E, 0xCC, 0xFC, 0xC0, 0xCC, 0xCF, 0x1F, 0xEE, 
-    0x01, 0x31, 0xEF, 0xF1, 0x11, 0xF1, 0x11, 0x1F, 0x00, 0xEE, 0xEE, 0xE1, 0x11, 0x1F, 0x1E, 0x00, 
-    0xCE, 0x0E, 0xC0, 0x00, 0x00, 0xDF, 0xFF, 0xE0, 0xDD, 0xDD, 0xDD, 0x01, 0xFF, 0x0D, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x0C, 0x02, 0x00, 0x00, 0xFC, 0xC0, 0xCC, 0xC0, 
-    0x1F, 0x0E, 0xEF, 0x10, 0xE0, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0, 0x0E, 0xEE, 0xEE, 0x0F, 0x31, 0x31, 
-    0xF0, 0x0E, 0xCE, 0xE0, 0x00, 0x00, 0x0D, 0xF2, 0x1E, 0xFE, 0xEC, 0xDD, 0xDD, 0x03, 0xFF, 0x0D, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0x0D, 0xF3, 0xE0, 0xF0, 0xFC, 0x00, 
-    0xCC, 0xE0, 0xFF, 0x0E, 0xEE, 0x1F, 0xEE, 0xE0, 0xF0, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 
-    0x11, 0x31, 0xE0, 0x0C, 0xCE, 0xDF, 0x00, 0x00, 0x0C, 0x21, 0xC0, 0x00, 0xDC, 0xCC, 0xDD, 0x02, 
-    0x0F, 0xCD, 0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0x0D, 0xDD, 0xD0, 0xDD, 0x00, 0x00, 0xC3, 0x30, 0xF0, 
-    0x0C, 0x00, 0xCC, 0x0F, 0xFF, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEC, 
-    0xEE, 0xEE, 0xF1, 0xF0, 0x10, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x0D, 0xDD, 
-    0x0C, 0xF2, 0xF0, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0x00, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 
-    0x0F, 0xD0, 0xFC, 0x00, 0xCC, 0xEF, 0xF0, 0x0E, 0xEC, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xE1, 0x30, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x1D, 0x00, 0x0C, 
-    0xCF, 0xFF, 0x0C, 0x22, 0x0E, 0x0D, 0xDD, 0xDD, 0xDD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xD0, 0xD0, 0xF0, 0x0C, 0xCC, 0xEF, 0xF0, 0xEE, 0xEE, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEC, 0xCE, 0xEE, 0xEE, 0xEF, 0xE0, 0x0E, 0xC2, 0x22, 0x2F, 0x00, 0x00, 0xD0, 0x10, 
-    0x00, 0xC2, 0x22, 0x21, 0xFF, 0x21, 0xED, 0x0D, 0xDD, 0xDD, 0x0D, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF0, 0x0C, 0xCC, 0xEF, 0x01, 0xFE, 0xCC, 0xCC, 0xCC, 0xCE, 
-    0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0xCC, 0xEE, 0xEE, 0x10, 0xEE, 0xEE, 0xCE, 0x13, 0x21, 0x00, 0x00, 
-    0x00, 0xFF, 0x0D, 0x24, 0x20, 0x0E, 0xEF, 0xF0, 0xE0, 0xDD, 0xDD, 0xDD, 0x0D, 0xF0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x0C, 0xCC, 0x00, 0x01, 0xFE, 0xCC, 0xEE, 
-    0xEC, 0x0C, 0xEE, 0xEE, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0x00, 0xEE, 0xF1, 0xCC, 0xE0, 0xF1, 
-    0x10, 0xFF, 0x0F, 0xFF, 0xC2, 0x21, 0x00, 0xEE, 0xEF, 0xFE, 0xE0, 0x00, 0xDD, 0xDD, 0x0D, 0xF0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0C, 0x0C, 0xF0, 0x0F, 0xF0, 
-    0xEC, 0xEE, 0xCC, 0xCC, 0xCC, 0xCC, 0xEC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFE, 0x0E, 0xE0, 0x11, 0x0E, 
-    0xEE, 0x0F, 0x1F, 0x00, 0xCC, 0xFF, 0x02, 0xFF, 0xEE, 0xEE, 0xFE, 0xEE, 0xED, 0xDD, 0xD0, 0x00, 
-    0x0D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xCC, 0x0C, 0xF0, 
-    0xEE, 0x0E, 0xCE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0xEC, 0xCC, 0x00, 0x0E, 0x01, 
-    0x1F, 0x10, 0xEE, 0xEE, 0xF1, 0xFF, 0x22, 0x22, 0x2F, 0xFE, 0xEC, 0xEE, 0xEE, 0x10, 0xED, 0xDD, 
-    0xDD, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xCD, 
-    0xFC, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCE, 0xEE, 0xEE, 0xCC, 0xCE, 
-    0xEE, 0x0E, 0xE0, 0x1E, 0xEE, 0xEE, 0xF1, 0x13, 0x42, 0x1F, 0xFF, 0xEE, 0xCE, 0xEE, 0xE1, 0x2E, 
-    0xEF, 0xFF, 0xFF, 0x0F, 0xFF, 0x00, 
+const uint8_t STORY_CH3_ENEMY_RLE[STORY_CH3_ENEMY_RLE_SIZE] = {
+    0xFC, 0x19, 0x04, 0x00, 0xCC, 0x00, 0xFC, 0x55, 0x06, 0x00, 0x30, 0xCF, 0x00, 0xFC, 0x4C, 0x0D, 
+    0x0F, 0x30, 0xCF, 0xCC, 0xC1, 0x1C, 0x00, 0xFC, 0x4E, 0x02, 0x02, 0x10, 0xB0, 0x03, 0x10, 0x11, 
+    0xFC, 0x4F, 0x0F, 0x03, 0x20, 0x02, 0xF1, 0x10, 0x10, 0xCC, 0xCE, 0xFC, 0x4B, 0x0F, 0x00, 0x21, 
+    0x13, 0x13, 0x10, 0x11, 0xEF, 0x1F, 0xFC, 0x4C, 0x02, 0x01, 0x30, 0xB1, 0x06, 0xE0, 0x00, 0x10, 
+    0x10, 0xFC, 0x4C, 0x0E, 0x00, 0x41, 0x01, 0x0E, 0xEF, 0xF1, 0x01, 0x00, 0xFC, 0x4B, 0x0F, 0x02, 
+    0x02, 0x10, 0x0F, 0xF1, 0x1F, 0x0E, 0x1E, 0xFC, 0x12, 0x03, 0xF0, 0xC0, 0x74, 0x0D, 0xF5, 0x52, 
+    0x31, 0x22, 0x1F, 0xF0, 0x11, 0xFC, 0x12, 0x07, 0x03, 0x01, 0x3C, 0xF0, 0xFC, 0x2B, 0x0B, 0x54, 
+    0x61, 0x23, 0xF0, 0x11, 0x00, 0xFC, 0x13, 0x07, 0x02, 0xF3, 0x01, 0xEF, 0xFC, 0x29, 0x10, 0x02, 
+    0x54, 0x3F, 0x0E, 0xEF, 0x31, 0xF0, 0xFF, 0xE0, 0xFC, 0x0F, 0x09, 0x0F, 0x61, 0x3F, 0x1F, 0x30, 
+    0xFC, 0x2A, 0x03, 0x76, 0x0E, 0xA0, 0x06, 0x1F, 0xFF, 0x00, 0x20, 0x57, 0x06, 0x26, 0x31, 0x30, 
+    0x30, 0xFC, 0x2A, 0x11, 0x01, 0x72, 0x1E, 0x0E, 0xFF, 0xEF, 0xFE, 0xE1, 0x2F, 0xFC, 0x00, 0x01, 
+    0x21, 0xDC, 0x00, 0xE0, 0x43, 0x07, 0x52, 0x11, 0x03, 0x10, 0x71, 0x0E, 0x24, 0x33, 0xF0, 0x0E, 
+    0xEE, 0xF0, 0xEF, 0x20, 0x49, 0x01, 0xFF, 0xCC, 0x0C, 0xF1, 0xFC, 0xCC, 0xF6, 0x31, 0x01, 0x30, 
+    0xFC, 0x2C, 0x07, 0x23, 0x13, 0x00, 0x10, 0xAE, 0x03, 0x02, 0x20, 0x47, 0x15, 0x03, 0x30, 0xCC, 
+    0x00, 0x23, 0x11, 0xFC, 0x03, 0x41, 0x10, 0x1F, 0x74, 0x0E, 0x13, 0x1E, 0xF1, 0x0E, 0xCE, 0x02, 
+    0x20, 0xF0, 0x42, 0x0D, 0x00, 0xCC, 0xC2, 0x41, 0x0C, 0x00, 0x52, 0xA1, 0x07, 0x42, 0x23, 0x10, 
+    0xE0, 0xFC, 0x2D, 0x2D, 0x01, 0x22, 0xE1, 0xFE, 0xEF, 0x22, 0x2F, 0x0F, 0xE0, 0xCF, 0x12, 0x00, 
+    0x66, 0x3F, 0x1F, 0xC0, 0x42, 0x01, 0x10, 0x32, 0x32, 0x10, 0xEE, 0xFC, 0x2D, 0x2D, 0x23, 0x42, 
+    0x00, 0xEE, 0x02, 0x1F, 0x0F, 0xFF, 0x02, 0x12, 0x55, 0x46, 0x26, 0xFF, 0x31, 0xFF, 0x33, 0xF1, 
+    0xEE, 0x13, 0x13, 0x22, 0x3F, 0xFC, 0x2C, 0x28, 0x25, 0x12, 0x0E, 0xEF, 0x12, 0x1E, 0xEF, 0xFF, 
+    0xC2, 0x74, 0x25, 0x46, 0x26, 0x5F, 0xE1, 0x30, 0x25, 0x2F, 0x31, 0x13, 0x20, 0xA1, 0x02, 0x22, 
+    0x00, 0xFC, 0x29, 0x33, 0x00, 0x54, 0x25, 0x20, 0xF3, 0x0F, 0xEF, 0x3E, 0xEC, 0xC2, 0x66, 0x22, 
+    0x64, 0x31, 0x1E, 0xE0, 0x0C, 0x65, 0x20, 0x0F, 0x11, 0x10, 0x12, 0x10, 0xF0, 0x3F, 0x6F, 0x04, 
+    0x54, 0x34, 0x20, 0xBF, 0x19, 0x03, 0x22, 0xF0, 0x35, 0x44, 0x65, 0x24, 0x41, 0x10, 0x00, 0x10, 
+    0x16, 0x21, 0xEF, 0x08, 0x12, 0xFF, 0x01, 0x42, 0xF0, 0xFC, 0x24, 0x37, 0xF5, 0x40, 0x22, 0x1F, 
+    0xFF, 0x02, 0x02, 0x22, 0xF1, 0x45, 0x21, 0x12, 0x42, 0x22, 0xF0, 0xF0, 0x0E, 0x24, 0x21, 0x11, 
+    0x0F, 0xFF, 0x0F, 0x00, 0x22, 0x11, 0x24, 0x4F, 0xFC, 0x00, 0x00, 0xD0, 0xFC, 0x19, 0x1C, 0x24, 
+    0x00, 0x22, 0x2F, 0x10, 0xAF, 0xCC, 0xFF, 0x04, 0x52, 0x23, 0x11, 0x32, 0x44, 0x10, 0xB0, 0x14, 
+    0x42, 0xF0, 0x31, 0xFF, 0xEE, 0xE0, 0xEE, 0xE0, 0x11, 0x12, 0x30, 0xFC, 0x22, 0x29, 0x00, 0x52, 
+    0xF2, 0x50, 0xF0, 0x20, 0xCF, 0xCC, 0xCF, 0x22, 0x55, 0x33, 0x1F, 0xE2, 0x46, 0x1E, 0xFF, 0x0F, 
+    0x21, 0x0F, 0x1F, 0x43, 0x01, 0xEC, 0xAE, 0x04, 0x12, 0x24, 0x30, 0xFC, 0x20, 0x01, 0x0F, 0xE2, 
+    0x03, 0x03, 0xF0, 0xAF, 0x1B, 0x24, 0x21, 0x44, 0x21, 0x10, 0x00, 0x24, 0x21, 0x0F, 0x11, 0x02, 
+    0x21, 0x0E, 0x0F, 0xCE, 0x07, 0xCC, 0xE3, 0x03, 0x30, 0xFC, 0x02, 0x01, 0xDD, 0xFC, 0x11, 0x0D, 
+    0x25, 0x52, 0x33, 0x30, 0x22, 0xF2, 0xFC, 0x44, 0x10, 0x22, 0x21, 0x22, 0x1F, 0x00, 0xF1, 0x22, 
+    0x12, 0x10, 0x46, 0x00, 0xF0, 0x44, 0xCC, 0x02, 0x13, 0xE0, 0xCC, 0x00, 0xD0, 0xFC, 0x16, 0x0C, 
+    0x24, 0x21, 0xFF, 0xFE, 0x22, 0x04, 0x40, 0xCF, 0x29, 0xDF, 0xF1, 0x22, 0x11, 0x1F, 0x0E, 0xFE, 
+    0xF0, 0xF0, 0x22, 0x1F, 0x12, 0x0E, 0xE0, 0xF0, 0xEE, 0xEC, 0x0E, 0xEC, 0xCC, 0x0F, 0xDC, 0x5C, 
+    0x2E, 0xF2, 0x23, 0x31, 0x00, 0x0F, 0x2F, 0x28, 0x4C, 0xFF, 0xC0, 0x0C, 0xEF, 0x24, 0x22, 0x3F, 
+    0xF1, 0x00, 0x0E, 0x0F, 0x12, 0x66, 0x42, 0x22, 0x10, 0x42, 0x0B, 0x0E, 0xE0, 0xC0, 0xFE, 0xCC, 
+    0xE0, 0xFC, 0x00, 0x00, 0xD0, 0xFC, 0x0D, 0x1B, 0x00, 0xF2, 0x24, 0x31, 0x23, 0x1F, 0x0F, 0xF0, 
+    0x2B, 0x72, 0xCF, 0x0F, 0xCE, 0xC0, 0x44, 0x16, 0x11, 0x00, 0x01, 0x1F, 0x11, 0x12, 0x64, 0x21, 
+    0x21, 0xEE, 0xEF, 0xF0, 0x42, 0x00, 0xC0, 0x42, 0xDC, 0x03, 0xDC, 0xCD, 0xFC, 0x0D, 0xB2, 0x19, 
+    0x42, 0x1F, 0xFF, 0x10, 0xFF, 0x02, 0x75, 0x42, 0xEF, 0x11, 0xEC, 0xCE, 0xF3, 0xB2, 0x1D, 0x10, 
+    0xF0, 0x00, 0xE0, 0x31, 0x03, 0x1E, 0x03, 0x2E, 0xEE, 0x0F, 0x0E, 0xEC, 0xCE, 0xFE, 0xFC, 0x19, 
+    0x15, 0xF2, 0xFF, 0xF1, 0x20, 0x0C, 0xC0, 0xCF, 0x02, 0x55, 0x44, 0x20, 0xA1, 0x03, 0xCC, 0xC0, 
+    0xB2, 0x04, 0x30, 0xF0, 0x00, 0xAE, 0x18, 0x13, 0xF0, 0x33, 0x32, 0x2E, 0xEC, 0xE0, 0xFE, 0xFF, 
+    0xCC, 0xF1, 0x1F, 0xF0, 0xDC, 0x00, 0xD0, 0x56, 0x00, 0x40, 0xAE, 0x00, 0x10, 0x42, 0x10, 0xCC, 
+    0xF2, 0x85, 0x22, 0x21, 0x01, 0x31, 0x21, 0x00, 0x44, 0x16, 0x1F, 0xFF, 0x0E, 0xE0, 0xE0, 0x0E, 
+    0xFE, 0xF3, 0x13, 0x2E, 0xCC, 0xC0, 0xAE, 0x08, 0x10, 0xCC, 0xDC, 0xCC, 0xD0, 0xFC, 0x15, 0x07, 
+    0x0F, 0xCC, 0xCF, 0x1C, 0x42, 0x1C, 0xD0, 0x55, 0x23, 0x22, 0x13, 0x23, 0x32, 0x11, 0xF0, 0x32, 
+    0x23, 0x0E, 0x00, 0x0F, 0x00, 0xCE, 0x0B, 0xFF, 0xF2, 0x22, 0x0F, 0xCC, 0xCE, 0xFC, 0x20, 0x00, 
+    0xF0, 0xAC, 0x02, 0xFF, 0x00, 0xAC, 0x1B, 0xF4, 0x42, 0x21, 0x31, 0x12, 0x32, 0x66, 0x21, 0x10, 
+    0x12, 0x31, 0xFE, 0xEF, 0x1F, 0xDE, 0x0D, 0xFF, 0x02, 0x42, 0x00, 0x0C, 0xCE, 0xEE, 0xFC, 0x04, 
+    0x04, 0xDC, 0xCD, 0xD0, 0xFC, 0x11, 0x0B, 0xFF, 0xFC, 0xDC, 0xC2, 0x52, 0x33, 0xA1, 0x26, 0x32, 
+    0x62, 0x32, 0x23, 0xE0, 0x21, 0x10, 0x0E, 0x0F, 0xF0, 0xEE, 0x00, 0xE0, 0xE0, 0x13, 0x21, 0xE0, 
+    0x0E, 0xCE, 0xE0, 0xDC, 0x05, 0xDC, 0xCC, 0xDD, 0x42, 0xFC, 0x15, 0x42, 0x13, 0xF5, 0x23, 0x23, 
+    0x11, 0xF0, 0x12, 0x23, 0x12, 0x21, 0xE0, 0xA1, 0x02, 0xFE, 0xE0, 0xAF, 0x10, 0xEF, 0x1E, 0x0E, 
+    0xF2, 0x13, 0x0C, 0xC1, 0x1E, 0xE0, 0xFC, 0x03, 0x02, 0xDD, 0xD0, 0xFC, 0x17, 0x10, 0xF1, 0xCD, 
+    0xC2, 0x72, 0x22, 0x10, 0x0F, 0x01, 0x10, 0xB2, 0x2C, 0x0E, 0xF2, 0x11, 0x21, 0xFE, 0xFF, 0xEF, 
+    0xEE, 0x10, 0xFF, 0xF2, 0x23, 0xCC, 0x01, 0x11, 0xFF, 0x00, 0xFF, 0x1F, 0x00, 0xFC, 0xDC, 0xD0, 
+    0xFC, 0x19, 0x08, 0xFC, 0x02, 0x85, 0x21, 0xF0, 0xB0, 0x10, 0x10, 0xF3, 0x23, 0xF0, 0xEF, 0x12, 
+    0x22, 0x12, 0x00, 0xAE, 0x16, 0xFE, 0xFF, 0xEF, 0x0F, 0x21, 0xCE, 0x01, 0x01, 0xF1, 0x32, 0x22, 
+    0x30, 0xB1, 0x63, 0x18, 0xCF, 0x48, 0x52, 0x2F, 0xFF, 0x00, 0xE0, 0xE0, 0x01, 0x32, 0x0E, 0xCC, 
+    0xE0, 0xA2, 0x22, 0x30, 0xFE, 0xEC, 0xF0, 0xEF, 0x00, 0x12, 0x11, 0xCC, 0x0F, 0x01, 0xEF, 0x23, 
+    0x1F, 0x00, 0xFF, 0xEF, 0xF0, 0xFC, 0x02, 0x00, 0xD0, 0xFC, 0x10, 0x13, 0x25, 0x52, 0x11, 0x0F, 
+    0xFF, 0x00, 0x0E, 0x0E, 0x3F, 0xEE, 0xAC, 0x1E, 0x0F, 0x22, 0xF0, 0xF0, 0xEE, 0xE1, 0xF0, 0x11, 
+    0xF2, 0x1E, 0xCE, 0x00, 0x30, 0xEE, 0x1F, 0x00, 0xAE, 0x02, 0x12, 0xD0, 0xFC, 0x0B, 0x01, 0xDD, 
+    0xFC, 0x07, 0x09, 0x37, 0x52, 0x31, 0xFF, 0x00, 0xDE, 0x08, 0x1F, 0xCC, 0x0C, 0xCC, 0x00, 0xEF, 
+    0x14, 0xEF, 0x1F, 0x10, 0xFF, 0x0E, 0xE0, 0x01, 0x33, 0xCE, 0xFF, 0xE0, 0xAC, 0x08, 0xE3, 0xFC, 
+    0xDC, 0xCD, 0xD0, 0xDC, 0x04, 0xDC, 0xCC, 0xD0, 0x50, 0x07, 0xD0, 0x27, 0x52, 0x1F, 0xBE, 0x00, 
+    0x00, 0xBE, 0x02, 0x0F, 0xE0, 0xCC, 0x03, 0x0F, 0x0E, 0xBF, 0xAE, 0x16, 0xCC, 0xEC, 0xEE, 0xE0, 
+    0x11, 0x90, 0xCF, 0x1E, 0xCC, 0xDC, 0xC0, 0x10, 0x44, 0x03, 0xDD, 0xCC, 0xBD, 0x42, 0x00, 0xD0, 
+    0x4E, 0x03, 0xCC, 0x65, 0x44, 0x0B, 0x0F, 0xFE, 0xCC, 0xCE, 0xE1, 0xE0, 0xDC, 0x01, 0xE0, 0xAE, 
+    0x02, 0xFF, 0xF0, 0x43, 0x04, 0xCC, 0xCE, 0x00, 0x42, 0x04, 0x1C, 0xE1, 0x00, 0xBC, 0x01, 0xEF, 
+    0x43, 0x01, 0xCD, 0xAC, 0x01, 0xDD, 0xAC, 0x02, 0xDD, 0xC0, 0x4F, 0x0A, 0xD6, 0x44, 0x21, 0x0E, 
+    0x0F, 0x00, 0xAC, 0x06, 0xEE, 0xE3, 0x0F, 0xE0, 0xAC, 0x02, 0xFC, 0xC0, 0xDE, 0x02, 0xFF, 0xE0, 
+    0xBC, 0x10, 0xEE, 0x00, 0xF1, 0x33, 0xCC, 0x0F, 0xCD, 0xCC, 0xD0, 0xEC, 0x02, 0xDC, 0xD0, 0x42, 
+    0x01, 0xDC, 0xAD, 0x01, 0xCD, 0xFC, 0x07, 0x15, 0xF2, 0x22, 0x30, 0x0F, 0xFE, 0x00, 0xCE, 0xFE, 
+    0x0E, 0x11, 0xE0, 0xFC, 0x01, 0x05, 0xEC, 0xCC, 0xEE, 0xDC, 0x42, 0x06, 0x03, 0x90, 0xCC, 0xF0, 
+    0xDD, 0x02, 0xCD, 0xD0, 0x42, 0xAD, 0x05, 0xCD, 0xDD, 0xCC, 0x54, 0x07, 0x32, 0x1F, 0x0F, 0xFC, 
+    0x43, 0x07, 0x10, 0xE0, 0x1E, 0xF0, 0xEC, 0x00, 0xE0, 0x42, 0xFC, 0x00, 0x0A, 0xEE, 0xE0, 0x03, 
+    0x41, 0xCD, 0xC0, 0xCD, 0x05, 0xCD, 0xCC, 0xDC, 0xDD, 0x01, 0xCC, 0x45, 0x00, 0xD0, 0x4E, 0x1B, 
+    0x31, 0x31, 0x00, 0x0E, 0xCC, 0x0E, 0x0E, 0xF0, 0x0E, 0x30, 0xE0, 0xEE, 0xFE, 0xCC, 0xBE, 0x4C, 
+    0x07, 0xF1, 0x33, 0x3C, 0xDD, 0xAC, 0x01, 0xDD, 0xCC, 0xED, 0xAC, 0xBD, 0xFC, 0x06, 0x04, 0xD1, 
+    0x11, 0xF0, 0x46, 0x17, 0xFF, 0x03, 0x0E, 0xF1, 0xC0, 0xFE, 0xCC, 0xEE, 0x0E, 0xE0, 0xF0, 0xEE, 
+    0x48, 0x03, 0x0F, 0x12, 0x46, 0x00, 0xD0, 0x44, 0xFD, 0x01, 0x47, 0x00, 0xD0, 0xFC, 0x02, 0xAD, 
+    0x03, 0x0F, 0xFF, 0xAE, 0x19, 0xCC, 0xCE, 0xF0, 0x02, 0x3E, 0xE1, 0x0E, 0x0F, 0x0E, 0x00, 0xFE, 
+    0x0F, 0x00, 0xCE, 0x00, 0x00, 0x45, 0x04, 0x32, 0x31, 0xC0, 0xAD, 0x42, 0x02, 0xDC, 0xD0, 0x4A, 
+    0xFD, 0x00, 0x4C, 0x04, 0xCF, 0xFF, 0x00, 0x44, 0x0B, 0x01, 0x1E, 0x34, 0x20, 0x00, 0x3F, 0xF0, 
+    0x00, 0x01, 0x1F, 0xCE, 0x02, 0x01, 0xE0, 0x44, 0x03, 0x22, 0x1F, 0xFD, 0x02, 0x00, 0xC0, 0xFD, 
+    0x01, 0x00, 0xC0, 0x46, 0xDC, 0x01, 0xDD, 0x44, 0x02, 0xCF, 0x20, 0xA0, 0x01, 0xEC, 0x42, 0x2F, 
+    0x23, 0xEF, 0x23, 0xF1, 0x00, 0x11, 0x1F, 0x11, 0x00, 0xF0, 0xFF, 0x0F, 0x0E, 0xE0, 0x13, 0x0C, 
+    0xCC, 0x00, 0xF3, 0x1F, 0xFC, 0xFF, 0xDD, 0xDC, 0xFD, 0x03, 0x07, 0xCD, 0xDC, 0xDD, 0xDC, 0xBD, 
+    0x4B, 0x15, 0xCC, 0x02, 0xFF, 0x00, 0xEE, 0xEC, 0xCE, 0x21, 0xF0, 0x23, 0x03, 0xA1, 0x02, 0x33, 
+    0x30, 0xB1, 0x16, 0x31, 0xFF, 0x0E, 0x01, 0x13, 0x1C, 0xCC, 0xE0, 0xF1, 0x1F, 0xFE, 0x10, 0x42, 
+    0xFD, 0x0B, 0x44, 0x00, 0xD0, 0x45, 0xAD, 0x01, 0xCF, 0xA2, 0x0F, 0xF0, 0x00, 0xEC, 0xCC, 0xF3, 
+    0xF0, 0xE2, 0x10, 0xE1, 0x08, 0x31, 0x12, 0x11, 0x1F, 0x00, 0x43, 0x0D, 0x11, 0xCC, 0xF0, 0xFF, 
+    0x10, 0xF0, 0x00, 0xDD, 0x00, 0xC0, 0xDD, 0x01, 0xCC, 0xFD, 0x05, 0x02, 0xCC, 0xC0, 0xDD, 0x0A, 
+    0xC2, 0x45, 0x62, 0x20, 0x20, 0xF0, 0x42, 0x05, 0x0F, 0xEE, 0xF3, 0xB1, 0xA2, 0x07, 0x32, 0x23, 
+    0x11, 0x1F, 0xB0, 0x0E, 0x11, 0x31, 0xCC, 0xEF, 0x11, 0x00, 0x10, 0x00, 0xFD, 0x16, 0x01, 0xCC, 
+    0xFD, 0x00, 0x19, 0xCF, 0x12, 0x21, 0x3F, 0x20, 0xFF, 0x0C, 0xCF, 0xFE, 0xFF, 0x11, 0x01, 0x33, 
+    0xA2, 0x0B, 0x13, 0x22, 0x3F, 0xFF, 0x00, 0xFF, 0xA1, 0x0E, 0x0C, 0xEF, 0xF2, 0x01, 0x01, 0x0C, 
+    0x0D, 0x00, 0x65, 0x15, 0xDC, 0xF1, 0x1E, 0xF0, 0x0E, 0xFF, 0xEC, 0xCF, 0x0E, 0xF1, 0xF0, 0xA1, 
+    0x0A, 0x31, 0x32, 0x11, 0x33, 0x2F, 0x00, 0x43, 0x0A, 0xF1, 0x00, 0xEF, 0x01, 0x32, 0x10, 0xA2, 
+    0x02, 0x1C, 0x00, 0x5B, 0xFD, 0x04, 0x14, 0xF1, 0x1F, 0xF0, 0xCF, 0xFE, 0xCC, 0xCE, 0xEE, 0xFE, 
+    0xE1, 0x20, 0xB1, 0x01, 0x22, 0xB1, 0x18, 0xF0, 0x00, 0xFF, 0x0F, 0x0E, 0xEF, 0xFF, 0x00, 0x10, 
+    0x11, 0x02, 0x23, 0xD0, 0x45, 0xEC, 0x02, 0xDD, 0xC0, 0xFD, 0x10, 0x07, 0xFF, 0xF0, 0x0E, 0xFE, 
+    0xAC, 0x2B, 0xEE, 0xE0, 0x00, 0x22, 0x2F, 0x11, 0x32, 0x22, 0x1F, 0xFF, 0x00, 0x0F, 0xF0, 0xF0, 
+    0xEE, 0xE0, 0xCF, 0xE0, 0xEF, 0xFE, 0xF0, 0x1F, 0x42, 0x0B, 0x0D, 0xCD, 0x03, 0x01, 0xFF, 0x1F, 
+    0xFD, 0x12, 0x09, 0xC2, 0x1E, 0x0E, 0xEE, 0x11, 0x45, 0x16, 0xF3, 0x24, 0x21, 0x13, 0x22, 0x13, 
+    0x21, 0x1F, 0xF0, 0xFF, 0x00, 0xF0, 0xBE, 0x00, 0xC0, 0xAE, 0x00, 0x00, 0x42, 0x0A, 0xFF, 0x0D, 
+    0xDD, 0xCD, 0x02, 0x20, 0xC1, 0x01, 0xFC, 0x5B, 0x07, 0xF0, 0xEC, 0xEE, 0xF0, 0x43, 0x01, 0xEF, 
+    0xA2, 0x0A, 0x32, 0x23, 0x10, 0x13, 0x23, 0x10, 0x43, 0xAE, 0x04, 0x0F, 0x0C, 0xC0, 0x42, 0x01, 
+    0xEE, 0xBF, 0xA0, 0x0B, 0x33, 0xFE, 0x00, 0xEF, 0xF1, 0x1F, 0xFD, 0x11, 0x05, 0xF2, 0x1F, 0xC0, 
+    0xAC, 0x45, 0x05, 0x02, 0x22, 0x11, 0x42, 0x09, 0xF1, 0x32, 0x21, 0x10, 0xFF, 0xAE, 0x18, 0x0F, 
+    0xF1, 0x0E, 0x00, 0xF1, 0xF0, 0xE0, 0x00, 0xF0, 0x0F, 0x2F, 0xCD, 0x00, 0xAD, 0x04, 0x0F, 0x11, 
+    0xC0, 0xFD, 0x0E, 0x3F, 0x0D, 0x01, 0xFC, 0xCF, 0xCC, 0x0C, 0xCC, 0xEF, 0x0E, 0xEF, 0x32, 0x3F, 
+    0x12, 0x32, 0x10, 0x12, 0x33, 0x1F, 0x00, 0x0E, 0xEE, 0xF1, 0x1F, 0x11, 0xFE, 0xCE, 0xF1, 0xF1, 
+    0xF0, 0x00, 0xFE, 0xEC, 0x04, 0xC0, 0xDD, 0x00, 0xAD, 0x03, 0xF0, 0x1F, 0x56, 0x04, 0xC2, 0x1E, 
+    0xE0, 0x46, 0x01, 0x00, 0x42, 0x10, 0x11, 0x10, 0xF1, 0x13, 0x11, 0x33, 0x11, 0x00, 0x00, 0xBE, 
+    0x0B, 0x01, 0x11, 0xF1, 0x0E, 0x0E, 0xEF, 0x44, 0xD0, 0xCD, 0x02, 0xF0, 0xF0, 0x55, 0x06, 0x0D, 
+    0xF2, 0x1E, 0xC0, 0x46, 0x0F, 0xF1, 0xFE, 0xE0, 0x13, 0x1E, 0xFF, 0x11, 0x1F, 0xA1, 0x00, 0xF0, 
+    0x45, 0xA1, 0x09, 0xF1, 0xE0, 0x0C, 0xE0, 0xEC, 0xB0, 0x04, 0xDF, 0xFF, 0xE0, 0x45, 0x04, 0x01, 
+    0xFF, 0x00, 0x54, 0x02, 0xC0, 0x20, 0xA0, 0x45, 0x0F, 0x01, 0xF0, 0xEE, 0xF1, 0x0E, 0x00, 0xFF, 
+    0x00, 0xAF, 0x01, 0x00, 0xBE, 0x0C, 0x0F, 0x31, 0x31, 0xF0, 0x0E, 0xCE, 0xE0, 0xC0, 0x08, 0xDF, 
+    0x21, 0xEF, 0xEE, 0xC0, 0x43, 0x00, 0x30, 0x4A, 0x01, 0x00, 0xED, 0x12, 0x00, 0x0D, 0xF3, 0xE0, 
+    0xF0, 0xFC, 0x00, 0xCC, 0xE0, 0xF0, 0x42, 0x07, 0xE1, 0xFE, 0xEE, 0x0F, 0xB0, 0xFE, 0x00, 0x0C, 
+    0xF1, 0x13, 0x1E, 0x00, 0xCC, 0xED, 0xF0, 0xB0, 0x11, 0xC2, 0x1C, 0x00, 0x0D, 0xCC, 0xCD, 0xD0, 
+    0x20, 0xFC, 0x49, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x43, 0x07, 0x0C, 0x33, 0x0F, 0x00, 0x43, 0x01, 
+    0x0F, 0x44, 0xDE, 0x02, 0x0E, 0x00, 0xDE, 0x00, 0xC0, 0xAE, 0x07, 0xF1, 0xF0, 0x10, 0xEC, 0xF0, 
+    0x00, 0x02, 0xF2, 0xE0, 0xB0, 0x08, 0xDD, 0xD0, 0xCF, 0x2F, 0x00, 0xFD, 0x01, 0xA0, 0xAD, 0xF0, 
+    0x00, 0x03, 0xFD, 0x0F, 0x43, 0x08, 0xEF, 0xF0, 0x0E, 0xEC, 0xC0, 0xFE, 0x0C, 0x07, 0xFF, 0xE1, 
+    0x30, 0xEF, 0xC0, 0x14, 0xFF, 0xD0, 0x1D, 0x00, 0x0C, 0xCF, 0xFF, 0x0C, 0x22, 0x0E, 0x00, 0xED, 
+    0xF0, 0x08, 0x07, 0xD0, 0xD0, 0xF0, 0x0C, 0x44, 0xAE, 0x01, 0xCC, 0xFE, 0x04, 0x01, 0xCC, 0xCE, 
+    0x05, 0xFE, 0x00, 0xEC, 0xA2, 0x00, 0xF0, 0xA0, 0x06, 0xD0, 0x10, 0x00, 0xC0, 0xA2, 0x06, 0x1F, 
+    0xF2, 0x1E, 0xD0, 0x44, 0x03, 0x0D, 0xFF, 0xF0, 0x09, 0x01, 0xDF, 0x46, 0x03, 0x01, 0xFE, 0xDC, 
+    0xDE, 0xCC, 0xAE, 0x01, 0x10, 0xAE, 0x05, 0xCE, 0x13, 0x21, 0xC0, 0x0F, 0xFF, 0x0D, 0x24, 0x20, 
+    0x0E, 0xEF, 0xF0, 0xE0, 0xCD, 0x02, 0x0D, 0xF0, 0xF0, 0x0A, 0x02, 0xDF, 0x00, 0x43, 0x01, 0x00, 
+    0x44, 0x05, 0xEE, 0xEC, 0x0C, 0xBE, 0xFC, 0x00, 0x1C, 0xEE, 0x00, 0xEE, 0xF1, 0xCC, 0xE0, 0xF1, 
+    0x10, 0xFF, 0x0F, 0xFF, 0xC2, 0x21, 0x00, 0xE0, 0x42, 0x04, 0xEE, 0x00, 0x00, 0x58, 0x11, 0x0F, 
+    0xC0, 0x0C, 0x0C, 0xF0, 0x0F, 0xF0, 0xEC, 0xEE, 0xEC, 0x48, 0x19, 0xFE, 0x0E, 0xE0, 0x11, 0x0E, 
+    0xEE, 0x0F, 0x1F, 0x00, 0xCC, 0xFF, 0x02, 0xFF, 0xAE, 0x00, 0xF0, 0xAE, 0xAD, 0xA0, 0x57, 0x00, 
+    0xC0, 0x43, 0x05, 0xEE, 0x0E, 0xCE, 0xFC, 0x05, 0x0F, 0xEE, 0xEC, 0xCC, 0x00, 0x0E, 0x01, 0x1F, 
+    0x10, 0xAE, 0x03, 0xF1, 0xFF, 0xB2, 0x04, 0xFF, 0xEE, 0xC0, 0xAE, 0x01, 0x10, 0x43, 0x06, 0xD0, 
+    0x0D, 0xFF, 0xD0, 0x55, 0x02, 0xDF, 0xC0, 0xEE, 0xFC, 0x04, 0xBE, 0x0A, 0xCC, 0xCE, 0xEE, 0x0E, 
+    0xE0, 0x10, 0xBE, 0x0C, 0xF1, 0x13, 0x42, 0x1F, 0xFF, 0xEE, 0xC0, 0xAE, 0x03, 0x12, 0xEE, 0xBF, 
+    0x05, 0x0F, 0xFF, 0x00, 
+};
+
+const gfx_image_t STORY_CH3_ENEMY_IMG = {
+    .w = STORY_CH3_ENEMY_W, .h = STORY_CH3_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH3_ENEMY_PAL, .colors = STORY_CH3_ENEMY_PAL_SIZE,
+    .data = STORY_CH3_ENEMY_RLE, .size = STORY_CH3_ENEMY_RLE_SIZE,
 };
@@ -6,289 +6,169 @@ const uint16_t STORY_CH4_PAL[STORY_CH4_PAL_SIZE] = {
     0x942E, 0x5CF3, 0xE0F4, 0xF10B, 0xCAEB, 0x994A, 0xA8F2, 0x2CB2, 
 };
 
-const uint8_t STORY_CH4_IDX[(STORY_CH4_W * STORY_CH4_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0x05, 0x71, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x75, 0x51, 0x11, 0x11, 
-    0x17, 0x11, 0x11, 0x11, 0x11, 0x23, 0x31, 0x11, 0x00, 0x00, 0x00, 0x20, 0x33, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x18, 0x71, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x32, 0x31, 0x10, 0x00, 0x00, 0x02, 0x22, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x78, 0x11, 0x11, 0x71, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x32, 0x10, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x57, 0x75, 0x01, 0x01, 0x11, 
-    0x17, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x32, 0x00, 0x00, 0x00, 0x22, 0x30, 0x00, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x57, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x10, 0x00, 0x00, 0x00, 0x23, 0x30, 0x30, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x03, 0x33, 0x00, 0x00, 0x20, 
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x07, 0x71, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x00, 0x00, 0x00, 0x21, 0x00, 0x10, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x02, 0x23, 0x32, 0x23, 0x33, 
-    0x20, 0x07, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x71, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x32, 0x31, 0x00, 0x00, 0x00, 0x23, 0x03, 0x30, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x02, 0x22, 0x23, 0x11, 
-    0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x71, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x31, 0x12, 0x31, 0x00, 0x00, 0x00, 0x22, 0x21, 0x30, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x20, 0x02, 0x22, 0x22, 0x00, 0x00, 0x22, 0x20, 0x22, 0x11, 
-    0x30, 0x75, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x50, 0x71, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x13, 0x21, 0x00, 0x00, 0x00, 0x22, 0x10, 0x30, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x22, 0x20, 0x00, 0x23, 0x20, 0x02, 0x32, 
-    0x20, 0x15, 0x55, 0x55, 0x57, 0x05, 0x55, 0x55, 0x57, 0x88, 0x88, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x12, 0x00, 0x00, 0x02, 0x22, 0x31, 0x10, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x22, 0x22, 0x22, 0x33, 0x20, 0x03, 0x30, 
-    0x00, 0x01, 0x55, 0x55, 0x01, 0x70, 0x00, 0x77, 0x88, 0x88, 0x87, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x02, 0x11, 0x01, 0x30, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x33, 0x32, 0x02, 0x32, 
-    0x00, 0x00, 0x70, 0x07, 0x71, 0x77, 0x77, 0x88, 0x88, 0x87, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x20, 0x00, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x02, 0x32, 0x22, 0x22, 0x23, 0x33, 0x32, 0x22, 0x22, 
-    0x20, 0x20, 0x10, 0x77, 0x11, 0x17, 0x88, 0x77, 0x77, 0x78, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x00, 0x00, 0x02, 0x23, 0x20, 0x00, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x20, 0x00, 0x00, 0x20, 0x00, 0x20, 0x02, 0x33, 0x22, 0x02, 0x23, 0x33, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x08, 0x71, 0x11, 0x88, 0x77, 0x77, 0x77, 0x70, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x22, 0x20, 0x10, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x20, 0x00, 0x00, 0x20, 0x00, 0x22, 0x23, 0x13, 0x22, 0x22, 0x23, 0x33, 0x22, 0x23, 0x22, 
-    0x00, 0x00, 0x01, 0x81, 0x11, 0x77, 0x77, 0x77, 0x77, 0x78, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x21, 0x10, 0x30, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x11, 0x32, 0x22, 0x23, 0x33, 0x22, 0x22, 0x22, 
-    0x02, 0x20, 0x38, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x20, 0x00, 0x21, 0x11, 0x10, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x33, 0x32, 0x33, 0x33, 0x33, 0x23, 0x22, 
-    0x02, 0x30, 0x17, 0x11, 0x11, 0x87, 0x77, 0x07, 0x18, 0x78, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x20, 0x00, 0x01, 0x11, 0x10, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x33, 0x33, 0x31, 0x13, 0x33, 0x23, 0x22, 
-    0x22, 0x22, 0x11, 0x11, 0x11, 0x87, 0x70, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x20, 0x02, 0x02, 0x11, 0x10, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x13, 0x31, 0x11, 0x13, 0x33, 0x33, 0x22, 
-    0x23, 0x11, 0x11, 0x11, 0x17, 0x77, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x20, 0x00, 0x22, 0x11, 0x10, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x13, 0x33, 
-    0x31, 0x11, 0x11, 0x11, 0x17, 0x87, 0x00, 0x77, 0x87, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x22, 0x00, 0x21, 0x11, 0x10, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x00, 0x07, 0x11, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x21, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x77, 0x70, 0x07, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 0x13, 0x20, 0x21, 0x11, 0x10, 0x02, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x20, 0x22, 0x00, 0x00, 0x23, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x18, 0x41, 0x11, 0x17, 0x77, 0x00, 0x71, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x20, 0x21, 0x31, 0x10, 0x02, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x32, 0x20, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x18, 0x41, 0x11, 0x14, 0x87, 0x00, 0x41, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x21, 0x30, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x33, 0x20, 0x02, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 
-    0x11, 0x17, 0x14, 0x11, 0x14, 0x87, 0x77, 0x41, 0x74, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x12, 0x22, 0x03, 0x23, 0x10, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x00, 0x23, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x22, 0x22, 0x11, 
-    0x11, 0x44, 0x11, 0x14, 0x48, 0x77, 0x77, 0x41, 0x80, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x20, 0x13, 0x11, 0x31, 0x12, 0x10, 0x02, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x02, 0x00, 0x00, 0xD0, 0x20, 0x00, 0x00, 0xD2, 0x00, 0x0D, 
-    0xDD, 0xDD, 0x10, 0x20, 0x2E, 0xD4, 0x11, 0x4D, 0x41, 0x11, 0x20, 0xDD, 0xDD, 0x12, 0x12, 0xDD, 
-    0x47, 0x84, 0x0C, 0x41, 0x44, 0x77, 0x84, 0x44, 0x0C, 0x44, 0x44, 0x11, 0x11, 0x11, 0x04, 0x44, 
-    0x41, 0x11, 0x11, 0x10, 0x44, 0x41, 0x11, 0x11, 0xDD, 0xDD, 0xD4, 0x12, 0x12, 0x32, 0x32, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x66, 0x67, 0x00, 0x00, 0xA6, 0x90, 0x00, 0x0E, 0xBC, 0xF0, 0xEB, 
-    0x66, 0x66, 0x80, 0x22, 0x1A, 0x67, 0x91, 0xEB, 0x69, 0x12, 0x0E, 0xB6, 0x6C, 0xF2, 0x22, 0xA6, 
-    0xC0, 0x40, 0xA6, 0x90, 0x41, 0x88, 0x44, 0x40, 0xA6, 0x66, 0x66, 0x90, 0x41, 0x11, 0xEB, 0x66, 
-    0xCF, 0x11, 0x11, 0x1A, 0x66, 0x69, 0xF1, 0x11, 0xA6, 0x66, 0x66, 0xF0, 0x22, 0x21, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xDD, 0x40, 0xD0, 0xD2, 0x00, 0xA6, 0x4D, 0x00, 0xDB, 0x6C, 0xF0, 0xEB, 
-    0x04, 0x04, 0x04, 0x13, 0x0A, 0x67, 0x01, 0xEB, 0x69, 0x00, 0xDB, 0x44, 0x40, 0x44, 0x12, 0xA6, 
-    0x49, 0x40, 0xA6, 0x90, 0x44, 0x44, 0x44, 0x40, 0xA6, 0xC4, 0x44, 0x04, 0x91, 0x0A, 0xB4, 0x44, 
-    0x04, 0x49, 0x10, 0xBC, 0x44, 0x40, 0x41, 0x11, 0xA6, 0x44, 0x44, 0x0D, 0x02, 0x31, 0x11, 0x20, 
-    0x00, 0x00, 0x00, 0x0E, 0x6C, 0x00, 0x0A, 0x69, 0x00, 0xA6, 0x66, 0x90, 0xB6, 0x6C, 0x00, 0xEB, 
-    0xCF, 0x00, 0xA6, 0x70, 0x2A, 0x67, 0x02, 0xDB, 0x69, 0x00, 0xA6, 0xF0, 0x3A, 0x64, 0x90, 0xA6, 
-    0xCF, 0x47, 0xA6, 0x99, 0x44, 0x44, 0x41, 0x11, 0xA6, 0x79, 0x10, 0xB6, 0x91, 0x0B, 0x60, 0x71, 
-    0xA6, 0x49, 0x1A, 0x64, 0xF3, 0x0A, 0x69, 0x14, 0xA6, 0x90, 0x3E, 0xBC, 0xF2, 0x23, 0x13, 0x32, 
-    0x00, 0x00, 0x00, 0x0E, 0x6C, 0x00, 0x0A, 0x69, 0x00, 0xA6, 0x41, 0x0B, 0x14, 0x6C, 0xF0, 0xEB, 
-    0xCF, 0x20, 0xA6, 0x90, 0x2A, 0x67, 0x02, 0xDB, 0x69, 0x1D, 0xB0, 0x92, 0x20, 0x47, 0x94, 0xA6, 
-    0xC9, 0x40, 0xA6, 0x91, 0x11, 0x33, 0x33, 0x30, 0xA6, 0x79, 0x40, 0xB0, 0x91, 0x0B, 0x69, 0x88, 
-    0xA6, 0x49, 0x4A, 0x64, 0xF1, 0x0A, 0x69, 0x10, 0xA6, 0x90, 0x3E, 0xBC, 0x94, 0x44, 0x44, 0x84, 
-    0x00, 0x00, 0x00, 0x0E, 0xB6, 0xB6, 0xBB, 0x69, 0x00, 0xA6, 0x90, 0xB0, 0xFE, 0xBC, 0xF2, 0xEB, 
-    0x6B, 0xB6, 0x41, 0x10, 0x0A, 0x67, 0x02, 0xDB, 0x69, 0x44, 0x4E, 0xB6, 0x6C, 0x04, 0x41, 0xAB, 
-    0x6B, 0xBB, 0xB6, 0x91, 0x31, 0x11, 0x13, 0x30, 0xA6, 0x6B, 0xB6, 0x99, 0x91, 0x0B, 0x69, 0x88, 
-    0xA6, 0x49, 0x4A, 0x66, 0xBB, 0xBB, 0x69, 0x00, 0xA6, 0x90, 0x3E, 0xBC, 0x93, 0x20, 0x23, 0x33, 
-    0x00, 0x00, 0x00, 0x0E, 0xB6, 0x60, 0x06, 0x69, 0x00, 0xA6, 0x90, 0x23, 0x0E, 0xBC, 0xF0, 0xEB, 
-    0x66, 0x06, 0x70, 0x22, 0x0A, 0x67, 0x00, 0x0B, 0x69, 0x22, 0x3E, 0xB0, 0x6C, 0x92, 0x23, 0xAB, 
-    0x66, 0x00, 0x66, 0x91, 0x11, 0x11, 0x13, 0x20, 0xA6, 0x66, 0x06, 0x94, 0x40, 0x0B, 0x69, 0x11, 
-    0xA6, 0x49, 0x1A, 0x66, 0x66, 0x06, 0x69, 0x01, 0xA6, 0x90, 0x3E, 0xBC, 0xF2, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0E, 0x6C, 0xF2, 0x0A, 0x69, 0x00, 0xA6, 0x90, 0x00, 0x0E, 0xBC, 0xF2, 0xEB, 
-    0xCF, 0x21, 0xA6, 0x70, 0x0A, 0x67, 0x00, 0x0B, 0x09, 0x22, 0xD0, 0x11, 0x1E, 0xB4, 0x02, 0xA6, 
-    0xC9, 0x31, 0xA6, 0x91, 0x11, 0x32, 0x13, 0x20, 0xA6, 0x79, 0x80, 0xB6, 0x90, 0x0B, 0x69, 0x11, 
-    0xA6, 0x49, 0x1A, 0x6C, 0xF1, 0x0A, 0x69, 0x10, 0xA6, 0x90, 0x0E, 0xBC, 0xF0, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x3E, 0x6C, 0xF2, 0x0A, 0x69, 0x00, 0xA6, 0x90, 0x20, 0x0E, 0xBC, 0xF2, 0xEB, 
-    0xCF, 0x20, 0xA6, 0x70, 0x0A, 0x67, 0x00, 0x0B, 0x6F, 0x00, 0xA6, 0xF0, 0x0E, 0x6C, 0xF0, 0xE6, 
-    0xCF, 0x20, 0xA6, 0x90, 0x22, 0x20, 0x23, 0x02, 0xA6, 0x79, 0x40, 0xB6, 0x91, 0x0B, 0x69, 0x11, 
-    0xA6, 0x49, 0x1A, 0x64, 0xF3, 0x1A, 0x69, 0x00, 0xA6, 0x90, 0x0E, 0xBC, 0xF0, 0x00, 0x00, 0x00, 
-    0x23, 0x20, 0x00, 0x0E, 0x6C, 0xF2, 0x0A, 0x69, 0x02, 0xA6, 0x90, 0x22, 0x0E, 0xBC, 0xF3, 0xEB, 
-    0x04, 0x0D, 0xB4, 0x10, 0x0D, 0x00, 0x40, 0xDC, 0x49, 0x20, 0xDC, 0x0D, 0xDB, 0x44, 0x00, 0xE6, 
-    0xC0, 0x20, 0xA6, 0x90, 0x20, 0x22, 0x22, 0x22, 0xA6, 0x79, 0x40, 0xB6, 0x98, 0x0C, 0xC7, 0x44, 
-    0xA4, 0x89, 0x1A, 0x64, 0xF2, 0x0A, 0x69, 0x02, 0xA6, 0x4D, 0xDB, 0x44, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x32, 0x22, 0x0E, 0x6C, 0xF2, 0x0A, 0x69, 0x02, 0xA6, 0x90, 0x22, 0x0E, 0xBC, 0xF2, 0xEB, 
-    0x66, 0x66, 0x80, 0x00, 0x00, 0x0A, 0x66, 0x69, 0x02, 0x22, 0x0E, 0xB6, 0x6C, 0xF0, 0x20, 0xE6, 
-    0xCF, 0x20, 0xA6, 0x90, 0x20, 0x00, 0x22, 0x22, 0xA6, 0x79, 0x80, 0xB6, 0x08, 0x80, 0x0B, 0x66, 
-    0xCF, 0x11, 0x1A, 0x6C, 0xF2, 0x0A, 0x69, 0x02, 0xA6, 0x66, 0x66, 0xF0, 0x00, 0x00, 0x03, 0x30, 
-    0x33, 0x33, 0x32, 0x00, 0x01, 0x02, 0x2D, 0x49, 0x32, 0xD0, 0x03, 0x22, 0x22, 0x04, 0x02, 0x20, 
-    0x04, 0x40, 0x10, 0x00, 0x00, 0x2D, 0x44, 0x41, 0x00, 0x00, 0x20, 0x44, 0x44, 0x02, 0x20, 0x00, 
-    0x10, 0x22, 0xD0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x40, 0x44, 0x94, 0x44, 0x04, 0x44, 
-    0x79, 0x44, 0x14, 0x01, 0x00, 0x0D, 0x01, 0x00, 0xD0, 0x44, 0x44, 0x00, 0x00, 0x33, 0x10, 0x00, 
-    0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x41, 0x22, 0x23, 0x32, 0x22, 0x33, 0x32, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x22, 0x31, 0x22, 0x02, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x48, 0x81, 0x84, 0x44, 0x44, 0x87, 
-    0x74, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 
-    0x33, 0x20, 0x00, 0x00, 0x22, 0x22, 0x33, 0x33, 0x33, 0x23, 0x11, 0x43, 0x31, 0x33, 0x43, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x02, 0x22, 0x12, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x11, 0x14, 0x44, 0x84, 0x84, 0x14, 0x44, 
-    0x41, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x33, 0x20, 0x31, 0x00, 
-    0x03, 0x23, 0x00, 0x00, 0x22, 0x22, 0x00, 0x02, 0x23, 0x22, 0x33, 0x14, 0x11, 0x32, 0x11, 0x33, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x22, 0x22, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x11, 0x44, 0x84, 0x11, 0x84, 
-    0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x00, 0x00, 0x00, 0x03, 0x32, 0x32, 0x00, 
-    0x03, 0x23, 0x00, 0x20, 0x02, 0x22, 0x20, 0x00, 0x23, 0x22, 0x32, 0x23, 0x33, 0x22, 0x33, 0x34, 
-    0x41, 0x20, 0x02, 0x20, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x22, 
-    0x21, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x03, 0x44, 0x44, 0x41, 0x41, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x11, 0x20, 0x00, 0x01, 0x33, 0x22, 0x20, 0x00, 
-    0x02, 0x22, 0x20, 0x30, 0x00, 0x02, 0x20, 0x00, 0x22, 0x21, 0x13, 0x20, 0x33, 0x23, 0x22, 0x23, 
-    0x33, 0x22, 0x04, 0x30, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x12, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x04, 0x44, 0x44, 0x41, 0x32, 
-    0x22, 0x20, 0x00, 0x02, 0x22, 0x00, 0x02, 0x22, 0x13, 0x20, 0x00, 0x34, 0x33, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x22, 0x02, 0x31, 0x12, 0x33, 0x13, 0x13, 0x22, 
-    0x22, 0x22, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x22, 0x41, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x24, 0x44, 0x44, 0x13, 0x32, 
-    0x22, 0x20, 0x00, 0x00, 0x22, 0x43, 0x22, 0x34, 0x41, 0x30, 0x00, 0x12, 0x23, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x22, 0x21, 0x20, 0x23, 0x13, 0x23, 0x13, 0x48, 0x13, 
-    0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x22, 0x22, 0x24, 0x84, 0x81, 0x23, 0x22, 
-    0x22, 0x00, 0x22, 0x00, 0x00, 0x14, 0x43, 0x23, 0x32, 0x33, 0x21, 0x13, 0x23, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x02, 0x00, 0x00, 0x31, 0x13, 0x20, 0x18, 0x34, 
-    0x41, 0x32, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x21, 0x48, 0x42, 0x22, 0x22, 
-    0x20, 0x22, 0x02, 0x22, 0x00, 0x00, 0x33, 0x22, 0x22, 0x13, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x00, 0x02, 0x22, 0x20, 0x02, 0x00, 0x00, 0x11, 0x11, 0x13, 0x32, 0x22, 
-    0x44, 0x32, 0x22, 0x14, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x21, 0x42, 0x22, 0x22, 
-    0x31, 0x20, 0x02, 0x22, 0x20, 0x00, 0x31, 0x12, 0x24, 0x41, 0x33, 0x32, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x23, 0x33, 0x22, 0x22, 0x20, 0x02, 0x22, 0x13, 0x11, 0x13, 0x11, 0x20, 0x02, 
-    0x33, 0x11, 0x32, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x22, 0x32, 0x22, 
-    0x22, 0x00, 0x22, 0x20, 0x20, 0x00, 0x02, 0x22, 0x38, 0x84, 0x13, 0x32, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x23, 0x32, 0x11, 0x13, 0x31, 0x44, 0x22, 0x20, 0x00, 
-    0x23, 0x44, 0x43, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x22, 
-    0x20, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x28, 0x81, 0x02, 0x23, 0x00, 0x00, 0x33, 0x20, 
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x33, 0x11, 0x44, 0x48, 0x48, 0x41, 0x22, 0x02, 
-    0x22, 0x33, 0x43, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x22, 
-    0x22, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x48, 0x12, 0x33, 0x32, 0x03, 0x41, 0x10, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x22, 0x22, 0x33, 0x22, 0x22, 0x23, 0x44, 0x88, 0x41, 0x11, 0x22, 0x22, 
-    0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0x10, 0x02, 0x02, 0x88, 0x13, 0x11, 0x20, 0x11, 0x13, 0x22, 0x11, 
-    0x00, 0x00, 0x22, 0x20, 0x00, 0x23, 0x33, 0x22, 0x33, 0x33, 0x14, 0x44, 0x11, 0x23, 0x32, 0x02, 
-    0x22, 0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x43, 0x23, 0x20, 0x33, 0x22, 0x33, 0x22, 0x13, 0x12, 0x02, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x21, 0x11, 0x14, 0x44, 0x11, 0x44, 0x41, 0x10, 
-    0x02, 0x22, 0x20, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x23, 0x32, 0x00, 
-    0x00, 0x00, 0x22, 0x00, 0x00, 0x21, 0x02, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x03, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x31, 0x32, 0x31, 0x11, 0x14, 0x11, 0x44, 0x31, 0x11, 
-    0x22, 0x23, 0x13, 0x22, 0x22, 0x02, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x02, 0x32, 0x20, 0x02, 
-    0x20, 0x22, 0x22, 0x00, 0x00, 0x02, 0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x21, 0x11, 0x32, 0x11, 0x11, 0x33, 0x11, 0x11, 0x32, 
-    0x22, 0x44, 0x13, 0x13, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x12, 0x22, 0x22, 
-    0x22, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x02, 0x22, 0x22, 0x23, 0x20, 
-    0x20, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x31, 0x11, 0x13, 0x31, 0x11, 0x12, 
-    0x02, 0x24, 0x43, 0x33, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x44, 0x22, 0x22, 
-    0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x20, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x32, 0x02, 0x31, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x42, 0x22, 0x12, 0x24, 0x44, 0x42, 0x44, 
-    0x44, 0x42, 0x22, 0x00, 0x02, 0x22, 0x00, 0x00, 0x22, 0x20, 0x02, 0x22, 0x20, 0x22, 0x22, 0x23, 
-    0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x33, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x22, 0x11, 0x13, 0x22, 0x31, 0x30, 0x21, 0x42, 0x02, 0x22, 0x44, 0x44, 0x84, 0x44, 
-    0x48, 0x00, 0x44, 0x23, 0x21, 0x44, 0x22, 0x22, 0x33, 0x31, 0x13, 0x11, 0x30, 0x22, 0x02, 0x22, 
-    0x33, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x32, 0x33, 0x31, 0x33, 0x13, 
-    0x31, 0x11, 0x32, 0x33, 0x31, 0x12, 0x23, 0x12, 0x34, 0x41, 0x02, 0x22, 0x21, 0x24, 0x44, 0x44, 
-    0x48, 0x00, 0x08, 0x88, 0x44, 0x31, 0x44, 0x44, 0x44, 0x14, 0x44, 0x88, 0x41, 0x32, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x23, 0x33, 0x31, 
-    0x11, 0x13, 0x33, 0x11, 0x11, 0x11, 0x22, 0x11, 0x34, 0x44, 0x12, 0x22, 0x02, 0x00, 0x13, 0x24, 
-    0x44, 0x88, 0x44, 0x44, 0x44, 0x21, 0x14, 0x44, 0x44, 0x14, 0x84, 0x48, 0x84, 0x82, 0x00, 0x00, 
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x12, 0x11, 0x21, 0x11, 0x41, 0x11, 0x32, 0x13, 0x21, 0x11, 
-    0x11, 0x48, 0x41, 0x31, 0x44, 0x21, 0x13, 0x31, 0x33, 0x21, 0x11, 0x18, 0x48, 0x41, 0x20, 0x31, 
-    0x30, 0x23, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x02, 0x00, 0x22, 0x22, 0x20, 0x00, 0x02, 0x22, 0x22, 
-    0x22, 0x33, 0x33, 0x32, 0x22, 0x22, 0x31, 0x12, 0x21, 0x32, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x31, 0x11, 0x14, 0x44, 0x13, 0x23, 0x32, 0x00, 0x23, 0x33, 0x33, 0x33, 0x32, 0x23, 0x31, 0x31, 
-    0x30, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x22, 0x20, 0x21, 0x32, 0x33, 0x13, 0x11, 0x11, 0x31, 0x11, 
-    0x11, 0x33, 0x12, 0x11, 0x22, 0x22, 0x20, 0x02, 0x23, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x22, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x02, 0x02, 0x32, 0x33, 0x22, 0x33, 0x11, 0x11, 0x33, 0x31, 
-    0x33, 0x23, 0x32, 0x20, 0x23, 0x32, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x00, 0x22, 0x22, 0x20, 0x00, 0x22, 0x20, 0x00, 0x00, 0x22, 0x32, 0x22, 0x32, 0x02, 
-    0x22, 0x23, 0x22, 0x00, 0x30, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x22, 0x20, 0x00, 0x22, 0x22, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x20, 0x00, 
-    0x00, 0x02, 0x02, 0x22, 0x30, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x23, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t STORY_CH4_RLE[STORY_CH4_RLE_SIZE] = {
+    0xF0, 0x3E, 0xF5, 0x08, 0x04, 0x77, 0x05, 0x70, 0xF1, 0x09, 0x00, 0x30, 0xE0, 0x01, 0x11, 0xF0, 
+    0x43, 0x00, 0x10, 0xF5, 0x08, 0x00, 0x00, 0xF1, 0x02, 0x00, 0x30, 0xF1, 0x02, 0xE0, 0x00, 0x30, 
+    0x77, 0x01, 0x22, 0xF0, 0x09, 0x00, 0x40, 0xF5, 0x06, 0x04, 0x01, 0x75, 0x50, 0xC1, 0x00, 0x70, 
+    0xE1, 0x02, 0x23, 0x30, 0x47, 0x04, 0x20, 0x33, 0x30, 0x7F, 0xF0, 0x02, 0xF5, 0x07, 0x05, 0x71, 
+    0x87, 0x13, 0xF1, 0x04, 0x04, 0x32, 0x31, 0x10, 0xC0, 0x04, 0x22, 0x20, 0x10, 0xF0, 0x2F, 0x02, 
+    0x22, 0x20, 0xF0, 0x07, 0x00, 0x10, 0xF5, 0x07, 0x01, 0x78, 0xA1, 0x00, 0x70, 0xF1, 0x06, 0x01, 
+    0x32, 0x48, 0x00, 0x20, 0xB0, 0x01, 0x22, 0x73, 0x00, 0x20, 0xF0, 0x06, 0x00, 0x70, 0xF5, 0x05, 
+    0x08, 0x00, 0x57, 0x75, 0x01, 0x00, 0xA1, 0x00, 0x70, 0xF1, 0x02, 0x02, 0x33, 0x20, 0xC0, 0x02, 
+    0x22, 0x30, 0x79, 0xA0, 0x00, 0x20, 0xF0, 0x03, 0xF5, 0x09, 0x02, 0x75, 0x70, 0xF1, 0x0A, 0x01, 
+    0x31, 0xD0, 0x04, 0x23, 0x30, 0x30, 0xA0, 0x76, 0x02, 0x33, 0x30, 0xA0, 0x00, 0x20, 0xB0, 0x00, 
+    0x10, 0xF5, 0x08, 0x02, 0x07, 0x70, 0xF1, 0x0A, 0xA3, 0x45, 0x03, 0x10, 0x01, 0x69, 0x00, 0x20, 
+    0x4E, 0x0C, 0x22, 0x33, 0x22, 0x33, 0x32, 0x00, 0x70, 0xF5, 0x09, 0x01, 0x01, 0x50, 0x05, 0x30, 
+    0x32, 0x31, 0x45, 0x03, 0x30, 0x33, 0x69, 0x01, 0x02, 0xF0, 0x00, 0x00, 0x20, 0x43, 0x01, 0x00, 
+    0xA2, 0x04, 0x31, 0x10, 0x10, 0xF5, 0x0D, 0x4F, 0x03, 0x03, 0x11, 0x48, 0x02, 0x22, 0x10, 0x6C, 
+    0x06, 0x20, 0x00, 0x20, 0x00, 0xB2, 0xA0, 0x0A, 0x22, 0x20, 0x22, 0x11, 0x30, 0x70, 0xD5, 0x00, 
+    0x00, 0xF5, 0x01, 0x01, 0x07, 0xF1, 0x08, 0x00, 0x00, 0xA1, 0x01, 0x32, 0x47, 0x01, 0x10, 0x42, 
+    0x00, 0x20, 0x66, 0xB0, 0x03, 0x20, 0x00, 0xB2, 0x42, 0x09, 0x32, 0x00, 0x23, 0x22, 0x01, 0xC5, 
+    0x00, 0x70, 0x45, 0x00, 0x70, 0xA8, 0xF1, 0x09, 0x00, 0x30, 0xC1, 0x00, 0x20, 0xB0, 0x05, 0x22, 
+    0x23, 0x11, 0x70, 0x00, 0x20, 0x45, 0x03, 0x22, 0x23, 0x42, 0x01, 0x33, 0xA0, 0x00, 0x10, 0xA5, 
+    0x07, 0x01, 0x70, 0x00, 0x77, 0xB8, 0x00, 0x70, 0xF1, 0x08, 0x00, 0x30, 0xD1, 0x45, 0x04, 0x11, 
+    0x01, 0x30, 0x72, 0xF2, 0x00, 0x07, 0x33, 0x32, 0x02, 0x32, 0xA0, 0x05, 0x70, 0x07, 0x71, 0xA7, 
+    0xB8, 0x01, 0x77, 0x50, 0xF1, 0x00, 0xC0, 0x02, 0x11, 0x20, 0xB0, 0x00, 0x20, 0xF0, 0x20, 0x00, 
+    0x20, 0x45, 0x00, 0x30, 0xC2, 0xA3, 0xC2, 0x0C, 0x02, 0x01, 0x07, 0x71, 0x11, 0x78, 0x80, 0xB7, 
+    0x01, 0x88, 0xF1, 0x0C, 0x00, 0x30, 0x48, 0x02, 0x22, 0x30, 0x67, 0x01, 0x22, 0x48, 0x07, 0x00, 
+    0x23, 0x32, 0x20, 0x43, 0xC2, 0xB0, 0x06, 0x87, 0x11, 0x18, 0x80, 0xD7, 0x00, 0x00, 0xF1, 0x14, 
+    0xB0, 0x04, 0x22, 0x20, 0x10, 0x70, 0x04, 0x22, 0x31, 0x30, 0xB2, 0x44, 0x00, 0x30, 0x45, 0x04, 
+    0x18, 0x11, 0x10, 0xF7, 0x00, 0x00, 0x80, 0xF1, 0x13, 0x00, 0x30, 0x44, 0x03, 0x11, 0x03, 0x42, 
+    0x00, 0x20, 0x60, 0xB0, 0x00, 0x20, 0xC0, 0x04, 0x31, 0x11, 0x30, 0x48, 0x08, 0x22, 0x20, 0x22, 
+    0x03, 0x80, 0xA1, 0xF7, 0x00, 0xF1, 0x14, 0x02, 0x00, 0x20, 0x44, 0x04, 0x11, 0x00, 0x20, 0x61, 
+    0xF0, 0x04, 0x43, 0x02, 0x33, 0x20, 0xC3, 0x01, 0x23, 0x42, 0x03, 0x30, 0x17, 0xA1, 0x09, 0x87, 
+    0x77, 0x07, 0x18, 0x78, 0x60, 0x00, 0x00, 0x74, 0x00, 0x20, 0xA1, 0xB3, 0x01, 0x11, 0x45, 0xA2, 
+    0xC1, 0x05, 0x87, 0x70, 0x07, 0xF1, 0x17, 0x07, 0x22, 0x20, 0x02, 0x02, 0x43, 0x01, 0x00, 0x6C, 
+    0x00, 0x30, 0xB1, 0x01, 0x33, 0xA1, 0xB3, 0x03, 0x22, 0x23, 0xD1, 0x02, 0x77, 0x70, 0xB0, 0xF1, 
+    0x16, 0x00, 0x00, 0x42, 0x01, 0x02, 0x45, 0x00, 0x20, 0xF0, 0x24, 0x00, 0x20, 0xF1, 0x03, 0x03, 
+    0x33, 0x31, 0xA3, 0xE1, 0x0A, 0x78, 0x70, 0x07, 0x78, 0x70, 0x70, 0x5D, 0x03, 0x20, 0x02, 0xA1, 
+    0x7C, 0x04, 0x11, 0x13, 0x30, 0xF1, 0x04, 0x07, 0x70, 0x00, 0x71, 0x17, 0xF1, 0x17, 0x00, 0x30, 
+    0x48, 0xF0, 0x17, 0x04, 0x20, 0x00, 0x20, 0xE0, 0x00, 0x20, 0xF1, 0x07, 0x4B, 0x07, 0x47, 0x77, 
+    0x00, 0x78, 0xF1, 0x14, 0x00, 0x40, 0x43, 0x00, 0x20, 0x46, 0x01, 0x22, 0xF0, 0x19, 0x04, 0x22, 
+    0x02, 0x20, 0xA0, 0x01, 0x23, 0xF1, 0x0E, 0x01, 0x84, 0xA1, 0x08, 0x77, 0x70, 0x07, 0x17, 0x70, 
+    0xF1, 0x18, 0x43, 0x00, 0x30, 0x68, 0x07, 0x23, 0x22, 0x00, 0x03, 0xF1, 0x0F, 0x44, 0x05, 0x48, 
+    0x70, 0x04, 0x62, 0xA2, 0x06, 0x12, 0x13, 0x02, 0x20, 0xF0, 0x18, 0xB2, 0x05, 0x33, 0x20, 0x02, 
+    0xF1, 0x06, 0xA2, 0xC1, 0x02, 0x71, 0x40, 0x44, 0x05, 0x77, 0x41, 0x74, 0xF1, 0x14, 0x00, 0x20, 
+    0x44, 0x08, 0x03, 0x23, 0x10, 0x00, 0x20, 0xF0, 0x1C, 0x05, 0x22, 0x00, 0x23, 0xF1, 0x02, 0x00, 
+    0x30, 0xA0, 0xA2, 0xA1, 0x07, 0x44, 0x11, 0x14, 0x48, 0xA7, 0x03, 0x41, 0x80, 0xF1, 0x14, 0x0E, 
+    0x32, 0x01, 0x31, 0x13, 0x11, 0x21, 0x00, 0x20, 0x4A, 0x03, 0xD0, 0x02, 0xA0, 0x02, 0xD0, 0x20, 
+    0xB0, 0x04, 0xD2, 0x00, 0x00, 0xBD, 0x11, 0x10, 0x20, 0x2E, 0xD4, 0x11, 0x4D, 0x41, 0x11, 0x20, 
+    0xAD, 0x17, 0x12, 0x12, 0xDD, 0x47, 0x84, 0x0C, 0x41, 0x44, 0x77, 0x84, 0x44, 0x0C, 0xA4, 0xC1, 
+    0x00, 0x00, 0xA4, 0xC1, 0x03, 0x04, 0x44, 0xB1, 0xBD, 0x08, 0x41, 0x21, 0x23, 0x23, 0x20, 0xF0, 
+    0x02, 0x04, 0xA6, 0x66, 0x70, 0xA0, 0x02, 0xA6, 0x90, 0xA0, 0x06, 0xEB, 0xCF, 0x0E, 0xB0, 0xA6, 
+    0x2C, 0x80, 0x22, 0x1A, 0x67, 0x91, 0xEB, 0x69, 0x12, 0x0E, 0xB6, 0x6C, 0xF2, 0x22, 0xA6, 0xC0, 
+    0x40, 0xA6, 0x90, 0x41, 0x88, 0x44, 0x40, 0xA0, 0xB6, 0x0B, 0x90, 0x41, 0x11, 0xEB, 0x66, 0xCF, 
+    0xB1, 0x09, 0xA6, 0x66, 0x9F, 0x11, 0x1A, 0xB6, 0x06, 0xF0, 0x22, 0x21, 0x10, 0xF0, 0x02, 0x07, 
+    0xDD, 0x40, 0xD0, 0xD2, 0x42, 0x06, 0x4D, 0x00, 0xDB, 0x60, 0x43, 0x0C, 0x04, 0x04, 0x04, 0x13, 
+    0x0A, 0x67, 0x00, 0x43, 0x0F, 0x00, 0xDB, 0x44, 0x40, 0x44, 0x12, 0xA6, 0x49, 0x45, 0xC4, 0x1D, 
+    0x0A, 0x6C, 0x44, 0x40, 0x49, 0x10, 0xAB, 0x44, 0x40, 0x44, 0x91, 0x0B, 0xC4, 0x44, 0x04, 0x43, 
+    0xA4, 0x08, 0x0D, 0x02, 0x31, 0x11, 0x20, 0xE0, 0x08, 0xE6, 0xC0, 0x00, 0xA6, 0x90, 0x42, 0x14, 
+    0x66, 0x90, 0xB6, 0x6C, 0x00, 0xEB, 0xCF, 0x00, 0xA6, 0x70, 0x20, 0x42, 0x01, 0x2D, 0x43, 0x13, 
+    0xA6, 0xF0, 0x3A, 0x64, 0x90, 0xA6, 0xCF, 0x47, 0xA6, 0x99, 0xB4, 0x32, 0x11, 0x1A, 0x67, 0x91, 
+    0x0B, 0x69, 0x10, 0xB6, 0x07, 0x1A, 0x64, 0x91, 0xA6, 0x4F, 0x30, 0xA6, 0x91, 0x4A, 0x69, 0x03, 
+    0xEB, 0xCF, 0x22, 0x31, 0x33, 0x20, 0x52, 0x08, 0x41, 0x0B, 0x14, 0x6C, 0xF0, 0x43, 0x04, 0x20, 
+    0xA6, 0x90, 0x49, 0x17, 0x1D, 0xB0, 0x92, 0x20, 0x47, 0x94, 0xA6, 0xC9, 0x40, 0xA6, 0x91, 0x11, 
+    0xB3, 0x00, 0x00, 0x42, 0x03, 0x40, 0xB0, 0x43, 0x02, 0x98, 0x80, 0x42, 0x00, 0x40, 0x42, 0x00, 
+    0x10, 0x43, 0x00, 0x00, 0x46, 0x00, 0x90, 0xB4, 0x01, 0x84, 0x46, 0x05, 0xB6, 0xB6, 0xBB, 0x44, 
+    0x14, 0x90, 0xB0, 0xFE, 0xBC, 0xF2, 0xEB, 0x6B, 0xB6, 0x41, 0x10, 0x00, 0x47, 0x0E, 0x44, 0x4E, 
+    0xB6, 0x6C, 0x04, 0x41, 0xAB, 0x60, 0xAB, 0x03, 0x69, 0x13, 0xA1, 0x43, 0x05, 0x6B, 0xB6, 0x99, 
+    0x4D, 0x00, 0x60, 0xAB, 0x02, 0x69, 0x00, 0x48, 0x06, 0x32, 0x02, 0x33, 0x30, 0x48, 0x03, 0x60, 
+    0x06, 0x46, 0x02, 0x23, 0x00, 0x42, 0x0A, 0x0E, 0xB6, 0x60, 0x67, 0x02, 0x20, 0x43, 0x19, 0x00, 
+    0xB6, 0x92, 0x23, 0xEB, 0x06, 0xC9, 0x22, 0x3A, 0xB6, 0x60, 0x06, 0x69, 0xC1, 0x01, 0x32, 0x42, 
+    0x06, 0x60, 0x69, 0x44, 0x00, 0x42, 0x01, 0x11, 0x42, 0x01, 0x1A, 0xA6, 0x05, 0x06, 0x69, 0x01, 
+    0x46, 0x01, 0xF2, 0xF0, 0x04, 0x06, 0xE6, 0xCF, 0x20, 0xA0, 0x46, 0x01, 0x00, 0x43, 0x0A, 0x2E, 
+    0xBC, 0xF2, 0x1A, 0x67, 0x00, 0x46, 0x14, 0x09, 0x22, 0xD0, 0x11, 0x1E, 0xB4, 0x02, 0xA6, 0xC9, 
+    0x31, 0xA0, 0x43, 0x01, 0x32, 0x44, 0x06, 0x79, 0x80, 0xB6, 0x90, 0x4C, 0x08, 0xCF, 0x10, 0xA6, 
+    0x91, 0x00, 0x42, 0x00, 0x00, 0x42, 0x02, 0x02, 0x20, 0xF0, 0x00, 0x01, 0x23, 0x4D, 0x00, 0x20, 
+    0x4A, 0x00, 0x00, 0x4A, 0x1F, 0x6F, 0x00, 0xA6, 0xF0, 0x0E, 0x6C, 0xF0, 0xE6, 0xCF, 0x20, 0xA6, 
+    0x90, 0x22, 0x20, 0x23, 0x02, 0x42, 0x00, 0x40, 0x42, 0x00, 0x10, 0x4B, 0x07, 0x4F, 0x31, 0xA6, 
+    0x90, 0x49, 0xC0, 0x02, 0x23, 0x20, 0xA0, 0x48, 0x00, 0x20, 0x43, 0x00, 0x20, 0x43, 0x1F, 0x3E, 
+    0xB0, 0x40, 0xDB, 0x41, 0x00, 0xD0, 0x04, 0x0D, 0xC4, 0x92, 0x0D, 0xC0, 0xDD, 0xB4, 0x40, 0x42, 
+    0x00, 0x00, 0x45, 0x00, 0x00, 0xC2, 0x47, 0x09, 0x80, 0xCC, 0x74, 0x4A, 0x48, 0x44, 0x01, 0x20, 
+    0x42, 0x08, 0x2A, 0x64, 0xDD, 0xB4, 0x40, 0xE0, 0x05, 0x31, 0x32, 0x22, 0x55, 0x02, 0x2E, 0xB0, 
+    0xA6, 0x00, 0x80, 0xC0, 0x11, 0xA6, 0x66, 0x90, 0x22, 0x20, 0xEB, 0x66, 0xCF, 0x02, 0x42, 0x00, 
+    0xF0, 0x46, 0x01, 0x00, 0x46, 0x13, 0x80, 0xB6, 0x08, 0x80, 0x0B, 0x66, 0xCF, 0x11, 0x1A, 0x6C, 
+    0x48, 0xA6, 0x00, 0xF0, 0xC0, 0x02, 0x33, 0x00, 0xB3, 0x10, 0x20, 0x00, 0x10, 0x22, 0xD4, 0x93, 
+    0x2D, 0x00, 0x30, 0xA2, 0x0A, 0x04, 0x02, 0x20, 0x04, 0x40, 0x10, 0xB0, 0x05, 0x2D, 0x44, 0x41, 
+    0xA0, 0x01, 0x20, 0xA4, 0x0C, 0x02, 0x20, 0x00, 0x10, 0x22, 0xD0, 0x10, 0xF0, 0x02, 0x1F, 0x99, 
+    0x40, 0x44, 0x94, 0x44, 0x04, 0x44, 0x79, 0x44, 0x14, 0x01, 0x00, 0x0D, 0x01, 0x00, 0xD0, 0xA4, 
+    0xA0, 0x08, 0x33, 0x10, 0x00, 0x33, 0x20, 0xF0, 0x01, 0x10, 0x33, 0x34, 0x12, 0x22, 0x33, 0x22, 
+    0x23, 0x33, 0x20, 0xF0, 0x05, 0x00, 0x20, 0xD0, 0x09, 0x22, 0x31, 0x22, 0x02, 0x22, 0xF0, 0x0B, 
+    0x06, 0x18, 0x48, 0x81, 0x80, 0xB4, 0x06, 0x87, 0x74, 0x41, 0x10, 0xF0, 0x00, 0x01, 0x22, 0xF0, 
+    0x00, 0x01, 0x14, 0xB0, 0x46, 0xA2, 0xC3, 0x0D, 0x23, 0x11, 0x43, 0x31, 0x33, 0x43, 0x22, 0xF0, 
+    0x02, 0xA2, 0xC0, 0x07, 0x22, 0x21, 0x20, 0x02, 0xD0, 0x01, 0x22, 0xF0, 0x01, 0x0C, 0x22, 0x11, 
+    0x14, 0x44, 0x84, 0x84, 0x10, 0xA4, 0x02, 0x11, 0x20, 0xF0, 0x01, 0x02, 0x22, 0x20, 0xD0, 0x0B, 
+    0x33, 0x20, 0x31, 0x00, 0x03, 0x23, 0x46, 0x14, 0x00, 0x02, 0x23, 0x22, 0x33, 0x14, 0x11, 0x32, 
+    0x11, 0x33, 0x20, 0x4B, 0xD0, 0xB2, 0x01, 0x00, 0xC2, 0xF0, 0x04, 0x01, 0x22, 0xA0, 0x03, 0x21, 
+    0x14, 0x42, 0x05, 0x18, 0x41, 0x22, 0x4B, 0x01, 0x32, 0xD0, 0x04, 0x33, 0x23, 0x20, 0x46, 0x02, 
+    0x20, 0x00, 0xA2, 0x02, 0x00, 0x00, 0x43, 0x11, 0x22, 0x33, 0x32, 0x23, 0x33, 0x44, 0x12, 0x00, 
+    0x22, 0x4C, 0x03, 0x00, 0x22, 0xA0, 0xA2, 0x04, 0x11, 0x22, 0x20, 0xF0, 0x03, 0x05, 0x22, 0x00, 
+    0x03, 0xB4, 0x05, 0x14, 0x12, 0x22, 0xF0, 0x02, 0x04, 0x22, 0x11, 0x20, 0xA0, 0x05, 0x13, 0x32, 
+    0x22, 0xA0, 0xA2, 0x01, 0x03, 0xA0, 0x44, 0x15, 0x22, 0x11, 0x32, 0x03, 0x32, 0x32, 0x22, 0x33, 
+    0x32, 0x20, 0x43, 0x44, 0xF0, 0x01, 0x00, 0x20, 0xD0, 0x09, 0x22, 0x21, 0x21, 0x11, 0x22, 0xD0, 
+    0xB2, 0x01, 0x00, 0xC4, 0x01, 0x13, 0xA2, 0xA0, 0x0A, 0x22, 0x20, 0x00, 0x22, 0x21, 0x30, 0x42, 
+    0x04, 0x34, 0x33, 0x20, 0xF0, 0x09, 0x10, 0x22, 0x02, 0x20, 0x23, 0x11, 0x23, 0x31, 0x31, 0x30, 
+    0xC2, 0x02, 0x01, 0x20, 0xF0, 0x0F, 0xD2, 0x03, 0x41, 0x22, 0x49, 0x01, 0x22, 0xB4, 0x01, 0x13, 
+    0x47, 0x13, 0x02, 0x24, 0x32, 0x23, 0x44, 0x13, 0x00, 0x01, 0x22, 0x33, 0xF0, 0x05, 0x16, 0x22, 
+    0x00, 0x02, 0x22, 0x12, 0x02, 0x31, 0x32, 0x31, 0x34, 0x81, 0x30, 0xD2, 0xF0, 0x06, 0x02, 0x22, 
+    0x20, 0xE0, 0xF2, 0x01, 0xC0, 0x45, 0x05, 0x84, 0x81, 0x23, 0xA2, 0x03, 0x00, 0x22, 0xA0, 0x10, 
+    0x14, 0x43, 0x23, 0x32, 0x33, 0x21, 0x13, 0x23, 0x20, 0xF0, 0x07, 0x06, 0x22, 0x20, 0x00, 0x20, 
+    0xA0, 0x0C, 0x31, 0x13, 0x20, 0x18, 0x34, 0x41, 0x30, 0xD2, 0x4D, 0x00, 0x20, 0xF0, 0x01, 0xC2, 
+    0xF0, 0x01, 0x06, 0x22, 0x21, 0x48, 0x40, 0xC2, 0x06, 0x02, 0x20, 0x22, 0x20, 0xA0, 0x01, 0x33, 
+    0xA2, 0x05, 0x13, 0x03, 0x33, 0xF0, 0x05, 0x01, 0x22, 0x44, 0x00, 0x20, 0x45, 0xB1, 0x06, 0x33, 
+    0x22, 0x24, 0x40, 0x42, 0x01, 0x14, 0xA2, 0x01, 0x02, 0xF0, 0x00, 0xA2, 0xF0, 0x02, 0x02, 0x22, 
+    0x20, 0xF0, 0x02, 0xB2, 0x00, 0x10, 0x44, 0x03, 0x31, 0x20, 0x42, 0x00, 0x20, 0x42, 0x0B, 0x11, 
+    0x22, 0x44, 0x13, 0x33, 0x22, 0x4C, 0x02, 0x33, 0x30, 0xB2, 0x15, 0x00, 0x22, 0x21, 0x31, 0x11, 
+    0x31, 0x12, 0x00, 0x23, 0x31, 0x13, 0xF2, 0x01, 0xF0, 0x02, 0x58, 0x08, 0x00, 0x02, 0x20, 0x22, 
+    0x30, 0xB2, 0x05, 0x00, 0x22, 0x20, 0x42, 0x08, 0x02, 0x22, 0x38, 0x84, 0x10, 0x4F, 0x00, 0x00, 
+    0xE2, 0x16, 0x33, 0x21, 0x11, 0x33, 0x14, 0x42, 0x22, 0x00, 0x02, 0x34, 0x44, 0x30, 0x50, 0x00, 
+    0x20, 0x4B, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x42, 0x05, 0x32, 0x22, 0x00, 0xB2, 0xE0, 0x07, 0x28, 
+    0x81, 0x02, 0x23, 0xA0, 0x05, 0x33, 0x20, 0x02, 0xE0, 0xA2, 0xA3, 0x11, 0x11, 0x44, 0x48, 0x48, 
+    0x41, 0x22, 0x02, 0x22, 0x33, 0x49, 0x01, 0x22, 0x48, 0x00, 0x20, 0xF0, 0x16, 0x00, 0x30, 0x43, 
+    0x00, 0x20, 0xB0, 0x01, 0x22, 0xC0, 0x0D, 0x24, 0x81, 0x23, 0x33, 0x20, 0x34, 0x11, 0xD0, 0x03, 
+    0x20, 0x00, 0xA2, 0x01, 0x33, 0xB2, 0x08, 0x34, 0x48, 0x84, 0x11, 0x10, 0xB2, 0x00, 0x00, 0xF2, 
+    0x0D, 0xF0, 0x1A, 0x04, 0x21, 0x12, 0x20, 0xE0, 0x17, 0x23, 0x10, 0x02, 0x02, 0x88, 0x13, 0x11, 
+    0x20, 0x11, 0x13, 0x22, 0x11, 0x43, 0x06, 0x22, 0x00, 0x02, 0x30, 0x42, 0xA3, 0x0A, 0x14, 0x44, 
+    0x11, 0x23, 0x32, 0x00, 0xD2, 0x00, 0x00, 0xF2, 0x09, 0xF0, 0x10, 0x00, 0x20, 0xE0, 0x02, 0x31, 
+    0x30, 0xF0, 0x02, 0x15, 0x24, 0x32, 0x32, 0x03, 0x32, 0x23, 0x32, 0x21, 0x31, 0x20, 0x23, 0x43, 
+    0xE0, 0x04, 0x20, 0x22, 0x20, 0xA1, 0x43, 0x06, 0x44, 0x41, 0x10, 0x00, 0xA2, 0xB0, 0xE2, 0x02, 
+    0x00, 0x00, 0xF2, 0x00, 0xF0, 0x0A, 0x01, 0x21, 0xD0, 0x03, 0x23, 0x32, 0xC0, 0x01, 0x22, 0xA0, 
+    0x04, 0x21, 0x02, 0x20, 0xE0, 0x03, 0x30, 0x02, 0xA0, 0x00, 0x30, 0x4B, 0x05, 0x33, 0x13, 0x23, 
+    0xA1, 0x43, 0x09, 0x31, 0x11, 0x22, 0x23, 0x13, 0xA2, 0x00, 0x00, 0xE2, 0x00, 0x00, 0xF2, 0x07, 
+    0xF0, 0x05, 0x00, 0x30, 0xC0, 0x08, 0x23, 0x22, 0x00, 0x22, 0x00, 0xA2, 0xB0, 0x06, 0x20, 0x03, 
+    0x00, 0x30, 0xF0, 0x04, 0x4C, 0x06, 0x22, 0x11, 0x13, 0x20, 0xA1, 0x01, 0x33, 0xA1, 0x09, 0x32, 
+    0x22, 0x44, 0x13, 0x13, 0xF2, 0x08, 0x01, 0x41, 0x4A, 0x00, 0x20, 0xF0, 0x01, 0x04, 0x22, 0x00, 
+    0x00, 0xC2, 0x02, 0x32, 0x00, 0x49, 0x03, 0x00, 0x02, 0xF0, 0x06, 0x01, 0x22, 0xF0, 0x09, 0x02, 
+    0x23, 0x30, 0xA1, 0x01, 0x33, 0xA1, 0x07, 0x20, 0x22, 0x44, 0x33, 0x44, 0x00, 0x30, 0xF2, 0x02, 
+    0x02, 0x34, 0x40, 0xA2, 0x00, 0x40, 0x44, 0xF0, 0x05, 0xF2, 0x03, 0x5A, 0x00, 0x20, 0x52, 0x03, 
+    0x02, 0x22, 0xF1, 0x01, 0x04, 0x32, 0x02, 0x30, 0xA1, 0xF2, 0x00, 0x06, 0x42, 0x22, 0x12, 0x20, 
+    0xA4, 0x00, 0x20, 0xB4, 0x08, 0x22, 0x20, 0x00, 0x22, 0x20, 0xA0, 0x02, 0x22, 0x20, 0x44, 0x00, 
+    0x00, 0xB2, 0x03, 0x32, 0x12, 0xF0, 0x21, 0x00, 0x20, 0xD0, 0x03, 0x23, 0x33, 0xF1, 0x01, 0x14, 
+    0x32, 0x21, 0x11, 0x32, 0x23, 0x13, 0x02, 0x14, 0x20, 0x22, 0x20, 0xA4, 0x00, 0x80, 0xA4, 0x0A, 
+    0x80, 0x04, 0x42, 0x32, 0x14, 0x40, 0xA2, 0x14, 0x33, 0x31, 0x13, 0x11, 0x30, 0x22, 0x02, 0x22, 
+    0x33, 0x00, 0x20, 0xF0, 0x21, 0x24, 0x20, 0x02, 0x00, 0x03, 0x23, 0x33, 0x13, 0x31, 0x33, 0x11, 
+    0x13, 0x23, 0x33, 0x11, 0x22, 0x31, 0x23, 0x44, 0x10, 0x42, 0x02, 0x21, 0x20, 0xC4, 0x0A, 0x80, 
+    0x00, 0x88, 0x84, 0x43, 0x10, 0xC4, 0x09, 0x14, 0x44, 0x88, 0x41, 0x32, 0xD0, 0x00, 0x20, 0xF0, 
+    0x2A, 0xA2, 0xA3, 0xA1, 0x02, 0x33, 0x30, 0xC1, 0x17, 0x22, 0x11, 0x34, 0x44, 0x12, 0x22, 0x02, 
+    0x00, 0x13, 0x24, 0x44, 0x88, 0xC4, 0x02, 0x21, 0x10, 0x45, 0x06, 0x84, 0x48, 0x84, 0x80, 0x46, 
+    0x00, 0x30, 0xF0, 0x1D, 0x00, 0x20, 0xF0, 0x04, 0xA2, 0xF3, 0x01, 0xD1, 0x0F, 0x21, 0x12, 0x11, 
+    0x14, 0x11, 0x13, 0x21, 0x32, 0xB1, 0x05, 0x48, 0x41, 0x31, 0x43, 0x05, 0x33, 0x13, 0x32, 0xA1, 
+    0x0D, 0x84, 0x84, 0x12, 0x03, 0x13, 0x02, 0x33, 0x64, 0x06, 0x22, 0x00, 0x20, 0x00, 0xB2, 0xA0, 
+    0xD2, 0xB3, 0xB2, 0x07, 0x31, 0x12, 0x21, 0x32, 0xF1, 0x03, 0x00, 0x30, 0xA1, 0x0B, 0x44, 0x41, 
+    0x32, 0x33, 0x20, 0x02, 0xE3, 0x04, 0x22, 0x33, 0x10, 0x42, 0x02, 0x02, 0x20, 0xF0, 0x1B, 0xC2, 
+    0xB0, 0x00, 0x20, 0xB0, 0xF2, 0x06, 0x01, 0x00, 0xA2, 0x00, 0x00, 0x42, 0x03, 0x33, 0x13, 0xA1, 
+    0x00, 0x30, 0xB1, 0x05, 0x33, 0x12, 0x11, 0xB2, 0x04, 0x00, 0x22, 0x30, 0xC2, 0xF0, 0x23, 0x00, 
+    0x20, 0xC0, 0x08, 0x22, 0x20, 0x00, 0x22, 0x20, 0xC0, 0xF2, 0x07, 0x0C, 0x00, 0x02, 0x02, 0x32, 
+    0x33, 0x22, 0x30, 0x44, 0x0D, 0x33, 0x13, 0x32, 0x33, 0x22, 0x02, 0x33, 0x42, 0xF0, 0x42, 0xF2, 
+    0x01, 0x01, 0x00, 0xB2, 0x05, 0x00, 0x02, 0x22, 0xB0, 0x08, 0x22, 0x32, 0x22, 0x32, 0x00, 0xA2, 
+    0x07, 0x32, 0x20, 0x03, 0x02, 0x7F, 0xF0, 0x06, 0xE2, 0x00, 0x00, 0x48, 0x01, 0x02, 0xD0, 0x05, 
+    0x22, 0x00, 0x22, 0xC0, 0x04, 0x20, 0x22, 0x20, 0x7F, 0xF0, 0x17, 0x02, 0x22, 0x20, 0xC0, 0x00, 
+    0x20, 0xF0, 0x0A, 0x07, 0x22, 0x23, 0x12, 0x22, 0xF0, 0x37, 0x00, 0x20, 0xF0, 0x31, 0x03, 0x20, 
+    0x00, 0x7F, 0xF0, 0x0D, 0x01, 0x22, 0xF0, 0x51, 
+};
+
+const gfx_image_t STORY_CH4_IMG = {
+    .w = STORY_CH4_W, .h = STORY_CH4_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH4_PAL, .colors = STORY_CH4_PAL_SIZE,
+    .data = STORY_CH4_RLE, .size = STORY_CH4_RLE_SIZE,
 };
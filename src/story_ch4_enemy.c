@@ -2,397 +2,107 @@
 #include "story_ch4_enemy.h"
 
 const uint16_t STORY_CH4_ENEMY_PAL[STORY_CH4_ENEMY_PAL_SIZE] = {
-    0x18E3, 0x2A6B, 0x5124, 0x21C8, 0x4AEC, 0x6493, 0x53D0, 0x9E7B, 
-    0x8D15, 0x9163, 0x75B8, 0x8DD8, 0x6207, 0xAA05, 0x932C, 0xD265, 
+    0x18E3, 0x2A6B, 0x5124, 0x6493, 
 };
 
-const uint8_t STORY_CH4_ENEMY_IDX[(STORY_CH4_ENEMY_W * STORY_CH4_ENEMY_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x31, 0x11, 0x11, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x13, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x31, 0x11, 0x11, 0x11, 0x13, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x57, 0x77, 0xB5, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5B, 0x77, 0x77, 0x77, 0x55, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xB7, 0xAA, 0x77, 0x7A, 0x7A, 0x54, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5B, 0xB5, 0x5A, 0x77, 0x55, 0x57, 0x55, 0x61, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x58, 0x66, 0x58, 0x77, 0x55, 0x50, 0x55, 0x61, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x45, 0x51, 0x68, 0x78, 0x45, 0x75, 0x56, 0x16, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x54, 0x84, 0x01, 0x50, 0x05, 0x51, 0x13, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x4B, 0x40, 0x15, 0x65, 0x51, 0x06, 0x41, 0x13, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x46, 0x40, 0x58, 0x85, 0x56, 0x11, 0x00, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x24, 0x00, 0x45, 0x81, 0x00, 0x45, 0x55, 0x10, 0x33, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x24, 0x04, 0x54, 0x00, 0x00, 0x00, 0x34, 0x61, 0x13, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x24, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x33, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0x75, 0x10, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x45, 0x55, 0x77, 0xA4, 0x00, 0x00, 0x00, 0x03, 0x33, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x12, 0xE0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x31, 0x44, 0x55, 0xA5, 0xAA, 0x50, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x00, 0x00, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x31, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x14, 0x44, 0x65, 0xA5, 0x55, 0x55, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x14, 0x11, 0x15, 0x55, 0x5A, 0x55, 0x40, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x4C, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x31, 0x15, 0x66, 0x16, 0x50, 0x61, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x01, 0x41, 0x15, 0x55, 0x51, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x42, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x11, 0x44, 0x01, 0x54, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0xC2, 0x00, 0x00, 0x00, 0x02, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x40, 0x03, 0x01, 0x10, 0x15, 0x41, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0xC2, 0x00, 0x00, 0x00, 0x22, 0x2E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x00, 0x01, 0x45, 0x13, 0x10, 0x01, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0xC0, 0x00, 0x00, 0x00, 0x22, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x16, 0x14, 0x11, 0x11, 0x11, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x56, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x20, 0x01, 0x11, 0x14, 0x55, 0x61, 0x01, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x55, 0x31, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x24, 0x13, 0x00, 0x00, 0x34, 0x45, 0x61, 0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x43, 0x6B, 0x54, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x29, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x33, 0x65, 0x40, 0x45, 0x11, 0x13, 0x30, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x29, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x31, 0x51, 0x06, 0x51, 0x33, 0x33, 0x30, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x30, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x31, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x35, 0x50, 0x16, 0x30, 0x45, 0x41, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x30, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x41, 0x45, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x34, 0x33, 0x51, 0x01, 0x55, 0x55, 0x41, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x45, 0x50, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x01, 0x10, 0x05, 0x54, 0x46, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x20, 0x00, 0x00, 0x22, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x14, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x13, 0x01, 0x00, 0x16, 0x54, 0x01, 0x54, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x03, 0x11, 
-    0x42, 0x20, 0x00, 0x00, 0x22, 0xD4, 0x00, 0x00, 0x00, 0x03, 0x30, 0x16, 0x11, 0x11, 0x11, 0x11, 
-    0x46, 0x58, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x10, 0x10, 0x01, 0x55, 0x13, 0x14, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x33, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x10, 0x00, 0x34, 0x54, 0x31, 0x40, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x41, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x60, 0x11, 0x11, 0x11, 
-    0x14, 0x11, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x43, 0x30, 0x14, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x10, 0x00, 
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x16, 0x55, 0x61, 0x11, 0x14, 
-    0x84, 0x44, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x10, 0x03, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x30, 0x00, 
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x15, 0x61, 0x11, 0x11, 0x65, 
-    0x44, 0x14, 0x13, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x41, 0x01, 0x10, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x30, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x33, 0x01, 0x56, 
-    0x46, 0x41, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x16, 0x10, 0x34, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x46, 0x14, 0x14, 0x44, 
-    0x54, 0x43, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x13, 0x00, 0x10, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x99, 0x92, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x41, 0x10, 0x11, 0x44, 0x00, 
-    0x44, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x40, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x10, 0x00, 0x00, 
-    0x20, 0x41, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x20, 0x00, 0x22, 0x02, 0x20, 0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x20, 0x02, 0x20, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x31, 0x30, 0x02, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x02, 0x22, 0x00, 0x02, 0x20, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x11, 0x41, 0x10, 0x02, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x20, 0x00, 0x02, 0x22, 0x00, 0x02, 0x22, 0x04, 0x45, 0x88, 0x41, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x03, 0x11, 0x11, 0x13, 0x02, 
-    0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x30, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x2D, 0xF9, 0x22, 0x00, 0x46, 0x55, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x41, 0x13, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x09, 0x92, 0x14, 0x44, 0x76, 0x14, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x11, 0x11, 0x10, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x02, 0xF2, 0x22, 0x22, 0x44, 0x14, 0x61, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x61, 0x11, 0x11, 0x00, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x11, 0x44, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xB6, 0x11, 0x11, 0x30, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x20, 0x02, 0x20, 0x00, 0x02, 0x02, 0x92, 0x44, 0x44, 0x40, 0x31, 0x15, 0x61, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xAA, 0x43, 0x11, 0x30, 0x00, 0x02, 
-    0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x02, 0x22, 0x22, 0x22, 0x02, 0xF2, 0x00, 0x02, 0x10, 0x03, 0x11, 0x55, 0x14, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x5B, 0x55, 0x51, 0x31, 0x10, 0x00, 0x02, 
-    0x14, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x20, 0x22, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0x34, 
-    0x44, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x14, 
-    0x46, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x02, 0x20, 0x22, 0x22, 0x20, 0x22, 0x99, 0x2C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x14, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x45, 0x55, 0x55, 0x56, 0x64, 0x00, 0x00, 0x44, 
-    0x46, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x22, 0x02, 0x2D, 0x90, 0x02, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-    0x31, 0x41, 0x45, 0x11, 0x11, 0x00, 0x00, 0x00, 0x44, 0x55, 0x56, 0x64, 0x41, 0x00, 0x00, 0x44, 
-    0x46, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x22, 0x02, 0x2D, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x31, 0x44, 0x46, 0x41, 0x11, 0x04, 0x45, 0x55, 0x56, 0x44, 0x13, 0x00, 0x04, 0x44, 
-    0x46, 0x41, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x22, 0x22, 0x99, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x14, 0x41, 0x1B, 0x75, 0x56, 0x55, 0x56, 0x41, 0x30, 0x00, 0x04, 0x44, 
-    0x44, 0x44, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x22, 0x22, 0x29, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x13, 0x15, 0x5B, 0xB5, 0xAB, 0x56, 0x10, 0x00, 0x00, 0x04, 0x44, 
-    0x44, 0x43, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x20, 0x00, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x14, 0x55, 0x55, 0x51, 0x30, 0x00, 0x00, 0x04, 0x44, 
-    0x41, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x22, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x01, 0x44, 0x13, 0x00, 0x00, 0x00, 0x04, 0x41, 
-    0x43, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x22, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x44, 
-    0x40, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x22, 0x20, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x45, 
-    0x40, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x22, 0x02, 0x20, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x10, 0x00, 0x00, 0x00, 0x45, 0x55, 
-    0x55, 0x10, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x20, 0x22, 0x20, 0x02, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x14, 0x00, 0x00, 0x00, 0x00, 0x88, 0x55, 
-    0xB5, 0x13, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x02, 0x22, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x84, 0x55, 
-    0x40, 0x14, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x20, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x24, 0x61, 
-    0x01, 0x44, 0x11, 0x13, 0x34, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x84, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x00, 0x00, 0x20, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2E, 0x00, 
-    0x14, 0x11, 0x41, 0x11, 0x40, 0x00, 0x30, 0x00, 0x00, 0x44, 0x44, 0x68, 0x84, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x42, 0x00, 
-    0x30, 0x00, 0x31, 0x14, 0x00, 0x16, 0x41, 0x10, 0x15, 0x54, 0x00, 0x03, 0x45, 0x54, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 
-    0x00, 0x33, 0x01, 0x10, 0x04, 0x8B, 0x75, 0x55, 0x55, 0x58, 0x61, 0x00, 0x01, 0x45, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x20, 0x00, 
-    0x00, 0x10, 0x00, 0x00, 0x04, 0x58, 0x55, 0x55, 0x55, 0x85, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x45, 0x66, 0x64, 0x44, 0x00, 0x14, 0x60, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x02, 0x20, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44, 0x44, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x14, 0x45, 0x84, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x44, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x44, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x45, 0x40, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x24, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x00, 0x00, 0x00, 0x02, 0x92, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t STORY_CH4_ENEMY_RLE[STORY_CH4_ENEMY_RLE_SIZE] = {
+    0xF0, 0x4A, 0xF1, 0x03, 0xF0, 0x6A, 0xF1, 0x05, 0xF0, 0x68, 0xF1, 0x07, 0xF0, 0x67, 0xF1, 0x09, 
+    0xF0, 0x5E, 0x00, 0x10, 0xA0, 0xF1, 0x0B, 0xF0, 0x28, 0x00, 0x10, 0xF0, 0x2A, 0xF1, 0x12, 0x7F, 
+    0xF0, 0x1A, 0xF1, 0x14, 0x7F, 0xF0, 0x18, 0xF1, 0x15, 0x7F, 0xF0, 0x17, 0xF1, 0x16, 0x6F, 0x00, 
+    0x10, 0xF0, 0x24, 0xF1, 0x1A, 0xF0, 0x26, 0x6B, 0xF1, 0x1C, 0x7F, 0xF0, 0x10, 0xF1, 0x1D, 0x7F, 
+    0x7F, 0x6B, 0x00, 0x10, 0xF0, 0x20, 0xF1, 0x1F, 0xF0, 0x25, 0x7A, 0x00, 0x30, 0x7F, 0x69, 0xF1, 
+    0x08, 0xC3, 0x7F, 0x75, 0xF3, 0x01, 0xF1, 0x08, 0xF0, 0x4C, 0xF1, 0x06, 0xF3, 0x03, 0xF1, 0x08, 
+    0xF0, 0x4A, 0xF1, 0x06, 0xF3, 0x06, 0x7F, 0x6D, 0xF3, 0x03, 0x00, 0x00, 0x50, 0x00, 0x10, 0xF0, 
+    0x48, 0xF1, 0x06, 0x02, 0x33, 0x10, 0xA3, 0x00, 0x10, 0xB3, 0x01, 0x13, 0xF1, 0x08, 0xF0, 0x48, 
+    0xF1, 0x09, 0x0A, 0x31, 0x31, 0x01, 0x30, 0x03, 0x30, 0xF1, 0x09, 0xF0, 0x20, 0x00, 0x10, 0xF0, 
+    0x1D, 0xF1, 0x09, 0x03, 0x31, 0x01, 0xA3, 0x02, 0x10, 0x30, 0xF1, 0x0A, 0xF0, 0x47, 0xF1, 0x07, 
+    0x00, 0x20, 0x42, 0xC3, 0x03, 0x11, 0x00, 0x7F, 0xF0, 0x16, 0xF1, 0x07, 0x0E, 0x21, 0x00, 0x13, 
+    0x31, 0x00, 0x13, 0x33, 0x10, 0x50, 0x00, 0x10, 0xF0, 0x45, 0x51, 0x02, 0x13, 0x10, 0xC0, 0x02, 
+    0x11, 0x30, 0xF1, 0x0A, 0xF0, 0x44, 0xF1, 0x08, 0x04, 0x21, 0x13, 0x10, 0xF0, 0x01, 0x7F, 0xF0, 
+    0x07, 0x02, 0x11, 0x10, 0xF0, 0x02, 0xF1, 0x09, 0x02, 0x21, 0x30, 0xF0, 0x04, 0x7F, 0xF0, 0x05, 
+    0x00, 0x10, 0xA3, 0x00, 0x10, 0x5A, 0x00, 0x30, 0xF0, 0x07, 0x7F, 0xF0, 0x01, 0x01, 0x11, 0xC3, 
+    0x00, 0x10, 0xD0, 0xF1, 0x09, 0x01, 0x21, 0xC0, 0x00, 0x20, 0xF0, 0x02, 0x7F, 0xE0, 0xA1, 0xD3, 
+    0x00, 0x00, 0xF1, 0x0F, 0x00, 0x20, 0xB0, 0xB2, 0xF0, 0x00, 0xF1, 0x06, 0xF0, 0x2F, 0xB1, 0xE3, 
+    0xF1, 0x0F, 0xB0, 0xD2, 0xF0, 0x00, 0x6C, 0x00, 0x20, 0x5A, 0x00, 0x10, 0x46, 0x00, 0x00, 0xF1, 
+    0x0C, 0x00, 0x20, 0xC0, 0x03, 0x22, 0x02, 0xF0, 0x02, 0x6C, 0xF0, 0x10, 0x46, 0x04, 0x13, 0x30, 
+    0x30, 0xF1, 0x0D, 0x45, 0x01, 0x00, 0x4B, 0x00, 0x00, 0x7F, 0x05, 0x00, 0x02, 0x20, 0x45, 0x00, 
+    0x30, 0xF1, 0x11, 0x7F, 0x5A, 0xA1, 0x05, 0x01, 0x31, 0x33, 0xF1, 0x0F, 0x00, 0x20, 0x46, 0x03, 
+    0x22, 0x21, 0x7B, 0x00, 0x20, 0x52, 0x07, 0x00, 0x10, 0x11, 0x01, 0x5F, 0x04, 0x22, 0x21, 0x30, 
+    0x65, 0x02, 0x11, 0x10, 0x62, 0x0D, 0x22, 0x20, 0x00, 0x11, 0x31, 0x11, 0x00, 0x56, 0xD0, 0x4F, 
+    0x00, 0x30, 0xF1, 0x03, 0xF0, 0x02, 0x03, 0x13, 0x31, 0xF0, 0x0C, 0x51, 0x01, 0x00, 0xB1, 0x03, 
+    0x33, 0x31, 0x5E, 0x03, 0x00, 0x02, 0xF0, 0x03, 0x03, 0x11, 0x33, 0x52, 0x02, 0x11, 0x10, 0xF0, 
+    0x0E, 0x51, 0x02, 0x11, 0x10, 0xA0, 0x04, 0x11, 0x13, 0x30, 0x60, 0xF0, 0x05, 0x05, 0x11, 0x13, 
+    0x33, 0x4D, 0x01, 0x11, 0xF0, 0x11, 0x4D, 0x03, 0x12, 0x22, 0xF0, 0x02, 0x04, 0x13, 0x10, 0x00, 
+    0x59, 0x01, 0x22, 0x52, 0x03, 0x10, 0x13, 0xB1, 0xC0, 0x00, 0x10, 0x6C, 0xA0, 0x02, 0x22, 0x20, 
+    0xD0, 0x01, 0x11, 0x52, 0xD0, 0x00, 0x20, 0xF0, 0x09, 0x06, 0x11, 0x31, 0x03, 0x30, 0xC1, 0xB0, 
+    0x01, 0x11, 0xF0, 0x13, 0x01, 0x22, 0xF0, 0x02, 0x02, 0x11, 0x00, 0x44, 0x01, 0x00, 0x5B, 0x00, 
+    0x20, 0xF0, 0x11, 0x09, 0x13, 0x30, 0x13, 0x10, 0x13, 0xA1, 0xF0, 0x19, 0x5E, 0x00, 0x00, 0xF1, 
+    0x09, 0x00, 0x30, 0x5B, 0x06, 0x11, 0x13, 0x10, 0x10, 0xA3, 0x43, 0x00, 0x10, 0xF0, 0x14, 0x00, 
+    0x20, 0xF0, 0x06, 0x00, 0x20, 0x45, 0x00, 0x20, 0x48, 0x00, 0x00, 0xF1, 0x05, 0x02, 0x33, 0x00, 
+    0x5C, 0x0C, 0x01, 0x10, 0x03, 0x31, 0x13, 0x31, 0x10, 0xF0, 0x1C, 0x00, 0x10, 0xF0, 0x00, 0x02, 
+    0x12, 0x20, 0xB0, 0x00, 0x20, 0x4A, 0x00, 0x00, 0xF1, 0x08, 0x49, 0x00, 0x10, 0x51, 0x0B, 0x00, 
+    0x13, 0x31, 0x01, 0x31, 0x11, 0xF0, 0x1F, 0x02, 0x11, 0x00, 0xA1, 0x48, 0x00, 0x10, 0x46, 0x03, 
+    0x10, 0x13, 0xF1, 0x00, 0x05, 0x33, 0x31, 0x12, 0xF0, 0x02, 0x4F, 0x06, 0x01, 0x00, 0x13, 0x30, 
+    0xB1, 0x01, 0x01, 0xF0, 0x23, 0x03, 0x11, 0x12, 0x45, 0x02, 0x00, 0x20, 0xE0, 0xA1, 0x00, 0x00, 
+    0xF1, 0x04, 0xF0, 0x13, 0x07, 0x11, 0x00, 0x01, 0x13, 0xA1, 0x02, 0x00, 0x30, 0x66, 0xC1, 0x03, 
+    0x00, 0x22, 0xF0, 0x08, 0xB1, 0x01, 0x30, 0x4A, 0x00, 0x10, 0xF0, 0x16, 0x09, 0x11, 0x10, 0x11, 
+    0x00, 0x11, 0xF0, 0x20, 0xA1, 0xA0, 0x50, 0x03, 0x01, 0x11, 0xA3, 0xB1, 0x00, 0x30, 0x43, 0x00, 
+    0x20, 0xF0, 0x15, 0xA1, 0x05, 0x00, 0x10, 0x11, 0xF0, 0x21, 0x5E, 0xB1, 0x01, 0x33, 0xD1, 0x5F, 
+    0x05, 0x01, 0x10, 0x11, 0xF0, 0x22, 0x45, 0x00, 0x20, 0xF0, 0x0B, 0x07, 0x11, 0x00, 0x01, 0x10, 
+    0x42, 0x05, 0x31, 0x10, 0x12, 0xF0, 0x14, 0x08, 0x13, 0x10, 0x11, 0x01, 0x10, 0xF0, 0x17, 0x02, 
+    0x22, 0x20, 0xF0, 0x02, 0x00, 0x10, 0xA0, 0x54, 0x03, 0x01, 0x13, 0xC1, 0x00, 0x30, 0xA1, 0x00, 
+    0x00, 0x5D, 0x06, 0x10, 0x01, 0x01, 0x10, 0xF0, 0x18, 0xD2, 0x49, 0x00, 0x20, 0x54, 0x03, 0x11, 
+    0x10, 0xA1, 0x01, 0x00, 0xC1, 0x5C, 0x04, 0x00, 0x01, 0x00, 0x62, 0xB0, 0x00, 0x20, 0xC0, 0x01, 
+    0x11, 0xA0, 0x00, 0x20, 0xF0, 0x0C, 0x05, 0x10, 0x01, 0x11, 0xB0, 0x05, 0x20, 0x11, 0x10, 0x61, 
+    0x01, 0x11, 0xF0, 0x13, 0xA2, 0xF0, 0x06, 0x43, 0xF0, 0x1B, 0x01, 0x10, 0x5F, 0x03, 0x10, 0x11, 
+    0xF0, 0x0F, 0x06, 0x20, 0x00, 0x22, 0x00, 0x46, 0x01, 0x22, 0xF0, 0x18, 0x02, 0x11, 0x10, 0xF0, 
+    0x06, 0x51, 0x00, 0x10, 0xF0, 0x02, 0x00, 0x10, 0xF0, 0x16, 0x02, 0x22, 0x00, 0x46, 0x00, 0x20, 
+    0x67, 0x05, 0x11, 0x10, 0x02, 0x57, 0xF0, 0x01, 0x01, 0x11, 0xF0, 0x12, 0x06, 0x22, 0x02, 0x22, 
+    0x00, 0x49, 0xF0, 0x17, 0x00, 0x10, 0xB0, 0xB1, 0x57, 0x00, 0x10, 0xF0, 0x20, 0xB2, 0xA0, 0x10, 
+    0x22, 0x20, 0x00, 0x22, 0x20, 0x11, 0x33, 0x31, 0x10, 0xF0, 0x0E, 0x00, 0x10, 0x43, 0xD1, 0x48, 
+    0x00, 0x20, 0xB0, 0x00, 0x10, 0xA0, 0x01, 0x11, 0xF0, 0x2B, 0x43, 0xC2, 0x06, 0x00, 0x13, 0x33, 
+    0x10, 0xF0, 0x12, 0xD1, 0xF0, 0x09, 0x00, 0x10, 0xF0, 0x30, 0x43, 0x02, 0x02, 0x20, 0xD0, 0x00, 
+    0x10, 0x5A, 0xD1, 0x03, 0x00, 0x02, 0xF0, 0x40, 0xA2, 0x42, 0x00, 0x20, 0xA1, 0x03, 0x33, 0x11, 
+    0x57, 0xE1, 0xA0, 0x7F, 0x50, 0xA2, 0xA1, 0x01, 0x31, 0xF0, 0x0D, 0x02, 0x13, 0x30, 0xB1, 0xB0, 
+    0x7F, 0x02, 0x22, 0x20, 0xF0, 0x03, 0x01, 0x22, 0xD0, 0xA1, 0xF0, 0x0C, 0x00, 0x10, 0xA3, 0xB1, 
+    0x7F, 0x45, 0x05, 0x22, 0x00, 0x22, 0xA0, 0x04, 0x20, 0x22, 0x20, 0xB1, 0x42, 0x03, 0x33, 0x11, 
+    0xF0, 0x09, 0xB3, 0x4A, 0x01, 0x11, 0xF0, 0x14, 0x00, 0x10, 0xF0, 0x0E, 0x00, 0x10, 0xF0, 0x00, 
+    0x03, 0x22, 0x20, 0xD2, 0x42, 0x0E, 0x00, 0x02, 0x10, 0x01, 0x11, 0x33, 0x11, 0x10, 0xF0, 0x06, 
+    0x00, 0x10, 0xC3, 0x47, 0xB1, 0xF0, 0x36, 0x03, 0x22, 0x20, 0xB2, 0x03, 0x02, 0x02, 0xF0, 0x01, 
+    0xF1, 0x00, 0x51, 0x02, 0x33, 0x10, 0xA0, 0x04, 0x11, 0x13, 0x30, 0x7B, 0x04, 0x22, 0x20, 0x00, 
+    0x48, 0xC2, 0xF0, 0x00, 0xB1, 0x01, 0x31, 0xF0, 0x01, 0x00, 0x10, 0x7F, 0x52, 0x03, 0x02, 0x20, 
+    0x43, 0x03, 0x02, 0x22, 0xF0, 0x03, 0x01, 0x10, 0xB1, 0x00, 0x30, 0xA1, 0xC0, 0x01, 0x11, 0xB3, 
+    0x01, 0x11, 0x63, 0x01, 0x11, 0x6D, 0xF0, 0x0A, 0xD1, 0x00, 0x30, 0xA1, 0x02, 0x01, 0x10, 0xB3, 
+    0xA1, 0x02, 0x00, 0x00, 0xA1, 0x01, 0x31, 0x42, 0x00, 0x10, 0xF0, 0x2F, 0x46, 0xB2, 0xF0, 0x10, 
+    0xD1, 0xF3, 0x00, 0x02, 0x11, 0x10, 0xA0, 0xE1, 0x56, 0x00, 0x10, 0x73, 0x00, 0x20, 0xF0, 0x0A, 
+    0x4E, 0xC0, 0xD1, 0x00, 0x00, 0x56, 0xF0, 0x1B, 0x50, 0xC0, 0x00, 0x10, 0xF0, 0x09, 0xA1, 0xB3, 
+    0x00, 0x10, 0x4A, 0xA0, 0x02, 0x11, 0x10, 0xF0, 0x09, 0x00, 0x10, 0xF0, 0x15, 0x00, 0x10, 0xB0, 
+    0x00, 0x20, 0x47, 0x03, 0x00, 0x22, 0xF0, 0x16, 0x03, 0x11, 0x00, 0xB1, 0xD0, 0x56, 0x00, 0x10, 
+    0xF0, 0x21, 0x01, 0x22, 0xA0, 0x02, 0x22, 0x00, 0x55, 0x00, 0x20, 0xF0, 0x0B, 0x4A, 0xB0, 0xA1, 
+    0xF0, 0x2D, 0x07, 0x20, 0x00, 0x22, 0x20, 0x56, 0xF0, 0x13, 0x03, 0x11, 0x13, 0x47, 0xF0, 0x04, 
+    0x03, 0x10, 0x01, 0x66, 0x0A, 0x22, 0x02, 0x20, 0x22, 0x00, 0x00, 0x56, 0x00, 0x20, 0xF0, 0x02, 
+    0x03, 0x10, 0x11, 0x46, 0xB3, 0x05, 0x10, 0x01, 0x11, 0xF0, 0x06, 0x00, 0x10, 0xF0, 0x21, 0x08, 
+    0x20, 0x22, 0x20, 0x02, 0x20, 0x63, 0xA1, 0xE0, 0xC3, 0x01, 0x11, 0x51, 0xF0, 0x20, 0x06, 0x22, 
+    0x02, 0x22, 0x00, 0x42, 0x00, 0x20, 0xF0, 0x04, 0x01, 0x22, 0xF0, 0x0E, 0x00, 0x10, 0xE0, 0x06, 
+    0x13, 0x13, 0x31, 0x00, 0xC1, 0x78, 0x02, 0x22, 0x20, 0xB0, 0x66, 0xF0, 0x00, 0x05, 0x12, 0x13, 
+    0x10, 0xF1, 0x00, 0xF0, 0x00, 0x04, 0x13, 0x33, 0x10, 0x6A, 0xA0, 0x04, 0x20, 0x22, 0x20, 0x4E, 
+    0x00, 0x20, 0xF0, 0x14, 0x04, 0x22, 0x10, 0x00, 0xF1, 0x00, 0x03, 0x00, 0x01, 0xB0, 0xA1, 0x03, 
+    0x33, 0x31, 0x66, 0xF0, 0x00, 0x4C, 0xB0, 0x00, 0x20, 0xF0, 0x06, 0x01, 0x22, 0x4A, 0x07, 0x12, 
+    0x00, 0x10, 0x00, 0xA1, 0x13, 0x00, 0x13, 0x11, 0x10, 0x13, 0x31, 0x00, 0x01, 0x13, 0x31, 0xF0, 
+    0x27, 0x01, 0x22, 0xF0, 0x05, 0x03, 0x20, 0x02, 0xF0, 0x12, 0x01, 0x22, 0xB0, 0x07, 0x11, 0x01, 
+    0x10, 0x01, 0xF3, 0x02, 0x07, 0x10, 0x00, 0x11, 0x31, 0xF0, 0x1A, 0x00, 0x20, 0xF0, 0x03, 0x4D, 
+    0xF0, 0x15, 0x00, 0x20, 0x46, 0xC0, 0x4A, 0x00, 0x30, 0xF0, 0x21, 0x01, 0x22, 0xF0, 0x01, 0x00, 
+    0x20, 0xF0, 0x24, 0x01, 0x20, 0x44, 0xD0, 0x01, 0x11, 0xA3, 0x07, 0x11, 0x10, 0x01, 0x13, 0x6E, 
+    0x04, 0x22, 0x02, 0x20, 0x6C, 0x01, 0x02, 0x4B, 0x00, 0x00, 0xE1, 0xA0, 0x01, 0x11, 0x6C, 0xB2, 
+    0xF0, 0x36, 0xB1, 0x01, 0x33, 0x43, 0x02, 0x00, 0x10, 0x6B, 0xF0, 0x3C, 0xE1, 0xF0, 0x24, 0x00, 
+    0x20, 0xF0, 0x3D, 0x00, 0x20, 0x45, 0xA0, 0x00, 0x10, 0xF0, 0x18, 0x00, 0x10, 0xF0, 0x04, 0x00, 
+    0x20, 0xF0, 0x3B, 0x05, 0x22, 0x20, 0x13, 0x43, 0x02, 0x01, 0x10, 0xF0, 0x33, 0x00, 0x20, 0xF0, 
+    0x2D, 0xA2, 0x00, 0x10, 0xE0, 0x00, 0x10, 0xF0, 0x5F, 0x02, 0x11, 0x10, 0x49, 0xF0, 0x69, 0x01, 
+    0x11, 0xF0, 0x01, 0x7F, 0x7D, 0xF0, 0x6B, 0x00, 0x10, 0xF0, 0xB7, 
+};
+
+const gfx_image_t STORY_CH4_ENEMY_IMG = {
+    .w = STORY_CH4_ENEMY_W, .h = STORY_CH4_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH4_ENEMY_PAL, .colors = STORY_CH4_ENEMY_PAL_SIZE,
+    .data = STORY_CH4_ENEMY_RLE, .size = STORY_CH4_ENEMY_RLE_SIZE,
 };
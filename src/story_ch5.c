@@ -6,281 +6,212 @@ const uint16_t STORY_CH5_PAL[STORY_CH5_PAL_SIZE] = {
     0x64F2, 0xF946, 0xF10B, 0xC637, 0x742D, 0xDAAA, 0xC574, 0xD952, 
 };
 
-const uint8_t STORY_CH5_IDX[(STORY_CH5_W * STORY_CH5_H) / 2] = {
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x02, 0x17, 0x02, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 0x02, 0x20, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0xB1, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x70, 0x44, 0x44, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x32, 0x15, 0x21, 0x25, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x04, 0x60, 0x04, 0x40, 0x77, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x12, 0x52, 0x25, 0x21, 0x05, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x64, 0x40, 0x04, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x12, 0x03, 0x33, 0x33, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 
-    0x11, 0x12, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x04, 0x44, 0x46, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x1B, 0x53, 0x33, 0x33, 0x30, 0x50, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x22, 0x21, 0x12, 0x22, 0x20, 0x22, 0x21, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x01, 0x02, 0x22, 0x22, 0x22, 0x21, 0x11, 0x10, 0x44, 0x74, 0x44, 0x40, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x12, 0x03, 0x33, 0x00, 0x00, 0x05, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x12, 0x22, 0x21, 0x22, 0x22, 0x20, 0x02, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x23, 0x04, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x07, 0x33, 0x07, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x50, 0x21, 0x10, 0x32, 0x22, 0x00, 0x33, 0x30, 0x00, 0x51, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x2E, 0xE2, 0x02, 0x21, 0x10, 0x02, 0x22, 0x21, 0x12, 0x00, 
-    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x33, 0x33, 0x00, 0x00, 0x20, 0x52, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x2E, 0x22, 0x22, 0x22, 0x20, 0x22, 0x20, 0x21, 0x20, 0x22, 0x15, 0x00, 
-    0x11, 0x11, 0x11, 0x12, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x35, 0x33, 0x11, 0x22, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x52, 0x00, 0x05, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x02, 0x22, 0x21, 0xB1, 0x22, 0x22, 0x22, 0x22, 0x23, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x12, 0x20, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x01, 0x11, 0x05, 0x30, 0x11, 0x22, 0x21, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x23, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 
-    0x10, 0xBB, 0x20, 0x22, 0x11, 0x11, 0x12, 0x22, 0x22, 0x21, 0x20, 0x44, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0x11, 0x22, 0x22, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x01, 0x12, 0x03, 0x33, 0x03, 0x00, 0x02, 0x22, 0xB1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x74, 0x00, 0x00, 0x00, 0x51, 0x11, 0x11, 
-    0x10, 0xBB, 0x12, 0x22, 0x22, 0x11, 0x11, 0x22, 0x22, 0x21, 0x20, 0x00, 0x00, 0x00, 0x77, 0x07, 
-    0x21, 0x11, 0x11, 0x22, 0x22, 0x12, 0x21, 0x12, 0x53, 0x22, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 
-    0x11, 0x21, 0x10, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x11, 0x11, 0x11, 0x1B, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x22, 0x00, 0x22, 0x20, 0x00, 0x00, 0x51, 0x11, 0x11, 
-    0x10, 0x01, 0x12, 0x22, 0x22, 0x11, 0x1B, 0x22, 0x22, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0x11, 0x22, 0x22, 0xB2, 0x21, 0x11, 0x12, 0x00, 0x11, 0x11, 0x14, 0x21, 0x11, 0x11, 
-    0x11, 0x21, 0x23, 0x30, 0x00, 0x00, 0x00, 0x20, 0x52, 0xB1, 0x11, 0x11, 0x11, 0x1B, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x02, 0x00, 0x21, 0x11, 0x22, 0x11, 0x10, 0x00, 0x00, 0x0B, 0x11, 0x11, 
-    0x11, 0x01, 0x12, 0x22, 0x22, 0xB1, 0xB2, 0x22, 0x22, 0x21, 0x37, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x11, 0x11, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x00, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 
-    0x11, 0x21, 0x23, 0x32, 0x33, 0x00, 0x00, 0x23, 0x02, 0x11, 0x11, 0x11, 0x11, 0x1B, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x21, 0x11, 0x22, 0x11, 0x10, 0x00, 0x20, 0x0B, 0x11, 0x11, 
-    0x11, 0x10, 0x22, 0x52, 0x52, 0x11, 0x10, 0x02, 0x22, 0x20, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x20, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 
-    0x12, 0x01, 0x33, 0x00, 0x00, 0x30, 0x00, 0x50, 0x02, 0x11, 0x11, 0x1B, 0x11, 0x1B, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x22, 0x22, 0x55, 0x22, 0x20, 0x50, 0x30, 0x00, 0x1B, 0xB1, 
-    0x1B, 0xB0, 0xB2, 0x35, 0x35, 0x12, 0x22, 0x22, 0x22, 0x02, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x20, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 
-    0x12, 0x00, 0x53, 0x30, 0x05, 0x00, 0x03, 0x20, 0x02, 0xB1, 0x11, 0x10, 0x11, 0x1B, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x21, 
-    0x11, 0x1B, 0x05, 0x32, 0x22, 0xB0, 0x33, 0x33, 0x33, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x13, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 
-    0x10, 0x22, 0x25, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x1B, 0x11, 0x10, 0x11, 0x1B, 0x11, 0x11, 
-    0x11, 0xBB, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 
-    0x22, 0x22, 0x23, 0x52, 0x25, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x33, 0x33, 0x33, 
-    0x02, 0x12, 0x12, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x13, 0xB1, 0x11, 0x12, 0x11, 0x11, 0x11, 
-    0x12, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0xB0, 0xB0, 0x12, 0x11, 0xB0, 0x12, 0x11, 
-    0x11, 0xB2, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x73, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x07, 0x66, 0x00, 0x00, 0x00, 0x00, 
-    0x55, 0x12, 0x20, 0x20, 0x52, 0x20, 0x22, 0x0E, 0x21, 0x13, 0x00, 0x11, 0x10, 0x21, 0x22, 0x12, 
-    0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x22, 0x25, 0x12, 0x22, 0xB0, 0x22, 
-    0x12, 0x20, 0x22, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x67, 
-    0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x07, 0x76, 0x66, 0x66, 0x00, 0x07, 0x66, 0x66, 
-    0x30, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x01, 0x20, 0x00, 0x51, 0x20, 0x0E, 0x00, 0x20, 
-    0x22, 0x0C, 0x50, 0x00, 0x05, 0x50, 0x00, 0x20, 0x00, 0x25, 0x02, 0x20, 0x22, 0x02, 0x20, 0x02, 
-    0xB2, 0x00, 0x00, 0x03, 0x00, 0x05, 0x04, 0x11, 0x11, 0x11, 0x24, 0x00, 0x00, 0x07, 0x07, 0x00, 
-    0x70, 0x00, 0x33, 0x03, 0x33, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x07, 0x44, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1B, 0x01, 0x24, 0x00, 0x00, 0x04, 0x06, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x76, 0x66, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x70, 0x00, 0x00, 0x03, 0x30, 0x0C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x24, 0x03, 0x02, 0xC0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x00, 0x67, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x0A, 0xAA, 0xAA, 0x32, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x30, 0x00, 0xD8, 0x00, 0xDD, 0xD3, 
-    0x00, 0x00, 0x30, 0x00, 0x0A, 0x3C, 0x0A, 0xDD, 0xDD, 0xE0, 0x00, 0x3C, 0x35, 0x0D, 0xC0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x44, 0x44, 0x44, 0x40, 0x33, 0x76, 0x44, 0x44, 0x44, 0x44, 
-    0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x04, 0x44, 0x40, 0x04, 0x40, 0x00, 
-    0x04, 0x0A, 0x09, 0x99, 0xD8, 0x33, 0xFD, 0x90, 0x00, 0x0A, 0xD8, 0x0F, 0x98, 0x3F, 0x9D, 0x9D, 
-    0x07, 0x0F, 0x00, 0x60, 0x0A, 0x38, 0x0A, 0x9D, 0xD9, 0x30, 0x0A, 0x58, 0x30, 0xF9, 0x80, 0x00, 
-    0x46, 0x07, 0x40, 0x04, 0x44, 0x44, 0x44, 0x44, 0x40, 0x03, 0x2B, 0x06, 0x44, 0x44, 0x44, 0x44, 
-    0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x70, 0x00, 0x74, 0x44, 0x40, 0x00, 0x60, 0x06, 
-    0x04, 0x40, 0x0A, 0x30, 0x00, 0x0A, 0x38, 0x2F, 0xD8, 0x0A, 0xD8, 0x0F, 0x98, 0x0F, 0xD8, 0x20, 
-    0x98, 0x0A, 0x99, 0x80, 0x0A, 0x3C, 0x0A, 0x20, 0x00, 0x01, 0x20, 0x03, 0x8F, 0xA3, 0x80, 0x44, 
-    0x44, 0x44, 0x44, 0x47, 0x40, 0x64, 0x44, 0x44, 0x00, 0x40, 0xEE, 0x46, 0x64, 0x44, 0x44, 0x44, 
-    0x70, 0x44, 0x44, 0x44, 0x44, 0x44, 0x70, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x05, 
-    0x22, 0x22, 0x0A, 0x38, 0x05, 0x0A, 0x38, 0x2F, 0xD8, 0x0A, 0xD8, 0x0F, 0x98, 0x3F, 0xD8, 0x3F, 
-    0xD8, 0x0F, 0x02, 0xF3, 0x0A, 0x38, 0x0A, 0x52, 0xE2, 0x22, 0x00, 0xFD, 0x8A, 0xD8, 0x00, 0x44, 
-    0x44, 0x44, 0x40, 0x07, 0x00, 0x44, 0x44, 0x40, 0x00, 0x00, 0xBE, 0x46, 0x74, 0x44, 0x44, 0x44, 
-    0x00, 0x44, 0x60, 0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x05, 
-    0x55, 0x50, 0x0A, 0x38, 0x35, 0x0A, 0x38, 0x2F, 0xD8, 0x0A, 0xD8, 0x0F, 0x98, 0x0F, 0x99, 0x93, 
-    0x07, 0x0F, 0x08, 0xAD, 0x0A, 0x38, 0x0A, 0x99, 0x98, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x60, 0x44, 
-    0x44, 0x44, 0x03, 0x00, 0x50, 0x00, 0x44, 0x40, 0x00, 0x00, 0x22, 0x46, 0x04, 0x44, 0x44, 0x44, 
-    0x00, 0x46, 0x03, 0x30, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0A, 0x38, 0x05, 0x0A, 0x38, 0x3F, 0xD8, 0x0A, 0xD8, 0x0F, 0x08, 0x0F, 0x08, 0x30, 
-    0xA0, 0x0F, 0xD8, 0xC0, 0x99, 0x3C, 0x0A, 0x32, 0x2C, 0x00, 0x00, 0x00, 0xA2, 0x06, 0x47, 0x44, 
-    0x44, 0x03, 0x60, 0x00, 0x00, 0x07, 0x44, 0x44, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x44, 
-    0x05, 0x06, 0x67, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x70, 0x47, 0x00, 0x00, 0x00, 0x06, 
-    0x03, 0x00, 0x0A, 0x30, 0x05, 0x0A, 0x38, 0x0F, 0x08, 0x0A, 0xD8, 0x0F, 0x90, 0x0A, 0xD8, 0x0F, 
-    0x90, 0x0F, 0xD8, 0x20, 0x3A, 0x38, 0x0A, 0x28, 0x20, 0x05, 0x07, 0x00, 0xA5, 0x04, 0x40, 0x44, 
-    0x40, 0x50, 0x40, 0x00, 0x00, 0x76, 0x44, 0x44, 0x40, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x44, 
-    0x00, 0x07, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x52, 0x20, 0x52, 0x22, 0x50, 0x00, 0x04, 0x76, 
-    0x40, 0x00, 0x0A, 0xD8, 0x03, 0x03, 0x0A, 0xA3, 0x20, 0x60, 0x0A, 0x9D, 0x50, 0x0A, 0xD8, 0x0F, 
-    0x98, 0x2F, 0x08, 0x60, 0x0A, 0x3C, 0x0A, 0x0A, 0xA9, 0x3C, 0x00, 0x00, 0xA2, 0x04, 0x40, 0x44, 
-    0x00, 0x04, 0x70, 0x40, 0x00, 0x44, 0x44, 0x44, 0x40, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x53, 0x52, 0x35, 0x22, 0x20, 0x40, 0x04, 
-    0x00, 0x00, 0x0D, 0x58, 0x25, 0x0C, 0x0D, 0x92, 0x05, 0x02, 0x0D, 0x02, 0x86, 0x0A, 0x38, 0x00, 
-    0xD8, 0x0A, 0xD8, 0x60, 0x0A, 0x5C, 0x0A, 0xDD, 0xDD, 0x38, 0x00, 0x00, 0xA0, 0x44, 0x00, 0x00, 
-    0x00, 0x04, 0x07, 0x00, 0x60, 0x64, 0x44, 0x44, 0x46, 0x00, 0x00, 0x46, 0x06, 0x44, 0x46, 0x66, 
-    0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x03, 0x25, 0x55, 0x5C, 
-    0x00, 0x05, 0x22, 0x22, 0x20, 0x02, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x02, 0x22, 
-    0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x22, 0x25, 0x55, 0x07, 0x46, 0x00, 0x03, 0x00, 
-    0x00, 0x04, 0x64, 0x00, 0x60, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x06, 0x44, 0x46, 0x66, 
-    0x05, 0x55, 0x5C, 0x55, 0xCC, 0x55, 0x55, 0x0C, 0x00, 0x00, 0x00, 0x52, 0x50, 0x55, 0x22, 0x25, 
-    0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x60, 0x03, 0x00, 0x32, 0x03, 0x20, 0x00, 0x02, 0x22, 
-    0x22, 0x24, 0x00, 0x00, 0x00, 0x00, 0x06, 0x63, 0x22, 0x22, 0x55, 0x20, 0x00, 0x00, 0x00, 0x07, 
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x06, 0x46, 0x44, 0x64, 
-    0x70, 0x5C, 0xCC, 0x55, 0x5C, 0x00, 0x00, 0x55, 0x55, 0x55, 0x25, 0x55, 0x52, 0x22, 0x00, 0x00, 
-    0x00, 0x22, 0x20, 0x55, 0x35, 0x53, 0x55, 0xFA, 0x99, 0xA9, 0x20, 0x0A, 0x28, 0xFA, 0x99, 0x99, 
-    0x20, 0x0A, 0x8C, 0x23, 0x22, 0x0A, 0x99, 0x98, 0x22, 0x22, 0x22, 0x00, 0x06, 0x07, 0x00, 0x00, 
-    0x50, 0x00, 0xC0, 0x00, 0x00, 0x74, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x06, 0x40, 0x44, 0x37, 
-    0x00, 0xCC, 0xC0, 0xC5, 0x50, 0x00, 0x03, 0x25, 0x52, 0x25, 0x55, 0x55, 0x22, 0x22, 0x00, 0x03, 
-    0x00, 0x55, 0x50, 0x06, 0x00, 0x00, 0x07, 0xF9, 0x33, 0x03, 0x00, 0x09, 0x80, 0xF9, 0x33, 0xD3, 
-    0x22, 0xF9, 0x80, 0x20, 0x02, 0x09, 0x33, 0xD0, 0x32, 0x55, 0x5C, 0x00, 0x04, 0x44, 0x00, 0x30, 
-    0x00, 0x67, 0x74, 0x60, 0x50, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x07, 0x44, 0x44, 0x44, 
-    0x00, 0x00, 0xC0, 0x55, 0x50, 0x00, 0x00, 0x55, 0x50, 0x64, 0x40, 0x55, 0x22, 0x25, 0x07, 0x03, 
-    0x77, 0x04, 0x44, 0x44, 0x44, 0x44, 0x40, 0xF9, 0x08, 0x04, 0x0C, 0x09, 0x80, 0x0A, 0x0C, 0x22, 
-    0x2C, 0x0A, 0x80, 0x50, 0x40, 0x09, 0x80, 0x0A, 0x30, 0x22, 0x55, 0x50, 0x00, 0x00, 0x05, 0x00, 
-    0x06, 0x00, 0x00, 0x60, 0x20, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x77, 0x44, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0xC5, 0x50, 0x70, 0x06, 0x00, 0x00, 0x44, 0x44, 0x35, 0x20, 0x03, 0x77, 0x25, 
-    0x52, 0x20, 0x44, 0x66, 0x77, 0x44, 0x00, 0xF9, 0xDD, 0xD0, 0x22, 0x09, 0x84, 0x09, 0x3A, 0xD8, 
-    0x50, 0x09, 0x80, 0x05, 0x00, 0x0A, 0x20, 0x0A, 0x30, 0x22, 0x52, 0x22, 0x22, 0x00, 0x00, 0x00, 
-    0x04, 0x00, 0x07, 0x60, 0x00, 0x03, 0x30, 0x64, 0x44, 0x44, 0x44, 0x06, 0x60, 0x64, 0x44, 0x44, 
-    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x60, 0x00, 0x50, 0x20, 0x00, 0x40, 0x20, 0x00, 0x44, 0x03, 
-    0x25, 0x00, 0x04, 0x46, 0x70, 0x06, 0x77, 0xF9, 0x90, 0xD8, 0x30, 0xF9, 0x84, 0x09, 0x99, 0xD8, 
-    0x00, 0x09, 0x80, 0x00, 0x00, 0x0A, 0x80, 0x0A, 0x38, 0x55, 0x55, 0x52, 0x22, 0x70, 0x00, 0x74, 
-    0x44, 0x70, 0x04, 0x46, 0x76, 0x02, 0x33, 0x36, 0x44, 0x44, 0x44, 0x44, 0x46, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x70, 0x23, 0x70, 0x52, 0x00, 0x00, 0x77, 0x64, 0x60, 
-    0x00, 0x70, 0x64, 0x04, 0x60, 0x04, 0x60, 0xF9, 0x82, 0x52, 0x55, 0xF9, 0x84, 0x09, 0x88, 0x22, 
-    0x55, 0x09, 0x88, 0x50, 0x00, 0x0A, 0x80, 0x0A, 0x38, 0x55, 0x55, 0x55, 0x5C, 0x77, 0x67, 0x44, 
-    0x44, 0x44, 0x44, 0x75, 0x57, 0x62, 0x35, 0x33, 0x64, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x06, 
-    0x40, 0x00, 0x00, 0x00, 0x06, 0x77, 0x44, 0x46, 0x05, 0x00, 0x06, 0x70, 0x00, 0x76, 0x47, 0x00, 
-    0x03, 0x07, 0x64, 0x76, 0x45, 0x04, 0x07, 0xF9, 0x82, 0x30, 0xE0, 0x09, 0x24, 0x09, 0x20, 0xEE, 
-    0x22, 0x09, 0x22, 0x33, 0x3C, 0x0A, 0x22, 0x0A, 0x58, 0x55, 0x55, 0x50, 0x00, 0x44, 0x47, 0x44, 
-    0x04, 0x44, 0x60, 0x55, 0x00, 0x00, 0x35, 0x02, 0x34, 0x44, 0x44, 0x44, 0x44, 0x60, 0x44, 0x04, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x44, 0x40, 0x04, 0x47, 0x00, 0x00, 0x77, 0x77, 0x70, 
-    0x00, 0x67, 0x04, 0x66, 0x65, 0x74, 0x00, 0xF9, 0x88, 0x35, 0xE5, 0x09, 0x84, 0x09, 0x99, 0x99, 
-    0x20, 0x09, 0x99, 0x99, 0x38, 0x0A, 0x99, 0x98, 0x22, 0x55, 0x55, 0xCC, 0x00, 0x76, 0x40, 0x44, 
-    0x77, 0x44, 0x60, 0x30, 0x00, 0x44, 0x43, 0x33, 0x37, 0x44, 0x44, 0x44, 0x60, 0x00, 0x64, 0x04, 
-    0x25, 0x22, 0x22, 0x30, 0x00, 0x00, 0x06, 0x77, 0x70, 0x00, 0x05, 0x55, 0x53, 0x55, 0x55, 0x07, 
-    0x40, 0x60, 0x00, 0x06, 0x72, 0x00, 0x35, 0x33, 0x85, 0x35, 0x0B, 0x23, 0x84, 0x02, 0x52, 0x53, 
-    0x22, 0x23, 0x33, 0x33, 0x22, 0x23, 0x55, 0x58, 0x22, 0x55, 0x52, 0x55, 0xC0, 0x00, 0x04, 0x66, 
-    0x44, 0x46, 0x66, 0x00, 0x44, 0x44, 0x44, 0x03, 0x36, 0x64, 0x44, 0x44, 0x00, 0x66, 0x00, 0x06, 
-    0x70, 0x22, 0x52, 0x22, 0x33, 0x00, 0x00, 0x55, 0x55, 0x55, 0x2B, 0x22, 0x11, 0x1B, 0x22, 0x00, 
-    0x00, 0x60, 0x00, 0x36, 0x72, 0x22, 0x22, 0x22, 0x22, 0x33, 0x55, 0x50, 0x24, 0x02, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x55, 0x22, 0x52, 0x22, 0x55, 0x22, 0x55, 0x52, 0x55, 0x55, 0x55, 0x50, 0x53, 
-    0x00, 0x00, 0x03, 0x04, 0x44, 0x44, 0x44, 0x47, 0x74, 0x40, 0x06, 0x00, 0x66, 0x76, 0x46, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x35, 0x55, 0x55, 0x55, 0x55, 0x52, 0x22, 0x22, 0x01, 0x2B, 0x25, 0x00, 
-    0x06, 0x40, 0x52, 0x04, 0x03, 0x03, 0x23, 0x00, 0x00, 0x00, 0x05, 0x33, 0x04, 0x60, 0x22, 0x2B, 
-    0x05, 0x55, 0x22, 0x25, 0x55, 0x55, 0x22, 0x52, 0x25, 0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x30, 0x55, 0x00, 0x00, 0x77, 0x66, 0x66, 0x66, 0x66, 0x66, 0x06, 0x37, 0x00, 0x77, 0x60, 
-    0x00, 0x03, 0x33, 0x33, 0x35, 0x25, 0x55, 0x55, 0x55, 0x52, 0x22, 0x25, 0x52, 0x22, 0x50, 0x00, 
-    0x76, 0x40, 0x02, 0x04, 0x50, 0x00, 0x20, 0x00, 0x00, 0x03, 0x00, 0x02, 0x74, 0x00, 0x02, 0x25, 
-    0x02, 0x22, 0x52, 0x25, 0x52, 0x22, 0x22, 0x22, 0x25, 0x25, 0xC2, 0x55, 0x52, 0x22, 0x25, 0x53, 
-    0x33, 0x53, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x04, 0x70, 0x07, 0x77, 0x60, 
-    0x03, 0x33, 0x55, 0x35, 0x30, 0x33, 0x55, 0x55, 0x33, 0x55, 0x55, 0x55, 0x55, 0x55, 0x37, 0x06, 
-    0x76, 0x40, 0x30, 0x06, 0x50, 0x02, 0x30, 0x03, 0x00, 0x00, 0x00, 0x30, 0x40, 0x70, 0x51, 0x00, 
-    0x02, 0x22, 0x55, 0x52, 0x22, 0x22, 0x25, 0x5C, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x33, 
-    0x52, 0x35, 0x53, 0x33, 0x00, 0x03, 0x00, 0x00, 0x33, 0x30, 0x66, 0x06, 0x00, 0x57, 0x76, 0x60, 
-    0x30, 0x33, 0x33, 0x53, 0x33, 0x00, 0x33, 0x33, 0x55, 0x55, 0x22, 0x52, 0x22, 0x25, 0x30, 0x04, 
-    0x44, 0x70, 0x00, 0x64, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x70, 0x00, 0x0C, 0x05, 0x12, 0x00, 
-    0x35, 0x25, 0x53, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x52, 0x25, 0x55, 0x55, 
-    0x55, 0x22, 0x22, 0x22, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x40, 0x06, 0x77, 0x00, 0x07, 0x60, 
-    0x03, 0x33, 0x53, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x60, 0x07, 
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x53, 0x00, 0x00, 0x00, 0x0C, 0x55, 0x22, 0x20, 0x05, 
-    0x23, 0x22, 0x22, 0x22, 0xB0, 0x22, 0x21, 0x00, 0x02, 0x2B, 0x22, 0x22, 0x00, 0x22, 0x22, 0x35, 
-    0x55, 0x22, 0x22, 0x22, 0x23, 0x33, 0x53, 0x00, 0x30, 0x00, 0x40, 0x06, 0x70, 0x00, 0x77, 0x60, 
-    0x35, 0x33, 0x33, 0x33, 0x33, 0x35, 0x35, 0x22, 0x22, 0x23, 0x07, 0x44, 0x44, 0x44, 0x32, 0x33, 
-    0x33, 0x52, 0x22, 0x22, 0x22, 0x22, 0x2E, 0x22, 0x22, 0x25, 0x52, 0x22, 0x25, 0x00, 0x25, 0x05, 
-    0x52, 0x21, 0x11, 0x22, 0x22, 0x25, 0x2B, 0x20, 0x22, 0x21, 0x11, 0x22, 0x05, 0x22, 0x22, 0x22, 
-    0x23, 0x21, 0x22, 0xC2, 0x25, 0x55, 0x55, 0x33, 0x30, 0x04, 0x44, 0x06, 0x63, 0x70, 0x76, 0x00, 
-    0x33, 0x00, 0x30, 0x00, 0x35, 0x55, 0x55, 0x52, 0x50, 0x00, 0x00, 0x44, 0x40, 0x33, 0xE3, 0x02, 
-    0x22, 0x20, 0x2E, 0xBE, 0xE2, 0x22, 0x22, 0x22, 0x25, 0x05, 0x22, 0x22, 0x22, 0x00, 0x22, 0x02, 
-    0x53, 0x02, 0x22, 0x22, 0x25, 0x5C, 0x21, 0x20, 0x02, 0x21, 0x11, 0x12, 0x03, 0x21, 0x12, 0x11, 
-    0x50, 0x22, 0x22, 0x5C, 0xCC, 0x00, 0x05, 0x33, 0x33, 0x04, 0x44, 0x40, 0x46, 0x70, 0x64, 0x00, 
-    0x53, 0x00, 0x30, 0x00, 0x55, 0x53, 0x03, 0x00, 0x00, 0x00, 0x07, 0x60, 0x2B, 0x20, 0x00, 0x02, 
-    0x22, 0x04, 0x03, 0x22, 0x22, 0x25, 0x33, 0x03, 0x36, 0x02, 0x22, 0x22, 0x25, 0x30, 0x64, 0x44, 
-    0x00, 0x02, 0x55, 0x25, 0x22, 0x25, 0x22, 0x22, 0xB2, 0x0B, 0x11, 0x12, 0x03, 0x32, 0x25, 0x22, 
-    0x0C, 0x52, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x60, 0x64, 0x66, 0x46, 0x07, 
-    0x00, 0x00, 0x00, 0x55, 0x25, 0x55, 0x35, 0x36, 0x46, 0x66, 0x46, 0x70, 0xE2, 0x06, 0x00, 0x0C, 
-    0x30, 0x04, 0x60, 0x00, 0x22, 0x55, 0x00, 0x67, 0x77, 0x02, 0x22, 0x22, 0x22, 0x50, 0x04, 0x44, 
-    0x00, 0x05, 0x22, 0x22, 0x22, 0x25, 0x25, 0x55, 0x22, 0x22, 0x2B, 0x12, 0x22, 0x50, 0x03, 0x00, 
-    0x55, 0x02, 0x22, 0x25, 0x50, 0x0C, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x44, 0x40, 0x44, 
-    0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x56, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0x00, 0x00, 
-    0x00, 0x30, 0x52, 0x30, 0x25, 0x00, 0x00, 0x03, 0x53, 0x70, 0x55, 0x22, 0x22, 0x00, 0x20, 0x05, 
-    0x22, 0x50, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x55, 0x52, 0x22, 0x22, 0x25, 0x5C, 0x03, 
-    0x55, 0x32, 0x22, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x64, 0x44, 0x60, 0x44, 0x00, 0x44, 
-    0x05, 0x55, 0x53, 0x22, 0x22, 0x52, 0x55, 0x56, 0x05, 0x52, 0x22, 0x30, 0x05, 0x07, 0x07, 0x60, 
-    0x02, 0x22, 0x55, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xC5, 0x55, 0x52, 0x04, 0x50, 0x05, 
-    0x55, 0x20, 0x52, 0x22, 0x25, 0x22, 0x25, 0x23, 0x2E, 0x23, 0x30, 0x55, 0x2B, 0x22, 0x52, 0x25, 
-    0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x46, 0x40, 0x04, 0x44, 
-    0x25, 0x02, 0x22, 0x25, 0x52, 0x23, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C, 
-    0x23, 0x33, 0x30, 0x21, 0x00, 0x77, 0x44, 0x47, 0x00, 0x05, 0x00, 0x52, 0x22, 0x04, 0x02, 0x00, 
-    0x00, 0x33, 0x05, 0x22, 0x22, 0x22, 0x25, 0x20, 0x02, 0x24, 0x46, 0x02, 0x5E, 0xB2, 0x52, 0x25, 
-    0x22, 0x22, 0x25, 0x03, 0x35, 0x50, 0x00, 0x30, 0x05, 0x33, 0x00, 0x00, 0x66, 0x06, 0x44, 0x44, 
-    0x55, 0x55, 0x55, 0x55, 0x00, 0x50, 0x00, 0x74, 0x40, 0x07, 0x66, 0x67, 0x00, 0x67, 0x00, 0x05, 
-    0x33, 0x33, 0x33, 0x22, 0x40, 0x07, 0x00, 0x00, 0x53, 0x30, 0x00, 0x03, 0x23, 0x04, 0x42, 0x74, 
-    0x40, 0x33, 0x00, 0x55, 0x25, 0x22, 0x25, 0x50, 0x75, 0x20, 0x00, 0x05, 0x30, 0x22, 0x55, 0x52, 
-    0x25, 0x22, 0x22, 0x55, 0x55, 0x32, 0x23, 0x55, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x06, 0x64, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x46, 0x64, 0x44, 0x47, 0x70, 0x00, 0x02, 0x33, 
-    0xE3, 0xE5, 0x33, 0xE2, 0x75, 0x50, 0x05, 0x00, 0x33, 0x55, 0x00, 0x55, 0x20, 0x00, 0x40, 0x04, 
-    0x40, 0x53, 0x07, 0x00, 0x33, 0x33, 0x33, 0x30, 0x46, 0xEB, 0x2E, 0xE2, 0x25, 0x02, 0x22, 0x52, 
-    0x55, 0x55, 0x32, 0x22, 0x22, 0x52, 0x22, 0x22, 0x50, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x53, 0x3E, 
-    0x0E, 0xB5, 0x53, 0xB0, 0x65, 0x55, 0x53, 0x50, 0x30, 0x03, 0x00, 0x22, 0x04, 0x44, 0x40, 0x20, 
-    0x04, 0x40, 0x23, 0x03, 0x33, 0x33, 0x00, 0x00, 0x44, 0x32, 0x33, 0x23, 0x32, 0x00, 0x55, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x33, 0x53, 0x55, 0x53, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x25, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x20, 0x00, 0x02, 0x33, 0x2B, 
-    0xBE, 0x5E, 0x35, 0x24, 0x75, 0x53, 0x00, 0x30, 0x03, 0x33, 0x30, 0x05, 0x44, 0x44, 0x00, 0x00, 
-    0x40, 0x44, 0x42, 0xE2, 0x33, 0x00, 0x00, 0x04, 0x44, 0x73, 0x00, 0x00, 0x33, 0x30, 0x60, 0x33, 
-    0x35, 0x22, 0x22, 0x22, 0x22, 0x25, 0x33, 0x22, 0x55, 0x55, 0x55, 0x52, 0x53, 0x33, 0x33, 0x33, 
-    0x00, 0x00, 0x22, 0x55, 0x5E, 0xE5, 0x22, 0x5E, 0xE5, 0x53, 0x32, 0x20, 0x00, 0x33, 0x3E, 0x12, 
-    0x22, 0xE0, 0x3E, 0x04, 0x40, 0x30, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x44, 0x40, 0x04, 0x02, 
-    0x44, 0x44, 0x00, 0x05, 0x03, 0x30, 0x00, 0x04, 0x44, 0x60, 0x00, 0x03, 0x35, 0x50, 0x70, 0x00, 
-    0x00, 0x03, 0x52, 0x22, 0x22, 0x22, 0x22, 0x52, 0x23, 0x53, 0xC5, 0x55, 0x55, 0x33, 0x55, 0x33, 
-    0x00, 0x02, 0x33, 0x35, 0x35, 0xE0, 0x35, 0x25, 0x55, 0x55, 0x25, 0x00, 0x05, 0x33, 0xE1, 0x20, 
-    0x05, 0x33, 0x22, 0x44, 0x40, 0x33, 0x00, 0x00, 0x33, 0x30, 0x05, 0x52, 0x04, 0x00, 0x03, 0x62, 
-    0x00, 0x47, 0x23, 0x40, 0x03, 0x00, 0x00, 0x04, 0x44, 0x70, 0x70, 0x00, 0x00, 0x07, 0x40, 0x00, 
-    0x00, 0x35, 0x33, 0x52, 0x22, 0x22, 0x25, 0x52, 0x25, 0x53, 0xC5, 0x25, 0x03, 0x00, 0x05, 0x55, 
-    0x00, 0x0B, 0x33, 0x33, 0x33, 0x35, 0x33, 0x35, 0x02, 0x25, 0x00, 0x33, 0x23, 0x33, 0x22, 0x00, 
-    0x23, 0x35, 0x10, 0x60, 0x64, 0x02, 0x20, 0x00, 0x03, 0x23, 0x00, 0x04, 0x02, 0x04, 0x21, 0x25, 
-    0x52, 0xB4, 0x40, 0x00, 0x33, 0x33, 0x30, 0x06, 0x44, 0x60, 0x33, 0x55, 0x23, 0x33, 0x67, 0x00, 
-    0x33, 0x35, 0x23, 0x33, 0x35, 0x22, 0x22, 0x22, 0x25, 0x55, 0x55, 0x50, 0x00, 0x30, 0x03, 0x55, 
-    0x00, 0x40, 0x23, 0x2E, 0xEE, 0xE2, 0x22, 0x22, 0x30, 0x00, 0x03, 0x30, 0x33, 0x33, 0x07, 0x02, 
-    0x53, 0x31, 0x57, 0x70, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x64, 0x00, 0x44, 0x03, 0x24, 
-    0x50, 0x20, 0x40, 0x33, 0x33, 0x53, 0x33, 0x00, 0x64, 0x60, 0x00, 0x03, 0x33, 0x00, 0x44, 0x00, 
-    0x00, 0x00, 0x33, 0x00, 0x03, 0x22, 0x22, 0x03, 0x55, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x33, 0x00, 0x22, 0x25, 
-    0x33, 0xE2, 0x40, 0x00, 0x33, 0x30, 0x73, 0x00, 0x03, 0x33, 0x00, 0x44, 0x44, 0x44, 0x47, 0x44, 
-    0x00, 0x03, 0x03, 0x33, 0x55, 0x35, 0x33, 0x30, 0x00, 0x64, 0x44, 0x44, 0x44, 0x44, 0x46, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x25, 0x20, 0x35, 0x22, 0x53, 0x33, 0x03, 0x30, 0x00, 0x03, 
-    0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x33, 0x53, 0x30, 0x00, 0x00, 0x03, 0x33, 0xB0, 0xE5, 0xE3, 
-    0x3E, 0x26, 0x70, 0x05, 0x52, 0x22, 0x00, 0x00, 0x03, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x60, 0x35, 0x25, 0x33, 0x33, 0x35, 0x20, 0x00, 0x07, 0x76, 0x60, 0x64, 0x40, 0x00, 0x00, 
-    0x00, 0x33, 0x33, 0x33, 0x00, 0x33, 0x22, 0x22, 0x22, 0x25, 0x55, 0x33, 0x33, 0x33, 0x33, 0x30, 
-    0x00, 0x00, 0xC0, 0x03, 0x25, 0x35, 0x35, 0x53, 0x00, 0x00, 0x00, 0x33, 0x33, 0x35, 0x23, 0x33, 
-    0x22, 0x00, 0x00, 0x35, 0x52, 0x50, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-    0x33, 0x33, 0x03, 0x33, 0x33, 0x55, 0x22, 0x22, 0x25, 0x53, 0x55, 0x03, 0x53, 0x05, 0x25, 0x53, 
-    0x00, 0x33, 0x35, 0x52, 0x22, 0x22, 0x22, 0x53, 0x33, 0x33, 0x00, 0x23, 0x35, 0x2E, 0x53, 0x32, 
-    0x04, 0x70, 0x00, 0x00, 0x03, 0x03, 0x60, 0x70, 0x00, 0x00, 0x03, 0x30, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x03, 0x50, 0x00, 0x33, 0x03, 0x33, 0x30, 0x33, 0x35, 
-    0x25, 0x53, 0x33, 0x33, 0x35, 0x22, 0x22, 0x53, 0x35, 0x53, 0x35, 0x35, 0x22, 0x53, 0x35, 0x53, 
+const uint8_t STORY_CH5_RLE[STORY_CH5_RLE_SIZE] = {
+    0xF1, 0x6F, 0x07, 0x00, 0x02, 0x17, 0x02, 0xF1, 0x6D, 0x00, 0x20, 0xA0, 0x04, 0x22, 0x00, 0x00, 
+    0xF1, 0x1F, 0x04, 0xB1, 0x11, 0x20, 0xF1, 0x40, 0x01, 0x70, 0xE4, 0xF1, 0x1D, 0x08, 0x32, 0x15, 
+    0x21, 0x25, 0x20, 0xF1, 0x3D, 0x0A, 0x20, 0x46, 0x00, 0x44, 0x07, 0x70, 0xF1, 0x1C, 0x0A, 0x25, 
+    0x22, 0x52, 0x10, 0x52, 0x20, 0xF1, 0x3C, 0x03, 0x06, 0x44, 0x42, 0x02, 0x44, 0x40, 0x64, 0x00, 
+    0x00, 0xB3, 0xA0, 0x00, 0x20, 0xF1, 0x1F, 0x01, 0x22, 0xE1, 0xA2, 0xF1, 0x05, 0x01, 0x20, 0xA4, 
+    0x00, 0x60, 0x67, 0x01, 0xB5, 0xC3, 0x01, 0x05, 0x56, 0x01, 0x22, 0xB1, 0x04, 0x22, 0x21, 0x10, 
+    0xA2, 0x01, 0x02, 0x47, 0xB0, 0x01, 0x10, 0xE2, 0xA1, 0x03, 0x04, 0x47, 0xA4, 0x00, 0x00, 0x65, 
+    0x04, 0x20, 0x33, 0x30, 0xB0, 0x00, 0x50, 0x57, 0x03, 0x21, 0x11, 0xA2, 0x00, 0x10, 0xB2, 0x01, 
+    0x00, 0x47, 0x02, 0x11, 0x00, 0xF2, 0x01, 0x02, 0x02, 0x20, 0x42, 0xC0, 0x02, 0x23, 0x00, 0x64, 
+    0x06, 0x10, 0x73, 0x30, 0x70, 0xA0, 0x56, 0x12, 0x50, 0x21, 0x10, 0x32, 0x22, 0x00, 0x33, 0x30, 
+    0x00, 0x50, 0xF1, 0x02, 0xD2, 0x05, 0xEE, 0x20, 0x22, 0x42, 0xA2, 0x04, 0x11, 0x20, 0x00, 0xD1, 
+    0x00, 0x20, 0xF1, 0x15, 0xA3, 0xA0, 0x03, 0x20, 0x52, 0xF1, 0x0B, 0x00, 0x20, 0xA0, 0x01, 0x22, 
+    0xE0, 0x05, 0x50, 0x00, 0x32, 0xF1, 0x00, 0xA0, 0x01, 0x2E, 0xD2, 0x0C, 0x02, 0x22, 0x02, 0x12, 
+    0x02, 0x21, 0x50, 0x48, 0x00, 0x00, 0x5C, 0x09, 0x53, 0x31, 0x12, 0x21, 0x12, 0x53, 0x01, 0x12, 
+    0xD0, 0x0A, 0x52, 0x00, 0x05, 0x20, 0x00, 0x50, 0x49, 0xA2, 0x02, 0x1B, 0x10, 0xF2, 0x00, 0x01, 
+    0x32, 0xF0, 0x00, 0x46, 0x03, 0x20, 0x12, 0xF1, 0x0D, 0x07, 0x01, 0x11, 0x05, 0x30, 0x42, 0x00, 
+    0x20, 0x55, 0x01, 0x23, 0xD0, 0x01, 0x33, 0xF0, 0x01, 0x00, 0x20, 0xB1, 0x06, 0x0B, 0xB2, 0x02, 
+    0x20, 0xB1, 0xC2, 0x04, 0x12, 0x04, 0x40, 0xE0, 0x00, 0x20, 0xB1, 0xA2, 0x02, 0x12, 0x20, 0x56, 
+    0x0D, 0x20, 0x33, 0x30, 0x30, 0x00, 0x22, 0x2B, 0xF1, 0x0B, 0x00, 0x50, 0xD0, 0x04, 0x70, 0x07, 
+    0x40, 0xC0, 0x00, 0x50, 0xC1, 0x03, 0x0B, 0xB1, 0xB2, 0xA1, 0x46, 0xC0, 0x03, 0x77, 0x07, 0x4D, 
+    0x04, 0x25, 0x32, 0x20, 0xB1, 0x01, 0x22, 0xD1, 0x07, 0x21, 0x10, 0x33, 0x03, 0xE0, 0x01, 0xBB, 
+    0xD1, 0x00, 0xB0, 0xF1, 0x02, 0x00, 0x20, 0xC0, 0x06, 0x22, 0x00, 0x22, 0x20, 0x4B, 0x01, 0x01, 
+    0x47, 0x00, 0xB0, 0x4C, 0xA0, 0x48, 0x00, 0xB0, 0x42, 0x04, 0x11, 0x20, 0x00, 0xB1, 0x00, 0x40, 
+    0x48, 0x02, 0x23, 0x30, 0xD0, 0x04, 0x20, 0x52, 0xB0, 0xE1, 0x4C, 0x0B, 0x20, 0x02, 0x11, 0x12, 
+    0x21, 0x11, 0xC0, 0x00, 0xB0, 0xC1, 0x46, 0x02, 0xB1, 0xB0, 0xC2, 0x03, 0x13, 0x77, 0x51, 0x00, 
+    0x20, 0x44, 0x00, 0x10, 0x45, 0x00, 0x00, 0xE1, 0x43, 0x02, 0x23, 0x30, 0x43, 0x02, 0x30, 0x20, 
+    0xF1, 0x00, 0x4C, 0x00, 0x00, 0x4C, 0x00, 0x20, 0x47, 0x0C, 0x10, 0x22, 0x52, 0x52, 0x11, 0x10, 
+    0x00, 0xA2, 0x02, 0x00, 0x00, 0x48, 0x00, 0x00, 0x4A, 0x00, 0x20, 0xA1, 0x00, 0x20, 0x4C, 0x04, 
+    0x20, 0x13, 0x30, 0xA0, 0x05, 0x30, 0x00, 0x50, 0x45, 0x00, 0xB0, 0x53, 0x1D, 0x22, 0x25, 0x52, 
+    0x22, 0x05, 0x03, 0x00, 0x01, 0xBB, 0x11, 0xBB, 0x0B, 0x23, 0x53, 0x51, 0xD2, 0x03, 0x02, 0x07, 
+    0x49, 0x03, 0x21, 0x11, 0xF2, 0x00, 0x53, 0x0F, 0x05, 0x33, 0x00, 0x50, 0x00, 0x32, 0x00, 0x2B, 
+    0xA1, 0x00, 0x00, 0x50, 0x00, 0x50, 0xF0, 0x07, 0x03, 0x11, 0x02, 0xA1, 0x08, 0xB0, 0x53, 0x22, 
+    0x2B, 0x00, 0xE3, 0x03, 0x00, 0x33, 0x58, 0x01, 0x13, 0xB1, 0x00, 0x20, 0xD1, 0x04, 0x02, 0x22, 
+    0x50, 0xD0, 0x00, 0x20, 0x42, 0x01, 0x1B, 0x4C, 0x01, 0xBB, 0x44, 0xF0, 0x08, 0xF2, 0x01, 0x05, 
+    0x35, 0x22, 0x55, 0xF3, 0x05, 0x00, 0x00, 0xC3, 0x03, 0x02, 0x12, 0x48, 0x00, 0x20, 0x43, 0x00, 
+    0xB0, 0x4A, 0x04, 0x22, 0x21, 0x20, 0xE0, 0x42, 0x0B, 0xB0, 0xB0, 0x12, 0x11, 0xB0, 0x12, 0x43, 
+    0x03, 0x21, 0x22, 0x52, 0x03, 0x00, 0x67, 0xF3, 0x0C, 0x03, 0x07, 0x66, 0xE0, 0x1E, 0x55, 0x12, 
+    0x20, 0x20, 0x52, 0x20, 0x22, 0x0E, 0x21, 0x13, 0x00, 0x11, 0x10, 0x21, 0x22, 0x10, 0xC2, 0x00, 
+    0x50, 0x49, 0x00, 0x00, 0xB2, 0x0F, 0x51, 0x22, 0x2B, 0x02, 0x21, 0x22, 0x02, 0x20, 0x44, 0x00, 
+    0x70, 0xF0, 0x05, 0x05, 0x76, 0x67, 0x00, 0xF3, 0x03, 0x04, 0x00, 0x07, 0x70, 0xB6, 0x03, 0x00, 
+    0x07, 0xA6, 0x00, 0x30, 0xE0, 0x03, 0x50, 0x05, 0xA0, 0x13, 0x12, 0x00, 0x05, 0x12, 0x00, 0xE0, 
+    0x02, 0x02, 0x20, 0xC5, 0xA0, 0x01, 0x55, 0x46, 0x0E, 0x50, 0x22, 0x02, 0x20, 0x22, 0x00, 0x2B, 
+    0x20, 0xB0, 0x06, 0x30, 0x00, 0x50, 0x40, 0xC1, 0x01, 0x24, 0xB0, 0x0E, 0x70, 0x70, 0x07, 0x00, 
+    0x03, 0x30, 0x33, 0x30, 0xA0, 0xF6, 0x01, 0x01, 0x07, 0xC4, 0xF0, 0x20, 0x00, 0x30, 0x46, 0xF0, 
+    0x13, 0x04, 0x11, 0x1B, 0x00, 0x46, 0x02, 0x40, 0x60, 0xF0, 0x01, 0x02, 0x70, 0x70, 0xA6, 0xF4, 
+    0x08, 0xF0, 0x05, 0x00, 0x70, 0xF0, 0x0A, 0x00, 0x70, 0x45, 0x03, 0x30, 0x0C, 0x4B, 0x03, 0x20, 
+    0x02, 0xC0, 0x00, 0x60, 0x49, 0x01, 0x11, 0x42, 0x03, 0x30, 0x2C, 0xF0, 0x07, 0xF4, 0x0C, 0x05, 
+    0x00, 0x67, 0x07, 0xF0, 0x08, 0x00, 0x70, 0xF0, 0x02, 0xBA, 0x06, 0x32, 0x00, 0x0D, 0xD0, 0xB0, 
+    0x0B, 0x30, 0x00, 0xD8, 0x00, 0xDD, 0xD3, 0xA0, 0x00, 0x30, 0xA0, 0x04, 0xA3, 0xC0, 0xA0, 0xAD, 
+    0x0A, 0xE0, 0x00, 0x3C, 0x35, 0x0D, 0xC0, 0xF0, 0x04, 0x00, 0x60, 0xE4, 0x04, 0x03, 0x37, 0x60, 
+    0x48, 0xF4, 0x08, 0x01, 0x00, 0xA4, 0x03, 0x00, 0x44, 0xA0, 0x0D, 0x40, 0xA0, 0x99, 0x9D, 0x83, 
+    0x3F, 0xD9, 0xA0, 0x13, 0xAD, 0x80, 0xF9, 0x83, 0xF9, 0xD9, 0xD0, 0x70, 0xF0, 0x06, 0x42, 0x1B, 
+    0x80, 0xA9, 0xDD, 0x93, 0x00, 0xA5, 0x83, 0x0F, 0x98, 0x00, 0x04, 0x60, 0x74, 0x00, 0xF4, 0x01, 
+    0x05, 0x00, 0x32, 0xB0, 0x56, 0x05, 0x07, 0x00, 0x07, 0x44, 0x0B, 0x06, 0x00, 0x60, 0x44, 0x00, 
+    0xA3, 0xA0, 0x06, 0xA3, 0x82, 0xFD, 0x80, 0x46, 0x0C, 0x0F, 0xD8, 0x20, 0x98, 0x0A, 0x99, 0x80, 
+    0x42, 0x03, 0xC0, 0xA2, 0xA0, 0x0A, 0x12, 0x00, 0x38, 0xFA, 0x38, 0x00, 0xF4, 0x00, 0x03, 0x74, 
+    0x06, 0xB4, 0x08, 0x00, 0x40, 0xEE, 0x46, 0x60, 0xD4, 0x00, 0x70, 0x49, 0x00, 0x70, 0xE0, 0x02, 
+    0x44, 0x40, 0xD0, 0x00, 0x50, 0xA2, 0x05, 0x0A, 0x38, 0x05, 0x4E, 0x22, 0x3F, 0xD8, 0x3F, 0xD8, 
+    0x0F, 0x02, 0xF3, 0x0A, 0x38, 0x0A, 0x52, 0xE2, 0x22, 0x00, 0xFD, 0x8A, 0xD8, 0x00, 0x46, 0x04, 
+    0x00, 0x70, 0x00, 0xB4, 0xB0, 0x04, 0xBE, 0x46, 0x70, 0xD4, 0x09, 0x00, 0x44, 0x60, 0x00, 0x44, 
+    0xD0, 0x00, 0x70, 0x4C, 0x03, 0x55, 0x50, 0x42, 0x00, 0x30, 0x4F, 0x0D, 0x0F, 0x99, 0x93, 0x07, 
+    0x0F, 0x08, 0xAD, 0x44, 0x03, 0x99, 0x98, 0xC0, 0x04, 0xA2, 0x00, 0x60, 0x45, 0x07, 0x03, 0x00, 
+    0x50, 0x00, 0x46, 0x04, 0x22, 0x46, 0x00, 0x48, 0x07, 0x60, 0x33, 0x00, 0x07, 0xF0, 0x00, 0xB4, 
+    0xF0, 0x03, 0x03, 0xA3, 0x80, 0x43, 0x00, 0x30, 0x47, 0x19, 0x08, 0x0F, 0x08, 0x30, 0xA0, 0x0F, 
+    0xD8, 0xC0, 0x99, 0x3C, 0x0A, 0x32, 0x2C, 0x47, 0x02, 0x64, 0x70, 0xA4, 0x02, 0x03, 0x60, 0xC0, 
+    0x00, 0x70, 0xA4, 0xC0, 0x01, 0x44, 0x47, 0x08, 0x50, 0x66, 0x70, 0x00, 0x70, 0xD0, 0x06, 0x20, 
+    0x07, 0x04, 0x70, 0xD0, 0x02, 0x60, 0x30, 0x43, 0x00, 0x00, 0x44, 0x02, 0x0F, 0x00, 0x45, 0x08, 
+    0x90, 0x0A, 0xD8, 0x0F, 0x90, 0x43, 0x1E, 0x20, 0x3A, 0x38, 0x0A, 0x28, 0x20, 0x05, 0x07, 0x00, 
+    0xA5, 0x04, 0x40, 0x44, 0x40, 0x50, 0x40, 0xB0, 0x01, 0x76, 0xB4, 0x4E, 0x03, 0x00, 0x77, 0x42, 
+    0x0F, 0x00, 0x07, 0x70, 0x05, 0x22, 0x05, 0x22, 0x25, 0xA0, 0x03, 0x47, 0x64, 0xA0, 0x13, 0xAD, 
+    0x80, 0x30, 0x30, 0xAA, 0x32, 0x06, 0x00, 0xA9, 0xD5, 0x46, 0x12, 0x82, 0xF0, 0x86, 0x00, 0xA3, 
+    0xC0, 0xA0, 0xAA, 0x93, 0xC0, 0xA0, 0x01, 0xA2, 0x44, 0x09, 0x00, 0x04, 0x70, 0x40, 0x00, 0xD4, 
+    0x50, 0xA0, 0x00, 0xC0, 0xF0, 0x00, 0x0E, 0x35, 0x35, 0x23, 0x52, 0x22, 0x04, 0x00, 0x40, 0xB0, 
+    0x1F, 0xD5, 0x82, 0x50, 0xC0, 0xD9, 0x20, 0x50, 0x20, 0xD0, 0x28, 0x60, 0xA3, 0x80, 0x0D, 0x80, 
+    0xAD, 0x43, 0x03, 0x5C, 0x0A, 0xAD, 0x01, 0x38, 0x43, 0x02, 0x04, 0x40, 0xD0, 0x07, 0x40, 0x70, 
+    0x06, 0x06, 0xC4, 0x00, 0x60, 0x43, 0x0A, 0x60, 0x64, 0x44, 0x66, 0x60, 0x00, 0xF5, 0x00, 0xF0, 
+    0x02, 0x04, 0x35, 0x03, 0x20, 0xA5, 0x04, 0xC0, 0x00, 0x50, 0xB2, 0x04, 0x00, 0x22, 0xC0, 0xF0, 
+    0x01, 0x04, 0x30, 0x07, 0x00, 0xB2, 0x01, 0x04, 0xF0, 0x00, 0x01, 0x70, 0xA2, 0x0A, 0x55, 0x50, 
+    0x74, 0x60, 0x00, 0x30, 0x44, 0x01, 0x64, 0x42, 0x00, 0x00, 0xF4, 0x02, 0x01, 0x04, 0x47, 0xA5, 
+    0x04, 0xC5, 0x5C, 0xC0, 0xA5, 0x01, 0x0C, 0xC0, 0x0B, 0x52, 0x50, 0x55, 0x22, 0x25, 0x00, 0xF2, 
+    0x03, 0x0A, 0x60, 0x03, 0x00, 0x32, 0x03, 0x20, 0xA0, 0xC2, 0x48, 0x02, 0x66, 0x30, 0xA2, 0x02, 
+    0x55, 0x20, 0xE0, 0x00, 0x70, 0xF0, 0x00, 0x00, 0x60, 0x4F, 0x0E, 0x64, 0x46, 0x47, 0x05, 0xCC, 
+    0xC5, 0x55, 0xC0, 0xA0, 0xC5, 0x00, 0x20, 0xA5, 0x02, 0x22, 0x20, 0xC0, 0x19, 0x22, 0x20, 0x55, 
+    0x35, 0x53, 0x55, 0xFA, 0x99, 0xA9, 0x20, 0x0A, 0x28, 0xFA, 0xA9, 0x0F, 0x20, 0x0A, 0x8C, 0x23, 
+    0x22, 0x0A, 0x99, 0x98, 0xC2, 0x05, 0x00, 0x06, 0x07, 0xA0, 0x04, 0x50, 0x00, 0xC0, 0xB0, 0x00, 
+    0x70, 0xF4, 0x04, 0x10, 0x06, 0x40, 0x44, 0x37, 0x00, 0xCC, 0xC0, 0xC5, 0x50, 0xA0, 0x05, 0x32, 
+    0x55, 0x22, 0xB5, 0xA2, 0x0B, 0x00, 0x03, 0x00, 0x55, 0x50, 0x06, 0xB0, 0x3D, 0x7F, 0x93, 0x30, 
+    0x30, 0x00, 0x98, 0x0F, 0x93, 0x3D, 0x32, 0x2F, 0x98, 0x02, 0x00, 0x20, 0x93, 0x3D, 0x03, 0x25, 
+    0x55, 0xC0, 0x00, 0x44, 0x40, 0x03, 0x00, 0x06, 0x77, 0x46, 0x05, 0x00, 0x4C, 0x00, 0x70, 0xC4, 
+    0xA0, 0x02, 0xC0, 0x50, 0x44, 0x08, 0x05, 0x55, 0x06, 0x44, 0x00, 0x43, 0x07, 0x50, 0x70, 0x37, 
+    0x70, 0xF4, 0x01, 0x08, 0x0F, 0x90, 0x80, 0x40, 0xC0, 0x42, 0x1C, 0x0A, 0x0C, 0x22, 0x2C, 0x0A, 
+    0x80, 0x50, 0x40, 0x09, 0x80, 0x0A, 0x30, 0x22, 0x55, 0x50, 0xC0, 0x04, 0x50, 0x00, 0x60, 0xA0, 
+    0x02, 0x60, 0x20, 0x4D, 0x00, 0x70, 0x49, 0x09, 0x00, 0xC5, 0x50, 0x70, 0x06, 0xA0, 0xA4, 0x36, 
+    0x35, 0x20, 0x03, 0x77, 0x25, 0x52, 0x20, 0x44, 0x66, 0x77, 0x44, 0x00, 0xF9, 0xDD, 0xD0, 0x22, 
+    0x09, 0x84, 0x09, 0x3A, 0xD8, 0x50, 0x09, 0x80, 0x05, 0x00, 0x0A, 0x20, 0x46, 0xB2, 0xD0, 0x05, 
+    0x40, 0x00, 0x76, 0xA0, 0x03, 0x33, 0x06, 0xD4, 0x04, 0x06, 0x60, 0x60, 0x4A, 0x00, 0xC0, 0xA0, 
+    0x2A, 0x60, 0x00, 0x50, 0x20, 0x00, 0x40, 0x20, 0x00, 0x44, 0x03, 0x25, 0x00, 0x04, 0x46, 0x70, 
+    0x06, 0x77, 0xF9, 0x90, 0xD8, 0x30, 0xF0, 0x43, 0x04, 0x99, 0xD8, 0x00, 0x44, 0xA0, 0x01, 0xA8, 
+    0x42, 0x00, 0x80, 0xB5, 0x18, 0x22, 0x27, 0x00, 0x07, 0x44, 0x47, 0x00, 0x44, 0x67, 0x60, 0x23, 
+    0x33, 0x60, 0xF4, 0x00, 0x00, 0x60, 0xF0, 0x09, 0x09, 0x66, 0x70, 0x23, 0x70, 0x52, 0xA0, 0x1B, 
+    0x77, 0x64, 0x60, 0x00, 0x70, 0x64, 0x04, 0x60, 0x04, 0x60, 0xF9, 0x82, 0x52, 0x55, 0x44, 0x0A, 
+    0x88, 0x22, 0x55, 0x09, 0x88, 0x50, 0x4E, 0x06, 0x55, 0xC7, 0x76, 0x70, 0xE4, 0x0A, 0x75, 0x57, 
+    0x62, 0x35, 0x33, 0x60, 0xF4, 0x01, 0x05, 0x04, 0x40, 0x64, 0xE0, 0x0D, 0x67, 0x74, 0x44, 0x60, 
+    0x50, 0x00, 0x67, 0x42, 0x12, 0x64, 0x70, 0x00, 0x30, 0x76, 0x47, 0x64, 0x50, 0x40, 0x70, 0x42, 
+    0x1E, 0x30, 0xE0, 0x09, 0x24, 0x09, 0x20, 0xEE, 0x22, 0x09, 0x22, 0x33, 0x3C, 0x0A, 0x22, 0x0A, 
+    0x50, 0x44, 0x10, 0x00, 0x04, 0x44, 0x74, 0x40, 0x44, 0x46, 0x05, 0x50, 0xA0, 0x04, 0x35, 0x02, 
+    0x30, 0xF4, 0x00, 0x00, 0x60, 0x42, 0x00, 0x40, 0xF0, 0x00, 0xE4, 0x04, 0x00, 0x44, 0x70, 0xA0, 
+    0xB7, 0x1B, 0x00, 0x06, 0x70, 0x46, 0x66, 0x57, 0x40, 0x0F, 0x98, 0x83, 0x5E, 0x50, 0x98, 0x40, 
+    0xB9, 0x02, 0x20, 0x00, 0xB9, 0x09, 0x38, 0x0A, 0x99, 0x98, 0x22, 0xA5, 0x0B, 0xCC, 0x00, 0x76, 
+    0x40, 0x44, 0x77, 0x42, 0x06, 0x30, 0x00, 0x44, 0x40, 0xA3, 0x00, 0x70, 0xC4, 0x09, 0x60, 0x00, 
+    0x64, 0x04, 0x25, 0xA2, 0x00, 0x30, 0xC0, 0x03, 0x67, 0x77, 0xA0, 0xA5, 0x00, 0x30, 0xA5, 0x04, 
+    0x07, 0x40, 0x60, 0xA0, 0x1B, 0x67, 0x20, 0x03, 0x53, 0x38, 0x53, 0x50, 0xB2, 0x38, 0x40, 0x25, 
+    0x25, 0x32, 0x22, 0xB3, 0x06, 0x22, 0x23, 0x55, 0x50, 0x44, 0x03, 0x25, 0x5C, 0xA0, 0x0A, 0x46, 
+    0x64, 0x44, 0x66, 0x60, 0x00, 0xC4, 0x04, 0x03, 0x36, 0x60, 0xB4, 0x11, 0x00, 0x66, 0x00, 0x06, 
+    0x70, 0x22, 0x52, 0x22, 0x33, 0xA0, 0xC5, 0x09, 0x2B, 0x22, 0x11, 0x1B, 0x22, 0xA0, 0x42, 0x02, 
+    0x36, 0x70, 0xF2, 0x00, 0x08, 0x33, 0x55, 0x50, 0x24, 0x00, 0xF2, 0x02, 0x09, 0x55, 0x22, 0x52, 
+    0x22, 0x55, 0x46, 0xB5, 0x02, 0x05, 0x30, 0xB0, 0x01, 0x30, 0xE4, 0x0F, 0x77, 0x44, 0x00, 0x60, 
+    0x06, 0x67, 0x64, 0x66, 0xF0, 0x00, 0x00, 0x30, 0xF5, 0x01, 0xB2, 0x15, 0x01, 0x2B, 0x25, 0x00, 
+    0x06, 0x40, 0x52, 0x04, 0x03, 0x03, 0x23, 0xD0, 0x11, 0x53, 0x30, 0x46, 0x02, 0x22, 0xB0, 0x55, 
+    0x52, 0x22, 0xB5, 0x06, 0x22, 0x52, 0x25, 0xC0, 0xF5, 0x06, 0x03, 0x30, 0x55, 0xA0, 0x01, 0x77, 
+    0xF6, 0x01, 0x07, 0x06, 0x37, 0x00, 0x77, 0x43, 0xC3, 0x01, 0x52, 0x4A, 0x15, 0x55, 0x22, 0x25, 
+    0x00, 0x07, 0x64, 0x00, 0x20, 0x45, 0x00, 0x02, 0xC0, 0x11, 0x30, 0x00, 0x27, 0x40, 0x00, 0x22, 
+    0x50, 0x22, 0x25, 0x42, 0xE2, 0x07, 0x52, 0x5C, 0x25, 0x55, 0xA2, 0x07, 0x55, 0x33, 0x35, 0x33, 
+    0xF0, 0x06, 0x07, 0x74, 0x04, 0x70, 0x07, 0x43, 0x0A, 0x33, 0x35, 0x53, 0x53, 0x03, 0x30, 0xA5, 
+    0x01, 0x33, 0xF5, 0x01, 0x03, 0x37, 0x06, 0x42, 0x0B, 0x30, 0x06, 0x50, 0x02, 0x30, 0x03, 0xC0, 
+    0x09, 0x30, 0x40, 0x70, 0x51, 0x00, 0x43, 0x01, 0x55, 0xC2, 0x03, 0x55, 0xC5, 0xF2, 0x03, 0x0E, 
+    0x53, 0x35, 0x23, 0x55, 0x33, 0x30, 0x00, 0x30, 0xA0, 0x11, 0x33, 0x30, 0x66, 0x06, 0x00, 0x57, 
+    0x76, 0x60, 0x30, 0xA3, 0x05, 0x53, 0x33, 0x00, 0xA3, 0xA5, 0x02, 0x22, 0x50, 0xA2, 0x10, 0x53, 
+    0x00, 0x44, 0x47, 0x00, 0x06, 0x40, 0x00, 0x30, 0xB0, 0x03, 0xC0, 0x07, 0xA0, 0x0C, 0xC0, 0x51, 
+    0x20, 0x03, 0x52, 0x55, 0x30, 0x45, 0xF2, 0x01, 0x03, 0x55, 0x22, 0xD5, 0xC2, 0x42, 0x00, 0x30, 
+    0xD0, 0x11, 0x40, 0x06, 0x77, 0x00, 0x07, 0x60, 0x03, 0x33, 0x53, 0xF0, 0x00, 0x00, 0x50, 0xC2, 
+    0xC0, 0x04, 0x60, 0x07, 0x70, 0xF0, 0x02, 0x03, 0x22, 0x53, 0xD0, 0x0A, 0xC5, 0x52, 0x22, 0x00, 
+    0x52, 0x30, 0xC2, 0x0B, 0xB0, 0x22, 0x21, 0x00, 0x02, 0x2B, 0xA2, 0x01, 0x00, 0xA2, 0x00, 0x30, 
+    0x47, 0x08, 0x23, 0x33, 0x53, 0x00, 0x30, 0x46, 0x08, 0x00, 0x07, 0x76, 0x03, 0x50, 0xF3, 0x00, 
+    0x02, 0x53, 0x50, 0xB2, 0x02, 0x30, 0x70, 0xC4, 0x01, 0x32, 0xA3, 0x00, 0x50, 0xF2, 0x01, 0x00, 
+    0xE0, 0xB2, 0x01, 0x55, 0xA2, 0x0C, 0x50, 0x02, 0x50, 0x55, 0x22, 0x11, 0x10, 0xB2, 0x0E, 0x52, 
+    0xB2, 0x02, 0x22, 0x11, 0x12, 0x20, 0x50, 0xD2, 0x07, 0x32, 0x12, 0x2C, 0x22, 0xB5, 0x1A, 0x33, 
+    0x30, 0x04, 0x44, 0x06, 0x63, 0x70, 0x76, 0x00, 0x33, 0x00, 0x30, 0x00, 0x30, 0xC5, 0x01, 0x25, 
+    0xB0, 0x08, 0x44, 0x40, 0x33, 0xE3, 0x00, 0xA2, 0x05, 0x02, 0xEB, 0xEE, 0xE2, 0x02, 0x50, 0x50, 
+    0xC2, 0x08, 0x00, 0x22, 0x02, 0x53, 0x00, 0xC2, 0x07, 0x55, 0xC2, 0x12, 0x00, 0x43, 0x0B, 0x12, 
+    0x03, 0x21, 0x12, 0x11, 0x50, 0xA2, 0x06, 0x5C, 0xCC, 0x00, 0x00, 0x42, 0x00, 0x30, 0x42, 0x0A, 
+    0x40, 0x46, 0x70, 0x64, 0x00, 0x50, 0x45, 0x05, 0x55, 0x53, 0x03, 0xD0, 0x05, 0x76, 0x02, 0xB2, 
+    0xA0, 0x06, 0x22, 0x20, 0x40, 0x30, 0xB2, 0x07, 0x53, 0x30, 0x33, 0x60, 0xC2, 0x12, 0x53, 0x06, 
+    0x44, 0x40, 0x00, 0x25, 0x52, 0x52, 0x22, 0x50, 0xA2, 0x03, 0xB2, 0x0B, 0x44, 0x08, 0x32, 0x25, 
+    0x22, 0x0C, 0x50, 0xB2, 0x00, 0x50, 0xF0, 0x00, 0x0D, 0x74, 0x00, 0x60, 0x64, 0x66, 0x46, 0x07, 
+    0xC0, 0x2B, 0x55, 0x25, 0x55, 0x35, 0x36, 0x46, 0x66, 0x46, 0x70, 0xE2, 0x06, 0x00, 0x0C, 0x30, 
+    0x04, 0x60, 0x00, 0x22, 0x55, 0x00, 0x67, 0x77, 0x45, 0x03, 0x25, 0x00, 0x44, 0x00, 0x50, 0xD2, 
+    0x04, 0x52, 0x55, 0x50, 0xB2, 0x0D, 0xB1, 0x22, 0x25, 0x00, 0x30, 0x05, 0x50, 0xA2, 0x04, 0x55, 
+    0x00, 0xC0, 0xC0, 0xC4, 0x00, 0x00, 0xA4, 0x02, 0x04, 0x40, 0xC0, 0xE2, 0x02, 0x56, 0x70, 0xA0, 
+    0x01, 0x77, 0xA0, 0x00, 0x70, 0xC0, 0x07, 0x30, 0x52, 0x30, 0x25, 0xB0, 0x06, 0x35, 0x37, 0x05, 
+    0x50, 0xA2, 0x09, 0x00, 0x20, 0x05, 0x22, 0x50, 0xF2, 0x04, 0xA5, 0xC2, 0x0D, 0x55, 0xC0, 0x35, 
+    0x53, 0x22, 0x20, 0x0C, 0xF0, 0x01, 0x09, 0x76, 0x44, 0x46, 0x04, 0x40, 0x42, 0xA5, 0x00, 0x30, 
+    0xA2, 0x1D, 0x52, 0x55, 0x56, 0x05, 0x52, 0x22, 0x30, 0x05, 0x07, 0x07, 0x60, 0x02, 0x22, 0x55, 
+    0xB5, 0xF0, 0x02, 0x01, 0x5C, 0xA5, 0x0B, 0x20, 0x45, 0x00, 0x55, 0x52, 0x05, 0xA2, 0x16, 0x52, 
+    0x22, 0x52, 0x32, 0xE2, 0x33, 0x05, 0x52, 0xB2, 0x25, 0x22, 0x50, 0xB2, 0xF0, 0x08, 0x0C, 0x74, 
+    0x46, 0x40, 0x04, 0x44, 0x25, 0x00, 0xA2, 0x09, 0x55, 0x22, 0x30, 0x00, 0x64, 0xF0, 0x01, 0x05, 
+    0x40, 0x00, 0xC2, 0xA3, 0x0A, 0x02, 0x10, 0x07, 0x74, 0x44, 0x70, 0x42, 0x09, 0x00, 0x52, 0x22, 
+    0x04, 0x02, 0xA0, 0x03, 0x33, 0x05, 0xD2, 0x0D, 0x52, 0x00, 0x22, 0x44, 0x60, 0x25, 0xEB, 0x48, 
+    0x0E, 0x50, 0x33, 0x55, 0x00, 0x03, 0x00, 0x53, 0x30, 0xA0, 0x03, 0x66, 0x06, 0xA4, 0xE5, 0x17, 
+    0x00, 0x50, 0x00, 0x74, 0x40, 0x07, 0x66, 0x67, 0x00, 0x67, 0x00, 0x05, 0xC3, 0x05, 0x22, 0x40, 
+    0x07, 0xA0, 0x02, 0x53, 0x30, 0xA0, 0x09, 0x32, 0x30, 0x44, 0x27, 0x44, 0x42, 0x04, 0x05, 0x52, 
+    0x50, 0x42, 0x04, 0x50, 0x75, 0x20, 0xA0, 0x0A, 0x53, 0x02, 0x25, 0x55, 0x22, 0x50, 0xA2, 0xA5, 
+    0x06, 0x32, 0x23, 0x55, 0x00, 0xA3, 0xE0, 0x02, 0x66, 0x40, 0xF0, 0x05, 0x04, 0x64, 0x46, 0x60, 
+    0xA4, 0x01, 0x77, 0xA0, 0x2A, 0x23, 0x3E, 0x3E, 0x53, 0x3E, 0x27, 0x55, 0x00, 0x50, 0x03, 0x35, 
+    0x50, 0x05, 0x52, 0x00, 0x04, 0x00, 0x44, 0x05, 0x30, 0x70, 0x00, 0xD3, 0x10, 0x04, 0x6E, 0xB2, 
+    0xEE, 0x22, 0x50, 0x22, 0x25, 0x20, 0xA5, 0x00, 0x30, 0xB2, 0x00, 0x50, 0xB2, 0x03, 0x50, 0x00, 
+    0x47, 0xF0, 0x02, 0x01, 0x55, 0xC3, 0xC0, 0x00, 0x40, 0xB0, 0x0C, 0x53, 0x3E, 0x0E, 0xB5, 0x53, 
+    0xB0, 0x60, 0xA5, 0x0B, 0x35, 0x03, 0x00, 0x30, 0x02, 0x20, 0xA4, 0x09, 0x02, 0x00, 0x44, 0x02, 
+    0x30, 0xB3, 0xA0, 0x0D, 0x44, 0x32, 0x33, 0x23, 0x32, 0x00, 0x55, 0xF2, 0x0A, 0x08, 0x53, 0x35, 
+    0x35, 0x55, 0x30, 0xF0, 0x02, 0x02, 0x32, 0x50, 0x46, 0xB3, 0x01, 0x52, 0xA0, 0x15, 0x23, 0x32, 
+    0xBB, 0xE5, 0xE3, 0x52, 0x47, 0x55, 0x30, 0x03, 0x00, 0xA3, 0x02, 0x00, 0x50, 0xA4, 0xA0, 0x09, 
+    0x40, 0x44, 0x42, 0xE2, 0x33, 0xB0, 0x04, 0x44, 0x47, 0x30, 0xA0, 0x09, 0x33, 0x30, 0x60, 0x33, 
+    0x35, 0xF2, 0x00, 0x04, 0x53, 0x32, 0x20, 0xD5, 0x01, 0x25, 0xD3, 0xA0, 0x11, 0x22, 0x55, 0x5E, 
+    0xE5, 0x22, 0x5E, 0xE5, 0x53, 0x32, 0x42, 0x10, 0x33, 0x3E, 0x12, 0x22, 0xE0, 0x3E, 0x04, 0x40, 
+    0x30, 0xE0, 0x03, 0x30, 0x05, 0x42, 0x04, 0x00, 0x40, 0x20, 0xA4, 0x06, 0x00, 0x05, 0x03, 0x30, 
+    0x45, 0x00, 0x60, 0xA0, 0x05, 0x33, 0x55, 0x07, 0xC0, 0x01, 0x35, 0xF2, 0x00, 0x06, 0x52, 0x23, 
+    0x53, 0xC0, 0xB5, 0x03, 0x33, 0x55, 0x43, 0x0B, 0x23, 0x33, 0x53, 0x5E, 0x03, 0x52, 0xB5, 0x12, 
+    0x25, 0x00, 0x05, 0x33, 0xE1, 0x20, 0x05, 0x33, 0x22, 0x40, 0x42, 0x00, 0x30, 0xA0, 0x19, 0x33, 
+    0x30, 0x05, 0x52, 0x04, 0x00, 0x03, 0x62, 0x00, 0x47, 0x23, 0x40, 0x03, 0xB0, 0x05, 0x44, 0x47, 
+    0x07, 0xC0, 0x01, 0x74, 0xB0, 0x04, 0x35, 0x33, 0x50, 0xC2, 0x04, 0x55, 0x22, 0x50, 0x42, 0x0D, 
+    0x25, 0x03, 0x00, 0x05, 0x55, 0x00, 0x0B, 0xD3, 0x21, 0x53, 0x33, 0x50, 0x22, 0x50, 0x03, 0x32, 
+    0x33, 0x32, 0x20, 0x02, 0x33, 0x51, 0x06, 0x06, 0x40, 0x22, 0xA0, 0x16, 0x32, 0x30, 0x00, 0x40, 
+    0x20, 0x42, 0x12, 0x55, 0x2B, 0x44, 0x00, 0x00, 0xB3, 0x17, 0x00, 0x64, 0x46, 0x03, 0x35, 0x52, 
+    0x33, 0x36, 0x70, 0x03, 0x33, 0x52, 0xA3, 0x00, 0x50, 0xD2, 0xC5, 0x06, 0x00, 0x03, 0x00, 0x30, 
+    0x42, 0x04, 0x40, 0x23, 0x20, 0xAE, 0xB2, 0x00, 0x30, 0xA0, 0x02, 0x33, 0x00, 0xA3, 0x11, 0x07, 
+    0x02, 0x53, 0x31, 0x57, 0x70, 0x03, 0x00, 0x03, 0xB0, 0x12, 0x30, 0x06, 0x40, 0x04, 0x40, 0x32, 
+    0x45, 0x02, 0x04, 0x00, 0xA3, 0x08, 0x53, 0x33, 0x00, 0x64, 0x60, 0xA0, 0x06, 0x33, 0x30, 0x04, 
+    0x40, 0xC0, 0x05, 0x33, 0x00, 0x03, 0xA2, 0x01, 0x03, 0xA5, 0x00, 0x30, 0xF0, 0x01, 0x00, 0x30, 
+    0xA0, 0x00, 0x70, 0xF0, 0x07, 0x17, 0x30, 0x33, 0x30, 0x02, 0x22, 0x53, 0x3E, 0x24, 0x00, 0x03, 
+    0x33, 0x07, 0x42, 0x04, 0x33, 0x30, 0x00, 0xD4, 0x15, 0x74, 0x40, 0x00, 0x30, 0x33, 0x35, 0x53, 
+    0x53, 0x33, 0x00, 0x06, 0xF4, 0x01, 0x00, 0x60, 0xF0, 0x03, 0x10, 0x33, 0x25, 0x20, 0x35, 0x22, 
+    0x53, 0x33, 0x03, 0x30, 0x47, 0x0C, 0x00, 0x77, 0x70, 0x00, 0x33, 0x53, 0x30, 0xC0, 0x14, 0x33, 
+    0x3B, 0x0E, 0x5E, 0x33, 0xE2, 0x67, 0x00, 0x55, 0x22, 0x20, 0xB0, 0x04, 0x30, 0x06, 0x70, 0xF0, 
+    0x03, 0x05, 0x60, 0x35, 0x25, 0xB3, 0x01, 0x52, 0xA0, 0x07, 0x77, 0x66, 0x06, 0x44, 0xD0, 0xC3, 
+    0x43, 0xC2, 0x02, 0x55, 0x50, 0xF3, 0x00, 0xB0, 0x0B, 0xC0, 0x03, 0x25, 0x35, 0x35, 0x53, 0xC0, 
+    0xB3, 0x06, 0x52, 0x33, 0x32, 0x20, 0xA0, 0x06, 0x35, 0x52, 0x50, 0x60, 0xF0, 0x0B, 0x02, 0x40, 
+    0x00, 0xF3, 0x01, 0x03, 0x23, 0x03, 0xF0, 0x03, 0xC3, 0x00, 0x00, 0xB3, 0x01, 0x55, 0xB2, 0x15, 
+    0x55, 0x35, 0x50, 0x35, 0x30, 0x52, 0x55, 0x30, 0x03, 0x33, 0x55, 0xD2, 0x00, 0x50, 0xB3, 0x0E, 
+    0x00, 0x23, 0x35, 0x2E, 0x53, 0x32, 0x04, 0x70, 0xC0, 0x05, 0x30, 0x36, 0x07, 0xC0, 0x03, 0x33, 
+    0x03, 0xF0, 0x03, 0xF3, 0x00, 0x08, 0x03, 0x50, 0x00, 0x33, 0x00, 0xA3, 0x07, 0x03, 0x33, 0x52, 
+    0x55, 0xC3, 0x00, 0x50, 0xA2, 0x11, 0x53, 0x35, 0x53, 0x35, 0x35, 0x22, 0x53, 0x35, 0x53, 
+};
+
+const gfx_image_t STORY_CH5_IMG = {
+    .w = STORY_CH5_W, .h = STORY_CH5_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH5_PAL, .colors = STORY_CH5_PAL_SIZE,
+    .data = STORY_CH5_RLE, .size = STORY_CH5_RLE_SIZE,
 };
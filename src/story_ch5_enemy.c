@@ -2,266 +2,69 @@
 #include "story_ch5_enemy.h"
 
 const uint16_t STORY_CH5_ENEMY_PAL[STORY_CH5_ENEMY_PAL_SIZE] = {
-    0x18A2, 0x5AAA, 0xE6FB, 0xA4D2, 0x41C6, 0xC5D6, 0x83AE, 0x4A07, 
-    0x940F, 0x3A08, 0xCE17, 0x39E8, 0x7C10, 0x7BF0, 0x7C0F, 0x3A07, 
+    0x18A2, 0x5AAA, 0xE6FB, 0xA4D2, 
 };
 
-const uint8_t STORY_CH5_ENEMY_IDX[(STORY_CH5_ENEMY_W * STORY_CH5_ENEMY_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x91, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x47, 0x40, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x47, 0x40, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x74, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x71, 0x44, 0x40, 0x44, 0x44, 0x70, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x41, 0x14, 0x40, 0x44, 
-    0x17, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x11, 
-    0x14, 0x41, 0x74, 0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
-    0x11, 0x77, 0x11, 0x14, 0x74, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x44, 0x14, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x17, 0x14, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x61, 0x61, 0x11, 0x17, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x31, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x66, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x31, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x66, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x3D, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x81, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA3, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x41, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 
-    0x01, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x11, 0x14, 0x11, 0x10, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x15, 0x23, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x61, 0x11, 0x11, 0x74, 0x44, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x1A, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x88, 0x66, 0x61, 0x11, 0x71, 0x17, 0x44, 0x74, 0x04, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x13, 0x33, 0x36, 0x31, 0x41, 0x71, 0x11, 0x17, 0x71, 
-    0x71, 0x44, 0x41, 0x14, 0x00, 0x01, 0x1A, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x61, 0x35, 0x36, 0x33, 0x71, 0x17, 0x16, 
-    0x66, 0x11, 0x17, 0x74, 0x01, 0x11, 0x04, 0x11, 0x12, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x0B, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x83, 0x33, 0x23, 0x85, 0x17, 
-    0x11, 0x11, 0x66, 0x61, 0x11, 0x10, 0x01, 0x11, 0x11, 0x13, 0x12, 0x22, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x43, 0x63, 0x33, 0x5A, 
-    0x35, 0x34, 0x16, 0x61, 0x11, 0x66, 0x11, 0x10, 0x03, 0x31, 0x11, 0x63, 0x32, 0x22, 0xD1, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x41, 0x33, 
-    0x35, 0x32, 0x55, 0x30, 0x11, 0x13, 0x84, 0x11, 0x11, 0x10, 0x41, 0x11, 0x11, 0x33, 0x52, 0x22, 
-    0xC1, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 
-    0x10, 0x33, 0x35, 0x32, 0xA3, 0x54, 0x11, 0x53, 0x63, 0x81, 0x71, 0x18, 0x61, 0x11, 0x31, 0x33, 
-    0x22, 0x22, 0xC1, 0x31, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x11, 0x11, 0x73, 0x52, 0x22, 0x23, 0x51, 0x16, 0x61, 0x12, 0x22, 0x33, 0xA2, 0x33, 0x61, 
-    0x16, 0x23, 0x32, 0x22, 0xC1, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x41, 0x13, 0x16, 0x22, 0x22, 0x25, 0x58, 0x16, 0x17, 0x12, 0x22, 0x22, 0x22, 
-    0x33, 0x81, 0x11, 0x85, 0x32, 0x22, 0xCD, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x63, 0x31, 0xA2, 0x22, 0x25, 0x53, 0x78, 0x36, 0x82, 0x22, 
-    0x22, 0x22, 0xA3, 0x36, 0x33, 0x11, 0x32, 0x22, 0x3C, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x63, 0x33, 0x32, 0x22, 0x22, 0x33, 0x43, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x66, 0x12, 0x22, 0x3D, 0x31, 0x74, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x41, 0x63, 0x35, 0x62, 0x22, 0x23, 0x35, 
-    0x1A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x38, 0x62, 0x22, 0x3C, 0x11, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x18, 0x53, 0x33, 0x22, 
-    0x33, 0x23, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x62, 0x22, 0x33, 0x10, 
-    0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x76, 0x68, 
-    0x53, 0x23, 0x62, 0x31, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x32, 0x23, 
-    0x13, 0x10, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x41, 
-    0x11, 0x35, 0x33, 0x83, 0x23, 0x43, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x61, 0x33, 0x86, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x13, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xC1, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x33, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x23, 0x33, 0x33, 0x33, 0x38, 0x10, 0x11, 0x70, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x11, 0x33, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x52, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x11, 0x10, 0x00, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x33, 0x52, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x25, 0x33, 0x33, 0x35, 0x36, 0x10, 0x00, 0x00, 0x47, 0x11, 0x70, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB1, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x61, 0x00, 0x00, 0x00, 0x00, 0x13, 
-    0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x33, 0x33, 0x33, 0x11, 0x10, 0x00, 0x00, 0x04, 0x13, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBB, 0xB9, 0x91, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x13, 0x00, 0x00, 0x00, 
-    0x00, 0x18, 0x5A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x33, 0x33, 0x21, 0x04, 0x40, 0x00, 0x00, 
-    0x41, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x9B, 0x00, 
-    0x00, 0x00, 0x00, 0xB1, 0xF1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x18, 0x35, 0x22, 0x2A, 0x22, 0x22, 0x22, 0x55, 0x33, 0x3A, 0x80, 0x04, 0x40, 
-    0x00, 0x00, 0x01, 0x13, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
-    0x99, 0x99, 0x9B, 0xB9, 0x00, 0x99, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0xA2, 0x52, 0x22, 0x22, 0x25, 0x55, 0x83, 0xA3, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x00, 0xBB, 0x11, 0x11, 0x11, 0x19, 0x99, 0x19, 0x11, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x44, 0x35, 0x00, 0x00, 0x00, 0x00, 0x18, 0x33, 0x55, 0x5A, 0x22, 0x22, 0x25, 0x55, 0x6A, 
-    0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x10, 0x0B, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x07, 0x35, 0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x55, 0x55, 0x55, 0x5A, 0x55, 
-    0x23, 0x52, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x07, 0x41, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x09, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x04, 0x16, 0x33, 0x55, 0x55, 0x55, 
-    0xA2, 0x22, 0xA1, 0x31, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x16, 0x11, 0x70, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x00, 0x07, 0x16, 0x33, 0x35, 
-    0x35, 0x22, 0x22, 0x33, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x11, 
-    0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x00, 0x04, 0x16, 
-    0x33, 0x52, 0x22, 0x2A, 0x31, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 
-    0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0xE1, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x32, 0x22, 0x22, 0x31, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x71, 0x00, 0x03, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x31, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x15, 0x22, 0x33, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x16, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 
-    0x51, 0x00, 0x00, 0x00, 0x13, 0xA3, 0x36, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x61, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x32, 0x10, 0x11, 0x33, 0x63, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 
+const uint8_t STORY_CH5_ENEMY_RLE[STORY_CH5_ENEMY_RLE_SIZE] = {
+    0xF0, 0x39, 0x00, 0x10, 0xF0, 0x5A, 0x7F, 0x7F, 0xF0, 0x3C, 0x00, 0x10, 0x7F, 0x7F, 0xF0, 0x3C, 
+    0x7F, 0x7F, 0xF0, 0x3D, 0x7F, 0x7F, 0xF0, 0x3D, 0x02, 0x11, 0x10, 0xF0, 0x42, 0x00, 0x10, 0x7F, 
+    0xF0, 0x2F, 0x7F, 0x7F, 0xF0, 0x3D, 0x7F, 0xF0, 0x01, 0x01, 0x11, 0x7F, 0xF0, 0x19, 0x7F, 0xF0, 
+    0x32, 0x7F, 0xE0, 0x00, 0x10, 0x7F, 0xF0, 0x19, 0x00, 0x30, 0x7F, 0xF0, 0x19, 0x01, 0x11, 0x7F, 
+    0xF0, 0x19, 0x5C, 0x00, 0x10, 0xF0, 0x56, 0x7F, 0x64, 0x00, 0x10, 0x7F, 0x03, 0x00, 0x01, 0x7F, 
+    0xF0, 0x19, 0x01, 0x33, 0x7F, 0x7F, 0x7F, 0x42, 0x00, 0x10, 0x7F, 0x7F, 0x7F, 0x03, 0x00, 0x11, 
+    0x7F, 0x60, 0xB0, 0x00, 0x10, 0x7F, 0xF0, 0x1A, 0x00, 0x10, 0xF0, 0x00, 0x02, 0x11, 0x10, 0x7F, 
+    0x55, 0x02, 0x11, 0x10, 0x7F, 0x7F, 0xF0, 0x38, 0xC1, 0xA0, 0xA1, 0x7F, 0x59, 0x01, 0x10, 0xB1, 
+    0xF0, 0x01, 0x7F, 0x56, 0xF0, 0x00, 0x00, 0x10, 0x7F, 0x52, 0xC1, 0x7F, 0x69, 0x00, 0x00, 0x7F, 
+    0xF0, 0x05, 0x7F, 0xF0, 0x06, 0x01, 0x11, 0xF0, 0x0A, 0x58, 0x00, 0x10, 0xF0, 0x2A, 0x01, 0x32, 
+    0x52, 0x04, 0x01, 0x31, 0x30, 0x4F, 0x00, 0x30, 0x75, 0x01, 0x23, 0x53, 0x04, 0x01, 0x33, 0x30, 
+    0xA1, 0xF0, 0x02, 0x76, 0x00, 0x10, 0x56, 0x01, 0x01, 0xA3, 0x00, 0x10, 0xF0, 0x03, 0x02, 0x13, 
+    0x30, 0x73, 0x02, 0x32, 0x10, 0xF0, 0x0F, 0x03, 0x13, 0x31, 0xF0, 0x04, 0x00, 0x30, 0x76, 0x00, 
+    0x30, 0xF0, 0x04, 0x01, 0x11, 0xF0, 0x03, 0x00, 0x10, 0xF0, 0x05, 0x77, 0xF0, 0x05, 0x4C, 0xF0, 
+    0x06, 0x74, 0x01, 0x13, 0xF0, 0x02, 0x01, 0x11, 0x42, 0x01, 0x11, 0x58, 0x00, 0x20, 0x71, 0x01, 
+    0x13, 0xF0, 0x04, 0x03, 0x11, 0x10, 0xA1, 0x7F, 0xF0, 0x02, 0x01, 0x13, 0xF0, 0x04, 0xF1, 0x00, 
+    0xA0, 0x01, 0x11, 0xF0, 0x08, 0x00, 0x10, 0x72, 0x01, 0x31, 0xF0, 0x05, 0x03, 0x11, 0x13, 0xF1, 
+    0x03, 0x50, 0x00, 0x20, 0x6E, 0x01, 0x11, 0xF0, 0x06, 0x01, 0x11, 0xC3, 0xF1, 0x02, 0x01, 0x01, 
+    0x49, 0x00, 0x20, 0x71, 0xF0, 0x06, 0x00, 0x10, 0x51, 0xE1, 0x05, 0x00, 0x01, 0x13, 0x7F, 0x04, 
+    0x11, 0x13, 0x10, 0xC3, 0xB1, 0x02, 0x33, 0x30, 0xC1, 0x00, 0x00, 0x42, 0xA1, 0x00, 0x20, 0x4C, 
+    0x00, 0x10, 0xF0, 0x19, 0x00, 0x10, 0x4D, 0x01, 0x01, 0xB3, 0x00, 0x20, 0x46, 0x03, 0x13, 0x33, 
+    0xA1, 0x00, 0x00, 0x42, 0x03, 0x11, 0x13, 0x7F, 0x01, 0x11, 0x45, 0xB3, 0x08, 0x11, 0x33, 0x11, 
+    0x13, 0x30, 0x43, 0x0B, 0x33, 0x11, 0x13, 0x33, 0x22, 0x23, 0x49, 0x01, 0x01, 0x6F, 0x02, 0x11, 
+    0x10, 0xB3, 0x09, 0x23, 0x33, 0x01, 0x11, 0x33, 0xC1, 0x00, 0x00, 0xC1, 0x46, 0x01, 0x31, 0x7B, 
+    0x00, 0x00, 0x47, 0x02, 0x11, 0x10, 0xB3, 0xA1, 0x08, 0x33, 0x11, 0x13, 0x13, 0x30, 0xA2, 0x6D, 
+    0x00, 0x30, 0xF0, 0x04, 0xC1, 0x01, 0x33, 0xA2, 0x42, 0x13, 0x33, 0x11, 0x22, 0x23, 0x33, 0x23, 
+    0x33, 0x11, 0x32, 0x33, 0x4E, 0xF0, 0x18, 0x00, 0x10, 0x4C, 0x06, 0x01, 0x11, 0x31, 0x30, 0xB2, 
+    0x05, 0x33, 0x31, 0x31, 0x43, 0xA2, 0x43, 0x01, 0x13, 0x44, 0x03, 0x31, 0x01, 0x68, 0x00, 0x10, 
+    0xF0, 0x04, 0x07, 0x11, 0x13, 0x33, 0x13, 0x47, 0x02, 0x33, 0x30, 0x48, 0x04, 0x33, 0x31, 0x10, 
+    0x45, 0x00, 0x10, 0x7D, 0x00, 0x30, 0x43, 0x00, 0x20, 0x42, 0xF2, 0x02, 0xD3, 0x00, 0x10, 0x43, 
+    0x03, 0x31, 0x11, 0x7F, 0x02, 0x22, 0x30, 0x54, 0x00, 0x30, 0x43, 0xA1, 0xF0, 0x1F, 0x00, 0x30, 
+    0x4C, 0x03, 0x01, 0x11, 0xB3, 0x06, 0x22, 0x33, 0x23, 0x30, 0xF2, 0x03, 0x4C, 0x01, 0x03, 0x48, 
+    0x00, 0x10, 0x6B, 0xA1, 0x44, 0x04, 0x33, 0x23, 0x10, 0x55, 0x07, 0x31, 0x31, 0x00, 0x11, 0x47, 
+    0x00, 0x10, 0x6E, 0x00, 0x10, 0xC3, 0x03, 0x23, 0x13, 0x4D, 0x00, 0x10, 0xA3, 0x01, 0x11, 0xF0, 
+    0x09, 0x01, 0x11, 0x5B, 0x00, 0x30, 0x4F, 0x01, 0x33, 0xD0, 0x4F, 0xF0, 0x11, 0x01, 0x11, 0xF0, 
+    0x10, 0x03, 0x11, 0x31, 0xF0, 0x07, 0x01, 0x11, 0xE0, 0x00, 0x30, 0x4E, 0xD3, 0x04, 0x10, 0x11, 
+    0x10, 0xA0, 0x00, 0x10, 0xF0, 0x01, 0x01, 0x11, 0xF0, 0x0E, 0x04, 0x11, 0x13, 0x30, 0xF0, 0x11, 
+    0x57, 0x04, 0x11, 0x00, 0x00, 0xA1, 0xF0, 0x02, 0x5A, 0x00, 0x10, 0xF0, 0x06, 0x01, 0x11, 0x60, 
+    0xB0, 0xB1, 0xF0, 0x02, 0x00, 0x10, 0xF0, 0x0B, 0xD1, 0xF0, 0x05, 0x03, 0x11, 0x31, 0xE0, 0x00, 
+    0x10, 0x53, 0x01, 0x11, 0x44, 0x03, 0x01, 0x13, 0x4A, 0x03, 0x01, 0x01, 0xF0, 0x07, 0xE1, 0x4E, 
+    0x01, 0x13, 0x49, 0x00, 0x30, 0x4E, 0x02, 0x21, 0x00, 0x45, 0xB1, 0xF0, 0x06, 0x00, 0x10, 0xD0, 
+    0x01, 0x11, 0xE0, 0x65, 0x00, 0x30, 0xC2, 0xD3, 0x00, 0x00, 0x46, 0x05, 0x01, 0x13, 0x11, 0xF0, 
+    0x06, 0x00, 0x10, 0x46, 0xC1, 0x56, 0x00, 0x30, 0x4B, 0x02, 0x32, 0x30, 0xC2, 0xD3, 0x01, 0x11, 
+    0xF0, 0x01, 0x42, 0x00, 0x10, 0x51, 0xF1, 0x07, 0x02, 0x00, 0x10, 0x5C, 0x02, 0x33, 0x30, 0x49, 
+    0x00, 0x10, 0xF0, 0x01, 0x00, 0x10, 0xA0, 0x4E, 0x03, 0x01, 0x00, 0xF1, 0x08, 0xF0, 0x08, 0x51, 
+    0xC3, 0x04, 0x23, 0x32, 0x10, 0x4A, 0x00, 0x10, 0x43, 0x02, 0x11, 0x10, 0x5D, 0x03, 0x00, 0x01, 
+    0x56, 0x00, 0x10, 0x49, 0x07, 0x22, 0x23, 0x13, 0x11, 0xF0, 0x03, 0x09, 0x11, 0x00, 0x01, 0x31, 
+    0x11, 0x4A, 0x00, 0x10, 0x74, 0xA2, 0x04, 0x33, 0x11, 0x10, 0xF0, 0x05, 0x44, 0xA1, 0xF0, 0x03, 
+    0x4F, 0xA0, 0x5D, 0xA2, 0x01, 0x33, 0xA1, 0xF0, 0x05, 0x02, 0x10, 0x10, 0xA0, 0x5E, 0x00, 0x30, 
+    0x5C, 0x03, 0x01, 0x13, 0xB2, 0x00, 0x30, 0xA1, 0xF0, 0x08, 0x00, 0x10, 0x42, 0x04, 0x33, 0x31, 
+    0x10, 0xF0, 0x04, 0xF1, 0x06, 0x54, 0x01, 0x11, 0x47, 0x04, 0x32, 0x23, 0x30, 0xA1, 0xF0, 0x0F, 
+    0x04, 0x13, 0x31, 0x10, 0xF0, 0x05, 0xF1, 0x07, 0xB0, 0x01, 0x11, 0xF0, 0x03, 0x02, 0x13, 0x30, 
+    0x45, 0x00, 0x10, 0xB3, 0x02, 0x11, 0x10, 0xF0, 0x11, 0x04, 0x13, 0x11, 0x10, 0xF0, 0x06, 0xF1, 
+    0x05, 0x00, 0x30, 0x44, 0xF0, 0x06, 0x06, 0x13, 0x21, 0x01, 0x10, 0xA3, 0xA1, 0xF0, 0x14, 0x03, 
+    0x31, 0x11, 0xF0, 0x07, 0xB1, 
+};
+
+const gfx_image_t STORY_CH5_ENEMY_IMG = {
+    .w = STORY_CH5_ENEMY_W, .h = STORY_CH5_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH5_ENEMY_PAL, .colors = STORY_CH5_ENEMY_PAL_SIZE,
+    .data = STORY_CH5_ENEMY_RLE, .size = STORY_CH5_ENEMY_RLE_SIZE,
 };
@@ -6,353 +6,221 @@ const uint16_t STORY_CH6_PAL[STORY_CH6_PAL_SIZE] = {
     0xD4B4, 0xD332, 0xF0EC, 0x9B52, 0x66BC, 0xD4FD, 0xA16C, 0x690B, 
 };
 
-const uint8_t STORY_CH6_IDX[(STORY_CH6_W * STORY_CH6_H) / 2] = {
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x03, 0x64, 0x46, 
-    0x56, 0x51, 0x10, 0x00, 0x32, 0x61, 0x41, 0x11, 0x58, 0x88, 0x55, 0x51, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x20, 0x22, 0x55, 0x55, 0x88, 0x88, 0x10, 0x06, 0x16, 0x20, 0x11, 0x00, 0x06, 0x25, 
-    0x52, 0x66, 0x22, 0x30, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x15, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x13, 0x31, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x03, 0x66, 0x65, 
-    0x56, 0x41, 0x10, 0x00, 0x32, 0x61, 0x41, 0x11, 0x58, 0x88, 0x55, 0x55, 0x02, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x25, 0x55, 0x88, 0x88, 0x10, 0x04, 0x16, 0x20, 0x11, 0x00, 0x06, 0x22, 
-    0x16, 0x22, 0x26, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x52, 0x22, 0x22, 0x22, 0x44, 
-    0x11, 0x11, 0x13, 0x11, 0x15, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x03, 0x26, 0x55, 
-    0x26, 0x21, 0x10, 0x00, 0x32, 0x21, 0x41, 0x11, 0x58, 0x88, 0x55, 0x52, 0x22, 0x22, 0x22, 0x22, 
-    0x62, 0x22, 0x22, 0x02, 0x25, 0x55, 0x88, 0x88, 0x10, 0x34, 0x16, 0x20, 0x11, 0x00, 0x06, 0x22, 
-    0x22, 0x22, 0x24, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x04, 0x44, 0x44, 0x22, 
-    0x25, 0x11, 0x11, 0x11, 0x52, 0x50, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x03, 0x22, 0x26, 
-    0x22, 0x21, 0x10, 0x00, 0x32, 0x21, 0x61, 0x11, 0x58, 0x88, 0x85, 0x52, 0x22, 0x22, 0x22, 0x21, 
-    0x11, 0x22, 0x22, 0x22, 0x26, 0x55, 0x88, 0x88, 0x10, 0x16, 0x16, 0x20, 0x11, 0x00, 0x06, 0x22, 
-    0x22, 0x22, 0x21, 0x01, 0x12, 0x22, 0x22, 0x64, 0x44, 0x44, 0x46, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x15, 0x62, 0x0B, 0x51, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x10, 0x03, 0x62, 0xB5, 
-    0x46, 0x44, 0x10, 0x00, 0x32, 0x61, 0x41, 0x11, 0x58, 0x88, 0xD5, 0x15, 0x52, 0x22, 0x22, 0x25, 
-    0x15, 0x22, 0x22, 0x26, 0x55, 0x25, 0x88, 0x88, 0x10, 0x16, 0x16, 0x22, 0x11, 0x00, 0x04, 0x22, 
-    0x5B, 0x22, 0x21, 0x11, 0x44, 0x14, 0x46, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x22, 0x22, 0x24, 
-    0x00, 0x01, 0x11, 0x55, 0xB0, 0x11, 0x11, 0x66, 0x55, 0x22, 0x61, 0x14, 0x10, 0x03, 0x22, 0x05, 
-    0x22, 0x24, 0x10, 0x00, 0x32, 0x61, 0x61, 0x11, 0x58, 0x99, 0x05, 0x16, 0x22, 0x22, 0x22, 0x26, 
-    0x16, 0x22, 0x22, 0x02, 0x26, 0x25, 0x89, 0x98, 0x10, 0x12, 0x14, 0x22, 0x11, 0x00, 0x06, 0x22, 
-    0x5B, 0x22, 0x24, 0x11, 0x40, 0x62, 0x22, 0x62, 0x22, 0x22, 0x22, 0x00, 0x20, 0x22, 0x04, 0x44, 
-    0x00, 0x11, 0x42, 0x20, 0xEB, 0x11, 0x10, 0x33, 0x00, 0x11, 0x13, 0x11, 0x10, 0x01, 0x22, 0x0B, 
-    0x22, 0x24, 0x10, 0x00, 0x16, 0x61, 0x11, 0x16, 0x59, 0x99, 0x05, 0x52, 0x22, 0x22, 0x22, 0x26, 
-    0x16, 0x26, 0x22, 0x00, 0x22, 0x25, 0x89, 0x98, 0x10, 0x16, 0x12, 0x26, 0x11, 0x00, 0x02, 0x00, 
-    0xB0, 0x02, 0x20, 0x11, 0x42, 0x16, 0x21, 0x03, 0x14, 0x44, 0x22, 0xB0, 0xB2, 0x02, 0x24, 0x44, 
-    0x30, 0x11, 0x22, 0x1B, 0xEB, 0x14, 0x11, 0x01, 0x10, 0x15, 0x01, 0x11, 0x10, 0x05, 0x20, 0x05, 
-    0x22, 0x24, 0x10, 0x05, 0x11, 0x11, 0x00, 0x06, 0x58, 0x88, 0x01, 0x62, 0x22, 0x22, 0x22, 0x65, 
-    0x15, 0x66, 0x22, 0x20, 0x22, 0x25, 0x88, 0x88, 0x13, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x5E, 0xE2, 0x22, 0x11, 0x42, 0x41, 0x11, 0x31, 0x14, 0x42, 0x22, 0x2F, 0xF2, 0x20, 0x22, 0x44, 
-    0x10, 0x15, 0x51, 0xBE, 0xEB, 0x11, 0x11, 0x01, 0x10, 0x10, 0x14, 0x46, 0x10, 0xD5, 0xBE, 0x05, 
-    0x22, 0x24, 0x10, 0x02, 0x66, 0x11, 0x10, 0x02, 0x58, 0x98, 0x01, 0x22, 0x22, 0x22, 0x22, 0x61, 
-    0x15, 0x66, 0x62, 0x22, 0x22, 0x25, 0x89, 0x85, 0x51, 0x26, 0x00, 0x00, 0x03, 0x00, 0x02, 0x22, 
-    0x2E, 0xE0, 0x22, 0x11, 0x62, 0x04, 0x11, 0x11, 0x11, 0x02, 0x22, 0x2F, 0xFF, 0x22, 0x26, 0x44, 
-    0x30, 0xB2, 0xBE, 0xEE, 0xEB, 0x13, 0x11, 0x01, 0x10, 0x03, 0x41, 0x44, 0x11, 0xBB, 0xE0, 0x05, 
-    0x22, 0x24, 0x10, 0x01, 0x26, 0x11, 0x15, 0x12, 0x58, 0xB8, 0x05, 0x22, 0x22, 0x22, 0x22, 0x11, 
-    0x11, 0x62, 0x62, 0x22, 0x22, 0x25, 0x8B, 0x85, 0x61, 0x22, 0x55, 0x11, 0x11, 0x00, 0x02, 0x22, 
-    0x2E, 0xEE, 0xF2, 0x11, 0x62, 0x00, 0x10, 0x10, 0x11, 0x22, 0x42, 0x2F, 0xFF, 0xF2, 0x20, 0x64, 
-    0x15, 0x2B, 0xFE, 0xEE, 0xE9, 0x13, 0x11, 0x31, 0x30, 0x31, 0x11, 0x11, 0x15, 0x5E, 0x00, 0x05, 
-    0x22, 0x24, 0x10, 0x01, 0x26, 0x11, 0x11, 0x12, 0x28, 0x98, 0x01, 0x22, 0x22, 0x26, 0x26, 0x11, 
-    0x11, 0x16, 0x22, 0x22, 0x22, 0x21, 0x89, 0x85, 0x63, 0x12, 0x11, 0x11, 0x11, 0x00, 0x02, 0x22, 
-    0xBE, 0xEE, 0xF2, 0x21, 0x62, 0x00, 0x41, 0x01, 0x11, 0x22, 0x40, 0x2F, 0xFF, 0xFF, 0xF2, 0x02, 
-    0x25, 0x1B, 0xEE, 0xEE, 0xEB, 0x30, 0x11, 0x34, 0x31, 0x00, 0x01, 0x11, 0x20, 0x8E, 0xEE, 0x05, 
-    0x22, 0x24, 0x10, 0x01, 0x25, 0x35, 0x11, 0x42, 0x25, 0x85, 0x01, 0x22, 0x22, 0x22, 0x21, 0x11, 
-    0x11, 0x16, 0x22, 0x22, 0x22, 0x20, 0x58, 0x52, 0x43, 0x12, 0x21, 0x16, 0x61, 0x00, 0x12, 0x22, 
-    0x5E, 0xEE, 0xF5, 0x25, 0x42, 0x43, 0x03, 0x11, 0x61, 0x22, 0x14, 0x2F, 0xFF, 0xFF, 0xF6, 0x20, 
-    0x51, 0x3B, 0xEE, 0xEE, 0xE8, 0x01, 0x11, 0x14, 0x41, 0x10, 0x11, 0x15, 0x50, 0x8E, 0x0E, 0x05, 
-    0x22, 0x24, 0x10, 0x01, 0x21, 0x01, 0x51, 0x12, 0x66, 0x55, 0x05, 0x22, 0x22, 0x22, 0x61, 0x15, 
-    0x11, 0x51, 0x62, 0x22, 0x22, 0x20, 0x12, 0x66, 0x63, 0x12, 0x20, 0x05, 0x51, 0x00, 0x12, 0x22, 
-    0x5E, 0xEE, 0xF2, 0x12, 0x12, 0x41, 0x11, 0x40, 0x21, 0x44, 0x44, 0xBF, 0xFF, 0xFF, 0xF4, 0x42, 
-    0x11, 0x1B, 0xEE, 0xEE, 0xE8, 0x31, 0x11, 0x11, 0x41, 0x11, 0x01, 0x12, 0x10, 0xDE, 0x00, 0x05, 
-    0x44, 0x44, 0x10, 0x06, 0x26, 0x11, 0x31, 0x64, 0x11, 0x11, 0x01, 0x22, 0x22, 0x22, 0x11, 0x11, 
-    0x11, 0x15, 0x62, 0x22, 0x22, 0x20, 0x11, 0x33, 0x11, 0x24, 0x11, 0x35, 0x33, 0x03, 0x14, 0x22, 
-    0x5E, 0xEE, 0xF2, 0x16, 0x24, 0x61, 0x11, 0x42, 0x24, 0x44, 0x44, 0xBF, 0xFF, 0xFF, 0x04, 0x44, 
-    0x11, 0x1B, 0xEE, 0xEA, 0xE8, 0x31, 0x31, 0x11, 0x44, 0x10, 0x05, 0x21, 0x10, 0x0E, 0x00, 0x05, 
-    0x44, 0x44, 0x10, 0x02, 0x26, 0x13, 0x15, 0x12, 0x26, 0x25, 0x05, 0x26, 0x22, 0x26, 0x11, 0x51, 
-    0x11, 0x55, 0x62, 0x22, 0x22, 0x23, 0x15, 0x15, 0x51, 0x44, 0x13, 0x01, 0x11, 0x13, 0x14, 0x22, 
-    0x5E, 0xEE, 0x06, 0x11, 0x22, 0x41, 0x01, 0x02, 0x00, 0x24, 0x44, 0xBF, 0xFF, 0xFF, 0x04, 0x22, 
-    0x11, 0x1B, 0xEE, 0xAA, 0x0D, 0x11, 0x11, 0x11, 0x41, 0x10, 0x05, 0x21, 0x10, 0x00, 0x00, 0x05, 
-    0x42, 0x24, 0x10, 0x01, 0x24, 0x13, 0x01, 0x12, 0x66, 0x61, 0x05, 0x25, 0x22, 0x26, 0x11, 0x11, 
-    0x11, 0x55, 0x62, 0x22, 0x22, 0x23, 0x16, 0x15, 0x61, 0x62, 0x10, 0x03, 0x61, 0x11, 0x14, 0x22, 
-    0xBE, 0xEE, 0x24, 0x11, 0x60, 0x10, 0x01, 0x02, 0x22, 0x24, 0x24, 0x2F, 0xFF, 0xFF, 0x24, 0x22, 
-    0x11, 0x1B, 0xEA, 0xAA, 0x0D, 0x13, 0x33, 0x11, 0x11, 0x10, 0x00, 0x15, 0x10, 0x00, 0x00, 0x98, 
-    0x14, 0x44, 0x13, 0x01, 0x21, 0x10, 0x01, 0x62, 0x64, 0x61, 0x05, 0x25, 0x65, 0x66, 0x11, 0x51, 
-    0x11, 0x55, 0x22, 0x22, 0x22, 0x23, 0x15, 0x10, 0x11, 0x62, 0x10, 0x00, 0x51, 0x11, 0x14, 0x22, 
-    0x5B, 0xEE, 0xB6, 0x11, 0x12, 0x10, 0x34, 0x02, 0x22, 0x46, 0x64, 0x2F, 0xFF, 0xFF, 0x26, 0x00, 
-    0x23, 0x0B, 0xEA, 0xA0, 0x9D, 0x33, 0x33, 0x31, 0x11, 0x10, 0x00, 0x11, 0x33, 0x09, 0x09, 0x88, 
-    0x12, 0x21, 0x10, 0x01, 0x21, 0x11, 0x01, 0x42, 0x11, 0x61, 0x05, 0x25, 0x55, 0x66, 0x65, 0x55, 
-    0x55, 0x55, 0x22, 0x22, 0x22, 0x23, 0x11, 0x30, 0x11, 0x12, 0x10, 0x00, 0x14, 0x11, 0x12, 0x22, 
-    0x5B, 0xEE, 0xB4, 0x44, 0x44, 0x11, 0x31, 0x46, 0x66, 0x44, 0x45, 0xBF, 0xFF, 0xFF, 0x21, 0x42, 
-    0x26, 0x1B, 0xA0, 0x08, 0x85, 0x11, 0x25, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x19, 0x99, 0x8D, 
-    0x12, 0x21, 0x10, 0x36, 0x11, 0x11, 0x01, 0x66, 0x11, 0x11, 0x35, 0x25, 0x55, 0x55, 0x55, 0x51, 
-    0x55, 0x56, 0x22, 0x22, 0x22, 0x23, 0x11, 0x11, 0x61, 0x10, 0x10, 0x00, 0x20, 0x11, 0x16, 0x02, 
-    0xBB, 0xEE, 0xB2, 0x22, 0x22, 0x13, 0x11, 0x12, 0x22, 0x22, 0x22, 0xBB, 0xFF, 0xFF, 0x22, 0x22, 
-    0x62, 0x19, 0xA9, 0x08, 0x8D, 0x11, 0x21, 0x11, 0x11, 0x00, 0x03, 0x01, 0x11, 0x1B, 0x99, 0x8D, 
-    0x12, 0x21, 0x13, 0x12, 0x61, 0x10, 0x33, 0x22, 0x22, 0x21, 0x05, 0x25, 0x51, 0x51, 0x11, 0x11, 
-    0x11, 0x55, 0x52, 0x22, 0x22, 0x21, 0x12, 0x65, 0x26, 0x62, 0x33, 0x00, 0x42, 0x11, 0x12, 0x02, 
-    0x5B, 0xEE, 0x20, 0x40, 0x04, 0x11, 0x03, 0x12, 0x22, 0x22, 0x22, 0xBB, 0xFF, 0xFF, 0x64, 0x22, 
-    0x12, 0x19, 0xA9, 0x99, 0x85, 0x51, 0x26, 0x16, 0x13, 0x00, 0x10, 0x31, 0x61, 0x18, 0x99, 0x85, 
-    0x62, 0x26, 0x11, 0x12, 0x21, 0x13, 0x01, 0x22, 0x46, 0x53, 0x51, 0x61, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x22, 0x22, 0x10, 0x00, 0x16, 0x62, 0x11, 0x00, 0x52, 0x11, 0x42, 0x02, 
-    0x5B, 0xE0, 0x22, 0x22, 0x24, 0x11, 0x13, 0x31, 0x26, 0x20, 0x22, 0x2B, 0xFF, 0xFF, 0x22, 0x26, 
-    0x22, 0x19, 0xE9, 0x99, 0x85, 0x21, 0x26, 0x16, 0x41, 0x00, 0x00, 0x31, 0x10, 0x58, 0x99, 0x83, 
-    0x12, 0x24, 0x13, 0x12, 0x61, 0x01, 0x01, 0x22, 0x41, 0x01, 0x65, 0x11, 0x11, 0x11, 0x11, 0x33, 
-    0x13, 0x11, 0x11, 0x11, 0x16, 0x62, 0x50, 0x01, 0x22, 0x44, 0x40, 0x00, 0x20, 0x11, 0x12, 0x22, 
-    0x2B, 0xBB, 0x22, 0x44, 0x41, 0x03, 0x11, 0x14, 0x21, 0x22, 0x22, 0x22, 0xFF, 0xF2, 0x62, 0x22, 
-    0x11, 0x08, 0x9B, 0x99, 0x00, 0x00, 0x01, 0x30, 0x11, 0x00, 0x00, 0x11, 0x00, 0x08, 0x88, 0x81, 
-    0x14, 0x20, 0x11, 0x12, 0x21, 0x30, 0x11, 0x22, 0x21, 0x31, 0x65, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x31, 0x11, 0x42, 0x10, 0x32, 0x02, 0x12, 0x10, 0x00, 0x14, 0x11, 0x62, 0x22, 
-    0x2B, 0xBB, 0xB2, 0x11, 0x11, 0x00, 0x13, 0x12, 0x11, 0x11, 0x11, 0x5B, 0xFF, 0xBB, 0x11, 0x42, 
-    0x22, 0x18, 0x89, 0x80, 0x00, 0x33, 0x31, 0x11, 0x10, 0x00, 0x00, 0x31, 0x11, 0x18, 0x88, 0x51, 
-    0x14, 0x22, 0x61, 0x16, 0x21, 0x10, 0x31, 0x22, 0x21, 0x13, 0x61, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x31, 0x11, 0x16, 0x31, 0x12, 0x02, 0x22, 0x13, 0x00, 0x14, 0x11, 0x22, 0x22, 
-    0x2B, 0xBB, 0xB2, 0x26, 0x61, 0x00, 0x13, 0x34, 0x21, 0x16, 0x44, 0x1B, 0x2B, 0x22, 0x22, 0x22, 
-    0x22, 0x15, 0x89, 0x00, 0x81, 0x11, 0x13, 0x11, 0x30, 0x00, 0x00, 0x31, 0x30, 0x08, 0x88, 0x51, 
-    0x44, 0x42, 0x24, 0x12, 0x21, 0x33, 0x06, 0x22, 0x21, 0x11, 0x11, 0x13, 0x33, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x33, 0x31, 0x11, 0x11, 0x12, 0x02, 0x22, 0x13, 0x00, 0x62, 0x42, 0x22, 0x22, 
-    0x22, 0xBB, 0xB2, 0x41, 0x11, 0x30, 0x13, 0x01, 0x11, 0x44, 0x22, 0x62, 0xBB, 0x2B, 0x22, 0x22, 
-    0x22, 0x18, 0x89, 0x00, 0x81, 0x11, 0x00, 0x31, 0x10, 0x00, 0x00, 0x11, 0x10, 0x08, 0x98, 0x56, 
-    0x41, 0x42, 0x22, 0x42, 0x26, 0x31, 0x31, 0x22, 0x22, 0x22, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x22, 0x02, 0x10, 0x43, 0x33, 0x22, 0x22, 0x20, 0x22, 
-    0x22, 0xB0, 0x22, 0x41, 0x41, 0x10, 0x03, 0x11, 0x44, 0x14, 0x22, 0x2B, 0x2B, 0x05, 0x42, 0x02, 
-    0x22, 0x4D, 0x80, 0x89, 0x52, 0x11, 0x13, 0x11, 0x00, 0x00, 0x00, 0x11, 0x10, 0x18, 0x98, 0x11, 
-    0x11, 0x24, 0x22, 0x42, 0x24, 0x13, 0x16, 0x22, 0x26, 0x62, 0x22, 0x22, 0x61, 0x11, 0x13, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x62, 0x11, 0x44, 0x42, 0x02, 0x42, 0x41, 0x13, 0x62, 0x22, 0x22, 0x22, 
-    0x22, 0x50, 0xB2, 0x24, 0x41, 0x13, 0x11, 0x13, 0x10, 0x42, 0x42, 0x02, 0x2B, 0x05, 0x42, 0x02, 
-    0x42, 0x21, 0x80, 0x88, 0xD1, 0x31, 0x14, 0x10, 0x00, 0x00, 0x01, 0x31, 0x61, 0x11, 0x8D, 0x11, 
-    0x12, 0x22, 0x22, 0x22, 0x24, 0x43, 0x16, 0x22, 0x24, 0x44, 0x22, 0x22, 0x22, 0x22, 0x42, 0x22, 
-    0x62, 0x61, 0x66, 0x61, 0x11, 0x31, 0x11, 0x12, 0x02, 0x22, 0x11, 0x11, 0x42, 0x22, 0x20, 0x02, 
-    0x22, 0x55, 0x62, 0x22, 0x41, 0x11, 0x01, 0x30, 0x11, 0x26, 0x44, 0x06, 0xBB, 0x02, 0x22, 0x24, 
-    0x22, 0x21, 0xD8, 0x88, 0x03, 0x11, 0x11, 0x10, 0x00, 0x00, 0x31, 0x11, 0x41, 0x11, 0x08, 0x11, 
-    0x22, 0x22, 0x22, 0x42, 0x24, 0x11, 0x35, 0x22, 0x24, 0x44, 0x24, 0x24, 0x14, 0x44, 0x16, 0x11, 
-    0x11, 0x11, 0x13, 0x10, 0x01, 0x31, 0x11, 0x12, 0x22, 0x26, 0x13, 0x31, 0x16, 0x22, 0x00, 0x00, 
-    0x22, 0x25, 0x60, 0x22, 0x44, 0x11, 0x31, 0x10, 0x31, 0x12, 0x22, 0x41, 0x5B, 0xB2, 0x22, 0x20, 
-    0x12, 0x21, 0x10, 0x00, 0x01, 0x12, 0x41, 0x30, 0x00, 0x00, 0x31, 0x11, 0x41, 0x31, 0x01, 0x12, 
-    0x22, 0x22, 0x22, 0x42, 0x22, 0x46, 0x62, 0x22, 0x24, 0x44, 0x24, 0x24, 0x14, 0x41, 0x11, 0x11, 
-    0x33, 0x10, 0x00, 0x10, 0x01, 0x31, 0x11, 0x12, 0x02, 0x22, 0x21, 0x44, 0x22, 0x20, 0x00, 0x00, 
-    0x02, 0x26, 0x44, 0x22, 0x44, 0x11, 0x13, 0x10, 0x01, 0x11, 0x22, 0x41, 0x55, 0x52, 0x22, 0x24, 
-    0x12, 0x21, 0x18, 0x00, 0x11, 0x22, 0x41, 0x00, 0x00, 0x00, 0x31, 0x11, 0x13, 0x31, 0x11, 0x22, 
-    0x22, 0x22, 0x22, 0x24, 0x22, 0x41, 0x66, 0x22, 0x24, 0x44, 0x24, 0x24, 0x11, 0x41, 0x11, 0x11, 
-    0x13, 0x10, 0x00, 0x10, 0x01, 0x31, 0x11, 0x12, 0x22, 0x12, 0x21, 0x16, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x22, 0x44, 0x22, 0x44, 0x41, 0x11, 0x13, 0x03, 0x14, 0x02, 0x24, 0x15, 0x52, 0x22, 0x24, 
-    0x12, 0x21, 0x11, 0x00, 0x11, 0x22, 0x21, 0x00, 0x03, 0x30, 0x11, 0x11, 0x61, 0x31, 0x11, 0x22, 
-    0x22, 0x22, 0x22, 0x24, 0x22, 0x11, 0x46, 0x22, 0x24, 0x44, 0x24, 0x24, 0x11, 0x41, 0x11, 0x11, 
-    0x13, 0x10, 0x00, 0x10, 0x01, 0x31, 0x11, 0x12, 0x22, 0x12, 0x43, 0x31, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x44, 0x02, 0x44, 0x41, 0x11, 0x11, 0x00, 0x10, 0x00, 0x22, 0x11, 0x22, 0x22, 0x24, 
-    0x12, 0x21, 0x11, 0x03, 0x12, 0x22, 0x10, 0x00, 0x33, 0x00, 0x11, 0x11, 0x13, 0x31, 0x16, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x16, 0x22, 0x24, 0x44, 0x24, 0x24, 0x14, 0x41, 0x11, 0x11, 
-    0x13, 0x10, 0x30, 0x10, 0x01, 0x31, 0x11, 0x12, 0x22, 0x42, 0x13, 0x31, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x64, 0x24, 0x14, 0x14, 0x11, 0x11, 0x00, 0x16, 0x20, 0x22, 0x41, 0x22, 0x02, 0x24, 
-    0x12, 0x21, 0x11, 0x01, 0x12, 0x25, 0x01, 0x13, 0x11, 0x00, 0x11, 0x10, 0x03, 0x31, 0x16, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x42, 0x24, 0x44, 0x22, 0x24, 0x44, 0x24, 0x24, 0x14, 0x41, 0x11, 0x11, 
-    0x13, 0x13, 0x30, 0x10, 0x01, 0x31, 0x11, 0x12, 0x22, 0x12, 0x21, 0x12, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x04, 0x41, 0x14, 0x44, 0x11, 0x14, 0x14, 0x10, 0x12, 0x02, 0x41, 0x02, 0x02, 0x24, 
-    0x12, 0x21, 0x11, 0x01, 0x12, 0x63, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x12, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x42, 0x13, 0x46, 0x22, 0x26, 0x46, 0x24, 0x24, 0x14, 0x41, 0x11, 0x11, 
-    0x13, 0x13, 0x33, 0x10, 0x01, 0x31, 0x11, 0x12, 0x22, 0x46, 0x43, 0x12, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x11, 0x64, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0x02, 0x21, 0x02, 0x02, 0x24, 
-    0x12, 0x21, 0x11, 0x01, 0x62, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 
-    0x41, 0x11, 0x11, 0x11, 0x13, 0x00, 0x03, 0x33, 0x33, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x31, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x66, 0x62, 0x22, 
-    0x22, 0x22, 0x44, 0x24, 0x44, 0x41, 0x44, 0x11, 0x11, 0x11, 0x16, 0x02, 0x21, 0x42, 0x02, 0x24, 
-    0x12, 0x21, 0x11, 0x31, 0x62, 0x24, 0x66, 0x11, 0x11, 0x11, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x33, 0x33, 0x13, 0x31, 0x13, 0x33, 0x11, 0x31, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x46, 0x44, 0x02, 0x21, 0x22, 0x20, 0x24, 
-    0x12, 0x61, 0x13, 0x03, 0x31, 0x30, 0x00, 0x00, 0x33, 0x33, 0x31, 0x13, 0x33, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 0x13, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 
-    0x46, 0x24, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x42, 0x21, 
-    0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x33, 
-    0x31, 0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 0x13, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x41, 0x14, 0x41, 0x44, 0x44, 0x44, 0x11, 
-    0x31, 0x13, 0x31, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x03, 0x33, 0x03, 0x30, 0x00, 0x33, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x33, 0x30, 0x00, 0x00, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x99, 0x93, 0x00, 0x00, 0x09, 0x99, 0x99, 0x30, 0x00, 0x00, 0x00, 0x99, 
-    0x93, 0x03, 0x31, 0x09, 0x11, 0x11, 0x31, 0x98, 0x30, 0xD9, 0x99, 0x99, 0x83, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0xD9, 0x99, 0x91, 0x33, 0x0D, 0x99, 0x99, 0x99, 0x11, 0x13, 0xD9, 0x99, 0x99, 
-    0x99, 0x83, 0x0D, 0x98, 0x30, 0x03, 0x10, 0x95, 0x11, 0x11, 0x09, 0x99, 0x51, 0x11, 0x11, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x77, 0x76, 0x30, 0x0D, 0x07, 0x77, 0x77, 0x63, 0x00, 0x00, 0xDA, 0x77, 
-    0x7C, 0x31, 0x11, 0x07, 0x63, 0x00, 0x30, 0x70, 0xC3, 0x0A, 0x77, 0x77, 0x7C, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0xDA, 0x77, 0x7C, 0x30, 0x3D, 0xA7, 0x77, 0x77, 0xC3, 0x11, 0x0A, 0x77, 0x77, 
-    0x77, 0x7C, 0x0D, 0xA7, 0xC0, 0x00, 0x00, 0x70, 0xC1, 0x13, 0x07, 0x77, 0x0C, 0x11, 0x11, 0x13, 
-    0x00, 0x00, 0x00, 0x99, 0x58, 0x9B, 0x93, 0x3D, 0x07, 0x05, 0x89, 0xB9, 0x33, 0x10, 0x99, 0x58, 
-    0x9B, 0x93, 0x0D, 0x07, 0x09, 0x33, 0x30, 0xA0, 0xC0, 0xDA, 0x7B, 0x88, 0x9B, 0x83, 0x00, 0x00, 
-    0x00, 0x00, 0xD9, 0x99, 0x58, 0x9B, 0x93, 0x0D, 0x07, 0x05, 0x5B, 0xB8, 0x13, 0xDA, 0x7B, 0x88, 
-    0x88, 0x53, 0x30, 0xA7, 0xB9, 0x30, 0x00, 0x70, 0xC0, 0xD9, 0x95, 0x5B, 0xBB, 0x53, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x75, 0x30, 0xDA, 0x76, 0x3D, 0x07, 0x63, 0x3D, 0xA7, 0x43, 0xD0, 0x76, 0x30, 
-    0xDA, 0x7C, 0x3D, 0x07, 0x77, 0xC3, 0x30, 0xA0, 0xC0, 0xDA, 0x7C, 0x00, 0x07, 0x0C, 0x00, 0x00, 
-    0x00, 0x00, 0xD0, 0x76, 0x30, 0xDA, 0x7C, 0x3D, 0x07, 0x43, 0x30, 0xA7, 0xC1, 0xDA, 0x7C, 0x30, 
-    0x00, 0x00, 0x0D, 0xA7, 0x77, 0xC3, 0x00, 0x70, 0xC0, 0x07, 0x0C, 0x03, 0x07, 0x0C, 0x11, 0x33, 
-    0x00, 0x00, 0x00, 0x75, 0x30, 0x0D, 0x83, 0x30, 0x07, 0x53, 0x10, 0xA7, 0x43, 0xD0, 0x76, 0x31, 
-    0x0A, 0x7C, 0x41, 0x07, 0x5B, 0xB0, 0xC0, 0xA0, 0xC0, 0xDA, 0x7C, 0x03, 0x07, 0x0C, 0x00, 0x03, 
-    0x00, 0x00, 0xD0, 0x76, 0x30, 0x0A, 0x7C, 0x0D, 0x07, 0x61, 0x10, 0xA7, 0xC3, 0x0A, 0x74, 0x11, 
-    0x11, 0x33, 0x3D, 0xA7, 0x5B, 0xB0, 0x30, 0x70, 0xC0, 0x0A, 0x0C, 0x00, 0x07, 0x0C, 0x03, 0x33, 
-    0x00, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0x31, 0x07, 0x0A, 0xAA, 0x53, 0x33, 0x10, 0x70, 0x0A, 
-    0xA7, 0x7C, 0x31, 0x07, 0x01, 0xA7, 0xC0, 0xA0, 0xC0, 0xDA, 0x7C, 0x00, 0x07, 0x0C, 0x00, 0x00, 
-    0x00, 0x00, 0xD0, 0x70, 0xAA, 0xA7, 0x7C, 0x0D, 0x07, 0x00, 0xAA, 0x53, 0x33, 0x0A, 0x70, 0xAA, 
-    0x0C, 0x31, 0x30, 0xA7, 0xC0, 0x77, 0xC0, 0x70, 0xC0, 0x0A, 0x70, 0xAA, 0xA7, 0x03, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x75, 0x30, 0xAA, 0xA1, 0x11, 0x07, 0x77, 0x77, 0x60, 0x00, 0x00, 0x77, 0x77, 
-    0x77, 0x7C, 0x11, 0x07, 0x63, 0x89, 0x9A, 0x70, 0xC3, 0xDA, 0x7C, 0x00, 0x07, 0x0C, 0x00, 0x00, 
-    0x00, 0x00, 0xD0, 0x77, 0x77, 0x77, 0x7C, 0x0D, 0x07, 0x77, 0x77, 0xC0, 0x00, 0xDA, 0x77, 0x77, 
-    0x7C, 0x00, 0x0D, 0xA7, 0xC0, 0x89, 0x0A, 0x70, 0xC1, 0x0A, 0x77, 0x77, 0x77, 0x03, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x75, 0x30, 0x77, 0x76, 0x30, 0x07, 0x53, 0x3D, 0xA7, 0x30, 0xD0, 0x75, 0x15, 
-    0x0A, 0x7C, 0x31, 0x07, 0x63, 0x0D, 0xA7, 0x70, 0xC0, 0xDA, 0x7C, 0x00, 0x07, 0x0C, 0x00, 0x00, 
-    0x00, 0x00, 0xD0, 0x75, 0x30, 0xDA, 0x7C, 0x0D, 0x07, 0x53, 0x0D, 0xA0, 0xC3, 0x0A, 0x76, 0x15, 
-    0x11, 0x13, 0x3D, 0xA7, 0xC0, 0x00, 0x77, 0x70, 0xC0, 0x0A, 0x0C, 0x00, 0x07, 0x03, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x75, 0x30, 0x1A, 0x74, 0x30, 0x07, 0x63, 0x3D, 0xA7, 0x43, 0x10, 0x76, 0x33, 
-    0xDA, 0x7C, 0x3D, 0x07, 0x63, 0x11, 0x5B, 0xA0, 0xC0, 0xDA, 0x7C, 0x00, 0x07, 0x0C, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x76, 0x30, 0xDA, 0x7C, 0x0D, 0x07, 0x43, 0x30, 0xA7, 0xC1, 0xDA, 0x7C, 0x41, 
-    0x33, 0x31, 0x30, 0xA7, 0xC3, 0x11, 0x59, 0x70, 0xC0, 0x0A, 0x0C, 0x00, 0x07, 0x03, 0x00, 0x00, 
-    0x00, 0x00, 0x09, 0x05, 0x1D, 0x00, 0x04, 0x31, 0x07, 0x5C, 0x1D, 0xA7, 0xC0, 0x00, 0x76, 0x33, 
-    0xDA, 0x7C, 0x31, 0x07, 0x63, 0x03, 0x30, 0xA0, 0xC1, 0x0A, 0x75, 0xD8, 0x00, 0x0C, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x76, 0x30, 0x0A, 0x7C, 0x31, 0x07, 0x63, 0x30, 0xA0, 0xC3, 0xDA, 0x76, 0xB8, 
-    0xDD, 0x51, 0x3D, 0xA7, 0xC3, 0x33, 0x30, 0x70, 0xC3, 0x0A, 0x0C, 0x00, 0x07, 0x03, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x77, 0x76, 0x41, 0x11, 0x07, 0x5C, 0x3D, 0xA7, 0x43, 0x10, 0x76, 0x33, 
-    0x0A, 0x74, 0x41, 0x07, 0x63, 0x31, 0x30, 0xA0, 0xC3, 0xDA, 0x77, 0x77, 0x7C, 0x33, 0x30, 0x00, 
-    0x00, 0x00, 0xD0, 0x76, 0x30, 0x0A, 0x7C, 0x31, 0xA7, 0x63, 0x30, 0xA7, 0xC3, 0xDA, 0x77, 0x77, 
-    0x77, 0x7C, 0x30, 0xA7, 0xC3, 0x11, 0x30, 0x70, 0xC1, 0x0A, 0x0C, 0x10, 0x07, 0x03, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x06, 0x30, 0x00, 0x90, 0x63, 0x3D, 0x90, 0xC0, 0x09, 0x06, 0x33, 
-    0xD9, 0x0C, 0x11, 0x90, 0x43, 0x00, 0x0D, 0x00, 0xC0, 0x09, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x30, 
-    0x03, 0x33, 0x09, 0x04, 0x13, 0xD0, 0x0C, 0x00, 0x90, 0x40, 0x0D, 0x00, 0xC1, 0x19, 0x00, 0x00, 
-    0x00, 0x0C, 0x0D, 0x90, 0xC3, 0x00, 0x30, 0x05, 0xC0, 0xD0, 0x0C, 0x10, 0xD0, 0x53, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x31, 0x03, 0x33, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x30, 0x03, 0x33, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x33, 0x00, 0x03, 0x30, 0x31, 0x11, 0x11, 0x00, 0x31, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x11, 0x41, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x13, 0x03, 0x30, 0x00, 0x33, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x13, 0x00, 0x00, 0x30, 0x01, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x33, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x30, 0x31, 0x33, 0x33, 0x13, 0x30, 0x31, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 
-    0x31, 0x11, 0x13, 0x31, 0x33, 0x30, 0x31, 0x11, 0x30, 0x00, 0x33, 0x33, 0x30, 0x13, 0x00, 0x13, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x13, 0x00, 0x33, 0x33, 0x30, 0x00, 0x00, 0x03, 0x33, 0x31, 0x13, 0x31, 0x11, 0x13, 0x13, 0x00, 
-    0x00, 0x03, 0x11, 0x11, 0x11, 0x13, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x44, 0x13, 0x30, 0x00, 0x00, 0x00, 0x31, 
-    0x30, 0x00, 0x00, 0x03, 0x33, 0x11, 0x11, 0x11, 0x13, 0x00, 0x31, 0x11, 0x00, 0x00, 0x03, 0x00, 
-    0x00, 0x31, 0x00, 0x00, 0x01, 0x11, 0x00, 0x31, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x00, 0x03, 0x33, 0x30, 0x00, 0x00, 0x31, 0x44, 0x44, 0x13, 0x30, 0x01, 0x13, 
-    0x33, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x10, 
-    0x01, 0x30, 0x00, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x33, 
-    0x03, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x44, 0x44, 0x14, 0x11, 
-    0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x00, 0x03, 
-    0x10, 0x00, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 
-    0x11, 0x11, 0x11, 0x44, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x44, 0x44, 
-    0x41, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 
-    0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 
-    0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 
-    0x11, 0x44, 0x44, 0x41, 0x11, 0x11, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x10, 
-    0x03, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x31, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 
-    0x00, 0x03, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 
-    0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x13, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x03, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 
-    0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x30, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x30, 0x00, 0x11, 0x11, 0x11, 0x11, 0x13, 0x13, 0x13, 0x01, 0x11, 0x11, 0x13, 0x31, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x03, 0x31, 0x11, 0x11, 0x11, 0x31, 
-    0x11, 0x13, 0x00, 0x01, 0x13, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 
-    0x11, 0x11, 0x33, 0x33, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x31, 0x11, 0x13, 0x30, 0x31, 0x11, 
-    0x11, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 
-    0x31, 0x11, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x03, 0x31, 0x10, 0x31, 0x03, 0x33, 0x11, 0x11, 
-    0x13, 0x13, 0x33, 0x13, 0x31, 0x11, 0x13, 0x00, 0x00, 0x31, 0x13, 0x30, 0x00, 0x33, 0x03, 0x11, 
-    0x11, 0x11, 0x30, 0x00, 0x00, 0x03, 0x31, 0x10, 0x00, 0x00, 0x11, 0x11, 0x30, 0x33, 0x00, 0x00, 
-    0x01, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x31, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x13, 0x13, 0x33, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x11, 
-    0x11, 0x11, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x11, 0x03, 0x13, 0x00, 0x00, 
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x33, 0x11, 0x00, 0x00, 0x33, 0x33, 
-    0x33, 0x11, 0x11, 0x11, 0x13, 0x33, 0x11, 0x33, 0x00, 0x00, 0x00, 0x33, 0x31, 0x11, 0x11, 0x11, 
-    0x03, 0x11, 0x11, 0x13, 0x31, 0x10, 0x00, 0x00, 0x00, 0x03, 0x33, 0x00, 0x01, 0x33, 0x31, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x13, 0x33, 0x11, 0x13, 0x33, 0x03, 0x31, 0x11, 0x00, 0x01, 0x03, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x52, 0x22, 0xB5, 0x55, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x21, 
+const uint8_t STORY_CH6_RLE[STORY_CH6_RLE_SIZE] = {
+    0xF1, 0x10, 0x1E, 0x00, 0x36, 0x44, 0x65, 0x65, 0x11, 0x00, 0x03, 0x26, 0x14, 0x11, 0x15, 0x88, 
+    0x85, 0x55, 0x10, 0xF2, 0x04, 0x02, 0x02, 0x20, 0xA5, 0xA8, 0x18, 0x10, 0x06, 0x16, 0x20, 0x11, 
+    0x00, 0x06, 0x25, 0x52, 0x66, 0x22, 0x30, 0x10, 0xF2, 0x02, 0x01, 0x15, 0xF2, 0x01, 0x02, 0x13, 
+    0x30, 0xE1, 0x00, 0x50, 0x4F, 0x05, 0x66, 0x55, 0x64, 0x52, 0x01, 0x50, 0xF2, 0x07, 0x48, 0x00, 
+    0x40, 0x49, 0x07, 0x21, 0x62, 0x22, 0x60, 0x4B, 0x02, 0x25, 0x50, 0xD2, 0x01, 0x44, 0xB1, 0x05, 
+    0x31, 0x11, 0x52, 0xF1, 0x05, 0x09, 0x00, 0x32, 0x65, 0x52, 0x62, 0x45, 0x00, 0x20, 0x4A, 0xF2, 
+    0x00, 0x00, 0x60, 0xB2, 0x00, 0x00, 0x49, 0x00, 0x30, 0x4B, 0xB2, 0x00, 0x40, 0x4D, 0x03, 0x25, 
+    0x50, 0xB4, 0x03, 0x22, 0x25, 0xC1, 0x02, 0x52, 0x50, 0xC0, 0x4A, 0x04, 0x22, 0x62, 0x20, 0x48, 
+    0x00, 0x60, 0x45, 0x00, 0x80, 0x48, 0x02, 0x11, 0x10, 0xD2, 0x00, 0x60, 0x46, 0x01, 0x16, 0x4F, 
+    0x02, 0x10, 0x10, 0x44, 0x00, 0x60, 0xC4, 0x00, 0x60, 0xF2, 0x01, 0xB1, 0x05, 0x56, 0x20, 0xB5, 
+    0xF1, 0x01, 0x00, 0x30, 0x44, 0x07, 0x62, 0xB5, 0x46, 0x44, 0x44, 0x02, 0x61, 0x40, 0x45, 0x04, 
+    0xD5, 0x15, 0x50, 0xC2, 0x02, 0x51, 0x50, 0xB2, 0x03, 0x65, 0x52, 0x4A, 0x00, 0x20, 0x43, 0x04, 
+    0x42, 0x25, 0xB0, 0x42, 0x07, 0x11, 0x44, 0x14, 0x46, 0xF2, 0x00, 0x01, 0x00, 0xC2, 0x0A, 0x40, 
+    0x00, 0x11, 0x15, 0x5B, 0x00, 0xA1, 0x09, 0x66, 0x55, 0x22, 0x61, 0x14, 0x42, 0x06, 0x22, 0x05, 
+    0x22, 0x20, 0x47, 0x00, 0x60, 0x43, 0x05, 0x99, 0x05, 0x16, 0xD2, 0x02, 0x61, 0x60, 0xA2, 0x08, 
+    0x02, 0x26, 0x25, 0x89, 0x90, 0x42, 0x02, 0x21, 0x40, 0x45, 0x00, 0x60, 0x45, 0x09, 0x41, 0x14, 
+    0x06, 0x22, 0x26, 0xD2, 0x29, 0x00, 0x20, 0x22, 0x04, 0x44, 0x00, 0x11, 0x42, 0x20, 0xEB, 0x11, 
+    0x10, 0x33, 0x00, 0x11, 0x13, 0x11, 0x10, 0x01, 0x22, 0x0B, 0x46, 0x02, 0x16, 0x60, 0xA1, 0x02, 
+    0x65, 0x90, 0x42, 0x00, 0x50, 0xE2, 0x42, 0x06, 0x62, 0x20, 0x02, 0x20, 0x47, 0x04, 0x61, 0x22, 
+    0x60, 0x43, 0x37, 0x20, 0x0B, 0x00, 0x22, 0x01, 0x14, 0x21, 0x62, 0x10, 0x31, 0x44, 0x42, 0x2B, 
+    0x0B, 0x20, 0x22, 0x44, 0x43, 0x01, 0x12, 0x21, 0xBE, 0xB1, 0x41, 0x10, 0x11, 0x01, 0x50, 0xA1, 
+    0x06, 0x00, 0x52, 0x00, 0x50, 0x45, 0x00, 0x50, 0xA1, 0x0A, 0x00, 0x06, 0x58, 0x88, 0x01, 0x60, 
+    0xD2, 0x08, 0x65, 0x15, 0x66, 0x22, 0x20, 0x44, 0x06, 0x88, 0x81, 0x31, 0x10, 0xF0, 0x00, 0x08, 
+    0x22, 0x25, 0xEE, 0x22, 0x20, 0x42, 0x08, 0x41, 0x11, 0x31, 0x14, 0x40, 0xA2, 0x12, 0xFF, 0x22, 
+    0x02, 0x24, 0x41, 0x01, 0x55, 0x1B, 0xEE, 0xB0, 0xA1, 0x43, 0x0A, 0x01, 0x44, 0x61, 0x0D, 0x5B, 
+    0xE0, 0x47, 0x0E, 0x26, 0x61, 0x11, 0x00, 0x25, 0x89, 0x80, 0x10, 0xE2, 0x01, 0x61, 0x42, 0x00, 
+    0x60, 0xC2, 0x08, 0x58, 0x98, 0x55, 0x12, 0x60, 0xB0, 0x00, 0x30, 0x44, 0x03, 0x2E, 0xE0, 0x42, 
+    0x03, 0x62, 0x04, 0xC1, 0x00, 0x00, 0x44, 0x0B, 0xF2, 0x22, 0x64, 0x43, 0x0B, 0x2B, 0xAE, 0x02, 
+    0xB1, 0x30, 0x44, 0x0B, 0x03, 0x41, 0x44, 0x11, 0xBB, 0xE0, 0x47, 0x01, 0x12, 0x42, 0x08, 0x51, 
+    0x25, 0x8B, 0x80, 0x50, 0xE2, 0xA1, 0x01, 0x62, 0x47, 0x08, 0xB8, 0x56, 0x12, 0x25, 0x50, 0xA1, 
+    0x47, 0x01, 0xEF, 0x44, 0x09, 0x01, 0x01, 0x01, 0x12, 0x24, 0x43, 0x0A, 0xF2, 0x20, 0x64, 0x15, 
+    0x2B, 0xF0, 0xAE, 0x00, 0x90, 0x42, 0x04, 0x31, 0x30, 0x30, 0xC1, 0x03, 0x55, 0xE0, 0x4E, 0x08, 
+    0x11, 0x22, 0x89, 0x80, 0x10, 0xB2, 0x02, 0x62, 0x60, 0xB1, 0x00, 0x60, 0xD2, 0x08, 0x18, 0x98, 
+    0x56, 0x31, 0x20, 0xC1, 0x44, 0x00, 0xB0, 0x43, 0x00, 0x20, 0x43, 0x03, 0x41, 0x01, 0x43, 0x00, 
+    0x00, 0x43, 0x08, 0xFF, 0x20, 0x22, 0x51, 0xB0, 0xBE, 0x14, 0xB3, 0x01, 0x13, 0x43, 0x10, 0x00, 
+    0x11, 0x12, 0x08, 0xEE, 0xE0, 0x49, 0x0A, 0x53, 0x51, 0x14, 0x22, 0x58, 0x50, 0x45, 0x01, 0x22, 
+    0xC1, 0x46, 0x15, 0x05, 0x85, 0x24, 0x31, 0x22, 0x11, 0x66, 0x10, 0x01, 0x22, 0x25, 0x42, 0x10, 
+    0x52, 0x54, 0x24, 0x30, 0x31, 0x16, 0x12, 0x21, 0x40, 0x45, 0x05, 0x62, 0x05, 0x13, 0x44, 0x01, 
+    0x80, 0xA1, 0x0D, 0x44, 0x11, 0x01, 0x11, 0x55, 0x08, 0xE0, 0x4A, 0x0C, 0x10, 0x15, 0x11, 0x26, 
+    0x65, 0x50, 0x50, 0xC2, 0x08, 0x61, 0x15, 0x11, 0x51, 0x60, 0x45, 0x04, 0x12, 0x66, 0x60, 0x42, 
+    0x03, 0x00, 0x55, 0x4A, 0x0C, 0x21, 0x21, 0x24, 0x11, 0x14, 0x02, 0x10, 0xA4, 0x00, 0xB0, 0xCF, 
+    0x05, 0x44, 0x21, 0x11, 0x45, 0x00, 0x30, 0xB1, 0x0F, 0x41, 0x11, 0x01, 0x12, 0x10, 0xDE, 0x00, 
+    0x05, 0xA4, 0x0B, 0x10, 0x06, 0x26, 0x11, 0x31, 0x64, 0xA1, 0x01, 0x01, 0xC2, 0xD1, 0x00, 0x50, 
+    0x47, 0x10, 0x13, 0x31, 0x12, 0x41, 0x13, 0x53, 0x30, 0x31, 0x40, 0x47, 0x03, 0x62, 0x46, 0x42, 
+    0x01, 0x22, 0xB4, 0x44, 0x03, 0x04, 0x44, 0x45, 0x00, 0xA0, 0x42, 0x00, 0x30, 0x42, 0x09, 0x41, 
+    0x00, 0x52, 0x11, 0x00, 0x4A, 0x1B, 0x22, 0x61, 0x31, 0x51, 0x22, 0x62, 0x50, 0x52, 0x62, 0x22, 
+    0x61, 0x15, 0x11, 0x15, 0x46, 0x0B, 0x31, 0x51, 0x55, 0x14, 0x41, 0x30, 0xA1, 0x47, 0x0E, 0x06, 
+    0x11, 0x22, 0x41, 0x01, 0x02, 0x00, 0x20, 0x49, 0x01, 0x22, 0x44, 0x03, 0xAA, 0x0D, 0xC1, 0x01, 
+    0x41, 0x47, 0xA0, 0x03, 0x54, 0x22, 0x42, 0x10, 0x12, 0x41, 0x30, 0x11, 0x26, 0x66, 0x10, 0x52, 
+    0x50, 0x44, 0xA1, 0x49, 0x0B, 0x61, 0x56, 0x16, 0x21, 0x00, 0x36, 0xA1, 0x0E, 0x42, 0x2B, 0xEE, 
+    0xE2, 0x41, 0x16, 0x01, 0x00, 0x42, 0x06, 0x22, 0x24, 0x24, 0x20, 0xBF, 0x00, 0x20, 0x46, 0x00, 
+    0xA0, 0x43, 0x02, 0x33, 0x30, 0xB1, 0x04, 0x00, 0x01, 0x50, 0x44, 0x13, 0x98, 0x14, 0x44, 0x13, 
+    0x01, 0x21, 0x10, 0x01, 0x62, 0x64, 0x44, 0x06, 0x65, 0x66, 0x11, 0x50, 0x43, 0xD2, 0x05, 0x31, 
+    0x51, 0x01, 0x44, 0x01, 0x05, 0x45, 0x0D, 0x5B, 0xEE, 0xB6, 0x11, 0x12, 0x10, 0x34, 0x42, 0x02, 
+    0x46, 0x60, 0x46, 0x05, 0x60, 0x02, 0x30, 0x42, 0x02, 0x09, 0xD0, 0xB3, 0x46, 0x0E, 0x13, 0x30, 
+    0x90, 0x98, 0x81, 0x22, 0x11, 0x00, 0x43, 0x06, 0x10, 0x14, 0x21, 0x10, 0x44, 0x04, 0x55, 0x66, 
+    0x60, 0xD5, 0x47, 0x05, 0x13, 0x01, 0x11, 0x43, 0x05, 0x14, 0x11, 0x12, 0x45, 0xB4, 0x0C, 0x11, 
+    0x31, 0x46, 0x66, 0x44, 0x45, 0xB0, 0x44, 0x10, 0x14, 0x22, 0x61, 0xBA, 0x00, 0x88, 0x51, 0x12, 
+    0x50, 0xA1, 0xA0, 0xB1, 0x04, 0x99, 0x98, 0xD0, 0x44, 0x01, 0x36, 0xA1, 0x03, 0x01, 0x66, 0xA1, 
+    0x00, 0x30, 0x43, 0xB5, 0x04, 0x15, 0x55, 0x60, 0x48, 0x05, 0x11, 0x61, 0x10, 0x42, 0x08, 0x20, 
+    0x11, 0x16, 0x02, 0xB0, 0x42, 0xB2, 0x04, 0x13, 0x11, 0x10, 0xD2, 0x01, 0xBB, 0x43, 0x0F, 0x22, 
+    0x26, 0x21, 0x9A, 0x90, 0x88, 0xD1, 0x12, 0xB1, 0x04, 0x00, 0x03, 0x00, 0xA1, 0x00, 0xB0, 0x47, 
+    0x08, 0x31, 0x26, 0x11, 0x03, 0x30, 0xB2, 0x01, 0x10, 0x42, 0x01, 0x15, 0xD1, 0x02, 0x55, 0x50, 
+    0xC2, 0x22, 0x11, 0x26, 0x52, 0x66, 0x23, 0x30, 0x04, 0x21, 0x11, 0x20, 0x25, 0xBE, 0xE2, 0x04, 
+    0x00, 0x41, 0x10, 0x30, 0x4C, 0x04, 0x64, 0x22, 0x10, 0x43, 0x31, 0x99, 0x85, 0x51, 0x26, 0x16, 
+    0x13, 0x00, 0x10, 0x31, 0x61, 0x18, 0x99, 0x85, 0x62, 0x26, 0x11, 0x12, 0x21, 0x13, 0x01, 0x22, 
+    0x46, 0x53, 0x51, 0x61, 0xF0, 0x04, 0x02, 0x11, 0x10, 0xA2, 0x10, 0x10, 0x00, 0x16, 0x62, 0x11, 
+    0x00, 0x52, 0x11, 0x40, 0x44, 0x00, 0x00, 0xB2, 0x0D, 0x41, 0x11, 0x33, 0x12, 0x62, 0x02, 0x22, 
+    0x43, 0x08, 0x22, 0x26, 0x22, 0x19, 0xE0, 0x43, 0x00, 0x20, 0x43, 0x01, 0x41, 0xA0, 0x04, 0x31, 
+    0x10, 0x50, 0x42, 0x0C, 0x31, 0x22, 0x41, 0x31, 0x26, 0x10, 0x10, 0x43, 0x04, 0x10, 0x16, 0x50, 
+    0xE1, 0x03, 0x33, 0x13, 0xD1, 0x13, 0x66, 0x25, 0x00, 0x12, 0x24, 0x44, 0x00, 0x02, 0x01, 0x11, 
+    0xA2, 0x10, 0xBB, 0xB2, 0x24, 0x44, 0x10, 0x31, 0x11, 0x42, 0x10, 0xC2, 0x0F, 0xFF, 0xF2, 0x62, 
+    0x22, 0x11, 0x08, 0x9B, 0x99, 0xB0, 0x03, 0x13, 0x01, 0x43, 0x04, 0x11, 0x00, 0x00, 0xA8, 0x13, 
+    0x11, 0x42, 0x01, 0x11, 0x22, 0x13, 0x01, 0x12, 0x22, 0x13, 0x43, 0xF0, 0x05, 0x16, 0x31, 0x11, 
+    0x42, 0x10, 0x32, 0x02, 0x12, 0x10, 0x00, 0x14, 0x11, 0x60, 0x45, 0x01, 0xB2, 0xA1, 0x05, 0x00, 
+    0x13, 0x12, 0xC1, 0x16, 0x5B, 0xFF, 0xBB, 0x11, 0x42, 0x22, 0x18, 0x89, 0x80, 0x00, 0x33, 0x30, 
+    0xA1, 0xB0, 0x00, 0x30, 0xA1, 0x03, 0x88, 0x85, 0x42, 0x09, 0x26, 0x11, 0x62, 0x11, 0x03, 0x43, 
+    0x03, 0x13, 0x61, 0x52, 0x0B, 0x16, 0x31, 0x12, 0x02, 0x22, 0x13, 0x44, 0xB2, 0x43, 0x02, 0x26, 
+    0x60, 0x43, 0x0B, 0x34, 0x21, 0x16, 0x44, 0x1B, 0x2B, 0xE2, 0x06, 0x15, 0x89, 0x00, 0x80, 0xA1, 
+    0x03, 0x31, 0x13, 0x45, 0x02, 0x30, 0x00, 0x43, 0x0D, 0x44, 0x42, 0x24, 0x12, 0x21, 0x33, 0x06, 
+    0x43, 0xA1, 0xA3, 0xF0, 0x01, 0xA3, 0xC1, 0x47, 0x02, 0x62, 0x40, 0xD2, 0x42, 0x15, 0x41, 0x11, 
+    0x30, 0x13, 0x01, 0x11, 0x44, 0x22, 0x62, 0xBB, 0x2B, 0x45, 0x00, 0x80, 0x46, 0x04, 0x00, 0x31, 
+    0x10, 0xB0, 0x17, 0x11, 0x10, 0x08, 0x98, 0x56, 0x41, 0x42, 0x22, 0x42, 0x26, 0x31, 0x31, 0xD2, 
+    0x01, 0x41, 0xF0, 0x09, 0x02, 0x11, 0x10, 0xA2, 0x07, 0x02, 0x10, 0x43, 0x33, 0xB2, 0x00, 0x00, 
+    0x43, 0x2C, 0x02, 0x24, 0x14, 0x11, 0x00, 0x31, 0x14, 0x41, 0x42, 0x22, 0xB2, 0xB0, 0x54, 0x20, 
+    0x22, 0x24, 0xD8, 0x08, 0x95, 0x21, 0x11, 0x31, 0x10, 0xC0, 0x42, 0x03, 0x18, 0x98, 0xA1, 0x01, 
+    0x24, 0x43, 0x09, 0x41, 0x31, 0x62, 0x22, 0x66, 0xB2, 0x00, 0x60, 0xA1, 0x00, 0x30, 0xD0, 0x13, 
+    0x11, 0x16, 0x21, 0x14, 0x44, 0x20, 0x24, 0x24, 0x11, 0x36, 0xF2, 0x00, 0x15, 0x50, 0xB2, 0x24, 
+    0x41, 0x13, 0x11, 0x13, 0x10, 0x42, 0x42, 0x02, 0x46, 0x0E, 0x42, 0x21, 0x80, 0x88, 0xD1, 0x31, 
+    0x14, 0x10, 0xC0, 0x0B, 0x13, 0x16, 0x11, 0x18, 0xD1, 0x11, 0xE2, 0x01, 0x44, 0x44, 0x02, 0x44, 
+    0x40, 0xE2, 0x0E, 0x42, 0x22, 0x62, 0x61, 0x66, 0x61, 0x11, 0x30, 0xA1, 0x04, 0x20, 0x22, 0x20, 
+    0xA1, 0x00, 0x40, 0xA2, 0x01, 0x00, 0x42, 0x17, 0x56, 0x22, 0x24, 0x11, 0x10, 0x13, 0x01, 0x12, 
+    0x64, 0x40, 0x6B, 0xB0, 0xA2, 0x0A, 0x42, 0x22, 0x1D, 0x88, 0x80, 0x30, 0xB1, 0xB0, 0x0B, 0x31, 
+    0x11, 0x41, 0x11, 0x08, 0x11, 0xC2, 0x07, 0x42, 0x24, 0x11, 0x35, 0x45, 0x08, 0x42, 0x41, 0x44, 
+    0x41, 0x60, 0xD1, 0x03, 0x31, 0x00, 0x45, 0x0B, 0x22, 0x26, 0x13, 0x31, 0x16, 0x22, 0xA0, 0x1A, 
+    0x22, 0x25, 0x60, 0x22, 0x44, 0x11, 0x31, 0x10, 0x31, 0x12, 0x22, 0x41, 0x5B, 0xB0, 0xA2, 0x05, 
+    0x01, 0x22, 0x11, 0xA0, 0x05, 0x11, 0x24, 0x13, 0x49, 0x04, 0x31, 0x01, 0x10, 0xD2, 0x06, 0x42, 
+    0x22, 0x46, 0x60, 0xA2, 0x48, 0xB1, 0x05, 0x33, 0x10, 0x00, 0x48, 0x00, 0x00, 0xA2, 0x05, 0x14, 
+    0x42, 0x22, 0xC0, 0x04, 0x22, 0x64, 0x40, 0x44, 0x07, 0x13, 0x10, 0x01, 0x11, 0x43, 0x01, 0x55, 
+    0xA2, 0x00, 0x40, 0x43, 0x08, 0x80, 0x01, 0x12, 0x24, 0x10, 0xC0, 0x42, 0x05, 0x13, 0x31, 0x11, 
+    0xF2, 0x00, 0x06, 0x42, 0x24, 0x16, 0x60, 0x49, 0x00, 0x10, 0x44, 0x00, 0x10, 0x4D, 0x07, 0x22, 
+    0x12, 0x21, 0x16, 0x47, 0x02, 0x02, 0x20, 0x44, 0x00, 0x40, 0xA1, 0x09, 0x30, 0x31, 0x40, 0x22, 
+    0x41, 0x4A, 0x00, 0x10, 0x44, 0x00, 0x20, 0x42, 0x02, 0x33, 0x00, 0xA1, 0x01, 0x61, 0x4E, 0x02, 
+    0x11, 0x40, 0x65, 0x05, 0x43, 0x31, 0x22, 0xE0, 0x42, 0x00, 0x00, 0x46, 0x0A, 0x10, 0x01, 0x00, 
+    0x02, 0x21, 0x10, 0xB2, 0x46, 0x0B, 0x31, 0x22, 0x21, 0x00, 0x03, 0x30, 0x43, 0x05, 0x13, 0x31, 
+    0x16, 0xF2, 0x03, 0x02, 0x13, 0x10, 0x4A, 0x00, 0x40, 0x48, 0x00, 0x30, 0x4B, 0x02, 0x42, 0x10, 
+    0x4D, 0x07, 0x64, 0x24, 0x14, 0x14, 0x45, 0x09, 0x62, 0x02, 0x24, 0x12, 0x20, 0x48, 0x0A, 0x11, 
+    0x22, 0x50, 0x11, 0x31, 0x10, 0x43, 0x01, 0x00, 0x4D, 0x05, 0x42, 0x24, 0x44, 0x53, 0x00, 0x30, 
+    0x4C, 0x05, 0x12, 0x21, 0x12, 0x4A, 0x06, 0x04, 0x41, 0x14, 0x40, 0x42, 0x0B, 0x41, 0x41, 0x01, 
+    0x20, 0x24, 0x10, 0x4D, 0x01, 0x63, 0xF1, 0x04, 0x03, 0x31, 0x11, 0xF2, 0x02, 0x0B, 0x42, 0x13, 
+    0x46, 0x22, 0x26, 0x46, 0x4F, 0x00, 0x30, 0x4A, 0x03, 0x46, 0x43, 0x4A, 0x06, 0x02, 0x22, 0x11, 
+    0x60, 0xF4, 0x00, 0xA1, 0x02, 0x02, 0x20, 0x4D, 0x02, 0x62, 0x20, 0xF1, 0x09, 0x03, 0x66, 0x64, 
+    0xE1, 0x03, 0x30, 0x00, 0xB3, 0xA0, 0xF3, 0x00, 0xF1, 0x11, 0x03, 0x46, 0x66, 0xD2, 0x02, 0x44, 
+    0x20, 0xA4, 0x02, 0x14, 0x40, 0xD1, 0x00, 0x60, 0x42, 0x00, 0x40, 0x49, 0x00, 0x30, 0x42, 0x02, 
+    0x46, 0x60, 0xD1, 0x01, 0x33, 0xF0, 0x02, 0xC3, 0x0D, 0x13, 0x31, 0x13, 0x33, 0x11, 0x31, 0x13, 
+    0xF1, 0x14, 0xC4, 0xF1, 0x0B, 0xC4, 0x02, 0x64, 0x40, 0x42, 0x03, 0x22, 0x20, 0x42, 0x08, 0x61, 
+    0x13, 0x03, 0x31, 0x30, 0xB0, 0xB3, 0x04, 0x11, 0x33, 0x30, 0xF1, 0x06, 0x43, 0x02, 0x03, 0x30, 
+    0xF0, 0x12, 0x02, 0x33, 0x00, 0xF1, 0x01, 0xE4, 0x01, 0x62, 0xE4, 0xF1, 0x07, 0x04, 0x44, 0x22, 
+    0x10, 0xB0, 0xD3, 0xF1, 0x01, 0xE3, 0xF0, 0x30, 0x01, 0x33, 0xF1, 0x09, 0xF4, 0x01, 0xF1, 0x00, 
+    0x02, 0x33, 0x30, 0xF1, 0x01, 0x03, 0x33, 0x11, 0xC3, 0xF0, 0x08, 0x00, 0x30, 0xF0, 0x2C, 0x01, 
+    0x33, 0xF1, 0x09, 0x07, 0x44, 0x41, 0x14, 0x41, 0xC4, 0x0A, 0x11, 0x31, 0x13, 0x31, 0x33, 0x30, 
+    0xF0, 0x50, 0x01, 0x33, 0xF1, 0x13, 0x01, 0x03, 0xF0, 0x05, 0xB3, 0xF0, 0x08, 0x00, 0x30, 0xC0, 
+    0x0B, 0x33, 0x30, 0x33, 0x00, 0x03, 0x33, 0xF0, 0x03, 0xA3, 0xB0, 0xB3, 0xF0, 0x00, 0x00, 0x30, 
+    0xF0, 0x01, 0x00, 0x30, 0x57, 0xD0, 0x03, 0x99, 0x93, 0xB0, 0xB9, 0x00, 0x30, 0xD0, 0x09, 0x99, 
+    0x93, 0x03, 0x31, 0x09, 0xA1, 0x06, 0x31, 0x98, 0x30, 0xD0, 0xB9, 0x01, 0x83, 0xF0, 0x03, 0x00, 
+    0xD0, 0xA9, 0x04, 0x13, 0x30, 0xD0, 0xC9, 0x04, 0x11, 0x13, 0xD0, 0xD9, 0x0D, 0x83, 0x0D, 0x98, 
+    0x30, 0x03, 0x10, 0x95, 0xA1, 0x04, 0x09, 0x99, 0x50, 0xC1, 0x00, 0x30, 0xE0, 0x08, 0x77, 0x76, 
+    0x30, 0x0D, 0x00, 0xB7, 0x01, 0x63, 0xA0, 0x17, 0xDA, 0x77, 0x7C, 0x31, 0x11, 0x07, 0x63, 0x00, 
+    0x30, 0x70, 0xC3, 0x0A, 0xB7, 0x00, 0xC0, 0xF0, 0x02, 0x0B, 0x3D, 0xA7, 0x77, 0xC3, 0x03, 0xDA, 
+    0xB7, 0x05, 0xC3, 0x11, 0x0A, 0xD7, 0x05, 0xC0, 0xDA, 0x7C, 0xB0, 0x0B, 0x70, 0xC1, 0x13, 0x07, 
+    0x77, 0x0C, 0x4A, 0x35, 0x99, 0x58, 0x9B, 0x93, 0x3D, 0x07, 0x05, 0x89, 0xB9, 0x33, 0x10, 0x99, 
+    0x58, 0x9B, 0x93, 0x0D, 0x07, 0x09, 0x33, 0x30, 0xA0, 0xC0, 0xDA, 0x7B, 0x88, 0x9B, 0x83, 0xE0, 
+    0x19, 0xD9, 0x99, 0x58, 0x9B, 0x93, 0x0D, 0x07, 0x05, 0x5B, 0xB8, 0x13, 0xDA, 0x7B, 0xA8, 0x08, 
+    0x53, 0x30, 0xA7, 0xB9, 0x30, 0x44, 0x0A, 0x0D, 0x99, 0x55, 0xBB, 0xB5, 0x30, 0xA1, 0xC0, 0x07, 
+    0x75, 0x30, 0xDA, 0x76, 0x42, 0x18, 0x63, 0x3D, 0xA7, 0x43, 0xD0, 0x76, 0x30, 0xDA, 0x7C, 0x3D, 
+    0x07, 0x77, 0xC0, 0x48, 0x06, 0xC0, 0x00, 0x70, 0xC0, 0x47, 0x19, 0x07, 0x63, 0x0D, 0xA7, 0xC3, 
+    0xD0, 0x74, 0x33, 0x0A, 0x7C, 0x1D, 0xA7, 0xC3, 0xC0, 0x06, 0xDA, 0x77, 0x7C, 0x30, 0x44, 0x0D, 
+    0x07, 0x0C, 0x03, 0x07, 0x0C, 0x11, 0x33, 0x48, 0x0B, 0x0D, 0x83, 0x30, 0x07, 0x53, 0x10, 0x47, 
+    0x0D, 0x10, 0xA7, 0xC4, 0x10, 0x75, 0xBB, 0x0C, 0x48, 0x00, 0x30, 0x45, 0x00, 0x30, 0x48, 0x0A, 
+    0x0A, 0x7C, 0x0D, 0x07, 0x61, 0x10, 0x42, 0x04, 0x30, 0xA7, 0x40, 0xA1, 0x0A, 0x33, 0x3D, 0xA7, 
+    0x5B, 0xB0, 0x30, 0x44, 0x04, 0xA0, 0xC0, 0x00, 0x42, 0x01, 0x03, 0x4B, 0x20, 0x00, 0x03, 0x10, 
+    0x70, 0xAA, 0xA5, 0x33, 0x31, 0x07, 0x00, 0xAA, 0x77, 0xC3, 0x10, 0x70, 0x1A, 0x70, 0x49, 0x00, 
+    0x00, 0x45, 0xB0, 0x07, 0xD0, 0x70, 0xAA, 0xA7, 0x44, 0x06, 0x00, 0xAA, 0x53, 0x30, 0x42, 0x0F, 
+    0x0A, 0xA0, 0xC3, 0x13, 0x0A, 0x7C, 0x07, 0x7C, 0x45, 0x07, 0x70, 0xAA, 0xA7, 0x03, 0xF0, 0x01, 
+    0x42, 0x06, 0xAA, 0xA1, 0x11, 0x00, 0xB7, 0x00, 0x60, 0xB0, 0xD7, 0x0E, 0xC1, 0x10, 0x76, 0x38, 
+    0x99, 0xA7, 0x0C, 0x30, 0x53, 0xC7, 0x43, 0xA7, 0x05, 0xC0, 0x00, 0xDA, 0xB7, 0x04, 0xC0, 0x00, 
+    0xD0, 0x42, 0x09, 0x89, 0x0A, 0x70, 0xC1, 0x0A, 0xC7, 0x4E, 0x1A, 0x77, 0x76, 0x30, 0x07, 0x53, 
+    0x3D, 0xA7, 0x30, 0xD0, 0x75, 0x15, 0x0A, 0x7C, 0x30, 0x43, 0x07, 0x0D, 0xA7, 0x70, 0xC0, 0x53, 
+    0x04, 0x53, 0x0D, 0xA0, 0x44, 0x12, 0x53, 0x0D, 0xA0, 0xC3, 0x0A, 0x76, 0x15, 0x11, 0x13, 0x30, 
+    0x43, 0x0E, 0x00, 0x77, 0x70, 0xC0, 0x0A, 0x0C, 0x00, 0x00, 0x4F, 0x03, 0x1A, 0x74, 0x42, 0x00, 
+    0x60, 0x43, 0x08, 0x43, 0x10, 0x76, 0x33, 0xD0, 0x42, 0x00, 0xD0, 0x42, 0x04, 0x11, 0x5B, 0xA0, 
+    0x53, 0x03, 0x00, 0x76, 0x48, 0x1B, 0x43, 0x30, 0xA7, 0xC1, 0xDA, 0x7C, 0x41, 0x33, 0x31, 0x30, 
+    0xA7, 0xC3, 0x11, 0x59, 0x55, 0x15, 0x90, 0x51, 0xD0, 0x00, 0x43, 0x10, 0x75, 0xC1, 0xDA, 0x7C, 
+    0x00, 0x48, 0x00, 0x10, 0x42, 0x0F, 0x03, 0x30, 0xA0, 0xC1, 0x0A, 0x75, 0xD8, 0x00, 0x4E, 0x08, 
+    0x0A, 0x7C, 0x31, 0x07, 0x60, 0x42, 0x0E, 0x0C, 0x3D, 0xA7, 0x6B, 0x8D, 0xD5, 0x13, 0xD0, 0x42, 
+    0x07, 0x33, 0x30, 0x70, 0xC3, 0x51, 0x09, 0x00, 0x07, 0x77, 0x64, 0x11, 0x43, 0x06, 0x3D, 0xA7, 
+    0x43, 0x10, 0x43, 0x04, 0x0A, 0x74, 0x40, 0x43, 0x01, 0x31, 0x43, 0x02, 0x3D, 0xA0, 0xB7, 0x03, 
+    0xC3, 0x33, 0xD0, 0x00, 0xD0, 0x49, 0x00, 0xA0, 0x44, 0x00, 0x70, 0x43, 0xC7, 0x02, 0xC3, 0x00, 
+    0x42, 0x01, 0x11, 0x43, 0x00, 0x10, 0x42, 0x00, 0x10, 0x4E, 0x2C, 0x90, 0x00, 0x63, 0x00, 0x09, 
+    0x06, 0x33, 0xD9, 0x0C, 0x00, 0x90, 0x63, 0x3D, 0x90, 0xC1, 0x19, 0x04, 0x30, 0x00, 0xD0, 0x0C, 
+    0x00, 0x90, 0xB0, 0x22, 0xC0, 0x00, 0x33, 0x00, 0x33, 0x30, 0x90, 0x41, 0x3D, 0x00, 0xC0, 0x09, 
+    0x04, 0x00, 0xD0, 0x0C, 0x11, 0x90, 0xD0, 0x10, 0xC0, 0xD9, 0x0C, 0x30, 0x03, 0x00, 0x5C, 0x0D, 
+    0x00, 0x42, 0x02, 0xD0, 0x50, 0x4A, 0x05, 0x00, 0x31, 0x41, 0xF0, 0x0C, 0x05, 0x31, 0x03, 0x33, 
+    0xA1, 0xF3, 0x00, 0x01, 0x00, 0xA3, 0xF0, 0x02, 0x0E, 0x33, 0x30, 0x00, 0x33, 0x00, 0x03, 0x30, 
+    0x30, 0xB1, 0x03, 0x00, 0x31, 0xF0, 0x08, 0x07, 0x30, 0x00, 0x31, 0x13, 0xF0, 0x07, 0x07, 0x33, 
+    0x31, 0x14, 0x13, 0xF0, 0x09, 0x0A, 0x31, 0x30, 0x33, 0x00, 0x03, 0x30, 0xB1, 0x00, 0x30, 0xF0, 
+    0x14, 0x00, 0x30, 0xB1, 0x00, 0x30, 0xA0, 0x04, 0x30, 0x01, 0x10, 0xF0, 0x0A, 0xA1, 0xF0, 0x01, 
+    0xA3, 0xD0, 0x00, 0x30, 0xA1, 0xF0, 0x07, 0x05, 0x31, 0x30, 0x31, 0xA3, 0x04, 0x13, 0x30, 0x30, 
+    0xA1, 0xF3, 0x00, 0xA1, 0x00, 0x30, 0xA1, 0x0E, 0x33, 0x13, 0x33, 0x03, 0x11, 0x13, 0x00, 0x00, 
+    0xB3, 0x06, 0x01, 0x30, 0x01, 0x30, 0xF0, 0x07, 0x04, 0x31, 0x11, 0x30, 0xF0, 0x03, 0x00, 0x30, 
+    0xF0, 0x02, 0x00, 0x30, 0xA1, 0x00, 0x30, 0xF0, 0x03, 0x04, 0x31, 0x30, 0x00, 0xB3, 0xC0, 0xA3, 
+    0x03, 0x11, 0x33, 0xA1, 0x02, 0x31, 0x30, 0xB0, 0x00, 0x30, 0xD1, 0x04, 0x31, 0x13, 0x30, 0xF0, 
+    0x02, 0x05, 0x30, 0x00, 0x11, 0xF0, 0x03, 0x05, 0x33, 0x11, 0x13, 0xF0, 0x13, 0x07, 0x11, 0x14, 
+    0x41, 0x33, 0xD0, 0x02, 0x31, 0x30, 0xC0, 0x02, 0x33, 0x30, 0xD1, 0x06, 0x30, 0x03, 0x11, 0x10, 
+    0xB0, 0x43, 0x01, 0x31, 0xB0, 0x05, 0x11, 0x10, 0x03, 0xE1, 0x00, 0x30, 0xE0, 0x01, 0x11, 0xE0, 
+    0x00, 0x30, 0xC1, 0xF0, 0x0B, 0x03, 0x30, 0x00, 0xA3, 0xB0, 0x01, 0x31, 0xA4, 0x09, 0x13, 0x30, 
+    0x01, 0x13, 0x33, 0xE1, 0x00, 0x30, 0xF0, 0x03, 0x02, 0x11, 0x30, 0xA0, 0x04, 0x10, 0x01, 0x30, 
+    0xA0, 0x02, 0x11, 0x30, 0xF0, 0x03, 0x00, 0x30, 0xD1, 0x04, 0x33, 0x03, 0x10, 0xA0, 0xD1, 0x00, 
+    0x30, 0xF0, 0x0E, 0x02, 0x33, 0x30, 0xF0, 0x03, 0x02, 0x31, 0x10, 0xA4, 0x01, 0x14, 0xC1, 0x01, 
+    0x33, 0xF0, 0x0A, 0x07, 0x11, 0x30, 0x00, 0x31, 0xA0, 0x02, 0x11, 0x30, 0xF0, 0x0C, 0x00, 0x30, 
+    0xE1, 0x05, 0x44, 0x11, 0x33, 0xF0, 0x13, 0x02, 0x33, 0x30, 0xF0, 0x05, 0x02, 0x31, 0x10, 0xB4, 
+    0x02, 0x11, 0x30, 0x53, 0x03, 0x00, 0x11, 0xC0, 0x02, 0x11, 0x10, 0xF0, 0x0E, 0x47, 0x00, 0x30, 
+    0xF0, 0x14, 0x00, 0x30, 0xF0, 0x0F, 0x04, 0x33, 0x11, 0x10, 0xB4, 0xB1, 0xA3, 0xF0, 0x03, 0x07, 
+    0x31, 0x10, 0x03, 0x11, 0xF0, 0x06, 0x01, 0x33, 0xF1, 0x03, 0x01, 0x33, 0xF0, 0x14, 0x00, 0x30, 
+    0xF0, 0x09, 0x01, 0x33, 0xF0, 0x04, 0x02, 0x33, 0x30, 0xD1, 0xC4, 0xF1, 0x1F, 0x00, 0x30, 0xF0, 
+    0x1C, 0x51, 0x05, 0x00, 0x03, 0x33, 0xF0, 0x0D, 0xA3, 0xF1, 0x0E, 0xC3, 0xF0, 0x29, 0x02, 0x33, 
+    0x30, 0xF0, 0x12, 0x05, 0x30, 0x30, 0x33, 0xF0, 0x56, 0x03, 0x33, 0x13, 0xF0, 0x12, 0x00, 0x30, 
+    0xF0, 0x2E, 0x00, 0x30, 0xF0, 0x1E, 0x00, 0x30, 0xF0, 0x76, 0x4B, 0x02, 0x33, 0x30, 0xF0, 0x0A, 
+    0x01, 0x33, 0xF0, 0x64, 0x03, 0x30, 0x33, 0xF0, 0x03, 0x01, 0x33, 0xF0, 0x6A, 0x01, 0x33, 0xC0, 
+    0x02, 0x33, 0x10, 0xF0, 0x51, 0x03, 0x13, 0x03, 0xF0, 0x0C, 0x01, 0x33, 0xF0, 0x0A, 0x01, 0x33, 
+    0xF0, 0x14, 0x00, 0x30, 0x71, 0xA1, 0x02, 0x33, 0x30, 0xF0, 0x07, 0x00, 0x30, 0xF0, 0x5B, 0x05, 
+    0x33, 0x30, 0x03, 0xF1, 0x00, 0x01, 0x33, 0xF0, 0x60, 0xA3, 0xF0, 0x01, 0x04, 0x11, 0x33, 0x30, 
+    0xF1, 0x03, 0x00, 0x30, 0xF0, 0x4B, 0x03, 0x11, 0x30, 0xD3, 0xF0, 0x0B, 0x00, 0x30, 0xF1, 0x0A, 
+    0xD3, 0xF0, 0x03, 0x00, 0x30, 0xF0, 0x29, 0xF3, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x4A, 0x05, 
+    0x33, 0x30, 0x00, 0xF1, 0x00, 0x05, 0x31, 0x31, 0x30, 0xC1, 0x01, 0x33, 0xF1, 0x05, 0xB3, 0x02, 
+    0x11, 0x30, 0xF0, 0x14, 0x06, 0x30, 0x33, 0x03, 0x30, 0xD1, 0x00, 0x30, 0xA1, 0x08, 0x30, 0x00, 
+    0x11, 0x33, 0x30, 0xF0, 0x03, 0x02, 0x30, 0x30, 0xB0, 0xA1, 0xA3, 0x47, 0x03, 0x11, 0x33, 0xA1, 
+    0x02, 0x33, 0x00, 0x44, 0xB3, 0xF1, 0x29, 0x00, 0x30, 0xC0, 0x03, 0x31, 0x11, 0xB0, 0x4D, 0xF0, 
+    0x00, 0x00, 0x30, 0xF1, 0x04, 0x0C, 0x30, 0x33, 0x11, 0x03, 0x10, 0x33, 0x30, 0xB1, 0x07, 0x31, 
+    0x33, 0x31, 0x33, 0xA1, 0x00, 0x30, 0xA0, 0x0B, 0x31, 0x13, 0x30, 0x00, 0x33, 0x03, 0xC1, 0x00, 
+    0x30, 0xC0, 0x03, 0x33, 0x11, 0xB0, 0xA1, 0x03, 0x30, 0x33, 0xB0, 0x03, 0x13, 0x33, 0xF0, 0x19, 
+    0x01, 0x33, 0xD1, 0x00, 0x30, 0xF0, 0x04, 0x47, 0xE1, 0x00, 0x30, 0xF0, 0x01, 0x01, 0x30, 0x47, 
+    0x01, 0x33, 0xF0, 0x02, 0x01, 0x33, 0xA1, 0x02, 0x03, 0x10, 0x44, 0x00, 0x30, 0xF0, 0x07, 0x01, 
+    0x33, 0xF0, 0x13, 0x07, 0x31, 0x11, 0x33, 0x11, 0xA0, 0xC3, 0xD1, 0x05, 0x33, 0x31, 0x13, 0x45, 
+    0x02, 0x33, 0x30, 0xD1, 0x01, 0x03, 0xB1, 0x03, 0x33, 0x11, 0xE0, 0x0C, 0x33, 0x30, 0x00, 0x13, 
+    0x33, 0x13, 0x30, 0xF0, 0x31, 0x00, 0x30, 0xF1, 0x07, 0xA3, 0xF1, 0x04, 0x00, 0x30, 0xE0, 0xC1, 
+    0x15, 0x33, 0x31, 0x11, 0x33, 0x30, 0x33, 0x11, 0x10, 0x00, 0x10, 0x33, 0xF0, 0x3D, 0xB3, 0xF1, 
+    0x1C, 0x04, 0x33, 0x31, 0x30, 0xF0, 0x3A, 0x00, 0x30, 0xF0, 0x75, 0x00, 0x10, 0xF0, 0x09, 0x00, 
+    0x30, 0xF0, 0x4B, 0x03, 0x10, 0x01, 0xF0, 0x1D, 0x00, 0x30, 0x7F, 0xF0, 0x08, 0x0D, 0x10, 0x05, 
+    0x22, 0x2B, 0x55, 0x51, 0x13, 0xF0, 0x16, 0x00, 0x10, 0xF0, 0x44, 0xC1, 0x01, 0x21, 
+};
+
+const gfx_image_t STORY_CH6_IMG = {
+    .w = STORY_CH6_W, .h = STORY_CH6_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH6_PAL, .colors = STORY_CH6_PAL_SIZE,
+    .data = STORY_CH6_RLE, .size = STORY_CH6_RLE_SIZE,
 };
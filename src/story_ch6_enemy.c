@@ -6,341 +6,261 @@ const uint16_t STORY_CH6_ENEMY_PAL[STORY_CH6_ENEMY_PAL_SIZE] = {
     0x5144, 0x6391, 0x9AC6, 0xAC4D, 0x322C, 0xCD92, 0x7453, 0xA5B8, 
 };
 
-const uint8_t STORY_CH6_ENEMY_IDX[(STORY_CH6_ENEMY_W * STORY_CH6_ENEMY_H) / 2] = {
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x20, 0x30, 0x80, 0x88, 0x00, 0x00, 
-    0x0A, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x5A, 0x00, 0x04, 0x44, 0x44, 0x06, 0x66, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x60, 0x44, 0x44, 0x40, 0xAA, 0xAA, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 
-    0x88, 0x88, 0x88, 0x82, 0x22, 0x22, 0x20, 0x58, 0x22, 0x22, 0x77, 0x72, 0x22, 0x22, 0x22, 0x22, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x88, 0x05, 0x00, 0x00, 0x00, 0xAA, 
-    0xAA, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x50, 0x00, 0x04, 0x44, 0x46, 0x61, 0x11, 0x11, 0x11, 0x11, 
-    0x66, 0x11, 0x11, 0x11, 0x66, 0x44, 0x44, 0x0A, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 
-    0x88, 0x88, 0x88, 0x22, 0x22, 0x22, 0x05, 0x02, 0x77, 0x77, 0x77, 0x77, 0x22, 0x22, 0x22, 0x22, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x00, 0x80, 0x08, 0x80, 0x00, 0x8A, 0xA0, 0xAA, 
-    0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x04, 0x44, 0x40, 0x61, 0x11, 0x11, 0x61, 0x11, 0x11, 
-    0x11, 0x66, 0x66, 0x61, 0x11, 0x64, 0x44, 0x44, 0x4A, 0xA0, 0x0A, 0xA5, 0x00, 0xAA, 0xAA, 0xAA, 
-    0x00, 0x88, 0x88, 0x82, 0x22, 0x28, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 0x22, 0x22, 
-    0x77, 0x77, 0x77, 0x77, 0x77, 0xCC, 0x77, 0x00, 0x08, 0x88, 0x08, 0x88, 0x05, 0x00, 0xAA, 0xAA, 
-    0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x04, 0x44, 0x61, 0x16, 0x66, 0x61, 0x11, 0x11, 0x61, 
-    0x11, 0x66, 0x66, 0x66, 0x66, 0x11, 0x04, 0x44, 0x44, 0x00, 0x0A, 0xAA, 0x05, 0x5A, 0xAA, 0xA5, 
-    0x55, 0x88, 0x88, 0x22, 0x22, 0x00, 0x77, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x77, 0x72, 0x22, 0x22, 
-    0x77, 0x77, 0x77, 0x77, 0xCC, 0xCC, 0x77, 0x08, 0x80, 0x88, 0x08, 0x80, 0x00, 0x55, 0xAA, 0xAA, 
-    0xAA, 0xA5, 0x55, 0x55, 0x55, 0x5A, 0x04, 0x44, 0x06, 0x11, 0x66, 0x61, 0x11, 0x11, 0x11, 0xD6, 
-    0x11, 0x16, 0x66, 0x66, 0x66, 0x61, 0x60, 0x44, 0x44, 0x44, 0x0A, 0xAA, 0x55, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x08, 0x22, 0x80, 0x08, 0x77, 0xCC, 0xCC, 0xCC, 0xCC, 0xC7, 0x77, 0x72, 0x22, 0x22, 
-    0x77, 0xC7, 0x77, 0x77, 0xCC, 0xCC, 0xC0, 0x08, 0x80, 0x00, 0x00, 0x00, 0x08, 0x04, 0x5A, 0xAA, 
-    0xAA, 0xA5, 0x55, 0x55, 0x00, 0x04, 0x44, 0x40, 0x61, 0x16, 0x61, 0x11, 0x11, 0x11, 0x11, 0x43, 
-    0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x11, 0x64, 0x44, 0x44, 0x40, 0x0A, 0x55, 0x5A, 0xAA, 0xAA, 
-    0xAA, 0xA5, 0x88, 0x88, 0x00, 0x27, 0x7C, 0x0C, 0xCC, 0xCC, 0xCC, 0xC7, 0x77, 0x72, 0x22, 0x22, 
-    0x77, 0x7C, 0xCC, 0xCC, 0xCC, 0x0C, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x45, 0x5A, 
-    0xAA, 0xA5, 0x00, 0x00, 0x44, 0x44, 0x44, 0x06, 0x11, 0x61, 0x11, 0x11, 0x11, 0x11, 0x1D, 0xB3, 
-    0x61, 0x11, 0x11, 0x16, 0x66, 0x66, 0x61, 0x16, 0x44, 0x44, 0x44, 0x40, 0x55, 0x5A, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x88, 0x80, 0x08, 0x27, 0x7C, 0x00, 0x00, 0x00, 0xC7, 0x77, 0x77, 0x77, 0x22, 0x22, 
-    0x77, 0x77, 0xCC, 0xCC, 0xC0, 0x00, 0x00, 0x88, 0x80, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0xA4, 0x5A, 
-    0x5A, 0x00, 0x44, 0x04, 0x44, 0x44, 0x40, 0x61, 0x16, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1D, 0x53, 
-    0xD1, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66, 0x16, 0x04, 0x00, 0x44, 0x40, 0x55, 0x55, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0x08, 0x05, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x22, 
-    0x77, 0x77, 0x7C, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x80, 0x05, 0xAA, 0xAA, 0x00, 0x00, 0xA5, 0x55, 
-    0x50, 0x04, 0x44, 0x44, 0x44, 0x44, 0x46, 0x11, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x03, 
-    0x31, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x61, 0x60, 0x00, 0x44, 0x40, 0x55, 0x50, 0xAA, 0x0A, 
-    0xAA, 0x5A, 0xA5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 
-    0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x05, 0x5A, 0xAA, 0xAA, 0x55, 0x55, 0x54, 
-    0x05, 0x44, 0x44, 0x44, 0x44, 0x44, 0x61, 0x16, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xD0, 0x03, 
-    0x36, 0x11, 0x11, 0x11, 0x16, 0x66, 0x66, 0x66, 0x16, 0x06, 0x04, 0x44, 0x45, 0x00, 0xA0, 0x40, 
-    0x55, 0xA5, 0xAA, 0xAA, 0xA5, 0xA5, 0x50, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x22, 
-    0xCC, 0x77, 0x7C, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x05, 0x55, 0x5A, 0xAA, 0xAA, 0xA5, 0x55, 0xAA, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x61, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0x0E, 
-    0x93, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x61, 0x66, 0x64, 0x44, 0x45, 0x00, 0x00, 0x04, 
-    0x0A, 0xA5, 0xAA, 0xAA, 0x55, 0x5B, 0xB5, 0x50, 0x80, 0x07, 0x7C, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA5, 0x5A, 0x5A, 0xAA, 0xAA, 0xA5, 0x55, 0x55, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x11, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1B, 0x08, 0x09, 
-    0x05, 0x31, 0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x61, 0x60, 0x60, 0x44, 0x44, 0x00, 0x04, 0x44, 
-    0x00, 0x00, 0xAA, 0xA0, 0x45, 0xA4, 0x45, 0x50, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x55, 0x55, 0xAA, 0xAA, 0x0A, 0xB4, 0x44, 
-    0x44, 0x40, 0x44, 0x44, 0x44, 0x06, 0x16, 0x61, 0x11, 0x11, 0x11, 0x11, 0x16, 0x50, 0x02, 0x03, 
-    0x33, 0x33, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x10, 0x06, 0x44, 0x44, 0x00, 0x44, 0x40, 
-    0x44, 0x00, 0x00, 0x44, 0x5A, 0xAB, 0xB5, 0x58, 0x87, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x55, 0x55, 0x55, 0xA0, 0x00, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x40, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x65, 0x00, 0xC7, 0x03, 
-    0x33, 0xF3, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x16, 0x40, 0x44, 0x44, 0x40, 0x40, 0x00, 
-    0x44, 0x40, 0x44, 0x0A, 0xAA, 0x55, 0x55, 0x00, 0x88, 0x00, 0x0C, 0xCC, 0x77, 0x77, 0x77, 0x77, 
-    0x77, 0x7C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0xBA, 0x55, 0x55, 0x55, 0x00, 0x04, 0x44, 0x44, 
-    0x4D, 0x44, 0x44, 0x44, 0x00, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0x00, 0xCC, 0x00, 
-    0x01, 0x10, 0x33, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x66, 0x16, 0x00, 0x04, 0x44, 0x40, 0x40, 0x44, 
-    0x44, 0x44, 0x44, 0x5A, 0xA5, 0x55, 0x55, 0x08, 0x88, 0x88, 0x00, 0xCC, 0xCC, 0x77, 0xCC, 0x77, 
-    0x77, 0x7C, 0xC0, 0x00, 0x05, 0x55, 0x00, 0x55, 0xD5, 0xA5, 0x55, 0x55, 0x00, 0x04, 0x44, 0x44, 
-    0x6D, 0x44, 0x44, 0x44, 0x06, 0x61, 0x61, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x09, 0x0C, 0x91, 
-    0x11, 0x11, 0x03, 0x31, 0x11, 0x11, 0x11, 0x11, 0x66, 0x11, 0x60, 0x00, 0x44, 0x40, 0x00, 0x44, 
-    0x44, 0x44, 0x44, 0x45, 0x55, 0x55, 0x55, 0x58, 0x88, 0x00, 0x00, 0xCC, 0xCC, 0x7C, 0xCC, 0x77, 
-    0x77, 0x7C, 0x00, 0x00, 0x00, 0x55, 0x55, 0x35, 0x55, 0x55, 0x55, 0x5B, 0x40, 0x44, 0x44, 0x44, 
-    0x66, 0x44, 0x40, 0x00, 0x06, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x15, 0x00, 0x09, 0x90, 0x91, 
-    0x11, 0x11, 0x03, 0x56, 0x11, 0x11, 0x11, 0x16, 0x66, 0x61, 0x60, 0x66, 0x04, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0x45, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-    0x77, 0x77, 0xC0, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0x44, 0x44, 0x44, 0x44, 
-    0x66, 0x00, 0x00, 0x00, 0x06, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0xD5, 0x00, 0x9E, 0xE0, 0x01, 
-    0x11, 0x11, 0x03, 0x3D, 0x11, 0x11, 0x11, 0x16, 0x66, 0x61, 0x60, 0x66, 0x04, 0x44, 0x44, 0x44, 
-    0x44, 0x44, 0x44, 0x44, 0xB5, 0xAA, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xC0, 0x99, 0x3F, 
-    0x77, 0xCC, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x60, 0x04, 0x06, 0x00, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0xD5, 0x00, 0x09, 0x90, 0x01, 
-    0x11, 0x11, 0xF3, 0x33, 0x11, 0x11, 0x11, 0x16, 0x66, 0x61, 0x66, 0x66, 0x64, 0x44, 0x44, 0x44, 
-    0x44, 0xD4, 0x44, 0x44, 0x5A, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x09, 0x9E, 0x30, 0x11, 0x11, 
-    0x77, 0x77, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x40, 0x44, 0x44, 0x44, 0x44, 0x46, 
-    0x60, 0x44, 0x06, 0x06, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0xBA, 0x50, 0x0C, 0xCC, 0x01, 
-    0x11, 0x10, 0x33, 0x55, 0x61, 0x11, 0x11, 0x11, 0x16, 0x61, 0x66, 0x66, 0x66, 0x44, 0x44, 0x44, 
-    0x44, 0x64, 0x44, 0x44, 0xA5, 0x5A, 0x55, 0x55, 0x00, 0x00, 0x33, 0xF0, 0x11, 0x11, 0x11, 0x11, 
-    0x77, 0x77, 0x00, 0x00, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 
-    0x60, 0x00, 0x00, 0x06, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x5A, 0x00, 0x0C, 0xC7, 0x0F, 
-    0x11, 0xF3, 0x30, 0x5B, 0x61, 0x11, 0x11, 0x11, 0x11, 0x61, 0x16, 0x61, 0x66, 0x60, 0x64, 0x44, 
-    0x44, 0x64, 0x44, 0x40, 0x00, 0xA5, 0x55, 0x50, 0x33, 0x3F, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x95, 0x55, 0xB3, 0xDB, 0xA4, 0x44, 0x44, 0x44, 0x44, 0x46, 
-    0x60, 0x00, 0x06, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x5A, 0x07, 0x77, 0xC7, 0xC3, 
-    0xF0, 0x33, 0x30, 0x05, 0x61, 0x11, 0x11, 0x11, 0x11, 0x61, 0x11, 0x11, 0x66, 0x60, 0x60, 0x44, 
-    0x44, 0x46, 0x66, 0x44, 0x05, 0x55, 0x33, 0x33, 0xFF, 0xF0, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1F, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x53, 0x33, 0x3D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x46, 
-    0x60, 0x00, 0x66, 0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0xB0, 0x07, 0x77, 0x77, 0x73, 
-    0x33, 0x33, 0x90, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x60, 0x00, 
-    0x00, 0x46, 0x6D, 0xD3, 0xB3, 0x33, 0x33, 0x33, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x90, 
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x99, 0x9E, 0x33, 0x33, 0x33, 0xDD, 0x44, 0x44, 0x44, 0x44, 0x46, 
-    0x66, 0x66, 0x66, 0x61, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x40, 0x00, 0x77, 0x77, 0x03, 
-    0x33, 0x39, 0x99, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 
-    0x66, 0xD3, 0x33, 0xEE, 0xEE, 0xEE, 0x33, 0xFF, 0xF3, 0x33, 0x3F, 0xFF, 0x3E, 0x99, 0x0C, 0xC7, 
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x09, 0xEE, 0x33, 0xDB, 0xB3, 0x34, 0x44, 0x44, 0x44, 0x04, 0x46, 
-    0x66, 0x66, 0x66, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x40, 0x82, 0x22, 0x22, 0x03, 
-    0xE9, 0x3E, 0x90, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x63, 
-    0x33, 0xE9, 0x99, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x99, 0x0C, 0xC7, 0x77, 0x77, 
-    0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x09, 0xE3, 0xDD, 0xBD, 0x44, 0x44, 0x44, 0x40, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0xB0, 0x82, 0x22, 0x22, 0x79, 
-    0xE3, 0x00, 0xC0, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x33, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x33, 0x30, 0x00, 0x00, 0x77, 0x77, 0x7C, 0xCC, 
-    0x55, 0x55, 0x50, 0x00, 0x00, 0x55, 0x55, 0x03, 0x1D, 0xDD, 0xD4, 0x44, 0x44, 0x66, 0x66, 0x66, 
-    0x66, 0x16, 0x66, 0x61, 0x11, 0x11, 0x11, 0x16, 0x11, 0x11, 0x16, 0xB8, 0x80, 0x22, 0x22, 0x79, 
-    0x00, 0xC0, 0x00, 0x03, 0x11, 0x11, 0x1D, 0xD6, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3E, 0x99, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x3B, 0xB3, 0xBB, 0x50, 0x00, 0x00, 0x77, 0x77, 0x7C, 0xCC, 
-    0x5B, 0x45, 0x50, 0x00, 0x99, 0x05, 0x55, 0x00, 0x36, 0x6D, 0xDD, 0x44, 0x4D, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x6D, 0x66, 0x11, 0x11, 0x40, 0x82, 0x22, 0x22, 0x70, 
-    0xC0, 0x99, 0x00, 0x03, 0x11, 0x16, 0xD5, 0x55, 0x61, 0x11, 0x11, 0x33, 0x33, 0x3E, 0xEE, 0xE9, 
-    0x99, 0x99, 0x99, 0x99, 0xE3, 0x33, 0xBB, 0x44, 0x45, 0x50, 0x00, 0x00, 0x07, 0x77, 0x70, 0x0C, 
-    0xB4, 0x44, 0xB0, 0x05, 0x33, 0x33, 0x30, 0x95, 0x5D, 0x66, 0xDD, 0x44, 0x44, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0xB5, 0xDD, 0x61, 0x11, 0x45, 0x82, 0x22, 0x22, 0x20, 
-    0x09, 0xE9, 0x00, 0x06, 0x11, 0x64, 0x55, 0x00, 0xD1, 0x10, 0x33, 0x33, 0x33, 0x3E, 0x99, 0x90, 
-    0x00, 0x90, 0x93, 0x3D, 0x66, 0x6D, 0x44, 0x44, 0x45, 0x00, 0x00, 0x00, 0x00, 0x77, 0xC0, 0x90, 
-    0xBB, 0xB4, 0x45, 0x55, 0xB3, 0x33, 0x33, 0x30, 0x5B, 0xD6, 0x66, 0x64, 0x4D, 0x66, 0x16, 0x66, 
-    0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x16, 0x50, 0xDD, 0xD1, 0x11, 0xDA, 0x82, 0x22, 0x22, 0x20, 
-    0x0E, 0x39, 0x00, 0x01, 0x11, 0xD5, 0x00, 0x80, 0xDD, 0x0F, 0x33, 0x33, 0x39, 0x99, 0x99, 0x00, 
-    0x93, 0x3D, 0x66, 0x66, 0x6D, 0xD4, 0x44, 0x04, 0x55, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x99, 
-    0xD3, 0xBB, 0x4B, 0xBB, 0xB3, 0x33, 0x33, 0x30, 0xB4, 0x46, 0x66, 0x66, 0x6D, 0x66, 0x66, 0x66, 
-    0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x6B, 0x08, 0xBB, 0xB6, 0x11, 0xDA, 0x82, 0x22, 0x22, 0x20, 
-    0x0E, 0x30, 0x00, 0x01, 0x16, 0x50, 0x08, 0x25, 0x33, 0x33, 0x33, 0x39, 0x99, 0x00, 0x03, 0x33, 
-    0x66, 0x66, 0x66, 0x66, 0xD4, 0x44, 0x44, 0x45, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 
-    0x33, 0x3B, 0x43, 0xBB, 0xBB, 0x33, 0x33, 0x3B, 0xBB, 0x44, 0xD6, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0xD5, 0x08, 0x5B, 0x5D, 0x11, 0x4A, 0x82, 0x22, 0x22, 0x20, 
-    0x9E, 0xE0, 0x00, 0x01, 0x1B, 0x00, 0x22, 0x2B, 0xBB, 0x33, 0x33, 0x00, 0x33, 0x33, 0x61, 0x11, 
-    0x66, 0x66, 0x66, 0x64, 0x44, 0x44, 0x44, 0x55, 0x55, 0x55, 0x50, 0x00, 0xC0, 0x00, 0x55, 0x00, 
-    0x6D, 0x33, 0xBB, 0xBB, 0x5B, 0xBB, 0x5B, 0xBB, 0xBB, 0x44, 0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x61, 0x11, 0x11, 0x11, 0x11, 0x63, 0x50, 0x08, 0x0B, 0x05, 0x66, 0x58, 0x82, 0x22, 0x22, 0x20, 
-    0x9E, 0x90, 0x0C, 0x0D, 0xD0, 0x02, 0x22, 0x03, 0x00, 0x33, 0x33, 0x33, 0x61, 0x11, 0x11, 0x11, 
-    0x16, 0x66, 0x66, 0x44, 0x44, 0x44, 0x44, 0xB5, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 
-    0xD1, 0x63, 0xB5, 0xBB, 0xAB, 0x4B, 0x55, 0xBB, 0x44, 0x44, 0x4D, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x66, 0x30, 0x00, 0x00, 0x03, 0x88, 0x44, 0xA8, 0x82, 0x22, 0x22, 0x20, 
-    0x93, 0xE0, 0x00, 0x00, 0x50, 0x82, 0x22, 0x53, 0x00, 0x03, 0x36, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x16, 0x66, 0x66, 0x04, 0x44, 0x44, 0x44, 0x4B, 0xB5, 0x55, 0x00, 0x05, 0x5B, 0xB5, 0x50, 0x00, 
-    0xD6, 0x66, 0x35, 0x55, 0x05, 0x4B, 0x55, 0x54, 0x44, 0x44, 0xDD, 0x4D, 0x66, 0x66, 0x66, 0x61, 
-    0x11, 0x11, 0x16, 0xDD, 0x55, 0x00, 0x00, 0x00, 0x03, 0x08, 0xAA, 0x08, 0x22, 0x22, 0x22, 0x23, 
-    0x33, 0x39, 0x00, 0x00, 0x00, 0x82, 0x22, 0x33, 0xE9, 0x00, 0x55, 0xBD, 0x11, 0x11, 0x11, 0x11, 
-    0x16, 0x66, 0x66, 0x66, 0x44, 0x44, 0x44, 0x4B, 0xB5, 0x5B, 0xBB, 0xBD, 0xD5, 0x50, 0x00, 0x00, 
-    0x3D, 0x61, 0xD3, 0xBB, 0x55, 0xDB, 0x00, 0x04, 0x44, 0x44, 0xD6, 0x66, 0x66, 0x66, 0x11, 0x11, 
-    0x16, 0x66, 0x6B, 0x50, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x58, 0x88, 0x88, 0x22, 0x22, 0x22, 0x7F, 
-    0x11, 0x39, 0x00, 0x00, 0x08, 0x08, 0x20, 0xD3, 0xFE, 0x99, 0x00, 0x00, 0x5D, 0x61, 0x11, 0x11, 
-    0x11, 0x66, 0x66, 0x66, 0x44, 0x44, 0xBB, 0x44, 0xB5, 0xBB, 0x55, 0x53, 0xB0, 0x00, 0x00, 0x00, 
-    0x53, 0xD6, 0xDD, 0x3B, 0xB5, 0xD4, 0x00, 0x44, 0x44, 0x44, 0x46, 0x66, 0x61, 0x16, 0x61, 0xF3, 
-    0x3D, 0x6D, 0x50, 0x00, 0x00, 0x00, 0x00, 0x99, 0x03, 0x52, 0x22, 0x22, 0x22, 0x22, 0x22, 0x73, 
-    0x11, 0x39, 0x00, 0x00, 0x00, 0x82, 0x20, 0x61, 0xF3, 0x39, 0x99, 0x90, 0x00, 0x53, 0x11, 0x11, 
-    0x11, 0x66, 0x66, 0x66, 0x44, 0x44, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x33, 0x33, 0xBB, 0x45, 0xD4, 0x04, 0x45, 0xB6, 0x46, 0x66, 0x11, 0xD3, 0x33, 0x33, 0x33, 
-    0xDD, 0xB0, 0x77, 0xC0, 0x99, 0x99, 0x99, 0x9E, 0x93, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x03, 
-    0x16, 0x30, 0x00, 0x70, 0x00, 0x82, 0x2B, 0x60, 0xF3, 0xFE, 0xEE, 0xE9, 0x00, 0x00, 0x5D, 0x11, 
-    0x11, 0x16, 0x66, 0x66, 0x04, 0x44, 0x44, 0x4B, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x50, 0x00, 
-    0x55, 0x33, 0x33, 0x5B, 0x45, 0xBD, 0x44, 0x4B, 0x0B, 0x6D, 0x33, 0x33, 0x3E, 0x33, 0x33, 0x3D, 
-    0xB0, 0x27, 0xCC, 0x09, 0x9E, 0xEE, 0x33, 0xE9, 0x0B, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 
-    0x00, 0x72, 0x27, 0x00, 0x00, 0x82, 0x23, 0x1F, 0x3F, 0x0F, 0x00, 0xF3, 0xEE, 0x90, 0x00, 0xD1, 
-    0x11, 0x16, 0x66, 0x66, 0x44, 0x44, 0x44, 0x4B, 0x55, 0x55, 0xBB, 0xB0, 0x00, 0x05, 0x55, 0x00, 
-    0x55, 0x5B, 0x33, 0xBB, 0x45, 0x5D, 0x44, 0x44, 0x58, 0x53, 0x50, 0x09, 0x99, 0x9E, 0x95, 0xBB, 
-    0x02, 0x7C, 0x09, 0x9E, 0xEE, 0x33, 0x3F, 0xF3, 0x05, 0x32, 0x28, 0x08, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x70, 0x00, 0x00, 0x50, 0x82, 0x0D, 0x33, 0xF0, 0x11, 0x11, 0x10, 0x00, 0x39, 0x00, 0x0D, 
-    0x11, 0x11, 0x66, 0x60, 0x04, 0x44, 0x4D, 0x44, 0x4B, 0xBB, 0xBB, 0xB5, 0x5B, 0x3B, 0x50, 0x00, 
-    0x35, 0x55, 0xB3, 0xB5, 0xB5, 0x0B, 0x5B, 0x44, 0x40, 0x00, 0x00, 0x09, 0x90, 0x00, 0x05, 0x50, 
-    0x27, 0xC0, 0x9E, 0xE3, 0x3E, 0xFF, 0xF0, 0x11, 0x3B, 0x38, 0x28, 0x08, 0x88, 0x22, 0x22, 0x27, 
-    0x00, 0x03, 0x33, 0x3B, 0xB0, 0x02, 0x0D, 0x30, 0x11, 0x11, 0x11, 0x11, 0x11, 0x03, 0x90, 0x00, 
-    0x61, 0x11, 0x66, 0x00, 0x00, 0x44, 0xDD, 0x44, 0x44, 0x44, 0xBB, 0xBB, 0xBD, 0x3B, 0x50, 0x00, 
-    0x3B, 0xBB, 0xBB, 0xBB, 0x45, 0xAA, 0x5A, 0xB6, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 
-    0x70, 0x09, 0x9E, 0x33, 0x33, 0x33, 0x01, 0x11, 0x35, 0xB8, 0x28, 0x00, 0x88, 0x80, 0x00, 0x05, 
-    0xD6, 0x16, 0xD3, 0x33, 0x3B, 0x02, 0x03, 0x3F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x33, 0x00, 
-    0x51, 0x11, 0x66, 0x00, 0x00, 0x4D, 0xD4, 0x4B, 0xBB, 0x44, 0x4B, 0xBB, 0xBB, 0x55, 0x55, 0x00, 
-    0x5B, 0x4B, 0xB4, 0x44, 0x55, 0xA0, 0xA5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 
-    0xC0, 0x99, 0xEE, 0xEE, 0x30, 0x53, 0xF1, 0x11, 0x35, 0x38, 0x20, 0x00, 0x00, 0x80, 0x00, 0x0B, 
-    0x66, 0x6D, 0x3D, 0xDD, 0xD5, 0x02, 0x03, 0x3F, 0x11, 0x13, 0x33, 0x11, 0x11, 0x11, 0x10, 0x30, 
-    0x03, 0x16, 0x66, 0x00, 0x00, 0x6D, 0x44, 0x44, 0x44, 0x44, 0x44, 0xBB, 0x55, 0x50, 0x00, 0x00, 
-    0x55, 0x3D, 0xB4, 0xBA, 0xAA, 0xA0, 0xBB, 0x08, 0x00, 0x99, 0x90, 0x00, 0x90, 0x00, 0x08, 0x27, 
-    0x09, 0xEE, 0xE9, 0x05, 0x00, 0x03, 0x31, 0x0F, 0x35, 0xB8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0B, 
-    0x66, 0x66, 0xDD, 0xD3, 0x33, 0x02, 0x03, 0x30, 0x00, 0x33, 0xB5, 0xBD, 0x11, 0x11, 0x10, 0x30, 
-    0x05, 0x66, 0x66, 0x66, 0x04, 0x44, 0x44, 0x4D, 0x44, 0x44, 0x4B, 0x55, 0x55, 0x00, 0x00, 0x00, 
-    0x30, 0x33, 0x00, 0x82, 0x05, 0x50, 0x50, 0x08, 0x28, 0x00, 0x00, 0x00, 0x00, 0x93, 0x02, 0x27, 
-    0x00, 0x99, 0x90, 0x05, 0x50, 0x53, 0x33, 0x3E, 0xE5, 0x52, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 
-    0x66, 0x16, 0x33, 0x33, 0x1F, 0x92, 0x03, 0x33, 0x33, 0x33, 0xB3, 0x53, 0xD1, 0x11, 0x10, 0xE9, 
-    0x00, 0xD6, 0x66, 0x66, 0x64, 0x44, 0x44, 0xDD, 0x44, 0x44, 0xB5, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x0F, 0x02, 0x22, 0x20, 0x08, 0x80, 0x00, 0x5A, 0x88, 0x00, 0x53, 0x31, 0x13, 0x82, 0x27, 
-    0xCC, 0x09, 0x00, 0x00, 0xB0, 0xB5, 0x55, 0x00, 0x9B, 0x52, 0x09, 0x99, 0x00, 0x00, 0x00, 0x03, 
-    0x11, 0x16, 0x33, 0x01, 0x03, 0x97, 0x03, 0x39, 0x03, 0x35, 0xDD, 0xB5, 0x53, 0xF0, 0x0F, 0xE9, 
-    0x00, 0xB6, 0x66, 0x66, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x00, 0x00, 0x00, 0x80, 0x00, 
-    0x32, 0x73, 0x32, 0x22, 0x28, 0x88, 0x80, 0x05, 0x44, 0xB8, 0x0D, 0x61, 0x11, 0x15, 0x22, 0x27, 
-    0x7C, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00, 0x0B, 0x07, 0x09, 0x99, 0x99, 0xEE, 0x90, 0x03, 
-    0x33, 0x11, 0x11, 0x11, 0x10, 0x30, 0x83, 0x3E, 0x00, 0x50, 0x36, 0xBB, 0x53, 0x3F, 0xF3, 0xE9, 
-    0x00, 0x56, 0x66, 0x66, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x50, 0x00, 0x00, 0x00, 0x07, 0x72, 
-    0x10, 0x20, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x44, 0x4A, 0xB6, 0x66, 0x11, 0x10, 0x22, 0x27, 
-    0x7C, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x99, 0xEE, 0xEE, 0xEF, 0xE0, 0x0E, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x03, 0x2B, 0x33, 0x00, 0x00, 0x03, 0xB0, 0x09, 0x33, 0xF3, 0xE9, 
-    0x00, 0x56, 0x66, 0x6D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x55, 0x00, 0x00, 0x00, 0x77, 0x08, 
-    0x00, 0x22, 0x03, 0x54, 0x44, 0xBA, 0x05, 0x5B, 0x44, 0x4B, 0x66, 0x66, 0x11, 0x60, 0x22, 0x27, 
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x29, 0xEE, 0xE0, 0x00, 0xF0, 0xE9, 0x93, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x35, 0x50, 0x05, 0x50, 0x00, 0x09, 0xE3, 0x33, 0x99, 
-    0x00, 0x06, 0x66, 0x6D, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x55, 0x00, 0x00, 0x88, 0x88, 0x88, 
-    0x22, 0x22, 0xC9, 0xB4, 0x44, 0x04, 0xA5, 0xB4, 0x44, 0x44, 0x66, 0x66, 0x66, 0x40, 0x22, 0x27, 
-    0xCC, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0xEE, 0xE0, 0x00, 0xFF, 0x9E, 0xE3, 
-    0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x32, 0x05, 0x50, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xEE, 0x99, 
-    0x00, 0x03, 0x66, 0x66, 0xD4, 0x44, 0x44, 0x44, 0x4B, 0x55, 0x55, 0x50, 0x00, 0x05, 0x55, 0x55, 
-    0x22, 0x27, 0x00, 0xB4, 0x44, 0x44, 0x55, 0x44, 0x44, 0x44, 0x46, 0x66, 0x64, 0x58, 0x22, 0x77, 
-    0x7C, 0xC7, 0xC0, 0x00, 0x00, 0x08, 0x80, 0x00, 0x2C, 0x99, 0xEE, 0x00, 0x0F, 0xFE, 0x99, 0x03, 
-    0x16, 0x61, 0x11, 0x11, 0x11, 0x11, 0x1E, 0x20, 0x50, 0x00, 0x00, 0x09, 0x39, 0x90, 0xEE, 0x99, 
-    0x00, 0x05, 0xD6, 0x66, 0xDD, 0x44, 0x44, 0x44, 0x55, 0x55, 0x50, 0x00, 0x00, 0x05, 0xD0, 0x88, 
-    0x27, 0xC0, 0x93, 0xB4, 0x44, 0x44, 0xB5, 0x44, 0x44, 0x44, 0x40, 0x66, 0x64, 0x08, 0x22, 0x77, 
-    0xC7, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2C, 0x99, 0x9E, 0xEE, 0x00, 0xEE, 0x00, 0x03, 
-    0x66, 0x16, 0x11, 0x11, 0x11, 0x11, 0x00, 0x02, 0x03, 0xB5, 0x59, 0x33, 0x99, 0x00, 0x99, 0x90, 
-    0xCC, 0x00, 0x56, 0x66, 0xD4, 0x44, 0xBB, 0xBB, 0xB5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x99, 0x54, 0x00, 0x44, 0x40, 0xB4, 0x44, 0x44, 0x46, 0x66, 0x65, 0x82, 0x22, 0x27, 
-    0x77, 0x77, 0x70, 0x00, 0x00, 0x00, 0x08, 0x22, 0x7C, 0xC9, 0x99, 0x99, 0xEE, 0x93, 0x99, 0x9B, 
-    0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0xF0, 0x22, 0x05, 0x55, 0x33, 0x90, 0x00, 0x09, 0x90, 
-    0x00, 0x88, 0xBD, 0xDD, 0xD3, 0xBB, 0x5B, 0xB5, 0xBB, 0xB5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x77, 0x7C, 0x00, 0xB4, 0x40, 0x04, 0x4A, 0xA4, 0x44, 0x44, 0x40, 0x66, 0x40, 0x82, 0x22, 0x27, 
-    0x77, 0x77, 0x08, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7C, 0xCC, 0x99, 0xC9, 0x99, 0x09, 0x39, 0x0B, 
-    0x66, 0x16, 0x11, 0x11, 0x11, 0x11, 0x10, 0xFE, 0x72, 0x22, 0x22, 0x20, 0x30, 0x00, 0x09, 0x00, 
-    0x00, 0x05, 0x33, 0x33, 0x33, 0x90, 0xB3, 0x33, 0x90, 0x05, 0xB3, 0xB5, 0x00, 0x00, 0x00, 0x00, 
-    0x72, 0x27, 0x00, 0xBB, 0x40, 0x04, 0x4A, 0xA4, 0xD4, 0x44, 0x40, 0x66, 0x65, 0x88, 0x22, 0x77, 
-    0x77, 0x00, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 0xCC, 0xCC, 0xC0, 0x00, 0x00, 0x05, 0x5B, 
-    0xDD, 0xD6, 0x11, 0x11, 0x11, 0x11, 0x10, 0x39, 0xC2, 0x22, 0x22, 0x22, 0x03, 0x50, 0x00, 0x00, 
-    0x05, 0x55, 0x33, 0x33, 0x35, 0x55, 0x5B, 0x35, 0x00, 0x00, 0x00, 0x53, 0x3B, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x05, 0x3B, 0x44, 0x00, 0x4A, 0xAD, 0x60, 0x44, 0x46, 0x66, 0xD0, 0x82, 0x88, 0x00, 
-    0x00, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 0xCC, 0xCC, 0xC0, 0x00, 0x00, 0x05, 0x5B, 
-    0xDD, 0xDD, 0x33, 0x63, 0x30, 0xF0, 0xF3, 0xE0, 0x72, 0x22, 0x22, 0x22, 0x28, 0x55, 0x50, 0x05, 
-    0x55, 0x50, 0x50, 0x00, 0x00, 0x05, 0x35, 0x35, 0x00, 0x00, 0x55, 0x53, 0x33, 0xB5, 0x80, 0x00, 
-    0x72, 0x22, 0x23, 0xF0, 0x5B, 0xD6, 0x66, 0x46, 0x66, 0x66, 0x66, 0x66, 0x40, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0xCC, 0x77, 0x77, 0x00, 0x00, 0x55, 0xB5, 
-    0xDD, 0xDD, 0xD3, 0x33, 0x33, 0x33, 0x3E, 0x0C, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x05, 0x53, 0x33, 0x33, 0x00, 0x00, 0xB3, 0x30, 0x05, 0x50, 0x00, 
-    0x22, 0x22, 0x03, 0x3F, 0x30, 0x53, 0x66, 0x16, 0xDB, 0xBD, 0x66, 0x66, 0xD0, 0x22, 0x72, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 0xC7, 0x70, 0x88, 0x00, 0x00, 0x05, 
-    0xDD, 0x66, 0xDD, 0x61, 0xD3, 0x33, 0xE9, 0x00, 0x72, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x05, 
-    0x55, 0x50, 0x03, 0x33, 0x33, 0x00, 0x53, 0xD3, 0x33, 0x33, 0x30, 0x00, 0x09, 0x00, 0x00, 0x08, 
-    0x22, 0x27, 0x00, 0x33, 0x01, 0x30, 0x5B, 0xD6, 0x65, 0x22, 0x0B, 0x6D, 0x08, 0x80, 0x00, 0x00, 
-    0x00, 0x00, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x77, 0x00, 0x00, 0x20, 0x00, 0x05, 
-    0x6D, 0xDD, 0x36, 0x61, 0xD3, 0x33, 0xE0, 0x0C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x05, 
-    0xBB, 0xB3, 0x33, 0x33, 0x00, 0x00, 0x03, 0x33, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x90, 0x00, 
-    0x22, 0x22, 0x2C, 0x09, 0x01, 0x13, 0x39, 0x00, 0x5B, 0x02, 0x22, 0x00, 0x22, 0x20, 0x00, 0x00, 
-    0x03, 0x30, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x88, 0x80, 0x00, 0x00, 0x05, 
-    0x6D, 0xDD, 0x61, 0x1D, 0xD3, 0x33, 0x00, 0x07, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x05, 0x00, 
-    0x55, 0xB3, 0x35, 0x00, 0x09, 0x33, 0x03, 0x33, 0x39, 0x00, 0x00, 0xE3, 0x30, 0x00, 0x5B, 0x00, 
-    0x22, 0x22, 0x2C, 0x00, 0xE3, 0x11, 0x1F, 0x39, 0x0C, 0x72, 0x22, 0x28, 0x87, 0x22, 0x20, 0x05, 
-    0xB0, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x88, 0x88, 0x88, 0x22, 0x00, 0x05, 
-    0x63, 0x3D, 0x33, 0x36, 0xD3, 0xB5, 0x00, 0x07, 0x22, 0x22, 0x22, 0x22, 0x55, 0x50, 0x50, 0x00, 
-    0x05, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE0, 0x00, 0x99, 0x00, 0x05, 0x00, 
-    0x22, 0x22, 0x22, 0x27, 0xC0, 0x31, 0x11, 0x10, 0x39, 0xC0, 0x02, 0x00, 0x00, 0x02, 0x22, 0x20, 
-    0x00, 0x22, 0x82, 0x22, 0x22, 0x82, 0x22, 0x22, 0x22, 0x22, 0x28, 0x02, 0x22, 0x77, 0xCC, 0x20, 
-    0x33, 0x31, 0x13, 0x00, 0xB3, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x20, 0x05, 0x5B, 0x35, 0x00, 
-    0x50, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x22, 0x22, 0x22, 0x7C, 0x0E, 0xF1, 0x11, 0x10, 0x0E, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x20, 
-    0x00, 0x22, 0x22, 0x22, 0x28, 0xA8, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x0C, 0xCC, 0xC7, 0x70, 
-    0x33, 0x00, 0x0F, 0xFE, 0x20, 0xB5, 0x00, 0x82, 0x22, 0x22, 0x22, 0x00, 0x05, 0x33, 0x33, 0x50, 
-    0x53, 0x33, 0x33, 0xFF, 0x33, 0x33, 0xFF, 0xFF, 0xFF, 0x3F, 0x33, 0x33, 0x90, 0x00, 0x00, 0x00, 
-    0x45, 0x82, 0x22, 0x22, 0x27, 0x0C, 0x0E, 0xF1, 0x11, 0x30, 0x01, 0x30, 0x53, 0x00, 0x0C, 0x22, 
-    0x0C, 0x22, 0x22, 0x22, 0x80, 0x00, 0x82, 0x22, 0x22, 0x22, 0x22, 0x27, 0xCC, 0x77, 0x77, 0x77, 
-    0x33, 0xFF, 0x3F, 0xFF, 0x92, 0x20, 0x00, 0x22, 0x22, 0x22, 0x20, 0x05, 0x5B, 0x33, 0x35, 0x05, 
-    0x33, 0x33, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x0F, 0x33, 0x33, 0x00, 0x09, 0x90, 
-    0xA4, 0x50, 0x22, 0x22, 0x22, 0x20, 0xCC, 0x9E, 0xF1, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x22, 
-    0x22, 0x22, 0x22, 0x28, 0xA0, 0x80, 0x82, 0x22, 0x22, 0x22, 0x22, 0x77, 0x77, 0x77, 0x77, 0x77, 
-    0x93, 0xF3, 0x3F, 0xFE, 0xEE, 0x22, 0x80, 0x22, 0x22, 0x22, 0xB0, 0x55, 0x5B, 0x33, 0x50, 0x33, 
-    0x33, 0xF1, 0x11, 0x11, 0x11, 0x1F, 0xFF, 0x00, 0x11, 0x11, 0x11, 0x1F, 0x33, 0x30, 0x00, 0x99, 
-    0xAA, 0x04, 0xA8, 0x22, 0x22, 0x22, 0x77, 0x7C, 0x9E, 0x30, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x22, 
-    0x22, 0x22, 0x22, 0x00, 0x08, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x27, 0x77, 0x77, 0x77, 0x77, 
-    0x9E, 0x3E, 0x3F, 0xEE, 0xE9, 0xC2, 0x22, 0x22, 0x22, 0x25, 0x30, 0x00, 0x00, 0x3B, 0x53, 0x33, 
-    0x3F, 0x01, 0x11, 0x11, 0x11, 0x10, 0x3F, 0x30, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x00, 0x00, 
-    0x55, 0xA0, 0x45, 0x82, 0x22, 0x22, 0x22, 0x77, 0xCC, 0x0C, 0x99, 0x90, 0x00, 0x0C, 0x00, 0x22, 
-    0x22, 0x22, 0x06, 0xD0, 0x08, 0x88, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 0x72, 0x27, 0x77, 0x27, 
-    0x0E, 0x99, 0x3E, 0x9E, 0x9C, 0xC7, 0x22, 0x22, 0x22, 0x03, 0x05, 0x00, 0x55, 0x5B, 0x33, 0x33, 
-    0xF0, 0x01, 0x11, 0x11, 0x11, 0x10, 0x3F, 0x3F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x39, 0x00, 
-    0x05, 0xAA, 0x04, 0x58, 0x22, 0x22, 0x22, 0x22, 0xCC, 0x7C, 0xC0, 0xC7, 0x02, 0x02, 0xC7, 0x22, 
-    0x22, 0x20, 0x11, 0x40, 0x08, 0x88, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 0x27, 0x27, 0x72, 0x22, 
-    0x09, 0x99, 0xE9, 0x99, 0xCC, 0x72, 0x22, 0x22, 0x22, 0x33, 0xB0, 0x00, 0x55, 0x5B, 0x33, 0x33, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x33, 0x33, 0xF1, 0x11, 0x11, 0x11, 0x11, 0x13, 0x33, 0x00, 
-    0x00, 0xAA, 0x04, 0x44, 0x08, 0x22, 0x22, 0x22, 0x22, 0x77, 0x7C, 0x77, 0x72, 0x07, 0x72, 0x22, 
-    0x88, 0x01, 0x16, 0x40, 0x08, 0x88, 0x82, 0x28, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0x22, 
-    0x09, 0x09, 0x99, 0x9C, 0x77, 0x72, 0x22, 0x22, 0x20, 0x30, 0x00, 0x00, 0x00, 0x5B, 0x3E, 0x3F, 
-    0xF0, 0x01, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x00, 0x3E, 0x30, 
-    0x00, 0x05, 0x5A, 0x04, 0x4A, 0x82, 0x22, 0x22, 0x22, 0x27, 0x77, 0x77, 0x22, 0x20, 0x22, 0x80, 
-    0x3D, 0x11, 0x1D, 0x00, 0x08, 0x88, 0x88, 0x28, 0x82, 0x22, 0x22, 0x22, 0x22, 0x72, 0x72, 0x27, 
-    0x00, 0x09, 0x99, 0xC7, 0x77, 0x22, 0x22, 0x22, 0x2B, 0x00, 0x00, 0x00, 0x55, 0xB3, 0x3E, 0xFF, 
-    0xFF, 0x01, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0xF3, 0x90, 
-    0x00, 0x8A, 0x55, 0xAA, 0x44, 0xA8, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0x22, 0x28, 0x28, 0x0D, 
-    0x11, 0x11, 0x64, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x27, 0x77, 0x27, 
-    0xC0, 0x09, 0xE0, 0xC7, 0x77, 0x22, 0x22, 0x22, 0x0B, 0x00, 0x0E, 0x30, 0xBB, 0x33, 0x93, 0xFF, 
-    0xF0, 0x01, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x00, 0xFF, 0x93, 
-    0x00, 0x00, 0x5A, 0xAA, 0x04, 0x44, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x85, 0x66, 
-    0x66, 0x61, 0xD4, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x27, 0x7C, 0x72, 
-    0xC0, 0x9E, 0xE0, 0x77, 0x72, 0x22, 0x22, 0x22, 0x05, 0x00, 0x03, 0x33, 0xB3, 0x39, 0xE3, 0x33, 
-    0xF0, 0x00, 0x01, 0x11, 0x11, 0x13, 0x63, 0x33, 0x31, 0x11, 0x11, 0x11, 0x00, 0xF0, 0xFF, 0x30, 
-    0x00, 0x00, 0x0A, 0xA5, 0xA4, 0x44, 0x45, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x84, 0x66, 
-    0x66, 0x66, 0x40, 0x00, 0x88, 0x88, 0x88, 0x22, 0x88, 0x22, 0x22, 0x22, 0x22, 0x27, 0x7C, 0xC2, 
-    0x00, 0xEF, 0xE9, 0xC7, 0x72, 0x22, 0x22, 0x22, 0x50, 0x00, 0xE3, 0x33, 0x33, 0x99, 0xE3, 0x33, 
-    0xF0, 0x00, 0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0xF1, 0x11, 0x31, 0x10, 0xFF, 0xFF, 0x33, 0x3E, 
-    0x00, 0x00, 0x55, 0x5A, 0xAA, 0x04, 0x44, 0x50, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0xA6, 0x06, 
-    0x66, 0x66, 0x40, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x27, 0xCC, 0x07, 
-    0x00, 0xF3, 0xE9, 0xC7, 0x77, 0x02, 0x22, 0x20, 0x00, 0x00, 0xEE, 0xB3, 0x39, 0x9E, 0xEE, 0x3F, 
-    0xFF, 0x01, 0x11, 0x16, 0x11, 0x13, 0xB3, 0x33, 0x31, 0x16, 0x63, 0x11, 0xF3, 0x33, 0x33, 0x3E, 
-    0x00, 0x00, 0x55, 0x55, 0xAA, 0x54, 0x00, 0x44, 0x08, 0x22, 0x22, 0x28, 0x88, 0x88, 0x46, 0x00, 
-    0x66, 0x64, 0x00, 0xA8, 0x80, 0x88, 0x88, 0x88, 0x88, 0x22, 0x22, 0x22, 0x22, 0x27, 0x7C, 0x0C, 
-    0x0E, 0xF3, 0x39, 0xCC, 0xCC, 0x72, 0x22, 0x20, 0x00, 0x00, 0x90, 0xB3, 0x30, 0x9E, 0xE3, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x61, 0x16, 0xDD, 0x33, 0x3D, 0x66, 0x63, 0x33, 0x33, 0x33, 0x33, 0x3E, 
-    0x00, 0x05, 0x55, 0x00, 0x05, 0x5A, 0x00, 0x04, 0x58, 0x82, 0x22, 0x88, 0x88, 0x85, 0xD6, 0x00, 
-    0x66, 0x04, 0x0A, 0x08, 0x80, 0x88, 0x88, 0x88, 0x08, 0x82, 0x22, 0x22, 0x22, 0x27, 0x7C, 0x0C, 
-    0x03, 0x3F, 0x30, 0x0C, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x99, 0x33, 0xB5, 
-    0xB3, 0x33, 0x33, 0xBB, 0xD6, 0x66, 0x6D, 0xD6, 0x66, 0x66, 0x4B, 0x33, 0x33, 0x33, 0x00, 0x00, 
-    0x00, 0x55, 0x55, 0x50, 0x05, 0x5A, 0x00, 0x00, 0x08, 0x82, 0x20, 0xA5, 0x55, 0xB6, 0x60, 0x06, 
-    0x60, 0x40, 0x0A, 0x08, 0x80, 0x88, 0x88, 0x88, 0x08, 0x82, 0x22, 0x22, 0x22, 0x22, 0x2C, 0xCC, 
-    0x93, 0xFF, 0x9C, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x53, 0x33, 0x33, 0xBB, 0x33, 0x33, 0x3B, 0xDD, 0x33, 0x33, 0xB3, 0x33, 0x13, 0x03, 0x00, 0x00, 
-    0x00, 0x55, 0x55, 0x55, 0x55, 0xA0, 0x00, 0x00, 0x00, 0x88, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 
-    0x04, 0x40, 0x0A, 0x88, 0x08, 0x88, 0x88, 0x88, 0x88, 0x87, 0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 
-    0x03, 0x3C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xB3, 0x33, 0x33, 0xB3, 0x33, 0x33, 0x3B, 0xD3, 0x33, 0x33, 0x03, 0x33, 0x31, 0x30, 0x90, 0x00, 
-    0x00, 0x00, 0x05, 0x55, 0x5A, 0xAA, 0xAA, 0xAA, 0x58, 0x85, 0xB4, 0x44, 0x44, 0x40, 0x00, 0x04, 
-    0x44, 0x40, 0x00, 0x88, 0x08, 0x88, 0x88, 0x88, 0x88, 0x87, 0x22, 0x22, 0x22, 0x27, 0x22, 0x22, 
-    0x00, 0x22, 0x09, 0x90, 0x77, 0x22, 0x22, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x35, 0x33, 0x33, 0xB3, 0x00, 0x11, 0x35, 0xD3, 0xF0, 0x0F, 0x30, 0x33, 0x33, 0x10, 0x09, 0x00, 
-    0x00, 0x00, 0x05, 0x55, 0x55, 0xAA, 0xA5, 0x5A, 0xAA, 0x55, 0x44, 0x44, 0x44, 0x44, 0x00, 0x04, 
-    0x44, 0x00, 0xA0, 0x88, 0x88, 0x88, 0x88, 0x08, 0x88, 0x82, 0x22, 0x22, 0x22, 0x27, 0x02, 0x22, 
-    0x22, 0x7E, 0xF3, 0x9C, 0x72, 0x22, 0x22, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-    0x35, 0x33, 0x33, 0x33, 0x33, 0xF0, 0x35, 0xD3, 0x30, 0x03, 0x3E, 0x33, 0x33, 0x33, 0x09, 0x00, 
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x05, 0x5A, 0x55, 0xAA, 0x5A, 0x55, 0x54, 0x44, 0x44, 0x44, 
-    0x40, 0x0A, 0x00, 0x88, 0x88, 0x82, 0x8A, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 0x2C, 0x0C, 0x22, 
-    0x00, 0x3F, 0x3E, 0x0C, 0x72, 0x22, 0x22, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x33, 0x30, 0x03, 0x33, 0x33, 0x35, 0xD3, 0x3F, 0xF3, 0xE3, 0x33, 0x33, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x55, 0xAA, 0xA5, 0x5A, 0xA5, 0x04, 0x44, 0x44, 0x44, 
-    0x40, 0xA0, 0x08, 0x88, 0x88, 0x28, 0x8A, 0x88, 0x80, 0x72, 0x22, 0x22, 0x22, 0x7C, 0xC0, 0xC2, 
-    0x03, 0x1F, 0xE9, 0x07, 0x72, 0x22, 0x22, 0x87, 0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x33, 0x55, 0x30, 0x03, 0xE3, 0x33, 0x35, 0xD3, 0x33, 0x33, 0x93, 0x30, 0x33, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0xBD, 0xB5, 0x55, 0x5A, 0xAA, 0x50, 0x44, 0x44, 0x44, 
-    0x40, 0x00, 0x08, 0x88, 0x88, 0x28, 0xA0, 0x88, 0x87, 0x77, 0x22, 0x22, 0x22, 0x20, 0x0C, 0xCC, 
-    0x90, 0x03, 0x90, 0x0C, 0x22, 0x22, 0x22, 0x07, 0x28, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30, 
-    0x33, 0x05, 0x30, 0x00, 0x03, 0x5B, 0xB5, 0xD3, 0x05, 0x33, 0x39, 0x00, 0x33, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xBB, 0x55, 0xB4, 0xBB, 0xDD, 0xDD, 0x6D, 0x55, 0x5A, 0xA5, 0x55, 0x44, 0x44, 0x00, 
-    0x00, 0xA0, 0x88, 0x88, 0x82, 0x80, 0xAA, 0x88, 0x00, 0x72, 0x22, 0x22, 0x22, 0x27, 0x0C, 0xCC, 
-    0xE1, 0x03, 0x90, 0x0C, 0x22, 0x22, 0x22, 0x07, 0x02, 0x88, 0x88, 0x87, 0x00, 0x00, 0x00, 0x30, 
-    0x03, 0x00, 0x50, 0x00, 0x00, 0x55, 0x50, 0x33, 0x05, 0x30, 0x99, 0x00, 0x30, 0x03, 0x00, 0x00, 
+const uint8_t STORY_CH6_ENEMY_RLE[STORY_CH6_ENEMY_RLE_SIZE] = {
+    0xF7, 0x0A, 0x08, 0x22, 0x03, 0x08, 0x08, 0x80, 0xB0, 0x00, 0xA0, 0xF5, 0x00, 0x05, 0xA5, 0xA0, 
+    0x00, 0xB4, 0x03, 0x06, 0x66, 0xF1, 0x03, 0x01, 0x60, 0xB4, 0x00, 0x00, 0xDA, 0x00, 0x50, 0xEA, 
+    0x01, 0x00, 0xD8, 0xC2, 0x02, 0x05, 0x80, 0xA2, 0x02, 0x77, 0x70, 0xF2, 0x00, 0xF7, 0x0A, 0x04, 
+    0x08, 0x80, 0x50, 0xC0, 0xAA, 0xE5, 0x02, 0xAA, 0x50, 0xA0, 0xA4, 0x01, 0x66, 0xF1, 0x00, 0x01, 
+    0x66, 0xC1, 0x01, 0x66, 0xA4, 0x00, 0x00, 0xAA, 0x01, 0x00, 0xFA, 0x01, 0x45, 0xC2, 0x03, 0x05, 
+    0x02, 0xE7, 0x55, 0x0D, 0x00, 0x08, 0x00, 0x88, 0x00, 0x08, 0xAA, 0x42, 0xF5, 0x03, 0x01, 0x00, 
+    0xA4, 0x01, 0x06, 0xB1, 0x00, 0x60, 0xD1, 0xB6, 0x03, 0x11, 0x16, 0xC4, 0x44, 0x02, 0x50, 0x00, 
+    0xCA, 0x01, 0x00, 0xB8, 0xA2, 0x02, 0x80, 0x00, 0xF7, 0x03, 0x4E, 0x11, 0xCC, 0x77, 0x00, 0x08, 
+    0x88, 0x08, 0x88, 0x05, 0x00, 0xCA, 0xF5, 0x01, 0x00, 0x00, 0x43, 0x02, 0x61, 0x10, 0xA6, 0xB1, 
+    0x00, 0x60, 0x46, 0x05, 0x66, 0x61, 0x10, 0xB4, 0x00, 0x00, 0x42, 0x03, 0xA0, 0x55, 0xAA, 0x02, 
+    0x55, 0x50, 0xA8, 0xA2, 0x03, 0x00, 0x77, 0xEC, 0x04, 0x7C, 0x77, 0x70, 0x4B, 0xAC, 0x05, 0x77, 
+    0x08, 0x80, 0x43, 0x04, 0x00, 0x05, 0x50, 0xDA, 0xE5, 0x0B, 0xA0, 0x44, 0x40, 0x61, 0x16, 0x66, 
+    0xD1, 0x04, 0xD6, 0x11, 0x10, 0xE6, 0x02, 0x16, 0x00, 0xC4, 0x42, 0x01, 0x55, 0xFA, 0x01, 0x07, 
+    0x08, 0x22, 0x80, 0x08, 0x48, 0x00, 0xC0, 0xA7, 0x45, 0x00, 0xC0, 0x47, 0x01, 0xC0, 0x42, 0xD0, 
+    0x03, 0x80, 0x45, 0x49, 0x02, 0x00, 0x00, 0xA4, 0x05, 0x06, 0x11, 0x66, 0xF1, 0x00, 0x01, 0x43, 
+    0xC1, 0xC6, 0x02, 0x11, 0x60, 0xC4, 0x05, 0x00, 0xA5, 0x55, 0xEA, 0x00, 0x50, 0xA8, 0x06, 0x00, 
+    0x27, 0x7C, 0x00, 0x51, 0x00, 0x70, 0xDC, 0x02, 0x0C, 0x00, 0x4A, 0x05, 0x00, 0x54, 0x55, 0x43, 
+    0xA0, 0xC4, 0x04, 0x06, 0x11, 0x60, 0xF1, 0x01, 0x03, 0xDB, 0x36, 0xC1, 0xC6, 0x02, 0x11, 0x60, 
+    0xD4, 0x00, 0x00, 0x49, 0x06, 0xA8, 0x88, 0x00, 0x80, 0x43, 0xB0, 0x00, 0xC0, 0xD7, 0x45, 0x00, 
+    0x70, 0xBC, 0xB0, 0x00, 0x80, 0x42, 0xAA, 0xB0, 0x0A, 0xA4, 0x5A, 0x5A, 0x00, 0x44, 0x00, 0xC4, 
+    0x04, 0x06, 0x11, 0x60, 0xF1, 0x02, 0x03, 0xD5, 0x3D, 0x4A, 0x06, 0x61, 0x60, 0x40, 0x00, 0x45, 
+    0x00, 0x50, 0xEA, 0x06, 0x08, 0x05, 0x08, 0x20, 0xF0, 0x00, 0x46, 0x01, 0x77, 0x44, 0x02, 0x7C, 
+    0xC0, 0xE0, 0x42, 0x00, 0x50, 0xAA, 0x43, 0xA5, 0x01, 0x00, 0xF4, 0x01, 0x03, 0x61, 0x16, 0xF1, 
+    0x03, 0x03, 0x50, 0x33, 0xD1, 0xD6, 0x02, 0x16, 0x00, 0x47, 0x0C, 0x0A, 0xA0, 0xAA, 0xA5, 0xAA, 
+    0x55, 0x50, 0xF0, 0x00, 0x02, 0x50, 0x00, 0xF7, 0x02, 0x44, 0x00, 0x70, 0xC0, 0x01, 0x88, 0xB0, 
+    0x01, 0x55, 0xBA, 0xB5, 0x02, 0x40, 0x50, 0xF4, 0x01, 0x03, 0x61, 0x16, 0xF1, 0x03, 0x05, 0xD0, 
+    0x03, 0x36, 0xD1, 0xD6, 0x04, 0x16, 0x06, 0x00, 0xA4, 0x0A, 0x50, 0x0A, 0x04, 0x05, 0x5A, 0x50, 
+    0xBA, 0x03, 0x5A, 0x55, 0xC0, 0xF7, 0x02, 0x08, 0x22, 0xCC, 0x77, 0x7C, 0xC0, 0xC0, 0x42, 0xA5, 
+    0xCA, 0x04, 0x55, 0x5A, 0xA0, 0xF4, 0x02, 0x03, 0x06, 0x16, 0x4B, 0x05, 0x50, 0x0E, 0x93, 0xE1, 
+    0xD6, 0x03, 0x16, 0x66, 0x45, 0x05, 0x00, 0x04, 0x0A, 0x44, 0x08, 0x55, 0x5B, 0xB5, 0x50, 0x80, 
+    0x42, 0x00, 0xC0, 0xF7, 0x03, 0x03, 0x00, 0xCC, 0xE0, 0x05, 0xAA, 0xA5, 0x5A, 0x48, 0x01, 0x55, 
+    0x4A, 0x02, 0x11, 0x60, 0xF1, 0x03, 0x07, 0xB0, 0x80, 0x90, 0x53, 0xF1, 0x01, 0x44, 0x02, 0x06, 
+    0x00, 0xA4, 0x05, 0x00, 0x04, 0x44, 0xA0, 0x0C, 0xAA, 0xA0, 0x45, 0xA4, 0x45, 0x50, 0x00, 0xF7, 
+    0x09, 0xF0, 0x02, 0x03, 0x55, 0x00, 0xA5, 0xAA, 0x02, 0x0A, 0xB0, 0xC4, 0x00, 0x00, 0xC4, 0x03, 
+    0x06, 0x16, 0x49, 0x05, 0x65, 0x00, 0x20, 0xB3, 0x00, 0xD0, 0xF1, 0x00, 0xA6, 0x03, 0x10, 0x06, 
+    0x44, 0x05, 0x44, 0x40, 0x44, 0xA0, 0x0E, 0x44, 0x5A, 0xAB, 0xB5, 0x58, 0x87, 0x00, 0x00, 0xF7, 
+    0x06, 0x4B, 0xD5, 0x03, 0xA0, 0x00, 0xF4, 0x04, 0x00, 0x00, 0xA6, 0xF1, 0x01, 0x05, 0x65, 0x00, 
+    0xC7, 0x42, 0x03, 0xF3, 0x33, 0xF1, 0x01, 0x05, 0x66, 0x16, 0x40, 0xB4, 0x0E, 0x04, 0x00, 0x04, 
+    0x44, 0x04, 0x40, 0xAA, 0xA0, 0xA5, 0x09, 0x00, 0x88, 0x00, 0x0C, 0xCC, 0xF7, 0x02, 0x01, 0xCC, 
+    0x49, 0x01, 0xBA, 0xC5, 0x02, 0x00, 0x00, 0xC4, 0x00, 0xD0, 0xC4, 0x00, 0x00, 0x4D, 0x0E, 0x50, 
+    0x00, 0xCC, 0x00, 0x01, 0x10, 0x33, 0xD0, 0x4B, 0x02, 0x00, 0x00, 0x45, 0xE4, 0x02, 0x5A, 0xA0, 
+    0xB5, 0x00, 0x00, 0xB8, 0x01, 0x00, 0xAC, 0x03, 0x77, 0xCC, 0x49, 0x02, 0x55, 0x50, 0x42, 0x02, 
+    0xD5, 0xA0, 0x4B, 0x00, 0x60, 0x46, 0x03, 0x66, 0x16, 0xF1, 0x01, 0x07, 0x30, 0x00, 0x90, 0xC9, 
+    0xB1, 0x02, 0x03, 0x30, 0x4A, 0x04, 0x16, 0x00, 0x00, 0x42, 0x00, 0x00, 0x47, 0x00, 0x40, 0xE5, 
+    0x02, 0x88, 0x80, 0xA0, 0x43, 0x00, 0xC0, 0x46, 0xC0, 0xA5, 0x00, 0x30, 0xE5, 0x02, 0xB4, 0x00, 
+    0xC4, 0x04, 0x66, 0x44, 0x40, 0xA0, 0xA6, 0xF1, 0x01, 0x00, 0x50, 0x42, 0x01, 0x90, 0x46, 0x01, 
+    0x56, 0xD1, 0xA6, 0x05, 0x16, 0x06, 0x60, 0xF4, 0x07, 0xC5, 0xD0, 0xFC, 0x01, 0xA7, 0x00, 0xC0, 
+    0xC0, 0xF5, 0x03, 0x00, 0xB0, 0xE4, 0x01, 0x66, 0xD0, 0x4B, 0x08, 0xD5, 0x00, 0x9E, 0xE0, 0x00, 
+    0x45, 0x01, 0x3D, 0x5E, 0x05, 0xB5, 0xAA, 0x55, 0xF0, 0x00, 0xAC, 0x08, 0x09, 0x93, 0xF7, 0x7C, 
+    0xC0, 0x45, 0x00, 0x00, 0xF5, 0x01, 0xF4, 0x01, 0x07, 0x60, 0x04, 0x06, 0x00, 0xA6, 0xF1, 0x01, 
+    0x42, 0x02, 0x09, 0x90, 0x45, 0x03, 0xF3, 0x33, 0x4B, 0xA6, 0xF4, 0x00, 0x00, 0xD0, 0xB4, 0x01, 
+    0x5A, 0xB5, 0xE0, 0x04, 0x99, 0xE3, 0x00, 0xA1, 0xA7, 0x4D, 0x02, 0x04, 0x00, 0xF4, 0x00, 0x03, 
+    0x66, 0x04, 0x42, 0x02, 0x66, 0x60, 0xF1, 0x02, 0x08, 0x6B, 0xA5, 0x00, 0xCC, 0xC0, 0x43, 0x05, 
+    0x03, 0x35, 0x56, 0xE1, 0x46, 0x00, 0x60, 0xE4, 0x00, 0x60, 0xB4, 0x03, 0xA5, 0x5A, 0xA5, 0xA0, 
+    0x03, 0x33, 0xF0, 0xE1, 0xA7, 0xB0, 0x01, 0x55, 0x46, 0x00, 0x50, 0xF4, 0x02, 0x01, 0x66, 0xC0, 
+    0x4D, 0x02, 0x5A, 0x00, 0x42, 0x0A, 0x70, 0xF1, 0x1F, 0x33, 0x05, 0xB0, 0x47, 0x0B, 0x16, 0x11, 
+    0x66, 0x16, 0x66, 0x06, 0x48, 0x03, 0x00, 0x0A, 0xA5, 0x05, 0x03, 0x33, 0xF0, 0xF1, 0x02, 0xF0, 
+    0x01, 0x0A, 0x99, 0x95, 0x55, 0xB3, 0xDB, 0xA0, 0x4E, 0xB6, 0x4D, 0x0E, 0x77, 0x7C, 0x7C, 0x3F, 
+    0x03, 0x33, 0x00, 0x50, 0x4B, 0x01, 0x11, 0x44, 0x00, 0x00, 0xB4, 0x08, 0x66, 0x64, 0x40, 0x55, 
+    0x50, 0xA3, 0x02, 0xFF, 0xF0, 0xB0, 0xD1, 0x00, 0xF0, 0x4B, 0x01, 0x95, 0xA3, 0x00, 0xD0, 0xF4, 
+    0x02, 0x43, 0xC6, 0x4A, 0x01, 0xB0, 0x42, 0x02, 0x77, 0x70, 0xB3, 0x03, 0x90, 0x0B, 0xF1, 0x09, 
+    0x02, 0x66, 0x60, 0xB0, 0x06, 0x46, 0x6D, 0xD3, 0xB0, 0xD3, 0xCF, 0xB0, 0x03, 0xFF, 0xE9, 0xA0, 
+    0x00, 0x50, 0x47, 0x00, 0xE0, 0xC3, 0x01, 0xDD, 0x49, 0xC6, 0x00, 0x10, 0x4C, 0x03, 0x40, 0x00, 
+    0xA7, 0x00, 0x00, 0xA3, 0x02, 0x99, 0x90, 0x55, 0xB6, 0x03, 0xD3, 0x33, 0xCE, 0x04, 0x33, 0xFF, 
+    0xF0, 0xA3, 0x0A, 0xFF, 0xF3, 0xE9, 0x90, 0xCC, 0x70, 0x42, 0x00, 0x50, 0xC0, 0x09, 0x9E, 0xE3, 
+    0x3D, 0xBB, 0x33, 0xD4, 0x00, 0x00, 0x47, 0x00, 0x10, 0x4F, 0x00, 0x80, 0xB2, 0x09, 0x03, 0xE9, 
+    0x3E, 0x90, 0x03, 0x55, 0x06, 0x33, 0x3E, 0x99, 0x90, 0xFE, 0x03, 0xA3, 0x04, 0x99, 0x0C, 0xC0, 
+    0xB7, 0xC5, 0xD0, 0x06, 0x9E, 0x3D, 0xDB, 0xD0, 0xD4, 0x00, 0x00, 0xF6, 0x01, 0x4E, 0x00, 0xB0, 
+    0x45, 0x06, 0x79, 0xE3, 0x00, 0xC0, 0x55, 0x01, 0x33, 0xF9, 0x08, 0x03, 0xE3, 0x33, 0xB0, 0xB7, 
+    0x02, 0xCC, 0xC0, 0xB5, 0xB0, 0xA5, 0x02, 0x03, 0x10, 0xAD, 0xB4, 0xE6, 0x00, 0x10, 0xA6, 0xE1, 
+    0x00, 0x60, 0x45, 0x02, 0x88, 0x00, 0x44, 0x02, 0x00, 0xC0, 0xA0, 0x44, 0x02, 0xDD, 0x60, 0xF1, 
+    0x00, 0x04, 0x33, 0xE9, 0x90, 0xAE, 0xF9, 0x01, 0x06, 0x3B, 0xB3, 0xBB, 0x50, 0x4C, 0x01, 0xB4, 
+    0x43, 0x02, 0x99, 0x00, 0x42, 0x0A, 0x03, 0x66, 0xDD, 0xD4, 0x44, 0xD0, 0xF6, 0x01, 0xF1, 0x01, 
+    0x03, 0x6D, 0x66, 0xA1, 0x02, 0x40, 0x80, 0xB2, 0x05, 0x70, 0xC0, 0x99, 0x45, 0x05, 0x6D, 0x55, 
+    0x56, 0xB1, 0xB3, 0xAE, 0xF9, 0x00, 0x09, 0xE3, 0x33, 0xBB, 0x44, 0x45, 0x44, 0x00, 0x00, 0xA7, 
+    0x0A, 0x00, 0xCB, 0x44, 0x4B, 0x00, 0x50, 0xB3, 0x06, 0x09, 0x55, 0xD6, 0x60, 0x43, 0x00, 0x40, 
+    0x52, 0x04, 0xB5, 0xDD, 0x60, 0x42, 0x00, 0x50, 0x44, 0x04, 0x20, 0x09, 0xE0, 0x42, 0x0C, 0x61, 
+    0x16, 0x45, 0x50, 0x0D, 0x11, 0x00, 0xD3, 0x10, 0xE9, 0x99, 0x00, 0x09, 0x09, 0x33, 0xD6, 0x66, 
+    0xD0, 0xB4, 0x00, 0x50, 0xE0, 0x0E, 0x77, 0xC0, 0x90, 0xBB, 0xB4, 0x45, 0x55, 0xB0, 0xC3, 0x03, 
+    0x05, 0xBD, 0xA6, 0x05, 0x44, 0xD6, 0x61, 0xC6, 0xF1, 0x01, 0x0A, 0x65, 0x0D, 0xDD, 0x11, 0x1D, 
+    0xA0, 0x47, 0x01, 0xE3, 0x42, 0x0C, 0x11, 0x1D, 0x50, 0x08, 0x0D, 0xD0, 0xF0, 0xB3, 0xB9, 0x05, 
+    0x00, 0x93, 0x3D, 0xB6, 0x07, 0xDD, 0x44, 0x40, 0x45, 0x48, 0x09, 0x00, 0x09, 0x9D, 0x3B, 0xB4, 
+    0xAB, 0x45, 0x02, 0xB4, 0x40, 0xC6, 0x00, 0xD0, 0xE6, 0xF1, 0x01, 0x07, 0x6B, 0x08, 0xBB, 0xB6, 
+    0x4D, 0xA0, 0x08, 0x11, 0x65, 0x00, 0x82, 0x50, 0xD3, 0x08, 0x99, 0x90, 0x00, 0x33, 0x30, 0xE6, 
+    0x00, 0xD0, 0xC4, 0xB5, 0xF0, 0x00, 0x08, 0x90, 0x03, 0x33, 0xB4, 0x30, 0xAB, 0xB3, 0x05, 0xBB, 
+    0xB4, 0x4D, 0xF6, 0x04, 0xF1, 0x01, 0x0A, 0xD5, 0x08, 0x5B, 0x5D, 0x11, 0x40, 0x47, 0x02, 0x9E, 
+    0xE0, 0x44, 0x08, 0xB0, 0x02, 0x22, 0xBB, 0xB0, 0xA3, 0x01, 0x00, 0xA3, 0x03, 0x61, 0x11, 0xD6, 
+    0xD4, 0xD5, 0x0E, 0x00, 0x0C, 0x00, 0x05, 0x50, 0x06, 0xD3, 0x30, 0xAB, 0x04, 0x5B, 0xBB, 0x50, 
+    0xBB, 0x02, 0x44, 0x40, 0xF6, 0x03, 0xF1, 0x00, 0x0D, 0x63, 0x50, 0x08, 0x0B, 0x05, 0x66, 0x58, 
+    0x48, 0x0F, 0x90, 0x0C, 0x0D, 0xD0, 0x02, 0x22, 0x03, 0x00, 0xC3, 0x00, 0x60, 0xE1, 0xB6, 0xE4, 
+    0x00, 0xB0, 0xB5, 0xB0, 0xB5, 0x11, 0x00, 0xD1, 0x63, 0xB5, 0xBB, 0xAB, 0x4B, 0x55, 0xBB, 0xB4, 
+    0x00, 0xD0, 0xF6, 0x01, 0xE1, 0x02, 0x66, 0x30, 0xC0, 0x05, 0x38, 0x84, 0x4A, 0x48, 0x01, 0x3E, 
+    0xB0, 0x0D, 0x50, 0x82, 0x22, 0x53, 0x00, 0x03, 0x36, 0xF1, 0x02, 0xB6, 0x00, 0x00, 0xE4, 0x01, 
+    0xBB, 0x44, 0x12, 0x55, 0xBB, 0x55, 0x00, 0x0D, 0x66, 0x63, 0x55, 0x50, 0x50, 0x42, 0x00, 0x50, 
+    0xB4, 0x03, 0xDD, 0x4D, 0xD6, 0xC1, 0x04, 0x6D, 0xD5, 0x50, 0xD0, 0x06, 0x30, 0x8A, 0xA0, 0x80, 
+    0xD2, 0xA3, 0x00, 0x90, 0xC0, 0x42, 0x09, 0x33, 0xE9, 0x00, 0x55, 0xBD, 0x4C, 0x01, 0x66, 0x49, 
+    0xAB, 0x03, 0xDD, 0x55, 0xB0, 0x0E, 0x3D, 0x61, 0xD3, 0xBB, 0x55, 0xDB, 0x00, 0x00, 0x44, 0xD6, 
+    0xB1, 0xA6, 0x01, 0xB5, 0xB0, 0x00, 0xC0, 0x43, 0x00, 0x50, 0xB8, 0xC2, 0x03, 0x7F, 0x11, 0x45, 
+    0x0A, 0x80, 0x82, 0x0D, 0x3F, 0xE9, 0x90, 0xA0, 0x02, 0x5D, 0x60, 0xD1, 0x48, 0x0C, 0xBB, 0x44, 
+    0xB5, 0xBB, 0x55, 0x53, 0xB0, 0xD0, 0x0D, 0x53, 0xD6, 0xDD, 0x3B, 0xB5, 0xD4, 0x00, 0xD4, 0xA6, 
+    0x0B, 0x11, 0x66, 0x1F, 0x33, 0xD6, 0xD5, 0xF0, 0x00, 0x04, 0x99, 0x03, 0x50, 0xF2, 0x02, 0x01, 
+    0x73, 0x47, 0x09, 0x08, 0x22, 0x06, 0x1F, 0x33, 0xA9, 0x04, 0x00, 0x05, 0x30, 0x4E, 0xA4, 0xE5, 
+    0xF0, 0x00, 0xB3, 0x02, 0xBB, 0x40, 0x42, 0x0B, 0x44, 0x5B, 0x64, 0x66, 0x61, 0x1D, 0xD3, 0x07, 
+    0xDD, 0xB0, 0x77, 0xC0, 0xD9, 0x03, 0xE9, 0x33, 0xF2, 0x02, 0x08, 0x03, 0x16, 0x30, 0x00, 0x70, 
+    0x44, 0x05, 0xB6, 0x0F, 0x3F, 0xAE, 0x00, 0x90, 0xA0, 0x01, 0x5D, 0xB1, 0xB6, 0x00, 0x00, 0xC4, 
+    0x00, 0xB0, 0x4A, 0x05, 0x50, 0x00, 0x55, 0xA3, 0x0D, 0x5B, 0x45, 0xBD, 0x44, 0x4B, 0x0B, 0x6D, 
+    0xB3, 0x00, 0xE0, 0xB3, 0x12, 0xDB, 0x02, 0x7C, 0xC0, 0x99, 0xEE, 0xE3, 0x3E, 0x90, 0xB0, 0x4A, 
+    0x07, 0x20, 0x00, 0x72, 0x27, 0xA0, 0x14, 0x82, 0x23, 0x1F, 0x3F, 0x0F, 0x00, 0xF3, 0xEE, 0x90, 
+    0x00, 0xD0, 0x47, 0xD4, 0x43, 0x02, 0xBB, 0xB0, 0xA0, 0x02, 0x55, 0x50, 0x42, 0x08, 0x5B, 0x33, 
+    0xBB, 0x45, 0x50, 0x42, 0x07, 0x45, 0x85, 0x35, 0x00, 0xA9, 0x1C, 0xE9, 0x5B, 0xB0, 0x27, 0xC0, 
+    0x99, 0xEE, 0xE3, 0x33, 0xFF, 0x30, 0x53, 0x22, 0x80, 0x80, 0xF2, 0x01, 0x00, 0x70, 0xB0, 0x09, 
+    0x50, 0x82, 0x0D, 0x33, 0xF0, 0xB1, 0x08, 0x00, 0x03, 0x90, 0x00, 0xD0, 0xA1, 0x04, 0x66, 0x60, 
+    0x00, 0xA4, 0x03, 0xD4, 0x44, 0xCB, 0x19, 0x55, 0xB3, 0xB5, 0x00, 0x03, 0x55, 0x5B, 0x3B, 0x5B, 
+    0x50, 0xB5, 0xB4, 0x44, 0xC0, 0x01, 0x99, 0xA0, 0x16, 0x55, 0x02, 0x7C, 0x09, 0xEE, 0x33, 0xEF, 
+    0xFF, 0x01, 0x13, 0xB3, 0x80, 0x42, 0x01, 0x88, 0xB2, 0x03, 0x70, 0x00, 0xA3, 0x03, 0xBB, 0x00, 
+    0x42, 0x00, 0x00, 0xF1, 0x01, 0x06, 0x03, 0x90, 0x00, 0x60, 0x43, 0xA0, 0x02, 0x44, 0xD0, 0x42, 
+    0x02, 0x44, 0x40, 0xBB, 0x00, 0xD0, 0x45, 0xDB, 0x08, 0x45, 0xAA, 0x5A, 0xB6, 0xB0, 0xF0, 0x03, 
+    0x08, 0x50, 0x27, 0x00, 0x99, 0xE0, 0xC3, 0x06, 0x01, 0x11, 0x35, 0xB0, 0x42, 0x03, 0x08, 0x88, 
+    0xA0, 0x05, 0x5D, 0x61, 0x6D, 0xA3, 0x06, 0xB0, 0x20, 0x33, 0xF0, 0xF1, 0x02, 0x05, 0x03, 0x30, 
+    0x05, 0x48, 0x09, 0xDD, 0x44, 0xBB, 0xB4, 0x44, 0xBB, 0xA5, 0x11, 0x00, 0x5B, 0x4B, 0xB4, 0x44, 
+    0x55, 0xA0, 0xA5, 0x55, 0xF0, 0x05, 0x05, 0x82, 0xC0, 0x99, 0xAE, 0x04, 0x30, 0x53, 0xF0, 0x43, 
+    0x02, 0x38, 0x20, 0xB0, 0x43, 0x05, 0xB6, 0x66, 0xD3, 0xAD, 0x00, 0x50, 0x47, 0x02, 0x33, 0x30, 
+    0xD1, 0x06, 0x03, 0x00, 0x31, 0x60, 0x44, 0x01, 0x6D, 0xF4, 0x01, 0x04, 0xBB, 0x55, 0x50, 0xB0, 
+    0x06, 0x55, 0x3D, 0xB4, 0xB0, 0xAA, 0x0D, 0x0B, 0xB0, 0x80, 0x09, 0x99, 0x00, 0x09, 0xA0, 0x15, 
+    0x82, 0x70, 0x9E, 0xEE, 0x90, 0x50, 0x00, 0x33, 0x10, 0xF3, 0x5B, 0x45, 0xB0, 0x42, 0x06, 0x6D, 
+    0xDD, 0x33, 0x30, 0x43, 0x08, 0x00, 0x03, 0x3B, 0x5B, 0xD0, 0x47, 0x00, 0x50, 0xC6, 0x00, 0x00, 
+    0xC4, 0x00, 0xD0, 0xB4, 0x00, 0xB0, 0xA5, 0xC0, 0x11, 0x30, 0x33, 0x00, 0x82, 0x05, 0x50, 0x50, 
+    0x08, 0x28, 0xE0, 0x10, 0x93, 0x02, 0x27, 0x00, 0x99, 0x90, 0x05, 0x50, 0x50, 0xA3, 0x05, 0xEE, 
+    0x55, 0x27, 0x4B, 0x01, 0x16, 0xA3, 0x02, 0x1F, 0x90, 0x42, 0xB3, 0x04, 0xB3, 0x53, 0xD0, 0x43, 
+    0x04, 0xE9, 0x00, 0xD0, 0xC6, 0xB4, 0x00, 0xD0, 0x43, 0x02, 0xB5, 0x50, 0xF0, 0x01, 0x03, 0x20, 
+    0xF0, 0xA2, 0x1A, 0x00, 0x88, 0x00, 0x05, 0xA8, 0x80, 0x05, 0x33, 0x11, 0x38, 0x22, 0x7C, 0xC0, 
+    0x90, 0xA0, 0x0F, 0xB0, 0xB5, 0x55, 0x00, 0x9B, 0x52, 0x09, 0x99, 0xD0, 0x02, 0x31, 0x10, 0x42, 
+    0x17, 0x01, 0x03, 0x97, 0x03, 0x39, 0x03, 0x35, 0xDD, 0xB5, 0x53, 0xF0, 0x0F, 0x42, 0x00, 0xB0, 
+    0x49, 0xC4, 0x01, 0x55, 0xC0, 0x08, 0x80, 0x00, 0x32, 0x73, 0x30, 0xA2, 0xA8, 0x09, 0x00, 0x54, 
+    0x4B, 0x80, 0xD6, 0xA1, 0x06, 0x52, 0x22, 0x77, 0xC0, 0xC0, 0x03, 0x55, 0x05, 0xB0, 0x02, 0xB0, 
+    0x70, 0x42, 0x09, 0x99, 0xEE, 0x90, 0x03, 0x33, 0xD1, 0x14, 0x03, 0x08, 0x33, 0xE0, 0x05, 0x03, 
+    0x6B, 0xB5, 0x33, 0xFF, 0x30, 0x42, 0x00, 0x50, 0xB6, 0xF4, 0x02, 0x01, 0x55, 0xE0, 0x0A, 0x77, 
+    0x21, 0x02, 0x00, 0x02, 0x80, 0xD0, 0x0C, 0x54, 0x44, 0xAB, 0x66, 0x61, 0x11, 0x00, 0x44, 0x01, 
+    0x99, 0xF0, 0x04, 0x04, 0x58, 0x09, 0x90, 0xBE, 0x04, 0xFE, 0x00, 0xE0, 0xF1, 0x01, 0x05, 0x03, 
+    0x2B, 0x33, 0xB0, 0x06, 0x3B, 0x00, 0x93, 0x30, 0x49, 0x00, 0xD0, 0x4B, 0x00, 0x50, 0xC0, 0x17, 
+    0x77, 0x08, 0x00, 0x22, 0x03, 0x54, 0x44, 0xBA, 0x05, 0x5B, 0x44, 0x4B, 0xA6, 0x02, 0x11, 0x60, 
+    0x45, 0xF0, 0x00, 0x00, 0x50, 0xA0, 0x0F, 0x50, 0x29, 0xEE, 0xE0, 0x00, 0xF0, 0xE9, 0x93, 0xF1, 
+    0x02, 0x09, 0x00, 0x03, 0x55, 0x00, 0x55, 0xA0, 0x09, 0x9E, 0x33, 0x39, 0x90, 0x00, 0x4D, 0xA5, 
+    0xA0, 0xC8, 0xA2, 0x0A, 0xC9, 0xB4, 0x44, 0x04, 0xA5, 0xB0, 0xB4, 0xC6, 0x00, 0x40, 0x43, 0xCC, 
+    0xF0, 0x02, 0x01, 0x20, 0x46, 0x05, 0xF9, 0xEE, 0x36, 0xF1, 0x02, 0x02, 0x32, 0x00, 0x42, 0xC0, 
+    0x04, 0x39, 0xEE, 0xE0, 0x43, 0x00, 0x30, 0xA6, 0x00, 0xD0, 0xE4, 0x00, 0xB0, 0xB5, 0xA0, 0xB5, 
+    0x05, 0x22, 0x27, 0x00, 0x42, 0x03, 0x44, 0x55, 0xD4, 0xA6, 0x0B, 0x45, 0x82, 0x27, 0x77, 0xCC, 
+    0x7C, 0xC0, 0x17, 0x88, 0x00, 0x02, 0xC9, 0x9E, 0xE0, 0x00, 0xFF, 0xE9, 0x90, 0x31, 0x66, 0xF1, 
+    0x01, 0x02, 0xE2, 0x00, 0x45, 0x04, 0x93, 0x99, 0x00, 0x45, 0x01, 0x5D, 0x42, 0x00, 0xD0, 0xC4, 
+    0xB5, 0xC0, 0x0A, 0x5D, 0x08, 0x82, 0x7C, 0x09, 0x30, 0x44, 0x00, 0xB0, 0x46, 0x00, 0x00, 0x42, 
+    0x00, 0x00, 0x43, 0x00, 0xC0, 0xA7, 0xF0, 0x01, 0x00, 0x20, 0x42, 0x0F, 0x9E, 0xEE, 0x00, 0xEE, 
+    0x00, 0x03, 0x66, 0x16, 0xE1, 0x18, 0x00, 0x02, 0x03, 0xB5, 0x59, 0x33, 0x99, 0x00, 0x99, 0x90, 
+    0xCC, 0x00, 0x50, 0x42, 0x02, 0x44, 0x40, 0xBB, 0x01, 0x55, 0xF0, 0x04, 0x0E, 0x20, 0x00, 0x99, 
+    0x54, 0x00, 0x44, 0x40, 0xB0, 0xC4, 0xA6, 0x01, 0x58, 0xA2, 0xC7, 0xE0, 0x05, 0x82, 0x27, 0xCC, 
+    0xB9, 0x08, 0xEE, 0x93, 0x99, 0x9B, 0x60, 0xF1, 0x02, 0x0C, 0x00, 0xF0, 0x22, 0x05, 0x55, 0x33, 
+    0x90, 0xA0, 0x07, 0x99, 0x00, 0x08, 0x8B, 0xAD, 0x0B, 0x3B, 0xB5, 0xBB, 0x5B, 0xBB, 0x55, 0xF0, 
+    0x02, 0x0E, 0x77, 0x7C, 0x00, 0xB4, 0x40, 0x04, 0x4A, 0xA0, 0xC4, 0x04, 0x06, 0x64, 0x00, 0x48, 
+    0x01, 0x08, 0xF2, 0x01, 0x13, 0x7C, 0xCC, 0x99, 0xC9, 0x99, 0x09, 0x39, 0x0B, 0x66, 0x16, 0xF1, 
+    0x00, 0x03, 0x0F, 0xE7, 0xC2, 0x01, 0x03, 0x43, 0xB0, 0x00, 0x50, 0xC3, 0x0D, 0x90, 0xB3, 0x33, 
+    0x90, 0x05, 0xB3, 0xB5, 0x47, 0x06, 0x22, 0x70, 0x0B, 0xB0, 0x46, 0x00, 0xD0, 0x45, 0x05, 0x65, 
+    0x88, 0x22, 0xA7, 0x02, 0x00, 0x80, 0xF2, 0x02, 0x01, 0x77, 0xBC, 0xC0, 0x05, 0x55, 0xBD, 0xDD, 
+    0x49, 0x02, 0x39, 0xC0, 0xD2, 0x02, 0x03, 0x50, 0xC0, 0x01, 0x55, 0x44, 0xA5, 0x02, 0xB3, 0x50, 
+    0xC0, 0x03, 0x53, 0x3B, 0xC0, 0xA2, 0x19, 0x05, 0x3B, 0x44, 0x00, 0x4A, 0xAD, 0x60, 0x44, 0x46, 
+    0x66, 0xD0, 0x82, 0x88, 0xA0, 0x00, 0x80, 0xF2, 0x04, 0x51, 0x0D, 0xD3, 0x36, 0x33, 0x0F, 0x0F, 
+    0x3E, 0x07, 0xE2, 0x05, 0x85, 0x55, 0x00, 0xA5, 0x01, 0x05, 0xC0, 0x02, 0x53, 0x50, 0x44, 0x0C, 
+    0x55, 0x53, 0x33, 0xB5, 0x80, 0x00, 0x70, 0xA2, 0x09, 0x3F, 0x05, 0xBD, 0x66, 0x64, 0xF6, 0x00, 
+    0x01, 0x40, 0xF2, 0x0E, 0x02, 0x7C, 0xC0, 0xA7, 0xA0, 0x03, 0x55, 0xB5, 0xBD, 0xE3, 0x02, 0xE0, 
+    0xC0, 0x47, 0x02, 0x22, 0x20, 0xF0, 0x03, 0x04, 0x90, 0x05, 0x50, 0xB3, 0xA0, 0x09, 0xB3, 0x30, 
+    0x05, 0x50, 0x00, 0xA2, 0x0F, 0x03, 0x3F, 0x30, 0x53, 0x66, 0x16, 0xDB, 0xBD, 0xA6, 0x04, 0xD0, 
+    0x22, 0x70, 0xF2, 0x0C, 0x07, 0x77, 0xC7, 0x70, 0x88, 0xB0, 0x10, 0x5D, 0xD6, 0x6D, 0xD6, 0x1D, 
+    0x33, 0x3E, 0x90, 0x00, 0x49, 0xA0, 0xA5, 0x01, 0x00, 0xB3, 0x04, 0x00, 0x53, 0xD0, 0xC3, 0xA0, 
+    0x00, 0x90, 0xB0, 0x1B, 0x82, 0x22, 0x70, 0x03, 0x30, 0x13, 0x05, 0xBD, 0x66, 0x52, 0x20, 0xB6, 
+    0xD0, 0x88, 0xF0, 0x00, 0x00, 0x70, 0xF2, 0x05, 0x02, 0x77, 0x70, 0xA0, 0x00, 0x20, 0x43, 0x05, 
+    0x6D, 0xDD, 0x36, 0x45, 0x02, 0x00, 0xC0, 0xF2, 0x01, 0xB0, 0x03, 0x5B, 0xBB, 0xB3, 0xB0, 0x02, 
+    0x33, 0x30, 0xA0, 0xA3, 0xA0, 0x03, 0x90, 0x00, 0xB2, 0x15, 0xC0, 0x90, 0x11, 0x33, 0x90, 0x05, 
+    0xB0, 0x22, 0x20, 0x02, 0x22, 0xC0, 0x03, 0x33, 0x00, 0xF2, 0x08, 0x02, 0x88, 0x80, 0xC0, 0x43, 
+    0x03, 0x61, 0x1D, 0x42, 0x03, 0x00, 0x07, 0xF2, 0x00, 0xA0, 0x0E, 0x50, 0x05, 0x5B, 0x33, 0x50, 
+    0x00, 0x93, 0x30, 0x42, 0x01, 0x39, 0xA0, 0x07, 0xE3, 0x30, 0x00, 0x5B, 0x47, 0x0B, 0x0E, 0x31, 
+    0x11, 0xF3, 0x90, 0xC7, 0xA2, 0x09, 0x88, 0x72, 0x22, 0x00, 0x5B, 0xB0, 0xF2, 0x05, 0xC8, 0x01, 
+    0x22, 0x43, 0x0A, 0x33, 0xD3, 0x33, 0x6D, 0x3B, 0x50, 0x4A, 0x04, 0x55, 0x50, 0x50, 0xA0, 0xA5, 
+    0xF3, 0x06, 0x09, 0xE0, 0x00, 0x99, 0x00, 0x05, 0x45, 0x05, 0x22, 0x7C, 0x03, 0xA1, 0x06, 0x03, 
+    0x9C, 0x00, 0x20, 0xB0, 0xA2, 0x05, 0x00, 0x02, 0x28, 0xB2, 0x00, 0x80, 0xF2, 0x01, 0x14, 0x80, 
+    0x22, 0x27, 0x7C, 0xC2, 0x03, 0x33, 0x11, 0x30, 0x0B, 0x30, 0xC0, 0xD2, 0x0B, 0x00, 0x55, 0xB3, 
+    0x50, 0x05, 0x05, 0xF3, 0x0B, 0xF0, 0x01, 0x00, 0x80, 0xC2, 0x04, 0x7C, 0x0E, 0xF0, 0xA1, 0x04, 
+    0x00, 0xE3, 0xE0, 0xD0, 0x45, 0xB2, 0x02, 0x8A, 0x80, 0xF2, 0x02, 0x01, 0x70, 0xAC, 0x11, 0x77, 
+    0x03, 0x30, 0x00, 0xFF, 0xE2, 0x0B, 0x50, 0x08, 0xD2, 0x03, 0x00, 0x05, 0xA3, 0x02, 0x50, 0x50, 
+    0xB3, 0x01, 0xFF, 0xA3, 0xCF, 0x01, 0x3F, 0xA3, 0x00, 0x90, 0xD0, 0x02, 0x45, 0x80, 0xC2, 0x18, 
+    0x70, 0xC0, 0xEF, 0x11, 0x13, 0x00, 0x13, 0x05, 0x30, 0x00, 0xC2, 0x20, 0xC0, 0xC2, 0x04, 0x80, 
+    0x00, 0x80, 0x49, 0x01, 0xCC, 0xC7, 0x0D, 0x33, 0xFF, 0x3F, 0xFF, 0x92, 0x20, 0x00, 0xD2, 0x0A, 
+    0x00, 0x55, 0xB3, 0x33, 0x50, 0x50, 0xA3, 0x00, 0xF0, 0xC0, 0x04, 0xFF, 0x0F, 0xF0, 0xB0, 0x00, 
+    0xF0, 0xA3, 0x09, 0x00, 0x09, 0x90, 0xA4, 0x50, 0xD2, 0x0E, 0x0C, 0xC9, 0xEF, 0x10, 0x00, 0x10, 
+    0x00, 0x50, 0xA0, 0xF2, 0x00, 0x03, 0x8A, 0x08, 0x49, 0xF7, 0x01, 0x0C, 0x93, 0xF3, 0x3F, 0xFE, 
+    0xEE, 0x22, 0x80, 0x45, 0x02, 0xB0, 0x50, 0x43, 0x01, 0x50, 0xA3, 0x00, 0xF0, 0xE1, 0x04, 0xFF, 
+    0xF0, 0x00, 0xD1, 0x0E, 0xF3, 0x33, 0x00, 0x09, 0x9A, 0xA0, 0x4A, 0x80, 0xC2, 0x0A, 0x77, 0x7C, 
+    0x9E, 0x30, 0xEF, 0xF0, 0xD0, 0xE2, 0x02, 0x00, 0x00, 0xB8, 0xF2, 0x00, 0x48, 0x09, 0xE3, 0xE3, 
+    0xFE, 0xEE, 0x9C, 0xE2, 0x01, 0x53, 0xB0, 0x02, 0x3B, 0x50, 0xA3, 0x01, 0xF0, 0xE1, 0x03, 0x03, 
+    0xF3, 0x46, 0x04, 0x11, 0x33, 0x30, 0xA0, 0x06, 0x55, 0xA0, 0x45, 0x80, 0xD2, 0x08, 0x77, 0xCC, 
+    0x0C, 0x99, 0x90, 0xA0, 0x00, 0xC0, 0x46, 0x02, 0x06, 0xD0, 0x45, 0x00, 0x80, 0xF2, 0x00, 0x13, 
+    0x72, 0x27, 0x77, 0x27, 0x0E, 0x99, 0x3E, 0x9E, 0x9C, 0xC7, 0xC2, 0x09, 0x03, 0x05, 0x00, 0x55, 
+    0x5B, 0xA3, 0x01, 0xF0, 0x4B, 0x00, 0xF0, 0xF1, 0x01, 0x0D, 0x33, 0x39, 0x00, 0x05, 0xAA, 0x04, 
+    0x58, 0xE2, 0x0D, 0xCC, 0x7C, 0xC0, 0xC7, 0x02, 0x02, 0xC7, 0xB2, 0x03, 0x01, 0x14, 0x4F, 0x12, 
+    0x27, 0x27, 0x72, 0x22, 0x09, 0x99, 0xE9, 0x99, 0xCC, 0x70, 0xD2, 0x03, 0x33, 0xB0, 0x48, 0xA0, 
+    0x47, 0x03, 0x33, 0x3F, 0xF1, 0x01, 0x02, 0x33, 0x30, 0xA0, 0x42, 0x03, 0x44, 0x08, 0xE2, 0x13, 
+    0x77, 0x7C, 0x77, 0x72, 0x07, 0x72, 0x22, 0x88, 0x01, 0x16, 0x45, 0x03, 0x22, 0x88, 0xF2, 0x02, 
+    0x44, 0x00, 0x00, 0xA9, 0x02, 0xC7, 0x70, 0x45, 0x01, 0x03, 0xD0, 0x08, 0x5B, 0x3E, 0x3F, 0xF0, 
+    0x00, 0xE1, 0xC3, 0xF1, 0x00, 0x04, 0x00, 0x3E, 0x30, 0xA0, 0x07, 0x55, 0xA0, 0x44, 0xA8, 0xE2, 
+    0xB7, 0x0E, 0x22, 0x20, 0x22, 0x80, 0x3D, 0x11, 0x1D, 0x00, 0x44, 0x00, 0x80, 0x4A, 0x00, 0x70, 
+    0x42, 0x02, 0x70, 0x00, 0x42, 0x03, 0xC7, 0x77, 0xD2, 0x00, 0xB0, 0xC0, 0x05, 0x55, 0xB3, 0x3E, 
+    0xAF, 0x47, 0x00, 0x10, 0xA3, 0xF1, 0x01, 0x11, 0x0F, 0xF3, 0x90, 0x00, 0x8A, 0x55, 0xAA, 0x44, 
+    0xA8, 0xF2, 0x01, 0x00, 0x70, 0xA2, 0x04, 0x82, 0x80, 0xD0, 0xA1, 0x03, 0x64, 0x00, 0xF8, 0x01, 
+    0xF2, 0x00, 0x0A, 0x77, 0x72, 0x7C, 0x00, 0x9E, 0x00, 0x48, 0x00, 0x00, 0x42, 0x0C, 0xE3, 0x0B, 
+    0xB3, 0x39, 0x3F, 0xFF, 0x00, 0x47, 0xC3, 0x48, 0x04, 0x0F, 0xF9, 0x30, 0xA0, 0x08, 0x5A, 0xAA, 
+    0x04, 0x44, 0x00, 0xF2, 0x06, 0x01, 0x85, 0xB6, 0x01, 0x1D, 0x56, 0x0B, 0xC7, 0x2C, 0x09, 0xEE, 
+    0x07, 0x77, 0xD2, 0x10, 0x05, 0x00, 0x03, 0x33, 0xB3, 0x39, 0xE3, 0x33, 0xF0, 0xA0, 0x45, 0x00, 
+    0x60, 0x49, 0x06, 0x00, 0xF0, 0xFF, 0x30, 0xC0, 0x03, 0xAA, 0x5A, 0xA4, 0x01, 0x58, 0x4C, 0x00, 
+    0x40, 0xC6, 0x01, 0x40, 0x46, 0x01, 0x22, 0x4C, 0x08, 0xC2, 0x00, 0xEF, 0xE9, 0xC0, 0x47, 0x04, 
+    0x50, 0x00, 0xE0, 0xB3, 0x00, 0x90, 0x47, 0xD1, 0xB3, 0x07, 0xF1, 0x11, 0x31, 0x10, 0xAF, 0x03, 
+    0x33, 0x3E, 0xA0, 0x0B, 0x55, 0x5A, 0xAA, 0x04, 0x44, 0x50, 0xF2, 0x02, 0x03, 0x8A, 0x60, 0x45, 
+    0x00, 0xA0, 0xF8, 0x02, 0x48, 0x07, 0xCC, 0x07, 0x00, 0xF3, 0x43, 0x01, 0x70, 0xA2, 0xB0, 0x0E, 
+    0xEE, 0xB3, 0x39, 0x9E, 0xEE, 0x3F, 0xFF, 0x00, 0xA1, 0x00, 0x60, 0x42, 0x00, 0xB0, 0xA3, 0x07, 
+    0x11, 0x66, 0x31, 0x1F, 0xC3, 0x46, 0x0A, 0x5A, 0xA5, 0x40, 0x04, 0x40, 0x80, 0xB2, 0xB8, 0x08, 
+    0x46, 0x00, 0x66, 0x64, 0x00, 0x42, 0x00, 0x00, 0x50, 0x09, 0x7C, 0x0C, 0x0E, 0xF3, 0x39, 0xAC, 
+    0x00, 0x70, 0x47, 0x08, 0x90, 0xB3, 0x30, 0x9E, 0xE0, 0xF3, 0x02, 0x0C, 0x61, 0x16, 0xDD, 0x33, 
+    0x3D, 0x66, 0x60, 0xF3, 0x01, 0x42, 0x12, 0x55, 0x50, 0x00, 0x55, 0xA0, 0x00, 0x45, 0x88, 0x22, 
+    0x20, 0xB8, 0x01, 0x5D, 0x43, 0x04, 0x04, 0x0A, 0x00, 0x47, 0x02, 0x08, 0x80, 0x4C, 0x06, 0x33, 
+    0xF3, 0x00, 0xC0, 0xD2, 0xD0, 0x0A, 0x5B, 0x00, 0x99, 0x33, 0xB5, 0xB0, 0xB3, 0x02, 0xBB, 0xD0, 
+    0xA6, 0x01, 0xDD, 0xB6, 0x01, 0x4B, 0xC3, 0xC0, 0xB5, 0x46, 0x01, 0x00, 0x42, 0x0E, 0x0A, 0x55, 
+    0x5B, 0x66, 0x00, 0x66, 0x04, 0x00, 0x55, 0x0A, 0x22, 0xCC, 0xC9, 0x3F, 0xF9, 0xC0, 0xF2, 0x00, 
+    0xF0, 0x08, 0x00, 0x50, 0x45, 0xB3, 0x02, 0xBD, 0xD0, 0xA3, 0x06, 0xB3, 0x33, 0x13, 0x00, 0x4A, 
+    0x03, 0x55, 0x5A, 0xD0, 0x02, 0x88, 0x00, 0xA4, 0xE0, 0x00, 0x40, 0x42, 0x02, 0x88, 0x00, 0xF8, 
+    0x01, 0x00, 0x70, 0xF2, 0x01, 0x05, 0x77, 0x03, 0x3C, 0xF2, 0x02, 0xB0, 0x00, 0x50, 0xF0, 0x02, 
+    0x00, 0xB0, 0x44, 0xC3, 0x01, 0xBD, 0xB3, 0x00, 0x00, 0xA3, 0x03, 0x13, 0x09, 0xE0, 0xA5, 0xDA, 
+    0x04, 0x58, 0x85, 0xB0, 0xC4, 0xA0, 0xA4, 0x02, 0x00, 0x00, 0x53, 0x00, 0x70, 0xA2, 0x09, 0x00, 
+    0x22, 0x09, 0x90, 0x77, 0xA2, 0x00, 0x80, 0xF0, 0x08, 0x01, 0x35, 0x44, 0x0D, 0x00, 0x11, 0x35, 
+    0xD3, 0xF0, 0x0F, 0x30, 0xA3, 0x03, 0x10, 0x09, 0x49, 0x0A, 0x5A, 0xAA, 0x55, 0xAA, 0xA5, 0x50, 
+    0xE4, 0x44, 0x03, 0x00, 0xA0, 0xE8, 0x00, 0x00, 0xA8, 0xE2, 0x01, 0x70, 0xB2, 0x06, 0x7E, 0xF3, 
+    0x9C, 0x70, 0xB2, 0x01, 0x82, 0xF0, 0x05, 0x00, 0x50, 0x45, 0xA3, 0x01, 0xF0, 0x42, 0x05, 0x30, 
+    0x03, 0x3E, 0xC3, 0x4C, 0x0E, 0x55, 0x05, 0x5A, 0x55, 0xAA, 0x5A, 0x55, 0x50, 0xE4, 0x03, 0x00, 
+    0xA0, 0x44, 0x05, 0x28, 0xA8, 0x88, 0xF2, 0x01, 0x0B, 0xC0, 0xC2, 0x20, 0x03, 0xF3, 0xE0, 0x46, 
+    0x02, 0x00, 0x80, 0xF0, 0x05, 0xB3, 0x01, 0x00, 0xC3, 0x42, 0x03, 0xFF, 0x3E, 0xC3, 0xF0, 0x01, 
+    0x46, 0x0B, 0x05, 0x5A, 0xAA, 0x55, 0xAA, 0x50, 0x47, 0x02, 0xA0, 0x00, 0xB8, 0x01, 0x28, 0x43, 
+    0x01, 0x07, 0xD2, 0x0D, 0x7C, 0xC0, 0xC2, 0x03, 0x1F, 0xE9, 0x07, 0x45, 0x03, 0x72, 0x08, 0x4D, 
+    0x01, 0x55, 0x42, 0x00, 0xE0, 0x46, 0x06, 0x33, 0x39, 0x33, 0x00, 0x52, 0x04, 0x55, 0xBD, 0xB0, 
+    0xA5, 0x04, 0xAA, 0xA5, 0x00, 0x46, 0x00, 0x00, 0x47, 0x07, 0xA0, 0x88, 0x87, 0x77, 0xD2, 0x0C, 
+    0x00, 0xCC, 0xC9, 0x00, 0x39, 0x00, 0xC0, 0xC2, 0x07, 0x07, 0x28, 0x00, 0x08, 0xE0, 0x04, 0x30, 
+    0x33, 0x00, 0x42, 0x12, 0x00, 0x35, 0xBB, 0x5D, 0x30, 0x53, 0x33, 0x90, 0x03, 0x30, 0xF0, 0x01, 
+    0x07, 0xBB, 0x55, 0xB4, 0xBB, 0xAD, 0x01, 0x6D, 0x43, 0x02, 0x55, 0x50, 0xA4, 0xA0, 0x01, 0xA0, 
+    0xB8, 0x09, 0x28, 0x0A, 0xA8, 0x80, 0x07, 0xE2, 0x00, 0x70, 0x42, 0x01, 0xE1, 0x4C, 0x01, 0x02, 
+    0xB8, 0x00, 0x70, 0x46, 0x04, 0x03, 0x00, 0x50, 0xB0, 0x04, 0x55, 0x50, 0x30, 0x42, 0x01, 0x09, 
+    0x42, 0x02, 0x00, 0x30, 0xA0, 
+};
+
+const gfx_image_t STORY_CH6_ENEMY_IMG = {
+    .w = STORY_CH6_ENEMY_W, .h = STORY_CH6_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH6_ENEMY_PAL, .colors = STORY_CH6_ENEMY_PAL_SIZE,
+    .data = STORY_CH6_ENEMY_RLE, .size = STORY_CH6_ENEMY_RLE_SIZE,
 };
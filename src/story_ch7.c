@@ -6,305 +6,205 @@ const uint16_t STORY_CH7_PAL[STORY_CH7_PAL_SIZE] = {
     0x3A2A, 0xF945, 0xCE37, 0x93AD, 0xE934, 0xD2AA, 0x31E9, 0xF8EB, 
 };
 
-const uint8_t STORY_CH7_IDX[(STORY_CH7_W * STORY_CH7_H) / 2] = {
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x65, 0x51, 0x11, 0x11, 0x55, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x34, 0x44, 0x32, 0x46, 0x52, 0x22, 0x21, 0x64, 0x44, 
-    0x00, 0x00, 0x46, 0x64, 0x44, 0x00, 0x44, 0x23, 0x41, 0x65, 0x11, 0x10, 0x33, 0x01, 0x11, 0x11, 
-    0x11, 0x00, 0x10, 0x28, 0x0E, 0xE8, 0xEE, 0xE0, 0xB7, 0x47, 0x73, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x56, 0x66, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x44, 0x44, 0x32, 0x24, 0x42, 0x22, 0x01, 0x64, 0x44, 
-    0x00, 0x00, 0x46, 0x64, 0x40, 0xAA, 0x44, 0x24, 0x11, 0x11, 0x11, 0x10, 0x33, 0x22, 0x30, 0x03, 
-    0x32, 0x22, 0x22, 0x28, 0x8E, 0xE8, 0xEE, 0xEE, 0x07, 0x77, 0x73, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x11, 0x43, 0x22, 0x22, 0x22, 0x22, 0x01, 0x64, 0x42, 
-    0x00, 0x00, 0x46, 0xA4, 0xAA, 0xA4, 0x44, 0x23, 0x33, 0x03, 0x03, 0x33, 0x33, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x20, 0x8E, 0x88, 0x88, 0x0E, 0x07, 0xB7, 0x72, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x56, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x51, 0x43, 0x22, 0x22, 0x22, 0x22, 0x01, 0x64, 0x40, 
-    0x00, 0x08, 0x46, 0x04, 0xA6, 0x44, 0x44, 0x03, 0x33, 0x32, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x28, 0x8E, 0x80, 0x8E, 0x00, 0xE0, 0xBB, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x66, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0x43, 0x22, 0x22, 0x22, 0x22, 0x01, 0x14, 0x40, 
-    0x00, 0x08, 0x46, 0xA4, 0x60, 0x44, 0x44, 0x02, 0x32, 0x22, 0x22, 0x32, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x33, 0x22, 0x20, 0x88, 0x88, 0xE0, 0xBB, 0x00, 0xB0, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x66, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x44, 0x43, 0x22, 0x22, 0x22, 0x22, 0x01, 0x14, 0x40, 
-    0x00, 0x00, 0x46, 0x64, 0x6A, 0x44, 0x43, 0x03, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x23, 0x0E, 0x88, 0xE0, 0xB0, 0x00, 0xB7, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x56, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x44, 0x32, 0x22, 0x22, 0x22, 0x22, 0x01, 0x64, 0x43, 
-    0x00, 0x00, 0x46, 0x64, 0xAA, 0xAA, 0x40, 0x04, 0x32, 0x22, 0x23, 0x22, 0x22, 0x32, 0x32, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x2E, 0x80, 0xE0, 0x00, 0xEE, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x51, 0x43, 0x32, 0x22, 0x22, 0x22, 0x22, 0x01, 0x64, 0x43, 
-    0x00, 0x08, 0x46, 0x64, 0xAA, 0xAA, 0x40, 0x04, 0x32, 0x22, 0x43, 0x23, 0x22, 0x32, 0x32, 0x23, 
-    0x32, 0x22, 0x22, 0x23, 0x28, 0x00, 0x80, 0x00, 0x0E, 0x00, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 
-    0x51, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x32, 0x22, 0x22, 0x22, 0x20, 0x22, 0x01, 0x64, 0x42, 
-    0x00, 0x00, 0x36, 0xA4, 0x0A, 0xAA, 0x42, 0x04, 0x32, 0x22, 0x33, 0x32, 0x24, 0x32, 0x33, 0x22, 
-    0x22, 0x23, 0x22, 0x23, 0x28, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x51, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x21, 0x64, 0x43, 
-    0x00, 0x00, 0x36, 0xA4, 0x00, 0xAA, 0x43, 0x44, 0x43, 0x32, 0x43, 0x32, 0x22, 0x32, 0x22, 0x23, 
-    0x23, 0x23, 0x22, 0x22, 0x28, 0x88, 0xE8, 0x00, 0x08, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x51, 0x11, 0x51, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x21, 0x64, 0x44, 
-    0x00, 0x00, 0x36, 0x64, 0xAA, 0xA4, 0x23, 0x44, 0x44, 0x44, 0x44, 0x43, 0x04, 0x43, 0x33, 0x22, 
-    0x32, 0x23, 0x22, 0x22, 0x20, 0x88, 0x88, 0x88, 0x88, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x51, 0x15, 0x51, 0x53, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x01, 0x64, 0x42, 
-    0x00, 0x00, 0x46, 0x64, 0xA6, 0x00, 0x00, 0x0B, 0xB4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 
-    0x32, 0x22, 0x23, 0x32, 0x23, 0x00, 0x00, 0x08, 0x02, 0x22, 0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x53, 0x22, 0x22, 0x22, 0x20, 0x00, 0x02, 0x01, 0x63, 0x33, 
-    0x00, 0x00, 0x46, 0x64, 0x64, 0x08, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x04, 0x42, 
-    0x32, 0x22, 0x33, 0x23, 0x22, 0x22, 0x88, 0x00, 0x23, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x15, 0x51, 0x11, 0x53, 0x22, 0x22, 0x22, 0x00, 0x00, 0x02, 0x01, 0x60, 0x42, 
-    0x00, 0x00, 0x36, 0x64, 0x43, 0xE0, 0x00, 0x02, 0x43, 0x00, 0x00, 0x44, 0x4B, 0x00, 0xAA, 0x42, 
-    0x33, 0x23, 0x22, 0x23, 0x22, 0x23, 0x20, 0x02, 0x32, 0x22, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x53, 0x22, 0x22, 0x22, 0x00, 0x02, 0x02, 0x01, 0x64, 0x42, 
-    0x00, 0x00, 0x36, 0x64, 0x40, 0x80, 0x24, 0x44, 0xAA, 0xA4, 0x04, 0x00, 0x44, 0x40, 0x4A, 0x42, 
-    0x33, 0x32, 0x23, 0x22, 0x33, 0x32, 0x32, 0x23, 0x32, 0x22, 0x22, 0x32, 0x23, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x53, 0x22, 0x22, 0x22, 0x00, 0x00, 0x02, 0x01, 0x60, 0x42, 
-    0x00, 0x00, 0x46, 0xA4, 0x60, 0x80, 0x04, 0x44, 0x04, 0xA4, 0x04, 0x22, 0x04, 0x42, 0x04, 0x42, 
-    0x32, 0x22, 0x23, 0x32, 0x22, 0x33, 0x32, 0x33, 0x33, 0x22, 0x32, 0x22, 0x23, 0x32, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x53, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x01, 0x40, 0x42, 
-    0x00, 0x00, 0x46, 0x64, 0x00, 0x80, 0x04, 0xA4, 0x04, 0xA4, 0x44, 0x22, 0x07, 0x43, 0x04, 0x42, 
-    0x33, 0x33, 0x33, 0x32, 0x22, 0x33, 0x33, 0x33, 0x23, 0x33, 0x33, 0x22, 0x32, 0x32, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x22, 0x22, 0x00, 0x00, 0x00, 0x02, 0x01, 0x40, 0x42, 
-    0x00, 0x00, 0x46, 0x64, 0x40, 0x00, 0x04, 0x44, 0x44, 0xA4, 0x04, 0x22, 0x07, 0x43, 0x24, 0x42, 
-    0x32, 0x33, 0x33, 0x22, 0x33, 0x33, 0x33, 0x22, 0x23, 0x33, 0x32, 0x22, 0x22, 0x23, 0x32, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x41, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x01, 0x43, 0x43, 
-    0x00, 0x08, 0x36, 0x64, 0xA0, 0x00, 0x00, 0x04, 0x44, 0x44, 0x44, 0x32, 0x00, 0x43, 0x24, 0x42, 
-    0x23, 0x33, 0x33, 0x23, 0x33, 0x33, 0x32, 0x33, 0x23, 0x33, 0x23, 0x32, 0x32, 0x22, 0x32, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04, 0x42, 
-    0x00, 0x00, 0x36, 0x64, 0xA0, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x32, 0x02, 0x43, 0x24, 0x42, 
-    0x33, 0x33, 0x32, 0x23, 0x32, 0x33, 0x32, 0x33, 0x32, 0x33, 0x33, 0x23, 0x32, 0x22, 0x22, 0x22, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x12, 0x22, 0x22, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x43, 
-    0x00, 0x00, 0x36, 0x44, 0xA0, 0x00, 0x24, 0x00, 0xAA, 0xAA, 0x44, 0x32, 0x00, 0x43, 0x2B, 0x42, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x33, 0x23, 0x33, 0x23, 0x32, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x34, 0x33, 0x34, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x32, 0x22, 0x22, 0x22, 0x00, 0x00, 0x02, 0x01, 0x34, 0x44, 
-    0x00, 0x00, 0x03, 0x44, 0x40, 0x00, 0x07, 0x44, 0x0A, 0xAA, 0x44, 0x32, 0x00, 0x43, 0x20, 0x42, 
-    0x33, 0x33, 0x23, 0x33, 0x33, 0x33, 0x23, 0x33, 0x33, 0x32, 0x22, 0x23, 0x22, 0x22, 0x22, 0x32, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x22, 0x02, 0x22, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x15, 0x12, 0x11, 0x32, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 
-    0x00, 0x00, 0x02, 0x44, 0x40, 0x80, 0x04, 0x40, 0xAA, 0xAA, 0x44, 0x33, 0x00, 0x43, 0x20, 0x42, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0x22, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x22, 0x22, 0x22, 0x20, 0x22, 0x00, 0x02, 0x00, 0x00, 0x44, 
-    0x00, 0x00, 0x20, 0x44, 0x40, 0x00, 0xB0, 0x40, 0x06, 0x6A, 0x44, 0x22, 0x00, 0x43, 0x2B, 0x43, 
-    0x33, 0x32, 0x02, 0x33, 0x22, 0x22, 0x22, 0x22, 0x32, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 
-    0x11, 0x11, 0x11, 0x15, 0x0F, 0x99, 0x40, 0x11, 0x0F, 0x99, 0x99, 0x33, 0x42, 0x02, 0xC9, 0x9D, 
-    0x01, 0x11, 0x51, 0xF9, 0x9B, 0x00, 0x20, 0xFD, 0x02, 0x20, 0x0F, 0xB0, 0x0C, 0x99, 0x99, 0x99, 
-    0x43, 0x00, 0x40, 0x46, 0x4C, 0xF9, 0x99, 0x99, 0xB5, 0x00, 0x0F, 0x99, 0xB3, 0x43, 0x0F, 0xD0, 
-    0x23, 0x30, 0xFB, 0x02, 0xC9, 0x99, 0x99, 0x94, 0x00, 0xC9, 0x99, 0x94, 0x02, 0x22, 0x33, 0x22, 
-    0x11, 0x11, 0x11, 0x10, 0x0D, 0xDD, 0x04, 0x11, 0x0F, 0x0B, 0xDD, 0x40, 0x44, 0x00, 0x0D, 0xDD, 
-    0x41, 0x11, 0x00, 0x0D, 0xD0, 0x42, 0x20, 0xF0, 0x20, 0x20, 0x0F, 0xB0, 0x0C, 0x9D, 0xDD, 0xDD, 
-    0x33, 0x00, 0x44, 0xAA, 0x40, 0xDD, 0xF9, 0xDD, 0x45, 0x00, 0x0D, 0xDD, 0x00, 0x43, 0x0F, 0x00, 
-    0x22, 0x30, 0xFB, 0x02, 0xC9, 0xDB, 0xDD, 0xD3, 0x30, 0xC9, 0xDD, 0xD0, 0x03, 0x22, 0x33, 0x23, 
-    0x11, 0x11, 0x11, 0x1C, 0x90, 0x51, 0xC9, 0x30, 0x0F, 0xD0, 0x30, 0xF0, 0x03, 0xC9, 0x40, 0x50, 
-    0x9B, 0x00, 0xC9, 0x05, 0x3C, 0x93, 0x30, 0xF9, 0x9B, 0x00, 0x0F, 0xB0, 0x0C, 0x93, 0x80, 0x00, 
-    0x00, 0x00, 0x34, 0xA4, 0x60, 0x31, 0xC9, 0x04, 0x6A, 0x0C, 0x93, 0x03, 0xC9, 0x33, 0x0F, 0x00, 
-    0x33, 0x30, 0xFB, 0x02, 0xC9, 0x30, 0x33, 0x33, 0x30, 0xC0, 0x03, 0x0C, 0x90, 0x32, 0x22, 0x33, 
-    0x11, 0x11, 0x11, 0x1C, 0x90, 0x11, 0xC9, 0x30, 0x0F, 0xD0, 0x40, 0xFD, 0x03, 0xC9, 0x40, 0x10, 
-    0x01, 0x30, 0xC9, 0x31, 0x0C, 0x93, 0x00, 0xF0, 0x30, 0xD3, 0x0F, 0xB0, 0x0C, 0x93, 0x20, 0x44, 
-    0x44, 0x00, 0x44, 0x44, 0x00, 0x00, 0xC9, 0x00, 0x44, 0x4C, 0x93, 0x34, 0xC9, 0x33, 0x0F, 0x00, 
-    0x0F, 0x30, 0xFB, 0x02, 0xC9, 0x30, 0x22, 0x23, 0x30, 0xC0, 0x02, 0x0C, 0x90, 0x32, 0x23, 0x23, 
-    0x11, 0x11, 0x11, 0x1C, 0x99, 0x99, 0x99, 0x33, 0x0F, 0x9F, 0xF9, 0x33, 0x43, 0xC9, 0x40, 0x13, 
-    0x43, 0x22, 0xC9, 0x99, 0x99, 0x93, 0x00, 0xF0, 0x0C, 0x93, 0x0F, 0xB0, 0x0C, 0x99, 0xF9, 0xD5, 
-    0x66, 0x44, 0x64, 0x44, 0x40, 0x44, 0xF9, 0x04, 0x44, 0x2C, 0x93, 0x41, 0xC9, 0x33, 0x0F, 0x00, 
-    0xC9, 0x30, 0xFB, 0x02, 0xC9, 0x9F, 0x9B, 0x02, 0x30, 0xC9, 0xFF, 0x94, 0x03, 0x33, 0x32, 0x33, 
-    0x11, 0x11, 0x11, 0x1C, 0x9D, 0xDD, 0xF9, 0x33, 0x0F, 0x9D, 0xDD, 0x40, 0x43, 0xC9, 0x43, 0x03, 
-    0x30, 0x02, 0xC9, 0xDD, 0xDD, 0x93, 0x00, 0xF0, 0x30, 0x2C, 0x99, 0xD0, 0x0C, 0x9D, 0xDD, 0xB0, 
-    0x0A, 0x44, 0xA0, 0x44, 0x44, 0x40, 0xF9, 0x34, 0x4A, 0x0C, 0x93, 0x44, 0xC9, 0x33, 0x0F, 0x00, 
-    0xC9, 0x30, 0xFB, 0x02, 0xC9, 0xDD, 0xDB, 0x02, 0x30, 0xC9, 0xDD, 0xD4, 0x32, 0x33, 0x32, 0x23, 
-    0x11, 0x11, 0x11, 0x1C, 0x90, 0x51, 0xC9, 0x38, 0x0F, 0xD0, 0x00, 0xF0, 0x00, 0x09, 0x40, 0x00, 
-    0xFB, 0x22, 0xC9, 0x30, 0x2C, 0x93, 0x00, 0xF0, 0x30, 0x00, 0xD9, 0xD0, 0x2C, 0x93, 0x34, 0x30, 
-    0xA4, 0x44, 0xA4, 0x00, 0x04, 0x40, 0xC9, 0x37, 0x77, 0x2C, 0x93, 0x44, 0xC9, 0x33, 0x0F, 0x00, 
-    0x00, 0x0C, 0x9B, 0x02, 0xC9, 0x30, 0x33, 0x33, 0x30, 0xC0, 0x03, 0x0C, 0x90, 0x33, 0x32, 0x23, 
-    0x11, 0x11, 0x11, 0x1C, 0x90, 0x11, 0xC9, 0x38, 0x0F, 0xD3, 0x00, 0xF0, 0x00, 0x09, 0x40, 0x00, 
-    0x97, 0x02, 0xC9, 0x32, 0x2C, 0x93, 0x00, 0xF0, 0x32, 0x44, 0x0F, 0xB0, 0x2C, 0x93, 0x14, 0x44, 
-    0xA4, 0x44, 0x44, 0x00, 0x00, 0x40, 0xC9, 0x04, 0x40, 0x0C, 0x93, 0x46, 0xC9, 0x33, 0x0F, 0x99, 
-    0x70, 0xF9, 0x9B, 0x02, 0xC9, 0x30, 0x22, 0x23, 0x30, 0xC0, 0x03, 0x0C, 0x90, 0x32, 0x32, 0x33, 
-    0x11, 0x11, 0x11, 0x1C, 0x90, 0x11, 0xC9, 0x38, 0x0F, 0xD0, 0x00, 0xF0, 0x00, 0x22, 0xC9, 0xFD, 
-    0x32, 0x22, 0xC9, 0x32, 0x2C, 0x93, 0x00, 0xF0, 0x30, 0x43, 0x0F, 0xD0, 0x2C, 0x99, 0xFF, 0xF9, 
-    0x45, 0x44, 0xA4, 0x00, 0x00, 0x40, 0xC9, 0x00, 0x40, 0x80, 0x0F, 0x9F, 0xB3, 0x33, 0x0F, 0x03, 
-    0x33, 0x20, 0x9D, 0x02, 0xC9, 0xFF, 0xFF, 0x94, 0x30, 0xC9, 0x03, 0x0C, 0x90, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x10, 0xD0, 0x11, 0x0D, 0x30, 0x2F, 0xB3, 0x02, 0xFD, 0x00, 0x22, 0xC0, 0xDD, 
-    0x00, 0x02, 0xC0, 0x32, 0x20, 0x93, 0x22, 0xFD, 0x00, 0x20, 0x0F, 0xB3, 0x2C, 0xDD, 0xDD, 0xDD, 
-    0x30, 0x44, 0xA4, 0x00, 0x00, 0x40, 0x0D, 0x04, 0x40, 0x80, 0x0F, 0x09, 0x40, 0x23, 0x0F, 0xD0, 
-    0x23, 0x30, 0xFB, 0x02, 0x09, 0xDD, 0xDD, 0xD3, 0x32, 0xCD, 0x03, 0x0C, 0xD0, 0x33, 0x33, 0x23, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x02, 0x34, 0x00, 0x03, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x20, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x00, 0x00, 0x00, 0x22, 0x45, 0x44, 0x45, 
-    0x6A, 0x44, 0xA4, 0x8E, 0x00, 0x4A, 0x44, 0x44, 0x40, 0x80, 0x44, 0x46, 0x44, 0x33, 0x32, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x00, 0x15, 0x66, 0x55, 0x43, 0x33, 0x32, 0x33, 0x33, 0x33, 0x32, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x22, 0x20, 0x00, 0x02, 0x22, 0x22, 0x22, 
-    0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x34, 0x00, 0x00, 0x02, 0x44, 0x44, 0x44, 0x44, 
-    0x04, 0x44, 0x44, 0x44, 0x34, 0x4A, 0x47, 0x74, 0x40, 0x80, 0x00, 0x04, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x44, 0x66, 0x66, 0x66, 0x12, 0x33, 0x33, 0x33, 0x23, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 0x20, 0x24, 0x20, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x44, 0x00, 0x00, 0x00, 0x42, 0x44, 0x46, 0x64, 
-    0x44, 0x04, 0x22, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x32, 0x22, 0x44, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x45, 0x66, 0x66, 0x66, 0x12, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x02, 0x00, 0x24, 0x40, 0x22, 0x22, 0x22, 0x22, 
-    0x20, 0x22, 0x02, 0x22, 0x22, 0x22, 0x20, 0x32, 0x24, 0x00, 0x00, 0x00, 0x42, 0x40, 0x44, 0xAA, 
-    0x64, 0x04, 0x46, 0x64, 0x44, 0x43, 0x33, 0x30, 0x43, 0x33, 0x33, 0x64, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x43, 0x45, 0x66, 0x66, 0x66, 0x13, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 0x00, 0x44, 0x40, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x20, 0x23, 0x02, 0x22, 0x22, 0x02, 0x10, 0x24, 0x00, 0x00, 0x02, 0x44, 0x46, 0x44, 0x44, 
-    0x64, 0x76, 0xA6, 0x64, 0x44, 0x34, 0x33, 0x30, 0x33, 0x23, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x31, 0x33, 0x32, 0x46, 0x66, 0x66, 0x66, 0x66, 0x43, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x02, 0x44, 0x22, 0x22, 0x22, 0x45, 0x22, 
-    0x22, 0x22, 0x30, 0x03, 0x22, 0x22, 0x22, 0x22, 0x33, 0x42, 0x00, 0x02, 0x44, 0x46, 0x44, 0x44, 
-    0x6B, 0x0A, 0xA0, 0x64, 0x33, 0x24, 0x33, 0x30, 0x06, 0x44, 0x42, 0x82, 0x23, 0x33, 0x33, 0x33, 
-    0x33, 0x34, 0x43, 0x80, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x20, 0x00, 0x44, 0x20, 0x22, 0x04, 0x55, 0x30, 
-    0x20, 0x22, 0x33, 0x03, 0x22, 0x22, 0x22, 0x23, 0x34, 0x42, 0x00, 0x02, 0x44, 0x46, 0x47, 0x44, 
-    0x40, 0x44, 0x46, 0x60, 0x04, 0x04, 0x44, 0x43, 0x06, 0x60, 0x44, 0x03, 0x04, 0x44, 0x33, 0x33, 
-    0x33, 0x34, 0x13, 0x21, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x13, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x20, 0x02, 0x44, 0x22, 0x22, 0x21, 0x11, 0x32, 
-    0x20, 0x02, 0x30, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x20, 0xB7, 
-    0x02, 0x33, 0x44, 0x40, 0x46, 0x44, 0x60, 0x64, 0x06, 0xA4, 0x00, 0x00, 0x04, 0x44, 0x33, 0x33, 
-    0x33, 0x44, 0x11, 0x16, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x54, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x22, 0x02, 0x44, 0x22, 0x22, 0x31, 0x11, 0x22, 
-    0x20, 0x22, 0x33, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x4B, 0xB0, 
-    0x00, 0x33, 0x42, 0x00, 0x44, 0x44, 0x04, 0xA4, 0x0A, 0xA0, 0x00, 0x04, 0x44, 0x44, 0x33, 0x33, 
-    0x34, 0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x22, 0x22, 0x42, 0x02, 0x22, 0x23, 0x00, 0x22, 
-    0x20, 0x22, 0x33, 0x44, 0x13, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x02, 0x44, 0x40, 0x40, 0x00, 
-    0x22, 0x33, 0x33, 0x00, 0x00, 0x4A, 0x44, 0xA4, 0x44, 0x44, 0x00, 0x04, 0x44, 0x04, 0x33, 0x43, 
-    0x14, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x15, 0x55, 0x55, 0x11, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22, 0x22, 0x20, 0x02, 0x22, 0x21, 0x51, 0x22, 
-    0x20, 0x02, 0x22, 0x44, 0x44, 0x00, 0x00, 0x44, 0x20, 0x00, 0x00, 0x02, 0x47, 0x46, 0x40, 0x00, 
-    0x04, 0x30, 0x33, 0x00, 0x77, 0x7A, 0x40, 0xA7, 0xA4, 0x44, 0x02, 0x04, 0x44, 0xA4, 0x43, 0x44, 
-    0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x11, 0x13, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x22, 0x20, 0x02, 0x22, 0x31, 0x55, 0x32, 
-    0x20, 0x22, 0x22, 0x34, 0x44, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x47, 0x46, 0x02, 0x03, 
-    0x70, 0x40, 0x24, 0x00, 0x70, 0x7A, 0x40, 0x64, 0x04, 0x40, 0x04, 0x04, 0x44, 0xA4, 0x41, 0x11, 
-    0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x11, 0x11, 0x11, 0x03, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x32, 0x22, 0x00, 0x02, 0x22, 0x15, 0x55, 0x32, 
-    0x20, 0x03, 0x30, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x47, 0x4A, 0x03, 0x0B, 
-    0x40, 0x00, 0x20, 0x00, 0x00, 0x77, 0x70, 0xA4, 0x70, 0x40, 0x04, 0x44, 0x4A, 0x61, 0x15, 0x11, 
-    0x15, 0x15, 0x55, 0x14, 0x44, 0x46, 0x41, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x20, 0x00, 0x00, 0x24, 0x11, 0x15, 0x32, 
-    0x22, 0x03, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x44, 0x82, 0x40, 
-    0x40, 0x00, 0x04, 0x00, 0x00, 0x07, 0xA4, 0x07, 0x40, 0x44, 0x44, 0x41, 0x44, 0x65, 0x11, 0x11, 
-    0x12, 0x21, 0x11, 0x00, 0x0B, 0x46, 0x12, 0x33, 0x30, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x20, 0x00, 0x02, 0x21, 0x11, 0x55, 0x32, 
-    0x22, 0x03, 0x32, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x44, 0x03, 0x00, 
-    0x00, 0x00, 0x44, 0x00, 0x00, 0x04, 0xAA, 0xA4, 0x40, 0x00, 0x74, 0x00, 0x00, 0x33, 0x24, 0x44, 
-    0x30, 0x02, 0x43, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x32, 0x20, 0x00, 0x00, 0x21, 0x55, 0x55, 0x42, 
-    0x22, 0x22, 0x33, 0x44, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x24, 0x04, 0x00, 
-    0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x00, 0x02, 0x20, 0x04, 0x04, 0x23, 0x34, 
-    0x42, 0x02, 0x22, 0x80, 0x00, 0x04, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x20, 0x02, 0x33, 0x41, 0x55, 0x55, 0x12, 
-    0x22, 0x22, 0x24, 0x44, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x70, 0x02, 0x04, 0x00, 
-    0x00, 0x00, 0x44, 0x00, 0x00, 0x0B, 0x64, 0x40, 0x00, 0x00, 0x23, 0x33, 0x34, 0x04, 0x24, 0x20, 
-    0x00, 0x88, 0x88, 0x80, 0x44, 0x4A, 0x13, 0x33, 0x34, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x12, 0x21, 0x55, 0x55, 0x11, 0x55, 0x12, 
-    0x22, 0x02, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x04, 0x00, 
-    0x00, 0x00, 0x4A, 0x47, 0x00, 0x04, 0x4A, 0x00, 0x00, 0x00, 0x02, 0x44, 0x33, 0x00, 0x00, 0x00, 
-    0x88, 0x80, 0x00, 0x80, 0x44, 0x46, 0x65, 0x11, 0x66, 0x65, 0x11, 0x33, 0x43, 0x41, 0x11, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x15, 0x11, 0x11, 0x15, 0x55, 0x13, 
-    0x20, 0x22, 0x22, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
-    0x8E, 0x00, 0x44, 0x44, 0x00, 0x04, 0x4A, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x08, 0x00, 0x00, 
-    0x80, 0x00, 0x00, 0x80, 0x4B, 0x46, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x55, 0x13, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x44, 0x00, 0x00, 0x04, 0x08, 
-    0x8E, 0x00, 0x44, 0x44, 0x00, 0x0B, 0x4A, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x80, 0x4B, 0x4A, 0x44, 0x11, 0x44, 0x11, 0x16, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x15, 0x55, 0x55, 0x12, 
-    0x22, 0x20, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x04, 0x00, 0x00, 0x04, 0x08, 
-    0xEE, 0x00, 0x47, 0x40, 0x00, 0x00, 0xAA, 0x07, 0x40, 0x80, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 
-    0x88, 0x00, 0x00, 0x00, 0x44, 0x46, 0x61, 0x11, 0x11, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x55, 0x55, 0x55, 0x13, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x00, 0x00, 0x24, 0x08, 
-    0xEE, 0x00, 0x40, 0x04, 0xB0, 0x00, 0xAA, 0x07, 0x4B, 0x04, 0x44, 0xA6, 0x66, 0x48, 0x80, 0x08, 
-    0x00, 0x80, 0x05, 0x30, 0x44, 0x46, 0x61, 0x11, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 
-    0x32, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x34, 0x77, 0x00, 0x00, 0x04, 0x08, 
-    0xEE, 0x00, 0x40, 0x07, 0x00, 0x00, 0x44, 0x47, 0x44, 0x04, 0x44, 0x44, 0xA0, 0x40, 0x28, 0x08, 
-    0x32, 0x88, 0x05, 0x40, 0xB4, 0x4A, 0xA1, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x43, 
-    0x43, 0x30, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x04, 0x08, 
-    0xEE, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x77, 0x74, 0x04, 0x44, 0xB0, 0x00, 0x44, 0x48, 0x80, 
-    0x32, 0x80, 0x21, 0x20, 0xBB, 0x4A, 0xA6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 
-    0x43, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x08, 
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x44, 0x40, 0x00, 0x44, 0x40, 0x00, 
-    0x32, 0x80, 0x44, 0x20, 0x00, 0x4A, 0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x11, 0x11, 0x55, 0x15, 0x55, 0x55, 0x55, 0x13, 
-    0x34, 0x02, 0x33, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x74, 0x70, 0x00, 0x00, 0x07, 0x70, 
-    0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x44, 0x44, 0xAA, 0x44, 0x40, 0x00, 
-    0x43, 0x80, 0x45, 0x30, 0x70, 0x70, 0x06, 0x66, 0x66, 0x66, 0x65, 0x55, 0x56, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x55, 0x11, 0x55, 0x51, 0x55, 0x55, 0x51, 0x43, 
-    0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x70, 0x00, 0x00, 0xB0, 0x04, 0x47, 
-    0x70, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x77, 0xB0, 0x00, 0x74, 0x44, 0x44, 0x07, 0x40, 0x00, 
-    0x14, 0x80, 0x45, 0x40, 0x00, 0x74, 0x46, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x51, 0x11, 0x55, 0x55, 0x55, 0x55, 0x51, 0x30, 
-    0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x77, 0x77, 
-    0x07, 0x70, 0x07, 0x7B, 0xB0, 0x00, 0xE0, 0x44, 0x77, 0x77, 0x44, 0x40, 0x00, 0x07, 0x70, 0x00, 
-    0x43, 0x00, 0x46, 0x48, 0x00, 0xB4, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 
-    0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x51, 0x51, 0x11, 0x11, 0x55, 0x55, 0x55, 0x55, 0x56, 0x40, 
-    0x00, 0x02, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x77, 0x70, 
-    0x80, 0x00, 0x07, 0x77, 0x0B, 0x70, 0x00, 0x44, 0x77, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x46, 0x4E, 0x00, 0x04, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x51, 0x15, 0x15, 0x55, 0x15, 0x55, 0x55, 0x56, 0x61, 
-    0x20, 0x04, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 
-    0x00, 0x00, 0x00, 0x77, 0xB0, 0xB0, 0xE8, 0x74, 0x47, 0xB0, 0x00, 0x00, 0x00, 0x07, 0x70, 0x08, 
-    0x00, 0x00, 0x41, 0x48, 0x00, 0xB4, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x55, 0x11, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 
-    0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0x77, 0x77, 0x00, 0x47, 0x7B, 0x00, 0xEE, 0x04, 0x74, 0x70, 0x00, 0x00, 0x00, 0x44, 0x40, 0x88, 
-    0x88, 0x00, 0x45, 0x48, 0x00, 0x74, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x66, 
-    0x11, 0x51, 0x51, 0x11, 0x11, 0x55, 0x15, 0x55, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 
-    0x34, 0x43, 0x33, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x77, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x44, 0x77, 0x00, 0xEE, 0x04, 0x77, 0xB0, 0x00, 0x00, 0x0B, 0x77, 0x70, 0xE8, 
-    0x88, 0x08, 0x46, 0x48, 0x00, 0x44, 0x46, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x66, 
-    0x11, 0x11, 0x11, 0x11, 0x55, 0x55, 0x15, 0x51, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 
-    0x34, 0x33, 0x33, 0x34, 0x20, 0x00, 0x00, 0x0B, 0x44, 0x77, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0B, 0x74, 0x47, 0x70, 0xEE, 0x07, 0x77, 0x70, 0x00, 0x00, 0x77, 0x74, 0x40, 0x88, 
-    0x08, 0x08, 0x46, 0x48, 0x00, 0x44, 0x46, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 
-    0x11, 0x55, 0x11, 0x11, 0x55, 0x51, 0x15, 0x15, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x38, 
-    0x03, 0x33, 0x33, 0x33, 0x32, 0x00, 0x00, 0x00, 0x44, 0x77, 0x77, 0x70, 0x08, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0x77, 0x47, 0x40, 0x00, 0x0B, 0xB7, 0xB0, 0x00, 0x0B, 0x77, 0x77, 0x70, 0x88, 
-    0x88, 0x08, 0x46, 0x3E, 0x00, 0x44, 0x46, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-    0x11, 0x55, 0x51, 0x11, 0x11, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x54, 0x08, 
-    0x03, 0x23, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x74, 0x77, 0x77, 0x70, 0x80, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x07, 0x77, 0x77, 0x47, 0x00, 0x0B, 0x74, 0xB0, 0x00, 0x0B, 0x77, 0x74, 0x70, 0x88, 
-    0x88, 0x00, 0x46, 0x2E, 0x00, 0x74, 0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x55, 0x55, 
-    0x55, 0x51, 0x55, 0x51, 0x11, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x88, 
-    0x23, 0x33, 0x23, 0x23, 0x43, 0x38, 0x00, 0x00, 0x04, 0x47, 0x77, 0xB0, 0x88, 0xE8, 0x00, 0x00, 
-    0x00, 0x00, 0xE7, 0x77, 0x77, 0x74, 0xB0, 0xB7, 0x77, 0x00, 0x0B, 0xBB, 0x77, 0x77, 0x70, 0x88, 
-    0x88, 0x00, 0x46, 0x4E, 0x08, 0x07, 0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x51, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x08, 
-    0x03, 0x33, 0x32, 0x23, 0x33, 0x30, 0x00, 0x00, 0x07, 0x47, 0x77, 0x00, 0x88, 0xE8, 0xEE, 0x00, 
-    0x00, 0x00, 0x00, 0x47, 0x77, 0x44, 0x44, 0xBB, 0x77, 0x08, 0x0B, 0xBB, 0x77, 0x77, 0x70, 0x88, 
-    0x88, 0x00, 0x25, 0x1E, 0x80, 0x00, 0xB6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x55, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 
-    0x34, 0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x0B, 0x77, 0x77, 0x00, 0x08, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0x00, 0x47, 0x74, 0x44, 0x44, 0x77, 0x77, 0x0E, 0x0B, 0xBB, 0x77, 0x77, 0x40, 0x88, 
-    0x88, 0x80, 0x35, 0x10, 0x80, 0x0E, 0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 
-    0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x30, 0x04, 
-    0x44, 0x0A, 0xAA, 0xA4, 0xA6, 0xA0, 0xE0, 0x80, 0x00, 0x77, 0x7B, 0x0E, 0x00, 0xEE, 0xEE, 0x00, 
-    0x00, 0x00, 0xB0, 0xB4, 0x44, 0x47, 0x44, 0x44, 0x47, 0x0E, 0x00, 0xBB, 0x77, 0x77, 0x70, 0x80, 
-    0x88, 0x00, 0x46, 0x52, 0x00, 0x00, 0x40, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x12, 0x00, 0x00, 
-    0x00, 0x04, 0x44, 0x40, 0x44, 0x4A, 0x40, 0x00, 0x00, 0xBB, 0xB7, 0x08, 0x00, 0x8E, 0xEE, 0x00, 
-    0x00, 0x00, 0xBB, 0x07, 0x44, 0x47, 0x44, 0x77, 0x47, 0x0E, 0x80, 0x07, 0x77, 0x77, 0x0E, 0x00, 
-    0x08, 0x02, 0x16, 0x51, 0x12, 0x00, 0x45, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x00, 
-    0x04, 0x08, 0x88, 0x00, 0x40, 0x04, 0x40, 0x00, 0x00, 0xB7, 0xB7, 0x00, 0x00, 0x8E, 0x8E, 0xE0, 
-    0x00, 0x00, 0x0B, 0xB7, 0x44, 0x47, 0x44, 0x77, 0x44, 0x08, 0x00, 0x07, 0x77, 0x77, 0x08, 0x88, 
-    0x08, 0x34, 0x16, 0x61, 0x14, 0x00, 0x46, 0x55, 0x55, 0x55, 0x66, 0x66, 0x65, 0x55, 0x66, 0x66, 
+const uint8_t STORY_CH7_RLE[STORY_CH7_RLE_SIZE] = {
+    0xF1, 0x04, 0x03, 0x66, 0x55, 0xB1, 0x01, 0x55, 0xF6, 0x0C, 0x09, 0x13, 0x44, 0x43, 0x24, 0x65, 
+    0xA2, 0x04, 0x16, 0x44, 0x40, 0xA0, 0x16, 0x46, 0x64, 0x44, 0x00, 0x44, 0x23, 0x41, 0x65, 0x11, 
+    0x10, 0x33, 0x00, 0xD1, 0x13, 0x00, 0x10, 0x28, 0x0E, 0xE8, 0xEE, 0xE0, 0xB7, 0x47, 0x73, 0xF2, 
+    0x01, 0xF1, 0x05, 0x06, 0x56, 0x66, 0x55, 0x50, 0xF6, 0x0F, 0x00, 0x10, 0xA4, 0x08, 0x32, 0x24, 
+    0x42, 0x22, 0x00, 0x4C, 0x06, 0x0A, 0xA4, 0x42, 0x40, 0xD1, 0x09, 0x03, 0x32, 0x23, 0x00, 0x33, 
+    0xC2, 0x01, 0x88, 0x44, 0x01, 0xE0, 0xA7, 0x57, 0x01, 0x11, 0xF6, 0x14, 0x04, 0x51, 0x14, 0x30, 
+    0xE2, 0x43, 0x00, 0x20, 0x44, 0x0E, 0xA4, 0xAA, 0xA4, 0x44, 0x23, 0x33, 0x03, 0x00, 0xB3, 0xF2, 
+    0x04, 0x02, 0x08, 0xE0, 0xA8, 0x06, 0x0E, 0x07, 0xB7, 0x70, 0xF2, 0x02, 0xF1, 0x0D, 0x02, 0x55, 
+    0x50, 0xF6, 0x0C, 0x00, 0x50, 0x4E, 0xA0, 0x06, 0x84, 0x60, 0x4A, 0x60, 0xA4, 0x00, 0x00, 0xA3, 
+    0x03, 0x23, 0x33, 0xF2, 0x07, 0x0D, 0x88, 0xE8, 0x08, 0xE0, 0x0E, 0x0B, 0xB0, 0x5F, 0xA1, 0x01, 
+    0x55, 0xF6, 0x09, 0x01, 0x14, 0x4A, 0x00, 0x10, 0x47, 0x03, 0xA4, 0x60, 0x43, 0x01, 0x23, 0xB2, 
+    0x4A, 0x05, 0x33, 0x22, 0x20, 0xA8, 0x07, 0xE0, 0xBB, 0x00, 0xB0, 0x64, 0x03, 0x11, 0x15, 0xF6, 
+    0x07, 0x00, 0x40, 0x52, 0x0C, 0x04, 0x66, 0x46, 0xA4, 0x44, 0x30, 0x30, 0xF2, 0x0E, 0x02, 0x30, 
+    0xE0, 0x43, 0x04, 0x00, 0x0B, 0x70, 0xF2, 0x03, 0xF1, 0x15, 0x00, 0x50, 0xF6, 0x05, 0x03, 0x54, 
+    0x43, 0xF2, 0x00, 0x05, 0x01, 0x64, 0x43, 0x46, 0xAA, 0x04, 0x40, 0x04, 0x30, 0xA2, 0x00, 0x30, 
+    0xA2, 0x02, 0x32, 0x30, 0xF2, 0x03, 0x0A, 0xE8, 0x0E, 0x00, 0x0E, 0xE0, 0x00, 0x69, 0x00, 0x50, 
+    0xF6, 0x01, 0x05, 0x55, 0x51, 0x43, 0x51, 0x00, 0x80, 0x4E, 0x03, 0x43, 0x23, 0x45, 0x01, 0x33, 
+    0xC2, 0x05, 0x32, 0x80, 0x08, 0xA0, 0x03, 0xE0, 0x03, 0x69, 0x01, 0x51, 0xE5, 0x04, 0x15, 0x51, 
+    0x30, 0xE2, 0x00, 0x00, 0x45, 0x00, 0x20, 0xA0, 0x04, 0x36, 0xA4, 0x00, 0x42, 0x00, 0x20, 0x44, 
+    0x09, 0x33, 0x32, 0x24, 0x32, 0x33, 0xB2, 0x00, 0x30, 0x46, 0xC0, 0x01, 0xE2, 0x68, 0xF1, 0x03, 
+    0x03, 0x51, 0x51, 0xF2, 0x00, 0x03, 0x00, 0x22, 0x42, 0x00, 0x30, 0x47, 0x0B, 0x0A, 0xA4, 0x34, 
+    0x44, 0x33, 0x24, 0x42, 0x01, 0x23, 0xA2, 0x02, 0x32, 0x30, 0x43, 0x0B, 0x22, 0x88, 0x8E, 0x80, 
+    0x00, 0x88, 0xF2, 0x04, 0xF1, 0x1F, 0x02, 0x51, 0x10, 0x52, 0x00, 0x40, 0x44, 0x06, 0x64, 0xAA, 
+    0xA4, 0x20, 0x42, 0xC4, 0x0A, 0x30, 0x44, 0x33, 0x32, 0x23, 0x20, 0x45, 0x00, 0x00, 0xE8, 0x01, 
+    0x23, 0x70, 0x07, 0x51, 0x15, 0x51, 0x53, 0x4A, 0x00, 0x00, 0x42, 0x00, 0x20, 0xA0, 0x00, 0x40, 
+    0x42, 0x00, 0x60, 0xB0, 0x01, 0xBB, 0xF4, 0x04, 0x02, 0x33, 0x30, 0xA2, 0x04, 0x33, 0x22, 0x30, 
+    0xB0, 0x06, 0x80, 0x22, 0x23, 0x30, 0x6E, 0xA1, 0x49, 0xA0, 0x42, 0x02, 0x33, 0x30, 0x46, 0x03, 
+    0x64, 0x08, 0xE0, 0x02, 0x44, 0x00, 0xB4, 0x03, 0x04, 0x42, 0x42, 0x03, 0x33, 0x23, 0xA2, 0x08, 
+    0x88, 0x00, 0x23, 0x22, 0x20, 0x70, 0x03, 0x55, 0x11, 0x47, 0xB0, 0x42, 0x02, 0x04, 0x20, 0xA0, 
+    0x06, 0x36, 0x64, 0x43, 0xE0, 0xA0, 0x02, 0x24, 0x30, 0xA0, 0x0F, 0x44, 0x4B, 0x00, 0xAA, 0x42, 
+    0x33, 0x23, 0x22, 0x43, 0x05, 0x32, 0x00, 0x23, 0xC2, 0x00, 0x30, 0x6D, 0xB1, 0x49, 0x00, 0x20, 
+    0x43, 0x00, 0x40, 0x49, 0x13, 0x08, 0x02, 0x44, 0x4A, 0xAA, 0x40, 0x40, 0x04, 0x44, 0x04, 0x43, 
+    0x0D, 0x32, 0x23, 0x22, 0x33, 0x32, 0x32, 0x23, 0x44, 0x03, 0x32, 0x23, 0x7B, 0x00, 0x00, 0x43, 
+    0x00, 0x00, 0x44, 0x0D, 0x46, 0xA4, 0x60, 0x80, 0x04, 0x44, 0x04, 0x42, 0x0A, 0x22, 0x04, 0x42, 
+    0x04, 0x42, 0x30, 0xA2, 0x08, 0x33, 0x22, 0x23, 0x33, 0x20, 0xA3, 0x02, 0x22, 0x30, 0xA2, 0x01, 
+    0x33, 0x76, 0xC0, 0x03, 0x20, 0x14, 0x47, 0x02, 0x64, 0x00, 0x43, 0x00, 0xA0, 0x43, 0x00, 0x40, 
+    0x42, 0x02, 0x74, 0x30, 0x43, 0xC3, 0x44, 0x03, 0x33, 0x32, 0xB3, 0x03, 0x22, 0x32, 0x58, 0x02, 
+    0x33, 0x30, 0xF1, 0x0D, 0x43, 0xD0, 0x4D, 0x00, 0x40, 0xA0, 0xB4, 0x02, 0xA4, 0x00, 0x45, 0x00, 
+    0x20, 0x42, 0x00, 0x20, 0xA3, 0x01, 0x22, 0xC3, 0x01, 0x22, 0x43, 0xC2, 0x01, 0x33, 0x55, 0x02, 
+    0x13, 0x40, 0x59, 0x00, 0x20, 0x48, 0x0B, 0x34, 0x30, 0x00, 0x83, 0x66, 0x4A, 0xC0, 0xD4, 0x03, 
+    0x32, 0x00, 0x44, 0x00, 0x20, 0xB3, 0x00, 0x20, 0xC3, 0x02, 0x23, 0x30, 0x42, 0x07, 0x23, 0x32, 
+    0x32, 0x22, 0x58, 0x00, 0x30, 0x59, 0xE0, 0x05, 0x24, 0x04, 0x42, 0xA0, 0x48, 0xE4, 0x03, 0x32, 
+    0x02, 0x44, 0xB3, 0x04, 0x22, 0x33, 0x20, 0x44, 0x01, 0x32, 0xA3, 0x01, 0x23, 0x42, 0xA2, 0xF1, 
+    0x0B, 0xA3, 0xF1, 0x08, 0x03, 0x31, 0x11, 0xB2, 0xD0, 0x01, 0x20, 0x42, 0x00, 0x30, 0x44, 0x00, 
+    0x40, 0x43, 0x03, 0x24, 0x00, 0xAA, 0x43, 0x04, 0x04, 0x32, 0xB0, 0x45, 0xF3, 0x06, 0x0A, 0x22, 
+    0x33, 0x23, 0x33, 0x23, 0x30, 0x54, 0x04, 0x43, 0x33, 0x40, 0x50, 0x00, 0x30, 0xD2, 0x45, 0x04, 
+    0x13, 0x44, 0x40, 0xB0, 0x03, 0x34, 0x44, 0xA0, 0x03, 0x74, 0x40, 0x4A, 0x00, 0x00, 0x44, 0x00, 
+    0x20, 0xD3, 0x00, 0x20, 0xC3, 0xA2, 0x00, 0x30, 0xC2, 0x52, 0x08, 0x33, 0x22, 0x02, 0x22, 0x30, 
+    0xF1, 0x03, 0x02, 0x51, 0x20, 0x4D, 0x06, 0x00, 0x42, 0x34, 0x20, 0xB0, 0x00, 0x20, 0x42, 0x05, 
+    0x80, 0x04, 0x40, 0xAA, 0x03, 0x44, 0x33, 0x4A, 0xF3, 0x0A, 0xD2, 0x01, 0x33, 0xF1, 0x09, 0xA0, 
+    0x04, 0x22, 0x00, 0x00, 0xF1, 0x05, 0x02, 0x21, 0x10, 0xD2, 0x06, 0x02, 0x20, 0x00, 0x20, 0xA0, 
+    0x01, 0x44, 0xA0, 0x01, 0x20, 0x42, 0x0D, 0x00, 0xB0, 0x40, 0x06, 0x6A, 0x44, 0x22, 0x43, 0x01, 
+    0xB4, 0xA3, 0x04, 0x20, 0x23, 0x30, 0xE2, 0x00, 0x30, 0xE2, 0x00, 0x30, 0xB2, 0x46, 0x0A, 0x50, 
+    0xF9, 0x94, 0x01, 0x10, 0xF0, 0xA9, 0x23, 0x33, 0x42, 0x02, 0xC9, 0x9D, 0x01, 0x11, 0x51, 0xF9, 
+    0x9B, 0x00, 0x20, 0xFD, 0x02, 0x20, 0x0F, 0xB0, 0x0C, 0xC9, 0x0A, 0x43, 0x00, 0x40, 0x46, 0x4C, 
+    0xF0, 0xB9, 0x18, 0xB5, 0x00, 0x0F, 0x99, 0xB3, 0x43, 0x0F, 0xD0, 0x23, 0x30, 0xFB, 0x02, 0xC0, 
+    0xC9, 0x03, 0x40, 0x0C, 0xA9, 0x08, 0x40, 0x22, 0x23, 0x32, 0x20, 0xD1, 0x06, 0x00, 0xDD, 0xD0, 
+    0x40, 0x42, 0x1F, 0x0B, 0xDD, 0x40, 0x44, 0x00, 0x0D, 0xDD, 0x41, 0x11, 0x00, 0x0D, 0xD0, 0x42, 
+    0x20, 0xF0, 0x20, 0x47, 0xBD, 0x00, 0x30, 0x42, 0x0B, 0x4A, 0xA4, 0x0D, 0xDF, 0x9D, 0xD4, 0x42, 
+    0x04, 0xDD, 0xD0, 0x00, 0x42, 0x03, 0x00, 0x22, 0x46, 0x0F, 0xDB, 0xDD, 0xD3, 0x30, 0xC9, 0xDD, 
+    0xD0, 0x03, 0x43, 0x00, 0x30, 0xD1, 0x2B, 0xC9, 0x05, 0x1C, 0x93, 0x00, 0xFD, 0x03, 0x0F, 0x00, 
+    0x3C, 0x94, 0x05, 0x09, 0xB0, 0x0C, 0x90, 0x53, 0xC9, 0x33, 0x0F, 0x99, 0xB0, 0x46, 0x01, 0x38, 
+    0xD0, 0x16, 0x34, 0xA4, 0x60, 0x31, 0xC9, 0x04, 0x6A, 0x0C, 0x93, 0x03, 0xC9, 0x30, 0x43, 0x01, 
+    0x33, 0x46, 0x01, 0x30, 0xB3, 0x0D, 0x0C, 0x00, 0x30, 0xC9, 0x03, 0x22, 0x23, 0x49, 0x00, 0x10, 
+    0x47, 0x03, 0x40, 0xFD, 0x44, 0x15, 0x10, 0x01, 0x30, 0xC9, 0x31, 0x0C, 0x93, 0x00, 0xF0, 0x30, 
+    0xD3, 0x46, 0x01, 0x20, 0xA4, 0x01, 0x00, 0xA4, 0xA0, 0x0B, 0xC9, 0x00, 0x44, 0x4C, 0x93, 0x34, 
+    0x46, 0x01, 0x0F, 0x48, 0x02, 0x22, 0x20, 0x44, 0x00, 0x20, 0x45, 0x01, 0x32, 0x48, 0xB9, 0x0A, 
+    0x33, 0x0F, 0x9F, 0xF9, 0x33, 0x40, 0x44, 0x05, 0x34, 0x32, 0x2C, 0xC9, 0x43, 0x02, 0x0C, 0x90, 
+    0x46, 0x09, 0x9F, 0x9D, 0x56, 0x64, 0x46, 0xA4, 0x0E, 0x04, 0x4F, 0x90, 0x44, 0x42, 0xC9, 0x34, 
+    0x10, 0x46, 0x01, 0xC9, 0x46, 0x0E, 0x9F, 0x9B, 0x02, 0x30, 0xC9, 0xFF, 0x94, 0x00, 0xA3, 0x01, 
+    0x23, 0x48, 0x03, 0xDD, 0xDF, 0x44, 0x04, 0xDD, 0xD4, 0x00, 0x43, 0x08, 0x30, 0x33, 0x00, 0x2C, 
+    0x90, 0xAD, 0x44, 0x06, 0x30, 0x2C, 0x99, 0xD0, 0x42, 0x0A, 0xDD, 0xDB, 0x00, 0xA4, 0x4A, 0x00, 
+    0xB4, 0x07, 0x0F, 0x93, 0x44, 0xA0, 0x42, 0x00, 0x40, 0x50, 0x02, 0xDD, 0xD0, 0x45, 0x05, 0xDD, 
+    0xD4, 0x32, 0x42, 0x00, 0x20, 0x48, 0x0D, 0x05, 0x1C, 0x93, 0x80, 0xFD, 0x00, 0x0F, 0xA0, 0x0E, 
+    0x94, 0x00, 0x0F, 0xB2, 0x2C, 0x93, 0x02, 0xC0, 0x46, 0x20, 0x00, 0xD9, 0xD0, 0x2C, 0x93, 0x34, 
+    0x30, 0xA4, 0x44, 0xA4, 0x00, 0x04, 0x40, 0xC9, 0x37, 0x77, 0x20, 0x4B, 0x04, 0x00, 0x0C, 0x90, 
+    0x43, 0x01, 0x30, 0xB3, 0x08, 0x0C, 0x00, 0x30, 0xC9, 0x00, 0x4E, 0x00, 0x10, 0x46, 0x00, 0x30, 
+    0x4A, 0x02, 0x97, 0x00, 0x42, 0x00, 0x20, 0x47, 0x05, 0x24, 0x40, 0xFB, 0x43, 0x03, 0x14, 0x44, 
+    0x42, 0x00, 0x40, 0x42, 0x00, 0x00, 0x42, 0x04, 0x04, 0x40, 0x00, 0x42, 0x00, 0x60, 0x44, 0x05, 
+    0x99, 0x70, 0xF9, 0x46, 0x02, 0x22, 0x20, 0x4A, 0x03, 0x23, 0x23, 0x52, 0x00, 0x00, 0x44, 0x08, 
+    0x22, 0xC9, 0xFD, 0x32, 0x20, 0x4C, 0x05, 0x04, 0x30, 0xFD, 0x42, 0x09, 0x9F, 0xFF, 0x94, 0x54, 
+    0x4A, 0x48, 0x0A, 0x04, 0x08, 0x00, 0xF9, 0xFB, 0x30, 0x42, 0x07, 0x03, 0x33, 0x20, 0x9D, 0x42, 
+    0xAF, 0x05, 0x94, 0x30, 0xC9, 0x45, 0xB3, 0xD1, 0x10, 0x0D, 0x01, 0x10, 0xD3, 0x02, 0xFB, 0x30, 
+    0x2F, 0xD0, 0x43, 0x1C, 0x0D, 0xD0, 0x00, 0x2C, 0x03, 0x22, 0x09, 0x32, 0x2F, 0xD0, 0x02, 0x00, 
+    0xFB, 0x32, 0xC0, 0xCD, 0x01, 0x30, 0x48, 0x03, 0x0D, 0x04, 0x44, 0x13, 0x09, 0x40, 0x23, 0x0F, 
+    0xD0, 0x23, 0x30, 0xFB, 0x02, 0x09, 0xBD, 0x04, 0x33, 0x2C, 0xD0, 0x42, 0x00, 0xD0, 0x43, 0x00, 
+    0x20, 0x46, 0xD1, 0x09, 0x20, 0x02, 0x34, 0x00, 0x03, 0xF2, 0x02, 0x01, 0x00, 0xF2, 0x02, 0x01, 
+    0x33, 0xC0, 0x09, 0x22, 0x45, 0x44, 0x45, 0x6A, 0x42, 0x05, 0x8E, 0x00, 0x4A, 0xB4, 0x0C, 0x08, 
+    0x04, 0x44, 0x64, 0x43, 0x33, 0x20, 0xF3, 0x01, 0x08, 0x00, 0x15, 0x66, 0x55, 0x40, 0xA3, 0x00, 
+    0x20, 0xD3, 0x01, 0x23, 0x4D, 0xA0, 0x02, 0x22, 0x20, 0xA0, 0xE2, 0x00, 0x00, 0xF2, 0x04, 0x02, 
+    0x03, 0x40, 0xB0, 0x00, 0x20, 0xE4, 0x00, 0x00, 0xD4, 0x06, 0x34, 0x4A, 0x47, 0x70, 0x43, 0x03, 
+    0x00, 0x04, 0xF3, 0x07, 0x01, 0x44, 0xC6, 0x01, 0x12, 0xC3, 0x00, 0x20, 0xD3, 0xF1, 0x05, 0x00, 
+    0x20, 0x42, 0x04, 0x02, 0x42, 0x00, 0xF2, 0x02, 0x00, 0x00, 0xF2, 0x00, 0x03, 0x00, 0x24, 0x44, 
+    0x0E, 0x04, 0x24, 0x44, 0x66, 0x44, 0x40, 0x42, 0x20, 0xF4, 0x02, 0x05, 0x23, 0x22, 0x24, 0x50, 
+    0x00, 0x50, 0x4C, 0xE3, 0x4F, 0x05, 0x20, 0x02, 0x44, 0x48, 0x03, 0x02, 0x20, 0x47, 0x02, 0x32, 
+    0x20, 0x48, 0x0B, 0x04, 0x4A, 0xA6, 0x40, 0x44, 0x66, 0xA4, 0xA3, 0x01, 0x04, 0xB3, 0x00, 0x60, 
+    0x4D, 0x00, 0x40, 0x48, 0x01, 0x32, 0x5C, 0x03, 0x00, 0x04, 0x4A, 0x05, 0x22, 0x02, 0x30, 0xB2, 
+    0x03, 0x02, 0x10, 0x45, 0x04, 0x24, 0x44, 0x60, 0xA4, 0x04, 0x64, 0x76, 0xA0, 0x43, 0x01, 0x34, 
+    0x42, 0x02, 0x33, 0x20, 0xA3, 0x00, 0x20, 0xF3, 0x02, 0x05, 0x13, 0x33, 0x24, 0xF6, 0x00, 0x02, 
+    0x43, 0x20, 0x57, 0x00, 0x30, 0xA0, 0x02, 0x24, 0x40, 0xC2, 0x01, 0x45, 0xC2, 0x03, 0x30, 0x03, 
+    0xE2, 0x03, 0x33, 0x42, 0x4B, 0x09, 0xB0, 0xAA, 0x06, 0x43, 0x32, 0x43, 0x08, 0x06, 0x44, 0x42, 
+    0x82, 0x20, 0xF3, 0x01, 0x05, 0x44, 0x38, 0x03, 0xF6, 0x02, 0x02, 0x11, 0x10, 0x55, 0x17, 0x12, 
+    0x20, 0x00, 0x44, 0x20, 0x22, 0x04, 0x55, 0x30, 0x20, 0x22, 0x33, 0x47, 0x02, 0x33, 0x40, 0x49, 
+    0x0D, 0x74, 0x44, 0x04, 0x44, 0x66, 0x00, 0x40, 0xA4, 0x0C, 0x30, 0x66, 0x04, 0x40, 0x30, 0x44, 
+    0x40, 0x46, 0x03, 0x13, 0x21, 0xF6, 0x04, 0x00, 0x50, 0x5B, 0x02, 0x24, 0x40, 0xB2, 0x0E, 0x11, 
+    0x13, 0x22, 0x00, 0x23, 0x00, 0x20, 0x20, 0xF0, 0x07, 0x19, 0x24, 0x20, 0xB7, 0x02, 0x33, 0x44, 
+    0x40, 0x46, 0x44, 0x60, 0x64, 0x06, 0xA4, 0xB0, 0x47, 0x08, 0x44, 0x11, 0x16, 0x55, 0x50, 0xF6, 
+    0x02, 0x01, 0x54, 0x55, 0x02, 0x32, 0x20, 0x46, 0x0E, 0x31, 0x11, 0x22, 0x20, 0x22, 0x33, 0x44, 
+    0x20, 0xF0, 0x08, 0x0D, 0x46, 0x4B, 0xB0, 0x00, 0x33, 0x42, 0x00, 0xA4, 0x06, 0x04, 0xA4, 0x0A, 
+    0xA0, 0xA0, 0xB4, 0xB3, 0x03, 0x41, 0x11, 0xF5, 0x09, 0x00, 0x10, 0x58, 0x04, 0x22, 0x42, 0x00, 
+    0xA2, 0x02, 0x30, 0x00, 0x48, 0x01, 0x13, 0xA0, 0x02, 0x20, 0x20, 0xC0, 0x0A, 0x24, 0x44, 0x04, 
+    0x00, 0x02, 0x20, 0xA3, 0xA0, 0x04, 0x4A, 0x44, 0xA0, 0xB4, 0x44, 0x08, 0x04, 0x33, 0x43, 0x14, 
+    0x10, 0xF5, 0x04, 0x02, 0x11, 0x10, 0xB5, 0x01, 0x11, 0x53, 0x00, 0x40, 0xB2, 0x00, 0x00, 0x43, 
+    0x02, 0x15, 0x10, 0x42, 0x03, 0x02, 0x22, 0xA4, 0xA0, 0x01, 0x44, 0x47, 0x02, 0x74, 0x60, 0x42, 
+    0x03, 0x04, 0x30, 0x42, 0x08, 0x77, 0x7A, 0x40, 0xA7, 0xA0, 0x42, 0x00, 0x20, 0x42, 0x07, 0xA4, 
+    0x43, 0x44, 0x11, 0x4C, 0x01, 0x55, 0x42, 0x02, 0x11, 0x10, 0xD3, 0xF1, 0x07, 0x01, 0x33, 0x46, 
+    0x07, 0x31, 0x55, 0x32, 0x20, 0xA2, 0x00, 0x30, 0x46, 0xE0, 0x43, 0x0D, 0x02, 0x03, 0x70, 0x40, 
+    0x24, 0x00, 0x70, 0x42, 0x07, 0x64, 0x04, 0x40, 0x04, 0x45, 0xC1, 0xF5, 0x02, 0xE1, 0x00, 0x00, 
+    0xF3, 0x00, 0x4F, 0x03, 0x22, 0x20, 0x43, 0x01, 0x15, 0x44, 0x06, 0x03, 0x30, 0x24, 0x40, 0xF0, 
+    0x05, 0x42, 0x09, 0xA0, 0x30, 0xB4, 0x00, 0x02, 0xB0, 0x07, 0x77, 0x70, 0xA4, 0x70, 0x42, 0x0B, 
+    0x44, 0x4A, 0x61, 0x15, 0x11, 0x15, 0x42, 0x00, 0x10, 0xA4, 0x02, 0x64, 0x10, 0xF3, 0x09, 0xF1, 
+    0x07, 0x02, 0x22, 0x20, 0xB0, 0x04, 0x24, 0x11, 0x10, 0x42, 0x06, 0x20, 0x34, 0x44, 0x30, 0xF0, 
+    0x06, 0x00, 0x20, 0xA4, 0x03, 0x82, 0x40, 0x42, 0x01, 0x04, 0xB0, 0x06, 0x7A, 0x40, 0x74, 0x00, 
+    0xB4, 0x04, 0x14, 0x46, 0x50, 0xB1, 0x11, 0x22, 0x11, 0x10, 0x00, 0xB4, 0x61, 0x23, 0x33, 0x00, 
+    0x62, 0x05, 0x22, 0x11, 0x15, 0x45, 0x04, 0x32, 0x34, 0x40, 0xF0, 0x06, 0x05, 0x70, 0x44, 0x03, 
+    0xC0, 0x00, 0x40, 0x44, 0x0A, 0x4A, 0xAA, 0x44, 0x00, 0x07, 0x40, 0xA0, 0x0B, 0x33, 0x24, 0x44, 
+    0x30, 0x02, 0x43, 0xB0, 0xF3, 0x0C, 0xF1, 0x07, 0x00, 0x30, 0x44, 0x02, 0x02, 0x10, 0xA5, 0x00, 
+    0x40, 0xB2, 0x03, 0x33, 0x44, 0xC0, 0x00, 0x70, 0x49, 0x03, 0x24, 0x04, 0x4B, 0x00, 0x00, 0xC4, 
+    0x14, 0x00, 0x02, 0x20, 0x04, 0x04, 0x23, 0x34, 0x42, 0x02, 0x22, 0x80, 0xA0, 0x01, 0x44, 0x61, 
+    0x08, 0x13, 0x20, 0x02, 0x33, 0x40, 0x43, 0x00, 0x10, 0xC2, 0x00, 0x40, 0x46, 0x02, 0x00, 0x70, 
+    0xA0, 0x00, 0x70, 0x42, 0x01, 0x02, 0x4D, 0x03, 0xB6, 0x44, 0xB0, 0x00, 0x20, 0xA3, 0x42, 0x04, 
+    0x42, 0x00, 0x00, 0xB8, 0x05, 0x04, 0x44, 0xA1, 0xA3, 0x02, 0x41, 0x10, 0x5A, 0x05, 0x51, 0x12, 
+    0x21, 0xA5, 0x01, 0x11, 0x44, 0x04, 0x02, 0x04, 0x40, 0xF0, 0x04, 0x00, 0x70, 0xE0, 0x46, 0x08, 
+    0xA4, 0x70, 0x00, 0x44, 0xA0, 0xD0, 0x04, 0x24, 0x43, 0x30, 0xC0, 0x05, 0x88, 0x80, 0x00, 0x43, 
+    0x14, 0x66, 0x51, 0x16, 0x66, 0x51, 0x13, 0x34, 0x34, 0x11, 0x14, 0x40, 0xF1, 0x09, 0x03, 0x51, 
+    0x15, 0xB1, 0x06, 0x55, 0x51, 0x32, 0x00, 0xA2, 0x00, 0x30, 0xE0, 0x00, 0x40, 0xF0, 0x04, 0x06, 
+    0x40, 0x08, 0xE0, 0x00, 0xA4, 0x44, 0x00, 0x40, 0xE0, 0x04, 0xB0, 0x00, 0x80, 0x43, 0xB0, 0x04, 
+    0x80, 0x4B, 0x40, 0xC6, 0xD1, 0xE6, 0xF1, 0x12, 0x44, 0x02, 0x22, 0x20, 0xF0, 0x05, 0x05, 0x70, 
+    0x00, 0x44, 0x45, 0x00, 0x80, 0x49, 0x05, 0xB4, 0xA0, 0x77, 0xF0, 0x0C, 0x43, 0x09, 0xA4, 0x41, 
+    0x14, 0x41, 0x11, 0xF6, 0x02, 0xF1, 0x08, 0x00, 0x50, 0xD1, 0xB5, 0x00, 0x10, 0xA2, 0x01, 0x0B, 
+    0xF0, 0x04, 0x04, 0x44, 0x04, 0x00, 0x47, 0x00, 0xE0, 0x42, 0x01, 0x74, 0xB0, 0x09, 0xAA, 0x07, 
+    0x40, 0x80, 0x00, 0xA4, 0xC0, 0x01, 0x88, 0xC0, 0x04, 0x44, 0x46, 0x60, 0xB1, 0x00, 0x50, 0xF6, 
+    0x04, 0x56, 0xC5, 0x01, 0x13, 0x42, 0xF0, 0x05, 0x01, 0x40, 0xA4, 0xA0, 0x00, 0x20, 0x46, 0x03, 
+    0x00, 0x4B, 0x46, 0x15, 0xB0, 0x44, 0x4A, 0x66, 0x64, 0x88, 0x00, 0x80, 0x08, 0x00, 0x53, 0x47, 
+    0x00, 0x50, 0xF6, 0x06, 0x50, 0x01, 0x51, 0xF5, 0x01, 0x07, 0x44, 0x32, 0x22, 0x02, 0x4C, 0x03, 
+    0x34, 0x77, 0xB0, 0x48, 0x00, 0x70, 0xA0, 0x05, 0x44, 0x47, 0x44, 0x42, 0x17, 0x44, 0xA0, 0x40, 
+    0x28, 0x08, 0x32, 0x88, 0x05, 0x40, 0xB4, 0x4A, 0xA1, 0xF6, 0x09, 0xF1, 0x09, 0xF5, 0x03, 0x06, 
+    0x43, 0x43, 0x30, 0x70, 0xF0, 0x0A, 0x00, 0x70, 0x4C, 0xB0, 0x04, 0x40, 0x77, 0x70, 0x43, 0x16, 
+    0xB0, 0x00, 0x44, 0x48, 0x80, 0x32, 0x80, 0x21, 0x20, 0xBB, 0x4A, 0xA0, 0xF6, 0x0A, 0xF1, 0x0A, 
+    0xF5, 0x02, 0x01, 0x14, 0x42, 0xF0, 0x0E, 0x04, 0x77, 0x70, 0x80, 0xA0, 0x00, 0x70, 0xF0, 0x00, 
+    0xA7, 0x04, 0x00, 0x44, 0x40, 0x44, 0x01, 0x00, 0x43, 0x08, 0x44, 0x20, 0x00, 0x4A, 0x40, 0x5F, 
+    0x00, 0x50, 0xB1, 0x02, 0x55, 0x10, 0x46, 0x06, 0x33, 0x40, 0x23, 0x30, 0xA0, 0x00, 0x70, 0xF0, 
+    0x00, 0x02, 0x74, 0x70, 0xC0, 0x06, 0x77, 0x00, 0x08, 0x80, 0xF0, 0x04, 0x02, 0x70, 0x70, 0xA4, 
+    0x01, 0xAA, 0x44, 0x0C, 0x43, 0x80, 0x45, 0x30, 0x70, 0x70, 0x00, 0xE6, 0xA5, 0x55, 0x01, 0x55, 
+    0x42, 0x01, 0x51, 0xB5, 0x02, 0x14, 0x30, 0xA0, 0x01, 0x44, 0xF0, 0x03, 0x02, 0x47, 0x70, 0xB0, 
+    0x09, 0xB0, 0x04, 0x47, 0x70, 0x0E, 0xE0, 0x08, 0xE0, 0x77, 0xB0, 0x00, 0x70, 0xB4, 0x01, 0x07, 
+    0x42, 0x01, 0x14, 0x42, 0x07, 0x40, 0x00, 0x74, 0x46, 0xF5, 0x03, 0x52, 0x03, 0x11, 0x51, 0x43, 
+    0xC5, 0x01, 0x13, 0xB0, 0x4C, 0xE0, 0x01, 0xBB, 0xA7, 0x08, 0x07, 0x70, 0x07, 0x7B, 0xB0, 0x43, 
+    0x01, 0x44, 0xA7, 0x02, 0x44, 0x40, 0xA0, 0x11, 0x77, 0x00, 0x04, 0x30, 0x04, 0x64, 0x80, 0x0B, 
+    0x44, 0xF5, 0x04, 0x47, 0x00, 0x50, 0xE1, 0x02, 0x51, 0x50, 0xB1, 0xF5, 0x00, 0x01, 0x64, 0xA0, 
+    0x02, 0x24, 0x30, 0xF0, 0x01, 0x01, 0x44, 0xF0, 0x00, 0x42, 0x01, 0x08, 0xA0, 0x07, 0x77, 0x70, 
+    0xB7, 0x00, 0x43, 0x00, 0xB0, 0xF0, 0x08, 0x06, 0x46, 0x4E, 0x00, 0x00, 0x4D, 0x00, 0x50, 0x46, 
+    0xF1, 0x01, 0x09, 0x55, 0x11, 0x51, 0x55, 0x51, 0x45, 0x05, 0x61, 0x20, 0x04, 0x49, 0x00, 0xB0, 
+    0xA4, 0xF0, 0x00, 0x00, 0x70, 0xE0, 0x0A, 0x77, 0xB0, 0xB0, 0xE8, 0x74, 0x40, 0x48, 0x04, 0x77, 
+    0x00, 0x80, 0x43, 0x05, 0x14, 0x80, 0x0B, 0x4E, 0x01, 0x55, 0x50, 0x04, 0x51, 0x15, 0x10, 0xF5, 
+    0x02, 0x01, 0x10, 0x42, 0x00, 0x40, 0xF0, 0x01, 0x04, 0x44, 0x77, 0x70, 0xF0, 0x01, 0xB7, 0x0E, 
+    0x00, 0x47, 0x7B, 0x00, 0xEE, 0x04, 0x74, 0x70, 0xD0, 0x03, 0x44, 0x40, 0xA8, 0x03, 0x00, 0x45, 
+    0x42, 0x00, 0x70, 0x4E, 0x02, 0x65, 0x50, 0x42, 0x02, 0x51, 0x50, 0xB1, 0x01, 0x55, 0x45, 0xF5, 
+    0x03, 0x07, 0x13, 0x44, 0x33, 0x34, 0x4C, 0x01, 0x77, 0xF0, 0x06, 0x03, 0x44, 0x77, 0x45, 0x01, 
+    0x7B, 0xC0, 0x05, 0xB7, 0x77, 0x0E, 0x42, 0x02, 0x84, 0x60, 0x42, 0x05, 0x44, 0x46, 0x66, 0x4A, 
+    0xA6, 0xE1, 0xA5, 0x04, 0x15, 0x51, 0x10, 0xF5, 0x05, 0x02, 0x33, 0x40, 0xB3, 0x01, 0x42, 0xC0, 
+    0x00, 0xB0, 0x45, 0x00, 0x40, 0xF0, 0x04, 0x05, 0xB7, 0x44, 0x77, 0x42, 0xA7, 0xB0, 0x08, 0x77, 
+    0x74, 0x40, 0x88, 0x00, 0x4D, 0x00, 0x60, 0xF5, 0x02, 0x44, 0x01, 0x55, 0x45, 0x06, 0x11, 0x51, 
+    0x51, 0x10, 0xF5, 0x03, 0x02, 0x38, 0x00, 0xE3, 0x00, 0x20, 0xC0, 0x45, 0x02, 0x00, 0x80, 0xF0, 
+    0x02, 0x05, 0x77, 0x74, 0x74, 0xA0, 0x03, 0xBB, 0x7B, 0xA0, 0x00, 0xB0, 0xB7, 0x00, 0x00, 0xA8, 
+    0x42, 0x01, 0x3E, 0x47, 0x00, 0x60, 0xF5, 0x05, 0x42, 0x00, 0x50, 0xB1, 0xD5, 0x46, 0x09, 0x15, 
+    0x55, 0x40, 0x80, 0x32, 0xD3, 0xC0, 0x00, 0x70, 0x45, 0x00, 0x80, 0xF0, 0x03, 0xB7, 0x01, 0x47, 
+    0x42, 0x01, 0x74, 0x47, 0x00, 0x40, 0x45, 0x07, 0x04, 0x62, 0xE0, 0x07, 0x45, 0xF6, 0x00, 0xE5, 
+    0x03, 0x15, 0x55, 0x46, 0x00, 0x10, 0xF5, 0x04, 0x0E, 0x08, 0x82, 0x33, 0x32, 0x32, 0x34, 0x33, 
+    0x80, 0xB0, 0x0A, 0x44, 0x77, 0x7B, 0x08, 0x8E, 0x80, 0xE0, 0x00, 0xE0, 0xC7, 0x0B, 0x4B, 0x0B, 
+    0x77, 0x70, 0x00, 0xBB, 0x42, 0x00, 0x70, 0x48, 0x05, 0x4E, 0x08, 0x07, 0x4D, 0x00, 0x60, 0xF5, 
+    0x04, 0x02, 0x15, 0x10, 0xF5, 0x07, 0x04, 0x10, 0x08, 0x00, 0xA3, 0x01, 0x22, 0xA3, 0xC0, 0x00, 
+    0x70, 0x42, 0x00, 0x00, 0x43, 0x01, 0xEE, 0xE0, 0x03, 0x47, 0x77, 0xA4, 0x05, 0xBB, 0x77, 0x08, 
+    0x4E, 0x08, 0x25, 0x1E, 0x80, 0x00, 0xB0, 0xF6, 0x07, 0xF5, 0x16, 0x04, 0x40, 0x00, 0x30, 0xF4, 
+    0x00, 0x45, 0x00, 0xB0, 0xA7, 0x03, 0x00, 0x08, 0xAE, 0x49, 0xB4, 0xA7, 0x01, 0x0E, 0x46, 0x00, 
+    0x40, 0x43, 0x0A, 0x80, 0x35, 0x10, 0x80, 0x0E, 0x70, 0xF6, 0x09, 0x02, 0x55, 0x60, 0xF5, 0x11, 
+    0x06, 0x30, 0x04, 0x44, 0x00, 0xAA, 0x12, 0x4A, 0x6A, 0x0E, 0x08, 0x00, 0x07, 0x77, 0xB0, 0xE0, 
+    0x00, 0x48, 0x02, 0xB0, 0xB0, 0xA4, 0x00, 0x70, 0xB4, 0x42, 0x00, 0x00, 0x44, 0x0B, 0x70, 0x80, 
+    0x88, 0x00, 0x46, 0x52, 0xA0, 0x01, 0x40, 0xB5, 0xF6, 0x04, 0xF5, 0x11, 0x01, 0x12, 0xD0, 0xA4, 
+    0x05, 0x04, 0x44, 0xA4, 0xB0, 0x08, 0xBB, 0xB7, 0x08, 0x00, 0x80, 0x48, 0x02, 0xB0, 0x70, 0x44, 
+    0x01, 0x77, 0x42, 0x02, 0x80, 0x00, 0xB7, 0x10, 0x0E, 0x00, 0x08, 0x02, 0x16, 0x51, 0x12, 0x00, 
+    0x40, 0xC5, 0x4E, 0x00, 0x60, 0x55, 0xC0, 0x0A, 0x40, 0x88, 0x80, 0x04, 0x00, 0x40, 0x45, 0x02, 
+    0x7B, 0x70, 0xA0, 0x04, 0x8E, 0x8E, 0xE0, 0xC0, 0x01, 0xBB, 0x48, 0x03, 0x40, 0x80, 0x46, 0x10, 
+    0x88, 0x80, 0x83, 0x41, 0x66, 0x11, 0x40, 0x04, 0x60, 0xC5, 0xB6, 0x02, 0x55, 0x50, 0xA6, 
+};
+
+const gfx_image_t STORY_CH7_IMG = {
+    .w = STORY_CH7_W, .h = STORY_CH7_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH7_PAL, .colors = STORY_CH7_PAL_SIZE,
+    .data = STORY_CH7_RLE, .size = STORY_CH7_RLE_SIZE,
 };
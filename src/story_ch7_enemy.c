@@ -6,349 +6,174 @@ const uint16_t STORY_CH7_ENEMY_PAL[STORY_CH7_ENEMY_PAL_SIZE] = {
     0x8B0D, 0xE4FC, 0xA474, 0x5227, 0x89F1, 0x3A08, 0x71D0, 0xCAB6, 
 };
 
-const uint8_t STORY_CH7_ENEMY_IDX[(STORY_CH7_ENEMY_W * STORY_CH7_ENEMY_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x12, 0x22, 0x12, 
-    0x21, 0x11, 0x11, 0x12, 0x40, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 0x00, 0x42, 0x22, 
-    0x24, 0x20, 0x00, 0x44, 0x21, 0x11, 0x12, 0x21, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0x11, 0x11, 0x11, 
-    0x14, 0x41, 0x21, 0x22, 0x22, 0x40, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x42, 0xC2, 
-    0x22, 0x22, 0x02, 0x44, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x1A, 0xA0, 0xA0, 
-    0xA7, 0x11, 0xD4, 0x42, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xCC, 
-    0x22, 0x22, 0x22, 0x24, 0x41, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x1A, 0x00, 0x09, 0x00, 
-    0x37, 0x31, 0x12, 0x24, 0x22, 0x22, 0x22, 0x22, 0xC2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2C, 
-    0xC2, 0x22, 0x22, 0x22, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xA9, 0xA0, 0x90, 0x00, 
-    0x37, 0x11, 0x71, 0x44, 0x44, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2C, 0xC2, 0x22, 0x22, 
-    0xC3, 0x22, 0xE2, 0x22, 0x37, 0x11, 0x73, 0x71, 0x11, 0x12, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1A, 0x0A, 0xAA, 0x00, 0x03, 
-    0x37, 0x77, 0x17, 0x14, 0x40, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0xCC, 0xE3, 0x33, 0xE7, 0x22, 
-    0x33, 0x3E, 0x33, 0x33, 0x77, 0x33, 0x33, 0x37, 0x11, 0x12, 0x44, 0x41, 0x24, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x19, 0xAA, 0x39, 0x00, 0x00, 
-    0x33, 0x77, 0x71, 0x12, 0x00, 0x00, 0x42, 0x22, 0x24, 0x04, 0x22, 0x22, 0x23, 0x03, 0x3E, 0x27, 
-    0x73, 0x33, 0x32, 0x71, 0x73, 0x73, 0x33, 0x33, 0x71, 0x11, 0x24, 0x42, 0x24, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xA0, 0xA7, 0xA0, 0xA3, 0x74, 
-    0x00, 0x77, 0x71, 0x22, 0x00, 0x00, 0x04, 0x22, 0x44, 0x44, 0x42, 0xE2, 0x2E, 0x33, 0x63, 0x71, 
-    0x73, 0x33, 0x31, 0x21, 0x17, 0x73, 0x33, 0x33, 0x31, 0x11, 0x24, 0x44, 0x44, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0xAA, 0xAA, 0x03, 0x31, 0x00, 
-    0x00, 0x01, 0x71, 0x12, 0x40, 0x00, 0x00, 0x04, 0x44, 0x44, 0x42, 0xC2, 0xEE, 0x3C, 0x03, 0xE3, 
-    0x33, 0x33, 0x3E, 0x12, 0x21, 0x11, 0x73, 0x33, 0x31, 0x11, 0x12, 0x22, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x77, 0x1A, 0x37, 0x70, 0x00, 
-    0x00, 0x00, 0x21, 0x22, 0x20, 0x00, 0x00, 0x00, 0x42, 0x20, 0x22, 0x22, 0x22, 0x7E, 0x33, 0x33, 
-    0x37, 0x33, 0x37, 0x21, 0x21, 0x11, 0x77, 0x33, 0x33, 0x17, 0x72, 0x22, 0x44, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x03, 0x11, 0x11, 0x11, 0x20, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x24, 0x40, 0x00, 0x00, 0x44, 0x44, 0x42, 0x22, 0x22, 0x22, 0xE0, 0xC3, 
-    0x22, 0x33, 0x33, 0x22, 0x21, 0x77, 0x77, 0x33, 0x33, 0x11, 0x12, 0x22, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x37, 0x12, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x22, 0x44, 0x00, 0x00, 0x40, 0x44, 0x42, 0x22, 0x22, 0x22, 0x33, 0xC3, 
-    0x37, 0x33, 0x33, 0x12, 0x11, 0x33, 0x33, 0x73, 0x33, 0x71, 0x11, 0x12, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x11, 0x22, 0x22, 0x11, 0x00, 0x00, 
-    0x05, 0x00, 0x00, 0x02, 0x12, 0x44, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 
-    0x31, 0xC3, 0x72, 0x22, 0x17, 0x33, 0x33, 0x37, 0x33, 0x33, 0x71, 0x14, 0x40, 0x00, 0x22, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x12, 0x22, 0x22, 0x11, 0x00, 0x55, 
-    0x55, 0x50, 0x00, 0x02, 0x11, 0x40, 0x00, 0x00, 0x00, 0x04, 0x22, 0x22, 0xE2, 0x13, 0x2C, 0xC2, 
-    0x22, 0x33, 0xC3, 0x72, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x12, 0x40, 0x00, 0x02, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA7, 0x22, 0x22, 0x22, 0x00, 0x00, 0x51, 
-    0x15, 0x55, 0x50, 0x00, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x2C, 0xC2, 
-    0x2E, 0x33, 0x3E, 0x3E, 0x23, 0x33, 0x30, 0x03, 0x33, 0x37, 0x33, 0x22, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x01, 0x22, 0x22, 0x20, 0x04, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x2C, 0x02, 
-    0x2C, 0xF3, 0x32, 0xCC, 0xE3, 0x33, 0x36, 0x66, 0x33, 0x37, 0x33, 0x72, 0x40, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0D, 0xDD, 0x40, 0x00, 0x00, 0x07, 0xA0, 0x32, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 
-    0x10, 0x00, 0x10, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0xE2, 0x22, 0x22, 0x22, 
-    0x23, 0x33, 0x32, 0xEE, 0xEC, 0x36, 0x66, 0x66, 0x03, 0x3C, 0x33, 0x32, 0x24, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x05, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x4D, 0xD4, 0x40, 0x40, 0x00, 0x10, 0x00, 0x11, 0x22, 0x02, 0x00, 0x00, 0x00, 0x05, 
-    0x10, 0x00, 0x00, 0x00, 0x02, 0x12, 0x44, 0x40, 0x00, 0x00, 0x00, 0x42, 0x22, 0x22, 0x22, 0x22, 
-    0x23, 0x33, 0xE2, 0xCC, 0x33, 0xFF, 0x33, 0x36, 0x66, 0xC3, 0x33, 0x32, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x44, 0x44, 0x40, 0x00, 
-    0x00, 0x00, 0x44, 0x04, 0x44, 0x42, 0x21, 0x09, 0x07, 0x11, 0x12, 0x22, 0x00, 0x00, 0x55, 0x05, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x12, 0x44, 0x40, 0x00, 0x44, 0x00, 0x42, 0x22, 0x22, 0x22, 0x22, 
-    0x33, 0x33, 0x33, 0x3F, 0xF3, 0x3C, 0x33, 0x36, 0x63, 0x33, 0xC3, 0xC2, 0x22, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0x00, 0x00, 0x01, 0x11, 0x1D, 0xDD, 0xDD, 0xDD, 0x44, 0x00, 
-    0x00, 0x00, 0x04, 0x44, 0x44, 0x22, 0x30, 0xA3, 0x73, 0x37, 0x12, 0x40, 0x00, 0x05, 0x50, 0x51, 
-    0x10, 0x05, 0x00, 0x00, 0x00, 0x11, 0x24, 0x44, 0x40, 0x22, 0x04, 0x42, 0x22, 0x22, 0x22, 0x22, 
-    0x33, 0x36, 0x33, 0xF3, 0x3F, 0x66, 0x66, 0x66, 0x96, 0x33, 0x3C, 0xC3, 0x22, 0x44, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x41, 0x8A, 0xA1, 0xD1, 0x11, 0xDD, 0x44, 0x40, 
-    0x00, 0x00, 0x04, 0x42, 0x11, 0x41, 0x0A, 0x77, 0x73, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x20, 0x05, 0x00, 0x00, 0x00, 0x21, 0x24, 0x42, 0x44, 0x22, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0xC3, 0x3F, 0xC3, 0xF3, 0x36, 0x99, 0x99, 0x96, 0x96, 0x63, 0x33, 0xC3, 0x22, 0x24, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x10, 0x44, 0x41, 0x11, 0x81, 0x11, 0x11, 0x1D, 0x44, 0x00, 
-    0x00, 0x00, 0x42, 0x11, 0x11, 0x27, 0xA3, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x00, 
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x24, 0x22, 0x44, 0x22, 0x44, 0x22, 0x22, 0x22, 0xC2, 0x23, 
-    0xC3, 0x33, 0x33, 0x6F, 0x69, 0x99, 0x99, 0x99, 0x96, 0x66, 0x63, 0xCC, 0x22, 0x22, 0x44, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x11, 0x02, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1D, 0x44, 0x40, 
-    0x00, 0x42, 0x42, 0x11, 0x12, 0x21, 0x11, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x11, 0x00, 
-    0xB1, 0x10, 0x00, 0x00, 0x00, 0x04, 0x12, 0x22, 0x44, 0x22, 0x24, 0x42, 0x22, 0x2E, 0xE3, 0xC3, 
-    0xC3, 0x33, 0x33, 0x66, 0x69, 0x99, 0x99, 0x66, 0x99, 0x66, 0x60, 0x33, 0xE2, 0x22, 0x22, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x51, 0x12, 0x11, 0x55, 0x11, 0x11, 0x11, 0x1D, 0x44, 0x40, 
-    0x44, 0x44, 0x41, 0x11, 0x12, 0x13, 0x12, 0x22, 0x20, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x24, 0x44, 0x22, 0x22, 0x22, 0x22, 0x21, 0x22, 0x2C, 
-    0xC3, 0x33, 0x36, 0x66, 0x69, 0x00, 0x96, 0x69, 0x69, 0x66, 0x66, 0x00, 0x32, 0x22, 0x22, 0x24, 
-    0x00, 0x00, 0x00, 0x02, 0x1B, 0x15, 0x55, 0x88, 0x11, 0x15, 0x51, 0x11, 0x11, 0x1D, 0x44, 0x44, 
-    0x44, 0x44, 0x21, 0x11, 0x11, 0x37, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 0x00, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 
-    0x33, 0x33, 0x36, 0x99, 0x90, 0x00, 0x99, 0x66, 0x99, 0x66, 0x66, 0x60, 0x0E, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x05, 0x51, 0x11, 0x11, 0x15, 0x51, 0x11, 0x11, 0x11, 0x1D, 0x44, 
-    0x41, 0x11, 0x11, 0x11, 0x13, 0x03, 0x31, 0x22, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x42, 0x22, 0x22, 0x12, 0x22, 0x22, 0x2C, 
-    0x33, 0x33, 0x36, 0x99, 0x90, 0x00, 0x09, 0x96, 0x99, 0x96, 0x66, 0x60, 0x03, 0xE2, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x15, 0x11, 0x15, 0x51, 0x11, 0x11, 0x14, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x31, 0x11, 0x22, 0x52, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xB0, 
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x42, 0x22, 0x22, 0x22, 0x22, 0x12, 0x23, 
-    0xCC, 0x33, 0x36, 0x69, 0x99, 0x00, 0x09, 0x96, 0x69, 0x66, 0x66, 0x63, 0x33, 0xE2, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x15, 0x51, 0x8B, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x18, 0x11, 0x12, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 
-    0x00, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x24, 0x42, 0x22, 0x22, 0x22, 0x21, 0x12, 0x22, 
-    0xC3, 0x33, 0x36, 0x69, 0x99, 0x99, 0x00, 0x99, 0x99, 0x66, 0x63, 0x33, 0x33, 0xCE, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x11, 0x11, 0x18, 0x88, 0x11, 
-    0x11, 0x11, 0x11, 0x8A, 0xAA, 0xAA, 0x8B, 0x55, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x11, 
-    0x55, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x11, 0x12, 0x22, 
-    0x2C, 0x33, 0x36, 0x66, 0x69, 0x99, 0x99, 0x99, 0x96, 0x66, 0xF3, 0x33, 0x3C, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x05, 0x55, 0x55, 0x55, 0x11, 0x11, 0x11, 0x55, 0x51, 0x11, 
-    0x11, 0x11, 0x10, 0x88, 0x88, 0xA0, 0xA0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x55, 0x11, 
-    0x5B, 0x11, 0x00, 0x00, 0x11, 0x50, 0x00, 0x00, 0x02, 0x12, 0x22, 0x21, 0x22, 0x21, 0x12, 0x22, 
-    0x22, 0x33, 0x33, 0x66, 0x66, 0x99, 0x99, 0x96, 0x66, 0x66, 0x63, 0x33, 0x3C, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x05, 0x55, 0x55, 0x55, 0x18, 0x15, 0x55, 0x21, 0x11, 
-    0x11, 0x88, 0x8A, 0x0A, 0xA0, 0xAA, 0xA0, 0x85, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0x01, 
-    0x10, 0x11, 0x10, 0x00, 0xB1, 0x10, 0x00, 0x00, 0x02, 0x12, 0x22, 0x11, 0x12, 0x11, 0x12, 0x22, 
-    0x22, 0xC3, 0x33, 0x66, 0x66, 0x66, 0x99, 0x66, 0x66, 0x99, 0x63, 0x33, 0x38, 0x22, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x51, 0x55, 0x55, 0x52, 0x11, 0x11, 
-    0x11, 0x11, 0x1A, 0x00, 0xA8, 0xAA, 0x0B, 0x51, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0B, 0x00, 0x11, 
-    0xB0, 0x11, 0x11, 0x00, 0x01, 0x11, 0x00, 0x00, 0x02, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x22, 
-    0xCC, 0x2C, 0x33, 0x66, 0x66, 0x6F, 0x66, 0x3F, 0x69, 0x96, 0xF3, 0x33, 0x33, 0x12, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 
-    0x18, 0x33, 0x38, 0x18, 0xA0, 0x18, 0x88, 0x11, 0x15, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x10, 0x01, 
-    0x11, 0x01, 0x11, 0x00, 0x05, 0x11, 0x50, 0x00, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 
-    0x21, 0x33, 0x33, 0xF3, 0x36, 0x6F, 0x33, 0xF6, 0x66, 0xFF, 0xFF, 0x0F, 0x00, 0x82, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x25, 0x55, 0x55, 0x51, 0x11, 0x11, 0x11, 
-    0x3A, 0xAA, 0xAA, 0x33, 0x33, 0xAA, 0x11, 0x11, 0x1B, 0x00, 0x00, 0x00, 0x05, 0x00, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x10, 0x00, 0x02, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x33, 0x33, 0xFF, 0x36, 0xFF, 0xFF, 0x66, 0x66, 0xFF, 0x90, 0x00, 0x88, 0x82, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x15, 0x55, 0x15, 0x55, 0x52, 0x11, 0x11, 0x11, 0x3A, 
-    0xAA, 0x33, 0x33, 0x37, 0x32, 0x21, 0x0A, 0x11, 0xB5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x11, 
-    0x11, 0x11, 0x1B, 0x00, 0x0B, 0x11, 0x10, 0x00, 0x02, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x3F, 0xF6, 0x66, 0x6F, 0xF6, 0x66, 0x6F, 0xFF, 0x08, 0x83, 0x11, 0x82, 0x22, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x21, 0x11, 0x11, 0x1A, 0x0A, 
-    0x33, 0x71, 0x18, 0x82, 0x21, 0x12, 0x01, 0x08, 0x11, 0x55, 0x50, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x01, 0xB1, 0x11, 0x00, 0x02, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x33, 0x33, 0x66, 0x6F, 0xFF, 0x3F, 0xFF, 0x33, 0x31, 0x18, 0x85, 0x11, 0x12, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x11, 0x11, 0x11, 0x30, 0xAA, 
-    0xAA, 0xA3, 0x31, 0x11, 0x12, 0x17, 0x10, 0x05, 0x81, 0xB1, 0x50, 0x05, 0x00, 0x00, 0x1B, 0x11, 
-    0x11, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x20, 0x01, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x33, 0x33, 0x33, 0xFF, 0xFF, 0x33, 0x33, 0x88, 0x31, 0x28, 0x85, 0x12, 0x25, 0x50, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x13, 0xA9, 0x99, 
-    0x99, 0x09, 0x90, 0x33, 0xCE, 0x22, 0x22, 0x40, 0x51, 0x11, 0xB5, 0x00, 0x00, 0x00, 0x1B, 0x11, 
-    0x11, 0x11, 0xB0, 0x00, 0x00, 0x11, 0x51, 0x10, 0x23, 0x22, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x83, 0x33, 0x33, 0x33, 0x38, 0x3A, 0x83, 0x08, 0x28, 0x85, 0x12, 0x25, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x11, 0xAA, 0xA3, 0x3A, 
-    0xA1, 0x11, 0x33, 0x30, 0x03, 0x3E, 0x22, 0x20, 0x00, 0x05, 0x1B, 0x50, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0xD0, 0x50, 0x10, 0x11, 0x21, 0x12, 0x82, 0x22, 0x33, 0x11, 0x11, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x88, 0x88, 0x33, 0x33, 0x03, 0x20, 0x01, 0x58, 0x15, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0xA3, 0x81, 0x71, 
-    0x31, 0x00, 0x00, 0x02, 0x22, 0x23, 0xEE, 0x22, 0x20, 0x00, 0x00, 0x51, 0xB0, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0xB1, 0x11, 0x25, 0x11, 0x12, 0x21, 0x8A, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x88, 0x88, 0x83, 0x00, 0x08, 0x18, 0x82, 0x58, 0x15, 0x50, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA3, 0x31, 
-    0x17, 0x71, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x24, 0x04, 0x45, 0xB5, 0x05, 0x00, 0x51, 
-    0x11, 0x11, 0x11, 0x00, 0x05, 0x11, 0x00, 0x11, 0x12, 0x13, 0x8A, 0x31, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x18, 0x88, 0x39, 0x09, 0x93, 0x28, 0x85, 0x55, 0x55, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0xB1, 
-    0x12, 0x21, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x40, 0x05, 0x50, 0x50, 0x51, 
-    0x11, 0x11, 0x11, 0x55, 0x50, 0x11, 0x05, 0x11, 0x12, 0xE1, 0x18, 0x37, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x12, 0x22, 0x11, 0x18, 0x00, 0xA0, 0x03, 0x21, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB1, 
-    0x51, 0x00, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x22, 0x22, 0x40, 0x00, 0x00, 0x00, 
-    0x55, 0x5B, 0xB0, 0xB1, 0x15, 0x00, 0x52, 0x51, 0x12, 0x22, 0x11, 0x77, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x22, 0x22, 0x22, 0x1A, 0xAA, 0xA0, 0x01, 0x22, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x41, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x10, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x22, 0x24, 0x00, 0x00, 0x00, 
-    0x50, 0x00, 0x00, 0x11, 0x1B, 0x50, 0x11, 0x11, 0x11, 0x21, 0x88, 0x77, 0x71, 0x11, 0x11, 0x11, 
-    0x11, 0x12, 0x22, 0x22, 0x11, 0x39, 0x00, 0x00, 0x81, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x44, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xB0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 
-    0x05, 0x00, 0x00, 0x01, 0x11, 0x15, 0x21, 0x11, 0x81, 0x11, 0x18, 0x73, 0x37, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x22, 0x22, 0x28, 0x90, 0x38, 0x81, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x24, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x1B, 0x5B, 0x02, 0x11, 0x11, 0x12, 0x11, 0x73, 0x37, 0x71, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x21, 0x1A, 0x81, 0x22, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x4D, 0xDD, 0x1D, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x5B, 0x1B, 0x01, 0xB0, 0x11, 0x11, 0x15, 0x23, 0x33, 0x73, 0x33, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0xA8, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x04, 0xD1, 0x11, 0x44, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x05, 
-    0x00, 0x00, 0x00, 0x51, 0x11, 0x05, 0x10, 0x01, 0x11, 0x12, 0x13, 0x3E, 0xE3, 0x33, 0x71, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x85, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x4D, 0x11, 0xDD, 0xD1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x24, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x51, 0x10, 0x11, 0x02, 0x11, 0x11, 0x22, 0x7E, 0xE7, 0x73, 0x03, 0x71, 
-    0x11, 0x11, 0x11, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x44, 0xDD, 0xD1, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 
-    0x05, 0xBB, 0x00, 0x00, 0x50, 0x11, 0x01, 0x42, 0x11, 0x11, 0x22, 0xE2, 0xE7, 0x33, 0x33, 0x31, 
-    0x11, 0x11, 0x11, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x04, 0x4D, 0x11, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x00, 0x55, 0x50, 0x00, 0x02, 0x41, 0xD4, 0x41, 0x11, 0x11, 0x22, 0x22, 0xE7, 0x37, 0x30, 0x37, 
-    0x11, 0x11, 0xAA, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x44, 0xDD, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2E, 
-    0x24, 0x05, 0x15, 0x00, 0x00, 0x01, 0x14, 0x44, 0x12, 0x11, 0x22, 0x22, 0x77, 0xEE, 0x37, 0x73, 
-    0xA1, 0xA1, 0x1B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xDD, 0xDD, 0xD1, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x22, 0x00, 0x10, 0x00, 0x00, 0x21, 0x44, 0x44, 0x12, 0x01, 0x12, 0x22, 0x77, 0x2E, 0xE2, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xDD, 0xD1, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x22, 0x20, 0x05, 0x00, 0x00, 0x01, 0x14, 0x40, 0x42, 0x00, 0x22, 0x22, 0xE2, 0x22, 0x24, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x12, 0x22, 0x20, 0x00, 0x02, 0x22, 0x24, 0x42, 0x40, 0x1B, 
-    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x1D, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x02, 0x21, 0x12, 0x00, 0x05, 0x22, 0x24, 0x24, 0x00, 0x55, 
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x44, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x44, 0x40, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x02, 0x21, 0x12, 0x40, 0x00, 0x22, 0x44, 0x40, 0x00, 0x0B, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x12, 0x40, 0x00, 0x4D, 0x11, 0xD4, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x22, 0x22, 0x00, 0x00, 0x00, 0x02, 0x11, 0x12, 0x10, 0x00, 0x22, 0x04, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x14, 0x44, 0x04, 0x11, 0x11, 0x1D, 0xD1, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x24, 0x22, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x10, 0x00, 0x52, 0x04, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x44, 0x04, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x42, 0x22, 0x50, 0x00, 0x00, 0x00, 0x52, 0x25, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x40, 0x04, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x12, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x14, 0x41, 0x14, 0x00, 0x04, 0x44, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x44, 0x44, 0x40, 0x00, 0x04, 0x41, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x44, 0x24, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x44, 0x24, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x21, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x20, 0x52, 0x20, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x14, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x02, 0x12, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x40, 0x11, 0x11, 0x11, 0x11, 0x71, 0x11, 0x11, 0x11, 
-    0x11, 0x40, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x14, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x88, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x1B, 0x11, 0x8B, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x51, 0xB5, 0xB1, 0x1B, 0xB1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x20, 0x00, 0x01, 0x85, 0xB8, 0x15, 0xB8, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBB, 0xB1, 0x1B, 0xB8, 0x1B, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xBB, 0x5B, 0x15, 0x11, 0xB5, 0xB0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x85, 0xB5, 0x15, 0x51, 0xBB, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x31, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x85, 0xBB, 0xBB, 0x5B, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4D, 0x11, 0x33, 0x36, 0x31, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xB5, 0x5B, 0x51, 0x88, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x66, 0x66, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xB5, 0xB5, 0x55, 0xB1, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x2D, 0x17, 0x21, 0x11, 0x11, 0x66, 0x36, 0x66, 0x61, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x22, 0x11, 0x11, 0x11, 0x21, 0x33, 0x36, 0x33, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x11, 0x14, 0x71, 0x11, 0x16, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x11, 0x11, 0x21, 0x10, 0x39, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x22, 0x21, 0x11, 0x41, 0x33, 0x32, 0x11, 0x11, 0x11, 0x33, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x21, 0x22, 0x40, 0x20, 0x19, 0x31, 0x11, 0x11, 0x11, 0x11, 0x3A, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0xA3, 0x21, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 
+const uint8_t STORY_CH7_ENEMY_RLE[STORY_CH7_ENEMY_RLE_SIZE] = {
+    0xF0, 0x2F, 0x08, 0x41, 0x12, 0x22, 0x12, 0x20, 0xC1, 0x04, 0x24, 0x04, 0x40, 0xF2, 0x02, 0x05, 
+    0x44, 0x40, 0x04, 0xA2, 0x07, 0x42, 0x00, 0x04, 0x42, 0xA1, 0x01, 0x22, 0xA1, 0x00, 0x40, 0xF0, 
+    0x3A, 0x02, 0x41, 0x20, 0xD1, 0x04, 0x44, 0x12, 0x10, 0xA2, 0x01, 0x40, 0xF2, 0x06, 0x03, 0x44, 
+    0x2C, 0xB2, 0x01, 0x02, 0x45, 0xC1, 0x7F, 0x43, 0x10, 0x11, 0xAA, 0x0A, 0x0A, 0x71, 0x1D, 0x44, 
+    0x22, 0x10, 0xF2, 0x0B, 0x01, 0xCC, 0xD2, 0x01, 0x44, 0xF1, 0x01, 0x00, 0x20, 0xF0, 0x39, 0x11, 
+    0x41, 0x1A, 0x00, 0x09, 0x00, 0x37, 0x31, 0x12, 0x24, 0xE2, 0x00, 0xC0, 0xF2, 0x05, 0x01, 0xCC, 
+    0xD2, 0x01, 0x12, 0xF1, 0x01, 0xF0, 0x39, 0x07, 0x11, 0xA9, 0xA0, 0x90, 0x42, 0x03, 0x11, 0x71, 
+    0xB4, 0xF2, 0x05, 0x01, 0xCC, 0xB2, 0x0E, 0xC3, 0x22, 0xE2, 0x22, 0x37, 0x11, 0x73, 0x70, 0xA1, 
+    0x05, 0x20, 0x04, 0x44, 0xF0, 0x33, 0x16, 0x41, 0xA0, 0xAA, 0xA0, 0x00, 0x33, 0x77, 0x71, 0x71, 
+    0x44, 0x04, 0x40, 0xF2, 0x01, 0x0D, 0xCC, 0xE3, 0x33, 0xE7, 0x22, 0x33, 0x3E, 0xA3, 0x01, 0x77, 
+    0xB3, 0x00, 0x70, 0x42, 0x05, 0x44, 0x41, 0x24, 0xF0, 0x31, 0x07, 0x44, 0x19, 0xAA, 0x39, 0xA0, 
+    0x07, 0x33, 0x77, 0x71, 0x12, 0xA0, 0x00, 0x40, 0xA2, 0x02, 0x40, 0x40, 0xB2, 0x07, 0x30, 0x33, 
+    0xE2, 0x77, 0xA3, 0x05, 0x27, 0x17, 0x37, 0xB3, 0x0A, 0x71, 0x11, 0x24, 0x42, 0x24, 0x40, 0xF0, 
+    0x2F, 0x0E, 0x42, 0x1A, 0x0A, 0x7A, 0x0A, 0x37, 0x40, 0x00, 0x42, 0x00, 0x20, 0x43, 0x03, 0x04, 
+    0x22, 0xB4, 0x0A, 0x2E, 0x22, 0xE3, 0x36, 0x37, 0x10, 0x43, 0x04, 0x12, 0x11, 0x70, 0x44, 0x00, 
+    0x30, 0x44, 0x02, 0x44, 0x40, 0xF0, 0x30, 0x02, 0x12, 0x70, 0xAA, 0x03, 0x03, 0x31, 0xB0, 0x05, 
+    0x17, 0x11, 0x24, 0xC0, 0xC4, 0x09, 0x2C, 0x2E, 0xE3, 0xC0, 0x3E, 0xC3, 0x07, 0xE1, 0x22, 0x11, 
+    0x17, 0x45, 0x04, 0x12, 0x22, 0x40, 0xF0, 0x31, 0x09, 0x23, 0x37, 0x71, 0xA3, 0x77, 0xD0, 0x04, 
+    0x21, 0x22, 0x20, 0xD0, 0x03, 0x42, 0x20, 0xC2, 0x01, 0x7E, 0xB3, 0x06, 0x73, 0x33, 0x72, 0x10, 
+    0x43, 0x00, 0x70, 0xA3, 0x02, 0x17, 0x70, 0x42, 0x00, 0x40, 0xF0, 0x2F, 0x03, 0x51, 0x03, 0xC1, 
+    0x00, 0x20, 0xE0, 0xA2, 0x01, 0x44, 0x44, 0xA4, 0xD2, 0x05, 0xE0, 0xC3, 0x22, 0xA3, 0x03, 0x22, 
+    0x21, 0xA7, 0x43, 0x01, 0x11, 0x42, 0xF0, 0x30, 0x05, 0x10, 0x37, 0x12, 0xA1, 0xF0, 0x01, 0xA2, 
+    0x01, 0x44, 0x43, 0x00, 0x00, 0x48, 0x05, 0x33, 0xC3, 0x37, 0xA3, 0x03, 0x12, 0x11, 0xA3, 0x04, 
+    0x73, 0x33, 0x70, 0xA1, 0x78, 0x04, 0x2A, 0xA1, 0x10, 0xA2, 0x45, 0x00, 0x50, 0xB0, 0x01, 0x21, 
+    0x45, 0xA0, 0xE2, 0xB3, 0x08, 0x1C, 0x37, 0x22, 0x21, 0x70, 0xB3, 0x00, 0x70, 0xA3, 0x03, 0x71, 
+    0x14, 0x42, 0x02, 0x22, 0x40, 0xF0, 0x29, 0x03, 0x10, 0x71, 0xB2, 0x42, 0xB5, 0x44, 0x01, 0x14, 
+    0xE0, 0x00, 0x40, 0xA2, 0x10, 0xE2, 0x13, 0x2C, 0xC2, 0x22, 0x33, 0xC3, 0x72, 0x10, 0xF3, 0x03, 
+    0x02, 0x71, 0x20, 0x42, 0x02, 0x02, 0x20, 0xF0, 0x28, 0x03, 0x1A, 0xA7, 0xC2, 0xA0, 0x02, 0x51, 
+    0x10, 0xA5, 0x05, 0x00, 0x02, 0x12, 0xF0, 0x00, 0xF2, 0x00, 0x42, 0x07, 0xE3, 0x33, 0xE3, 0xE2, 
+    0xA3, 0x01, 0x00, 0xA3, 0x03, 0x73, 0x32, 0x44, 0xF0, 0x1F, 0x00, 0xD0, 0xF0, 0x00, 0x04, 0x13, 
+    0x00, 0x10, 0xB2, 0x03, 0x00, 0x42, 0xF0, 0x03, 0x49, 0x00, 0x00, 0x47, 0x0A, 0x02, 0x2C, 0xF3, 
+    0x32, 0xCC, 0xE0, 0xA3, 0x02, 0x66, 0x60, 0x44, 0x00, 0x70, 0x4E, 0x02, 0x11, 0x10, 0x5A, 0x02, 
+    0xDD, 0x40, 0xC0, 0x03, 0x7A, 0x03, 0xC2, 0xD0, 0x04, 0x10, 0x00, 0x10, 0x43, 0x01, 0x14, 0xF0, 
+    0x00, 0x03, 0x42, 0x2E, 0xE2, 0xA3, 0x05, 0x2E, 0xEE, 0xC3, 0xB6, 0x09, 0x03, 0x3C, 0x33, 0x32, 
+    0x24, 0xF0, 0x04, 0x03, 0x51, 0x81, 0xF0, 0x03, 0x03, 0x40, 0x44, 0xF0, 0x00, 0x13, 0x4D, 0xD4, 
+    0x40, 0x40, 0x00, 0x10, 0x00, 0x11, 0x22, 0x02, 0xD0, 0x00, 0x50, 0x42, 0xB0, 0x05, 0x21, 0x24, 
+    0x44, 0xD0, 0x00, 0x40, 0xF2, 0x01, 0x11, 0x33, 0x3E, 0x2C, 0xC3, 0x3F, 0xF3, 0x33, 0x66, 0x6C, 
+    0xA3, 0x02, 0x22, 0x20, 0xF0, 0x06, 0x00, 0x50, 0x49, 0xE4, 0x46, 0x01, 0x40, 0xA4, 0x0B, 0x22, 
+    0x10, 0x90, 0x71, 0x11, 0x22, 0x43, 0x01, 0x55, 0x49, 0x00, 0x00, 0x46, 0x01, 0x44, 0x4A, 0xD3, 
+    0x04, 0xFF, 0x33, 0xC0, 0x43, 0x09, 0x33, 0x3C, 0x3C, 0x22, 0x24, 0x4D, 0x01, 0x51, 0xB0, 0xA1, 
+    0xDD, 0x01, 0x44, 0xD0, 0xB4, 0x0C, 0x22, 0x30, 0xA3, 0x73, 0x37, 0x12, 0x40, 0xA0, 0x08, 0x55, 
+    0x05, 0x11, 0x00, 0x50, 0x45, 0x01, 0x12, 0xA4, 0x04, 0x02, 0x20, 0x40, 0x4B, 0x06, 0x63, 0x3F, 
+    0x33, 0xF0, 0xC6, 0x0B, 0x96, 0x33, 0x3C, 0xC3, 0x22, 0x44, 0xF0, 0x05, 0x44, 0x09, 0x41, 0x8A, 
+    0xA1, 0xD1, 0x11, 0x42, 0x00, 0x40, 0x46, 0x0B, 0x21, 0x14, 0x10, 0xA7, 0x77, 0x32, 0xF0, 0x03, 
+    0x01, 0x52, 0x47, 0x00, 0x20, 0x42, 0x06, 0x24, 0x42, 0x24, 0x40, 0xF2, 0x01, 0x04, 0xC3, 0x3F, 
+    0xC0, 0x42, 0x00, 0x60, 0xB9, 0x06, 0x69, 0x66, 0x33, 0x30, 0x42, 0x02, 0x24, 0x40, 0x4C, 0x09, 
+    0x51, 0x04, 0x44, 0x11, 0x18, 0xC1, 0x02, 0xD4, 0x40, 0xC0, 0x01, 0x42, 0xA1, 0x06, 0x27, 0xA3, 
+    0x11, 0x30, 0xF0, 0x01, 0x02, 0x51, 0x10, 0xA0, 0x00, 0x50, 0xE0, 0x03, 0x12, 0x42, 0x4B, 0x04, 
+    0xC2, 0x23, 0xC0, 0xB3, 0x02, 0x6F, 0x60, 0xE9, 0xA6, 0x02, 0x3C, 0xC0, 0xA2, 0x01, 0x44, 0x4D, 
+    0x02, 0x10, 0x20, 0xF1, 0x02, 0x08, 0xD4, 0x44, 0x00, 0x04, 0x20, 0x43, 0x07, 0x22, 0x11, 0x12, 
+    0x12, 0xF0, 0x00, 0x01, 0xB1, 0x42, 0x02, 0xB1, 0x10, 0xE0, 0x02, 0x41, 0x20, 0x44, 0x02, 0x24, 
+    0x40, 0xA2, 0x03, 0xEE, 0x3C, 0x46, 0x00, 0x60, 0x44, 0x0A, 0x66, 0x99, 0x66, 0x60, 0x33, 0xE0, 
+    0xC2, 0xF0, 0x00, 0x0B, 0x10, 0x15, 0x51, 0x12, 0x11, 0x55, 0x4A, 0xB4, 0xA1, 0x03, 0x21, 0x31, 
+    0xA2, 0xE0, 0x01, 0x55, 0xD0, 0x01, 0x11, 0xE0, 0x03, 0x22, 0x24, 0x43, 0xC2, 0x04, 0x12, 0x22, 
+    0xC0, 0x43, 0xA6, 0x07, 0x90, 0x09, 0x66, 0x96, 0x42, 0x03, 0x60, 0x03, 0xC2, 0x00, 0x40, 0xD0, 
+    0x0D, 0x21, 0xB1, 0x55, 0x58, 0x81, 0x11, 0x55, 0x48, 0xB4, 0x00, 0x20, 0xB1, 0x03, 0x37, 0x11, 
+    0x4A, 0xF0, 0x09, 0x07, 0x42, 0x24, 0x00, 0x44, 0xF2, 0x02, 0xC3, 0x0B, 0x69, 0x99, 0x00, 0x09, 
+    0x96, 0x69, 0x43, 0x03, 0x60, 0x0E, 0xC2, 0xD0, 0x05, 0x55, 0x00, 0x55, 0xC1, 0x46, 0x05, 0x11, 
+    0xD4, 0x44, 0xE1, 0x03, 0x30, 0x33, 0x49, 0x00, 0x10, 0xF0, 0x0C, 0x43, 0xB2, 0x00, 0x10, 0xC2, 
+    0x00, 0xC0, 0x4A, 0x06, 0x09, 0x96, 0x99, 0x90, 0x44, 0x01, 0x3E, 0x4A, 0xA0, 0x04, 0x51, 0x11, 
+    0x50, 0x49, 0x01, 0x44, 0xF1, 0x03, 0x08, 0x33, 0x11, 0x12, 0x25, 0x20, 0xC0, 0x00, 0x50, 0xB0, 
+    0x00, 0xB0, 0xC0, 0x00, 0x50, 0x47, 0x00, 0x20, 0x46, 0xA2, 0x05, 0x12, 0x23, 0xCC, 0x42, 0x03, 
+    0x69, 0x99, 0x44, 0x01, 0x69, 0xB6, 0x01, 0x33, 0x50, 0x08, 0x18, 0x81, 0x55, 0x18, 0xB0, 0x45, 
+    0xF1, 0x05, 0x06, 0x81, 0x11, 0x25, 0x50, 0xF0, 0x04, 0x02, 0x51, 0x50, 0xC0, 0x02, 0x10, 0x50, 
+    0xD0, 0x01, 0x24, 0x47, 0x05, 0x11, 0x22, 0x2C, 0xA3, 0x43, 0x03, 0x99, 0x00, 0xA9, 0x02, 0x66, 
+    0x60, 0xB3, 0x01, 0xCE, 0x4C, 0xF5, 0x02, 0xC1, 0x02, 0x88, 0x80, 0xE1, 0x00, 0x80, 0xBA, 0x01, 
+    0x8B, 0x48, 0x09, 0x10, 0x00, 0x15, 0x11, 0x55, 0xC0, 0x00, 0x10, 0xE0, 0xF2, 0x00, 0x00, 0x10, 
+    0x43, 0x01, 0x2C, 0x43, 0x01, 0x66, 0xE9, 0x03, 0x66, 0x6F, 0xA3, 0x00, 0xC0, 0xC2, 0xF0, 0x00, 
+    0x03, 0x55, 0x50, 0xD5, 0xC1, 0x02, 0x55, 0x50, 0xE1, 0x00, 0x00, 0xA8, 0x04, 0xA0, 0xA0, 0x10, 
+    0x4B, 0x00, 0x50, 0x42, 0x02, 0xB1, 0x10, 0x43, 0x01, 0x15, 0x45, 0x00, 0x10, 0xA2, 0x03, 0x12, 
+    0x22, 0x44, 0x00, 0x20, 0xA3, 0xA6, 0xB9, 0xC6, 0x52, 0x05, 0x00, 0x55, 0x00, 0xD5, 0x06, 0x18, 
+    0x15, 0x55, 0x20, 0xB1, 0x0E, 0x88, 0x8A, 0x0A, 0xA0, 0xAA, 0xA0, 0x85, 0x50, 0x49, 0x0E, 0x0B, 
+    0x01, 0x10, 0x11, 0x10, 0x00, 0xB1, 0x10, 0x49, 0x04, 0x11, 0x12, 0x10, 0x45, 0x00, 0xC0, 0x45, 
+    0x03, 0x66, 0x99, 0xA6, 0x01, 0x99, 0x43, 0x00, 0x80, 0x4F, 0xB0, 0xB5, 0x00, 0x10, 0xB5, 0x00, 
+    0x20, 0xF1, 0x00, 0x0A, 0xA0, 0x0A, 0x8A, 0xA0, 0xB5, 0x10, 0xE0, 0x08, 0x10, 0x0B, 0x00, 0x11, 
+    0xB0, 0x42, 0x06, 0x10, 0x00, 0x11, 0x10, 0x44, 0x02, 0x22, 0x20, 0xF1, 0x00, 0x05, 0x22, 0xCC, 
+    0x2C, 0x45, 0x09, 0xF6, 0x63, 0xF6, 0x99, 0x6F, 0xB3, 0x00, 0x10, 0x53, 0x00, 0x00, 0xF5, 0x00, 
+    0x00, 0x20, 0xC1, 0x10, 0x83, 0x33, 0x81, 0x8A, 0x01, 0x88, 0x81, 0x11, 0x50, 0xD0, 0x09, 0xB0, 
+    0xB1, 0x00, 0x11, 0x10, 0x44, 0x06, 0x51, 0x15, 0x00, 0x00, 0xB2, 0xF1, 0x01, 0x02, 0x22, 0x10, 
+    0xA3, 0x0B, 0xF3, 0x36, 0x6F, 0x33, 0xF6, 0x66, 0xAF, 0x04, 0x0F, 0x00, 0x80, 0x4F, 0xC5, 0x00, 
+    0x20, 0xC5, 0xD1, 0x00, 0x30, 0xBA, 0xA3, 0x01, 0xAA, 0xB1, 0x00, 0xB0, 0xD0, 0x02, 0x50, 0x00, 
+    0xF1, 0x01, 0xA0, 0x02, 0x11, 0x10, 0xA0, 0x4C, 0x01, 0x11, 0x44, 0x02, 0xF3, 0x60, 0xAF, 0xA6, 
+    0x07, 0xFF, 0x90, 0x00, 0x88, 0x51, 0x05, 0x11, 0x55, 0x51, 0xA5, 0x00, 0x20, 0xC1, 0x03, 0x3A, 
+    0xAA, 0xB3, 0x0B, 0x73, 0x22, 0x10, 0xA1, 0x1B, 0x55, 0xF0, 0x01, 0x00, 0xB0, 0xD1, 0x04, 0xB0, 
+    0x00, 0xB0, 0x47, 0xF1, 0x07, 0x03, 0x33, 0xFF, 0xA6, 0x01, 0xFF, 0xA6, 0x08, 0xFF, 0xF0, 0x88, 
+    0x31, 0x10, 0x50, 0xB0, 0xB5, 0x00, 0x20, 0xC1, 0x17, 0xA0, 0xA3, 0x37, 0x11, 0x88, 0x22, 0x11, 
+    0x20, 0x10, 0x81, 0x15, 0x55, 0xE0, 0xE1, 0xA0, 0x04, 0x1B, 0x11, 0x10, 0x42, 0x00, 0x30, 0xF1, 
+    0x08, 0xA3, 0x43, 0x0F, 0xF3, 0xFF, 0xF3, 0x33, 0x11, 0x88, 0x51, 0x11, 0x52, 0x04, 0x00, 0x55, 
+    0x50, 0xC1, 0x01, 0x30, 0xBA, 0x01, 0x33, 0xA1, 0x0E, 0x21, 0x71, 0x00, 0x58, 0x1B, 0x15, 0x00, 
+    0x50, 0xA0, 0x01, 0x1B, 0xA1, 0x00, 0x00, 0x45, 0xA1, 0x03, 0x20, 0x01, 0x54, 0x01, 0x33, 0xAF, 
+    0xA3, 0x04, 0x88, 0x31, 0x20, 0x42, 0x03, 0x22, 0x55, 0xF0, 0x02, 0x00, 0x50, 0xF0, 0x01, 0xC1, 
+    0x01, 0x3A, 0xB9, 0x07, 0x09, 0x90, 0x33, 0xCE, 0xA2, 0x07, 0x40, 0x51, 0x11, 0xB5, 0xC0, 0x44, 
+    0x02, 0x11, 0xB0, 0xB0, 0x0A, 0x11, 0x51, 0x10, 0x23, 0x22, 0x70, 0xF1, 0x08, 0x00, 0x80, 0xE3, 
+    0x06, 0x83, 0xA8, 0x30, 0x80, 0x46, 0xF0, 0x03, 0x00, 0x10, 0xF0, 0x02, 0x18, 0x1A, 0x11, 0xAA, 
+    0xA3, 0x3A, 0xA1, 0x11, 0x33, 0x30, 0x03, 0x3E, 0x22, 0x20, 0xA0, 0x03, 0x51, 0xB5, 0xC0, 0xD1, 
+    0x11, 0xD0, 0x50, 0x10, 0x11, 0x21, 0x12, 0x82, 0x22, 0x33, 0xA1, 0x00, 0x20, 0xF1, 0x04, 0xA8, 
+    0xA3, 0x0A, 0x03, 0x20, 0x01, 0x58, 0x15, 0x20, 0xF0, 0x13, 0x0A, 0x12, 0x1A, 0x38, 0x17, 0x13, 
+    0x10, 0xB0, 0xA2, 0x05, 0x3E, 0xE2, 0x22, 0xB0, 0x02, 0x51, 0xB0, 0xB0, 0xD1, 0x10, 0x00, 0x0B, 
+    0x11, 0x12, 0x51, 0x11, 0x22, 0x18, 0xA0, 0xF1, 0x09, 0xB8, 0x08, 0x30, 0x00, 0x81, 0x88, 0x20, 
+    0x42, 0x00, 0x50, 0xF0, 0x05, 0x00, 0x40, 0xF0, 0x08, 0x08, 0xAA, 0x33, 0x11, 0x77, 0x10, 0xE0, 
+    0xD2, 0x0B, 0x40, 0x44, 0x5B, 0x50, 0x50, 0x05, 0xD1, 0x07, 0x00, 0x05, 0x11, 0x00, 0x42, 0x04, 
+    0x13, 0x8A, 0x30, 0xF1, 0x09, 0x0B, 0x88, 0x83, 0x90, 0x99, 0x32, 0x88, 0xB5, 0xF0, 0x16, 0x0C, 
+    0x10, 0x01, 0x1B, 0x11, 0x22, 0x11, 0x40, 0xF0, 0x00, 0xD2, 0x06, 0x40, 0x05, 0x50, 0x50, 0x47, 
+    0x07, 0x55, 0x50, 0x11, 0x05, 0x42, 0x05, 0xE1, 0x18, 0x37, 0xF1, 0x04, 0x12, 0x22, 0x21, 0x11, 
+    0x80, 0x0A, 0x00, 0x32, 0x11, 0x55, 0x50, 0xF0, 0x04, 0x01, 0x44, 0xF0, 0x0D, 0x09, 0x1B, 0x15, 
+    0x10, 0x01, 0x14, 0xF0, 0x01, 0x00, 0x40, 0xC2, 0x00, 0x40, 0xD0, 0x16, 0x55, 0x5B, 0xB0, 0xB1, 
+    0x15, 0x00, 0x52, 0x51, 0x12, 0x22, 0x11, 0x70, 0x4B, 0xC2, 0x00, 0x10, 0xAA, 0x07, 0x00, 0x12, 
+    0x25, 0x55, 0xF0, 0x04, 0x03, 0x41, 0x14, 0xF0, 0x0E, 0x08, 0x10, 0x01, 0x00, 0x11, 0x40, 0xF0, 
+    0x02, 0x00, 0x40, 0xB2, 0x00, 0x40, 0x45, 0xB0, 0x05, 0x11, 0x1B, 0x50, 0xC1, 0x06, 0x21, 0x88, 
+    0x77, 0x70, 0xF1, 0x01, 0xB2, 0x03, 0x11, 0x39, 0xA0, 0x04, 0x81, 0x55, 0x50, 0xF0, 0x03, 0xA4, 
+    0x01, 0x1D, 0xF0, 0x10, 0x00, 0xB0, 0xB0, 0x4B, 0x01, 0x00, 0xB2, 0xD0, 0x00, 0x50, 0xB0, 0xA1, 
+    0x05, 0x52, 0x11, 0x18, 0xA1, 0x04, 0x87, 0x33, 0x70, 0xF1, 0x01, 0xB2, 0x09, 0x89, 0x03, 0x88, 
+    0x15, 0x55, 0xF0, 0x05, 0xF4, 0x00, 0xF0, 0x0E, 0x00, 0x10, 0xB0, 0x00, 0xD0, 0xF0, 0x06, 0xA2, 
+    0x00, 0x40, 0xF0, 0x02, 0x06, 0x11, 0xB5, 0xB0, 0x20, 0xB1, 0x02, 0x21, 0x10, 0x42, 0x00, 0x70, 
+    0xF1, 0x02, 0x0A, 0x21, 0x1A, 0x81, 0x22, 0x55, 0x50, 0xF0, 0x08, 0x09, 0x4D, 0xDD, 0x1D, 0x44, 
+    0x02, 0xF0, 0x0C, 0x00, 0x50, 0xF0, 0x0D, 0xA2, 0x00, 0x40, 0xF0, 0x00, 0x07, 0x5B, 0x1B, 0x01, 
+    0xB0, 0xB1, 0x08, 0x52, 0x33, 0x37, 0x33, 0x30, 0xF1, 0x03, 0x04, 0xA8, 0x15, 0x50, 0xF0, 0x0D, 
+    0x08, 0x4D, 0x11, 0x14, 0x40, 0x10, 0xF0, 0x24, 0xA2, 0x02, 0x00, 0x50, 0x45, 0x07, 0x11, 0x10, 
+    0x51, 0x00, 0xA1, 0x09, 0x21, 0x33, 0xEE, 0x33, 0x37, 0xF1, 0x01, 0x03, 0x38, 0x55, 0xF0, 0x10, 
+    0x08, 0x4D, 0x11, 0xDD, 0xD1, 0x20, 0xF0, 0x24, 0x03, 0x22, 0x24, 0xF0, 0x00, 0x08, 0x15, 0x11, 
+    0x01, 0x10, 0x20, 0xA1, 0x0A, 0x22, 0x7E, 0xE7, 0x73, 0x03, 0x70, 0xE1, 0x01, 0x01, 0xF0, 0x01, 
+    0x00, 0x40, 0xF0, 0x04, 0x05, 0x44, 0x4D, 0xDD, 0xB1, 0x54, 0x00, 0xB0, 0xF0, 0x0F, 0xA2, 0x04, 
+    0x00, 0x5B, 0xB0, 0xA0, 0x06, 0x50, 0x11, 0x01, 0x40, 0x45, 0x03, 0xE2, 0xE7, 0xB3, 0xD1, 0x01, 
+    0x81, 0x49, 0x01, 0x14, 0xF0, 0x02, 0x05, 0x44, 0x04, 0x4D, 0xC1, 0x54, 0xF0, 0x11, 0xA2, 0x04, 
+    0x00, 0x55, 0x50, 0xA0, 0x05, 0x24, 0x1D, 0x44, 0xB1, 0xA2, 0x07, 0xE7, 0x37, 0x30, 0x37, 0xA1, 
+    0x04, 0xAA, 0x10, 0x50, 0x49, 0x00, 0xD0, 0x4B, 0x02, 0x44, 0xD0, 0x45, 0xF0, 0x28, 0x08, 0x42, 
+    0xE2, 0x40, 0x51, 0x50, 0xB0, 0x06, 0x11, 0x44, 0x41, 0x20, 0x44, 0x0F, 0x77, 0xEE, 0x37, 0x73, 
+    0xA1, 0xA1, 0x1B, 0x0B, 0xF0, 0x0F, 0xBD, 0xD1, 0xF0, 0x28, 0xB2, 0x02, 0x00, 0x10, 0xB0, 0x01, 
+    0x21, 0xA4, 0x04, 0x12, 0x01, 0x10, 0x43, 0x03, 0x2E, 0xE2, 0xD1, 0xF0, 0x12, 0x02, 0xDD, 0xD0, 
+    0xF1, 0x00, 0xF0, 0x29, 0xB2, 0x02, 0x00, 0x50, 0xB0, 0x08, 0x11, 0x44, 0x04, 0x20, 0x00, 0xA2, 
+    0x00, 0xE0, 0xA2, 0x00, 0x40, 0xC1, 0xF0, 0x02, 0x03, 0x40, 0x44, 0xF0, 0x04, 0xF1, 0x02, 0x00, 
+    0x20, 0xF0, 0x2A, 0xC2, 0xD0, 0x00, 0x10, 0xA2, 0xA0, 0xA2, 0x09, 0x44, 0x24, 0x01, 0xB1, 0x01, 
+    0xF0, 0x02, 0x04, 0x41, 0x1D, 0xD0, 0x56, 0xF0, 0x2C, 0xB2, 0x00, 0x50, 0xD0, 0x08, 0x22, 0x11, 
+    0x20, 0x00, 0x50, 0x42, 0x08, 0x24, 0x00, 0x55, 0x00, 0xB0, 0xF0, 0x00, 0x01, 0x44, 0xB1, 0x00, 
+    0x40, 0xC0, 0x05, 0x44, 0x40, 0x44, 0x7E, 0x00, 0x00, 0xB2, 0x4A, 0x08, 0x40, 0x00, 0x22, 0x44, 
+    0x40, 0xA0, 0x00, 0xB0, 0xF0, 0x02, 0x00, 0x40, 0xD1, 0x0A, 0x24, 0x00, 0x04, 0xD1, 0x1D, 0x40, 
+    0x4A, 0xF0, 0x2E, 0x00, 0x40, 0x4A, 0x04, 0x11, 0x12, 0x10, 0x43, 0x00, 0x00, 0x44, 0xF0, 0x03, 
+    0xE1, 0x04, 0x44, 0x40, 0x40, 0xB1, 0x01, 0xDD, 0xF1, 0x02, 0xF0, 0x2F, 0x01, 0x24, 0x47, 0x04, 
+    0x01, 0x12, 0x00, 0x42, 0x03, 0x52, 0x04, 0xF0, 0x07, 0xE1, 0x04, 0x44, 0x04, 0x00, 0xF1, 0x09, 
+    0xF0, 0x30, 0x04, 0x42, 0x22, 0x50, 0xD0, 0x03, 0x52, 0x25, 0xB0, 0x01, 0x42, 0xF0, 0x07, 0xF1, 
+    0x00, 0x01, 0x40, 0x52, 0xF0, 0x32, 0xA2, 0xF0, 0x00, 0x00, 0x50, 0xF0, 0x0F, 0xE1, 0x00, 0x20, 
+    0xC4, 0xF1, 0x06, 0x02, 0x40, 0x50, 0x7F, 0xF0, 0x15, 0xA1, 0x07, 0x44, 0x11, 0x40, 0x00, 0x50, 
+    0x01, 0x02, 0xF0, 0x31, 0x02, 0x22, 0x20, 0xF0, 0x1A, 0x02, 0x11, 0x10, 0xB4, 0xA0, 0x01, 0x44, 
+    0xF1, 0x06, 0x00, 0x20, 0xF0, 0x33, 0x03, 0x22, 0x24, 0xF0, 0x18, 0xB1, 0x03, 0x44, 0x42, 0xA4, 
+    0xF1, 0x09, 0x00, 0x20, 0xF0, 0x33, 0x6E, 0xF1, 0x0A, 0x00, 0x50, 0x7F, 0x00, 0x40, 0x64, 0xF1, 
+    0x0B, 0x02, 0x21, 0x50, 0xF0, 0x35, 0x08, 0x22, 0x05, 0x22, 0x05, 0x50, 0xF0, 0x11, 0x00, 0x20, 
+    0x59, 0xF0, 0x38, 0x07, 0x20, 0x21, 0x25, 0x55, 0xF0, 0x12, 0xB1, 0x02, 0x44, 0x00, 0xE1, 0x00, 
+    0x70, 0xF1, 0x00, 0x04, 0x40, 0x05, 0x20, 0xF0, 0x58, 0x45, 0x00, 0x40, 0xF1, 0x09, 0x03, 0x02, 
+    0x55, 0xF0, 0x3F, 0x03, 0xB5, 0x55, 0x6D, 0x03, 0x42, 0x22, 0xF0, 0x3E, 0x06, 0x1B, 0x88, 0x11, 
+    0x10, 0x58, 0xF1, 0x0A, 0x03, 0x22, 0x12, 0xF0, 0x3E, 0x08, 0xB1, 0xB1, 0x18, 0xB1, 0x10, 0x6A, 
+    0x02, 0x11, 0x20, 0xF0, 0x39, 0x0F, 0x24, 0x00, 0x05, 0x1B, 0x5B, 0x11, 0xBB, 0x15, 0x69, 0x01, 
+    0x22, 0xF0, 0x3A, 0x01, 0x22, 0xA0, 0x0A, 0x18, 0x5B, 0x81, 0x5B, 0x85, 0xB0, 0x69, 0xF0, 0x41, 
+    0x0B, 0x1B, 0xBB, 0x11, 0xBB, 0x81, 0xB5, 0x67, 0xF0, 0x42, 0x0B, 0xBB, 0xB5, 0xB1, 0x51, 0x1B, 
+    0x5B, 0x7F, 0x72, 0x0A, 0x85, 0xB5, 0x15, 0x51, 0xBB, 0x10, 0x60, 0x01, 0x73, 0x7F, 0xF0, 0x06, 
+    0x02, 0x58, 0x50, 0xAB, 0x04, 0x5B, 0x18, 0x80, 0xF0, 0x07, 0x00, 0x40, 0xF1, 0x01, 0x07, 0x4D, 
+    0x11, 0x33, 0x36, 0x7F, 0xF0, 0x08, 0x0A, 0x8B, 0xB5, 0x5B, 0x51, 0x88, 0x10, 0x59, 0x03, 0x11, 
+    0x13, 0xA6, 0xC1, 0xF0, 0x43, 0x0A, 0x5B, 0xB5, 0xB5, 0x55, 0xB1, 0x50, 0xF0, 0x07, 0x05, 0x22, 
+    0xD1, 0x72, 0xB1, 0x02, 0x66, 0x30, 0xA6, 0xD1, 0xF0, 0x44, 0xD5, 0x01, 0xB5, 0xF0, 0x08, 0x02, 
+    0x22, 0x20, 0xC1, 0x07, 0x21, 0x33, 0x36, 0x33, 0xE1, 0xF0, 0x49, 0x01, 0x55, 0xF0, 0x0A, 0x05, 
+    0x21, 0x11, 0x47, 0xA1, 0x00, 0x60, 0xA3, 0xF1, 0x01, 0xF0, 0x5E, 0x42, 0x07, 0x12, 0x11, 0x03, 
+    0x93, 0xF1, 0x04, 0xF0, 0x5E, 0xA2, 0x08, 0x11, 0x14, 0x13, 0x33, 0x20, 0xC1, 0x01, 0x33, 0x7F, 
+    0xF0, 0x20, 0x0A, 0x21, 0x22, 0x40, 0x20, 0x19, 0x30, 0xF1, 0x00, 0x01, 0x3A, 0x7F, 0x68, 0x02, 
+    0x22, 0x20, 0xA0, 0x06, 0xA3, 0x21, 0x22, 0x20, 0xF1, 0x02, 
+};
+
+const gfx_image_t STORY_CH7_ENEMY_IMG = {
+    .w = STORY_CH7_ENEMY_W, .h = STORY_CH7_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH7_ENEMY_PAL, .colors = STORY_CH7_ENEMY_PAL_SIZE,
+    .data = STORY_CH7_ENEMY_RLE, .size = STORY_CH7_ENEMY_RLE_SIZE,
 };
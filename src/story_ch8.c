@@ -6,329 +6,250 @@ const uint16_t STORY_CH8_PAL[STORY_CH8_PAL_SIZE] = {
     0x39C8, 0xF946, 0xF10B, 0x22CB, 0xCD91, 0xCD0E, 0x64D2, 0xA111, 
 };
 
-const uint8_t STORY_CH8_IDX[(STORY_CH8_W * STORY_CH8_H) / 2] = {
-    0x44, 0x44, 0x11, 0x11, 0x11, 0x6C, 0x61, 0x34, 0x41, 0x11, 0x31, 0x11, 0x11, 0x11, 0x18, 0x11, 
-    0x11, 0x01, 0x18, 0x11, 0x11, 0x14, 0xC0, 0xC4, 0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x18, 
-    0x81, 0x11, 0x11, 0x11, 0x51, 0x0C, 0x17, 0x11, 0x11, 0x10, 0x70, 0x72, 0x21, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x34, 0x44, 0x33, 0x34, 0xCC, 0xC0, 0xCC, 0xC4, 0x31, 0x34, 0x31, 0x11, 0x11, 0x11, 
-    0x44, 0x43, 0x11, 0x11, 0x13, 0xC6, 0x41, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x80, 0x11, 
-    0x15, 0x01, 0x81, 0x11, 0x11, 0x36, 0x0C, 0x61, 0x11, 0x11, 0x11, 0x3C, 0xC1, 0x11, 0x11, 0x08, 
-    0x81, 0x17, 0x11, 0x11, 0x21, 0xC4, 0x11, 0x11, 0x11, 0x17, 0x02, 0x72, 0x22, 0x17, 0x11, 0x11, 
-    0x11, 0x13, 0x34, 0x44, 0x43, 0x43, 0x3C, 0xC0, 0x0C, 0xDC, 0x04, 0x36, 0x41, 0x11, 0x11, 0x11, 
-    0xC4, 0x43, 0x16, 0x11, 0x14, 0x6C, 0x43, 0x43, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 
-    0x12, 0x11, 0x71, 0x11, 0x11, 0x46, 0x04, 0x41, 0x11, 0x11, 0x14, 0xDC, 0x31, 0x11, 0x11, 0x08, 
-    0x81, 0x11, 0x11, 0x15, 0x13, 0xC4, 0x11, 0x11, 0x11, 0x11, 0x07, 0x72, 0x55, 0x12, 0x21, 0x11, 
-    0x11, 0x11, 0x14, 0x33, 0x43, 0x46, 0x11, 0x44, 0xC6, 0xCC, 0xC0, 0x63, 0x46, 0x11, 0x11, 0x11, 
-    0xD3, 0x11, 0xC6, 0x11, 0x16, 0x66, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x17, 0x11, 0x11, 0x14, 0x46, 0x63, 0x61, 0x11, 0x11, 0x36, 0x44, 0x11, 0x11, 0x11, 0x00, 
-    0x03, 0x11, 0x77, 0x21, 0x34, 0x66, 0x11, 0x11, 0x11, 0x11, 0x00, 0x15, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x13, 0x34, 0x43, 0x33, 0x36, 0x63, 0x11, 0x36, 0x00, 0xDD, 0x64, 0x44, 0x41, 0x11, 0x11, 
-    0x41, 0x16, 0xC3, 0x11, 0x46, 0x11, 0x44, 0x11, 0x14, 0x11, 0x11, 0x71, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x36, 0x34, 0x36, 0x41, 0x11, 0x11, 0x64, 0xC4, 0x31, 0x11, 0x10, 0x01, 
-    0x44, 0x11, 0x07, 0x11, 0x43, 0x34, 0x11, 0x11, 0x17, 0x71, 0x10, 0x27, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x31, 0x11, 0x33, 0xC6, 0x31, 0x14, 0x00, 0x0C, 0xD4, 0x44, 0x11, 0x11, 0x11, 
-    0x41, 0x36, 0x41, 0x11, 0x46, 0x14, 0x63, 0x11, 0x13, 0x11, 0x11, 0x81, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x34, 0x12, 0x11, 0x73, 0xC4, 0x4D, 0x41, 0x13, 0x12, 0x03, 
-    0x63, 0x11, 0x70, 0x11, 0x44, 0x13, 0x11, 0x10, 0x18, 0x87, 0x10, 0x00, 0x71, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x33, 0x11, 0x33, 0x4C, 0x61, 0x11, 0x46, 0x6C, 0xD4, 0x33, 0x46, 0x41, 0x11, 
-    0x44, 0x44, 0x11, 0x34, 0x44, 0x46, 0x11, 0x13, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x54, 0x61, 0x44, 0x11, 0x11, 0x13, 0x33, 0xCC, 0x41, 0x11, 0x17, 0x24, 
-    0x41, 0x18, 0x70, 0x13, 0xC3, 0x11, 0x71, 0x00, 0x10, 0x00, 0x02, 0x00, 0x21, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x34, 0x43, 0x11, 0x13, 0x64, 0x44, 0x43, 0x4C, 0xC4, 0x11, 
-    0x44, 0x44, 0x14, 0x46, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x12, 0x11, 0x36, 0x41, 0x41, 0x11, 0x11, 0x13, 0x34, 0x0D, 0x41, 0x13, 0x10, 0x14, 
-    0x11, 0x18, 0x02, 0x14, 0xC1, 0x11, 0x01, 0x80, 0x10, 0x00, 0x01, 0x10, 0x07, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x14, 0x43, 0x11, 0x16, 0x44, 0x44, 0x44, 0xCC, 0x43, 
-    0x44, 0xC4, 0x4D, 0x46, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x36, 0x11, 0x11, 0x11, 0x11, 0x14, 0x30, 0xD4, 0x31, 0x13, 0x12, 0x43, 
-    0x11, 0x18, 0x02, 0x14, 0x31, 0x11, 0x01, 0x80, 0x00, 0x00, 0x22, 0x20, 0x02, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x33, 0x44, 0x11, 0x11, 0x63, 0x14, 0x44, 0x46, 0x63, 
-    0x34, 0x43, 0x64, 0x46, 0x44, 0x35, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x34, 0x11, 0x11, 0x11, 0x11, 0x34, 0x4D, 0xD3, 0x11, 0x13, 0x11, 0x61, 
-    0x11, 0x71, 0x10, 0x16, 0x11, 0x11, 0x08, 0x80, 0x00, 0x00, 0x21, 0x52, 0x00, 0x02, 0x11, 0x11, 
-    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x34, 0x31, 0x11, 0x11, 0x13, 0x44, 0x44, 0x4C, 
-    0x46, 0x34, 0x64, 0x44, 0x11, 0x31, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x11, 0x11, 0x43, 0x44, 0xC1, 0x11, 0x33, 0x16, 0x31, 
-    0x11, 0x81, 0x30, 0x13, 0x11, 0x11, 0x10, 0x70, 0x00, 0x00, 0x01, 0x12, 0x00, 0x02, 0x51, 0x11, 
-    0x11, 0x15, 0x11, 0x12, 0x22, 0x55, 0x11, 0x53, 0x43, 0x41, 0x11, 0x11, 0x31, 0x44, 0x44, 0xCC, 
-    0x66, 0x46, 0x44, 0x43, 0x44, 0x43, 0x11, 0x11, 0x51, 0x11, 0x11, 0x11, 0x81, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x14, 0x31, 0x11, 0x13, 0x40, 0xC1, 0x11, 0x31, 0x16, 0x11, 
-    0x17, 0x81, 0x10, 0x11, 0x11, 0x77, 0x10, 0x10, 0x00, 0x00, 0x05, 0x20, 0x11, 0x00, 0x02, 0x11, 
-    0x11, 0x11, 0x12, 0x11, 0x52, 0x55, 0x11, 0x11, 0x34, 0x11, 0x11, 0x11, 0x11, 0x13, 0x44, 0xDD, 
-    0x66, 0x43, 0x31, 0x14, 0x43, 0x31, 0x11, 0x15, 0x11, 0x01, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x13, 0xC0, 0x41, 0x21, 0x34, 0x41, 0x11, 
-    0x67, 0x06, 0x10, 0x88, 0x11, 0x78, 0x10, 0x88, 0x00, 0x00, 0x00, 0x50, 0x21, 0x00, 0x00, 0x01, 
-    0x21, 0x11, 0x12, 0x07, 0x15, 0x21, 0x11, 0x11, 0x11, 0x41, 0x51, 0x13, 0x11, 0x11, 0x13, 0x44, 
-    0x43, 0x43, 0x11, 0x34, 0x33, 0x31, 0x11, 0x12, 0x12, 0x01, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x41, 0x13, 0x36, 0x36, 0xC4, 0x31, 0x11, 0x56, 0x47, 0x16, 
-    0x10, 0x1C, 0x10, 0x10, 0x11, 0x70, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x07, 
-    0x72, 0x20, 0x10, 0x00, 0x02, 0x02, 0x11, 0x11, 0x11, 0x44, 0x51, 0x14, 0x41, 0x11, 0x11, 0x13, 
-    0x33, 0xD3, 0x51, 0x43, 0x34, 0x31, 0x15, 0x22, 0x22, 0x81, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x12, 0x16, 0x11, 0x43, 0x33, 0x43, 0xC6, 0x34, 0x34, 0x13, 0x12, 0x16, 0x17, 0x16, 
-    0x12, 0x4C, 0x28, 0x10, 0x07, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x80, 
-    0x72, 0x20, 0x17, 0x00, 0x01, 0x00, 0x21, 0x51, 0x11, 0x13, 0x12, 0x13, 0x44, 0x11, 0x11, 0x11, 
-    0x34, 0x45, 0x21, 0x44, 0x43, 0x11, 0x12, 0x00, 0x08, 0x81, 0x51, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x52, 0x41, 0x36, 0x43, 0x36, 0x64, 0xC3, 0xCC, 0xC4, 0x13, 0x12, 0x46, 0x12, 0x43, 
-    0x73, 0xC4, 0x81, 0x10, 0x00, 0x88, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x20, 0x20, 0x01, 0x70, 0x00, 0x00, 0x02, 0x52, 0x51, 0x51, 0x15, 0x21, 0x31, 0x11, 0x31, 0x11, 
-    0x34, 0x15, 0x54, 0x33, 0x33, 0x34, 0x32, 0x00, 0x08, 0x81, 0x51, 0x81, 0x11, 0x11, 0x11, 0x21, 
-    0x70, 0x25, 0x21, 0x63, 0x66, 0x46, 0x63, 0x46, 0xC3, 0x6C, 0x43, 0x33, 0x35, 0x64, 0x11, 0x41, 
-    0x14, 0x41, 0x01, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x02, 0x00, 0x15, 0x02, 0x22, 0x02, 0x11, 0x25, 0x52, 0x11, 0x15, 0x13, 0x11, 0x13, 0x11, 
-    0x13, 0x15, 0x11, 0x14, 0x43, 0x66, 0x10, 0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x10, 0x12, 0x20, 
-    0x21, 0x11, 0x21, 0x63, 0x13, 0x66, 0x41, 0x40, 0x64, 0x44, 0x11, 0x11, 0x33, 0x41, 0x14, 0x45, 
-    0x34, 0x11, 0x01, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0x22, 0x51, 0x15, 0x25, 0x55, 0x22, 0x51, 0x11, 0x11, 0x33, 
-    0x11, 0x52, 0x11, 0x44, 0x44, 0x63, 0x20, 0x00, 0x00, 0x11, 0x0B, 0xB1, 0x11, 0x17, 0x12, 0x11, 
-    0x34, 0x50, 0x23, 0x11, 0x11, 0x36, 0x11, 0xCC, 0x44, 0x34, 0x11, 0x11, 0x36, 0x11, 0x14, 0x17, 
-    0x11, 0x11, 0x07, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x52, 0x21, 0x12, 0x15, 0x55, 0x52, 0x25, 0x51, 0x11, 0x11, 
-    0x11, 0x51, 0x44, 0x44, 0x44, 0x31, 0x20, 0x00, 0x00, 0x1B, 0x81, 0x11, 0x11, 0x70, 0x21, 0x11, 
-    0x11, 0x10, 0x11, 0x11, 0x11, 0x30, 0x11, 0x04, 0x44, 0x34, 0x33, 0x15, 0x16, 0x41, 0x14, 0x27, 
-    0x02, 0x12, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x52, 0x52, 0x22, 0x20, 0x21, 0x05, 0x52, 0x21, 0x15, 
-    0x11, 0x11, 0x44, 0x44, 0x34, 0x41, 0x00, 0x00, 0x00, 0x11, 0x18, 0x11, 0x11, 0x77, 0x71, 0x11, 
-    0x11, 0x51, 0x13, 0x33, 0x11, 0x66, 0x26, 0xC4, 0x66, 0x11, 0x44, 0x32, 0x16, 0x61, 0x14, 0x27, 
-    0x25, 0x10, 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x01, 0x12, 0x22, 0x21, 0x12, 0x00, 0x00, 
-    0x11, 0x11, 0x33, 0x33, 0x34, 0x35, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x01, 0x61, 0x11, 0x14, 0x61, 0x16, 0xC3, 0x31, 0x16, 0x43, 0x31, 0x16, 0x41, 0x11, 0x12, 
-    0x01, 0x12, 0x00, 0x21, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x11, 0x25, 0x53, 0x15, 0x05, 0x00, 
-    0x14, 0x11, 0x33, 0x13, 0x31, 0x15, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x51, 0x11, 0x11, 0x16, 0x41, 0x14, 0x61, 0x11, 0x36, 0x35, 0x15, 0x46, 0x61, 0x11, 0x12, 
-    0x03, 0x37, 0x00, 0x01, 0x00, 0x07, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x55, 0x22, 0x22, 0x22, 0x23, 0x31, 0x01, 0x10, 
-    0x33, 0x11, 0x11, 0x11, 0x50, 0x20, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x16, 0x31, 0x16, 0x61, 0x11, 0x13, 0x15, 0x55, 0x16, 0x61, 0x11, 0x10, 
-    0x01, 0x37, 0x00, 0x00, 0x00, 0x07, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x25, 0x55, 0x20, 0x22, 0x01, 0x31, 0x01, 0x10, 
-    0x11, 0x11, 0x11, 0x63, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x6C, 0x63, 0x36, 0x31, 0x11, 0x11, 0x15, 0x21, 0x46, 0x11, 0x11, 0x30, 
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x52, 0x25, 0x02, 0x50, 0x51, 0x11, 0x11, 
-    0x13, 0x50, 0x16, 0x61, 0x02, 0x55, 0x00, 0x00, 0x1B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x13, 0x64, 0x33, 0x66, 0x11, 0x15, 0x11, 0x12, 0x13, 0x13, 0x11, 0x11, 0x10, 
-    0x05, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x21, 0x20, 0x22, 0x05, 0x15, 0x11, 
-    0x11, 0x21, 0x14, 0x11, 0x01, 0x11, 0x20, 0x07, 0x00, 0x70, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x16, 0x41, 0x16, 0x63, 0x11, 0x10, 0x11, 0x22, 0x13, 0x31, 0x11, 0x16, 0x10, 
-    0x05, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x50, 0x00, 0x00, 0x11, 0x11, 
-    0x55, 0x11, 0x43, 0x10, 0x11, 0x12, 0x00, 0x07, 0x70, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x66, 0x31, 0x46, 0x11, 0x11, 0x52, 0x21, 0x11, 0x11, 0x31, 0x11, 0x11, 0x70, 
-    0x01, 0x10, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x51, 0x14, 0x43, 0x50, 0x11, 0x10, 0x00, 0x08, 0x80, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x14, 0x44, 0x33, 0x31, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 
-    0x02, 0x70, 0x00, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x50, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x14, 0x31, 0x02, 0x11, 0x10, 0x00, 0x70, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x21, 0x11, 
-    0x11, 0x13, 0x13, 0x44, 0x31, 0x11, 0x11, 0x11, 0x12, 0x01, 0x11, 0x11, 0x11, 0x34, 0x17, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x45, 0x50, 0x00, 0x00, 0x05, 
-    0x11, 0x33, 0x10, 0x01, 0x11, 0x00, 0x07, 0x00, 0x08, 0x80, 0x00, 0x01, 0x11, 0x15, 0x01, 0x15, 
-    0x11, 0x16, 0x11, 0x14, 0x11, 0x11, 0x11, 0x11, 0x12, 0x15, 0x51, 0x11, 0x11, 0x34, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x61, 0x50, 0x00, 0x00, 0x00, 
-    0x51, 0x11, 0x10, 0x01, 0x12, 0x00, 0x05, 0x07, 0x77, 0x77, 0x80, 0x07, 0x73, 0x32, 0x11, 0x21, 
-    0x11, 0x33, 0x71, 0x41, 0x11, 0x23, 0x33, 0x35, 0x22, 0x12, 0x73, 0x33, 0x11, 0x33, 0x31, 0x00, 
-    0x00, 0x20, 0x00, 0x70, 0x00, 0x00, 0x73, 0x17, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x00, 0x00, 
-    0x00, 0x51, 0x72, 0x20, 0x00, 0x02, 0x00, 0x02, 0x22, 0x22, 0x01, 0x11, 0x10, 0x20, 0x00, 0x00, 
-    0x13, 0x11, 0x00, 0x11, 0x50, 0x00, 0x00, 0x70, 0x99, 0x90, 0x00, 0x07, 0xA9, 0x99, 0x00, 0x21, 
-    0x11, 0x09, 0x93, 0xE2, 0x11, 0x10, 0x99, 0x3B, 0x22, 0x57, 0x09, 0x96, 0xB3, 0x60, 0x9E, 0x00, 
-    0x00, 0xA3, 0x07, 0xA3, 0xB0, 0x0F, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x00, 0x00, 0x99, 0x0B, 0x00, 0xFA, 0x6B, 0x7A, 0x99, 0x90, 0xB0, 0x11, 0x15, 0x52, 0x00, 0x00, 
-    0x11, 0x11, 0x00, 0x15, 0x12, 0x00, 0x00, 0x7A, 0x01, 0x53, 0x31, 0xB7, 0xA0, 0x30, 0x33, 0x11, 
-    0x3A, 0x03, 0x30, 0x31, 0x1F, 0xA0, 0x33, 0x03, 0x10, 0x0A, 0x33, 0x30, 0x31, 0x60, 0x90, 0x08, 
-    0x00, 0xA4, 0x07, 0xA3, 0xB0, 0x0A, 0x33, 0x03, 0x18, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x07, 0x03, 0x30, 0x03, 0x10, 0xF9, 0x6B, 0x7A, 0x01, 0x23, 0x31, 0x01, 0x55, 0x52, 0x00, 0x00, 
-    0x11, 0x11, 0x00, 0x51, 0x61, 0x00, 0x80, 0x7A, 0x00, 0x0F, 0x96, 0xB7, 0xA3, 0xB0, 0xF9, 0xEB, 
-    0xFA, 0x4E, 0x10, 0x9E, 0x1F, 0x96, 0x03, 0x09, 0xE0, 0xF9, 0xE1, 0x30, 0x9E, 0x10, 0x99, 0x0B, 
-    0x00, 0xA4, 0x00, 0x00, 0x08, 0x00, 0x01, 0x0A, 0x6B, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x00, 0xA4, 0xB0, 0x09, 0xE0, 0x0A, 0x60, 0x7A, 0x3B, 0x0F, 0x9E, 0x05, 0x55, 0x55, 0x00, 0x00, 
-    0x11, 0x10, 0x21, 0x61, 0x31, 0x00, 0x00, 0x7A, 0x00, 0x0F, 0xA6, 0xB0, 0xA0, 0x30, 0xA3, 0xE1, 
-    0xFA, 0x03, 0x0A, 0x9E, 0x1F, 0xA6, 0x11, 0x10, 0x00, 0xF9, 0xE1, 0x10, 0x9E, 0x10, 0x9E, 0xFA, 
-    0x10, 0xA4, 0x00, 0x00, 0x00, 0x03, 0x10, 0x31, 0xB0, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x07, 0xA0, 0x30, 0xA9, 0xE0, 0x0A, 0x60, 0x7A, 0x01, 0x20, 0x30, 0x13, 0x50, 0x25, 0x52, 0x00, 
-    0x11, 0x11, 0x14, 0x11, 0x10, 0x00, 0x00, 0x7A, 0x00, 0x0F, 0xA6, 0xB0, 0xA9, 0x99, 0x00, 0x21, 
-    0x0A, 0x99, 0x99, 0x9E, 0x10, 0xA4, 0x0A, 0xA0, 0xB0, 0x09, 0x60, 0x70, 0x0E, 0x10, 0x9E, 0x70, 
-    0x0A, 0x96, 0x00, 0x00, 0x00, 0x07, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x07, 0xA9, 0x99, 0x99, 0xE0, 0xF9, 0x60, 0x7A, 0x99, 0x90, 0xB0, 0x11, 0x52, 0x25, 0x52, 0x22, 
-    0x10, 0x80, 0x13, 0x11, 0x10, 0x00, 0x00, 0x7A, 0x00, 0x0F, 0xA6, 0xB7, 0xA0, 0x15, 0xFA, 0x10, 
-    0x0A, 0x31, 0x10, 0x9E, 0x10, 0x90, 0x0A, 0x99, 0xE0, 0x09, 0xE1, 0x70, 0x0E, 0x10, 0x9E, 0x00, 
-    0xA0, 0x96, 0x00, 0x00, 0x00, 0x72, 0x25, 0x0A, 0x3B, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x07, 0xA3, 0x11, 0xF9, 0xE0, 0xFA, 0x60, 0x7A, 0x01, 0x2F, 0xA1, 0x11, 0x55, 0x55, 0x52, 0x05, 
-    0x00, 0x01, 0x41, 0x11, 0x20, 0x00, 0x00, 0x7A, 0x00, 0x0F, 0x96, 0xB7, 0xA3, 0xB0, 0xF9, 0xE0, 
-    0x0A, 0x4B, 0x20, 0x9E, 0x00, 0x96, 0xB0, 0x09, 0xE5, 0x09, 0xEB, 0x70, 0x9E, 0x10, 0x9E, 0x00, 
-    0x0F, 0x94, 0x00, 0x00, 0x08, 0x00, 0xB0, 0x09, 0x4B, 0x00, 0x00, 0x00, 0x7A, 0x3B, 0x00, 0x00, 
-    0x07, 0xA3, 0xB0, 0xF9, 0xE0, 0xFA, 0x60, 0x7A, 0x3B, 0x0F, 0x9E, 0x13, 0x11, 0x51, 0x55, 0x52, 
-    0x00, 0x23, 0x11, 0x11, 0x00, 0x00, 0x00, 0x7A, 0x03, 0x9A, 0x31, 0xB7, 0xA3, 0xB0, 0xF9, 0xE1, 
-    0xFA, 0x31, 0x50, 0x9E, 0x17, 0x00, 0x09, 0x33, 0x15, 0x33, 0x0A, 0xA3, 0x31, 0x70, 0x9E, 0x00, 
-    0x0F, 0xA4, 0x00, 0x00, 0x00, 0x23, 0x39, 0xA3, 0x1B, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x99, 0x91, 
-    0x07, 0xA3, 0xB0, 0x09, 0xE0, 0xF9, 0x6B, 0x7A, 0x0B, 0x0F, 0x90, 0x03, 0x31, 0x11, 0x45, 0x52, 
-    0x00, 0x11, 0x11, 0x10, 0x00, 0x01, 0x00, 0x7A, 0x99, 0x90, 0x00, 0x07, 0xA3, 0xB0, 0x09, 0xE1, 
-    0x0A, 0x61, 0x50, 0x9E, 0x15, 0x0A, 0x09, 0x6B, 0x22, 0x51, 0xA0, 0x9E, 0x03, 0x7F, 0x9E, 0x00, 
-    0x07, 0xAE, 0x00, 0x00, 0x00, 0x07, 0xA9, 0x00, 0x28, 0x80, 0x00, 0x00, 0x7A, 0x99, 0x00, 0x9E, 
-    0x07, 0xA4, 0xB0, 0xF9, 0xE1, 0x0A, 0xEB, 0x7A, 0x3B, 0x00, 0xAE, 0x01, 0x31, 0x11, 0x35, 0x22, 
-    0x81, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0x11, 0x18, 0x00, 0x1B, 0x00, 0x01, 0x11, 
-    0x50, 0x11, 0x11, 0x15, 0x22, 0x00, 0x00, 0x05, 0x22, 0x31, 0x00, 0x11, 0x31, 0x70, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x35, 0x11, 0x22, 
-    0x11, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x08, 0x00, 0x02, 0x53, 0x22, 
-    0x00, 0x51, 0x15, 0x12, 0x00, 0x00, 0x00, 0x02, 0x02, 0x41, 0x00, 0x21, 0x31, 0x70, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x25, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x11, 0x25, 0x22, 
-    0x11, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x10, 0x00, 0x00, 0x02, 0x13, 0x00, 
-    0x05, 0x11, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x11, 0x21, 0x31, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x12, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x51, 0x10, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x52, 0x52, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x10, 0x00, 0x00, 0x22, 0x22, 0x31, 0x10, 
-    0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x35, 0x15, 0x13, 0x32, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x10, 0x02, 0x52, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x52, 0x55, 
-    0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x02, 0x31, 0x20, 
-    0x01, 0x50, 0x00, 0x02, 0x00, 0x00, 0x15, 0x01, 0x33, 0x52, 0x21, 0x31, 0x35, 0x77, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0x02, 0x15, 0x20, 0x00, 0x00, 0x00, 0x02, 0x34, 0x12, 0x25, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x00, 
-    0x11, 0x22, 0x00, 0x01, 0x20, 0x02, 0x35, 0x52, 0x11, 0x22, 0x21, 0x11, 0x37, 0x70, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x32, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x02, 0x25, 0x20, 0x00, 0x00, 0x00, 0x00, 0x13, 0x35, 0x20, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x16, 0x10, 0x02, 
-    0x12, 0x22, 0x00, 0x11, 0x00, 0x03, 0x31, 0x25, 0x11, 0x02, 0x01, 0x53, 0x12, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x32, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x52, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x31, 0x00, 0x00, 
-    0x00, 0x22, 0x55, 0x11, 0x05, 0x34, 0x15, 0x21, 0x20, 0x00, 0x05, 0x13, 0x17, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x13, 0x25, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x21, 0x31, 0x20, 0x02, 
-    0x22, 0x52, 0x11, 0x11, 0x23, 0x33, 0x11, 0x22, 0x21, 0x00, 0x00, 0x53, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x01, 0x00, 0x00, 0x00, 0x52, 0x24, 0x53, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x41, 0x12, 0x01, 
-    0x11, 0x22, 0x11, 0x52, 0x51, 0x53, 0x55, 0x00, 0x10, 0x02, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 0x50, 0x20, 0x00, 0x25, 0x03, 0x53, 0x55, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x15, 0x02, 0x11, 
-    0x11, 0x51, 0x31, 0x12, 0x11, 0x51, 0x20, 0x00, 0x20, 0x05, 0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x02, 0x12, 0x21, 0x12, 0x00, 0x00, 0x01, 0x25, 0x11, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x22, 0x31, 0x15, 0x01, 0x10, 
-    0x11, 0x11, 0x33, 0x52, 0x15, 0x22, 0x00, 0x00, 0x00, 0x01, 0x22, 0x33, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0B, 0xB1, 0x80, 0x00, 0x25, 0x22, 0x15, 0x02, 0x00, 0x05, 0x52, 0x35, 0x55, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x10, 0x01, 0x15, 
-    0x11, 0x31, 0x11, 0x22, 0x52, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x33, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x70, 0x00, 0x01, 0x22, 0x21, 0x20, 0x20, 0x00, 0x15, 0x55, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x00, 0x51, 0x21, 
-    0x11, 0x15, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x25, 0x11, 0x22, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x02, 0x20, 0x25, 0x12, 0x20, 0x00, 0x21, 0x21, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x52, 0x00, 0x11, 0x11, 
-    0x11, 0x51, 0x10, 0x20, 0x00, 0x00, 0x20, 0x02, 0x12, 0x01, 0x21, 0x11, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x15, 0x02, 0x00, 0x01, 0x51, 0x44, 
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x53, 0x11, 0x15, 0x02, 0x31, 0x43, 
-    0x10, 0x21, 0x00, 0x00, 0x20, 0x00, 0x00, 0x05, 0x12, 0x02, 0x25, 0x31, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x20, 0x14, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02, 0x11, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x51, 0x15, 0x21, 0x11, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x02, 0x22, 0x00, 0x23, 0x31, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x20, 0x34, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x10, 0x00, 0x00, 0x13, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x11, 0x12, 0x22, 0x11, 0x11, 0x52, 0x02, 
-    0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x02, 0x21, 0x22, 0x00, 0x14, 0x17, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x22, 0x13, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x12, 0x02, 0x00, 0x03, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0x10, 0x00, 0x01, 0x15, 0x12, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x01, 0x23, 0x12, 0x00, 0x21, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x23, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x52, 0x51, 0x20, 0x00, 0x01, 0x35, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x20, 0x20, 0x21, 0x20, 0x02, 0x20, 0x00, 
-    0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x25, 0x23, 0x50, 0x50, 0x53, 0x10, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x01, 0x24, 0x43, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x51, 0x15, 0x00, 0x00, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x01, 0x10, 0x11, 0x02, 0x22, 0x00, 0x00, 
-    0x20, 0x52, 0x02, 0x00, 0x00, 0x00, 0x22, 0x23, 0x22, 0x50, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x02, 0x24, 0x41, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x55, 0x20, 0x00, 0x55, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 
-    0x00, 0x10, 0x02, 0x02, 0x00, 0x00, 0x12, 0x23, 0x21, 0x22, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x24, 0x33, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x11, 0x22, 0x00, 0x25, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-    0x00, 0x10, 0x25, 0x02, 0x20, 0x00, 0x12, 0x23, 0x23, 0x21, 0x41, 0x22, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x01, 0x21, 0x34, 0x52, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x21, 0x52, 0x00, 0x25, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x50, 
-    0x02, 0x10, 0x32, 0x03, 0x50, 0x05, 0x20, 0x23, 0x54, 0x23, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x02, 0x21, 0x34, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x52, 0x50, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 
-    0x01, 0x12, 0x32, 0x24, 0x50, 0x11, 0x00, 0x53, 0x54, 0x53, 0x33, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x02, 0x23, 0x44, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x20, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x10, 
-    0x23, 0x23, 0x32, 0x23, 0x20, 0x31, 0x00, 0x53, 0x33, 0x53, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x20, 0x21, 0x44, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x07, 0x22, 0x00, 0x22, 0x00, 0x20, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x20, 0x02, 0x00, 0x53, 0x12, 
-    0x33, 0x24, 0x32, 0x53, 0x21, 0x32, 0x52, 0x25, 0x31, 0x3D, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x22, 0x21, 0x43, 0x32, 0x22, 0x80, 0x00, 0x00, 0x00, 
-    0x20, 0x02, 0x22, 0x20, 0x02, 0x20, 0x02, 0x00, 0x20, 0x00, 0x00, 0x02, 0x02, 0x02, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x52, 0x21, 0x11, 0x52, 0x21, 0x02, 0x13, 0x55, 
-    0x42, 0x53, 0x32, 0x53, 0x24, 0x32, 0x35, 0x25, 0x41, 0x44, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x02, 0x22, 0x22, 0x22, 0x00, 0x22, 0x15, 0x33, 0x42, 0x27, 0x70, 0x00, 0x02, 0x00, 
-    0x20, 0x02, 0x12, 0x20, 0x05, 0x20, 0x01, 0x00, 0x52, 0x00, 0x02, 0x22, 0x20, 0x22, 0x11, 0x52, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x25, 0x55, 0x53, 0x51, 0x51, 0x33, 0x51, 
-    0x32, 0x53, 0x32, 0x55, 0x3D, 0x33, 0x31, 0x21, 0x33, 0xDD, 0x31, 0x12, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x22, 0x33, 0x33, 0x31, 0x22, 0x88, 0x02, 0x00, 0x20, 
-    0x21, 0x00, 0x52, 0x22, 0x02, 0x12, 0x01, 0x12, 0x25, 0x20, 0x02, 0x12, 0x12, 0x22, 0x53, 0x35, 
-    0x00, 0x1B, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x41, 0x21, 0x33, 0x44, 0x34, 
-    0x15, 0x4D, 0x43, 0x35, 0xD4, 0x14, 0x31, 0x23, 0x33, 0xD4, 0x15, 0x22, 0x20, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x11, 0x33, 0x34, 0x11, 0x77, 0x81, 0x00, 0x70, 0x02, 
-    0x25, 0x20, 0x21, 0x12, 0x22, 0x51, 0x22, 0x55, 0x22, 0x15, 0x10, 0x52, 0x51, 0x22, 0x25, 0x15, 
-    0x01, 0x00, 0x18, 0x01, 0xBB, 0x10, 0x00, 0x00, 0x01, 0x11, 0x14, 0x10, 0x51, 0x15, 0x33, 0x11, 
-    0x14, 0x43, 0x35, 0x55, 0x30, 0x2C, 0x12, 0x53, 0x33, 0xC3, 0x31, 0x22, 0x20, 0x00, 0x00, 0x00, 
-    0x20, 0x33, 0x00, 0x00, 0x30, 0x22, 0x20, 0x52, 0x15, 0x43, 0x55, 0x21, 0x08, 0xB0, 0x07, 0x81, 
-    0x72, 0x20, 0x03, 0x42, 0x22, 0x25, 0x52, 0x22, 0x52, 0x51, 0x52, 0x55, 0x31, 0x51, 0x11, 0x11, 
-    0x0B, 0x00, 0xBB, 0xBB, 0x11, 0xB1, 0x10, 0x22, 0x11, 0x21, 0x31, 0x52, 0x11, 0x11, 0x13, 0x33, 
-    0x33, 0x33, 0x31, 0x31, 0x33, 0x3D, 0x12, 0x33, 0x34, 0xD3, 0x35, 0x52, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x03, 0x03, 0x00, 0x22, 0x02, 0x52, 0x23, 0x33, 0x11, 0x22, 0x20, 0x70, 0x07, 0x10, 
-    0x17, 0x81, 0x11, 0x35, 0x21, 0x11, 0x22, 0x55, 0x32, 0x25, 0x35, 0x21, 0x15, 0x53, 0x11, 0x13, 
-    0x08, 0x8B, 0xBB, 0x80, 0x00, 0x11, 0x11, 0x11, 0x11, 0x13, 0x35, 0x22, 0x11, 0x33, 0x34, 0x33, 
-    0x14, 0x33, 0x33, 0x35, 0x55, 0x34, 0x22, 0x33, 0x4D, 0x43, 0x33, 0x52, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x25, 0x52, 0x24, 0x33, 0x31, 0x12, 0x20, 0x00, 0x00, 0x00, 
-    0x71, 0x00, 0x21, 0x43, 0x58, 0x11, 0x66, 0x15, 0x43, 0x25, 0x33, 0x25, 0x15, 0x55, 0x11, 0x34, 
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x65, 0x11, 0x16, 0x66, 0x45, 0x13, 0x21, 0x66, 0x41, 0x11, 0x51, 
-    0x33, 0x33, 0x51, 0x11, 0x52, 0x43, 0x25, 0x4C, 0xDD, 0x43, 0x31, 0x52, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x22, 0x25, 0x22, 0x55, 0x24, 0x33, 0x52, 0x22, 0x00, 0x00, 0x88, 0x81, 
-    0x11, 0x25, 0x25, 0x44, 0x12, 0x11, 0x63, 0x33, 0xDD, 0x12, 0x33, 0x31, 0x31, 0x51, 0x34, 0x66, 
-    0x00, 0x01, 0x50, 0x00, 0x16, 0x32, 0x13, 0x66, 0x36, 0x42, 0x11, 0x22, 0x46, 0x46, 0x64, 0x11, 
-    0x31, 0x15, 0x55, 0x51, 0x13, 0xC1, 0x22, 0x44, 0x4D, 0x35, 0x15, 0x52, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x02, 0x22, 0x22, 0x22, 0x20, 0x22, 0x52, 0x05, 0x35, 0x50, 0x52, 0x52, 0x00, 0xE6, 0x11, 
-    0x64, 0x41, 0x15, 0x44, 0x35, 0x51, 0x15, 0x33, 0xDD, 0x35, 0x33, 0x46, 0xC6, 0x43, 0x43, 0x33, 
-    0x01, 0x43, 0x12, 0x21, 0x63, 0x02, 0x51, 0x15, 0x43, 0x51, 0x22, 0x22, 0x51, 0x51, 0x31, 0x13, 
-    0x33, 0x35, 0x53, 0x31, 0x54, 0x45, 0x55, 0x53, 0x43, 0xD4, 0x34, 0x31, 0x15, 0x22, 0x22, 0x02, 
-    0x20, 0x11, 0x53, 0x31, 0x51, 0x11, 0x31, 0x11, 0x35, 0x55, 0x53, 0x33, 0x35, 0x20, 0x15, 0x25, 
-    0x55, 0x11, 0x51, 0x43, 0x31, 0x15, 0x14, 0x44, 0xC3, 0x33, 0x11, 0x31, 0x11, 0x43, 0x44, 0x11, 
-    0x4D, 0xD1, 0x22, 0x14, 0x41, 0x00, 0x51, 0x53, 0xD4, 0x55, 0x52, 0x02, 0x11, 0x55, 0x25, 0x55, 
-    0x55, 0x55, 0x51, 0x13, 0x44, 0x31, 0x15, 0x25, 0x13, 0x34, 0x44, 0x44, 0x31, 0x15, 0x11, 0x11, 
-    0x50, 0x44, 0x34, 0x43, 0x33, 0x34, 0x44, 0x44, 0x35, 0x55, 0x51, 0x33, 0x31, 0x55, 0x55, 0x51, 
-    0x41, 0x11, 0x54, 0x44, 0x41, 0x41, 0x51, 0x13, 0xD3, 0x33, 0x11, 0x11, 0x31, 0x11, 0x13, 0x11, 
-    0xDD, 0x41, 0x01, 0x11, 0x41, 0x00, 0x51, 0x14, 0x44, 0x12, 0x25, 0x55, 0x25, 0x11, 0x55, 0x55, 
-    0x51, 0x13, 0x11, 0x11, 0x33, 0x33, 0x33, 0x44, 0x43, 0x33, 0x33, 0x31, 0x13, 0x11, 0x33, 0x44, 
-    0x11, 0x44, 0x44, 0x44, 0x44, 0x34, 0x43, 0x33, 0x13, 0x44, 0x44, 0x33, 0x33, 0x15, 0x11, 0x15, 
-    0x44, 0x11, 0x11, 0x54, 0x44, 0x34, 0x31, 0x13, 0x34, 0x44, 0x43, 0x43, 0x33, 0x33, 0x11, 0x11, 
-    0xD0, 0x05, 0x44, 0x44, 0x41, 0x11, 0x11, 0x13, 0x44, 0x11, 0x11, 0x55, 0x11, 0x50, 0x02, 0x05, 
-    0x51, 0x4D, 0x44, 0x44, 0x44, 0x44, 0x46, 0xC6, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x44, 
-    0x31, 0x11, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x43, 0x33, 0x43, 0x53, 0x34, 0x33, 0x15, 0x51, 
-    0x13, 0x33, 0x14, 0x11, 0x33, 0x14, 0x31, 0x66, 0x63, 0x44, 0x31, 0x33, 0x36, 0x15, 0x55, 0x55, 
-    0x30, 0x35, 0x15, 0x11, 0x51, 0x10, 0x00, 0x61, 0x11, 0x55, 0x51, 0x50, 0x13, 0x15, 0x52, 0x25, 
-    0x02, 0x55, 0x13, 0x33, 0x33, 0x44, 0x4D, 0x44, 0x44, 0x44, 0x33, 0x44, 0x34, 0x33, 0x44, 0x44, 
-    0x44, 0x44, 0x4D, 0xDD, 0xDD, 0xDD, 0xD4, 0x43, 0x53, 0x13, 0x33, 0x34, 0x33, 0x33, 0x33, 0x13, 
-    0x34, 0x44, 0xC0, 0x43, 0x31, 0x14, 0x35, 0x30, 0x04, 0x44, 0x35, 0x11, 0x33, 0x15, 0x51, 0x55, 
+const uint8_t STORY_CH8_RLE[STORY_CH8_RLE_SIZE] = {
+    0xA4, 0xC1, 0x0A, 0x6C, 0x61, 0x34, 0x41, 0x11, 0x30, 0xE1, 0x00, 0x80, 0xA1, 0x03, 0x01, 0x18, 
+    0xB1, 0x04, 0x4C, 0x0C, 0x40, 0xE1, 0x00, 0x40, 0xC1, 0x01, 0x88, 0xD1, 0x05, 0x51, 0x0C, 0x17, 
+    0xB1, 0x05, 0x07, 0x07, 0x22, 0xF1, 0x01, 0x15, 0x33, 0x44, 0x43, 0x33, 0x4C, 0xCC, 0x0C, 0xCC, 
+    0x43, 0x13, 0x43, 0xD1, 0x03, 0x44, 0x43, 0xB1, 0x06, 0x3C, 0x64, 0x14, 0x40, 0xF1, 0x03, 0x08, 
+    0x80, 0x11, 0x15, 0x01, 0x80, 0xB1, 0x04, 0x36, 0x0C, 0x60, 0xD1, 0x02, 0x3C, 0xC0, 0xB1, 0x00, 
+    0x00, 0x42, 0x00, 0x70, 0xA1, 0x03, 0x21, 0xC4, 0xD1, 0x08, 0x70, 0x27, 0x22, 0x21, 0x70, 0x4A, 
+    0x10, 0x43, 0x43, 0x3C, 0xC0, 0x0C, 0xDC, 0x04, 0x36, 0x40, 0xD1, 0x00, 0xC0, 0x42, 0x0A, 0x61, 
+    0x11, 0x46, 0xC4, 0x34, 0x30, 0xF1, 0x03, 0x00, 0x00, 0x42, 0x03, 0x21, 0x17, 0xB1, 0x04, 0x46, 
+    0x04, 0x40, 0xC1, 0x03, 0x4D, 0xC3, 0x48, 0xA1, 0x02, 0x51, 0x30, 0x47, 0x09, 0x10, 0x77, 0x25, 
+    0x51, 0x22, 0xE1, 0x14, 0x43, 0x34, 0x34, 0x61, 0x14, 0x4C, 0x6C, 0xCC, 0x06, 0x34, 0x60, 0xC1, 
+    0x04, 0xD3, 0x11, 0xC0, 0x42, 0x03, 0x66, 0x64, 0xF1, 0x0D, 0x00, 0x70, 0xB1, 0x05, 0x44, 0x66, 
+    0x36, 0xB1, 0x03, 0x36, 0x44, 0xC1, 0x0D, 0x00, 0x03, 0x11, 0x77, 0x21, 0x34, 0x66, 0x47, 0x02, 
+    0x01, 0x50, 0xF1, 0x02, 0x03, 0x33, 0x44, 0xA3, 0x0B, 0x66, 0x31, 0x13, 0x60, 0x0D, 0xD6, 0xA4, 
+    0xB1, 0x11, 0x41, 0x16, 0xC3, 0x11, 0x46, 0x11, 0x44, 0x11, 0x14, 0xA1, 0x00, 0x70, 0xF1, 0x08, 
+    0x06, 0x36, 0x34, 0x36, 0x40, 0xB1, 0x04, 0x64, 0xC4, 0x30, 0xA1, 0x0E, 0x00, 0x14, 0x41, 0x10, 
+    0x71, 0x14, 0x33, 0x40, 0xB1, 0x06, 0x77, 0x11, 0x02, 0x70, 0xF1, 0x05, 0x13, 0x31, 0x11, 0x33, 
+    0xC6, 0x31, 0x14, 0x00, 0x0C, 0xD4, 0x44, 0xC1, 0x05, 0x41, 0x36, 0x41, 0x43, 0x06, 0x46, 0x31, 
+    0x11, 0x30, 0xA1, 0x00, 0x80, 0xF1, 0x0A, 0x2E, 0x41, 0x34, 0x12, 0x11, 0x73, 0xC4, 0x4D, 0x41, 
+    0x13, 0x12, 0x03, 0x63, 0x11, 0x70, 0x11, 0x44, 0x13, 0x11, 0x10, 0x18, 0x87, 0x10, 0x00, 0x70, 
+    0x4C, 0x00, 0x30, 0x42, 0x10, 0x4C, 0x61, 0x11, 0x46, 0x6C, 0xD4, 0x33, 0x46, 0x40, 0x42, 0x05, 
+    0x44, 0x41, 0x13, 0xA4, 0x04, 0x61, 0x11, 0x30, 0xC1, 0x00, 0x00, 0xF1, 0x08, 0x05, 0x54, 0x61, 
+    0x44, 0xB1, 0x05, 0x33, 0x3C, 0xC4, 0xA1, 0x13, 0x72, 0x44, 0x11, 0x87, 0x01, 0x3C, 0x31, 0x17, 
+    0x10, 0x01, 0xA0, 0x03, 0x20, 0x02, 0xF1, 0x09, 0x09, 0x33, 0x44, 0x31, 0x11, 0x36, 0xA4, 0x04, 
+    0x34, 0xCC, 0x40, 0x45, 0x01, 0x44, 0xA6, 0xF1, 0x11, 0x07, 0x21, 0x13, 0x64, 0x14, 0xC1, 0x1B, 
+    0x33, 0x40, 0xD4, 0x11, 0x31, 0x01, 0x41, 0x11, 0x80, 0x21, 0x4C, 0x11, 0x10, 0x18, 0x44, 0x04, 
+    0x11, 0x00, 0x70, 0xF1, 0x09, 0x09, 0x33, 0x14, 0x43, 0x11, 0x16, 0xC4, 0x09, 0xCC, 0x43, 0x44, 
+    0xC4, 0x4D, 0x5D, 0x00, 0x10, 0x42, 0xF1, 0x00, 0x05, 0x43, 0x0D, 0x43, 0x42, 0x02, 0x24, 0x30, 
+    0x46, 0x00, 0x30, 0x45, 0xA0, 0x06, 0x22, 0x20, 0x02, 0x20, 0xF1, 0x07, 0x06, 0x31, 0x13, 0x34, 
+    0x40, 0xA1, 0x02, 0x63, 0x10, 0xA4, 0x0E, 0x66, 0x33, 0x44, 0x36, 0x44, 0x64, 0x43, 0x50, 0x5B, 
+    0x00, 0x40, 0xE1, 0x06, 0x34, 0x4D, 0xD3, 0x10, 0x42, 0x0A, 0x16, 0x11, 0x17, 0x11, 0x01, 0x60, 
+    0xA1, 0x01, 0x08, 0x45, 0x06, 0x15, 0x20, 0x00, 0x20, 0xB1, 0x00, 0x50, 0xF1, 0x03, 0x04, 0x33, 
+    0x34, 0x30, 0xC1, 0x00, 0x30, 0xB4, 0x0D, 0xC4, 0x63, 0x46, 0x44, 0x41, 0x13, 0x14, 0xF1, 0x12, 
+    0x00, 0x40, 0xF1, 0x00, 0x15, 0x43, 0x44, 0xC1, 0x11, 0x33, 0x16, 0x31, 0x11, 0x81, 0x30, 0x13, 
+    0xB1, 0x01, 0x07, 0xC0, 0x01, 0x11, 0x43, 0x00, 0x50, 0xC1, 0x0F, 0x51, 0x11, 0x22, 0x25, 0x51, 
+    0x15, 0x34, 0x34, 0xB1, 0x01, 0x31, 0xA4, 0x0D, 0xCC, 0x66, 0x46, 0x44, 0x43, 0x44, 0x43, 0xA1, 
+    0x00, 0x50, 0xD1, 0x00, 0x80, 0xF1, 0x06, 0x00, 0x30, 0xA1, 0x01, 0x43, 0xA1, 0x02, 0x34, 0x00, 
+    0x43, 0x0A, 0x11, 0x61, 0x11, 0x78, 0x11, 0x00, 0xA1, 0x04, 0x77, 0x10, 0x10, 0xC0, 0x08, 0x52, 
+    0x01, 0x10, 0x00, 0x20, 0xD1, 0x03, 0x21, 0x15, 0x43, 0x03, 0x11, 0x34, 0xF1, 0x00, 0x0F, 0x34, 
+    0x4D, 0xD6, 0x64, 0x33, 0x11, 0x44, 0x33, 0xA1, 0x03, 0x51, 0x10, 0xA1, 0x00, 0x00, 0xF1, 0x0B, 
+    0x00, 0x40, 0xC1, 0x1C, 0x3C, 0x04, 0x12, 0x13, 0x44, 0x11, 0x16, 0x70, 0x61, 0x08, 0x81, 0x17, 
+    0x81, 0x08, 0x80, 0xC0, 0x02, 0x50, 0x20, 0x42, 0x03, 0x00, 0x12, 0x43, 0x04, 0x07, 0x15, 0x20, 
+    0xD1, 0x05, 0x41, 0x51, 0x13, 0xB1, 0x0B, 0x34, 0x44, 0x34, 0x31, 0x13, 0x43, 0x44, 0x02, 0x21, 
+    0x20, 0x54, 0x00, 0x30, 0x44, 0x1F, 0x33, 0x63, 0x6C, 0x43, 0x11, 0x15, 0x64, 0x71, 0x61, 0x01, 
+    0xC1, 0x01, 0x01, 0x17, 0x01, 0x00, 0x45, 0x04, 0x00, 0x01, 0x10, 0xA0, 0x05, 0x77, 0x22, 0x01, 
+    0xA0, 0x02, 0x20, 0x20, 0x45, 0x05, 0x45, 0x11, 0x44, 0xC1, 0x0E, 0x33, 0x3D, 0x35, 0x14, 0x33, 
+    0x43, 0x11, 0x50, 0xA2, 0x04, 0x81, 0x11, 0x00, 0x4C, 0x17, 0x21, 0x61, 0x14, 0x33, 0x34, 0x3C, 
+    0x63, 0x43, 0x41, 0x31, 0x21, 0x61, 0x42, 0x09, 0x24, 0xC2, 0x81, 0x00, 0x71, 0xA0, 0x48, 0x06, 
+    0x07, 0x00, 0x08, 0x00, 0x43, 0x09, 0x70, 0x00, 0x10, 0x02, 0x15, 0xA1, 0x06, 0x31, 0x21, 0x34, 
+    0x40, 0xC1, 0x16, 0x34, 0x45, 0x21, 0x44, 0x43, 0x11, 0x12, 0x00, 0x08, 0x81, 0x51, 0x00, 0xF1, 
+    0x04, 0x10, 0x52, 0x41, 0x36, 0x43, 0x36, 0x64, 0xC3, 0xCC, 0xC0, 0x43, 0x12, 0x46, 0x12, 0x43, 
+    0x73, 0xC4, 0x81, 0x10, 0x00, 0x88, 0x80, 0x4B, 0xB0, 0x07, 0x22, 0x02, 0x00, 0x17, 0xC0, 0x0F, 
+    0x25, 0x25, 0x15, 0x11, 0x52, 0x13, 0x11, 0x13, 0x43, 0x03, 0x15, 0x54, 0xB3, 0x01, 0x43, 0x47, 
+    0x00, 0x80, 0xD1, 0x16, 0x21, 0x70, 0x25, 0x21, 0x63, 0x66, 0x46, 0x63, 0x46, 0xC3, 0x6C, 0x40, 
+    0xA3, 0x0B, 0x56, 0x41, 0x14, 0x11, 0x44, 0x10, 0x43, 0x02, 0x08, 0x00, 0x50, 0x2D, 0x02, 0x00, 
+    0x20, 0x01, 0x50, 0x22, 0x20, 0x21, 0x12, 0x55, 0x21, 0x11, 0x51, 0x31, 0x11, 0x31, 0x11, 0x31, 
+    0x51, 0x11, 0x44, 0x36, 0x61, 0xC0, 0x01, 0x10, 0xC1, 0x08, 0x01, 0x22, 0x02, 0x11, 0x10, 0x42, 
+    0x0B, 0x13, 0x66, 0x41, 0x40, 0x64, 0x44, 0xA1, 0x10, 0x33, 0x41, 0x14, 0x45, 0x34, 0x11, 0x01, 
+    0x00, 0x80, 0x44, 0xF0, 0x0F, 0x11, 0x12, 0x00, 0x22, 0x25, 0x11, 0x52, 0x55, 0x52, 0x25, 0xB1, 
+    0x07, 0x33, 0x11, 0x52, 0x11, 0xA4, 0x02, 0x63, 0x20, 0xB0, 0x04, 0x11, 0x0B, 0xB0, 0xA1, 0x0A, 
+    0x71, 0x21, 0x13, 0x45, 0x02, 0x30, 0xA1, 0x08, 0x36, 0x11, 0xCC, 0x44, 0x30, 0x44, 0x06, 0x61, 
+    0x11, 0x41, 0x70, 0xA1, 0x04, 0x07, 0x08, 0x80, 0xF0, 0x16, 0x0A, 0x20, 0x00, 0x52, 0x21, 0x12, 
+    0x10, 0xA5, 0x03, 0x22, 0x55, 0xD1, 0x01, 0x51, 0xC4, 0x01, 0x31, 0x45, 0x01, 0xB8, 0xB1, 0x02, 
+    0x70, 0x20, 0xC1, 0x00, 0x00, 0xC1, 0x05, 0x30, 0x11, 0x04, 0x42, 0x13, 0x33, 0x15, 0x16, 0x41, 
+    0x14, 0x27, 0x02, 0x12, 0x00, 0x08, 0xF0, 0x0B, 0x00, 0x20, 0xF0, 0x07, 0x03, 0x55, 0x25, 0xA2, 
+    0x0A, 0x02, 0x10, 0x55, 0x22, 0x11, 0x50, 0xA1, 0xA4, 0x03, 0x34, 0x41, 0xC0, 0x03, 0x11, 0x18, 
+    0x43, 0x01, 0x77, 0xB1, 0x18, 0x51, 0x13, 0x33, 0x11, 0x66, 0x26, 0xC4, 0x66, 0x11, 0x44, 0x32, 
+    0x16, 0x60, 0x43, 0x02, 0x25, 0x10, 0xA0, 0x00, 0x70, 0xB0, 0x00, 0x80, 0xF0, 0x17, 0x06, 0x20, 
+    0x02, 0x01, 0x10, 0xA2, 0x02, 0x11, 0x20, 0xA0, 0xA1, 0xB3, 0x02, 0x43, 0x50, 0xB0, 0xF1, 0x08, 
+    0x02, 0x01, 0x60, 0xA1, 0x11, 0x46, 0x11, 0x6C, 0x33, 0x11, 0x64, 0x33, 0x11, 0x64, 0xA1, 0x0C, 
+    0x20, 0x11, 0x20, 0x02, 0x10, 0x00, 0x80, 0x4F, 0x00, 0x20, 0xF0, 0x08, 0x12, 0x20, 0x20, 0x21, 
+    0x12, 0x55, 0x31, 0x50, 0x50, 0x01, 0x40, 0x42, 0x04, 0x13, 0x31, 0x10, 0x55, 0x00, 0x50, 0xC1, 
+    0x11, 0x64, 0x11, 0x46, 0x11, 0x13, 0x63, 0x51, 0x54, 0x66, 0x44, 0x05, 0x33, 0x70, 0x00, 0x42, 
+    0x04, 0x78, 0x80, 0x80, 0xF0, 0x03, 0x00, 0x80, 0xF0, 0x08, 0x03, 0x20, 0x55, 0xD2, 0x08, 0x33, 
+    0x10, 0x11, 0x03, 0x30, 0xC1, 0x02, 0x50, 0x20, 0xB0, 0xF1, 0x10, 0x04, 0x63, 0x11, 0x60, 0x42, 
+    0x06, 0x13, 0x15, 0x55, 0x10, 0x44, 0x02, 0x00, 0x10, 0x43, 0xA0, 0x02, 0x71, 0x80, 0xF0, 0x08, 
+    0x00, 0x20, 0x4D, 0x0A, 0x22, 0x55, 0x52, 0x02, 0x20, 0x10, 0x44, 0xC1, 0x01, 0x63, 0xE0, 0xA1, 
+    0x00, 0x70, 0xF1, 0x0A, 0x06, 0x6C, 0x63, 0x36, 0x30, 0xC1, 0x04, 0x52, 0x14, 0x60, 0xA1, 0x04, 
+    0x30, 0x01, 0x10, 0xE0, 0x01, 0x11, 0xF0, 0x09, 0x4D, 0x0C, 0x00, 0x05, 0x52, 0x25, 0x02, 0x50, 
+    0x50, 0xC1, 0x0A, 0x35, 0x01, 0x66, 0x10, 0x25, 0x50, 0x43, 0x00, 0xB0, 0xF1, 0x0C, 0x12, 0x36, 
+    0x43, 0x36, 0x61, 0x11, 0x51, 0x11, 0x21, 0x31, 0x30, 0xB1, 0x02, 0x00, 0x50, 0x5B, 0xF0, 0x0A, 
+    0x0B, 0x25, 0x21, 0x20, 0x22, 0x05, 0x15, 0xA1, 0x12, 0x21, 0x14, 0x11, 0x01, 0x11, 0x20, 0x07, 
+    0x00, 0x70, 0x80, 0xF1, 0x09, 0x11, 0x64, 0x11, 0x66, 0x31, 0x11, 0x01, 0x12, 0x21, 0x33, 0xA1, 
+    0x00, 0x60, 0x72, 0x04, 0x05, 0x50, 0x50, 0xB0, 0xA1, 0x10, 0x55, 0x11, 0x43, 0x10, 0x11, 0x12, 
+    0x00, 0x07, 0x70, 0xA0, 0xF1, 0x08, 0x05, 0x66, 0x31, 0x46, 0xA1, 0x02, 0x52, 0x20, 0xB1, 0x43, 
+    0x04, 0x17, 0x00, 0x10, 0x47, 0x02, 0x31, 0x80, 0xF0, 0x1D, 0x01, 0x55, 0xD0, 0x42, 0x05, 0x11, 
+    0x44, 0x35, 0x42, 0xA0, 0x05, 0x88, 0x00, 0x08, 0xF1, 0x07, 0x05, 0x44, 0x43, 0x33, 0xD1, 0x00, 
+    0x00, 0xF1, 0x02, 0x04, 0x77, 0x02, 0x70, 0xE0, 0x01, 0x13, 0x65, 0x02, 0x14, 0x50, 0xD0, 0xB1, 
+    0x04, 0x43, 0x10, 0x20, 0x44, 0x00, 0x70, 0xC0, 0xD1, 0x00, 0x20, 0xC1, 0x05, 0x31, 0x34, 0x43, 
+    0xE1, 0x00, 0x20, 0x46, 0x04, 0x34, 0x17, 0x20, 0xF0, 0x04, 0x01, 0x31, 0xF0, 0x1D, 0x04, 0x54, 
+    0x45, 0x50, 0xC0, 0x13, 0x51, 0x13, 0x31, 0x00, 0x11, 0x10, 0x00, 0x70, 0x00, 0x88, 0xA0, 0xA1, 
+    0x0C, 0x50, 0x11, 0x51, 0x11, 0x61, 0x11, 0x40, 0xF1, 0x00, 0x03, 0x21, 0x55, 0x46, 0x00, 0x10, 
+    0xF0, 0x05, 0x03, 0x11, 0x08, 0xF0, 0x09, 0x01, 0x11, 0xF0, 0x08, 0x02, 0x66, 0x10, 0x45, 0x01, 
+    0x05, 0xA1, 0x42, 0x05, 0x20, 0x00, 0x50, 0xB7, 0x16, 0x80, 0x07, 0x73, 0x32, 0x11, 0x21, 0x11, 
+    0x33, 0x71, 0x41, 0x11, 0x20, 0xA3, 0x0D, 0x52, 0x21, 0x27, 0x33, 0x31, 0x13, 0x33, 0x43, 0x04, 
+    0x20, 0x00, 0x70, 0xB0, 0x03, 0x73, 0x17, 0xF0, 0x00, 0x01, 0x72, 0xD0, 0x04, 0x51, 0x72, 0x20, 
+    0xA0, 0x03, 0x20, 0x00, 0xB2, 0x00, 0x00, 0xA1, 0x01, 0x02, 0xB0, 0x08, 0x13, 0x11, 0x00, 0x11, 
+    0x50, 0xB0, 0x04, 0x70, 0x99, 0x90, 0xA0, 0x06, 0x7A, 0x99, 0x90, 0x00, 0x42, 0x1B, 0x09, 0x93, 
+    0xE2, 0x11, 0x10, 0x99, 0x3B, 0x22, 0x57, 0x09, 0x96, 0xB3, 0x60, 0x9E, 0xA0, 0x0B, 0xA3, 0x07, 
+    0xA3, 0xB0, 0x0F, 0xA9, 0xF0, 0x01, 0x03, 0x7A, 0x3B, 0xE0, 0x17, 0x99, 0x0B, 0x00, 0xFA, 0x6B, 
+    0x7A, 0x99, 0x90, 0xB0, 0x11, 0x15, 0x52, 0x43, 0x00, 0x10, 0x43, 0x02, 0x51, 0x20, 0x43, 0x34, 
+    0xA0, 0x15, 0x33, 0x1B, 0x7A, 0x03, 0x03, 0x31, 0x13, 0xA0, 0x33, 0x03, 0x11, 0xFA, 0x03, 0x30, 
+    0x31, 0x00, 0xA3, 0x33, 0x03, 0x16, 0x09, 0x00, 0x80, 0x0A, 0x40, 0x45, 0x06, 0xA3, 0x30, 0x31, 
+    0x80, 0x4D, 0x0A, 0x70, 0x33, 0x00, 0x31, 0x0F, 0x90, 0x42, 0x08, 0x01, 0x23, 0x31, 0x01, 0x50, 
+    0x4B, 0x06, 0x51, 0x61, 0x00, 0x80, 0x42, 0x2E, 0x00, 0xF9, 0x6B, 0x7A, 0x3B, 0x0F, 0x9E, 0xBF, 
+    0xA4, 0xE1, 0x09, 0xE1, 0xF9, 0x60, 0x30, 0x9E, 0x0F, 0x9E, 0x13, 0x09, 0xE1, 0x09, 0x90, 0xB0, 
+    0x43, 0xA0, 0x08, 0x80, 0x00, 0x10, 0xA6, 0xB0, 0x4D, 0x15, 0x0A, 0x4B, 0x00, 0x9E, 0x00, 0xA6, 
+    0x07, 0xA3, 0xB0, 0xF9, 0xE0, 0xB5, 0x45, 0x06, 0x02, 0x16, 0x13, 0x10, 0xA0, 0x44, 0x11, 0xA6, 
+    0xB0, 0xA0, 0x30, 0xA3, 0xE1, 0xFA, 0x03, 0x0A, 0x42, 0x06, 0xA6, 0x11, 0x10, 0x00, 0x43, 0x00, 
+    0x10, 0x44, 0x03, 0xEF, 0xA1, 0x46, 0x07, 0x00, 0x31, 0x03, 0x1B, 0xD0, 0x47, 0x05, 0x7A, 0x03, 
+    0x0A, 0x47, 0x0D, 0x01, 0x20, 0x30, 0x13, 0x50, 0x25, 0x52, 0x43, 0x05, 0x11, 0x41, 0x11, 0xB0, 
+    0x49, 0x08, 0x99, 0x90, 0x02, 0x10, 0xA0, 0xB9, 0x11, 0xE1, 0x0A, 0x40, 0xAA, 0x0B, 0x00, 0x96, 
+    0x07, 0x00, 0x43, 0x05, 0x70, 0x0A, 0x96, 0xD0, 0x02, 0x7A, 0x90, 0xF0, 0x01, 0x49, 0xB9, 0x03, 
+    0xE0, 0xF9, 0x42, 0x09, 0x99, 0x90, 0xB0, 0x11, 0x52, 0x42, 0x07, 0x22, 0x10, 0x80, 0x13, 0x4F, 
+    0x0E, 0x7A, 0x01, 0x5F, 0xA1, 0x00, 0xA3, 0x11, 0x00, 0x42, 0x0B, 0x90, 0x0A, 0x99, 0xE0, 0x09, 
+    0xE1, 0x46, 0x03, 0x00, 0xA0, 0x46, 0x07, 0x72, 0x25, 0x0A, 0x3B, 0x4F, 0x03, 0x31, 0x1F, 0x42, 
+    0x00, 0xA0, 0x42, 0x07, 0x01, 0x2F, 0xA1, 0x11, 0xB5, 0x0B, 0x20, 0x50, 0x00, 0x14, 0x11, 0x12, 
+    0x49, 0x00, 0x90, 0x42, 0x1F, 0x3B, 0x0F, 0x9E, 0x00, 0xA4, 0xB2, 0x09, 0xE0, 0x09, 0x6B, 0x00, 
+    0x9E, 0x50, 0x9E, 0xB7, 0x09, 0x45, 0x03, 0x0F, 0x94, 0xB0, 0x07, 0x80, 0x0B, 0x00, 0x94, 0x51, 
+    0x01, 0xB0, 0x48, 0x13, 0x3B, 0x0F, 0x9E, 0x13, 0x11, 0x51, 0x55, 0x52, 0x00, 0x23, 0xA1, 0xC0, 
+    0x07, 0x7A, 0x03, 0x9A, 0x31, 0x47, 0x1B, 0x1F, 0xA3, 0x15, 0x09, 0xE1, 0x70, 0x00, 0x93, 0x31, 
+    0x53, 0x30, 0xAA, 0x33, 0x17, 0x45, 0x00, 0xA0, 0x44, 0x07, 0x02, 0x33, 0x9A, 0x31, 0x47, 0x05, 
+    0x00, 0x99, 0x91, 0x44, 0x00, 0x00, 0x42, 0x05, 0x96, 0xB7, 0xA0, 0x42, 0x07, 0x00, 0x33, 0x11, 
+    0x14, 0x43, 0xB1, 0xA0, 0x00, 0x10, 0x42, 0x02, 0x99, 0x90, 0xA0, 0x43, 0x06, 0x09, 0xE1, 0x0A, 
+    0x60, 0x44, 0x12, 0x50, 0xA0, 0x96, 0xB2, 0x25, 0x1A, 0x09, 0xE0, 0x37, 0xF0, 0x43, 0x02, 0x7A, 
+    0xE0, 0xD0, 0x07, 0x7A, 0x90, 0x02, 0x88, 0x45, 0x1D, 0x99, 0x00, 0x9E, 0x07, 0xA4, 0xB0, 0xF9, 
+    0xE1, 0x0A, 0xEB, 0x7A, 0x3B, 0x00, 0xAE, 0x01, 0x42, 0x07, 0x35, 0x22, 0x81, 0x11, 0xD0, 0x00, 
+    0x10, 0xB0, 0x10, 0xB1, 0x11, 0x80, 0x01, 0xB0, 0x00, 0x11, 0x15, 0x00, 0xB1, 0x02, 0x52, 0x20, 
+    0xB0, 0x0B, 0x52, 0x23, 0x10, 0x01, 0x13, 0x17, 0xF0, 0x0A, 0x01, 0x11, 0xF0, 0x0E, 0x06, 0x11, 
+    0x10, 0x01, 0x20, 0xF0, 0x01, 0x0E, 0x13, 0x35, 0x11, 0x22, 0x11, 0x10, 0x00, 0x10, 0xF0, 0x03, 
+    0x14, 0x52, 0x00, 0x80, 0x00, 0x25, 0x32, 0x20, 0x05, 0x11, 0x51, 0x20, 0xD0, 0x07, 0x20, 0x24, 
+    0x10, 0x02, 0x57, 0x00, 0x10, 0xF0, 0x0D, 0x06, 0x22, 0x50, 0x05, 0x50, 0xF0, 0x01, 0x05, 0x54, 
+    0x11, 0x25, 0x43, 0x00, 0x10, 0x4B, 0x03, 0x81, 0x11, 0xC0, 0x0B, 0x21, 0x30, 0x00, 0x51, 0x12, 
+    0x22, 0xF0, 0x01, 0x04, 0x13, 0x51, 0x10, 0x42, 0x01, 0x08, 0xF0, 0x09, 0x04, 0x23, 0x12, 0x70, 
+    0xF0, 0x0C, 0x02, 0x51, 0x10, 0x4B, 0x06, 0x01, 0x15, 0x52, 0x50, 0x45, 0xF0, 0x00, 0x03, 0x88, 
+    0x01, 0xB0, 0xA2, 0x07, 0x31, 0x10, 0x01, 0x12, 0xF0, 0x03, 0x09, 0x34, 0x35, 0x15, 0x13, 0x32, 
+    0xF0, 0x0C, 0x02, 0x31, 0x20, 0xF0, 0x0D, 0x07, 0x55, 0x10, 0x02, 0x52, 0x48, 0x08, 0x33, 0x52, 
+    0x55, 0x11, 0x80, 0x4A, 0x02, 0x00, 0x10, 0x44, 0x0A, 0x00, 0x02, 0x31, 0x20, 0x01, 0x50, 0xA0, 
+    0x00, 0x20, 0xA0, 0x0F, 0x15, 0x01, 0x33, 0x52, 0x21, 0x31, 0x35, 0x77, 0x52, 0x00, 0x40, 0x55, 
+    0x08, 0x01, 0x52, 0x02, 0x15, 0x20, 0xE0, 0x09, 0x23, 0x41, 0x22, 0x51, 0x11, 0xF0, 0x00, 0x00, 
+    0x80, 0x43, 0xF0, 0x00, 0x1F, 0x11, 0x20, 0x01, 0x12, 0x20, 0x00, 0x12, 0x00, 0x23, 0x55, 0x21, 
+    0x12, 0x22, 0x11, 0x13, 0x77, 0xF0, 0x0B, 0x03, 0x43, 0x27, 0xF0, 0x0D, 0x05, 0x55, 0x00, 0x22, 
+    0x48, 0x07, 0x01, 0x33, 0x52, 0x01, 0xF0, 0x02, 0x43, 0xC0, 0x0A, 0x71, 0x01, 0x61, 0x00, 0x21, 
+    0x20, 0x42, 0x14, 0x11, 0x00, 0x03, 0x31, 0x25, 0x11, 0x02, 0x01, 0x53, 0x12, 0x10, 0xF0, 0x0B, 
+    0x00, 0x30, 0x57, 0x06, 0x02, 0x25, 0x25, 0x50, 0xF0, 0x01, 0xA1, 0x00, 0x00, 0x4A, 0x01, 0x8B, 
+    0xF0, 0x01, 0x04, 0x11, 0x13, 0x10, 0xC0, 0x0E, 0x22, 0x55, 0x11, 0x05, 0x34, 0x15, 0x21, 0x20, 
+    0xA0, 0x05, 0x51, 0x31, 0x72, 0xF0, 0x0B, 0x04, 0x13, 0x12, 0x70, 0xF0, 0x0E, 0x04, 0x21, 0x00, 
+    0x20, 0x49, 0x04, 0x31, 0x32, 0x50, 0x49, 0x02, 0x1B, 0x80, 0xE0, 0x0D, 0x10, 0x21, 0x31, 0x20, 
+    0x02, 0x22, 0x52, 0xA1, 0x09, 0x23, 0x33, 0x11, 0x22, 0x21, 0xA0, 0x02, 0x53, 0x20, 0xF0, 0x0D, 
+    0x42, 0x00, 0x20, 0xF0, 0x0F, 0x05, 0x22, 0x20, 0x01, 0xC0, 0x07, 0x52, 0x24, 0x53, 0x15, 0xF0, 
+    0x02, 0x01, 0xB8, 0xF0, 0x03, 0x1F, 0x34, 0x11, 0x20, 0x11, 0x12, 0x21, 0x15, 0x25, 0x15, 0x35, 
+    0x50, 0x01, 0x00, 0x20, 0x02, 0x31, 0x57, 0x00, 0x70, 0xF0, 0x11, 0x11, 0x11, 0x22, 0x15, 0x02, 
+    0x00, 0x02, 0x50, 0x35, 0x35, 0x4A, 0xD0, 0x00, 0x10, 0xC0, 0x04, 0x41, 0x50, 0x20, 0xA1, 0x14, 
+    0x51, 0x31, 0x12, 0x11, 0x51, 0x20, 0x00, 0x20, 0x05, 0x00, 0x10, 0x58, 0x00, 0x30, 0x55, 0x04, 
+    0x81, 0x80, 0x20, 0x42, 0x01, 0x12, 0xB0, 0x05, 0x12, 0x51, 0x11, 0x48, 0x00, 0x80, 0xE0, 0x0D, 
+    0x80, 0x07, 0x22, 0x31, 0x15, 0x01, 0x10, 0xA1, 0x07, 0x33, 0x52, 0x15, 0x22, 0xD0, 0x05, 0x12, 
+    0x23, 0x32, 0xF0, 0x0D, 0x05, 0x23, 0x17, 0x02, 0xF0, 0x09, 0x17, 0xBB, 0x18, 0x00, 0x02, 0x52, 
+    0x21, 0x50, 0x20, 0x00, 0x55, 0x23, 0x55, 0x51, 0xB0, 0x42, 0x0E, 0x00, 0x11, 0x51, 0x13, 0x11, 
+    0x12, 0x25, 0x20, 0xF0, 0x00, 0x06, 0x12, 0x13, 0x32, 0x20, 0x56, 0x00, 0x10, 0x52, 0x03, 0x01, 
+    0x17, 0xA0, 0x0F, 0x12, 0x22, 0x12, 0x02, 0x00, 0x01, 0x55, 0x51, 0x56, 0x07, 0x31, 0x20, 0x05, 
+    0x12, 0xA1, 0x03, 0x51, 0x55, 0xF0, 0x00, 0x00, 0x20, 0x42, 0x02, 0x51, 0x10, 0x54, 0x04, 0x20, 
+    0x41, 0x10, 0xF0, 0x0D, 0x01, 0x81, 0xA0, 0x06, 0x22, 0x02, 0x51, 0x20, 0x42, 0x05, 0x21, 0x21, 
+    0x44, 0xF0, 0x0A, 0x08, 0x10, 0x11, 0x15, 0x20, 0x00, 0xC1, 0x04, 0x51, 0x10, 0x20, 0xB0, 0x0C, 
+    0x20, 0x02, 0x12, 0x01, 0x21, 0x11, 0x20, 0xF0, 0x0C, 0x04, 0x22, 0x33, 0x30, 0xF0, 0x13, 0x0D, 
+    0x22, 0x00, 0x01, 0x50, 0x20, 0x00, 0x15, 0x49, 0x03, 0x80, 0x0B, 0xE0, 0x0F, 0x53, 0x11, 0x15, 
+    0x02, 0x31, 0x43, 0x10, 0x21, 0xA0, 0x00, 0x20, 0xC0, 0x07, 0x51, 0x20, 0x22, 0x53, 0x4B, 0x02, 
+    0x22, 0x20, 0x46, 0x04, 0x01, 0x43, 0x20, 0xF0, 0x18, 0x01, 0x22, 0xA0, 0x04, 0x21, 0x13, 0x30, 
+    0xF0, 0x0A, 0x07, 0x11, 0x15, 0x11, 0x52, 0xA1, 0x00, 0x50, 0xE0, 0x01, 0x22, 0xB0, 0x06, 0x22, 
+    0x20, 0x02, 0x30, 0x58, 0x03, 0x34, 0x31, 0xF0, 0x13, 0x00, 0x20, 0x43, 0x00, 0x10, 0xB0, 0x03, 
+    0x13, 0x11, 0xF0, 0x07, 0x07, 0x20, 0x11, 0x12, 0x22, 0xA1, 0x04, 0x52, 0x02, 0x20, 0x4A, 0x02, 
+    0x22, 0x10, 0x42, 0x03, 0x14, 0x17, 0x4A, 0x01, 0x02, 0xE0, 0x06, 0x22, 0x13, 0x41, 0x20, 0xF0, 
+    0x14, 0x0D, 0x22, 0x20, 0x12, 0x02, 0x00, 0x03, 0x15, 0xF0, 0x06, 0x03, 0x15, 0x21, 0xA0, 0x04, 
+    0x11, 0x51, 0x20, 0xD0, 0x00, 0x20, 0xB0, 0x42, 0x0A, 0x12, 0x31, 0x20, 0x02, 0x11, 0x20, 0xF0, 
+    0x02, 0xB2, 0x46, 0x02, 0x23, 0x30, 0x5E, 0x05, 0x55, 0x25, 0x12, 0xA0, 0x01, 0x13, 0x4E, 0x11, 
+    0x02, 0x12, 0x02, 0x02, 0x12, 0x00, 0x22, 0x00, 0x02, 0x46, 0x0F, 0x00, 0x02, 0x52, 0x35, 0x05, 
+    0x05, 0x31, 0x02, 0xF0, 0x00, 0xC2, 0xD0, 0x05, 0x12, 0x44, 0x37, 0xF0, 0x15, 0x06, 0x22, 0x25, 
+    0x11, 0x50, 0xA0, 0x01, 0x11, 0xF0, 0x05, 0x0D, 0x21, 0x11, 0x01, 0x10, 0x11, 0x02, 0x22, 0xA0, 
+    0x05, 0x20, 0x52, 0x02, 0x45, 0x09, 0x22, 0x32, 0x25, 0x03, 0x32, 0xF0, 0x01, 0xD2, 0xD0, 0x06, 
+    0x22, 0x44, 0x12, 0x20, 0xF0, 0x16, 0x0A, 0x22, 0x15, 0x52, 0x00, 0x05, 0x50, 0xF0, 0x05, 0x02, 
+    0x11, 0x20, 0xE0, 0x00, 0x20, 0xA0, 0x09, 0x20, 0x00, 0x10, 0x02, 0x02, 0xA0, 0x00, 0x10, 0x42, 
+    0x04, 0x12, 0x23, 0x10, 0x50, 0x00, 0x20, 0x47, 0x04, 0x33, 0x22, 0x20, 0x5E, 0x07, 0x21, 0x12, 
+    0x20, 0x02, 0x4D, 0xF0, 0x07, 0x44, 0x04, 0x25, 0x02, 0x20, 0x46, 0x06, 0x32, 0x14, 0x12, 0x20, 
+    0x55, 0x05, 0x12, 0x13, 0x45, 0x4B, 0x01, 0x22, 0xF0, 0x09, 0x04, 0x22, 0x21, 0x50, 0x5D, 0x1C, 
+    0x20, 0x02, 0x50, 0x02, 0x10, 0x32, 0x03, 0x50, 0x05, 0x20, 0x23, 0x54, 0x23, 0x31, 0x20, 0xF0, 
+    0x00, 0xF2, 0x00, 0xC0, 0x00, 0x20, 0x42, 0x00, 0x10, 0x4B, 0xF0, 0x07, 0x00, 0x20, 0xA0, 0x08, 
+    0x20, 0x05, 0x25, 0x02, 0x20, 0xF0, 0x14, 0x18, 0x13, 0x00, 0x11, 0x23, 0x22, 0x45, 0x01, 0x10, 
+    0x05, 0x35, 0x45, 0x33, 0x30, 0x51, 0x00, 0x20, 0x45, 0x01, 0x34, 0x4F, 0x04, 0x20, 0x00, 0x20, 
+    0x48, 0x00, 0x20, 0xC0, 0x02, 0x22, 0x20, 0x59, 0x00, 0x20, 0xA0, 0x0D, 0x31, 0x02, 0x32, 0x33, 
+    0x22, 0x32, 0x03, 0x43, 0x04, 0x33, 0x53, 0x40, 0x57, 0x03, 0x20, 0x21, 0x4F, 0x0F, 0x72, 0x20, 
+    0x02, 0x20, 0x02, 0x00, 0x02, 0x00, 0x45, 0x02, 0x02, 0x20, 0xF0, 0x0B, 0x22, 0x20, 0x20, 0x22, 
+    0x00, 0x20, 0x05, 0x31, 0x23, 0x32, 0x43, 0x25, 0x32, 0x13, 0x25, 0x22, 0x53, 0x13, 0xD0, 0x4A, 
+    0x00, 0x00, 0xF2, 0x01, 0x42, 0x09, 0x22, 0x14, 0x33, 0x22, 0x28, 0xD0, 0x02, 0x20, 0x00, 0xA2, 
+    0x06, 0x00, 0x22, 0x00, 0x20, 0x43, 0xA0, 0x06, 0x20, 0x20, 0x21, 0x10, 0xF0, 0x03, 0x19, 0x20, 
+    0x02, 0x00, 0x52, 0x21, 0x11, 0x52, 0x21, 0x02, 0x13, 0x55, 0x42, 0x53, 0x43, 0x0A, 0x43, 0x23, 
+    0x52, 0x54, 0x14, 0x40, 0x4A, 0x04, 0x22, 0x00, 0x00, 0xD2, 0x42, 0x08, 0x15, 0x33, 0x42, 0x27, 
+    0x70, 0xA0, 0x00, 0x20, 0x44, 0x00, 0x10, 0x42, 0x0B, 0x52, 0x00, 0x10, 0x05, 0x20, 0x00, 0xA2, 
+    0x06, 0x02, 0x21, 0x15, 0x20, 0xF0, 0x07, 0x02, 0x20, 0x20, 0xA5, 0x09, 0x35, 0x15, 0x13, 0x35, 
+    0x13, 0x44, 0x10, 0x53, 0xD3, 0x33, 0x12, 0x13, 0x3D, 0xD3, 0x11, 0x20, 0x4B, 0x02, 0x00, 0x00, 
+    0xB2, 0x02, 0x02, 0x20, 0xB3, 0x32, 0x12, 0x28, 0x80, 0x20, 0x02, 0x02, 0x10, 0x05, 0x22, 0x20, 
+    0x21, 0x20, 0x11, 0x22, 0x52, 0x00, 0x21, 0x21, 0x22, 0x25, 0x33, 0x50, 0x01, 0xB0, 0x01, 0xB0, 
+    0x47, 0xB1, 0x22, 0x41, 0x21, 0x33, 0x44, 0x34, 0x15, 0x4D, 0x43, 0x35, 0xD4, 0x14, 0x31, 0x23, 
+    0x33, 0xD4, 0x15, 0x22, 0x20, 0x4D, 0x00, 0x00, 0x43, 0x3C, 0x11, 0x33, 0x34, 0x11, 0x77, 0x81, 
+    0x00, 0x70, 0x02, 0x25, 0x20, 0x21, 0x12, 0x22, 0x51, 0x22, 0x55, 0x22, 0x15, 0x10, 0x52, 0x51, 
+    0x22, 0x25, 0x15, 0x01, 0x00, 0x18, 0x01, 0xBB, 0x10, 0xC0, 0xA1, 0x20, 0x41, 0x05, 0x11, 0x53, 
+    0x31, 0x11, 0x44, 0x33, 0x55, 0x53, 0x02, 0xC1, 0x25, 0x33, 0x3C, 0x33, 0x10, 0x49, 0x02, 0x03, 
+    0x30, 0xA0, 0x01, 0x30, 0x42, 0x18, 0x52, 0x15, 0x43, 0x55, 0x21, 0x08, 0xB0, 0x07, 0x81, 0x72, 
+    0x20, 0x03, 0x40, 0xA2, 0x0F, 0x55, 0x22, 0x25, 0x25, 0x15, 0x25, 0x53, 0x15, 0xB1, 0x03, 0x0B, 
+    0x00, 0xAB, 0x0F, 0x11, 0xB1, 0x10, 0x22, 0x11, 0x21, 0x31, 0x52, 0xB1, 0xE3, 0x12, 0x13, 0x13, 
+    0x33, 0xD1, 0x23, 0x33, 0x4D, 0x33, 0x55, 0x20, 0xF0, 0x00, 0x3F, 0x22, 0x20, 0x30, 0x30, 0x02, 
+    0x20, 0x25, 0x22, 0x33, 0x31, 0x12, 0x22, 0x07, 0x00, 0x71, 0x01, 0x78, 0x11, 0x13, 0x52, 0x11, 
+    0x12, 0x25, 0x53, 0x22, 0x53, 0x52, 0x11, 0x55, 0x31, 0x11, 0x30, 0x08, 0x88, 0xBB, 0xB8, 0x00, 
+    0x00, 0xF1, 0x00, 0x0E, 0x33, 0x52, 0x21, 0x13, 0x33, 0x43, 0x31, 0x40, 0xB3, 0x0E, 0x55, 0x53, 
+    0x42, 0x23, 0x34, 0xD4, 0x33, 0x30, 0x49, 0xB0, 0xD2, 0x0B, 0x55, 0x22, 0x43, 0x33, 0x11, 0x22, 
+    0xD0, 0x1F, 0x71, 0x00, 0x21, 0x43, 0x58, 0x11, 0x66, 0x15, 0x43, 0x25, 0x33, 0x25, 0x15, 0x55, 
+    0x11, 0x34, 0xE0, 0x17, 0x10, 0x65, 0x11, 0x16, 0x66, 0x45, 0x13, 0x21, 0x66, 0x41, 0x11, 0x51, 
+    0xA3, 0x0C, 0x51, 0x11, 0x52, 0x43, 0x25, 0x4C, 0xD0, 0x42, 0x00, 0x10, 0x4D, 0x0A, 0x20, 0x02, 
+    0x22, 0x52, 0x25, 0x50, 0x42, 0x03, 0x52, 0x22, 0xA0, 0x28, 0x88, 0x81, 0x11, 0x25, 0x25, 0x44, 
+    0x12, 0x11, 0x63, 0x33, 0xDD, 0x12, 0x33, 0x31, 0x31, 0x51, 0x34, 0x66, 0x00, 0x01, 0x50, 0x42, 
+    0x19, 0x63, 0x21, 0x36, 0x63, 0x64, 0x21, 0x12, 0x24, 0x64, 0x66, 0x41, 0x13, 0x11, 0xA5, 0x0E, 
+    0x11, 0x3C, 0x12, 0x24, 0x44, 0xD3, 0x51, 0x50, 0x49, 0x01, 0x20, 0xE2, 0x22, 0x02, 0x25, 0x20, 
+    0x53, 0x55, 0x05, 0x25, 0x20, 0x0E, 0x61, 0x16, 0x44, 0x11, 0x54, 0x43, 0x55, 0x11, 0x50, 0x42, 
+    0x21, 0x35, 0x33, 0x46, 0xC6, 0x43, 0x43, 0x33, 0x01, 0x43, 0x12, 0x21, 0x63, 0x02, 0x51, 0x15, 
+    0x43, 0x51, 0xA2, 0x06, 0x51, 0x51, 0x31, 0x10, 0xA3, 0x07, 0x55, 0x33, 0x15, 0x44, 0xA5, 0x0A, 
+    0x34, 0x3D, 0x43, 0x43, 0x11, 0x50, 0xA2, 0x12, 0x02, 0x20, 0x11, 0x53, 0x31, 0x51, 0x11, 0x31, 
+    0x11, 0x30, 0xA5, 0xA3, 0x3F, 0x52, 0x01, 0x52, 0x55, 0x51, 0x15, 0x14, 0x33, 0x11, 0x51, 0x44, 
+    0x4C, 0x33, 0x31, 0x13, 0x11, 0x14, 0x34, 0x41, 0x14, 0xDD, 0x12, 0x21, 0x44, 0x10, 0x05, 0x15, 
+    0x3D, 0x45, 0x55, 0x20, 0x21, 0x03, 0x15, 0x52, 0xE5, 0x0D, 0x11, 0x34, 0x43, 0x11, 0x52, 0x51, 
+    0x33, 0xB4, 0x03, 0x31, 0x15, 0xA1, 0x06, 0x50, 0x44, 0x34, 0x40, 0xA3, 0xB4, 0x43, 0x04, 0x13, 
+    0x33, 0x10, 0xB5, 0x05, 0x14, 0x11, 0x15, 0xA4, 0x07, 0x14, 0x15, 0x11, 0x3D, 0x43, 0x02, 0x11, 
+    0x30, 0xA1, 0x0A, 0x31, 0x1D, 0xD4, 0x10, 0x11, 0x10, 0x44, 0x0D, 0x14, 0x44, 0x12, 0x25, 0x55, 
+    0x25, 0x11, 0xB5, 0x02, 0x11, 0x30, 0xA1, 0xC3, 0x02, 0x44, 0x40, 0xC3, 0x0A, 0x11, 0x31, 0x13, 
+    0x34, 0x41, 0x10, 0xE4, 0x07, 0x34, 0x43, 0x33, 0x13, 0xA4, 0xA3, 0x07, 0x15, 0x11, 0x15, 0x44, 
+    0xA1, 0x0A, 0x54, 0x44, 0x34, 0x31, 0x13, 0x30, 0xA4, 0x01, 0x34, 0xB3, 0xA1, 0x03, 0xD0, 0x05, 
+    0xB4, 0xC1, 0x02, 0x34, 0x40, 0xA1, 0x0D, 0x55, 0x11, 0x50, 0x02, 0x05, 0x51, 0x4D, 0xF4, 0x00, 
+    0x02, 0x6C, 0x60, 0x45, 0xD3, 0x05, 0x44, 0x31, 0x11, 0xA3, 0xF4, 0x00, 0x29, 0x33, 0x34, 0x35, 
+    0x33, 0x43, 0x31, 0x55, 0x11, 0x33, 0x31, 0x41, 0x13, 0x31, 0x43, 0x16, 0x66, 0x34, 0x43, 0x13, 
+    0x33, 0x61, 0xB5, 0x24, 0x30, 0x35, 0x15, 0x11, 0x51, 0x10, 0x00, 0x61, 0x11, 0x55, 0x51, 0x50, 
+    0x13, 0x15, 0x52, 0x25, 0x02, 0x55, 0x10, 0xB3, 0x03, 0x44, 0x4D, 0xC4, 0x07, 0x33, 0x44, 0x34, 
+    0x33, 0xF4, 0x00, 0xED, 0x05, 0x44, 0x35, 0x31, 0xA3, 0x00, 0x40, 0xC3, 0x21, 0x13, 0x34, 0x44, 
+    0xC0, 0x43, 0x31, 0x14, 0x35, 0x30, 0x04, 0x44, 0x35, 0x11, 0x33, 0x15, 0x51, 0x55, 
+};
+
+const gfx_image_t STORY_CH8_IMG = {
+    .w = STORY_CH8_W, .h = STORY_CH8_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH8_PAL, .colors = STORY_CH8_PAL_SIZE,
+    .data = STORY_CH8_RLE, .size = STORY_CH8_RLE_SIZE,
 };
@@ -6,289 +6,204 @@ const uint16_t STORY_CH8_ENEMY_PAL[STORY_CH8_ENEMY_PAL_SIZE] = {
     0x3207, 0x634E, 0x31C8, 0x6BB0, 0x3A09, 0x424A, 0x6B8F, 0x52CC, 
 };
 
-const uint8_t STORY_CH8_ENEMY_IDX[(STORY_CH8_ENEMY_W * STORY_CH8_ENEMY_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x0C, 0x00, 
-    0xAC, 0x1F, 0x19, 0x99, 0x99, 0x99, 0x9E, 0x9E, 0xBB, 0xBB, 0x22, 0x24, 0x55, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x54, 0x43, 0x33, 0x22, 0x22, 0x22, 0xBB, 0xBB, 0xBB, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xF1, 0xCC, 0xDD, 0xCC, 0xCA, 0xCA, 0x0A, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0xAA, 0x0A, 
-    0xAD, 0xF1, 0x99, 0x99, 0x99, 0x99, 0xEE, 0xEB, 0xBB, 0xBB, 0x22, 0x34, 0x45, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x54, 0x44, 0x33, 0x32, 0xB2, 0x22, 0xBB, 0xBB, 0xBB, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xDC, 0xCD, 0xDD, 0xAA, 0xAA, 0xAA, 0xA0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAC, 
-    0xCF, 0x19, 0x99, 0x99, 0x99, 0x99, 0xE9, 0xEB, 0xBB, 0xBB, 0x22, 0x34, 0x44, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x54, 0x44, 0x33, 0x32, 0x2B, 0x22, 0xBB, 0xBB, 0xBE, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0xCC, 0xDC, 0xAA, 0x00, 0xAA, 0xA0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 
-    0xC1, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0xEB, 0xBB, 0xBB, 0x23, 0x44, 0x44, 0x55, 0x55, 0x55, 
-    0x55, 0x55, 0x54, 0x43, 0x33, 0x32, 0x2B, 0x22, 0xBB, 0xBB, 0xBE, 0xBE, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xCC, 0xDA, 0xA0, 0x0A, 0xAA, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xDA, 
-    0xD1, 0x99, 0x99, 0x99, 0x99, 0xEE, 0xE9, 0xBB, 0xBB, 0xBB, 0x24, 0x44, 0x45, 0x54, 0x55, 0x55, 
-    0x55, 0x55, 0x54, 0x43, 0x33, 0x32, 0x22, 0x22, 0xBB, 0xBB, 0xBB, 0xB9, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xDC, 0xCA, 0x00, 0xAA, 0xAA, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xCD, 0xCC, 
-    0xF9, 0x99, 0x99, 0x9E, 0x9E, 0xEE, 0xEB, 0xB9, 0xBB, 0xBB, 0x24, 0x44, 0x45, 0x55, 0x55, 0x55, 
-    0x44, 0x45, 0x44, 0x43, 0x33, 0x32, 0x2B, 0xBB, 0xBB, 0xBB, 0xBE, 0xBE, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFD, 0xC0, 0x00, 0x0A, 0xA0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAC, 0x1C, 0xAD, 
-    0x19, 0x99, 0x99, 0x9E, 0x99, 0xEE, 0xEB, 0xEB, 0xBB, 0xB2, 0x34, 0x44, 0x45, 0x55, 0x55, 0x54, 
-    0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x2B, 0xBB, 0xBB, 0xBE, 0xEE, 0xBB, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1D, 0xC0, 0x0A, 0xA0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCA, 0xAD, 0xDC, 0xDF, 
-    0x99, 0x99, 0x99, 0x9E, 0x99, 0xEE, 0xBB, 0xEB, 0xBB, 0x22, 0x34, 0x44, 0x45, 0x44, 0x55, 0x45, 
-    0x44, 0x45, 0x44, 0x44, 0x33, 0x33, 0x22, 0xBB, 0xBB, 0xBB, 0xBE, 0xEB, 0xE9, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xD0, 0x0A, 0xA0, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x0A, 0xDF, 0xDD, 0x11, 
-    0x99, 0x99, 0x99, 0xEE, 0xE9, 0xEB, 0xBE, 0xBB, 0xBB, 0x22, 0x34, 0x44, 0x55, 0x24, 0x55, 0x54, 
-    0x34, 0x45, 0x44, 0x44, 0x33, 0x33, 0x22, 0xBB, 0xBB, 0xBB, 0xBE, 0xEB, 0xBE, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xD0, 0x0A, 0xA0, 0xA0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0xCD, 0xFF, 0xD1, 0xF1, 
-    0x99, 0x99, 0x99, 0x9E, 0xEE, 0xBB, 0xBE, 0xBB, 0xB2, 0x33, 0x44, 0x44, 0x53, 0x25, 0x55, 0x52, 
-    0x35, 0x44, 0x44, 0x44, 0x33, 0x33, 0x32, 0xBB, 0xBB, 0xBB, 0xBE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFA, 0xAD, 0xAA, 0xA0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xCF, 0xFD, 0xDD, 0xF9, 
-    0x99, 0x99, 0x99, 0x9E, 0xEE, 0xBB, 0xBE, 0xBB, 0x22, 0x33, 0x44, 0x44, 0x46, 0x25, 0x55, 0x41, 
-    0x34, 0x44, 0x44, 0x44, 0x33, 0x33, 0x32, 0xBB, 0xBB, 0xBB, 0xBB, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFD, 0xCD, 0xDC, 0xC0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAC, 0xCF, 0xFD, 0x1D, 0xF9, 
-    0x99, 0x99, 0x99, 0x9E, 0xEB, 0xBB, 0xBE, 0xB2, 0x23, 0x34, 0x44, 0x44, 0x26, 0x34, 0x55, 0x2F, 
-    0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x32, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xEE, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFD, 0xCD, 0xDD, 0xCA, 0x0A, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAC, 0xDF, 0xCD, 0xFF, 0x19, 
-    0x99, 0x99, 0x99, 0xEB, 0xEB, 0xBB, 0xBB, 0x22, 0x33, 0x34, 0x44, 0x44, 0x6B, 0x45, 0x55, 0xBF, 
-    0x44, 0x44, 0x54, 0x44, 0x43, 0x33, 0x33, 0x2B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xEE, 0xEE, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xF1, 0xCF, 0xDD, 0xCA, 0x0A, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCD, 0xDC, 0xD1, 0xF1, 0x19, 
-    0x99, 0x99, 0x9E, 0xBE, 0xEB, 0xBB, 0xB2, 0xB2, 0x34, 0x34, 0x44, 0x53, 0x63, 0x55, 0x55, 0xF1, 
-    0x43, 0x44, 0x54, 0x44, 0x43, 0x33, 0x33, 0x2B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xBB, 0xBB, 0xE9, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xDF, 0x1D, 0xDA, 0xAC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0xCD, 0xDD, 0xCC, 0x1F, 0x11, 0x19, 
-    0x99, 0x9E, 0xEE, 0x9E, 0xEB, 0xBB, 0x2B, 0x33, 0x43, 0x44, 0x44, 0x4B, 0xB5, 0x54, 0x53, 0x7F, 
-    0x32, 0x43, 0x55, 0x44, 0x43, 0x33, 0x32, 0x2B, 0xBB, 0xBB, 0xBB, 0xBB, 0xEE, 0xBB, 0xBB, 0xBE, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0x1C, 0xCC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0C, 0xDD, 0xDD, 0xCD, 0xF1, 0x99, 0x99, 
-    0x99, 0x9E, 0xE9, 0xEB, 0xEB, 0xB2, 0xB2, 0x33, 0x33, 0x44, 0x45, 0x31, 0x35, 0x52, 0x26, 0x71, 
-    0x22, 0x22, 0x44, 0x54, 0x43, 0x33, 0x32, 0x2B, 0xBB, 0xBB, 0xBE, 0xEB, 0xEE, 0xBB, 0xBB, 0xBE, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF1, 0x1F, 0xFF, 0x1D, 0xCC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x0A, 0x00, 0xAC, 0xDD, 0xCC, 0xDD, 0x99, 0x99, 0x99, 
-    0x99, 0xEE, 0x99, 0xEB, 0xEB, 0xB2, 0x23, 0x33, 0x33, 0x44, 0x45, 0xB1, 0x45, 0x46, 0x21, 0x7B, 
-    0x22, 0x2B, 0xB3, 0x44, 0x43, 0x33, 0x32, 0x2B, 0xBB, 0xBB, 0xBE, 0xEE, 0xEE, 0xBB, 0xBB, 0xBE, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFD, 0xDF, 0xFF, 0xFD, 0xAC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xA0, 0x0C, 0x00, 0x0A, 0xDD, 0xCC, 0xD1, 0x99, 0x99, 0x99, 
-    0x9E, 0xE9, 0x99, 0xEE, 0xBB, 0x22, 0x32, 0x33, 0x34, 0x44, 0x44, 0x6B, 0x43, 0x26, 0x27, 0x7B, 
-    0x3B, 0x21, 0xF2, 0x34, 0x43, 0x33, 0x32, 0xBB, 0xBB, 0xBE, 0xEE, 0x9E, 0xEE, 0xBB, 0xBB, 0xBB, 
-    0xE9, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFD, 0xDF, 0xFF, 0xFC, 0xAA, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x0C, 0x00, 0x00, 0xCD, 0xDC, 0x19, 0x99, 0x99, 0x99, 
-    0x9E, 0xE9, 0x9B, 0xBE, 0xBB, 0x23, 0x33, 0x33, 0x34, 0x44, 0x44, 0x12, 0x46, 0xBB, 0x1A, 0x1F, 
-    0xB6, 0x61, 0x1F, 0xBB, 0x33, 0x33, 0x32, 0x2B, 0xBB, 0xBB, 0xEB, 0x99, 0xEE, 0xBB, 0xBB, 0xEE, 
-    0xE9, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0xFD, 0xD1, 0xFF, 0xDC, 0xCC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCA, 0xA0, 0x00, 0x0A, 0xDD, 0xCC, 0x19, 0x99, 0x99, 0x99, 
-    0x9E, 0xE9, 0xEB, 0xEB, 0xB2, 0x22, 0x33, 0x33, 0x44, 0x44, 0x43, 0xF2, 0x41, 0xBB, 0xFC, 0xFF, 
-    0x1B, 0x69, 0x1F, 0xF1, 0x33, 0x33, 0x33, 0x22, 0xBB, 0xBB, 0xBB, 0xE9, 0xEE, 0xEB, 0xBB, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x1D, 0xDD, 0x1F, 0xDD, 0xDC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xDC, 0x0A, 0xAA, 0xAA, 0xAC, 0xAD, 0x99, 0x99, 0x99, 0x99, 
-    0x9E, 0x99, 0xBB, 0xBB, 0x22, 0x23, 0x33, 0x33, 0x44, 0x44, 0x42, 0x62, 0x21, 0xBB, 0x7C, 0xFF, 
-    0x1B, 0xB9, 0x1E, 0x1F, 0xB3, 0x33, 0x33, 0x22, 0x2B, 0xBB, 0xBE, 0x99, 0x9E, 0xEB, 0xBB, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xCD, 0xDD, 0xCD, 0xDD, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAC, 0xCA, 0xAA, 0xAA, 0xC1, 0x99, 0x99, 0x99, 0x99, 
-    0xE9, 0x9E, 0xBB, 0xBB, 0x22, 0x23, 0x33, 0x34, 0x44, 0x44, 0x4B, 0x62, 0xF1, 0xB6, 0xCD, 0xDD, 
-    0xF9, 0xB1, 0x11, 0x1F, 0xF2, 0x43, 0x33, 0x22, 0x2B, 0xBB, 0xBB, 0x99, 0x9E, 0xEE, 0xEB, 0xBE, 
-    0xBE, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x91, 0xDC, 0xCC, 0xC1, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 0xCC, 0xAA, 0xCC, 0xD9, 0x99, 0x99, 0x99, 0x9E, 
-    0xE9, 0xEB, 0xBB, 0x2B, 0xB2, 0x33, 0x33, 0x33, 0x44, 0x44, 0x46, 0xFF, 0xF6, 0xB1, 0xCD, 0xDD, 
-    0x1F, 0x91, 0xE1, 0xFF, 0xF1, 0x34, 0x33, 0x32, 0x22, 0xBB, 0xBB, 0x99, 0x99, 0xEE, 0xEE, 0xBB, 
-    0xBE, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1C, 0xAA, 0xDF, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 0xCA, 0xCC, 0xCC, 0xCC, 0xF9, 0x99, 0x99, 0x99, 0x9E, 
-    0xE9, 0xEB, 0x22, 0xBB, 0x22, 0x32, 0x33, 0x33, 0x33, 0x34, 0x3F, 0xFF, 0x1F, 0xFC, 0xCC, 0xD1, 
-    0x1F, 0x91, 0xE9, 0x2F, 0xF7, 0xB4, 0x33, 0x33, 0x32, 0xBB, 0xBB, 0xEE, 0x99, 0x9E, 0xEE, 0xEB, 
-    0xBE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x91, 0x1D, 0xDA, 0xDF, 0xFF, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xCC, 0xCD, 0xDD, 0xD1, 0x19, 0x99, 0x99, 0x99, 0x9E, 
-    0xEE, 0xB2, 0x2B, 0xBB, 0x23, 0x33, 0x32, 0x33, 0x33, 0x34, 0x3B, 0xB1, 0x1F, 0xCC, 0xCD, 0x1F, 
-    0xFF, 0x11, 0xFF, 0xB9, 0x1F, 0x13, 0x33, 0x32, 0x32, 0xBB, 0xBB, 0xEE, 0xE9, 0x99, 0xEE, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF1, 0xFD, 0xD1, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xCC, 0xCD, 0xDF, 0x1F, 0x99, 0x99, 0x99, 0x99, 0x9E, 
-    0xEE, 0x2B, 0xBB, 0xB2, 0x22, 0x23, 0x32, 0x33, 0x33, 0x44, 0x2F, 0x99, 0xFF, 0xDC, 0xCD, 0xDD, 
-    0xD1, 0xF1, 0xD1, 0xF9, 0xB1, 0xF3, 0x33, 0x32, 0x23, 0x2B, 0xBB, 0xBE, 0xE9, 0x99, 0xEE, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF1, 0xF1, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xDD, 0xDD, 0xCD, 0x11, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x9E, 
-    0xEE, 0xBB, 0xBB, 0xB2, 0x22, 0x33, 0x33, 0x33, 0x33, 0x44, 0xBC, 0x11, 0x1C, 0xCC, 0xCA, 0xD1, 
-    0xD1, 0x1D, 0xDF, 0xFF, 0x99, 0x12, 0x33, 0x33, 0x23, 0x2B, 0xBB, 0xBE, 0x99, 0x99, 0xEE, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF1, 0xFF, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xDD, 0xDD, 0xD1, 0x19, 0x99, 0x99, 0x99, 0x99, 0x9E, 
-    0xEB, 0xBB, 0xBB, 0x22, 0x23, 0x33, 0x33, 0x43, 0x33, 0x43, 0xFF, 0x1F, 0xCC, 0xCC, 0xDD, 0x1C, 
-    0xCD, 0x1D, 0xCD, 0x1F, 0xF1, 0xF1, 0x33, 0x33, 0x22, 0x2B, 0xBB, 0xBB, 0xEE, 0x99, 0xEE, 0xEE, 
-    0xEE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFD, 0xFF, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xDD, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x99, 0x9E, 
-    0xBB, 0xBB, 0xB2, 0x22, 0x23, 0x33, 0x22, 0x33, 0x34, 0x4B, 0xF1, 0xFD, 0xCD, 0xCC, 0xCC, 0xCC, 
-    0xCC, 0xDD, 0xDD, 0x11, 0x1F, 0xFF, 0x23, 0x33, 0x32, 0x22, 0xBB, 0xBB, 0xBE, 0xEE, 0xEE, 0xE9, 
-    0xEE, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11, 0xFF, 0xF1, 0x11, 
-    0x00, 0x00, 0x00, 0x0A, 0xCC, 0xCA, 0x0C, 0xDD, 0xDD, 0x11, 0x19, 0x99, 0x99, 0x99, 0x99, 0xEE, 
-    0xBB, 0xBB, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x23, 0x34, 0x46, 0xDF, 0xFD, 0xDC, 0xCA, 0xCC, 0xDC, 
-    0xCC, 0xCC, 0xCD, 0x11, 0xDF, 0xFF, 0x93, 0x33, 0x33, 0x22, 0x2B, 0xBB, 0xBB, 0xEE, 0xEE, 0x99, 
-    0x9E, 0xEE, 0x99, 0x99, 0x99, 0x9E, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xF1, 0x11, 
-    0x00, 0x00, 0x00, 0xAC, 0xD1, 0xDD, 0xDD, 0xDD, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEB, 
-    0xBB, 0xBB, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x34, 0x3F, 0xFF, 0xDF, 0xCC, 0xCA, 0xCD, 0xDC, 
-    0xCC, 0xCC, 0xCD, 0x1D, 0xDF, 0xFF, 0x13, 0x23, 0x33, 0x22, 0x2B, 0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x9E, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xF1, 0xD1, 
-    0x00, 0x00, 0x00, 0xCC, 0xAD, 0xDD, 0xD1, 0xDD, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEB, 
-    0xBB, 0xBB, 0xB2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x2F, 0x11, 0xFF, 0xCC, 0xAC, 0xCC, 0xAC, 
-    0xCC, 0xCC, 0xCD, 0x1D, 0xDF, 0xFF, 0xFB, 0xB3, 0x33, 0x33, 0x2B, 0xBB, 0xBB, 0xBE, 0xEE, 0xEE, 
-    0x9E, 0xEE, 0xE9, 0x99, 0x99, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xF1, 0xD1, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xDD, 0xCF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEB, 
-    0xBB, 0xB2, 0x22, 0x22, 0xB2, 0x22, 0x22, 0x22, 0x23, 0xBF, 0x11, 0x11, 0xAC, 0xAC, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0x11, 0xDF, 0xFF, 0x19, 0xB2, 0x33, 0x22, 0x22, 0xBB, 0xBB, 0xBE, 0xEE, 0xEE, 
-    0x9E, 0xEE, 0xEE, 0xE9, 0x99, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF, 0xD1, 
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0xDD, 0x19, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0xEB, 
-    0xBB, 0xB2, 0x22, 0x2B, 0xBB, 0x22, 0x22, 0x22, 0x23, 0xBF, 0xFF, 0x1C, 0xCC, 0xAC, 0xCC, 0xCC, 
-    0xAC, 0xCC, 0xCC, 0xD1, 0xDF, 0x1F, 0xD1, 0xB2, 0x2B, 0xBB, 0xB2, 0xBB, 0xBB, 0xBB, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE9, 0xEE, 0xE9, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xDD, 
-    0x00, 0x00, 0x0A, 0xAA, 0xD1, 0x1F, 0x11, 0x99, 0x99, 0x99, 0xEE, 0x99, 0x99, 0x99, 0x9E, 0xEB, 
-    0xBB, 0xB2, 0x22, 0xBB, 0xBB, 0x23, 0x22, 0x23, 0x33, 0x1F, 0xFF, 0xFA, 0xCA, 0xAA, 0xCC, 0xCC, 
-    0xAA, 0xCD, 0xCC, 0xCD, 0x1F, 0x11, 0xFF, 0xB2, 0x2B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 0xEE, 
-    0xEE, 0xEE, 0xE9, 0xEE, 0xE9, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xDD, 
-    0x0C, 0xA0, 0xAC, 0xAC, 0x11, 0xFF, 0x19, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0xBB, 
-    0xBB, 0xBB, 0x2B, 0xBB, 0xBB, 0x22, 0x22, 0x22, 0x2B, 0x1F, 0xDC, 0xDA, 0xAA, 0xAC, 0xCC, 0xCC, 
-    0xCA, 0xAC, 0xCC, 0xDC, 0xDF, 0x9E, 0x1D, 0x6B, 0x2B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xDD, 
-    0xCD, 0xAA, 0xDC, 0xAD, 0x1F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x22, 0x22, 0x2B, 0xBB, 0x1F, 0xDA, 0xAA, 0xAC, 0xCC, 0xAA, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xDC, 0xDF, 0x19, 0x9D, 0x12, 0x22, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x91, 0x1F, 0x11, 
-    0xDD, 0xAD, 0xDA, 0xCC, 0xDD, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xB2, 0x22, 0x22, 0xBB, 0xBB, 0xFD, 0xDC, 0xCD, 0xDD, 0xDC, 0xCA, 0xAC, 
-    0xCC, 0xCA, 0xCC, 0xCC, 0xDF, 0xF9, 0x9D, 0xF3, 0x32, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x1F, 0xFF, 
-    0xCD, 0xAC, 0xAA, 0xDD, 0xDD, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xEB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x22, 0x2B, 0xBB, 0xBB, 0xFD, 0xCC, 0x1F, 0xDD, 0xCC, 0xCA, 0xAC, 
-    0xCC, 0xAA, 0xAC, 0xCC, 0xC1, 0xD1, 0xFD, 0xCB, 0x22, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF, 
-    0x00, 0x00, 0x0C, 0xDD, 0xDD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEE, 0xEE, 0x99, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x22, 0xBB, 0x66, 0x61, 0x11, 0xFF, 0xF1, 0xDC, 0xCC, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAC, 0xCC, 0xCC, 0xAD, 0xFD, 0xDF, 0x22, 0x2B, 0xBB, 0xB2, 0xBB, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0x1F, 
-    0x0A, 0x00, 0xAD, 0xDD, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEE, 0x99, 0x96, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xB2, 0x2B, 0x66, 0x11, 0x11, 0x11, 0x11, 0xFC, 0xCC, 0xCC, 0xCC, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0xCD, 0xFF, 0x1F, 0xF2, 0x32, 0x2B, 0xB2, 0x2B, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 
-    0xAA, 0x00, 0xCD, 0xD1, 0x11, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0xB2, 0x2B, 0x66, 0x11, 0x11, 0x11, 0x1F, 0xDD, 0xDC, 0xCC, 0xCC, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xFF, 0xFF, 0xFB, 0x63, 0xBB, 0xB2, 0x2B, 0xBB, 0xBB, 0xBB, 
-    0xBB, 0x9E, 0xBE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF, 
-    0xAA, 0xA0, 0xAD, 0xF1, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0x22, 0x26, 0x61, 0xFF, 0xFF, 0xFF, 0xFD, 0x1D, 0xDD, 0xCC, 0xCC, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAD, 0x1F, 0xFF, 0xFF, 0x92, 0xFB, 0x22, 0x2B, 0xBB, 0x6B, 0xBB, 
-    0xB9, 0x99, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0xFD, 0x1F, 
-    0xAD, 0xDA, 0xC1, 0xF1, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x99, 0x9B, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xBB, 0x23, 0xB6, 0x1F, 0xFF, 0x11, 0xDF, 0xDC, 0xCC, 0xDD, 0xCC, 0xCC, 0xCC, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xD1, 0x11, 0xFF, 0xF1, 0xBB, 0x1B, 0x22, 0xBB, 0x6B, 0xBB, 
-    0xBE, 0x99, 0x9E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x91, 0xD1, 
-    0xA1, 0xDC, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xEE, 0xEE, 0x99, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0xB2, 0x33, 0xB1, 0xFF, 0xF1, 0xDD, 0xDD, 0xCC, 0xCD, 0xDD, 0xCC, 0xCC, 0xCC, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xDD, 0xDF, 0xFF, 0xFD, 0x1F, 0xFB, 0xB2, 0xBB, 0x6B, 0xBB, 
-    0xBE, 0x99, 0x9E, 0xE9, 0x99, 0xEB, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xCC, 
-    0xCD, 0xCD, 0x1F, 0xDF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xEE, 0xE9, 0x11, 0x1B, 
-    0xBB, 0xBB, 0xBB, 0xB2, 0x22, 0x61, 0xFF, 0xFD, 0xDD, 0xCC, 0xCC, 0x1F, 0xF1, 0xDA, 0xAC, 0xCA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x9B, 0x11, 0xFD, 0xCF, 0x9F, 0xB2, 0x2B, 0xBB, 0xBB, 
-    0xB9, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xEE, 0xEE, 0xEE, 0xEE, 0xE9, 0x99, 0x99, 0x99, 0x91, 0xCC, 
-    0xDD, 0xC1, 0x1F, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEB, 0xBB, 0xE1, 0x11, 0x16, 
-    0x1B, 0xBB, 0xBB, 0xB2, 0x2B, 0x11, 0xFF, 0xDC, 0xCC, 0xCC, 0xCC, 0xD1, 0xFF, 0xFD, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x12, 0x3E, 0xFF, 0xFF, 0xCD, 0xFF, 0xBB, 0x22, 0xBB, 0xBB, 
-    0xB9, 0xB9, 0x99, 0x99, 0x99, 0x99, 0x9B, 0xEB, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x9F, 0xCC, 
-    0xCC, 0xC1, 0xF1, 0x19, 0x99, 0x99, 0x9E, 0xEE, 0xE9, 0x99, 0xEE, 0xBB, 0xBB, 0x91, 0x11, 0x11, 
-    0x1B, 0xBB, 0xB9, 0x96, 0xBB, 0xFF, 0xF1, 0xDC, 0xCC, 0xAA, 0xAA, 0xCD, 0x19, 0x91, 0xCC, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x93, 0x9F, 0xF1, 0xFD, 0xCD, 0xDF, 0xF1, 0x12, 0xBB, 0xBB, 
-    0xBB, 0xBB, 0xBB, 0x91, 0xF1, 0xEE, 0xBB, 0xEB, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0xDD, 
-    0xDD, 0xC1, 0x11, 0x1E, 0xEE, 0xE9, 0xEB, 0xBB, 0xEE, 0xEB, 0xBB, 0xBB, 0xBB, 0x11, 0x11, 0x11, 
-    0x19, 0xBB, 0x11, 0x99, 0x61, 0xFF, 0x1C, 0xCA, 0xCC, 0xAA, 0xAA, 0xCD, 0xFF, 0x99, 0xDA, 0xAA, 
-    0xAA, 0xAA, 0x0A, 0xAA, 0xAA, 0xDF, 0x9F, 0x1D, 0xDD, 0xDA, 0xAC, 0xDD, 0xFF, 0x1B, 0xB2, 0xB2, 
-    0x22, 0x2B, 0xB9, 0xFD, 0xCF, 0xEB, 0xBB, 0xEB, 0xEE, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x1D, 
-    0x11, 0xDD, 0xF1, 0x1E, 0xEB, 0xE9, 0x99, 0x9E, 0xEE, 0xBB, 0xBB, 0x91, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x99, 0x11, 0x19, 0x1F, 0xFF, 0xCC, 0xCA, 0xAA, 0xAA, 0xAA, 0xCD, 0xFD, 0x1F, 0x1A, 0x0A, 
-    0xAA, 0x00, 0x00, 0x00, 0xAD, 0xF9, 0x91, 0x1D, 0xDC, 0xDA, 0xAC, 0xCD, 0x1F, 0x19, 0xBB, 0xB2, 
-    0x2B, 0xB2, 0x1B, 0xF1, 0x1D, 0x1B, 0xBB, 0xBE, 0xE9, 0xF1, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x91, 
-    0xFD, 0x11, 0xF1, 0xBB, 0xEB, 0x91, 0x1F, 0x9B, 0xBB, 0xBB, 0xB9, 0x11, 0x11, 0x11, 0x11, 0x1F, 
-    0x19, 0x11, 0xF1, 0x91, 0xFF, 0xFC, 0xCC, 0xCC, 0xCA, 0xAA, 0xAA, 0xCD, 0xFD, 0xF1, 0xFD, 0xCC, 
-    0xAA, 0xCC, 0xCC, 0xDD, 0xC1, 0xF1, 0xFF, 0xDA, 0xAA, 0xAA, 0xAC, 0xCC, 0xDD, 0xF1, 0x6B, 0x22, 
-    0x2B, 0x22, 0x66, 0x1F, 0xDC, 0xA1, 0xBB, 0xE9, 0x91, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xCA, 0xC1, 0xF1, 0xBB, 0xB9, 0xFF, 0xFF, 0x1B, 0xBB, 0xBB, 0xB1, 0xF1, 0x11, 0x11, 0x11, 0xFF, 
-    0x19, 0x11, 0x11, 0xFF, 0xFF, 0xDC, 0x11, 0x11, 0xCD, 0xCC, 0xCA, 0xCC, 0xDD, 0xDD, 0x11, 0xDD, 
-    0xDD, 0x11, 0x11, 0x11, 0xD1, 0xFF, 0xFD, 0xAA, 0xCD, 0xDA, 0xAA, 0xAA, 0xAA, 0xAC, 0xFF, 0x11, 
-    0x11, 0xFF, 0xF1, 0x1C, 0xAA, 0xAF, 0xBB, 0x99, 0x9F, 0xFF, 0x99, 0x99, 0x99, 0x99, 0xEE, 0xEE, 
-    0xCA, 0xAA, 0xC1, 0xBB, 0xE1, 0xFF, 0xF1, 0x1B, 0xBB, 0xBB, 0x1F, 0xF1, 0x11, 0x11, 0x11, 0xF1, 
-    0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xDC, 0xCD, 0xC1, 0xDD, 0xCC, 0xAA, 0xCA, 0xCC, 0xAA, 0xCC, 0xAC, 
-    0xDD, 0x19, 0x11, 0x11, 0xDF, 0x11, 0xDA, 0x0D, 0x1D, 0x11, 0x1D, 0xAA, 0xAA, 0xCC, 0xDF, 0xF1, 
-    0xCF, 0x1B, 0xFD, 0xAA, 0xAA, 0xAF, 0xBB, 0x99, 0x1F, 0xFF, 0x9E, 0x99, 0x99, 0x9E, 0xEE, 0xEE, 
-    0xDA, 0xAD, 0xC1, 0xBE, 0x1F, 0xFF, 0xFF, 0x99, 0x9B, 0xB1, 0xFF, 0x11, 0x11, 0x11, 0x1F, 0xF1, 
-    0x19, 0x99, 0x1F, 0xFF, 0xFF, 0xCA, 0xCA, 0xC1, 0x1D, 0xCC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xDC, 
-    0xDC, 0xDC, 0xCC, 0xCC, 0xDF, 0x91, 0xCA, 0xAC, 0xD1, 0x11, 0xDD, 0xCC, 0xCC, 0xDD, 0xDF, 0xFF, 
-    0x1F, 0xFF, 0xDA, 0xAA, 0x0A, 0xCD, 0xBB, 0x99, 0x11, 0xF1, 0x9E, 0x99, 0xE9, 0xEE, 0xEE, 0xEE, 
-    0xCA, 0xD1, 0x11, 0xEF, 0xF1, 0xFF, 0xFF, 0x99, 0x91, 0x11, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x19, 
-    0x99, 0xB9, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xC8, 0xCC, 0xCA, 0xAA, 0xAA, 0xA0, 0xAA, 0xAD, 0x1D, 
-    0x11, 0x11, 0x11, 0x1C, 0x1F, 0xFD, 0xAA, 0xAD, 0x11, 0x11, 0xDC, 0xD1, 0x11, 0xDC, 0xDF, 0xFF, 
-    0xDD, 0xDC, 0xAA, 0xAA, 0xAC, 0xCC, 0xF9, 0x99, 0x11, 0x11, 0x9E, 0xEE, 0xEE, 0xEE, 0xBB, 0xBE, 
-    0xAA, 0xCC, 0xD1, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0x99, 0x11, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x99, 0x1F, 0xFF, 0x11, 0x1C, 0xAA, 0xCA, 0xAC, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA, 0xAC, 0xD1, 
-    0x11, 0x11, 0x11, 0xDC, 0xD1, 0xCA, 0xAA, 0xDD, 0xDD, 0x1D, 0xDD, 0x11, 0x11, 0x1D, 0xDD, 0xD1, 
-    0xDC, 0xCC, 0xAA, 0xAA, 0xAC, 0xCC, 0xD1, 0x11, 0x1F, 0x11, 0x9E, 0xEE, 0xEE, 0xBB, 0xBB, 0xBE, 
-    0xAA, 0xD1, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0xF1, 0x11, 0x11, 0x11, 0xF1, 0x1D, 
-    0xFF, 0xDF, 0xDD, 0xD1, 0xDC, 0xCC, 0xCA, 0xCC, 0xCA, 0xAA, 0xAA, 0xCA, 0xA0, 0x0A, 0xAC, 0xCC, 
-    0xCC, 0xCD, 0xDC, 0xCC, 0xCC, 0xAA, 0xAC, 0xDD, 0xDC, 0xCD, 0x11, 0x11, 0x11, 0x11, 0xD1, 0xDD, 
-    0xDC, 0xCA, 0xAA, 0xAC, 0xAA, 0xAA, 0xC1, 0x1F, 0xFF, 0x11, 0x9E, 0xBB, 0xBB, 0xBB, 0xBB, 0xBE, 
-    0xAC, 0xF1, 0x11, 0x11, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0xFD, 0xDD, 
-    0xDD, 0xFD, 0xDD, 0x11, 0xDD, 0xDD, 0xDC, 0x11, 0xCA, 0xAA, 0xAA, 0xCA, 0xA0, 0xAA, 0xAA, 0xC1, 
-    0x1E, 0x11, 0xE1, 0xDC, 0xCA, 0xAA, 0xAD, 0xD1, 0x1C, 0xD1, 0x11, 0x1E, 0x11, 0x1D, 0xD1, 0xDD, 
-    0x1C, 0xCA, 0xAA, 0xAC, 0xCA, 0xAA, 0xAC, 0x11, 0xFF, 0x11, 0x99, 0x9E, 0xEB, 0xE9, 0x99, 0xE9, 
-    0xC0, 0xCD, 0xCC, 0xF1, 0xFF, 0xFF, 0xF1, 0x1D, 0x1D, 0xFF, 0x11, 0x11, 0x61, 0x1F, 0x1C, 0xCC, 
-    0xDD, 0xDD, 0xDC, 0xD1, 0xDC, 0xCC, 0xDD, 0xDD, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0xC1, 
-    0x11, 0x11, 0x1D, 0xC0, 0xAA, 0xA0, 0xAC, 0xD1, 0x1D, 0x11, 0x11, 0x11, 0xCC, 0xCC, 0xDD, 0xDC, 
-    0x77, 0xAA, 0xAA, 0xCC, 0xCC, 0xAA, 0xAA, 0x11, 0x1F, 0x11, 0x99, 0x99, 0xEE, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0xA1, 0x1C, 0xCC, 0xDC, 0xDD, 0xDD, 0xCF, 0x11, 0x11, 0x66, 0x9F, 0x1A, 0xAC, 
-    0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xCC, 0xCC, 0xCA, 0xAC, 0xDC, 0xA0, 0xAA, 0xA0, 0x0C, 0xC1, 0x11, 
-    0x11, 0x11, 0x1D, 0x0A, 0xAA, 0x00, 0x01, 0xD1, 0x1D, 0xDD, 0xD1, 0x1C, 0xCD, 0xDD, 0xDD, 0xCC, 
-    0xC1, 0xAA, 0xCC, 0xCA, 0xAA, 0xAA, 0xAA, 0xD1, 0x1F, 0xF1, 0x91, 0x19, 0x91, 0xF1, 0xFF, 0xFF, 
-    0x00, 0x00, 0x00, 0x0D, 0xCA, 0xAC, 0xDC, 0xDD, 0xDC, 0xDF, 0x11, 0x16, 0xB1, 0x1F, 0xCA, 0xAC, 
-    0xCC, 0xCD, 0xDD, 0xDC, 0xAC, 0xCC, 0xCA, 0xA0, 0xDD, 0xCC, 0xCC, 0xCA, 0xAD, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0xAA, 0xA0, 0x0D, 0x11, 0x1D, 0xDD, 0xDC, 0xCD, 0xDD, 0xCA, 0x00, 0xCC, 
-    0xCC, 0xCC, 0xCA, 0xAA, 0xCA, 0xAA, 0xAA, 0xCD, 0xDD, 0x1F, 0x91, 0x19, 0x91, 0xFF, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0xAA, 0xCC, 0xCC, 0xCC, 0xD1, 0xFF, 0xF1, 0xB1, 0x9D, 0xAA, 0x00, 
-    0xAC, 0xCD, 0xDD, 0xCC, 0xAA, 0xAC, 0xCC, 0xAD, 0x11, 0xDD, 0xDD, 0xDD, 0xD1, 0x11, 0x11, 0x11, 
-    0x11, 0x1C, 0xCC, 0x00, 0x00, 0xA0, 0x0C, 0xDD, 0xDD, 0xDD, 0xD1, 0x1C, 0xCA, 0x00, 0x00, 0xC1, 
-    0xDA, 0xCC, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAD, 0xDD, 0xDD, 0xF1, 0x11, 0x1F, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0xAC, 0xCC, 0xDF, 0xFF, 0xF1, 0x11, 0x1C, 0xAA, 0x00, 
-    0xAC, 0xCC, 0xCC, 0xAC, 0xCC, 0xA0, 0xAC, 0xC1, 0x11, 0x11, 0xDC, 0xCC, 0xDD, 0xC1, 0x11, 0x11, 
-    0x11, 0x1C, 0x8C, 0x00, 0x00, 0x0A, 0x0C, 0xCC, 0xD1, 0x1D, 0xD1, 0xDD, 0xAA, 0x00, 0x0A, 0xC1, 
-    0xCA, 0xCD, 0xCA, 0x00, 0xAA, 0xAA, 0xA0, 0xAC, 0xCD, 0xDD, 0xD1, 0xFF, 0xDD, 0xF1, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xD1, 0xFF, 0xFF, 0xF1, 0xDA, 0xAA, 0xAC, 
-    0xCA, 0x0C, 0xA0, 0xAC, 0xCC, 0xAA, 0x0C, 0xD1, 0x1D, 0xCD, 0x1C, 0xCC, 0xCC, 0xC1, 0x1D, 0xDD, 
-    0xD1, 0x11, 0x11, 0xC0, 0x00, 0x00, 0xAD, 0x11, 0x1D, 0xCC, 0xCC, 0xCA, 0xAA, 0xA0, 0xCC, 0xCC, 
-    0xCA, 0xCC, 0xAA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xDD, 0xDD, 0x11, 0x1F, 0x1D, 0x11, 0x1D, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xDD, 0xCC, 0x1C, 0x11, 0xA0, 0xAA, 0xCA, 
-    0xAA, 0x0D, 0x1C, 0xAC, 0xAC, 0xDC, 0xCC, 0xCC, 0xDD, 0xCC, 0xDD, 0xCC, 0xAA, 0xAC, 0xDD, 0xDC, 
-    0xD1, 0x91, 0x11, 0xC0, 0x00, 0x00, 0xAD, 0x1D, 0xD0, 0x0A, 0xA0, 0x0A, 0xAA, 0xAC, 0xCA, 0xAC, 
-    0xCA, 0xAA, 0xAA, 0x00, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA, 0xCD, 0xDD, 0x11, 0x1D, 0xCC, 0xDD, 0xDC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xDD, 0xCD, 0xCC, 0xDC, 0xAA, 0xAA, 0xAA, 
-    0xA0, 0x00, 0x0C, 0xCA, 0xA0, 0xCC, 0xDD, 0xCC, 0xCC, 0xCD, 0xCC, 0xCD, 0xAA, 0xAA, 0xCD, 0xD1, 
-    0x1D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xCC, 0xCA, 0xAA, 0xCC, 0xCC, 0xCC, 0xCC, 0x00, 0xAA, 
-    0xAA, 0xAA, 0xCC, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xDD, 0x11, 0xDC, 0xCC, 0xCC, 0xCC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCC, 0xDD, 0xCC, 0xCA, 0xAA, 0xAA, 0x0A, 0xAA, 
-    0xA0, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x0A, 0xCC, 0xCC, 0xCC, 0xCA, 0xAD, 0xDD, 0xCC, 0x11, 0x1D, 
-    0xCA, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0xAA, 0x0A, 0xAA, 0xAA, 0xCC, 0xA0, 0x0C, 0xC0, 0x0A, 0xAA, 
-    0xAA, 0xAC, 0xCC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xCC, 0xD1, 0x1C, 0xCD, 0xCC, 0xCC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0x0A, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xDD, 0xCD, 0xD1, 0xDD, 0xCC, 0xC1, 0x11, 0x11, 0x11, 
-    0x1D, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xCC, 0xDC, 0xAC, 0xAA, 0xAC, 0xCA, 0xAA, 0xAA, 
-    0xCC, 0xAC, 0xCC, 0xAA, 0xAA, 0xCC, 0xAA, 0xAA, 0xA0, 0xAA, 0xAA, 0xD1, 0xDC, 0xDD, 0xCC, 0xCC, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xA0, 0x0C, 0xAA, 0xA0, 0xAC, 0xCC, 0xAA, 0xAA, 0x00, 
-    0xAA, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xAD, 0xD1, 0x11, 0x1C, 0xAA, 0xAC, 0xDD, 0xDD, 0x11, 
-    0x11, 0xDD, 0xCA, 0xAA, 0x00, 0x00, 0xCC, 0xCD, 0xCC, 0xDA, 0xAA, 0xAA, 0xCD, 0xDC, 0xAA, 0xAA, 
-    0xAA, 0xCC, 0xCC, 0xCA, 0xAC, 0xDA, 0x00, 0x0A, 0xA0, 0xAA, 0xAA, 0xAD, 0xDC, 0xCA, 0xAC, 0xAA, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xA0, 0x0A, 0xAA, 0xAA, 0x0C, 0xCC, 0xAA, 0xAA, 0xA0, 
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x11, 0xDC, 0xAA, 0xAA, 0xAC, 0x11, 0xCC, 0xC0, 
-    0x0D, 0xCC, 0xCC, 0xA0, 0xAA, 0x0C, 0xCC, 0xC1, 0x1D, 0xA0, 0x00, 0x00, 0xC1, 0x1D, 0xCA, 0xAA, 
-    0xAC, 0xCC, 0xCC, 0x1C, 0xAC, 0xC0, 0x00, 0x0A, 0xA0, 0x00, 0xAA, 0xAC, 0xDC, 0xAC, 0xCA, 0xA0, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x0A, 0xCA, 0xAA, 0xAA, 0xAA, 
-    0xAA, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0A, 0xAD, 0xDA, 0xCC, 0xCA, 0xA0, 0x00, 0xAC, 0xCC, 0xC0, 
-    0x0C, 0x1D, 0xC0, 0x0C, 0xA0, 0xAA, 0xA8, 0xD1, 0x11, 0x0A, 0x00, 0x00, 0x0C, 0xCC, 0xCA, 0xAA, 
-    0xCC, 0xAC, 0xCC, 0x1C, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAC, 0xCC, 0xDD, 0xCC, 0xAA, 
+const uint8_t STORY_CH8_ENEMY_RLE[STORY_CH8_ENEMY_RLE_SIZE] = {
+    0xF0, 0x0D, 0x00, 0xC0, 0xC0, 0x07, 0xC0, 0x0A, 0xC1, 0xF1, 0xE9, 0x02, 0xE9, 0xE0, 0xAB, 0x03, 
+    0x22, 0x24, 0xF5, 0x04, 0x04, 0x44, 0x33, 0x30, 0xC2, 0xCB, 0xF9, 0x10, 0x0E, 0x1F, 0x1C, 0xCD, 
+    0xDC, 0xCC, 0xAC, 0xA0, 0xA0, 0xF0, 0x0E, 0x01, 0xAA, 0xB0, 0x07, 0xAA, 0x0A, 0xAD, 0xF1, 0xE9, 
+    0x02, 0xEE, 0xE0, 0xBB, 0x04, 0x22, 0x34, 0x40, 0x4C, 0x05, 0x43, 0x33, 0x2B, 0x60, 0x08, 0x9F, 
+    0xFD, 0xCC, 0xDD, 0xD0, 0xDA, 0xF0, 0x0C, 0x00, 0xA0, 0xF0, 0x00, 0x04, 0xAC, 0xCF, 0x10, 0xF9, 
+    0x00, 0x01, 0xE9, 0x49, 0x00, 0x40, 0x50, 0x01, 0x2B, 0x45, 0x00, 0xE0, 0xF9, 0x12, 0x0A, 0xFF, 
+    0xCC, 0xCD, 0xCA, 0xA0, 0x00, 0x56, 0xF0, 0x00, 0x04, 0xAC, 0xCC, 0x10, 0xF9, 0x00, 0x00, 0xE0, 
+    0x47, 0x00, 0x30, 0xA4, 0x4B, 0xA3, 0x49, 0x01, 0xBE, 0xF9, 0x11, 0x0B, 0xFF, 0xCC, 0xDA, 0xA0, 
+    0x0A, 0xAA, 0xF0, 0x15, 0x04, 0xAC, 0xDA, 0xD0, 0x47, 0x03, 0xEE, 0xE9, 0xCB, 0x00, 0x20, 0xA4, 
+    0x02, 0x55, 0x40, 0x4F, 0x00, 0x20, 0x45, 0x01, 0xBB, 0xF9, 0x12, 0x07, 0x1F, 0xDC, 0xCA, 0x00, 
+    0xAA, 0xF0, 0x13, 0x06, 0xAC, 0xCD, 0xCC, 0xF0, 0xC9, 0x01, 0xE9, 0xAE, 0x02, 0xBB, 0x90, 0x49, 
+    0xB5, 0x04, 0x44, 0x45, 0x40, 0x46, 0xEB, 0x02, 0xEB, 0xE0, 0xF9, 0x13, 0x02, 0xFD, 0xC0, 0xA0, 
+    0x01, 0xAA, 0xF0, 0x13, 0x07, 0xAA, 0xC1, 0xCA, 0xD1, 0x46, 0x00, 0x90, 0x42, 0x00, 0xE0, 0xAB, 
+    0x01, 0x23, 0x48, 0xF4, 0x00, 0xA3, 0x45, 0x04, 0xEE, 0xEB, 0xB0, 0xF9, 0x13, 0x00, 0x10, 0x42, 
+    0x01, 0xAA, 0xF0, 0x13, 0x08, 0xAC, 0xAA, 0xDD, 0xCD, 0xF0, 0xD9, 0x43, 0x00, 0xB0, 0x43, 0x00, 
+    0x20, 0x45, 0x09, 0x44, 0x55, 0x45, 0x44, 0x45, 0x47, 0x00, 0x20, 0xDB, 0x03, 0xEE, 0xBE, 0xF9, 
+    0x13, 0x01, 0xFD, 0x5D, 0x09, 0xAC, 0x0A, 0xDF, 0xDD, 0x11, 0xC9, 0x07, 0xEE, 0xE9, 0xEB, 0xBE, 
+    0xAB, 0x44, 0x08, 0x55, 0x24, 0x55, 0x54, 0x30, 0x55, 0x01, 0xBE, 0x60, 0x00, 0xA0, 0xF0, 0x0F, 
+    0x09, 0xAA, 0x0C, 0xDF, 0xFD, 0x1F, 0x45, 0x04, 0x9E, 0xEE, 0xB0, 0x44, 0x02, 0x23, 0x30, 0xA4, 
+    0x02, 0x53, 0x20, 0xA5, 0x02, 0x23, 0x50, 0xC4, 0xB3, 0x48, 0x01, 0xEE, 0x5A, 0x06, 0x1F, 0xAA, 
+    0xDA, 0xA0, 0x57, 0x09, 0x0A, 0xCC, 0xFF, 0xDD, 0xDF, 0xE9, 0x47, 0x00, 0x20, 0x45, 0x01, 0x46, 
+    0x42, 0x02, 0x41, 0x30, 0xD4, 0x4B, 0x00, 0xB0, 0xBE, 0x5A, 0x05, 0xDC, 0xDD, 0xCC, 0xF0, 0x0F, 
+    0x00, 0xA0, 0x44, 0x00, 0x10, 0x4A, 0xAB, 0x05, 0xEB, 0x22, 0x33, 0xB4, 0x07, 0x26, 0x34, 0x55, 
+    0x2F, 0xE4, 0x4C, 0x05, 0xBB, 0xBE, 0xEE, 0x5D, 0x04, 0xDC, 0xA0, 0xA0, 0xF0, 0x0B, 0x0A, 0xAA, 
+    0xAC, 0xDF, 0xCD, 0xFF, 0x10, 0xD9, 0x01, 0xEB, 0x43, 0x03, 0xB2, 0x23, 0x45, 0x06, 0x6B, 0x45, 
+    0x55, 0xB0, 0x43, 0x00, 0x50, 0xA4, 0xB3, 0x00, 0x20, 0x4B, 0x01, 0xEE, 0x57, 0x02, 0x1C, 0xF0, 
+    0x58, 0x09, 0x0C, 0xCD, 0xDC, 0xD1, 0xF1, 0x45, 0x02, 0xEB, 0xE0, 0x43, 0x04, 0x2B, 0x23, 0x40, 
+    0x42, 0x03, 0x53, 0x63, 0xA5, 0x03, 0xF1, 0x43, 0x56, 0xAB, 0x00, 0xE0, 0x56, 0x08, 0xFD, 0xF1, 
+    0xDD, 0xAA, 0xC0, 0xF0, 0x07, 0x0C, 0xA0, 0x00, 0xCD, 0xDD, 0xCC, 0x1F, 0x10, 0x44, 0x03, 0xEE, 
+    0xE9, 0x43, 0x05, 0x2B, 0x33, 0x43, 0xB4, 0x0E, 0xBB, 0x55, 0x45, 0x37, 0xF3, 0x24, 0x35, 0x50, 
+    0x45, 0x00, 0x20, 0x48, 0x00, 0xE0, 0x43, 0x01, 0xBE, 0xF9, 0x0D, 0xCF, 0x02, 0x1C, 0xC0, 0x4D, 
+    0x00, 0xA0, 0xA0, 0x00, 0xC0, 0xAD, 0x03, 0xCD, 0xF1, 0xD9, 0x0A, 0xEE, 0x9E, 0xBE, 0xBB, 0x2B, 
+    0x20, 0xA3, 0x0D, 0x44, 0x45, 0x31, 0x35, 0x52, 0x26, 0x71, 0xA2, 0x02, 0x44, 0x50, 0x4C, 0x01, 
+    0xEE, 0x51, 0x00, 0xE0, 0x4A, 0x01, 0x11, 0x42, 0x00, 0xD0, 0x4C, 0x0D, 0xDA, 0x0A, 0x00, 0xAC, 
+    0xDD, 0xCC, 0xDD, 0xE9, 0x02, 0xEE, 0x90, 0x45, 0x00, 0x20, 0xB3, 0x42, 0x10, 0xB1, 0x45, 0x46, 
+    0x21, 0x7B, 0x22, 0x2B, 0xB3, 0x40, 0x4E, 0x00, 0xE0, 0x50, 0xF9, 0x03, 0x02, 0xFD, 0xD0, 0xAF, 
+    0x01, 0xDA, 0x4A, 0x08, 0xCA, 0x00, 0xC0, 0x00, 0xA0, 0x43, 0x00, 0x10, 0xD9, 0x0F, 0xEE, 0x99, 
+    0x9E, 0xEB, 0xB2, 0x23, 0x23, 0x33, 0xB4, 0x10, 0x6B, 0x43, 0x26, 0x27, 0x7B, 0x3B, 0x21, 0xF2, 
+    0x30, 0x45, 0xBB, 0x03, 0xEE, 0xE9, 0x46, 0x01, 0xBE, 0xF9, 0x01, 0x00, 0xE0, 0x4F, 0x02, 0xCA, 
+    0xA0, 0xF0, 0x01, 0x02, 0xAC, 0x00, 0x44, 0x05, 0x0C, 0xDD, 0xC1, 0xE9, 0x42, 0x01, 0xBB, 0x42, 
+    0xC3, 0xB4, 0x11, 0x12, 0x46, 0xBB, 0x1A, 0x1F, 0xB6, 0x61, 0x1F, 0xBB, 0xB3, 0x01, 0x22, 0xBB, 
+    0x03, 0xEB, 0x99, 0x44, 0x01, 0xEE, 0x4A, 0x00, 0xE0, 0x4A, 0x06, 0x1F, 0xFD, 0xCC, 0xC0, 0xF0, 
+    0x02, 0x03, 0xAC, 0xAA, 0xA0, 0x03, 0xAD, 0xDC, 0x4B, 0x07, 0xEB, 0xEB, 0xB2, 0x22, 0xA3, 0xB4, 
+    0x12, 0x3F, 0x24, 0x1B, 0xBF, 0xCF, 0xF1, 0xB6, 0x91, 0xFF, 0x10, 0xC3, 0x01, 0x22, 0xCB, 0x04, 
+    0xE9, 0xEE, 0xE0, 0x44, 0x00, 0xE0, 0x52, 0x08, 0x1D, 0xDD, 0x1F, 0xDD, 0xD0, 0x4B, 0x02, 0xDC, 
+    0x00, 0xCA, 0x02, 0xCA, 0xD0, 0xF9, 0x00, 0x02, 0xE9, 0x90, 0xAB, 0x02, 0x22, 0x20, 0xB3, 0xB4, 
+    0x07, 0x26, 0x22, 0x1B, 0xB7, 0x43, 0x06, 0xB9, 0x1E, 0x1F, 0xB0, 0x45, 0x00, 0x20, 0xAB, 0x03, 
+    0xE9, 0x99, 0x5B, 0x09, 0x9D, 0xCD, 0xDD, 0xCD, 0xDD, 0x4A, 0x04, 0xAA, 0xAC, 0xC0, 0xBA, 0x01, 
+    0xC1, 0xE9, 0x03, 0xE9, 0x9E, 0x49, 0xC4, 0x0D, 0xB6, 0x2F, 0x1B, 0x6C, 0xDD, 0xDF, 0x9B, 0xA1, 
+    0x03, 0xFF, 0x24, 0x48, 0x00, 0xB0, 0x43, 0x05, 0xEE, 0xBB, 0xEB, 0x48, 0x00, 0x90, 0x49, 0x01, 
+    0x1D, 0xAC, 0x02, 0x11, 0x10, 0xF0, 0x04, 0x00, 0xA0, 0xAC, 0x04, 0xAA, 0xCC, 0xD0, 0xE9, 0x0A, 
+    0xEE, 0x9E, 0xBB, 0xB2, 0xBB, 0x20, 0xC3, 0xB4, 0x06, 0x6F, 0xFF, 0x6B, 0x10, 0x42, 0x11, 0x1F, 
+    0x91, 0xE1, 0xFF, 0xF1, 0x34, 0x33, 0x32, 0x22, 0x45, 0x00, 0x90, 0xAE, 0x01, 0xBB, 0x55, 0x06, 
+    0x91, 0xCA, 0xAD, 0xF0, 0x4B, 0x04, 0xAC, 0xCC, 0xA0, 0xCC, 0x00, 0xF0, 0x4B, 0x07, 0x22, 0xBB, 
+    0x22, 0x32, 0xD3, 0x0C, 0x43, 0xFF, 0xF1, 0xFF, 0xCC, 0xCD, 0x10, 0x43, 0x05, 0x92, 0xFF, 0x7B, 
+    0x42, 0x01, 0x33, 0x43, 0x04, 0xEE, 0x99, 0x90, 0xAE, 0x4A, 0x00, 0xE0, 0x49, 0x08, 0x11, 0xDD, 
+    0xAD, 0xFF, 0xF0, 0xF0, 0x02, 0xCC, 0xAD, 0x01, 0x11, 0x48, 0x07, 0xEB, 0x22, 0xBB, 0xB2, 0xA3, 
+    0x00, 0x20, 0x45, 0x15, 0xBB, 0x11, 0xFC, 0xCC, 0xD1, 0xFF, 0xF1, 0x1F, 0xFB, 0x91, 0xF1, 0xA3, 
+    0x00, 0x20, 0x46, 0x03, 0xE9, 0x99, 0xCE, 0x53, 0x08, 0x9F, 0x1F, 0xDD, 0x11, 0x10, 0x51, 0x02, 
+    0xF1, 0xF0, 0xF9, 0x00, 0x03, 0xEE, 0xE2, 0xAB, 0xA2, 0x45, 0x0A, 0x44, 0x2F, 0x99, 0xFF, 0xDC, 
+    0xC0, 0xAD, 0x09, 0x1F, 0x1D, 0x1F, 0x9B, 0x1F, 0x43, 0x02, 0x23, 0x20, 0xAB, 0x62, 0xB1, 0x4A, 
+    0xAD, 0x05, 0xCD, 0x11, 0xF1, 0x4A, 0xBB, 0x02, 0x22, 0x20, 0xE3, 0x06, 0x44, 0xBC, 0x11, 0x10, 
+    0xAC, 0x0E, 0xAD, 0x1D, 0x11, 0xDD, 0xFF, 0xF9, 0x91, 0x20, 0xA3, 0x46, 0xA9, 0x5D, 0x00, 0xF0, 
+    0x4D, 0x02, 0x0D, 0x10, 0xBD, 0x01, 0x11, 0xF9, 0x01, 0x01, 0xEE, 0xBB, 0x02, 0x22, 0x20, 0xB3, 
+    0x00, 0x40, 0x42, 0x04, 0x3F, 0xF1, 0xF0, 0xAC, 0x0F, 0xDD, 0x1C, 0xCD, 0x1D, 0xCD, 0x1F, 0xF1, 
+    0xF1, 0x43, 0x00, 0x20, 0x43, 0x02, 0xBE, 0xE0, 0x5D, 0x00, 0xD0, 0x50, 0x07, 0x0C, 0xCC, 0xDD, 
+    0xFF, 0x4A, 0xBB, 0xA2, 0x10, 0x33, 0x32, 0x23, 0x33, 0x44, 0xBF, 0x1F, 0xDC, 0xD0, 0xEC, 0xAD, 
+    0x06, 0x11, 0x1F, 0xFF, 0x20, 0xA3, 0x02, 0x22, 0x20, 0xBB, 0xCE, 0x03, 0x9E, 0xEE, 0x53, 0x04, 
+    0x11, 0xFF, 0xF0, 0x48, 0x06, 0xAC, 0xCC, 0xA0, 0xC0, 0xAD, 0x01, 0x11, 0x48, 0x00, 0xE0, 0x48, 
+    0xC2, 0x42, 0x0B, 0x6D, 0xFF, 0xDD, 0xCC, 0xAC, 0xCD, 0xCC, 0x07, 0xD1, 0x1D, 0xFF, 0xF9, 0xB3, 
+    0x02, 0x22, 0x20, 0xBB, 0xAE, 0x05, 0x99, 0x9E, 0xEE, 0x47, 0x00, 0xE0, 0x49, 0xAF, 0x47, 0x03, 
+    0xAC, 0xD1, 0xCD, 0x01, 0x11, 0xF9, 0x03, 0x00, 0xE0, 0xBB, 0xF2, 0x03, 0x08, 0x34, 0x3F, 0xFF, 
+    0xDF, 0xC0, 0x42, 0x00, 0xD0, 0x47, 0x00, 0xD0, 0x42, 0x02, 0x13, 0x20, 0x4D, 0xDE, 0x51, 0x01, 
+    0x91, 0x42, 0x00, 0xD0, 0x45, 0x02, 0xCC, 0xA0, 0xAD, 0x03, 0x1D, 0xDF, 0xF9, 0x04, 0x44, 0x00, 
+    0xB0, 0xF2, 0x03, 0x0D, 0x42, 0xF1, 0x1F, 0xFC, 0xCA, 0xCC, 0xCA, 0x4B, 0x02, 0xFB, 0xB0, 0xB3, 
+    0x44, 0x00, 0xB0, 0xBE, 0x00, 0x90, 0x47, 0xAE, 0x56, 0xA0, 0x05, 0xAD, 0xDD, 0xCF, 0xF9, 0x05, 
+    0x43, 0xB2, 0x00, 0xB0, 0xE2, 0x02, 0x3B, 0xF0, 0xA1, 0x00, 0xA0, 0x43, 0xEC, 0x01, 0x11, 0x42, 
+    0x05, 0x19, 0xB2, 0x33, 0xA2, 0x4D, 0x01, 0xEE, 0x45, 0x00, 0xE0, 0xF9, 0x02, 0xAF, 0x49, 0x05, 
+    0xD1, 0xDD, 0xD1, 0xD9, 0x00, 0xE0, 0x4E, 0x02, 0xBB, 0xB0, 0x48, 0x04, 0xFF, 0x1C, 0xC0, 0x45, 
+    0x00, 0xA0, 0xBC, 0x0A, 0xD1, 0xDF, 0x1F, 0xD1, 0xB2, 0x20, 0xAB, 0x44, 0x00, 0xB0, 0xFE, 0x00, 
+    0x03, 0x9E, 0xEE, 0x4F, 0x00, 0x10, 0x42, 0x00, 0xD0, 0xB0, 0x08, 0xAA, 0xAD, 0x11, 0xF1, 0x10, 
+    0xC9, 0x01, 0xEE, 0xD9, 0x00, 0xE0, 0x46, 0xAB, 0x08, 0x23, 0x22, 0x23, 0x33, 0x10, 0xAF, 0x04, 
+    0xAC, 0xAA, 0xA0, 0x43, 0x0C, 0xAC, 0xDC, 0xCC, 0xD1, 0xF1, 0x1F, 0xF0, 0x45, 0xEB, 0x62, 0x0B, 
+    0xCA, 0x0A, 0xCA, 0xC1, 0x1F, 0xF1, 0xD9, 0x00, 0xE0, 0xE9, 0x00, 0xE0, 0xCB, 0x00, 0x20, 0xBB, 
+    0xD2, 0x05, 0xB1, 0xFD, 0xCD, 0xAA, 0xCC, 0x0E, 0xAA, 0xCC, 0xCD, 0xCD, 0xF9, 0xE1, 0xD6, 0xB0, 
+    0x4B, 0x00, 0xB0, 0xFE, 0x0A, 0x4D, 0x0B, 0xCD, 0xAA, 0xDC, 0xAD, 0x1F, 0xF1, 0xF9, 0x07, 0x00, 
+    0xE0, 0xFB, 0x04, 0xB2, 0x01, 0xBB, 0x42, 0xAA, 0x04, 0xCC, 0xCA, 0xA0, 0xEC, 0x42, 0x07, 0x19, 
+    0x9D, 0x12, 0x22, 0xFB, 0x05, 0x58, 0x10, 0x91, 0x1F, 0x11, 0xDD, 0xAD, 0xDA, 0xCC, 0xDD, 0x10, 
+    0xF9, 0x08, 0x4B, 0xB2, 0xAB, 0x04, 0xFD, 0xDC, 0xC0, 0xAD, 0x03, 0xCC, 0xAA, 0xAC, 0x00, 0xA0, 
+    0xAC, 0x08, 0xDF, 0xF9, 0x9D, 0xF3, 0x30, 0x4D, 0x00, 0xB0, 0xFE, 0x08, 0xF9, 0x00, 0x0A, 0xF1, 
+    0xFF, 0xFC, 0xDA, 0xCA, 0xA0, 0xAD, 0x00, 0xF0, 0xF9, 0x07, 0x00, 0xE0, 0x4B, 0x03, 0xB2, 0x22, 
+    0xBB, 0x08, 0xFD, 0xCC, 0x1F, 0xDD, 0xC0, 0x45, 0x02, 0xAA, 0xA0, 0xAC, 0x07, 0x1D, 0x1F, 0xDC, 
+    0xB2, 0x4E, 0x01, 0xBB, 0xFE, 0x08, 0x46, 0xAF, 0xB0, 0x00, 0xC0, 0xAD, 0xF9, 0x07, 0xAE, 0x01, 
+    0x99, 0x4A, 0x0F, 0xBB, 0x66, 0x61, 0x11, 0xFF, 0xF1, 0xDC, 0xCC, 0xFA, 0x00, 0xBC, 0x08, 0xAD, 
+    0xFD, 0xDF, 0x22, 0x20, 0xAB, 0x00, 0x20, 0xFB, 0x03, 0xFE, 0x06, 0xE9, 0x09, 0x1F, 0xF1, 0xF0, 
+    0xA0, 0x0A, 0xAD, 0x00, 0x10, 0x50, 0x03, 0x99, 0x96, 0xFB, 0x00, 0x04, 0x22, 0xB6, 0x60, 0xE1, 
+    0x00, 0xF0, 0xDC, 0xFA, 0x01, 0x10, 0xCA, 0xCD, 0xFF, 0x1F, 0xF2, 0x32, 0x2B, 0xB2, 0x20, 0x58, 
+    0x00, 0xE0, 0x48, 0x0A, 0xFF, 0xAA, 0x00, 0xCD, 0xD1, 0x10, 0x4F, 0xB9, 0xFB, 0x01, 0x4A, 0x03, 
+    0xFD, 0xDD, 0x4D, 0x03, 0xAA, 0xAD, 0xBF, 0x03, 0xB6, 0x3B, 0x4B, 0x02, 0x9E, 0xB0, 0x54, 0x00, 
+    0x90, 0x44, 0x06, 0xA0, 0xAD, 0xF1, 0x10, 0xF9, 0x0C, 0xFB, 0x01, 0x05, 0x22, 0x26, 0x61, 0xDF, 
+    0x04, 0xD1, 0xDD, 0xD0, 0x4A, 0x00, 0xC0, 0x43, 0x00, 0x10, 0xBF, 0x04, 0x92, 0xFB, 0x20, 0x43, 
+    0x00, 0x60, 0xAB, 0x02, 0x99, 0x90, 0xFE, 0x07, 0x47, 0x08, 0xD1, 0xFA, 0xDD, 0xAC, 0x10, 0x51, 
+    0x03, 0xE9, 0x99, 0xFB, 0x02, 0x0F, 0x23, 0xB6, 0x1F, 0xFF, 0x11, 0xDF, 0xDC, 0xCC, 0x44, 0x01, 
+    0xCC, 0xFA, 0x02, 0x0E, 0xDD, 0x11, 0x1F, 0xFF, 0x1B, 0xB1, 0xB2, 0x20, 0x45, 0x03, 0xE9, 0x99, 
+    0x55, 0x07, 0x91, 0xD1, 0xA1, 0xDC, 0xAF, 0xF9, 0x06, 0xBE, 0x01, 0x99, 0xFB, 0x00, 0x08, 0x23, 
+    0x3B, 0x1F, 0xFF, 0x10, 0xAD, 0x03, 0xCC, 0xCD, 0x51, 0x03, 0xCD, 0xDD, 0xAF, 0x05, 0xD1, 0xFF, 
+    0xBB, 0x4C, 0x04, 0x99, 0x9E, 0xB0, 0x4F, 0x09, 0xFC, 0xCC, 0xDC, 0xD1, 0xFD, 0x52, 0x03, 0x91, 
+    0x11, 0x47, 0x02, 0x22, 0x60, 0x42, 0x02, 0xDD, 0xD0, 0xAC, 0x08, 0x1F, 0xF1, 0xDA, 0xAC, 0xC0, 
+    0xFA, 0x05, 0x0D, 0xD9, 0xB1, 0x1F, 0xDC, 0xF9, 0xFB, 0x22, 0xCB, 0xF9, 0x01, 0xFE, 0x01, 0xE9, 
+    0x09, 0x1C, 0xCD, 0xDC, 0x11, 0xF1, 0xF9, 0x06, 0x04, 0xEB, 0xBB, 0xE0, 0xA1, 0x01, 0x61, 0x46, 
+    0x05, 0xB1, 0x1F, 0xFD, 0xDC, 0x05, 0xD1, 0xFF, 0xFD, 0xFA, 0x07, 0x03, 0x12, 0x3E, 0xAF, 0x07, 
+    0xCD, 0xFF, 0xBB, 0x22, 0x44, 0x00, 0xB0, 0xF9, 0x01, 0x02, 0xBE, 0xB0, 0xCE, 0xD9, 0x00, 0xF0, 
+    0xBC, 0x02, 0x1F, 0x10, 0x45, 0xAE, 0x04, 0x99, 0x9E, 0xE0, 0xAB, 0x00, 0x90, 0xC1, 0xAB, 0x08, 
+    0x99, 0x6B, 0xBF, 0xFF, 0x10, 0x42, 0xAA, 0x07, 0xCD, 0x19, 0x91, 0xCC, 0xFA, 0x04, 0x0F, 0xD9, 
+    0x39, 0xFF, 0x1F, 0xDC, 0xDD, 0xFF, 0x11, 0x44, 0xBB, 0x06, 0x91, 0xF1, 0xEE, 0xB0, 0x4E, 0x00, 
+    0x90, 0xAD, 0x00, 0xC0, 0xA1, 0xAE, 0x07, 0x9E, 0xBB, 0xBE, 0xEE, 0xDB, 0xD1, 0x0E, 0x9B, 0xB1, 
+    0x19, 0x96, 0x1F, 0xF1, 0xCC, 0xA0, 0x46, 0x04, 0xFF, 0x99, 0xD0, 0xDA, 0x00, 0x00, 0xBA, 0x04, 
+    0xDF, 0x9F, 0x10, 0xAD, 0x0B, 0xAA, 0xCD, 0xDF, 0xF1, 0xBB, 0x2B, 0xA2, 0x08, 0xBB, 0x9F, 0xDC, 
+    0xFE, 0xB0, 0x44, 0x02, 0x99, 0xE0, 0xF9, 0x00, 0x06, 0x1D, 0x11, 0xDD, 0xF0, 0x42, 0x01, 0xBE, 
+    0xA9, 0x02, 0xEE, 0xE0, 0xAB, 0x00, 0x90, 0xF1, 0x02, 0x0C, 0x99, 0x11, 0x19, 0x1F, 0xFF, 0xCC, 
+    0xC0, 0xDA, 0x0B, 0xCD, 0xFD, 0x1F, 0x1A, 0x0A, 0xAA, 0xC0, 0x09, 0xAD, 0xF9, 0x91, 0x1D, 0xDC, 
+    0x42, 0x14, 0xCD, 0x1F, 0x19, 0xBB, 0xB2, 0x2B, 0xB2, 0x1B, 0xF1, 0x1D, 0x10, 0xAB, 0x04, 0xEE, 
+    0x9F, 0x10, 0x48, 0x10, 0x91, 0xFD, 0x11, 0xF1, 0xBB, 0xEB, 0x91, 0x1F, 0x90, 0xCB, 0x00, 0x90, 
+    0xF1, 0x00, 0x0B, 0xF1, 0x91, 0x1F, 0x19, 0x1F, 0xFF, 0xCC, 0x47, 0x07, 0xF1, 0xFD, 0xCC, 0xAA, 
+    0xAC, 0x08, 0xDD, 0xC1, 0xF1, 0xFF, 0xD0, 0xCA, 0x1E, 0xCC, 0xCD, 0xDF, 0x16, 0xB2, 0x22, 0xB2, 
+    0x26, 0x61, 0xFD, 0xCA, 0x1B, 0xBE, 0x99, 0x1F, 0x10, 0xF9, 0x03, 0x02, 0xCA, 0xC0, 0x43, 0x01, 
+    0xB9, 0xAF, 0x00, 0x10, 0xCB, 0x01, 0x1F, 0xD1, 0x00, 0xF0, 0x43, 0x01, 0x11, 0xAF, 0x01, 0xDC, 
+    0xA1, 0x07, 0xCD, 0xCC, 0xCA, 0xCC, 0xAD, 0x01, 0x11, 0xAD, 0xC1, 0x0A, 0xD1, 0xFF, 0xFD, 0xAA, 
+    0xCD, 0xD0, 0xEA, 0x02, 0xCF, 0xF0, 0xA1, 0x11, 0xFF, 0xF1, 0x1C, 0xAA, 0xAF, 0xBB, 0x99, 0x9F, 
+    0xFF, 0xE9, 0xAE, 0x0D, 0xCA, 0xAA, 0xC1, 0xBB, 0xE1, 0xFF, 0xF1, 0x44, 0x01, 0x1F, 0x47, 0xC1, 
+    0xBF, 0x19, 0xDC, 0xCD, 0xC1, 0xDD, 0xCC, 0xAA, 0xCA, 0xCC, 0xAA, 0xCC, 0xAC, 0xDD, 0x19, 0x43, 
+    0x0C, 0xF1, 0x1D, 0xA0, 0xD1, 0xD1, 0x11, 0xD0, 0xAA, 0x0B, 0xCC, 0xDF, 0xF1, 0xCF, 0x1B, 0xFD, 
+    0xBA, 0x43, 0x00, 0x10, 0x42, 0x00, 0xE0, 0xB9, 0xBE, 0x08, 0xDA, 0xAD, 0xC1, 0xBE, 0x10, 0xBF, 
+    0x07, 0x99, 0x9B, 0xB1, 0xFF, 0xD1, 0x06, 0xFF, 0x11, 0x99, 0x90, 0x44, 0x06, 0xCA, 0xCA, 0xC1, 
+    0x10, 0x43, 0xDA, 0x05, 0xDD, 0xCD, 0xCD, 0xBC, 0x0D, 0xDF, 0x91, 0xCA, 0xAC, 0xD1, 0x11, 0xDD, 
+    0xAC, 0x11, 0xDD, 0xDF, 0xFF, 0x1F, 0xFF, 0xDA, 0xAA, 0x0A, 0xCD, 0x43, 0x02, 0x1F, 0x10, 0x42, 
+    0x01, 0xE9, 0xCE, 0x09, 0xCA, 0xD1, 0x11, 0xEF, 0xF1, 0x45, 0x01, 0x11, 0x48, 0x06, 0x11, 0x99, 
+    0x9B, 0x90, 0xBF, 0x00, 0xD0, 0xAA, 0x04, 0xC8, 0xCC, 0xC0, 0xCA, 0x00, 0x00, 0x42, 0x01, 0x1D, 
+    0xD1, 0x08, 0xC1, 0xFF, 0xDA, 0xAA, 0xD0, 0xA1, 0x07, 0xDC, 0xD1, 0x11, 0xDC, 0x42, 0x03, 0xDD, 
+    0xDC, 0xBA, 0x04, 0xCC, 0xCF, 0x90, 0x42, 0x02, 0x11, 0x90, 0xDE, 0x0A, 0xBB, 0xBE, 0xAA, 0xCC, 
+    0xD1, 0x10, 0xEF, 0x02, 0x19, 0x90, 0x4B, 0x10, 0x19, 0x91, 0xFF, 0xF1, 0x11, 0xCA, 0xAC, 0xAA, 
+    0xC0, 0xFA, 0x00, 0x42, 0x01, 0xCD, 0xD1, 0x07, 0xDC, 0xD1, 0xCA, 0xAA, 0xAD, 0x03, 0x1D, 0xDD, 
+    0xB1, 0xAD, 0x03, 0x1D, 0xCC, 0x47, 0x00, 0xD0, 0xA1, 0x00, 0xF0, 0x46, 0xBB, 0x05, 0xEA, 0xAD, 
+    0x11, 0xFF, 0x02, 0xA1, 0x00, 0xF0, 0xD1, 0x0C, 0xF1, 0x1D, 0xFF, 0xDF, 0xDD, 0xD1, 0xD0, 0xAC, 
+    0x03, 0xAC, 0xCC, 0xBA, 0x06, 0xCA, 0xA0, 0x0A, 0xA0, 0xCC, 0x01, 0xDD, 0xBC, 0x09, 0xAA, 0xAC, 
+    0xDD, 0xDC, 0xCD, 0xE1, 0x06, 0xD1, 0xDD, 0xDC, 0xC0, 0xAA, 0x00, 0xC0, 0xAA, 0x04, 0xC1, 0x1F, 
+    0xF0, 0x43, 0xFB, 0x00, 0x03, 0xEA, 0xCF, 0xE1, 0xFF, 0x00, 0xE1, 0x00, 0xF0, 0xBD, 0x05, 0xFD, 
+    0xDD, 0x11, 0xBD, 0x02, 0xC1, 0x10, 0x48, 0xAA, 0x0A, 0xC1, 0x1E, 0x11, 0xE1, 0xDC, 0xC0, 0xAA, 
+    0x05, 0xDD, 0x11, 0xCD, 0xA1, 0x04, 0xE1, 0x11, 0xD0, 0x42, 0x00, 0x10, 0x45, 0x00, 0xC0, 0xAA, 
+    0x02, 0xC1, 0x10, 0x43, 0x12, 0x99, 0xEE, 0xBE, 0x99, 0x9E, 0x9C, 0x0C, 0xDC, 0xCF, 0x10, 0xBF, 
+    0x04, 0x11, 0xD1, 0xD0, 0x44, 0x07, 0x61, 0x1F, 0x1C, 0xCC, 0xBD, 0x06, 0xCD, 0x1D, 0xCC, 0xC0, 
+    0xAD, 0x44, 0xCA, 0x02, 0x00, 0xC0, 0xC1, 0x0C, 0xDC, 0x0A, 0xAA, 0x0A, 0xCD, 0x11, 0xD0, 0xC1, 
+    0xAC, 0x05, 0xDD, 0xDC, 0x77, 0xAA, 0xAC, 0xAA, 0x02, 0x11, 0x10, 0x44, 0x02, 0x9E, 0xE0, 0xC1, 
+    0xC0, 0x07, 0xA1, 0x1C, 0xCC, 0xDC, 0xAD, 0x00, 0xC0, 0x44, 0x0D, 0x69, 0xF1, 0xAA, 0xCC, 0xCD, 
+    0xCC, 0xCD, 0xEC, 0x0D, 0xAA, 0xCD, 0xCA, 0x0A, 0xAA, 0x00, 0xCC, 0xE1, 0x08, 0xD0, 0xAA, 0xA0, 
+    0x00, 0x10, 0x42, 0x06, 0xDD, 0xD1, 0x1C, 0xC0, 0xBD, 0x08, 0xCC, 0xC1, 0xAA, 0xCC, 0xC0, 0xDA, 
+    0x0D, 0xD1, 0x1F, 0xF1, 0x91, 0x19, 0x91, 0xF1, 0xAF, 0xD0, 0x03, 0xDC, 0xAA, 0x44, 0x01, 0xCD, 
+    0x42, 0x05, 0x6B, 0x11, 0xFC, 0x43, 0x00, 0xC0, 0xAD, 0x01, 0xCA, 0xAC, 0x04, 0xAA, 0x0D, 0xD0, 
+    0xBC, 0x02, 0xAA, 0xD0, 0xF1, 0x03, 0x08, 0x00, 0xAA, 0xA0, 0x0D, 0x10, 0x44, 0x08, 0xCC, 0xDD, 
+    0xDC, 0xA0, 0x00, 0xDC, 0x03, 0xAA, 0xAC, 0xBA, 0x05, 0xCD, 0xDD, 0x1F, 0x45, 0x00, 0xF0, 0xA1, 
+    0xD0, 0x04, 0xA0, 0x0A, 0xA0, 0xCC, 0x0E, 0xD1, 0xFF, 0xF1, 0xB1, 0x9D, 0xAA, 0x00, 0xA0, 0x43, 
+    0x0B, 0xCC, 0xAA, 0xAC, 0xCC, 0xAD, 0x11, 0xDD, 0xF1, 0x01, 0x02, 0xCC, 0xC0, 0xA0, 0x03, 0xA0, 
+    0x0C, 0xDD, 0x04, 0x11, 0xCC, 0xA0, 0xA0, 0x08, 0xC1, 0xDA, 0xCC, 0xA0, 0x00, 0xEA, 0xBD, 0x00, 
+    0xF0, 0xA1, 0x00, 0xF0, 0xC1, 0xF0, 0x02, 0x03, 0xAA, 0x0A, 0x42, 0xAF, 0xA1, 0x00, 0xC0, 0x45, 
+    0x0B, 0xCC, 0xCA, 0xCC, 0xCA, 0x0A, 0xCC, 0xB1, 0x06, 0xDC, 0xCC, 0xDD, 0xC0, 0x47, 0x00, 0x80, 
+    0x43, 0x0E, 0x0A, 0x0C, 0xCC, 0xD1, 0x1D, 0xD1, 0xDD, 0xA0, 0x42, 0x0A, 0xAC, 0x1C, 0xAC, 0xDC, 
+    0xA0, 0x00, 0xBA, 0x03, 0x0A, 0xCC, 0xAD, 0x05, 0x1F, 0xFD, 0xDF, 0x4E, 0xA0, 0x42, 0x00, 0x10, 
+    0xBF, 0x01, 0x1D, 0xAA, 0x06, 0xCC, 0xA0, 0xCA, 0x00, 0x43, 0x09, 0xA0, 0xCD, 0x11, 0xDC, 0xD1, 
+    0xCC, 0x01, 0x11, 0xAD, 0xB1, 0x00, 0xC0, 0xB0, 0x05, 0xAD, 0x11, 0x1D, 0xBC, 0xAA, 0x00, 0x00, 
+    0xBC, 0x05, 0xAC, 0xCA, 0xA0, 0xFA, 0x01, 0x00, 0xC0, 0xAD, 0x09, 0x11, 0x1F, 0x1D, 0x11, 0x1D, 
+    0x51, 0x17, 0xDC, 0xC1, 0xC1, 0x1A, 0x0A, 0xAC, 0xAA, 0xA0, 0xD1, 0xCA, 0xCA, 0xCD, 0xBC, 0x12, 
+    0xDD, 0xCC, 0xDD, 0xCC, 0xAA, 0xAC, 0xDD, 0xDC, 0xD1, 0x90, 0x4A, 0x07, 0xDD, 0x00, 0xAA, 0x00, 
+    0xAA, 0x05, 0xCC, 0xAA, 0xCC, 0xBA, 0x01, 0x00, 0xDA, 0x03, 0x0A, 0xAC, 0x44, 0x06, 0xDC, 0xCD, 
+    0xDD, 0xC0, 0x53, 0x04, 0xDC, 0xCD, 0xC0, 0xDA, 0xA0, 0x08, 0xCC, 0xAA, 0x0C, 0xCD, 0xD0, 0xBC, 
+    0x04, 0xDC, 0xCC, 0xD0, 0xAA, 0x06, 0xCD, 0xD1, 0x1D, 0xA0, 0xF0, 0x00, 0x07, 0xAD, 0xCC, 0xCA, 
+    0xAA, 0xEC, 0x01, 0x00, 0xCA, 0x04, 0xCC, 0xA0, 0x00, 0xFA, 0x01, 0x43, 0x00, 0xD0, 0xDC, 0xF0, 
+    0x06, 0x00, 0xA0, 0x43, 0x01, 0xCC, 0xBA, 0x00, 0x00, 0x46, 0x03, 0x0A, 0xAA, 0xA0, 0x00, 0xA0, 
+    0xDC, 0x0C, 0xAA, 0xDD, 0xDC, 0xC1, 0x11, 0xDC, 0xA0, 0xA0, 0x00, 0xA0, 0xA0, 0x03, 0xAA, 0xA0, 
+    0xBA, 0x08, 0xCC, 0xA0, 0x0C, 0xC0, 0x00, 0xCA, 0x02, 0xCC, 0xC0, 0xFA, 0x02, 0x0A, 0x0A, 0xCC, 
+    0xCD, 0x11, 0xCC, 0xD0, 0x51, 0x06, 0x0C, 0xCC, 0xAA, 0xA0, 0x44, 0xCA, 0x05, 0x0A, 0xAA, 0x0A, 
+    0xA0, 0x0C, 0xAA, 0xDD, 0xCD, 0xD1, 0xDD, 0xCC, 0xC0, 0xE1, 0x02, 0xDD, 0xC0, 0xF0, 0x01, 0x0C, 
+    0xAA, 0xCC, 0xDC, 0xAC, 0xAA, 0xAC, 0xC0, 0xBA, 0x01, 0xCC, 0x46, 0x01, 0xCC, 0x45, 0x07, 0xAA, 
+    0xAD, 0x1D, 0xCD, 0x4F, 0x0D, 0xC0, 0xA0, 0x0C, 0xAA, 0xA0, 0xAC, 0xCC, 0xAA, 0x04, 0x00, 0xAA, 
+    0xA0, 0xA0, 0x43, 0x04, 0x00, 0xAD, 0xD0, 0xA1, 0x04, 0xCA, 0xAA, 0xC0, 0xAD, 0xA1, 0x05, 0xDD, 
+    0xCA, 0xAA, 0xA0, 0x06, 0xCC, 0xCD, 0xCC, 0xD0, 0xBA, 0x03, 0xCD, 0xDC, 0xCA, 0xBC, 0x07, 0xAA, 
+    0xCD, 0xA0, 0x00, 0x45, 0x09, 0xAD, 0xDC, 0xCA, 0xAC, 0xAA, 0x4B, 0x03, 0xCA, 0x00, 0xBA, 0x00, 
+    0x00, 0x45, 0x02, 0xA0, 0xA0, 0xF0, 0x02, 0x07, 0xA0, 0x01, 0x11, 0xDC, 0xBA, 0x08, 0xC1, 0x1C, 
+    0xCC, 0x00, 0xD0, 0xAC, 0x04, 0xA0, 0xAA, 0x00, 0xAC, 0x03, 0x11, 0xDA, 0xB0, 0x04, 0xC1, 0x1D, 
+    0xC0, 0xAA, 0xBC, 0x04, 0x1C, 0xAC, 0xC0, 0xA0, 0x0F, 0xAA, 0x00, 0x0A, 0xAA, 0xCD, 0xCA, 0xCC, 
+    0xAA, 0xF0, 0x09, 0x44, 0x01, 0xAC, 0xFA, 0x00, 0xB0, 0x00, 0xC0, 0xB0, 0x0D, 0xAA, 0xDD, 0xAC, 
+    0xCC, 0xAA, 0x00, 0x0A, 0xAC, 0x14, 0x00, 0xC1, 0xDC, 0x00, 0xCA, 0x0A, 0xAA, 0x8D, 0x11, 0x10, 
+    0xA0, 0xB0, 0xAC, 0x05, 0xAA, 0xAC, 0xCA, 0x43, 0x01, 0xCA, 0xF0, 0x02, 0x0A, 0xAA, 0xCC, 0xCD, 
+    0xDC, 0xCA, 0xA0, 
+};
+
+const gfx_image_t STORY_CH8_ENEMY_IMG = {
+    .w = STORY_CH8_ENEMY_W, .h = STORY_CH8_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH8_ENEMY_PAL, .colors = STORY_CH8_ENEMY_PAL_SIZE,
+    .data = STORY_CH8_ENEMY_RLE, .size = STORY_CH8_ENEMY_RLE_SIZE,
 };
@@ -6,297 +6,140 @@ const uint16_t STORY_CH9_PAL[STORY_CH9_PAL_SIZE] = {
     0xE185, 0xF10B, 0xE48B, 0x594A, 0x6A07, 0x128A, 0xF110, 0xA44E, 
 };
 
-const uint8_t STORY_CH9_IDX[(STORY_CH9_W * STORY_CH9_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x01, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 
-    0x33, 0x31, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x10, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x22, 0x22, 0x22, 0x22, 0x11, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 
-    0x33, 0x31, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x12, 0x22, 0x22, 0x23, 0x32, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 
-    0x33, 0x31, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x22, 0x22, 0x33, 0x33, 0x32, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 0x33, 0x36, 
-    0x63, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x12, 0x22, 0x33, 0x66, 0x33, 0x33, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 
-    0x22, 0x22, 0x22, 0x23, 0x33, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 0x34, 0x46, 0x66, 
-    0x63, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x12, 0x22, 0x26, 0x66, 0x63, 0x33, 0x33, 0x22, 0x21, 0x11, 0x12, 0x22, 0x22, 0x22, 
-    0x22, 0x23, 0x13, 0x33, 0x33, 0x32, 0x21, 0x21, 0x11, 0x11, 0x11, 0x12, 0x36, 0x66, 0x33, 0x33, 
-    0x32, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x22, 0x36, 0x66, 0x66, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x23, 0x13, 0x33, 0x33, 0x33, 0x21, 0x33, 0x23, 0x32, 0x22, 0x33, 0x44, 0x33, 0x33, 0x33, 
-    0x31, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x23, 0x32, 
-    0x23, 0x33, 0x13, 0x33, 0x12, 0x33, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x44, 0x33, 0x53, 0xC1, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x31, 0x03, 0x31, 0x01, 0x33, 0xC0, 0x23, 0x33, 0x33, 0x33, 0x34, 0x45, 0x33, 0x31, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x66, 0x66, 0x33, 0x33, 0x33, 
-    0x33, 0x31, 0x01, 0x51, 0x00, 0x33, 0x10, 0x03, 0x43, 0x33, 0x33, 0x44, 0x55, 0x55, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x22, 0x23, 0x33, 0x33, 0x63, 0x33, 0x36, 0x66, 0x66, 0x66, 0x66, 0x63, 
-    0x36, 0x30, 0x01, 0x10, 0x00, 0x11, 0x00, 0x03, 0x43, 0x33, 0x54, 0x44, 0x55, 0x5C, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x21, 
-    0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x44, 0x66, 
-    0x64, 0x30, 0x01, 0x10, 0x00, 0x01, 0x00, 0x03, 0x53, 0x35, 0x44, 0x45, 0x55, 0x71, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x21, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x23, 0x36, 0x66, 0x44, 0x44, 0x44, 0x44, 0x66, 0x64, 0x44, 
-    0x44, 0x41, 0x01, 0x00, 0x00, 0x01, 0x00, 0x15, 0x56, 0x44, 0x44, 0x55, 0x55, 0x71, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 
-    0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 0x33, 0x33, 0x36, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44, 0x44, 0x55, 0x57, 0xC1, 0xCC, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x33, 0x33, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44, 0x45, 0x55, 0x5C, 0x77, 0x71, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x12, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x22, 0x33, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x55, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x34, 0x44, 0x45, 0x55, 0x55, 0x57, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x32, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x33, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x14, 0x44, 0x44, 0x45, 0x55, 0x51, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x23, 0x21, 0x11, 0x11, 0x11, 0x11, 0x13, 0x35, 0x44, 0x44, 0x44, 0x44, 0x45, 
-    0x11, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0x45, 0x44, 0x45, 0x55, 0x71, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x13, 0x31, 0x11, 0x11, 0x11, 0x11, 0x12, 0x33, 0x55, 0x44, 0x44, 0x4A, 0xAC, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA3, 0x54, 0x55, 0x5C, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x13, 0x63, 0x21, 0x11, 0x11, 0x11, 0x11, 0x23, 0x33, 0x35, 0x43, 0x34, 0x43, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x41, 0x35, 0x55, 0x57, 0x71, 0x11, 0x10, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x10, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x13, 0x33, 0x33, 0x32, 0x22, 0x21, 0x11, 0x12, 0x23, 0x33, 0x53, 0x34, 0x44, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x40, 0x15, 0x55, 0x57, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x17, 0x77, 0x70, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x11, 0x11, 0x11, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 0x36, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x51, 0x14, 0x44, 
-    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x50, 0x05, 0x55, 0x77, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x17, 0x77, 0x77, 0x70, 0x00, 
-    0x00, 0x00, 0x01, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x23, 0x34, 0x44, 0x64, 0x44, 0x44, 0x15, 0x41, 0x05, 0x44, 
-    0x41, 0x00, 0x10, 0x01, 0x11, 0x00, 0x00, 0x00, 0x15, 0x10, 0x01, 0x55, 0x77, 0xC1, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x77, 0xC1, 0x11, 0x7C, 0x11, 0x11, 0x1B, 0x01, 0x77, 0x77, 0x70, 0x00, 
-    0x00, 0x00, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x35, 0x54, 0x44, 0x44, 0x44, 0x05, 0x41, 0x01, 0xC1, 
-    0x10, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x57, 0x7C, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x77, 0x77, 0x77, 0x00, 
-    0x00, 0x01, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1C, 0x33, 0x35, 0x54, 0x44, 0x45, 0x0C, 0x41, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xC1, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x17, 0x77, 0x77, 0x00, 
-    0x00, 0x01, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x33, 0x22, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x55, 0x54, 0x50, 0x00, 0x5C, 0x00, 0x01, 
-    0x01, 0x11, 0x11, 0x11, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x11, 0x11, 0x11, 0x11, 
-    0x1C, 0x71, 0x01, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x00, 0x00, 0x07, 0x55, 0x57, 0x10, 
-    0x00, 0x01, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x33, 0x33, 0x22, 
-    0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x53, 0x55, 0x50, 0x00, 0xC1, 0x00, 0x11, 
-    0x11, 0x12, 0x21, 0x22, 0x22, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xCC, 0xC3, 0xC3, 0x35, 
-    0x55, 0x70, 0x00, 0x75, 0x55, 0x77, 0x77, 0x75, 0x55, 0x50, 0x00, 0x00, 0x05, 0x77, 0x00, 0x00, 
-    0x00, 0x12, 0x22, 0x11, 0x12, 0x11, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x33, 0x33, 
-    0x33, 0x22, 0x21, 0x11, 0x11, 0x11, 0x12, 0x33, 0x33, 0x35, 0x55, 0x10, 0x00, 0x01, 0x00, 0x11, 
-    0x10, 0x11, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x35, 0x13, 0x55, 
-    0x55, 0x10, 0x00, 0x05, 0x57, 0x77, 0x77, 0x75, 0x55, 0x57, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x22, 0x22, 0x23, 0x12, 0x33, 0x33, 0x32, 0x21, 0x11, 0x11, 0x11, 0x12, 0x22, 0x33, 
-    0x33, 0x33, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x54, 0x1C, 0x45, 
-    0x55, 0x00, 0x00, 0x05, 0x57, 0x77, 0x77, 0x75, 0x55, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x31, 0x13, 0x33, 0x03, 0x66, 0x66, 0x66, 0x63, 0x23, 0x22, 0x11, 0x11, 0x22, 0x23, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x45, 
-    0x55, 0x10, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x10, 0x16, 0x61, 0x03, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x32, 0x22, 0x33, 
-    0x33, 0x33, 0x33, 0x35, 0x35, 0x54, 0x44, 0x44, 0x44, 0x55, 0x44, 0x51, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 
-    0x55, 0x70, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x57, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x10, 0x05, 0x66, 0x63, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4A, 0xC5, 0xAA, 0x51, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x10, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x46, 0x66, 0x66, 0x66, 0x44, 0x44, 
-    0x44, 0x53, 0x54, 0x44, 0x44, 0x44, 0xAA, 0x44, 0x45, 0x01, 0xA4, 0x51, 0x00, 0x01, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x11, 0x10, 0x00, 0x01, 0x11, 
-    0x11, 0x00, 0x01, 0x05, 0x55, 0x55, 0x55, 0x55, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x34, 0xE8, 0x88, 0x55, 0x64, 0xE8, 0x88, 
-    0x89, 0x02, 0xE4, 0x02, 0x30, 0x95, 0xF6, 0x4E, 0x88, 0x01, 0x40, 0x90, 0x00, 0x0E, 0x90, 0x00, 
-    0x00, 0x00, 0x0B, 0x98, 0x90, 0x00, 0x00, 0xE8, 0x80, 0x00, 0x00, 0xE8, 0x80, 0x00, 0xB9, 0x88, 
-    0x88, 0x4D, 0xB9, 0x50, 0xAA, 0x55, 0x09, 0x88, 0x88, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x33, 0x33, 0x33, 0x34, 0x94, 0x56, 0x04, 0x54, 0x96, 0x56, 
-    0x45, 0x53, 0xE8, 0x45, 0xE9, 0x85, 0x59, 0x95, 0x50, 0x45, 0xDB, 0x94, 0x5D, 0x0E, 0x40, 0x00, 
-    0x00, 0x00, 0xB9, 0x5C, 0x04, 0x50, 0xB9, 0x5C, 0x04, 0x50, 0xB9, 0x5C, 0xB0, 0x50, 0x01, 0xB9, 
-    0x47, 0x70, 0xB9, 0x50, 0x45, 0x55, 0x09, 0x45, 0x55, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x66, 0x66, 0x66, 0x64, 0x95, 0xF6, 0xE4, 0x04, 0x94, 0x06, 
-    0x66, 0x65, 0xE8, 0x40, 0xE4, 0x85, 0xFE, 0x90, 0x7B, 0x95, 0xD0, 0x98, 0x47, 0x00, 0x90, 0x01, 
-    0x10, 0x00, 0x09, 0x00, 0xB9, 0xF0, 0x09, 0x00, 0x09, 0x5D, 0xB9, 0x00, 0x09, 0x5D, 0x00, 0x09, 
-    0x5D, 0x00, 0xB9, 0x57, 0x55, 0x55, 0x09, 0x50, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x44, 0x44, 0x66, 0x64, 0x94, 0xF6, 0xE4, 0x04, 0xE8, 0x48, 
-    0x45, 0x64, 0xE4, 0x09, 0x50, 0x9F, 0xFE, 0x90, 0x5B, 0x95, 0xDB, 0x90, 0x08, 0x00, 0x90, 0x11, 
-    0x10, 0x01, 0x09, 0x00, 0x00, 0x00, 0x09, 0x49, 0x98, 0x5D, 0x0B, 0x08, 0x8D, 0x00, 0x00, 0xB9, 
-    0x5D, 0x00, 0xB9, 0x5D, 0x55, 0x55, 0x09, 0x64, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0x44, 0x44, 0x66, 0x64, 0x94, 0xF6, 0xE4, 0x04, 0xE8, 0x48, 
-    0x5F, 0x64, 0xE4, 0x04, 0xF0, 0x9F, 0xF0, 0x90, 0x5B, 0x95, 0xDB, 0x9F, 0x0B, 0xE8, 0x90, 0x21, 
-    0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x09, 0x64, 0x48, 0x5D, 0x00, 0x08, 0x40, 0x10, 0x00, 0xB9, 
-    0x5D, 0x00, 0xB9, 0x5D, 0x77, 0x57, 0x09, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0xA4, 0x44, 0x44, 0xAA, 0x44, 0x44, 0x95, 0xF4, 0xE8, 0x04, 0x94, 0x0A, 
-    0xAA, 0xA4, 0xE4, 0x04, 0xA0, 0x9F, 0xF0, 0x90, 0xDB, 0x95, 0xDB, 0x9F, 0x01, 0x09, 0x90, 0x21, 
-    0x00, 0x01, 0xE9, 0x00, 0xB9, 0x50, 0x09, 0x00, 0xB9, 0x5D, 0xB9, 0x70, 0x09, 0x4D, 0x00, 0xB9, 
-    0x5D, 0x00, 0xB9, 0x5D, 0x17, 0x77, 0x09, 0x50, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x94, 0x54, 0x94, 0x04, 0x94, 0xF4, 
-    0x44, 0xAA, 0xE4, 0x0A, 0xA0, 0x95, 0xF4, 0x90, 0xB0, 0x95, 0xDB, 0x9F, 0x00, 0x00, 0x90, 0x10, 
-    0x00, 0x00, 0x09, 0x01, 0x09, 0x50, 0x09, 0x00, 0xB9, 0x5D, 0xB9, 0x01, 0xB9, 0x5D, 0x00, 0xB9, 
-    0x5D, 0x00, 0xB9, 0x5B, 0x25, 0x57, 0x09, 0x45, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x43, 0x43, 0x33, 0x33, 0x33, 0x34, 0x98, 0x88, 0xF0, 0x1A, 0xE8, 0x88, 
-    0x89, 0x0A, 0xE4, 0x04, 0x50, 0x9F, 0x75, 0xB9, 0x88, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x98, 0x40, 0x00, 0x09, 0x00, 0xB9, 0xFD, 0x00, 0x98, 0x80, 0x00, 0x00, 0xB9, 
-    0xFD, 0x00, 0xB9, 0x88, 0x88, 0x40, 0x09, 0x88, 0x88, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x53, 0x31, 0x15, 0x66, 0x66, 0x44, 0x44, 0x4A, 0xFC, 0x1A, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xA5, 0x17, 0x77, 0x71, 0xBB, 0x77, 0x71, 0x11, 0xB7, 0x00, 0x00, 0x10, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x71, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x01, 0x11, 0x17, 0x77, 0x77, 0x77, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x33, 0x36, 0x44, 0xA4, 0xAA, 0x31, 0x1A, 0xAA, 0xAA, 
-    0xAA, 0xAA, 0xAA, 0xAA, 0xBB, 0xB1, 0xB7, 0x7C, 0x10, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x1C, 0x33, 0x33, 0x45, 0x55, 0xC1, 0x13, 0xA5, 0xAA, 
-    0xAA, 0xA0, 0x00, 0x0F, 0x17, 0xBB, 0xBB, 0xB1, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0xC3, 0x33, 0x33, 0x11, 0x11, 0x11, 0x1C, 0xAA, 
-    0xA5, 0xAA, 0xAA, 0xF7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x16, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0xC7, 0x55, 0x53, 0x01, 0x11, 0x11, 0x01, 0xAA, 
-    0xA1, 0x54, 0x55, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x77, 0x75, 0x5C, 0x11, 0x00, 0x00, 0x01, 0x55, 
-    0x51, 0x75, 0x77, 0x11, 0x11, 0x10, 0x01, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0B, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0xBB, 0xBB, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 
-    0x00, 0x1B, 0xB7, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x11, 0x1B, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 
-    0x11, 0x1B, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0xC1, 0x11, 
-    0x11, 0x11, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x23, 0x33, 0x11, 0x21, 0x12, 0x22, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x12, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x21, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x11, 0x00, 0x11, 0x13, 0x62, 0x22, 0x21, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x01, 0x11, 
-    0x22, 0x21, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x21, 0x01, 0x22, 0x22, 
-    0x11, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x31, 0x36, 0x32, 0x22, 
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x11, 0x12, 
-    0x22, 0x22, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x21, 0x01, 0x11, 0x12, 
-    0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x13, 0x66, 0x63, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x12, 
-    0x22, 0x22, 0x21, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x01, 0x22, 0x33, 0x21, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 
-    0x82, 0x22, 0x21, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 
-    0x88, 0x88, 0x22, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x28, 
-    0x88, 0x88, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x28, 
-    0x88, 0x68, 0x82, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x02, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 
-    0x66, 0x66, 0x82, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x22, 0x22, 0x12, 0x22, 0x22, 
-    0x22, 0x21, 0x11, 0x12, 0x22, 0x12, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x86, 
-    0x66, 0x26, 0x68, 0x82, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x21, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x10, 0x11, 0x12, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x22, 0x11, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x88, 0x86, 
-    0x03, 0x16, 0x68, 0x88, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x81, 0x28, 
-    0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x12, 0x82, 0x22, 0x22, 0x82, 0x22, 0x28, 0x86, 0x66, 0x2A, 
-    0xA4, 0x4A, 0x06, 0x26, 0x88, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x12, 0x21, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x86, 0x66, 0x66, 0x22, 0x12, 
-    0x33, 0x32, 0x32, 0x12, 0x66, 0x88, 0x88, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0x22, 
-    0x22, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x26, 0x33, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x16, 0x66, 0x68, 0x88, 0x22, 0x22, 0x22, 0x21, 0x12, 0x82, 0x28, 0x22, 
-    0x22, 0x11, 0x00, 0x00, 0x11, 0x11, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x01, 0x13, 0x66, 0x68, 0x82, 0x88, 0x22, 0x10, 0x01, 0x28, 0x22, 0x62, 
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t STORY_CH9_RLE[STORY_CH9_RLE_SIZE] = {
+    0xF0, 0x1C, 0x01, 0x10, 0xB1, 0xA0, 0xF1, 0x13, 0x00, 0x20, 0xF1, 0x08, 0x00, 0x20, 0xA3, 0x02, 
+    0x11, 0x10, 0xA0, 0xF1, 0x00, 0xF0, 0x24, 0xF1, 0x00, 0x03, 0x22, 0x11, 0xB0, 0xF1, 0x05, 0xE2, 
+    0x01, 0x11, 0xB2, 0x54, 0xA0, 0xF1, 0x05, 0x6A, 0xC2, 0x05, 0x33, 0x21, 0x11, 0xC0, 0xF1, 0x01, 
+    0xF2, 0x06, 0xF1, 0x07, 0x7F, 0x04, 0x00, 0x11, 0x10, 0xA2, 0xB3, 0x00, 0x20, 0xF1, 0x07, 0xF2, 
+    0x06, 0xF1, 0x04, 0x00, 0x20, 0xA3, 0x04, 0x66, 0x31, 0x10, 0xF0, 0x05, 0xA1, 0xF0, 0x14, 0x01, 
+    0x11, 0x4D, 0x00, 0x10, 0x43, 0x01, 0x66, 0xA3, 0x01, 0x22, 0xF1, 0x02, 0xF2, 0x01, 0x02, 0x33, 
+    0x30, 0x4C, 0x04, 0x23, 0x34, 0x40, 0xA6, 0x4F, 0xF0, 0x17, 0xB1, 0xF0, 0x00, 0xB1, 0xA2, 0xA6, 
+    0xB3, 0x02, 0x22, 0x20, 0xA1, 0xF2, 0x01, 0x01, 0x31, 0xC3, 0x03, 0x22, 0x12, 0xE1, 0x04, 0x23, 
+    0x66, 0x60, 0xB3, 0x00, 0x20, 0x6E, 0x00, 0x00, 0xB1, 0xD0, 0xD1, 0x02, 0x22, 0x30, 0xB6, 0xC3, 
+    0xF2, 0x06, 0x46, 0x0E, 0x32, 0x13, 0x32, 0x33, 0x22, 0x23, 0x34, 0x40, 0xD3, 0x01, 0x11, 0xF0, 
+    0x16, 0x00, 0x10, 0xF0, 0x08, 0xF1, 0x0A, 0x00, 0x20, 0xF3, 0x08, 0xA2, 0x05, 0x33, 0x22, 0x33, 
+    0x43, 0x05, 0x12, 0x33, 0x30, 0xF3, 0x01, 0x42, 0x02, 0x53, 0xC0, 0xA1, 0xF0, 0x29, 0x51, 0x00, 
+    0x20, 0xF3, 0x11, 0x0B, 0x10, 0x33, 0x10, 0x13, 0x3C, 0x02, 0xE3, 0x05, 0x44, 0x53, 0x33, 0xD1, 
+    0xF0, 0x2E, 0xF1, 0x02, 0x00, 0x20, 0x4C, 0xB6, 0x49, 0x0B, 0x15, 0x10, 0x03, 0x31, 0x00, 0x34, 
+    0xB3, 0x01, 0x44, 0xA5, 0xD1, 0xF0, 0x2F, 0x02, 0x11, 0x20, 0xF1, 0x00, 0xA2, 0xB3, 0x00, 0x60, 
+    0x47, 0xB6, 0x0D, 0x33, 0x63, 0x00, 0x11, 0x00, 0x01, 0x10, 0x45, 0x01, 0x54, 0x43, 0x00, 0xC0, 
+    0x7F, 0x01, 0x22, 0xF1, 0x01, 0x04, 0x22, 0x23, 0x30, 0xF6, 0x04, 0x06, 0x44, 0x46, 0x66, 0x40, 
+    0x46, 0x00, 0x00, 0x43, 0x0A, 0x53, 0x35, 0x44, 0x45, 0x55, 0x70, 0xD1, 0xF0, 0x30, 0x02, 0x11, 
+    0x10, 0x49, 0x08, 0x11, 0x22, 0x33, 0x66, 0x60, 0xE4, 0x02, 0x66, 0x60, 0xC4, 0x02, 0x10, 0x10, 
+    0xB0, 0x06, 0x10, 0x01, 0x55, 0x60, 0xA4, 0xA5, 0x45, 0xF0, 0x31, 0x42, 0x01, 0x22, 0xF1, 0x02, 
+    0x00, 0x20, 0xC3, 0x00, 0x60, 0xF4, 0x06, 0x00, 0x10, 0xF0, 0x01, 0x00, 0x10, 0xD4, 0x09, 0x55, 
+    0x57, 0xC1, 0xCC, 0x11, 0xF0, 0x32, 0xB1, 0x01, 0x22, 0xF1, 0x02, 0x02, 0x22, 0x20, 0xB3, 0x5E, 
+    0xA5, 0x05, 0xC7, 0x77, 0x11, 0xF0, 0x12, 0x00, 0x10, 0xF0, 0x1A, 0x02, 0x11, 0x10, 0xC2, 0xF1, 
+    0x00, 0x01, 0x22, 0x4C, 0x01, 0x55, 0x4C, 0x00, 0x30, 0x46, 0x03, 0x55, 0x71, 0x58, 0xA1, 0xF0, 
+    0x02, 0x02, 0x11, 0x10, 0x56, 0xB1, 0x01, 0x32, 0xF1, 0x01, 0x03, 0x33, 0x35, 0xF4, 0x01, 0x02, 
+    0x33, 0xA0, 0x49, 0x02, 0xC4, 0x10, 0xC4, 0xA5, 0x02, 0x11, 0x10, 0xF0, 0x0E, 0xA1, 0xF0, 0x03, 
+    0xF1, 0x06, 0x50, 0x02, 0x23, 0x20, 0xF1, 0x01, 0x4A, 0x03, 0x51, 0x15, 0x49, 0x05, 0x15, 0x03, 
+    0x45, 0x44, 0x00, 0x70, 0x57, 0xD1, 0x57, 0x01, 0x11, 0xF0, 0x00, 0xE1, 0x01, 0x33, 0xF1, 0x01, 
+    0x04, 0x23, 0x35, 0x50, 0xB4, 0x03, 0xAA, 0xC1, 0xF0, 0x07, 0x08, 0x1A, 0x35, 0x45, 0x55, 0xC0, 
+    0xC1, 0xF0, 0x02, 0xF1, 0x08, 0x53, 0x01, 0x22, 0xB1, 0x4E, 0x02, 0x63, 0x20, 0xF1, 0x00, 0x00, 
+    0x20, 0xA3, 0x06, 0x54, 0x33, 0x44, 0x30, 0xF0, 0x08, 0x03, 0xC4, 0x13, 0xA5, 0x01, 0x77, 0xA1, 
+    0xB0, 0xF1, 0x03, 0x00, 0x70, 0xF1, 0x03, 0xF0, 0x01, 0xF1, 0x02, 0x02, 0x22, 0x20, 0xA1, 0x4D, 
+    0xB3, 0xA2, 0xA1, 0x05, 0x22, 0x33, 0x35, 0x42, 0x01, 0x43, 0xF0, 0x06, 0x04, 0xC4, 0x40, 0x10, 
+    0x43, 0xF1, 0x09, 0xE7, 0xB1, 0xA7, 0xF0, 0x00, 0xF1, 0x03, 0xA2, 0xC1, 0x01, 0x00, 0xF1, 0x03, 
+    0x05, 0x23, 0x36, 0x66, 0xF3, 0x01, 0x02, 0x51, 0x10, 0xA4, 0x00, 0x10, 0xF0, 0x05, 0x08, 0x44, 
+    0x50, 0x05, 0x55, 0x70, 0x4F, 0xF7, 0x01, 0x02, 0x11, 0x10, 0xC7, 0xE0, 0x01, 0x12, 0xF1, 0x03, 
+    0xB2, 0xF1, 0x0B, 0x06, 0x23, 0x34, 0x44, 0x60, 0xB4, 0x05, 0x15, 0x41, 0x05, 0x44, 0x05, 0x10, 
+    0x01, 0x11, 0xC0, 0x05, 0x15, 0x10, 0x01, 0x42, 0x00, 0xC0, 0xF1, 0x04, 0x07, 0x77, 0xC1, 0x11, 
+    0x7C, 0xB1, 0x02, 0xB0, 0x10, 0x4A, 0x01, 0x12, 0xF1, 0x05, 0xC2, 0xF1, 0x0A, 0x03, 0x23, 0x55, 
+    0xD4, 0x00, 0x00, 0x42, 0x05, 0x1C, 0x11, 0x00, 0xE1, 0xC0, 0x00, 0x10, 0xA0, 0x03, 0x57, 0x7C, 
+    0xF1, 0x01, 0x00, 0x00, 0xF1, 0x07, 0x02, 0x00, 0x00, 0xC7, 0xB0, 0x03, 0x12, 0x22, 0xF1, 0x07, 
+    0xB2, 0xF1, 0x08, 0x05, 0xC3, 0x33, 0x55, 0xA4, 0x04, 0x50, 0xC4, 0x10, 0xC0, 0xF1, 0x00, 0xF0, 
+    0x02, 0x02, 0x7C, 0xC0, 0xF1, 0x02, 0x4E, 0xA0, 0x00, 0x10, 0x4B, 0xF1, 0x09, 0x05, 0x22, 0x33, 
+    0x22, 0xF1, 0x07, 0xA3, 0x0E, 0x55, 0x54, 0x50, 0x00, 0x5C, 0x00, 0x01, 0x00, 0xD1, 0x03, 0x21, 
+    0x11, 0xF0, 0x01, 0x01, 0x1C, 0xF1, 0x00, 0x04, 0xC7, 0x10, 0x10, 0xF7, 0x04, 0xC0, 0x05, 0x75, 
+    0x55, 0x71, 0x44, 0xF1, 0x0B, 0x00, 0x20, 0xA3, 0x02, 0x22, 0x20, 0x50, 0x02, 0x35, 0x50, 0x42, 
+    0x03, 0xC1, 0x00, 0xB1, 0x02, 0x22, 0x10, 0xA2, 0x4B, 0x12, 0x5C, 0xCC, 0x3C, 0x33, 0x55, 0x57, 
+    0x00, 0x07, 0x55, 0x50, 0xB7, 0xA5, 0xC0, 0x02, 0x57, 0x70, 0xC0, 0x09, 0x12, 0x22, 0x11, 0x12, 
+    0x11, 0xA2, 0xF1, 0x01, 0x01, 0x22, 0xC3, 0x02, 0x22, 0x20, 0xE1, 0x00, 0x20, 0xB3, 0x03, 0x55, 
+    0x51, 0xA0, 0x44, 0x00, 0x00, 0xA1, 0xC0, 0x00, 0x10, 0x48, 0x06, 0xC5, 0x33, 0x51, 0x30, 0xA5, 
+    0x00, 0x10, 0xA0, 0x01, 0x55, 0xC7, 0xA5, 0x00, 0x70, 0xA0, 0x01, 0x11, 0xE0, 0x42, 0x05, 0x22, 
+    0x23, 0x12, 0xB3, 0x01, 0x22, 0xE1, 0x02, 0x22, 0x20, 0xC3, 0xB2, 0xF3, 0x02, 0x02, 0x55, 0xC0, 
+    0xF0, 0x0C, 0x48, 0x0B, 0x00, 0x1C, 0x54, 0x1C, 0x45, 0x55, 0xB0, 0x4F, 0xF0, 0x01, 0x09, 0x12, 
+    0x31, 0x13, 0x33, 0x03, 0xD6, 0x04, 0x32, 0x32, 0x20, 0xA1, 0x02, 0x22, 0x20, 0xF3, 0x08, 0xD5, 
+    0x00, 0x10, 0xF0, 0x1A, 0x02, 0x70, 0x10, 0x42, 0x00, 0x10, 0x44, 0xF5, 0x02, 0xF0, 0x07, 0x05, 
+    0x10, 0x16, 0x61, 0x47, 0xB6, 0x05, 0x33, 0x32, 0x22, 0xF3, 0x00, 0x03, 0x53, 0x55, 0xD4, 0x03, 
+    0x55, 0x44, 0x63, 0x07, 0x00, 0x05, 0x15, 0x57, 0x4C, 0x02, 0x7C, 0x10, 0xF0, 0x0A, 0x0A, 0x11, 
+    0x00, 0x56, 0x66, 0x33, 0x30, 0xF6, 0x04, 0xF4, 0x09, 0x04, 0xAC, 0x5A, 0xA0, 0x66, 0x04, 0x00, 
+    0x07, 0x10, 0x4B, 0x00, 0x70, 0xF0, 0x11, 0x00, 0x10, 0xE3, 0x00, 0x40, 0xD6, 0xC4, 0x02, 0x53, 
+    0x50, 0xD4, 0x09, 0xAA, 0x44, 0x45, 0x01, 0xA4, 0x43, 0x01, 0x11, 0xF0, 0x00, 0x02, 0x11, 0x10, 
+    0xB0, 0x02, 0x11, 0x10, 0xB0, 0x02, 0x11, 0x10, 0xA0, 0xB1, 0x03, 0x00, 0x01, 0x48, 0x02, 0x51, 
+    0x10, 0x5E, 0x09, 0x4E, 0x88, 0x85, 0x56, 0x4E, 0xA8, 0x15, 0x90, 0x2E, 0x40, 0x23, 0x09, 0x5F, 
+    0x64, 0xE8, 0x80, 0x14, 0x09, 0xA0, 0x01, 0xE9, 0xE0, 0x03, 0xB9, 0x89, 0xB0, 0x02, 0xE8, 0x80, 
+    0xB0, 0x07, 0xE8, 0x80, 0x00, 0xB9, 0xA8, 0x0B, 0x4D, 0xB9, 0x50, 0xAA, 0x55, 0x09, 0xA8, 0x01, 
+    0x4D, 0xF0, 0x0D, 0x01, 0x36, 0x46, 0x28, 0x94, 0x56, 0x04, 0x54, 0x96, 0x56, 0x45, 0x53, 0xE8, 
+    0x45, 0xE9, 0x85, 0x59, 0x95, 0x50, 0x45, 0xDB, 0x94, 0x5D, 0x0E, 0x40, 0xD0, 0x1F, 0xB9, 0x5C, 
+    0x04, 0x50, 0xB9, 0x5C, 0x04, 0x50, 0xB9, 0x5C, 0xB0, 0x50, 0x01, 0xB9, 0x47, 0x70, 0x42, 0x01, 
+    0x45, 0x42, 0x04, 0x45, 0x55, 0x70, 0x55, 0x01, 0x54, 0xD6, 0x0B, 0x49, 0x5F, 0x6E, 0x40, 0x49, 
+    0x40, 0xA6, 0x1D, 0x5E, 0x84, 0x0E, 0x48, 0x5F, 0xE9, 0x07, 0xB9, 0x5D, 0x09, 0x84, 0x70, 0x09, 
+    0x00, 0x11, 0xA0, 0x1D, 0x90, 0x0B, 0x9F, 0x00, 0x90, 0x00, 0x95, 0xDB, 0x90, 0x00, 0x95, 0xD0, 
+    0x00, 0x95, 0xD0, 0x42, 0x00, 0x70, 0xA5, 0x04, 0x09, 0x50, 0x70, 0xF0, 0x0F, 0x01, 0x13, 0xB4, 
+    0x43, 0x00, 0x40, 0x44, 0x0F, 0xE8, 0x48, 0x45, 0x64, 0xE4, 0x09, 0x50, 0x9F, 0x42, 0x00, 0x50, 
+    0x42, 0x04, 0xB9, 0x00, 0x80, 0x42, 0x00, 0x10, 0x42, 0x00, 0x10, 0x42, 0xB0, 0x0C, 0x94, 0x99, 
+    0x85, 0xD0, 0xB0, 0x88, 0xD0, 0xA0, 0x00, 0xB0, 0x46, 0x00, 0xD0, 0x44, 0x03, 0x64, 0x97, 0xF0, 
+    0x0D, 0x03, 0x3A, 0xAA, 0x52, 0x01, 0x5F, 0x43, 0x01, 0x4F, 0x42, 0x00, 0x00, 0x47, 0x09, 0xF0, 
+    0xBE, 0x89, 0x02, 0x10, 0x4B, 0x02, 0x64, 0x40, 0x42, 0x05, 0x00, 0x84, 0x01, 0x4B, 0x08, 0x77, 
+    0x57, 0x09, 0x84, 0x80, 0x54, 0x01, 0x3A, 0xB4, 0x01, 0xAA, 0xA4, 0x0A, 0x95, 0xF4, 0xE8, 0x04, 
+    0x94, 0x00, 0xAA, 0x43, 0x00, 0xA0, 0x45, 0x00, 0xD0, 0x46, 0x02, 0x10, 0x90, 0x46, 0x17, 0xE9, 
+    0x00, 0xB9, 0x50, 0x09, 0x00, 0xB9, 0x5D, 0xB9, 0x70, 0x09, 0x4D, 0x4A, 0x08, 0x17, 0x77, 0x09, 
+    0x50, 0xD0, 0xF0, 0x0C, 0x00, 0x10, 0xF4, 0x04, 0x05, 0x94, 0x54, 0x94, 0x42, 0x13, 0xF4, 0x44, 
+    0xAA, 0xE4, 0x0A, 0xA0, 0x95, 0xF4, 0x90, 0xB0, 0x45, 0x05, 0x00, 0x09, 0x01, 0xC0, 0x03, 0x90, 
+    0x10, 0x4B, 0x04, 0x01, 0xB9, 0x50, 0x4A, 0x0B, 0xB2, 0x55, 0x70, 0x94, 0x52, 0x11, 0xF0, 0x0B, 
+    0x03, 0x34, 0x34, 0xE3, 0x09, 0x49, 0x88, 0x8F, 0x01, 0xAE, 0xA8, 0x01, 0x90, 0x42, 0x0F, 0x45, 
+    0x09, 0xF7, 0x5B, 0x98, 0x80, 0x00, 0xB9, 0xB0, 0x00, 0x40, 0xF0, 0x00, 0x02, 0x98, 0x40, 0xA0, 
+    0x43, 0x06, 0xFD, 0x00, 0x98, 0x80, 0xB0, 0x02, 0xB9, 0xF0, 0x43, 0xA8, 0x03, 0x40, 0x09, 0xA8, 
+    0x01, 0x4D, 0xF0, 0x0A, 0x06, 0x15, 0x33, 0x11, 0x50, 0xA6, 0xB4, 0x03, 0xAF, 0xC1, 0xFA, 0x03, 
+    0x01, 0x51, 0xA7, 0x0A, 0x1B, 0xB7, 0x77, 0x11, 0x1B, 0x70, 0xA0, 0x00, 0x10, 0xA0, 0x00, 0x10, 
+    0xF0, 0x01, 0x05, 0x11, 0x71, 0x11, 0xC0, 0x00, 0x10, 0xC0, 0x00, 0x10, 0xB0, 0xA1, 0xD7, 0x01, 
+    0x11, 0xF0, 0x0D, 0xC1, 0x0B, 0x33, 0x36, 0x44, 0xA4, 0xAA, 0x31, 0x4B, 0x0A, 0xAB, 0xBB, 0x1B, 
+    0x77, 0xC1, 0x00, 0xA1, 0xF0, 0x02, 0x00, 0x20, 0x4A, 0x01, 0x11, 0xF0, 0x12, 0x02, 0x77, 0x70, 
+    0xF0, 0x12, 0xC1, 0x00, 0xC0, 0xA3, 0x09, 0x45, 0x55, 0xC1, 0x13, 0xA5, 0xBA, 0xA0, 0x02, 0xF1, 
+    0x70, 0xBB, 0xF1, 0x00, 0xF0, 0x00, 0x01, 0x61, 0x4A, 0xF0, 0x14, 0x01, 0xBB, 0xF0, 0x13, 0xC1, 
+    0x00, 0xC0, 0xB3, 0xD1, 0x04, 0xCA, 0xAA, 0x50, 0xAA, 0x01, 0xF7, 0xF1, 0x05, 0xF0, 0x01, 0x00, 
+    0x10, 0x49, 0xF0, 0x35, 0x45, 0x05, 0x75, 0x55, 0x30, 0xB1, 0x0A, 0x01, 0xAA, 0xA1, 0x54, 0x55, 
+    0x70, 0xF1, 0x05, 0xF0, 0x03, 0x00, 0x10, 0xF0, 0x3F, 0xC1, 0x07, 0x77, 0x75, 0x5C, 0x11, 0xB0, 
+    0x08, 0x15, 0x55, 0x17, 0x57, 0x70, 0xB1, 0x05, 0x00, 0x11, 0x01, 0xF0, 0x2E, 0x01, 0x11, 0x64, 
+    0xE1, 0x44, 0xF1, 0x04, 0xF0, 0x31, 0xBB, 0xF0, 0x18, 0xF1, 0x15, 0xF0, 0x31, 0x00, 0x10, 0xBB, 
+    0x00, 0x10, 0x60, 0x02, 0x22, 0x20, 0xF1, 0x10, 0xF0, 0x2A, 0x02, 0x11, 0x10, 0xA0, 0x05, 0x1B, 
+    0xB7, 0x7B, 0xF0, 0x1A, 0xF1, 0x11, 0xF0, 0x2B, 0xF1, 0x01, 0x03, 0xB7, 0x77, 0xF0, 0x1B, 0x7F, 
+    0x02, 0x00, 0x00, 0xA1, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x49, 0x00, 0x10, 0xF0, 0x1C, 0xA1, 0x00, 
+    0x20, 0xF1, 0x0A, 0xF0, 0x10, 0x05, 0x11, 0x01, 0x11, 0x4E, 0xD1, 0x02, 0x01, 0xC0, 0xD1, 0x01, 
+    0x7B, 0xF0, 0x1D, 0x0A, 0x12, 0x23, 0x33, 0x11, 0x21, 0x10, 0xA2, 0x62, 0x06, 0x11, 0x22, 0x11, 
+    0x10, 0x54, 0x00, 0x20, 0xF1, 0x00, 0xF0, 0x1E, 0x0B, 0x13, 0x31, 0x10, 0x01, 0x11, 0x36, 0xA2, 
+    0x5A, 0x01, 0x11, 0x43, 0x00, 0x20, 0x43, 0x03, 0x10, 0x11, 0xC0, 0xE1, 0x00, 0x20, 0x42, 0x07, 
+    0x22, 0x21, 0x11, 0x00, 0x67, 0xB1, 0xA0, 0x05, 0x13, 0x13, 0x63, 0xA2, 0x00, 0x10, 0xF0, 0x0E, 
+    0x05, 0x11, 0x01, 0x11, 0xB2, 0x4E, 0xB2, 0x01, 0x10, 0xA1, 0x01, 0x21, 0xA0, 0x01, 0x11, 0xF0, 
+    0x0B, 0x00, 0x10, 0x55, 0xC1, 0x07, 0x01, 0x36, 0x66, 0x31, 0xF0, 0x06, 0xD1, 0x42, 0xA1, 0xC2, 
+    0xC1, 0xC0, 0x08, 0x10, 0x12, 0x23, 0x32, 0x10, 0xF0, 0x16, 0xA1, 0xF0, 0x08, 0xF1, 0x06, 0x02, 
+    0x23, 0x10, 0xF0, 0x05, 0xF1, 0x08, 0x01, 0x28, 0x49, 0x01, 0x11, 0xB0, 0xC1, 0xF0, 0x16, 0xA1, 
+    0xF0, 0x09, 0xF1, 0x26, 0x02, 0x22, 0x20, 0xA8, 0x01, 0x22, 0xF1, 0x00, 0xF0, 0x1F, 0xB1, 0x7E, 
+    0x02, 0x22, 0x20, 0xB8, 0x02, 0x22, 0x20, 0xF1, 0x00, 0xF0, 0x1C, 0xD1, 0xF0, 0x0B, 0xF1, 0x20, 
+    0xC2, 0x08, 0x88, 0x86, 0x88, 0x22, 0x20, 0xF1, 0x06, 0x03, 0x00, 0x11, 0xD0, 0x01, 0x11, 0xF0, 
+    0x06, 0xF1, 0x00, 0x54, 0x00, 0x00, 0xC2, 0xF1, 0x10, 0xF2, 0x04, 0x00, 0x80, 0xA6, 0x42, 0x01, 
+    0x22, 0xF1, 0x08, 0x54, 0xF1, 0x01, 0xF0, 0x0F, 0x02, 0x22, 0x10, 0xA2, 0x00, 0x10, 0xE2, 0xA1, 
+    0x06, 0x22, 0x21, 0x22, 0x10, 0xF2, 0x07, 0x08, 0x86, 0x66, 0x26, 0x68, 0x80, 0xB2, 0xF1, 0x07, 
+    0x02, 0x01, 0x10, 0x4E, 0xF1, 0x00, 0x01, 0x21, 0xF0, 0x10, 0x06, 0x11, 0x01, 0x01, 0x10, 0x47, 
+    0xB2, 0x02, 0x11, 0x00, 0xF2, 0x07, 0xA8, 0x03, 0x60, 0x31, 0x42, 0x00, 0x80, 0xF2, 0x00, 0xF1, 
+    0x06, 0x49, 0xF1, 0x03, 0x01, 0x01, 0xF0, 0x18, 0x05, 0x16, 0x81, 0x28, 0xC2, 0x00, 0x10, 0xB0, 
+    0x02, 0x12, 0x80, 0xB2, 0x00, 0x80, 0xA2, 0x10, 0x88, 0x66, 0x62, 0xAA, 0x44, 0xA0, 0x62, 0x68, 
+    0x80, 0xF2, 0x04, 0x03, 0x11, 0x22, 0xF1, 0x10, 0x02, 0x22, 0x10, 0xF0, 0x1B, 0x02, 0x21, 0x00, 
+    0xD1, 0xE0, 0x00, 0x10, 0xE2, 0x00, 0x80, 0xB6, 0x0D, 0x22, 0x12, 0x33, 0x32, 0x32, 0x12, 0x66, 
+    0xB8, 0xF2, 0x04, 0x00, 0x10, 0xD2, 0x01, 0x00, 0xF1, 0x03, 0x03, 0x01, 0x11, 0xF0, 0x34, 0x07, 
+    0x11, 0x02, 0x63, 0x33, 0xF1, 0x05, 0xA6, 0x02, 0x88, 0x80, 0xD2, 0x06, 0x11, 0x28, 0x22, 0x80, 
+    0xA2, 0x01, 0x11, 0xA0, 0xA1, 0x00, 0x00, 0xA1, 0xF0, 0x3C, 0xF1, 0x09, 0x19, 0x01, 0x13, 0x66, 
+    0x68, 0x82, 0x88, 0x22, 0x10, 0x01, 0x28, 0x22, 0x62, 0x21, 0xF0, 0x53, 0xE1, 0xC0, 0x01, 0x13, 
+    0xC1, 0xD0, 0xA1, 0xF0, 0x56, 0xD1, 0xA0, 0x00, 0x10, 0xF0, 0x01, 0x01, 0x10, 0xB1, 0xF0, 0x41, 
+    0x02, 0x11, 0x10, 0x5F, 0xA0, 0x02, 0x11, 0x10, 0xF0, 0x01, 0x4A, 0x02, 0x11, 0x10, 0xF0, 0x38, 
+    0x01, 0x11, 0xF0, 0x0A, 0x4C, 0xF0, 0x02, 0xC1, 0xF0, 0x45, 0x01, 0x11, 0xC0, 0x00, 0x10, 0xF0, 
+    0x00, 0xF1, 0x00, 0xD0, 0xF1, 0x07, 0xF0, 0x19, 
+};
+
+const gfx_image_t STORY_CH9_IMG = {
+    .w = STORY_CH9_W, .h = STORY_CH9_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH9_PAL, .colors = STORY_CH9_PAL_SIZE,
+    .data = STORY_CH9_RLE, .size = STORY_CH9_RLE_SIZE,
 };
@@ -6,177 +6,143 @@ const uint16_t STORY_CH9_ENEMY_PAL[STORY_CH9_ENEMY_PAL_SIZE] = {
     0xCE96, 0xE75A, 0x83AA, 0x8A84, 0x3A05, 0x89E3, 0x2923, 0x20E2, 
 };
 
-const uint8_t STORY_CH9_ENEMY_IDX[(STORY_CH9_ENEMY_W * STORY_CH9_ENEMY_H) / 2] = {
-    0x00, 0x00, 0xEE, 0x0E, 0xEE, 0x00, 0x00, 0xEE, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE4, 0xF0, 0xF0, 
-    0x00, 0x11, 0x11, 0x66, 0x66, 0x66, 0x66, 0x62, 0xE1, 0x36, 0x66, 0x35, 0x55, 0x31, 0x11, 0x13, 
-    0x36, 0x65, 0x75, 0x33, 0x55, 0x77, 0x56, 0x63, 0x31, 0x20, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 
-    0xEE, 0xEE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x44, 
-    0xF0, 0xF0, 0x00, 0x11, 0x16, 0x16, 0x66, 0x66, 0x63, 0x1E, 0x21, 0x16, 0x11, 0x11, 0x16, 0x33, 
-    0x31, 0x23, 0x63, 0x55, 0x55, 0x53, 0x55, 0x77, 0x56, 0x63, 0x12, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 
-    0xEE, 0xFE, 0xEE, 0xEE, 0x62, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x0E, 0xEE, 0xF0, 0x00, 
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x11, 0x16, 0x66, 0x66, 0x33, 0x2E, 0x13, 0x33, 0x33, 0x53, 
-    0x31, 0x13, 0x33, 0x23, 0x35, 0x56, 0x35, 0x35, 0x55, 0x75, 0x53, 0x33, 0x10, 0x00, 0x0E, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xFF, 0xFE, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xEE, 
-    0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x01, 0x11, 0x61, 0x66, 0x63, 0x31, 0xE4, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x31, 0x13, 0x11, 0x35, 0x63, 0x63, 0x57, 0x55, 0x55, 0x53, 0x31, 0x00, 0x0E, 
-    0xEE, 0x00, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 
-    0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0x11, 0x61, 0x16, 0x66, 0x31, 0xE2, 
-    0x33, 0x33, 0x35, 0x31, 0x63, 0x33, 0x33, 0x21, 0x56, 0x66, 0x15, 0x77, 0x57, 0x75, 0x31, 0x10, 
-    0xE0, 0xEE, 0xEE, 0x0E, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xEE, 0x00, 0xEE, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0xF1, 0x11, 0x66, 0x66, 0x16, 
-    0x31, 0xF2, 0x35, 0x55, 0x53, 0x33, 0x13, 0x33, 0x33, 0x41, 0x36, 0x33, 0x58, 0x85, 0x57, 0x75, 
-    0x11, 0x1E, 0xEE, 0xEE, 0xEE, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x11, 0x12, 0x00, 0x00, 
-    0x00, 0x00, 0xEE, 0xE0, 0x0E, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0x11, 0x66, 
-    0x66, 0x16, 0x31, 0xF4, 0x33, 0x53, 0x33, 0x55, 0x33, 0x36, 0x35, 0xE1, 0x53, 0x35, 0x87, 0x55, 
-    0x55, 0x56, 0x11, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xEE, 0xEF, 0x11, 0x20, 
-    0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0x0E, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x16, 0x66, 0x66, 0x16, 0x31, 0xF2, 0x33, 0x36, 0x35, 0x55, 0x31, 0x33, 0x53, 0xF1, 0x33, 0x57, 
-    0x85, 0x55, 0x55, 0x51, 0x10, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEF, 0xF0, 0xFF, 0xFE, 0xE0, 0xEF, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0xEF, 0x00, 0xEE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x21, 0x33, 0x33, 0x63, 0x31, 0xE0, 0x53, 0x31, 0x53, 0x63, 0x31, 0x53, 0x61, 0xF1, 
-    0x55, 0x57, 0x75, 0x75, 0x55, 0x33, 0x1E, 0xEE, 0x00, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
-    0x00, 0xEF, 0x12, 0xEE, 0xEE, 0xEE, 0x00, 0x0E, 0xEE, 0xE0, 0x0E, 0xE0, 0xF0, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x36, 0x33, 0x20, 0x18, 0x51, 0x31, 0x11, 0x11, 0x53, 
-    0x14, 0xE3, 0x55, 0x79, 0x57, 0x75, 0x33, 0x33, 0xCE, 0xEE, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFE, 0xE0, 0xEF, 0x12, 0xE0, 0xFF, 0xEE, 0x0E, 0x00, 0xEE, 0xF0, 0xEE, 0xEE, 0xE0, 0x00, 
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE2, 0x63, 0x33, 0x36, 0x33, 0x3F, 0xE1, 0x51, 0x21, 0x02, 
-    0x23, 0x58, 0x2F, 0x25, 0x55, 0x85, 0x57, 0x55, 0x33, 0x32, 0xEE, 0x0E, 0x0E, 0xFF, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0xEE, 0xE0, 0x0F, 0x22, 0x24, 0x00, 0xEE, 0x00, 0x0E, 0xEE, 0xFF, 0xEE, 0xFE, 
-    0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xF0, 0x16, 0x13, 0x33, 0x33, 0x51, 0xEE, 0x00, 
-    0xEE, 0xE0, 0x14, 0xA1, 0xEC, 0x35, 0x55, 0x85, 0x58, 0x55, 0x35, 0x10, 0x00, 0x0F, 0x0E, 0xFF, 
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xE0, 0xEE, 0x22, 0x11, 0x11, 0x20, 0x0E, 0xEE, 0xEE, 0xEE, 
-    0xFF, 0x0E, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0xFE, 0x35, 0x13, 0x33, 0x33, 0x55, 
-    0x1C, 0xE0, 0x04, 0x40, 0x0F, 0x00, 0x03, 0x55, 0x38, 0x85, 0x77, 0x33, 0x31, 0x00, 0x00, 0x0E, 
-    0xF0, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xEE, 0xEE, 0xE0, 0xEF, 0x22, 0x22, 0x22, 0x11, 0x22, 0x40, 
-    0xEE, 0xEE, 0xEF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xE2, 0x13, 0x33, 
-    0x35, 0x55, 0x31, 0xE0, 0x04, 0x00, 0x00, 0x16, 0x55, 0x55, 0x77, 0x55, 0x55, 0x33, 0x10, 0xE0, 
-    0x00, 0xEE, 0xF0, 0x0F, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xFE, 0xE0, 0x0F, 0x22, 0x22, 0x22, 0x21, 
-    0x11, 0x11, 0x12, 0xEE, 0xEE, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 
-    0x11, 0x33, 0x55, 0x55, 0x55, 0x0F, 0xEE, 0xEF, 0x01, 0x55, 0x33, 0x55, 0x55, 0x55, 0x53, 0x31, 
-    0x0E, 0xEE, 0x00, 0xEF, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 
-    0x22, 0x22, 0x21, 0x11, 0x12, 0x04, 0x0E, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 
-    0xEE, 0xEE, 0xE0, 0x16, 0x35, 0x57, 0x51, 0x0E, 0x4F, 0x24, 0x05, 0x53, 0x35, 0x55, 0x77, 0x55, 
-    0x53, 0x10, 0xE0, 0x00, 0xEE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xEE, 0xE0, 0x0E, 
-    0x22, 0x22, 0x21, 0x22, 0x21, 0x11, 0x11, 0x12, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xFF, 
-    0xFF, 0x0F, 0xEE, 0xEE, 0xEE, 0xE2, 0x35, 0x88, 0x75, 0x3F, 0xFF, 0xFF, 0x45, 0x55, 0x53, 0x55, 
-    0x55, 0x55, 0x53, 0x00, 0x00, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xEE, 0xEE, 
-    0xE0, 0x0E, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x32, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0xFF, 
-    0x00, 0xFF, 0xF0, 0x00, 0xEE, 0xEE, 0xEF, 0xE5, 0x99, 0x99, 0x95, 0xEF, 0x0F, 0xF0, 0x15, 0x55, 
-    0x53, 0x33, 0x55, 0x55, 0x60, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xEE, 
-    0xEE, 0xEE, 0xE0, 0x00, 0x24, 0x44, 0x22, 0x22, 0x21, 0x11, 0x11, 0x12, 0x20, 0x00, 0x00, 0x0E, 
-    0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xEE, 0xEF, 0xF0, 0x05, 0x99, 0x8A, 0x1E, 0xFF, 0x00, 0xF0, 
-    0xA9, 0x55, 0x53, 0x31, 0x63, 0x53, 0x0E, 0x0E, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 
-    0xFF, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x22, 0x44, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x0E, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xF0, 0x0E, 0x02, 0x11, 0x11, 0x33, 0xF0, 0x00, 
-    0x00, 0xFF, 0x19, 0x98, 0x53, 0x11, 0x11, 0x30, 0xE0, 0xEE, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xF0, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x22, 0x44, 0x02, 0x22, 0x22, 0x11, 0x11, 0x16, 
-    0x12, 0x40, 0xEE, 0xEE, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0x00, 0x0E, 0x21, 0x11, 0x11, 0x10, 0x42, 
-    0xE0, 0xF0, 0x00, 0x02, 0x38, 0x99, 0x83, 0x15, 0x11, 0x0E, 0xE0, 0xEE, 0x00, 0x00, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x0E, 0x22, 0x24, 0x02, 0x22, 0x22, 0x11, 
-    0x11, 0x11, 0x11, 0x10, 0xEE, 0x00, 0xFF, 0xEF, 0xFF, 0x0F, 0xF0, 0x00, 0x0F, 0x04, 0x22, 0x01, 
-    0x1E, 0xEE, 0xEF, 0x00, 0x00, 0x25, 0x89, 0x99, 0x98, 0x10, 0xE4, 0xEE, 0xFF, 0xEF, 0x0E, 0x00, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x22, 0x24, 0x02, 0x12, 
-    0x21, 0x11, 0x21, 0x11, 0x11, 0x12, 0x22, 0x2E, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 
-    0x40, 0x42, 0x0E, 0xEE, 0x0E, 0xF0, 0x0E, 0x18, 0x89, 0x98, 0x88, 0x5E, 0x0E, 0x0F, 0xFF, 0xFF, 
-    0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x22, 0x24, 
-    0x04, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x44, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0xFE, 0xF0, 0x24, 0x2E, 0xEE, 0xEE, 0x0E, 0xFF, 0xF2, 0x55, 0x88, 0x88, 0x75, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0x4E, 0xEF, 0xEE, 0xEE, 0x00, 
-    0x22, 0x24, 0x04, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x0E, 0xE0, 0xFF, 0xFF, 
-    0xFF, 0xFF, 0xFE, 0x42, 0x42, 0x0E, 0x00, 0x0E, 0x40, 0x04, 0xF3, 0x85, 0x55, 0x57, 0x55, 0xEF, 
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xE0, 0x42, 0x24, 0x44, 
-    0x24, 0xE0, 0x22, 0x24, 0x04, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2E, 0xEE, 0xEE, 0xFF, 
-    0x00, 0x0F, 0xFF, 0xEE, 0xEE, 0x40, 0x2E, 0xEE, 0x04, 0x0E, 0x22, 0x0E, 0xF1, 0x56, 0x33, 0x13, 
-    0x53, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x02, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 0x04, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xEE, 0xE4, 
-    0x4E, 0xEE, 0xF0, 0xFF, 0xFE, 0xEE, 0x4E, 0x4F, 0xFE, 0xFE, 0x00, 0xF0, 0x20, 0x0F, 0xF2, 0x21, 
-    0x12, 0x11, 0x33, 0x20, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xFE, 0xE0, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0x00, 0x22, 0x22, 0x22, 0x44, 0x42, 0x04, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x11, 0x2E, 0xEF, 0x0F, 0xFF, 0xFE, 0x44, 0x44, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0xFF, 
-    0xF4, 0x24, 0xFE, 0x21, 0x16, 0x10, 0x00, 0x00, 0xF0, 0x0F, 0xFF, 0xFE, 0xE0, 0xFE, 0xEE, 0xE4, 
-    0xE4, 0x4E, 0xEE, 0xE0, 0x04, 0x22, 0x22, 0x22, 0x04, 0x42, 0x42, 0x22, 0x22, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x1F, 0xEE, 0xFF, 0xFE, 0xE4, 0x44, 0x44, 0x00, 0x00, 0x0E, 0xF0, 0xFE, 
-    0xF0, 0xFF, 0xFE, 0x0E, 0x00, 0xEE, 0x21, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0x44, 0x44, 0x44, 0x40, 0x04, 0x22, 0x22, 0x22, 0x44, 0x42, 0x24, 0x40, 0x22, 0x21, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0xEE, 0xEE, 0xFE, 0x44, 0xD4, 0x4F, 0x0F, 0x00, 0x0F, 
-    0xE0, 0x00, 0x00, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0xE4, 0x24, 0xFF, 0x00, 0x00, 0xFE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xE4, 0x4E, 0x21, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 
-    0x42, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x04, 0x4E, 0xEE, 0x4B, 0xB4, 0xE0, 0xFF, 
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x0E, 0x44, 0xFF, 0x00, 0x00, 0xFE, 
-    0xEE, 0x00, 0x44, 0x44, 0xEE, 0x4E, 0x21, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x40, 0x42, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x0E, 0x44, 0x21, 0xA1, 
-    0x40, 0x0F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x0E, 0xF0, 0x0F, 
-    0xFF, 0xFE, 0xEE, 0xE0, 0x04, 0x4E, 0xEE, 0xE4, 0x02, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 
-    0x02, 0x22, 0x22, 0x24, 0x44, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 
-    0x11, 0x16, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xF0, 0x00, 0xEE, 
-    0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0x04, 0xE2, 0x14, 0x44, 0x44, 0x02, 0x11, 0x11, 0x11, 0x22, 0x22, 
-    0x22, 0x22, 0x04, 0x24, 0x22, 0x24, 0x00, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x33, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x20, 
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xE0, 0x42, 0x21, 0x3A, 0x12, 0x22, 0x42, 0x21, 0x11, 0x11, 
-    0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x40, 0x00, 0x42, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x13, 0x51, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x27, 0x1E, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x04, 0x11, 0x1A, 0x12, 0x22, 0x22, 0x22, 
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x22, 0x20, 0x00, 0x22, 0x22, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x1E, 0x0F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE3, 0x3E, 0x00, 0x0E, 0x44, 0x44, 0x44, 0x4E, 0xEE, 0x04, 0x21, 0x31, 0x31, 0x11, 
-    0x24, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x04, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0xFF, 0xF0, 0xFF, 0xFE, 0xF0, 0x00, 
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0x71, 0x00, 0x0F, 0x44, 0x44, 0x44, 0x44, 0x40, 0x04, 0x21, 0x13, 
-    0x66, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x04, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x21, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xEE, 0x0E, 0xFF, 0xFF, 0xFF, 
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xEE, 0xE4, 0x55, 0x00, 0x00, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x21, 0x11, 0x66, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x42, 0x24, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0xFF, 0xEF, 0xF0, 
-    0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0x55, 0xF0, 0x00, 0x12, 0x44, 0x4B, 0xB2, 
-    0x44, 0x44, 0x22, 0x11, 0x11, 0x66, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x04, 
-    0x42, 0x20, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x00, 
-    0x00, 0x00, 0xFF, 0xEE, 0xFE, 0x00, 0x00, 0x44, 0xE0, 0xEE, 0xEE, 0x55, 0x10, 0x00, 0x1A, 0x42, 
-    0x2B, 0xB1, 0x24, 0x24, 0x22, 0x11, 0x11, 0x16, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x42, 
-    0x00, 0x04, 0x44, 0x24, 0x04, 0x22, 0x22, 0x22, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 
-    0x20, 0x00, 0x00, 0x00, 0xFF, 0xEE, 0xFE, 0xF0, 0xF4, 0x4E, 0x44, 0xEE, 0xEE, 0x37, 0x51, 0x00, 
-    0x03, 0xA1, 0xAB, 0xB3, 0xA2, 0x11, 0x22, 0x12, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x20, 
-    0x40, 0x04, 0x00, 0x40, 0x00, 0x22, 0x00, 0x22, 0x22, 0x20, 0x21, 0x12, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x12, 0x2E, 0x0F, 0x00, 0x00, 0x0F, 0xEE, 0xFE, 0xEE, 0xE0, 0xEE, 0x4E, 0xEE, 0xEE, 0x37, 
-    0x75, 0x00, 0xE3, 0x33, 0x33, 0x13, 0x53, 0x33, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x42, 0x22, 0x20, 0x21, 0x21, 0x11, 0x11, 
-    0x11, 0x22, 0x22, 0x11, 0x20, 0xFE, 0xFF, 0xF0, 0x0F, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x0E, 0xEE, 
-    0xEE, 0x37, 0x58, 0x60, 0x01, 0x33, 0x33, 0x11, 0x36, 0x13, 0x36, 0x33, 0x11, 0x11, 0x12, 0x22, 
-    0x22, 0x22, 0x20, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x22, 0x24, 0x02, 0x21, 
-    0x11, 0x11, 0x20, 0xEE, 0xE0, 0x21, 0x00, 0xFF, 0xEE, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xFE, 0xEE, 
-    0x0E, 0xFF, 0xFF, 0x17, 0x55, 0x3F, 0x00, 0x33, 0x36, 0x11, 0x63, 0x11, 0x11, 0x63, 0x61, 0x11, 
-    0x12, 0x22, 0x22, 0x44, 0x00, 0x0E, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x22, 0x22, 
-    0x00, 0x02, 0x12, 0x12, 0x00, 0x22, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xFE, 0xEE, 0xEE, 0xEF, 
-    0xFE, 0x00, 0x0E, 0xFE, 0xEE, 0xE5, 0x75, 0x50, 0x00, 0x63, 0x33, 0x31, 0x13, 0x31, 0x11, 0x66, 
-    0x11, 0x11, 0x22, 0x22, 0x24, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 
-    0x22, 0x22, 0x20, 0x00, 0x12, 0x22, 0xE1, 0x61, 0x12, 0x00, 0xF0, 0x0F, 0x0F, 0x00, 0xE0, 0xEF, 
-    0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0x00, 0x15, 0x55, 0x52, 0xF0, 0x15, 0x33, 0x61, 0x11, 0x11, 
-    0x16, 0x33, 0x11, 0x11, 0x22, 0x22, 0x40, 0xE0, 0x0E, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x22, 0x22, 0x22, 0x22, 0x40, 0x21, 0x10, 0x01, 0x11, 0x11, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 
-    0xEE, 0xEF, 0xFE, 0xE0, 0x0E, 0x02, 0xF0, 0x00, 0x24, 0x15, 0x55, 0x50, 0xFF, 0x05, 0x35, 0x31, 
-    0x11, 0x11, 0x13, 0x61, 0x11, 0x12, 0x24, 0x44, 0x0E, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x1E, 0x21, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x0F, 0xEE, 0xEE, 0xEF, 0xFF, 0xE0, 0xEE, 0x20, 0x00, 0x24, 0x22, 0x35, 0x55, 0x5E, 0x00, 0xF1, 
-    0x33, 0x36, 0x11, 0x11, 0x13, 0x61, 0x11, 0x12, 0x24, 0x00, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x22, 0x22, 0x21, 0x12, 0x2E, 0x21, 0x11, 0x12, 0xF0, 
-    0x00, 0x00, 0x0E, 0xEE, 0x0E, 0xFF, 0xFF, 0xE0, 0xE0, 0x4E, 0x00, 0x22, 0x02, 0x57, 0x53, 0x3E, 
-    0x1E, 0x01, 0x33, 0x33, 0x11, 0x11, 0x63, 0x11, 0x11, 0x12, 0x24, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 0x11, 0x11, 
-    0x4E, 0xF0, 0x00, 0x00, 0xFF, 0xEE, 0x0F, 0xFF, 0xFE, 0xE0, 0xEE, 0x00, 0xF0, 0x22, 0x01, 0x57, 
-    0x75, 0x32, 0x51, 0xF3, 0x33, 0x33, 0x11, 0x11, 0x31, 0x12, 0x11, 0x22, 0x20, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x42, 0x24, 0x21, 0x22, 0x20, 
-    0x21, 0x10, 0xEF, 0xF0, 0x00, 0x0F, 0xEE, 0x0E, 0xEF, 0xFF, 0xFE, 0xEE, 0xE0, 0xEF, 0xEE, 0x22, 
-    0x23, 0x55, 0x55, 0x55, 0x53, 0x15, 0x33, 0x66, 0x11, 0x13, 0x12, 0x22, 0x22, 0x22, 0x40, 0xEE, 
-    0xEE, 0xEE, 0xEF, 0xFE, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x24, 0x22, 0xEE, 0xFF, 0xF0, 0x00, 0x0E, 0xE0, 0x0E, 0xEF, 0xFF, 0xFE, 0x00, 0x04, 0xFE, 
-    0xEE, 0x22, 0x23, 0x55, 0x33, 0x36, 0x35, 0x53, 0x36, 0x11, 0x11, 0x13, 0x22, 0x22, 0x22, 0x22, 
-    0x0E, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x00, 0x22, 0x0E, 
-    0xE0, 0x00, 0x22, 0x40, 0x0E, 0xEE, 0xF0, 0x0F, 0xFF, 0xEE, 0x00, 0x0E, 0xEF, 0xFF, 0xEE, 0x00, 
-    0x20, 0xE0, 0xF0, 0x42, 0x23, 0x55, 0x36, 0x61, 0x16, 0x36, 0x16, 0x11, 0x11, 0x11, 0x22, 0x24, 
-    0x42, 0x24, 0x0E, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xEE, 0x0E, 0xEE, 0x00, 0x00, 0x00, 
-    0x02, 0x40, 0xEE, 0xE0, 0x00, 0x0E, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0x00, 0x00, 0xE0, 0xEE, 0xEF, 
-    0xEE, 0x04, 0x40, 0xEF, 0xF0, 0x02, 0x23, 0x33, 0x33, 0x61, 0x12, 0x22, 0x21, 0x11, 0x11, 0x22, 
-    0x22, 0x20, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xF0, 0x00, 0xEF, 0xEE, 0xEE, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x00, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0x00, 0x0E, 0xE0, 
-    0xEE, 0xEE, 0xE0, 0x44, 0x20, 0xF0, 0x00, 0xE2, 0x23, 0x33, 0x33, 0x33, 0x31, 0x22, 0x22, 0x11, 
-    0x20, 0x22, 0x22, 0x4E, 0xE0, 0x0E, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0xEF, 
+const uint8_t STORY_CH9_ENEMY_RLE[STORY_CH9_ENEMY_RLE_SIZE] = {
+    0xA0, 0x05, 0xEE, 0x0E, 0xEE, 0xA0, 0x05, 0xEE, 0x00, 0x0F, 0xC0, 0x07, 0xE4, 0xF0, 0xF0, 0x00, 
+    0xA1, 0xF6, 0x00, 0x0B, 0x2E, 0x13, 0x66, 0x63, 0x55, 0x53, 0xA1, 0x16, 0x33, 0x66, 0x57, 0x53, 
+    0x35, 0x57, 0x75, 0x66, 0x33, 0x12, 0x00, 0x00, 0xEE, 0x01, 0xFF, 0xAE, 0x00, 0x10, 0xF0, 0x05, 
+    0x49, 0x00, 0x40, 0x48, 0x01, 0x61, 0xC6, 0x06, 0x31, 0xE2, 0x11, 0x60, 0xB1, 0x08, 0x63, 0x33, 
+    0x12, 0x36, 0x30, 0xB5, 0x47, 0x01, 0x12, 0xA0, 0x01, 0xE0, 0x45, 0xBE, 0x02, 0x62, 0xE0, 0xE0, 
+    0x01, 0xEE, 0xA0, 0x03, 0xEE, 0xEF, 0xF0, 0x00, 0x00, 0xE0, 0xA0, 0xA1, 0xB6, 0x04, 0x33, 0x2E, 
+    0x10, 0xB3, 0x1A, 0x53, 0x31, 0x13, 0x33, 0x23, 0x35, 0x56, 0x35, 0x35, 0x55, 0x75, 0x53, 0x33, 
+    0x10, 0xA0, 0xFE, 0x00, 0x06, 0xFF, 0xFE, 0xEE, 0x20, 0xF0, 0x02, 0x07, 0xE0, 0x0E, 0x00, 0xEE, 
+    0xD0, 0x02, 0xFE, 0xF0, 0xB0, 0x0C, 0x11, 0x16, 0x16, 0x66, 0x33, 0x1E, 0x40, 0xF3, 0x02, 0x0C, 
+    0x11, 0x31, 0x13, 0x56, 0x36, 0x35, 0x70, 0xB5, 0x0D, 0x33, 0x10, 0x00, 0xEE, 0xE0, 0x0E, 0xEE, 
+    0xEF, 0x01, 0xEC, 0xF0, 0x03, 0x05, 0xEE, 0x0E, 0xE0, 0x46, 0x03, 0x0F, 0xFE, 0x47, 0x07, 0x16, 
+    0x66, 0x31, 0xE2, 0xB3, 0x03, 0x53, 0x16, 0xB3, 0x13, 0x21, 0x56, 0x66, 0x15, 0x77, 0x57, 0x75, 
+    0x31, 0x10, 0xE0, 0xAE, 0x02, 0x0E, 0xE0, 0xFF, 0x02, 0x01, 0x12, 0xF0, 0x01, 0x02, 0xEE, 0x00, 
+    0x43, 0x01, 0xFF, 0xD0, 0x05, 0xEF, 0x00, 0x0F, 0x42, 0x09, 0x66, 0x61, 0x63, 0x1F, 0x23, 0xA5, 
+    0x03, 0x33, 0x31, 0xB3, 0x09, 0x41, 0x36, 0x33, 0x58, 0x85, 0x42, 0x02, 0x11, 0x10, 0xDE, 0x01, 
+    0x0E, 0xEF, 0x00, 0xE0, 0x42, 0x02, 0x11, 0x20, 0x48, 0x02, 0xE0, 0x00, 0x4A, 0x06, 0xFF, 0xF0, 
+    0x00, 0x20, 0x49, 0x16, 0x43, 0x35, 0x33, 0x35, 0x53, 0x33, 0x63, 0x5E, 0x15, 0x33, 0x58, 0x70, 
+    0xB5, 0x02, 0x61, 0x10, 0xDE, 0xDF, 0x0A, 0x00, 0xFF, 0xEE, 0xEF, 0x11, 0x20, 0xE0, 0xBE, 0x03, 
+    0x0E, 0xEE, 0xF0, 0x07, 0x00, 0x10, 0xB6, 0x43, 0x15, 0x23, 0x33, 0x63, 0x55, 0x53, 0x13, 0x35, 
+    0x3F, 0x13, 0x35, 0x78, 0xC5, 0x02, 0x11, 0x00, 0xCE, 0xAF, 0x09, 0xEF, 0xF0, 0xFF, 0xFE, 0xE0, 
+    0x42, 0xF0, 0x00, 0xAE, 0x02, 0xF0, 0x00, 0x44, 0x01, 0xFF, 0xF0, 0x01, 0x01, 0x21, 0xA3, 0x2A, 
+    0x63, 0x31, 0xE0, 0x53, 0x31, 0x53, 0x63, 0x31, 0x53, 0x61, 0xF1, 0x55, 0x57, 0x75, 0x75, 0x55, 
+    0x33, 0x1E, 0xEE, 0x00, 0xEE, 0xE0, 0xFF, 0x01, 0x01, 0xE0, 0x42, 0x00, 0x20, 0xCE, 0x45, 0x05, 
+    0x00, 0xEE, 0x0F, 0xF0, 0x07, 0x43, 0x0A, 0x36, 0x33, 0x20, 0x18, 0x51, 0x30, 0xB1, 0x0D, 0x53, 
+    0x14, 0xE3, 0x55, 0x79, 0x57, 0x75, 0xA3, 0x00, 0xC0, 0x44, 0xFF, 0x03, 0x01, 0xEE, 0x44, 0x0C, 
+    0x0F, 0xFE, 0xE0, 0xE0, 0x0E, 0xEF, 0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xA0, 0x03, 0xFE, 0x26, 0x45, 
+    0x18, 0x3F, 0xE1, 0x51, 0x21, 0x02, 0x23, 0x58, 0x2F, 0x25, 0x55, 0x85, 0x57, 0x50, 0x42, 0x06, 
+    0x2E, 0xE0, 0xE0, 0xE0, 0xFF, 0x02, 0xAE, 0x19, 0x00, 0xF2, 0x22, 0x40, 0x0E, 0xE0, 0x00, 0xEE, 
+    0xEF, 0xFE, 0xEF, 0xEE, 0xFF, 0x46, 0x00, 0xF0, 0xA0, 0x04, 0xF0, 0x16, 0x10, 0xB3, 0x10, 0x51, 
+    0xEE, 0x00, 0xEE, 0xE0, 0x14, 0xA1, 0xEC, 0x30, 0x44, 0x05, 0x85, 0x53, 0x51, 0xA0, 0x00, 0xF0, 
+    0x43, 0x00, 0x00, 0xEF, 0x42, 0x03, 0xEE, 0x22, 0xA1, 0x02, 0x20, 0x00, 0xDE, 0x02, 0xFF, 0x00, 
+    0x4B, 0x07, 0xF0, 0xFF, 0xFE, 0x35, 0x45, 0x1A, 0x51, 0xCE, 0x00, 0x44, 0x00, 0xF0, 0x00, 0x35, 
+    0x53, 0x88, 0x57, 0x73, 0x33, 0x10, 0xB0, 0x02, 0xEF, 0x00, 0x46, 0x01, 0x0F, 0xBE, 0x02, 0x0E, 
+    0xF0, 0xC2, 0x05, 0x11, 0x22, 0x40, 0xBE, 0xAF, 0xF0, 0x00, 0xCF, 0x03, 0x0F, 0xE2, 0x43, 0x04, 
+    0x55, 0x53, 0x10, 0x42, 0xA0, 0x01, 0x16, 0xA5, 0x01, 0x77, 0xA5, 0x1C, 0x33, 0x10, 0xE0, 0x00, 
+    0xEE, 0xF0, 0x0F, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0x45, 0x00, 0x20, 0xC1, 0x00, 
+    0x20, 0xBE, 0x00, 0xF0, 0xF0, 0x02, 0xEF, 0x04, 0xE1, 0x13, 0x30, 0xC5, 0x0B, 0x0F, 0xEE, 0xEF, 
+    0x01, 0x55, 0x33, 0xD5, 0x0A, 0x33, 0x10, 0xEE, 0xE0, 0x0E, 0xF0, 0x43, 0xC0, 0x02, 0xFF, 0xF0, 
+    0xCE, 0xF2, 0x00, 0x43, 0x02, 0x04, 0x00, 0x4B, 0xBF, 0x00, 0x00, 0xBE, 0x18, 0x01, 0x63, 0x55, 
+    0x75, 0x10, 0xE4, 0xF2, 0x40, 0x55, 0x33, 0x55, 0x57, 0x70, 0x42, 0x07, 0x10, 0xE0, 0x00, 0xEE, 
+    0xAF, 0xE0, 0x02, 0xFF, 0xF0, 0xAE, 0x01, 0x00, 0x44, 0x00, 0x10, 0x45, 0x07, 0x11, 0x20, 0x00, 
+    0xEF, 0xB0, 0x00, 0xF0, 0x45, 0x01, 0x0F, 0xDE, 0x07, 0x23, 0x58, 0x87, 0x53, 0xBF, 0x00, 0x40, 
+    0xA5, 0x00, 0x30, 0xD5, 0x00, 0x30, 0xA0, 0xAE, 0xFF, 0x01, 0x02, 0x0F, 0xF0, 0xCE, 0x46, 0xA2, 
+    0xB1, 0x00, 0x30, 0x42, 0x03, 0x00, 0xEF, 0x42, 0x00, 0xF0, 0x43, 0x02, 0x00, 0x00, 0xBE, 0x02, 
+    0xFE, 0x50, 0xB9, 0x07, 0x5E, 0xF0, 0xFF, 0x01, 0x43, 0x01, 0x33, 0xA5, 0x05, 0x60, 0xE0, 0x00, 
+    0xFF, 0x04, 0x02, 0x00, 0xF0, 0xDE, 0x06, 0x00, 0x02, 0x44, 0x40, 0x48, 0x02, 0x12, 0x20, 0xC0, 
+    0x05, 0xEF, 0x00, 0xFF, 0xD0, 0x15, 0xEE, 0xEF, 0xF0, 0x05, 0x99, 0x8A, 0x1E, 0xFF, 0x00, 0xF0, 
+    0xA9, 0x43, 0x0C, 0x16, 0x35, 0x30, 0xE0, 0xEE, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x4A, 
+    0x00, 0x20, 0x45, 0x00, 0x20, 0xC1, 0xD0, 0x01, 0xEE, 0xC0, 0x0A, 0xFF, 0xF0, 0xFF, 0x00, 0xE0, 
+    0x20, 0xA1, 0x02, 0x33, 0xF0, 0xB0, 0x07, 0xFF, 0x19, 0x98, 0x53, 0xA1, 0x08, 0x30, 0xE0, 0xEE, 
+    0xE0, 0xE0, 0x49, 0xAF, 0x4C, 0x00, 0x00, 0x48, 0x04, 0x61, 0x24, 0x00, 0xAE, 0x02, 0xFF, 0xE0, 
+    0xBF, 0x06, 0xEF, 0x00, 0x0E, 0x20, 0xC1, 0x05, 0x04, 0x2E, 0x0F, 0xA0, 0x0C, 0x23, 0x89, 0x98, 
+    0x31, 0x51, 0x10, 0xE0, 0x42, 0xA0, 0xFF, 0x03, 0xFE, 0x00, 0x05, 0x00, 0xE2, 0x22, 0x4A, 0xA1, 
+    0x04, 0x0E, 0xE0, 0x00, 0x44, 0x02, 0x0F, 0xF0, 0xA0, 0x07, 0xF0, 0x42, 0x20, 0x11, 0xAE, 0x00, 
+    0xF0, 0xA0, 0x02, 0x25, 0x80, 0xA9, 0x0C, 0x81, 0x0E, 0x4E, 0xEF, 0xFE, 0xF0, 0xE0, 0x4B, 0xFE, 
+    0x01, 0x02, 0x00, 0x00, 0x44, 0x06, 0x12, 0x21, 0x11, 0x20, 0xC1, 0xA2, 0x05, 0xEF, 0xF0, 0x0F, 
+    0xC0, 0xAF, 0x1B, 0x04, 0x04, 0x20, 0xEE, 0xE0, 0xEF, 0x00, 0xE1, 0x88, 0x99, 0x88, 0x85, 0xE0, 
+    0xE0, 0xDF, 0x45, 0x04, 0xEE, 0xFF, 0xF0, 0xFE, 0x01, 0xA0, 0x43, 0x02, 0x41, 0x10, 0x42, 0xE1, 
+    0x05, 0x22, 0x44, 0x0E, 0xFF, 0x02, 0x05, 0xEF, 0x02, 0x42, 0xBE, 0x07, 0x0E, 0xFF, 0xF2, 0x55, 
+    0xA8, 0x02, 0x75, 0x20, 0xF0, 0x00, 0x04, 0xF0, 0x0F, 0x00, 0xCF, 0xDE, 0x03, 0x4E, 0xEF, 0xAE, 
+    0x46, 0x00, 0x20, 0xF1, 0x05, 0x06, 0x20, 0x00, 0xEE, 0x00, 0x48, 0x10, 0x42, 0x42, 0x0E, 0x00, 
+    0x0E, 0x40, 0x04, 0xF3, 0x80, 0xA5, 0x05, 0x75, 0x5E, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0xCE, 0x09, 
+    0x04, 0x22, 0x44, 0x42, 0x4E, 0x53, 0x00, 0x20, 0xBE, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xAE, 0x18, 
+    0x40, 0x2E, 0xEE, 0x04, 0x0E, 0x22, 0x0E, 0xF1, 0x56, 0x33, 0x13, 0x53, 0x10, 0xF0, 0x02, 0x04, 
+    0xFF, 0xEE, 0xF0, 0xFE, 0x02, 0x00, 0x00, 0xF2, 0x02, 0x00, 0x40, 0x42, 0x00, 0x20, 0xF1, 0x03, 
+    0x2A, 0xEE, 0xE4, 0x4E, 0xEE, 0xF0, 0xFF, 0xFE, 0xEE, 0x4E, 0x4F, 0xFE, 0xFE, 0x00, 0xF0, 0x20, 
+    0x0F, 0xF2, 0x21, 0x12, 0x11, 0x33, 0x20, 0xE0, 0x06, 0xF0, 0x0F, 0xEE, 0x00, 0x4A, 0x03, 0xEE, 
+    0x00, 0xC2, 0x03, 0x44, 0x42, 0x42, 0x01, 0x22, 0xF1, 0x01, 0x08, 0x00, 0x11, 0x2E, 0xEF, 0x00, 
+    0xAF, 0x00, 0xE0, 0xA4, 0x0A, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xAF, 0x09, 0x42, 0x4F, 0xE2, 
+    0x11, 0x61, 0xB0, 0x02, 0xF0, 0x00, 0xAF, 0x46, 0x03, 0x4E, 0x44, 0xAE, 0x02, 0x00, 0x40, 0xC2, 
+    0x04, 0x04, 0x42, 0x40, 0xB2, 0xF1, 0x06, 0x07, 0xFE, 0xEF, 0xFF, 0xEE, 0xB4, 0xB0, 0x14, 0xEF, 
+    0x0F, 0xEF, 0x0F, 0xFF, 0xE0, 0xE0, 0x0E, 0xE2, 0x12, 0xF0, 0xD0, 0x00, 0xF0, 0xFE, 0x03, 0xD4, 
+    0x47, 0x0A, 0x44, 0x42, 0x24, 0x40, 0x22, 0x20, 0xF1, 0x05, 0x00, 0x20, 0xAE, 0x0E, 0xFE, 0x44, 
+    0xD4, 0x4F, 0x0F, 0x00, 0x0F, 0xE0, 0xB0, 0x42, 0x00, 0xF0, 0xB0, 0x05, 0xE4, 0x24, 0xFF, 0xA0, 
+    0x00, 0xF0, 0xFE, 0x01, 0x05, 0x44, 0xE2, 0x11, 0xF2, 0x0A, 0x02, 0x40, 0x40, 0x4E, 0x0D, 0x10, 
+    0x44, 0xEE, 0xE4, 0xBB, 0x4E, 0x0F, 0x43, 0x00, 0xF0, 0x46, 0x09, 0xF0, 0x00, 0xF0, 0x00, 0xE4, 
+    0x49, 0x01, 0x00, 0xA4, 0x01, 0xEE, 0x43, 0xA1, 0x52, 0x00, 0x20, 0xF1, 0x06, 0x0B, 0x20, 0xE4, 
+    0x42, 0x1A, 0x14, 0x00, 0x49, 0xC0, 0x02, 0xFE, 0xF0, 0xA0, 0x03, 0xEF, 0x00, 0xAF, 0xAE, 0x03, 
+    0x00, 0x44, 0xAE, 0x02, 0x40, 0x20, 0x4C, 0x00, 0x00, 0xC2, 0x02, 0x44, 0x40, 0x4F, 0x03, 0x12, 
+    0x22, 0xA1, 0x00, 0x60, 0xC0, 0x00, 0xF0, 0x4B, 0x01, 0x44, 0x42, 0x01, 0xEE, 0xDF, 0x07, 0xEE, 
+    0xE0, 0x4E, 0x21, 0xB4, 0x45, 0x00, 0x10, 0x47, 0x02, 0x42, 0x40, 0x42, 0x04, 0x00, 0x22, 0x20, 
+    0xF1, 0x0C, 0x01, 0x33, 0x46, 0xF0, 0x03, 0x05, 0x13, 0x20, 0x00, 0xDF, 0xAE, 0x0D, 0x04, 0x22, 
+    0x13, 0xA1, 0x22, 0x24, 0x22, 0x4C, 0x09, 0x00, 0x02, 0x24, 0x00, 0x04, 0x54, 0x05, 0x35, 0x10, 
+    0xFF, 0x4F, 0x06, 0x27, 0x1E, 0x00, 0x00, 0xFE, 0x01, 0x05, 0x00, 0x41, 0x11, 0x43, 0xA2, 0x00, 
+    0x10, 0xF2, 0x02, 0x44, 0x03, 0x20, 0x00, 0xA2, 0xF1, 0x0A, 0x02, 0x61, 0xE0, 0x43, 0x00, 0xF0, 
+    0x4C, 0x02, 0xE3, 0x30, 0x43, 0xD4, 0x0E, 0xEE, 0xE0, 0x42, 0x13, 0x13, 0x11, 0x12, 0x40, 0xF2, 
+    0x05, 0x03, 0x00, 0x04, 0xF2, 0x02, 0xF1, 0x0A, 0x0A, 0x20, 0xFF, 0xF0, 0xFF, 0xFE, 0xF0, 0xF0, 
+    0x00, 0x09, 0xFE, 0x01, 0x71, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x42, 0x06, 0x13, 0x66, 0x11, 
+    0x10, 0xF2, 0x06, 0x50, 0x00, 0x20, 0xF1, 0x06, 0x03, 0xEE, 0x0E, 0xCF, 0x00, 0xE0, 0xE0, 0x06, 
+    0xFE, 0xEE, 0x45, 0x50, 0xA0, 0x01, 0x42, 0xF4, 0x01, 0x03, 0x21, 0x11, 0x55, 0x04, 0x04, 0x22, 
+    0x40, 0xF2, 0x02, 0xF1, 0x05, 0x0C, 0x2F, 0xFE, 0xFF, 0x0F, 0xFF, 0xEF, 0xF0, 0xB0, 0xDE, 0x06, 
+    0x55, 0xF0, 0x00, 0x10, 0x42, 0x02, 0xBB, 0x20, 0x43, 0x00, 0x20, 0xA1, 0x01, 0x66, 0x51, 0x05, 
+    0x44, 0x22, 0x04, 0xF2, 0x02, 0xF1, 0x03, 0x00, 0x20, 0xD0, 0x05, 0xFF, 0xEE, 0xFE, 0xA0, 0x03, 
+    0x44, 0xE0, 0x44, 0x00, 0x10, 0x42, 0x09, 0xA4, 0x22, 0xBB, 0x12, 0x42, 0x45, 0x03, 0x16, 0x11, 
+    0xF2, 0x02, 0x01, 0x44, 0x44, 0x04, 0x42, 0x40, 0x40, 0xC2, 0x00, 0x10, 0x4C, 0x00, 0x20, 0x4C, 
+    0x07, 0xF0, 0xF4, 0x4E, 0x44, 0xAE, 0x15, 0x37, 0x51, 0x00, 0x03, 0xA1, 0xAB, 0xB3, 0xA2, 0x11, 
+    0x22, 0x12, 0xD1, 0xE2, 0x0E, 0x04, 0x00, 0x40, 0x04, 0x00, 0x02, 0x20, 0x00, 0xB2, 0x03, 0x02, 
+    0x11, 0x4C, 0x02, 0xE0, 0xF0, 0xB0, 0x43, 0x06, 0xEE, 0xE0, 0xEE, 0x40, 0xBE, 0x06, 0x37, 0x75, 
+    0x00, 0xE0, 0xB3, 0x05, 0x13, 0x53, 0x33, 0xF1, 0x00, 0xE2, 0x00, 0x40, 0xF0, 0x04, 0x03, 0x22, 
+    0x04, 0x45, 0x00, 0x20, 0xD1, 0xA2, 0x08, 0x11, 0x20, 0xFE, 0xFF, 0xF0, 0x43, 0xCE, 0x02, 0x00, 
+    0x00, 0x45, 0x05, 0x58, 0x60, 0x01, 0x43, 0x08, 0x13, 0x61, 0x33, 0x63, 0x30, 0x4B, 0xC0, 0x00, 
+    0xE0, 0xE0, 0x01, 0x22, 0x43, 0x02, 0x40, 0x20, 0x44, 0x10, 0x20, 0xEE, 0xE0, 0x21, 0x00, 0xFF, 
+    0xEE, 0x00, 0x00, 0xDE, 0x05, 0xFE, 0xEE, 0x0E, 0xAF, 0x0F, 0x17, 0x55, 0x3F, 0x00, 0x33, 0x36, 
+    0x11, 0x63, 0xA1, 0x02, 0x63, 0x60, 0x47, 0x04, 0x44, 0x00, 0x00, 0xBE, 0x48, 0x00, 0x00, 0xB2, 
+    0x13, 0x00, 0x02, 0x12, 0x12, 0x00, 0x22, 0x00, 0x02, 0xE0, 0x0F, 0xA0, 0x00, 0xF0, 0xCE, 0x07, 
+    0xFF, 0xE0, 0x00, 0xEF, 0xAE, 0x07, 0x57, 0x55, 0x00, 0x06, 0xA3, 0x03, 0x11, 0x33, 0x42, 0x00, 
+    0x60, 0xA1, 0xB2, 0x00, 0x40, 0xA0, 0xCE, 0x4E, 0x10, 0x20, 0x00, 0x12, 0x22, 0xE1, 0x61, 0x12, 
+    0x00, 0xF0, 0x42, 0x06, 0xF0, 0x0E, 0x0E, 0xF0, 0xDE, 0x00, 0x00, 0xAE, 0x02, 0x00, 0x10, 0xA5, 
+    0x07, 0x2F, 0x01, 0x53, 0x36, 0xC1, 0x02, 0x63, 0x30, 0x46, 0x04, 0x40, 0xE0, 0x00, 0xDE, 0xF0, 
+    0x00, 0xF2, 0x00, 0x06, 0x40, 0x21, 0x10, 0x00, 0xB1, 0x02, 0x0F, 0x00, 0x42, 0x01, 0x00, 0xAE, 
+    0x0E, 0xFF, 0xEE, 0x00, 0xE0, 0x2F, 0x00, 0x02, 0x40, 0x43, 0x07, 0x0F, 0xF0, 0x53, 0x53, 0xC1, 
+    0x01, 0x36, 0xA1, 0x08, 0x22, 0x44, 0x40, 0xEE, 0x00, 0xEE, 0xF0, 0x00, 0x00, 0x40, 0xF2, 0x01, 
+    0x04, 0x01, 0x1E, 0x20, 0x44, 0xC0, 0x00, 0xF0, 0xBE, 0x0F, 0xFF, 0xFE, 0x0E, 0xE2, 0x00, 0x02, 
+    0x42, 0x23, 0xA5, 0x08, 0xE0, 0x0F, 0x13, 0x33, 0x60, 0x4C, 0x02, 0x00, 0x00, 0xFE, 0x02, 0xF0, 
+    0x02, 0x00, 0x40, 0xD2, 0x03, 0x11, 0x22, 0x44, 0x01, 0x2F, 0xC0, 0x04, 0xEE, 0xE0, 0xE0, 0xAF, 
+    0x14, 0xE0, 0xE0, 0x4E, 0x00, 0x22, 0x02, 0x57, 0x53, 0x3E, 0x1E, 0x00, 0x42, 0x00, 0x30, 0xA1, 
+    0x01, 0x63, 0xB1, 0x42, 0xFE, 0x02, 0x01, 0xFF, 0xF0, 0x01, 0x01, 0xE0, 0xF2, 0x01, 0x01, 0x40, 
+    0xA1, 0x01, 0x4E, 0x44, 0x04, 0xFF, 0xEE, 0x00, 0xAF, 0x07, 0xEE, 0x0E, 0xE0, 0x0F, 0x42, 0x09, 
+    0x15, 0x77, 0x53, 0x25, 0x1F, 0xB3, 0xA1, 0x09, 0x31, 0x12, 0x11, 0x22, 0x20, 0xFE, 0x03, 0x4B, 
+    0x12, 0xE0, 0x04, 0x22, 0x42, 0x12, 0x22, 0x02, 0x11, 0x0E, 0xF0, 0x43, 0x05, 0xFE, 0xE0, 0xEE, 
+    0x44, 0x0A, 0xEE, 0x0E, 0xFE, 0xE2, 0x22, 0x30, 0xD5, 0x0B, 0x31, 0x53, 0x36, 0x61, 0x11, 0x31, 
+    0xD2, 0x00, 0x40, 0x46, 0x04, 0xFF, 0xEE, 0xF0, 0x46, 0x01, 0xEE, 0xF0, 0x02, 0xA2, 0x05, 0x42, 
+    0x2E, 0xEF, 0x44, 0x02, 0xEE, 0x00, 0x46, 0x05, 0x00, 0x04, 0xFE, 0x46, 0x09, 0x33, 0x36, 0x35, 
+    0x53, 0x36, 0xB1, 0x00, 0x30, 0xE2, 0x00, 0x00, 0xEE, 0xDF, 0xA0, 0xAE, 0xA0, 0x18, 0x22, 0x0E, 
+    0xE0, 0x00, 0x22, 0x40, 0x0E, 0xEE, 0xF0, 0x0F, 0xFF, 0xEE, 0x00, 0x45, 0x0A, 0xEE, 0x00, 0x20, 
+    0xE0, 0xF0, 0x40, 0x44, 0x07, 0x66, 0x11, 0x63, 0x61, 0x44, 0x08, 0x12, 0x22, 0x44, 0x22, 0x40, 
+    0x44, 0xDF, 0x08, 0x0F, 0xFE, 0xE0, 0xEE, 0xE0, 0xD0, 0x05, 0x24, 0x0E, 0xEE, 0xA0, 0x02, 0xEE, 
+    0xE0, 0xAF, 0xAE, 0xA0, 0x04, 0xE0, 0xEE, 0xE0, 0x42, 0x09, 0x44, 0x0E, 0xFF, 0x00, 0x22, 0xB3, 
+    0x02, 0x61, 0x10, 0xA2, 0xB1, 0xB2, 0xB0, 0xCE, 0xBF, 0x04, 0x00, 0x0E, 0xF0, 0xAE, 0xF0, 0x00, 
+    0x00, 0x20, 0xA0, 0x02, 0xEE, 0x00, 0xFE, 0x03, 0xA0, 0x00, 0xE0, 0x43, 0x0B, 0xEE, 0x04, 0x42, 
+    0x0F, 0x00, 0x0E, 0x45, 0x03, 0x33, 0x31, 0xA2, 0x03, 0x11, 0x20, 0xA2, 0x04, 0x4E, 0xE0, 0x00, 
+    0xCE, 0xBF, 0xA0, 0x01, 0xEF, 
+};
+
+const gfx_image_t STORY_CH9_ENEMY_IMG = {
+    .w = STORY_CH9_ENEMY_W, .h = STORY_CH9_ENEMY_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_CH9_ENEMY_PAL, .colors = STORY_CH9_ENEMY_PAL_SIZE,
+    .data = STORY_CH9_ENEMY_RLE, .size = STORY_CH9_ENEMY_RLE_SIZE,
 };
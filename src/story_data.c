@@ -1,22 +0,0 @@
-/*==============================================================================
- * @file    story_data.c
- * @brief   Story chapter metadata: titles, enemy names, and thresholds.
- *
- * Defines the `g_story` table used by Story mode to label chapters and set
- * baseline enemy Hz thresholds.
- *============================================================================*/
-
-#include "story_data.h"
-
-const story_chapter_t g_story[STORY_CHAPTERS] = {
-  {"Ch.1: Awakening",        "Scarecrow",     0},
-{"Ch.2: Training Grounds",     "Dummy",         15}, //15
-  {"Ch.3: Catacombs",        "Rat King",      30}, //30
-  {"Ch.4: Ambush Road",      "Bandit",        45}, //45
-  {"Ch.5: Tourney Field",    "Knight",        60}, //60
-  {"Ch.6: Grand Arena",      "Champion",      75}, //75
-  {"Ch.7: Arcane Tower",     "Sorcerer",      90}, //90
-  {"Ch.8: Dragon’s Lair",    "Dragon",       100}, //110
-  {"Ch.9: Demon Castle",       "Demon King",    130}, //130
-  {"Ch.10: G?ME? AD??N",     "H?: 99999999999999999999999999",   1} //1
-};
@@ -6,321 +6,230 @@ const uint16_t STORY_FINAL_SCENE_PAL[STORY_FINAL_SCENE_PAL_SIZE] = {
     0x95B9, 0x9535, 0x6E5D, 0x5B2C, 0x5392, 0x198A, 0x324C, 0x9CEB, 
 };
 
-const uint8_t STORY_FINAL_SCENE_IDX[(STORY_FINAL_SCENE_W * STORY_FINAL_SCENE_H) / 2] = {
-    0x33, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x35, 0x55, 0x55, 0x52, 0x22, 0x22, 0x33, 0x33, 
-    0x35, 0x55, 0x53, 0x24, 0x4C, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 
-    0x33, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x33, 
-    0x33, 0x33, 0x32, 0x22, 0x2A, 0x10, 0x11, 0xAA, 0xAA, 0x44, 0x22, 0x10, 0xAA, 0xAA, 0x00, 0x22, 
-    0x33, 0x33, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 0x55, 0x32, 0x22, 0x25, 0x55, 0x33, 
-    0x35, 0x53, 0x22, 0xA0, 0x00, 0x70, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 
-    0x35, 0x53, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x35, 
-    0x33, 0x33, 0x33, 0x24, 0x11, 0x11, 0x11, 0x44, 0xAA, 0xA2, 0x22, 0xA0, 0x10, 0xAA, 0x00, 0x22, 
-    0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x53, 0x22, 0x23, 0x55, 0x55, 0x33, 
-    0x35, 0x53, 0x22, 0x40, 0x00, 0x75, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x33, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 
-    0x33, 0x35, 0x33, 0x40, 0x0A, 0x4A, 0xAA, 0x22, 0x24, 0x22, 0x22, 0x21, 0xA2, 0x00, 0x00, 0x22, 
-    0x33, 0x32, 0x20, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x32, 0x22, 0x25, 0x55, 0x55, 0x55, 
-    0x35, 0x53, 0x22, 0x40, 0x00, 0x75, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x55, 0x35, 
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 
-    0x22, 0x32, 0x24, 0x81, 0xA2, 0x24, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 0x20, 0x00, 0x22, 
-    0x33, 0x32, 0x22, 0xA0, 0xA4, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x35, 0x55, 0x55, 0x55, 
-    0x55, 0x53, 0x22, 0x40, 0x00, 0x70, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 
-    0x50, 0x00, 0x55, 0x55, 0x33, 0x33, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 
-    0x24, 0x10, 0x00, 0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x22, 
-    0x33, 0x32, 0x22, 0x2A, 0x11, 0x42, 0x22, 0x23, 0x32, 0x22, 0x22, 0x22, 0x35, 0x55, 0x55, 0x55, 
-    0x05, 0x53, 0x22, 0x40, 0x00, 0x40, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x50, 0x55, 0x55, 0x55, 
-    0x50, 0x00, 0x55, 0x55, 0x33, 0x33, 0x35, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x21, 
-    0x10, 0x1A, 0x42, 0x22, 0x22, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x00, 0x22, 
-    0x33, 0x32, 0x22, 0x2A, 0x11, 0x04, 0x22, 0x22, 0x23, 0x22, 0x22, 0x23, 0x35, 0x55, 0x55, 0x55, 
-    0x05, 0x05, 0x22, 0x40, 0x00, 0x45, 0x33, 0x33, 0x33, 0x22, 0x24, 0x33, 0x33, 0x55, 0x55, 0x55, 
-    0x50, 0x00, 0x54, 0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 0x34, 0x11, 
-    0x44, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x4A, 0x22, 
-    0x33, 0x22, 0x22, 0xAA, 0x1A, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x50, 
-    0x55, 0x05, 0x22, 0x40, 0x00, 0x45, 0x33, 0x33, 0x33, 0x22, 0xA0, 0x43, 0x35, 0x33, 0x33, 0x55, 
-    0x50, 0x00, 0x54, 0x55, 0x33, 0x33, 0x35, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x32, 0x42, 0x33, 
-    0x33, 0x33, 0x22, 0x22, 0x22, 0x23, 0x33, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x41, 0xA2, 
-    0x32, 0x22, 0x22, 0xA0, 0xAA, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x55, 
-    0x50, 0x05, 0x22, 0x40, 0x00, 0x45, 0x33, 0x33, 0x32, 0x22, 0xA0, 0x43, 0x50, 0x53, 0x33, 0x35, 
-    0x55, 0x55, 0x55, 0x55, 0x33, 0x33, 0x35, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x32, 0x22, 0x22, 0x23, 0x32, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2A, 0x42, 
-    0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x33, 0x23, 0x33, 0x33, 
-    0x50, 0x05, 0x22, 0x40, 0x00, 0x75, 0x33, 0x33, 0x32, 0x22, 0xA0, 0x45, 0x55, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x41, 0x33, 0x33, 0x22, 0x22, 0x23, 0x32, 0x23, 0x22, 0x22, 0x22, 0x24, 0x41, 0x12, 0x22, 0x22, 
-    0x22, 0x22, 0x2A, 0x2A, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 
-    0x33, 0x55, 0x22, 0x40, 0x00, 0x70, 0x33, 0x33, 0x22, 0x22, 0xA0, 0x40, 0x53, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x55, 0x55, 0x53, 0x33, 0x33, 0x33, 0x33, 
-    0x35, 0x33, 0x33, 0x22, 0x22, 0x23, 0x33, 0x33, 0x22, 0x22, 0x22, 0x20, 0x01, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 
-    0x33, 0x33, 0x22, 0x40, 0x00, 0x70, 0x33, 0x33, 0x33, 0x22, 0x10, 0x40, 0x33, 0x33, 0x33, 0x33, 
-    0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x35, 0x55, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x35, 0x11, 0x53, 0x32, 0x22, 0x23, 0x33, 0x33, 0x22, 0x24, 0x42, 0xA1, 0x42, 0x22, 0x22, 0x22, 
-    0x22, 0x21, 0x0A, 0x2A, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x33, 0x33, 0x22, 0x40, 0x00, 0x40, 0x33, 0x33, 0x55, 0x32, 0x10, 0x43, 0x33, 0x33, 0x23, 0x33, 
-    0x32, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x24, 0x23, 0x33, 0x22, 0x33, 0x33, 0x33, 0x22, 0x40, 0x00, 0x01, 0xA2, 0x22, 0x22, 0x22, 
-    0x22, 0x2A, 0x40, 0xAA, 0xAA, 0x22, 0x22, 0x4A, 0xA2, 0x22, 0x22, 0x22, 0x33, 0x22, 0x22, 0x41, 
-    0x22, 0x33, 0x22, 0x40, 0x00, 0x70, 0x33, 0x35, 0x55, 0x32, 0x10, 0x43, 0x33, 0x32, 0x22, 0x22, 
-    0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x32, 0x22, 0x22, 0x23, 0x22, 0x33, 0x22, 0x10, 0x14, 0x44, 0x22, 0x22, 0x22, 0x20, 
-    0x22, 0x22, 0x22, 0xA2, 0x22, 0x22, 0x22, 0x4A, 0xAA, 0x22, 0x33, 0x33, 0x33, 0x33, 0x23, 0x40, 
-    0x33, 0x33, 0x22, 0xA0, 0x00, 0xC0, 0x50, 0x00, 0x33, 0x32, 0x10, 0x43, 0x33, 0x22, 0x22, 0x22, 
-    0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x32, 0x22, 0x23, 0x22, 0x22, 0x24, 0x14, 0x22, 0x22, 0x14, 0x22, 0x22, 0x20, 
-    0xA4, 0x22, 0x22, 0x22, 0x22, 0x52, 0x22, 0xA1, 0x11, 0xAA, 0x42, 0x33, 0x33, 0x33, 0x23, 0x40, 
-    0x33, 0x33, 0x22, 0x10, 0x00, 0xC0, 0x00, 0x00, 0x33, 0x32, 0x10, 0x45, 0x33, 0x32, 0x22, 0x22, 
-    0x23, 0x33, 0x32, 0x22, 0x33, 0x2A, 0xA2, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x32, 0x23, 0x33, 
-    0x33, 0x33, 0x33, 0x32, 0x22, 0xAA, 0x22, 0x4A, 0x41, 0x42, 0x22, 0x24, 0x04, 0x22, 0x22, 0x20, 
-    0x4A, 0x22, 0x22, 0x22, 0x44, 0x44, 0x10, 0x00, 0x11, 0x10, 0x00, 0x12, 0x33, 0x33, 0x33, 0x41, 
-    0x23, 0x22, 0x22, 0x10, 0x00, 0x40, 0x30, 0x00, 0x33, 0x32, 0xA0, 0x43, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x22, 0x22, 0x21, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x23, 0x33, 0x42, 0x22, 0xA1, 0x14, 0x22, 0x42, 0x22, 0x22, 0x24, 0x04, 0x22, 0x22, 0x2A, 
-    0x24, 0x42, 0x4A, 0x44, 0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x53, 0x35, 0x40, 
-    0x22, 0x23, 0x22, 0x10, 0x00, 0x70, 0x50, 0x00, 0x03, 0x32, 0xA0, 0x42, 0x33, 0x22, 0x33, 0x33, 
-    0x32, 0x22, 0x22, 0x24, 0x11, 0xA4, 0x22, 0x22, 0x23, 0x32, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x22, 0x4A, 0x11, 0x42, 0x22, 0x22, 0x24, 0x24, 0x04, 0x22, 0x22, 0x2A, 
-    0x42, 0x22, 0x4A, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x53, 0x33, 0x41, 
-    0x22, 0x22, 0x22, 0x10, 0x00, 0xC0, 0x00, 0x00, 0x05, 0x32, 0x10, 0xA2, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x40, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x33, 0x32, 0x23, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x41, 0xA4, 0x22, 0x22, 0x44, 0x44, 0x04, 0x22, 0x22, 0x24, 
-    0x42, 0x24, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x25, 0x53, 0x40, 
-    0x52, 0x22, 0x42, 0x10, 0x00, 0x70, 0x50, 0x00, 0x33, 0x32, 0xA0, 0xA2, 0x21, 0xAA, 0x22, 0x22, 
-    0x24, 0xAA, 0x44, 0x00, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x4A, 0xA4, 0x42, 0x24, 0x44, 0x04, 0x24, 0x22, 0x24, 
-    0x42, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x55, 0x40, 
-    0x53, 0x22, 0xAA, 0x10, 0x00, 0x40, 0x53, 0x55, 0x33, 0x32, 0x10, 0xA2, 0xA1, 0x4A, 0xAA, 0x1A, 
-    0x42, 0x41, 0x10, 0x01, 0xA4, 0x42, 0x22, 0x33, 0x32, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x24, 0x10, 0x14, 0x42, 0x40, 0x0A, 0x2A, 0xA4, 0x24, 
-    0xA4, 0x44, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x35, 0x40, 
-    0x53, 0x32, 0xA1, 0x10, 0x00, 0x43, 0x55, 0x53, 0x33, 0x32, 0x80, 0xA2, 0x22, 0xA2, 0x22, 0x41, 
-    0x4A, 0xA1, 0x00, 0x1A, 0x44, 0xA2, 0x22, 0x23, 0x33, 0x33, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x41, 0x10, 0x00, 0x01, 0x00, 0x01, 0xA4, 0x4A, 0xA1, 
-    0x44, 0x11, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x35, 0x40, 
-    0x53, 0x34, 0x11, 0x10, 0x00, 0x42, 0x44, 0x42, 0x33, 0x32, 0x10, 0x12, 0x22, 0x2A, 0x24, 0x11, 
-    0x44, 0x10, 0x01, 0xA2, 0x44, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 
-    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 
-    0x14, 0x41, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x25, 0x41, 
-    0x03, 0x32, 0x11, 0x00, 0x00, 0x84, 0x11, 0x14, 0x22, 0x32, 0x10, 0x14, 0x22, 0x22, 0x21, 0x11, 
-    0xA4, 0x10, 0x00, 0x11, 0xA2, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x32, 0x33, 0x23, 0x32, 0x22, 0x22, 0x4A, 0x11, 0x10, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 
-    0x11, 0x18, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0x25, 0x41, 
-    0x22, 0x34, 0x11, 0x00, 0x00, 0x44, 0x14, 0x44, 0x23, 0x32, 0x10, 0x11, 0xA2, 0x42, 0x24, 0x42, 
-    0x10, 0x00, 0x00, 0x10, 0x1A, 0x22, 0x12, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 
-    0x33, 0x23, 0x33, 0x23, 0x33, 0x23, 0x23, 0x32, 0xA1, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x00, 
-    0x11, 0x11, 0x41, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x35, 0x41, 
-    0x22, 0x24, 0x11, 0x10, 0x00, 0x44, 0x14, 0x44, 0x42, 0x22, 0xA1, 0x11, 0x1A, 0xAA, 0x22, 0x22, 
-    0x10, 0x00, 0x01, 0x11, 0x11, 0xA2, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 
-    0x22, 0x22, 0x33, 0x33, 0x32, 0x22, 0x23, 0x22, 0x41, 0x11, 0x01, 0x11, 0x00, 0x11, 0x11, 0x11, 
-    0x14, 0x44, 0x48, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x23, 0x41, 
-    0x22, 0x24, 0x11, 0x10, 0x00, 0x8A, 0x14, 0x44, 0x4A, 0x11, 0x11, 0x44, 0x44, 0x44, 0x42, 0x24, 
-    0x10, 0x01, 0x11, 0x11, 0x1A, 0x44, 0x22, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 
-    0x22, 0x22, 0x22, 0x33, 0x22, 0x22, 0x22, 0x24, 0xA1, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x18, 0x77, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 
-    0x32, 0x41, 0x11, 0x10, 0x00, 0x84, 0x41, 0x11, 0x11, 0x00, 0x00, 0x12, 0x22, 0x22, 0xAA, 0x44, 
-    0x11, 0x11, 0x11, 0x11, 0x1A, 0x44, 0x22, 0x22, 0x23, 0x33, 0x22, 0x22, 0x22, 0x22, 0x44, 0x14, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x11, 0x00, 0x00, 0x01, 0x11, 0x1A, 0xA1, 0x11, 
-    0x00, 0x84, 0x44, 0x11, 0x11, 0x18, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 
-    0x44, 0x11, 0x11, 0x10, 0x00, 0x42, 0x48, 0x84, 0x54, 0x41, 0x00, 0x01, 0x43, 0x22, 0x4A, 0x4A, 
-    0x1A, 0xA1, 0x11, 0x14, 0x1A, 0x44, 0x22, 0x22, 0x22, 0x22, 0x32, 0x22, 0x22, 0x22, 0x41, 0x11, 
-    0x22, 0x22, 0x22, 0x42, 0x44, 0x4A, 0x42, 0x24, 0x11, 0x00, 0x00, 0x00, 0x11, 0x14, 0x41, 0x11, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x14, 
-    0x41, 0x11, 0x11, 0x10, 0x00, 0x84, 0x44, 0x81, 0x11, 0x10, 0x00, 0x00, 0x04, 0x44, 0x42, 0x4A, 
-    0xAA, 0x44, 0x11, 0x44, 0xAA, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x11, 
-    0x42, 0x22, 0x22, 0x22, 0x44, 0x41, 0x14, 0x4A, 0x11, 0x10, 0x00, 0x00, 0x11, 0x84, 0x41, 0x44, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x14, 
-    0x24, 0x11, 0x01, 0x00, 0x00, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x44, 0x41, 
-    0x11, 0x44, 0x11, 0xAA, 0x44, 0x22, 0x24, 0x42, 0x22, 0x22, 0x22, 0x22, 0x24, 0x42, 0x21, 0x00, 
-    0x12, 0x22, 0x22, 0x22, 0x22, 0x2A, 0xA4, 0xAA, 0x11, 0x48, 0x00, 0x00, 0x01, 0xA4, 0x2A, 0xA4, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x14, 
-    0x24, 0x41, 0x11, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x44, 0x11, 
-    0x11, 0x44, 0x4A, 0xA4, 0x44, 0x42, 0x21, 0x11, 0x44, 0x44, 0x44, 0x44, 0x22, 0x44, 0x41, 0x00, 
-    0x14, 0x22, 0x22, 0x22, 0x42, 0x2A, 0xA4, 0x44, 0x44, 0x11, 0x11, 0x11, 0x04, 0x42, 0x22, 0x4A, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x44, 
-    0x44, 0x41, 0x11, 0x10, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1A, 0x44, 0x11, 
-    0x44, 0x44, 0x44, 0xA4, 0x42, 0x22, 0x2A, 0x11, 0x11, 0xA4, 0x42, 0x22, 0x22, 0x44, 0x00, 0x00, 
-    0x00, 0x43, 0x22, 0x22, 0x22, 0x41, 0xA2, 0x44, 0x44, 0x10, 0x00, 0x11, 0x1A, 0x44, 0x22, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 
-    0x44, 0xA1, 0x11, 0x10, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x24, 0x11, 
-    0x44, 0x44, 0x44, 0x44, 0x22, 0x22, 0x22, 0xA1, 0x11, 0x42, 0x22, 0x22, 0x22, 0x40, 0x00, 0x00, 
-    0x01, 0x15, 0x33, 0x32, 0x22, 0x2A, 0xA4, 0x14, 0x21, 0x00, 0x00, 0x01, 0x1A, 0xA4, 0x22, 0x24, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 
-    0x44, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x44, 0x11, 
-    0xAA, 0xAA, 0x44, 0x44, 0x22, 0x22, 0x22, 0x22, 0x44, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 
-    0x08, 0x14, 0x33, 0x24, 0x42, 0x4A, 0x11, 0x14, 0x10, 0x00, 0x00, 0x00, 0x11, 0x44, 0x24, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 
-    0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x44, 0x44, 
-    0x44, 0xA1, 0xA4, 0xAA, 0xA4, 0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x08, 
-    0x77, 0x74, 0x23, 0x22, 0x44, 0x4A, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xA0, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 
-    0x41, 0x44, 0x41, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44, 0x44, 0x44, 
-    0x44, 0xA1, 0x11, 0x11, 0x10, 0x01, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x01, 0x11, 
-    0x00, 0x01, 0x42, 0x41, 0x11, 0x11, 0x11, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x11, 0x10, 
-    0x14, 0x44, 0x4A, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x41, 0x11, 0x44, 
-    0xAA, 0x11, 0x11, 0x10, 0x11, 0x11, 0x42, 0x22, 0x22, 0x22, 0x22, 0x24, 0x00, 0x00, 0x00, 0x01, 
-    0x9C, 0xC7, 0x44, 0x41, 0x01, 0xA4, 0x44, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x00, 0x11, 0x00, 
-    0x14, 0x44, 0x44, 0x48, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x01, 
-    0x41, 0x00, 0x00, 0x00, 0x00, 0x11, 0x42, 0x22, 0x24, 0x42, 0x24, 0x40, 0x00, 0x00, 0x01, 0x9B, 
-    0xBE, 0xE7, 0x7C, 0x44, 0x42, 0x22, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x88, 0x84, 0x44, 0x41, 0x11, 0x44, 0x11, 0x11, 0x00, 
-    0x14, 0x44, 0xAA, 0x48, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x44, 0x24, 0x41, 0x11, 0x00, 0x00, 0x00, 0x18, 0x10, 
-    0x00, 0xEB, 0xEB, 0x72, 0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x98, 0x88, 0x11, 0x11, 0x9B, 0x10, 0x01, 0x84, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x18, 0x10, 
-    0x14, 0x44, 0x44, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x9B, 0xBB, 0xB8, 0x14, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x81, 0x18, 0x88, 0x88, 0x1C, 0xB1, 0x01, 0x44, 0x74, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 
-    0x14, 0x41, 0x14, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x14, 0x48, 0x10, 0x00, 0x01, 
-    0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x44, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 
-    0x9B, 0xFB, 0xB0, 0x09, 0x99, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 
-    0x88, 0x18, 0x11, 0x88, 0x81, 0xEB, 0x00, 0x18, 0x77, 0x44, 0x44, 0x44, 0x74, 0x44, 0x44, 0x01, 
-    0x11, 0x11, 0x44, 0x44, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x01, 0x11, 
-    0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x88, 0x7C, 
-    0x99, 0x90, 0x00, 0xFB, 0xB6, 0xB0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 
-    0x88, 0x81, 0x11, 0x11, 0x88, 0xCD, 0x80, 0x00, 0x08, 0xC4, 0x44, 0x47, 0x74, 0x44, 0x44, 0x11, 
-    0x14, 0x84, 0x44, 0x44, 0x11, 0x81, 0x01, 0x10, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x81, 0x88, 0x89, 0x80, 
-    0x99, 0xBB, 0xBB, 0xBB, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0x10, 
-    0x88, 0x88, 0x88, 0x88, 0x87, 0xCD, 0x70, 0x00, 0x00, 0x17, 0x74, 0x44, 0x44, 0x44, 0x44, 0x41, 
-    0xA4, 0x44, 0x44, 0x44, 0x88, 0x88, 0x10, 0x00, 0x01, 0x00, 0x01, 0x11, 0x11, 0x11, 0x41, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 
-    0x19, 0xBB, 0xBB, 0xBF, 0x0F, 0xBB, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x87, 0x98, 0x98, 0x00, 0x9C, 0xBE, 0xD9, 0x9C, 0x80, 0x00, 0x84, 0x44, 0x44, 0x44, 0x23, 0x24, 
-    0x44, 0x22, 0x44, 0x04, 0x44, 0x48, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x90, 0x10, 0x09, 0x9B, 0x0B, 0x91, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x88, 0x81, 0x19, 0x00, 0x07, 0xCE, 0xDE, 0xCC, 0x10, 0x00, 0x00, 0x14, 0x44, 0x42, 0x55, 0x24, 
-    0x44, 0x22, 0x22, 0x00, 0x44, 0x4A, 0x11, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0xA1, 0x11, 0x10, 
-    0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x08, 0x91, 0x09, 
-    0x00, 0x00, 0x00, 0x01, 0x99, 0x78, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x89, 0x91, 0x19, 0xEE, 0xEE, 0xEC, 0x81, 0xC7, 0x00, 0x00, 0x44, 0x44, 0x44, 0x24, 
-    0x42, 0x22, 0x44, 0x44, 0x44, 0x44, 0x44, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x99, 0xB9, 0x00, 0x11, 0x9C, 
-    0xEE, 0xBB, 0xCC, 0x99, 0xCE, 0xEE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x44, 0x44, 0x4A, 
-    0x11, 0x18, 0x18, 0x77, 0x18, 0x7E, 0xEE, 0xED, 0xD8, 0x88, 0x00, 0x00, 0x44, 0x11, 0x11, 0x14, 
-    0x42, 0x22, 0x24, 0x44, 0x44, 0x44, 0x44, 0x41, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x90, 0x00, 0x00, 0x00, 0x7E, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x7E, 0xBB, 0xED, 0xDE, 0x90, 0x00, 0x00, 0x10, 0x01, 0x11, 0x01, 
-    0x11, 0x11, 0x14, 0x44, 0x44, 0x44, 0x4A, 0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7C, 0xDD, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDE, 0xEE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x10, 
-    0x11, 0x81, 0x17, 0x11, 0x98, 0x9B, 0xEE, 0xDD, 0xDD, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9C, 0x55, 0xED, 0xDD, 
-    0xDD, 0xDD, 0xDD, 0xDD, 0x55, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xDD, 0xDE, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCE, 0xEE, 0xED, 
-    0x6D, 0xDD, 0xDD, 0xDD, 0x5C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x88, 0x14, 0x41, 0x00, 0x00, 0x00, 0x8E, 0xED, 0xDD, 0xD7, 0x01, 0x00, 0x11, 0x11, 0x00, 0x10, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x10, 0x01, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCC, 0xCC, 0xED, 
-    0xDD, 0x6D, 0xDD, 0xDD, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x1C, 0xDD, 0xDD, 0xD7, 0x08, 0x91, 0x84, 0x11, 0x10, 0x00, 
-    0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x18, 0x81, 0x11, 
-    0x11, 0x01, 0x00, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x88, 0x77, 0xED, 
-    0xDD, 0xDD, 0xDD, 0xDC, 0x11, 0x11, 0x11, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x99, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEE, 0xEE, 0xDC, 0x89, 0x91, 0x81, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x00, 0x00, 0x17, 0xCD, 
-    0xDD, 0xEE, 0xBB, 0xB0, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xCC, 0x71, 0x01, 0x81, 0x11, 0x10, 0x07, 0xDE, 0xEE, 0xEC, 0x7C, 0x71, 0x11, 0x11, 0x88, 0x11, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x01, 0x11, 0x11, 0x88, 0x11, 0x81, 
-    0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xCD, 
-    0xDD, 0x71, 0x91, 0xC0, 0x00, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0xEE, 0xBB, 0x11, 0x11, 0x11, 0x11, 0x17, 0xDE, 0xDE, 0xEC, 0xCC, 0x77, 0x44, 0x47, 0x77, 0x78, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x81, 0x18, 0x11, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xED, 
-    0xDC, 0x00, 0x01, 0x11, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0xD6, 0xDE, 0x91, 0x81, 0x11, 0x11, 0x1C, 0xDE, 0xEB, 0xEB, 0x74, 0x77, 0x44, 0x44, 0x44, 0x44, 
-    0x41, 0x48, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0x81, 0x11, 0x10, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x88, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xED, 
-    0xD9, 0x00, 0x01, 0x11, 0x11, 0x11, 0x18, 0x00, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0xDD, 0xDE, 0xC0, 0x00, 0x1C, 0x77, 0xCE, 0xDE, 0xEE, 0xEC, 0x17, 0x47, 0x77, 0x77, 0x77, 0x77, 
-    0x41, 0x10, 0x00, 0x00, 0x11, 0x11, 0x01, 0x10, 0x18, 0x11, 0x18, 0x44, 0x77, 0x44, 0x81, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x44, 0x44, 0x41, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xDD, 
-    0xD8, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x90, 0x01, 0x11, 0x11, 0x18, 0x44, 0x48, 0x11, 0x18, 
-    0xD6, 0xDE, 0xEB, 0x90, 0x09, 0x6B, 0xCB, 0xED, 0xBE, 0xE1, 0x17, 0x74, 0x77, 0x77, 0x77, 0x74, 
-    0x11, 0x11, 0x00, 0x01, 0x11, 0x18, 0x88, 0x78, 0x44, 0x77, 0x7C, 0x55, 0x57, 0x77, 0x41, 0x10, 
-    0x00, 0x01, 0x18, 0x47, 0xC5, 0x55, 0x07, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xED, 
-    0xC8, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x84, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x66, 0x66, 0xDD, 0xDB, 0x10, 0x17, 0xBE, 0x98, 0xEC, 0x91, 0x17, 0xC9, 0x14, 0x77, 0x78, 0x88, 
-    0x11, 0x01, 0x11, 0x87, 0x48, 0x88, 0x84, 0x77, 0x47, 0x75, 0x55, 0x55, 0x5C, 0x74, 0x11, 0x00, 
-    0x00, 0x00, 0x08, 0x47, 0x05, 0x07, 0x48, 0x81, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xCE, 
-    0x18, 0x41, 0x10, 0x11, 0x88, 0x10, 0x00, 0x00, 0x08, 0x74, 0x77, 0x74, 0x44, 0x44, 0x77, 0x74, 
-    0x66, 0x66, 0x66, 0xD6, 0xB0, 0x01, 0xBC, 0x10, 0x99, 0x77, 0x7B, 0xCB, 0x98, 0x77, 0x71, 0x00, 
-    0x00, 0x00, 0x17, 0x47, 0x44, 0x48, 0x14, 0x75, 0xC5, 0x55, 0x55, 0x55, 0x41, 0x11, 0x81, 0x00, 
-    0x00, 0x00, 0x01, 0x44, 0x07, 0x41, 0x71, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 
-    0x18, 0x77, 0x81, 0x11, 0x11, 0x11, 0x18, 0x11, 0x11, 0x14, 0x44, 0x77, 0xC7, 0x77, 0x77, 0x91, 
-    0x66, 0x66, 0x66, 0x66, 0x6B, 0x89, 0x69, 0x90, 0x01, 0x77, 0x5B, 0x79, 0x9C, 0x57, 0x10, 0x00, 
-    0x00, 0x00, 0x18, 0x77, 0x44, 0x74, 0x77, 0x44, 0x75, 0x55, 0x55, 0x5C, 0x48, 0x81, 0x00, 0x00, 
-    0x00, 0x01, 0x87, 0x77, 0x41, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x01, 0x00, 0x11, 0x10, 0xC9, 
-    0x00, 0x01, 0x11, 0x18, 0x81, 0x11, 0x00, 0x11, 0x11, 0x88, 0x1C, 0x74, 0x47, 0x77, 0x77, 0x77, 
-    0x66, 0x6B, 0x66, 0x66, 0x60, 0xF7, 0xDB, 0x90, 0x00, 0x00, 0x77, 0x00, 0x7D, 0xC8, 0x01, 0x00, 
-    0x08, 0x99, 0x84, 0x77, 0x74, 0x77, 0x55, 0x75, 0x75, 0x74, 0x47, 0x55, 0x55, 0x40, 0x00, 0x00, 
-    0x00, 0x01, 0x84, 0x41, 0x10, 0x00, 0x00, 0x00, 0x19, 0x79, 0x11, 0x11, 0x18, 0x49, 0x00, 0xC8, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x18, 0x78, 0x9B, 0x87, 0x78, 0x84, 0x88, 0x77, 
-    0x66, 0x66, 0x66, 0x66, 0x60, 0xFB, 0x66, 0xB9, 0x00, 0x07, 0xBB, 0x00, 0x00, 0x11, 0x99, 0x99, 
-    0xCC, 0xCC, 0x87, 0x77, 0x05, 0x55, 0x54, 0x11, 0x11, 0x00, 0x04, 0x74, 0x77, 0x10, 0x08, 0x77, 
-    0x81, 0x88, 0x11, 0x10, 0x10, 0x00, 0x00, 0x01, 0x81, 0x19, 0x88, 0x11, 0x18, 0x10, 0x00, 0xC8, 
-    0x11, 0x18, 0x11, 0x11, 0x11, 0x18, 0x11, 0x00, 0x01, 0x88, 0x9C, 0x7C, 0x77, 0x74, 0x18, 0xE7, 
-    0x66, 0x66, 0x66, 0x0B, 0x66, 0x00, 0x66, 0x6B, 0x00, 0x97, 0x9B, 0x79, 0x00, 0x00, 0x00, 0x00, 
-    0x09, 0x7C, 0x77, 0x74, 0x77, 0x45, 0x55, 0x71, 0x47, 0x88, 0x18, 0x57, 0x41, 0x01, 0x45, 0x57, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x88, 0x18, 0x79, 0x10, 0x11, 0xC8, 
-    0x18, 0x97, 0x88, 0x88, 0x18, 0x88, 0x88, 0x81, 0x00, 0x11, 0x1E, 0xCC, 0xC5, 0x57, 0x11, 0x57, 
-    0x66, 0x66, 0x66, 0x00, 0x06, 0x66, 0xEB, 0x90, 0x00, 0x00, 0xDB, 0xBB, 0x90, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x09, 0x77, 0x41, 0x14, 0x40, 0x55, 0x55, 0x54, 0x75, 0x41, 0x10, 0x14, 0x44, 0x48, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x11, 0x18, 0x81, 0x88, 0x11, 0xC1, 
-    0x01, 0x88, 0x88, 0x88, 0x11, 0x18, 0x88, 0x89, 0x89, 0x81, 0x1C, 0x75, 0x55, 0x55, 0x8C, 0xDC, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 0x00, 0xFF, 0x0B, 0x6E, 0xEB, 0x90, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x75, 0x55, 0x55, 0x54, 0x47, 0x10, 0x01, 0x84, 0x7C, 
-    0x78, 0x11, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x08, 0x10, 0x10, 0x78, 
-    0x10, 0x00, 0x11, 0x81, 0x19, 0x81, 0x81, 0x18, 0x79, 0x71, 0x1C, 0x75, 0x55, 0xC7, 0x7C, 0xDC, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x0B, 0x00, 0x00, 0x06, 0x6E, 0xE7, 0x19, 0x90, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xB8, 0x87, 0x77, 0x77, 0xC9, 0x00, 0x17, 0x05, 
-    0x57, 0x81, 0x11, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x88, 
-    0x11, 0x11, 0x10, 0x00, 0x18, 0x79, 0x88, 0x77, 0x09, 0x71, 0x8C, 0x87, 0x5C, 0x00, 0x9E, 0xE7, 
-    0x66, 0x66, 0x66, 0x60, 0x66, 0x6B, 0x00, 0x00, 0x0B, 0x06, 0x66, 0xB7, 0x90, 0xFF, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBE, 0xEB, 0x7C, 0xBD, 0xD0, 0x01, 0x55, 
-    0x54, 0x74, 0x11, 0xC7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x01, 0x91, 0x87, 0x98, 
-    0x11, 0x81, 0x10, 0x00, 0x19, 0x7C, 0x77, 0x77, 0x97, 0x80, 0x8C, 0x98, 0x79, 0x09, 0x99, 0x99, 
-    0x66, 0x60, 0x66, 0x66, 0x66, 0x6F, 0x00, 0x00, 0x0F, 0x06, 0x66, 0x66, 0x60, 0x00, 0xFF, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xBB, 0xBD, 0xD6, 0x6D, 0x10, 0x07, 
-    0x55, 0x54, 0x45, 0xC4, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x87, 0x77, 0x77, 0x98, 
-    0x89, 0x98, 0x11, 0x11, 0x11, 0x87, 0x7C, 0xC7, 0x77, 0x91, 0x18, 0x7E, 0xC9, 0x99, 0x90, 0x99, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x00, 0x00, 0x00, 0x60, 0x66, 0x60, 0x0B, 0xBF, 0xF0, 
-    0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xEE, 0x66, 0x61, 0x00, 
-    0xC5, 0x55, 0x55, 0x47, 0x57, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x77, 0x7C, 0xC7, 0x44, 0x79, 
-    0x87, 0x78, 0x89, 0x88, 0x88, 0x11, 0x77, 0x87, 0x71, 0x19, 0xCC, 0xB9, 0x09, 0x90, 0x99, 0x99, 
-    0x66, 0x66, 0x66, 0x66, 0xBF, 0x06, 0x66, 0x06, 0x00, 0x00, 0xBB, 0x66, 0x66, 0xBB, 0x0B, 0xFF, 
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0x90, 0xF9, 0xB6, 0x6D, 0x80, 
-    0x07, 0x55, 0x57, 0x44, 0x41, 0x00, 0x00, 0x00, 0x01, 0x88, 0x84, 0xCC, 0x77, 0x77, 0x77, 0x77, 
-    0x47, 0x77, 0x77, 0x47, 0x77, 0x77, 0x81, 0x17, 0x11, 0x8C, 0x90, 0x00, 0x00, 0x09, 0x9B, 0x00, 
-    0x66, 0x66, 0x66, 0x66, 0x0B, 0x66, 0x66, 0x66, 0x06, 0x66, 0x09, 0x66, 0x66, 0x60, 0x00, 0x00, 
-    0xFF, 0xFF, 0x0F, 0xF0, 0x00, 0xF0, 0xF0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFB, 0xB6, 0xB9, 
-    0x00, 0x75, 0x74, 0x47, 0x41, 0x01, 0x11, 0x11, 0x14, 0x74, 0x14, 0x75, 0x55, 0x77, 0x55, 0x57, 
-    0x77, 0xC7, 0x77, 0x77, 0x77, 0x88, 0x11, 0x97, 0x87, 0xB9, 0x90, 0x09, 0x99, 0x9B, 0xBB, 0xBB, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x66, 0x60, 0x00, 0x00, 
-    0x00, 0xFF, 0x0F, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x99, 0x9F, 0xFF, 0xF9, 
-    0xB9, 0x9B, 0x77, 0x77, 0x17, 0x18, 0x88, 0x88, 0x47, 0x54, 0x45, 0x55, 0x55, 0x54, 0x75, 0x77, 
-    0x55, 0x57, 0x77, 0x79, 0x91, 0x10, 0x00, 0x99, 0x9C, 0x79, 0x99, 0x99, 0x97, 0x7C, 0xCE, 0xDB, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
-    0x00, 0xBB, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0x09, 0xFF, 0xFF, 0xB0, 
-    0xEE, 0xBB, 0x90, 0x00, 0x08, 0x11, 0x17, 0x47, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x47, 
-    0x05, 0x78, 0x77, 0x90, 0x00, 0x90, 0x00, 0x09, 0x97, 0x07, 0x79, 0x97, 0xCC, 0x98, 0x99, 0xC9, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6B, 0x06, 0xB0, 
-    0x60, 0x6B, 0x00, 0x60, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xF9, 0x0B, 0xBB, 0xB0, 
-    0x66, 0x6D, 0xB9, 0x90, 0x01, 0x11, 0x11, 0x17, 0x71, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 
-    0x55, 0x4C, 0x77, 0x79, 0x99, 0x99, 0x97, 0xBB, 0xBB, 0xEE, 0xEB, 0xEC, 0x99, 0x88, 0x99, 0x97, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0xB0, 0xBB, 
-    0x66, 0x66, 0x66, 0x60, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x66, 0x00, 0x66, 
-    0x66, 0x66, 0xEE, 0xE7, 0x81, 0x11, 0x11, 0x78, 0x11, 0x1A, 0x45, 0x55, 0x55, 0x54, 0x55, 0xC7, 
-    0x7C, 0xEB, 0xBB, 0xEB, 0x97, 0xBB, 0xBB, 0xBB, 0xEE, 0xDD, 0xDD, 0xE9, 0x89, 0x99, 0x99, 0x9C, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xB9, 0x00, 
-    0x06, 0x60, 0x66, 0x66, 0x6B, 0x00, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x66, 0x66, 0x66, 
-    0x66, 0x66, 0xEB, 0xBB, 0xC8, 0x11, 0x11, 0x81, 0x11, 0xA1, 0x14, 0x55, 0x55, 0x55, 0x55, 0xCC, 
-    0xCE, 0xBB, 0xEE, 0xBB, 0xBB, 0xCB, 0xBB, 0xBB, 0xBB, 0xBE, 0xEE, 0xED, 0xC7, 0x89, 0x99, 0x79, 
+const uint8_t STORY_FINAL_SCENE_RLE[STORY_FINAL_SCENE_RLE_SIZE] = {
+    0xB3, 0xF2, 0x02, 0x00, 0x30, 0xC5, 0xB2, 0xB3, 0xA5, 0x04, 0x32, 0x44, 0xC0, 0xA5, 0xF3, 0x07, 
+    0x03, 0x23, 0x33, 0xF5, 0x05, 0xF3, 0x02, 0x01, 0x22, 0xE3, 0xA2, 0x04, 0xA1, 0x01, 0x10, 0xAA, 
+    0x05, 0x44, 0x22, 0x10, 0xAA, 0x03, 0x00, 0x22, 0x4E, 0x01, 0x22, 0xA5, 0x00, 0x30, 0xA2, 0x02, 
+    0x55, 0x50, 0x43, 0x08, 0x32, 0x2A, 0x00, 0x07, 0x00, 0x53, 0x03, 0x55, 0x33, 0xF5, 0x03, 0x4A, 
+    0x02, 0x23, 0x50, 0xC3, 0x01, 0x24, 0xC1, 0x0B, 0x44, 0xAA, 0xA2, 0x22, 0xA0, 0x10, 0x48, 0xF2, 
+    0x06, 0x06, 0x35, 0x32, 0x22, 0x30, 0xA5, 0x46, 0x00, 0x40, 0x42, 0x00, 0x50, 0x4D, 0x00, 0x50, 
+    0xA3, 0xF5, 0x07, 0xF3, 0x02, 0xB2, 0x11, 0x33, 0x35, 0x33, 0x40, 0x0A, 0x4A, 0xAA, 0x22, 0x24, 
+    0xB2, 0x02, 0x1A, 0x20, 0xA0, 0x43, 0x03, 0x22, 0x00, 0xF2, 0x04, 0x00, 0x30, 0xA2, 0xD5, 0x5A, 
+    0x02, 0x55, 0x30, 0xF5, 0x02, 0xA3, 0xA5, 0xF3, 0x02, 0xB2, 0x09, 0x32, 0x24, 0x81, 0xA2, 0x24, 
+    0xF2, 0x03, 0x02, 0x42, 0x20, 0x48, 0x04, 0x2A, 0x0A, 0x40, 0xF2, 0x05, 0x00, 0x30, 0xF5, 0x01, 
+    0x46, 0x01, 0x05, 0xF3, 0x04, 0xD5, 0x02, 0x00, 0x00, 0xA5, 0xA3, 0xC5, 0xF3, 0x04, 0x08, 0x22, 
+    0x41, 0x00, 0x01, 0x40, 0xF2, 0x0A, 0x49, 0x04, 0x2A, 0x11, 0x40, 0xA2, 0x01, 0x33, 0x4D, 0x00, 
+    0x00, 0x47, 0x01, 0x40, 0xF3, 0x03, 0x01, 0x50, 0x50, 0x00, 0x30, 0x4F, 0x06, 0x21, 0x10, 0x1A, 
+    0x40, 0xB2, 0x00, 0xA0, 0xF2, 0x07, 0x00, 0xA0, 0x4C, 0x01, 0x04, 0xB2, 0x00, 0x30, 0xB2, 0x00, 
+    0x30, 0x48, 0x01, 0x05, 0x45, 0x00, 0x50, 0xC3, 0x03, 0x22, 0x24, 0xA3, 0x49, 0x00, 0x40, 0x45, 
+    0x00, 0x30, 0xB5, 0xF3, 0x01, 0x06, 0x41, 0x14, 0x42, 0x30, 0xF2, 0x0E, 0x02, 0x14, 0xA0, 0x42, 
+    0xA2, 0x05, 0xAA, 0x1A, 0x1A, 0xF2, 0x02, 0xD3, 0x02, 0x50, 0x50, 0x51, 0x05, 0xA0, 0x43, 0x35, 
+    0xA3, 0x4D, 0xC5, 0xE3, 0x02, 0x24, 0x20, 0xC3, 0xD2, 0x02, 0x33, 0x30, 0xF2, 0x05, 0x04, 0x41, 
+    0xA2, 0x30, 0xB2, 0x03, 0xA0, 0xAA, 0xF2, 0x04, 0x46, 0x02, 0x55, 0x00, 0x4D, 0x00, 0x20, 0x44, 
+    0x02, 0x50, 0x50, 0xA3, 0xF5, 0x00, 0x49, 0x00, 0x50, 0xF3, 0x08, 0x46, 0x02, 0x22, 0x30, 0xF2, 
+    0x04, 0x01, 0xA4, 0xF2, 0x01, 0x00, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xA2, 0x02, 0x33, 0x20, 0xB3, 
+    0x48, 0x00, 0x70, 0x4A, 0x02, 0x55, 0x50, 0xF3, 0x0B, 0x50, 0x01, 0x41, 0xA3, 0x4F, 0x03, 0x44, 
+    0x11, 0xF2, 0x01, 0x03, 0xA2, 0xA0, 0xF2, 0x0A, 0xC3, 0x00, 0x50, 0x46, 0x00, 0x00, 0xA3, 0xA2, 
+    0x04, 0xA0, 0x40, 0x50, 0xF3, 0x10, 0xB5, 0xF3, 0x01, 0x00, 0x50, 0x49, 0x01, 0x33, 0x46, 0x02, 
+    0x00, 0x10, 0xF2, 0x01, 0x01, 0x1A, 0xF2, 0x04, 0x00, 0x00, 0x4C, 0x01, 0x33, 0x4A, 0x07, 0x33, 
+    0x22, 0x10, 0x40, 0xE3, 0x02, 0x22, 0x20, 0xF3, 0x05, 0x02, 0x55, 0x50, 0xF3, 0x04, 0x05, 0x51, 
+    0x15, 0x33, 0x4A, 0x05, 0x44, 0x2A, 0x14, 0xF2, 0x01, 0x06, 0x10, 0xA2, 0xA1, 0xA0, 0xF2, 0x0D, 
+    0x48, 0x00, 0x40, 0x43, 0x02, 0x55, 0x30, 0x42, 0xB3, 0x00, 0x20, 0xA3, 0x4E, 0xF3, 0x08, 0x07, 
+    0x24, 0x23, 0x33, 0x22, 0xC3, 0x02, 0x22, 0x40, 0xA0, 0x01, 0x1A, 0xF2, 0x01, 0x02, 0xA4, 0x00, 
+    0xAA, 0xA2, 0x02, 0x4A, 0xA0, 0xD2, 0x01, 0x33, 0xA2, 0x03, 0x41, 0x22, 0x46, 0x00, 0x70, 0x42, 
+    0x00, 0x50, 0x49, 0xF2, 0x00, 0xF3, 0x01, 0xA2, 0xF3, 0x0A, 0xC2, 0x02, 0x32, 0x20, 0x42, 0x05, 
+    0x10, 0x14, 0x44, 0xD2, 0x00, 0x00, 0xC2, 0x00, 0xA0, 0xD2, 0x05, 0x4A, 0xAA, 0x22, 0xE3, 0x03, 
+    0x23, 0x40, 0xA3, 0x0D, 0x22, 0xA0, 0x00, 0xC0, 0x50, 0x00, 0x33, 0x46, 0xF2, 0x00, 0xF3, 0x00, 
+    0xB2, 0xF3, 0x0D, 0x45, 0x05, 0x22, 0x24, 0x14, 0xA2, 0x01, 0x14, 0x44, 0x01, 0xA4, 0xE2, 0x0B, 
+    0x52, 0x22, 0xA1, 0x11, 0xAA, 0x42, 0x4E, 0x00, 0x10, 0x43, 0xA0, 0x45, 0x03, 0x53, 0x33, 0xC2, 
+    0xA3, 0x07, 0x22, 0x23, 0x32, 0xAA, 0xD2, 0xD3, 0x01, 0x22, 0x4B, 0x08, 0xAA, 0x22, 0x4A, 0x41, 
+    0x40, 0xA2, 0x01, 0x40, 0x45, 0x01, 0x4A, 0xC2, 0xA4, 0x0B, 0x10, 0x00, 0x11, 0x10, 0x00, 0x12, 
+    0xC3, 0x03, 0x41, 0x23, 0xA2, 0x42, 0x02, 0x40, 0x30, 0x45, 0x02, 0xA0, 0x40, 0xF3, 0x04, 0xB2, 
+    0x02, 0x11, 0xA0, 0xF2, 0x01, 0xF3, 0x03, 0x04, 0x23, 0x33, 0x40, 0x42, 0x05, 0x11, 0x42, 0x24, 
+    0xC2, 0x46, 0x0B, 0xA2, 0x44, 0x24, 0xA4, 0x4A, 0x11, 0xF0, 0x03, 0x0C, 0x14, 0x55, 0x33, 0x54, 
+    0x02, 0x22, 0x30, 0x44, 0x02, 0x70, 0x50, 0xA0, 0x44, 0x04, 0x23, 0x32, 0x20, 0xB3, 0xC2, 0x04, 
+    0x41, 0x1A, 0x40, 0xB2, 0x01, 0x33, 0xA2, 0xF3, 0x08, 0x06, 0x22, 0x4A, 0x11, 0x40, 0xC2, 0x00, 
+    0x40, 0x48, 0x08, 0x42, 0x22, 0x4A, 0x11, 0x10, 0xF0, 0x07, 0x06, 0x45, 0x33, 0x34, 0x10, 0xC2, 
+    0x42, 0x00, 0xC0, 0xC0, 0x05, 0x53, 0x21, 0x0A, 0xF2, 0x06, 0x03, 0x40, 0x1A, 0xE2, 0x02, 0x33, 
+    0x30, 0x53, 0x05, 0x22, 0x41, 0xA4, 0xA2, 0xA4, 0x45, 0x07, 0x44, 0x22, 0x44, 0x11, 0xF0, 0x09, 
+    0x0B, 0x12, 0x55, 0x34, 0x05, 0x22, 0x24, 0x43, 0x0A, 0x70, 0x50, 0x00, 0x33, 0x32, 0xA0, 0x42, 
+    0x02, 0x1A, 0xA0, 0xB2, 0x05, 0x4A, 0xA4, 0x40, 0x49, 0x00, 0x20, 0xF3, 0x0C, 0xC2, 0x06, 0x4A, 
+    0xA4, 0x42, 0x20, 0x44, 0x00, 0x40, 0x44, 0x03, 0x44, 0x41, 0xF0, 0x0A, 0x0C, 0x14, 0x55, 0x54, 
+    0x05, 0x32, 0x2A, 0xA0, 0x42, 0x05, 0x40, 0x53, 0x55, 0x42, 0x1C, 0x10, 0xA2, 0xA1, 0x4A, 0xAA, 
+    0x1A, 0x42, 0x41, 0x10, 0x01, 0xA4, 0x42, 0x22, 0x33, 0x30, 0x5B, 0x12, 0x24, 0x10, 0x14, 0x42, 
+    0x40, 0x0A, 0x2A, 0xA4, 0x24, 0xA0, 0xA4, 0x01, 0x11, 0x52, 0x01, 0x23, 0x43, 0x03, 0x32, 0xA1, 
+    0x43, 0x03, 0x35, 0x55, 0xA3, 0x17, 0x28, 0x0A, 0x22, 0x2A, 0x22, 0x24, 0x14, 0xAA, 0x10, 0x01, 
+    0xA4, 0x4A, 0xA2, 0xC3, 0x00, 0x20, 0x56, 0x02, 0x41, 0x10, 0xA0, 0x0E, 0x10, 0x00, 0x1A, 0x44, 
+    0xAA, 0x14, 0x41, 0x10, 0x5D, 0x01, 0x41, 0x44, 0x04, 0x24, 0x44, 0x20, 0x42, 0x02, 0x10, 0x10, 
+    0xA2, 0x0E, 0xA2, 0x41, 0x14, 0x41, 0x00, 0x1A, 0x24, 0x40, 0xC2, 0xF3, 0x05, 0x00, 0x20, 0x4D, 
+    0xA1, 0xF0, 0x00, 0x07, 0x11, 0x10, 0x11, 0x44, 0xA1, 0x52, 0x0A, 0x52, 0x54, 0x10, 0x33, 0x21, 
+    0x10, 0xA0, 0x07, 0x84, 0x11, 0x14, 0x22, 0x43, 0x00, 0x40, 0xB2, 0x03, 0x11, 0x1A, 0x42, 0x03, 
+    0x01, 0x1A, 0xD2, 0xF3, 0x0A, 0x05, 0x23, 0x32, 0x33, 0xB2, 0x07, 0x4A, 0x11, 0x10, 0x01, 0xC0, 
+    0x09, 0x11, 0x00, 0x11, 0x18, 0x81, 0xF0, 0x0A, 0x02, 0x14, 0x30, 0x42, 0x03, 0x22, 0x34, 0x44, 
+    0x07, 0x44, 0x14, 0x44, 0x23, 0x43, 0x09, 0x1A, 0x24, 0x22, 0x44, 0x21, 0xB0, 0x07, 0x10, 0x1A, 
+    0x22, 0x12, 0xF3, 0x06, 0x06, 0x22, 0x23, 0x32, 0x30, 0x43, 0x07, 0x32, 0x32, 0x33, 0x2A, 0x43, 
+    0x00, 0x10, 0xA0, 0x00, 0x10, 0x45, 0x01, 0x14, 0x42, 0xA1, 0xF0, 0x04, 0x02, 0x44, 0x30, 0x43, 
+    0x04, 0x24, 0x11, 0x10, 0x47, 0x04, 0x42, 0x22, 0xA0, 0xA1, 0x02, 0xAA, 0xA0, 0xA2, 0x43, 0xB1, 
+    0x02, 0xA2, 0x20, 0x4C, 0xF2, 0x00, 0xB3, 0xA2, 0x0C, 0x32, 0x24, 0x11, 0x10, 0x11, 0x10, 0x00, 
+    0xD1, 0xA4, 0x00, 0x80, 0xF1, 0x00, 0xF0, 0x02, 0x03, 0x14, 0x23, 0x4A, 0x01, 0x8A, 0x43, 0x00, 
+    0xA0, 0xA1, 0xD4, 0x05, 0x22, 0x41, 0x00, 0xC1, 0x05, 0xA4, 0x42, 0x22, 0xF3, 0x02, 0xF2, 0x03, 
+    0x01, 0x33, 0xD2, 0x06, 0x4A, 0x11, 0x00, 0x00, 0xF1, 0x02, 0x04, 0x87, 0x74, 0x40, 0xF1, 0x01, 
+    0xF0, 0x03, 0x06, 0x14, 0x44, 0x32, 0x40, 0xA1, 0x42, 0x01, 0x44, 0xB1, 0xA0, 0x00, 0x10, 0xB2, 
+    0x03, 0xAA, 0x44, 0xF1, 0x00, 0x44, 0x04, 0x22, 0x33, 0x30, 0xE2, 0x03, 0x44, 0x14, 0xF2, 0x06, 
+    0x02, 0x41, 0x10, 0xB0, 0xA1, 0x08, 0xAA, 0x11, 0x10, 0x08, 0x40, 0x45, 0x03, 0x81, 0x11, 0xF0, 
+    0x05, 0x00, 0x10, 0xA4, 0xB1, 0x1B, 0x00, 0x04, 0x24, 0x88, 0x45, 0x44, 0x10, 0x00, 0x14, 0x32, 
+    0x24, 0xA4, 0xA1, 0xAA, 0xA1, 0x00, 0x40, 0x47, 0x03, 0x22, 0x23, 0x46, 0x02, 0x11, 0x10, 0xC2, 
+    0x06, 0x42, 0x44, 0x4A, 0x40, 0x48, 0x05, 0x01, 0x11, 0x44, 0x43, 0x00, 0x00, 0xF1, 0x02, 0xF0, 
+    0x03, 0x06, 0x11, 0x00, 0x14, 0x40, 0xC1, 0x07, 0x00, 0x08, 0x44, 0x48, 0xA1, 0xC0, 0xA4, 0x0D, 
+    0x24, 0xAA, 0xA4, 0x41, 0x14, 0x4A, 0xA4, 0xF2, 0x09, 0x03, 0x41, 0x14, 0xD2, 0x0A, 0x44, 0x41, 
+    0x14, 0x4A, 0x11, 0x10, 0x45, 0x07, 0x84, 0x41, 0x44, 0x11, 0xE0, 0x50, 0x09, 0x10, 0x14, 0x24, 
+    0x11, 0x01, 0xA0, 0x03, 0x84, 0x41, 0xF0, 0x02, 0x00, 0x10, 0xB4, 0x02, 0x11, 0x10, 0x42, 0x08, 
+    0xAA, 0x44, 0x22, 0x24, 0x40, 0xF2, 0x01, 0x07, 0x44, 0x22, 0x10, 0x01, 0xF2, 0x01, 0x08, 0xAA, 
+    0x4A, 0xA1, 0x14, 0x80, 0xB0, 0x09, 0x1A, 0x42, 0xAA, 0x41, 0x11, 0xE0, 0xA1, 0xF0, 0x03, 0xA1, 
+    0x05, 0x42, 0x44, 0x11, 0x44, 0x00, 0x10, 0xF0, 0x04, 0x04, 0x11, 0x44, 0x40, 0xA1, 0x04, 0x44, 
+    0x4A, 0xA0, 0xA4, 0x04, 0x22, 0x11, 0x10, 0xE4, 0x04, 0x22, 0x44, 0x40, 0x42, 0x00, 0x40, 0xC2, 
+    0x00, 0x40, 0x43, 0xA4, 0xC1, 0x07, 0x04, 0x42, 0x22, 0x4A, 0xF0, 0x03, 0xA1, 0xF0, 0x03, 0x01, 
+    0x11, 0xB4, 0xA1, 0x02, 0x00, 0x00, 0xA1, 0xF0, 0x01, 0x03, 0x11, 0x1A, 0x42, 0xC4, 0x02, 0xA4, 
+    0x40, 0xA2, 0x00, 0xA0, 0xA1, 0x02, 0xA4, 0x40, 0xB2, 0x01, 0x44, 0xC0, 0x01, 0x43, 0xC2, 0x03, 
+    0x41, 0xA2, 0x43, 0x0C, 0x00, 0x01, 0x11, 0xA4, 0x42, 0x22, 0x40, 0xF0, 0x06, 0x01, 0x11, 0xF0, 
+    0x03, 0x43, 0x00, 0xA0, 0x56, 0x01, 0x12, 0x47, 0x01, 0x44, 0xC2, 0x04, 0xA1, 0x11, 0x40, 0xD2, 
+    0x00, 0x40, 0xC0, 0x05, 0x11, 0x53, 0x33, 0xA2, 0x06, 0xAA, 0x41, 0x42, 0x10, 0xB0, 0x03, 0x11, 
+    0xAA, 0x52, 0xF0, 0x05, 0x43, 0xB1, 0x01, 0x00, 0xA1, 0xF0, 0x03, 0x06, 0x11, 0x44, 0x41, 0x10, 
+    0xAA, 0x48, 0x03, 0x22, 0x44, 0xE2, 0x00, 0x10, 0xC0, 0x0F, 0x81, 0x43, 0x32, 0x44, 0x24, 0xA1, 
+    0x11, 0x41, 0xD0, 0x07, 0x11, 0x44, 0x24, 0x11, 0xF0, 0x04, 0x06, 0x11, 0x10, 0x00, 0x10, 0xE0, 
+    0x04, 0x11, 0x14, 0x40, 0xF1, 0x02, 0xF0, 0x04, 0x00, 0x10, 0xE4, 0x09, 0xA1, 0xA4, 0xAA, 0xA4, 
+    0x14, 0xF2, 0x04, 0x00, 0x10, 0xB0, 0x0A, 0x87, 0x77, 0x42, 0x32, 0x24, 0x40, 0x43, 0x00, 0x10, 
+    0x46, 0x04, 0x00, 0xA4, 0xA0, 0xF0, 0x07, 0xF1, 0x01, 0x46, 0x05, 0x14, 0x14, 0x44, 0xB1, 0xF0, 
+    0x04, 0x00, 0x10, 0x4A, 0xB1, 0x03, 0x00, 0x14, 0xF2, 0x02, 0x00, 0x10, 0xA0, 0x09, 0x11, 0x10, 
+    0x00, 0x14, 0x24, 0xD1, 0x02, 0x44, 0x40, 0xF0, 0x00, 0x01, 0x11, 0xF0, 0x08, 0xA1, 0x01, 0x00, 
+    0xC1, 0x44, 0x01, 0x01, 0xA4, 0x00, 0xA0, 0x4E, 0xA1, 0x07, 0x41, 0x11, 0x44, 0xAA, 0xB1, 0x00, 
+    0x00, 0xA1, 0x49, 0x00, 0x40, 0xD0, 0x0B, 0x19, 0xCC, 0x74, 0x44, 0x10, 0x1A, 0xC4, 0x00, 0x10, 
+    0xF0, 0x12, 0xD1, 0x00, 0x00, 0xB1, 0x42, 0x00, 0x00, 0x44, 0x03, 0x44, 0x88, 0x4A, 0xD1, 0x05, 
+    0x00, 0x01, 0x41, 0xE0, 0x45, 0x05, 0x44, 0x22, 0x44, 0xC0, 0x12, 0x19, 0xBB, 0xEE, 0x77, 0xC4, 
+    0x44, 0x22, 0x24, 0x44, 0x10, 0xF0, 0x0F, 0x01, 0x19, 0x42, 0x02, 0x88, 0x80, 0xA4, 0x04, 0x11, 
+    0x14, 0x40, 0xA1, 0x44, 0x04, 0xAA, 0x48, 0x10, 0xF0, 0x00, 0xF1, 0x02, 0x03, 0x00, 0x01, 0x47, 
+    0x01, 0x01, 0xA4, 0x05, 0x24, 0x41, 0x11, 0xC0, 0x0D, 0x18, 0x10, 0x00, 0xEB, 0xEB, 0x72, 0x04, 
+    0xA1, 0xF0, 0x09, 0x03, 0x98, 0x88, 0xA1, 0x02, 0x9B, 0x10, 0x42, 0xF4, 0x03, 0x03, 0x11, 0x81, 
+    0x43, 0x03, 0x44, 0x11, 0xE0, 0xF1, 0x02, 0xA0, 0xA1, 0xF0, 0x00, 0x01, 0x18, 0xB4, 0x00, 0x10, 
+    0xF0, 0x03, 0x00, 0x90, 0xAB, 0x05, 0x81, 0x44, 0x11, 0xF0, 0x09, 0x05, 0x10, 0x08, 0x11, 0xB8, 
+    0x08, 0x1C, 0xB1, 0x01, 0x44, 0x70, 0xF4, 0x04, 0x00, 0x00, 0x42, 0x05, 0x11, 0x41, 0x11, 0xF0, 
+    0x02, 0x05, 0x11, 0x14, 0x48, 0x45, 0x00, 0x80, 0x48, 0x06, 0x01, 0x11, 0x44, 0xA0, 0x4A, 0x0C, 
+    0x99, 0xBF, 0xBB, 0x00, 0x99, 0x9C, 0x90, 0xF0, 0x07, 0x15, 0x11, 0x10, 0x88, 0x18, 0x11, 0x88, 
+    0x81, 0xEB, 0x00, 0x18, 0x77, 0xC4, 0x00, 0x70, 0x44, 0xB1, 0xA4, 0x02, 0x11, 0x10, 0xF0, 0x01, 
+    0xD1, 0x07, 0x01, 0x11, 0x81, 0x01, 0x48, 0x04, 0x48, 0x11, 0x10, 0xC0, 0x15, 0x11, 0x18, 0x87, 
+    0xC9, 0x99, 0x00, 0x0F, 0xBB, 0x6B, 0x0F, 0xFB, 0x51, 0x00, 0x80, 0xB1, 0x04, 0x88, 0xCD, 0x80, 
+    0xA0, 0x01, 0x8C, 0xA4, 0x00, 0x70, 0x44, 0x04, 0x11, 0x14, 0x80, 0xB4, 0x09, 0x11, 0x81, 0x01, 
+    0x10, 0x11, 0x48, 0xB1, 0xF0, 0x03, 0x01, 0x11, 0xE0, 0x0A, 0x18, 0x18, 0x88, 0x98, 0x09, 0x90, 
+    0xCB, 0x03, 0x0F, 0x0F, 0xF0, 0x06, 0x01, 0x18, 0x44, 0xC8, 0x03, 0x7C, 0xD7, 0xB0, 0x02, 0x17, 
+    0x70, 0xF4, 0x01, 0x01, 0x1A, 0xD4, 0xA8, 0x00, 0x10, 0xA0, 0x49, 0x03, 0x41, 0x11, 0xF0, 0x02, 
+    0x01, 0x11, 0xE0, 0x00, 0x10, 0xA0, 0x00, 0x80, 0xB0, 0x00, 0x10, 0x44, 0x07, 0xF0, 0xFB, 0xB6, 
+    0x69, 0x4B, 0xA1, 0x14, 0x87, 0x98, 0x98, 0x00, 0x9C, 0xBE, 0xD9, 0x9C, 0x80, 0x00, 0x80, 0xD4, 
+    0x0A, 0x23, 0x24, 0x44, 0x22, 0x44, 0x00, 0xA4, 0x45, 0xF1, 0x01, 0x42, 0x00, 0x10, 0xD0, 0x03, 
+    0x11, 0x00, 0xA1, 0xF0, 0x06, 0x0E, 0x89, 0x01, 0x00, 0x99, 0xB0, 0xB9, 0x17, 0xE0, 0xF0, 0x02, 
+    0xD1, 0x10, 0x88, 0x81, 0x19, 0x00, 0x07, 0xCE, 0xDE, 0xCC, 0x10, 0xB0, 0x00, 0x10, 0xA4, 0x02, 
+    0x25, 0x50, 0x44, 0x09, 0x22, 0x00, 0x44, 0x4A, 0x11, 0x4A, 0x00, 0xA0, 0xA1, 0x06, 0x00, 0x01, 
+    0x00, 0x10, 0xD0, 0xB1, 0xF0, 0x00, 0x04, 0x89, 0x10, 0x90, 0xD0, 0x06, 0x19, 0x97, 0x8C, 0x70, 
+    0xF0, 0x01, 0xF1, 0x03, 0x05, 0x89, 0x91, 0x19, 0xBE, 0x04, 0xC8, 0x1C, 0x70, 0xA0, 0xC4, 0x05, 
+    0x24, 0x42, 0x22, 0xF4, 0x01, 0x00, 0x10, 0x49, 0x02, 0x11, 0x10, 0xB0, 0x01, 0x11, 0x47, 0x03, 
+    0x01, 0x11, 0xB0, 0x16, 0x99, 0xB9, 0x00, 0x11, 0x9C, 0xEE, 0xBB, 0xCC, 0x99, 0xCE, 0xEE, 0xC0, 
+    0xF0, 0x01, 0x02, 0x11, 0x10, 0xB4, 0x0B, 0xA1, 0x11, 0x81, 0x87, 0x71, 0x87, 0xAE, 0x04, 0xDD, 
+    0x88, 0x80, 0x44, 0xB1, 0x43, 0x00, 0x20, 0xF4, 0x01, 0x05, 0x10, 0x00, 0x11, 0xF0, 0x14, 0x02, 
+    0x89, 0x90, 0xD0, 0x01, 0x7E, 0xFD, 0x04, 0x00, 0xC0, 0xF0, 0x02, 0xF1, 0x00, 0xF8, 0x01, 0x08, 
+    0x7E, 0xBB, 0xED, 0xDE, 0x90, 0xB0, 0x06, 0x10, 0x01, 0x11, 0x00, 0xC1, 0xE4, 0x03, 0xAA, 0x11, 
+    0xF0, 0x1F, 0x02, 0x87, 0xC0, 0xFD, 0x02, 0x03, 0xEE, 0xEC, 0xF0, 0x04, 0x15, 0x11, 0x10, 0x00, 
+    0x10, 0x11, 0x81, 0x17, 0x11, 0x98, 0x9B, 0xEE, 0xBD, 0x00, 0x90, 0xF0, 0x09, 0xF1, 0x03, 0xF0, 
+    0x1C, 0x05, 0x19, 0xC5, 0x5E, 0xFD, 0x02, 0x02, 0x55, 0x80, 0xF0, 0x18, 0x00, 0xC0, 0xAD, 0x03, 
+    0xED, 0x91, 0xF0, 0x18, 0x02, 0x11, 0x10, 0xF0, 0x17, 0x01, 0x7C, 0xAE, 0x01, 0xD6, 0x46, 0x00, 
+    0xC0, 0x54, 0x05, 0x88, 0x14, 0x41, 0xC0, 0x02, 0x8E, 0xE0, 0xAD, 0x04, 0x70, 0x10, 0x00, 0xA1, 
+    0x02, 0x00, 0x10, 0xB0, 0xD1, 0xD0, 0x00, 0x10, 0xB0, 0x04, 0x18, 0x10, 0x00, 0xD1, 0x55, 0x07, 
+    0xCC, 0xCE, 0xDD, 0xD6, 0xBD, 0x01, 0xCC, 0xF0, 0x0D, 0xD1, 0xB0, 0x01, 0x1C, 0xBD, 0x0E, 0x70, 
+    0x89, 0x18, 0x41, 0x11, 0x00, 0x01, 0x10, 0x47, 0xF1, 0x02, 0x00, 0x00, 0xA1, 0x01, 0x88, 0xB1, 
+    0x03, 0x01, 0x00, 0xB1, 0x02, 0x00, 0x00, 0xF1, 0x02, 0x04, 0x88, 0x87, 0x70, 0x42, 0xBD, 0x00, 
+    0xC0, 0xC1, 0x04, 0x00, 0x11, 0x10, 0xF0, 0x03, 0x03, 0x19, 0x98, 0xF0, 0x01, 0x00, 0x90, 0xAE, 
+    0x06, 0xDC, 0x89, 0x91, 0x80, 0xF1, 0x01, 0x02, 0x00, 0x00, 0xF1, 0x1A, 0xA0, 0xC1, 0xA0, 0x00, 
+    0x10, 0xA0, 0x0B, 0x17, 0xCD, 0xDD, 0xEE, 0xBB, 0xB0, 0xB1, 0xB0, 0xA1, 0xF0, 0x01, 0x06, 0xCC, 
+    0x71, 0x01, 0x80, 0xA1, 0x03, 0x00, 0x7D, 0xAE, 0x03, 0xC7, 0xC7, 0xB1, 0x06, 0x88, 0x11, 0x00, 
+    0x00, 0xF1, 0x04, 0xB0, 0xB1, 0x06, 0x88, 0x11, 0x81, 0x10, 0xB0, 0x01, 0x11, 0xD0, 0x02, 0x11, 
+    0x10, 0xF0, 0x01, 0x01, 0x14, 0x42, 0x07, 0x71, 0x91, 0xC0, 0x00, 0x46, 0x00, 0x00, 0xC1, 0xD0, 
+    0x03, 0xEE, 0xBB, 0xF1, 0x00, 0x0D, 0x7D, 0xED, 0xEE, 0xCC, 0xC7, 0x74, 0x44, 0xA7, 0x01, 0x81, 
+    0xF0, 0x00, 0xA1, 0xE0, 0x43, 0x04, 0x11, 0x81, 0x10, 0xA0, 0xF1, 0x03, 0xF0, 0x03, 0x0E, 0x1C, 
+    0xED, 0xDC, 0x00, 0x01, 0x11, 0x00, 0x00, 0x46, 0x01, 0x00, 0xB1, 0xC0, 0x06, 0xD6, 0xDE, 0x91, 
+    0x80, 0xC1, 0x08, 0xCD, 0xEE, 0xBE, 0xB7, 0x40, 0x43, 0xC4, 0x02, 0x14, 0x80, 0xD0, 0x44, 0x00, 
+    0x10, 0xB0, 0x01, 0x18, 0xA1, 0xA0, 0xF1, 0x00, 0x01, 0x88, 0xB1, 0xF0, 0x03, 0x04, 0xBE, 0xDD, 
+    0x90, 0x44, 0xB1, 0x05, 0x80, 0x00, 0x10, 0xF1, 0x04, 0x0E, 0xDD, 0xDE, 0xC0, 0x00, 0x1C, 0x77, 
+    0xCE, 0xD0, 0xAE, 0x03, 0xC1, 0x74, 0xF7, 0x00, 0x02, 0x41, 0x10, 0xB0, 0xA1, 0x11, 0x01, 0x10, 
+    0x18, 0x11, 0x18, 0x44, 0x77, 0x44, 0x81, 0xA0, 0xC1, 0xB4, 0x4E, 0x0A, 0x9D, 0xDD, 0x81, 0x11, 
+    0x00, 0x00, 0xC1, 0x02, 0x90, 0x00, 0xC1, 0x20, 0x84, 0x44, 0x81, 0x11, 0x8D, 0x6D, 0xEE, 0xB9, 
+    0x00, 0x96, 0xBC, 0xBE, 0xDB, 0xEE, 0x11, 0x77, 0x40, 0xD7, 0x00, 0x40, 0xA1, 0x02, 0x00, 0x00, 
+    0xA1, 0x13, 0x88, 0x87, 0x84, 0x47, 0x77, 0xC5, 0x55, 0x77, 0x74, 0x11, 0xA0, 0x0C, 0x11, 0x84, 
+    0x7C, 0x55, 0x50, 0x74, 0x80, 0xF0, 0x04, 0x03, 0x8E, 0xDC, 0x45, 0xB0, 0x05, 0x10, 0x01, 0x18, 
+    0xF4, 0x04, 0xA6, 0x24, 0xDD, 0xDB, 0x10, 0x17, 0xBE, 0x98, 0xEC, 0x91, 0x17, 0xC9, 0x14, 0x77, 
+    0x78, 0x88, 0x11, 0x01, 0x11, 0x87, 0x40, 0xA8, 0x05, 0x47, 0x74, 0x77, 0xC5, 0x04, 0xC7, 0x41, 
+    0x10, 0xD0, 0x0B, 0x84, 0x70, 0x50, 0x74, 0x88, 0x11, 0xB0, 0x00, 0x10, 0xD0, 0x0C, 0xCE, 0x18, 
+    0x41, 0x10, 0x11, 0x88, 0x10, 0xC0, 0x05, 0x87, 0x47, 0x77, 0xB4, 0x02, 0x77, 0x70, 0x43, 0x19, 
+    0x66, 0xD6, 0xB0, 0x01, 0xBC, 0x10, 0x99, 0x77, 0x7B, 0xCB, 0x98, 0x77, 0x71, 0xC0, 0x0C, 0x17, 
+    0x47, 0x44, 0x48, 0x14, 0x75, 0xC0, 0xD5, 0x04, 0x41, 0x11, 0x80, 0x46, 0x09, 0x14, 0x40, 0x74, 
+    0x17, 0x10, 0x45, 0xE0, 0x06, 0xCC, 0x18, 0x77, 0x80, 0xE1, 0x00, 0x80, 0xB1, 0x05, 0x44, 0x47, 
+    0x7C, 0xB7, 0x01, 0x91, 0xF6, 0x00, 0x13, 0xB8, 0x96, 0x99, 0x00, 0x17, 0x75, 0xB7, 0x99, 0xC5, 
+    0x71, 0xD0, 0x0C, 0x18, 0x77, 0x44, 0x74, 0x77, 0x44, 0x70, 0xC5, 0x04, 0xC4, 0x88, 0x10, 0xD0, 
+    0x06, 0x18, 0x77, 0x74, 0x10, 0xE0, 0x10, 0x18, 0x10, 0x01, 0x00, 0x11, 0x10, 0xC9, 0x00, 0x00, 
+    0xA1, 0x06, 0x88, 0x11, 0x10, 0x00, 0xA1, 0x06, 0x88, 0x1C, 0x74, 0x40, 0xD7, 0x03, 0x66, 0x6B, 
+    0xB6, 0x05, 0x0F, 0x7D, 0xB9, 0xB0, 0x21, 0x77, 0x00, 0x7D, 0xC8, 0x01, 0x00, 0x08, 0x99, 0x84, 
+    0x77, 0x74, 0x77, 0x55, 0x75, 0x75, 0x74, 0x47, 0xA5, 0x00, 0x40, 0xE0, 0x05, 0x18, 0x44, 0x11, 
+    0xD0, 0x03, 0x19, 0x79, 0xB1, 0x06, 0x84, 0x90, 0x0C, 0x80, 0x45, 0xB1, 0x11, 0x00, 0x01, 0x18, 
+    0x78, 0x9B, 0x87, 0x78, 0x84, 0x88, 0x43, 0xC6, 0x0C, 0x0F, 0xB6, 0x6B, 0x90, 0x00, 0x7B, 0xB0, 
+    0xA0, 0x01, 0x11, 0xA9, 0xAC, 0x04, 0x87, 0x77, 0x00, 0xA5, 0x00, 0x40, 0xA1, 0x15, 0x00, 0x04, 
+    0x74, 0x77, 0x10, 0x08, 0x77, 0x81, 0x88, 0x11, 0x10, 0x45, 0x06, 0x18, 0x11, 0x98, 0x80, 0x42, 
+    0x01, 0x10, 0x42, 0x03, 0x11, 0x18, 0xD1, 0x13, 0x81, 0x10, 0x00, 0x18, 0x89, 0xC7, 0xC7, 0x77, 
+    0x41, 0x8E, 0x45, 0x11, 0x0B, 0x66, 0x00, 0x66, 0x6B, 0x00, 0x97, 0x9B, 0x79, 0xF0, 0x00, 0x1E, 
+    0x97, 0xC7, 0x77, 0x47, 0x74, 0x55, 0x57, 0x14, 0x78, 0x81, 0x85, 0x74, 0x10, 0x14, 0x55, 0x70, 
+    0xC1, 0xE0, 0x15, 0x11, 0x00, 0x01, 0x88, 0x18, 0x79, 0x10, 0x11, 0xC8, 0x18, 0x97, 0xA8, 0x00, 
+    0x10, 0xC8, 0x0F, 0x10, 0x01, 0x11, 0xEC, 0xCC, 0x55, 0x71, 0x15, 0x46, 0x07, 0x00, 0x66, 0x6E, 
+    0xB9, 0xB0, 0x04, 0xDB, 0xBB, 0x90, 0xF0, 0x03, 0x08, 0x97, 0x74, 0x11, 0x44, 0x00, 0xB5, 0x07, 
+    0x47, 0x54, 0x11, 0x01, 0xA4, 0x00, 0x80, 0xB1, 0xD0, 0x01, 0x11, 0xB0, 0xA1, 0x0A, 0x88, 0x18, 
+    0x81, 0x1C, 0x10, 0x10, 0xC8, 0x02, 0x11, 0x10, 0xA8, 0x07, 0x98, 0x98, 0x11, 0xC7, 0xB5, 0x03, 
+    0x8C, 0xDC, 0xF6, 0x02, 0xB0, 0x06, 0xFF, 0x0B, 0x6E, 0xE0, 0x4C, 0xC0, 0x03, 0x11, 0x17, 0xC5, 
+    0x11, 0x44, 0x71, 0x00, 0x18, 0x47, 0xC7, 0x81, 0x11, 0x81, 0xF0, 0x05, 0x1D, 0x10, 0x10, 0x81, 
+    0x01, 0x07, 0x81, 0x00, 0x01, 0x18, 0x11, 0x98, 0x18, 0x11, 0x87, 0x97, 0x45, 0x02, 0xC7, 0x70, 
+    0x4E, 0x00, 0xB0, 0xB0, 0x07, 0x66, 0xEE, 0x71, 0x99, 0xF0, 0x0A, 0x04, 0x90, 0xB8, 0x80, 0xB7, 
+    0x10, 0xC9, 0x00, 0x17, 0x05, 0x57, 0x81, 0x11, 0x09, 0x90, 0xF0, 0x07, 0x06, 0x10, 0x01, 0x18, 
+    0x80, 0xB1, 0x1A, 0x00, 0x01, 0x87, 0x98, 0x87, 0x70, 0x97, 0x18, 0xC8, 0x75, 0xC0, 0x09, 0xEE, 
+    0x70, 0xD6, 0x04, 0x06, 0x66, 0xB0, 0xB0, 0x0A, 0xB0, 0x66, 0x6B, 0x79, 0x0F, 0xF0, 0xF0, 0x0B, 
+    0x18, 0xFF, 0xBE, 0xEB, 0x7C, 0xBD, 0xD0, 0x01, 0x55, 0x54, 0x74, 0x11, 0xC7, 0x80, 0xF0, 0x00, 
+    0x01, 0x11, 0x44, 0x08, 0x91, 0x87, 0x98, 0x11, 0x80, 0x44, 0x02, 0x97, 0xC0, 0xA7, 0x0A, 0x97, 
+    0x80, 0x8C, 0x98, 0x79, 0x00, 0xB9, 0x03, 0x66, 0x60, 0xD6, 0x00, 0xF0, 0xB0, 0x00, 0xF0, 0x42, 
+    0x07, 0x66, 0x60, 0x00, 0xFF, 0xF0, 0x08, 0x1A, 0xFF, 0x0F, 0xFB, 0xBB, 0xDD, 0x66, 0xD1, 0x00, 
+    0x75, 0x55, 0x44, 0x5C, 0x44, 0xC0, 0xF0, 0x00, 0x42, 0x01, 0x18, 0xB7, 0x05, 0x98, 0x89, 0x98, 
+    0xC1, 0x0E, 0x87, 0x7C, 0xC7, 0x77, 0x91, 0x18, 0x7E, 0xC0, 0xA9, 0x00, 0x00, 0x43, 0xF6, 0x01, 
+    0xD0, 0x01, 0x60, 0x43, 0x03, 0xBB, 0xFF, 0xA0, 0x02, 0xFF, 0x00, 0xFF, 0x06, 0x0B, 0x00, 0xBE, 
+    0xE6, 0x66, 0x10, 0x0C, 0xB5, 0x03, 0x47, 0x57, 0x48, 0xB7, 0x0C, 0xCC, 0x74, 0x47, 0x98, 0x77, 
+    0x88, 0x90, 0xA8, 0x11, 0x11, 0x77, 0x87, 0x71, 0x19, 0xCC, 0xB9, 0x09, 0x90, 0xA9, 0xE6, 0x07, 
+    0xBF, 0x06, 0x66, 0x06, 0xA0, 0x01, 0xBB, 0xA6, 0x03, 0xBB, 0x0B, 0xEF, 0x01, 0x00, 0xCF, 0x03, 
+    0x0F, 0x00, 0xAF, 0x13, 0x90, 0xF9, 0xB6, 0x6D, 0x80, 0x07, 0x55, 0x57, 0x44, 0x41, 0xD0, 0x06, 
+    0x18, 0x88, 0x4C, 0xC0, 0xE7, 0x00, 0x40, 0xB7, 0x00, 0x40, 0xB7, 0x08, 0x81, 0x17, 0x11, 0x8C, 
+    0x90, 0xC0, 0x04, 0x99, 0xB0, 0x00, 0xE6, 0x01, 0x0B, 0xC6, 0x05, 0x06, 0x66, 0x09, 0xB6, 0xB0, 
+    0xAF, 0x10, 0x0F, 0xF0, 0x00, 0xF0, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0xCF, 0x0F, 0xBB, 0x6B, 0x90, 
+    0x07, 0x57, 0x44, 0x74, 0x10, 0xC1, 0x11, 0x47, 0x41, 0x47, 0x55, 0x57, 0x75, 0x55, 0x77, 0x7C, 
+    0xD7, 0x0C, 0x88, 0x11, 0x97, 0x87, 0xB9, 0x90, 0x00, 0xA9, 0xBB, 0xF6, 0x0B, 0x01, 0x00, 0x48, 
+    0x01, 0x00, 0x42, 0x00, 0x00, 0xAF, 0xF0, 0x01, 0x01, 0x6F, 0xA9, 0xAF, 0x04, 0x9B, 0x99, 0xB0, 
+    0xA7, 0x02, 0x17, 0x10, 0xB8, 0x04, 0x47, 0x54, 0x40, 0xC5, 0x07, 0x47, 0x57, 0x75, 0x55, 0xA7, 
+    0x0B, 0x99, 0x11, 0x00, 0x09, 0x99, 0xC7, 0xC9, 0x05, 0x77, 0xCC, 0xED, 0x53, 0xF6, 0x03, 0x09, 
+    0x00, 0xBB, 0x00, 0x0B, 0xFF, 0xF0, 0x01, 0x05, 0xFB, 0xFB, 0x09, 0xAF, 0x06, 0xB0, 0xEE, 0xBB, 
+    0x90, 0xA0, 0x08, 0x81, 0x11, 0x74, 0x74, 0x40, 0xF5, 0x03, 0x0C, 0x47, 0x05, 0x78, 0x77, 0x90, 
+    0x00, 0x90, 0xA0, 0x10, 0x99, 0x70, 0x77, 0x99, 0x7C, 0xC9, 0x89, 0x9C, 0x90, 0xF6, 0x12, 0x0F, 
+    0xB0, 0x6B, 0x06, 0x06, 0xB0, 0x06, 0x00, 0x0B, 0xE0, 0x07, 0xBF, 0xF0, 0x0F, 0x90, 0xAB, 0x09, 
+    0x06, 0x66, 0xDB, 0x99, 0x00, 0xC1, 0x03, 0x77, 0x14, 0xF5, 0x02, 0x08, 0x75, 0x55, 0x4C, 0x77, 
+    0x70, 0xC9, 0x00, 0x70, 0xAB, 0x0D, 0xEE, 0xEB, 0xEC, 0x99, 0x88, 0x99, 0x97, 0xF6, 0x12, 0x04, 
+    0x0B, 0x0B, 0xB0, 0xD6, 0x4A, 0xA0, 0x06, 0xBF, 0xB6, 0x60, 0x00, 0xC6, 0x04, 0xEE, 0xE7, 0x80, 
+    0xB1, 0x06, 0x78, 0x11, 0x1A, 0x40, 0xC5, 0x0E, 0x45, 0x5C, 0x77, 0xCE, 0xBB, 0xBE, 0xB9, 0x70, 
+    0xCB, 0x01, 0xEE, 0xAD, 0x02, 0xE9, 0x80, 0xC9, 0x00, 0xC0, 0xF6, 0x13, 0x07, 0xB9, 0x00, 0x06, 
+    0x60, 0xB6, 0x05, 0xB0, 0x0B, 0xBB, 0xD0, 0x03, 0xBB, 0x00, 0xF6, 0x01, 0x05, 0xEB, 0xBB, 0xC8, 
+    0xA1, 0x07, 0x81, 0x11, 0xA1, 0x14, 0xE5, 0x07, 0xCC, 0xCE, 0xBB, 0xEE, 0xAB, 0x00, 0xC0, 0xEB, 
+    0xAE, 0x08, 0xDC, 0x78, 0x99, 0x97, 0x90, 
+};
+
+const gfx_image_t STORY_FINAL_SCENE_IMG = {
+    .w = STORY_FINAL_SCENE_W, .h = STORY_FINAL_SCENE_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = STORY_FINAL_SCENE_PAL, .colors = STORY_FINAL_SCENE_PAL_SIZE,
+    .data = STORY_FINAL_SCENE_RLE, .size = STORY_FINAL_SCENE_RLE_SIZE,
 };
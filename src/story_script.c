@@ -0,0 +1,308 @@
+// Generated by story2bc.py from story_script.txt; edit the script, not this file.
+#include <stdint.h>
+#include "project.h"
+#include "cheevos.h"
+#include "lore_text.h"
+#include "story_script.h"
+#include "game_story_logo.h"
+#include "story_opening_scene.h"
+#include "story_final_scene.h"
+#include "you_died.h"
+#include "story_ch1.h"
+#include "story_ch2.h"
+#include "story_ch3.h"
+#include "story_ch4.h"
+#include "story_ch5.h"
+#include "story_ch6.h"
+#include "story_ch7.h"
+#include "story_ch8.h"
+#include "story_ch9.h"
+#include "story_ch10.h"
+#include "story_ch1_enemy.h"
+#include "story_ch2_enemy.h"
+#include "story_ch3_enemy.h"
+#include "story_ch4_enemy.h"
+#include "story_ch5_enemy.h"
+#include "story_ch6_enemy.h"
+#include "story_ch7_enemy.h"
+#include "story_ch8_enemy.h"
+#include "story_ch9_enemy.h"
+#include "story_ch10_enemy.h"
+
+const uint8_t g_story_bc[509] = {
+  /*     0 */ SOP_UNLOCK, ACH_STORY_START,
+  /*     2 */ SOP_SCREEN,
+  /*     3 */ SOP_DEFER, GFX_PRIO_ART,
+  /*     5 */ SOP_CLEAR,
+  /*     6 */ SOP_ART, 0, STORY_CENTER, STORY_CENTER,
+  /*    10 */ SOP_DEFER, STORY_DEFER_OFF,
+  /*    12 */ SOP_WAIT, SB16(5000),
+  /*    15 */ SOP_SCREEN,
+  /*    16 */ SOP_CLEAR,
+  /*    17 */ SOP_HEADER, SB16(0), SB16(COL_WHITE),
+  /*    22 */ SOP_MARK,
+  /*    23 */ SOP_LORE, LORE_STORY_PROLOGUE,
+  /*    25 */ SOP_TYPE, SB16(8000), 40,
+  /*    29 */ SOP_SCREEN,
+  /*    30 */ SOP_DEFER, GFX_PRIO_ART,
+  /*    32 */ SOP_CLEAR,
+  /*    33 */ SOP_ART, 1, STORY_CENTER, STORY_CENTER,
+  /*    37 */ SOP_DEFER, STORY_DEFER_OFF,
+  /*    39 */ SOP_WAIT, SB16(5000),
+  /*    42 */ SOP_CHAPTER, SB16(9), SB16(25), SB16(0), 4, 14,
+  /*    51 */ SOP_SCREEN,
+  /*    52 */ SOP_CLEAR,
+  /*    53 */ SOP_MARK,
+  /*    54 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*    59 */ SOP_LORE, LORE_STORY_CH1,
+  /*    61 */ SOP_TYPE, SB16(13000), 50,
+  /*    65 */ SOP_CALL, SB16(422),
+  /*    68 */ SOP_UNLOCK, ACH_CH1,
+  /*    70 */ SOP_UNLOCK, ACH_SCARECROW,
+  /*    72 */ SOP_SCREEN,
+  /*    73 */ SOP_LOOT,
+  /*    74 */ SOP_WAIT, SB16(5000),
+  /*    77 */ SOP_CHAPTER, SB16(35), SB16(58), SB16(15), 5, 15,
+  /*    86 */ SOP_SCREEN,
+  /*    87 */ SOP_CLEAR,
+  /*    88 */ SOP_MARK,
+  /*    89 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*    94 */ SOP_LORE, LORE_STORY_CH2,
+  /*    96 */ SOP_TYPE, SB16(13000), 50,
+  /*   100 */ SOP_CALL, SB16(422),
+  /*   103 */ SOP_UNLOCK, ACH_CH2,
+  /*   105 */ SOP_UNLOCK, ACH_TRAINING_DUMMY,
+  /*   107 */ SOP_SCREEN,
+  /*   108 */ SOP_LOOT,
+  /*   109 */ SOP_WAIT, SB16(5000),
+  /*   112 */ SOP_CHAPTER, SB16(64), SB16(80), SB16(30), 6, 16,
+  /*   121 */ SOP_SCREEN,
+  /*   122 */ SOP_CLEAR,
+  /*   123 */ SOP_MARK,
+  /*   124 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   129 */ SOP_LORE, LORE_STORY_CH3,
+  /*   131 */ SOP_TYPE, SB16(13000), 50,
+  /*   135 */ SOP_CALL, SB16(422),
+  /*   138 */ SOP_UNLOCK, ACH_CH3,
+  /*   140 */ SOP_UNLOCK, ACH_RAT_KING,
+  /*   142 */ SOP_SCREEN,
+  /*   143 */ SOP_LOOT,
+  /*   144 */ SOP_WAIT, SB16(5000),
+  /*   147 */ SOP_CHAPTER, SB16(89), SB16(107), SB16(45), 7, 17,
+  /*   156 */ SOP_SCREEN,
+  /*   157 */ SOP_CLEAR,
+  /*   158 */ SOP_MARK,
+  /*   159 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   164 */ SOP_LORE, LORE_STORY_CH4,
+  /*   166 */ SOP_TYPE, SB16(13000), 50,
+  /*   170 */ SOP_CALL, SB16(422),
+  /*   173 */ SOP_UNLOCK, ACH_CH4,
+  /*   175 */ SOP_UNLOCK, ACH_BANDITS,
+  /*   177 */ SOP_SCREEN,
+  /*   178 */ SOP_LOOT,
+  /*   179 */ SOP_WAIT, SB16(5000),
+  /*   182 */ SOP_CHAPTER, SB16(114), SB16(134), SB16(60), 8, 18,
+  /*   191 */ SOP_SCREEN,
+  /*   192 */ SOP_CLEAR,
+  /*   193 */ SOP_MARK,
+  /*   194 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   199 */ SOP_LORE, LORE_STORY_CH5,
+  /*   201 */ SOP_TYPE, SB16(13000), 50,
+  /*   205 */ SOP_CALL, SB16(422),
+  /*   208 */ SOP_UNLOCK, ACH_CH5,
+  /*   210 */ SOP_UNLOCK, ACH_KNIGHT,
+  /*   212 */ SOP_SCREEN,
+  /*   213 */ SOP_LOOT,
+  /*   214 */ SOP_WAIT, SB16(5000),
+  /*   217 */ SOP_CHAPTER, SB16(141), SB16(159), SB16(75), 9, 19,
+  /*   226 */ SOP_SCREEN,
+  /*   227 */ SOP_CLEAR,
+  /*   228 */ SOP_MARK,
+  /*   229 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   234 */ SOP_LORE, LORE_STORY_CH6,
+  /*   236 */ SOP_TYPE, SB16(13000), 50,
+  /*   240 */ SOP_CALL, SB16(422),
+  /*   243 */ SOP_UNLOCK, ACH_CH6,
+  /*   245 */ SOP_UNLOCK, ACH_CHAMPION,
+  /*   247 */ SOP_SCREEN,
+  /*   248 */ SOP_LOOT,
+  /*   249 */ SOP_WAIT, SB16(5000),
+  /*   252 */ SOP_CHAPTER, SB16(168), SB16(187), SB16(90), 10, 20,
+  /*   261 */ SOP_SCREEN,
+  /*   262 */ SOP_CLEAR,
+  /*   263 */ SOP_MARK,
+  /*   264 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   269 */ SOP_LORE, LORE_STORY_CH7,
+  /*   271 */ SOP_TYPE, SB16(13000), 50,
+  /*   275 */ SOP_CALL, SB16(422),
+  /*   278 */ SOP_UNLOCK, ACH_CH7,
+  /*   280 */ SOP_UNLOCK, ACH_SORCERER,
+  /*   282 */ SOP_SCREEN,
+  /*   283 */ SOP_LOOT,
+  /*   284 */ SOP_WAIT, SB16(5000),
+  /*   287 */ SOP_CHAPTER, SB16(196), SB16(218), SB16(100), 11, 21,
+  /*   296 */ SOP_SCREEN,
+  /*   297 */ SOP_CLEAR,
+  /*   298 */ SOP_MARK,
+  /*   299 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   304 */ SOP_LORE, LORE_STORY_CH8,
+  /*   306 */ SOP_TYPE, SB16(13000), 50,
+  /*   310 */ SOP_CALL, SB16(422),
+  /*   313 */ SOP_UNLOCK, ACH_CH8,
+  /*   315 */ SOP_UNLOCK, ACH_DRAGON,
+  /*   317 */ SOP_SCREEN,
+  /*   318 */ SOP_LOOT,
+  /*   319 */ SOP_WAIT, SB16(5000),
+  /*   322 */ SOP_CHAPTER, SB16(225), SB16(244), SB16(130), 12, 22,
+  /*   331 */ SOP_SCREEN,
+  /*   332 */ SOP_CLEAR,
+  /*   333 */ SOP_MARK,
+  /*   334 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   339 */ SOP_LORE, LORE_STORY_CH9,
+  /*   341 */ SOP_TYPE, SB16(13000), 50,
+  /*   345 */ SOP_CALL, SB16(422),
+  /*   348 */ SOP_UNLOCK, ACH_CH9,
+  /*   350 */ SOP_UNLOCK, ACH_DEMON_KING,
+  /*   352 */ SOP_SCREEN,
+  /*   353 */ SOP_LOOT,
+  /*   354 */ SOP_WAIT, SB16(5000),
+  /*   357 */ SOP_CHAPTER, SB16(255), SB16(274), SB16(1), 13, 23,
+  /*   366 */ SOP_SCREEN,
+  /*   367 */ SOP_CLEAR,
+  /*   368 */ SOP_MARK,
+  /*   369 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   374 */ SOP_LORE, LORE_STORY_CH10,
+  /*   376 */ SOP_TYPE, SB16(13000), 50,
+  /*   380 */ SOP_CALL, SB16(422),
+  /*   383 */ SOP_UNLOCK, ACH_CH10,
+  /*   385 */ SOP_UNLOCK, ACH_GAME_ADMIN,
+  /*   387 */ SOP_SCREEN,
+  /*   388 */ SOP_LOOT,
+  /*   389 */ SOP_WAIT, SB16(5000),
+  /*   392 */ SOP_SCREEN,
+  /*   393 */ SOP_CLEAR,
+  /*   394 */ SOP_HEADER, SB16(305), SB16(COL_WHITE),
+  /*   399 */ SOP_LORE, LORE_STORY_EPILOGUE,
+  /*   401 */ SOP_TYPE, SB16(8000), 80,
+  /*   405 */ SOP_SCREEN,
+  /*   406 */ SOP_CLEAR,
+  /*   407 */ SOP_MARK,
+  /*   408 */ SOP_DEFER, GFX_PRIO_ART,
+  /*   410 */ SOP_ART, 2, STORY_CENTER, STORY_CENTER,
+  /*   414 */ SOP_DEFER, STORY_DEFER_OFF,
+  /*   416 */ SOP_UNLOCK, ACH_STORY_CLEAR,
+  /*   418 */ SOP_WAIT, SB16(5000),
+  /*   421 */ SOP_END,
+  /*   422 */ SOP_SCREEN,
+  /*   423 */ SOP_DEFER, GFX_PRIO_ART,
+  /*   425 */ SOP_CLEAR,
+  /*   426 */ SOP_ART, STORY_IMG_ART, STORY_CENTER, 20,
+  /*   430 */ SOP_DEFER, GFX_PRIO_HUD,
+  /*   432 */ SOP_HEADER, SB16(0xFFFF), SB16(COL_WHITE),
+  /*   437 */ SOP_BAR, 0, 104, 128, 24, SB16(COL_DKGRAY),
+  /*   444 */ SOP_FOE, 1, 106, SB16(COL_YELLOW),
+  /*   449 */ SOP_TEXT, 1, 118, SB16(314), SB16(COL_WHITE), 1,
+  /*   457 */ SOP_DEFER, STORY_DEFER_OFF,
+  /*   459 */ SOP_WAIT, SB16(7000),
+  /*   462 */ SOP_SCREEN,
+  /*   463 */ SOP_CHOOSE, SB16(5000),
+  /*   466 */ SOP_SCREEN,
+  /*   467 */ SOP_BATTLE, SB16(5000),
+  /*   470 */ SOP_SCREEN,
+  /*   471 */ SOP_RESULT, SB16(2000), SB16(477),
+  /*   476 */ SOP_RET,
+  /*   477 */ SOP_SCREEN,
+  /*   478 */ SOP_DEFER, GFX_PRIO_ART,
+  /*   480 */ SOP_CLEAR,
+  /*   481 */ SOP_ART, 3, STORY_CENTER, STORY_CENTER,
+  /*   485 */ SOP_DEFER, GFX_PRIO_HUD,
+  /*   487 */ SOP_TEXT, 10, 110, SB16(343), SB16(COL_RED), 1,
+  /*   495 */ SOP_DEFER, STORY_DEFER_OFF,
+  /*   497 */ SOP_WAIT, SB16(3000),
+  /*   500 */ SOP_DIED, SB16(422),
+  /*   503 */ SOP_SCREEN,
+  /*   504 */ SOP_GIVEUP, SB16(5000), SB16(422),
+};
+
+const uint16_t g_story_bc_len = 509u;
+
+const char g_story_str[] =
+  /*     0 */ "Prologue" "\0"
+  /*     9 */ "Ch.1: Awakening" "\0"
+  /*    25 */ "Scarecrow" "\0"
+  /*    35 */ "Ch.2: Training Grounds" "\0"
+  /*    58 */ "Dummy" "\0"
+  /*    64 */ "Ch.3: Catacombs" "\0"
+  /*    80 */ "Rat King" "\0"
+  /*    89 */ "Ch.4: Ambush Road" "\0"
+  /*   107 */ "Bandit" "\0"
+  /*   114 */ "Ch.5: Tourney Field" "\0"
+  /*   134 */ "Knight" "\0"
+  /*   141 */ "Ch.6: Grand Arena" "\0"
+  /*   159 */ "Champion" "\0"
+  /*   168 */ "Ch.7: Arcane Tower" "\0"
+  /*   187 */ "Sorcerer" "\0"
+  /*   196 */ "Ch.8: Dragon\342\200\231s Lair" "\0"
+  /*   218 */ "Dragon" "\0"
+  /*   225 */ "Ch.9: Demon Castle" "\0"
+  /*   244 */ "Demon King" "\0"
+  /*   255 */ "Ch.10: G?ME? AD?\?N" "\0"
+  /*   274 */ "H?: 99999999999999999999999999" "\0"
+  /*   305 */ "Epilogue" "\0"
+  /*   314 */ "Choose an item (A/B) with Hz" "\0"
+  /*   343 */ "Too many deaths..." "\0"
+  ;
+
+const gfx_image_t *const g_story_img[24] = {
+  &GAME_STORY_LOGO_IMG,
+  &STORY_OPENING_SCENE_IMG,
+  &STORY_FINAL_SCENE_IMG,
+  &YOU_DIED_IMG,
+  &STORY_CH1_IMG,
+  &STORY_CH2_IMG,
+  &STORY_CH3_IMG,
+  &STORY_CH4_IMG,
+  &STORY_CH5_IMG,
+  &STORY_CH6_IMG,
+  &STORY_CH7_IMG,
+  &STORY_CH8_IMG,
+  &STORY_CH9_IMG,
+  &STORY_CH10_IMG,
+  &STORY_CH1_ENEMY_IMG,
+  &STORY_CH2_ENEMY_IMG,
+  &STORY_CH3_ENEMY_IMG,
+  &STORY_CH4_ENEMY_IMG,
+  &STORY_CH5_ENEMY_IMG,
+  &STORY_CH6_ENEMY_IMG,
+  &STORY_CH7_ENEMY_IMG,
+  &STORY_CH8_ENEMY_IMG,
+  &STORY_CH9_ENEMY_IMG,
+  &STORY_CH10_ENEMY_IMG,
+};
+
+const uint16_t g_story_img_key[24] = {
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  GFX_KEY_NONE,
+  STORY_CH1_ENEMY_KEY,
+  STORY_CH2_ENEMY_KEY,
+  STORY_CH3_ENEMY_KEY,
+  STORY_CH4_ENEMY_KEY,
+  STORY_CH5_ENEMY_KEY,
+  STORY_CH6_ENEMY_KEY,
+  STORY_CH7_ENEMY_KEY,
+  STORY_CH8_ENEMY_KEY,
+  STORY_CH9_ENEMY_KEY,
+  STORY_CH10_ENEMY_KEY,
+};
@@ -6,389 +6,202 @@ const uint16_t TEAM_PAL[TEAM_PAL_SIZE] = {
     0x5227, 0x41E6, 0xCC8E, 0x3A07, 0x3A08, 0x39E8, 0xD636, 0xCDD4, 
 };
 
-const uint8_t TEAM_IDX[(TEAM_W * TEAM_H) / 2] = {
-    0x77, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x63, 
-    0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0x33, 0x6E, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x22, 0x22, 0x22, 
-    0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE6, 
-    0x63, 0x33, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x22, 0x22, 0x22, 
-    0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE6, 0x66, 
-    0x66, 0x36, 0x33, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x22, 0x22, 0x22, 
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 
-    0x63, 0x33, 0x33, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0xE6, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x22, 0x22, 0x22, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 
-    0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x22, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE6, 0x66, 
-    0x66, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x24, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 
-    0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0xE6, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x24, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x63, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x66, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x22, 0x22, 0x25, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 
-    0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x63, 0x33, 0x36, 0x36, 0x66, 0x3E, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x25, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE6, 0xEE, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x36, 0x66, 0x66, 0x6E, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x22, 0x25, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x6E, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x33, 0x66, 0x66, 0x6E, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x2F, 0x24, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE6, 0xEE, 0x66, 
-    0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x66, 0x6E, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE6, 0x6E, 0x36, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x33, 0x36, 0x66, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0x55, 0xFE, 0xEE, 0xEE, 0xE6, 0x6E, 0x63, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x33, 0x66, 0x66, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xEF, 0xFF, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x41, 0x11, 0x11, 0x2E, 0xEE, 0xE6, 0x6E, 0x66, 
-    0x63, 0x33, 0x33, 0x33, 0x36, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33, 0x66, 0x66, 0x66, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0x21, 0x14, 0x2E, 0xFF, 0xFE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x62, 0x11, 0x11, 0x11, 0x12, 0x6E, 0xE6, 0x6E, 0x66, 
-    0x66, 0x33, 0x36, 0x36, 0x66, 0x66, 0x63, 0x33, 0x63, 0x33, 0x33, 0x33, 0x66, 0x66, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x11, 0x1B, 0x11, 0x12, 0xEF, 0xFE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x21, 0x11, 0x11, 0x11, 0x11, 0xFE, 0xE6, 0x6E, 0x66, 
-    0x63, 0x33, 0x66, 0x66, 0x33, 0x63, 0x33, 0x33, 0x63, 0x33, 0x33, 0x36, 0x36, 0x66, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x11, 0x11, 0x11, 0x11, 0x5E, 0xFF, 0xFE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x21, 0x11, 0x11, 0x11, 0x11, 0x26, 0xEE, 0xEE, 0x66, 
-    0x66, 0xE6, 0x66, 0x3E, 0x21, 0x12, 0xF6, 0x36, 0x66, 0x33, 0x66, 0x66, 0x66, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x11, 0x44, 0x11, 0x11, 0x12, 0xEF, 0xFE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xF1, 0x14, 0x55, 0x41, 0x11, 0x1E, 0xEE, 0xEE, 0xEE, 
-    0x6E, 0xEE, 0xEE, 0xF1, 0x11, 0x11, 0x11, 0xE6, 0x66, 0x66, 0x66, 0x66, 0x6E, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xE2, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x14, 0x55, 0x51, 0x11, 0x11, 0xEF, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x21, 0x15, 0xA7, 0xA5, 0x41, 0x1E, 0xEE, 0x66, 0x66, 
-    0x66, 0x66, 0x63, 0x51, 0x11, 0x11, 0x11, 0x23, 0x33, 0x33, 0x33, 0x33, 0x36, 0x66, 0xEE, 0xEE, 
-    0x62, 0x11, 0x11, 0x11, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x49, 0x44, 0x4A, 0x77, 0x54, 0x11, 0xFF, 0xFE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0x41, 0x11, 0x45, 0x55, 0x11, 0xFE, 0xEE, 0xE6, 0x66, 
-    0x66, 0x66, 0x6E, 0x11, 0x11, 0x14, 0x11, 0x53, 0x63, 0x33, 0x33, 0x33, 0x3E, 0x66, 0xEE, 0xE6, 
-    0x51, 0x11, 0x11, 0x11, 0x01, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x21, 0x41, 0x14, 0x54, 0x45, 0x11, 0xFF, 0xFE, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xF2, 0x41, 0x41, 0x15, 0x11, 0x11, 0xFE, 0xEE, 0xE6, 0x66, 
-    0x66, 0x6E, 0x62, 0x11, 0x45, 0x54, 0x41, 0x1E, 0x63, 0x33, 0x33, 0x33, 0x3E, 0x66, 0xEE, 0x62, 
-    0x11, 0x14, 0x54, 0x11, 0x11, 0x2E, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0x14, 0x14, 0x41, 0x14, 0x15, 0xFF, 0xFF, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0x22, 0x41, 0x55, 0x5A, 0x54, 0x44, 0xFE, 0xEE, 0xE6, 0x66, 
-    0x66, 0x6E, 0x62, 0x11, 0x14, 0x41, 0x11, 0x1E, 0x36, 0x33, 0x63, 0x33, 0x66, 0xEE, 0xEE, 0x65, 
-    0xD1, 0x45, 0x25, 0x41, 0x10, 0x2E, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x54, 0x44, 0x44, 0x54, 0x44, 0x45, 0xFF, 0xFF, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE7, 0x25, 0x41, 0x45, 0x45, 0xA7, 0x42, 0xEE, 0xEE, 0xEE, 0x66, 
-    0x66, 0x6E, 0x65, 0x11, 0x14, 0x44, 0x41, 0x1E, 0x66, 0x66, 0x63, 0x36, 0x6E, 0xEE, 0xEE, 0x62, 
-    0x11, 0x41, 0x54, 0x11, 0x11, 0x2E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x22, 0x24, 0x44, 0x44, 0x54, 0x55, 0x42, 0xFF, 0xFF, 0xEE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xF2, 0x24, 0x41, 0x11, 0x11, 0x45, 0x42, 0xEE, 0xEE, 0xEE, 0xE6, 
-    0x66, 0xEE, 0xE1, 0x14, 0x44, 0x44, 0x44, 0x4E, 0x66, 0x66, 0x66, 0x33, 0x6E, 0xEE, 0xEE, 0xE2, 
-    0x14, 0x11, 0x41, 0x14, 0x11, 0x2E, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x72, 0x22, 0x25, 0x44, 0x44, 0x44, 0x44, 0x57, 0x77, 0xFF, 0xFE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0x72, 0x24, 0x11, 0x14, 0x44, 0x41, 0x42, 0xEE, 0xEE, 0xEE, 0xE6, 
-    0x66, 0xEE, 0xF1, 0x14, 0x41, 0x44, 0x44, 0x56, 0x66, 0x66, 0x66, 0x66, 0x6E, 0xEE, 0xEE, 0x62, 
-    0x14, 0x54, 0x54, 0x54, 0x11, 0x2E, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 
-    0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x22, 0x22, 0x55, 0x44, 0x44, 0x44, 0x44, 0x2F, 0x77, 0xFF, 0xFE, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0x72, 0x24, 0x11, 0x11, 0x44, 0x11, 0x22, 0xEE, 0xEE, 0xEE, 0xE6, 
-    0x66, 0xEE, 0xF1, 0x14, 0x11, 0x44, 0x44, 0x26, 0x66, 0x63, 0x66, 0x66, 0x66, 0x6E, 0xEE, 0xE2, 
-    0x44, 0x44, 0x44, 0x44, 0x14, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 
-    0xFF, 0xFF, 0xFF, 0x77, 0x22, 0x22, 0x55, 0x55, 0x54, 0x44, 0x44, 0x44, 0x22, 0x27, 0x7F, 0xFF, 
-    0xFF, 0xEE, 0xEE, 0xEF, 0xF7, 0x22, 0x25, 0x11, 0x19, 0x11, 0x11, 0x2E, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0x6E, 0x24, 0x11, 0x44, 0x44, 0x41, 0x5E, 0x66, 0x66, 0x66, 0x66, 0x6E, 0x6E, 0xEE, 0xEF, 
-    0x44, 0x14, 0x44, 0x14, 0x12, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x11, 
-    0xFF, 0xFF, 0xFF, 0x77, 0x22, 0x22, 0x25, 0x55, 0x51, 0x44, 0x44, 0x14, 0xF2, 0x77, 0xFF, 0xFF, 
-    0xFF, 0xFE, 0xEE, 0xEF, 0xFF, 0x72, 0x51, 0x01, 0x11, 0x11, 0x41, 0x15, 0xFE, 0xEE, 0xEE, 0xE6, 
-    0x66, 0x6E, 0xF4, 0x11, 0x14, 0x44, 0x41, 0x26, 0x63, 0x33, 0x66, 0x66, 0x66, 0x6E, 0xEE, 0xEF, 
-    0x24, 0x44, 0x74, 0x41, 0x52, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xF2, 0x11, 
-    0xFF, 0xFF, 0xF7, 0x72, 0x22, 0x22, 0x55, 0x55, 0x48, 0x41, 0x11, 0x41, 0x2F, 0x27, 0xFF, 0xFF, 
-    0xEE, 0xEE, 0xEE, 0xEE, 0xE7, 0x21, 0x10, 0x00, 0x11, 0x14, 0x41, 0xB0, 0x15, 0x2E, 0x6E, 0xE6, 
-    0x66, 0x6E, 0xF2, 0x11, 0x11, 0x11, 0x15, 0xF6, 0x66, 0x33, 0x66, 0x66, 0x66, 0x66, 0xEE, 0xF2, 
-    0x24, 0x44, 0x44, 0x41, 0x52, 0x2F, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xF2, 0x11, 
-    0xFF, 0xFF, 0x77, 0x22, 0x22, 0x22, 0x25, 0x51, 0x80, 0x81, 0x14, 0x49, 0x12, 0x7F, 0x77, 0xFF, 
-    0xFE, 0xEE, 0xEE, 0xEF, 0x41, 0x00, 0x00, 0x00, 0x01, 0x11, 0x80, 0x11, 0x80, 0x81, 0x2E, 0xEE, 
-    0xEE, 0xEE, 0xE2, 0x12, 0x51, 0x11, 0x53, 0xE6, 0x66, 0x33, 0x66, 0x66, 0x66, 0x6E, 0xEE, 0xF2, 
-    0x24, 0x14, 0x41, 0x11, 0x42, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xF2, 0x11, 
-    0xFF, 0xFF, 0x77, 0x22, 0x22, 0x25, 0x11, 0x00, 0x00, 0x09, 0x11, 0x00, 0x00, 0x12, 0xFF, 0x7F, 
-    0xFE, 0xEE, 0xEE, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x81, 0x11, 0x10, 0x12, 0xEE, 
-    0x66, 0x6E, 0xE2, 0x26, 0x3F, 0x52, 0x33, 0x33, 0x33, 0x36, 0x66, 0x66, 0x66, 0x6E, 0xEE, 0xF2, 
-    0x24, 0x11, 0x11, 0x11, 0x12, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x22, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 
-    0xFF, 0xEE, 0xEE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x11, 0x11, 0x01, 0x6E, 
-    0x66, 0x66, 0x33, 0x33, 0x33, 0xEE, 0x33, 0x33, 0x33, 0x33, 0x36, 0x66, 0x66, 0x66, 0xEE, 0xF2, 
-    0x22, 0x11, 0x11, 0x11, 0x1E, 0x22, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x22, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 
-    0xFF, 0xFE, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x98, 0x81, 0x11, 0x11, 0xEE, 
-    0xE3, 0x33, 0x33, 0x33, 0xEF, 0x33, 0x2E, 0x33, 0x33, 0x33, 0x33, 0x66, 0x66, 0x66, 0xEE, 0xEE, 
-    0x3E, 0x41, 0x11, 0x41, 0xF3, 0x3E, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x72, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x7F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x88, 0x11, 0x1C, 0x2E, 
-    0x33, 0x33, 0x33, 0x33, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x66, 0x66, 0x6E, 0x63, 0x33, 
-    0x33, 0xF4, 0x44, 0x4F, 0x33, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0x77, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x4F, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x08, 0x1B, 0x12, 
-    0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0xE6, 0x66, 0x63, 0x33, 0x33, 
-    0x33, 0x32, 0x55, 0x2E, 0x33, 0x33, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x72, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x12, 
-    0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0xE6, 0x63, 0x33, 0x33, 0x33, 
-    0x3E, 0x22, 0xF2, 0x2F, 0xE3, 0x33, 0x33, 0x33, 0x3E, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0xF2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x12, 
-    0xE3, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEE, 0x63, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0xF2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x05, 
-    0xEE, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x3E, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
-    0xE2, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x3E, 0x33, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFE, 0xEE, 0xEE, 0xEF, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x01, 
-    0xE2, 0x2E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0xE3, 0xE2, 0x33, 0x3E, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFE, 0xEE, 0xEE, 0xEE, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x25, 0x11, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x15, 
-    0xFF, 0x2E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x2E, 0x2E, 0xE3, 0xEF, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x33, 0xFE, 0xEE, 0xEE, 0xEE, 0xFF, 0xE2, 0x11, 
-    0xFF, 0xF7, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x55, 0x11, 0x84, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5A, 0x54, 0x12, 
-    0x22, 0x52, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x22, 0x2E, 0x3E, 0x33, 0xFE, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0x3E, 0x33, 0x33, 0xFE, 0xEE, 0xEE, 0xEE, 0xFE, 0xE2, 0x11, 
-    0xEF, 0x77, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x54, 0x11, 0x84, 0x45, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x54, 0x42, 
-    0x22, 0x52, 0x2E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0xEF, 0x22, 0xF3, 0x33, 0x33, 0x2F, 0x33, 
-    0x33, 0x33, 0x33, 0x33, 0x33, 0xEF, 0x33, 0x33, 0x33, 0xFE, 0xEE, 0xEE, 0xEE, 0xFE, 0xE2, 0x11, 
-    0xF7, 0x72, 0x25, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x51, 0x11, 0x84, 0x45, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x45, 0x44, 0x22, 
-    0x25, 0x52, 0x22, 0xEE, 0xEE, 0xE3, 0x33, 0xEF, 0xFE, 0xF2, 0x5F, 0x32, 0xE3, 0x33, 0x22, 0xEF, 
-    0xE3, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x3E, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE5, 0x11, 
-    0xF7, 0x72, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x84, 0x44, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44, 0x44, 0x22, 
-    0x25, 0x22, 0x22, 0x3E, 0x33, 0x33, 0x33, 0x33, 0xEF, 0xF2, 0x5E, 0x24, 0x44, 0x44, 0x52, 0xFF, 
-    0x33, 0x33, 0x33, 0x33, 0x3E, 0xFE, 0xEE, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE5, 0x11, 
-    0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x84, 0x44, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x2F, 
-    0x21, 0x52, 0xFE, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x22, 0x25, 0x24, 0x44, 0x44, 0x4F, 0x2E, 
-    0x33, 0x33, 0x33, 0x33, 0xEE, 0x2E, 0xE3, 0x33, 0x33, 0x3E, 0xEE, 0xEE, 0xEE, 0xEE, 0xF5, 0x11, 
-    0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x88, 0x44, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44, 0x44, 0xFE, 
-    0x21, 0x55, 0x2E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3E, 0xF2, 0x22, 0xE4, 0x44, 0x44, 0x5F, 0xF3, 
-    0x33, 0x33, 0x33, 0x33, 0xEE, 0x2E, 0x25, 0x25, 0x54, 0x4F, 0xEE, 0xEE, 0xEE, 0xEE, 0xF4, 0x11, 
-    0x72, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x14, 0x11, 0x18, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x44, 0x44, 0xEE, 
-    0x21, 0x22, 0x22, 0x63, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x11, 0x24, 0x44, 0x41, 0x22, 0xE3, 
-    0x33, 0x33, 0x33, 0x33, 0xEE, 0x2E, 0x21, 0x44, 0x41, 0x1F, 0xEE, 0xEE, 0xEE, 0xEE, 0xF5, 0x11, 
-    0x72, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x15, 0x11, 0x19, 0x84, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44, 0x44, 0x42, 0xEF, 
-    0x24, 0xE2, 0xEE, 0x22, 0xE3, 0x33, 0x33, 0x33, 0x33, 0xE3, 0x54, 0x24, 0x44, 0x41, 0x2F, 0x3E, 
-    0xE3, 0x33, 0xE3, 0x3E, 0xEF, 0x2F, 0x21, 0x44, 0x41, 0x4F, 0xFE, 0xEE, 0xEE, 0xEE, 0xF4, 0x11, 
-    0x72, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x45, 0x11, 0x18, 0x84, 0x44, 0x90, 0x00, 0x00, 0x00, 0x00, 0x84, 0x44, 0x41, 0x1F, 0x33, 
-    0xF5, 0x53, 0xE3, 0x33, 0xF6, 0x33, 0x33, 0xEF, 0xE3, 0x3E, 0x22, 0xF5, 0x14, 0x44, 0x5F, 0xEE, 
-    0xEE, 0x3E, 0xE3, 0x3E, 0xEF, 0x2F, 0x21, 0x44, 0x41, 0x4F, 0xFE, 0xEE, 0xEE, 0xEE, 0xE2, 0x55, 
-    0x72, 0x22, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x55, 0x11, 0x11, 0x88, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x18, 0x1E, 0xEE, 
-    0x25, 0x52, 0xEF, 0x33, 0x36, 0x33, 0x3E, 0xEE, 0xE3, 0xEF, 0x2F, 0xF2, 0x14, 0x44, 0x52, 0xEE, 
-    0xE3, 0x3E, 0xE3, 0x3E, 0xEF, 0x22, 0x54, 0x44, 0x11, 0x52, 0xFF, 0xEE, 0xEE, 0xEE, 0xEF, 0x22, 
-    0x72, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x25, 0x11, 0x11, 0x18, 0x44, 0x49, 0x00, 0x00, 0x00, 0x01, 0x44, 0x44, 0x88, 0x12, 0x33, 
-    0xF5, 0x22, 0x22, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xEE, 0x25, 0xE2, 0x14, 0x44, 0x42, 0xFE, 
-    0xE3, 0x3E, 0xEE, 0x3E, 0xE7, 0x25, 0x44, 0x41, 0x11, 0x22, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 
-    0x72, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x25, 0x11, 0x11, 0x11, 0x84, 0x44, 0x00, 0x00, 0x00, 0x15, 0x54, 0x18, 0x08, 0x52, 0x23, 
-    0x32, 0x22, 0xE3, 0xEE, 0xE3, 0x33, 0x33, 0x33, 0x33, 0xEF, 0x21, 0xEF, 0x14, 0x44, 0x42, 0xFE, 
-    0x33, 0xEE, 0xE3, 0x3E, 0xE2, 0x54, 0x44, 0x41, 0x11, 0x22, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x25, 0x11, 0x11, 0x11, 0x08, 0x44, 0x49, 0x00, 0x01, 0x55, 0x41, 0x90, 0x09, 0x53, 0xFE, 
-    0x35, 0x22, 0xFE, 0x33, 0xEE, 0xE3, 0x36, 0x33, 0x3E, 0xF2, 0x22, 0xEF, 0x41, 0x44, 0x45, 0xF3, 
-    0x3E, 0xFE, 0x33, 0x3E, 0xF2, 0x44, 0x44, 0x11, 0x15, 0x22, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x22, 0x22, 0x22, 0x25, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x25, 0x11, 0x11, 0x18, 0x00, 0x84, 0xA5, 0x11, 0x4A, 0x54, 0x10, 0x00, 0x08, 0x4E, 0x33, 
-    0x32, 0xF2, 0x2F, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0xE3, 0xF2, 0xEE, 0x21, 0x14, 0x44, 0xE3, 
-    0x3F, 0xE3, 0x33, 0xE2, 0xF4, 0x44, 0x41, 0x11, 0x52, 0x22, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x55, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
-    0x22, 0x25, 0x41, 0x11, 0x10, 0x00, 0x04, 0x5A, 0xAA, 0xAA, 0xA1, 0x00, 0x00, 0x08, 0x13, 0x33, 
-    0x32, 0x22, 0xFF, 0xE3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE2, 0x22, 0x3E, 0x21, 0x14, 0x44, 0xF3, 
-    0xE3, 0x33, 0xE3, 0x25, 0x54, 0x44, 0x11, 0x15, 0x22, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 
-    0x22, 0x25, 0x41, 0x11, 0x10, 0x00, 0x09, 0x44, 0x5A, 0xA4, 0x40, 0x00, 0x00, 0x01, 0x12, 0xE3, 
-    0xF1, 0x98, 0x15, 0x52, 0x22, 0x42, 0xF2, 0x22, 0x11, 0x00, 0x13, 0x33, 0x21, 0x11, 0x44, 0x44, 
-    0x42, 0x22, 0xFF, 0x14, 0x44, 0x41, 0x11, 0x55, 0x52, 0x22, 0x2F, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x52, 0x10, 0x00, 0x00, 0x00, 0x95, 0x55, 0x58, 0x00, 0x00, 0x00, 0x05, 
-    0x22, 0x25, 0x41, 0x11, 0x10, 0x00, 0x00, 0x14, 0x45, 0xAA, 0x40, 0x00, 0x00, 0x01, 0x14, 0x23, 
-    0x32, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x3E, 0x41, 0x11, 0x14, 0x48, 
-    0x09, 0x81, 0x11, 0x44, 0x44, 0x11, 0x15, 0x55, 0x22, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x4A, 0x77, 0x71, 0x00, 0x00, 0x00, 0x04, 
-    0x22, 0x25, 0x41, 0x11, 0x10, 0x00, 0x01, 0x14, 0x44, 0x54, 0x90, 0x00, 0x00, 0x01, 0x11, 0x23, 
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x32, 0x11, 0x11, 0x14, 0x44, 
-    0x44, 0x44, 0x41, 0x14, 0x41, 0x11, 0x14, 0x55, 0x22, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x25, 0x90, 0x00, 0x00, 0x00, 0x44, 0x45, 0xAA, 0x40, 0x00, 0x00, 0x01, 
-    0x22, 0x25, 0x54, 0x11, 0x11, 0x11, 0x81, 0x11, 0x44, 0x49, 0x09, 0x81, 0x11, 0x11, 0x11, 0x12, 
-    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x14, 0x11, 0x11, 0x11, 0x44, 
-    0x45, 0x44, 0x49, 0x01, 0x11, 0x11, 0x14, 0x55, 0x52, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x00, 0x85, 0x44, 0x44, 0x44, 0x00, 0x00, 0x01, 
-    0x22, 0x25, 0x54, 0x11, 0x15, 0x55, 0x41, 0x11, 0x11, 0x11, 0x55, 0x52, 0x22, 0x75, 0x11, 0x12, 
-    0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x11, 0x11, 0x11, 0x18, 0x11, 
-    0x44, 0x41, 0x41, 0x98, 0x81, 0x11, 0x14, 0x55, 0x52, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x72, 0x22, 0x22, 0x22, 0x25, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44, 0x40, 0x00, 0x00, 0x01, 
-    0x22, 0x25, 0x54, 0x41, 0x15, 0x55, 0x41, 0x11, 0x11, 0x14, 0x55, 0x52, 0x22, 0x25, 0x11, 0x11, 
-    0x94, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x14, 0x11, 0x11, 
-    0x14, 0x44, 0x11, 0x81, 0x11, 0x11, 0x14, 0x55, 0x22, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x22, 0x22, 0x22, 0x22, 0x90, 0x00, 0x00, 0x00, 0x81, 0x44, 0x41, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x55, 0x41, 0x15, 0x55, 0x54, 0x41, 0x11, 0x45, 0x55, 0x55, 0x22, 0x52, 0x51, 0x11, 
-    0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x44, 0x41, 0x11, 
-    0x11, 0x11, 0x41, 0x81, 0x44, 0x44, 0x44, 0x55, 0x52, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x22, 0x22, 0x22, 0x22, 0x80, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x55, 0x41, 0x45, 0x55, 0x55, 0x44, 0x11, 0x45, 0x55, 0x55, 0x25, 0x22, 0x21, 0x11, 
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x44, 0x41, 0x11, 
-    0x88, 0x88, 0x11, 0x11, 0x44, 0x44, 0x44, 0x55, 0x52, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x41, 0x15, 0x55, 0x55, 0x54, 0x41, 0x45, 0x55, 0x55, 0x52, 0x55, 0x25, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x44, 0x44, 0x11, 
-    0x88, 0x11, 0x11, 0x14, 0x45, 0x55, 0x44, 0x55, 0x22, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x72, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x22, 0x22, 0x25, 0x51, 0x15, 0x55, 0x55, 0x55, 0x51, 0x14, 0x55, 0x55, 0x55, 0x52, 0x25, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x51, 0x14, 0x54, 0x41, 
-    0x11, 0x11, 0x11, 0x41, 0x44, 0x44, 0x44, 0x55, 0x22, 0x22, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x72, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0x22, 0x22, 0x25, 0x51, 0x15, 0x55, 0x55, 0x55, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x22, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x54, 0x14, 0x54, 0x41, 
-    0x11, 0x11, 0x11, 0x45, 0x54, 0x44, 0x44, 0x22, 0x22, 0x22, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x77, 0x22, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0x22, 0x22, 0x25, 0x51, 0x15, 0x55, 0x55, 0x51, 0x11, 0x11, 0x15, 0x55, 0x55, 0x42, 0x72, 0x51, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x24, 0x14, 0x44, 0x41, 
-    0x11, 0x11, 0x11, 0x11, 0x55, 0x44, 0x45, 0x22, 0x22, 0x22, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x77, 0x22, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0x22, 0x22, 0x25, 0x51, 0x15, 0x55, 0x44, 0x44, 0x11, 0x11, 0x15, 0x55, 0x55, 0x52, 0xF2, 0x51, 
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0x24, 0x14, 0x44, 0x41, 
-    0x11, 0x19, 0x11, 0x14, 0x44, 0x44, 0x45, 0x22, 0x22, 0x22, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x77, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x41, 0x15, 0x55, 0x54, 0x14, 0x11, 0x11, 0x14, 0x44, 0x55, 0x42, 0xF2, 0x51, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x52, 0x25, 0x14, 0x44, 0x41, 
-    0x11, 0x18, 0x11, 0x14, 0x44, 0x44, 0x45, 0x22, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x77, 0x77, 0x72, 0x22, 0x22, 0x28, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x41, 0x15, 0x55, 0x55, 0x44, 0x11, 0x11, 0x14, 0x45, 0x55, 0x42, 0xF2, 0x24, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x22, 0x25, 0x14, 0x44, 0x44, 
-    0x11, 0x18, 0x11, 0x14, 0x44, 0x44, 0x15, 0x22, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xF7, 0x77, 0x72, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x84, 0x80, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x41, 0x14, 0x54, 0x55, 0x54, 0x11, 0x11, 0x11, 0x44, 0x54, 0x42, 0xF2, 0x25, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x22, 0x25, 0x14, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x42, 0x22, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xFF, 0x77, 0x72, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x41, 0x44, 0x55, 0x45, 0x51, 0x11, 0x11, 0x11, 0x44, 0x54, 0x15, 0xE7, 0x25, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x25, 0x11, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x14, 0x44, 0x44, 0x12, 0x22, 0x22, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xFF, 0xF7, 0x77, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x44, 0x44, 0x55, 0x54, 0x51, 0x11, 0x11, 0x11, 0x44, 0x55, 0x12, 0xF7, 0x25, 
-    0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x22, 0x25, 0x11, 0x44, 0x44, 
-    0x41, 0x11, 0x11, 0x44, 0x44, 0x44, 0x42, 0x22, 0x2F, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xFF, 0x77, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x05, 
-    0x72, 0x22, 0x25, 0x44, 0x11, 0x55, 0x55, 0x54, 0x14, 0x11, 0x11, 0x44, 0x55, 0x15, 0xEF, 0x22, 
-    0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x2F, 0x22, 0x11, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x42, 0x22, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xFF, 0xFF, 0x77, 0x22, 0x22, 0x24, 0x00, 0x00, 0x00, 0x01, 0x54, 0x48, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x44, 0x11, 0x55, 0x54, 0x44, 0x44, 0x41, 0x11, 0x14, 0x55, 0x14, 0xE7, 0x22, 
-    0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x2F, 0x22, 0x11, 0x44, 0x44, 
-    0x11, 0x11, 0x11, 0x44, 0x44, 0x41, 0x42, 0x22, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEF, 0xFF, 0x77, 0x22, 0x22, 0x24, 0x00, 0x00, 0x00, 0x01, 0x54, 0x51, 0x00, 0x00, 0x00, 0x12, 
-    0x22, 0x22, 0x25, 0x44, 0x11, 0x45, 0x54, 0x45, 0x55, 0x44, 0x11, 0x14, 0x55, 0x45, 0xEF, 0x72, 
-    0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFF, 0x22, 0x11, 0x44, 0x41, 
-    0x11, 0x11, 0x11, 0x44, 0x44, 0x41, 0x42, 0x22, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xFF, 0x77, 0x72, 0x22, 0x25, 0x00, 0x00, 0x00, 0x01, 0x54, 0x41, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x44, 0x14, 0x45, 0x55, 0x55, 0x55, 0x54, 0x41, 0x14, 0x55, 0x45, 0xFF, 0x72, 
-    0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x22, 0xFF, 0x72, 0x11, 0x14, 0x41, 
-    0x11, 0x11, 0x11, 0x14, 0x44, 0x41, 0x52, 0x22, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x72, 0x22, 0x22, 0x10, 0x00, 0x00, 0x04, 0x54, 0x44, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x44, 0x11, 0x55, 0x55, 0x45, 0x25, 0x54, 0x41, 0x44, 0x45, 0x45, 0xFF, 0x72, 
-    0x51, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0xFF, 0x72, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x44, 0x41, 0x52, 0x22, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x72, 0x22, 0x22, 0x40, 0x00, 0x00, 0x05, 0x54, 0x45, 0x80, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x44, 0x11, 0x55, 0x51, 0x52, 0x22, 0x55, 0x41, 0x45, 0x45, 0x54, 0x2F, 0x72, 
-    0x54, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0xFF, 0x72, 0x41, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x44, 0x41, 0x52, 0x2F, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x72, 0x22, 0x22, 0x40, 0x00, 0x00, 0x05, 0x55, 0x45, 0x10, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x54, 0x11, 0x15, 0x41, 0x42, 0x22, 0x55, 0x41, 0x11, 0x11, 0x14, 0x2F, 0x72, 
-    0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0xFF, 0x72, 0x41, 0x44, 0x11, 
-    0x11, 0x44, 0x11, 0x11, 0x11, 0x44, 0x52, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x72, 0x22, 0x22, 0x10, 0x00, 0x00, 0x82, 0x55, 0x45, 0x10, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x54, 0x41, 0x41, 0x11, 0x52, 0x22, 0x25, 0x44, 0x11, 0x11, 0x51, 0x2F, 0x72, 
-    0x25, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0xFF, 0xF2, 0x51, 0x14, 0x11, 
-    0x11, 0x44, 0x41, 0x11, 0x11, 0x14, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x72, 0x22, 0x22, 0x10, 0x00, 0x00, 0x12, 0x55, 0x54, 0x50, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x54, 0x11, 0x11, 0x15, 0x52, 0x22, 0x25, 0x54, 0x11, 0x15, 0x54, 0x5F, 0x72, 
-    0x25, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0xFF, 0xF2, 0x51, 0x14, 0x11, 
-    0x11, 0x55, 0x41, 0x11, 0x11, 0x14, 0x22, 0x2F, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xF7, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x12, 0x55, 0x55, 0x40, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x25, 0x54, 0x44, 0x14, 0x54, 0x52, 0x22, 0x22, 0x54, 0x11, 0x44, 0x54, 0x5F, 0x72, 
-    0x25, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xF2, 0x51, 0x11, 0x11, 
-    0x14, 0x55, 0x51, 0x11, 0x14, 0x44, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x82, 0x55, 0x55, 0x40, 0x00, 0x00, 0x05, 
-    0x22, 0x22, 0x22, 0x54, 0x15, 0x54, 0x11, 0x22, 0x22, 0x22, 0x54, 0x11, 0x44, 0x14, 0x57, 0x72, 
-    0x25, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7F, 0xFF, 0xF2, 0x51, 0x11, 0x14, 
-    0x14, 0x55, 0x51, 0x11, 0x44, 0x14, 0x22, 0x2F, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x02, 0x25, 0x55, 0x58, 0x00, 0x00, 0x04, 
-    0x22, 0x22, 0x22, 0x54, 0x44, 0x45, 0x54, 0x52, 0x22, 0x22, 0x54, 0x14, 0x45, 0x54, 0x57, 0x72, 
-    0x25, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7F, 0xFF, 0xF2, 0x51, 0x11, 0x11, 
-    0x14, 0x52, 0x54, 0x11, 0x11, 0x11, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xF7, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x02, 0x25, 0x55, 0x58, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x22, 0x54, 0x45, 0x55, 0x55, 0x52, 0x22, 0x22, 0x54, 0x45, 0x55, 0x55, 0x57, 0x72, 
-    0x22, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2F, 0xFF, 0xF2, 0x51, 0x11, 0x11, 
-    0x14, 0x22, 0x54, 0x14, 0x11, 0x11, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xF7, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x02, 0x22, 0x55, 0x51, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x22, 0x54, 0x44, 0x45, 0x55, 0x52, 0x27, 0x22, 0x25, 0x45, 0x54, 0x55, 0x5F, 0x72, 
-    0x22, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x2F, 0xFF, 0xF2, 0x51, 0x11, 0x11, 
-    0x15, 0x22, 0x54, 0x44, 0x44, 0x14, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xFF, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x92, 0x22, 0x55, 0x51, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x22, 0x54, 0x55, 0x52, 0x54, 0x52, 0x77, 0x22, 0x25, 0x45, 0x55, 0x55, 0x5F, 0x72, 
-    0x22, 0x51, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x12, 0x2F, 0xFF, 0xF2, 0x51, 0x11, 0x14, 
-    0x15, 0x22, 0x24, 0x14, 0x44, 0x14, 0x22, 0x2F, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xFF, 0x77, 0x22, 0x22, 0x10, 0x00, 0x00, 0x12, 0x22, 0x25, 0x51, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x22, 0x51, 0x55, 0x25, 0x54, 0x57, 0x77, 0x72, 0x25, 0x15, 0x55, 0x44, 0x2F, 0x72, 
-    0x22, 0x54, 0x10, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x12, 0x2F, 0xFF, 0xF2, 0x51, 0x11, 0x11, 
-    0x15, 0x22, 0x24, 0x44, 0x41, 0x14, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEF, 0xFF, 0x77, 0x22, 0x22, 0x40, 0x00, 0x00, 0x12, 0x22, 0x25, 0x51, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x22, 0x51, 0x55, 0x54, 0x41, 0x57, 0x77, 0x72, 0x25, 0x15, 0x25, 0x55, 0x27, 0x77, 
-    0x22, 0x54, 0x10, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x12, 0xFF, 0xFF, 0x72, 0x51, 0x11, 0x11, 
-    0x15, 0x22, 0x24, 0x14, 0x41, 0x14, 0x22, 0x2F, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0xEE, 0xEE, 0xEF, 0xF7, 0x72, 0x22, 0x40, 0x00, 0x00, 0x12, 0x22, 0x25, 0x51, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x25, 0x51, 0x45, 0x54, 0x41, 0x27, 0x77, 0x72, 0x25, 0x14, 0x52, 0x25, 0x27, 0x72, 
-    0x22, 0x54, 0x18, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x42, 0x2F, 0xFF, 0x22, 0x51, 0x11, 0x11, 
-    0x15, 0x22, 0x21, 0x14, 0x11, 0x14, 0x22, 0x22, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 0x00, 0x00, 0x02, 0x22, 0x25, 0x54, 0x00, 0x00, 0x01, 
-    0x22, 0x22, 0x22, 0x51, 0x15, 0x55, 0x55, 0x2F, 0xFF, 0xF7, 0x25, 0x11, 0x45, 0x55, 0x2F, 0xFF, 
-    0x72, 0x54, 0x11, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x22, 0xFE, 0xEF, 0xF2, 0x21, 0x11, 0x14, 
-    0x42, 0x22, 0x24, 0x41, 0x11, 0x14, 0x22, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-    0x89, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x18, 0x90, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x18, 0x90, 0x04, 0x25, 0x41, 0x11, 0x11, 0x11, 0x19, 0x81, 0x11, 0x55, 0x11, 0x11, 
-    0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 
-    0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 0x11, 0x11, 0x41, 0x44, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x80, 0x00, 0x00, 0x00, 0x91, 0x14, 0x45, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x44, 
-    0x10, 0x00, 0x14, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t TEAM_RLE[TEAM_RLE_SIZE] = {
+    0xC7, 0xFF, 0x07, 0xFE, 0x1F, 0x02, 0x63, 0x60, 0xF3, 0x0B, 0x03, 0x63, 0x36, 0xFE, 0x09, 0xFF, 
+    0x05, 0xD2, 0xA7, 0xFF, 0x08, 0xFE, 0x21, 0x00, 0x60, 0x42, 0x00, 0x60, 0xF3, 0x0A, 0x01, 0x66, 
+    0x7F, 0xFE, 0x19, 0xB6, 0x05, 0x36, 0x33, 0x66, 0x61, 0x00, 0xE0, 0x53, 0xFF, 0x0B, 0xFE, 0x20, 
+    0x02, 0x66, 0x60, 0xB3, 0x00, 0x60, 0xF3, 0x08, 0x03, 0x66, 0xE6, 0x62, 0xFF, 0x0B, 0xFE, 0x21, 
+    0x46, 0xF3, 0x0A, 0x00, 0x60, 0xFE, 0x0A, 0xFF, 0x04, 0x58, 0x00, 0xF0, 0xFE, 0x1F, 0xB6, 0xB3, 
+    0x00, 0x60, 0xF3, 0x09, 0x63, 0x00, 0x40, 0xFF, 0x0B, 0xFE, 0x1F, 0xA6, 0xC3, 0x00, 0x60, 0xF3, 
+    0x08, 0x03, 0x66, 0xE6, 0x76, 0x01, 0xFF, 0x67, 0xF3, 0x10, 0xA6, 0xFE, 0x07, 0xFF, 0x04, 0xC2, 
+    0x00, 0x50, 0xFF, 0x0C, 0x01, 0xEF, 0xFE, 0x1E, 0x02, 0x66, 0x60, 0xF3, 0x06, 0x00, 0x60, 0xA3, 
+    0x05, 0x63, 0x66, 0x63, 0xFE, 0x09, 0xFF, 0x04, 0x58, 0x00, 0xE0, 0x64, 0x02, 0x6E, 0xE0, 0xF3, 
+    0x09, 0x43, 0x00, 0x30, 0x42, 0x02, 0x66, 0x60, 0xFE, 0x08, 0x64, 0x00, 0xF0, 0x64, 0x01, 0xE6, 
+    0x58, 0x00, 0x30, 0x54, 0x00, 0xE0, 0x4C, 0x02, 0xF2, 0x40, 0x79, 0x05, 0x6E, 0xE6, 0x66, 0xF3, 
+    0x0E, 0x55, 0x00, 0xE0, 0xFF, 0x02, 0x42, 0x00, 0x10, 0x7A, 0x03, 0x6E, 0x36, 0xF3, 0x07, 0x00, 
+    0x60, 0xE3, 0x02, 0x66, 0x60, 0xFE, 0x0B, 0xFF, 0x03, 0x59, 0x00, 0xF0, 0xFE, 0x10, 0x03, 0xF5, 
+    0x5F, 0x47, 0x00, 0x60, 0xF3, 0x08, 0x46, 0xA6, 0x78, 0x03, 0xEF, 0xFF, 0xFE, 0x0D, 0x00, 0x40, 
+    0xB1, 0x00, 0x20, 0x46, 0x01, 0x66, 0xE3, 0x00, 0x60, 0x4A, 0xC6, 0xFE, 0x0C, 0x5C, 0x0B, 0xEF, 
+    0x72, 0x11, 0x42, 0xEF, 0xFF, 0xFE, 0x0A, 0x01, 0x62, 0xD1, 0x01, 0x26, 0x46, 0x05, 0x63, 0x33, 
+    0x63, 0xC6, 0x47, 0x01, 0x33, 0x74, 0x0A, 0xE2, 0x11, 0x1B, 0x11, 0x12, 0xE0, 0x53, 0x00, 0x20, 
+    0xF1, 0x00, 0x00, 0xF0, 0x46, 0x02, 0x33, 0x30, 0xA6, 0x02, 0x33, 0x60, 0xB3, 0x45, 0x01, 0x63, 
+    0x56, 0x00, 0xE0, 0x5A, 0x00, 0x20, 0xF1, 0x00, 0x04, 0x5E, 0xFF, 0xF0, 0x59, 0x01, 0x26, 0xAE, 
+    0xA6, 0x11, 0xE6, 0x66, 0x3E, 0x21, 0x12, 0xF6, 0x36, 0x66, 0x33, 0xC6, 0xFE, 0x0E, 0xFF, 0x02, 
+    0x4F, 0x06, 0xE5, 0x01, 0x14, 0x40, 0xB1, 0x01, 0x2E, 0x51, 0x06, 0xF1, 0x14, 0x55, 0x40, 0xA1, 
+    0xDE, 0x00, 0x60, 0xBE, 0x00, 0xF0, 0xD1, 0x00, 0xE0, 0xF6, 0x01, 0xFE, 0x01, 0xB2, 0x64, 0x06, 
+    0x10, 0x14, 0x55, 0x50, 0xB1, 0x01, 0xEF, 0xFE, 0x09, 0x08, 0x21, 0x15, 0xA7, 0xA5, 0x40, 0x43, 
+    0xF6, 0x00, 0x01, 0x35, 0xD1, 0x00, 0x20, 0xF3, 0x01, 0x02, 0x66, 0x60, 0xAE, 0x01, 0x62, 0xD1, 
+    0x00, 0xF0, 0xFE, 0x00, 0xFF, 0x02, 0x4E, 0x0E, 0x49, 0x44, 0x4A, 0x77, 0x54, 0x11, 0xFF, 0xF0, 
+    0xFE, 0x07, 0x0B, 0xF4, 0x11, 0x14, 0x55, 0x51, 0x1F, 0xAE, 0xE6, 0x00, 0xE0, 0xB1, 0x05, 0x41, 
+    0x15, 0x36, 0xE3, 0x00, 0xE0, 0x43, 0x01, 0x65, 0xD1, 0x01, 0x01, 0x62, 0x09, 0x21, 0x41, 0x14, 
+    0x54, 0x45, 0x52, 0x07, 0xF2, 0x41, 0x41, 0x15, 0xA1, 0x49, 0x0C, 0xE6, 0x21, 0x14, 0x55, 0x44, 
+    0x11, 0xE0, 0x4C, 0x07, 0x62, 0x11, 0x14, 0x54, 0xA1, 0x00, 0x20, 0x60, 0x0C, 0xF5, 0x11, 0x41, 
+    0x44, 0x11, 0x41, 0x50, 0xAF, 0xFE, 0x04, 0x0C, 0xF2, 0x24, 0x15, 0x55, 0xA5, 0x44, 0x40, 0x4E, 
+    0x02, 0x14, 0x40, 0xA1, 0x0A, 0xE3, 0x63, 0x36, 0x33, 0x36, 0x60, 0xAE, 0x0B, 0x65, 0xD1, 0x45, 
+    0x25, 0x41, 0x10, 0x47, 0x00, 0xE0, 0x56, 0x02, 0x77, 0x50, 0xB4, 0x00, 0x50, 0xA4, 0x50, 0x0C, 
+    0x72, 0x54, 0x14, 0x54, 0x5A, 0x74, 0x20, 0xCE, 0x45, 0x00, 0x50, 0x43, 0x04, 0x44, 0x11, 0xE0, 
+    0xB6, 0x03, 0x33, 0x66, 0xBE, 0x07, 0x62, 0x11, 0x41, 0x54, 0xA1, 0x48, 0x00, 0xE0, 0x53, 0x04, 
+    0x77, 0x22, 0x20, 0x45, 0x03, 0x55, 0x42, 0x4E, 0x04, 0xF2, 0x24, 0x40, 0xB1, 0x01, 0x45, 0x46, 
+    0x08, 0xE6, 0x66, 0xEE, 0xE1, 0x10, 0xE4, 0x44, 0x02, 0x63, 0x30, 0x44, 0x09, 0xE2, 0x14, 0x11, 
+    0x41, 0x14, 0x4A, 0xFF, 0x01, 0x00, 0x50, 0x48, 0x01, 0x77, 0xA2, 0x00, 0x50, 0xE4, 0x06, 0x57, 
+    0x77, 0xFF, 0xF0, 0xFE, 0x01, 0x07, 0xF7, 0x22, 0x41, 0x11, 0xA4, 0x00, 0x10, 0x4C, 0x00, 0xF0, 
+    0x42, 0x00, 0x10, 0xA4, 0x00, 0x50, 0xF6, 0x01, 0xBE, 0x08, 0x62, 0x14, 0x54, 0x54, 0x50, 0x4A, 
+    0xFF, 0x02, 0x48, 0x01, 0x77, 0xA2, 0x00, 0x50, 0x47, 0x01, 0x2F, 0x55, 0x05, 0x14, 0x41, 0x12, 
+    0x4F, 0x00, 0x10, 0x43, 0x00, 0x20, 0xA6, 0x00, 0x30, 0xD6, 0xAE, 0x00, 0x20, 0xE4, 0x01, 0x14, 
+    0xFE, 0x03, 0x4E, 0x01, 0x77, 0xA2, 0xB5, 0x46, 0x03, 0x22, 0x77, 0xBF, 0xBE, 0x0A, 0xFF, 0x72, 
+    0x22, 0x51, 0x11, 0x90, 0xA1, 0x00, 0x20, 0xFE, 0x02, 0x05, 0x6E, 0x24, 0x11, 0xB4, 0x02, 0x15, 
+    0xE0, 0xF6, 0x00, 0x00, 0xE0, 0x43, 0x0A, 0xF4, 0x41, 0x44, 0x41, 0x41, 0x20, 0xFE, 0x00, 0xFF, 
+    0x01, 0x01, 0x21, 0x4B, 0x00, 0x20, 0xA5, 0x00, 0x10, 0xA4, 0x05, 0x14, 0xF2, 0x77, 0xDF, 0x44, 
+    0x05, 0xF7, 0x25, 0x10, 0xB1, 0x04, 0x41, 0x15, 0xF0, 0xCE, 0xA6, 0x05, 0xEF, 0x41, 0x11, 0x43, 
+    0x05, 0x26, 0x63, 0x33, 0xD6, 0x43, 0x0A, 0x24, 0x44, 0x74, 0x41, 0x52, 0xF0, 0xFE, 0x01, 0x4E, 
+    0x01, 0x77, 0xB2, 0xA5, 0x0A, 0x48, 0x41, 0x11, 0x41, 0x2F, 0x20, 0x43, 0xFE, 0x00, 0x13, 0x72, 
+    0x11, 0x00, 0x01, 0x11, 0x44, 0x1B, 0x01, 0x52, 0xE6, 0x46, 0x00, 0x20, 0xD1, 0x04, 0x5F, 0x66, 
+    0x60, 0x47, 0x04, 0x6E, 0xEF, 0x20, 0x42, 0x00, 0x40, 0x43, 0x01, 0x2F, 0xFE, 0x01, 0x4C, 0x01, 
+    0x77, 0xD2, 0x13, 0x55, 0x18, 0x08, 0x11, 0x44, 0x91, 0x27, 0xF7, 0x7F, 0xFF, 0xCE, 0x02, 0xF4, 
+    0x10, 0xD0, 0x0B, 0x11, 0x18, 0x01, 0x18, 0x08, 0x12, 0xEE, 0x09, 0x21, 0x25, 0x11, 0x15, 0x3E, 
+    0x4A, 0x00, 0xE0, 0x44, 0x0A, 0x14, 0x41, 0x11, 0x42, 0x2F, 0xF0, 0x5C, 0x02, 0x51, 0x10, 0xB0, 
+    0x02, 0x91, 0x10, 0xA0, 0x04, 0x12, 0xFF, 0x70, 0x46, 0x00, 0x10, 0xF0, 0x01, 0x04, 0x80, 0x00, 
+    0x80, 0xA1, 0x10, 0x01, 0x2E, 0xE6, 0x66, 0xEE, 0x22, 0x63, 0xF5, 0x20, 0xD3, 0xE6, 0x46, 0xC1, 
+    0x51, 0x00, 0xE0, 0x44, 0x00, 0x70, 0x43, 0x02, 0x51, 0x80, 0xF0, 0x07, 0x01, 0x15, 0xAF, 0xAE, 
+    0x00, 0x20, 0xF0, 0x06, 0x01, 0x88, 0xA1, 0x02, 0x01, 0x60, 0x42, 0x00, 0x60, 0xC3, 0x01, 0xEE, 
+    0xF3, 0x00, 0xD6, 0x43, 0x00, 0x20, 0xD1, 0x02, 0xE2, 0x20, 0x4A, 0x00, 0xE0, 0x4D, 0x01, 0x59, 
+    0xF0, 0x0B, 0x08, 0x12, 0xFF, 0xFE, 0xFE, 0x50, 0xF0, 0x05, 0x03, 0x99, 0x88, 0xB1, 0x02, 0xEE, 
+    0xE0, 0xD3, 0x05, 0xEF, 0x33, 0x2E, 0xE3, 0x46, 0x0F, 0xEE, 0x3E, 0x41, 0x11, 0x41, 0xF3, 0x3E, 
+    0xFF, 0xFE, 0x00, 0x4C, 0x03, 0x22, 0x21, 0xF0, 0x0D, 0x01, 0x17, 0xAF, 0x01, 0xE1, 0xF0, 0x06, 
+    0x09, 0x98, 0x88, 0x11, 0x1C, 0x2E, 0xE3, 0x00, 0xE0, 0xF3, 0x04, 0xB6, 0x01, 0xE6, 0xB3, 0x00, 
+    0xF0, 0xA4, 0x00, 0xF0, 0xC3, 0xFE, 0x02, 0x47, 0x05, 0x77, 0x72, 0x74, 0xF0, 0x0F, 0x05, 0x4F, 
+    0x7F, 0xF2, 0xF0, 0x02, 0x00, 0x10, 0xC0, 0x08, 0x80, 0x08, 0x1B, 0x12, 0x60, 0xF3, 0x0B, 0x01, 
+    0xEE, 0xA6, 0xE3, 0x04, 0x25, 0x52, 0xE0, 0xE3, 0xDE, 0x00, 0xF0, 0x48, 0x00, 0xF0, 0x42, 0x00, 
+    0x10, 0xF0, 0x0F, 0x05, 0x12, 0x7F, 0x74, 0xF0, 0x07, 0x01, 0x11, 0xA0, 0x01, 0x11, 0x59, 0xE3, 
+    0x07, 0xE2, 0x2F, 0x22, 0xFE, 0xE3, 0xEE, 0x4A, 0x02, 0x72, 0x80, 0xF0, 0x10, 0x04, 0x5F, 0x22, 
+    0x10, 0x58, 0x02, 0xE3, 0xE0, 0xF3, 0x0A, 0x01, 0xEE, 0x47, 0xA3, 0x00, 0xF0, 0xF3, 0x03, 0xCE, 
+    0xAF, 0x48, 0x00, 0x50, 0xF0, 0x11, 0x04, 0x1F, 0x22, 0x80, 0xF0, 0x0D, 0x07, 0x11, 0x05, 0xEE, 
+    0x3E, 0xF3, 0x07, 0x03, 0xE3, 0x3E, 0xF3, 0x11, 0xEE, 0x4A, 0x00, 0x40, 0x59, 0x02, 0x22, 0x10, 
+    0xF0, 0x0F, 0x05, 0x10, 0x1E, 0x2E, 0xF3, 0x08, 0x5C, 0x00, 0xF0, 0xCE, 0x00, 0xF0, 0x4A, 0x00, 
+    0x10, 0xF0, 0x12, 0x58, 0x00, 0x80, 0x43, 0x01, 0x2E, 0xF3, 0x06, 0x08, 0xFE, 0x3E, 0x23, 0x33, 
+    0xE0, 0x5B, 0x00, 0xE0, 0x67, 0x06, 0x51, 0x18, 0x81, 0x10, 0xF0, 0x07, 0x07, 0x15, 0x54, 0x15, 
+    0xFF, 0x4F, 0x08, 0x22, 0xE2, 0xEE, 0x3E, 0xF0, 0xF3, 0x09, 0x00, 0xE0, 0x53, 0x01, 0x22, 0x5A, 
+    0x00, 0x50, 0x42, 0x03, 0x45, 0xA9, 0xF0, 0x05, 0x0B, 0x85, 0xA5, 0x41, 0x22, 0x25, 0x2E, 0xF3, 
+    0x05, 0x0A, 0xE2, 0x22, 0xE3, 0xE3, 0x3F, 0xE0, 0xF3, 0x04, 0x02, 0xE3, 0xE0, 0xA3, 0x47, 0x00, 
+    0xE0, 0x42, 0x05, 0xEF, 0x77, 0x25, 0xF0, 0x13, 0x01, 0x54, 0x42, 0x02, 0x45, 0x80, 0xF0, 0x05, 
+    0x05, 0x14, 0x55, 0x44, 0x43, 0x01, 0x2E, 0xF3, 0x02, 0x05, 0xEE, 0xF2, 0x2F, 0xB3, 0x01, 0x2F, 
+    0xF3, 0x03, 0x01, 0xEF, 0xC3, 0x4C, 0x06, 0xF7, 0x72, 0x25, 0x80, 0x5A, 0x00, 0x10, 0x53, 0x0C, 
+    0x84, 0x54, 0x42, 0x22, 0x55, 0x22, 0x20, 0xBE, 0x0D, 0x33, 0x3E, 0xFF, 0xEF, 0x25, 0xF3, 0x2E, 
+    0x42, 0x03, 0x2E, 0xFE, 0xF3, 0x00, 0x03, 0xFF, 0x3E, 0xA3, 0xFE, 0x02, 0x00, 0x50, 0x45, 0x01, 
+    0x21, 0xF0, 0x12, 0xA1, 0x03, 0x84, 0x44, 0x4F, 0x00, 0x40, 0x44, 0xA2, 0x01, 0x3E, 0xE3, 0x06, 
+    0xEF, 0xF2, 0x5E, 0x20, 0xB4, 0x03, 0x52, 0xFF, 0xF3, 0x00, 0x03, 0xEF, 0xEE, 0x51, 0x01, 0x77, 
+    0xA2, 0x62, 0x00, 0x90, 0xF0, 0x06, 0x43, 0x07, 0xF2, 0x15, 0x2F, 0xEE, 0xF3, 0x01, 0x04, 0xF2, 
+    0x22, 0x50, 0x44, 0x03, 0x4F, 0x2E, 0xE3, 0x04, 0xEE, 0x2E, 0xE0, 0xC3, 0xFE, 0x00, 0x00, 0xF0, 
+    0x68, 0x03, 0x84, 0x48, 0xF0, 0x05, 0x00, 0x80, 0xA4, 0x07, 0xFE, 0x21, 0x55, 0x2E, 0xF3, 0x02, 
+    0x05, 0xEF, 0x22, 0x2E, 0xB4, 0x02, 0x5F, 0xF0, 0xF3, 0x00, 0x42, 0x07, 0x25, 0x25, 0x54, 0x4F, 
+    0x47, 0x03, 0x41, 0x17, 0xB2, 0x5B, 0x07, 0x41, 0x11, 0x84, 0x44, 0xF0, 0x04, 0x00, 0x80, 0xB4, 
+    0x03, 0xEE, 0x21, 0xA2, 0x00, 0x60, 0xF3, 0x00, 0xA2, 0x02, 0x11, 0x20, 0xA4, 0x03, 0x12, 0x2E, 
+    0x4C, 0x05, 0x14, 0x44, 0x11, 0x48, 0x00, 0x50, 0x63, 0x08, 0x51, 0x11, 0x98, 0x44, 0x80, 0xF0, 
+    0x02, 0x00, 0x80, 0xB4, 0x0B, 0x2E, 0xF2, 0x4E, 0x2E, 0xE2, 0x2E, 0xF3, 0x00, 0x03, 0xE3, 0x54, 
+    0x45, 0x0E, 0xF3, 0xEE, 0x33, 0x3E, 0x33, 0xEE, 0xF2, 0xF0, 0x44, 0x02, 0x4F, 0xF0, 0x46, 0x00, 
+    0x40, 0x62, 0x00, 0x40, 0x42, 0x05, 0x88, 0x44, 0x49, 0xF0, 0x00, 0x00, 0x80, 0xA4, 0x0E, 0x11, 
+    0xF3, 0x3F, 0x55, 0x3E, 0x33, 0x3F, 0x60, 0xA3, 0x0F, 0xEF, 0xE3, 0x3E, 0x22, 0xF5, 0x14, 0x44, 
+    0x5F, 0xAE, 0x01, 0x3E, 0x56, 0x03, 0xE2, 0x55, 0x44, 0x00, 0x40, 0xF0, 0x12, 0x00, 0x50, 0x42, 
+    0x05, 0x18, 0x84, 0x44, 0xF0, 0x00, 0xA4, 0x0E, 0x18, 0x1E, 0xEE, 0x25, 0x52, 0xEF, 0x33, 0x30, 
+    0x42, 0xAE, 0x06, 0x3E, 0xF2, 0xFF, 0x20, 0x43, 0x04, 0x2E, 0xEE, 0x30, 0x47, 0x0A, 0x25, 0x44, 
+    0x41, 0x15, 0x2F, 0xF0, 0xDE, 0x02, 0xF2, 0x20, 0x44, 0x00, 0x50, 0xF0, 0x11, 0x01, 0x42, 0x43, 
+    0x00, 0x10, 0x42, 0x00, 0x90, 0xD0, 0x00, 0x10, 0xA4, 0x07, 0x88, 0x12, 0x33, 0xF5, 0xA2, 0x00, 
+    0xE0, 0xF3, 0x02, 0x04, 0xEE, 0x25, 0xE0, 0x43, 0x02, 0x42, 0xF0, 0x44, 0x0D, 0xE3, 0xEE, 0x72, 
+    0x54, 0x44, 0x11, 0x12, 0x48, 0x02, 0xEF, 0xF0, 0x44, 0x01, 0x21, 0xF0, 0x0F, 0x01, 0x12, 0x45, 
+    0x04, 0x18, 0x44, 0x40, 0xC0, 0x14, 0x15, 0x54, 0x18, 0x08, 0x52, 0x23, 0x32, 0x22, 0xE3, 0xEE, 
+    0xE0, 0x48, 0x04, 0xF2, 0x1E, 0xF0, 0x46, 0x0A, 0x33, 0xEE, 0xE3, 0x3E, 0xE2, 0x50, 0xA4, 0x4D, 
+    0x01, 0xEE, 0xE2, 0x00, 0x10, 0xF0, 0x0E, 0x00, 0x20, 0x47, 0x3F, 0x08, 0x44, 0x49, 0x00, 0x01, 
+    0x55, 0x41, 0x90, 0x09, 0x53, 0xFE, 0x35, 0x22, 0xFE, 0x33, 0xEE, 0xE3, 0x36, 0x33, 0x3E, 0xF2, 
+    0x22, 0xEF, 0x41, 0x44, 0x45, 0xF3, 0x3E, 0xFE, 0x33, 0x3E, 0xF2, 0xA4, 0x03, 0x11, 0x15, 0x42, 
+    0x00, 0xF0, 0x4E, 0x02, 0x52, 0x10, 0xF0, 0x0C, 0x00, 0x10, 0x47, 0x0D, 0x80, 0x08, 0x4A, 0x51, 
+    0x14, 0xA5, 0x41, 0xA0, 0x0A, 0x84, 0xE3, 0x33, 0x2F, 0x22, 0xF0, 0xF3, 0x01, 0x18, 0xFF, 0xE3, 
+    0xF2, 0xEE, 0x21, 0x14, 0x44, 0xE3, 0x3F, 0xE3, 0x33, 0xE2, 0xF0, 0xA4, 0x04, 0x11, 0x15, 0x20, 
+    0x4C, 0x00, 0x70, 0xD2, 0x02, 0x55, 0x10, 0xF0, 0x0A, 0x01, 0x15, 0x42, 0x00, 0x40, 0xA1, 0xA0, 
+    0x01, 0x45, 0xCA, 0x00, 0x10, 0xB0, 0x01, 0x81, 0xA3, 0x05, 0x22, 0x2F, 0xFE, 0xF3, 0x02, 0x04, 
+    0xE2, 0x22, 0x30, 0x45, 0x11, 0xF3, 0xE3, 0x33, 0xE3, 0x25, 0x54, 0x44, 0x11, 0x15, 0xB2, 0x52, 
+    0x01, 0x24, 0xF0, 0x0A, 0x00, 0x90, 0x4C, 0x07, 0x94, 0x45, 0xAA, 0x44, 0xC0, 0x20, 0x11, 0x2E, 
+    0x3F, 0x19, 0x81, 0x55, 0x22, 0x24, 0x2F, 0x22, 0x21, 0x10, 0x01, 0x33, 0x32, 0x11, 0x10, 0xB4, 
+    0x05, 0x22, 0x2F, 0xF1, 0xA4, 0x05, 0x11, 0x15, 0x55, 0x43, 0xFE, 0x01, 0x48, 0x00, 0x10, 0xD0, 
+    0x00, 0x90, 0xA5, 0x00, 0x80, 0xD0, 0x4C, 0x06, 0x01, 0x44, 0x5A, 0xA0, 0x47, 0x05, 0x42, 0x33, 
+    0x29, 0xF0, 0x08, 0x04, 0x13, 0x3E, 0x40, 0xA1, 0x08, 0x44, 0x80, 0x98, 0x11, 0x10, 0xA4, 0x05, 
+    0x11, 0x15, 0x55, 0xB2, 0x01, 0xFF, 0x4F, 0x00, 0x20, 0x47, 0x05, 0x4A, 0x77, 0x71, 0xD0, 0x00, 
+    0x40, 0x4B, 0x07, 0x11, 0x44, 0x45, 0x49, 0x46, 0x04, 0x12, 0x33, 0xE0, 0xF0, 0x09, 0x03, 0x1F, 
+    0x32, 0xB1, 0xE4, 0x03, 0x11, 0x44, 0xA1, 0x00, 0x40, 0x59, 0x01, 0x59, 0x46, 0x05, 0x44, 0x5A, 
+    0xA4, 0xC0, 0x00, 0x10, 0x42, 0x01, 0x54, 0xC1, 0x0A, 0x81, 0x11, 0x44, 0x49, 0x09, 0x80, 0xE1, 
+    0x02, 0x23, 0x30, 0xF0, 0x09, 0x03, 0x44, 0x14, 0xC1, 0x08, 0x44, 0x45, 0x44, 0x49, 0x00, 0xC1, 
+    0x03, 0x45, 0x55, 0x57, 0xE0, 0x01, 0x85, 0xC4, 0x4D, 0x03, 0x55, 0x54, 0xD1, 0x07, 0x55, 0x52, 
+    0x22, 0x75, 0x42, 0x01, 0x25, 0xF0, 0x08, 0x02, 0x11, 0x90, 0xD1, 0x0B, 0x81, 0x14, 0x44, 0x14, 
+    0x19, 0x88, 0x67, 0x00, 0x10, 0xC4, 0xC0, 0x45, 0x00, 0x40, 0x4A, 0x00, 0x40, 0x44, 0x00, 0x20, 
+    0x42, 0x03, 0x19, 0x41, 0xF0, 0x0A, 0xB1, 0x00, 0x40, 0xB1, 0x05, 0x44, 0x41, 0x18, 0xC1, 0x02, 
+    0x45, 0x50, 0xB2, 0x4A, 0x00, 0x70, 0xE2, 0x00, 0x90, 0xD0, 0x05, 0x81, 0x44, 0x41, 0xD0, 0x42, 
+    0x02, 0x25, 0x50, 0x44, 0x06, 0x54, 0x41, 0x11, 0x40, 0xB5, 0x0B, 0x22, 0x52, 0x51, 0x11, 0x80, 
+    0x48, 0x54, 0x02, 0x44, 0x40, 0xD1, 0x03, 0x41, 0x81, 0xC4, 0x02, 0x55, 0x50, 0x57, 0x00, 0x80, 
+    0xF0, 0x00, 0x01, 0x88, 0xF0, 0x00, 0x47, 0x00, 0x40, 0xB5, 0x01, 0x44, 0x47, 0x03, 0x52, 0x22, 
+    0x43, 0xF0, 0x0B, 0x48, 0xA8, 0xA1, 0x60, 0x00, 0x10, 0xF0, 0x0B, 0x43, 0x04, 0x25, 0x41, 0x10, 
+    0xC5, 0x01, 0x44, 0x45, 0x08, 0x52, 0x55, 0x25, 0x11, 0x10, 0x5A, 0x00, 0x40, 0x42, 0xB1, 0x04, 
+    0x44, 0x55, 0x50, 0x42, 0xB2, 0x4B, 0x00, 0x70, 0x5A, 0x00, 0x50, 0x44, 0x00, 0x50, 0x46, 0x04, 
+    0x55, 0x11, 0x40, 0xD5, 0x00, 0x20, 0x57, 0x09, 0x11, 0x45, 0x11, 0x45, 0x44, 0xD1, 0x01, 0x41, 
+    0xC4, 0x44, 0x00, 0xF0, 0x79, 0xA1, 0x00, 0x40, 0xD5, 0x01, 0x22, 0x57, 0x02, 0x55, 0x40, 0x4B, 
+    0x01, 0x55, 0xB4, 0xC2, 0x4D, 0x00, 0x70, 0xC2, 0x00, 0x50, 0xF0, 0x0B, 0x00, 0x40, 0x4D, 0xC1, 
+    0xB5, 0x04, 0x42, 0x72, 0x50, 0x55, 0x04, 0x45, 0x24, 0x10, 0xA4, 0xF1, 0x00, 0x05, 0x55, 0x44, 
+    0x45, 0x46, 0xFE, 0x01, 0x53, 0x00, 0x10, 0x54, 0xA4, 0x48, 0x02, 0x52, 0xF0, 0x42, 0x00, 0x80, 
+    0x52, 0x01, 0x52, 0x49, 0x03, 0x91, 0x11, 0xC4, 0x5B, 0x00, 0x20, 0x52, 0x00, 0x10, 0x44, 0x00, 
+    0x40, 0x43, 0x02, 0x54, 0x10, 0x44, 0x05, 0x44, 0x45, 0x54, 0x44, 0x00, 0x10, 0xF0, 0x09, 0x05, 
+    0x84, 0x52, 0x25, 0x47, 0x00, 0x80, 0x4D, 0x00, 0xF0, 0x4E, 0x00, 0x70, 0xC2, 0x00, 0x80, 0xF0, 
+    0x00, 0x00, 0x40, 0x55, 0x01, 0x54, 0x46, 0x00, 0x50, 0x44, 0x01, 0x24, 0x52, 0x02, 0x15, 0x20, 
+    0x46, 0x00, 0x40, 0x4A, 0x00, 0x10, 0x51, 0x00, 0xF0, 0x48, 0x00, 0x10, 0xE0, 0x02, 0x84, 0x80, 
+    0x50, 0x05, 0x45, 0x45, 0x55, 0x44, 0x04, 0x14, 0x45, 0x40, 0x43, 0x00, 0x50, 0x61, 0xA1, 0xC4, 
+    0xC2, 0x4C, 0x00, 0xF0, 0x50, 0x02, 0x14, 0x10, 0x4F, 0x06, 0x44, 0x55, 0x45, 0x50, 0xD1, 0x42, 
+    0x03, 0x15, 0xE7, 0x55, 0xA2, 0x02, 0x51, 0x10, 0x4E, 0x00, 0x10, 0xB2, 0xAF, 0x4A, 0x03, 0xF7, 
+    0x77, 0x5F, 0x00, 0x40, 0x42, 0x01, 0x54, 0x49, 0x09, 0x51, 0x2F, 0x72, 0x54, 0x18, 0xF0, 0x08, 
+    0x00, 0x40, 0x49, 0x00, 0x40, 0xB1, 0xD4, 0xA2, 0xBF, 0xFE, 0x03, 0x01, 0xFF, 0x4E, 0x02, 0x44, 
+    0x40, 0xE0, 0x01, 0x57, 0x45, 0x01, 0x11, 0xB5, 0x02, 0x41, 0x40, 0x47, 0x07, 0x5E, 0xF2, 0x24, 
+    0x11, 0xF0, 0x08, 0x05, 0x52, 0x2F, 0x22, 0x44, 0xC1, 0x48, 0xBF, 0xFE, 0x02, 0xAF, 0x45, 0x00, 
+    0x40, 0xD0, 0x04, 0x15, 0x44, 0x80, 0xD0, 0xC2, 0x46, 0xC4, 0xA1, 0x42, 0x05, 0x4E, 0x72, 0x25, 
+    0x68, 0x00, 0x10, 0x46, 0xFE, 0x04, 0x53, 0x01, 0x51, 0xC0, 0x00, 0x10, 0x49, 0x00, 0x40, 0x42, 
+    0x04, 0x55, 0x54, 0x40, 0x44, 0x04, 0x45, 0xEF, 0x70, 0x53, 0x02, 0x22, 0xF0, 0x46, 0xD1, 0x59, 
+    0x00, 0xE0, 0x42, 0x00, 0x70, 0xA2, 0x00, 0x50, 0x48, 0x00, 0x40, 0x45, 0x00, 0x00, 0x48, 0x01, 
+    0x44, 0xE5, 0x01, 0x44, 0x45, 0x00, 0xF0, 0x54, 0x00, 0x80, 0x42, 0x04, 0x72, 0x11, 0x10, 0x47, 
+    0x00, 0x10, 0x43, 0x00, 0x50, 0x53, 0x02, 0xEF, 0xF0, 0x44, 0x01, 0x21, 0xC0, 0x04, 0x45, 0x44, 
+    0x40, 0x4F, 0x00, 0x10, 0xA5, 0x02, 0x45, 0x20, 0x43, 0x02, 0x44, 0x40, 0x48, 0x00, 0x80, 0xF0, 
+    0x06, 0x00, 0x10, 0x47, 0xF1, 0x02, 0x62, 0x00, 0x40, 0xC0, 0x05, 0x55, 0x44, 0x58, 0x52, 0x0F, 
+    0x15, 0x22, 0x25, 0x54, 0x14, 0x54, 0x55, 0x42, 0x42, 0x02, 0x41, 0x10, 0x54, 0x02, 0x41, 0x40, 
+    0x50, 0xAF, 0xFE, 0x07, 0x50, 0x03, 0x54, 0x51, 0x4B, 0x08, 0x54, 0x11, 0x15, 0x41, 0x40, 0x45, 
+    0xB1, 0x43, 0x00, 0x20, 0x5A, 0x00, 0x40, 0xA1, 0x01, 0x44, 0xC1, 0x01, 0x44, 0x44, 0xFE, 0x08, 
+    0x47, 0x00, 0x10, 0xB0, 0x01, 0x82, 0x52, 0x06, 0x41, 0x41, 0x11, 0x50, 0xA2, 0x02, 0x54, 0x40, 
+    0xA1, 0x01, 0x51, 0x43, 0x00, 0x50, 0x51, 0x07, 0x7F, 0xFF, 0x25, 0x11, 0x45, 0x00, 0x40, 0xC1, 
+    0x01, 0x42, 0x63, 0x06, 0x12, 0x55, 0x54, 0x50, 0x4D, 0xB1, 0x00, 0x50, 0x44, 0x00, 0x50, 0x42, 
+    0x03, 0x55, 0x45, 0x63, 0x01, 0x55, 0x4C, 0x00, 0xF0, 0xFE, 0x08, 0x03, 0xF7, 0x77, 0x4D, 0x01, 
+    0x54, 0x4D, 0x05, 0x44, 0x14, 0x54, 0x43, 0x00, 0x20, 0x42, 0x01, 0x44, 0x58, 0x03, 0xFF, 0xFE, 
+    0x43, 0xA1, 0x03, 0x45, 0x55, 0xA1, 0x01, 0x44, 0x45, 0xFE, 0x08, 0x00, 0xF0, 0x4C, 0x00, 0x80, 
+    0x4A, 0x00, 0x50, 0xC2, 0x07, 0x54, 0x15, 0x54, 0x11, 0xC2, 0x44, 0x03, 0x14, 0x57, 0x42, 0x02, 
+    0x41, 0x80, 0xF0, 0x05, 0x01, 0x47, 0xAF, 0x44, 0x00, 0x40, 0x46, 0x02, 0x44, 0x10, 0x44, 0xFE, 
+    0x09, 0x4D, 0x02, 0x02, 0x20, 0xA5, 0x00, 0x80, 0xB0, 0x00, 0x40, 0x46, 0x06, 0x44, 0x45, 0x54, 
+    0x50, 0x46, 0x03, 0x44, 0x55, 0x47, 0x00, 0x10, 0xF0, 0x05, 0x00, 0x50, 0x49, 0x06, 0x11, 0x45, 
+    0x25, 0x40, 0xC1, 0x43, 0x00, 0xF0, 0x6B, 0x00, 0x10, 0x47, 0xC5, 0x45, 0x00, 0x40, 0xC5, 0x42, 
+    0x00, 0x20, 0x4F, 0x01, 0x22, 0x4B, 0x00, 0x20, 0x42, 0x00, 0x40, 0x59, 0x00, 0xE0, 0x4F, 0x04, 
+    0x25, 0x55, 0x10, 0x4D, 0x01, 0x44, 0x44, 0x0C, 0x72, 0x22, 0x54, 0x55, 0x45, 0x55, 0xF0, 0x42, 
+    0x00, 0x50, 0x4D, 0x00, 0x90, 0x4C, 0x00, 0x50, 0x42, 0xA4, 0x01, 0x14, 0x57, 0x00, 0xF0, 0x4A, 
+    0x00, 0x90, 0x53, 0x08, 0x55, 0x52, 0x54, 0x52, 0x70, 0x46, 0xA5, 0x4D, 0x00, 0x90, 0xB0, 0x00, 
+    0x10, 0x4A, 0x00, 0x40, 0x42, 0x02, 0x24, 0x10, 0x49, 0x00, 0xF0, 0xFE, 0x07, 0x00, 0xF0, 0x4C, 
+    0x00, 0x10, 0xA2, 0x4E, 0x07, 0x15, 0x52, 0x55, 0x45, 0xA7, 0x09, 0x22, 0x51, 0x55, 0x54, 0x42, 
+    0x44, 0x00, 0x40, 0x46, 0x00, 0x80, 0x50, 0x00, 0x10, 0x44, 0x03, 0x44, 0x41, 0x46, 0xFE, 0x08, 
+    0x47, 0x00, 0x40, 0x5B, 0x03, 0x54, 0x41, 0x48, 0x07, 0x25, 0x55, 0x27, 0x77, 0x49, 0x01, 0x81, 
+    0x45, 0xAF, 0x00, 0x70, 0x4B, 0x00, 0x10, 0x5A, 0x05, 0xEE, 0xFF, 0x77, 0x5A, 0x03, 0x55, 0x14, 
+    0x43, 0x00, 0x20, 0x46, 0x03, 0x45, 0x22, 0x42, 0x00, 0x20, 0x43, 0x00, 0x80, 0xB0, 0x00, 0x10, 
+    0x44, 0x06, 0x42, 0x2F, 0xFF, 0x20, 0x4A, 0x03, 0x11, 0x41, 0x44, 0x00, 0x20, 0xAF, 0x01, 0xEE, 
+    0xFF, 0x01, 0xF2, 0x03, 0x44, 0x00, 0x00, 0x44, 0x00, 0x40, 0x49, 0x03, 0x25, 0x11, 0xB5, 0x00, 
+    0x20, 0xAF, 0x0D, 0x72, 0x51, 0x14, 0x55, 0x52, 0xFF, 0xF7, 0x42, 0x00, 0x10, 0x4A, 0x08, 0x22, 
+    0xFE, 0xEF, 0xF2, 0x20, 0xA1, 0x01, 0x44, 0xA2, 0x01, 0x44, 0xA1, 0x03, 0x42, 0x2F, 0xFE, 0x08, 
+    0x02, 0x89, 0x90, 0xF0, 0x07, 0x05, 0x88, 0x81, 0x89, 0xD0, 0xB1, 0x07, 0x89, 0x00, 0x42, 0x54, 
+    0xE1, 0x06, 0x98, 0x11, 0x15, 0x50, 0xC1, 0x00, 0x80, 0xF0, 0x06, 0xF1, 0x04, 0x00, 0x50, 0xB1, 
+    0x44, 0xB1, 0x04, 0x41, 0x44, 0x10, 0xF4, 0x02, 0x00, 0x90, 0xF0, 0x1F, 0x05, 0x15, 0x55, 0x48, 
+    0xD0, 0x06, 0x91, 0x14, 0x45, 0x10, 0xF0, 0x15, 0x0A, 0x11, 0x44, 0x41, 0x00, 0x01, 0x40, 0xC1, 
+    0xF0, 0x0B, 
+};
+
+const gfx_image_t TEAM_IMG = {
+    .w = TEAM_W, .h = TEAM_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TEAM_PAL, .colors = TEAM_PAL_SIZE,
+    .data = TEAM_RLE, .size = TEAM_RLE_SIZE,
 };
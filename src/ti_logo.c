@@ -2,297 +2,50 @@
 #include "ti_logo.h"
 
 const uint16_t TI_LOGO_PAL[TI_LOGO_PAL_SIZE] = {
-    0xED55, 0xDB4D, 0xD124, 0xF6DA, 0xD1E8, 0xE40F, 0xEDF8, 0xEE17, 
-    0xFFFF, 0xC800, 0xF73C, 0xD228, 0xE451, 0xF638, 0xC8A2, 0xD1A6, 
+    0xED55, 0xDB4D, 0xFFFF, 0xC800, 
 };
 
-const uint8_t TI_LOGO_IDX[(TI_LOGO_W * TI_LOGO_H) / 2] = {
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x80, 0x11, 0x11, 0x10, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x9C, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0xA9, 0x99, 0x99, 0x90, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x93, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x09, 0x99, 0x99, 0xEA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0xC9, 0xE9, 0xE9, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0xAA, 0xAA, 0xAA, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 
-    0xAA, 0xAA, 0xA8, 0x88, 0x3A, 0xAA, 0xAA, 0x88, 0x8A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x38, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x08, 0x8C, 0x99, 0x99, 0x92, 0x88, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x08, 0x81, 0x99, 0x99, 0x91, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x38, 0x82, 0x99, 0x99, 0x9C, 0x88, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x92, 0x88, 0xA9, 0x99, 0x99, 0x90, 0x88, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9B, 0x88, 0x09, 0x99, 0x99, 0x93, 0x88, 0xB9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x91, 0x88, 0x09, 0x99, 0x99, 0x28, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x90, 0x88, 0x19, 0x99, 0x99, 0xB8, 0x83, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0xF9, 0x99, 0x99, 0x18, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB1, 
-    0x11, 0x18, 0x8A, 0xE9, 0x99, 0x99, 0x08, 0x80, 0x11, 0x11, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA8, 
-    0x88, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x38, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 
-    0x88, 0x88, 0x80, 0x99, 0x99, 0x9E, 0x88, 0x88, 0x88, 0x83, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x88, 
-    0x88, 0x88, 0x81, 0x99, 0x99, 0x9B, 0x88, 0x88, 0x88, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9C, 0x88, 
-    0x88, 0x88, 0x8F, 0x99, 0x99, 0x91, 0x88, 0x88, 0x88, 0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x88, 
-    0x88, 0x88, 0x8E, 0x99, 0x99, 0x90, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xEA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x88, 
-    0x88, 0x88, 0xD9, 0x99, 0x99, 0x93, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x94, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF9, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF8, 0x88, 
-    0x88, 0x88, 0x09, 0x99, 0x99, 0xE8, 0x88, 0x88, 0x88, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0xFA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x09, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x21, 0x11, 
-    0x1D, 0x88, 0x19, 0x99, 0x99, 0x48, 0x8A, 0x11, 0x11, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x90, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x9D, 0x88, 0xB9, 0x99, 0x99, 0x18, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF9, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x28, 0x88, 0xE9, 0x99, 0x99, 0x08, 0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAF, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x18, 0x83, 0x99, 0x99, 0x99, 0xD8, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 
-    0xB9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xC8, 0x80, 0x99, 0x99, 0x9E, 0xA8, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xD8, 0x81, 0x99, 0x99, 0x9F, 0x88, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 
-    0x88, 0x8B, 0x99, 0x99, 0x91, 0x88, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 
-    0x88, 0x82, 0x99, 0x99, 0x90, 0x88, 0xB9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x8A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9C, 
-    0x88, 0x39, 0x99, 0x99, 0x9D, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 
-    0x88, 0x09, 0x99, 0x99, 0xEA, 0x8D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 
-    0x88, 0x59, 0x99, 0x99, 0xF8, 0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF8, 
-    0x88, 0x49, 0x99, 0x99, 0x18, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x18, 
-    0x88, 0x00, 0x00, 0x00, 0x38, 0x88, 0xD0, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x21, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x1C, 0x1E, 0x99, 0x99, 0x99, 0x99, 0x38, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8C, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x1D, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x1A, 0x88, 0x8A, 0xB9, 0x99, 0x99, 0x9E, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x0A, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x91, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x92, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x08, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x09, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x8D, 0x99, 0x99, 0x9E, 0xA8, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAE, 0x99, 0x99, 0x99, 0x92, 0x08, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x8D, 0x12, 0x21, 0x88, 0x88, 0x88, 0x88, 0x88, 0x19, 0x99, 0x99, 0x08, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x1A, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAE, 0x99, 0x99, 0xED, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x09, 0x99, 0x99, 0xE0, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x99, 0x99, 0x99, 
-    0x10, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x19, 0x99, 0x92, 0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8A, 0xE9, 0x99, 0x99, 
-    0x99, 0x92, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xE9, 0x99, 0xFA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x19, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x39, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB9, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x79, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x19, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xAE, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x81, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x18, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x80, 0x29, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xA1, 0xE9, 0x99, 0x99, 0x99, 0x90, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0xA0, 0xB2, 0xEE, 0x2B, 0xCA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xAA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+const uint8_t TI_LOGO_RLE[TI_LOGO_RLE_SIZE] = {
+    0xF2, 0xFF, 0xF2, 0x1E, 0x00, 0x00, 0xF1, 0x06, 0x00, 0x00, 0xF2, 0x66, 0xF3, 0x08, 0xF2, 0x66, 
+    0x7F, 0x7F, 0x7F, 0x7F, 0x54, 0x00, 0x00, 0xB1, 0x00, 0x00, 0xF2, 0x56, 0x58, 0xC3, 0x00, 0x10, 
+    0xF2, 0x56, 0x5E, 0x00, 0x00, 0xF2, 0x56, 0x57, 0x00, 0x00, 0xC3, 0xF2, 0x57, 0x7F, 0x7F, 0x55, 
+    0x00, 0x10, 0x7F, 0x7C, 0xF2, 0x5E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xF3, 0x06, 0x03, 0x02, 
+    0x21, 0xC3, 0x02, 0x22, 0x20, 0xF3, 0x05, 0x00, 0x00, 0xF2, 0x46, 0x5C, 0x03, 0x12, 0x20, 0x7F, 
+    0x70, 0x02, 0x22, 0x20, 0xC3, 0x7F, 0x7D, 0x03, 0x02, 0x21, 0x7F, 0x72, 0x00, 0x00, 0xC3, 0x02, 
+    0x22, 0x20, 0xF3, 0x06, 0x7F, 0x61, 0x00, 0x10, 0x7F, 0x7C, 0x03, 0x02, 0x21, 0x7F, 0x7C, 0xC3, 
+    0x03, 0x12, 0x20, 0x7F, 0x6C, 0xA1, 0x00, 0x20, 0x46, 0x03, 0x02, 0x20, 0xA1, 0x7F, 0x67, 0xD2, 
+    0x00, 0x00, 0xC3, 0xE2, 0x7F, 0x7F, 0xF3, 0x00, 0x00, 0x10, 0xF2, 0x46, 0xF3, 0x05, 0x00, 0x10, 
+    0xD2, 0x00, 0x10, 0x4B, 0x00, 0x00, 0xF3, 0x03, 0xF2, 0x32, 0x00, 0x00, 0xF1, 0x0A, 0x54, 0xC3, 
+    0x00, 0x10, 0xD2, 0x00, 0x10, 0xF3, 0x03, 0x00, 0x00, 0x79, 0xF3, 0x18, 0x00, 0x00, 0x4B, 0x00, 
+    0x00, 0xD2, 0xF3, 0x05, 0xF2, 0x32, 0xF3, 0x18, 0xD2, 0x00, 0x00, 0xC3, 0xE2, 0xF3, 0x06, 0x7F, 
+    0x7D, 0x00, 0x30, 0xF2, 0x30, 0x00, 0x00, 0xF3, 0x17, 0xA1, 0x03, 0x02, 0x21, 0x47, 0xB1, 0xF3, 
+    0x07, 0x00, 0x00, 0xF2, 0x30, 0x00, 0x10, 0xF3, 0x1A, 0x02, 0x02, 0x20, 0xC3, 0x03, 0x12, 0x20, 
+    0xF3, 0x0C, 0x78, 0x00, 0x20, 0xF3, 0x1A, 0x00, 0x20, 0x46, 0x03, 0x02, 0x21, 0x7F, 0xF2, 0x07, 
+    0xF3, 0x18, 0x00, 0x10, 0x4A, 0xF3, 0x0D, 0x7A, 0x00, 0x20, 0x61, 0x00, 0x00, 0xC3, 0x00, 0x20, 
+    0x7F, 0xF2, 0x0C, 0x00, 0x10, 0xF3, 0x15, 0x03, 0x02, 0x21, 0x46, 0x00, 0x00, 0x7F, 0xF2, 0x0B, 
+    0x00, 0x10, 0xF3, 0x14, 0x02, 0x22, 0x20, 0xC3, 0x03, 0x12, 0x21, 0x7F, 0xF2, 0x0C, 0x64, 0x02, 
+    0x02, 0x20, 0xF3, 0x0E, 0x7E, 0x00, 0x20, 0xF3, 0x12, 0x00, 0x10, 0x7F, 0xF2, 0x1A, 0x00, 0x10, 
+    0xF3, 0x11, 0x03, 0x02, 0x20, 0xC3, 0x02, 0x22, 0x00, 0x7F, 0xF2, 0x0F, 0xF3, 0x11, 0x03, 0x22, 
+    0x21, 0x46, 0x00, 0x10, 0x7F, 0xF2, 0x0F, 0x00, 0x10, 0x5A, 0xC3, 0x03, 0x12, 0x20, 0x7F, 0xF2, 
+    0x0F, 0x00, 0x00, 0xF3, 0x0F, 0x03, 0x12, 0x22, 0xC0, 0xA2, 0xA0, 0x7F, 0xF2, 0x0C, 0xF3, 0x0F, 
+    0x00, 0x00, 0xF2, 0x07, 0x50, 0x01, 0x10, 0xF2, 0x3A, 0x00, 0x00, 0xF3, 0x02, 0x02, 0x11, 0x10, 
+    0xF3, 0x00, 0xF2, 0x08, 0x00, 0x10, 0xF3, 0x05, 0x01, 0x10, 0xF2, 0x3E, 0xF3, 0x00, 0x00, 0x10, 
+    0xB2, 0x64, 0x00, 0x00, 0xF2, 0x41, 0x00, 0x00, 0xD3, 0x00, 0x10, 0xD2, 0x56, 0xF3, 0x02, 0x00, 
+    0x00, 0xF2, 0x44, 0x00, 0x00, 0xC3, 0xE2, 0x00, 0x00, 0x5E, 0x00, 0x00, 0xF2, 0x47, 0x04, 0x01, 
+    0x33, 0x10, 0xF2, 0x01, 0x00, 0x10, 0xB3, 0x00, 0x00, 0xF2, 0x06, 0x00, 0x00, 0xD3, 0x00, 0x10, 
+    0xF2, 0x59, 0xC3, 0x00, 0x00, 0x53, 0x00, 0x00, 0xF2, 0x5A, 0x00, 0x10, 0xC3, 0x01, 0x10, 0xF2, 
+    0x03, 0x00, 0x10, 0xB3, 0xF2, 0x5D, 0xF3, 0x10, 0xF2, 0x5E, 0x00, 0x10, 0xF3, 0x0E, 0xF2, 0x60, 
+    0xF3, 0x0D, 0xF2, 0x61, 0x00, 0x10, 0xF3, 0x0B, 0x00, 0x00, 0xF2, 0x61, 0x00, 0x00, 0xF3, 0x0B, 
+    0xF2, 0x63, 0xF3, 0x0A, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xF3, 0x09, 0xF2, 0x65, 0xF3, 0x08, 
+    0x00, 0x00, 0xF2, 0x65, 0x00, 0x00, 0x7F, 0xF2, 0x36, 0x00, 0x10, 0xF3, 0x06, 0xF2, 0x68, 0x7F, 
+    0xF2, 0x36, 0x00, 0x00, 0x7F, 0xF2, 0x36, 0x00, 0x10, 0x7F, 0xF2, 0x36, 0x00, 0x10, 0xF3, 0x03, 
+    0x00, 0x00, 0xF2, 0x6A, 0x00, 0x10, 0xF3, 0x02, 0x00, 0x10, 0xF2, 0x6B, 0x00, 0x00, 0xF3, 0x02, 
+    0xF2, 0x6D, 0x00, 0x10, 0xF3, 0x00, 0x00, 0x00, 0xF2, 0x6E, 0x00, 0x00, 0xC3, 0x00, 0x10, 0xF2, 
+    0xA8, 
+};
+
+const gfx_image_t TI_LOGO_IMG = {
+    .w = TI_LOGO_W, .h = TI_LOGO_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TI_LOGO_PAL, .colors = TI_LOGO_PAL_SIZE,
+    .data = TI_LOGO_RLE, .size = TI_LOGO_RLE_SIZE,
 };
@@ -8,14 +8,18 @@
 
 #include <stdbool.h>
 #include "timer.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_types.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/systick.h"
 #include "driverlib/interrupt.h"
 
 static volatile uint32_t g_ms = 0;
+static uint32_t g_ticks_per_us = 1;
 static void SysTickThunk(void){ g_ms++; }
 
 void timer_init(void){
+  g_ticks_per_us = SysCtlClockGet()/1000000u;
   SysTickPeriodSet(SysCtlClockGet()/1000u);
   SysTickIntRegister(SysTickThunk);
   SysTickIntEnable();
@@ -24,6 +28,22 @@ void timer_init(void){
 
 uint32_t millis(void){ return g_ms; }
 
+uint32_t micros(void){
+  uint32_t ms, seen, left;
+  do {                                   // tick counted in between: read again
+    seen = g_ms;
+    ms   = seen;
+    left = SysTickValueGet();
+    // Wrapped but the tick is not counted yet (interrupts masked, or its
+    // ISR not run yet): add it, and re-read so left is from after the wrap
+    if (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PEND_STSET){
+      left = SysTickValueGet();
+      ms++;
+    }
+  } while (seen != g_ms);
+  return ms * 1000u + (SysTickPeriodGet() - 1u - left) / g_ticks_per_us;
+}
+
 void delay_ms(uint32_t ms){
   uint32_t start = g_ms;
   // Fallback
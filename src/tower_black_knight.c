@@ -6,285 +6,85 @@ const uint16_t TOWER_BLACK_KNIGHT_PAL[TOWER_BLACK_KNIGHT_PAL_SIZE] = {
     0x58C9, 0x73B0, 0xA10B, 0xB165, 0x92EB, 0x8433, 0x7C12, 0x1207, 
 };
 
-const uint8_t TOWER_BLACK_KNIGHT_IDX[(TOWER_BLACK_KNIGHT_W * TOWER_BLACK_KNIGHT_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x06, 0x66, 0x66, 0x66, 0x60, 0x00, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x60, 
-    0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 0x60, 0x00, 0x16, 0x68, 0x02, 0x16, 0x60, 0x00, 0x00, 0x00, 
-    0x26, 0x68, 0x00, 0x86, 0x68, 0x00, 0x66, 0x60, 0x00, 0x06, 0x66, 0x00, 0x66, 0x60, 0x00, 0x00, 
-    0x66, 0x66, 0x66, 0x00, 0x00, 0x66, 0x60, 0x00, 0x06, 0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x60, 
-    0x00, 0x47, 0x33, 0x33, 0x33, 0xA0, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x58, 
-    0x00, 0x00, 0x00, 0x47, 0x33, 0x33, 0x50, 0x00, 0xC3, 0x3A, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0x20, 0xC3, 0x3A, 0x01, 0x33, 0x50, 0x00, 0x47, 0x35, 0x00, 0x73, 0x58, 0x00, 0x00, 
-    0x73, 0x33, 0x35, 0x80, 0x04, 0x73, 0x50, 0x00, 0x47, 0x35, 0x00, 0x73, 0x33, 0x33, 0x33, 0x50, 
-    0x00, 0x47, 0x35, 0x80, 0x15, 0x35, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x52, 
-    0x00, 0x00, 0x01, 0x33, 0xA0, 0x27, 0x35, 0x80, 0xC3, 0x3A, 0x43, 0x35, 0x20, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0x47, 0x35, 0x80, 0x01, 0x33, 0x35, 0x80, 0x47, 0x35, 0x00, 0x73, 0x58, 0x00, 0x43, 
-    0x35, 0x00, 0xC3, 0x3A, 0x04, 0x33, 0x50, 0x00, 0x47, 0x35, 0x00, 0x00, 0x27, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x35, 0x80, 0x47, 0x35, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x08, 0x73, 0xA7, 0x3B, 
-    0x80, 0x00, 0xA7, 0x3A, 0x60, 0x06, 0xBB, 0x80, 0xC3, 0x35, 0xC3, 0x58, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0xC3, 0x56, 0x00, 0x01, 0x33, 0x33, 0xB6, 0x47, 0x35, 0x00, 0x73, 0x58, 0x06, 0xB3, 
-    0x56, 0x00, 0x06, 0x66, 0x04, 0x53, 0x50, 0x00, 0x47, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x35, 0x80, 0x15, 0x35, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x47, 0x35, 0x2C, 0x33, 
-    0xA0, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x02, 0xC3, 0x33, 0x33, 0xA0, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x33, 0x33, 0xA0, 0x00, 0x01, 0x33, 0x33, 0x35, 0x47, 0x35, 0x00, 0x73, 0x58, 0x0C, 0x33, 
-    0xA0, 0x00, 0x00, 0x00, 0x04, 0x53, 0x50, 0x00, 0x47, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x33, 0x33, 0x33, 0xA0, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x47, 0x35, 0x2C, 0x33, 
-    0xA0, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x02, 0xC3, 0x33, 0x33, 0xA0, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x33, 0x33, 0xA0, 0x00, 0x01, 0x33, 0x54, 0x73, 0x33, 0x35, 0x00, 0x73, 0x58, 0x0C, 0x33, 
-    0xA0, 0x07, 0x33, 0x3A, 0x04, 0x33, 0x33, 0x33, 0x33, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x35, 0xA6, 0xC3, 0x3A, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x47, 0x33, 0x57, 0x33, 
-    0xA0, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x35, 0xC3, 0x3A, 0x00, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0x17, 0x3A, 0x20, 0x01, 0x33, 0x52, 0x6C, 0x33, 0x35, 0x00, 0x73, 0x58, 0x0C, 0x33, 
-    0xA0, 0x06, 0xC3, 0x3A, 0x04, 0x53, 0x56, 0x66, 0x17, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x35, 0x80, 0x47, 0x35, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 0x17, 0x33, 0x33, 0x33, 
-    0xA6, 0x04, 0xC3, 0x58, 0x00, 0x00, 0x66, 0x00, 0xC3, 0x3A, 0x45, 0x35, 0x80, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0x2C, 0x35, 0x86, 0x01, 0x33, 0x50, 0x01, 0x33, 0x35, 0x0F, 0x73, 0x58, 0x01, 0x33, 
-    0xA0, 0x00, 0x13, 0x3A, 0x04, 0x53, 0x50, 0x00, 0x47, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x35, 0x80, 0x47, 0x35, 0x04, 0x73, 0x58, 0x00, 0x00, 0x01, 0x33, 0x50, 0x00, 0x45, 
-    0x35, 0x00, 0x0C, 0x33, 0xA0, 0x4C, 0x35, 0xA0, 0xC3, 0x3A, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0x00, 0xC3, 0x3A, 0x01, 0x33, 0x50, 0x00, 0x47, 0x35, 0x0F, 0x73, 0x58, 0x00, 0x47, 
-    0x35, 0x00, 0x13, 0x3A, 0x04, 0x33, 0x50, 0x00, 0x47, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x47, 0x33, 0x33, 0x33, 0xA6, 0x04, 0x73, 0x33, 0x33, 0x3A, 0x01, 0x33, 0x50, 0x00, 0x15, 
-    0x35, 0x00, 0x00, 0x17, 0x33, 0x33, 0x58, 0x60, 0xC3, 0x3A, 0x04, 0x73, 0x58, 0x00, 0x00, 0x00, 
-    0x13, 0x35, 0x00, 0xC3, 0x3A, 0x01, 0x33, 0x50, 0x00, 0x47, 0x35, 0x04, 0x73, 0x58, 0x00, 0x06, 
-    0x73, 0x33, 0x33, 0x35, 0x01, 0x73, 0x50, 0x00, 0x47, 0x35, 0x00, 0x00, 0x47, 0x35, 0x80, 0x00, 
-    0x00, 0x0C, 0xBB, 0xB3, 0xBB, 0x80, 0x02, 0xCB, 0xBB, 0x3B, 0x38, 0x01, 0xBB, 0xA0, 0x00, 0x4B, 
-    0xBA, 0x00, 0x00, 0x4B, 0xB3, 0x3B, 0xA2, 0x02, 0x1B, 0xBA, 0x04, 0xCB, 0xA8, 0x00, 0x00, 0x00, 
-    0x1B, 0xBA, 0x00, 0x1B, 0xBA, 0x01, 0xBB, 0xA0, 0x00, 0x4B, 0xBA, 0x00, 0xCB, 0xB6, 0x00, 0x00, 
-    0x1B, 0xBB, 0xBB, 0xBA, 0x04, 0xBB, 0xA0, 0x00, 0x0B, 0xBA, 0x00, 0x00, 0x0B, 0xBB, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x22, 0x44, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x02, 0x11, 0x44, 0x11, 0x14, 0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x22, 0x02, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x22, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x24, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x20, 0x02, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x12, 0x01, 0x14, 0x24, 0x22, 0x22, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x40, 0x01, 0x14, 0x24, 0x44, 0x21, 0x42, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x21, 0x14, 0x10, 0x21, 0x42, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x10, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x11, 0x00, 0x00, 0x42, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x04, 0x42, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x12, 0x22, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x14, 0x44, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x14, 
-    0x11, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x14, 
-    0x44, 0x42, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 
-    0x14, 0x44, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x11, 0x41, 0x44, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 
-    0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x14, 0x11, 0x44, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x22, 
-    0x22, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 
-    0x11, 0x11, 0x14, 0x14, 0x44, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x22, 
-    0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x19, 0x91, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x22, 0x22, 0x22, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x40, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x22, 0x20, 0x22, 0x22, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x02, 0x22, 0x22, 0x22, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x11, 0x10, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9E, 0x99, 0x99, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x44, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1D, 0xDD, 0xED, 0x10, 
-    0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x24, 0x44, 0x41, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xDD, 0x9E, 0x90, 
-    0x01, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x44, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xED, 0xEE, 0xE0, 
-    0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x24, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEE, 0xEE, 0xD1, 
-    0x02, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0xDE, 0x9D, 
-    0xD9, 0x91, 0x20, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x24, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0xDD, 
-    0x99, 0x91, 0x91, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 
-    0x99, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x24, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x21, 
-    0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x42, 0x22, 0x00, 0x00, 0x20, 0x00, 0x00, 0x22, 0x44, 0x24, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0x11, 
-    0x19, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x14, 0x42, 0x22, 0x22, 0x22, 0x00, 0x02, 0x24, 0x44, 0x14, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x99, 
-    0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x22, 0x22, 0x22, 0x20, 0x22, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x99, 
-    0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x42, 0x22, 0x22, 0x22, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE9, 
-    0x99, 0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x14, 0x24, 0x11, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 
-    0x99, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 
-    0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x19, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x41, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x14, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t TOWER_BLACK_KNIGHT_RLE[TOWER_BLACK_KNIGHT_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x6A, 0xE6, 0x05, 0x00, 0x06, 0x66, 0xF0, 0x01, 0xA6, 0xE0, 0xC6, 
+    0x0B, 0x00, 0x01, 0x66, 0x80, 0x21, 0x66, 0xD0, 0x0E, 0x26, 0x68, 0x00, 0x86, 0x68, 0x00, 0x66, 
+    0x60, 0xA0, 0x07, 0x66, 0x60, 0x06, 0x66, 0xB0, 0xC6, 0xA0, 0x02, 0x66, 0x60, 0xA0, 0x04, 0x66, 
+    0x60, 0x00, 0xF6, 0x00, 0x04, 0x00, 0x04, 0x70, 0xC3, 0x07, 0xA0, 0x04, 0x73, 0x58, 0xE0, 0x05, 
+    0x13, 0x33, 0x58, 0xC0, 0x01, 0x47, 0xA3, 0x0D, 0x50, 0x00, 0xC3, 0x3A, 0x04, 0x73, 0x58, 0xC0, 
+    0x1B, 0x13, 0x35, 0x20, 0xC3, 0x3A, 0x01, 0x33, 0x50, 0x00, 0x47, 0x35, 0x00, 0x73, 0x58, 0xA0, 
+    0x00, 0x70, 0xA3, 0x11, 0x58, 0x00, 0x47, 0x35, 0x00, 0x04, 0x73, 0x50, 0x07, 0xD3, 0x00, 0x50, 
+    0x44, 0x06, 0x58, 0x01, 0x53, 0x50, 0x51, 0x00, 0x20, 0xB0, 0x09, 0x13, 0x3A, 0x02, 0x73, 0x58, 
+    0x43, 0x04, 0x43, 0x35, 0x20, 0xD0, 0x42, 0x05, 0x47, 0x35, 0x80, 0x42, 0x02, 0x35, 0x80, 0x4B, 
+    0x0C, 0x43, 0x35, 0x00, 0xC3, 0x3A, 0x04, 0x30, 0x49, 0x06, 0x00, 0x27, 0x35, 0x80, 0xB0, 0x44, 
+    0x01, 0x47, 0x4D, 0x14, 0x87, 0x3A, 0x73, 0xB8, 0x00, 0x0A, 0x73, 0xA6, 0x00, 0x6B, 0xB0, 0x43, 
+    0x04, 0x5C, 0x35, 0x80, 0xE0, 0x42, 0x04, 0xC3, 0x56, 0x00, 0x44, 0x02, 0x3B, 0x60, 0x49, 0x0D, 
+    0x6B, 0x35, 0x60, 0x00, 0x66, 0x60, 0x45, 0x4B, 0x00, 0x40, 0x4D, 0x01, 0x15, 0x4C, 0x0F, 0x47, 
+    0x35, 0x2C, 0x33, 0xA0, 0x04, 0x73, 0x58, 0xD0, 0x01, 0x2C, 0xB3, 0x00, 0xA0, 0xF0, 0x00, 0x00, 
+    0x10, 0xB3, 0x00, 0xA0, 0xA0, 0x43, 0x01, 0x35, 0x49, 0x03, 0xC3, 0x3A, 0xE0, 0x5A, 0xB3, 0x01, 
+    0xA0, 0x7F, 0x03, 0x35, 0x47, 0xA3, 0x4C, 0x06, 0x73, 0x33, 0xA0, 0x40, 0xF3, 0x00, 0x50, 0x06, 
+    0x5A, 0x6C, 0x33, 0xA0, 0x4D, 0x02, 0x35, 0x70, 0x4F, 0x08, 0x0C, 0x33, 0x5C, 0x33, 0xA0, 0x49, 
+    0x05, 0x51, 0x73, 0xA2, 0x44, 0x02, 0x26, 0xC0, 0x4F, 0x01, 0x6C, 0x43, 0x07, 0x53, 0x56, 0x66, 
+    0x17, 0x52, 0x05, 0x80, 0x47, 0x35, 0x4A, 0x01, 0x17, 0xC3, 0x04, 0xA6, 0x04, 0xC0, 0x45, 0x01, 
+    0x66, 0x43, 0x05, 0xA4, 0x53, 0x58, 0x49, 0x05, 0x2C, 0x35, 0x86, 0x43, 0x02, 0x00, 0x10, 0x43, 
+    0x00, 0xF0, 0x43, 0x00, 0x10, 0x43, 0x01, 0x01, 0x46, 0x03, 0x00, 0x04, 0x64, 0x17, 0x13, 0x35, 
+    0x00, 0x04, 0x53, 0x50, 0x00, 0xC3, 0x3A, 0x04, 0xC3, 0x5A, 0x43, 0x05, 0x04, 0x73, 0x58, 0x48, 
+    0x05, 0x00, 0xC3, 0x3A, 0x45, 0x02, 0x04, 0x70, 0x47, 0x04, 0x04, 0x73, 0x50, 0x46, 0x00, 0x30, 
+    0x58, 0xB3, 0x01, 0xA6, 0x42, 0xB3, 0x00, 0xA0, 0x46, 0x00, 0x10, 0x44, 0x02, 0x01, 0x70, 0xA3, 
+    0x02, 0x58, 0x60, 0x66, 0x00, 0x40, 0x44, 0x02, 0x06, 0x70, 0xC3, 0x03, 0x50, 0x17, 0x55, 0x1F, 
+    0x0C, 0xBB, 0xB3, 0xBB, 0x80, 0x02, 0xCB, 0xBB, 0x3B, 0x38, 0x01, 0xBB, 0xA0, 0x00, 0x4B, 0xBA, 
+    0xA0, 0x12, 0x4B, 0xB3, 0x3B, 0xA2, 0x02, 0x1B, 0xBA, 0x04, 0xCB, 0xA0, 0x46, 0x0D, 0xBB, 0xA0, 
+    0x01, 0xBB, 0xA0, 0x1B, 0xBA, 0x42, 0x08, 0xBB, 0xA0, 0x0C, 0xBB, 0x60, 0xA0, 0x00, 0x10, 0xCB, 
+    0x05, 0xA0, 0x4B, 0xBA, 0xA0, 0x02, 0xBB, 0xA0, 0xB0, 0x02, 0xBB, 0xB0, 0xF0, 0x29, 0x00, 0x20, 
+    0xF0, 0x75, 0x03, 0x20, 0x02, 0xF0, 0x73, 0x00, 0x20, 0xF0, 0x75, 0x00, 0x20, 0x59, 0x00, 0x20, 
+    0xF0, 0x76, 0x01, 0x42, 0xF0, 0x55, 0x00, 0x20, 0xF0, 0x0C, 0x00, 0x10, 0xF0, 0x00, 0x05, 0x14, 
+    0x22, 0x44, 0xA2, 0xF0, 0x4D, 0x01, 0x22, 0xF0, 0x11, 0x0F, 0x20, 0x02, 0x11, 0x44, 0x11, 0x14, 
+    0x44, 0x22, 0xF0, 0x48, 0xB2, 0xC0, 0x00, 0x20, 0xF0, 0x0E, 0xF1, 0x01, 0x06, 0x44, 0x22, 0x02, 
+    0x20, 0xF0, 0x43, 0xF2, 0x00, 0x58, 0x01, 0x04, 0xF1, 0x01, 0x00, 0x40, 0xC2, 0xF0, 0x42, 0x01, 
+    0x24, 0x46, 0xF0, 0x13, 0xF1, 0x00, 0xD2, 0xF0, 0x3E, 0x05, 0x22, 0x00, 0x20, 0x66, 0x06, 0x20, 
+    0x11, 0x42, 0x40, 0xB2, 0xF0, 0x3F, 0x02, 0x20, 0x00, 0x42, 0xF0, 0x18, 0x04, 0x11, 0x24, 0x00, 
+    0x44, 0x05, 0x44, 0x21, 0x42, 0xF0, 0x3C, 0x00, 0x20, 0xF0, 0x25, 0x07, 0x12, 0x21, 0x14, 0x10, 
+    0x7F, 0xF0, 0x02, 0x00, 0x20, 0xF0, 0x24, 0xB1, 0x03, 0x01, 0x02, 0x7F, 0xF0, 0x2D, 0x03, 0x24, 
+    0x11, 0xA0, 0x00, 0x40, 0x7F, 0xF0, 0x2D, 0x01, 0x41, 0xB0, 0x00, 0x40, 0x7F, 0xF0, 0x33, 0x03, 
+    0x21, 0x11, 0xA2, 0xF0, 0x4A, 0x00, 0x10, 0xF0, 0x1B, 0xA1, 0x05, 0x44, 0x42, 0x22, 0xF0, 0x33, 
+    0xA2, 0xF0, 0x06, 0x00, 0x10, 0xF0, 0x1D, 0xC1, 0x05, 0x41, 0x14, 0x22, 0x7C, 0x00, 0x20, 0xF0, 
+    0x04, 0x02, 0x22, 0x10, 0xF0, 0x1B, 0xD1, 0xA4, 0xA2, 0x7F, 0xF0, 0x28, 0xE1, 0xC4, 0x00, 0x20, 
+    0x7F, 0xF0, 0x28, 0xE1, 0x01, 0x41, 0x42, 0x00, 0x20, 0xF0, 0x2A, 0xD2, 0x00, 0x10, 0xF0, 0x2E, 
+    0xE1, 0x07, 0x41, 0x14, 0x42, 0x22, 0xF0, 0x25, 0xA2, 0x00, 0x00, 0xB2, 0x00, 0x40, 0xF0, 0x2E, 
+    0x00, 0x40, 0xF1, 0x00, 0x01, 0x41, 0xA4, 0x01, 0x22, 0x6D, 0x00, 0x00, 0x44, 0x00, 0x10, 0xF0, 
+    0x2B, 0x06, 0x14, 0x00, 0x19, 0x90, 0xF1, 0x03, 0x02, 0x42, 0x20, 0xF0, 0x1F, 0x03, 0x22, 0x20, 
+    0xF2, 0x00, 0xF0, 0x2C, 0x04, 0x11, 0x40, 0x00, 0xF1, 0x06, 0x02, 0x44, 0x20, 0xF0, 0x1C, 0x02, 
+    0x20, 0x00, 0xA2, 0x00, 0x00, 0xC2, 0xF0, 0x2D, 0xA1, 0x01, 0x00, 0xF1, 0x06, 0x02, 0x42, 0x20, 
+    0xF0, 0x1A, 0x05, 0x22, 0x20, 0x00, 0xF2, 0x00, 0xF0, 0x2C, 0x07, 0x19, 0x91, 0x11, 0x00, 0xF1, 
+    0x06, 0x03, 0x42, 0x22, 0xF0, 0x19, 0xF2, 0x03, 0x02, 0x44, 0x20, 0x74, 0x00, 0xE0, 0xA9, 0x02, 
+    0x00, 0x00, 0x4C, 0x01, 0x42, 0xF0, 0x1A, 0xF2, 0x01, 0x03, 0x44, 0x14, 0xF0, 0x2C, 0x0A, 0x11, 
+    0xDD, 0xDE, 0xD1, 0x01, 0x00, 0x4C, 0x00, 0x40, 0xF0, 0x19, 0xE2, 0xA4, 0xB1, 0xF0, 0x2B, 0x42, 
+    0x07, 0x9E, 0x90, 0x01, 0x14, 0x49, 0x03, 0x22, 0x02, 0xF0, 0x15, 0xD2, 0x01, 0x44, 0xF1, 0x01, 
+    0xF0, 0x2C, 0x09, 0x9E, 0xDE, 0xEE, 0x00, 0x02, 0xF1, 0x02, 0xB2, 0xF0, 0x14, 0xD2, 0x00, 0x40, 
+    0xF1, 0x03, 0xF0, 0x2B, 0x01, 0x19, 0xAE, 0x03, 0xD1, 0x02, 0xC0, 0xC1, 0x01, 0x42, 0xF0, 0x17, 
+    0xA2, 0x02, 0x44, 0x40, 0xF1, 0x04, 0xF0, 0x2C, 0x0B, 0x1D, 0xDD, 0xE9, 0xDD, 0x99, 0x12, 0xA0, 
+    0xA1, 0xF0, 0x18, 0xB2, 0x02, 0x44, 0x40, 0xF1, 0x05, 0xF0, 0x2E, 0x00, 0x10, 0xAD, 0x07, 0x99, 
+    0x91, 0x91, 0x01, 0xF0, 0x1D, 0xA2, 0xA4, 0xF1, 0x04, 0xF0, 0x31, 0x04, 0x19, 0xD9, 0x90, 0xB1, 
+    0xF0, 0x10, 0x02, 0x22, 0x20, 0xF0, 0x03, 0xA2, 0xB4, 0xF1, 0x01, 0xF0, 0x30, 0x04, 0x10, 0x02, 
+    0x10, 0x45, 0xC1, 0xF0, 0x0A, 0x03, 0x42, 0x22, 0xA0, 0x00, 0x20, 0xB0, 0x03, 0x22, 0x44, 0x7F, 
+    0x47, 0x00, 0x90, 0xA1, 0x01, 0x99, 0xF1, 0x03, 0x03, 0x20, 0x02, 0xF0, 0x04, 0x02, 0x14, 0x40, 
+    0xD2, 0x0B, 0x00, 0x02, 0x24, 0x44, 0x14, 0x44, 0xF1, 0x03, 0x00, 0x20, 0xF0, 0x30, 0x00, 0xE0, 
+    0xC9, 0xF1, 0x05, 0xF0, 0x06, 0xA1, 0xD2, 0x04, 0x02, 0x24, 0x40, 0xF1, 0x0A, 0xF0, 0x30, 0x01, 
+    0x4E, 0xC9, 0xF1, 0x04, 0x01, 0x42, 0x4F, 0x00, 0x40, 0xD2, 0x00, 0x40, 0xF1, 0x0D, 0xF0, 0x31, 
+    0x01, 0x1E, 0x50, 0x02, 0x14, 0x20, 0x4E, 0x07, 0x14, 0x24, 0x11, 0x44, 0xF1, 0x0D, 0xF0, 0x33, 
+    0x00, 0x10, 0xA9, 0xF1, 0x07, 0x50, 0x01, 0x14, 0xF1, 0x11, 0x00, 0x40, 0xF0, 0x34, 0x01, 0x99, 
+    0xF1, 0x09, 0x51, 0xF1, 0x12, 0xF0, 0x35, 0x02, 0x11, 0x90, 0xF1, 0x07, 0x02, 0x42, 0x20, 0x6A, 
+    0x00, 0x10, 0xF0, 0x35, 0xF1, 0x08, 0x02, 0x44, 0x20, 0xF0, 0x03, 0x7F, 0xF0, 0x15, 0x02, 0x11, 
+    0x40, 0xF1, 0x07, 0x02, 0x42, 0x20, 0x7F, 0x69, 0xF1, 0x06, 0x03, 0x44, 0x22, 0xF0, 0x03, 0x7F, 
+    0xF0, 0x16, 0x01, 0x12, 0xF1, 0x02, 0x05, 0x44, 0x12, 0x22, 0xF0, 0x04, 0xF1, 0x1A, 0xF0, 0x36, 
+    0x4A, 0x02, 0x22, 0x20, 0xF0, 0x06, 0xF1, 0x19, 0xF0, 0x37, 0xF1, 0x03, 0x01, 0x22, 0xF0, 0x07, 
+    0xF1, 0x19, 0x00, 0x20, 0x7F, 0xF1, 0x00, 0x01, 0x42, 0xF0, 0x08, 0xF1, 0x1A, 0xF0, 0x37, 0xF1, 
+    0x01, 0x00, 0x20, 0x7F, 0x7A, 0x01, 0x44, 0x67, 0x01, 0x22, 0xF1, 0x02, 0x00, 0x20, 0xF0, 0x37, 
+    0xC1, 0x03, 0x44, 0x22, 0xF0, 0x09, 
+};
+
+const gfx_image_t TOWER_BLACK_KNIGHT_IMG = {
+    .w = TOWER_BLACK_KNIGHT_W, .h = TOWER_BLACK_KNIGHT_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TOWER_BLACK_KNIGHT_PAL, .colors = TOWER_BLACK_KNIGHT_PAL_SIZE,
+    .data = TOWER_BLACK_KNIGHT_RLE, .size = TOWER_BLACK_KNIGHT_RLE_SIZE,
 };
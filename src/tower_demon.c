@@ -6,197 +6,80 @@ const uint16_t TOWER_DEMON_PAL[TOWER_DEMON_PAL_SIZE] = {
     0xF4B3, 0xA289, 0xE392, 0xAA26, 0x6249, 0xA96A, 0x6A07, 0xB331, 
 };
 
-const uint8_t TOWER_DEMON_IDX[(TOWER_DEMON_W * TOWER_DEMON_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 
-    0x22, 0x66, 0x66, 0x66, 0x64, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x73, 0x33, 0x46, 0x66, 0x66, 
-    0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 
-    0x26, 0x66, 0x66, 0x66, 0x64, 0x44, 0x33, 0x33, 0x33, 0x33, 0x77, 0x33, 0x33, 0x44, 0x46, 0x66, 
-    0x62, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 
-    0x26, 0x66, 0x64, 0x43, 0x33, 0x33, 0x37, 0x73, 0x77, 0x77, 0x77, 0x33, 0x73, 0x33, 0x46, 0x66, 
-    0x66, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE5, 0x55, 0x55, 
-    0x36, 0x63, 0x55, 0x55, 0x55, 0xA3, 0x55, 0x58, 0x75, 0x55, 0x87, 0x77, 0x55, 0x55, 0x86, 0x66, 
-    0x55, 0xA2, 0x10, 0x5A, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xC5, 0x5D, 0x25, 
-    0x53, 0x63, 0x55, 0x34, 0x33, 0x47, 0x55, 0x58, 0x75, 0x55, 0x87, 0x85, 0x58, 0x35, 0x58, 0x64, 
-    0x55, 0x5A, 0x20, 0x5A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE5, 0x5D, 0x22, 
-    0x55, 0x34, 0x55, 0x36, 0x44, 0x47, 0x55, 0x58, 0x75, 0x55, 0x87, 0x55, 0x83, 0x33, 0x55, 0xA6, 
-    0x55, 0x55, 0xF0, 0x5A, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x95, 0x5D, 0x22, 
-    0x55, 0x34, 0x55, 0x55, 0x5A, 0x47, 0x55, 0x55, 0x55, 0x55, 0x87, 0x55, 0x83, 0x34, 0x55, 0x86, 
-    0x55, 0xA5, 0x55, 0x5A, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x95, 0x5D, 0x12, 
-    0x55, 0x34, 0x55, 0xA3, 0x33, 0x47, 0x55, 0x85, 0x58, 0x55, 0x87, 0x55, 0x83, 0x34, 0x55, 0x86, 
-    0x55, 0x32, 0x55, 0x58, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x95, 0x50, 0x25, 
-    0x5F, 0x1C, 0x55, 0x36, 0x44, 0x47, 0x55, 0x85, 0x58, 0x55, 0x87, 0x85, 0x5A, 0x45, 0x58, 0x24, 
-    0x55, 0x91, 0x25, 0x5A, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x95, 0x55, 0x55, 
-    0xF1, 0x29, 0x55, 0x55, 0x55, 0xA3, 0x55, 0x85, 0x58, 0x55, 0x87, 0x78, 0x55, 0x55, 0x84, 0x21, 
-    0x55, 0x90, 0x15, 0x58, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x22, 0x1C, 0xCC, 0xCC, 
-    0x16, 0x66, 0x33, 0x37, 0x77, 0x33, 0x98, 0x78, 0x87, 0x87, 0x77, 0x73, 0x88, 0x87, 0x34, 0x42, 
-    0xC9, 0x10, 0x01, 0x92, 0x22, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 
-    0x66, 0x66, 0x66, 0x66, 0x44, 0x33, 0x23, 0x33, 0x37, 0x7B, 0x37, 0x77, 0x33, 0x33, 0x44, 0x46, 
-    0x21, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x66, 0x66, 0x66, 0x44, 0x43, 0x32, 0xB3, 0x33, 0x37, 0x79, 0x27, 0x77, 0x73, 0x33, 0x34, 0x44, 
-    0x41, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x66, 0x66, 0x44, 0x44, 0x44, 0x31, 0xB3, 0x33, 0x37, 0x73, 0x13, 0x77, 0x73, 0x33, 0x34, 0x44, 
-    0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 
-    0x66, 0x44, 0x44, 0x44, 0x43, 0x21, 0x33, 0x33, 0x33, 0x77, 0x11, 0x77, 0x73, 0x33, 0x34, 0x44, 
-    0x61, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 
-    0x64, 0x64, 0x44, 0x43, 0x34, 0x02, 0x33, 0x33, 0x33, 0x37, 0xB0, 0x97, 0x33, 0x33, 0x34, 0x44, 
-    0x62, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
-    0x64, 0x64, 0x44, 0x44, 0x31, 0x13, 0x33, 0x33, 0x33, 0x33, 0x31, 0x13, 0x33, 0x33, 0x34, 0x44, 
-    0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x26, 
-    0x64, 0x44, 0x44, 0x44, 0x20, 0x13, 0x33, 0x33, 0x33, 0x33, 0x32, 0x02, 0x33, 0x33, 0x44, 0x46, 
-    0x62, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x26, 
-    0x66, 0x44, 0x44, 0x44, 0x10, 0xB3, 0x33, 0x33, 0x33, 0x33, 0x39, 0x01, 0x33, 0x34, 0x44, 0x46, 
-    0x62, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 
-    0x66, 0x44, 0x44, 0x44, 0x00, 0xB3, 0x43, 0x33, 0x33, 0x33, 0x39, 0x00, 0x43, 0x34, 0x44, 0x66, 
-    0x61, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 
-    0x64, 0x44, 0x44, 0x4B, 0x00, 0x13, 0x33, 0x44, 0x44, 0x33, 0x31, 0x00, 0xB3, 0x44, 0x46, 0x66, 
-    0x21, 0x00, 0x01, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 
-    0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-    0x64, 0x44, 0x44, 0x44, 0x00, 0x01, 0xE9, 0x33, 0x73, 0x91, 0x10, 0x00, 0x44, 0x44, 0x66, 0x66, 
-    0x20, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x01, 
-    0x64, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00, 0x92, 0x99, 0x00, 0x00, 0x02, 0x44, 0x46, 0x66, 0x62, 
-    0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 
-    0x14, 0x44, 0x44, 0x44, 0x41, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x14, 0x66, 0x66, 0x66, 0x61, 
-    0x10, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x02, 0x44, 0x44, 0x44, 0x44, 0x66, 0x10, 0x00, 0x00, 0x01, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x01, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x10, 0x00, 0x02, 0x34, 0x66, 0x66, 0x66, 0x62, 0x11, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x01, 0x1B, 0x24, 0x44, 0x44, 0x62, 0x11, 0x31, 0x03, 0x11, 0xB3, 0x46, 0x66, 0x62, 0x21, 0x10, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0xB4, 0x43, 0x21, 0x00, 0x11, 0x01, 0x00, 0x12, 0x96, 0x62, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x01, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x12, 0xB9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x21, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x10, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x12, 0x10, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x22, 0x01, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x10, 
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x01, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x21, 0x11, 0x11, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x12, 0x21, 0x11, 0x12, 0x12, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x21, 0x11, 0x11, 
-    0x11, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 
-    0x11, 0x11, 0x12, 0x21, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 
-    0x11, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 
-    0x11, 0x11, 0x11, 0x21, 0x11, 0x12, 0x12, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x22, 0x12, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x22, 0x12, 0x12, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x21, 0x12, 0x12, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x22, 0x12, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x22, 0x11, 0x21, 0x11, 
-    0x21, 0x11, 0x00, 0x00, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x10, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x21, 0x21, 0x11, 0x11, 
-    0x21, 0x10, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x12, 0x21, 0x11, 0x11, 0x11, 
-    0x22, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x11, 0x11, 
-    0x22, 0x10, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t TOWER_DEMON_RLE[TOWER_DEMON_RLE_SIZE] = {
+    0xF0, 0x07, 0xF1, 0x04, 0xB2, 0xD6, 0x02, 0x44, 0x40, 0xF3, 0x01, 0x04, 0x73, 0x33, 0x40, 0xB6, 
+    0xB2, 0xE1, 0xF0, 0x1A, 0xF1, 0x05, 0x02, 0x22, 0x20, 0xE6, 0x49, 0x01, 0x77, 0xA3, 0x02, 0x44, 
+    0x40, 0xA6, 0x4A, 0x01, 0x11, 0xF0, 0x17, 0xF1, 0x04, 0xB2, 0xA6, 0x01, 0x44, 0xC3, 0x02, 0x77, 
+    0x30, 0xC7, 0x05, 0x33, 0x73, 0x33, 0x43, 0x00, 0x60, 0xC2, 0xE1, 0xF0, 0x13, 0xF1, 0x05, 0x00, 
+    0xE0, 0xB5, 0x03, 0x36, 0x63, 0xC5, 0x0D, 0xA3, 0x55, 0x58, 0x75, 0x55, 0x87, 0x77, 0xA5, 0x0B, 
+    0x86, 0x66, 0x55, 0xA2, 0x10, 0x5A, 0xF1, 0x00, 0x02, 0x01, 0x10, 0xF0, 0x0B, 0xF1, 0x09, 0x07, 
+    0xC5, 0x5D, 0x25, 0x53, 0x42, 0x05, 0x34, 0x33, 0x47, 0x48, 0x0E, 0x85, 0x58, 0x35, 0x58, 0x64, 
+    0x55, 0x5A, 0x20, 0x4A, 0xE1, 0xF0, 0x05, 0xF1, 0x0A, 0x00, 0xE0, 0x42, 0x0A, 0x25, 0x53, 0x45, 
+    0x53, 0x64, 0x40, 0x4A, 0x09, 0x55, 0x83, 0x33, 0x55, 0xA6, 0xA5, 0x04, 0xF0, 0x5A, 0x20, 0xF1, 
+    0x09, 0x5A, 0x03, 0x22, 0x29, 0x49, 0x03, 0x55, 0x5A, 0x43, 0xB5, 0x45, 0x07, 0x45, 0x58, 0x65, 
+    0x5A, 0xA5, 0x52, 0xB1, 0x5C, 0x00, 0x10, 0x45, 0x03, 0xA3, 0x33, 0x42, 0x03, 0x85, 0x58, 0x4E, 
+    0x07, 0x32, 0x55, 0x58, 0x22, 0x71, 0x0C, 0x02, 0x55, 0xF1, 0xC5, 0x53, 0x64, 0x40, 0x4A, 0x11, 
+    0x85, 0x5A, 0x45, 0x58, 0x24, 0x55, 0x91, 0x25, 0x5A, 0x5C, 0xF1, 0x09, 0x43, 0x06, 0x55, 0x5F, 
+    0x12, 0x90, 0xC5, 0x01, 0xA3, 0x48, 0x01, 0x78, 0xA5, 0x0C, 0x84, 0x21, 0x55, 0x90, 0x15, 0x58, 
+    0x20, 0xF1, 0x0E, 0x51, 0x00, 0x20, 0x44, 0x00, 0x10, 0xBC, 0x12, 0x16, 0x66, 0x33, 0x37, 0x77, 
+    0x33, 0x98, 0x78, 0x87, 0x80, 0xA7, 0x12, 0x38, 0x88, 0x73, 0x44, 0x2C, 0x91, 0x00, 0x19, 0x22, 
+    0x20, 0x67, 0xC1, 0xC0, 0x00, 0x10, 0xE6, 0x04, 0x44, 0x33, 0x20, 0xA3, 0x06, 0x77, 0xB3, 0x77, 
+    0x70, 0xA3, 0x07, 0x44, 0x46, 0x21, 0x11, 0xA0, 0xF1, 0x0F, 0x53, 0xF0, 0x01, 0xD6, 0x06, 0x44, 
+    0x43, 0x32, 0xB0, 0x44, 0x01, 0x92, 0xA7, 0xA3, 0xA4, 0x45, 0x02, 0x00, 0x00, 0x58, 0xF1, 0x05, 
+    0xF0, 0x03, 0x00, 0x20, 0xA6, 0xC4, 0x01, 0x31, 0x45, 0x02, 0x31, 0x30, 0x48, 0x00, 0x20, 0x48, 
+    0x01, 0x00, 0x61, 0xF0, 0x05, 0x03, 0x16, 0x66, 0xD4, 0x02, 0x32, 0x10, 0xC3, 0x03, 0x77, 0x11, 
+    0x48, 0x00, 0x60, 0x4A, 0x02, 0x00, 0x00, 0x53, 0x01, 0x00, 0xD1, 0xF0, 0x07, 0x04, 0x26, 0x64, 
+    0x60, 0xA4, 0x04, 0x33, 0x40, 0x20, 0xD3, 0x04, 0x7B, 0x09, 0x70, 0xB3, 0x42, 0x00, 0x20, 0x4C, 
+    0x01, 0x00, 0x52, 0xD1, 0xF0, 0x08, 0x00, 0x60, 0x46, 0x03, 0x43, 0x11, 0xF3, 0x01, 0x01, 0x11, 
+    0xC3, 0x44, 0xF0, 0x08, 0xF1, 0x02, 0xE0, 0xA1, 0xF0, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x02, 0x26, 
+    0x60, 0xD4, 0x01, 0x20, 0x49, 0x02, 0x20, 0x20, 0xA3, 0x05, 0x44, 0x46, 0x62, 0xE0, 0x01, 0x11, 
+    0xF0, 0x00, 0xF1, 0x00, 0xF0, 0x00, 0x01, 0x11, 0xF0, 0x01, 0x00, 0x10, 0x4B, 0x00, 0x60, 0xC4, 
+    0x02, 0x10, 0xB0, 0xF3, 0x01, 0x05, 0x90, 0x13, 0x33, 0xA4, 0x54, 0x00, 0x00, 0x4F, 0xF0, 0x0E, 
+    0x00, 0x10, 0x47, 0x04, 0x00, 0xB3, 0x40, 0x48, 0x01, 0x04, 0x43, 0x07, 0x66, 0x61, 0x00, 0x01, 
+    0xF0, 0x09, 0xB1, 0xF0, 0x0B, 0x01, 0x11, 0x4C, 0xC4, 0x06, 0xB0, 0x01, 0x33, 0x30, 0xA4, 0x0E, 
+    0x33, 0x31, 0x00, 0xB3, 0x44, 0x46, 0x66, 0x20, 0x43, 0x02, 0x10, 0x10, 0xF0, 0x08, 0x47, 0x01, 
+    0x11, 0xF0, 0x02, 0x01, 0x11, 0xF0, 0x04, 0x00, 0x20, 0x45, 0x10, 0x40, 0x00, 0x1E, 0x93, 0x37, 
+    0x39, 0x11, 0x00, 0x00, 0xA4, 0xA6, 0x00, 0x20, 0xC0, 0x02, 0x11, 0x10, 0xF0, 0x08, 0x45, 0x01, 
+    0x11, 0xF0, 0x02, 0x07, 0x11, 0x00, 0x01, 0x01, 0xE0, 0x00, 0x10, 0x46, 0x00, 0x20, 0xB0, 0x03, 
+    0x92, 0x99, 0xB0, 0x03, 0x24, 0x44, 0xA6, 0x01, 0x21, 0x4C, 0x01, 0x11, 0xF0, 0x15, 0x0A, 0x10, 
+    0x00, 0x11, 0x10, 0x01, 0x10, 0xC0, 0x00, 0x10, 0xE4, 0x00, 0x10, 0xB0, 0x01, 0x11, 0xB0, 0x01, 
+    0x14, 0xD6, 0x00, 0x10, 0x44, 0xB1, 0xB0, 0x01, 0x11, 0xF0, 0x19, 0xC1, 0xD0, 0x00, 0x20, 0xE4, 
+    0x02, 0x66, 0x10, 0xC0, 0x00, 0x10, 0xF6, 0x01, 0x01, 0x11, 0xC0, 0xC1, 0xF0, 0x1F, 0xB1, 0xE0, 
+    0x00, 0x10, 0xF4, 0x01, 0x02, 0x20, 0x10, 0xA0, 0x02, 0x23, 0x40, 0xD6, 0x00, 0x20, 0x46, 0x00, 
+    0x00, 0xC1, 0xF0, 0x16, 0x01, 0x11, 0x49, 0x00, 0x10, 0x46, 0x02, 0x1B, 0x20, 0xB4, 0x0C, 0x62, 
+    0x11, 0x31, 0x03, 0x11, 0xB3, 0x40, 0xA6, 0x03, 0x22, 0x11, 0xD0, 0xD1, 0xF0, 0x15, 0x01, 0x11, 
+    0xD0, 0x4B, 0x00, 0x00, 0xA1, 0x16, 0xB4, 0x43, 0x21, 0x00, 0x11, 0x01, 0x00, 0x12, 0x96, 0x62, 
+    0x11, 0x10, 0xF0, 0x00, 0xC1, 0x01, 0x01, 0xF0, 0x13, 0x00, 0x10, 0x44, 0x00, 0x10, 0x4E, 0x08, 
+    0x00, 0x11, 0x12, 0xB9, 0x10, 0xF0, 0x01, 0x04, 0x11, 0x32, 0x10, 0xF0, 0x02, 0xD1, 0x02, 0x01, 
+    0x10, 0xF0, 0x11, 0xA1, 0x43, 0xE1, 0xF0, 0x05, 0x01, 0x11, 0xF0, 0x03, 0x01, 0x11, 0xF0, 0x04, 
+    0xF1, 0x01, 0xA0, 0x01, 0x11, 0x56, 0xB1, 0x00, 0x00, 0x54, 0xF0, 0x04, 0x4C, 0xF1, 0x03, 0xA0, 
+    0x52, 0xF1, 0x01, 0x45, 0x03, 0x01, 0x11, 0xF0, 0x01, 0x00, 0x10, 0xF0, 0x07, 0x00, 0x10, 0x52, 
+    0x00, 0x00, 0x44, 0xF0, 0x0B, 0xF1, 0x00, 0x00, 0x00, 0x43, 0x00, 0x20, 0x43, 0x00, 0x10, 0xF0, 
+    0x1D, 0xE1, 0x00, 0x20, 0xA1, 0xF0, 0x0D, 0xF1, 0x01, 0x00, 0x00, 0xA1, 0x02, 0x22, 0x00, 0xB1, 
+    0x65, 0x00, 0x20, 0x49, 0x00, 0x10, 0x5D, 0xC1, 0x00, 0x20, 0xD1, 0xA0, 0x00, 0x10, 0xF0, 0x14, 
+    0x02, 0x10, 0x10, 0x46, 0xD1, 0x65, 0x00, 0x20, 0xB1, 0x02, 0x00, 0x10, 0x5D, 0x04, 0x11, 0x12, 
+    0x20, 0xA1, 0x02, 0x21, 0x20, 0x56, 0xF1, 0x08, 0x02, 0x21, 0x20, 0x44, 0x04, 0x11, 0x12, 0x10, 
+    0xF0, 0x0E, 0x03, 0x11, 0x00, 0xB1, 0x4C, 0x01, 0x11, 0x63, 0xF1, 0x00, 0x59, 0x00, 0x10, 0x44, 
+    0x00, 0x10, 0x6D, 0x06, 0x21, 0x22, 0x21, 0x20, 0xE1, 0xF0, 0x10, 0xF1, 0x00, 0x43, 0x00, 0x10, 
+    0x47, 0x00, 0x10, 0xF0, 0x06, 0x03, 0x11, 0x00, 0x52, 0x00, 0x20, 0x6D, 0xF1, 0x00, 0x4F, 0x00, 
+    0x10, 0x4F, 0x00, 0x10, 0x6A, 0x01, 0x12, 0xF1, 0x04, 0xF0, 0x07, 0xA1, 0x01, 0x00, 0x4C, 0x02, 
+    0x21, 0x20, 0xE1, 0xA0, 0x01, 0x12, 0xF0, 0x03, 0x01, 0x12, 0x4E, 0x00, 0x20, 0x5E, 0xF1, 0x03, 
+    0x44, 0x05, 0x12, 0x11, 0x12, 0x45, 0x02, 0x22, 0x10, 0xF0, 0x02, 0x02, 0x22, 0x10, 0x4C, 0x00, 
+    0x10, 0x5B, 0x00, 0x00, 0x51, 0x01, 0x12, 0xB1, 0x02, 0x21, 0x10, 0xA0, 0x00, 0x10, 0x4C, 0x02, 
+    0x11, 0x20, 0x4A, 0x00, 0x20, 0xF1, 0x06, 0x51, 0x00, 0x00, 0xF1, 0x01, 0x01, 0x22, 0x43, 0xC1, 
+    0x01, 0x22, 0x43, 0x02, 0x02, 0x10, 0xF0, 0x04, 0x4C, 0xF1, 0x08, 0x50, 0xF1, 0x06, 0x4E, 0x00, 
+    0x10, 0x4E, 0x00, 0x10, 0xB0, 0x66, 0x00, 0x00, 0x4F, 0xF1, 0x02, 0x7F, 0xB0, 0xF1, 0x03, 0x01, 
+    0x22, 0x50, 0xF0, 0x06, 0x01, 0x11, 0x58, 0xF0, 0x0D, 0x5A, 0x02, 0x12, 0x10, 0xF0, 0x07, 0x58, 
+    0xF0, 0x0F, 0x5A, 0x00, 0x10, 0xF0, 0x08, 0x6D, 0x04, 0x10, 0x11, 0x00, 0xF1, 0x0C, 0xA0, 0x00, 
+    0x20, 0x51, 0x00, 0x10, 0xA0, 0xF1, 0x0A, 0xF0, 0x0D, 0x03, 0x11, 0x10, 0x58, 0x00, 0x10, 0xF0, 
+    0x09, 0x6B, 0x00, 0x10, 0xD0, 0x7F, 0xF0, 0x16, 0x55, 0x00, 0x10, 0x51, 0x00, 0x00, 0x51, 0xF0, 
+    0x18, 0xF1, 0x0C, 0x02, 0x00, 0x00, 0x63, 0xF0, 0x1A, 0x6A, 0xE0, 0x01, 0x11, 0xF0, 0x21, 0x56, 
+    0xF0, 0x3E, 0xF1, 0x0D, 0xF0, 0x41, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0xF0, 0x1B, 0xF1, 0x05, 
+    0xF0, 0x4A, 0xF1, 0x03, 0xF0, 0x4B, 0x7F, 0xE0, 
+};
+
+const gfx_image_t TOWER_DEMON_IMG = {
+    .w = TOWER_DEMON_W, .h = TOWER_DEMON_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TOWER_DEMON_PAL, .colors = TOWER_DEMON_PAL_SIZE,
+    .data = TOWER_DEMON_RLE, .size = TOWER_DEMON_RLE_SIZE,
 };
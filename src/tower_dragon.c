@@ -6,180 +6,119 @@ const uint16_t TOWER_DRAGON_PAL[TOWER_DRAGON_PAL_SIZE] = {
     0x91A4, 0x7207, 0xF165, 0x9C71, 0x51A8, 0xCACA, 0x992A, 0xE50B, 
 };
 
-const uint8_t TOWER_DRAGON_IDX[(TOWER_DRAGON_W * TOWER_DRAGON_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x24, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x02, 0x25, 0x06, 0x50, 0x00, 
-    0x00, 0x00, 0x50, 0x05, 0x50, 0x00, 0x01, 0x11, 0x00, 0x24, 0x26, 0x66, 0x66, 0x66, 0x62, 0x22, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0C, 0x48, 0x10, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x60, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x11, 0x00, 0x14, 0x26, 0x66, 0x66, 0x66, 
-    0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x48, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x2C, 0x11, 0x00, 0x12, 0x42, 0x22, 
-    0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x41, 
-    0x11, 0x29, 0x24, 0xAA, 0xAA, 0xE0, 0x00, 0x4A, 0xAA, 0xA4, 0x62, 0x50, 0x4A, 0xA1, 0x00, 0x00, 
-    0x04, 0xAA, 0xAE, 0x00, 0x00, 0x4A, 0xAA, 0xE0, 0x05, 0x4A, 0xE0, 0x04, 0xAE, 0x51, 0x00, 0x11, 
-    0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x12, 0x21, 0x2D, 0xAE, 0x0D, 0xAC, 0x00, 0xDA, 0xE5, 0xDA, 0xE6, 0x00, 0x4A, 0xAE, 
-    0x00, 0x06, 0x4A, 0xE5, 0x4A, 0xE0, 0x04, 0xAE, 0x04, 0xAE, 0x00, 0x4A, 0xAE, 0x04, 0xA0, 0x51, 
-    0x01, 0x11, 0x44, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x50, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x19, 0x2D, 0xAC, 0x00, 0x4A, 0xE0, 0xDA, 0xC0, 0x4A, 0xE5, 0x64, 
-    0xAE, 0x4A, 0xC0, 0x04, 0xAE, 0x56, 0x50, 0x00, 0x4A, 0xE0, 0x00, 0x4A, 0xE5, 0x4A, 0xAA, 0xE4, 
-    0xA0, 0x51, 0x0C, 0x10, 0x24, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x42, 0x14, 0x20, 0xC2, 0x22, 
-    0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x2D, 0xAE, 0x00, 0x4A, 0xE0, 0xDA, 0xAA, 0xAE, 
-    0x20, 0x6D, 0xAC, 0x4A, 0xE0, 0x0D, 0xAE, 0x64, 0xA8, 0xE0, 0xDA, 0xC0, 0x00, 0x4A, 0x05, 0x4A, 
-    0xE4, 0xA0, 0xA0, 0xC1, 0x0C, 0xC5, 0xC4, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x00, 0x14, 0x44, 
-    0xD4, 0x44, 0x42, 0x21, 0x11, 0x00, 0x00, 0x00, 0x01, 0x21, 0x2D, 0xAE, 0x10, 0x4A, 0xE0, 0xDA, 
-    0xE2, 0xDA, 0xE2, 0x6D, 0xAA, 0xAA, 0xE0, 0x0D, 0xAE, 0x62, 0xDA, 0xE5, 0xDA, 0xC0, 0x00, 0x4A, 
-    0x06, 0x4A, 0xE6, 0xDA, 0xA0, 0x2C, 0x02, 0xCC, 0xC2, 0x42, 0x22, 0x22, 0x22, 0x22, 0x2B, 0x40, 
-    0x44, 0x4D, 0x44, 0x44, 0x44, 0x21, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x2D, 0xAE, 0x02, 0xA0, 
-    0x10, 0xDA, 0xE6, 0x4A, 0xE5, 0x4A, 0xE1, 0x14, 0xA1, 0x0C, 0xD0, 0xC5, 0x4A, 0xE0, 0x0D, 0xAC, 
-    0x02, 0xA0, 0xC5, 0x4A, 0x46, 0x64, 0xA0, 0x22, 0x22, 0x22, 0x22, 0x42, 0x22, 0x22, 0x22, 0x20, 
-    0xBB, 0xBB, 0x22, 0x44, 0x24, 0x22, 0x22, 0x11, 0x10, 0x00, 0x00, 0x00, 0x01, 0x11, 0x2D, 0xA0, 
-    0xAD, 0x01, 0x00, 0xDA, 0xE0, 0x4A, 0x06, 0xDA, 0xC0, 0x04, 0xAE, 0x00, 0x2D, 0x08, 0xAA, 0xE0, 
-    0x02, 0xDA, 0x8D, 0x01, 0x00, 0xDA, 0xE5, 0x24, 0xA0, 0x22, 0x22, 0x22, 0x22, 0x42, 0x22, 0x22, 
-    0x22, 0x2B, 0xBB, 0xBB, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x08, 0x88, 0x88, 0x10, 0x00, 0x11, 0x10, 0x21, 0x22, 0x11, 0x00, 0x01, 0x11, 0x00, 0x22, 0x18, 
-    0x11, 0x10, 0x00, 0x18, 0x81, 0x10, 0x00, 0xC1, 0xC2, 0x22, 0x84, 0x42, 0x22, 0x22, 0x22, 0x24, 
-    0x22, 0x22, 0x22, 0x2B, 0xBB, 0xB0, 0x11, 0x11, 0x19, 0x19, 0x39, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x56, 0x65, 0x52, 0x42, 0x22, 0x22, 
-    0x22, 0x24, 0x42, 0x22, 0x24, 0xBB, 0xBB, 0x00, 0x00, 0x01, 0x19, 0x94, 0x49, 0x13, 0x11, 0x10, 
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x10, 0x22, 0x26, 0x00, 0x00, 0x00, 
-    0x00, 0x05, 0x22, 0x20, 0x00, 0x00, 0x55, 0x00, 0x10, 0x01, 0x11, 0x00, 0x56, 0x66, 0x52, 0x24, 
-    0x42, 0x22, 0x22, 0x24, 0x44, 0x0B, 0x00, 0xBB, 0xBB, 0x00, 0x00, 0xC2, 0x22, 0x24, 0x44, 0x34, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x60, 0x66, 0x50, 
-    0x00, 0x00, 0x00, 0x02, 0x50, 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 0x06, 0x62, 
-    0x62, 0x22, 0x44, 0x22, 0x22, 0x24, 0x44, 0x40, 0x0B, 0xBB, 0xBB, 0x02, 0x0C, 0x22, 0x22, 0x22, 
-    0x44, 0x44, 0x21, 0x11, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-    0x02, 0x66, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x06, 0x62, 0x22, 0x24, 0x42, 0x24, 0x44, 0x22, 0xF0, 0x00, 0x0B, 0xBB, 0x02, 0xCC, 0xCC, 
-    0xCC, 0xCC, 0xC2, 0x22, 0x49, 0x11, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00, 0x10, 0x00, 0x00, 0x11, 
-    0x90, 0x00, 0x00, 0x62, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x66, 0x05, 0x50, 0x00, 0x29, 0x00, 
-    0x00, 0x00, 0x52, 0x22, 0x22, 0x22, 0x44, 0x44, 0x44, 0x44, 0x22, 0x40, 0x00, 0x00, 0xBB, 0x02, 
-    0x00, 0x00, 0x05, 0x00, 0x01, 0xC9, 0x24, 0x11, 0x11, 0x11, 0x81, 0x91, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x01, 0x30, 0x00, 0x00, 0x05, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x06, 0x00, 
-    0x31, 0x00, 0x00, 0x00, 0x02, 0xB2, 0x22, 0x22, 0x44, 0xFD, 0x44, 0x44, 0x44, 0x40, 0x00, 0xBB, 
-    0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0x99, 0x33, 0x93, 0x91, 0x31, 0x11, 0x11, 
-    0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 
-    0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x05, 0x22, 0x22, 0x22, 0x4D, 0xD4, 0x44, 0x44, 0x44, 0x40, 
-    0xBB, 0xBB, 0xBB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x33, 0x33, 0x33, 0x93, 0x39, 
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x18, 0x78, 0x11, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 
-    0x00, 0x01, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00, 0x62, 0x22, 0x22, 0x24, 0x44, 0xDD, 0x44, 0x44, 
-    0x44, 0x4B, 0xBB, 0xBB, 0xBB, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x33, 0x37, 0x33, 
-    0x33, 0x31, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x17, 0x07, 0x81, 0x00, 0x00, 0x00, 0x00, 0x66, 
-    0x50, 0x00, 0x00, 0x09, 0x8D, 0xF7, 0x11, 0x00, 0x00, 0x05, 0x22, 0x22, 0x22, 0x44, 0x44, 0xFF, 
-    0xF0, 0x0B, 0x42, 0x20, 0x00, 0xBB, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x3D, 
-    0x73, 0x33, 0x39, 0x91, 0x11, 0x10, 0x00, 0x00, 0x00, 0x11, 0x18, 0x70, 0x71, 0x00, 0x00, 0x00, 
-    0x00, 0x05, 0x60, 0x00, 0x00, 0x01, 0x7F, 0x77, 0x11, 0x00, 0x05, 0x56, 0x62, 0x24, 0x44, 0x44, 
-    0x00, 0x00, 0x0B, 0xB0, 0x22, 0x22, 0x22, 0x20, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x94, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x18, 0x81, 0x00, 
-    0x00, 0x55, 0x00, 0x05, 0x66, 0x00, 0x00, 0x11, 0x18, 0x81, 0x11, 0x00, 0x05, 0x66, 0x22, 0x22, 
-    0x44, 0x44, 0x00, 0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x19, 0x33, 0x38, 0x91, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x55, 0x50, 0x20, 0x22, 0x60, 0x00, 0x11, 0x00, 0x11, 0x91, 0x00, 0x00, 0x56, 
-    0x22, 0x22, 0x24, 0x44, 0xFF, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x31, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x10, 0x01, 0x00, 0x00, 0x00, 0x55, 0x65, 0x20, 0x22, 0x25, 0x01, 0x10, 0x00, 0x00, 0x10, 0x12, 
-    0x1C, 0x22, 0x22, 0x22, 0x22, 0x44, 0xFD, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x31, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x25, 0x05, 0x52, 0x22, 0x29, 0x11, 0x00, 0x00, 
-    0x00, 0x12, 0xC2, 0x22, 0x22, 0x22, 0x22, 0x24, 0x44, 0x26, 0x66, 0x22, 0x22, 0x22, 0x22, 0x22, 
-    0x26, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x01, 0x01, 0x73, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x56, 0x52, 0x06, 0x21, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x22, 0x22, 0x22, 0x22, 0x62, 0x22, 0x65, 0x56, 0x66, 0x66, 0x66, 
-    0x26, 0x66, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x18, 0x10, 0x18, 0x81, 0x00, 0x00, 0x18, 0x00, 0x00, 0x06, 0x26, 0x00, 0x62, 
-    0x94, 0x11, 0x00, 0x00, 0x00, 0x11, 0x55, 0x62, 0x22, 0x22, 0x26, 0x56, 0x22, 0x55, 0x62, 0x66, 
-    0x65, 0x56, 0x66, 0x65, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x13, 0x00, 0x00, 0x88, 0x11, 0x00, 0x00, 0x22, 
-    0x02, 0x02, 0x0F, 0x1C, 0x20, 0x00, 0x01, 0x42, 0x05, 0x62, 0x22, 0x22, 0x25, 0x56, 0x66, 0x26, 
-    0x26, 0x66, 0x66, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x00, 0x13, 0x31, 0x12, 
-    0x66, 0x56, 0x62, 0x42, 0x4F, 0x1C, 0xC0, 0x01, 0x3D, 0xC5, 0x65, 0x62, 0x22, 0x2C, 0x55, 0x00, 
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x81, 0x11, 0x13, 
-    0x12, 0x05, 0x66, 0x55, 0x65, 0x22, 0x40, 0x92, 0x11, 0x23, 0x71, 0xC0, 0x65, 0x52, 0x22, 0x50, 
-    0x00, 0x00, 0x55, 0x65, 0x55, 0x55, 0x55, 0x66, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 
-    0x11, 0x11, 0x12, 0x26, 0x55, 0x00, 0x02, 0x24, 0x43, 0x42, 0x1C, 0x4F, 0x31, 0x10, 0x05, 0x55, 
-    0xCC, 0x50, 0x00, 0x55, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x11, 0x06, 0x25, 0x00, 0x05, 0x23, 0x11, 0x44, 0x21, 0x43, 0x11, 0x11, 
-    0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x18, 0x11, 0x81, 0x17, 0x10, 0x26, 0x00, 0x00, 0x3A, 0x12, 0x42, 0x22, 0x41, 
-    0x11, 0x11, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x70, 0x00, 0x00, 0x01, 0x0A, 0x19, 0x91, 
-    0x24, 0x31, 0x11, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x10, 0x11, 0x18, 0x11, 0x10, 0x17, 0xA0, 0x00, 0x00, 0x01, 0x78, 
-    0x11, 0x49, 0x93, 0x81, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x00, 0x00, 
-    0x01, 0x11, 0x13, 0x34, 0x43, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x18, 0x81, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x19, 0x11, 0x33, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x01, 0x11, 0x33, 0x38, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x81, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x38, 0x81, 0x33, 0x88, 0x31, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x18, 0x81, 0x11, 0x13, 0x33, 0x33, 0x11, 0x11, 0x11, 0x99, 0x11, 0x11, 0x11, 0x11, 0x81, 
-    0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x83, 0x33, 0xF7, 0x38, 0x81, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x13, 0x31, 0x00, 0x13, 0x33, 0x33, 0x33, 0x11, 0x11, 0x33, 0x93, 0x33, 0x81, 
-    0x11, 0x88, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x13, 0x17, 0xF7, 0x88, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x11, 0x00, 0x01, 0x13, 0x33, 0x33, 0x19, 0x11, 0x33, 0x93, 
-    0x33, 0x33, 0x88, 0x83, 0x77, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x17, 0x3F, 0x07, 0x38, 
-    0x11, 0x13, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x33, 0x19, 0x11, 
-    0x99, 0x93, 0x33, 0x37, 0x73, 0x87, 0x07, 0x81, 0x10, 0x10, 0x00, 0x11, 0x18, 0x81, 0x3F, 0xFF, 
-    0x78, 0x33, 0x83, 0x33, 0x33, 0x31, 0x11, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x33, 0x38, 
-    0x31, 0x19, 0x99, 0x99, 0x33, 0x33, 0x33, 0x37, 0x87, 0x78, 0x11, 0x11, 0x11, 0x11, 0x88, 0x83, 
-    0x3F, 0xFF, 0x78, 0x87, 0x73, 0x44, 0x91, 0x99, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 
-    0x33, 0x33, 0x31, 0x91, 0x11, 0x13, 0x39, 0x11, 0x38, 0x83, 0x77, 0x07, 0x88, 0x81, 0x11, 0x18, 
-    0x88, 0x77, 0x30, 0x00, 0x73, 0x37, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x81, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x19, 0x93, 0x91, 0x11, 0x11, 0x13, 0x91, 0x99, 0x38, 0x33, 0x77, 0x07, 0x77, 0x88, 
-    0x88, 0x78, 0x38, 0x77, 0x77, 0xF7, 0x77, 0x77, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x11, 0x11, 0x18, 0x88, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x99, 0x99, 0x33, 0x37, 0xF7, 
-    0x33, 0x33, 0x37, 0x77, 0x73, 0x77, 0x0F, 0xF7, 0x77, 0x77, 0x33, 0x38, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x01, 0x11, 0x11, 0x87, 0x81, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x19, 0x99, 0x99, 0x33, 
-    0x37, 0x77, 0x37, 0x7F, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x77, 0x77, 0x73, 0x33, 0x31, 0x11, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x87, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x19, 
-    0x99, 0x44, 0x37, 0x33, 0x33, 0x70, 0xF0, 0xF0, 0x00, 0x07, 0x77, 0x77, 0x77, 0x73, 0x33, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x11, 0x11, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 
-    0x11, 0x11, 0x92, 0x24, 0x44, 0x33, 0x37, 0x77, 0xF0, 0xF0, 0xF0, 0x07, 0x77, 0x77, 0x73, 0x33, 
-    0x33, 0x91, 0x11, 0x11, 0x11, 0x11, 0x22, 0x1C, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x92, 0x92, 0x29, 0x92, 0x33, 0x77, 0x00, 0x00, 0xF0, 0x07, 0x77, 0x77, 
-    0x33, 0x33, 0x43, 0x91, 0x99, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x66, 0x50, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x92, 0x93, 0x37, 0x70, 0x00, 0x00, 0x77, 
-    0x73, 0x33, 0x33, 0x49, 0x99, 0x11, 0x91, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x52, 0x50, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x19, 0x93, 0x37, 0x33, 
-    0x33, 0x44, 0xD4, 0x43, 0x44, 0x49, 0x91, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x92, 
-    0x29, 0x99, 0x22, 0x22, 0x44, 0xDD, 0x44, 0x42, 0x91, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x22, 0xC1, 0x22, 0x22, 0x22, 0x4D, 0x44, 0x22, 0x91, 0x11, 0x11, 0x11, 0xC2, 0x22, 
-    0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x12, 0x21, 0x12, 0x22, 0x22, 0x24, 0x44, 0x91, 0x11, 0x11, 0x11, 0x11, 
-    0xCC, 0xC5, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x56, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x11, 0x11, 0x12, 0x44, 0x44, 0x44, 0x49, 0x11, 0x11, 
-    0x11, 0xCC, 0xC0, 0x00, 0x55, 0x22, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x66, 
+const uint8_t TOWER_DRAGON_RLE[TOWER_DRAGON_RLE_SIZE] = {
+    0xF0, 0x02, 0xD5, 0x02, 0x24, 0x10, 0xE0, 0x00, 0x10, 0xF0, 0x00, 0x01, 0x26, 0xF0, 0x01, 0x09, 
+    0x50, 0x60, 0x22, 0x50, 0x65, 0xD0, 0x04, 0x50, 0x05, 0x50, 0xA0, 0x07, 0x11, 0x10, 0x02, 0x42, 
+    0xE6, 0xD2, 0xF0, 0x05, 0x09, 0x50, 0x0C, 0x48, 0x10, 0x01, 0xF0, 0x07, 0x01, 0x62, 0x48, 0x04, 
+    0x20, 0x00, 0x60, 0xF0, 0x06, 0x05, 0x55, 0x50, 0x00, 0x42, 0x00, 0x10, 0x47, 0xE2, 0xF0, 0x08, 
+    0x02, 0x24, 0x80, 0xB1, 0xF0, 0x05, 0x03, 0x52, 0x25, 0xF0, 0x16, 0x03, 0x65, 0x2C, 0x43, 0x07, 
+    0x24, 0x22, 0x26, 0x66, 0xF2, 0x00, 0xF0, 0x07, 0x09, 0x52, 0x41, 0x11, 0x29, 0x24, 0xAA, 0x04, 
+    0xE0, 0x00, 0x40, 0xAA, 0x08, 0x46, 0x25, 0x04, 0xAA, 0x10, 0xB0, 0x04, 0x4A, 0xAA, 0xE0, 0xA0, 
+    0x10, 0x4A, 0xAA, 0xE0, 0x05, 0x4A, 0xE0, 0x04, 0xAE, 0x50, 0x42, 0x00, 0x10, 0x42, 0xF2, 0x04, 
+    0xF0, 0x09, 0x17, 0x11, 0x22, 0x12, 0xDA, 0xE0, 0xDA, 0xC0, 0x0D, 0xAE, 0x5D, 0xAE, 0x60, 0x42, 
+    0x26, 0xE0, 0x00, 0x64, 0xAE, 0x54, 0xAE, 0x00, 0x4A, 0xE0, 0x4A, 0xE0, 0x04, 0xAA, 0xE0, 0x4A, 
+    0x05, 0x10, 0x11, 0x14, 0x40, 0xF2, 0x07, 0xA0, 0x00, 0x50, 0xF0, 0x04, 0x36, 0x11, 0x19, 0x2D, 
+    0xAC, 0x00, 0x4A, 0xE0, 0xDA, 0xC0, 0x4A, 0xE5, 0x64, 0xAE, 0x4A, 0xC0, 0x04, 0xAE, 0x56, 0x50, 
+    0x00, 0x4A, 0xE0, 0x00, 0x4A, 0xE5, 0x4A, 0xAA, 0xE0, 0x44, 0x03, 0xC1, 0x02, 0x4B, 0x0C, 0x42, 
+    0x14, 0x20, 0xC2, 0x22, 0x55, 0x20, 0x4A, 0x04, 0x22, 0xDA, 0xE0, 0x46, 0x1A, 0xAA, 0xAE, 0x20, 
+    0x6D, 0xAC, 0x4A, 0xE0, 0x0D, 0xAE, 0x64, 0xA8, 0xE0, 0xDA, 0xC0, 0x43, 0x10, 0x05, 0x4A, 0xE4, 
+    0xA0, 0xA0, 0xC1, 0x0C, 0xC5, 0xC0, 0x4A, 0x07, 0xB0, 0x01, 0x44, 0x4D, 0xA4, 0x04, 0x22, 0x11, 
+    0x10, 0xD0, 0x02, 0x12, 0x10, 0x42, 0x00, 0x10, 0x45, 0x07, 0xE2, 0xDA, 0xE2, 0x6D, 0xAA, 0x45, 
+    0x04, 0x2D, 0xAE, 0x50, 0x47, 0x11, 0x64, 0xAE, 0x6D, 0xAA, 0x02, 0xC0, 0x2C, 0xCC, 0x24, 0x49, 
+    0x05, 0x40, 0x44, 0x4D, 0xC4, 0x48, 0xA1, 0x42, 0x04, 0x02, 0xA0, 0x10, 0x42, 0x28, 0x64, 0xAE, 
+    0x54, 0xAE, 0x11, 0x4A, 0x10, 0xCD, 0x0C, 0x54, 0xAE, 0x00, 0xDA, 0xC0, 0x2A, 0x0C, 0x54, 0xA4, 
+    0x66, 0x4A, 0x00, 0xE2, 0x47, 0x00, 0x00, 0xAB, 0x05, 0x22, 0x44, 0x24, 0xA2, 0x02, 0x11, 0x10, 
+    0xE0, 0x44, 0x05, 0x0A, 0xD0, 0x10, 0x42, 0x13, 0x04, 0xA0, 0x6D, 0xAC, 0x00, 0x4A, 0xE0, 0x02, 
+    0xD0, 0x8A, 0x42, 0x0D, 0x2D, 0xA8, 0xD0, 0x10, 0x0D, 0xAE, 0x52, 0x52, 0xBB, 0xD2, 0xC1, 0xF0, 
+    0x03, 0xB8, 0x30, 0x10, 0x00, 0x11, 0x10, 0x21, 0x22, 0x11, 0x00, 0x01, 0x11, 0x00, 0x22, 0x18, 
+    0x11, 0x10, 0x00, 0x18, 0x81, 0x10, 0x00, 0xC1, 0xC2, 0x22, 0x84, 0x40, 0xE2, 0x00, 0x40, 0x49, 
+    0x00, 0x00, 0xB1, 0x04, 0x91, 0x93, 0x90, 0xB1, 0xF0, 0x0E, 0x00, 0x50, 0xF0, 0x04, 0x01, 0x22, 
+    0xF0, 0x04, 0x0A, 0x11, 0x10, 0x05, 0x66, 0x55, 0x20, 0x48, 0x00, 0x40, 0xA2, 0x00, 0x40, 0xAB, 
+    0xB0, 0x08, 0x11, 0x99, 0x44, 0x91, 0x30, 0x46, 0x01, 0x11, 0xF0, 0x00, 0x0A, 0x11, 0x00, 0x01, 
+    0x02, 0x22, 0x60, 0xF0, 0x00, 0x03, 0x52, 0x22, 0xB0, 0x04, 0x55, 0x00, 0x10, 0x48, 0x05, 0x65, 
+    0x22, 0x44, 0x46, 0x04, 0x40, 0xB0, 0x00, 0x46, 0x00, 0xC0, 0xA2, 0x06, 0x44, 0x43, 0x41, 0x10, 
+    0xF0, 0x09, 0x01, 0x11, 0x42, 0x04, 0x60, 0x66, 0x50, 0xE0, 0x03, 0x25, 0x06, 0xF0, 0x00, 0x43, 
+    0xA0, 0x08, 0x66, 0x26, 0x22, 0x24, 0x40, 0x46, 0x02, 0x40, 0x00, 0xBB, 0x03, 0x02, 0x0C, 0xC2, 
+    0xA4, 0x03, 0x21, 0x11, 0xB0, 0x01, 0x11, 0xF0, 0x01, 0x00, 0x10, 0xD0, 0x02, 0x26, 0x60, 0xF0, 
+    0x00, 0x01, 0x55, 0xF0, 0x0B, 0x00, 0x60, 0x42, 0x0A, 0x24, 0x42, 0x24, 0x44, 0x22, 0xF0, 0xA0, 
+    0x43, 0xFC, 0x00, 0x04, 0x22, 0x24, 0x90, 0x44, 0xB1, 0x03, 0x00, 0x01, 0xB0, 0x02, 0x11, 0x90, 
+    0xB0, 0x02, 0x62, 0x20, 0xF0, 0x00, 0x0B, 0x20, 0x66, 0x05, 0x50, 0x00, 0x29, 0xC0, 0x00, 0x50, 
+    0xD2, 0xE4, 0x02, 0x22, 0x40, 0xB0, 0x42, 0xB0, 0x08, 0x50, 0x00, 0x1C, 0x92, 0x40, 0xC1, 0x02, 
+    0x81, 0x90, 0xB1, 0xD0, 0x01, 0x13, 0xC0, 0x02, 0x56, 0x50, 0xF0, 0x01, 0x09, 0x22, 0x00, 0x06, 
+    0x00, 0x31, 0xD0, 0x01, 0x2B, 0x45, 0x01, 0xFD, 0xD4, 0x02, 0x00, 0x00, 0xBB, 0xF0, 0x02, 0x0C, 
+    0x11, 0x24, 0x99, 0x33, 0x93, 0x91, 0x30, 0xD1, 0x00, 0x00, 0xF1, 0x00, 0x04, 0x00, 0x50, 0x50, 
+    0xF0, 0x03, 0x01, 0x55, 0xA0, 0x01, 0x11, 0xE0, 0x00, 0x50, 0xC2, 0x02, 0x4D, 0xD0, 0xE4, 0x00, 
+    0x00, 0xDB, 0xF0, 0x03, 0x02, 0x11, 0x40, 0xC3, 0x03, 0x93, 0x39, 0xB1, 0x02, 0x00, 0x00, 0xB1, 
+    0x04, 0x87, 0x81, 0x10, 0xF0, 0x00, 0x01, 0x65, 0xC0, 0x06, 0x11, 0x13, 0x31, 0x10, 0xC0, 0x00, 
+    0x60, 0xC2, 0x04, 0x44, 0x4D, 0xD0, 0xD4, 0xEB, 0x00, 0x40, 0x4B, 0x04, 0x13, 0x33, 0x70, 0xB3, 
+    0x02, 0x11, 0x10, 0xC0, 0xB1, 0x03, 0x70, 0x78, 0x47, 0x00, 0x60, 0x46, 0x04, 0x98, 0xDF, 0x70, 
+    0x45, 0x00, 0x50, 0xC2, 0xA4, 0x11, 0xFF, 0xF0, 0x0B, 0x42, 0x20, 0x00, 0xBB, 0x02, 0x22, 0x4D, 
+    0x01, 0xD7, 0xA3, 0x01, 0x99, 0xA1, 0xD0, 0x06, 0x11, 0x18, 0x70, 0x70, 0x47, 0x02, 0x05, 0x60, 
+    0xC0, 0x03, 0x17, 0xF7, 0x44, 0x05, 0x55, 0x66, 0x22, 0xB4, 0xB0, 0x02, 0xBB, 0x00, 0xD2, 0x00, 
+    0x00, 0x50, 0x01, 0x94, 0xA3, 0xE1, 0xD0, 0xA1, 0x01, 0x88, 0x43, 0x01, 0x55, 0x43, 0x00, 0x60, 
+    0xA0, 0x05, 0x11, 0x18, 0x81, 0x44, 0x01, 0x66, 0xA2, 0x47, 0xF2, 0x06, 0xF0, 0x05, 0x06, 0x19, 
+    0x33, 0x38, 0x90, 0x50, 0x00, 0x10, 0xC0, 0x08, 0x55, 0x50, 0x20, 0x22, 0x60, 0x43, 0x04, 0x00, 
+    0x11, 0x90, 0x42, 0x01, 0x05, 0x43, 0x06, 0x24, 0x44, 0xFF, 0x00, 0xF2, 0x08, 0xF0, 0x06, 0x03, 
+    0x13, 0x33, 0xC1, 0xF0, 0x02, 0x02, 0x10, 0x00, 0x47, 0x01, 0x65, 0x42, 0x04, 0x25, 0x01, 0x10, 
+    0xB0, 0x05, 0x10, 0x12, 0x1C, 0xE2, 0x05, 0x44, 0xFD, 0x26, 0xF2, 0x06, 0x00, 0x60, 0x56, 0xF0, 
+    0x00, 0x02, 0x18, 0x10, 0xF0, 0x02, 0x05, 0x62, 0x50, 0x55, 0xA2, 0x02, 0x91, 0x10, 0xC0, 0x02, 
+    0x12, 0xC0, 0xF2, 0x01, 0x06, 0x44, 0x42, 0x66, 0x60, 0xF2, 0x02, 0x02, 0x66, 0x50, 0x50, 0xB1, 
+    0xE0, 0x05, 0x10, 0x17, 0x31, 0xF0, 0x02, 0x09, 0x26, 0x56, 0x52, 0x06, 0x21, 0x46, 0x03, 0x00, 
+    0x55, 0xE2, 0x06, 0x62, 0x22, 0x65, 0x50, 0xD6, 0x00, 0x20, 0xA6, 0x00, 0x50, 0xF0, 0x09, 0x04, 
+    0x11, 0x10, 0x10, 0xF0, 0x00, 0x07, 0x18, 0x10, 0x18, 0x81, 0xA0, 0x01, 0x18, 0xB0, 0x08, 0x62, 
+    0x60, 0x06, 0x29, 0x40, 0x46, 0x04, 0x11, 0x55, 0x60, 0xC2, 0x0D, 0x65, 0x62, 0x25, 0x56, 0x26, 
+    0x66, 0x55, 0xA6, 0x01, 0x55, 0x4D, 0x01, 0x11, 0xA0, 0xA1, 0x47, 0x06, 0x11, 0x00, 0x01, 0x30, 
+    0xA0, 0x03, 0x88, 0x11, 0xA0, 0x0A, 0x22, 0x02, 0x02, 0x0F, 0x1C, 0x20, 0xA0, 0x03, 0x14, 0x20, 
+    0x46, 0x07, 0x55, 0x66, 0x62, 0x62, 0xB6, 0xB5, 0xF0, 0x09, 0x02, 0x11, 0x00, 0xD1, 0xF0, 0x04, 
+    0x20, 0x17, 0x10, 0x00, 0x13, 0x31, 0x12, 0x66, 0x56, 0x62, 0x42, 0x4F, 0x1C, 0xC0, 0x01, 0x3D, 
+    0xC5, 0x60, 0x44, 0x04, 0xC5, 0x50, 0x00, 0xF6, 0x04, 0x52, 0x01, 0x00, 0x46, 0x00, 0x10, 0xE0, 
+    0x00, 0x10, 0x42, 0x01, 0x88, 0xA1, 0x1F, 0x31, 0x20, 0x56, 0x65, 0x56, 0x52, 0x24, 0x09, 0x21, 
+    0x12, 0x37, 0x1C, 0x06, 0x55, 0x22, 0x25, 0xB0, 0x02, 0x55, 0x60, 0xD5, 0x42, 0xF0, 0x0D, 0xE1, 
+    0x01, 0x21, 0xF0, 0x02, 0x00, 0x10, 0x43, 0x1E, 0x11, 0x22, 0x65, 0x50, 0x00, 0x22, 0x44, 0x34, 
+    0x21, 0xC4, 0xF3, 0x11, 0x00, 0x55, 0x5C, 0xC0, 0x42, 0x04, 0x55, 0x00, 0x50, 0xD0, 0xA5, 0x5C, 
+    0x02, 0x11, 0x10, 0x49, 0xE1, 0x02, 0x06, 0x20, 0x42, 0x0A, 0x52, 0x31, 0x14, 0x42, 0x14, 0x30, 
+    0xB1, 0x03, 0x00, 0x05, 0xF0, 0x09, 0x55, 0xF1, 0x00, 0x01, 0x00, 0x49, 0x0D, 0x11, 0x18, 0x11, 
+    0x81, 0x17, 0x10, 0x26, 0xA0, 0x08, 0x3A, 0x12, 0x42, 0x22, 0x40, 0xB1, 0x00, 0x90, 0xF0, 0x20, 
+    0xF1, 0x09, 0xC0, 0xF1, 0x02, 0x01, 0x77, 0xC0, 0x09, 0x10, 0xA1, 0x99, 0x12, 0x43, 0xA1, 0x01, 
+    0x01, 0xF0, 0x21, 0xF1, 0x09, 0x44, 0x0B, 0x01, 0x11, 0x81, 0x11, 0x01, 0x7A, 0x45, 0x08, 0x78, 
+    0x11, 0x49, 0x93, 0x80, 0x43, 0xF0, 0x21, 0xF1, 0x0C, 0x42, 0xF1, 0x00, 0x02, 0x01, 0x10, 0x45, 
+    0x07, 0x11, 0x13, 0x34, 0x43, 0xD1, 0x7C, 0x01, 0x10, 0xC1, 0x03, 0x88, 0x11, 0xF0, 0x02, 0x06, 
+    0x11, 0x19, 0x11, 0x30, 0x64, 0x00, 0x50, 0xF0, 0x02, 0xB1, 0x07, 0x01, 0x11, 0x33, 0x38, 0xF1, 
+    0x06, 0x02, 0x88, 0x10, 0xF0, 0x03, 0x0A, 0x11, 0x38, 0x81, 0x33, 0x88, 0x30, 0xB1, 0xF0, 0x1F, 
+    0x02, 0x18, 0x80, 0xA1, 0xB3, 0xC1, 0x01, 0x99, 0xE1, 0x02, 0x81, 0x30, 0x4A, 0x0B, 0x11, 0x88, 
+    0x33, 0x3F, 0x73, 0x88, 0x53, 0x00, 0x10, 0x56, 0x04, 0x33, 0x10, 0x00, 0x44, 0x01, 0x33, 0xA1, 
+    0x06, 0x33, 0x93, 0x33, 0x80, 0x42, 0x02, 0x87, 0x80, 0xF0, 0x01, 0xB1, 0x06, 0x31, 0x7F, 0x78, 
+    0x80, 0xE1, 0xF0, 0x1D, 0x08, 0x19, 0x11, 0x00, 0x01, 0x10, 0x44, 0x00, 0x90, 0x46, 0x09, 0x33, 
+    0x88, 0x83, 0x77, 0x11, 0x48, 0x08, 0x31, 0x17, 0x3F, 0x07, 0x30, 0x42, 0x02, 0x33, 0x30, 0x66, 
+    0xE0, 0x48, 0x01, 0x99, 0x43, 0x1D, 0x77, 0x38, 0x70, 0x78, 0x11, 0x01, 0x00, 0x01, 0x11, 0x88, 
+    0x13, 0xFF, 0xF7, 0x83, 0x38, 0xC3, 0x02, 0x11, 0x10, 0xD0, 0xD1, 0x5D, 0x07, 0x93, 0x33, 0x83, 
+    0x11, 0xB9, 0xD3, 0x04, 0x78, 0x77, 0x80, 0xE1, 0x03, 0x88, 0x83, 0x44, 0x0F, 0x87, 0x73, 0x44, 
+    0x91, 0x99, 0x11, 0x10, 0x00, 0xF1, 0x02, 0x60, 0x03, 0x33, 0x19, 0xA1, 0x0F, 0x33, 0x91, 0x13, 
+    0x88, 0x37, 0x70, 0x78, 0x88, 0xA1, 0x0C, 0x88, 0x87, 0x73, 0x00, 0x07, 0x33, 0x70, 0xA3, 0xE1, 
+    0x02, 0x00, 0x00, 0xD1, 0x00, 0x80, 0xA1, 0x5A, 0x05, 0x11, 0x99, 0x39, 0xC1, 0x07, 0x39, 0x19, 
+    0x93, 0x83, 0x43, 0x01, 0x77, 0xA8, 0x03, 0x78, 0x38, 0xA7, 0x00, 0xF0, 0xB7, 0x4A, 0x03, 0x10, 
+    0x00, 0xB1, 0x02, 0x88, 0x80, 0xA1, 0x5B, 0xF1, 0x04, 0xA9, 0x05, 0x33, 0x37, 0xF7, 0xB3, 0xA7, 
+    0x04, 0x37, 0x70, 0xF0, 0x47, 0x00, 0x80, 0x4A, 0x00, 0x00, 0xB1, 0x02, 0x87, 0x80, 0xA1, 0xF0, 
+    0x12, 0xA1, 0x01, 0x00, 0xD1, 0xB9, 0x42, 0x0A, 0x77, 0x37, 0x7F, 0x00, 0xFF, 0xF0, 0xA0, 0x00, 
+    0xF0, 0xB7, 0xA3, 0xF1, 0x01, 0x02, 0x00, 0x00, 0xC1, 0x03, 0x87, 0x11, 0xF0, 0x1C, 0xE1, 0x06, 
+    0x99, 0x94, 0x43, 0x70, 0xA3, 0x04, 0x70, 0xF0, 0xF0, 0xA0, 0xE7, 0x02, 0x33, 0x30, 0xF1, 0x02, 
+    0x04, 0x00, 0x11, 0x00, 0x43, 0x01, 0x11, 0xF0, 0x1E, 0xE1, 0x0B, 0x92, 0x24, 0x44, 0x33, 0x37, 
+    0x77, 0x42, 0x00, 0xF0, 0x46, 0xB3, 0x00, 0x90, 0xF1, 0x00, 0x06, 0x22, 0x1C, 0x00, 0x00, 0xB1, 
+    0xF0, 0x00, 0x00, 0x50, 0xF0, 0x07, 0x01, 0x55, 0xC0, 0x00, 0x10, 0xF0, 0x02, 0x42, 0x09, 0x92, 
+    0x29, 0x92, 0x33, 0x77, 0xA0, 0x46, 0xA3, 0x07, 0x43, 0x91, 0x99, 0x11, 0xF2, 0x01, 0x00, 0x10, 
+    0xF0, 0x05, 0x01, 0x55, 0xF0, 0x03, 0x05, 0x50, 0x56, 0x65, 0xF0, 0x0A, 0xC1, 0x06, 0x92, 0x93, 
+    0x37, 0x70, 0xB0, 0x02, 0x77, 0x70, 0xB3, 0x07, 0x49, 0x99, 0x11, 0x91, 0x4A, 0x00, 0x20, 0xF0, 
+    0x06, 0x01, 0x62, 0xF0, 0x03, 0x03, 0x55, 0x52, 0x4B, 0x00, 0x10, 0xF0, 0x00, 0xC1, 0x04, 0x99, 
+    0x33, 0x70, 0xA3, 0x0A, 0x44, 0xD4, 0x43, 0x44, 0x49, 0x90, 0xD1, 0x57, 0x01, 0x55, 0x4B, 0xF0, 
+    0x07, 0x00, 0x10, 0x48, 0x01, 0x00, 0xB1, 0x05, 0x92, 0x29, 0x99, 0xA2, 0x07, 0x44, 0xDD, 0x44, 
+    0x42, 0x50, 0xF0, 0x06, 0x02, 0x55, 0x50, 0xF0, 0x22, 0xB1, 0x03, 0x22, 0xC1, 0xC2, 0x04, 0x4D, 
+    0x44, 0x20, 0x47, 0x00, 0xC0, 0x7F, 0xD0, 0xA1, 0x03, 0x22, 0x11, 0xC2, 0x03, 0x44, 0x49, 0xF1, 
+    0x00, 0x03, 0xCC, 0xC5, 0x52, 0x03, 0x55, 0x56, 0xF0, 0x27, 0x01, 0x1C, 0xB1, 0x00, 0x20, 0xD4, 
+    0x00, 0x90, 0xC1, 0x0B, 0xCC, 0xC0, 0x00, 0x55, 0x22, 0x66, 0x4E, 0x01, 0x66, 
+};
+
+const gfx_image_t TOWER_DRAGON_IMG = {
+    .w = TOWER_DRAGON_W, .h = TOWER_DRAGON_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TOWER_DRAGON_PAL, .colors = TOWER_DRAGON_PAL_SIZE,
+    .data = TOWER_DRAGON_RLE, .size = TOWER_DRAGON_RLE_SIZE,
 };
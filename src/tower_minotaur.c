@@ -6,170 +6,131 @@ const uint16_t TOWER_MINOTAUR_PAL[TOWER_MINOTAUR_PAL_SIZE] = {
     0xCDB0, 0xDAEB, 0xF946, 0xB550, 0x8B07, 0xE989, 0xF759, 0xA1AA, 
 };
 
-const uint8_t TOWER_MINOTAUR_IDX[(TOWER_MINOTAUR_W * TOWER_MINOTAUR_H) / 2] = {
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x37, 0x77, 0x77, 0x87, 0x8B, 0xBB, 0xBB, 0xB3, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x38, 0x14, 0x33, 0x33, 0x13, 0x33, 0x33, 0x68, 0x88, 0x88, 0x33, 0x33, 0x33, 
-    0x25, 0x23, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x87, 0x77, 0x78, 0x77, 0x68, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x37, 0x77, 0x77, 0x88, 0xB3, 0x33, 0x33, 0x33, 0xB3, 0x33, 0x33, 
-    0x33, 0x33, 0x33, 0x81, 0x51, 0x33, 0x31, 0x33, 0x3B, 0xBB, 0xB8, 0x88, 0x8B, 0x33, 0x33, 0x33, 
-    0x15, 0x02, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x77, 0x77, 0x78, 0x77, 0x63, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xB7, 0x77, 0x77, 0x8B, 0xBB, 0x39, 0x93, 0x39, 0x93, 0x39, 0x63, 
-    0x91, 0x33, 0x19, 0x15, 0x26, 0x99, 0x13, 0x33, 0x99, 0x66, 0x98, 0x88, 0x66, 0x66, 0x33, 0x19, 
-    0x34, 0x50, 0x11, 0x11, 0xC1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x77, 0x77, 0x76, 0x77, 0x63, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xB7, 0x77, 0x77, 0x8B, 0x8B, 0x9A, 0xDB, 0x3A, 0xA0, 0x3A, 0x9B, 
-    0xAD, 0x93, 0x9A, 0x04, 0x3A, 0x99, 0xD9, 0x33, 0x99, 0xA9, 0x98, 0x80, 0x9A, 0xD8, 0x33, 0x9A, 
-    0x12, 0x1A, 0x11, 0xAD, 0x1D, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x23, 0x77, 0x77, 0x77, 0x77, 0x73, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xB7, 0x77, 0x77, 0x88, 0x8B, 0x9A, 0xDB, 0x3A, 0xA8, 0x3A, 0x9B, 
-    0xAA, 0xAB, 0x9A, 0x01, 0xD9, 0xBB, 0x9D, 0x93, 0x7B, 0xA0, 0x77, 0x76, 0xD9, 0x99, 0x33, 0x9D, 
-    0x13, 0x1A, 0x12, 0xAD, 0x09, 0xA2, 0x22, 0x22, 0x22, 0x22, 0x23, 0x76, 0x87, 0x77, 0x78, 0x73, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x87, 0x77, 0x77, 0x78, 0x63, 0x9A, 0xA9, 0x9A, 0xA8, 0x3A, 0x9B, 
-    0xA9, 0x9A, 0x0A, 0x21, 0xA0, 0x33, 0x3A, 0x97, 0x78, 0xA9, 0x86, 0x76, 0xA8, 0x9D, 0x33, 0x9D, 
-    0x13, 0x1A, 0x11, 0xAA, 0x9D, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x37, 0x77, 0x77, 0x78, 0x73, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0xB7, 0x77, 0x77, 0x78, 0x8B, 0x9A, 0x1A, 0x99, 0xA8, 0x3A, 0x9B, 
-    0xA9, 0xB9, 0xAD, 0x21, 0xA9, 0x37, 0x6A, 0x98, 0x86, 0xA9, 0x31, 0x39, 0xA9, 0xAD, 0x63, 0x9D, 
-    0x30, 0x1A, 0xF1, 0xAD, 0x29, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x87, 0x38, 0x77, 0x78, 0x61, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x3B, 0x88, 0x87, 0x77, 0x8B, 0x9A, 0xBA, 0x91, 0xA8, 0x3A, 0x9B, 
-    0xAD, 0x87, 0x9A, 0x02, 0x9A, 0x88, 0xA9, 0x12, 0x21, 0xA9, 0x12, 0x1A, 0xF4, 0x2A, 0xD3, 0x9A, 
-    0x88, 0x9A, 0x13, 0xAD, 0x29, 0xA2, 0x42, 0x22, 0x22, 0x22, 0x22, 0x77, 0x38, 0x78, 0x78, 0x34, 
-    0x00, 0x04, 0x42, 0x22, 0x22, 0x12, 0x22, 0x87, 0x88, 0x8B, 0x99, 0xB9, 0x93, 0xA6, 0x39, 0x9B, 
-    0x99, 0x87, 0x9A, 0x05, 0x21, 0xAA, 0xD2, 0x45, 0x41, 0x0F, 0x40, 0x2A, 0xF0, 0x20, 0xD2, 0x29, 
-    0x9A, 0xAF, 0x23, 0x09, 0x21, 0xD2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x87, 0x67, 0x63, 0x66, 0x61, 
-    0x00, 0x00, 0x45, 0x22, 0x42, 0x12, 0x44, 0x37, 0x88, 0x73, 0x22, 0x68, 0x12, 0x26, 0x88, 0x88, 
-    0x77, 0x77, 0x34, 0x45, 0x02, 0x22, 0x25, 0x55, 0x41, 0x15, 0x00, 0x00, 0x00, 0x00, 0x04, 0x52, 
-    0x34, 0x54, 0x33, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x77, 0x33, 0x33, 0x66, 0x61, 
-    0x00, 0x00, 0x45, 0x04, 0x42, 0x22, 0x45, 0x38, 0x68, 0x32, 0x50, 0x22, 0x05, 0x53, 0x86, 0x88, 
-    0x88, 0x77, 0x73, 0x44, 0x55, 0x44, 0x55, 0x55, 0x42, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 
-    0x55, 0x43, 0x33, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x33, 0x16, 0x66, 0x66, 0x31, 
-    0x00, 0x05, 0x44, 0x44, 0x42, 0x11, 0x45, 0x23, 0x88, 0x34, 0x22, 0x00, 0x05, 0x01, 0x83, 0x33, 
-    0x68, 0x77, 0x77, 0x34, 0x55, 0x44, 0x44, 0x55, 0x54, 0x55, 0x45, 0x55, 0x00, 0x00, 0x00, 0x05, 
-    0x41, 0x33, 0x33, 0x33, 0x12, 0x22, 0x22, 0x24, 0x44, 0x44, 0x22, 0x21, 0x60, 0x63, 0x66, 0x36, 
-    0x00, 0x04, 0x24, 0x44, 0x42, 0x22, 0x50, 0x52, 0x22, 0x44, 0x22, 0x50, 0x05, 0x52, 0x86, 0x66, 
-    0x87, 0x77, 0xE7, 0x73, 0x12, 0x13, 0x61, 0x44, 0x22, 0x55, 0x44, 0x40, 0x00, 0x00, 0x04, 0x21, 
-    0x33, 0x33, 0x33, 0x33, 0x11, 0x22, 0x22, 0x44, 0x44, 0x44, 0x22, 0x22, 0x66, 0x63, 0x16, 0x66, 
-    0x00, 0x00, 0x44, 0x44, 0x42, 0x24, 0x00, 0x50, 0x00, 0x00, 0x54, 0x00, 0x05, 0x44, 0x37, 0x88, 
-    0x77, 0x7E, 0x83, 0x32, 0x44, 0x42, 0x61, 0x51, 0x44, 0x45, 0x44, 0x40, 0x00, 0x00, 0x04, 0x41, 
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x22, 0x22, 0x44, 0x44, 0x42, 0x22, 0x22, 0x13, 0x13, 0x36, 0x63, 
-    0x00, 0x00, 0x44, 0x44, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x05, 0x44, 0x37, 0x88, 
-    0x77, 0xE7, 0x33, 0x61, 0x44, 0x54, 0x36, 0x52, 0x45, 0x55, 0x50, 0x50, 0x00, 0x00, 0x00, 0x04, 
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x12, 0x22, 0x22, 0x24, 0x42, 0x22, 0x22, 0x21, 0x66, 0x67, 0x66, 
-    0x00, 0x04, 0x44, 0x44, 0x42, 0x24, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x55, 0x17, 0x87, 
-    0x77, 0xE7, 0x63, 0x62, 0x44, 0x04, 0x33, 0x14, 0x46, 0x14, 0x45, 0x00, 0x00, 0x00, 0x50, 0x55, 
-    0x13, 0x13, 0x33, 0x33, 0x31, 0x12, 0x22, 0x22, 0x24, 0x44, 0x22, 0x22, 0x23, 0x76, 0x67, 0x63, 
-    0x00, 0x04, 0x44, 0x24, 0x41, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x23, 0x67, 0x77, 
-    0x77, 0x76, 0x62, 0x44, 0x44, 0x54, 0x41, 0x88, 0x21, 0x14, 0x40, 0x00, 0x00, 0x55, 0x55, 0x55, 
-    0x23, 0x11, 0x13, 0x33, 0x11, 0x12, 0x22, 0x22, 0x22, 0x42, 0x24, 0x22, 0x23, 0x78, 0x66, 0x66, 
-    0x00, 0x04, 0x44, 0x24, 0x23, 0x14, 0x40, 0x00, 0x00, 0x00, 0x02, 0x50, 0x37, 0x77, 0x77, 0x77, 
-    0x7E, 0x8C, 0x34, 0x44, 0x45, 0x55, 0x01, 0x66, 0x14, 0x45, 0x50, 0x00, 0x00, 0x55, 0x55, 0x55, 
-    0x41, 0x31, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x24, 0x22, 0x22, 0x22, 0x21, 0x78, 0x37, 0x66, 
-    0x00, 0x05, 0x54, 0x44, 0x23, 0x14, 0x20, 0x00, 0x00, 0x02, 0x25, 0x55, 0x37, 0x78, 0x87, 0x77, 
-    0xEE, 0x73, 0x14, 0x55, 0x04, 0x45, 0x04, 0x3C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x55, 
-    0x55, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x87, 0x66, 0x66, 
-    0x00, 0x05, 0x55, 0x55, 0x23, 0x32, 0x45, 0x00, 0x00, 0x08, 0x84, 0x54, 0x67, 0x66, 0x87, 0x77, 
-    0xE8, 0xE8, 0x14, 0x50, 0x03, 0x34, 0x54, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 
-    0x00, 0x13, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x66, 0x66, 0x63, 
-    0x00, 0x00, 0x40, 0x05, 0x23, 0x31, 0x44, 0x50, 0x00, 0x48, 0x76, 0x25, 0x37, 0x88, 0x87, 0x68, 
-    0x88, 0x73, 0x24, 0x50, 0x56, 0x64, 0x50, 0x53, 0x15, 0x50, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 
-    0x50, 0x41, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x37, 0x66, 0x33, 
-    0x00, 0x00, 0x50, 0x05, 0x23, 0x33, 0x44, 0x50, 0x00, 0x28, 0x77, 0x35, 0x27, 0x77, 0x77, 0x33, 
-    0x18, 0x72, 0x44, 0x52, 0x03, 0x34, 0x50, 0x04, 0x14, 0x50, 0x00, 0x05, 0x55, 0x00, 0x00, 0x55, 
-    0x55, 0x54, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x21, 0x37, 0x66, 0x36, 
-    0x00, 0x00, 0x50, 0x05, 0x23, 0x36, 0x14, 0x40, 0x50, 0x46, 0x87, 0x34, 0x27, 0x77, 0x78, 0x31, 
-    0x42, 0x24, 0x45, 0x16, 0x40, 0x45, 0x05, 0x55, 0x5C, 0x45, 0x00, 0x55, 0x50, 0x00, 0x00, 0x54, 
-    0x55, 0x55, 0x54, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x21, 0x37, 0x76, 0x66, 
-    0x00, 0x00, 0x50, 0x55, 0x23, 0x36, 0x34, 0x45, 0x00, 0x03, 0x77, 0x71, 0x53, 0x78, 0x83, 0x14, 
-    0x40, 0x05, 0x52, 0x77, 0x10, 0x24, 0x50, 0x55, 0x54, 0x44, 0x55, 0x00, 0x00, 0x00, 0x50, 0x05, 
-    0x50, 0x05, 0x55, 0x41, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x37, 0x76, 0x66, 
-    0x00, 0x00, 0x50, 0x55, 0x21, 0x33, 0x31, 0xC4, 0x00, 0x02, 0x87, 0x76, 0x51, 0x78, 0x73, 0x40, 
-    0x05, 0x50, 0x46, 0x67, 0x30, 0x13, 0x14, 0x55, 0x55, 0x00, 0x50, 0x00, 0x00, 0x04, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x37, 0x77, 0x66, 
-    0x50, 0x00, 0x50, 0x50, 0x21, 0x13, 0x33, 0x4C, 0x40, 0x00, 0x17, 0x77, 0x42, 0x77, 0x31, 0x50, 
-    0x00, 0x55, 0x46, 0x77, 0x30, 0x13, 0x44, 0x14, 0x55, 0x00, 0x55, 0x00, 0x00, 0x0C, 0x11, 0x50, 
-    0x00, 0x00, 0x00, 0x51, 0x31, 0x11, 0x11, 0x12, 0x21, 0x22, 0x22, 0x22, 0x22, 0x17, 0x77, 0x63, 
-    0x00, 0x00, 0x50, 0x00, 0x21, 0x11, 0x13, 0x14, 0xC4, 0x00, 0x27, 0x77, 0x25, 0x33, 0x20, 0x00, 
-    0x00, 0x05, 0x46, 0x87, 0x10, 0x54, 0x54, 0x15, 0x50, 0x00, 0x55, 0x00, 0x00, 0x05, 0x11, 0x40, 
-    0x00, 0x00, 0x00, 0x01, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x11, 0x17, 0x77, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x21, 0x11, 0x31, 0xCC, 0x45, 0x27, 0x77, 0x35, 0x45, 0x50, 0x00, 
-    0x00, 0x04, 0x36, 0x68, 0x20, 0x00, 0x05, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x40, 
-    0x00, 0x00, 0x00, 0x04, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x22, 0x11, 0x18, 0x77, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x22, 0x11, 0x33, 0x14, 0xC4, 0x48, 0x77, 0x15, 0x45, 0x55, 0x00, 
-    0x04, 0x13, 0x66, 0x67, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x10, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x11, 0x12, 0x11, 0x17, 0x77, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x21, 0x11, 0x33, 0x31, 0x44, 0x53, 0x73, 0x45, 0x55, 0x55, 0x00, 
-    0x46, 0x66, 0x66, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x15, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x76, 0x63, 
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x13, 0x33, 0x33, 0x31, 0x41, 0x73, 0x45, 0x55, 0x55, 0x41, 
-    0x66, 0x66, 0x66, 0x66, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x3C, 
-    0x50, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x38, 0x63, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x13, 0x33, 0x33, 0x33, 0x38, 0x77, 0x45, 0x55, 0x51, 0x66, 
-    0x66, 0x63, 0x36, 0x67, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x31, 
-    0x45, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x33, 0x36, 0x63, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x11, 0x33, 0x33, 0x31, 0x37, 0x77, 0x35, 0x55, 0x16, 0x33, 
-    0x33, 0x33, 0x36, 0x68, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x31, 
-    0x14, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x13, 0x16, 0x76, 0x66, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x11, 0x31, 0x11, 0x18, 0x77, 0x83, 0x45, 0x23, 0x33, 
-    0x33, 0x33, 0x36, 0x83, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 
-    0x31, 0x40, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x36, 0x76, 0x66, 
-    0x00, 0x00, 0x00, 0x55, 0x42, 0x22, 0x22, 0x22, 0x11, 0x11, 0x37, 0x77, 0x77, 0x35, 0x43, 0x33, 
-    0x33, 0x33, 0x66, 0x11, 0x25, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
-    0x13, 0x40, 0x00, 0x00, 0x41, 0x11, 0xC1, 0x14, 0x42, 0x22, 0x21, 0x21, 0x11, 0x13, 0x76, 0x66, 
-    0x00, 0x00, 0x00, 0x05, 0x44, 0x22, 0x22, 0x22, 0x11, 0x12, 0x37, 0x77, 0x86, 0x64, 0x53, 0x33, 
-    0x33, 0x33, 0x61, 0x43, 0x61, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x31, 0x40, 0x00, 0x00, 0x41, 0x1C, 0x11, 0x14, 0x44, 0x22, 0x22, 0x22, 0x22, 0x13, 0x76, 0x66, 
-    0x00, 0x00, 0x00, 0x05, 0x44, 0x42, 0x22, 0x22, 0x11, 0x12, 0x18, 0x76, 0x63, 0x31, 0x51, 0x63, 
-    0x33, 0x36, 0x62, 0x13, 0x64, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0x31, 0x40, 0x55, 0x55, 0x41, 0x11, 0x11, 0x44, 0x44, 0x22, 0x22, 0x22, 0x22, 0x13, 0x76, 0x66, 
-    0x00, 0x00, 0x05, 0x55, 0x44, 0x42, 0x22, 0x22, 0x21, 0x11, 0x23, 0x78, 0x63, 0x36, 0x44, 0x63, 
-    0x33, 0x36, 0x61, 0x37, 0x35, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x00, 0x54, 0x55, 0x41, 0x11, 0x11, 0x12, 0x24, 0x42, 0x22, 0x22, 0x22, 0x21, 0x06, 0x66, 
-    0x00, 0x00, 0x05, 0x54, 0x44, 0x42, 0x22, 0x22, 0x22, 0x11, 0x21, 0x66, 0x66, 0x33, 0x44, 0x33, 
-    0x33, 0x66, 0x3C, 0x36, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x05, 0x55, 0x55, 0x44, 0x1C, 0x11, 0x11, 0x14, 0x22, 0x22, 0x22, 0x11, 0x11, 0x76, 0x66, 
-    0x00, 0x00, 0x05, 0x54, 0x44, 0x44, 0x42, 0x22, 0x11, 0x21, 0x11, 0x16, 0x77, 0x63, 0x15, 0x16, 
-    0x33, 0x33, 0x6C, 0x63, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x01, 0x45, 0x55, 0x41, 0x1C, 0xCC, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x77, 0x66, 
-    0x00, 0x00, 0x55, 0x44, 0x44, 0x44, 0x42, 0x21, 0x11, 0x11, 0x11, 0x16, 0x78, 0x66, 0x35, 0x43, 
-    0x33, 0x33, 0x63, 0x83, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 
-    0x42, 0x23, 0x45, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x21, 0x11, 0x21, 0x77, 0x76, 
-    0x00, 0x00, 0x55, 0x44, 0x44, 0x44, 0x22, 0x21, 0x11, 0x11, 0x13, 0x33, 0x66, 0x33, 0x61, 0x43, 
-    0x33, 0x33, 0x63, 0x12, 0x45, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 
-    0x42, 0x32, 0x55, 0x42, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x11, 0x87, 0x63, 
-    0x00, 0x00, 0x55, 0x44, 0x44, 0x24, 0x21, 0x11, 0x11, 0x11, 0x13, 0x33, 0x36, 0x66, 0x63, 0x43, 
-    0x63, 0x33, 0x61, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 
-    0x22, 0x31, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x21, 0x11, 0x13, 0x77, 0x66, 
-    0x00, 0x05, 0x54, 0x44, 0x22, 0x24, 0x21, 0x11, 0x13, 0x11, 0x33, 0x33, 0x36, 0x66, 0x33, 0x44, 
-    0x33, 0x33, 0x61, 0x55, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 
-    0x44, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x24, 0x42, 0x11, 0x13, 0x76, 0x66, 
-    0x00, 0x55, 0x44, 0x44, 0x22, 0x24, 0x11, 0x11, 0x33, 0x11, 0x33, 0x33, 0x68, 0x66, 0x33, 0x14, 
-    0x13, 0x66, 0x34, 0x55, 0x55, 0x55, 0x44, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0x24, 0x13, 0x33, 0x33, 0x11, 0x13, 0x11, 0x12, 0x11, 0x11, 0x1C, 0x42, 0x21, 0x13, 0x76, 0x66, 
-    0x00, 0x54, 0x44, 0x42, 0x21, 0x21, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x36, 0x66, 0x36, 0x15, 
-    0x43, 0x68, 0x32, 0x55, 0x55, 0x44, 0x44, 0x44, 0x45, 0x54, 0x55, 0x55, 0x50, 0x00, 0x00, 0x04, 
-    0x44, 0x13, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22, 0x22, 0x13, 0x76, 0x66, 
-    0x00, 0x54, 0x44, 0x42, 0x21, 0x21, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x66, 0x33, 0x14, 
-    0x43, 0x33, 0x12, 0x55, 0x54, 0x42, 0x21, 0x24, 0x42, 0x42, 0x45, 0x40, 0x50, 0x50, 0x00, 0x04, 
-    0x44, 0x13, 0x33, 0x33, 0x11, 0x11, 0x12, 0x11, 0x11, 0x12, 0x22, 0x42, 0x22, 0x23, 0x76, 0x66, 
-    0x05, 0x54, 0x42, 0x22, 0x22, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x61, 
-    0x13, 0x36, 0x34, 0x44, 0x44, 0x11, 0x24, 0x21, 0x13, 0x11, 0x44, 0x40, 0x04, 0x25, 0x50, 0x52, 
-    0x45, 0x16, 0x33, 0x33, 0x31, 0x11, 0x22, 0x13, 0x11, 0x12, 0x24, 0x21, 0x12, 0x21, 0x66, 0x66, 
-    0x55, 0x44, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 
-    0x63, 0x38, 0x32, 0x44, 0x42, 0x11, 0x14, 0x13, 0x33, 0x33, 0x14, 0x12, 0x42, 0x14, 0x44, 0x44, 
-    0x44, 0x13, 0x33, 0x33, 0x31, 0x11, 0x42, 0x21, 0x11, 0x12, 0x42, 0x13, 0x31, 0x11, 0x66, 0x66, 
-    0x55, 0x42, 0x44, 0x44, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x63, 0x36, 0x32, 0x44, 0x22, 0x13, 0x31, 0x13, 0x33, 0x33, 0x11, 0x31, 0x13, 0x12, 0x22, 0x22, 
-    0x22, 0x23, 0xBB, 0x33, 0x31, 0x12, 0x22, 0x22, 0xCC, 0x12, 0x11, 0x13, 0x33, 0x33, 0x77, 0x76, 
-    0x55, 0x44, 0x22, 0x24, 0x42, 0x11, 0x11, 0x33, 0x31, 0x11, 0x13, 0x31, 0x11, 0x33, 0x33, 0x33, 
-    0x33, 0x36, 0x32, 0x44, 0x41, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 
-    0x22, 0x23, 0x33, 0x33, 0x31, 0x11, 0x11, 0x22, 0x11, 0x11, 0x13, 0x13, 0x3B, 0x33, 0x63, 0x31, 
-    0x22, 0x44, 0x42, 0x24, 0x42, 0x22, 0x11, 0x33, 0x31, 0x11, 0x11, 0x33, 0x11, 0x33, 0x33, 0x33, 
-    0x33, 0x33, 0x22, 0x22, 0x23, 0x63, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x12, 0x22, 
-    0x22, 0x21, 0x33, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x36, 0x33, 0x33, 0x33, 0x14, 0x44, 0xC1, 
-    0x52, 0x22, 0x40, 0x05, 0x42, 0x22, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 
-    0x36, 0x63, 0x11, 0x11, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 
-    0x22, 0x11, 0x33, 0x31, 0x33, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x13, 0x12, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x21, 0x11, 0x33, 0x31, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 
-    0x33, 0x31, 0x11, 0x11, 0x21, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x31, 0x12, 
-    0x11, 0x11, 0x31, 0x11, 0x13, 0x31, 0x11, 0x11, 0x1C, 0xC1, 0x11, 0x33, 0x36, 0x31, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x21, 0x11, 0x13, 0x31, 0x11, 0x13, 0x33, 0x11, 0x33, 
-    0x33, 0x31, 0x21, 0x12, 0x22, 0x33, 0x32, 0x11, 0x11, 0x31, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x22, 0x22, 0x22, 0x24, 0x44, 0x24, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x11, 0x44, 0x11, 
+const uint8_t TOWER_MINOTAUR_RLE[TOWER_MINOTAUR_RLE_SIZE] = {
+    0xF2, 0x01, 0x00, 0x30, 0xB7, 0x02, 0x87, 0x80, 0xCB, 0xF3, 0x05, 0x02, 0x81, 0x40, 0xA3, 0x00, 
+    0x10, 0xB3, 0x00, 0x60, 0xB8, 0xC3, 0x05, 0x25, 0x23, 0x11, 0xF2, 0x07, 0x00, 0x80, 0xA7, 0x04, 
+    0x87, 0x76, 0x80, 0x4F, 0x01, 0x8B, 0xD3, 0x00, 0xB0, 0xF3, 0x02, 0x0A, 0x81, 0x51, 0x33, 0x31, 
+    0x33, 0x30, 0xAB, 0xA8, 0x00, 0xB0, 0xC3, 0x04, 0x15, 0x02, 0x10, 0xF2, 0x07, 0x00, 0x10, 0xB7, 
+    0x42, 0x00, 0x30, 0xF2, 0x01, 0x00, 0xB0, 0x44, 0x26, 0xBB, 0xB3, 0x99, 0x33, 0x99, 0x33, 0x96, 
+    0x39, 0x13, 0x31, 0x91, 0x52, 0x69, 0x91, 0x33, 0x39, 0x96, 0x69, 0x88, 0x80, 0xA6, 0x07, 0x33, 
+    0x19, 0x34, 0x50, 0xA1, 0x01, 0xC1, 0xF2, 0x02, 0x00, 0x30, 0xB7, 0x00, 0x60, 0x54, 0x1B, 0x8B, 
+    0x9A, 0xDB, 0x3A, 0xA0, 0x3A, 0x9B, 0xAD, 0x93, 0x9A, 0x04, 0x3A, 0x99, 0xD9, 0x42, 0x18, 0xA9, 
+    0x98, 0x80, 0x9A, 0xD8, 0x33, 0x9A, 0x12, 0x1A, 0x11, 0xAD, 0x1D, 0xD0, 0x4E, 0xA7, 0x50, 0x00, 
+    0x80, 0x47, 0x00, 0x80, 0x43, 0x29, 0xAA, 0xB9, 0xA0, 0x1D, 0x9B, 0xB9, 0xD9, 0x37, 0xBA, 0x07, 
+    0x77, 0x6D, 0x99, 0x93, 0x39, 0xD1, 0x31, 0xA1, 0x2A, 0xD0, 0x9A, 0x4A, 0x01, 0x68, 0xA7, 0x00, 
+    0x80, 0x4A, 0x00, 0x80, 0xC7, 0x07, 0x86, 0x39, 0xAA, 0x99, 0x46, 0x1A, 0x99, 0xA0, 0xA2, 0x1A, 
+    0x03, 0x33, 0xA9, 0x77, 0x8A, 0x98, 0x67, 0x6A, 0x89, 0xD0, 0x47, 0x05, 0x1A, 0xA9, 0xDF, 0xF2, 
+    0x02, 0x00, 0x30, 0xC7, 0x4B, 0x00, 0xB0, 0x45, 0x07, 0x8B, 0x9A, 0x1A, 0x99, 0x46, 0x28, 0xB9, 
+    0xAD, 0x21, 0xA9, 0x37, 0x6A, 0x98, 0x86, 0xA9, 0x31, 0x39, 0xA9, 0xAD, 0x63, 0x9D, 0x30, 0x1A, 
+    0xF1, 0xAD, 0x29, 0xD0, 0xF2, 0x02, 0x03, 0x87, 0x38, 0x42, 0x01, 0x61, 0xF2, 0x01, 0x07, 0x3B, 
+    0x88, 0x87, 0x77, 0x42, 0x03, 0xBA, 0x91, 0x45, 0x24, 0xD8, 0x79, 0xA0, 0x29, 0xA8, 0x8A, 0x91, 
+    0x22, 0x1A, 0x91, 0x21, 0xAF, 0x42, 0xAD, 0x39, 0xA8, 0x89, 0xA1, 0x30, 0x42, 0x02, 0xA2, 0x40, 
+    0xF2, 0x00, 0x00, 0x70, 0x42, 0x09, 0x87, 0x83, 0x40, 0x00, 0x44, 0xB2, 0x17, 0x12, 0x22, 0x87, 
+    0x88, 0x8B, 0x99, 0xB9, 0x93, 0xA6, 0x39, 0x9B, 0x99, 0x43, 0x23, 0x52, 0x1A, 0xAD, 0x24, 0x54, 
+    0x10, 0xF4, 0x02, 0xAF, 0x02, 0x0D, 0x22, 0x99, 0xAA, 0xF2, 0x30, 0x92, 0x1D, 0xF2, 0x02, 0x09, 
+    0x87, 0x67, 0x63, 0x66, 0x61, 0xA0, 0x17, 0x45, 0x22, 0x42, 0x12, 0x44, 0x37, 0x88, 0x73, 0x22, 
+    0x68, 0x12, 0x26, 0xA8, 0xA7, 0x04, 0x34, 0x45, 0x00, 0xA2, 0x06, 0x55, 0x54, 0x11, 0x50, 0xF0, 
+    0x00, 0x0A, 0x45, 0x23, 0x45, 0x43, 0x33, 0x10, 0xF2, 0x05, 0x01, 0x77, 0xA3, 0x48, 0x17, 0x04, 
+    0x42, 0x22, 0x45, 0x38, 0x68, 0x32, 0x50, 0x22, 0x05, 0x53, 0x86, 0xA8, 0x09, 0x77, 0x73, 0x44, 
+    0x55, 0x44, 0xA5, 0x06, 0x42, 0x45, 0x00, 0x50, 0xF0, 0x00, 0x02, 0x55, 0x40, 0xA3, 0x4D, 0x02, 
+    0x33, 0x10, 0xB6, 0x00, 0x30, 0x42, 0x00, 0x50, 0xB4, 0x17, 0x21, 0x14, 0x52, 0x38, 0x83, 0x42, 
+    0x20, 0x00, 0x50, 0x18, 0x33, 0x36, 0x42, 0x01, 0x73, 0x43, 0x0B, 0x44, 0x55, 0x54, 0x55, 0x45, 
+    0x55, 0xD0, 0x02, 0x54, 0x10, 0xC3, 0x00, 0x10, 0xC2, 0xB4, 0x10, 0x22, 0x21, 0x60, 0x63, 0x66, 
+    0x36, 0x00, 0x04, 0x20, 0x43, 0x2C, 0x22, 0x50, 0x52, 0x22, 0x44, 0x22, 0x50, 0x05, 0x52, 0x86, 
+    0x66, 0x87, 0x77, 0xE7, 0x73, 0x12, 0x13, 0x61, 0x44, 0x22, 0x55, 0x44, 0x40, 0xC0, 0x02, 0x42, 
+    0x10, 0xE3, 0x01, 0x11, 0xA2, 0xC4, 0xA2, 0x06, 0x66, 0x63, 0x16, 0x60, 0x42, 0x00, 0x00, 0xB4, 
+    0x05, 0x22, 0x40, 0x05, 0xB0, 0x1E, 0x54, 0x00, 0x05, 0x44, 0x37, 0x88, 0x77, 0x7E, 0x83, 0x32, 
+    0x44, 0x42, 0x61, 0x51, 0x44, 0x40, 0x49, 0x00, 0x40, 0x47, 0x00, 0x30, 0x48, 0xB2, 0x07, 0x13, 
+    0x13, 0x36, 0x63, 0x49, 0x00, 0x20, 0xF0, 0x00, 0x01, 0x55, 0x49, 0x0E, 0xE7, 0x33, 0x61, 0x44, 
+    0x54, 0x36, 0x52, 0x40, 0xA5, 0x01, 0x05, 0xE0, 0x00, 0x40, 0x48, 0x00, 0x10, 0xC2, 0x45, 0x0A, 
+    0x21, 0x66, 0x67, 0x66, 0x00, 0x00, 0xC4, 0x03, 0x22, 0x45, 0xF0, 0x00, 0x09, 0x55, 0x00, 0x55, 
+    0x17, 0x87, 0x42, 0x11, 0x63, 0x62, 0x44, 0x04, 0x33, 0x14, 0x46, 0x14, 0x45, 0xC0, 0x06, 0x50, 
+    0x55, 0x13, 0x10, 0x4E, 0x00, 0x40, 0xB2, 0x01, 0x37, 0x42, 0x00, 0x30, 0x44, 0x06, 0x24, 0x41, 
+    0x24, 0x40, 0xF0, 0x02, 0x04, 0x42, 0x23, 0x60, 0xC7, 0x02, 0x66, 0x20, 0xA4, 0x0A, 0x54, 0x41, 
+    0x88, 0x21, 0x14, 0x40, 0xB0, 0xC5, 0x08, 0x23, 0x11, 0x13, 0x33, 0x10, 0x46, 0x04, 0x24, 0x22, 
+    0x40, 0x43, 0x00, 0x80, 0xA6, 0x46, 0x02, 0x23, 0x10, 0x48, 0x03, 0x25, 0x03, 0xE7, 0x03, 0xE8, 
+    0xC3, 0xA4, 0x0B, 0x55, 0x50, 0x16, 0x61, 0x44, 0x55, 0x49, 0x02, 0x41, 0x30, 0xE1, 0xC2, 0x00, 
+    0x40, 0xD2, 0x04, 0x17, 0x83, 0x70, 0x43, 0x03, 0x55, 0x44, 0x43, 0x00, 0x20, 0xC0, 0x1D, 0x22, 
+    0x55, 0x53, 0x77, 0x88, 0x77, 0x7E, 0xE7, 0x31, 0x45, 0x50, 0x44, 0x50, 0x43, 0xC5, 0xF0, 0x00, 
+    0x03, 0x55, 0x54, 0xA5, 0xF1, 0x00, 0xF2, 0x04, 0x03, 0x11, 0x87, 0xA6, 0x43, 0x08, 0x55, 0x52, 
+    0x33, 0x24, 0x50, 0xB0, 0x08, 0x88, 0x45, 0x46, 0x76, 0x60, 0x43, 0x0E, 0x8E, 0x81, 0x45, 0x00, 
+    0x33, 0x45, 0x41, 0x10, 0x48, 0x09, 0x00, 0x05, 0x05, 0x00, 0x13, 0xE1, 0xF2, 0x04, 0x00, 0x10, 
+    0xB6, 0x00, 0x30, 0xA0, 0x02, 0x40, 0x00, 0x42, 0x27, 0x14, 0x45, 0x00, 0x04, 0x87, 0x62, 0x53, 
+    0x78, 0x88, 0x76, 0x88, 0x87, 0x32, 0x45, 0x05, 0x66, 0x45, 0x05, 0x31, 0x55, 0xB0, 0x00, 0x50, 
+    0xC0, 0x03, 0x55, 0x04, 0xF1, 0x01, 0x4B, 0x04, 0x37, 0x66, 0x30, 0x43, 0x00, 0x50, 0x44, 0x00, 
+    0x30, 0x44, 0x06, 0x28, 0x77, 0x35, 0x20, 0xB7, 0x13, 0x33, 0x18, 0x72, 0x44, 0x52, 0x03, 0x34, 
+    0x50, 0x04, 0x14, 0x43, 0x02, 0x55, 0x50, 0xA0, 0xB5, 0x00, 0x40, 0xF1, 0x02, 0x4E, 0x00, 0x60, 
+    0x49, 0x0C, 0x61, 0x44, 0x05, 0x04, 0x68, 0x73, 0x40, 0x43, 0x0F, 0x83, 0x14, 0x22, 0x44, 0x51, 
+    0x64, 0x04, 0x50, 0xA5, 0x07, 0xC4, 0x50, 0x05, 0x55, 0xB0, 0x01, 0x54, 0xB5, 0x00, 0x40, 0xF1, 
+    0x02, 0x49, 0x02, 0x76, 0x60, 0x45, 0x00, 0x50, 0x43, 0x29, 0x34, 0x45, 0x00, 0x03, 0x77, 0x71, 
+    0x53, 0x78, 0x83, 0x14, 0x40, 0x05, 0x52, 0x77, 0x10, 0x24, 0x50, 0x55, 0x54, 0x44, 0x55, 0xC0, 
+    0x0A, 0x50, 0x05, 0x50, 0x05, 0x55, 0x40, 0xE1, 0xF2, 0x02, 0x4D, 0x24, 0x13, 0x33, 0x1C, 0x40, 
+    0x00, 0x28, 0x77, 0x65, 0x17, 0x87, 0x34, 0x00, 0x55, 0x04, 0x66, 0x73, 0x01, 0x31, 0x40, 0xA5, 
+    0x02, 0x00, 0x50, 0xC0, 0x02, 0x41, 0x40, 0xE0, 0x55, 0x03, 0x76, 0x65, 0x44, 0x1F, 0x02, 0x11, 
+    0x33, 0x34, 0xC4, 0x00, 0x01, 0x77, 0x74, 0x27, 0x73, 0x15, 0x00, 0x05, 0x54, 0x67, 0x43, 0x03, 
+    0x44, 0x14, 0x43, 0x00, 0x50, 0xB0, 0x03, 0xC1, 0x15, 0xD0, 0x02, 0x51, 0x30, 0x46, 0x00, 0x10, 
+    0xE2, 0x00, 0x10, 0x42, 0x00, 0x30, 0xA0, 0x02, 0x50, 0x00, 0x42, 0x11, 0x11, 0x31, 0x4C, 0x40, 
+    0x02, 0x77, 0x72, 0x53, 0x32, 0xC0, 0x0E, 0x54, 0x68, 0x71, 0x05, 0x45, 0x41, 0x55, 0x00, 0x47, 
+    0x03, 0x51, 0x14, 0xE0, 0x46, 0xC1, 0x04, 0x22, 0x21, 0x10, 0x43, 0x00, 0x60, 0xE0, 0x0B, 0x22, 
+    0x21, 0x11, 0x31, 0xCC, 0x45, 0x42, 0x04, 0x35, 0x45, 0x50, 0xC0, 0x05, 0x43, 0x66, 0x82, 0xA0, 
+    0x01, 0x54, 0x43, 0xD0, 0x4A, 0x00, 0x40, 0x4A, 0x01, 0x21, 0x43, 0x00, 0x80, 0x4A, 0x10, 0x42, 
+    0x22, 0x11, 0x33, 0x14, 0xC4, 0x48, 0x77, 0x10, 0x42, 0x0A, 0x50, 0x00, 0x41, 0x36, 0x66, 0x70, 
+    0x43, 0xF0, 0x05, 0x03, 0x51, 0x31, 0x47, 0xE1, 0x00, 0x20, 0xC1, 0x42, 0x00, 0x70, 0x4A, 0x03, 
+    0x22, 0x21, 0x42, 0x08, 0x31, 0x44, 0x53, 0x73, 0x40, 0xB5, 0x02, 0x00, 0x40, 0xB6, 0x02, 0x87, 
+    0x30, 0xF0, 0x0A, 0x03, 0x13, 0x15, 0xE0, 0xF1, 0x0A, 0x04, 0x77, 0x66, 0x30, 0x47, 0xA1, 0xC3, 
+    0x02, 0x14, 0x10, 0x46, 0x01, 0x41, 0xF6, 0x00, 0x00, 0x50, 0xF0, 0x09, 0x04, 0x41, 0x3C, 0x50, 
+    0x56, 0x06, 0x33, 0x86, 0x36, 0x60, 0x51, 0x04, 0x33, 0x87, 0x70, 0x43, 0x00, 0x10, 0xB6, 0x05, 
+    0x33, 0x66, 0x78, 0x51, 0x05, 0x0C, 0x31, 0x45, 0x51, 0x06, 0x31, 0x13, 0x33, 0x60, 0x4D, 0x02, 
+    0x21, 0x10, 0xB3, 0x0A, 0x13, 0x77, 0x73, 0x55, 0x51, 0x60, 0xD3, 0x03, 0x66, 0x81, 0x52, 0x04, 
+    0x43, 0x11, 0x40, 0xC0, 0x00, 0x40, 0xF1, 0x04, 0x07, 0x33, 0x13, 0x16, 0x76, 0x49, 0xB2, 0x02, 
+    0x11, 0x30, 0xA1, 0x07, 0x87, 0x78, 0x34, 0x52, 0xE3, 0x03, 0x68, 0x34, 0x52, 0x05, 0x01, 0x33, 
+    0x14, 0x51, 0x04, 0x11, 0x13, 0x30, 0x49, 0x02, 0x55, 0x40, 0xD2, 0xA1, 0x00, 0x30, 0xB7, 0x02, 
+    0x35, 0x40, 0xD3, 0x07, 0x66, 0x11, 0x25, 0x55, 0xF0, 0x09, 0x03, 0x43, 0x13, 0x48, 0x04, 0xC1, 
+    0x14, 0x40, 0xA2, 0x01, 0x12, 0xA1, 0x00, 0x30, 0x48, 0x03, 0x05, 0x44, 0x47, 0x00, 0x20, 0x42, 
+    0x04, 0x86, 0x64, 0x50, 0x46, 0x04, 0x14, 0x36, 0x10, 0x52, 0x03, 0x01, 0x31, 0x47, 0x01, 0xC1, 
+    0x42, 0x00, 0x40, 0xE2, 0x4E, 0x00, 0x40, 0x47, 0x0A, 0x18, 0x76, 0x63, 0x31, 0x51, 0x60, 0xA3, 
+    0x06, 0x66, 0x21, 0x36, 0x40, 0x53, 0x00, 0x40, 0x42, 0xA5, 0x00, 0x40, 0xB1, 0xA4, 0x51, 0x01, 
+    0x55, 0x47, 0x0D, 0x21, 0x11, 0x23, 0x78, 0x63, 0x36, 0x44, 0x45, 0x04, 0x13, 0x73, 0x50, 0x53, 
+    0x06, 0x02, 0x10, 0x05, 0x40, 0x46, 0x04, 0x12, 0x24, 0x40, 0xE2, 0x01, 0x10, 0x48, 0xA4, 0xD2, 
+    0x03, 0x11, 0x21, 0xA6, 0x03, 0x33, 0x44, 0xA3, 0x08, 0x66, 0x3C, 0x36, 0x45, 0x50, 0xF0, 0x0D, 
+    0x01, 0x40, 0xB5, 0x03, 0x44, 0x1C, 0xB1, 0x00, 0x40, 0xC2, 0xA1, 0x00, 0x70, 0x4C, 0x07, 0x44, 
+    0x22, 0x21, 0x12, 0xA1, 0x08, 0x67, 0x76, 0x31, 0x51, 0x60, 0xA3, 0x04, 0x6C, 0x63, 0x50, 0x58, 
+    0x01, 0x14, 0x42, 0x04, 0x11, 0xCC, 0xC0, 0xC1, 0x02, 0x22, 0x20, 0xB1, 0x01, 0x77, 0x44, 0x01, 
+    0x55, 0xD4, 0x01, 0x22, 0xE1, 0x07, 0x67, 0x86, 0x63, 0x54, 0xB3, 0x05, 0x63, 0x83, 0x40, 0x50, 
+    0xA5, 0x03, 0x42, 0x23, 0x42, 0xF1, 0x04, 0x43, 0x04, 0x21, 0x77, 0x70, 0x4B, 0x00, 0x20, 0x46, 
+    0x08, 0x33, 0x36, 0x63, 0x36, 0x10, 0x46, 0x03, 0x12, 0x45, 0x50, 0x0B, 0x05, 0x54, 0x42, 0x32, 
+    0x55, 0x42, 0xF1, 0x03, 0x00, 0x20, 0x43, 0x05, 0x11, 0x87, 0x63, 0x48, 0x02, 0x24, 0x20, 0xE1, 
+    0xA3, 0xA6, 0x03, 0x34, 0x36, 0x42, 0x00, 0x10, 0xA5, 0xF0, 0x0A, 0x08, 0x55, 0x42, 0x23, 0x12, 
+    0x40, 0xF1, 0x04, 0xA2, 0xA1, 0x0E, 0x37, 0x76, 0x60, 0x00, 0x55, 0x44, 0x42, 0x20, 0x45, 0x02, 
+    0x31, 0x10, 0xB3, 0x06, 0x66, 0x63, 0x34, 0x40, 0xA3, 0x45, 0x01, 0x55, 0xF0, 0x08, 0x05, 0x55, 
+    0x44, 0x13, 0xF1, 0x07, 0x03, 0x24, 0x42, 0x43, 0x00, 0x60, 0x42, 0x01, 0x55, 0xA4, 0x42, 0xA1, 
+    0x00, 0x30, 0x45, 0x01, 0x68, 0x42, 0x07, 0x14, 0x13, 0x66, 0x34, 0xC5, 0x02, 0x44, 0x50, 0xF0, 
+    0x07, 0x03, 0x42, 0x41, 0xB3, 0x07, 0x11, 0x13, 0x11, 0x12, 0xB1, 0x03, 0xC4, 0x22, 0x48, 0xA4, 
+    0x03, 0x22, 0x12, 0xD1, 0xD3, 0x0C, 0x66, 0x63, 0x61, 0x54, 0x36, 0x83, 0x20, 0xA5, 0xD4, 0x02, 
+    0x55, 0x40, 0xB5, 0x45, 0x00, 0x40, 0x48, 0xF1, 0x01, 0x00, 0x40, 0xA2, 0x55, 0xF3, 0x00, 0x0A, 
+    0x66, 0x33, 0x14, 0x43, 0x33, 0x10, 0x42, 0x11, 0x44, 0x22, 0x12, 0x44, 0x24, 0x24, 0x54, 0x05, 
+    0x05, 0x50, 0x00, 0x20, 0xB1, 0x03, 0x22, 0x24, 0xA2, 0x44, 0x03, 0x55, 0x44, 0xB2, 0xB1, 0xF3, 
+    0x06, 0x06, 0x61, 0x13, 0x36, 0x30, 0xB4, 0x19, 0x11, 0x24, 0x21, 0x13, 0x11, 0x44, 0x40, 0x04, 
+    0x25, 0x50, 0x52, 0x45, 0x16, 0xB3, 0x06, 0x11, 0x12, 0x21, 0x30, 0x43, 0x06, 0x42, 0x11, 0x22, 
+    0x10, 0xA6, 0x03, 0x55, 0x44, 0xB2, 0xF1, 0x02, 0xF3, 0x02, 0x0F, 0x66, 0x33, 0x83, 0x24, 0x44, 
+    0x21, 0x11, 0x41, 0xB3, 0x06, 0x14, 0x12, 0x42, 0x10, 0xD4, 0x00, 0x10, 0xC3, 0x05, 0x11, 0x14, 
+    0x22, 0xA1, 0x07, 0x24, 0x21, 0x33, 0x11, 0x46, 0x00, 0x20, 0xB4, 0x54, 0x04, 0x36, 0x33, 0x60, 
+    0x42, 0x05, 0x22, 0x13, 0x31, 0x45, 0x05, 0x13, 0x11, 0x31, 0xE2, 0x02, 0x3B, 0xB0, 0x43, 0xB2, 
+    0x06, 0xCC, 0x12, 0x11, 0x10, 0xB3, 0x02, 0x77, 0x70, 0x42, 0x06, 0x42, 0x22, 0x44, 0x20, 0xA1, 
+    0x02, 0x33, 0x30, 0xA1, 0x04, 0x33, 0x11, 0x10, 0xF3, 0x00, 0x43, 0x01, 0x41, 0xF3, 0x09, 0x46, 
+    0xB3, 0xB1, 0x01, 0x22, 0xB1, 0x0F, 0x31, 0x33, 0xB3, 0x36, 0x33, 0x12, 0x24, 0x44, 0x43, 0x01, 
+    0x22, 0x47, 0x02, 0x13, 0x30, 0x49, 0x00, 0x30, 0xB2, 0x01, 0x36, 0xF3, 0x08, 0x00, 0x10, 0xC2, 
+    0x00, 0x10, 0x48, 0xA1, 0x01, 0x36, 0xC3, 0x0D, 0x14, 0x44, 0xC1, 0x52, 0x22, 0x40, 0x05, 0x4C, 
+    0xA1, 0xD3, 0x02, 0x66, 0x30, 0xB1, 0xF3, 0x0B, 0xB2, 0x00, 0x10, 0x42, 0x03, 0x13, 0x33, 0xF1, 
+    0x05, 0x06, 0x31, 0x11, 0x31, 0x20, 0xF0, 0x00, 0x09, 0x42, 0x22, 0x11, 0x13, 0x33, 0x4C, 0x01, 
+    0x33, 0xB1, 0x01, 0x21, 0xF3, 0x05, 0x07, 0x11, 0x33, 0x31, 0x12, 0xA1, 0x00, 0x30, 0xA1, 0x46, 
+    0x09, 0xCC, 0x11, 0x13, 0x33, 0x63, 0xB1, 0xF0, 0x01, 0x00, 0x50, 0xA2, 0xA1, 0x01, 0x33, 0xA1, 
+    0x04, 0x33, 0x31, 0x10, 0x44, 0x09, 0x21, 0x12, 0x22, 0x33, 0x32, 0xA1, 0x00, 0x30, 0xA1, 0x00, 
+    0x30, 0xF1, 0x01, 0xD2, 0x04, 0x44, 0x42, 0x40, 0xE1, 0xA2, 0x05, 0x11, 0x44, 0x11, 
+};
+
+const gfx_image_t TOWER_MINOTAUR_IMG = {
+    .w = TOWER_MINOTAUR_W, .h = TOWER_MINOTAUR_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TOWER_MINOTAUR_PAL, .colors = TOWER_MINOTAUR_PAL_SIZE,
+    .data = TOWER_MINOTAUR_RLE, .size = TOWER_MINOTAUR_RLE_SIZE,
 };
@@ -6,233 +6,116 @@ const uint16_t TOWER_ORC_PAL[TOWER_ORC_PAL_SIZE] = {
     0xEF3A, 0xCDB2, 0xF166, 0x8306, 0xDAAA, 0xC54E, 0xE14A, 0x6149, 
 };
 
-const uint8_t TOWER_ORC_IDX[(TOWER_ORC_W * TOWER_ORC_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0xAA, 0xAA, 0xF0, 0x00, 0x2A, 0xAA, 0xAA, 0xE0, 0x00, 0x00, 0x2A, 0xAA, 0xA0, 0x00, 0x22, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 
-    0xE3, 0x2E, 0xAF, 0x00, 0x2A, 0xA0, 0x35, 0xAE, 0x30, 0x02, 0xAE, 0x33, 0xCA, 0x0F, 0x00, 0x00, 
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 
-    0x30, 0x02, 0xAE, 0xF0, 0x2A, 0xAF, 0x02, 0xAE, 0xF0, 0xFC, 0xAF, 0x00, 0x30, 0x00, 0x00, 0x06, 
-    0x54, 0x52, 0x22, 0x52, 0x22, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 
-    0x00, 0x00, 0xCA, 0xE0, 0x2A, 0xA0, 0x35, 0xAE, 0x30, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 
-    0x00, 0x00, 0xCA, 0xE0, 0x2A, 0xAA, 0xAA, 0xEF, 0x00, 0xCA, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 
-    0x00, 0x00, 0xCA, 0xE0, 0x2A, 0xAF, 0x02, 0xAE, 0xF0, 0xCA, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCA, 
-    0x00, 0x0C, 0xAE, 0xF0, 0x2A, 0xA0, 0x05, 0xAE, 0xF0, 0x0C, 0xA0, 0x00, 0x5A, 0xE6, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 
-    0xA0, 0xCA, 0x0F, 0x00, 0x2A, 0xA0, 0x06, 0xAA, 0x52, 0x02, 0xCA, 0x05, 0xAC, 0x56, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
-    0xCC, 0x00, 0xF0, 0x20, 0x69, 0xC9, 0x66, 0xCC, 0x06, 0x60, 0x6C, 0xCC, 0xC0, 0x62, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-    0x88, 0x00, 0x02, 0x68, 0x86, 0x66, 0x52, 0x26, 0x66, 0x66, 0x60, 0x60, 0x02, 0x20, 0x32, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 
-    0x88, 0x20, 0x26, 0x02, 0x24, 0x98, 0x76, 0x52, 0x22, 0x66, 0x66, 0x66, 0x62, 0x00, 0x00, 0x02, 
-    0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x62, 0x68, 
-    0x88, 0x86, 0x66, 0x02, 0x97, 0x78, 0x88, 0x87, 0x41, 0x22, 0x32, 0x22, 0x26, 0x25, 0x33, 0x30, 
-    0x25, 0x22, 0x23, 0x00, 0x26, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x02, 0x88, 0x88, 0x66, 
-    0x77, 0x82, 0x10, 0x16, 0x97, 0x88, 0x88, 0x87, 0x76, 0x10, 0x00, 0x00, 0x01, 0x22, 0x33, 0x30, 
-    0x00, 0x03, 0x13, 0x00, 0x24, 0x66, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x00, 0x02, 0x66, 0x87, 0x88, 0x54, 
-    0x46, 0x40, 0x00, 0x54, 0x67, 0x88, 0x88, 0x87, 0x77, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x12, 0x12, 0x26, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x86, 0x02, 0x62, 0x24, 0x96, 0x86, 0x22, 
-    0x44, 0x40, 0x03, 0x12, 0x47, 0x88, 0x88, 0x88, 0x77, 0x20, 0x06, 0x30, 0x30, 0x00, 0x03, 0x30, 
-    0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x78, 0x66, 0x62, 0x22, 0x94, 0x99, 0x32, 
-    0x41, 0xB4, 0x00, 0x31, 0x44, 0x88, 0x88, 0x88, 0x77, 0x10, 0x65, 0x00, 0x00, 0x00, 0x00, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x32, 0x21, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x89, 0x45, 0x23, 0x03, 0x99, 0x96, 0x15, 
-    0x51, 0x05, 0x50, 0x01, 0x54, 0x67, 0x88, 0x87, 0x94, 0x47, 0x90, 0x13, 0x00, 0x00, 0x00, 0x02, 
-    0x13, 0x00, 0x00, 0x00, 0x03, 0x22, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x62, 0x32, 0x42, 0x03, 0x66, 0x75, 0x31, 
-    0x20, 0x00, 0x30, 0x01, 0x11, 0x24, 0x97, 0x77, 0x74, 0xD9, 0x3B, 0x99, 0x44, 0x66, 0x50, 0x00, 
-    0x33, 0x10, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x32, 0x10, 0x55, 0x65, 0x03, 
-    0x00, 0x00, 0x00, 0x05, 0x31, 0x15, 0x44, 0x54, 0x74, 0x13, 0x33, 0x24, 0x69, 0x97, 0x79, 0x41, 
-    0x13, 0x03, 0x33, 0x00, 0x00, 0x31, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x93, 0x12, 0x00, 0x03, 0x50, 0x32, 0x64, 0x33, 
-    0x00, 0x00, 0x00, 0x34, 0x53, 0x12, 0x15, 0x49, 0x74, 0x10, 0x52, 0x02, 0x46, 0x54, 0x97, 0x74, 
-    0x55, 0x10, 0x01, 0x10, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x96, 0x20, 0x03, 0x04, 0x20, 0x24, 0x49, 0x23, 
-    0x00, 0x00, 0x00, 0x24, 0x24, 0x11, 0x14, 0x97, 0x87, 0x55, 0x43, 0x00, 0x22, 0x69, 0x49, 0x7D, 
-    0xD4, 0x41, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x52, 0x30, 0x30, 0x14, 0x50, 0x25, 0x55, 0x30, 
-    0x00, 0x00, 0x00, 0x05, 0x44, 0x94, 0x49, 0x77, 0x61, 0x95, 0x50, 0x00, 0x02, 0x29, 0x57, 0x79, 
-    0x9D, 0x44, 0x43, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x52, 0x03, 0x00, 0x00, 0x03, 0x14, 0x45, 0x03, 
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x99, 0xD7, 0x91, 0x00, 0x74, 0x10, 0x00, 0x00, 0x32, 0x56, 0x7D, 
-    0x44, 0x4D, 0x44, 0x30, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x16, 0x44, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x54, 0x49, 
-    0x74, 0x99, 0x99, 0x94, 0x30, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x20, 0x00, 0x00, 0x20, 0x02, 0x54, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43, 0x05, 0x51, 0x31, 0x00, 0x00, 0x00, 0x00, 0x03, 0x19, 
-    0x87, 0x77, 0x77, 0x77, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x53, 0x00, 0x00, 0x00, 0x01, 0x45, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x95, 0x11, 0x50, 0x14, 0x00, 0x00, 0x00, 0x01, 0x03, 0x15, 
-    0x69, 0x77, 0x88, 0x87, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x53, 0x03, 0x00, 0x00, 0x03, 0x23, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x41, 0x14, 0x24, 0x00, 0x00, 0x00, 0x34, 0x41, 0x55, 
-    0x47, 0x78, 0x88, 0x89, 0x4D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC5, 0x30, 0x00, 0x00, 0x00, 0x02, 0x20, 
-    0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x05, 0x14, 0x24, 0x42, 0x00, 0x00, 0x31, 0x5D, 0x89, 0x44, 
-    0x78, 0x87, 0x88, 0x8D, 0xD4, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x35, 0x50, 0x00, 0x00, 0x00, 0x01, 0x30, 
-    0x00, 0x00, 0x00, 0x04, 0x50, 0x00, 0x11, 0x05, 0x72, 0x41, 0x00, 0x00, 0xBB, 0x47, 0x88, 0x7B, 
-    0x47, 0x88, 0x78, 0x8D, 0xD4, 0xB4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xC3, 0x00, 0x50, 0x00, 0x00, 0x00, 0x31, 0x30, 
-    0x00, 0x00, 0x00, 0x01, 0x51, 0x00, 0x31, 0x1B, 0xD5, 0x10, 0x00, 0x00, 0x4B, 0x49, 0x77, 0x84, 
-    0x14, 0x67, 0x77, 0x74, 0x44, 0xB5, 0xDD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x30, 0x00, 0x30, 0x01, 0x00, 0x00, 0x11, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x31, 0xB5, 0x55, 0x53, 0xB2, 0x00, 0x00, 0x13, 0x4B, 0x54, 0x77, 0x87, 
-    0x15, 0x19, 0x79, 0x44, 0x44, 0x15, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x11, 0x31, 0x00, 0x02, 0x40, 0xBB, 0xB1, 0x44, 0x78, 
-    0x51, 0x14, 0x99, 0x44, 0xB1, 0x11, 0x44, 0x44, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5D, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0xBB, 0x14, 0x47, 
-    0x41, 0x55, 0x44, 0x44, 0x11, 0x34, 0x79, 0x94, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x55, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x30, 0x00, 0x13, 0x01, 0x40, 0x04, 0xB4, 0x14, 0xB4, 
-    0x53, 0x51, 0x1B, 0x11, 0x13, 0x18, 0x86, 0x64, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x22, 0x40, 0x01, 0x11, 0x11, 0x13, 
-    0x10, 0x01, 0x11, 0x11, 0x33, 0x28, 0x89, 0x64, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x54, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0x54, 0x13, 0x00, 0x10, 0x33, 0x13, 
-    0x00, 0x00, 0x00, 0x13, 0x01, 0x26, 0x88, 0x65, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x33, 0x31, 0x13, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x14, 0x11, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x22, 0x26, 0x94, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x44, 0x41, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x47, 0x95, 0x15, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x32, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x54, 0x42, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x01, 0x12, 0x55, 0x42, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x02, 0x86, 0x50, 0x00, 0x00, 0x21, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x01, 0x54, 0x94, 0x55, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x44, 0x67, 0x23, 0x11, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x83, 0x03, 0x33, 0x13, 0x15, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x13, 0x35, 0x96, 0xB1, 0x30, 0x00, 0x00, 
-    0x00, 0x11, 0x56, 0x76, 0x78, 0x85, 0x44, 0x10, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x10, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x21, 0x30, 0x00, 0x00, 
-    0x11, 0x14, 0x42, 0x69, 0x77, 0x64, 0x20, 0x00, 0x00, 0x00, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x00, 0x03, 0x35, 0x54, 0x54, 0x42, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x33, 0x11, 0x13, 0x11, 0x30, 0x00, 0x00, 
-    0x05, 0x44, 0x74, 0x54, 0x55, 0x20, 0x00, 0x00, 0x01, 0x21, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x44, 0x55, 0x51, 0x15, 0x54, 0x46, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0x51, 0x35, 0x51, 0x11, 0x30, 0x00, 0x00, 
-    0x00, 0x24, 0x67, 0x12, 0x23, 0x00, 0x12, 0x20, 0x02, 0x41, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x52, 0x10, 0x00, 0x02, 0x11, 0x54, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x33, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x55, 0x30, 0x10, 0x01, 0x67, 0x72, 0x26, 0x61, 0x15, 0x41, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x12, 0x13, 0x00, 0x00, 0x01, 0x14, 0x67, 0x76, 0x41, 0x02, 0x43, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x30, 0x00, 0x01, 0x52, 0x11, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x13, 0x00, 0x00, 0x00, 0x00, 0x11, 0x47, 0x84, 0x42, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x11, 0x46, 0x44, 0x42, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x46, 0x64, 0x62, 0x01, 0x13, 0x03, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x03, 0x54, 0x45, 0x22, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x66, 0x66, 0x61, 0x03, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x14, 0x42, 0x11, 0x16, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x67, 0x64, 0x20, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x10, 0x15, 0x00, 0x14, 0x43, 0x00, 0x01, 0x69, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x55, 0x44, 0x10, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x00, 0x31, 0x00, 0x04, 0x51, 0x00, 0x00, 0x59, 0xD1, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x54, 0x25, 0x64, 0x10, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x02, 0x42, 0x01, 0x00, 0x31, 0x44, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x01, 0x24, 0x45, 0x42, 0x11, 0x12, 0x10, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x26, 0x60, 0x01, 0x15, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x10, 0x01, 0x21, 0x31, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x20, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x16, 0x32, 0x00, 0x00, 0x20, 0x33, 0x10, 0x33, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x03, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x25, 0x51, 0x00, 0x01, 0x32, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x03, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x96, 0x30, 0x30, 0x32, 0x52, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0x00, 0x00, 0x19, 0x41, 0x15, 0x56, 0x22, 0x20, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x95, 0x10, 0x03, 0x33, 0x22, 0x26, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x19, 0x50, 0x00, 0x00, 0x22, 0x55, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0x33, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x03, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x12, 0x52, 0x21, 0x00, 0x22, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x52, 0x25, 0x52, 0x52, 0x30, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 
-    0x25, 0x22, 0x22, 0x11, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 
-    0x00, 0x30, 0x00, 0x03, 0x32, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x35, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x14, 0xB0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x54, 0x10, 0x15, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x51, 0x00, 0x15, 0x51, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-    0x13, 0x00, 0x03, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t TOWER_ORC_RLE[TOWER_ORC_RLE_SIZE] = {
+    0xF0, 0xF5, 0x01, 0x22, 0xF0, 0x36, 0x00, 0x50, 0xAA, 0x04, 0xF0, 0x00, 0x20, 0xBA, 0x00, 0xE0, 
+    0xB0, 0x00, 0x20, 0xAA, 0x05, 0x00, 0x02, 0x23, 0xF0, 0x36, 0x07, 0x5A, 0xE3, 0x2E, 0xAF, 0x43, 
+    0x10, 0x03, 0x5A, 0xE3, 0x00, 0x2A, 0xE3, 0x3C, 0xA0, 0xF0, 0xA0, 0xF2, 0x04, 0xF0, 0x27, 0x09, 
+    0x5A, 0xA3, 0x00, 0x2A, 0xEF, 0x42, 0x0D, 0xF0, 0x2A, 0xEF, 0x0F, 0xCA, 0xF0, 0x03, 0xC0, 0x07, 
+    0x65, 0x45, 0x22, 0x25, 0xE2, 0xF0, 0x25, 0x01, 0xAA, 0xB0, 0x02, 0xCA, 0xE0, 0x42, 0x08, 0x03, 
+    0x5A, 0xE3, 0x0C, 0xA0, 0xF0, 0x00, 0x00, 0x30, 0xF0, 0x08, 0x00, 0x20, 0x79, 0x09, 0xAA, 0xAE, 
+    0xF0, 0x0C, 0xAE, 0xF0, 0x3E, 0x00, 0x20, 0x4C, 0x05, 0xF0, 0x2A, 0xEF, 0x7F, 0xF0, 0x02, 0x09, 
+    0x2C, 0xA0, 0x00, 0xCA, 0xEF, 0x42, 0x02, 0x00, 0x50, 0x42, 0x09, 0x0C, 0xA0, 0x00, 0x5A, 0xE6, 
+    0xF0, 0x39, 0x08, 0xFC, 0xA0, 0xCA, 0x0F, 0x00, 0x44, 0x0D, 0x6A, 0xA5, 0x20, 0x2C, 0xA0, 0x5A, 
+    0xC5, 0x7F, 0x18, 0x00, 0x05, 0xCC, 0x00, 0xF0, 0x20, 0x69, 0xC9, 0x66, 0xCC, 0x06, 0x60, 0x60, 
+    0xAC, 0x03, 0x06, 0x22, 0xF0, 0x39, 0x0F, 0x68, 0x80, 0x00, 0x26, 0x88, 0x66, 0x65, 0x22, 0xC6, 
+    0x09, 0x06, 0x00, 0x22, 0x03, 0x22, 0xF0, 0x36, 0x13, 0x38, 0x88, 0x20, 0x26, 0x02, 0x24, 0x98, 
+    0x76, 0x52, 0x22, 0xD6, 0x00, 0x20, 0xB0, 0x03, 0x23, 0x13, 0xF0, 0x2E, 0x04, 0x28, 0x62, 0x60, 
+    0xA8, 0x07, 0x66, 0x60, 0x29, 0x77, 0xA8, 0x05, 0x74, 0x12, 0x23, 0xA2, 0x11, 0x62, 0x53, 0x33, 
+    0x02, 0x52, 0x22, 0x30, 0x02, 0x66, 0xF0, 0x1D, 0x01, 0x42, 0xC0, 0x00, 0x20, 0xA8, 0x0B, 0x66, 
+    0x77, 0x82, 0x10, 0x16, 0x97, 0xB8, 0x03, 0x77, 0x61, 0xC0, 0x02, 0x12, 0x20, 0x42, 0x04, 0x00, 
+    0x03, 0x10, 0x42, 0x03, 0x46, 0x62, 0xF0, 0x1B, 0x01, 0x98, 0xA0, 0x11, 0x26, 0x68, 0x78, 0x85, 
+    0x44, 0x64, 0x00, 0x05, 0x46, 0x46, 0x02, 0x72, 0x30, 0xF0, 0x09, 0x06, 0x12, 0x12, 0x26, 0x60, 
+    0x64, 0x15, 0x60, 0x26, 0x22, 0x49, 0x68, 0x62, 0x24, 0x44, 0x00, 0x31, 0x24, 0x44, 0x09, 0x87, 
+    0x72, 0x00, 0x63, 0x03, 0xA0, 0x01, 0x33, 0xE0, 0x00, 0x10, 0xA2, 0x01, 0x62, 0x62, 0x17, 0x78, 
+    0x66, 0x62, 0x22, 0x94, 0x99, 0x32, 0x41, 0xB4, 0x00, 0x31, 0x44, 0x46, 0x03, 0x10, 0x65, 0xE0, 
+    0x47, 0x05, 0x03, 0x22, 0x12, 0x62, 0x26, 0xD8, 0x94, 0x52, 0x30, 0x39, 0x99, 0x61, 0x55, 0x10, 
+    0x55, 0x00, 0x15, 0x46, 0x78, 0x88, 0x79, 0x44, 0x79, 0x01, 0x30, 0xD0, 0x02, 0x21, 0x30, 0xD0, 
+    0x03, 0x32, 0x23, 0x62, 0x1B, 0x16, 0x23, 0x24, 0x20, 0x36, 0x67, 0x53, 0x12, 0x00, 0x03, 0x00, 
+    0x11, 0x12, 0x49, 0xA7, 0x11, 0x4D, 0x93, 0xB9, 0x94, 0x46, 0x65, 0x00, 0x03, 0x31, 0xD0, 0x02, 
+    0x22, 0x00, 0x61, 0x0F, 0x20, 0x02, 0x00, 0x32, 0x10, 0x55, 0x65, 0x03, 0xD0, 0x1E, 0x53, 0x11, 
+    0x54, 0x45, 0x47, 0x41, 0x33, 0x32, 0x46, 0x99, 0x77, 0x94, 0x11, 0x30, 0x33, 0x30, 0xA0, 0x02, 
+    0x31, 0x10, 0xF0, 0x19, 0x0F, 0x69, 0x31, 0x20, 0x00, 0x35, 0x03, 0x26, 0x43, 0x45, 0x20, 0x34, 
+    0x53, 0x12, 0x15, 0x49, 0x74, 0x10, 0x52, 0x02, 0x46, 0x54, 0x97, 0x74, 0x55, 0x10, 0x01, 0x10, 
+    0xA0, 0x01, 0x32, 0xF0, 0x19, 0x0F, 0x49, 0x62, 0x00, 0x30, 0x42, 0x02, 0x44, 0x92, 0x45, 0x1F, 
+    0x24, 0x24, 0x11, 0x14, 0x97, 0x87, 0x55, 0x43, 0x00, 0x22, 0x69, 0x49, 0x7D, 0xD4, 0x41, 0x00, 
+    0x43, 0x00, 0x20, 0xF0, 0x1A, 0x0F, 0x25, 0x23, 0x03, 0x01, 0x45, 0x02, 0x55, 0x53, 0xE0, 0x0D, 
+    0x54, 0x49, 0x44, 0x97, 0x76, 0x19, 0x55, 0xA0, 0x0C, 0x22, 0x95, 0x77, 0x99, 0xD4, 0x44, 0x30, 
+    0xB0, 0x65, 0x01, 0x03, 0xB0, 0x06, 0x31, 0x44, 0x50, 0x30, 0xE0, 0x0C, 0x14, 0x99, 0xD7, 0x91, 
+    0x00, 0x74, 0x10, 0xB0, 0x0C, 0x32, 0x56, 0x7D, 0x44, 0x4D, 0x44, 0x30, 0xA0, 0x00, 0x10, 0xF0, 
+    0x1B, 0x00, 0x30, 0xF0, 0x00, 0x03, 0x16, 0x44, 0xF0, 0x03, 0xA1, 0x04, 0x00, 0x39, 0x40, 0xE0, 
+    0x06, 0x15, 0x44, 0x97, 0x40, 0xB9, 0x05, 0x43, 0x00, 0x33, 0x62, 0x01, 0x52, 0xB0, 0x06, 0x20, 
+    0x02, 0x54, 0x30, 0xF0, 0x03, 0x08, 0x54, 0x30, 0x55, 0x13, 0x10, 0xF0, 0x00, 0x03, 0x31, 0x98, 
+    0xD7, 0x00, 0xD0, 0xF0, 0x1F, 0x02, 0x55, 0x30, 0xD0, 0x03, 0x14, 0x51, 0x4B, 0x07, 0x95, 0x11, 
+    0x50, 0x14, 0xD0, 0x0E, 0x10, 0x31, 0x56, 0x97, 0x78, 0x88, 0x77, 0x40, 0xF0, 0x1E, 0x04, 0x35, 
+    0x30, 0x30, 0xB0, 0x02, 0x32, 0x30, 0xF0, 0x05, 0x06, 0x12, 0x41, 0x14, 0x20, 0x45, 0x08, 0x34, 
+    0x41, 0x55, 0x47, 0x70, 0xA8, 0x03, 0x94, 0xD1, 0x65, 0x02, 0xC5, 0x30, 0xE0, 0x01, 0x22, 0xE0, 
+    0x01, 0x21, 0xA0, 0x06, 0x51, 0x42, 0x44, 0x20, 0xA0, 0x13, 0x31, 0x5D, 0x89, 0x44, 0x78, 0x87, 
+    0x88, 0x8D, 0xD4, 0x45, 0xF0, 0x1B, 0x04, 0x30, 0x35, 0x50, 0xE0, 0x01, 0x13, 0xE0, 0x0C, 0x45, 
+    0x00, 0x01, 0x10, 0x57, 0x24, 0x10, 0xA0, 0x0C, 0xBB, 0x47, 0x88, 0x7B, 0x47, 0x88, 0x70, 0x43, 
+    0x03, 0xB4, 0x41, 0xF0, 0x17, 0x05, 0x14, 0xC3, 0x00, 0x46, 0x00, 0x30, 0x48, 0x0B, 0x15, 0x10, 
+    0x03, 0x11, 0xBD, 0x51, 0xB0, 0x0A, 0x4B, 0x49, 0x77, 0x84, 0x14, 0x60, 0xA7, 0x07, 0x44, 0x4B, 
+    0x5D, 0xD4, 0xF0, 0x15, 0xA3, 0x06, 0x00, 0x03, 0x00, 0x10, 0xA0, 0x00, 0x10, 0x48, 0x03, 0x03, 
+    0x1B, 0xA5, 0x02, 0x3B, 0x20, 0xA0, 0x0F, 0x13, 0x4B, 0x54, 0x77, 0x87, 0x15, 0x19, 0x79, 0xA4, 
+    0x01, 0x15, 0xA4, 0xF0, 0x14, 0x02, 0xB3, 0x30, 0xF0, 0x04, 0x00, 0x10, 0xF0, 0x01, 0x01, 0x33, 
+    0xA0, 0x1D, 0x11, 0x31, 0x00, 0x02, 0x40, 0xBB, 0xB1, 0x44, 0x78, 0x51, 0x14, 0x99, 0x44, 0xB1, 
+    0x11, 0xA4, 0x00, 0x50, 0xF0, 0x11, 0x03, 0x25, 0xDB, 0x4C, 0x01, 0x01, 0xF0, 0x0D, 0x0E, 0x14, 
+    0x01, 0x4B, 0xB1, 0x44, 0x74, 0x15, 0x50, 0xA4, 0x09, 0x11, 0x34, 0x79, 0x94, 0xB1, 0xF0, 0x0F, 
+    0x04, 0x35, 0x55, 0x30, 0xD0, 0x00, 0x30, 0xD0, 0x00, 0x30, 0xF0, 0x03, 0x08, 0x11, 0x13, 0x00, 
+    0x01, 0x30, 0x42, 0x16, 0x04, 0xB4, 0x14, 0xB4, 0x53, 0x51, 0x1B, 0x11, 0x13, 0x18, 0x86, 0x60, 
+    0x59, 0x05, 0x5B, 0x00, 0x13, 0xF0, 0x04, 0x00, 0x30, 0x4B, 0xD0, 0x06, 0x51, 0x22, 0x40, 0x00, 
+    0xC1, 0x03, 0x31, 0x00, 0xB1, 0x0A, 0x33, 0x28, 0x89, 0x64, 0x11, 0x30, 0xF0, 0x0E, 0x08, 0x30, 
+    0x01, 0x54, 0x45, 0x10, 0x49, 0xF0, 0x0A, 0x0E, 0x15, 0x35, 0x41, 0x30, 0x01, 0x03, 0x31, 0x30, 
+    0xC0, 0x0C, 0x13, 0x01, 0x26, 0x88, 0x65, 0x44, 0x10, 0xF0, 0x0E, 0x09, 0x50, 0x33, 0x31, 0x13, 
+    0x11, 0xF0, 0x14, 0x06, 0x25, 0x01, 0x41, 0x10, 0xD0, 0x45, 0x0D, 0x00, 0x03, 0x15, 0x22, 0x26, 
+    0x94, 0x11, 0xF0, 0x13, 0x04, 0x31, 0x12, 0x20, 0xF0, 0x12, 0x08, 0x31, 0x31, 0x44, 0x41, 0x10, 
+    0xF0, 0x08, 0x0C, 0x11, 0x12, 0x47, 0x95, 0x15, 0x51, 0x10, 0xF0, 0x07, 0x04, 0x20, 0x00, 0x30, 
+    0x43, 0x02, 0x20, 0x30, 0x5A, 0x08, 0x00, 0x11, 0x54, 0x42, 0x20, 0xF0, 0x06, 0x0C, 0x22, 0x01, 
+    0x12, 0x55, 0x42, 0x11, 0x30, 0xF0, 0x09, 0x03, 0x28, 0x65, 0xB0, 0x05, 0x21, 0x12, 0x01, 0xF0, 
+    0x10, 0x0A, 0x33, 0x00, 0x15, 0x49, 0x45, 0x50, 0xF0, 0x01, 0x0C, 0x12, 0x44, 0x67, 0x23, 0x11, 
+    0x03, 0x30, 0xF0, 0x0E, 0x0C, 0x28, 0x83, 0x03, 0x33, 0x13, 0x15, 0x30, 0xF0, 0x12, 0x0A, 0x31, 
+    0x13, 0x35, 0x96, 0xB1, 0x30, 0xD0, 0x0C, 0x11, 0x56, 0x76, 0x78, 0x85, 0x44, 0x10, 0xB0, 0x01, 
+    0x31, 0xF0, 0x0B, 0x00, 0x10, 0xA0, 0x05, 0x21, 0x01, 0x25, 0xF0, 0x14, 0xC1, 0x00, 0x20, 0x45, 
+    0x0C, 0x11, 0x14, 0x42, 0x69, 0x77, 0x64, 0x20, 0xD0, 0x02, 0x44, 0x10, 0xF0, 0x05, 0x0F, 0x20, 
+    0x00, 0x33, 0x55, 0x45, 0x44, 0x22, 0x23, 0xF0, 0x11, 0x09, 0x31, 0x13, 0x31, 0x11, 0x31, 0x45, 
+    0x0A, 0x05, 0x44, 0x74, 0x54, 0x55, 0x20, 0xC0, 0x06, 0x12, 0x12, 0x11, 0x10, 0xF0, 0x04, 0x0F, 
+    0x34, 0x45, 0x55, 0x11, 0x55, 0x44, 0x66, 0x41, 0xF0, 0x0F, 0x0A, 0x30, 0x01, 0x45, 0x13, 0x55, 
+    0x10, 0x47, 0x11, 0x02, 0x46, 0x71, 0x22, 0x30, 0x01, 0x22, 0x00, 0x24, 0xB1, 0xF0, 0x06, 0x03, 
+    0x45, 0x21, 0xA0, 0x05, 0x21, 0x15, 0x46, 0x59, 0x03, 0x03, 0x33, 0xB1, 0xF0, 0x01, 0x13, 0x15, 
+    0x53, 0x01, 0x00, 0x16, 0x77, 0x22, 0x66, 0x11, 0x54, 0x4E, 0x00, 0x30, 0xF0, 0x03, 0x02, 0x14, 
+    0x30, 0xF0, 0x0E, 0x00, 0x30, 0xF0, 0x0A, 0x03, 0x12, 0x13, 0xB0, 0x0C, 0x11, 0x46, 0x77, 0x64, 
+    0x10, 0x24, 0x30, 0xF0, 0x05, 0x00, 0x30, 0xA0, 0x04, 0x15, 0x21, 0x10, 0xB0, 0x01, 0x52, 0xF0, 
+    0x0F, 0x00, 0x30, 0xA0, 0x00, 0x30, 0xF0, 0x03, 0x02, 0x11, 0x30, 0xE0, 0x0B, 0x11, 0x47, 0x84, 
+    0x42, 0x01, 0x51, 0xF0, 0x04, 0x00, 0x30, 0xA0, 0x0C, 0x11, 0x46, 0x44, 0x42, 0x00, 0x03, 0x10, 
+    0xF0, 0x10, 0x00, 0x30, 0xF0, 0x12, 0x0D, 0x15, 0x46, 0x64, 0x62, 0x01, 0x13, 0x03, 0xF0, 0x05, 
+    0x0C, 0x11, 0x03, 0x54, 0x45, 0x22, 0x44, 0x20, 0xF0, 0x13, 0x00, 0x20, 0x59, 0x00, 0x40, 0xB6, 
+    0x04, 0x10, 0x31, 0x10, 0xF0, 0x07, 0x0D, 0x21, 0x00, 0x14, 0x42, 0x11, 0x16, 0x74, 0xF0, 0x01, 
+    0x00, 0x30, 0xF0, 0x0A, 0x00, 0x30, 0xF0, 0x0D, 0x0A, 0x11, 0x46, 0x76, 0x42, 0x00, 0x00, 0x4E, 
+    0x03, 0x10, 0x15, 0x43, 0x07, 0x30, 0x00, 0x16, 0x91, 0x5B, 0xF0, 0x0E, 0x0C, 0x11, 0x15, 0x54, 
+    0x41, 0x00, 0x02, 0x30, 0xF0, 0x04, 0x0A, 0x30, 0x03, 0x10, 0x00, 0x45, 0x10, 0xA0, 0x03, 0x59, 
+    0xD1, 0xF0, 0x28, 0x07, 0x22, 0x15, 0x42, 0x56, 0x42, 0x01, 0x31, 0xF0, 0x04, 0x00, 0x30, 0xA0, 
+    0x0E, 0x30, 0x00, 0x24, 0x20, 0x10, 0x03, 0x14, 0x40, 0xF0, 0x26, 0x0E, 0x12, 0x44, 0x54, 0x21, 
+    0x11, 0x21, 0x00, 0x10, 0x4C, 0xF0, 0x01, 0x09, 0x42, 0x26, 0x60, 0x01, 0x15, 0xF0, 0x25, 0x00, 
+    0x10, 0xB2, 0x07, 0x10, 0x01, 0x21, 0x31, 0x58, 0x09, 0x15, 0x15, 0x20, 0x00, 0x54, 0xD0, 0x00, 
+    0x30, 0xF0, 0x1B, 0x03, 0x16, 0x32, 0xA0, 0x07, 0x20, 0x33, 0x10, 0x33, 0x58, 0x01, 0x31, 0xD0, 
+    0x01, 0x51, 0x45, 0x00, 0x30, 0xF0, 0x1B, 0x01, 0x64, 0xB0, 0x09, 0x25, 0x51, 0x00, 0x01, 0x32, 
+    0x56, 0xF0, 0x00, 0x00, 0x30, 0x6B, 0x0A, 0x19, 0x63, 0x03, 0x03, 0x25, 0x20, 0xB0, 0x00, 0x30, 
+    0x5F, 0xD0, 0x00, 0x30, 0xF0, 0x0C, 0x00, 0x30, 0xF0, 0x03, 0x00, 0x50, 0xA0, 0x0A, 0x19, 0x41, 
+    0x15, 0x56, 0x22, 0x20, 0xB0, 0x00, 0x30, 0xF0, 0x1D, 0x02, 0x33, 0x30, 0x53, 0x00, 0x30, 0xF0, 
+    0x02, 0x10, 0x19, 0x51, 0x00, 0x33, 0x32, 0x22, 0x66, 0x20, 0x10, 0xF0, 0x21, 0xA3, 0xF0, 0x0C, 
+    0x4A, 0x03, 0x01, 0x95, 0xB0, 0x06, 0x22, 0x55, 0x22, 0x20, 0xF0, 0x21, 0x02, 0x3B, 0xB0, 0x62, 
+    0xD0, 0x02, 0x12, 0x10, 0xA2, 0xF0, 0x21, 0x01, 0xBB, 0xB1, 0x66, 0x00, 0x00, 0xB2, 0xF0, 0x20, 
+    0x05, 0x33, 0x30, 0x03, 0xF0, 0x1A, 0x06, 0x21, 0x25, 0x22, 0x10, 0x42, 0x00, 0x30, 0xF0, 0x21, 
+    0x01, 0x33, 0xF0, 0x1D, 0x0D, 0x35, 0x22, 0x55, 0x25, 0x23, 0x00, 0x21, 0xF0, 0x48, 0x03, 0x15, 
+    0x25, 0xA2, 0x03, 0x11, 0x22, 0xF0, 0x4B, 0x04, 0x21, 0x00, 0x30, 0xA0, 0x04, 0x33, 0x22, 0x30, 
+    0xF0, 0x36, 0x04, 0x30, 0x33, 0x30, 0xF0, 0x12, 0x01, 0x33, 0xF0, 0x36, 0xB3, 0xF0, 0x06, 0x02, 
+    0x35, 0x10, 0xF0, 0x01, 0x00, 0x30, 0xF0, 0x20, 0x01, 0x33, 0xF0, 0x1D, 0x03, 0x11, 0x4B, 0xA0, 
+    0x00, 0x30, 0xF0, 0x25, 0x00, 0x30, 0xF0, 0x1F, 0x08, 0x15, 0x41, 0x01, 0x55, 0x10, 0x7F, 0x56, 
+    0x01, 0x10, 0x43, 0x00, 0x30, 0xF0, 0x4D, 0x05, 0x31, 0x30, 0x00, 0xA3, 0xF0, 0x58, 0x00, 0x10, 
+    0xF0, 0x0C, 
+};
+
+const gfx_image_t TOWER_ORC_IMG = {
+    .w = TOWER_ORC_W, .h = TOWER_ORC_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TOWER_ORC_PAL, .colors = TOWER_ORC_PAL_SIZE,
+    .data = TOWER_ORC_RLE, .size = TOWER_ORC_RLE_SIZE,
 };
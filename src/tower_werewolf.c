@@ -6,197 +6,84 @@ const uint16_t TOWER_WEREWOLF_PAL[TOWER_WEREWOLF_PAL_SIZE] = {
     0x6473, 0x9AAA, 0xE149, 0xA511, 0x4926, 0xB146, 0x9929, 0x4BB0, 
 };
 
-const uint8_t TOWER_WEREWOLF_IDX[(TOWER_WEREWOLF_W * TOWER_WEREWOLF_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xDC, 0x0D, 0xD0, 0x0D, 0xD0, 0x5D, 0xD3, 0x33, 
-    0x0C, 0xDD, 0x3D, 0xC0, 0x0D, 0xD3, 0xD3, 0xC0, 0xDD, 0x00, 0xDD, 0x00, 0xD0, 0x00, 0x0D, 0xD3, 
-    0xD0, 0x00, 0xDD, 0x00, 0x00, 0x93, 0x33, 0x3A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3C, 0x00, 0xA0, 0x20, 0xA0, 0x93, 0xEC, 0xCC, 
-    0x01, 0x3A, 0x10, 0x30, 0x23, 0xAC, 0xCC, 0x12, 0x0A, 0x01, 0x3A, 0x09, 0x3E, 0x04, 0x0A, 0xC9, 
-    0x3E, 0x00, 0x0A, 0x00, 0x00, 0x93, 0xEC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x00, 0x30, 0x0A, 0x00, 0x93, 0x00, 0x00, 
-    0x01, 0x3E, 0x09, 0x30, 0x13, 0xA0, 0x01, 0x70, 0xC3, 0xE1, 0x3E, 0x13, 0xE0, 0x40, 0xA0, 0x00, 
-    0x93, 0x00, 0x0A, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x33, 0x33, 0x3A, 0x00, 0x93, 0x33, 0x3C, 
-    0x09, 0x3A, 0x03, 0x92, 0x13, 0x3A, 0x39, 0x00, 0x00, 0x33, 0x33, 0x33, 0xE0, 0x20, 0xA0, 0x00, 
-    0x13, 0xE0, 0x0A, 0x00, 0x00, 0x93, 0x33, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x33, 0x33, 0x3A, 0x02, 0x93, 0x00, 0x02, 
-    0x8B, 0x30, 0x80, 0x31, 0x13, 0xA1, 0x11, 0x07, 0x20, 0x33, 0x33, 0x33, 0xE0, 0x40, 0xA0, 0x00, 
-    0x93, 0xE0, 0x0A, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xA0, 0x00, 0x93, 0x92, 0x1B, 
-    0x89, 0x3E, 0x00, 0x31, 0x13, 0xA1, 0x1C, 0xC1, 0x21, 0x3A, 0x41, 0x3E, 0x00, 0x04, 0x0A, 0x01, 
-    0x3E, 0x00, 0x0A, 0xC0, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x03, 0xA0, 0x00, 0x93, 0x00, 0x3A, 
-    0xF1, 0x3E, 0x29, 0x31, 0x13, 0x33, 0x33, 0x91, 0x01, 0x0A, 0x21, 0x3E, 0x00, 0x00, 0x43, 0x33, 
-    0xE0, 0x00, 0xA3, 0x33, 0xE0, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 
-    0x82, 0x22, 0x22, 0x22, 0x22, 0x10, 0x11, 0x11, 0x00, 0x22, 0x22, 0x21, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x28, 
-    0x22, 0x42, 0x22, 0x20, 0x00, 0x17, 0x51, 0x11, 0x00, 0x01, 0x11, 0x02, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x44, 0x2F, 
-    0x44, 0x00, 0x01, 0x00, 0x00, 0x11, 0x50, 0x01, 0x00, 0x01, 0x12, 0x20, 0x21, 0x11, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x81, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x1B, 0x10, 0x00, 0x10, 0x01, 0x11, 0x10, 0x02, 0x11, 0x81, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x12, 0x24, 
-    0x00, 0x00, 0x00, 0x02, 0x21, 0x10, 0x00, 0x71, 0x11, 0x07, 0x11, 0x11, 0x20, 0x21, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0x20, 0x14, 
-    0x22, 0x20, 0x00, 0x10, 0x11, 0x11, 0x17, 0x75, 0x11, 0x71, 0x10, 0x00, 0x01, 0x12, 0x11, 0x11, 
-    0xB1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF2, 0x04, 0x88, 
-    0x88, 0x81, 0x22, 0x11, 0x10, 0x00, 0x17, 0x75, 0x11, 0x11, 0x10, 0x00, 0x00, 0x12, 0x00, 0x02, 
-    0x71, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x82, 0x24, 0x01, 0x12, 
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x61, 0x55, 0x01, 0x11, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0x82, 0x24, 0x22, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xB1, 0x17, 0x51, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0xB1, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x88, 0x40, 0x22, 0x40, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x65, 0x11, 0x11, 0x11, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x05, 0xBB, 0x00, 0x11, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF2, 0x02, 0x20, 0x00, 0x00, 
-    0x00, 0x04, 0x21, 0x11, 0x61, 0x01, 0x10, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x71, 0x6B, 0xB1, 0x01, 0x11, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x18, 0x18, 0x11, 0x66, 0x10, 0x00, 0x55, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x16, 0xB1, 0x01, 0x16, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2F, 0xF2, 0x20, 0x00, 0x00, 
-    0x00, 0x22, 0x22, 0x00, 0x16, 0x61, 0x10, 0x15, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0xBB, 0x00, 0x75, 0x0B, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x44, 0x40, 0x00, 0x00, 
-    0x04, 0x40, 0x00, 0x00, 0x51, 0x61, 0x10, 0x11, 0x01, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-    0x10, 0x51, 0xBB, 0x50, 0x10, 0x06, 0x57, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x24, 0x00, 0x04, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x51, 0x15, 0x00, 0x11, 0x71, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x01, 0x16, 0x10, 0x11, 0x01, 0x11, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x01, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x10, 0x16, 0x10, 0x71, 0x01, 0x15, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x0C, 0x51, 0x00, 0x00, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x20, 0x17, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x11, 0xB0, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6B, 0x61, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x16, 0x11, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x02, 0x01, 0x15, 0x60, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x88, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0xB1, 0x16, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x00, 0x00, 0x75, 0x17, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0xB6, 0xB6, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x11, 0x11, 0x60, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x51, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x60, 0x01, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 
-    0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1B, 0x61, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x84, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x00, 0x05, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x50, 0x01, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x11, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x22, 0x21, 0x11, 0x17, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0x11, 0x61, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x84, 0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x66, 0x51, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x20, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81, 0x82, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x51, 0x55, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x12, 0x21, 0x12, 0x88, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96, 0x66, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x71, 0x11, 0x91, 0x71, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x20, 0x02, 0x22, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x61, 
-    0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x16, 0x65, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x48, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x95, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x11, 0x1B, 0x17, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x11, 0x16, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x70, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x6B, 0x11, 0x11, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
-    0x16, 0x10, 0x00, 0x00, 0x00, 0x01, 0x15, 0x16, 0x1C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x71, 0x10, 0x00, 0x00, 0x00, 0x16, 0x61, 0x16, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x17, 0x00, 0x00, 0x01, 0x11, 0x16, 0x66, 0x17, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x07, 0x15, 0x70, 0x01, 0x11, 0x15, 0x11, 0x16, 0x10, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x1B, 0x66, 0x65, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x10, 0x00, 0x21, 0xB6, 0x6B, 0x65, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x20, 0x00, 0x01, 0x16, 0xBB, 0x61, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x21, 0x11, 0x19, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x22, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x00, 0x07, 0x16, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x82, 
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x00, 0x02, 0x87, 0x00, 0x00, 0x19, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x8F, 0x24, 
-    0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x12, 0x70, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2F, 0xF8, 0x24, 
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x22, 0x22, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x04, 0x44, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x24, 0x04, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x04, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t TOWER_WEREWOLF_RLE[TOWER_WEREWOLF_RLE_SIZE] = {
+    0xF0, 0xFF, 0xF0, 0xDE, 0x29, 0xCD, 0xC0, 0xDD, 0x00, 0xDD, 0x05, 0xDD, 0x33, 0x30, 0xCD, 0xD3, 
+    0xDC, 0x00, 0xDD, 0x3D, 0x3C, 0x0D, 0xD0, 0x0D, 0xD0, 0x0D, 0xA0, 0x08, 0xDD, 0x3D, 0x00, 0x0D, 
+    0xD0, 0xA0, 0x00, 0x90, 0xA3, 0x01, 0xA4, 0xF0, 0x15, 0x36, 0x93, 0xC0, 0x0A, 0x02, 0x0A, 0x09, 
+    0x3E, 0xCC, 0xC0, 0x13, 0xA1, 0x03, 0x02, 0x3A, 0xCC, 0xC1, 0x20, 0xA0, 0x13, 0xA0, 0x93, 0xE0, 
+    0x40, 0xAC, 0x93, 0xE0, 0x00, 0xA0, 0x44, 0x03, 0xEC, 0xCC, 0xF0, 0x17, 0x0B, 0x93, 0x00, 0x30, 
+    0x0A, 0x00, 0x93, 0xB0, 0x20, 0x13, 0xE0, 0x93, 0x01, 0x3A, 0x00, 0x17, 0x0C, 0x3E, 0x13, 0xE1, 
+    0x3E, 0x04, 0x0A, 0x00, 0x09, 0x30, 0x48, 0xF0, 0x1B, 0x00, 0x90, 0xC3, 0x43, 0x11, 0x33, 0x3C, 
+    0x09, 0x3A, 0x03, 0x92, 0x13, 0x3A, 0x39, 0xA0, 0xC3, 0x02, 0xE0, 0x20, 0x43, 0x02, 0x13, 0xE0, 
+    0x47, 0x02, 0x33, 0xA0, 0x68, 0x17, 0x29, 0x30, 0x00, 0x28, 0xB3, 0x08, 0x03, 0x11, 0x3A, 0x11, 
+    0x10, 0x72, 0x47, 0x00, 0x40, 0x43, 0x00, 0x90, 0x49, 0xF0, 0x1D, 0x12, 0x3C, 0x00, 0xA0, 0x00, 
+    0x93, 0x92, 0x1B, 0x89, 0x3E, 0x00, 0x46, 0x19, 0xCC, 0x12, 0x13, 0xA4, 0x13, 0xE0, 0x00, 0x40, 
+    0xA0, 0x13, 0xE0, 0x00, 0xAC, 0x68, 0x04, 0x93, 0x00, 0x30, 0x44, 0x09, 0x00, 0x3A, 0xF1, 0x3E, 
+    0x29, 0x42, 0xA3, 0x06, 0x91, 0x01, 0x0A, 0x20, 0x44, 0x0D, 0x04, 0x33, 0x3E, 0x00, 0x0A, 0x33, 
+    0x3E, 0x66, 0xF0, 0x02, 0x04, 0x22, 0x28, 0x80, 0xF2, 0x00, 0x01, 0x10, 0xA1, 0x01, 0x00, 0xB2, 
+    0x01, 0x12, 0xF0, 0x39, 0x07, 0x24, 0x42, 0x82, 0x24, 0xA2, 0x05, 0x00, 0x01, 0x75, 0x43, 0x05, 
+    0x01, 0x11, 0x02, 0xA1, 0xF0, 0x35, 0x0B, 0x41, 0x44, 0x2F, 0x44, 0x00, 0x01, 0xA0, 0x04, 0x11, 
+    0x50, 0x00, 0x44, 0x07, 0x22, 0x02, 0x11, 0x12, 0xF0, 0x35, 0x04, 0x41, 0x18, 0x10, 0xF0, 0x00, 
+    0x07, 0x11, 0xB1, 0x00, 0x01, 0x42, 0x09, 0x11, 0x00, 0x21, 0x18, 0x12, 0xF0, 0x32, 0x05, 0x42, 
+    0x12, 0x24, 0xD0, 0x0C, 0x22, 0x11, 0x00, 0x07, 0x11, 0x10, 0x70, 0xA1, 0x02, 0x20, 0x20, 0xC1, 
+    0xF0, 0x2F, 0x0E, 0x28, 0x82, 0x01, 0x42, 0x22, 0x00, 0x01, 0x00, 0xB1, 0x07, 0x77, 0x51, 0x17, 
+    0x11, 0xA0, 0x02, 0x11, 0x20, 0xA1, 0x02, 0xB1, 0x10, 0xF0, 0x2C, 0x05, 0x28, 0xF2, 0x04, 0xB8, 
+    0x08, 0x12, 0x21, 0x11, 0x00, 0x00, 0x44, 0x00, 0x10, 0x44, 0x0A, 0x01, 0x20, 0x00, 0x27, 0x11, 
+    0x20, 0xF0, 0x29, 0x08, 0x42, 0x82, 0x24, 0x01, 0x10, 0xB2, 0xE0, 0x04, 0x61, 0x55, 0x00, 0x46, 
+    0x00, 0x20, 0xD0, 0xB1, 0x00, 0x20, 0xF0, 0x25, 0x02, 0x28, 0x80, 0x42, 0x01, 0x22, 0xF0, 0x03, 
+    0x06, 0x70, 0xB1, 0x17, 0x50, 0x46, 0xD0, 0x02, 0x11, 0xB0, 0xB1, 0x00, 0x70, 0xF0, 0x22, 0x08, 
+    0x4F, 0x88, 0x40, 0x22, 0x40, 0xE0, 0xA1, 0x04, 0x00, 0x16, 0x50, 0xC1, 0x00, 0x50, 0xF0, 0x03, 
+    0x04, 0x5B, 0xB0, 0x00, 0xA1, 0x00, 0x20, 0xF0, 0x20, 0x06, 0x28, 0xF2, 0x02, 0x20, 0xE0, 0x0A, 
+    0x42, 0x11, 0x16, 0x10, 0x11, 0x00, 0xB1, 0xF0, 0x04, 0x06, 0x71, 0x6B, 0xB1, 0x00, 0xC1, 0x00, 
+    0x20, 0x65, 0x03, 0xFF, 0x82, 0x47, 0x0E, 0x18, 0x18, 0x11, 0x66, 0x10, 0x00, 0x55, 0x50, 0x4D, 
+    0x03, 0x01, 0x16, 0x43, 0x04, 0x61, 0x10, 0x10, 0x65, 0x03, 0x22, 0xFF, 0x47, 0xA2, 0x08, 0x00, 
+    0x16, 0x61, 0x10, 0x10, 0x42, 0x00, 0x10, 0xF0, 0x02, 0xB1, 0x0A, 0xBB, 0x00, 0x75, 0x0B, 0x10, 
+    0x10, 0x64, 0x05, 0x02, 0x24, 0x44, 0xC0, 0x01, 0x44, 0xB0, 0x01, 0x51, 0x43, 0x04, 0x10, 0x11, 
+    0x70, 0xF0, 0x02, 0x10, 0x71, 0x05, 0x1B, 0xB5, 0x01, 0x00, 0x65, 0x70, 0x10, 0xF0, 0x1B, 0x07, 
+    0x44, 0x24, 0x00, 0x04, 0xF0, 0x03, 0x0A, 0x51, 0x15, 0x00, 0x11, 0x71, 0x10, 0xF0, 0x04, 0x0A, 
+    0x11, 0x01, 0x16, 0x10, 0x11, 0x00, 0xA1, 0x01, 0x01, 0xF0, 0x1B, 0x00, 0x20, 0xF0, 0x09, 0x00, 
+    0xC0, 0xC0, 0x01, 0x15, 0x4D, 0x03, 0x01, 0x10, 0x42, 0x00, 0x70, 0x42, 0x04, 0x51, 0x11, 0x20, 
+    0xF0, 0x1A, 0x00, 0x40, 0xF0, 0x08, 0x02, 0xC5, 0x10, 0xB0, 0x02, 0x71, 0x10, 0xF0, 0x07, 0x03, 
+    0x20, 0x17, 0xA0, 0xF1, 0x00, 0x72, 0xF0, 0x1B, 0x00, 0x70, 0xA1, 0x04, 0xB0, 0x11, 0x20, 0xF0, 
+    0x16, 0x01, 0x22, 0xF0, 0x04, 0x00, 0xC0, 0xF0, 0x03, 0x00, 0x10, 0xF0, 0x13, 0x08, 0x70, 0x06, 
+    0xB6, 0x11, 0x10, 0xF0, 0x14, 0x01, 0x2F, 0x4C, 0xF0, 0x04, 0x00, 0x20, 0xF0, 0x11, 0x00, 0x10, 
+    0xA0, 0x04, 0x16, 0x11, 0x60, 0x5B, 0x02, 0x12, 0x80, 0x55, 0x00, 0x10, 0xF0, 0x15, 0x0C, 0x71, 
+    0x00, 0x20, 0x11, 0x56, 0x01, 0x10, 0xF0, 0x10, 0x03, 0xF8, 0x8F, 0xF0, 0x0E, 0x5D, 0xC0, 0x04, 
+    0x11, 0x16, 0x60, 0x58, 0x03, 0x28, 0x82, 0xF0, 0x0E, 0x01, 0x55, 0x65, 0x03, 0xB1, 0x16, 0x58, 
+    0x00, 0x20, 0xB0, 0x03, 0x75, 0x17, 0xF0, 0x07, 0x00, 0x10, 0xF0, 0x08, 0x02, 0x51, 0x10, 0xF0, 
+    0x06, 0x00, 0x70, 0x42, 0x03, 0x6B, 0x61, 0xF0, 0x0D, 0x02, 0x48, 0x10, 0xA0, 0xA1, 0x00, 0x60, 
+    0xF0, 0x17, 0x01, 0x11, 0x42, 0x00, 0x10, 0xF0, 0x06, 0x06, 0x11, 0x16, 0x00, 0x10, 0x55, 0x05, 
+    0x28, 0x20, 0x00, 0xB1, 0xF0, 0x06, 0x01, 0x75, 0xF0, 0x08, 0x05, 0x10, 0x01, 0x17, 0xF0, 0x05, 
+    0xB1, 0x03, 0xB6, 0x12, 0xF0, 0x0D, 0x04, 0x88, 0x40, 0x00, 0xB1, 0xF0, 0x03, 0x06, 0x50, 0x00, 
+    0x55, 0x10, 0xF0, 0x05, 0x02, 0x70, 0x50, 0x42, 0xF0, 0x05, 0x08, 0x21, 0x51, 0x16, 0x61, 0x10, 
+    0xF0, 0x0D, 0x04, 0xF8, 0x22, 0x20, 0xA1, 0x00, 0x70, 0xF0, 0x1E, 0x00, 0x10, 0xF0, 0x06, 0x06, 
+    0x55, 0x11, 0x16, 0x10, 0x55, 0x04, 0x18, 0x40, 0x40, 0xA1, 0xF0, 0x1F, 0x01, 0x77, 0xF0, 0x06, 
+    0x05, 0x11, 0x16, 0x65, 0x55, 0x07, 0x88, 0x20, 0x00, 0x12, 0xF0, 0x21, 0x02, 0x55, 0x10, 0x4F, 
+    0xC1, 0xF0, 0x0A, 0x07, 0x18, 0x18, 0x20, 0x02, 0xF0, 0x1C, 0x07, 0x70, 0x51, 0x55, 0x11, 0x4C, 
+    0x00, 0x70, 0xE1, 0xF0, 0x06, 0x07, 0x12, 0x21, 0x12, 0x88, 0x42, 0xF0, 0x20, 0x04, 0x19, 0x66, 
+    0x60, 0x4B, 0x00, 0x70, 0x42, 0x02, 0x91, 0x70, 0x4E, 0x09, 0x12, 0x00, 0x22, 0x21, 0x12, 0xF0, 
+    0x24, 0x05, 0x16, 0x61, 0x57, 0xF0, 0x02, 0xA1, 0x04, 0x66, 0x51, 0x10, 0xF0, 0x05, 0x01, 0x11, 
+    0xA0, 0x02, 0x48, 0xF0, 0xF0, 0x26, 0x03, 0x55, 0x95, 0xF0, 0x03, 0x00, 0x50, 0xA1, 0x03, 0xB1, 
+    0x75, 0xF0, 0x05, 0x01, 0x11, 0xC0, 0x01, 0x11, 0xF0, 0x13, 0x00, 0x20, 0xF0, 0x0A, 0x01, 0x51, 
+    0xF0, 0x04, 0x07, 0x16, 0x11, 0x16, 0x15, 0x4D, 0x00, 0x20, 0xD0, 0x00, 0x20, 0xF0, 0x14, 0x00, 
+    0x40, 0xF0, 0x05, 0x01, 0x55, 0xA0, 0x03, 0x70, 0x11, 0x49, 0x02, 0x16, 0xB0, 0xA1, 0x00, 0x70, 
+    0xF0, 0x2B, 0x00, 0x20, 0xF0, 0x06, 0x43, 0x04, 0x00, 0x16, 0x10, 0xE0, 0x08, 0x11, 0x51, 0x61, 
+    0xC1, 0x10, 0xF0, 0x2B, 0x02, 0x42, 0x40, 0xF0, 0x0C, 0x01, 0x71, 0x46, 0x07, 0x16, 0x61, 0x16, 
+    0x15, 0x72, 0x02, 0x44, 0x20, 0xF0, 0x10, 0x01, 0x17, 0xB0, 0xA1, 0x05, 0x66, 0x61, 0x71, 0xF0, 
+    0x2B, 0x02, 0x44, 0x40, 0xF0, 0x0E, 0x05, 0x71, 0x57, 0x00, 0xA1, 0x07, 0x51, 0x11, 0x61, 0x07, 
+    0xF0, 0x45, 0xE1, 0x07, 0xB6, 0x66, 0x51, 0x91, 0xF0, 0x47, 0x0E, 0x21, 0x00, 0x02, 0x1B, 0x66, 
+    0xB6, 0x51, 0x10, 0x6C, 0x02, 0x42, 0x40, 0xF0, 0x18, 0x00, 0x20, 0xA0, 0x08, 0x11, 0x6B, 0xB6, 
+    0x11, 0x10, 0xF0, 0x24, 0x02, 0x22, 0x20, 0xF0, 0x1D, 0x00, 0x20, 0xA1, 0x00, 0x90, 0xA1, 0xF0, 
+    0x22, 0x00, 0x40, 0xB2, 0xF0, 0x1C, 0x07, 0x11, 0x00, 0x07, 0x16, 0x6B, 0x06, 0x22, 0x18, 0x22, 
+    0x40, 0xF0, 0x16, 0x06, 0x40, 0x00, 0x28, 0x70, 0xA0, 0x03, 0x19, 0x69, 0xF0, 0x21, 0x08, 0x28, 
+    0x8F, 0x24, 0x22, 0x40, 0xF0, 0x18, 0x02, 0x12, 0x70, 0xD0, 0x01, 0x16, 0xF0, 0x20, 0x07, 0x42, 
+    0xFF, 0x82, 0x44, 0xF0, 0x1A, 0x00, 0x20, 0xF0, 0x01, 0x01, 0x15, 0xF0, 0x1E, 0x01, 0x44, 0xA2, 
+    0x00, 0x40, 0xF0, 0x28, 0x00, 0x10, 0xF0, 0x1E, 0x05, 0x22, 0x04, 0x44, 0xF0, 0x29, 0x65, 0x05, 
+    0x42, 0x40, 0x44, 0xF0, 0x50, 0x05, 0x44, 0x40, 0x04, 0xF0, 0x20, 0x00, 0x10, 0xF0, 0x11, 
+};
+
+const gfx_image_t TOWER_WEREWOLF_IMG = {
+    .w = TOWER_WEREWOLF_W, .h = TOWER_WEREWOLF_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = TOWER_WEREWOLF_PAL, .colors = TOWER_WEREWOLF_PAL_SIZE,
+    .data = TOWER_WEREWOLF_RLE, .size = TOWER_WEREWOLF_RLE_SIZE,
 };
@@ -12,6 +12,7 @@
 #include <stdio.h>
 #include "timer.h"     // millis()
 #include "gfx.h"       // gfx_clear, gfx_header, gfx_text2, gfx_bar
+#include "hud.h"       // hud_bar_t
 #include "project.h"   // colors
 
 // Geometry for the two winner bars
@@ -28,8 +29,14 @@ static float    g_p1_target_hz = 0.0f;
 static float    g_p2_target_hz = 0.0f;
 static uint8_t  g_p1_px        = 0;
 static uint8_t  g_p2_px        = 0;
+static hud_bar_t g_p1_bar;             // remembers the pixels already on screen
+static hud_bar_t g_p2_bar;
 static uint32_t g_t0_ms        = 0;
 
+// rank segment separators (percent of BW), drawn on top of the bars
+static const uint8_t k_cuts[] = {25,45,65,80,90,95,97,99};
+#define N_CUTS ((uint8_t)(sizeof(k_cuts)/sizeof(k_cuts[0])))
+
 static float clampf(float v, float lo, float hi){
     if (v < lo) return lo;
     if (v > hi) return hi;
@@ -51,9 +58,11 @@ void winner2_start(float p1_avg_hz, float p2_avg_hz)
     gfx_header("RESULTS", COL_RED);
     gfx_bar(0, 18, 128, 1, COL_DKGRAY);   // separator under header
 
-    // initial gray backgrounds for both bars
-    gfx_bar(BX, BY1, BW, BH, COL_GRAY);
-    gfx_bar(BX, BY2, BW, BH, COL_GRAY);
+    // initial gray backgrounds for both bars, with the rank separators
+    hud_bar_init(&g_p1_bar, BX, BY1, BW, BH, 250.0f, COL_BLUE, COL_GRAY);
+    hud_bar_init(&g_p2_bar, BX, BY2, BW, BH, 250.0f, COL_RED,  COL_GRAY);
+    hud_bar_cuts(&g_p1_bar, k_cuts, N_CUTS, COL_WHITE);
+    hud_bar_cuts(&g_p2_bar, k_cuts, N_CUTS, COL_WHITE);
 
     // numeric labels above bars
     char p1txt[24], p2txt[24];
@@ -80,27 +89,11 @@ bool winner2_tick(void)
     uint8_t w1 = (ramp_px < g_p1_px) ? ramp_px : g_p1_px;
     uint8_t w2 = (ramp_px < g_p2_px) ? ramp_px : g_p2_px;
 
-    /* ---- DYNAMIC PART: ONLY BAR ROWS ARE TOUCHED ---- */
-
-    // clear bar rows back to gray
-    gfx_bar(BX, BY1, BW, BH, COL_GRAY);
-    gfx_bar(BX, BY2, BW, BH, COL_GRAY);
-
-    // foreground bars: P1 = BLUE, P2 = RED
-    if (w1 > 0u) {
-        gfx_bar(BX, BY1, w1, BH, COL_BLUE);
-    }
-    if (w2 > 0u) {
-        gfx_bar(BX, BY2, w2, BH, COL_RED);
-    }
-
-    // rank segment separators drawn on top of bars (still only in bar region)
-    static const uint8_t cuts[] = {25,45,65,80,90,95,97,99};
-    for (unsigned i = 0; i < sizeof(cuts)/sizeof(cuts[0]); ++i){
-        uint8_t x = (uint8_t)(BX + (cuts[i] * BW) / 100u);
-        gfx_bar(x, BY1, 1, BH, COL_WHITE);
-        gfx_bar(x, BY2, 1, BH, COL_WHITE);
-    }
+    /* ---- DYNAMIC PART: ONLY NEWLY FILLED COLUMNS ARE TOUCHED ---- */
+
+    // P1 = BLUE, P2 = RED; nothing is sent once both bars reach target
+    hud_bar_set_px(&g_p1_bar, w1);
+    hud_bar_set_px(&g_p2_bar, w2);
 
     // game_two.c decides when to leave this screen
     return (dt >= SCREEN_HOLD_MS);
@@ -6,469 +6,95 @@ const uint16_t YOU_WIN_P1_PIC_PAL[YOU_WIN_P1_PIC_PAL_SIZE] = {
     0x73DA, 0xE9C8, 0x910A, 0x5192, 0xA844, 0x81D0, 0xD599, 0x83B8, 
 };
 
-const uint8_t YOU_WIN_P1_PIC_IDX[(YOU_WIN_P1_PIC_W * YOU_WIN_P1_PIC_H) / 2] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x31, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x41, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x43, 0x33, 0x33, 0x34, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x13, 0x00, 
-    0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x14, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x14, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x13, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x41, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xC3, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x14, 0x44, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x00, 0x04, 0x11, 0x11, 0x00, 0x00, 
-    0x03, 0x11, 0x11, 0x11, 0x13, 0x40, 0x00, 0x03, 0x11, 0x13, 0x00, 0x03, 0x11, 0x13, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x01, 0x11, 0x14, 0x00, 0x41, 
-    0x11, 0x10, 0x00, 0x41, 0x11, 0x30, 0x41, 0x11, 0x34, 0x00, 0x00, 0x31, 0x11, 0x30, 0x00, 0x00, 
-    0x00, 0x04, 0x11, 0x11, 0x57, 0x04, 0x11, 0x11, 0x57, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x1E, 
-    0x00, 0x03, 0x11, 0x13, 0x20, 0x03, 0x11, 0x13, 0x20, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x1A, 
-    0x01, 0x11, 0x11, 0x16, 0x70, 0x01, 0x11, 0x16, 0x70, 0x41, 0x11, 0x15, 0x70, 0x41, 0x11, 0x93, 
-    0x11, 0x11, 0x11, 0xE0, 0x00, 0x31, 0x11, 0x32, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 
-    0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x50, 0x03, 0x11, 0x13, 0x27, 0x03, 
-    0x11, 0x13, 0x25, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x1D, 0xBC, 0x11, 0x11, 0x16, 0x27, 0x01, 
-    0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x00, 0x31, 
-    0x11, 0x32, 0x70, 0x00, 0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x19, 0x27, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 
-    0x20, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x70, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 
-    0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0xFF, 0x83, 0x11, 0x11, 0x25, 0x03, 
-    0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 
-    0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x1F, 0xF8, 0x31, 
-    0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 
-    0x82, 0x04, 0x11, 0x19, 0x22, 0x70, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 
-    0x25, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 
-    0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x27, 0x01, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 
-    0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 
-    0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x00, 0x41, 0x11, 0x11, 
-    0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 
-    0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 
-    0x82, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 
-    0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 
-    0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 
-    0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0x82, 0x04, 
-    0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 
-    0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 
-    0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 
-    0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x1D, 
-    0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 
-    0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x22, 0x43, 
-    0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 
-    0x11, 0x13, 0x25, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 
-    0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 
-    0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x63, 0x11, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 
-    0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x01, 0x11, 
-    0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 
-    0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 
-    0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x1D, 0xBA, 0x11, 
-    0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 
-    0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 
-    0x25, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x16, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 
-    0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 
-    0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 
-    0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x16, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 
-    0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 
-    0x11, 0x66, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 
-    0x25, 0x03, 0x11, 0x13, 0x25, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0xBA, 0x11, 0x11, 0x1A, 
-    0x87, 0x01, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 
-    0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 0x38, 0x26, 0x11, 0x11, 0x82, 0x04, 
-    0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x04, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x0C, 0x11, 0x11, 0x1A, 0xB6, 0x01, 0x11, 0x16, 0x27, 0x41, 
-    0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 
-    0x00, 0x04, 0x11, 0x38, 0x22, 0x54, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 
-    0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 
-    0x2A, 0x11, 0x11, 0x1A, 0xBC, 0x11, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 
-    0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x04, 0x35, 0x22, 0x57, 0x74, 
-    0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 
-    0x11, 0x13, 0x25, 0x01, 0x11, 0x11, 0x11, 0x33, 0x11, 0x16, 0x26, 0x11, 0x11, 0x1A, 0xBA, 0x11, 
-    0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 
-    0x11, 0x32, 0x50, 0x00, 0x00, 0x00, 0x07, 0x57, 0x70, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 
-    0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x27, 0x01, 0x11, 0x11, 
-    0x11, 0x41, 0x11, 0x16, 0x27, 0x31, 0x11, 0x1A, 0xBA, 0x11, 0x11, 0x16, 0x27, 0x41, 0x11, 0x18, 
-    0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 
-    0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x27, 0x41, 0x11, 0x11, 0x11, 0x01, 0x11, 0x16, 0x27, 0x01, 
-    0x11, 0x1A, 0xBA, 0x11, 0x11, 0x1A, 0x87, 0xE1, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 
-    0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x04, 0x11, 0x11, 
-    0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 
-    0x27, 0x01, 0x11, 0x11, 0x13, 0x01, 0x11, 0x16, 0x27, 0x01, 0x11, 0x1A, 0xBA, 0x11, 0x11, 0x1A, 
-    0xB0, 0x01, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x43, 0x33, 0x62, 
-    0x50, 0x00, 0x00, 0x00, 0x43, 0x11, 0x57, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 
-    0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 0x25, 0x03, 0x11, 0x13, 0x27, 0x01, 0x11, 0x11, 0x14, 0x01, 
-    0x11, 0x16, 0x27, 0x01, 0x11, 0x1A, 0xBA, 0x11, 0x11, 0x1A, 0xBA, 0x11, 0x11, 0x18, 0x20, 0x41, 
-    0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x00, 0x72, 0x22, 0x50, 0x00, 0x00, 0x04, 0x11, 0x11, 
-    0x55, 0x04, 0x11, 0x11, 0x82, 0x04, 0x11, 0x19, 0x25, 0x04, 0x11, 0x11, 0x25, 0x03, 0x11, 0x13, 
-    0x25, 0x03, 0x11, 0x13, 0x25, 0xA1, 0x11, 0x11, 0x14, 0x01, 0x11, 0x16, 0x27, 0x01, 0x11, 0x16, 
-    0xBA, 0x11, 0x11, 0x1A, 0xBA, 0x11, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 
-    0x50, 0x00, 0x0E, 0xE0, 0x70, 0x00, 0x00, 0x04, 0x11, 0x11, 0x99, 0x31, 0x11, 0x11, 0x82, 0x04, 
-    0x11, 0x11, 0x99, 0x31, 0x11, 0x11, 0x25, 0x03, 0x11, 0x11, 0x93, 0x31, 0x11, 0x13, 0x25, 0xC1, 
-    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x93, 0x31, 0x11, 0x11, 0x91, 0x11, 0x11, 0x1A, 0xBA, 0x11, 
-    0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 
-    0x25, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x25, 0xC1, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1B, 0xBA, 0x11, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 
-    0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x25, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x16, 0x25, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x1F, 0x25, 0xC1, 0x11, 0x11, 0x90, 0x04, 0x11, 0x11, 0x11, 0x11, 0x93, 0x11, 0x11, 0x11, 
-    0x11, 0x9B, 0xBA, 0x11, 0x11, 0x18, 0x20, 0x41, 0x11, 0x92, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 
-    0x11, 0x32, 0x50, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x32, 0x27, 0x00, 0x03, 0x11, 
-    0x11, 0x11, 0x11, 0x62, 0x27, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x62, 0x56, 0xC1, 0x11, 0x11, 
-    0x30, 0x00, 0x31, 0x11, 0x11, 0x19, 0x22, 0x31, 0x11, 0x11, 0x13, 0xB0, 0xAA, 0x11, 0x11, 0x18, 
-    0x20, 0x41, 0x11, 0x12, 0x50, 0x41, 0x11, 0x12, 0x50, 0x31, 0x11, 0x32, 0x50, 0x00, 0x00, 0x00, 
-    0x00, 0xE6, 0x66, 0x66, 0x68, 0x22, 0x57, 0x00, 0x00, 0xE6, 0x66, 0x66, 0x68, 0x22, 0x77, 0x00, 
-    0x00, 0x06, 0x66, 0x66, 0x62, 0x22, 0x5A, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x66, 0x66, 0xF2, 
-    0x25, 0x75, 0x66, 0x66, 0xF2, 0x20, 0xAC, 0x11, 0xA6, 0x62, 0x20, 0x04, 0x66, 0x62, 0x50, 0x04, 
-    0x66, 0x62, 0x50, 0x04, 0x66, 0xF2, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x55, 0x55, 0x57, 
-    0x70, 0x00, 0x00, 0x07, 0x55, 0x55, 0x55, 0x57, 0x70, 0x00, 0x00, 0x07, 0x55, 0x55, 0x55, 0x70, 
-    0xAC, 0x11, 0x11, 0x11, 0x19, 0x00, 0x00, 0x07, 0x55, 0x55, 0x57, 0x00, 0x07, 0x55, 0x55, 0x77, 
-    0xE3, 0x33, 0xE7, 0x25, 0x57, 0x00, 0x07, 0x55, 0x50, 0x00, 0x07, 0x55, 0x50, 0x00, 0x75, 0x55, 
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 
-    0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x03, 0x11, 
-    0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 
-    0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 
-    0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 
-    0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x03, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-    0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x14, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x31, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 0x13, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x11, 
-    0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-    0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x11, 0x11, 
-    0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 
-    0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x04, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x10, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 
-    0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x31, 0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
-    0x11, 0x11, 0x11, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x01, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x44, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x11, 0x11, 0x40, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 
-    0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 
-    0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x14, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x11, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+const uint8_t YOU_WIN_P1_PIC_RLE[YOU_WIN_P1_PIC_RLE_SIZE] = {
+    0xF0, 0xA8, 0x04, 0x31, 0x11, 0x40, 0xF0, 0x65, 0x00, 0x30, 0xB1, 0xF0, 0x64, 0x00, 0x40, 0xC1, 
+    0xF0, 0x64, 0xD1, 0x00, 0x30, 0xF0, 0x62, 0xE1, 0x00, 0x40, 0xF0, 0x62, 0xE1, 0xF0, 0x62, 0xE1, 
+    0x00, 0x40, 0xF0, 0x61, 0x00, 0x30, 0xD1, 0x00, 0x30, 0xF0, 0x61, 0x00, 0x40, 0xE1, 0xF0, 0x62, 
+    0xE1, 0x00, 0x40, 0xF0, 0x61, 0x00, 0x40, 0xE1, 0xF0, 0x62, 0xE1, 0x00, 0x40, 0xF0, 0x61, 0x00, 
+    0x40, 0xD1, 0x00, 0x30, 0xF0, 0x62, 0xE1, 0xF0, 0x62, 0x00, 0x40, 0xD1, 0x00, 0x30, 0xF0, 0x62, 
+    0xE1, 0xF0, 0x62, 0x00, 0x40, 0xD1, 0x00, 0x40, 0xF0, 0x62, 0x00, 0x30, 0xD1, 0xF0, 0x63, 0xD1, 
+    0x00, 0x40, 0xF0, 0x62, 0x00, 0x40, 0xD1, 0xE0, 0x00, 0x40, 0xC3, 0x00, 0x40, 0xF0, 0x53, 0x00, 
+    0x30, 0xC1, 0x00, 0x30, 0xC0, 0x00, 0x30, 0xF1, 0x01, 0x00, 0x30, 0xF0, 0x51, 0xD1, 0x00, 0x40, 
+    0xA0, 0x00, 0x40, 0xF1, 0x05, 0x00, 0x40, 0xF0, 0x4F, 0x49, 0x00, 0x40, 0xF1, 0x07, 0x00, 0x40, 
+    0xF0, 0x4E, 0xD1, 0x03, 0x00, 0x04, 0xF1, 0x09, 0x00, 0x40, 0xF0, 0x4D, 0x48, 0xF1, 0x0B, 0xF0, 
+    0x4D, 0xD1, 0x02, 0x40, 0x30, 0xF1, 0x0B, 0x00, 0x30, 0xF0, 0x4C, 0x00, 0x30, 0xC1, 0x01, 0x30, 
+    0xF1, 0x0D, 0xF0, 0x4C, 0x00, 0x40, 0xD1, 0x00, 0x30, 0xF1, 0x0D, 0x00, 0x30, 0xF0, 0x4C, 0xF1, 
+    0x16, 0xF0, 0x4C, 0x7F, 0xF0, 0x2A, 0x00, 0x40, 0x7F, 0xF0, 0x2A, 0x7F, 0xF0, 0x2A, 0x00, 0x40, 
+    0x7F, 0xF0, 0x2A, 0x7F, 0xF0, 0x2B, 0xF1, 0x12, 0x00, 0x30, 0xF0, 0x4F, 0x00, 0x30, 0xF1, 0x11, 
+    0x00, 0x40, 0xF0, 0x50, 0xF1, 0x11, 0xF0, 0x52, 0xF1, 0x0F, 0x00, 0x40, 0xF0, 0x52, 0x00, 0x40, 
+    0xF1, 0x0C, 0x01, 0xC3, 0xF0, 0x54, 0x00, 0x30, 0xF1, 0x0C, 0xF0, 0x56, 0xF1, 0x0B, 0xF0, 0x57, 
+    0x00, 0x40, 0xF1, 0x08, 0x00, 0x30, 0xF0, 0x59, 0xF1, 0x06, 0x00, 0x30, 0xF0, 0x5A, 0x00, 0x30, 
+    0xF1, 0x01, 0x02, 0x44, 0x40, 0xF0, 0x5D, 0xF1, 0x02, 0xF0, 0x60, 0xF1, 0x02, 0x00, 0x40, 0xF0, 
+    0x28, 0x00, 0x40, 0xA1, 0x03, 0x00, 0x04, 0xA1, 0xB0, 0x00, 0x30, 0xD1, 0x01, 0x34, 0xA0, 0x0C, 
+    0x31, 0x11, 0x30, 0x00, 0x31, 0x11, 0x30, 0xF0, 0x00, 0xF1, 0x05, 0x03, 0x40, 0x00, 0xA1, 0x03, 
+    0x40, 0x04, 0xA1, 0x0E, 0x00, 0x04, 0x11, 0x13, 0x04, 0x11, 0x13, 0x40, 0xA0, 0x04, 0x31, 0x11, 
+    0x30, 0x4B, 0x01, 0x57, 0x44, 0x04, 0x57, 0x00, 0x30, 0xF1, 0x01, 0x00, 0xE0, 0x46, 0x00, 0x20, 
+    0x45, 0x00, 0x20, 0xD0, 0x00, 0x40, 0xC1, 0x01, 0xA0, 0xC1, 0x01, 0x67, 0x44, 0x01, 0x67, 0x44, 
+    0x01, 0x57, 0x43, 0x01, 0x93, 0xC1, 0x00, 0xE0, 0x46, 0x00, 0x20, 0x4A, 0x01, 0x82, 0x44, 0x03, 
+    0x82, 0x04, 0xF1, 0x02, 0x01, 0x95, 0x46, 0x00, 0x70, 0x45, 0x00, 0x50, 0xC0, 0x00, 0x30, 0xC1, 
+    0x02, 0xDB, 0xC0, 0x44, 0x01, 0x27, 0x44, 0x01, 0x27, 0x43, 0x01, 0x82, 0x43, 0xE1, 0x01, 0x95, 
+    0x46, 0x00, 0x70, 0x61, 0x01, 0x27, 0x45, 0x00, 0x50, 0x4C, 0xD1, 0x02, 0xDB, 0xA0, 0x62, 0x02, 
+    0x12, 0x70, 0x45, 0x00, 0x50, 0x59, 0x03, 0xFF, 0x83, 0xA1, 0x01, 0x25, 0x53, 0x00, 0x30, 0x65, 
+    0x03, 0xFF, 0x83, 0x43, 0x00, 0x50, 0x60, 0x04, 0x92, 0x27, 0x00, 0x59, 0xE1, 0x5D, 0x04, 0x92, 
+    0x27, 0x00, 0x68, 0x02, 0x50, 0x40, 0x58, 0x00, 0x40, 0x67, 0x02, 0x50, 0x40, 0x7F, 0x44, 0x00, 
+    0x30, 0x7F, 0x70, 0xF1, 0x00, 0x7F, 0x67, 0x00, 0x40, 0x7F, 0x43, 0x03, 0x22, 0x43, 0x67, 0x00, 
+    0x30, 0x7F, 0x43, 0x01, 0x63, 0xC1, 0x63, 0xF1, 0x01, 0x7B, 0xE1, 0x62, 0x00, 0x40, 0x7F, 0x70, 
+    0x00, 0x30, 0xF1, 0x01, 0x00, 0x60, 0x7F, 0x65, 0xF1, 0x02, 0x7D, 0x01, 0x66, 0x79, 0x01, 0xA8, 
+    0x71, 0x02, 0x38, 0x20, 0x66, 0x00, 0x40, 0x4A, 0x01, 0x0C, 0x44, 0x01, 0xB6, 0x6E, 0x05, 0x38, 
+    0x22, 0x54, 0x65, 0x00, 0x30, 0x4A, 0x01, 0x2A, 0x45, 0x00, 0xC0, 0xB1, 0x67, 0x06, 0x35, 0x22, 
+    0x57, 0x70, 0x66, 0xD1, 0x01, 0x33, 0x43, 0x00, 0x60, 0x45, 0x00, 0xA0, 0x6B, 0x07, 0x00, 0x75, 
+    0x77, 0x00, 0x64, 0x00, 0x70, 0x46, 0x00, 0x40, 0xA1, 0x03, 0x62, 0x73, 0x74, 0xC0, 0x65, 0x00, 
+    0x40, 0xD1, 0x00, 0x00, 0x45, 0x00, 0x00, 0x4A, 0x03, 0xA8, 0x7E, 0x65, 0x01, 0x43, 0x68, 0x00, 
+    0x00, 0xC1, 0x00, 0x30, 0x54, 0x02, 0xB0, 0x00, 0x55, 0x04, 0x43, 0x33, 0x60, 0x47, 0x05, 0x43, 
+    0x11, 0x57, 0x6D, 0x00, 0x40, 0x55, 0x00, 0xA0, 0xB1, 0x51, 0x04, 0x00, 0x72, 0x20, 0x46, 0x00, 
+    0x40, 0xA1, 0x01, 0x55, 0x65, 0x01, 0x5A, 0x52, 0x00, 0x60, 0x62, 0x04, 0x0E, 0xE0, 0x70, 0x49, 
+    0x02, 0x99, 0x30, 0xB1, 0x45, 0x03, 0x19, 0x93, 0xB1, 0x45, 0x03, 0x19, 0x33, 0xA1, 0x03, 0x32, 
+    0x5C, 0xC1, 0x00, 0x00, 0x43, 0x03, 0x19, 0x33, 0xB1, 0x00, 0x90, 0xC1, 0x59, 0x04, 0x31, 0x11, 
+    0x30, 0xF0, 0x00, 0xF1, 0x03, 0x00, 0x20, 0x45, 0xD1, 0x04, 0x32, 0x50, 0x40, 0xF1, 0x02, 0x4F, 
+    0xF1, 0x06, 0x00, 0xB0, 0x5D, 0x00, 0x20, 0xE0, 0x00, 0x30, 0xF1, 0x01, 0x05, 0x02, 0x50, 0x03, 
+    0xF1, 0x01, 0x04, 0x62, 0x50, 0x00, 0xF1, 0x02, 0x00, 0xF0, 0x46, 0x03, 0x90, 0x04, 0xE1, 0x01, 
+    0x93, 0xE1, 0x00, 0x90, 0x5F, 0x00, 0x50, 0xE0, 0x00, 0x30, 0xE1, 0x07, 0x32, 0x27, 0x00, 0x03, 
+    0xE1, 0x06, 0x62, 0x27, 0x00, 0x40, 0xF1, 0x00, 0x03, 0x62, 0x56, 0x44, 0x04, 0x30, 0x00, 0x30, 
+    0xC1, 0x03, 0x92, 0x23, 0xC1, 0x03, 0x3B, 0x0A, 0x4B, 0x00, 0x10, 0x58, 0x01, 0x0E, 0xC6, 0x03, 
+    0x82, 0x25, 0x42, 0x01, 0x0E, 0xC6, 0x04, 0x82, 0x27, 0x70, 0xB0, 0xC6, 0x04, 0x22, 0x25, 0xA0, 
+    0xD1, 0xB0, 0xA6, 0x05, 0xF2, 0x25, 0x75, 0xA6, 0x24, 0xF2, 0x20, 0xAC, 0x11, 0xA6, 0x62, 0x20, 
+    0x04, 0x66, 0x62, 0x50, 0x04, 0x66, 0x62, 0x50, 0x04, 0x66, 0xF2, 0x70, 0xF0, 0x02, 0x00, 0x70, 
+    0xC5, 0x01, 0x77, 0xC0, 0x00, 0x70, 0xD5, 0x01, 0x77, 0xC0, 0x00, 0x70, 0xC5, 0x03, 0x70, 0xAC, 
+    0xD1, 0x00, 0x90, 0xB0, 0x00, 0x70, 0xB5, 0x04, 0x70, 0x00, 0x70, 0xA5, 0x12, 0x77, 0xE3, 0x33, 
+    0xE7, 0x25, 0x57, 0x00, 0x07, 0x55, 0x50, 0xA0, 0x0A, 0x75, 0x55, 0x00, 0x07, 0x55, 0x50, 0x4A, 
+    0xF0, 0x1D, 0x01, 0x3C, 0xF1, 0x01, 0x00, 0x30, 0xF0, 0x5D, 0xF1, 0x05, 0x00, 0x40, 0xF0, 0x5A, 
+    0x00, 0x40, 0xF1, 0x07, 0x00, 0xE0, 0xF0, 0x58, 0x00, 0x30, 0xF1, 0x09, 0xF0, 0x57, 0x00, 0x90, 
+    0xF1, 0x01, 0x00, 0x30, 0xE1, 0x00, 0x30, 0xF0, 0x55, 0xF1, 0x02, 0x02, 0x40, 0x30, 0xE1, 0x00, 
+    0x30, 0xF0, 0x52, 0x00, 0x40, 0xF1, 0x02, 0x03, 0x40, 0x00, 0xF1, 0x00, 0x00, 0x40, 0xF0, 0x50, 
+    0x00, 0x30, 0xF1, 0x02, 0xC0, 0xF1, 0x00, 0xF0, 0x4F, 0x00, 0x30, 0xF1, 0x01, 0x00, 0x30, 0xD0, 
+    0x00, 0x40, 0xE1, 0x00, 0x30, 0xF0, 0x4D, 0x00, 0x30, 0xF1, 0x01, 0x00, 0x30, 0xF0, 0x00, 0x00, 
+    0x30, 0xE1, 0x00, 0x40, 0xF0, 0x4B, 0x00, 0x30, 0xF1, 0x01, 0x00, 0x40, 0xF0, 0x02, 0xF1, 0x00, 
+    0x00, 0x40, 0xF0, 0x49, 0x00, 0x30, 0xF1, 0x01, 0xF0, 0x05, 0xF1, 0x00, 0xF0, 0x49, 0xF1, 0x00, 
+    0x00, 0x30, 0xF0, 0x06, 0x00, 0x40, 0xE1, 0x00, 0x30, 0xF0, 0x47, 0x00, 0x30, 0xE1, 0x00, 0x30, 
+    0xF0, 0x08, 0x00, 0x30, 0xE1, 0x00, 0x40, 0xF0, 0x46, 0xE1, 0x00, 0x40, 0xF0, 0x0A, 0xF1, 0x00, 
+    0xF0, 0x45, 0x00, 0x30, 0xD1, 0x00, 0x30, 0xF0, 0x0C, 0xF1, 0x00, 0xF0, 0x44, 0x46, 0xF0, 0x0D, 
+    0x00, 0x40, 0xE1, 0x00, 0x30, 0xF0, 0x43, 0xD1, 0x00, 0x30, 0xF0, 0x0E, 0x00, 0x30, 0xE1, 0x00, 
+    0x40, 0xF0, 0x42, 0xD1, 0x00, 0x40, 0xF0, 0x0F, 0xF1, 0x00, 0xF0, 0x42, 0xD1, 0xF0, 0x11, 0xE1, 
+    0x00, 0x30, 0xF0, 0x40, 0x00, 0x40, 0x5F, 0x00, 0x40, 0xE1, 0x00, 0x40, 0xF0, 0x3F, 0x60, 0x01, 
+    0x03, 0xE1, 0xF0, 0x3F, 0x00, 0x30, 0x60, 0x00, 0x00, 0xF1, 0x00, 0xF0, 0x3E, 0x45, 0x00, 0x30, 
+    0xF0, 0x13, 0x00, 0x40, 0xE1, 0x00, 0x30, 0xF0, 0x3D, 0x62, 0x01, 0x03, 0xE1, 0x00, 0x40, 0xF0, 
+    0x3C, 0x63, 0x01, 0x09, 0xE1, 0xF0, 0x3C, 0xD1, 0x5D, 0x00, 0x00, 0xF1, 0x00, 0xF0, 0x3B, 0xD1, 
+    0x00, 0x40, 0xF0, 0x16, 0x00, 0x40, 0xE1, 0x00, 0x30, 0xF0, 0x3A, 0x65, 0x01, 0x03, 0xE1, 0x00, 
+    0x40, 0xF0, 0x39, 0x66, 0x00, 0x00, 0xF1, 0x00, 0xF0, 0x39, 0x67, 0x00, 0x00, 0xF1, 0x00, 0xF0, 
+    0x38, 0xD1, 0xF0, 0x1A, 0x00, 0x40, 0xE1, 0x00, 0x30, 0xF0, 0x36, 0x00, 0x40, 0x68, 0x02, 0x03, 
+    0xC0, 0xD1, 0x00, 0x40, 0x7F, 0x67, 0x00, 0x00, 0xF1, 0x00, 0x7F, 0x68, 0x00, 0x00, 0xF1, 0x00, 
+    0xF0, 0x34, 0x00, 0x30, 0xC1, 0x00, 0x30, 0xF0, 0x1D, 0x00, 0x40, 0xE1, 0x00, 0x30, 0x7F, 0x67, 
+    0x01, 0x03, 0xE1, 0x00, 0x40, 0x7F, 0x67, 0x00, 0x00, 0xF1, 0x00, 0x7F, 0x68, 0x00, 0x40, 0xE1, 
+    0x00, 0x30, 0xF0, 0x31, 0xD1, 0x00, 0x40, 0xF0, 0x20, 0x00, 0x30, 0xE1, 0x00, 0x40, 0x7F, 0xF0, 
+    0x21, 0xF1, 0x00, 0x02, 0x44, 0x40, 0xF0, 0x2C, 0x00, 0x40, 0x70, 0x00, 0x00, 0xF1, 0x02, 0xF0, 
+    0x2B, 0x00, 0x40, 0xE1, 0x6A, 0x00, 0x40, 0xF1, 0x00, 0x00, 0x30, 0xF0, 0x2B, 0xF1, 0x00, 0x6A, 
+    0x01, 0x03, 0x7F, 0xB1, 0xF0, 0x25, 0x7F, 0x71, 0x00, 0x00, 0xD1, 0x00, 0x40, 0xF0, 0x2C, 0xD1, 
+    0x00, 0x40, 0xF0, 0x27, 0x7A, 0x00, 0x40, 0xA1, 0x01, 0x94, 0xF0, 0x29, 0xB1, 0x00, 0x30, 0xF0, 
+    0x66, 0x04, 0x41, 0x11, 0x40, 0xF0, 0xF8, 
+};
+
+const gfx_image_t YOU_WIN_P1_PIC_IMG = {
+    .w = YOU_WIN_P1_PIC_W, .h = YOU_WIN_P1_PIC_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = YOU_WIN_P1_PIC_PAL, .colors = YOU_WIN_P1_PIC_PAL_SIZE,
+    .data = YOU_WIN_P1_PIC_RLE, .size = YOU_WIN_P1_PIC_RLE_SIZE,
 };
@@ -6,481 +6,130 @@ const uint16_t YOU_WIN_P2_PIC_PAL[YOU_WIN_P2_PIC_PAL_SIZE] = {
     0xFFFF, 0x365F, 0x369F, 0xD79F, 0x54BF, 0x6EDF, 0xAF5F, 0x95BF, 
 };
 
-const uint8_t YOU_WIN_P2_PIC_IDX[(YOU_WIN_P2_PIC_W * YOU_WIN_P2_PIC_H) / 2] = {
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xBE, 0xD2, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x80, 0xD9, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xED, 0x99, 0x99, 0x99, 0x99, 
-    0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x49, 0x99, 0x99, 0x99, 0x99, 0x94, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x0D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x24, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x94, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE8, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0xBD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE4, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB2, 0x22, 0x22, 
-    0x2E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xB8, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB2, 0x49, 0x99, 0x99, 0x99, 0x94, 0xDB, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD0, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x9D, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x49, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD0, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE8, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4B, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x01, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 
-    0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x94, 
-    0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDB, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x9E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x94, 0xDB, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 
-    0x99, 0x9D, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x42, 0x08, 
-    0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x31, 0x42, 0xE8, 0x88, 0x88, 0x8D, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x49, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4D, 0xEB, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xE2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x9A, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x04, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x90, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x8E, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xED, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xD4, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0xD4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xBE, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xB2, 0xD4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x2E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 
-    0xD4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x94, 0xDE, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x24, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x42, 0xB8, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x42, 0xE8, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xEB, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 
-    0x99, 0x99, 0x99, 0x99, 0x9E, 0xED, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x20, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x9D, 
-    0x88, 0x88, 0xE2, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x94, 0x2E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x8B, 0x8B, 0x88, 0x88, 0x8B, 0x8B, 0x88, 0x88, 0x88, 0x88, 0xBB, 0xBB, 0xB8, 0x88, 0x88, 0x88, 
-    0x8B, 0x8B, 0x88, 0x88, 0x8B, 0xBB, 0x29, 0x99, 0x99, 0x99, 0x99, 0xE8, 0xBB, 0x88, 0x88, 0xBE, 
-    0xD4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 
-    0xDE, 0x88, 0x88, 0x88, 0xB8, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0xB8, 0x8E, 
-    0x99, 0x99, 0x08, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x94, 0x08, 0x88, 0x8D, 0x99, 0x9D, 0x88, 0x8D, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x48, 0xB9, 0x99, 0x9E, 0x88, 0x89, 0x99, 0x94, 0x49, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x2B, 0x88, 0xD9, 
-    0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x91, 0x08, 0xE9, 0x99, 0x91, 0x08, 0x84, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x49, 0x99, 0x45, 0x88, 0x49, 0x99, 0x33, 0x99, 0x99, 
-    0x99, 0x92, 0x8B, 0x99, 0x99, 0x12, 0x8B, 0x99, 0x99, 0x1F, 0xBE, 0x99, 0x9A, 0x33, 0x99, 0x99, 
-    0x99, 0x33, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x92, 0x8D, 0x99, 0x94, 0x10, 0x88, 0x88, 
-    0x88, 0x88, 0x8E, 0x99, 0x99, 0xCF, 0x0E, 0x99, 0x99, 0xC5, 0x0E, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xA3, 0xF8, 0x84, 0x99, 0xA3, 0x12, 0x0D, 0x99, 0xA3, 0x63, 0x39, 0x99, 0x99, 0xB8, 0xB9, 0x99, 
-    0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x10, 0x89, 0x99, 0xA3, 0x33, 0x99, 0x99, 0x93, 0x33, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x9A, 0x33, 0x94, 0x49, 0x99, 0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 
-    0x9C, 0xF0, 0xE9, 0x99, 0x9C, 0x50, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9C, 0x28, 0x49, 0x9A, 
-    0x31, 0x20, 0xD9, 0x9A, 0x36, 0x33, 0x99, 0x99, 0xD8, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 
-    0x11, 0x2B, 0x99, 0x9A, 0x11, 0x2D, 0x99, 0x99, 0x33, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x33, 0x99, 0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0xCF, 0x0E, 0x99, 0x99, 
-    0xC5, 0x0D, 0x99, 0x99, 0x1C, 0xC3, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0x12, 0x0D, 0x99, 0xA3, 
-    0x63, 0x39, 0x99, 0x9E, 0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 
-    0x10, 0xE9, 0x99, 0x93, 0x33, 0x99, 0x99, 0x93, 0x33, 0x3A, 0x99, 0x93, 0x33, 0x99, 0x99, 0x9C, 
-    0xF0, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x9C, 0xF0, 0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x91, 
-    0xF5, 0x49, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x31, 0x20, 0xD9, 0x9A, 0x36, 0x33, 0x99, 0x94, 0x88, 
-    0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x2E, 0x99, 0x99, 0xCC, 
-    0x19, 0x99, 0x99, 0x33, 0x33, 0xA9, 0x99, 0x33, 0x39, 0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 0x88, 
-    0x8E, 0x99, 0x99, 0xCF, 0x0E, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0x99, 0xCF, 
-    0x0D, 0x99, 0xA3, 0x12, 0x0D, 0x99, 0xA3, 0x63, 0x39, 0x99, 0xD8, 0x88, 0xB9, 0x99, 0xA1, 0x10, 
-    0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x50, 0x29, 0x99, 0x93, 0x33, 
-    0x99, 0x99, 0x93, 0x33, 0x99, 0x99, 0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x9C, 0xF0, 
-    0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x31, 0x20, 
-    0xD9, 0x9A, 0x36, 0x33, 0x99, 0x9E, 0x88, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 0x2B, 
-    0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0x33, 0x39, 0x99, 0x99, 0x33, 0x39, 
-    0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0xCF, 0x0E, 0x99, 0x99, 0xC5, 0x0D, 
-    0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0x12, 0x0D, 0x99, 0xA3, 0x63, 0x39, 
-    0x99, 0xB8, 0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 0xE9, 
-    0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF2, 0x49, 0x99, 0x93, 0x33, 0x99, 0x99, 0x9C, 0xF0, 0x88, 
-    0x88, 0x88, 0x88, 0xE9, 0x99, 0x9C, 0xF0, 0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x29, 
-    0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x31, 0x20, 0xD9, 0x9A, 0x36, 0x33, 0xA9, 0x48, 0x88, 0x8B, 0x99, 
-    0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 
-    0x99, 0xCF, 0x0E, 0x99, 0x99, 0x33, 0x39, 0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 0x88, 0x8E, 0x99, 
-    0x99, 0xCF, 0x24, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xCF, 0x0D, 0x99, 
-    0xA3, 0x12, 0x0D, 0x99, 0xA3, 0x63, 0x39, 0x92, 0x88, 0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 
-    0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF0, 0x29, 0x99, 
-    0x93, 0x33, 0x99, 0x99, 0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x91, 0x99, 0x99, 0x99, 
-    0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x31, 0x20, 0xD9, 0x9A, 
-    0x36, 0x33, 0x99, 0xE8, 0x88, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 
-    0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0x33, 0x34, 0x99, 0x99, 
-    0xCF, 0x08, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 
-    0xCF, 0x02, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0x12, 0x0D, 0x99, 0xA3, 0x63, 0x39, 0x4B, 0x88, 
-    0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 
-    0x10, 0x29, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x93, 0x10, 0xD9, 0x99, 0x9C, 0xF0, 0x88, 0x88, 0x88, 
-    0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 
-    0xF0, 0xD9, 0x9A, 0x31, 0x20, 0xD9, 0x9A, 0x36, 0x33, 0x94, 0x88, 0x88, 0x8B, 0x99, 0x9A, 0x11, 
-    0x0B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0xCF, 
-    0x02, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 
-    0xA9, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0x12, 
-    0x0D, 0x99, 0xA3, 0x63, 0x39, 0xD8, 0x88, 0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 
-    0xB9, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0x50, 
-    0xD9, 0x99, 0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x9A, 0x91, 0x19, 0x99, 0x9C, 0x50, 
-    0xD9, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x31, 0x20, 0x49, 0x9A, 0x36, 0x33, 
-    0x92, 0x88, 0x88, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x0E, 
-    0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x08, 
-    0x88, 0x88, 0x88, 0x8E, 0x99, 0xA9, 0x1C, 0x11, 0xA9, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x02, 
-    0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0xC2, 0x04, 0x99, 0xA3, 0x63, 0x39, 0xE8, 0x88, 0x88, 0xB9, 
-    0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x10, 0x29, 
-    0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0x27, 
-    0x91, 0xC1, 0x1F, 0x49, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0xF0, 0xD9, 
-    0x9A, 0x3C, 0x20, 0x49, 0x9A, 0x36, 0x33, 0x9E, 0x88, 0x88, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 
-    0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0xCF, 0x02, 0x99, 
-    0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 0x88, 0x8E, 0x41, 0xC1, 0xF2, 0x02, 0x99, 
-    0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0xC2, 0x04, 0x99, 
-    0xA3, 0x63, 0x39, 0xB8, 0x88, 0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 
-    0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0x50, 0xD9, 0x99, 
-    0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0xFF, 0x22, 0x08, 0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 
-    0x9C, 0xF0, 0x29, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x3C, 0x2E, 0xA9, 0x9A, 0x36, 0x33, 0xAB, 0x88, 
-    0x88, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 
-    0xC1, 0x02, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x08, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x00, 0x88, 0x8E, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 
-    0xCF, 0x0D, 0x99, 0xA3, 0xC2, 0x29, 0x99, 0xA3, 0x63, 0x34, 0x88, 0x88, 0x88, 0xB9, 0x99, 0xA1, 
-    0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 
-    0xF0, 0x29, 0x99, 0x9C, 0x50, 0xD7, 0x9A, 0x9C, 0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x48, 
-    0x88, 0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x3C, 
-    0x22, 0x99, 0x9A, 0x36, 0x33, 0x48, 0x88, 0x88, 0x8B, 0x99, 0x9A, 0x11, 0x0B, 0x99, 0x9A, 0x11, 
-    0x2B, 0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xC5, 
-    0x02, 0x43, 0x33, 0x1F, 0x08, 0x88, 0x88, 0x88, 0x88, 0xE4, 0x99, 0xF0, 0x8E, 0x99, 0x99, 0xC5, 
-    0x0D, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xCF, 0x0D, 0x99, 0xA3, 0xC2, 0x29, 0x99, 0xA3, 0x63, 
-    0x34, 0x88, 0x88, 0x88, 0xB9, 0x99, 0xA1, 0x10, 0xB9, 0x99, 0xA1, 0x12, 0xB9, 0x99, 0xA1, 0x10, 
-    0xE9, 0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF0, 0x29, 0x99, 0x9C, 0x50, 0x80, 0xF1, 0x11, 0xF0, 
-    0x88, 0x88, 0x88, 0x88, 0xE7, 0x99, 0x91, 0x20, 0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 
-    0x29, 0x99, 0x9C, 0xF0, 0xD9, 0x9A, 0x3C, 0x22, 0x99, 0x9A, 0x36, 0x33, 0x48, 0x88, 0x88, 0x8B, 
-    0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x2B, 0x99, 0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 
-    0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xC5, 0x08, 0xBB, 0x22, 0x02, 0x08, 0x88, 0x88, 0x88, 0x82, 
-    0x99, 0x99, 0x99, 0x44, 0x99, 0x99, 0xC5, 0x0D, 0x99, 0x99, 0x99, 0x49, 0x99, 0x99, 0xCF, 0x0D, 
-    0x99, 0x99, 0x94, 0x99, 0x99, 0xA3, 0x63, 0x34, 0x88, 0x88, 0x88, 0xB9, 0x99, 0x99, 0x94, 0x49, 
-    0x99, 0x99, 0x94, 0x49, 0x99, 0xA1, 0x10, 0xE9, 0x99, 0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF0, 0x29, 
-    0x99, 0x9C, 0x50, 0xD9, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9C, 0x50, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xF0, 0xD9, 0x99, 0x99, 0x99, 0x99, 
-    0x9A, 0x36, 0x33, 0x48, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x9A, 0x11, 0x0E, 0x99, 0x99, 0xC1, 0x02, 0x99, 0x99, 0xCF, 0x02, 0x99, 0x99, 0xC5, 0x0D, 0x99, 
-    0x94, 0x10, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 0x99, 0x99, 0xA1, 0x1F, 0x08, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0xA1, 0x1F, 0x0B, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA3, 0x33, 0x3A, 0x88, 
-    0x88, 0x88, 0x82, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x91, 0x10, 0xE9, 0x99, 
-    0x9C, 0x10, 0x29, 0x99, 0x9C, 0xF0, 0xE9, 0x99, 0x9C, 0x50, 0xD9, 0x99, 0x9C, 0xF0, 0x88, 0x88, 
-    0x88, 0x88, 0x8B, 0x49, 0xAA, 0xAA, 0xAA, 0xA1, 0x11, 0x20, 0x8B, 0x99, 0xAA, 0xAA, 0xAA, 0x91, 
-    0x11, 0x20, 0x8E, 0x99, 0xAA, 0xAA, 0xAA, 0x93, 0x63, 0x33, 0x9D, 0x88, 0x88, 0x88, 0x8D, 0x99, 
-    0xAA, 0xAA, 0x9C, 0xC4, 0x99, 0xAA, 0xAA, 0x9C, 0x1F, 0x0E, 0x79, 0xAA, 0xC1, 0x02, 0x79, 0xA9, 
-    0xCF, 0x02, 0x7A, 0xAA, 0xC5, 0x0D, 0x7A, 0xA9, 0xCF, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x21, 
-    0x11, 0x11, 0x1C, 0x11, 0x22, 0x88, 0x88, 0x43, 0x11, 0x11, 0x1C, 0x11, 0x22, 0x88, 0xE4, 0x33, 
-    0x33, 0x33, 0x33, 0x63, 0x33, 0x99, 0x94, 0xE8, 0x88, 0x88, 0x8E, 0x11, 0x11, 0x1C, 0x15, 0x22, 
-    0x11, 0x11, 0x1C, 0xCF, 0x20, 0x8E, 0x11, 0x1C, 0x10, 0xB2, 0x11, 0x11, 0xF0, 0xB2, 0x11, 0x11, 
-    0x50, 0xB2, 0x11, 0x11, 0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x0F, 0x55, 0x55, 0x5F, 0x22, 
-    0x08, 0x88, 0x88, 0x25, 0x55, 0x55, 0x5F, 0x20, 0x02, 0x49, 0x99, 0x33, 0x33, 0x33, 0x33, 0x33, 
-    0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x80, 0xF5, 0x55, 0xFF, 0x20, 0x80, 0xF5, 0x55, 0xF2, 0x20, 
-    0x88, 0x80, 0x55, 0xFF, 0x28, 0x80, 0xF5, 0xFF, 0x08, 0x80, 0xF5, 0xFF, 0x08, 0x80, 0xF5, 0xF5, 
-    0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x80, 
-    0x00, 0x08, 0x0E, 0xD4, 0x99, 0x99, 0x9A, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x99, 0x99, 0x4B, 
-    0x88, 0x88, 0x88, 0x80, 0x00, 0x00, 0x88, 0x88, 0x80, 0x00, 0x08, 0x88, 0x88, 0x88, 0x00, 0x00, 
-    0x88, 0x88, 0x00, 0x08, 0x88, 0x88, 0x00, 0x00, 0x88, 0x88, 0x00, 0x08, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xBD, 0xA9, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x24, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB2, 0xA9, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDB, 0xB4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 
-    0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x2A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x9D, 0x08, 0x88, 0x8D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE8, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDB, 0x88, 0x88, 0x88, 
-    0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE4, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x42, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x94, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x40, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x8B, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDE, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x8B, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0xA2, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 
-    0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x94, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4E, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x9D, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x4E, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xD9, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0xB9, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 
-    0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xB8, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x99, 0x08, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x04, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 
-    0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x04, 0x99, 0x99, 0x99, 0x94, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4B, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x49, 0x99, 0x99, 0x99, 0x9B, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x8B, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x99, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 
-    0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x94, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE8, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xB9, 0x99, 0x99, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0xB4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x49, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8D, 0x99, 0x99, 0x99, 
-    0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x4E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x94, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x90, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 
-    0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x94, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE4, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xB4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 
-    0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x8E, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xD9, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xB9, 0x99, 0x99, 0x99, 0x99, 0xE8, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0xD9, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x2E, 0xB8, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0x99, 0x99, 0x99, 
-    0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0xB4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x09, 0x99, 0x99, 0x99, 0x99, 0x08, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x84, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x1A, 0x99, 0x99, 0x99, 0x99, 0x99, 
-    0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x8B, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x04, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x9B, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xD9, 0x99, 
-    0x99, 0x99, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x99, 0x9B, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0x9A, 0x99, 0x99, 
-    0x99, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x28, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x9A, 0x99, 0x99, 0x99, 0x9E, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0xE4, 0x99, 0x99, 0x99, 0x94, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x29, 0x99, 0x99, 0x99, 0x4E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x49, 
-    0x99, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0xBE, 0x22, 0x2E, 0xB8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xEE, 0xEB, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 
+const uint8_t YOU_WIN_P2_PIC_RLE[YOU_WIN_P2_PIC_RLE_SIZE] = {
+    0xF8, 0xFF, 0xF8, 0x7B, 0x04, 0xBE, 0xD2, 0xE0, 0xF8, 0x67, 0x01, 0x0D, 0xB9, 0x00, 0xD0, 0xF8, 
+    0x64, 0x01, 0xED, 0xE9, 0x00, 0x20, 0xF8, 0x61, 0x01, 0xE4, 0xF9, 0x01, 0x00, 0x40, 0xF8, 0x5F, 
+    0x01, 0x0D, 0xF9, 0x03, 0x7F, 0xF8, 0x1D, 0x02, 0xB2, 0x40, 0xF9, 0x04, 0x7F, 0xF8, 0x1C, 0x00, 
+    0x20, 0xF9, 0x07, 0x00, 0xE0, 0xF8, 0x5A, 0x01, 0xBD, 0xF9, 0x07, 0x00, 0xD0, 0xF8, 0x5A, 0x01, 
+    0xE4, 0xF9, 0x07, 0x00, 0x20, 0xF8, 0x08, 0x00, 0xB0, 0xC2, 0x00, 0xE0, 0xF8, 0x41, 0x00, 0x40, 
+    0xF9, 0x07, 0x01, 0xDB, 0xF8, 0x06, 0x02, 0xB2, 0x40, 0xE9, 0x02, 0x4D, 0xB0, 0xF8, 0x3D, 0x00, 
+    0xD0, 0xF9, 0x06, 0x01, 0xD0, 0xF8, 0x07, 0x00, 0x20, 0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x3B, 0x00, 
+    0xD0, 0xF9, 0x05, 0x01, 0xD0, 0xF8, 0x07, 0x01, 0xB4, 0xF9, 0x07, 0x01, 0x4E, 0xF8, 0x38, 0x00, 
+    0xD0, 0xF9, 0x04, 0x01, 0xD0, 0xF8, 0x08, 0x00, 0xB0, 0xF9, 0x0B, 0x00, 0xE0, 0xF8, 0x36, 0x00, 
+    0xE0, 0xF9, 0x03, 0x01, 0x4E, 0xF8, 0x09, 0x00, 0xB0, 0xF9, 0x0D, 0x00, 0xE0, 0xF8, 0x35, 0x00, 
+    0x40, 0xF9, 0x02, 0x00, 0x20, 0xF8, 0x0B, 0x00, 0x40, 0xF9, 0x0E, 0x00, 0xB0, 0xF8, 0x33, 0x00, 
+    0xE0, 0xF9, 0x01, 0x01, 0x4B, 0xF8, 0x0B, 0x00, 0x20, 0xF9, 0x0F, 0x00, 0xD0, 0xF8, 0x33, 0x00, 
+    0x40, 0xF9, 0x00, 0x00, 0x40, 0xF8, 0x0C, 0x02, 0x01, 0x40, 0xF9, 0x0F, 0x00, 0xE0, 0xF8, 0x32, 
+    0x00, 0xD0, 0xE9, 0x00, 0x40, 0xF8, 0x0D, 0x00, 0x20, 0xF9, 0x11, 0x00, 0xD0, 0x7F, 0x42, 0x00, 
+    0xE0, 0xF8, 0x0C, 0x00, 0x40, 0xF9, 0x12, 0x00, 0xB0, 0xF8, 0x31, 0x00, 0x20, 0xF9, 0x01, 0x01, 
+    0xDB, 0xF8, 0x09, 0x00, 0xE0, 0xF9, 0x13, 0x00, 0xE0, 0xF8, 0x31, 0x00, 0xE0, 0xF9, 0x03, 0x01, 
+    0x2B, 0xF8, 0x07, 0x00, 0x20, 0xF9, 0x13, 0x00, 0xD0, 0xF8, 0x32, 0x00, 0xD0, 0xF9, 0x03, 0x02, 
+    0x4D, 0xB0, 0xF8, 0x05, 0x00, 0xD0, 0x7F, 0xF8, 0x0E, 0x00, 0x00, 0xF9, 0x02, 0x05, 0xA9, 0x99, 
+    0xDE, 0x7F, 0xF8, 0x1C, 0x00, 0xE0, 0xF9, 0x07, 0x02, 0x42, 0x00, 0x7F, 0xF8, 0x1A, 0x00, 0xE0, 
+    0xF9, 0x07, 0x04, 0x31, 0x42, 0xE0, 0x7F, 0xF8, 0x18, 0x01, 0x24, 0xF9, 0x0A, 0x06, 0x4D, 0xEB, 
+    0x88, 0x20, 0x7F, 0xF8, 0x13, 0x00, 0xD0, 0xF9, 0x0D, 0x01, 0xDE, 0x58, 0x03, 0xA9, 0x92, 0xF8, 
+    0x38, 0x01, 0x04, 0xF9, 0x2A, 0x00, 0x00, 0xF8, 0x3A, 0x01, 0xE4, 0xF9, 0x27, 0x00, 0x40, 0xF8, 
+    0x3D, 0x01, 0xED, 0xF9, 0x25, 0x00, 0x20, 0xF8, 0x3F, 0x02, 0xBD, 0x40, 0xF9, 0x21, 0x00, 0x40, 
+    0xF8, 0x43, 0x02, 0xED, 0x40, 0xF9, 0x1E, 0x00, 0xE0, 0xF8, 0x45, 0x02, 0xBE, 0x40, 0xF9, 0x1B, 
+    0x00, 0x20, 0xF8, 0x49, 0x03, 0xB2, 0xD4, 0x5F, 0x00, 0xE0, 0xF8, 0x4C, 0x02, 0xED, 0x40, 0xF9, 
+    0x16, 0x03, 0x4D, 0xEB, 0xF8, 0x4B, 0x02, 0x02, 0x40, 0xF9, 0x17, 0x02, 0x42, 0xB0, 0xF8, 0x4A, 
+    0x5F, 0x05, 0x99, 0x94, 0x2E, 0xF8, 0x46, 0x00, 0xE0, 0xF9, 0x1F, 0x02, 0xDE, 0xB0, 0xF8, 0x42, 
+    0x00, 0xD0, 0xF9, 0x00, 0x03, 0xEE, 0xD4, 0xF9, 0x15, 0x02, 0x42, 0x00, 0xF8, 0x3E, 0x00, 0xB0, 
+    0xF9, 0x00, 0x00, 0xD0, 0xA8, 0x02, 0xE2, 0x40, 0xF9, 0x15, 0x02, 0x42, 0xE0, 0xF8, 0x10, 0x02, 
+    0xB8, 0xB0, 0xB8, 0x02, 0xB8, 0xB0, 0xE8, 0xBB, 0xE8, 0x02, 0xB8, 0xB0, 0xB8, 0x03, 0xBB, 0xB2, 
+    0xF9, 0x00, 0x03, 0xE8, 0xBB, 0xA8, 0x03, 0xBE, 0xD4, 0xF9, 0x14, 0x02, 0x4D, 0xE0, 0xC8, 0x02, 
+    0xB8, 0xB0, 0xF8, 0x03, 0x00, 0xE0, 0xA9, 0x03, 0xB8, 0x8E, 0xA9, 0x00, 0x00, 0xA8, 0x00, 0xD0, 
+    0xD9, 0x01, 0x40, 0xA8, 0x08, 0xD9, 0x99, 0xD8, 0x88, 0xD0, 0xF9, 0x02, 0x03, 0xA4, 0x8B, 0xA9, 
+    0x03, 0xE8, 0x88, 0xA9, 0x01, 0x44, 0xF9, 0x13, 0x09, 0x42, 0xB8, 0x8D, 0x99, 0x94, 0xF8, 0x02, 
+    0x00, 0x20, 0xA9, 0x01, 0x10, 0x44, 0x04, 0x10, 0x88, 0x40, 0xF9, 0x01, 0x11, 0x28, 0x88, 0x49, 
+    0x99, 0x45, 0x88, 0x49, 0x99, 0x33, 0xD9, 0x00, 0x20, 0x44, 0x03, 0x12, 0x8B, 0xA9, 0x09, 0x1F, 
+    0xBE, 0x99, 0x9A, 0x33, 0xC9, 0x01, 0x33, 0xF9, 0x04, 0x02, 0x39, 0x20, 0x44, 0x01, 0x10, 0xF8, 
+    0x00, 0x00, 0xE0, 0xA9, 0x02, 0xCF, 0x00, 0x43, 0x03, 0xC5, 0x0E, 0xF9, 0x01, 0x02, 0xA3, 0xF0, 
+    0x43, 0x0C, 0xA3, 0x12, 0x0D, 0x99, 0xA3, 0x63, 0x30, 0xB9, 0x00, 0xB0, 0x43, 0x03, 0xA1, 0x10, 
+    0x42, 0x04, 0xA1, 0x10, 0x80, 0x44, 0x00, 0x30, 0x45, 0x00, 0x30, 0xF9, 0x02, 0x05, 0xA3, 0x39, 
+    0x44, 0xA9, 0x02, 0xCF, 0x00, 0x56, 0x00, 0x20, 0xF9, 0x03, 0x01, 0xC2, 0x53, 0x01, 0xD8, 0x4E, 
+    0x01, 0x2B, 0x42, 0x03, 0x11, 0x2D, 0x50, 0x03, 0x99, 0x33, 0xC9, 0x59, 0x00, 0xD0, 0xA9, 0x03, 
+    0x1C, 0xC3, 0x43, 0x02, 0xF0, 0xD0, 0x51, 0x00, 0xE0, 0x57, 0x01, 0x0E, 0x4A, 0xA3, 0x00, 0xA0, 
+    0x43, 0x00, 0x30, 0x64, 0x02, 0xF5, 0x40, 0x58, 0x01, 0x48, 0x57, 0x00, 0x20, 0x43, 0x02, 0xCC, 
+    0x10, 0x73, 0x03, 0xCF, 0x0D, 0x58, 0x00, 0xD0, 0x58, 0x00, 0x00, 0x44, 0x02, 0x50, 0x20, 0x45, 
+    0xB9, 0x69, 0x00, 0x20, 0x58, 0x00, 0xE0, 0x5F, 0x00, 0x10, 0x7F, 0x51, 0x00, 0xB0, 0x66, 0x03, 
+    0xCF, 0x24, 0x7F, 0x44, 0x02, 0xA9, 0x40, 0xA8, 0x65, 0x01, 0x0E, 0x5C, 0x01, 0x24, 0x65, 0x02, 
+    0x99, 0x20, 0x6A, 0x00, 0x20, 0x5A, 0x00, 0x10, 0xD9, 0x63, 0x00, 0xE0, 0x72, 0x00, 0x40, 0x52, 
+    0xE9, 0x62, 0x01, 0x4B, 0x70, 0x02, 0x10, 0xD0, 0x7F, 0xB8, 0x6B, 0x01, 0xC5, 0x56, 0x00, 0xA0, 
+    0x67, 0x00, 0xD0, 0x7F, 0x47, 0x03, 0xA9, 0x11, 0x5D, 0x00, 0x40, 0x46, 0x00, 0x20, 0x7F, 0x45, 
+    0x06, 0xA9, 0x1C, 0x11, 0xA0, 0x59, 0x00, 0xC0, 0x49, 0x00, 0xE0, 0x7F, 0xA8, 0x08, 0x27, 0x91, 
+    0xC1, 0x1F, 0x40, 0xA9, 0x7F, 0x67, 0x08, 0xE4, 0x1C, 0x1F, 0x20, 0x20, 0x66, 0x00, 0xB0, 0x7F, 
+    0xC8, 0x06, 0xFF, 0x22, 0x08, 0xE0, 0x5C, 0x01, 0xEA, 0x45, 0x00, 0xA0, 0x7F, 0xE8, 0x03, 0x00, 
+    0x88, 0x5E, 0x01, 0x29, 0x45, 0x00, 0x40, 0xC8, 0x6F, 0x02, 0x79, 0xA0, 0x4D, 0x01, 0x24, 0x7F, 
+    0x5F, 0x05, 0x24, 0x33, 0x31, 0x49, 0x05, 0xE4, 0x99, 0xF0, 0x7F, 0x5D, 0x04, 0x80, 0xF1, 0x10, 
+    0x49, 0x07, 0xE7, 0x99, 0x91, 0x20, 0x74, 0x00, 0x20, 0x67, 0x05, 0xBB, 0x22, 0x02, 0x47, 0x00, 
+    0x20, 0xC9, 0x01, 0x44, 0x4A, 0x02, 0x99, 0x40, 0xB9, 0x44, 0x03, 0x99, 0x94, 0xA9, 0x4E, 0x04, 
+    0x99, 0x94, 0x40, 0xC9, 0x01, 0x44, 0x5D, 0x04, 0xD9, 0x99, 0x40, 0xF8, 0x02, 0x00, 0xE0, 0xF9, 
+    0x03, 0x03, 0xC5, 0x02, 0xF9, 0x03, 0x00, 0x10, 0x46, 0xB9, 0x4A, 0x00, 0x80, 0xF9, 0x0A, 0x5F, 
+    0x01, 0x10, 0xF8, 0x01, 0x00, 0x40, 0xF9, 0x00, 0x05, 0xA1, 0x1F, 0x08, 0xF9, 0x01, 0x05, 0xA1, 
+    0x1F, 0x0B, 0x4A, 0x03, 0x33, 0x3A, 0xD8, 0x01, 0x27, 0xF9, 0x07, 0x01, 0xA9, 0x51, 0x00, 0xE0, 
+    0x49, 0x03, 0x9C, 0xF0, 0xF8, 0x00, 0x02, 0xB4, 0x90, 0xDA, 0x08, 0x11, 0x12, 0x08, 0xB9, 0x90, 
+    0xCA, 0x09, 0x91, 0x11, 0x20, 0x8E, 0x99, 0xCA, 0x07, 0x93, 0x63, 0x33, 0x9D, 0xD8, 0x02, 0xD9, 
+    0x90, 0xAA, 0x05, 0x9C, 0xC4, 0x99, 0xAA, 0x09, 0x9C, 0x1F, 0x0E, 0x79, 0xAA, 0x42, 0x02, 0x79, 
+    0xA0, 0x42, 0x04, 0x27, 0xAA, 0xA0, 0x42, 0x02, 0x7A, 0xA0, 0x4B, 0x02, 0x88, 0x20, 0xC1, 0x04, 
+    0xC1, 0x12, 0x20, 0xA8, 0x01, 0x43, 0xB1, 0x08, 0xC1, 0x12, 0x28, 0x8E, 0x40, 0xE3, 0x08, 0x63, 
+    0x33, 0x99, 0x94, 0xE0, 0xC8, 0x00, 0xE0, 0xB1, 0x04, 0xC1, 0x52, 0x20, 0xB1, 0x0E, 0xCC, 0xF2, 
+    0x08, 0xE1, 0x11, 0xC1, 0x0B, 0x20, 0xA1, 0x03, 0xF0, 0xB2, 0xA1, 0x03, 0x50, 0xB2, 0xA1, 0x4B, 
+    0x02, 0x80, 0xF0, 0xB5, 0x03, 0xF2, 0x20, 0xB8, 0x00, 0x20, 0xC5, 0x08, 0xF2, 0x00, 0x24, 0x99, 
+    0x90, 0xF3, 0x01, 0xC9, 0x00, 0x20, 0xC8, 0x32, 0x0F, 0x55, 0x5F, 0xF2, 0x08, 0x0F, 0x55, 0x5F, 
+    0x22, 0x08, 0x88, 0x05, 0x5F, 0xF2, 0x88, 0x0F, 0x5F, 0xF0, 0x88, 0x0F, 0x5F, 0xF0, 0x88, 0x0F, 
+    0x5F, 0x50, 0x4B, 0x01, 0x88, 0xD0, 0xF8, 0x00, 0xA0, 0x04, 0x80, 0xED, 0x40, 0xB9, 0x00, 0xA0, 
+    0xC9, 0x00, 0x30, 0xF9, 0x00, 0x01, 0x4B, 0xD8, 0xB0, 0xB8, 0xA0, 0xD8, 0xA0, 0xA8, 0x02, 0x00, 
+    0x00, 0xB8, 0xA0, 0xA8, 0x02, 0x00, 0x00, 0xF8, 0x1A, 0x02, 0xBD, 0xA0, 0xF9, 0x11, 0x00, 0xE0, 
+    0xF8, 0x4E, 0x01, 0xE4, 0xF9, 0x15, 0x00, 0x20, 0xF8, 0x4B, 0x01, 0x24, 0xF9, 0x0A, 0x00, 0xA0, 
+    0xF9, 0x04, 0x00, 0xD0, 0xF8, 0x47, 0x02, 0xB2, 0xA0, 0xF9, 0x0A, 0x03, 0xDB, 0xB4, 0xF9, 0x04, 
+    0x01, 0x4B, 0xF8, 0x43, 0x02, 0xB2, 0xA0, 0xF9, 0x0A, 0x01, 0xD0, 0xA8, 0x00, 0xD0, 0xF9, 0x05, 
+    0x00, 0xE0, 0xF8, 0x41, 0x00, 0x20, 0xF9, 0x0B, 0x01, 0xDB, 0xD8, 0x00, 0x20, 0xF9, 0x05, 0x00, 
+    0x20, 0xF8, 0x3E, 0x01, 0xE4, 0xF9, 0x09, 0x02, 0x42, 0xB0, 0xF8, 0x01, 0x00, 0xE0, 0xF9, 0x05, 
+    0x00, 0xD0, 0xF8, 0x3C, 0x00, 0xD0, 0xF9, 0x09, 0x01, 0x4E, 0xF8, 0x05, 0x01, 0xB4, 0xF9, 0x04, 
+    0x01, 0x40, 0xF8, 0x38, 0x01, 0xB4, 0xF9, 0x08, 0x01, 0xDE, 0xF8, 0x08, 0x01, 0xBD, 0xF9, 0x05, 
+    0x00, 0x20, 0xF8, 0x37, 0x00, 0x40, 0xF9, 0x06, 0x02, 0xA2, 0xB0, 0xF8, 0x0C, 0x00, 0x20, 0xF9, 
+    0x05, 0x00, 0xD0, 0xF8, 0x35, 0x00, 0x20, 0xF9, 0x05, 0x01, 0x42, 0xF8, 0x10, 0x00, 0xE0, 0xF9, 
+    0x05, 0x01, 0x4B, 0xF8, 0x33, 0x00, 0x40, 0xF9, 0x03, 0x01, 0x4E, 0xF8, 0x13, 0x01, 0xB4, 0xF9, 
+    0x05, 0x00, 0xE0, 0xF8, 0x31, 0x00, 0xB0, 0xF9, 0x02, 0x01, 0xDE, 0xF8, 0x17, 0x00, 0x20, 0xF9, 
+    0x05, 0x00, 0xD0, 0xF8, 0x30, 0x00, 0xE0, 0xF9, 0x00, 0x01, 0x4E, 0xF8, 0x1A, 0x00, 0xE0, 0xF9, 
+    0x05, 0x01, 0x4B, 0x7E, 0x00, 0x40, 0xF8, 0x1D, 0x01, 0xBD, 0xF9, 0x05, 0x00, 0xE0, 0xF8, 0x2D, 
+    0x00, 0xB0, 0xE9, 0x00, 0xD0, 0xF8, 0x1F, 0x00, 0xD0, 0xF9, 0x05, 0x00, 0x20, 0x7C, 0x00, 0x40, 
+    0xF8, 0x20, 0x00, 0xE0, 0xF9, 0x05, 0x01, 0x4B, 0xF8, 0x2B, 0x00, 0x40, 0xE9, 0x00, 0x00, 0xF8, 
+    0x20, 0x03, 0x04, 0x9A, 0xF9, 0x02, 0x01, 0x4E, 0xF8, 0x2A, 0x00, 0xD0, 0xE9, 0x00, 0x20, 0xF8, 
+    0x22, 0x00, 0xD0, 0xF9, 0x05, 0x00, 0x20, 0xF8, 0x29, 0x00, 0xE0, 0xE9, 0x00, 0xD0, 0xF8, 0x23, 
+    0x00, 0x20, 0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x28, 0x01, 0x04, 0xD9, 0x00, 0x40, 0xF8, 0x24, 0x02, 
+    0xEA, 0xA0, 0xF9, 0x03, 0x01, 0x4B, 0xF8, 0x27, 0x46, 0x01, 0x9B, 0xF8, 0x24, 0x01, 0xB4, 0xF9, 
+    0x05, 0x00, 0x20, 0x76, 0x00, 0xE0, 0xF8, 0x26, 0x00, 0xD0, 0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x25, 
+    0x00, 0x20, 0xE9, 0x00, 0xD0, 0xF8, 0x27, 0x00, 0x20, 0xF9, 0x05, 0x01, 0x4B, 0xF8, 0x23, 0x00, 
+    0xE0, 0xE9, 0x00, 0x40, 0xF8, 0x28, 0x01, 0xE4, 0xF9, 0x04, 0x01, 0xAE, 0xF8, 0x22, 0x00, 0xB0, 
+    0xF9, 0x00, 0x00, 0xB0, 0xF8, 0x28, 0x01, 0xB4, 0xF9, 0x05, 0x00, 0x20, 0xF8, 0x22, 0x00, 0x40, 
+    0xE9, 0x00, 0x20, 0xF8, 0x2A, 0x00, 0x20, 0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x21, 0x00, 0xD0, 0xE9, 
+    0x00, 0xD0, 0xF8, 0x2B, 0x00, 0xE0, 0xF9, 0x05, 0x01, 0x4E, 0xF8, 0x1F, 0x00, 0xE0, 0xE9, 0x00, 
+    0x40, 0xF8, 0x2C, 0x01, 0xB4, 0xF9, 0x05, 0x00, 0x20, 0xF8, 0x1E, 0x00, 0xB0, 0xF9, 0x00, 0x00, 
+    0x00, 0xF8, 0x2D, 0x00, 0xD0, 0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x1E, 0x00, 0x40, 0xE9, 0x00, 0x20, 
+    0xF8, 0x2E, 0x00, 0x20, 0xF9, 0x05, 0x01, 0x4B, 0xF8, 0x1C, 0x00, 0x20, 0xE9, 0x00, 0x40, 0xF8, 
+    0x2F, 0x01, 0xE4, 0xF9, 0x05, 0x00, 0xE0, 0xF8, 0x1B, 0x00, 0xB0, 0xF9, 0x00, 0x00, 0xB0, 0xF8, 
+    0x2F, 0x01, 0xB4, 0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x1B, 0x00, 0x40, 0xE9, 0x00, 0x20, 0xF8, 0x31, 
+    0x00, 0x40, 0xF9, 0x05, 0x00, 0x40, 0xF8, 0x1A, 0x00, 0xD0, 0xE9, 0x00, 0xD0, 0xF8, 0x32, 0x01, 
+    0xE4, 0xF9, 0x04, 0x01, 0x4E, 0xF8, 0x18, 0x00, 0xE0, 0xE9, 0x00, 0x40, 0xF8, 0x33, 0x01, 0xBD, 
+    0xF9, 0x05, 0x00, 0x20, 0xF8, 0x17, 0x00, 0xB0, 0xF9, 0x00, 0x00, 0xE0, 0xF8, 0x34, 0x00, 0x20, 
+    0xF9, 0x05, 0x00, 0xD0, 0xF8, 0x17, 0x00, 0xD0, 0xE9, 0x00, 0xD0, 0xF8, 0x35, 0x01, 0xEA, 0xF9, 
+    0x04, 0x03, 0x42, 0xEB, 0xF8, 0x13, 0x00, 0xE0, 0xE9, 0x00, 0x40, 0xF8, 0x36, 0x01, 0xB4, 0xF9, 
+    0x07, 0x00, 0xD0, 0xF8, 0x12, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xF8, 0x37, 0x00, 0x20, 0xF9, 
+    0x07, 0x00, 0xD0, 0xF8, 0x11, 0x00, 0x40, 0xF9, 0x00, 0x00, 0x20, 0xF8, 0x38, 0x00, 0x20, 0xF9, 
+    0x07, 0x00, 0x20, 0xF8, 0x0F, 0x00, 0x20, 0xF9, 0x01, 0x00, 0x40, 0xF8, 0x39, 0x01, 0x04, 0x64, 
+    0x02, 0x01, 0xA0, 0xF9, 0x01, 0x00, 0xB0, 0xF8, 0x39, 0x01, 0xB4, 0xF9, 0x03, 0x00, 0xD0, 0xF8, 
+    0x0F, 0x01, 0x04, 0x7F, 0xF8, 0x06, 0x00, 0xD0, 0xF9, 0x02, 0x00, 0xB0, 0xF8, 0x10, 0x00, 0xD0, 
+    0xF9, 0x02, 0x7F, 0xB8, 0x00, 0x20, 0x62, 0x02, 0xB9, 0xA0, 0xE9, 0x00, 0x40, 0xF8, 0x3E, 0x00, 
+    0xE0, 0xF9, 0x00, 0x00, 0x20, 0xF8, 0x11, 0x02, 0x99, 0xA0, 0xD9, 0x00, 0xE0, 0xF8, 0x3F, 0x01, 
+    0xE4, 0xD9, 0x00, 0x40, 0xF8, 0x11, 0x00, 0x20, 0xD9, 0x01, 0x4E, 0xF8, 0x42, 0x01, 0x44, 0xA9, 
+    0x00, 0x20, 0xF8, 0x13, 0x06, 0xBE, 0x22, 0x2E, 0xB0, 0xF8, 0x46, 0x03, 0xEE, 0xEB, 0xF8, 0xFF, 
+    0xF8, 0xD5, 
+};
+
+const gfx_image_t YOU_WIN_P2_PIC_IMG = {
+    .w = YOU_WIN_P2_PIC_W, .h = YOU_WIN_P2_PIC_H, .fmt = GFX_IMG_PAL4_RLE,
+    .pal = YOU_WIN_P2_PIC_PAL, .colors = YOU_WIN_P2_PIC_PAL_SIZE,
+    .data = YOU_WIN_P2_PIC_RLE, .size = YOU_WIN_P2_PIC_RLE_SIZE,
 };